@@ -35,7 +35,10 @@ ClassImp(AliCFContainer)
 AliCFContainer::AliCFContainer() : 
   AliCFFrame(),
   fNStep(0),
-  fGrid(0x0)
+  fGrid(0x0),
+  fCoord(),
+  fDenseThreshold(kDefaultDenseBins),
+  fDenseChecked(kFALSE)
 {
   //
   // default constructor
@@ -46,7 +49,10 @@ AliCFContainer::AliCFContainer() :
 AliCFContainer::AliCFContainer(const Char_t* name, const Char_t* title, const Int_t nSelSteps, const Int_t nVarIn, const Int_t* nBinIn) :  
   AliCFFrame(name,title),
   fNStep(nSelSteps),
-  fGrid(0x0)
+  fGrid(0x0),
+  fCoord(),
+  fDenseThreshold(kDefaultDenseBins),
+  fDenseChecked(kFALSE)
 {
   //
   // main constructor
@@ -65,7 +71,10 @@ AliCFContainer::AliCFContainer(const Char_t* name, const Char_t* title, const In
 AliCFContainer::AliCFContainer(const AliCFContainer& c) :
   AliCFFrame(c.fName,c.fTitle),
   fNStep(0),
-  fGrid(0x0)
+  fGrid(0x0),
+  fCoord(),
+  fDenseThreshold(kDefaultDenseBins),
+  fDenseChecked(kFALSE)
 {
   //
   // copy constructor
@@ -103,6 +112,8 @@ void AliCFContainer::Copy(TObject& c) const
   AliCFFrame::Copy(c);
   AliCFContainer& target = (AliCFContainer &) c;
   target.fNStep = fNStep;
+  target.fDenseThreshold = fDenseThreshold;
+  target.fDenseChecked = kFALSE;
   target.fGrid  = new AliCFGridSparse*[fNStep];
   for (Int_t iStep=0; iStep<fNStep; iStep++) {
     if (fGrid[iStep])  target.fGrid[iStep] = new AliCFGridSparse(*(fGrid[iStep]));
@@ -120,7 +131,100 @@ void AliCFContainer::Fill(const Double_t *var, Int_t istep, Double_t weight)
     AliError("Non-existent selection step, grid was not filled");
     return;
   }
-  fGrid[istep]->Fill(var,weight);
+  if (!fDenseChecked) CheckDenseIndex();
+  if (fGrid[istep]->GetUseDenseIndex()) FillDense(var,istep,weight);
+  else fGrid[istep]->Fill(var,weight);
+}
+
+//____________________________________________________________________
+void AliCFContainer::FillN(const Double_t *var, Int_t nEntries, Int_t istep, const Double_t *weights)
+{
+  //
+  // Fills the grid at selection step istep for nEntries sets of values of the
+  // input variables, stored one after the other in var (nEntries*GetNVar() values),
+  // with the weights in weights (by default w=1)
+  //
+  if(istep >= fNStep || istep < 0){
+    AliError("Non-existent selection step, grid was not filled");
+    return;
+  }
+  if (!fDenseChecked) CheckDenseIndex();
+  Int_t nVar = GetNVar();
+  AliCFGridSparse *grid = fGrid[istep];
+  for (Int_t i=0; i<nEntries; i++) {
+    Double_t weight = weights ? weights[i] : 1.;
+    if (grid->GetUseDenseIndex()) FillDense(var+i*nVar,istep,weight);
+    else grid->Fill(var+i*nVar,weight);
+  }
+}
+
+//____________________________________________________________________
+void AliCFContainer::FillDense(const Double_t *var, Int_t istep, Double_t weight)
+{
+  //
+  // Fills the grid at step istep through the dense index
+  //
+  Int_t nVar = GetNVar();
+  if ((Int_t)fCoord.size()<nVar) fCoord.resize(nVar);
+  fGrid[istep]->GetBinCoordinates(var,&fCoord[0]);
+  fGrid[istep]->FillBin(&fCoord[0],fGrid[istep]->GetLinearBin(&fCoord[0]),weight);
+}
+
+//____________________________________________________________________
+void AliCFContainer::CheckDenseIndex()
+{
+  //
+  // Switches on the dense index if the grids have at most fDenseThreshold bins
+  //
+  fDenseChecked = kTRUE;
+  if (fDenseThreshold<=0 || fNStep<=0) return;
+  Long64_t nBins = 1;
+  for (Int_t iVar=0; iVar<GetNVar(); iVar++) {
+    nBins *= GetNBins(iVar)+2;
+    if (nBins>fDenseThreshold) return;
+  }
+  for (Int_t istep=0; istep<fNStep; istep++) {
+    if (!fGrid[istep]->GetUseDenseIndex()) fGrid[istep]->SetUseDenseIndex(kTRUE);
+  }
+}
+
+//____________________________________________________________________
+void AliCFContainer::FillSteps(const Double_t *var, const Int_t *steps, Int_t nSteps, Double_t weight)
+{
+  //
+  // Fills the grids of the nSteps selection steps listed in steps for the 
+  // same set of values of the input variables, with a given weight (by default w=1).
+  // The bin coordinates are computed only once for all the steps
+  //
+  if (nSteps<=0) return;
+  if (!fDenseChecked) CheckDenseIndex();
+  Int_t nVar = GetNVar();
+  if ((Int_t)fCoord.size()<nVar) fCoord.resize(nVar);
+  fGrid[0]->GetBinCoordinates(var,&fCoord[0]);
+  Long64_t linearBin = fGrid[0]->GetLinearBin(&fCoord[0]);
+  for (Int_t i=0; i<nSteps; i++) {
+    Int_t istep = steps[i];
+    if(istep >= fNStep || istep < 0){
+      AliError("Non-existent selection step, grid was not filled");
+      continue;
+    }
+    fGrid[istep]->FillBin(&fCoord[0],(fGrid[istep]->GetUseDenseIndex() ? linearBin : -1),weight);
+  }
+}
+
+//____________________________________________________________________
+Bool_t AliCFContainer::SetUseDenseIndex(Bool_t flag)
+{
+  //
+  // Use a dense table of the bins in FillSteps(), for containers with few bins.
+  // Returns kTRUE if the dense index is used by all the steps
+  //
+  Bool_t ok = kTRUE;
+  fDenseChecked = kTRUE;
+  for (Int_t istep=0; istep<fNStep; istep++) {
+    if (!fGrid[istep]->SetUseDenseIndex(flag)) ok = kFALSE;
+  }
+  return ok;
 }
 
 //____________________________________________________________________
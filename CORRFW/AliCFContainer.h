@@ -12,6 +12,7 @@
 
 #include "AliCFFrame.h"
 #include "AliCFGridSparse.h"
+#include <vector>
 
 class TH1D;
 class TH2D;
@@ -62,6 +63,12 @@ class AliCFContainer : public AliCFFrame
   virtual Int_t GetNStep() const {return fNStep;};
   virtual void  SetNStep(Int_t nStep) {fNStep=nStep;}
   virtual void  Fill(const Double_t *var, Int_t istep, Double_t weight=1.) ;
+  virtual void  FillN(const Double_t *var, Int_t nEntries, Int_t istep, const Double_t *weights=0x0) ;
+  virtual void  FillSteps(const Double_t *var, const Int_t *steps, Int_t nSteps, Double_t weight=1.) ;
+  virtual Bool_t SetUseDenseIndex(Bool_t flag=kTRUE) ;
+  // the dense index is switched on at the first fill for grids with at most maxBins bins per step 
+  // (with under/overflows), 0 to disable
+  void          SetDenseIndexThreshold(Long64_t maxBins) {fDenseThreshold=maxBins; fDenseChecked=kFALSE;}
 
   virtual Float_t  GetOverFlows (Int_t var,Int_t istep,Bool_t excl=kFALSE) const;
   virtual Float_t  GetUnderFlows(Int_t var,Int_t istep,Bool_t excl=kFALSE) const ;
@@ -96,8 +103,15 @@ class AliCFContainer : public AliCFFrame
  private:
   Int_t    fNStep; //number of selection steps
   AliCFGridSparse **fGrid;//[fNStep]
+  std::vector<Int_t> fCoord; //! bin coordinates buffer for FillSteps()
+  enum {kDefaultDenseBins=65536}; // default threshold for the automatic dense index
+  Long64_t fDenseThreshold;  //! maximum number of bins per step for the automatic dense index
+  Bool_t   fDenseChecked;    //! the dense index was set up (or not) at the first fill
+
+  void     CheckDenseIndex();
+  void     FillDense(const Double_t *var, Int_t istep, Double_t weight);
   
-  ClassDef(AliCFContainer,5);
+  ClassDef(AliCFContainer,7);
 };
 
 inline void AliCFContainer::SetBinLimits(Int_t ivar, const Double_t* array) {
@@ -34,15 +34,23 @@
 #include "TH3D.h"
 #include "TAxis.h"
 #include "AliCFUnfolding.h"
+#include <thread>
 
 //____________________________________________________________________
 ClassImp(AliCFGridSparse)
 
+Bool_t AliCFGridSparse::fgUseDenseKernels = kFALSE;
+Int_t  AliCFGridSparse::fgNThreads = 1;
+
 //____________________________________________________________________
 AliCFGridSparse::AliCFGridSparse() : 
   AliCFFrame(),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fUseDenseIndex(kFALSE),
+  fDenseIndex(),
+  fDenseStride(),
+  fNDenseFilled(0)
 {
   // default constructor
 }
@@ -50,7 +58,11 @@ AliCFGridSparse::AliCFGridSparse() :
 AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title) : 
   AliCFFrame(name,title),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fUseDenseIndex(kFALSE),
+  fDenseIndex(),
+  fDenseStride(),
+  fNDenseFilled(0)
 {
   // default constructor
 }
@@ -58,7 +70,11 @@ AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title) :
 AliCFGridSparse::AliCFGridSparse(const Char_t* name, const Char_t* title, Int_t nVarIn, const Int_t * nBinIn) :  
   AliCFFrame(name,title),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fUseDenseIndex(kFALSE),
+  fDenseIndex(),
+  fDenseStride(),
+  fNDenseFilled(0)
 {
   //
   // main constructor
@@ -80,7 +96,11 @@ AliCFGridSparse::~AliCFGridSparse()
 AliCFGridSparse::AliCFGridSparse(const AliCFGridSparse& c) :
   AliCFFrame(c),
   fSumW2(kFALSE),
-  fData(0x0)
+  fData(0x0),
+  fUseDenseIndex(kFALSE),
+  fDenseIndex(),
+  fDenseStride(),
+  fNDenseFilled(0)
 {
   //
   // copy constructor
@@ -131,6 +151,89 @@ void AliCFGridSparse::Fill(const Double_t *var, Double_t weight)
   fData->Fill(var,weight);
 }
 
+//____________________________________________________________________
+void AliCFGridSparse::GetBinCoordinates(const Double_t *var, Int_t *coord) const
+{
+  //
+  // Bin coordinates (including under/overflow bins) of a set of values of the input variables
+  //
+  for (Int_t iVar=0; iVar<GetNVar(); iVar++) coord[iVar] = fData->GetAxis(iVar)->FindBin(var[iVar]);
+}
+
+//____________________________________________________________________
+Long64_t AliCFGridSparse::GetLinearBin(const Int_t *coord) const
+{
+  //
+  // Index of the bin in the dense table, -1 if the dense index is not used
+  //
+  if (!fUseDenseIndex) return -1;
+  Long64_t bin = 0;
+  for (Int_t iVar=0; iVar<GetNVar(); iVar++) bin += coord[iVar]*fDenseStride[iVar];
+  return bin;
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::FillBin(const Int_t *coord, Long64_t linearBin, Double_t weight)
+{
+  //
+  // Fill the grid at the given bin coordinates, with weight (by default w=1).
+  // If the dense index is used and linearBin (from GetLinearBin()) is given, 
+  // the THnSparse bin is taken from the dense table
+  //
+  Long64_t bin = -1;
+  if (fUseDenseIndex && linearBin>=0) {
+    if (fNDenseFilled>fData->GetNbins()) ResetDenseIndex(); // the THnSparse was reset in the meantime
+    Long64_t& denseBin = fDenseIndex[linearBin];
+    if (denseBin<0) denseBin = fData->GetBin(coord,kTRUE);
+    bin = denseBin;
+    fNDenseFilled = fData->GetNbins();
+  }
+  else bin = fData->GetBin(coord,kTRUE);
+
+  fData->AddBinContent(bin,weight);
+  if (fData->GetCalculateErrors()) fData->AddBinError2(bin,weight*weight);
+  fData->SetEntries(fData->GetEntries()+1);
+}
+
+//____________________________________________________________________
+Bool_t AliCFGridSparse::SetUseDenseIndex(Bool_t flag)
+{
+  //
+  // Use a dense table from the bin coordinates to the THnSparse bins in FillBin().
+  // Only for grids with at most kMaxDenseBins bins (including under/overflows)
+  //
+  fUseDenseIndex = kFALSE;
+  fDenseIndex.clear();
+  fDenseStride.clear();
+  if (!flag) return kFALSE;
+
+  Long64_t nBins = 1;
+  fDenseStride.resize(GetNVar());
+  for (Int_t iVar=0; iVar<GetNVar(); iVar++) {
+    fDenseStride[iVar] = nBins;
+    nBins *= GetNBins(iVar)+2;
+    if (nBins>kMaxDenseBins) {
+      AliWarning(Form("Grid %s has more than %d bins, the dense index is not used",GetName(),kMaxDenseBins));
+      fDenseStride.clear();
+      return kFALSE;
+    }
+  }
+  fDenseIndex.resize(nBins);
+  fUseDenseIndex = kTRUE;
+  ResetDenseIndex();
+  return kTRUE;
+}
+
+//____________________________________________________________________
+void AliCFGridSparse::ResetDenseIndex()
+{
+  //
+  // Invalidate the dense table, to be called whenever the THnSparse bins are reallocated
+  //
+  fDenseIndex.assign(fDenseIndex.size(),-1);
+  fNDenseFilled = 0;
+}
+
 //___________________________________________________________________
 AliCFGridSparse* AliCFGridSparse::MakeSlice(Int_t nVars, const Int_t* vars, const Double_t* varMin, const Double_t* varMax, Bool_t useBins) const
 {
@@ -364,6 +467,7 @@ void AliCFGridSparse::Add(const AliCFGridSparse* aGrid1, const AliCFGridSparse*
   if (!fSumW2  && (aGrid1->GetSumW2() || aGrid2->GetSumW2())) SumW2();
 
   fData->Reset();
+  ResetDenseIndex();
   fData->Add(aGrid1->GetGrid(),c1);
   fData->Add(aGrid2->GetGrid(),c2);
 }
@@ -401,6 +505,7 @@ void AliCFGridSparse::Multiply(const AliCFGridSparse* aGrid1, const AliCFGridSpa
   if(!fSumW2  && (aGrid1->GetSumW2() || aGrid2->GetSumW2())) SumW2();
 
   fData->Reset();
+  ResetDenseIndex();
   THnSparse *h1 = aGrid1->GetGrid();
   THnSparse *h2 = aGrid2->GetGrid();
   h2->Multiply(h1);
@@ -424,7 +529,9 @@ void AliCFGridSparse::Divide(const AliCFGridSparse* aGrid, Double_t c)
 
   THnSparse *h1 = aGrid->GetGrid();
   THnSparse *h2 = (THnSparse*)fData->Clone();
-  fData->Divide(h2,h1);
+  if (!fgUseDenseKernels || !DivideDense(h2,h1,1.,1.,"")) fData->Divide(h2,h1);
+  delete h2;
+  ResetDenseIndex();
   fData->Scale(c);
 }
 
@@ -445,7 +552,107 @@ void AliCFGridSparse::Divide(const AliCFGridSparse* aGrid1, const AliCFGridSpars
 
   THnSparse *h1= aGrid1->GetGrid();
   THnSparse *h2= aGrid2->GetGrid();
-  fData->Divide(h1,h2,c1,c2,option);
+  if (!fgUseDenseKernels || !DivideDense(h1,h2,c1,c2,option)) fData->Divide(h1,h2,c1,c2,option);
+  ResetDenseIndex();
+}
+
+//____________________________________________________________________
+Bool_t AliCFGridSparse::DivideDense(const THnSparse* h1, const THnSparse* h2, Double_t c1, Double_t c2, Option_t *option)
+{
+  //
+  // Same as THnSparse::Divide(h1,h2,c1,c2,option) : the result has the bins of h1,
+  // set to 0 where h2 is empty, binomial errors with option "B".
+  // The denominator is copied once into a dense array, the ratios and errors are
+  // computed on plain arrays in fgNThreads chunks and written back in one pass.
+  // Returns kFALSE (nothing done) if the grids are too large or inconsistent
+  //
+  Int_t nDim = GetNVar();
+  if (h1==fData || h2==fData || h1->GetNdimensions()!=nDim || h2->GetNdimensions()!=nDim || c2==0.) return kFALSE;
+  std::vector<Long64_t> stride(nDim);
+  Long64_t nBins = 1;
+  for (Int_t iVar=0; iVar<nDim; iVar++) {
+    if (h1->GetAxis(iVar)->GetNbins()!=GetNBins(iVar) || h2->GetAxis(iVar)->GetNbins()!=GetNBins(iVar)) return kFALSE;
+    stride[iVar] = nBins;
+    nBins *= GetNBins(iVar)+2;
+    if (nBins>kMaxDenseDivideBins) return kFALSE;
+  }
+
+  TString opt = option;
+  opt.ToLower();
+  Bool_t binomial = opt.Contains("b");
+  if (!fData->GetCalculateErrors() && (h1->GetCalculateErrors() || h2->GetCalculateErrors())) fData->Sumw2();
+  Bool_t errors = fData->GetCalculateErrors();
+
+  // denominator in a dense array
+  std::vector<Int_t> coord(nDim);
+  std::vector<Double_t> den(nBins,0.), denErr2(errors ? nBins : 0,0.);
+  for (Long64_t iBin=0; iBin<h2->GetNbins(); iBin++) {
+    Double_t v = h2->GetBinContent(iBin,&coord[0]);
+    Long64_t index = 0;
+    for (Int_t iVar=0; iVar<nDim; iVar++) index += coord[iVar]*stride[iVar];
+    den[index] = v;
+    if (errors) denErr2[index] = h2->GetBinError2(iBin);
+  }
+
+  // numerator bins
+  Long64_t nNum = h1->GetNbins();
+  std::vector<Long64_t> numIndex(nNum);
+  std::vector<Double_t> num(nNum), numErr2(errors ? nNum : 0);
+  for (Long64_t iBin=0; iBin<nNum; iBin++) {
+    num[iBin] = h1->GetBinContent(iBin,&coord[0]);
+    Long64_t index = 0;
+    for (Int_t iVar=0; iVar<nDim; iVar++) index += coord[iVar]*stride[iVar];
+    numIndex[iBin] = index;
+    if (errors) numErr2[iBin] = h1->GetBinError2(iBin);
+  }
+
+  // ratio and error kernels
+  std::vector<Double_t> ratio(nNum), ratioErr2(errors ? nNum : 0);
+  std::vector<Char_t> emptyDen(nNum);
+  auto kernel = [&](Long64_t first, Long64_t last) {
+    for (Long64_t i=first; i<last; i++) {
+      Double_t v1 = num[i];
+      Double_t v2 = den[numIndex[i]];
+      emptyDen[i] = (v2==0.);
+      if (v2==0.) {v1 = 0.; v2 = 1.;}
+      ratio[i] = c1*v1/c2/v2;
+      if (!errors) continue;
+      Double_t e1 = numErr2[i];
+      Double_t e2 = denErr2[numIndex[i]];
+      if (binomial) {
+        if (v1!=v2) {
+          Double_t w = v1/v2;
+          ratioErr2[i] = TMath::Abs(((1.-2.*w)*e1 + w*w*e2)/(v2*v2));
+        }
+        else ratioErr2[i] = 0.;
+      }
+      else {
+        Double_t b22 = v2*v2*c2*c2;
+        ratioErr2[i] = c1*c1*c2*c2*(e1*v2*v2 + e2*v1*v1)/(b22*b22);
+      }
+    }
+  };
+  Int_t nThreads = TMath::Max(1,TMath::Min(fgNThreads,(Int_t)(nNum/10000+1)));
+  Long64_t chunk = (nNum+nThreads-1)/nThreads;
+  std::vector<std::thread> workers;
+  for (Int_t iThr=1; iThr<nThreads; iThr++) workers.push_back(std::thread(kernel,iThr*chunk,TMath::Min(nNum,(iThr+1)*chunk)));
+  kernel(0,TMath::Min(nNum,chunk));
+  for (auto &w : workers) w.join();
+
+  // result
+  Double_t entries = h1->GetEntries();
+  fData->Reset();
+  Bool_t warn = kFALSE;
+  for (Long64_t iBin=0; iBin<nNum; iBin++) {
+    for (Int_t iVar=0; iVar<nDim; iVar++) coord[iVar] = (numIndex[iBin]/stride[iVar]) % (GetNBins(iVar)+2);
+    Long64_t bin = fData->GetBin(&coord[0],kTRUE);
+    fData->SetBinContent(bin,ratio[iBin]);
+    if (errors) fData->SetBinError2(bin,ratioErr2[iBin]);
+    if (emptyDen[iBin]) warn = kTRUE;
+  }
+  fData->SetEntries(entries);
+  if (warn) AliWarning("Denominator has empty bins - division by zero! Setting bin to 0.");
+  return kTRUE;
 }
 
 
@@ -465,6 +672,7 @@ void AliCFGridSparse::Rebin(const Int_t* group)
   THnSparse *rebinned =fData->Rebin(group);
   fData->Reset();
   fData = rebinned;
+  if (fUseDenseIndex) SetUseDenseIndex(kTRUE);
 }
 //____________________________________________________________________
 void AliCFGridSparse::Scale(Long_t index, const Double_t *fact)
@@ -609,6 +817,7 @@ void AliCFGridSparse::Copy(TObject& c) const
   if (fData) {
     target.fData = (THnSparse*)fData->Clone();
   }
+  target.SetUseDenseIndex(fUseDenseIndex);
 }
 
 //____________________________________________________________________
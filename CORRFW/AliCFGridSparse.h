@@ -12,6 +12,7 @@
 #include "THnSparse.h"
 #include "AliLog.h"
 #include "TAxis.h"
+#include <vector>
 
 class TH1D;
 class TH2D;
@@ -56,6 +57,12 @@ class AliCFGridSparse : public AliCFFrame
   //virtual Int_t      GetBinIndex(Int_t ivar, Int_t ind) const ;
 
   virtual void    Fill(const Double_t *var, Double_t weight=1.);
+  // bulk filling: the bin coordinates are computed once and can be used for several grids with the same binning
+  virtual void     GetBinCoordinates(const Double_t *var, Int_t *coord) const;
+  virtual Long64_t GetLinearBin(const Int_t *coord) const;
+  virtual void     FillBin(const Int_t *coord, Long64_t linearBin=-1, Double_t weight=1.);
+  virtual Bool_t   SetUseDenseIndex(Bool_t flag=kTRUE);
+  Bool_t           GetUseDenseIndex() const {return fUseDenseIndex;}
   virtual Float_t GetEntries()const;
   virtual Float_t GetElement(Long_t iel)               const; 
   virtual Float_t GetElement(const Int_t *bin)         const; 
@@ -88,6 +95,9 @@ class AliCFGridSparse : public AliCFFrame
   virtual void     Multiply(const AliCFGridSparse* aGrid1,const AliCFGridSparse* aGrid2, Double_t c1=1.,Double_t c2=1.);
   virtual void     Divide(const AliCFGridSparse* aGrid, Double_t c=1.);
   virtual void     Divide(const AliCFGridSparse* aGrid1, const AliCFGridSparse* aGrid2, Double_t c1=1., Double_t c2=1.,Option_t *option=0);
+  // Divide() (hence the efficiency calculation and correction) with a dense copy of the denominator
+  // and the ratio and error kernels spread over nThreads, for grids up to kMaxDenseDivideBins bins
+  static void      SetUseDenseKernels(Bool_t flag=kTRUE, Int_t nThreads=1) {fgUseDenseKernels=flag; fgNThreads=nThreads;}
   virtual void     Rebin(const Int_t* group);
   virtual void     Scale(Long_t iel, const Double_t *fact); 
   virtual void     Scale(const Int_t* bin, const Double_t *fact); 
@@ -99,7 +109,7 @@ class AliCFGridSparse : public AliCFFrame
   //virtual Double_t GetIntegral(const Double_t *varMin, const Double_t *varMax) const;
   virtual Long64_t Merge(TCollection* list);
 
-  virtual void     SetGrid(THnSparse* grid) {if (fData) delete fData ; fData=grid;}
+  virtual void     SetGrid(THnSparse* grid) {if (fData) delete fData ; fData=grid; ResetDenseIndex();}
   THnSparse   *    GetGrid() const {return fData;}
 
   virtual Float_t GetOverFlows (Int_t var, Bool_t excl=kFALSE) const;
@@ -118,12 +128,24 @@ class AliCFGridSparse : public AliCFFrame
   void     SetAxisRange(TAxis* axis, Double_t min, Double_t max, Bool_t useBins) const;
   void     GetProjectionName (TString& s,Int_t var0, Int_t var1=-1, Int_t var2=-1) const;
   void     GetProjectionTitle(TString& s,Int_t var0, Int_t var1=-1, Int_t var2=-1) const;
+  void     ResetDenseIndex();
+  Bool_t   DivideDense(const THnSparse* h1, const THnSparse* h2, Double_t c1, Double_t c2, Option_t *option);
 
   // data members:
   Bool_t      fSumW2    ; // Flag to check if calculation of squared weights enabled
   THnSparse  *fData     ; // The data Container: a THnSparse  
 
-  ClassDef(AliCFGridSparse,3);
+  enum {kMaxDenseBins=1048576}; // maximum number of bins (with under/overflows) for the dense index
+  Bool_t      fUseDenseIndex ; //! look up the THnSparse bins in a dense table instead of the THnSparse hash
+  std::vector<Long64_t> fDenseIndex  ; //! THnSparse bin of each linear bin, -1 if not yet allocated
+  std::vector<Long64_t> fDenseStride ; //! stride of each axis in the linear bin index
+  Long64_t    fNDenseFilled  ; //! number of filled THnSparse bins at the last look up
+
+  enum {kMaxDenseDivideBins=4194304}; // maximum number of bins (with under/overflows) for the dense Divide()
+  static Bool_t fgUseDenseKernels; // use DivideDense() in Divide()
+  static Int_t  fgNThreads;        // number of threads of the dense kernels
+
+  ClassDef(AliCFGridSparse,4);
 };
 
 
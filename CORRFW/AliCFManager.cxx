@@ -34,7 +34,17 @@ AliCFManager::AliCFManager() :
   fEvtContainer(0x0),
   fPartContainer(0x0),
   fEvtCutList(0x0),
-  fPartCutList(0x0)
+  fPartCutList(0x0),
+  fEvtCuts(),
+  fPartCuts(),
+  fEvtSelMasks(),
+  fPartSelMasks(),
+  fEvtObj(0x0),
+  fEvtEvaluated(0),
+  fEvtPassed(0),
+  fPartObj(0x0),
+  fPartEvaluated(0),
+  fPartPassed(0)
 { 
   //
   // ctor
@@ -48,7 +58,17 @@ AliCFManager::AliCFManager(const Char_t* name, const Char_t* title) :
   fEvtContainer(0x0),
   fPartContainer(0x0),
   fEvtCutList(0x0),
-  fPartCutList(0x0)
+  fPartCutList(0x0),
+  fEvtCuts(),
+  fPartCuts(),
+  fEvtSelMasks(),
+  fPartSelMasks(),
+  fEvtObj(0x0),
+  fEvtEvaluated(0),
+  fEvtPassed(0),
+  fPartObj(0x0),
+  fPartEvaluated(0),
+  fPartPassed(0)
 { 
    //
    // ctor
@@ -62,7 +82,17 @@ AliCFManager::AliCFManager(const AliCFManager& c) :
   fEvtContainer(c.fEvtContainer),
   fPartContainer(c.fPartContainer),
   fEvtCutList(c.fEvtCutList),
-  fPartCutList(c.fPartCutList)
+  fPartCutList(c.fPartCutList),
+  fEvtCuts(c.fEvtCuts),
+  fPartCuts(c.fPartCuts),
+  fEvtSelMasks(c.fEvtSelMasks),
+  fPartSelMasks(c.fPartSelMasks),
+  fEvtObj(0x0),
+  fEvtEvaluated(0),
+  fEvtPassed(0),
+  fPartObj(0x0),
+  fPartEvaluated(0),
+  fPartPassed(0)
 { 
    //
    //copy ctor
@@ -84,6 +114,11 @@ AliCFManager& AliCFManager::operator=(const AliCFManager& c)
   this->fPartContainer=c.fPartContainer;
   this->fEvtCutList=c.fEvtCutList;
   this->fPartCutList=c.fPartCutList;
+  this->fEvtCuts=c.fEvtCuts;
+  this->fPartCuts=c.fPartCuts;
+  this->fEvtSelMasks=c.fEvtSelMasks;
+  this->fPartSelMasks=c.fPartSelMasks;
+  ResetSelectionCache();
   return *this ;
 }
 
@@ -136,9 +171,124 @@ Bool_t AliCFManager::CheckEventCuts(Int_t isel, TObject *obj, const TString  &se
   return kTRUE;
 }
 
+//_____________________________________________________________________________
+Int_t AliCFManager::RegisterEventSelection(Int_t isel, const TString &selcuts) {
+  //
+  // register the subsample selcuts of the event-level cuts of step isel,
+  // returns the id to be passed to CheckEventSelection or -1
+  //
+
+  if(isel<0 || isel>=fNStepEvt){
+    AliWarning(Form("Selection index out of Range! isel=%i, max. number of selections= %i", isel,fNStepEvt));
+    return -1;
+  }
+  return RegisterSelection(fEvtCutList ? fEvtCutList[isel] : 0x0, selcuts, fEvtCuts, fEvtSelMasks);
+}
+
+//_____________________________________________________________________________
+Int_t AliCFManager::RegisterParticleSelection(Int_t isel, const TString &selcuts) {
+  //
+  // register the subsample selcuts of the particle-level cuts of step isel,
+  // returns the id to be passed to CheckParticleSelection or -1
+  //
+
+  if(isel<0 || isel>=fNStepPart){
+    AliWarning(Form("Selection index out of Range! isel=%i, max. number of selections= %i", isel,fNStepPart));
+    return -1;
+  }
+  return RegisterSelection(fPartCutList ? fPartCutList[isel] : 0x0, selcuts, fPartCuts, fPartSelMasks);
+}
+
+//_____________________________________________________________________________
+Int_t AliCFManager::RegisterSelection(TObjArray* list, const TString &selcuts, std::vector<AliCFCutBase*> &cuts, std::vector<ULong64_t> &masks) {
+  //
+  // mask of the cuts of list selected by selcuts, the cuts shared between
+  // steps get the same bit
+  //
+
+  ULong64_t mask = 0;
+  if (list) {
+    TObjArrayIter iter(list);
+    AliCFCutBase *cut = 0;
+    while ( (cut = (AliCFCutBase*)iter.Next()) ) {
+      if (!CompareStrings(cut->GetName(),selcuts)) continue;
+      UInt_t bit = 0;
+      while (bit<cuts.size() && cuts[bit]!=cut) bit++;
+      if (bit==cuts.size()) {
+        if (cuts.size()>=64) {
+          AliError("More than 64 distinct cuts, selection not registered");
+          return -1;
+        }
+        cuts.push_back(cut);
+      }
+      mask |= (1ULL<<bit);
+    }
+  }
+  masks.push_back(mask);
+  ResetSelectionCache();
+  return masks.size()-1;
+}
+
+//_____________________________________________________________________________
+Bool_t AliCFManager::CheckEventSelection(Int_t id, TObject *obj) const {
+  //
+  // check whether object obj passes the registered event-level selection id
+  //
+
+  if(id<0 || id>=(Int_t)fEvtSelMasks.size()){
+    AliWarning(Form("Selection id out of Range! id=%i, registered selections= %i", id,(Int_t)fEvtSelMasks.size()));
+    return kTRUE;
+  }
+  return CheckSelection(fEvtSelMasks[id],obj,fEvtCuts,fEvtObj,fEvtEvaluated,fEvtPassed);
+}
+
+//_____________________________________________________________________________
+Bool_t AliCFManager::CheckParticleSelection(Int_t id, TObject *obj) const {
+  //
+  // check whether object obj passes the registered particle-level selection id
+  //
+
+  if(id<0 || id>=(Int_t)fPartSelMasks.size()){
+    AliWarning(Form("Selection id out of Range! id=%i, registered selections= %i", id,(Int_t)fPartSelMasks.size()));
+    return kTRUE;
+  }
+  return CheckSelection(fPartSelMasks[id],obj,fPartCuts,fPartObj,fPartEvaluated,fPartPassed);
+}
+
+//_____________________________________________________________________________
+Bool_t AliCFManager::CheckSelection(ULong64_t mask, TObject *obj, const std::vector<AliCFCutBase*> &cuts,
+                                    const TObject* &cached, ULong64_t &evaluated, ULong64_t &passed) const {
+  //
+  // evaluates the cuts of mask not yet evaluated for obj, stops at the first failing one
+  //
+
+  if (obj!=cached) {
+    cached=obj;
+    evaluated=0;
+    passed=0;
+  }
+  if ((evaluated & mask) != mask) {
+    if (~passed & evaluated & mask) return kFALSE;
+    ULong64_t todo = mask & ~evaluated;
+    while (todo) {
+      Int_t bit = 0;
+      while (!((todo>>bit) & 1ULL)) bit++;
+      const ULong64_t b = 1ULL<<bit;
+      evaluated |= b;
+      todo &= ~b;
+      if (cuts[bit]->IsSelected(obj)) passed |= b;
+      else return kFALSE;
+    }
+  }
+  return (passed & mask) == mask;
+}
+
 //_____________________________________________________________________________
 void  AliCFManager::SetMCEventInfo(const TObject *obj) const {
 
+  //new event, the cached decisions are not valid anymore
+  ResetSelectionCache();
+
   //Particle level cuts
 
   if (!fPartCutList) {
@@ -174,6 +324,9 @@ void  AliCFManager::SetMCEventInfo(const TObject *obj) const {
 //_____________________________________________________________________________
 void  AliCFManager::SetRecEventInfo(const TObject *obj) const {
 
+  //new event, the cached decisions are not valid anymore
+  ResetSelectionCache();
+
   //Particle level cuts
 
   if (!fPartCutList) {
@@ -27,6 +27,9 @@
 #include "TNamed.h"
 #include "AliCFContainer.h"
 #include "AliLog.h"
+#include <vector>
+
+class AliCFCutBase;
 
 //____________________________________________________________________________
 class AliCFManager : public TNamed 
@@ -116,6 +119,20 @@ class AliCFManager : public TNamed
   virtual Bool_t CheckEventCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
   virtual Bool_t CheckParticleCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
 
+  //Precompiled selections: the subsample selcuts of the cut list of step isel
+  //is registered once (after the cut lists are set) and gets an id. Each
+  //distinct cut is then evaluated at most once per object, the decisions are
+  //kept in a bitmask until a different object or the event info is passed (call
+  //ResetSelectionCache() if objects are reused at the same address), so every
+  //further step is a mask test. At most 64 distinct cuts per level.
+  Int_t RegisterEventSelection(Int_t isel, const TString &selcuts="all");
+  Int_t RegisterParticleSelection(Int_t isel, const TString &selcuts="all");
+  Bool_t CheckEventSelection(Int_t id, TObject *obj) const;
+  Bool_t CheckParticleSelection(Int_t id, TObject *obj) const;
+  ULong64_t GetEventSelectionMask(Int_t id) const {return (id>=0 && id<(Int_t)fEvtSelMasks.size()) ? fEvtSelMasks[id] : 0;}
+  ULong64_t GetParticleSelectionMask(Int_t id) const {return (id>=0 && id<(Int_t)fPartSelMasks.size()) ? fPartSelMasks[id] : 0;}
+  void ResetSelectionCache() const {fEvtObj=0x0; fPartObj=0x0;}
+
  private:
   
   //number of steps
@@ -130,9 +147,24 @@ class AliCFManager : public TNamed
   //Particle-level selections
   TObjArray **fPartCutList ; //[fNStepPart] arrays of cuts for each particle-selection level
 
+  //Precompiled selections
+  std::vector<AliCFCutBase*> fEvtCuts;   //! distinct event-level cuts, bit i of the masks is cut i
+  std::vector<AliCFCutBase*> fPartCuts;  //! distinct particle-level cuts, bit i of the masks is cut i
+  std::vector<ULong64_t> fEvtSelMasks;   //! cut bits of the registered event selections
+  std::vector<ULong64_t> fPartSelMasks;  //! cut bits of the registered particle selections
+  mutable const TObject* fEvtObj;        //! object the event cut decisions belong to
+  mutable ULong64_t fEvtEvaluated;       //! event cuts evaluated for fEvtObj
+  mutable ULong64_t fEvtPassed;          //! event cuts passed by fEvtObj
+  mutable const TObject* fPartObj;       //! object the particle cut decisions belong to
+  mutable ULong64_t fPartEvaluated;      //! particle cuts evaluated for fPartObj
+  mutable ULong64_t fPartPassed;         //! particle cuts passed by fPartObj
+
   Bool_t CompareStrings(const TString  &cutname,const TString  &selcuts) const;
+  Int_t RegisterSelection(TObjArray* list, const TString &selcuts, std::vector<AliCFCutBase*> &cuts, std::vector<ULong64_t> &masks);
+  Bool_t CheckSelection(ULong64_t mask, TObject *obj, const std::vector<AliCFCutBase*> &cuts,
+                        const TObject* &cached, ULong64_t &evaluated, ULong64_t &passed) const;
 
-  ClassDef(AliCFManager,2);
+  ClassDef(AliCFManager,3);
 };
 
 
@@ -92,6 +92,8 @@
 #include "TH2D.h"
 #include "TH3D.h"
 #include "TRandom3.h"
+#include <atomic>
+#include <thread>
 
 
 ClassImp(AliCFUnfolding)
@@ -130,7 +132,18 @@ AliCFUnfolding::AliCFUnfolding() :
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(0)
+  fRandomSeed(0),
+  fUseDense(kTRUE),
+  fNThreads(1),
+  fMinConvergenceGain(0.),
+  fDenseReady(kFALSE),
+  fNDenseM(0),
+  fNDenseT(0),
+  fStrideM(),
+  fStrideT(),
+  fCondValue(),
+  fCondM(),
+  fCondT()
 {
   //
   // default constructor
@@ -174,7 +187,18 @@ AliCFUnfolding::AliCFUnfolding(const Char_t* name, const Char_t* title, const In
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(randomSeed)
+  fRandomSeed(randomSeed),
+  fUseDense(kTRUE),
+  fNThreads(1),
+  fMinConvergenceGain(0.),
+  fDenseReady(kFALSE),
+  fNDenseM(0),
+  fNDenseT(0),
+  fStrideM(),
+  fStrideT(),
+  fCondValue(),
+  fCondM(),
+  fCondT()
 {
   //
   // named constructor
@@ -274,6 +298,8 @@ void AliCFUnfolding::Init() {
   fDeltaUnfoldedN->SetTitle("");
   fDeltaUnfoldedN->Reset();
 
+  // dense kernels if the spaces fit in memory
+  InitDense();
 
 }
 
@@ -352,8 +378,10 @@ void AliCFUnfolding::Unfold() {
 
   Int_t iIterBayes     = 0 ;
   Double_t convergence = 0.;
+  Double_t previousConvergence = 0.;
 
-  for (iIterBayes=0; iIterBayes<fMaxNumIterations; iIterBayes++) { // bayes iterations
+  if (fDenseReady && fUseDense && !fUseSmoothing) iIterBayes = UnfoldDense(convergence);
+  else for (iIterBayes=0; iIterBayes<fMaxNumIterations; iIterBayes++) { // bayes iterations
 
     CreateEstMeasured(); // create measured estimate from prior
     CreateInvResponse(); // create inverse response  from prior
@@ -367,6 +395,13 @@ void AliCFUnfolding::Unfold() {
       AliDebug(0,Form("convergence is met at iteration %d",iIterBayes));
       break;
     }
+    if (fMinConvergenceGain>0. && iIterBayes>0 && fNCalcCorrErrors == 0 && 
+	previousConvergence-convergence < fMinConvergenceGain*previousConvergence) {
+      fNRandomIterations = iIterBayes;
+      AliDebug(0,Form("convergence does not improve anymore at iteration %d",iIterBayes));
+      break;
+    }
+    previousConvergence = convergence;
 
     if (fUseSmoothing) {
       if (Smooth()) {
@@ -457,7 +492,8 @@ void AliCFUnfolding::CalculateCorrelatedErrors() {
 
 
   //Do fNRandomIterations = bayes iterations performed
-  for (int i=0; i<fNRandomIterations; i++) {
+  if (fDenseReady && fUseDense && !fUseSmoothing && fNThreads>1) FillDeltaUnfoldedThreads();
+  else for (int i=0; i<fNRandomIterations; i++) {
     
     // reset prior to original one
     if (fPrior) delete fPrior ;
@@ -862,3 +898,269 @@ void AliCFUnfolding::CreateFlatPrior() {
   delete [] bin;
   delete [] bins;
 }
+
+//______________________________________________________________
+
+void AliCFUnfolding::InitDense() {
+  //
+  // Sets up the dense kernels : the measured and true spaces are stored in arrays
+  // (including under/overflows) and the conditional matrix as a list of its bins
+  // with their measured and true indices. Done only if the spaces are small enough
+  //
+
+  fDenseReady = kFALSE;
+  fCondValue.clear();
+  fCondM.clear();
+  fCondT.clear();
+  if (!fUseDense) return;
+
+  fStrideM.resize(fNVariables);
+  fStrideT.resize(fNVariables);
+  fNDenseM = 1;
+  fNDenseT = 1;
+  for (Int_t iVar=0; iVar<fNVariables; iVar++) {
+    if (fResponse->GetAxis(iVar)->GetNbins() != fMeasured->GetAxis(iVar)->GetNbins() ||
+	fResponse->GetAxis(iVar+fNVariables)->GetNbins() != fPrior->GetAxis(iVar)->GetNbins()) {
+      AliInfo("Binnings of the response and of the spectra differ, the dense kernels are not used");
+      return;
+    }
+    fStrideM[iVar] = fNDenseM;
+    fStrideT[iVar] = fNDenseT;
+    fNDenseM *= fMeasured->GetAxis(iVar)->GetNbins()+2;
+    fNDenseT *= fPrior   ->GetAxis(iVar)->GetNbins()+2;
+    if (fNDenseM>kMaxDenseBins || fNDenseT>kMaxDenseBins) {
+      AliInfo(Form("More than %d bins in the measured or true space, the dense kernels are not used",kMaxDenseBins));
+      return;
+    }
+  }
+
+  Long64_t nCond = fConditional->GetNbins();
+  fCondValue.resize(nCond);
+  fCondM.resize(nCond);
+  fCondT.resize(nCond);
+  for (Long64_t iBin=0; iBin<nCond; iBin++) {
+    fCondValue[iBin] = fConditional->GetBinContent(iBin,fCoordinates2N);
+    GetCoordinates();
+    Long64_t m = 0, t = 0;
+    for (Int_t iVar=0; iVar<fNVariables; iVar++) {
+      m += fCoordinatesN_M[iVar]*fStrideM[iVar];
+      t += fCoordinatesN_T[iVar]*fStrideT[iVar];
+    }
+    fCondM[iBin] = m;
+    fCondT[iBin] = t;
+  }
+  fDenseReady = kTRUE;
+  AliInfo(Form("Dense kernels used : %lld measured bins, %lld true bins, %lld response bins",fNDenseM,fNDenseT,nCond));
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::ToDense(const THnSparse* h, const std::vector<Long64_t> &stride, std::vector<Double_t> &dense, Long64_t n) const {
+  //
+  // copies the content of h into the dense array
+  //
+  dense.assign(n,0.);
+  std::vector<Int_t> coord(h->GetNdimensions());
+  for (Long64_t iBin=0; iBin<h->GetNbins(); iBin++) {
+    Double_t value = h->GetBinContent(iBin,&coord[0]);
+    Long64_t index = 0;
+    for (Int_t iVar=0; iVar<fNVariables; iVar++) index += coord[iVar]*stride[iVar];
+    dense[index] = value;
+  }
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::FromDense(THnSparse* h, const std::vector<Long64_t> &stride, const std::vector<Double_t> &dense) const {
+  //
+  // replaces the content of h with the non-zero bins of the dense array, with zero errors
+  //
+  h->Reset();
+  std::vector<Int_t> coord(h->GetNdimensions());
+  for (Long64_t index=0; index<(Long64_t)dense.size(); index++) {
+    if (dense[index]==0.) continue;
+    for (Int_t iVar=0; iVar<fNVariables; iVar++) coord[iVar] = (index/stride[iVar]) % (h->GetAxis(iVar)->GetNbins()+2);
+    h->SetBinContent(&coord[0],dense[index]);
+    h->SetBinError  (&coord[0],0.);
+  }
+}
+
+//______________________________________________________________
+
+Int_t AliCFUnfolding::IterateDense(std::vector<Double_t> &prior, const std::vector<Double_t> &eff, const std::vector<Double_t> &meas,
+				   Int_t maxIter, Bool_t checkConvergence, std::vector<Double_t> &unfolded, std::vector<Double_t> &est,
+				   std::vector<Double_t> &inv, Double_t &convergence, Bool_t &stopped) const {
+  //
+  // Bayes iterations on the dense arrays, same steps as CreateEstMeasured(), CreateInvResponse() 
+  // and CreateUnfolded(). The prior is updated to the unfolded spectrum after each iteration.
+  // Returns the number of the last iteration, stopped is set if the convergence criterion is met
+  //
+
+  const Long64_t nCond = fCondValue.size();
+  std::vector<Double_t> priorTimesEff(fNDenseT);
+  Double_t previousConvergence = 0.;
+  stopped = kFALSE;
+  inv.resize(nCond);
+
+  Int_t iIter = 0;
+  for (iIter=0; iIter<maxIter; iIter++) {
+    for (Long64_t t=0; t<fNDenseT; t++) priorTimesEff[t] = prior[t]*eff[t];
+
+    // measured estimate
+    est.assign(fNDenseM,0.);
+    for (Long64_t k=0; k<nCond; k++) {
+      Double_t fill = fCondValue[k]*priorTimesEff[fCondT[k]];
+      if (fill>0.) est[fCondM[k]] += fill;
+    }
+    // inverse response
+    for (Long64_t k=0; k<nCond; k++) {
+      Double_t estMeasuredValue = est[fCondM[k]];
+      inv[k] = (estMeasuredValue>0. ? fCondValue[k]*priorTimesEff[fCondT[k]]/estMeasuredValue : 0.);
+    }
+    // unfolded
+    unfolded.assign(fNDenseT,0.);
+    for (Long64_t k=0; k<nCond; k++) {
+      Double_t effValue = eff[fCondT[k]];
+      Double_t fill = (effValue>0. ? inv[k]*meas[fCondM[k]]/effValue : 0.);
+      if (fill>0.) unfolded[fCondT[k]] += fill;
+    }
+
+    convergence = 0.;
+    for (Long64_t t=0; t<fNDenseT; t++) {
+      if (prior[t]>0.) convergence += ((prior[t]-unfolded[t])/prior[t])*((prior[t]-unfolded[t])/prior[t]);
+    }
+    AliDebug(0,Form("convergence at iteration %d is %e",iIter,convergence));
+
+    if (checkConvergence) {
+      if (fMaxConvergence>0. && convergence<fMaxConvergence) {
+	AliDebug(0,Form("convergence is met at iteration %d",iIter));
+	stopped = kTRUE;
+	break;
+      }
+      if (fMinConvergenceGain>0. && iIter>0 && previousConvergence-convergence < fMinConvergenceGain*previousConvergence) {
+	AliDebug(0,Form("convergence does not improve anymore at iteration %d",iIter));
+	stopped = kTRUE;
+	break;
+      }
+    }
+    previousConvergence = convergence;
+
+    // update the prior distribution
+    prior = unfolded;
+  }
+  return iIter;
+}
+
+//______________________________________________________________
+
+Int_t AliCFUnfolding::UnfoldDense(Double_t &convergence) {
+  //
+  // Bayes iterations of Unfold() with the dense kernels, the resulting spectra
+  // are copied back to the THnSparse's. Returns the number of the last iteration
+  //
+
+  std::vector<Double_t> prior, eff, meas, unfolded, est, inv;
+  ToDense(fPrior     ,fStrideT,prior,fNDenseT);
+  ToDense(fEfficiency,fStrideT,eff  ,fNDenseT);
+  ToDense(fMeasured  ,fStrideM,meas ,fNDenseM);
+
+  Bool_t stopped = kFALSE;
+  Int_t iIterBayes = IterateDense(prior,eff,meas,fMaxNumIterations,fNCalcCorrErrors==0,unfolded,est,inv,convergence,stopped);
+  if (stopped) fNRandomIterations = iIterBayes;
+  if (unfolded.empty()) return iIterBayes;
+
+  FromDense(fUnfolded        ,fStrideT,unfolded);
+  FromDense(fMeasuredEstimate,fStrideM,est);
+  FromDense(fPrior           ,fStrideT,prior);
+  for (Long64_t k=0; k<(Long64_t)inv.size(); k++) {
+    fConditional->GetBinContent(k,fCoordinates2N);
+    if (inv[k]>0. || fInverseResponse->GetBinContent(fCoordinates2N)>0.) {
+      fInverseResponse->SetBinContent(fCoordinates2N,inv[k]);
+      fInverseResponse->SetBinError  (fCoordinates2N,0.);
+    }
+  }
+  return iIterBayes;
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::FillDeltaUnfoldedThreads() {
+  //
+  // The fNRandomIterations unfoldings of randomized efficiency and measured spectra
+  // spread over fNThreads threads with the dense kernels. Each random iteration has
+  // its own generator, seeded from fRandom3, so the result does not depend on the
+  // number of threads. The randomized response is not needed: the conditional matrix
+  // is computed once from the original response.
+  //
+
+  // seeds, original spectra and final unfolded spectrum
+  std::vector<UInt_t> seeds(fNRandomIterations);
+  for (Int_t i=0; i<fNRandomIterations; i++) seeds[i] = fRandom3->Integer(kMaxUInt);
+
+  struct BinValue {Long64_t index; Double_t value; Double_t error;};
+  std::vector<BinValue> effOrig, measOrig;
+  std::vector<Int_t> coord(fNVariables);
+  for (Long64_t iBin=0; iBin<fEfficiencyOrig->GetNbins(); iBin++) {
+    BinValue b; b.value = fEfficiencyOrig->GetBinContent(iBin,&coord[0]); b.error = fEfficiencyOrig->GetBinError(iBin); b.index = 0;
+    for (Int_t iVar=0; iVar<fNVariables; iVar++) b.index += coord[iVar]*fStrideT[iVar];
+    effOrig.push_back(b);
+  }
+  for (Long64_t iBin=0; iBin<fMeasuredOrig->GetNbins(); iBin++) {
+    BinValue b; b.value = fMeasuredOrig->GetBinContent(iBin,&coord[0]); b.error = fMeasuredOrig->GetBinError(iBin); b.index = 0;
+    for (Int_t iVar=0; iVar<fNVariables; iVar++) b.index += coord[iVar]*fStrideM[iVar];
+    measOrig.push_back(b);
+  }
+  std::vector<Double_t> priorOrig, unfoldedFinal;
+  ToDense(fPriorOrig    ,fStrideT,priorOrig,fNDenseT);
+  ToDense(fUnfoldedFinal,fStrideT,unfoldedFinal,fNDenseT);
+
+  // per thread sums of the deltas and of their squares
+  Int_t nThreads = TMath::Max(1,TMath::Min(fNThreads,fNRandomIterations));
+  std::vector<std::vector<Double_t> > sum(nThreads), sum2(nThreads);
+  std::vector<Int_t> nDone(nThreads,0);
+  std::atomic<Int_t> next(0);
+
+  auto work = [&](Int_t iThr) {
+    std::vector<Double_t> prior, eff, meas, unfolded, est, inv;
+    sum[iThr].assign(fNDenseT,0.);
+    sum2[iThr].assign(fNDenseT,0.);
+    for (Int_t i=next++; i<fNRandomIterations; i=next++) {
+      TRandom3 random(seeds[i]);
+      eff.assign(fNDenseT,0.);
+      meas.assign(fNDenseM,0.);
+      for (const BinValue &b : effOrig)  eff [b.index] = random.Gaus(b.value,b.error);
+      for (const BinValue &b : measOrig) meas[b.index] = random.Gaus(b.value,b.error);
+      prior = priorOrig;
+      Double_t convergence = 0.;
+      Bool_t stopped = kFALSE;
+      IterateDense(prior,eff,meas,fMaxNumIterations,kFALSE,unfolded,est,inv,convergence,stopped);
+      if (unfolded.empty()) unfolded.assign(fNDenseT,0.);
+      for (Long64_t t=0; t<fNDenseT; t++) {
+	Double_t delta = unfoldedFinal[t]-unfolded[t];
+	sum [iThr][t] += delta;
+	sum2[iThr][t] += delta*delta;
+      }
+      nDone[iThr]++;
+    }
+  };
+  std::vector<std::thread> workers;
+  for (Int_t iThr=1; iThr<nThreads; iThr++) workers.push_back(std::thread(work,iThr));
+  work(0);
+  for (auto &w : workers) w.join();
+
+  // same profile as FillDeltaUnfoldedProfile() after all the iterations
+  Double_t nTot = 0;
+  for (Int_t iThr=0; iThr<nThreads; iThr++) nTot += nDone[iThr];
+  if (nTot<=0) return;
+  for (Long64_t iBin=0; iBin<fUnfoldedFinal->GetNbins(); iBin++) {
+    fUnfoldedFinal->GetBinContent(iBin,fCoordinatesN_M);
+    Long64_t t = 0;
+    for (Int_t iVar=0; iVar<fNVariables; iVar++) t += fCoordinatesN_M[iVar]*fStrideT[iVar];
+    Double_t s = 0., s2 = 0.;
+    for (Int_t iThr=0; iThr<nThreads; iThr++) {s += sum[iThr][t]; s2 += sum2[iThr][t];}
+    fDeltaUnfoldedP->SetBinError  (fCoordinatesN_M,s2/nTot);
+    fDeltaUnfoldedP->SetBinContent(fCoordinatesN_M,s/nTot);
+    fDeltaUnfoldedN->SetBinContent(fCoordinatesN_M,nTot);
+  }
+  AliInfo(Form("%d random iterations done in %d threads",(Int_t)nTot,nThreads));
+}
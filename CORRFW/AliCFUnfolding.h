@@ -13,6 +13,7 @@
 #include "TNamed.h"
 #include "THnSparse.h"
 #include "AliLog.h"
+#include <vector>
 
 class TF1;
 class TRandom3;
@@ -36,6 +37,12 @@ class AliCFUnfolding : public TNamed {
   }
 
   void SetNRandomIterations(Int_t n = 100) {fNRandomIterations = n;};
+  // dense kernels for the iterations when the measured and true spaces have at most kMaxDenseBins bins (default)
+  void SetUseDenseMatrices(Bool_t b = kTRUE) {fUseDense = b;}
+  // random iterations of the error calculation spread over n threads, requires the dense kernels
+  void SetNThreads(Int_t n = 1) {fNThreads = n;}
+  // stop the main iteration also when the convergence improves by less than this fraction (0 = off)
+  void SetMinConvergenceGain(Double_t gain = 0.) {fMinConvergenceGain = gain;}
 
   void UseSmoothing(TF1* fcn=0x0, Option_t* opt="iremn") { // if fcn=0x0 then smooth using neighbouring bins 
     fUseSmoothing=kTRUE;                                   // this function must NOT be used if fNVariables > 3
@@ -112,6 +119,20 @@ class AliCFUnfolding : public TNamed {
   Short_t        fNCalcCorrErrors;   // Book-keeping to prevend infinite loop
   UInt_t         fRandomSeed;        // Random seed
 
+  /* dense kernels */
+  enum {kMaxDenseBins = 4194304};    // Maximum number of bins (with under/overflows) of the measured and true spaces for the dense kernels
+  Bool_t         fUseDense;          // Use the dense kernels if the spaces are small enough
+  Int_t          fNThreads;          // Number of threads for the random iterations
+  Double_t       fMinConvergenceGain;// Minimum relative improvement of the convergence per main iteration
+  Bool_t         fDenseReady;        //! Dense kernels set up
+  Long64_t       fNDenseM;           //! Number of bins of the dense measured space
+  Long64_t       fNDenseT;           //! Number of bins of the dense true space
+  std::vector<Long64_t> fStrideM;    //! Strides of the measured axes in the dense index
+  std::vector<Long64_t> fStrideT;    //! Strides of the true axes in the dense index
+  std::vector<Double_t> fCondValue;  //! Content of each bin of the conditional matrix
+  std::vector<Long64_t> fCondM;      //! Dense measured index of each bin of the conditional matrix
+  std::vector<Long64_t> fCondT;      //! Dense true index of each bin of the conditional matrix
+
 
   // functions
   void     Init();                  // initialisation of the internal settings
@@ -132,7 +153,17 @@ class AliCFUnfolding : public TNamed {
   void     FillDeltaUnfoldedProfile();  // Fills the fDeltaUnfoldedP profile
   void     SetMaxConvergencePerDOF (Double_t val);
 
-  ClassDef(AliCFUnfolding,1);
+  /* dense kernels */
+  void     InitDense();                 // Sets up the dense kernels from the conditional matrix
+  Int_t    UnfoldDense(Double_t &convergence); // Bayes iterations of Unfold() with the dense kernels
+  Int_t    IterateDense(std::vector<Double_t> &prior, const std::vector<Double_t> &eff, const std::vector<Double_t> &meas,
+                        Int_t maxIter, Bool_t checkConvergence, std::vector<Double_t> &unfolded, std::vector<Double_t> &est,
+                        std::vector<Double_t> &inv, Double_t &convergence, Bool_t &stopped) const;
+  void     FillDeltaUnfoldedThreads();  // Random iterations of the error calculation spread over fNThreads
+  void     ToDense  (const THnSparse* h, const std::vector<Long64_t> &stride, std::vector<Double_t> &dense, Long64_t n) const;
+  void     FromDense(THnSparse* h, const std::vector<Long64_t> &stride, const std::vector<Double_t> &dense) const;
+
+  ClassDef(AliCFUnfolding,2);
 };
 
 #endif
@@ -62,6 +62,7 @@ AliEveBeamsInfo::AliEveBeamsInfo(const char* name) :
   fTrigger(0),
   fTriggerClassesPanel(0),
   fNumberOfActiveTriggerClasses(0),
+  fActiveTriggerClasses(""),
   fTriggerClasses(0),
   fAl(0),
   fHisto2dv(0),
@@ -412,6 +413,7 @@ void AliEveBeamsInfo::AddTriggerClasses()
 
     TString fTriggerNameString = fEsd->GetESDRun()->GetActiveTriggerClasses();
     TString *fTriggerName = SepareTriggerClasses(fNumberOfActiveTriggerClasses, fTriggerNameString);
+    fActiveTriggerClasses = fTriggerNameString;
 
     fTriggerClasses = new TGLOverlayButton*[fNumberOfActiveTriggerClasses];
 
@@ -426,6 +428,7 @@ void AliEveBeamsInfo::AddTriggerClasses()
 
       AddOverlayButton(fTriggerClasses[i]);
     }
+    delete[] fTriggerName;
   }
 }
 
@@ -445,7 +448,10 @@ void AliEveBeamsInfo::RemoveTriggerClasses()
 //______________________________________________________________________________
 void AliEveBeamsInfo::UpdateTriggerClasses()
 {
-  // Remove trigger information and update it
+  // Remove trigger information and update it,
+  // the buttons are kept as long as the active classes do not change
+  if (fTriggerClasses && fActiveTriggerClasses == fEsd->GetESDRun()->GetActiveTriggerClasses()) return;
+
   RemoveTriggerClasses();
   AddTriggerClasses();
 }
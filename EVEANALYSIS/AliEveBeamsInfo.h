@@ -81,6 +81,7 @@ private:
 
   TGLOverlayButton    *fTriggerClassesPanel; // Active trigger classes panel
   Int_t               fNumberOfActiveTriggerClasses; // Number of active trigger classes
+  TString             fActiveTriggerClasses;  // Active trigger classes of the buttons
   TGLOverlayButton    **fTriggerClasses;      // Active trigger classes
 
   AliEveMultiView     *fAl;                   // Multiview instance
@@ -30,6 +30,12 @@
 #include "TEveProjectionAxes.h"
 #include "TGLWidget.h"
 #include "TStopwatch.h"
+#include "TTree.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 //______________________________________________________________________________
 // This class provides the following features:
@@ -99,7 +105,9 @@ AliEveLego::AliEveLego(const char* name) :
   fAl(0),
   fHisto2dLegoOverlay(0),
   fHisto2dAllEventsLegoOverlay(0),
-  fHisto2dAllEventsSlot(0)
+  fHisto2dAllEventsSlot(0),
+  fTowersFront(0),
+  fTowersFrontAE(0)
 {
   // Constructor.
   gEve->AddToListTree(this,0);
@@ -248,51 +256,112 @@ namespace
     }
     return phi;
   }
-}
-
-//______________________________________________________________________________
-TEveCaloDataHist* AliEveLego::LoadData()
-{
-   // Load data from ESD tree
-   fHistopos->Reset();
-   fHistoneg->Reset();
-   fHistoElectrons->Reset();
-   fHistoMuons->Reset();
-   fHistoPions->Reset();
-   fHistoKaons->Reset();
-   fHistoProtons->Reset();
-
-   // Getting current tracks, filling histograms
-   for (int n = 0; n < fEsd->GetNumberOfTracks(); ++n) {
 
-     AliESDtrack *track = fEsd->GetTrack(n);
-     const Double_t sign = fEsd->GetTrack(n)->GetSign();
-     const Int_t prob = GetParticleType(track);     
+  // Dense tower sums, same binning as the histograms. The slices follow the
+  // particle type ids: positive, negative, electrons, muons, pions, kaons,
+  // protons, for all tracks and for the primary vertex contributors
+  const Int_t kNEtaBins   = 100;
+  const Int_t kNPhiBins   = 80;
+  const Int_t kNSlices    = 7;
+  const Int_t kNTowers    = 2 * kNSlices * kNEtaBins * kNPhiBins;
+  const size_t kTracksPerBatch = 20000;
 
-     // Filling histograms
-     if (sign > 0)
-       fHistopos->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-     if (sign < 0)
-       fHistoneg->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-     if (prob == 0)
-       fHistoElectrons->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
+  struct LegoTrack
+  {
+    Int_t   fTower;    // eta, phi tower
+    Float_t fPt;       // pT
+    Char_t  fSign;     // charge sign
+    Char_t  fType;     // particle type, see AliEveLego::GetParticleType
+    Bool_t  fPrimary;  // primary vertex contributor
+  };
+
+  Int_t TowerIndex(Int_t sel, Int_t slice, Int_t tower)
+  {
+    return (sel * kNSlices + slice) * kNEtaBins * kNPhiBins + tower;
+  }
 
-     if (prob == 1)
-       fHistoMuons->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
+  //____________________________________________________________________________
+  void ReadTracks(AliEveLego *lego, AliESDEvent *esd, std::vector<LegoTrack> &tracks)
+  {
+    // Append the tracks of the event inside the eta, phi range
+
+    const Int_t ntracks = esd->GetNumberOfTracks();
+    std::vector<Bool_t> primary(ntracks, kFALSE);
+    const AliESDVertex *pv = esd->GetPrimaryVertex();
+    if (pv)
+      for (Int_t n = 0; n < pv->GetNIndices(); n++)
+        if (pv->GetIndices()[n] < ntracks) primary[pv->GetIndices()[n]] = kTRUE;
+
+    for (Int_t n = 0; n < ntracks; ++n) {
+      AliESDtrack *track = esd->GetTrack(n);
+
+      // same bins as TH2F::Fill, under- and overflows are not shown
+      const Double_t eta = track->Eta();
+      const Double_t phi = getphi(track->Phi());
+      if (eta < -1.5 || eta >= 1.5 || phi < -TMath::Pi() || phi >= TMath::Pi()) continue;
+      const Int_t ieta = TMath::Min(Int_t((eta + 1.5) / 3. * kNEtaBins), kNEtaBins - 1);
+      const Int_t iphi = TMath::Min(Int_t((phi + TMath::Pi()) / TMath::TwoPi() * kNPhiBins), kNPhiBins - 1);
+
+      LegoTrack t;
+      t.fTower   = ieta * kNPhiBins + iphi;
+      t.fPt      = fabs(track->Pt());
+      t.fSign    = (track->GetSign() > 0) ? 1 : ((track->GetSign() < 0) ? -1 : 0);
+      t.fType    = lego->GetParticleType(track);
+      t.fPrimary = primary[n];
+      tracks.push_back(t);
+    }
+  }
 
-     if (prob == 2)
-       fHistoPions->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
+  //____________________________________________________________________________
+  void FillTowers(Float_t *towers, const std::vector<LegoTrack> &tracks)
+  {
+    // Add the track pT to the towers of its charge and particle type
+
+    for (size_t n = 0; n < tracks.size(); ++n) {
+      const LegoTrack &t = tracks[n];
+      for (Int_t sel = 0; sel <= (t.fPrimary ? 1 : 0); sel++) {
+        if (t.fSign > 0) towers[TowerIndex(sel, 0, t.fTower)] += t.fPt;
+        if (t.fSign < 0) towers[TowerIndex(sel, 1, t.fTower)] += t.fPt;
+        towers[TowerIndex(sel, 2 + t.fType, t.fTower)] += t.fPt;
+      }
+    }
+  }
 
-     if (prob == 3)
-       fHistoKaons->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
+  //____________________________________________________________________________
+  void CopyTowers(const std::vector<Float_t> &towers, TH2F **histos, Bool_t primary,
+                  const Bool_t *typeOn, Float_t maxPt)
+  {
+    // Fill the histograms from the tower sums, limited to maxPt
+
+    for (Int_t slice = 0; slice < kNSlices; slice++) {
+      TH2F *h = histos[slice];
+      h->Reset();
+      if (towers.empty() || typeOn[slice] == kFALSE) continue;
+
+      Float_t *content = h->GetArray();
+      const Float_t *tow = &towers[TowerIndex(primary ? 1 : 0, slice, 0)];
+      for (Int_t ieta = 0; ieta < kNEtaBins; ieta++)
+        for (Int_t iphi = 0; iphi < kNPhiBins; iphi++) {
+          const Float_t val = tow[ieta * kNPhiBins + iphi];
+          if (val > 0) content[h->GetBin(ieta + 1, iphi + 1)] = TMath::Min(val, maxPt);
+        }
+    }
+  }
+}
 
-     if (prob == 4)
-       fHistoProtons->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-   }
+//______________________________________________________________________________
+TEveCaloDataHist* AliEveLego::LoadData()
+{
+   // Load data from ESD tree
+   // The tower sums of the current event are made for all tracks and for the
+   // primary vertex contributors in the back buffer, which is then shown
+   std::vector<LegoTrack> tracks;
+   ReadTracks(this, fEsd, tracks);
 
-   fData->DataChanged();
+   Int_t back = 1 - fTowersFront;
+   fTowers[back].assign(kNTowers, 0.);
+   FillTowers(&fTowers[back][0], tracks);
+   fTowersFront = back;
 
    FilterData();
 
@@ -303,18 +372,39 @@ TEveCaloDataHist* AliEveLego::LoadData()
 TEveCaloDataHist* AliEveLego::LoadAllData()
 {
    // Load data from all events ESD
-   fHistoposAllEvents->Reset();
-   fHistonegAllEvents->Reset();
-   fHistoElectronsAllEvents->Reset();
-   fHistoMuonsAllEvents->Reset();
-   fHistoPionsAllEvents->Reset();
-   fHistoKaonsAllEvents->Reset();
-   fHistoProtonsAllEvents->Reset();
+   if (!fDataAllEvents) return 0;
+
+   // The events are read in this thread, the tracks are handed over in batches
+   // to a worker which accumulates the tower sums in the back buffer
+   Int_t back = 1 - fTowersFrontAE;
+   std::vector<Float_t> &towers = fTowersAE[back];
+   towers.assign(kNTowers, 0.);
+
+   std::mutex mutex;
+   std::condition_variable cond;
+   std::deque<std::vector<LegoTrack> > queue;
+   Bool_t done = kFALSE;
+
+   std::thread worker([&]() {
+      std::vector<LegoTrack> batch;
+      for (;;) {
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          cond.wait(lock, [&]() { return done || !queue.empty(); });
+          if (queue.empty()) return;
+          batch.swap(queue.front());
+          queue.pop_front();
+        }
+        FillTowers(&towers[0], batch);
+        batch.clear();
+      }
+   });
 
    TTree* t = AliEveEventManager::GetMaster()->GetESDTree();
 
-   // Getting current tracks for each event, filling histograms
+   // Getting current tracks for each event
    Int_t fAcceptedEvents = 0;
+   std::vector<LegoTrack> tracks;
    for (int event = 0; event < t->GetEntries(); event++) {
       t->GetEntry(event);
 
@@ -323,34 +413,23 @@ TEveCaloDataHist* AliEveLego::LoadAllData()
 
       fAcceptedEvents++;
 
-      for (int n = 0; n < fEsd->GetNumberOfTracks(); ++n) {
-
-           AliESDtrack *track = fEsd->GetTrack(n);
-           const Double_t sign = track->GetSign();
-           const Int_t prob = GetParticleType(track);
-
-           if (sign > 0)
-             fHistoposAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-           if (sign < 0)
-             fHistonegAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-           if (prob == 0)
-             fHistoElectronsAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-           if (prob == 1)
-             fHistoMuonsAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-           if (prob == 2)
-             fHistoPionsAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-           if (prob == 3)
-             fHistoKaonsAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-
-           if (prob == 4)
-             fHistoProtonsAllEvents->Fill(track->Eta(), getphi(track->Phi()), fabs(track->Pt()));
-        }
+      ReadTracks(this, fEsd, tracks);
+      if (tracks.size() >= kTracksPerBatch) {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(std::vector<LegoTrack>());
+        queue.back().swap(tracks);
+        cond.notify_one();
+      }
    }
+   {
+     std::lock_guard<std::mutex> lock(mutex);
+     queue.push_back(std::vector<LegoTrack>());
+     queue.back().swap(tracks);
+     done = kTRUE;
+     cond.notify_one();
+   }
+   worker.join();
+   fTowersFrontAE = back;
 
    // Setting the current view to the first event
    t->GetEntry(0);
@@ -359,95 +438,17 @@ TEveCaloDataHist* AliEveLego::LoadAllData()
    // with this we can estimate the event efficiency
    printf("Number of events loaded: %i, with AliPhysicsSelection: %i\n",fAcceptedEvents,fCollisionCandidatesOnly);
 
-   fDataAllEvents->DataChanged();
-
-   return fDataAllEvents;
+   return FilterAllData();
 }
 
 //______________________________________________________________________________
 TEveCaloDataHist* AliEveLego::FilterData()
 {
-   // Tracks selection
-   if ( fTracksId == 2 )
-   {
-      fHistopos->Reset();
-      fHistoneg->Reset();
-      fHistoElectrons->Reset();
-      fHistoMuons->Reset();
-      fHistoPions->Reset();
-      fHistoKaons->Reset();
-      fHistoProtons->Reset();
-
-      const AliESDVertex *pv  = fEsd->GetPrimaryVertex();
-
-      for (Int_t n = 0; n < pv->GetNIndices(); n++ )
-      {
-         AliESDtrack *at = fEsd->GetTrack(pv->GetIndices()[n]);
-         const Double_t sign = at->GetSign();
-         const Int_t prob = GetParticleType(at);
-
-         if (sign > 0)
-           fHistopos->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-         if (sign < 0)
-           fHistoneg->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-         if (prob == 0)
-           fHistoElectrons->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-         if (prob == 1)
-           fHistoMuons->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-         if (prob == 2)
-           fHistoPions->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-         if (prob == 3)
-           fHistoKaons->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-         if (prob == 4)
-           fHistoProtons->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-      }
-   }
-
-   fData->DataChanged();
-
-   // Max Pt threshold
-   if (GetPtMax() >= fMaxPt){
-      for (Int_t binx = 1; binx <= 100; binx++) {
-         for (Int_t biny = 1; biny <= 80; biny++) {
-
-           if (fHistopos->GetBinContent(binx, biny) >= fMaxPt)
-             fHistopos->SetBinContent(binx, biny, fMaxPt);
-
-           if (fHistoneg->GetBinContent(binx, biny) >= fMaxPt)
-             fHistoneg->SetBinContent(binx, biny, fMaxPt);
-
-           if (fHistoElectrons->GetBinContent(binx, biny) >= fMaxPt)
-             fHistoElectrons->SetBinContent(binx, biny, fMaxPt);
-
-           if (fHistoMuons->GetBinContent(binx, biny) >= fMaxPt)
-             fHistoMuons->SetBinContent(binx, biny, fMaxPt);
-
-           if (fHistoPions->GetBinContent(binx, biny) >= fMaxPt)
-             fHistoPions->SetBinContent(binx, biny, fMaxPt);
-
-           if (fHistoKaons->GetBinContent(binx, biny) >= fMaxPt)
-             fHistoKaons->SetBinContent(binx, biny, fMaxPt);
-
-           if (fHistoProtons->GetBinContent(binx, biny) >= fMaxPt)
-             fHistoProtons->SetBinContent(binx, biny, fMaxPt);
-         }
-      }
-   }
-
-   // Particle type filter
-   if ( fParticleTypeId[0] == kFALSE) fHistopos->Reset();
-   if ( fParticleTypeId[1] == kFALSE) fHistoneg->Reset();
-   if ( fParticleTypeId[2] == kFALSE) fHistoElectrons->Reset();
-   if ( fParticleTypeId[3] == kFALSE) fHistoMuons->Reset();
-   if ( fParticleTypeId[4] == kFALSE) fHistoPions->Reset();
-   if ( fParticleTypeId[5] == kFALSE) fHistoKaons->Reset();
-   if ( fParticleTypeId[6] == kFALSE) fHistoProtons->Reset();
+   // Tracks selection, max pT threshold and particle type filter,
+   // applied when copying the tower sums to the histograms
+   TH2F *histos[kNSlices] = { fHistopos, fHistoneg, fHistoElectrons, fHistoMuons,
+                              fHistoPions, fHistoKaons, fHistoProtons };
+   CopyTowers(fTowers[fTowersFront], histos, fTracksId == 2, fParticleTypeId, fMaxPt);
 
    fData->DataChanged();
 
@@ -457,107 +458,15 @@ TEveCaloDataHist* AliEveLego::FilterData()
 //______________________________________________________________________________
 TEveCaloDataHist* AliEveLego::FilterAllData()
 {
-   // Tracks selection
-   if ( fTracksIdAE == 2 )
-   {
-      fHistoposAllEvents->Reset();
-      fHistonegAllEvents->Reset();
-      fHistoElectronsAllEvents->Reset();
-      fHistoMuonsAllEvents->Reset();
-      fHistoPionsAllEvents->Reset();
-      fHistoKaonsAllEvents->Reset();
-      fHistoProtonsAllEvents->Reset();
-
-      TTree* t = AliEveEventManager::GetMaster()->GetESDTree();
-
-      // Getting current tracks for each event, filling histograms
-      Int_t fAcceptedEvents = 0;
-      for (int event = 0; event < t->GetEntries(); event++) {
-
-        t->GetEntry(event);
-        const AliESDVertex *pv  = fEsd->GetPrimaryVertex();
-
-        if (fCollisionCandidatesOnly == kTRUE)
-          if (fPhysicsSelection->IsCollisionCandidate(fEsd) == kFALSE) continue;
-
-        fAcceptedEvents++;
-
-        for (Int_t n = 0; n < pv->GetNIndices(); n++ )
-        {
-          AliESDtrack *at = fEsd->GetTrack(pv->GetIndices()[n]);
-          const Double_t sign = at->GetSign();
-          const Int_t prob = GetParticleType(at);
-
-          if (sign > 0)
-            fHistoposAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
+   // Same as FilterData for the all events histograms,
+   // the events are read only the first time
+   if (!fDataAllEvents) return 0;
+   if (fTowersAE[fTowersFrontAE].empty()) return LoadAllData();
 
-          if (sign < 0)
-            fHistonegAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-          if (prob == 0)
-            fHistoElectronsAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-          if (prob == 1)
-            fHistoMuonsAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-          if (prob == 2)
-            fHistoPionsAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-          if (prob == 3)
-            fHistoKaonsAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-
-          if (prob == 4)
-            fHistoProtonsAllEvents->Fill(at->Eta(), getphi(at->Phi()), fabs(at->Pt()));
-        }
-      }
-      t->GetEntry(0);
-      printf("Number of events loaded: %i, with AliPhysicsSelection: %i\n",fAcceptedEvents,fCollisionCandidatesOnly);
-
-   } else {
-
-      LoadAllData();
-
-    }
-   
-   fDataAllEvents->DataChanged();
-
-   // Max Pt threshold
-   if (GetPtMaxAE() >= fMaxPtAE){
-      for (Int_t binx = 1; binx <= 100; binx++) {
-         for (Int_t biny = 1; biny <= 80; biny++) {
-
-            if (fHistoposAllEvents->GetBinContent(binx, biny) >= fMaxPtAE)            
-              fHistoposAllEvents->SetBinContent(binx, biny, fMaxPtAE);
-
-            if (fHistonegAllEvents->GetBinContent(binx, biny) >= fMaxPtAE)            
-              fHistonegAllEvents->SetBinContent(binx, biny, fMaxPtAE);
-
-            if (fHistoElectronsAllEvents->GetBinContent(binx, biny) >= fMaxPt)
-              fHistoElectronsAllEvents->SetBinContent(binx, biny, fMaxPt);
-
-            if (fHistoMuonsAllEvents->GetBinContent(binx, biny) >= fMaxPt)
-              fHistoMuonsAllEvents->SetBinContent(binx, biny, fMaxPt);
-
-            if (fHistoPionsAllEvents->GetBinContent(binx, biny) >= fMaxPt)
-              fHistoPionsAllEvents->SetBinContent(binx, biny, fMaxPt);
-
-            if (fHistoKaonsAllEvents->GetBinContent(binx, biny) >= fMaxPt)
-              fHistoKaonsAllEvents->SetBinContent(binx, biny, fMaxPt);
-
-            if (fHistoProtonsAllEvents->GetBinContent(binx, biny) >= fMaxPt)
-              fHistoProtonsAllEvents->SetBinContent(binx, biny, fMaxPt);
-         }
-      }
-   }
-
-   // Particles species and charges filter
-   if ( fParticleTypeIdAE[0] == kFALSE ) fHistoposAllEvents->Reset();
-   if ( fParticleTypeIdAE[1] == kFALSE ) fHistonegAllEvents->Reset();
-   if ( fParticleTypeIdAE[2] == kFALSE ) fHistoElectronsAllEvents->Reset();
-   if ( fParticleTypeIdAE[3] == kFALSE ) fHistoMuonsAllEvents->Reset();
-   if ( fParticleTypeIdAE[4] == kFALSE ) fHistoPionsAllEvents->Reset();
-   if ( fParticleTypeIdAE[5] == kFALSE ) fHistoKaonsAllEvents->Reset();
-   if ( fParticleTypeIdAE[6] == kFALSE ) fHistoProtonsAllEvents->Reset();
+   TH2F *histos[kNSlices] = { fHistoposAllEvents, fHistonegAllEvents, fHistoElectronsAllEvents,
+                              fHistoMuonsAllEvents, fHistoPionsAllEvents, fHistoKaonsAllEvents,
+                              fHistoProtonsAllEvents };
+   CopyTowers(fTowersAE[fTowersFrontAE], histos, fTracksIdAE == 2, fParticleTypeIdAE, fMaxPtAE);
 
    fDataAllEvents->DataChanged();
 
@@ -883,7 +792,8 @@ void AliEveLego::SetParticleType(Int_t id, Bool_t status)
   // Activate/deactivate particles types
   fParticleTypeId[id] = status;
 
-  Update();
+  FilterData();
+  gEve->Redraw3D(kTRUE);
 }
 
 //______________________________________________________________________________
@@ -897,8 +807,9 @@ void AliEveLego::SetParticleTypeAE(Int_t id, Bool_t status)
 void AliEveLego::SetMaxPt(Double_t val)
 {
    // Add new maximum
-   fMaxPt = val;   
-   Update();
+   fMaxPt = val;
+   FilterData();
+   gEve->Redraw3D(kTRUE);
 }
 
 //______________________________________________________________________________
@@ -955,7 +866,7 @@ void AliEveLego::SwitchDataType(Bool_t status)
   fPhysicsSelection = new AliPhysicsSelection();
   fPhysicsSelection->SetAnalyzeMC(fIsMC);
   fPhysicsSelection->Initialize(fEsd);
-  FilterAllData();
+  LoadAllData();
 }
 
 //______________________________________________________________________________
@@ -968,7 +879,7 @@ void AliEveLego::SetCollisionCandidatesOnly()
   } else {
     fCollisionCandidatesOnly = 0;
   }
-  FilterAllData();
+  LoadAllData();
 }
 
 /******************************************************************************/
@@ -12,6 +12,8 @@
 
 #include "TEveElement.h"
 
+#include <vector>
+
 class AliESDEvent;
 class AliEveEventSelector;
 class AliEveMultiView;
@@ -127,6 +129,10 @@ private:
   TEveCaloLegoOverlay *fHisto2dLegoOverlay;     // Overlay for calo lego
   TEveCaloLegoOverlay *fHisto2dAllEventsLegoOverlay; // Overlay for calo lego all events
   TEveWindowSlot      *fHisto2dAllEventsSlot;   // Window slot for 2d all events histogram
+  std::vector<Float_t> fTowers[2];              // Tower sums of the current event, front and back buffer
+  Int_t               fTowersFront;             // Buffer shown in the histograms
+  std::vector<Float_t> fTowersAE[2];            // Tower sums of all events, front and back buffer
+  Int_t               fTowersFrontAE;           // Buffer shown in the all events histograms
 
   AliEveLego(const AliEveLego&);                // Not implemented
   AliEveLego& operator=(const AliEveLego&);     // Not implemented
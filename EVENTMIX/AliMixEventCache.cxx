@@ -0,0 +1,166 @@
+//
+// Class AliMixEventCache
+//
+// AliMixEventCache keeps copies of already read mixed events,
+// so that a partner mixed with several main events is read only once
+//
+
+#include <TClass.h>
+#include <TClonesArray.h>
+#include <TCollection.h>
+#include <TList.h>
+
+#include "AliLog.h"
+#include "AliAODEvent.h"
+#include "AliESDEvent.h"
+
+#include "AliMixEventCache.h"
+
+//_________________________________________________________________________________________________
+AliMixEventCache::AliMixEventCache(Long64_t maxSize) :
+   fItems(),
+   fIndex(),
+   fMaxSize(maxSize),
+   fSize(0),
+   fNHits(0),
+   fNMisses(0)
+{
+   //
+   // Default constructor
+   //
+}
+
+//_________________________________________________________________________________________________
+AliMixEventCache::~AliMixEventCache()
+{
+   //
+   // Destructor
+   //
+   Clear();
+}
+
+//_________________________________________________________________________________________________
+void AliMixEventCache::Clear()
+{
+   //
+   // Removes all cached events
+   //
+   Shrink(0);
+}
+
+//_________________________________________________________________________________________________
+void AliMixEventCache::SetMaxSize(Long64_t maxSize)
+{
+   //
+   // Sets memory budget and removes events above it
+   //
+   fMaxSize = maxSize > 0 ? maxSize : 0;
+   Shrink(fMaxSize);
+}
+
+//_________________________________________________________________________________________________
+void AliMixEventCache::Shrink(Long64_t maxSize)
+{
+   //
+   // Removes least recently used events until the size is below maxSize
+   //
+   while (!fItems.empty() && (fSize > maxSize || maxSize == 0)) {
+      Item &item = fItems.back();
+      fSize -= item.fSize;
+      fIndex.erase(item.fKey);
+      delete item.fEvent;
+      fItems.pop_back();
+   }
+}
+
+//_________________________________________________________________________________________________
+Bool_t AliMixEventCache::Restore(const char *fileName, Long64_t entry, AliVEvent *ev)
+{
+   //
+   // Copies cached event into ev using the event assignment, which copies
+   // the content into the existing objects (branch addresses stay valid)
+   //
+   if (!fMaxSize || !ev) return kFALSE;
+   std::map<Key_t, ItemList_t::iterator>::iterator it = fIndex.find(Key_t(fileName, entry));
+   if (it == fIndex.end()) {
+      fNMisses++;
+      return kFALSE;
+   }
+   AliVEvent *cached = it->second->fEvent;
+   AliAODEvent *aod = dynamic_cast<AliAODEvent *>(ev);
+   AliESDEvent *esd = dynamic_cast<AliESDEvent *>(ev);
+   if (aod && dynamic_cast<AliAODEvent *>(cached)) {
+      *aod = *(static_cast<AliAODEvent *>(cached));
+   } else if (esd && dynamic_cast<AliESDEvent *>(cached)) {
+      *esd = *(static_cast<AliESDEvent *>(cached));
+   } else {
+      fNMisses++;
+      return kFALSE;
+   }
+   // move to front
+   fItems.splice(fItems.begin(), fItems, it->second);
+   fNHits++;
+   AliDebugGeneral("AliMixEventCache", AliLog::kDebug + 1, Form("Restored %s entry %lld", fileName, entry));
+   return kTRUE;
+}
+
+//_________________________________________________________________________________________________
+void AliMixEventCache::Store(const char *fileName, Long64_t entry, const AliVEvent *ev)
+{
+   //
+   // Stores a copy of the event
+   //
+   if (!fMaxSize || !ev) return;
+   Key_t key(fileName, entry);
+   if (fIndex.count(key)) return;
+
+   Long64_t size = EstimateSize(ev);
+   if (size > fMaxSize) return;
+
+   AliVEvent *copy = 0;
+   const AliAODEvent *aod = dynamic_cast<const AliAODEvent *>(ev);
+   const AliESDEvent *esd = dynamic_cast<const AliESDEvent *>(ev);
+   if (aod) copy = new AliAODEvent(*aod);
+   else if (esd) copy = new AliESDEvent(*esd);
+   if (!copy) return;
+
+   Shrink(fMaxSize - size);
+   Item item;
+   item.fKey = key;
+   item.fEvent = copy;
+   item.fSize = size;
+   fItems.push_front(item);
+   fIndex[key] = fItems.begin();
+   fSize += size;
+}
+
+//_________________________________________________________________________________________________
+Long64_t AliMixEventCache::EstimateSize(const AliVEvent *ev)
+{
+   //
+   // Estimated size of the event: the objects in its clones arrays
+   // (heap memory owned by these objects is not counted)
+   //
+   if (!ev) return 0;
+   Long64_t size = ev->IsA()->Size();
+   TList *list = ev->GetList();
+   if (!list) return size;
+   TIter next(list);
+   TObject *obj;
+   while ((obj = next())) {
+      TClonesArray *arr = dynamic_cast<TClonesArray *>(obj);
+      if (arr && arr->GetClass()) size += (Long64_t)arr->GetEntriesFast() * arr->GetClass()->Size();
+      else size += obj->IsA()->Size();
+   }
+   return size;
+}
+
+//_________________________________________________________________________________________________
+void AliMixEventCache::Print() const
+{
+   //
+   // Prints usage of the cache
+   //
+   AliInfoGeneral("AliMixEventCache", Form("%d events, %.1f/%.1f MB, hits %lld, misses %lld", GetNEvents(),
+                fSize / 1048576., fMaxSize / 1048576., fNHits, fNMisses));
+}
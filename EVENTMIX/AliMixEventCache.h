@@ -0,0 +1,64 @@
+//
+// Class AliMixEventCache
+//
+// AliMixEventCache keeps copies of already read mixed events,
+// so that a partner mixed with several main events is read only once
+//
+
+#ifndef ALIMIXEVENTCACHE_H
+#define ALIMIXEVENTCACHE_H
+
+#include <TString.h>
+
+#include <list>
+#include <map>
+#include <string>
+#include <utility>
+
+class AliVEvent;
+class AliMixEventCache {
+public:
+   AliMixEventCache(Long64_t maxSize = 0);
+   virtual ~AliMixEventCache();
+
+   // copies cached event into ev, returns kFALSE if not cached
+   Bool_t      Restore(const char *fileName, Long64_t entry, AliVEvent *ev);
+   // stores a copy of ev (only AliAODEvent and AliESDEvent)
+   void        Store(const char *fileName, Long64_t entry, const AliVEvent *ev);
+   void        Clear();
+
+   // memory budget in bytes (0 - cache disabled)
+   void        SetMaxSize(Long64_t maxSize);
+   Long64_t    GetMaxSize() const { return fMaxSize; }
+   Long64_t    GetSize() const { return fSize; }
+   Int_t       GetNEvents() const { return (Int_t)fItems.size(); }
+   Long64_t    GetNHits() const { return fNHits; }
+   Long64_t    GetNMisses() const { return fNMisses; }
+
+   void        Print() const;
+
+   static Long64_t EstimateSize(const AliVEvent *ev);
+
+private:
+   typedef std::pair<std::string, Long64_t> Key_t;
+   struct Item {
+      Key_t      fKey;     // file name and entry in its tree
+      AliVEvent *fEvent;   // copy of the event
+      Long64_t   fSize;    // estimated size of the copy
+   };
+   typedef std::list<Item> ItemList_t;
+
+   void        Shrink(Long64_t maxSize);
+
+   ItemList_t  fItems;                                  // cached events, most recently used first
+   std::map<Key_t, ItemList_t::iterator> fIndex;        // position of each cached event
+   Long64_t    fMaxSize;                                // memory budget in bytes
+   Long64_t    fSize;                                   // estimated size of cached events
+   Long64_t    fNHits;                                  // number of restored events
+   Long64_t    fNMisses;                                // number of events not found
+
+   AliMixEventCache(const AliMixEventCache &cache);
+   AliMixEventCache &operator=(const AliMixEventCache &cache);
+};
+
+#endif
@@ -134,17 +134,14 @@ Int_t AliMixEventCutObj::GetNumberOfBins() const
 Int_t AliMixEventCutObj::GetBinNumber(Float_t num) const
 {
    //
-   // Returns bin (index) number in current cut.
+   // Returns bin (index) number in current cut (1..GetNumberOfBins()).
    // Returns -1 in case of out of range
    //
-   Int_t binNum = 0;
-   for (Float_t iCurrent = fCutMin; iCurrent < fCutMax; iCurrent += fCutStep) {
-      binNum++;
-      if ((num >= iCurrent) && (num < iCurrent + fCutStep - fCutSmallVal)) {
-         return binNum;
-      }
-   }
-   return -1;
+   if (fCutStep < 1e-5 || num < fCutMin) return -1;
+   Int_t binNum = (Int_t)((num - fCutMin) / fCutStep);
+   if (binNum >= GetNumberOfBins()) return -1;
+   if (num >= fCutMin + (binNum + 1) * fCutStep - fCutSmallVal) return -1;
+   return binNum + 1;
 }
 
 //_________________________________________________________________________________________________
@@ -0,0 +1,72 @@
+//
+// Class AliMixEventEntryBuffer
+//
+// AliMixEventEntryBuffer keeps the last entry numbers of events
+// in one bin of AliMixEventPool
+//
+
+#include "AliMixEventEntryBuffer.h"
+
+ClassImp(AliMixEventEntryBuffer)
+
+//_________________________________________________________________________________________________
+AliMixEventEntryBuffer::AliMixEventEntryBuffer(Int_t capacity) : TObject(),
+   fEntries(),
+   fN(0),
+   fCapacity(capacity > 0 ? capacity : 0)
+{
+   //
+   // Default constructor
+   //
+   fEntries.reserve(fCapacity);
+}
+
+//_________________________________________________________________________________________________
+Bool_t AliMixEventEntryBuffer::Enter(Long64_t entry)
+{
+   //
+   // Adds entry, overwriting the oldest one when full.
+   // As TEntryList, the same entry is not entered twice in a row
+   //
+   if (fN > 0 && GetEntry(fN - 1) == entry) return kFALSE;
+   if (fCapacity > 0 && fN >= fCapacity) {
+      fEntries[fN % fCapacity] = entry;
+   } else {
+      fEntries.push_back(entry);
+   }
+   fN++;
+   return kTRUE;
+}
+
+//_________________________________________________________________________________________________
+void AliMixEventEntryBuffer::Reset()
+{
+   //
+   // Removes all entries
+   //
+   fEntries.clear();
+   fN = 0;
+}
+
+//_________________________________________________________________________________________________
+Long64_t AliMixEventEntryBuffer::GetEntry(Long64_t i) const
+{
+   //
+   // Returns i-th entered entry
+   //
+   if (i < 0 || i >= fN) return -1;
+   if (fCapacity == 0) return fEntries[i];
+   if (i < fN - fCapacity) return -1;
+   return fEntries[i % fCapacity];
+}
+
+//_________________________________________________________________________________________________
+void AliMixEventEntryBuffer::SetCapacity(Int_t capacity)
+{
+   //
+   // Sets number of kept entries and removes all entries
+   //
+   fCapacity = capacity > 0 ? capacity : 0;
+   Reset();
+   fEntries.reserve(fCapacity);
+}
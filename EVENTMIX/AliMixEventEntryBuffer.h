@@ -0,0 +1,41 @@
+//
+// Class AliMixEventEntryBuffer
+//
+// AliMixEventEntryBuffer keeps the last entry numbers of events
+// in one bin of AliMixEventPool
+//
+
+#ifndef ALIMIXEVENTENTRYBUFFER_H
+#define ALIMIXEVENTENTRYBUFFER_H
+
+#include <TObject.h>
+
+#include <vector>
+
+class AliMixEventEntryBuffer : public TObject {
+public:
+   AliMixEventEntryBuffer(Int_t capacity = 0);
+   virtual ~AliMixEventEntryBuffer() {}
+
+   // adds entry, returns kFALSE if it was the last one entered
+   Bool_t      Enter(Long64_t entry);
+   void        Reset();
+
+   // number of entries entered since the last Reset
+   Long64_t    GetN() const { return fN; }
+   // i-th entered entry, -1 if it was already overwritten
+   Long64_t    GetEntry(Long64_t i) const;
+
+   // sets number of kept entries (0 - keep all), removes all entries
+   void        SetCapacity(Int_t capacity);
+   Int_t       GetCapacity() const { return fCapacity; }
+
+private:
+   std::vector<Long64_t> fEntries;     // entries, ring of size fCapacity if fCapacity>0
+   Long64_t    fN;                     // number of entries entered
+   Int_t       fCapacity;              // number of kept entries (0 - keep all)
+
+   ClassDef(AliMixEventEntryBuffer, 1)
+};
+
+#endif
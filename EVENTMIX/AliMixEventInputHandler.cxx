@@ -9,9 +9,9 @@
 
 #include <TFile.h>
 #include <TChain.h>
-#include <TEntryList.h>
 #include "AliLog.h"
 #include "AliMixEventPool.h"
+#include "AliMixEventEntryBuffer.h"
 #include "AliMixEventInputHandler.h"
 #include "AliAnalysisManager.h"
 
@@ -189,7 +189,8 @@ Bool_t AliMixEventInputHandler::GetEntry() {
    AliDebug(AliLog::kDebug, Form("++++++++++++++ BEGIN SETUP EVENT %lld +++++++++++++++++++", fEntryCounter));
 
    fMixEventNumber = 0;
-   TEntryList *el = fEventPool->FindEntryList(inEvHMain->GetEvent());
+   Int_t idEntryList = -1;
+   AliMixEventEntryBuffer *el = fEventPool->FindEntryList(inEvHMain->GetEvent(), idEntryList);
    Long64_t elNum = 0;
    if (el)
       elNum = el->GetN();
@@ -8,10 +8,9 @@
 //        Martin Vala (martin.vala@cern.ch)
 //
 
-#include <TEntryList.h>
-
 #include "AliLog.h"
 #include "AliMixEventCutObj.h"
+#include "AliMixEventEntryBuffer.h"
 
 #include "AliMixEventPool.h"
 
@@ -23,7 +22,9 @@ AliMixEventPool::AliMixEventPool(const char *name, const char *title) : TNamed(n
    fListOfEventCuts(),
    fBinNumber(0),
    fBufferSize(0),
-   fMixNumber(0)
+   fMixNumber(0),
+   fEntryBufferSize(0),
+   fBinStrides()
 {
    //
    // Default constructor.
@@ -37,7 +38,9 @@ AliMixEventPool::AliMixEventPool(const AliMixEventPool &obj) : TNamed(obj),
    fListOfEventCuts(obj.fListOfEventCuts),
    fBinNumber(obj.fBinNumber),
    fBufferSize(obj.fBufferSize),
-   fMixNumber(obj.fMixNumber)
+   fMixNumber(obj.fMixNumber),
+   fEntryBufferSize(obj.fEntryBufferSize),
+   fBinStrides(obj.fBinStrides)
 {
    //
    // Copy constructor
@@ -59,6 +62,8 @@ AliMixEventPool &AliMixEventPool::operator=(const AliMixEventPool &obj)
       fBinNumber = obj.fBinNumber;
       fBufferSize = obj.fBufferSize;
       fMixNumber = obj.fMixNumber;
+      fEntryBufferSize = obj.fEntryBufferSize;
+      fBinStrides = obj.fBinStrides;
    }
    return *this;
 }
@@ -94,9 +99,9 @@ void AliMixEventPool::Print(const Option_t *option) const
       cut->Print(option);
    }
    AliDebug(AliLog::kDebug, Form("NumOfEntryList %d", fListOfEntryList.GetEntries()));
-   TEntryList *el;
+   AliMixEventEntryBuffer *el;
    for (Int_t i = 0; i < fListOfEntryList.GetEntries(); i++) {
-      el = (TEntryList *) fListOfEntryList.At(i);
+      el = (AliMixEventEntryBuffer *) fListOfEntryList.At(i);
       AliDebug(AliLog::kDebug, Form("EntryList[%d] %lld", i, el->GetN()));
    }
 }
@@ -104,59 +109,42 @@ void AliMixEventPool::Print(const Option_t *option) const
 Int_t AliMixEventPool::Init()
 {
    //
-   // Init event pool
+   // Init event pool, one entry buffer per bin combination
    //
    AliDebug(AliLog::kDebug + 5, "<-");
-   CreateEntryListsRecursivly(fListOfEventCuts.GetEntries() - 1);
-   fBinNumber++;
+   InitBinStrides();
+   fBinNumber = fBinStrides.empty() ? 1 : fBinStrides.back();
    AliDebug(AliLog::kDebug, Form("fBinnumber = %d", fBinNumber));
-   AddEntryList();
+   fListOfEntryList.Expand(fBinNumber);
+   for (Int_t i = 0; i < fBinNumber; i++) AddEntryList();
    AliDebug(AliLog::kDebug + 5, "->");
    return 0;
 }
 
 //_________________________________________________________________________________________________
-void AliMixEventPool::CreateEntryListsRecursivly(Int_t index)
+void AliMixEventPool::InitBinStrides()
 {
    //
-   // Helper function which create entrylist recursivly
+   // Strides of the linear bin index, the last element is the number of bins
    //
-   AliDebug(AliLog::kDebug + 5, "<-");
+   Int_t num = fListOfEventCuts.GetEntriesFast();
+   fBinStrides.assign(num + 1, 1);
    AliMixEventCutObj *cut;
-   if (index >= 0) {
-      AliDebug(AliLog::kDebug + 1, Form("index = %d", index));
-      cut = dynamic_cast<AliMixEventCutObj *>(fListOfEventCuts.At(index));
-      if (!cut) return;
-      cut->Reset();
-      while (cut->HasMore()) {
-         cut->AddStep();
-         CreateEntryListsRecursivly(index - 1);
-         if (cut->HasMore()) {
-            fBinNumber++;
-            AliDebug(AliLog::kDebug + 1, Form("fBinnumber = %d", fBinNumber));
-            AddEntryList();
-            //                 PrintCurrentCutIntervals();
-         }
-      }
+   for (Int_t i = 0; i < num; i++) {
+      cut = (AliMixEventCutObj *) fListOfEventCuts.At(i);
+      fBinStrides[i + 1] = fBinStrides[i] * cut->GetNumberOfBins();
    }
-   AliDebug(AliLog::kDebug + 5, "->");
 }
 
 //_________________________________________________________________________________________________
-TEntryList *AliMixEventPool::AddEntryList()
+AliMixEventEntryBuffer *AliMixEventPool::AddEntryList()
 {
    //
-   // Adds endtry list
+   // Adds entry buffer
    //
    AliDebug(AliLog::kDebug + 5, "<-");
-   TObjArrayIter next(&fListOfEventCuts);
-   AliMixEventCutObj *cut;
-   while ((cut = (AliMixEventCutObj *) next())) {
-      if (cut) cut->PrintCurrentInterval();
-   }
-   TEntryList *el = new TEntryList;
+   AliMixEventEntryBuffer *el = new AliMixEventEntryBuffer(fEntryBufferSize);
    fListOfEntryList.Add(el);
-   AliDebug(AliLog::kDebug + 1, Form("Number in Entry list -> %lld", el->GetN()));
    AliDebug(AliLog::kDebug + 5, "->");
    return el;
 }
@@ -165,7 +153,7 @@ TEntryList *AliMixEventPool::AddEntryList()
 Bool_t AliMixEventPool::AddEntry(Long64_t entry, AliVEvent *ev)
 {
    //
-   // Adds entry to correct entry list
+   // Adds entry to correct entry buffer
    //
    AliDebug(AliLog::kDebug + 5, "<-");
    AliDebug(AliLog::kDebug + 5, Form("AddEntry(%lld,%p)", entry, (void *)ev));
@@ -174,7 +162,7 @@ Bool_t AliMixEventPool::AddEntry(Long64_t entry, AliVEvent *ev)
       return kFALSE;
    }
    Int_t idEntryList = -1;
-   TEntryList *el =  FindEntryList(ev, idEntryList);
+   AliMixEventEntryBuffer *el =  FindEntryList(ev, idEntryList);
    if (el) {
       el->Enter(entry);
       AliDebug(AliLog::kDebug, Form("Entry %lld was added with idEntryList %d !!!", entry, idEntryList));
@@ -186,55 +174,36 @@ Bool_t AliMixEventPool::AddEntry(Long64_t entry, AliVEvent *ev)
 }
 
 //_________________________________________________________________________________________________
-TEntryList *AliMixEventPool::FindEntryList(AliVEvent *ev, Int_t &idEntryList)
+Int_t AliMixEventPool::GetBinIndex(AliVEvent *ev)
 {
    //
-   // Find entrlist in list of entrlist
+   // Linear bin index of the event: sum of (bin - 1) * stride over all cuts
    //
-   AliDebug(AliLog::kDebug + 5, "<-");
    Int_t num = fListOfEventCuts.GetEntriesFast();
-   if (num < 1) return 0;
-   Int_t *indexes = new Int_t[num] ;
-   Int_t *lenght = new Int_t[num];
-   Int_t i = 0;
-   TObjArrayIter next(&fListOfEventCuts);
+   if (num < 1) return -1;
+   if ((Int_t) fBinStrides.size() != num + 1) InitBinStrides();
+   Int_t index = 0, bin;
    AliMixEventCutObj *cut;
-   while ((cut = (AliMixEventCutObj *) next())) {
-      indexes[i] = cut->GetIndex(ev);
-      if (indexes[i] < 0) {
-         AliDebug(AliLog::kDebug, Form("idEntryList %d", -1));
-         delete [] indexes;
-         delete [] lenght;
-         return 0;
-      }
-      lenght[i] = cut->GetNumberOfBins();
-      AliDebug(AliLog::kDebug + 1, Form("indexes[%d] %d", i, indexes[i]));
-      i++;
+   for (Int_t i = 0; i < num; i++) {
+      cut = (AliMixEventCutObj *) fListOfEventCuts.At(i);
+      bin = cut->GetIndex(ev);
+      if (bin < 0) return -1;
+      index += (bin - 1) * fBinStrides[i];
    }
-   idEntryList = 0;
-   SearchIndexRecursive(fListOfEventCuts.GetEntries() - 1, &indexes[0], &lenght[0], idEntryList);
-   AliDebug(AliLog::kDebug, Form("idEntryList %d", idEntryList - 1));
-   // index which start with 0 (idEntryList-1)
-   delete [] indexes;
-   delete [] lenght;
-   AliDebug(AliLog::kDebug + 5, "->");
-   return (TEntryList *) fListOfEntryList.At(idEntryList - 1);
+   return index;
 }
 
 //_________________________________________________________________________________________________
-void AliMixEventPool::SearchIndexRecursive(Int_t num, Int_t *i, Int_t *d, Int_t &index)
+AliMixEventEntryBuffer *AliMixEventPool::FindEntryList(AliVEvent *ev, Int_t &idEntryList)
 {
    //
-   // Search for index of entrylist
+   // Find entry buffer of the event
    //
-   AliDebug(AliLog::kDebug + 5, "<-");
-   if (num > 0) {
-      index += (i[num] - 1) * d[num - 1];
-      SearchIndexRecursive(num - 1, i, d, index);
-   } else {
-      index += i[num];
-   }
-   AliDebug(AliLog::kDebug + 5, "->");
+   Int_t index = GetBinIndex(ev);
+   AliDebug(AliLog::kDebug, Form("idEntryList %d", index));
+   if (index < 0) return 0;
+   idEntryList = index + 1;
+   return (AliMixEventEntryBuffer *) fListOfEntryList.At(index);
 }
 
 //_________________________________________________________________________________________________
@@ -14,7 +14,9 @@
 #include <TObjArray.h>
 #include <TNamed.h>
 
-class TEntryList;
+#include <vector>
+
+class AliMixEventEntryBuffer;
 class AliMixEventCutObj;
 class AliVEvent;
 class AliMixEventPool : public TNamed {
@@ -30,12 +32,13 @@ public:
    // inits correctly object
    Int_t       Init();
 
-   void        CreateEntryListsRecursivly(Int_t index);
-   void        SearchIndexRecursive(Int_t num, Int_t *i, Int_t *d, Int_t &index);
-   TEntryList *AddEntryList();
+   AliMixEventEntryBuffer *AddEntryList();
 
    Bool_t      AddEntry(Long64_t entry, AliVEvent *ev);
-   TEntryList *FindEntryList(AliVEvent *ev, Int_t &idEntryList);
+   // entries of the bin of the event, idEntryList is the bin index + 1
+   AliMixEventEntryBuffer *FindEntryList(AliVEvent *ev, Int_t &idEntryList);
+   // linear bin index (first cut runs fastest), -1 if out of range
+   Int_t       GetBinIndex(AliVEvent *ev);
 
    void        AddCut(AliMixEventCutObj *cut);
 
@@ -48,17 +51,25 @@ public:
    void        SetMixNumber(Int_t numMix) { fMixNumber = numMix; }
    Int_t       GetBufferSize() const { return fBufferSize; }
    Int_t       GetMixNumber() const { return fMixNumber; }
+   // number of entries kept in each bin (0 - keep all), to be set before Init
+   void        SetEntryBufferSize(Int_t size) { fEntryBufferSize = size; }
+   Int_t       GetEntryBufferSize() const { return fEntryBufferSize; }
 
 private:
 
-   TObjArray   fListOfEntryList;       // list of entry lists
+   void        InitBinStrides();
+
+   TObjArray   fListOfEntryList;       // list of entry buffers (one per bin)
    TObjArray   fListOfEventCuts;       // list of entry lists
 
    Int_t       fBinNumber;             // bin number
    Int_t       fBufferSize;            // buffer size
    Int_t       fMixNumber;             // mixing number
+   Int_t       fEntryBufferSize;       // number of entries kept in each bin (0 - keep all)
+
+   std::vector<Int_t> fBinStrides;     //! stride of each cut in the linear bin index
 
-   ClassDef(AliMixEventPool, 1)
+   ClassDef(AliMixEventPool, 2)
 };
 
 #endif
@@ -11,12 +11,16 @@
 #include <TChain.h>
 #include <TChainElement.h>
 #include <TSystem.h>
+#include <TMath.h>
+#include <TObjString.h>
 
 #include "AliLog.h"
 #include "AliAnalysisManager.h"
 #include "AliInputEventHandler.h"
 
 #include "AliMixEventPool.h"
+#include "AliMixEventEntryBuffer.h"
+#include "AliMixEventCache.h"
 #include "AliMixInputEventHandler.h"
 #include "AliMixInputHandlerInfo.h"
 
@@ -43,12 +47,16 @@ AliMixInputEventHandler::AliMixInputEventHandler(const Int_t size, const Int_t m
    fCurrentBinIndex(-1),
    fOfflineTriggerMask(0),
    fCurrentMixEntry(),
-   fCurrentEntryMainTree(0)
+   fCurrentEntryMainTree(0),
+   fMixBranches(),
+   fMixEventCacheSize(0),
+   fMixEventCache(0)
 {
    //
    // Default constructor.
    //
    AliDebug(AliLog::kDebug + 10, "<-");
+   fMixBranches.SetOwner(kTRUE);
    SetMixNumber(mixNum);
    AliDebug(AliLog::kDebug + 10, "->");
 }
@@ -59,6 +67,19 @@ AliMixInputEventHandler::~AliMixInputEventHandler() {
    // Destructor
    //
    fMixTrees.Clear();
+   if (fMixEventCache) {
+      fMixEventCache->Print();
+      delete fMixEventCache;
+   }
+}
+
+//_____________________________________________________________________________
+void AliMixInputEventHandler::AddMixBranch(const char *name)
+{
+   //
+   // Adds branch to be read in mixed events
+   //
+   if (name && !fMixBranches.FindObject(name)) fMixBranches.Add(new TObjString(name));
 }
 
 //_____________________________________________________________________________
@@ -149,17 +170,25 @@ Bool_t AliMixInputEventHandler::Notify(const char *path)
    fMixIntupHandlerInfoTmp->AddTreeToChain(path);
    Int_t lastIndex = fMixIntupHandlerInfoTmp->GetChain()->GetListOfFiles()->GetEntries();
    TChainElement *che = (TChainElement *)fMixIntupHandlerInfoTmp->GetChain()->GetListOfFiles()->At(lastIndex - 1);
+   if (fMixEventCacheSize > 0 && !fMixEventCache)
+      fMixEventCache = new AliMixEventCache((Long64_t)(fMixEventCacheSize * 1048576.));
    AliMixInputHandlerInfo *mixIHI = 0;
    for (Int_t i = 0; i < fInputHandlers.GetEntries(); i++) {
       AliDebug(AliLog::kDebug + 5, Form("fInputHandlers[%d]", i));
       mixIHI = new AliMixInputHandlerInfo(fMixIntupHandlerInfoTmp->GetName(), fMixIntupHandlerInfoTmp->GetTitle());
+      mixIHI->SetEventCache(fMixEventCache);
+      mixIHI->SetActiveBranches(&fMixBranches);
       if (doPrepareEntry) mixIHI->PrepareEntry(che, -1, (AliInputEventHandler *)InputEventHandler(i), fAnalysisType);
       AliDebug(AliLog::kDebug + 5, Form("chain[%d]->GetEntries() = %lld", i, mixIHI->GetChain()->GetEntries()));
       fMixTrees.Add(mixIHI);
    }
    AliDebug(AliLog::kDebug + 5, Form("fEntryCounter=%lld", fEntryCounter));
-   if (fEventPool && fEventPool->NeedInit())
+   if (fEventPool && fEventPool->NeedInit()) {
+      // keep only the entries which can still be mixed
+      if (!fEventPool->GetEntryBufferSize())
+         fEventPool->SetEntryBufferSize(TMath::Max(fBufferSize, 2 * fMixNumber + 1) + 2);
       fEventPool->Init();
+   }
    if (fUseDefautProcess) {
       AliDebug(AliLog::kDebug, Form("-> SKIPPED"));
       return AliMultiInputEventHandler::Notify(path);
@@ -304,7 +333,7 @@ Bool_t AliMixInputEventHandler::MixBuffer()
    // reset mix number
    fNumberMixed = 0;
    Long64_t elNum = 0;
-   TEntryList *el = 0;
+   AliMixEventEntryBuffer *el = 0;
    Int_t idEntryList = -1;
    if (fEventPool) el = fEventPool->FindEntryList(inEvHMain->GetEvent(), idEntryList);
    // return in case of 0 entry in full chain
@@ -405,7 +434,7 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithOneEvent()
    fNumberMixed = 0;
    Long64_t elNum = 0;
    Int_t idEntryList = -1;
-   TEntryList *el = 0;
+   AliMixEventEntryBuffer *el = 0;
    if (fEventPool) el = fEventPool->FindEntryList(inEvHMain->GetEvent(), idEntryList);
    // return in case of 0 entry in full chain
    if (!fEntryCounter) {
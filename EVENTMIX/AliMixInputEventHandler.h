@@ -22,6 +22,7 @@ class TChain;
 class TChainElement;
 class AliMixEventPool;
 class AliMixInputHandlerInfo;
+class AliMixEventCache;
 class AliInputEventHandler;
 class AliMixInputEventHandler : public AliMultiInputEventHandler {
 
@@ -73,6 +74,13 @@ public:
 
    Bool_t                  GetEntryMainEvent();
    Bool_t                  GetEntryMixedEvent(Int_t idHandler=0);
+
+   // reads only these branches of mixed events (all if none added)
+   void                    AddMixBranch(const char *name);
+   // keeps decoded mixed events up to sizeMB (0 - no cache)
+   void                    SetMixEventCacheSize(Double_t sizeMB) { fMixEventCacheSize = sizeMB; }
+   Double_t                GetMixEventCacheSize() const { return fMixEventCacheSize; }
+   AliMixEventCache       *GetMixEventCache() const { return fMixEventCache; }
 protected:
 
    TObjArray               fMixTrees;              // buffer of input handlers
@@ -100,6 +108,10 @@ private:
    TEntryList fCurrentMixEntry;    //! array of mix entries currently used (user should touch)
    Long64_t fCurrentEntryMainTree; //! current entry in current tree (main event)
 
+   TObjArray fMixBranches;         // branches read in mixed events
+   Double_t  fMixEventCacheSize;   // memory budget of fMixEventCache in MB
+   AliMixEventCache *fMixEventCache; //! decoded mixed events
+
    virtual Bool_t          MixStd();
    virtual Bool_t          MixBuffer();
    virtual Bool_t          MixEventsMoreTimesWithOneEvent();
@@ -110,7 +122,7 @@ private:
    AliMixInputEventHandler(const AliMixInputEventHandler &handler);
    AliMixInputEventHandler &operator=(const AliMixInputEventHandler &handler);
 
-   ClassDef(AliMixInputEventHandler, 5)
+   ClassDef(AliMixInputEventHandler, 6)
 };
 
 #endif
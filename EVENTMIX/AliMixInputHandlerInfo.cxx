@@ -11,9 +11,11 @@
 #include <TChain.h>
 #include <TFile.h>
 #include <TChainElement.h>
+#include <TObjArray.h>
 
 #include "AliLog.h"
 #include "AliInputEventHandler.h"
+#include "AliMixEventCache.h"
 
 #include "AliMixInputHandlerInfo.h"
 
@@ -24,7 +26,9 @@ AliMixInputHandlerInfo::AliMixInputHandlerInfo(const char *name, const char *tit
    fChain(0),
    fChainEntriesArray(),
    fZeroEntryNumber(0),
-   fNeedNotify(kFALSE)
+   fNeedNotify(kFALSE),
+   fEventCache(0),
+   fActiveBranches(0)
 {
    //
    // Default constructor.
@@ -133,11 +137,18 @@ void AliMixInputHandlerInfo::PrepareEntry(TChainElement *te, Long64_t entry, Ali
          fChain->GetEntry(0);
          eh->Init(opt);
          eh->Init(fChain->GetTree(), opt);
+         ApplyActiveBranches();
       }
       fNeedNotify = kTRUE;
       AliDebug(AliLog::kDebug + 5, "->");
       return;
    }
+   // event already decoded for another main event
+   if (fChain && !fNeedNotify && fEventCache && fEventCache->Restore(te->GetTitle(), entry, eh->GetEvent())) {
+      AliDebug(AliLog::kDebug, Form("Entry %lld of %s restored from cache", entry, te->GetTitle()));
+      AliDebug(AliLog::kDebug + 5, "->");
+      return;
+   }
    if (fChain) {
       AliDebug(AliLog::kDebug, Form("Filename is %s", fChain->GetTree()->GetCurrentFile()->GetName()));
       TString fn = fChain->GetTree()->GetCurrentFile()->GetName();
@@ -151,6 +162,7 @@ void AliMixInputHandlerInfo::PrepareEntry(TChainElement *te, Long64_t entry, Ali
          fChain->GetEntry(0);
          eh->Init(opt);
          eh->Init(fChain->GetTree(), opt);
+         ApplyActiveBranches();
          eh->Notify(te->GetTitle());
          fChain->GetEntry(entry);
          eh->BeginEvent(entry);
@@ -164,6 +176,7 @@ void AliMixInputHandlerInfo::PrepareEntry(TChainElement *te, Long64_t entry, Ali
          eh->BeginEvent(entry);
          // file is in tree fChain already
       }
+      if (fEventCache) fEventCache->Store(te->GetTitle(), entry, eh->GetEvent());
    }
    AliDebug(AliLog::kDebug, Form("We are USING file %s ...", te->GetTitle()));
    AliDebug(AliLog::kDebug, Form("We are USING file from fChain->GetTree() %s ...", fChain->GetTree()->GetCurrentFile()->GetName()));
@@ -180,3 +193,19 @@ Long64_t AliMixInputHandlerInfo::GetEntries()
    if (fChain) return fChain->GetEntries();
    return -1;
 }
+
+//_____________________________________________________________________________
+void AliMixInputHandlerInfo::ApplyActiveBranches()
+{
+   //
+   // Reads only the requested branches of the mixed events
+   //
+   if (!fChain || !fActiveBranches || fActiveBranches->GetEntriesFast() == 0) return;
+   fChain->SetBranchStatus("*", 0);
+   TIter next(fActiveBranches);
+   TObject *name;
+   while ((name = next())) {
+      AliDebug(AliLog::kDebug, Form("Reading branch %s", name->GetName()));
+      fChain->SetBranchStatus(name->GetName(), 1);
+   }
+}
@@ -15,7 +15,9 @@
 class TTree;
 class TChain;
 class TChainElement;
+class TObjArray;
 class AliInputEventHandler;
+class AliMixEventCache;
 class AliMixInputHandlerInfo : public TNamed {
 
 public:
@@ -33,16 +35,25 @@ public:
    TChainElement *GetEntryInTree(Long64_t &entry);
    Long64_t      GetEntries();
 
+   // decoded events shared by all mixing handlers (not owned)
+   void SetEventCache(AliMixEventCache *cache) { fEventCache = cache; }
+   // names of branches to read (not owned, all branches if null or empty)
+   void SetActiveBranches(const TObjArray *branches) { fActiveBranches = branches; }
+
 private:
    TChain    *fChain;              // current chain
    TArrayI   fChainEntriesArray;   // array of entries of every chaing
    Long64_t  fZeroEntryNumber;     // zero entry number (will be used when we will delete not needed chains)
    Bool_t    fNeedNotify;          // flag if Notify is needed for current input handler
+   AliMixEventCache *fEventCache;  //! cache of decoded mixed events
+   const TObjArray  *fActiveBranches; //! branches read for mixed events
+
+   void ApplyActiveBranches();
 
    AliMixInputHandlerInfo(const AliMixInputHandlerInfo &handler);
    AliMixInputHandlerInfo &operator=(const AliMixInputHandlerInfo &handler);
 
-   ClassDef(AliMixInputHandlerInfo, 1); // Mix Input Handler info
+   ClassDef(AliMixInputHandlerInfo, 2); // Mix Input Handler info
 };
 
 #endif // ALIMIXINPUTHANDLERINFO_H
@@ -1,6 +1,7 @@
 #ifdef __CINT__
 
 #pragma link C++ class AliMixEventCutObj+;
+#pragma link C++ class AliMixEventEntryBuffer+;
 #pragma link C++ class AliMixEventPool+;
 
 #pragma link C++ class AliMixInfo+;
@@ -89,7 +89,7 @@ void AliFastJetBkg::BkgFastJetb(Double_t& rho,Double_t& sigma,
   AliFastJetHeaderV1 *header = (AliFastJetHeaderV1*)fHeader; 
   Int_t debug  = header->GetDebug();     // debug option
   if(debug>0) cout<<"===============  AliFastJetBkg::BkgFastJetb()  =========== "<<endl;
-  vector<fastjet::PseudoJet> inputParticles=fInputFJ->GetInputParticles();
+  const vector<fastjet::PseudoJet>& inputParticles=fInputFJ->GetInputParticles();
   
   double rParamBkg = header->GetRparamBkg(); //Radius for background calculation
 
@@ -111,7 +111,7 @@ void AliFastJetBkg::BkgFastJetWoHardest(Double_t& rho,Double_t& sigma,
   AliFastJetHeaderV1 *header = (AliFastJetHeaderV1*)fHeader; 
   Int_t debug  = header->GetDebug();     // debug option
   if(debug) cout<<"===============  AliFastJetBkg::BkgWoHardest()  =========== "<<endl;
-  vector<fastjet::PseudoJet> inputParticles=fInputFJ->GetInputParticles();
+  const vector<fastjet::PseudoJet>& inputParticles=fInputFJ->GetInputParticles();
   
   double rParamBkg = header->GetRparamBkg(); //Radius for background calculation  
   Double_t medianb,sigmab,meanareab;
@@ -125,7 +125,7 @@ void AliFastJetBkg::BkgFastJetWoHardest(Double_t& rho,Double_t& sigma,
 //____________________________________________________________________
 void AliFastJetBkg::CalcRhob(Double_t& median,Double_t& 
 			     sigma,Double_t& 
-			     meanarea,vector<fastjet::PseudoJet> inputParticles,Double_t 
+			     meanarea,const vector<fastjet::PseudoJet>& inputParticles,Double_t 
 			     rParamBkg,TString method)
 {
   // calculate rho using the fastjet method
@@ -191,7 +191,7 @@ void AliFastJetBkg::CalcRhob(Double_t& median,Double_t&
 
 //____________________________________________________________________
 void AliFastJetBkg::CalcRhoWoHardest(Double_t& median,Double_t& 
-				     sigma,Double_t& meanarea,vector<fastjet::PseudoJet> inputParticles,Double_t 
+				     sigma,Double_t& meanarea,const vector<fastjet::PseudoJet>& inputParticles,Double_t 
 				     rParamBkg,TString method)
 {
   // calculate rho (without the hardest jet) using the fastjet method
@@ -266,7 +266,7 @@ Float_t AliFastJetBkg::BkgFastJet()
   Int_t debug  = header->GetDebug();     // debug option
 
   if(debug>0) cout<<"===============  AliFastJetBkg::BkgFastJet()  =========== "<<endl;
-  vector<fastjet::PseudoJet> inputParticles=fInputFJ->GetInputParticles();
+  const vector<fastjet::PseudoJet>& inputParticles=fInputFJ->GetInputParticles();
   
   if(debug>0) cout<<"printing inputParticles for BKG "<<inputParticles.size()<<endl;
   
@@ -287,7 +287,7 @@ Float_t AliFastJetBkg::BkgChargedFastJet()
 
   if(debug>0) cout<<"===============  AliFastJetBkg::BkgChargedFastJet()  =========== "<<endl;
 
-  vector<fastjet::PseudoJet> inputParticlesCharged=fInputFJ->GetInputParticlesCh();
+  const vector<fastjet::PseudoJet>& inputParticlesCharged=fInputFJ->GetInputParticlesCh();
   
   if(debug>0) cout<<"printing CHARGED inputParticles for BKG "<<inputParticlesCharged.size()<<endl;
 
@@ -377,7 +377,7 @@ Float_t AliFastJetBkg::BkgFastJetCone(TClonesArray* fAODJets)
   
   // cout<<" nIn = "<<nIn<<endl;
   Float_t sumpt=0;
-  vector<fastjet::PseudoJet> inputParticles=fInputFJ->GetInputParticles();
+  const vector<fastjet::PseudoJet>& inputParticles=fInputFJ->GetInputParticles();
   for(UInt_t i=0; i<inputParticles.size(); i++)
     { // Loop over input list of particles
       pt    = inputParticles[i].perp();
@@ -445,7 +445,7 @@ Float_t AliFastJetBkg::BkgFastJetCone(TClonesArray* fAODJets)
 }
 
 //___________________________________________________________________
-Double_t AliFastJetBkg::CalcRho(vector<fastjet::PseudoJet> inputParticles,Double_t rParamBkg,TString method)
+Double_t AliFastJetBkg::CalcRho(const vector<fastjet::PseudoJet>& inputParticles,Double_t rParamBkg,TString method)
 {
   // calculate rho using the fastjet method
 
@@ -47,11 +47,11 @@ class AliFastJetBkg : public TObject
   static Double_t  BkgFunction(Double_t *x,Double_t *par);
     
  private:
-  Double_t         CalcRho(vector<fastjet::PseudoJet> input_particles,Double_t RparamBkg,TString method);
+  Double_t         CalcRho(const vector<fastjet::PseudoJet>& input_particles,Double_t RparamBkg,TString method);
   void             CalcRhob(Double_t& median, Double_t& sigma, Double_t& meanarea,
-			    vector<fastjet::PseudoJet> input_particles,Double_t RparamBkg,TString method);
+			    const vector<fastjet::PseudoJet>& input_particles,Double_t RparamBkg,TString method);
   void             CalcRhoWoHardest(Double_t& median, Double_t& sigma, Double_t& meanarea,
-				    vector<fastjet::PseudoJet> input_particles,Double_t RparamBkg,TString method);
+				    const vector<fastjet::PseudoJet>& input_particles,Double_t RparamBkg,TString method);
 
   AliJetHeader*    fHeader;  //! header
   AliFastJetInput* fInputFJ; //! input particles
@@ -52,7 +52,8 @@ ClassImp(AliFastJetFinder)
 AliFastJetFinder::AliFastJetFinder():
   AliJetFinder(),
   fInputFJ(new AliFastJetInput()),
-  fJetBkg(new  AliFastJetBkg())
+  fJetBkg(new  AliFastJetBkg()),
+  fOwnInput(kTRUE)
 {
   // Constructor
 }
@@ -61,11 +62,22 @@ AliFastJetFinder::AliFastJetFinder():
 AliFastJetFinder::~AliFastJetFinder()
 {
   // destructor
-  delete  fInputFJ;
+  if (fOwnInput) delete  fInputFJ;
   delete  fJetBkg;
 
 }
 
+//____________________________________________________________________________
+void AliFastJetFinder::SetSharedInput(Bool_t shared)
+{
+  // Use the input shared by all the finders of the train (filled once per event)
+  // instead of an own one
+  if (fOwnInput) delete fInputFJ;
+  fInputFJ  = shared ? AliFastJetInput::GetSharedInput() : new AliFastJetInput();
+  fOwnInput = !shared;
+
+}
+
 //______________________________________________________________________________
 void AliFastJetFinder::FindJets()
 {
@@ -80,7 +92,7 @@ void AliFastJetFinder::FindJets()
   // RUN ALGORITHM  
   // read input particles -----------------------------
 
-  vector<fastjet::PseudoJet> inputParticles=fInputFJ->GetInputParticles();
+  const vector<fastjet::PseudoJet>& inputParticles=fInputFJ->GetInputParticles();
   if(inputParticles.size()==0){
     if(debug>0) Printf("%s:%d No input particles found, skipping event",(char*)__FILE__,__LINE__);
     return;
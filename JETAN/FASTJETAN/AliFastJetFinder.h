@@ -49,14 +49,16 @@ class AliFastJetFinder : public AliJetFinder
   void              RunTest(const char* datafile); // a simple test
   virtual void      WriteJHeaderToFile() const;
   virtual Bool_t    ProcessEvent();
+  void              SetSharedInput(Bool_t shared = kTRUE);
       
   protected:
   AliFastJetFinder(const AliFastJetFinder& rfj);
   AliFastJetFinder& operator = (const AliFastJetFinder& rsfj);
   AliFastJetInput*  fInputFJ;  //! input particles array
   AliFastJetBkg*    fJetBkg;   //! pointer to bkg class
+  Bool_t            fOwnInput; //! input owned, not the shared one
 
-  ClassDef(AliFastJetFinder,3) //  Fastjet analysis class
+  ClassDef(AliFastJetFinder,4) //  Fastjet analysis class
 
 };
 
@@ -31,9 +31,12 @@
 #include "AliFastJetInput.h"
 #include "AliJetCalTrk.h"
 
+#include "AliAnalysisManager.h"
+
 #include "fastjet/PseudoJet.hh"
 
-#include<vector> 
+#include <mutex>
+#include <vector>
 
 using namespace std;
 
@@ -45,7 +48,9 @@ AliFastJetInput::AliFastJetInput():
   fHeader(0x0),
   fCalTrkEvent(0x0),
   fInputParticles(0),
-  fInputParticlesCh(0)
+  fInputParticlesCh(0),
+  fFilledEvent(0x0),
+  fFilledEntry(-1)
 {
   // Default constructor
 }
@@ -56,7 +61,9 @@ AliFastJetInput::AliFastJetInput(const AliFastJetInput &input):
   fHeader(input.fHeader),
   fCalTrkEvent(input.fCalTrkEvent),
   fInputParticles(input.fInputParticles),
-  fInputParticlesCh(input.fInputParticlesCh)
+  fInputParticlesCh(input.fInputParticlesCh),
+  fFilledEvent(input.fFilledEvent),
+  fFilledEntry(input.fFilledEntry)
 {
   // copy constructor
 }
@@ -71,54 +78,81 @@ AliFastJetInput& AliFastJetInput::operator=(const AliFastJetInput& source)
    fCalTrkEvent = source.fCalTrkEvent;
    fInputParticles = source.fInputParticles;
    fInputParticlesCh = source.fInputParticlesCh;
+   fFilledEvent = source.fFilledEvent;
+   fFilledEntry = source.fFilledEntry;
   }
 
   return *this;
 
 }
 
+//___________________________________________________________
+AliFastJetInput* AliFastJetInput::GetSharedInput()
+{
+  // input shared by all the finders (and their background) of the train:
+  // filled by the first finder of the event, reused by the others
+  static AliFastJetInput sharedInput;
+  return &sharedInput;
+
+}
+
 //___________________________________________________________
 void AliFastJetInput::FillInput()
 {
   // fills input particles for FASTJET based analysis
+  // The buffers keep their capacity from event to event. The input is not filled
+  // again for the same caltrkevent and entry of the analysis manager, so that
+  // the finders sharing it (GetSharedInput) convert the tracks only once
   
   AliFastJetHeaderV1 *header = (AliFastJetHeaderV1*)fHeader;
   Int_t debug  = header->GetDebug();     // debug option
 
   if(debug>0) cout<<"-------- AliFastJetInput::FillInput()  ----------------"<<endl;
 
+  // finders may run concurrently on the shared input
+  static std::mutex fillMutex;
+  std::lock_guard<std::mutex> lock(fillMutex);
+
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  Long64_t entry = mgr ? mgr->GetCurrentEntry() : -1;
+  if(this == GetSharedInput() && entry >= 0 && fFilledEvent == fCalTrkEvent && fFilledEntry == entry) {
+    if(debug>0) cout << "Input already filled for entry " << entry << endl;
+    return;
+  }
+  fFilledEvent = fCalTrkEvent;
+  fFilledEntry = entry;
+
   fInputParticles.clear();
   fInputParticlesCh.clear();
 
   // RUN ALGORITHM  
   // read input particles -----------------------------
-  vector<fastjet::PseudoJet> inputParticles;
 
   if(fCalTrkEvent == 0) { cout << "Could not get the CalTrk Event" << endl; return; }
   Int_t nIn =  fCalTrkEvent->GetNCalTrkTracks() ;
   if(nIn == 0) { if (debug>0) cout << "entries = 0 ; Event empty !!!" << endl ; return; }
+  fInputParticles.reserve(nIn);
+  fInputParticlesCh.reserve(nIn);
 
   // Information extracted from fCalTrkEvent
   // load input vectors and calculate total energy in array
   Float_t px = -999., py = -999., pz = -999., en = -999.; 
  
   // Fill charged tracks
-  for(Int_t i = 0; i < fCalTrkEvent->GetNCalTrkTracks(); i++)
+  for(Int_t i = 0; i < nIn; i++)
     { // loop for all input particles
-      if (fCalTrkEvent->GetCalTrkTrack(i)->GetCutFlag() != 1) continue;
-      px =  fCalTrkEvent->GetCalTrkTrack(i)->GetPx();
-      py =  fCalTrkEvent->GetCalTrkTrack(i)->GetPy();
-      pz =  fCalTrkEvent->GetCalTrkTrack(i)->GetPz();
-      en =  fCalTrkEvent->GetCalTrkTrack(i)->GetP();
-
-      fastjet::PseudoJet inputPart(px,py,pz,en);  // create PseudoJet object
-      inputPart.set_user_index(i);      //label the particle into Fastjet algortihm
-      fInputParticles.push_back(inputPart);       // back of the inputParticles vector
+      AliJetCalTrkTrack* calTrk = fCalTrkEvent->GetCalTrkTrack(i);
+      if (calTrk->GetCutFlag() != 1) continue;
+      px =  calTrk->GetPx();
+      py =  calTrk->GetPy();
+      pz =  calTrk->GetPz();
+      en =  calTrk->GetP();
+
+      fInputParticles.push_back(fastjet::PseudoJet(px,py,pz,en)); // create PseudoJet object
+      fInputParticles.back().set_user_index(i);   //label the particle into Fastjet algortihm
  
       // only for charged particles (TPC+ITS)
-      fastjet::PseudoJet inputPartCh(px,py,pz,en); // create PseudoJet object
-      inputPartCh.set_user_index(i);               //label the particle into Fastjet algortihm
-      fInputParticlesCh.push_back(inputPartCh);    // back of the inputParticles vector
+      fInputParticlesCh.push_back(fInputParticles.back());
     } // End loop on CalTrk
 
 }
@@ -43,8 +43,10 @@ class AliFastJetInput : public TObject
   void                       SetHeader(AliJetHeader *header)            {fHeader=header;}
   void                       SetCalTrkEvent(AliJetCalTrkEvent *caltrk)  {fCalTrkEvent=caltrk;}
   void                       FillInput();
-  vector<fastjet::PseudoJet> GetInputParticles()   const                {return fInputParticles;}
-  vector<fastjet::PseudoJet> GetInputParticlesCh() const                {return fInputParticlesCh;}
+  const vector<fastjet::PseudoJet>& GetInputParticles()   const         {return fInputParticles;}
+  const vector<fastjet::PseudoJet>& GetInputParticlesCh() const         {return fInputParticlesCh;}
+  void                       ResetInput()                               {fFilledEvent=0x0; fFilledEntry=-1;}
+  static AliFastJetInput*    GetSharedInput();
   static Double_t            Thermalspectrum(const Double_t *x, const Double_t *par);
 
  private:
@@ -53,8 +55,10 @@ class AliFastJetInput : public TObject
    
   vector<fastjet::PseudoJet> fInputParticles;   //! input particles for FastJet
   vector<fastjet::PseudoJet> fInputParticlesCh; //! input charged particles for FastJet
+  const AliJetCalTrkEvent* fFilledEvent;        //! caltrkevent the input was filled from
+  Long64_t fFilledEntry;                        //! entry of the analysis manager the input was filled for
 
-  ClassDef(AliFastJetInput, 2)                  //  fills input particles for FASTJET based analysis
+  ClassDef(AliFastJetInput, 3)                  //  fills input particles for FASTJET based analysis
     
 };
  
@@ -56,7 +56,8 @@ ClassImp(AliSISConeJetFinder)
 AliSISConeJetFinder::AliSISConeJetFinder():
   AliJetFinder(),
   fInputFJ(new AliFastJetInput()),
-  fJetBkg(new  AliFastJetBkg())
+  fJetBkg(new  AliFastJetBkg()),
+  fOwnInput(kTRUE)
 {
   // Constructor
 }
@@ -65,11 +66,22 @@ AliSISConeJetFinder::AliSISConeJetFinder():
 AliSISConeJetFinder::~AliSISConeJetFinder()
 {
   // destructor
-  delete  fInputFJ;
+  if (fOwnInput) delete  fInputFJ;
   delete  fJetBkg;
 
 }
 
+//____________________________________________________________________________
+void AliSISConeJetFinder::SetSharedInput(Bool_t shared)
+{
+  // Use the input shared by all the finders of the train (filled once per event)
+  // instead of an own one
+  if (fOwnInput) delete fInputFJ;
+  fInputFJ  = shared ? AliFastJetInput::GetSharedInput() : new AliFastJetInput();
+  fOwnInput = !shared;
+
+}
+
 //______________________________________________________________________________
 void AliSISConeJetFinder::FindJets()
 {
@@ -81,7 +93,7 @@ void AliSISConeJetFinder::FindJets()
   Bool_t bgMode               = header->GetBGMode();// Here one choose to subtract BG or not
 
   // Read input particles 
-  vector<fastjet::PseudoJet> inputParticles=fInputFJ->GetInputParticles();
+  const vector<fastjet::PseudoJet>& inputParticles=fInputFJ->GetInputParticles();
   if(inputParticles.size()==0){
     if(debug>0) Printf("%s:%d No input particles found, skipping event",(char*)__FILE__,__LINE__);
     return;
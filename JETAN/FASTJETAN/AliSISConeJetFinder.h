@@ -32,6 +32,7 @@ class AliSISConeJetFinder : public AliJetFinder
 
   // others
   Bool_t  ProcessEvent(); 
+  void    SetSharedInput(Bool_t shared = kTRUE);
   void    WriteJHeaderToFile() const;
 
   protected:
@@ -40,8 +41,9 @@ class AliSISConeJetFinder : public AliJetFinder
 
   AliFastJetInput*  fInputFJ;     //! input particles array
   AliFastJetBkg*    fJetBkg;      //! pointer to bkg class
+  Bool_t            fOwnInput;    //! input owned, not the shared one
 
-  ClassDef(AliSISConeJetFinder,3) // SISCONE analysis class
+  ClassDef(AliSISConeJetFinder,4) // SISCONE analysis class
 
 };
 
@@ -25,6 +25,7 @@
 
 #include <TFile.h>
 #include <TTree.h>
+#include <TBranch.h>
 #include <TChain.h>
 #include <TClonesArray.h>
 #include <TDirectory.h>
@@ -61,6 +62,25 @@
 using std::cout;
 using std::endl;
 
+namespace {
+   // Copy of obj in the next slot of a clones array cleared with Clear():
+   // the objects of the previous events are assigned to instead of being
+   // destructed and constructed again
+   template <class T> T* AddRecycled(TClonesArray *arr, Int_t &n, const T &obj)
+   {
+      T *o = static_cast<T*>(arr->ConstructedAt(n++));
+      *o = obj;
+      return o;
+   }
+
+   // enable a branch (and its sub-branches) if present in the tree
+   void EnableBranch(TTree *tree, const char *name)
+   {
+      UInt_t found = 0;
+      tree->SetBranchStatus(Form("%s*",name), 1, &found);
+   }
+}
+
 ClassImp(AliAnalysisTaskFastEmbedding)
 
 //__________________________________________________________________________
@@ -96,6 +116,14 @@ AliAnalysisTaskFastEmbedding::AliAnalysisTaskFastEmbedding()
   ,fAODEntries(-1)
   ,fAODEntriesSum(0)
   ,fAODEntriesMax(0)
+,fReadRequiredBranchesOnly(kFALSE)
+,fTreeCacheSize(0)
+,fFileXsecTrials()
+,fSelectionBranches()
+  ,fReadRequiredBranchesOnly(kFALSE)
+  ,fTreeCacheSize(0)
+  ,fFileXsecTrials()
+  ,fSelectionBranches()
   ,fOfflineTrgMask(AliVEvent::kAny)
   ,fMinContribVtx(1)
   ,fVtxZMin(-8.)
@@ -338,6 +366,10 @@ AliAnalysisTaskFastEmbedding::AliAnalysisTaskFastEmbedding(const AliAnalysisTask
 ,fAODEntries(copy.fAODEntries)
 ,fAODEntriesSum(copy.fAODEntriesSum)
 ,fAODEntriesMax(copy.fAODEntriesMax)
+,fReadRequiredBranchesOnly(copy.fReadRequiredBranchesOnly)
+,fTreeCacheSize(copy.fTreeCacheSize)
+,fFileXsecTrials(copy.fFileXsecTrials)
+,fSelectionBranches(copy.fSelectionBranches)
 ,fOfflineTrgMask(copy.fOfflineTrgMask)
 ,fMinContribVtx(copy.fMinContribVtx)
 ,fVtxZMin(copy.fVtxZMin)
@@ -465,6 +497,10 @@ AliAnalysisTaskFastEmbedding& AliAnalysisTaskFastEmbedding::operator=(const AliA
       fAODEntries        = o.fAODEntries;
       fAODEntriesSum     = o.fAODEntriesSum;
       fAODEntriesMax     = o.fAODEntriesMax;
+      fReadRequiredBranchesOnly = o.fReadRequiredBranchesOnly;
+      fTreeCacheSize     = o.fTreeCacheSize;
+      fFileXsecTrials    = o.fFileXsecTrials;
+      fSelectionBranches = o.fSelectionBranches;
       fOfflineTrgMask    = o.fOfflineTrgMask;
       fMinContribVtx     = o.fMinContribVtx;
       fVtxZMin           = o.fVtxZMin;
@@ -1153,7 +1189,7 @@ void AliAnalysisTaskFastEmbedding::UserExec(Option_t *)
       PostData(1, fHistList);
       return;
    }
-   tracks->Delete();
+   tracks->Clear(); // objects kept for the next events, see AddRecycled()
    Int_t nAODtracks=0;
 
    TClonesArray *extrav0s = (TClonesArray*)(fAODout->FindListObject("aodExtraV0s"));
@@ -1202,10 +1238,10 @@ void AliAnalysisTaskFastEmbedding::UserExec(Option_t *)
      return;
    }
    */
-   extrav0s->Delete();
-   extraK0s->Delete();
-   extraLa->Delete();
-   extraALa->Delete();
+   extrav0s->Clear();
+   extraK0s->Clear();
+   extraLa->Clear();
+   extraALa->Clear();
    /* extraK0sCone->Delete();
    extraLaCone->Delete();
    extraALaCone->Delete();
@@ -1257,9 +1293,14 @@ void AliAnalysisTaskFastEmbedding::UserExec(Option_t *)
             }
          }
 
-         // get next event
-         fAODtree->GetEvent(fAODEntry);
-         if(fAODtreeJets) fAODtreeJets->GetEvent(fAODEntry);
+         // get next event, for the jet pt selection only the branches it needs
+         if(fSelectionBranches.size()){
+            for(UInt_t ib=0; ib<fSelectionBranches.size(); ++ib) fSelectionBranches[ib]->GetEntry(fAODEntry);
+         }
+         else {
+            fAODtree->GetEvent(fAODEntry);
+            if(fAODtreeJets) fAODtreeJets->GetEvent(fAODEntry);
+         }
 
 
          // get pt hard
@@ -1334,6 +1375,12 @@ void AliAnalysisTaskFastEmbedding::UserExec(Option_t *)
       }
       AliDebug(AliLog::kDebug,Form("Use entry %d from extra AOD.", fAODEntry));
 
+      // full event of the selected entry
+      if(fSelectionBranches.size()){
+         fAODtree->GetEvent(fAODEntry);
+         if(fAODtreeJets) fAODtreeJets->GetEvent(fAODEntry);
+      }
+
       fh2PtHardEvtSel->Fill(fPtHardBin,fPtHard);
       if(fQAMode){
       fh2AODevent->Fill(fFileId,fAODEntry);
@@ -1348,7 +1395,7 @@ void AliAnalysisTaskFastEmbedding::UserExec(Option_t *)
             PostData(1, fHistList);
             return;
          }
-         mcpartOUT->Delete();
+         mcpartOUT->Clear();
       } else {
          AliInfo("No extra MC particles found.");
       }
@@ -1373,8 +1420,7 @@ void AliAnalysisTaskFastEmbedding::UserExec(Option_t *)
 	   Double_t rd=rndm->Uniform(0.,1.);
 	   if(rd>fExtraEffPb) continue; 
 
-	   new ((*extrav0s)[nAODv0s++]) AliAODv0(*tmpv0); 
-	   dummy = (*extrav0s)[nAODv0s-1];
+	   dummy = AddRecycled(extrav0s, nAODv0s, *tmpv0);
 
 	   fh1V0Pt->Fill(tmpv0->Pt());
 	   fh2V0EtaPhi->Fill(tmpv0->Eta(), tmpv0->Phi());	  
@@ -1395,8 +1441,7 @@ void AliAnalysisTaskFastEmbedding::UserExec(Option_t *)
 	   IsGoodV0 = ApplyV0Cuts(tmpv0, fK0Type, kK0, pythiaVertex, fAODevent);
           
 	   if(IsGoodV0 == kFALSE)continue;
-	   new ((*extraK0s)[nAODK0s++]) AliAODv0(*tmpv0); 
-	   dummy = (*extraK0s)[nAODK0s-1];
+	   dummy = AddRecycled(extraK0s, nAODK0s, *tmpv0);
 	   fh1K0Pt->Fill(tmpv0->Pt());
 	   fh2K0EtaPhi->Fill(tmpv0->Eta(), tmpv0->Phi());
 	   fListK0s->Add(tmpv0);
@@ -1419,8 +1464,7 @@ void AliAnalysisTaskFastEmbedding::UserExec(Option_t *)
 	
 	   if(!IsGoodV0)continue;
 
-	   new ((*extraLa)[nAODLa++]) AliAODv0(*tmpv0); 
-	   dummy = (*extraLa)[nAODLa-1];	
+	   dummy = AddRecycled(extraLa, nAODLa, *tmpv0);	
            fh1LaPt->Fill(tmpv0->Pt());
 	   fh2LaEtaPhi->Fill(tmpv0->Eta(), tmpv0->Phi());
 	   fListLa->Add(tmpv0);
@@ -1439,8 +1483,7 @@ void AliAnalysisTaskFastEmbedding::UserExec(Option_t *)
 	   Bool_t IsGoodV0 = ApplyV0Cuts(tmpv0, fALaType, kAntiLambda, pythiaVertex, fAODevent);
 	   if(!IsGoodV0)continue;
 
-	   new ((*extraALa)[nAODALa++]) AliAODv0(*tmpv0); 
-	   dummy = (*extraALa)[nAODALa-1];
+	   dummy = AddRecycled(extraALa, nAODALa, *tmpv0);
 	   fh1ALaPt->Fill(tmpv0->Pt());
 	   fh2ALaEtaPhi->Fill(tmpv0->Eta(), tmpv0->Phi());
 	   fListALa->Add(tmpv0);
@@ -1674,8 +1717,7 @@ void AliAnalysisTaskFastEmbedding::UserExec(Option_t *)
 
             tmpTr->SetStatus(AliESDtrack::kEmbedded);
 
-            new ((*tracks)[nAODtracks++]) AliAODTrack(*tmpTr); 
-            dummy = (*tracks)[nAODtracks-1];
+            dummy = AddRecycled(tracks, nAODtracks, *tmpTr);
 
             if(fTrackFilterMap<=0 || tmpTr->TestFilterBit(fTrackFilterMap)){
 	      if(tmpTr->Pt()>0.15 && TMath::Abs(tmpTr->Eta())<0.9) fh1TrackPt->Fill(tmpTr->Pt());
@@ -1701,8 +1743,7 @@ void AliAnalysisTaskFastEmbedding::UserExec(Option_t *)
                } 
 
                if(tmpPart->IsPhysicalPrimary() && tmpPart->Charge()!=-99.  && tmpPart->Pt()>0.){
-		 new((*mcpartOUT)[nAODmcpart++]) AliAODMCParticle(*tmpPart);
-		 dummy = (*mcpartOUT)[nAODmcpart-1];
+		 dummy = AddRecycled(mcpartOUT, nAODmcpart, *tmpPart);
 
 		 if(fDebug>10) printf("added track %d with pT=%.2f to extra branch\n",nAODmcpart,tmpPart->Pt());
 		 
@@ -1801,8 +1842,7 @@ void AliAnalysisTaskFastEmbedding::UserExec(Option_t *)
          );
          tmpTr->SetFlags(AliESDtrack::kEmbedded);
 
-         new((*tracks)[nAODtracks++]) AliAODTrack(*tmpTr);
-         dummy = (*tracks)[nAODtracks-1];
+         dummy = AddRecycled(tracks, nAODtracks, *tmpTr);
 
          fh1TrackPt->Fill(pt);
          fh2TrackEtaPhi->Fill(eta,phi);
@@ -1980,6 +2020,8 @@ Int_t AliAnalysisTaskFastEmbedding::OpenAODfile(Int_t trial)
    fAODeventJets = new AliAODEvent();
    fAODeventJets->ReadFromTree(fAODtreeJets);
 
+   SetupExtraAODBranches();
+
 
    // fetch header, jets, etc. from new file
    fNevents = fAODtree->GetEntries();
@@ -2004,14 +2046,24 @@ Int_t AliAnalysisTaskFastEmbedding::OpenAODfile(Int_t trial)
      return -1;
    }
    
-   Float_t trials = 1.;
-   Float_t xsec = 0.;
-   PythiaInfoFromFile(curfile->GetName(),xsec,trials);
-   fXsection = xsec;
+   // cross section and trials are read once per file of the list
+   std::map<Int_t, std::pair<Float_t,Float_t> >::const_iterator xsecTrials = fFileXsecTrials.find(fFileId);
+   if(fAODPathArray && xsecTrials!=fFileXsecTrials.end()){
+      fXsection  = xsecTrials->second.first;
+      fAvgTrials = xsecTrials->second.second;
+   }
+   else {
+      Float_t trials = 1.;
+      Float_t xsec = 0.;
+      PythiaInfoFromFile(curfile->GetName(),xsec,trials);
+      fXsection = xsec;
 
-   // construct a poor man average trials 
-   Float_t nEntries = (Float_t)fAODtree->GetTree()->GetEntries();
-   if(trials>=nEntries && nEntries>0.)fAvgTrials = trials/nEntries;
+      // construct a poor man average trials 
+      Float_t nEntries = (Float_t)fAODtree->GetTree()->GetEntries();
+      if(trials>=nEntries && nEntries>0.)fAvgTrials = trials/nEntries;
+
+      if(fAODPathArray) fFileXsecTrials[fFileId] = std::make_pair(fXsection, fAvgTrials);
+   }
 
    if(fFileId>=0){
       AliInfo(Form("Read successfully AOD event from file %d",fFileId));
@@ -2023,6 +2075,58 @@ Int_t AliAnalysisTaskFastEmbedding::OpenAODfile(Int_t trial)
 }
 
 
+//__________________________________________________________________________
+void AliAnalysisTaskFastEmbedding::SetupExtraAODBranches()
+{
+   // branches read from the extra AOD tree of the new file:
+   // only those used by the embedding mode if requested, with a read-ahead
+   // cache, and the ones needed by the jet pt selection
+
+   const char *jetBranch = fJetBranch.Length() ? fJetBranch.Data() : "jets";
+   Bool_t needTracks = (fEmbedMode==kAODFull || fEmbedMode==kAODJetTracks || fEvtSelJetMinLConstPt>0);
+
+   if(fReadRequiredBranchesOnly){
+      fAODtree->SetBranchStatus("*",0);
+      EnableBranch(fAODtree, "header");
+      EnableBranch(fAODtree, AliAODMCHeader::StdBranchName());
+      EnableBranch(fAODtree, jetBranch);
+      if(needTracks){
+         EnableBranch(fAODtree, "tracks");
+         EnableBranch(fAODtree, "vertices");
+      }
+      if(fEmbedMode==kAODFull || fEmbedMode==kAODJetTracks) EnableBranch(fAODtree, AliAODMCParticle::StdBranchName());
+      if(fEmbedMode==kAODFull) EnableBranch(fAODtree, "v0s");
+   }
+
+   if(fTreeCacheSize>0){
+      fAODtree->SetCacheSize(fTreeCacheSize);
+      fAODtree->AddBranchToCache("*", kTRUE);
+      fAODtree->StopCacheLearningPhase();
+   }
+
+   // entries rejected by the jet pt selection are only partially read;
+   // the full event is read if one of the branches is missing
+   fSelectionBranches.clear();
+   if(fEvtSelecMode!=kEventsJetPt) return;
+
+   TBranch *branch = fAODtree->GetBranch(jetBranch);
+   if(!branch && fAODtreeJets) branch = fAODtreeJets->GetBranch(jetBranch);
+   if(!branch) return;
+   fSelectionBranches.push_back(branch);
+
+   if(fEvtSelJetMinLConstPt>0){
+      branch = fAODtree->GetBranch("tracks");
+      if(!branch){
+         fSelectionBranches.clear();
+         return;
+      }
+      fSelectionBranches.push_back(branch);
+   }
+
+   branch = fAODtree->GetBranch(AliAODMCHeader::StdBranchName());
+   if(branch) fSelectionBranches.push_back(branch);
+}
+
 //____________________________________________________________________________
 Float_t AliAnalysisTaskFastEmbedding::GetPtHard(Bool_t bSet, Float_t newValue){
 
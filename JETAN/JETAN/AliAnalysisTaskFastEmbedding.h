@@ -6,6 +6,8 @@
 
 /* $Id$ */
 
+#include <map>
+#include <vector>
 #include "AliAnalysisTaskSE.h"
 
 class AliAODv0;
@@ -14,6 +16,7 @@ class AliPIDResponse;
 class AliESDEvent;
 class AliAODEvent;
 class TTree;
+class TBranch;
 class TFile;
 class TChain;
 class TObjArray;
@@ -54,6 +57,8 @@ public:
    void SetArrayOfAODEntries(TArrayI* arr) {fAODEntriesArray = arr;}
    void SetAODEntriesSum(Int_t i){ fAODEntriesSum = i;}
    void SetAODEntriesMax(Int_t i){ fAODEntriesMax = i;}
+   void SetReadRequiredBranchesOnly(Bool_t b) { fReadRequiredBranchesOnly = b;}
+   void SetTreeCacheSize(Long64_t size) { fTreeCacheSize = size;}
    
    virtual void     SetOfflineTrgMask(AliVEvent::EOfflineTriggerTypes mask) { fOfflineTrgMask = mask; }
    virtual void     SetMinContribVtx(Int_t n) { fMinContribVtx = n; }
@@ -164,6 +169,10 @@ private:
    Int_t      fAODEntries;      // entries of AOD
    Int_t      fAODEntriesSum;   // sum of all entries of AODs
    Int_t      fAODEntriesMax;   // maximum entries of AODs
+   Bool_t     fReadRequiredBranchesOnly; // read only the branches of the extra AOD used by the embedding mode
+   Long64_t   fTreeCacheSize;   // size of the read-ahead cache of the extra AOD tree in bytes (0: ROOT default)
+   std::map<Int_t, std::pair<Float_t,Float_t> > fFileXsecTrials; //! cross section and average trials per file of fAODPathArray
+   std::vector<TBranch*> fSelectionBranches; //! branches read before the full event for the jet pt selection
 
    AliVEvent::EOfflineTriggerTypes fOfflineTrgMask; // mask of offline triggers to accept
    Int_t   fMinContribVtx; // minimum number of track contributors for primary vertex
@@ -270,9 +279,10 @@ private:
    Int_t GetJobID();    // get job id (sub-job id on the GRID)
    Int_t SelectAODfile();
    Int_t OpenAODfile(Int_t trial = 0);
+   void  SetupExtraAODBranches();
 
 
-   ClassDef(AliAnalysisTaskFastEmbedding, 6);
+   ClassDef(AliAnalysisTaskFastEmbedding, 7);
 };
 
 #endif
@@ -373,30 +373,9 @@ void AliAnalysisTaskKMeans::UserExec(Option_t *)
   }
 
   //
-  Double_t rk0[10];
-  AliKMeansResult* res = 0;
   AliKMeansResult best(10);
-  Float_t   rmaxG = -1.;
-
-  for (Int_t k = 0; k < 20; k++) {
-    Float_t   rmax   = -1.;
-    Int_t     imax   = 0;
-    for (Int_t i = 0; i < fK; i++) {
-      res = fA[i];
-      AliKMeansClustering::SoftKMeans2(i+1, ic, phi, eta, res->GetMx(),res->GetMy(), res->GetSigma2(), res->GetRk());
-      res->Sort(ic, phi, eta);
-      Int_t j = (res->GetInd())[0];
-      rk0[i]  = (res->GetTarget())[j];
-      if (rk0[i] > rmax)  {
-	rmax = rk0[i];
-	imax = i;
-      }
-    }
-    if (rmax > rmaxG) {
-      rmaxG = rmax;
-      best.CopyResults(fA[imax]);
-    }
-  }
+  Float_t   rmaxG = AliKMeansClustering::SoftKMeans2Restarts(fK, ic, phi, eta, fA, &best, 20);
+
   Double_t* mPhi     = best.GetMx();
   Double_t* mEta     = best.GetMy();
   Double_t* sigma2   = best.GetSigma2();
@@ -482,26 +461,7 @@ void AliAnalysisTaskKMeans::UserExec(Option_t *)
     //
     // Randomized phi
     //
-  rmaxG = -1.;
-  for (Int_t k = 0; k < 20; k++) {
-    Float_t rmax   = -1.;
-    Int_t   imax   =  0;
-    for (Int_t i = 0; i < fK; i++) {
-      res = fB[i];
-      AliKMeansClustering::SoftKMeans2(i+1, ic, phiR, etaR, res->GetMx(),res->GetMy(), res->GetSigma2(), res->GetRk());
-      res->Sort(ic, phiR, etaR);
-      Int_t j = (res->GetInd())[0];
-      rk0[i]  = (res->GetTarget())[j];
-      if (rk0[i] > rmax) {
-	rmax = rk0[i];
-	imax = i;
-      }
-    }
-    if (rmax > rmaxG) {
-      rmaxG = rmax;
-      best.CopyResults(fB[imax]);
-    }    
-  }
+  rmaxG = AliKMeansClustering::SoftKMeans2Restarts(fK, ic, phiR, etaR, fB, &best, 20);
   
     mPhi    = best.GetMx();
     mEta    = best.GetMy();
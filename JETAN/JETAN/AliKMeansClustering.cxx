@@ -24,12 +24,17 @@
  
 #include "AliKMeansClustering.h"
 #include <TMath.h>
-#include <TRandom.h>
-#include <TH1F.h>
+#include <TRandom3.h>
+
+#include <thread>
+#include <vector>
 
 ClassImp(AliKMeansClustering)
 
 Double_t AliKMeansClustering::fBeta = 10.;
+Int_t    AliKMeansClustering::fgNThreads = 1;
+Int_t    AliKMeansClustering::fgNAgree   = 0;
+Double_t AliKMeansClustering::fgAgreeTolerance = 1.e-3;
 
  
 Int_t AliKMeansClustering::SoftKMeans(Int_t k, Int_t n, const Double_t* x, const Double_t* y, Double_t* mx, Double_t* my , Double_t* rk )
@@ -47,12 +52,12 @@ Int_t AliKMeansClustering::SoftKMeans(Int_t k, Int_t n, const Double_t* x, const
     }
 
     //
-    // (2a) The responsibilities
-    Double_t** r = new Double_t*[n]; // responsibilities
-    for (j = 0; j < n; j++) {r[j] = new Double_t[k];}
+    // (2a) The responsibilities, contiguous in the data points of each mean
+    Double_t* r = new Double_t[k * n]; // responsibilities
     //
     // (2b) Normalisation
     Double_t* nr   = new Double_t[n];
+    Double_t* dist = new Double_t[n];
     // (3) Iterations
     Int_t nit = 0;
     
@@ -61,31 +66,31 @@ Int_t AliKMeansClustering::SoftKMeans(Int_t k, Int_t n, const Double_t* x, const
       //
       // Assignment step
       //
-      for (j = 0; j < n; j++) {
-	nr[j] = 0.;
-	for (i = 0; i < k; i++) {
-	  r[j][i] = TMath::Exp(- fBeta * d(mx[i], my[i], x[j], y[j]));
-	  nr[j] += r[j][i];
-	} // mean i
-      } // data point j
+      for (j = 0; j < n; j++) nr[j] = 0.;
+      for (i = 0; i < k; i++) {
+	Double_t* ri = r + i * n;
+	Distances(mx[i], my[i], n, x, y, dist);
+	for (j = 0; j < n; j++) ri[j] = TMath::Exp(- fBeta * dist[j]);
+	for (j = 0; j < n; j++) nr[j] += ri[j];
+      } // mean i
 	
-      for (j = 0; j < n; j++) {
-	for (i = 0; i < k; i++) {
-	  r[j][i] /=  nr[j];
-	} // mean i
-      } // data point j
+      for (i = 0; i < k; i++) {
+	Double_t* ri = r + i * n;
+	for (j = 0; j < n; j++) ri[j] /=  nr[j];
+      } // mean i
       
 	//
 	// Update step
       Double_t di = 0;
       
       for (i = 0; i < k; i++) {
+	  const Double_t* ri = r + i * n;
 	  Double_t oldx = mx[i];
 	  Double_t oldy = my[i];
 	  
 	  mx[i] = x[0];
 	  my[i] = y[0];
-	  rk[i] = r[0][i];
+	  rk[i] = ri[0];
 	
 	for (j = 1; j < n; j++) {
 	    Double_t xx =  x[j];
@@ -96,9 +101,9 @@ Int_t AliKMeansClustering::SoftKMeans(Int_t k, Int_t n, const Double_t* x, const
 	    Double_t dx = mx[i] - x[j];
 	    if (dx >  TMath::Pi()) xx += 2. * TMath::Pi();
 	    if (dx < -TMath::Pi()) xx -= 2. * TMath::Pi();
-	    mx[i] = mx[i] * rk[i] + r[j][i] * xx;
-	    my[i] = my[i] * rk[i] + r[j][i] * y[j];
-	    rk[i] += r[j][i];
+	    mx[i] = mx[i] * rk[i] + ri[j] * xx;
+	    my[i] = my[i] * rk[i] + ri[j] * y[j];
+	    rk[i] += ri[j];
 	    mx[i] /= rk[i];
 	    my[i] /= rk[i];	    
 	    if (mx[i] > 2. * TMath::Pi()) mx[i] -= 2. * TMath::Pi();
@@ -113,14 +118,15 @@ Int_t AliKMeansClustering::SoftKMeans(Int_t k, Int_t n, const Double_t* x, const
 
 // Clean-up    
     delete[] nr;
-    for (j = 0; j < n; j++) delete[] r[j];
+    delete[] dist;
     delete[] r;
 // 
     return (nit < 1000);
     
 }
 
-Int_t AliKMeansClustering::SoftKMeans2(Int_t k, Int_t n, Double_t* x, Double_t* y, Double_t* mx, Double_t* my , Double_t* sigma2, Double_t* rk )
+Int_t AliKMeansClustering::SoftKMeans2(Int_t k, Int_t n, Double_t* x, Double_t* y, Double_t* mx, Double_t* my , Double_t* sigma2, Double_t* rk,
+				       TRandom* rndm )
 {
     //
     // The soft K-means algorithm
@@ -129,38 +135,39 @@ Int_t AliKMeansClustering::SoftKMeans2(Int_t k, Int_t n, Double_t* x, Double_t*
     //
     // (1) Initialisation of the k means using k-means++ recipe
     // 
-     OptimalInit(k, n, x, y, mx, my);
+     OptimalInit(k, n, x, y, mx, my, rndm);
     //
-    // (2a) The responsibilities
-    Double_t** r = new Double_t*[n]; // responsibilities
-    for (j = 0; j < n; j++) {r[j] = new Double_t[k];}
+    // (2a) The responsibilities, contiguous in the data points of each mean
+    Double_t* r = new Double_t[k * n]; // responsibilities
     //
     // (2b) Normalisation
-    Double_t* nr = new Double_t[n];
+    Double_t* nr   = new Double_t[n];
+    Double_t* dist = new Double_t[n];
     //
     // (2c) Weights 
     Double_t* pi = new Double_t[k];
     //
     //
     // (2d) Initialise the responsibilties and weights
-    for (j = 0; j < n; j++) {
-      nr[j] = 0.;
-      for (i = 0; i < k; i++) {
-	r[j][i] = TMath::Exp(- fBeta * d(mx[i], my[i], x[j], y[j]));
-	nr[j] += r[j][i];
-      } // mean i
-    } // data point j
+    for (j = 0; j < n; j++) nr[j] = 0.;
+    for (i = 0; i < k; i++) {
+      Double_t* ri = r + i * n;
+      Distances(mx[i], my[i], n, x, y, dist);
+      for (j = 0; j < n; j++) ri[j] = TMath::Exp(- fBeta * dist[j]);
+      for (j = 0; j < n; j++) nr[j] += ri[j];
+    } // mean i
     
     for (i = 0; i < k; i++) {
+      Double_t* ri = r + i * n;
       rk[i]    = 0.;
       sigma2[i] = 1./fBeta;
  
       for (j = 0; j < n; j++) {
-	r[j][i] /=  nr[j];
-	rk[i] += r[j][i];
-      } // mean i
+	ri[j] /=  nr[j];
+	rk[i] += ri[j];
+      } // data point j
       pi[i] = rk[i] / Double_t(n);
-    } // data point j
+    } // mean i
     // (3) Iterations
     Int_t nit = 0;
 
@@ -169,32 +176,32 @@ Int_t AliKMeansClustering::SoftKMeans2(Int_t k, Int_t n, Double_t* x, Double_t*
       //
       // Assignment step
       //
-      for (j = 0; j < n; j++) {
-	nr[j] = 0.;
-	for (i = 0; i < k; i++) {
-	  r[j][i] = pi[i] * TMath::Exp(- d(mx[i], my[i], x[j], y[j]) / sigma2[i] ) 
-	    / (2. * sigma2[i] * TMath::Pi() * TMath::Pi());
-	  nr[j] += r[j][i];
-	} // mean i
-      } // data point j
+      for (j = 0; j < n; j++) nr[j] = 0.;
+      for (i = 0; i < k; i++) {
+	Double_t* ri = r + i * n;
+	const Double_t norm = 2. * sigma2[i] * TMath::Pi() * TMath::Pi();
+	Distances(mx[i], my[i], n, x, y, dist);
+	for (j = 0; j < n; j++) ri[j] = pi[i] * TMath::Exp(- dist[j] / sigma2[i] ) / norm;
+	for (j = 0; j < n; j++) nr[j] += ri[j];
+      } // mean i
 	
       for (i = 0; i < k; i++) {
-	for (j = 0; j < n; j++) {
-	  r[j][i] /=  nr[j];
-	} // mean i
-      } // data point j
+	Double_t* ri = r + i * n;
+	for (j = 0; j < n; j++) ri[j] /=  nr[j];
+      } // mean i
       
 	//
 	// Update step
       Double_t di = 0;
       
       for (i = 0; i < k; i++) {
+	  const Double_t* ri = r + i * n;
 	  Double_t oldx = mx[i];
 	  Double_t oldy = my[i];
 	  
 	  mx[i] = x[0];
 	  my[i] = y[0];
-	  rk[i] = r[0][i];
+	  rk[i] = ri[0];
 	for (j = 1; j < n; j++) {
 	    Double_t xx =  x[j];
 //
@@ -204,10 +211,10 @@ Int_t AliKMeansClustering::SoftKMeans2(Int_t k, Int_t n, Double_t* x, Double_t*
 	    Double_t dx = mx[i] - x[j];
 	    if (dx >  TMath::Pi()) xx += 2. * TMath::Pi();
 	    if (dx < -TMath::Pi()) xx -= 2. * TMath::Pi();
-	    if (r[j][i] > 1.e-15) {
-	      mx[i] = mx[i] * rk[i] + r[j][i] * xx;
-	      my[i] = my[i] * rk[i] + r[j][i] * y[j];
-	      rk[i] += r[j][i];
+	    if (ri[j] > 1.e-15) {
+	      mx[i] = mx[i] * rk[i] + ri[j] * xx;
+	      my[i] = my[i] * rk[i] + ri[j] * y[j];
+	      rk[i] += ri[j];
 	      mx[i] /= rk[i];
 	      my[i] /= rk[i];	
 	    }    
@@ -220,9 +227,11 @@ Int_t AliKMeansClustering::SoftKMeans2(Int_t k, Int_t n, Double_t* x, Double_t*
       //
       // Sigma
       for (i = 0; i < k; i++) {
+	const Double_t* ri = r + i * n;
+	Distances(mx[i], my[i], n, x, y, dist);
 	sigma2[i] = 0.;
 	for (j = 0; j < n; j++) {
-	  sigma2[i] += r[j][i] * d(mx[i], my[i], x[j], y[j]);
+	  sigma2[i] += ri[j] * dist[j];
 	} // Data
 	sigma2[i] /= rk[i];
 	if (sigma2[i] < 0.0025) sigma2[i] = 0.0025;
@@ -237,13 +246,97 @@ Int_t AliKMeansClustering::SoftKMeans2(Int_t k, Int_t n, Double_t* x, Double_t*
 
 // Clean-up    
     delete[] nr;
+    delete[] dist;
     delete[] pi;
-    for (j = 0; j < n; j++) delete[] r[j];
     delete[] r;
 // 
     return (nit < 1000);
 }
 
+Float_t AliKMeansClustering::SoftKMeans2Restarts(Int_t kmax, Int_t n, Double_t* x, Double_t* y, AliKMeansResult** res,
+						 AliKMeansResult* best, Int_t nRestarts)
+{
+    //
+    // Repeats the clustering with k = 1 ... kmax means nRestarts times and keeps
+    // in best the result with the highest target (AliKMeansResult::Sort(n, x, y))
+    // of its first cluster. res holds the kmax results of one restart.
+    // Returns the target of the best result, -1 if none was found.
+    //
+    // With SetNThreads(n > 1) the restarts are spread over threads, each with its
+    // own random generator seeded from gRandom. With SetRestartAgreement(m) the
+    // restarts stop once m of them reached the best target within the tolerance.
+    //
+    Float_t rmaxG  = -1.;
+    Int_t   nAgree = 0;
+    // one restart, returns the index of the best result in r
+    auto restart = [kmax, n, x, y](AliKMeansResult** r, TRandom* rndm, Float_t& rmax) {
+	rmax = -1.;
+	Int_t imax = 0;
+	for (Int_t i = 0; i < kmax; i++) {
+	    SoftKMeans2(i+1, n, x, y, r[i]->GetMx(), r[i]->GetMy(), r[i]->GetSigma2(), r[i]->GetRk(), rndm);
+	    r[i]->Sort(n, x, y);
+	    Int_t j = (r[i]->GetInd())[0];
+	    Double_t rk0 = (r[i]->GetTarget())[j];
+	    if (rk0 > rmax) {
+		rmax = rk0;
+		imax = i;
+	    }
+	}
+	return imax;
+    };
+    // restarts are compared in order, so that the result does not depend on the threads
+    auto accept = [&rmaxG, &nAgree, best](AliKMeansResult* r, Float_t rmax) {
+	if (rmax > rmaxG) {
+	    if (rmaxG > 0. && TMath::Abs(rmax - rmaxG) <= fgAgreeTolerance * rmax) nAgree++;
+	    else nAgree = 1;
+	    rmaxG = rmax;
+	    best->CopyResults(r);
+	} else if (rmaxG > 0. && TMath::Abs(rmax - rmaxG) <= fgAgreeTolerance * rmaxG) {
+	    nAgree++;
+	}
+	return (fgNAgree > 0 && nAgree >= fgNAgree);
+    };
+
+    const Int_t nThreads = TMath::Min(fgNThreads, nRestarts);
+    if (nThreads <= 1) {
+	Float_t rmax = -1.;
+	for (Int_t k = 0; k < nRestarts; k++) {
+	    Int_t imax = restart(res, gRandom, rmax);
+	    if (accept(res[imax], rmax)) break;
+	}
+	return rmaxG;
+    }
+
+    // results and generators of the restarts of a batch
+    std::vector<AliKMeansResult*> results(nThreads * kmax);
+    std::vector<TRandom3*> rndms(nThreads);
+    for (Int_t t = 0; t < nThreads; t++) {
+	for (Int_t i = 0; i < kmax; i++) results[t * kmax + i] = new AliKMeansResult(i+1);
+	rndms[t] = new TRandom3(1);
+    }
+    std::vector<Int_t>   imax(nThreads);
+    std::vector<Float_t> rmax(nThreads);
+    for (Int_t k0 = 0; k0 < nRestarts; k0 += nThreads) {
+	const Int_t nBatch = TMath::Min(nThreads, nRestarts - k0);
+	for (Int_t t = 0; t < nBatch; t++) rndms[t]->SetSeed(gRandom->Integer(kMaxUInt) + 1);
+	auto work = [&](Int_t t) {
+	    imax[t] = restart(&results[t * kmax], rndms[t], rmax[t]);
+	};
+	std::vector<std::thread> workers;
+	for (Int_t t = 1; t < nBatch; t++) workers.push_back(std::thread(work, t));
+	work(0);
+	for (UInt_t t = 0; t < workers.size(); t++) workers[t].join();
+	Bool_t stop = kFALSE;
+	for (Int_t t = 0; t < nBatch && !stop; t++) stop = accept(results[t * kmax + imax[t]], rmax[t]);
+	if (stop) break;
+    }
+    for (Int_t t = 0; t < nThreads; t++) {
+	for (Int_t i = 0; i < kmax; i++) delete results[t * kmax + i];
+	delete rndms[t];
+    }
+    return rmaxG;
+}
+
 Int_t AliKMeansClustering::SoftKMeans3(Int_t k, Int_t n, Double_t* x, Double_t* y, Double_t* mx, Double_t* my , 
 				       Double_t* sigmax2, Double_t* sigmay2, Double_t* rk )
 {
@@ -256,38 +349,38 @@ Int_t AliKMeansClustering::SoftKMeans3(Int_t k, Int_t n, Double_t* x, Double_t*
     // 
      OptimalInit(k, n, x, y, mx, my);
     //
-    // (2a) The responsibilities
-    Double_t** r = new Double_t*[n]; // responsibilities
-    for (j = 0; j < n; j++) {r[j] = new Double_t[k];}
+    // (2a) The responsibilities, contiguous in the data points of each mean
+    Double_t* r = new Double_t[k * n]; // responsibilities
     //
     // (2b) Normalisation
-    Double_t* nr = new Double_t[n];
+    Double_t* nr   = new Double_t[n];
+    Double_t* dist = new Double_t[n];
     //
     // (2c) Weights 
     Double_t* pi = new Double_t[k];
     //
     //
     // (2d) Initialise the responsibilties and weights
-    for (j = 0; j < n; j++) {
-      nr[j] = 0.;
-      for (i = 0; i < k; i++) {
-
-	r[j][i] = TMath::Exp(- fBeta * d(mx[i], my[i], x[j], y[j]));
-	nr[j] += r[j][i];
-      } // mean i
-    } // data point j
+    for (j = 0; j < n; j++) nr[j] = 0.;
+    for (i = 0; i < k; i++) {
+      Double_t* ri = r + i * n;
+      Distances(mx[i], my[i], n, x, y, dist);
+      for (j = 0; j < n; j++) ri[j] = TMath::Exp(- fBeta * dist[j]);
+      for (j = 0; j < n; j++) nr[j] += ri[j];
+    } // mean i
     
     for (i = 0; i < k; i++) {
+      Double_t* ri = r + i * n;
       rk[i]    = 0.;
       sigmax2[i] = 1./fBeta;
       sigmay2[i] = 1./fBeta;
  
       for (j = 0; j < n; j++) {
-	r[j][i] /=  nr[j];
-	rk[i] += r[j][i];
-      } // mean i
+	ri[j] /=  nr[j];
+	rk[i] += ri[j];
+      } // data point j
       pi[i] = rk[i] / Double_t(n);
-    } // data point j
+    } // mean i
     // (3) Iterations
     Int_t nit = 0;
 
@@ -296,36 +389,36 @@ Int_t AliKMeansClustering::SoftKMeans3(Int_t k, Int_t n, Double_t* x, Double_t*
       //
       // Assignment step
       //
-      for (j = 0; j < n; j++) {
-	nr[j] = 0.;
-	for (i = 0; i < k; i++) {
-
+      for (j = 0; j < n; j++) nr[j] = 0.;
+      for (i = 0; i < k; i++) {
+	Double_t* ri = r + i * n;
+	const Double_t norm = 2. * TMath::Sqrt(sigmax2[i] * sigmay2[i]) * TMath::Pi() * TMath::Pi();
+	for (j = 0; j < n; j++) {
 	  Double_t dx = TMath::Abs(mx[i]-x[j]);
-	  if (dx > TMath::Pi()) dx = 2. * TMath::Pi() - dx;
+	  dx = (dx > TMath::Pi()) ? 2. * TMath::Pi() - dx : dx;
 	  Double_t dy = TMath::Abs(my[i]-y[j]);
-	  r[j][i] = pi[i] * TMath::Exp(-0.5 *  (dx * dx / sigmax2[i] + dy * dy / sigmay2[i])) 
-	    / (2. * TMath::Sqrt(sigmax2[i] * sigmay2[i]) * TMath::Pi() * TMath::Pi());
-	  nr[j] += r[j][i];
-	} // mean i
-      } // data point j
+	  ri[j] = pi[i] * TMath::Exp(-0.5 *  (dx * dx / sigmax2[i] + dy * dy / sigmay2[i])) / norm;
+	} // data point j
+	for (j = 0; j < n; j++) nr[j] += ri[j];
+      } // mean i
 	
       for (i = 0; i < k; i++) {
-	for (j = 0; j < n; j++) {
-	  r[j][i] /=  nr[j];
-	} // mean i
-      } // data point j
+	Double_t* ri = r + i * n;
+	for (j = 0; j < n; j++) ri[j] /=  nr[j];
+      } // mean i
       
 	//
 	// Update step
       Double_t di = 0;
       
       for (i = 0; i < k; i++) {
+	  const Double_t* ri = r + i * n;
 	  Double_t oldx = mx[i];
 	  Double_t oldy = my[i];
 	  
 	  mx[i] = x[0];
 	  my[i] = y[0];
-	  rk[i] = r[0][i];
+	  rk[i] = ri[0];
 	for (j = 1; j < n; j++) {
 	    Double_t xx =  x[j];
 //
@@ -335,10 +428,10 @@ Int_t AliKMeansClustering::SoftKMeans3(Int_t k, Int_t n, Double_t* x, Double_t*
 	    Double_t dx = mx[i] - x[j];
 	    if (dx >  TMath::Pi()) xx += 2. * TMath::Pi();
 	    if (dx < -TMath::Pi()) xx -= 2. * TMath::Pi();
-	    if (r[j][i] > 1.e-15) {
-	      mx[i] = mx[i] * rk[i] + r[j][i] * xx;
-	      my[i] = my[i] * rk[i] + r[j][i] * y[j];
-	      rk[i] += r[j][i];
+	    if (ri[j] > 1.e-15) {
+	      mx[i] = mx[i] * rk[i] + ri[j] * xx;
+	      my[i] = my[i] * rk[i] + ri[j] * y[j];
+	      rk[i] += ri[j];
 	      mx[i] /= rk[i];
 	      my[i] /= rk[i];	
 	    }    
@@ -351,15 +444,16 @@ Int_t AliKMeansClustering::SoftKMeans3(Int_t k, Int_t n, Double_t* x, Double_t*
       //
       // Sigma
       for (i = 0; i < k; i++) {
+	const Double_t* ri = r + i * n;
 	sigmax2[i] = 0.;
 	sigmay2[i] = 0.;
 
 	for (j = 0; j < n; j++) {
 	  Double_t dx = TMath::Abs(mx[i]-x[j]);
-	  if (dx > TMath::Pi()) dx = 2. * TMath::Pi() - dx;
+	  dx = (dx > TMath::Pi()) ? 2. * TMath::Pi() - dx : dx;
 	  Double_t dy = TMath::Abs(my[i]-y[j]);
-	  sigmax2[i] += r[j][i] * dx * dx;
-	  sigmay2[i] += r[j][i] * dy * dy;
+	  sigmax2[i] += ri[j] * dx * dx;
+	  sigmay2[i] += ri[j] * dy * dy;
 	} // Data
 	sigmax2[i] /= rk[i];
 	sigmay2[i] /= rk[i];
@@ -376,8 +470,8 @@ Int_t AliKMeansClustering::SoftKMeans3(Int_t k, Int_t n, Double_t* x, Double_t*
 
 // Clean-up    
     delete[] nr;
+    delete[] dist;
     delete[] pi;
-    for (j = 0; j < n; j++) delete[] r[j];
     delete[] r;
 // 
     return (nit < 1000);
@@ -395,9 +489,24 @@ Double_t AliKMeansClustering::d(Double_t mx, Double_t my, Double_t x, Double_t y
     return (0.5*(dx * dx + (my - y) * (my - y)));
 }
 
+void AliKMeansClustering::Distances(Double_t mx, Double_t my, Int_t n, const Double_t* x, const Double_t* y, Double_t* dist)
+{
+    //
+    // Distances d(mx, my, x[j], y[j]) of all the data points,
+    // written without branches so that the loop is vectorised
+    
+    for (Int_t j = 0; j < n; j++) {
+	Double_t dx = TMath::Abs(mx - x[j]);
+	dx = (dx > TMath::Pi()) ? 2. * TMath::Pi() - dx : dx;
+	Double_t dy = my - y[j];
+	dist[j] = 0.5*(dx * dx + dy * dy);
+    }
+}
 
 
-void AliKMeansClustering::OptimalInit(Int_t k, Int_t n, const Double_t* x, const Double_t* y, Double_t* mx, Double_t* my)
+
+void AliKMeansClustering::OptimalInit(Int_t k, Int_t n, const Double_t* x, const Double_t* y, Double_t* mx, Double_t* my,
+				      TRandom* rndm)
 {
   //  
   // Optimal initialisation using the k-means++ algorithm
@@ -407,12 +516,22 @@ void AliKMeansClustering::OptimalInit(Int_t k, Int_t n, const Double_t* x, const
   // It was proposed in 2007 by David Arthur and Sergei Vassilvitskii as an approximation algorithm for the NP-hard k-means problem---
   // a way of avoiding the sometimes poor clusterings found by the standard k-means algorithm.
   //
+  // The min distances are updated with the last center only, and the points are
+  // sampled from their cumulative sum (same sampling as a TH1F filled with the
+  // min distances of all the iterations, without booking a histogram per call)
   //
-  TH1F d2("d2", "", n, -0.5, Float_t(n)-0.5);
-  d2.Reset();
+  if (!rndm) rndm = gRandom;
+  Double_t* dmin = new Double_t[n];
+  Double_t* dij  = new Double_t[n];
+  Float_t*  w    = new Float_t[n];   // weights, accumulated as bin contents
+  Double_t* cum  = new Double_t[n+1];
+  for (Int_t j = 0; j < n; j++) {
+    dmin[j] = 1.e10;
+    w[j]    = 0.;
+  }
 
   // (1) Chose first center as a random point among the input data.
-  Int_t ir = Int_t(Float_t(n) * gRandom->Rndm());
+  Int_t ir = Int_t(Float_t(n) * rndm->Rndm());
   mx[0] = x[ir];
   my[0] = y[ir];
 
@@ -420,21 +539,30 @@ void AliKMeansClustering::OptimalInit(Int_t k, Int_t n, const Double_t* x, const
   Int_t icl = 1;
   while(icl < k)
     {
-      // find min distance to existing clusters
+      // min distance to existing clusters
+      Distances(mx[icl-1], my[icl-1], n, x, y, dij);
       for (Int_t j = 0; j < n; j++) {
-	Double_t dmin = 1.e10;
-	for (Int_t i = 0; i < icl; i++) {
-	  Double_t dij = d(mx[i], my[i], x[j], y[j]);
-	  if (dij < dmin) dmin = dij;
-	} // clusters
-	d2.Fill(Float_t(j), dmin);
+	dmin[j] = (dij[j] < dmin[j]) ? dij[j] : dmin[j];
+	w[j] += dmin[j];
       } // data points
       // select a new cluster from data points with probability ~d2
-      ir = Int_t(d2.GetRandom() + 0.5);
+      cum[0] = 0.;
+      for (Int_t j = 0; j < n; j++) cum[j+1] = cum[j] + w[j];
+      ir = 0;
+      if (cum[n] > 0.) {
+	Double_t r1 = rndm->Rndm() * cum[n];
+	ir = TMath::BinarySearch(n + 1, cum, r1);
+	if (ir >= n) ir = n - 1;
+	if (ir <  0) ir = 0;
+      }
       mx[icl] = x[ir];
       my[icl] = y[ir];
       icl++;
     } // icl
+  delete[] dmin;
+  delete[] dij;
+  delete[] w;
+  delete[] cum;
 }
 
 
@@ -13,6 +13,9 @@
 // andreas.morsch@cern.ch
 
 #include <TObject.h>
+
+class TRandom;
+class AliKMeansResult;
  
 class AliKMeansClustering : public TObject
 {
@@ -22,14 +25,23 @@ class AliKMeansClustering : public TObject
   
   static Int_t SoftKMeans (Int_t k, Int_t n, const Double_t* x, const Double_t* y, Double_t* mx, Double_t* my , Double_t* rk );
   static Int_t SoftKMeans2(Int_t k, Int_t n, Double_t* x, Double_t* y, Double_t* mx, Double_t* my , Double_t* sigma2, 
-			  Double_t* rk );
+			  Double_t* rk, TRandom* rndm = 0 );
+  static Float_t SoftKMeans2Restarts(Int_t kmax, Int_t n, Double_t* x, Double_t* y, AliKMeansResult** res,
+				     AliKMeansResult* best, Int_t nRestarts);
   static Int_t SoftKMeans3(Int_t k, Int_t n, Double_t* x, Double_t* y, Double_t* mx, Double_t* my , 
 			   Double_t* sigmax2, Double_t* sigmay2, Double_t* rk );
-  static void  OptimalInit(Int_t k, Int_t n, const Double_t* x, const Double_t* y, Double_t* mx, Double_t* my);
+  static void  OptimalInit(Int_t k, Int_t n, const Double_t* x, const Double_t* y, Double_t* mx, Double_t* my,
+			   TRandom* rndm = 0);
   static void  SetBeta(Double_t beta) {fBeta = beta;}
+  static void  SetNThreads(Int_t n)   {fgNThreads = n;}
+  static void  SetRestartAgreement(Int_t n, Double_t tol = 1.e-3) {fgNAgree = n; fgAgreeTolerance = tol;}
   static Double_t d(Double_t mx, Double_t my, Double_t x, Double_t y);
+  static void  Distances(Double_t mx, Double_t my, Int_t n, const Double_t* x, const Double_t* y, Double_t* dist);
 protected:
   static Double_t fBeta; // beta parameter
+  static Int_t    fgNThreads;        // threads for the restarts
+  static Int_t    fgNAgree;          // restarts reaching the best target to stop, 0 for all the restarts
+  static Double_t fgAgreeTolerance;  // relative tolerance on the target of agreeing restarts
   
   ClassDef(AliKMeansClustering, 1)
 };
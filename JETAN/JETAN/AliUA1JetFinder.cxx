@@ -27,6 +27,8 @@
 // Versions V1 and V2 merged
 //---------------------------------------------------------------------
 
+#include <algorithm>
+
 #include <TH2F.h>
 #include <TMath.h>
 
@@ -44,7 +46,22 @@ ClassImp(AliUA1JetFinder)
 AliUA1JetFinder::AliUA1JetFinder():
   AliJetFinder(),
   fLego(0),  
-  fJetBkg(new AliJetBkg())
+  fJetBkg(new AliJetBkg()),
+  fCellsReady(kFALSE),
+  fNCell(0),
+  fNCellPos(0),
+  fEtaBin(),
+  fPhiBin(),
+  fDPhi2(),
+  fPhiOrder(),
+  fRowBins(),
+  fCellBin(),
+  fEtCell(),
+  fEtaCell(),
+  fPhiCell(),
+  fFlagCell(),
+  fIndexCell(),
+  fConeCells()
 {
   // Default constructor
 }
@@ -118,6 +135,7 @@ void AliUA1JetFinder::FindJets()
     etbgTotal+= ptT[i];
     etbg2 += ptT[i]*ptT[i];
   }
+  fCellsReady = kFALSE; // cell map filled at the first iteration
   
   // calculate total energy and fluctuation in map
   Double_t meanpt = 0.;
@@ -302,42 +320,125 @@ void AliUA1JetFinder::FindJets()
 }
 
 //-----------------------------------------------------------------------
-void AliUA1JetFinder::RunAlgoritm(Float_t etbgTotal, Double_t dEtTotal, Int_t& nJets,
-				  Float_t* const etJet,Float_t* const etaJet, Float_t* const phiJet,
-				  Float_t* const etallJet, Int_t* const ncellsJet)
+void AliUA1JetFinder::FillCells()
 {
-  // Dump lego
+  // Dump lego into the cell map and sort the cells by et
+  // The map only depends on the lego, it is kept for all the background iterations of the event
   AliUA1JetHeader* header = (AliUA1JetHeader*) fHeader;
-  const Int_t nBinsMax = 120000; // we use a fixed array not to fragment memory 
- 
   const Int_t nBinEta = header->GetLegoNbinEta();
   const Int_t nBinPhi = header->GetLegoNbinPhi();
-  if((nBinPhi*nBinEta)>nBinsMax){
-    AliError("Too many bins of the ETA-PHI histogram");
+  const Int_t nBins   = nBinEta*nBinPhi;
+  if (fCellBin.GetSize() != nBins) {
+    fEtaBin.Set(nBinEta);
+    fPhiBin.Set(nBinPhi);
+    fDPhi2.Set(nBinPhi);
+    fPhiOrder.Set(nBinPhi);
+    fRowBins.Set(nBinPhi);
+    fCellBin.Set(nBins);
+    fEtCell.Set(nBins);
+    fEtaCell.Set(nBins);
+    fPhiCell.Set(nBins);
+    fFlagCell.Set(nBins);
+    fIndexCell.Set(nBins);
+    fConeCells.Set(nBins);
   }
 
-  Float_t etCell[nBinsMax] = {0.};   //! Cell Energy
-  Float_t etaCell[nBinsMax] = {0.};  //! Cell eta
-  Float_t phiCell[nBinsMax] = {0.};  //! Cell phi
-  Short_t flagCell[nBinsMax] = {0}; //! Cell flag
-  
-  Int_t nCell = 0;
   TAxis* xaxis = fLego->GetXaxis();
   TAxis* yaxis = fLego->GetYaxis();
+  for (Int_t i = 1; i <= nBinEta; i++) fEtaBin[i-1] = xaxis->GetBinCenter(i);
+  for (Int_t j = 1; j <= nBinPhi; j++) fPhiBin[j-1] = yaxis->GetBinCenter(j);
+
+  fNCell = 0;
+  fNCellPos = 0;
   Float_t e = 0.0;
   for (Int_t i = 1; i <= nBinEta; i++) {
     for (Int_t j = 1; j <= nBinPhi; j++) {
+      Int_t bin = (i-1)*nBinPhi + j-1;
       e = fLego->GetBinContent(i,j);
-      if (e < 0.0) continue; // don't include this cells
-      Float_t eta  = xaxis->GetBinCenter(i);
-      Float_t phi  = yaxis->GetBinCenter(j);
-      etCell[nCell]  = e;
-      etaCell[nCell] = eta;
-      phiCell[nCell] = phi;
-      flagCell[nCell] = 0; //default
-      nCell++;
+      if (e < 0.0) { // don't include this cells
+	fCellBin[bin] = -1;
+	continue;
+      }
+      fCellBin[bin]     = fNCell;
+      fEtCell[fNCell]   = e;
+      fEtaCell[fNCell]  = fEtaBin[i-1];
+      fPhiCell[fNCell]  = fPhiBin[j-1];
+      if (e > 0.0) fNCellPos++;
+      fNCell++;
+    }
+  }
+
+  // Sort cells by et, the cells with et > 0 come first
+  TMath::Sort(fNCell, fEtCell.GetArray(), fIndexCell.GetArray());
+  fCellsReady = kTRUE;
+
+}
+
+//-----------------------------------------------------------------------
+Int_t AliUA1JetFinder::FindConeCells(Float_t eta, Float_t phi, Float_t rc, Float_t& etCone)
+{
+  // Free cells within rc of (eta,phi), stored in fConeCells in cell order,
+  // and their total energy.
+  // The phi distances are computed once for all the eta rows: the bins of a row
+  // in the cone are the first ones ordered by phi distance, so only the cone
+  // footprint is visited instead of the whole map
+  AliUA1JetHeader* header = (AliUA1JetHeader*) fHeader;
+  const Int_t nBinEta = header->GetLegoNbinEta();
+  const Int_t nBinPhi = header->GetLegoNbinPhi();
+
+  Float_t dphi = 0.0;
+  for (Int_t j = 0; j < nBinPhi; j++) {
+    dphi = fPhiBin[j] - phi;
+    if (dphi < -TMath::Pi()) dphi= -dphi - 2.0 * TMath::Pi();
+    if (dphi > TMath::Pi()) dphi = 2.0 * TMath::Pi() - dphi;
+    fDPhi2[j] = dphi * dphi;
+  }
+  TMath::Sort(nBinPhi, fDPhi2.GetArray(), fPhiOrder.GetArray(), kFALSE);
+
+  Int_t nCellIn = 0;
+  etCone = 0.0;
+  Int_t* rowBins = fRowBins.GetArray();
+  for (Int_t i = 0; i < nBinEta; i++) {
+    Float_t deta = fEtaBin[i] - eta;
+    Int_t nIn = 0;
+    for (; nIn < nBinPhi; nIn++) {
+      Float_t dr = TMath::Sqrt(deta * deta + fDPhi2[fPhiOrder[nIn]]);
+      if (!(dr <= rc)) break;
+    }
+    if (nIn == 0) continue;
+    // sum in cell order
+    memcpy(rowBins, fPhiOrder.GetArray(), sizeof(Int_t)*nIn);
+    std::sort(rowBins, rowBins + nIn);
+    const Int_t* cellBin = fCellBin.GetArray() + i*nBinPhi;
+    for (Int_t k = 0; k < nIn; k++) {
+      Int_t ncell = cellBin[rowBins[k]];
+      if (ncell < 0 || fFlagCell[ncell] != 0) continue; // cell not used or used before
+      etCone += fEtCell[ncell];
+      fConeCells[nCellIn++] = ncell;
     }
   }
+
+  return nCellIn;
+
+}
+
+//-----------------------------------------------------------------------
+void AliUA1JetFinder::RunAlgoritm(Float_t etbgTotal, Double_t dEtTotal, Int_t& nJets,
+				  Float_t* const etJet,Float_t* const etaJet, Float_t* const phiJet,
+				  Float_t* const etallJet, Int_t* const ncellsJet)
+{
+  // Dump lego
+  AliUA1JetHeader* header = (AliUA1JetHeader*) fHeader;
+  if (!fCellsReady) FillCells();
+
+  const Int_t nCell = fNCell;
+  const Float_t* etCell  = fEtCell.GetArray();
+  const Float_t* etaCell = fEtaCell.GetArray();
+  const Float_t* phiCell = fPhiCell.GetArray();
+  const Int_t*   index   = fIndexCell.GetArray();
+  Short_t* flagCell = fFlagCell.GetArray();
+  memset(flagCell,0,sizeof(Short_t)*nCell);
+
   // Parameters from header
   Float_t minmove = header->GetMinMove();
   Float_t maxmove = header->GetMaxMove();
@@ -351,9 +452,6 @@ void AliUA1JetFinder::RunAlgoritm(Float_t etbgTotal, Double_t dEtTotal, Int_t& n
 
   // Run algorithm//
   
-  // Sort cells by et
-  Int_t index[nBinsMax];
-  TMath::Sort(nCell, etCell, index);
   // variable used in centroide loop
   Float_t eta   = 0.0;
   Float_t phi   = 0.0;
@@ -371,12 +469,18 @@ void AliUA1JetFinder::RunAlgoritm(Float_t etbgTotal, Double_t dEtTotal, Int_t& n
   Float_t etasb = 0.0;
   Float_t phisb = 0.0;
   Float_t dphib = 0.0;
+  Int_t   kfirst = 0;
 
   for(Int_t icell = 0; icell < nCell; icell++)
     {
       Int_t jcell = index[icell];
-      if(etCell[jcell] <= etseed) continue; // if cell energy is low et seed
+      if(etCell[jcell] <= etseed) break; // cells are sorted, no more seeds
       if(flagCell[jcell] != 0) continue; // if cell was used before
+
+      // first cell not more energetic than the seed
+      while(etCell[index[kfirst]] > etCell[jcell]) kfirst++;
+      // once the cells with et = 0 are reached the centroide does not move any more
+      Int_t klast = (etCell[jcell] > 0.0) ? fNCellPos : nCell;
       
       eta  = etaCell[jcell];
       phi  = phiCell[jcell];
@@ -390,12 +494,11 @@ void AliUA1JetFinder::RunAlgoritm(Float_t etbgTotal, Double_t dEtTotal, Int_t& n
       etsb = ets;
       etasb = 0.0;
       phisb = 0.0;
-      for(Int_t kcell =0; kcell < nCell; kcell++)
+      for(Int_t kcell = kfirst; kcell < klast; kcell++)
 	{
 	  Int_t lcell = index[kcell];
 	  if(lcell == jcell) continue; // cell itself
 	  if(flagCell[lcell] != 0) continue; // cell used before
-	  if(etCell[lcell] > etCell[jcell]) continue; // can this happen
 	  //calculate dr
 	  deta = etaCell[lcell] - eta;
 	  dphi = TMath::Abs(phiCell[lcell] - phi);
@@ -441,24 +544,8 @@ void AliUA1JetFinder::RunAlgoritm(Float_t etbgTotal, Double_t dEtTotal, Int_t& n
       
       // Flag cells in Rc, estimate total energy in cone
       Float_t etCone   = 0.0;
-      Int_t   nCellIn  = 0;
       rc = header->GetRadius();
-
-      for(Int_t ncell =0; ncell < nCell; ncell++)
-	{
-	  if(flagCell[ncell] != 0) continue; // cell used before
-	  //calculate dr
-	  deta = etaCell[ncell] - eta;
-	  dphi = phiCell[ncell] - phi;
-	  if (dphi < -TMath::Pi()) dphi= -dphi - 2.0 * TMath::Pi();
-	  if (dphi > TMath::Pi()) dphi = 2.0 * TMath::Pi() - dphi;
-	  dr = TMath::Sqrt(deta * deta + dphi * dphi);
-	  if(dr <= rc){  // cell in cone
-	    flagCell[ncell] = -1;
-	    etCone+=etCell[ncell];
-	    nCellIn++;
-	  }
-	}
+      Int_t   nCellIn  = FindConeCells(eta, phi, rc, etCone);
       
       // Select jets with et > background
       // estimate max fluctuation of background in cone
@@ -469,13 +556,9 @@ void AliUA1JetFinder::RunAlgoritm(Float_t etbgTotal, Double_t dEtTotal, Int_t& n
       Double_t etcmin = etCone ;  // could be used etCone - etmin !!
       //decisions !! etbmax < etcmin
       
-      for(Int_t mcell =0; mcell < nCell; mcell++){
-	if(flagCell[mcell] == -1){
-	  if(etbmax < etcmin)
-	    flagCell[mcell] = 1; //flag cell as used
-	  else
-	    flagCell[mcell] = 0; // leave it free
-	}
+      if(etbmax < etcmin){
+	for(Int_t mcell =0; mcell < nCellIn; mcell++)
+	  flagCell[fConeCells[mcell]] = 1; //flag cell as used, the others are left free
       }
       //store tmp jet info !!!
       if(etbmax < etcmin) {
@@ -510,6 +593,7 @@ void AliUA1JetFinder::RunAlgoritm(Float_t etbgTotal, Double_t dEtTotal, Int_t& n
 void AliUA1JetFinder::Reset()
 {
   fLego->Reset();
+  fCellsReady = kFALSE;
   AliJetFinder::Reset();
 
 }
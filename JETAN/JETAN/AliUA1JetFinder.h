@@ -16,6 +16,10 @@
 // Versions V1 and V2 merged
 //---------------------------------------------------------------------
 
+#include <TArrayF.h>
+#include <TArrayI.h>
+#include <TArrayS.h>
+
 #include "AliJetFinder.h"
 
 class TH2F;
@@ -44,11 +48,31 @@ class AliUA1JetFinder : public AliJetFinder
   AliUA1JetFinder(const AliUA1JetFinder& rJetF1);
   AliUA1JetFinder& operator = (const AliUA1JetFinder& rhsf);
 
+  void    FillCells();
+  Int_t   FindConeCells(Float_t eta, Float_t phi, Float_t rc, Float_t& etCone);
+
   TH2F*       fLego;          //  Lego Histo
 
   AliJetBkg*  fJetBkg;        //! pointer to bkg class
 
-  ClassDef(AliUA1JetFinder,3) //  UA1 jet finder
+  // cell map of the lego, built once per event and shared by the background iterations
+  Bool_t      fCellsReady;    //! cell map filled from the current lego
+  Int_t       fNCell;         //! number of cells used
+  Int_t       fNCellPos;      //! number of cells with et > 0
+  TArrayF     fEtaBin;        //! eta of the lego bins
+  TArrayF     fPhiBin;        //! phi of the lego bins
+  TArrayF     fDPhi2;         //! squared phi distance of the bins to the cone axis
+  TArrayI     fPhiOrder;      //! phi bins ordered by distance to the cone axis
+  TArrayI     fRowBins;       //! phi bins of an eta row in the cone
+  TArrayI     fCellBin;       //! cell of each eta-phi bin, -1 if not used
+  TArrayF     fEtCell;        //! cell energy
+  TArrayF     fEtaCell;       //! cell eta
+  TArrayF     fPhiCell;       //! cell phi
+  TArrayS     fFlagCell;      //! cell flag
+  TArrayI     fIndexCell;     //! cells sorted by decreasing energy
+  TArrayI     fConeCells;     //! free cells in the current cone
+
+  ClassDef(AliUA1JetFinder,4) //  UA1 jet finder
 
 };
 
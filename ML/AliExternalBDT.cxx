@@ -13,9 +13,15 @@
 #include "AliExternalBDT.h"
 
 #include <cassert>
+#include <cstdint>
 #include <iostream>
 #include <stdio.h>
 #include <stdlib.h>
+#include <limits>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace {
   inline bool checkFile (const std::string name) {
@@ -27,6 +33,42 @@ namespace {
       return false;
     }
   }
+
+  /// code generator and compiler settings, part of the cache key
+  const char *kCodeGenerator = "ast_native";
+  const char *kCompileFlags = "-O1 -fPIC";
+
+  /// FNV-1a hash of the model file content and of the compiler settings, empty if the file cannot be read
+  std::string hashModel(const std::string &path) {
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == NULL) return "";
+    uint64_t hash = 14695981039346656037ull;
+    unsigned char buffer[65536];
+    std::size_t nread = 0;
+    while ((nread = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+      for (std::size_t i = 0; i < nread; ++i) {
+        hash ^= buffer[i];
+        hash *= 1099511628211ull;
+      }
+    }
+    fclose(file);
+    const std::string settings = std::string(kCodeGenerator) + "|" + kCompileFlags;
+    for (std::size_t i = 0; i < settings.size(); ++i) {
+      hash ^= static_cast<unsigned char>(settings[i]);
+      hash *= 1099511628211ull;
+    }
+    char hex[17];
+    snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+    return std::string(hex);
+  }
+}
+
+std::string AliExternalBDT::fgModelCacheDir = "";
+
+std::string AliExternalBDT::GetModelCacheDir() {
+  if (!fgModelCacheDir.empty()) return fgModelCacheDir;
+  const char *env = getenv("ALIML_MODEL_CACHE_DIR");
+  return env ? std::string(env) : std::string("");
 }
 
 AliExternalBDT::AliExternalBDT(std::string name) :
@@ -37,30 +79,34 @@ AliExternalBDT::AliExternalBDT(std::string name) :
   fCompiler{},
   fPredictor{},
   fOutSize{0u},
-  fNumFeatures{0u}
+  fNumFeatures{0u},
+  fEntries{},
+  fOutput{},
+  fBatchInput{},
+  fBatchOutput{},
+  fNThreads{1}
 {
 }
 
 
-bool AliExternalBDT::CompileAndLoadModelLibrary() {
-  std::string path = GetUniquePath();
+bool AliExternalBDT::CompileAndLoadModelLibrary(const std::string &path) {
   if (checkFile(path + "/main.so")) {
     std::cout << "Library found: " << path.data() << "/main.so . Loading it!" << std::endl;
   } else {
     std::cout << "Starting the model compilation, depending on the model size it can take a while..." << std::endl;
-    system((std::string("gcc -c -O1 -fPIC ") + path + "/main.c -o " + path + "/main.o && gcc -shared " + path + \
-          "/main.o -o " + path + "/main.so").data());
+    // link to a temporary name and rename, so that main.so is never seen half-written
+    system((std::string("gcc -c ") + kCompileFlags + " " + path + "/main.c -o " + path + "/main.o && gcc -shared " + \
+          path + "/main.o -o " + path + "/main.so.tmp && mv -f " + path + "/main.so.tmp " + path + "/main.so").data());
   }
   return LoadModelLibrary(path + "/main.so");
 }
 
-bool AliExternalBDT::CreateModelCode() {
-  std::string path = GetUniquePath();
+bool AliExternalBDT::CreateModelCode(const std::string &path) {
   if (checkFile(path + "/main.c")) {
     std::cout << "Code found: " << path.data() << "/main.c . \
       Remove it or unset/change the AliExternalBDT name to force its regeneration." << std::endl;
   } else {
-    const int status_comp = TreeliteCompilerCreate("ast_native", &fCompiler);
+    const int status_comp = TreeliteCompilerCreate(kCodeGenerator, &fCompiler);
     if (status_comp != 0) {
       std::cerr << "Compiler creation failed." << std::endl;
       return false;
@@ -112,11 +158,46 @@ bool AliExternalBDT::LoadModel(const std::string &path, int type) {
     std::cerr << "Model loading failed" << std::endl;
     return false;
   }
-  if (!CreateModelCode()) return false;
-  if (!CompileAndLoadModelLibrary()) return false;
+  const std::string cacheDir = GetModelCacheDir();
+  if (!cacheDir.empty()) return LoadFromCache(cacheDir);
+
+  const std::string uniquePath = GetUniquePath();
+  if (!CreateModelCode(uniquePath)) return false;
+  if (!CompileAndLoadModelLibrary(uniquePath)) return false;
   return true;
 }
 
+bool AliExternalBDT::LoadFromCache(const std::string &cacheDir) {
+  const std::string hash = hashModel(fModelPath);
+  if (hash.empty()) {
+    std::cerr << "Cannot read " << fModelPath << " to compute its hash" << std::endl;
+    return false;
+  }
+  mkdir(cacheDir.data(), 0775);
+  const std::string path = cacheDir + "/" + fModelName + "_" + hash;
+
+  // the first job on the node compiles while holding the lock, the others wait for it and load the library
+  const std::string lockName = path + ".lock";
+  const int lock = open(lockName.data(), O_CREAT | O_RDWR, 0664);
+  if (lock < 0 || flock(lock, LOCK_EX) != 0) {
+    std::cerr << "Cannot lock " << lockName << ", compiling the model locally" << std::endl;
+    if (lock >= 0) close(lock);
+    const std::string uniquePath = GetUniquePath();
+    return CreateModelCode(uniquePath) && CompileAndLoadModelLibrary(uniquePath);
+  }
+
+  bool status = true;
+  if (!checkFile(path + "/main.so")) {
+    status = CreateModelCode(path) && CompileAndLoadModelLibrary(path);
+  } else {
+    std::cout << "Cached library found: " << path.data() << "/main.so . Loading it!" << std::endl;
+    status = LoadModelLibrary(path + "/main.so");
+  }
+  flock(lock, LOCK_UN);
+  close(lock);
+  return status;
+}
+
 bool AliExternalBDT::LoadXGBoostModel(std::string path) {
   if (!LoadModel(path, 0)) return false;
   return true;
@@ -128,7 +209,7 @@ bool AliExternalBDT::LoadLightGBMModel(std::string path) {
 }
 
 bool AliExternalBDT::LoadModelLibrary(std::string path) {
-  const int status = TreelitePredictorLoad(path.data(), 1, &fPredictor);
+  const int status = TreelitePredictorLoad(path.data(), fNThreads, &fPredictor);
 
   TreelitePredictorQueryResultSizeSingleInst(fPredictor, &fOutSize);
   TreelitePredictorQueryNumFeature(fPredictor, &fNumFeatures);
@@ -159,3 +240,59 @@ bool AliExternalBDT::Predict(double *features, int size, std::vector<double> &ou
 
   return true;
 }
+
+bool AliExternalBDT::Predict(const double *features, int size, double *outputScores, bool useRawScore) {
+  if (fEntries.size() != static_cast<std::size_t>(size)) fEntries.resize(size);
+  if (fOutput.size() != fOutSize) fOutput.resize(fOutSize);
+  for (int iEntry = 0; iEntry < size; ++iEntry) {
+    fEntries[iEntry].fvalue = static_cast<float>(features[iEntry]);
+  }
+
+  std::size_t outSize = fOutSize;
+  int predict = TreelitePredictorPredictInst(fPredictor, fEntries.data(),
+      static_cast<int>(useRawScore), &fOutput[0],
+      &outSize);
+  if(predict<0)
+    return false;
+
+  for (std::size_t iEntry = 0; iEntry < fOutSize; ++iEntry) {
+    outputScores[iEntry] = static_cast<double>(fOutput[iEntry]);
+  }
+
+  return true;
+}
+
+bool AliExternalBDT::PredictBatch(const float *features, std::size_t nRows, std::size_t nCols,
+                                  std::vector<float> &outputScores, bool useRawScore) {
+  outputScores.resize(nRows * fOutSize);
+  if (nRows == 0) return true;
+
+  DenseBatchHandle batch;
+  if (TreeliteAssembleDenseBatch(features, std::numeric_limits<float>::quiet_NaN(), nRows, nCols, &batch) != 0)
+    return false;
+
+  std::size_t outSize = 0;
+  int predict = TreelitePredictorPredictBatch(fPredictor, batch, 0, 0, static_cast<int>(useRawScore),
+      &outputScores[0], &outSize);
+  TreeliteDeleteDenseBatch(batch);
+  if(predict<0 || outSize != nRows * fOutSize)
+    return false;
+
+  return true;
+}
+
+bool AliExternalBDT::PredictBatch(const double *features, std::size_t nRows, std::size_t nCols,
+                                  std::vector<double> &outputScores, bool useRawScore) {
+  fBatchInput.resize(nRows * nCols);
+  for (std::size_t iEntry = 0; iEntry < fBatchInput.size(); ++iEntry) {
+    fBatchInput[iEntry] = static_cast<float>(features[iEntry]);
+  }
+  if (!PredictBatch(fBatchInput.data(), nRows, nCols, fBatchOutput, useRawScore))
+    return false;
+
+  outputScores.resize(fBatchOutput.size());
+  for (std::size_t iEntry = 0; iEntry < fBatchOutput.size(); ++iEntry) {
+    outputScores[iEntry] = static_cast<double>(fBatchOutput[iEntry]);
+  }
+  return true;
+}
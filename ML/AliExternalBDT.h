@@ -30,13 +30,32 @@ public:
   bool LoadXGBoostModel(std::string path);
 
   bool Predict(double *features, int size, std::vector<double> &outputScores, bool useRaw = false);
+  /// overload writing GetOutputSize() scores to a preallocated buffer, without allocating per call
+  bool Predict(const double *features, int size, double *outputScores, bool useRaw = false);
+  /// score nRows rows of a row-major nRows x nCols matrix in one treelite batch call, using the
+  /// predictor thread pool; outputScores gets nRows x GetOutputSize() values
+  bool PredictBatch(const float *features, std::size_t nRows, std::size_t nCols, std::vector<float> &outputScores,
+                    bool useRaw = false);
+  /// overload for double features, converted once to the float32 buffer used by treelite
+  bool PredictBatch(const double *features, std::size_t nRows, std::size_t nCols, std::vector<double> &outputScores,
+                    bool useRaw = false);
+
+  /// number of worker threads of the treelite predictor, to be set before the model is loaded
+  void SetNumberOfThreads(int nThreads) { fNThreads = nThreads > 0 ? nThreads : 1; }
+  int GetNumberOfThreads() const { return fNThreads; }
 
   std::size_t GetOutputSize() const {return fOutSize;}
   std::size_t GetNumberOfFeatures() const {return fNumFeatures;}
 
+  /// directory shared by the jobs on a node where compiled models are cached, keyed by the hash of
+  /// the model file and of the compiler settings (empty: no cache, unless ALIML_MODEL_CACHE_DIR is set)
+  static void SetModelCacheDir(const std::string &dir) { fgModelCacheDir = dir; }
+  static std::string GetModelCacheDir();
+
 private:
-  bool CompileAndLoadModelLibrary();
-  bool CreateModelCode();
+  bool CompileAndLoadModelLibrary(const std::string &path);
+  bool CreateModelCode(const std::string &path);
+  bool LoadFromCache(const std::string &cacheDir);
   std::string GetUniquePath();
   bool LoadModel(const std::string &path, int type);
 
@@ -48,6 +67,14 @@ private:
   PredictorHandle fPredictor;
   std::size_t fOutSize;
   std::size_t fNumFeatures;
+
+  std::vector<TreelitePredictorEntry> fEntries;   /// scratch buffers reused by the batch Predict
+  std::vector<float> fOutput;
+  std::vector<float> fBatchInput;               /// float32 copy of double batch input
+  std::vector<float> fBatchOutput;              /// float32 batch scores
+  int fNThreads;                                /// worker threads of the predictor
+
+  static std::string fgModelCacheDir;   /// shared compiled-model cache directory
 };
 
 #endif
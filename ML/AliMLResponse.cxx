@@ -29,7 +29,8 @@ ClassImp(AliMLResponse);
 //_______________________________________________________________________________
 AliMLResponse::AliMLResponse()
     : TNamed(), fConfigFilePath{}, fModels{}, fCentClasses{}, fBins{}, fVariableNames{}, fNBins{}, fNVariables{},
-      fBinsBegin{}, fRaw{} {
+      fBinsBegin{}, fRaw{}, fBatchColumns{}, fBatchColumnIndex{}, fBatchFeatures{}, fBatchScores{}, fBatchRows{},
+      fNScores{0} {
   //
   // Default constructor
   //
@@ -38,7 +39,8 @@ AliMLResponse::AliMLResponse()
 //_______________________________________________________________________________
 AliMLResponse::AliMLResponse(const Char_t *name, const Char_t *title)
     : TNamed(name, title), fConfigFilePath{""}, fModels{}, fCentClasses{}, fBins{}, fVariableNames{}, fNBins{},
-      fNVariables{}, fBinsBegin{}, fRaw{} {
+      fNVariables{}, fBinsBegin{}, fRaw{}, fBatchColumns{}, fBatchColumnIndex{}, fBatchFeatures{}, fBatchScores{},
+      fBatchRows{}, fNScores{0} {
   //
   // Standard constructor
   //
@@ -55,7 +57,10 @@ AliMLResponse::~AliMLResponse() {
 AliMLResponse::AliMLResponse(const AliMLResponse &source)
     : TNamed(source.GetName(), source.GetTitle()), fConfigFilePath{source.fConfigFilePath}, fModels{source.fModels},
       fCentClasses{source.fCentClasses}, fBins{source.fBins}, fVariableNames{source.fVariableNames},
-      fNBins{source.fNBins}, fNVariables{source.fNVariables}, fBinsBegin{source.fBinsBegin}, fRaw{source.fRaw} {
+      fNBins{source.fNBins}, fNVariables{source.fNVariables}, fBinsBegin{source.fBinsBegin}, fRaw{source.fRaw},
+      fBatchColumns{source.fBatchColumns}, fBatchColumnIndex{source.fBatchColumnIndex},
+      fBatchFeatures{source.fBatchFeatures}, fBatchScores{source.fBatchScores}, fBatchRows{source.fBatchRows},
+      fNScores{source.fNScores} {
   //
   // Copy constructor
   //
@@ -78,6 +83,12 @@ AliMLResponse &AliMLResponse::operator=(const AliMLResponse &source) {
   fNVariables     = source.fNVariables;
   fBinsBegin      = source.fBinsBegin;
   fRaw            = source.fRaw;
+  fBatchColumns     = source.fBatchColumns;
+  fBatchColumnIndex = source.fBatchColumnIndex;
+  fBatchFeatures    = source.fBatchFeatures;
+  fBatchScores      = source.fBatchScores;
+  fBatchRows        = source.fBatchRows;
+  fNScores          = source.fNScores;
 
   return *this;
 }
@@ -120,11 +131,20 @@ void AliMLResponse::CompileModels(std::string configLocalPath) {
 
   fBinsBegin = fBins.begin();
 
+  /// optional node-level cache of compiled models shared between jobs
+  if (nodeList["MODEL_CACHE_DIR"]) {
+    AliExternalBDT::SetModelCacheDir(nodeList["MODEL_CACHE_DIR"].as<string>());
+  }
+
   for (const auto &model : nodeList["MODELS"]) {
     fModels.push_back(AliMLModelHandler{model});
   }
 
+  /// optional number of worker threads per model for multi-row predictions
+  int nThreads = nodeList["NUM_THREADS"] ? nodeList["NUM_THREADS"].as<int>() : 1;
+
   for (auto &model : fModels) {
+    model.GetModel()->SetNumberOfThreads(nThreads);
     bool comp = model.CompileModel();
     if (!comp) {
       AliFatal("Error in model compilation! Exit");
@@ -136,6 +156,33 @@ void AliMLResponse::CompileModels(std::string configLocalPath) {
       AliFatal("Inconsistency between number of features in model and yaml! Exit");
     }
   }
+  fNScores = fModels.empty() ? 0 : (int)fModels.front().GetModel()->GetOutputSize();
+  ResolveBatchColumns();
+}
+
+//_______________________________________________________________________________
+void AliMLResponse::ResolveBatchColumns() {
+  /// map each model feature to its column in the PredictBatch matrix, done once instead of per candidate
+  if (fVariableNames.empty())
+    return;    /// resolved again once the config is read
+
+  fBatchColumnIndex.assign(fNVariables, -1);
+  fBatchRows.assign(fModels.size(), vector<int>());
+  for (int iVar = 0; iVar < fNVariables; iVar++) {
+    if (fBatchColumns.empty()) {
+      fBatchColumnIndex[iVar] = iVar;
+      continue;
+    }
+    for (std::size_t iCol = 0; iCol < fBatchColumns.size(); iCol++) {
+      if (fBatchColumns[iCol] == fVariableNames[iVar]) {
+        fBatchColumnIndex[iVar] = (int)iCol;
+        break;
+      }
+    }
+    if (fBatchColumnIndex[iVar] < 0) {
+      AliFatal(Form("Variable |%s| not found in the batch columns provided! Exit", fVariableNames[iVar].data()));
+    }
+  }
 }
 
 //_______________________________________________________________________________
@@ -157,17 +204,18 @@ int AliMLResponse::FindBin(double binvar) {
 }
 
 //_______________________________________________________________________________
-double AliMLResponse::Predict(double binvar, map<string, double> varmap) {
+double AliMLResponse::Predict(double binvar, const map<string, double> &varmap) {
   if ((int)varmap.size() < fNVariables) {
     AliFatal("The variable map you provided to the predictor has a size smaller than the variable list size! Exit");
   }
 
   vector<double> features;
   for (const auto &varname : fVariableNames) {
-    if (varmap.find(varname) == varmap.end()) {
+    map<string, double>::const_iterator var = varmap.find(varname);
+    if (var == varmap.end()) {
       AliFatal(Form("Variable |%s| not found in variable list provided in config! Exit", varname.data()));
     }
-    features.push_back(varmap[varname]);
+    features.push_back(var->second);
   }
 
   int bin = FindBin(binvar);
@@ -202,17 +250,18 @@ double AliMLResponse::Predict(double binvar, vector<double> variables) {
 }
 
 //_______________________________________________________________________________
-bool AliMLResponse::PredictMultiClass(double binvar, map<string, double> varmap, vector<double> &outScores) {
+bool AliMLResponse::PredictMultiClass(double binvar, const map<string, double> &varmap, vector<double> &outScores) {
   if ((int)varmap.size() < fNVariables) {
     AliFatal("The variable map you provided to the predictor has a size smaller than the variable list size! Exit");
   }
 
   vector<double> features;
   for (const auto &varname : fVariableNames) {
-    if (varmap.find(varname) == varmap.end()) {
+    map<string, double>::const_iterator var = varmap.find(varname);
+    if (var == varmap.end()) {
       AliFatal(Form("Variable |%s| not found in variable list provided in config! Exit", varname.data()));
     }
-    features.push_back(varmap[varname]);
+    features.push_back(var->second);
   }
 
   int bin = FindBin(binvar);
@@ -237,7 +286,56 @@ bool AliMLResponse::PredictMultiClass(double binvar, vector<double> variables, v
 }
 
 //_______________________________________________________________________________
-bool AliMLResponse::IsSelected(double binvar, map<std::string, double> varmap) {
+int AliMLResponse::PredictBatch(const double *binvars, const double *features, int nCand, int nColumns,
+                                double *scores) {
+  if ((int)fBatchColumnIndex.size() != fNVariables) {
+    AliFatal("Batch columns not resolved, call MLResponseInit() first! Exit");
+  }
+  if (nColumns < (fBatchColumns.empty() ? fNVariables : (int)fBatchColumns.size())) {
+    AliFatal(Form("Number of columns passed (%d) smaller than the number of batch columns! Exit", nColumns));
+  }
+
+  for (auto &rows : fBatchRows)
+    rows.clear();
+  for (int iCand = 0; iCand < nCand; iCand++) {
+    int bin = FindBin(binvars[iCand]);
+    if (bin > 0) {
+      fBatchRows[bin - 1].push_back(iCand);
+      continue;
+    }
+    for (int iScore = 0; iScore < fNScores; iScore++)
+      scores[(std::size_t)iCand * fNScores + iScore] = -999.;
+  }
+
+  int nEvaluated{0};
+  for (std::size_t iModel = 0; iModel < fBatchRows.size(); iModel++) {
+    const vector<int> &rows = fBatchRows[iModel];
+    if (rows.empty())
+      continue;
+
+    /// gather the candidates of this bin in model feature order
+    fBatchFeatures.resize(rows.size() * fNVariables);
+    for (std::size_t iRow = 0; iRow < rows.size(); iRow++) {
+      const double *row = features + (std::size_t)rows[iRow] * nColumns;
+      for (int iVar = 0; iVar < fNVariables; iVar++)
+        fBatchFeatures[iRow * fNVariables + iVar] = row[fBatchColumnIndex[iVar]];
+    }
+
+    bool predict = fModels[iModel].GetModel()->PredictBatch(fBatchFeatures.data(), rows.size(), fNVariables,
+                                                            fBatchScores, fRaw);
+    for (std::size_t iRow = 0; iRow < rows.size(); iRow++) {
+      double *candScores = scores + (std::size_t)rows[iRow] * fNScores;
+      for (int iScore = 0; iScore < fNScores; iScore++)
+        candScores[iScore] = predict ? fBatchScores[iRow * fNScores + iScore] : -999.;
+    }
+    if (predict)
+      nEvaluated += rows.size();
+  }
+  return nEvaluated;
+}
+
+//_______________________________________________________________________________
+bool AliMLResponse::IsSelected(double binvar, const map<std::string, double> &varmap) {
   double score{0.};
   return IsSelected(binvar, varmap, score);
 }
@@ -249,7 +347,7 @@ bool AliMLResponse::IsSelected(double binvar, vector<double> variables) {
 }
 
 //_______________________________________________________________________________
-bool AliMLResponse::IsSelectedMultiClass(double binvar, map<std::string, double> varmap) {
+bool AliMLResponse::IsSelectedMultiClass(double binvar, const map<std::string, double> &varmap) {
   vector<double> score;
   return IsSelectedMultiClass(binvar, varmap, score);
 }
@@ -49,31 +49,45 @@ public:
   /// return the bin index
   int FindBin(double binvar);
   /// return the ML model predicted score (raw or proba, depending on useraw)
-  double Predict(double binvar, std::map<std::string, double> varmap);
+  double Predict(double binvar, const std::map<std::string, double> &varmap);
   /// overload to pass directly a vector of variables
   double Predict(double binvar, std::vector<double> variables);
   /// return true if predicted score for map is above the threshold given in the config
-  bool IsSelected(double binvar, std::map<std::string, double> varmap);
+  bool IsSelected(double binvar, const std::map<std::string, double> &varmap);
   /// overload for getting the model score too
-  template <typename F> bool IsSelected(double binvar, std::map<std::string, double> varmap, F &score);
+  template <typename F> bool IsSelected(double binvar, const std::map<std::string, double> &varmap, F &score);
   /// overload to pass directly a vector of variables
   bool IsSelected(double binvar, std::vector<double> variables);
   /// overload for getting the model score too
   template <typename F> bool IsSelected(double binvar, std::vector<double> variables, F &score);
   /// return the ML model predicted scores (raw or proba, depending on useraw)
-  bool PredictMultiClass(double binvar, std::map<std::string, double> varmap, std::vector<double> &outScores);
+  bool PredictMultiClass(double binvar, const std::map<std::string, double> &varmap, std::vector<double> &outScores);
   /// overload to pass directly a vector of variables
   bool PredictMultiClass(double binvar, std::vector<double> variables, std::vector<double> &outScores);
   /// return true if predicted score for map is above the threshold given in the config
-  bool IsSelectedMultiClass(double binvar, std::map<std::string, double> varmap);
+  bool IsSelectedMultiClass(double binvar, const std::map<std::string, double> &varmap);
   /// overload for getting the model score too
-  template <typename F> bool IsSelectedMultiClass(double binvar, std::map<std::string, double> varmap, std::vector<F> &outScores);
+  template <typename F> bool IsSelectedMultiClass(double binvar, const std::map<std::string, double> &varmap, std::vector<F> &outScores);
   /// overload to pass directly a vector of variables
   bool IsSelectedMultiClass(double binvar, std::vector<double> variables);
   /// overload for getting the model score too
   template <typename F> bool IsSelectedMultiClass(double binvar, std::vector<double> variables, std::vector<F> &outScores);
 
+  /// set the column names of the feature matrix passed to PredictBatch (default: VAR_NAMES order of the config)
+  void SetBatchColumns(const std::vector<std::string> &columns) { fBatchColumns = columns; ResolveBatchColumns(); }
+  /// number of scores returned per candidate (1 for binary models, number of classes otherwise)
+  int GetNumberOfScores() const { return fNScores; }
+  /// return the ML model predicted scores for nCand candidates in one call. features is a row-major
+  /// nCand x nColumns matrix, scores must hold nCand x GetNumberOfScores() values; candidates outside
+  /// the binning (or failing prediction) get -999. Candidates are grouped per model bin and each group
+  /// is scored with one multi-row (multi-threaded, see NUM_THREADS) model call. Returns the number of
+  /// candidates evaluated
+  int PredictBatch(const double *binvars, const double *features, int nCand, int nColumns, double *scores);
+
 protected:
+  void ResolveBatchColumns();
+
+
   std::string fConfigFilePath;    /// path of the config file
 
   std::vector<AliMLModelHandler> fModels;     //!<! vector of models
@@ -88,12 +102,19 @@ protected:
 
   bool fRaw;    /// set to true to use raw score instead of probability
 
+  std::vector<std::string> fBatchColumns;    /// column names of the PredictBatch feature matrix
+  std::vector<int> fBatchColumnIndex;        //!<! column of each model feature in the feature matrix
+  std::vector<double> fBatchFeatures;        //!<! scratch candidates x features matrix of one model bin
+  std::vector<double> fBatchScores;          //!<! scratch scores of one model bin
+  std::vector<std::vector<int> > fBatchRows; //!<! candidates of the current batch in each model bin
+  int fNScores;                              //!<! number of scores per candidate
+
   /// \cond CLASSIMP
-  ClassDef(AliMLResponse, 2);    ///
+  ClassDef(AliMLResponse, 3);    ///
   /// \endcond
 };
 
-template <typename F> bool AliMLResponse::IsSelected(double binvar, std::map<std::string, double> varmap, F &score) {
+template <typename F> bool AliMLResponse::IsSelected(double binvar, const std::map<std::string, double> &varmap, F &score) {
   int bin = FindBin(binvar);
   if (bin < 0)
     return false;
@@ -109,7 +130,7 @@ template <typename F> bool AliMLResponse::IsSelected(double binvar, std::vector<
   return score >= fModels.at(bin - 1).GetScoreCut()[0];
 }
 
-template <typename F> bool AliMLResponse::IsSelectedMultiClass(double binvar, std::map<std::string, double> varmap, std::vector<F> &outScores) {
+template <typename F> bool AliMLResponse::IsSelectedMultiClass(double binvar, const std::map<std::string, double> &varmap, std::vector<F> &outScores) {
   int bin = FindBin(binvar);
   if (bin < 0)
     return false;
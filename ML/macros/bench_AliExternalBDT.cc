@@ -0,0 +1,77 @@
+#include <TRandom3.h>
+#include <TStopwatch.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "AliExternalBDT.h"
+
+// Throughput of AliExternalBDT: rows/second for the row-by-row Predict and for the multi-row
+// PredictBatch (double and float32 input) with the requested number of predictor threads.
+// Usage: .x bench_AliExternalBDT.cc+("test_xgboost_pt8_12.model", "model_lightgbm.txt", 100000, 4)
+
+namespace {
+void bench(AliExternalBDT *bdt, const std::string &label, int nRows, int nThreads) {
+  const int nFeatures = (int)bdt->GetNumberOfFeatures();
+  TRandom3 rnd(1234);
+  std::vector<double> features(nRows * nFeatures);
+  std::vector<float> featuresF(nRows * nFeatures);
+  for (std::size_t i = 0; i < features.size(); i++) {
+    features[i] = rnd.Uniform(-1., 1.);
+    featuresF[i] = (float)features[i];
+  }
+
+  std::vector<double> scores;
+  TStopwatch timer;
+  timer.Start();
+  for (int iRow = 0; iRow < nRows; iRow++) {
+    scores.clear();
+    bdt->Predict(&features[iRow * nFeatures], nFeatures, scores, true);
+  }
+  timer.Stop();
+  const double tSingle = timer.RealTime();
+
+  timer.Start();
+  bdt->PredictBatch(features.data(), nRows, nFeatures, scores, true);
+  timer.Stop();
+  const double tBatch = timer.RealTime();
+
+  std::vector<float> scoresF;
+  timer.Start();
+  bdt->PredictBatch(featuresF.data(), nRows, nFeatures, scoresF, true);
+  timer.Stop();
+  const double tBatchF = timer.RealTime();
+
+  std::cout << label << " (" << nFeatures << " features, " << nThreads << " threads):" << std::endl;
+  std::cout << "  Predict           " << nRows / tSingle << " rows/s" << std::endl;
+  std::cout << "  PredictBatch      " << nRows / tBatch << " rows/s" << std::endl;
+  std::cout << "  PredictBatch f32  " << nRows / tBatchF << " rows/s" << std::endl;
+}
+} // namespace
+
+int bench_AliExternalBDT(std::string xgboostModel = "test_xgboost_pt8_12.model", std::string lightgbmModel = "",
+                         int nRows = 100000, int nThreads = 1) {
+  if (!xgboostModel.empty()) {
+    AliExternalBDT *bdt = new AliExternalBDT("bench_xgb");
+    bdt->SetNumberOfThreads(nThreads);
+    if (!bdt->LoadXGBoostModel(xgboostModel)) {
+      delete bdt;
+      return 1;
+    }
+    bench(bdt, "XGBoost " + xgboostModel, nRows, nThreads);
+    delete bdt;
+  }
+
+  if (!lightgbmModel.empty()) {
+    AliExternalBDT *bdt = new AliExternalBDT("bench_lgb");
+    bdt->SetNumberOfThreads(nThreads);
+    if (!bdt->LoadLightGBMModel(lightgbmModel)) {
+      delete bdt;
+      return 1;
+    }
+    bench(bdt, "LightGBM " + lightgbmModel, nRows, nThreads);
+    delete bdt;
+  }
+  return 0;
+}
@@ -17,6 +17,7 @@
 #include "AliVMultiplicity.h"
 #include "AliPPVsMultUtils.h"
 #include "AliESDtrackCuts.h"
+#include "AliAnalysisManager.h"
 
 #include "AliAnalysisUtils.h"
 
@@ -25,6 +26,7 @@ ClassImp(AliAnalysisUtils)
 //______________________________________________________________________
 AliAnalysisUtils::AliAnalysisUtils():TObject(),
   fisAOD(kTRUE),
+  fUseDecisionCache(kTRUE),
   fMinVtxContr(0),
   fMaxVtxZ(10.),
   fCutOnZVertexSPD(kTRUE),
@@ -51,8 +53,77 @@ AliAnalysisUtils::~AliAnalysisUtils()
 {
 }
 
+//______________________________________________________________________
+AliAnalysisUtils::DecisionCache& AliAnalysisUtils::GetDecisionCache()
+{
+  // shared by all the instances, valid for one event
+  static DecisionCache cache;
+  return cache;
+}
+
+//______________________________________________________________________
+AliAnalysisUtils::DecisionCache* AliAnalysisUtils::GetEventCache(const AliVEvent *event) const
+{
+  // cache of the event, reset on a new event
+  // only used in an analysis manager event loop, where the current entry identifies the event
+  if (!fUseDecisionCache || !event) return 0x0;
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  if (!mgr) return 0x0;
+  DecisionCache &cache = GetDecisionCache();
+  const Long64_t entry = mgr->GetCurrentEntry();
+  if (cache.fEvent != event || cache.fEntry != entry) {
+    cache.fEvent = event;
+    cache.fEntry = entry;
+    cache.fDecisions.clear();
+  }
+  return &cache;
+}
+
+//______________________________________________________________________
+Bool_t AliAnalysisUtils::FindCachedDecision(const DecisionCache &cache, Int_t check, const Double_t *par, Bool_t &decision)
+{
+  for (UInt_t i = 0; i < cache.fDecisions.size(); i++) {
+    const CachedDecision &cached = cache.fDecisions[i];
+    if (cached.fCheck != check) continue;
+    Bool_t same = kTRUE;
+    for (Int_t ip = 0; ip < kMaxCachePar && same; ip++) same = (cached.fPar[ip] == par[ip]);
+    if (!same) continue;
+    decision = cached.fDecision;
+    return kTRUE;
+  }
+  return kFALSE;
+}
+
+//______________________________________________________________________
+void AliAnalysisUtils::AddCachedDecision(DecisionCache &cache, Int_t check, const Double_t *par, Bool_t decision)
+{
+  CachedDecision cached;
+  cached.fCheck = check;
+  for (Int_t ip = 0; ip < kMaxCachePar; ip++) cached.fPar[ip] = par[ip];
+  cached.fDecision = decision;
+  cache.fDecisions.push_back(cached);
+}
+
 //______________________________________________________________________
 Bool_t AliAnalysisUtils::IsVertexSelected2013pA(AliVEvent *event)
+{
+  const Double_t par[kMaxCachePar] = {Double_t(fMinVtxContr), fMaxVtxZ, Double_t(fCutOnZVertexSPD), 0, 0, 0};
+  DecisionCache *cache = GetEventCache(event);
+  Bool_t accept = kFALSE;
+  if (cache && FindCachedDecision(*cache, kVertexSelected2013pA, par, accept)) {
+    fisAOD = cache->fIsAOD;
+    return accept;
+  }
+  accept = EvaluateVertexSelected2013pA(event);
+  if (cache) {
+    cache->fIsAOD = fisAOD;
+    AddCachedDecision(*cache, kVertexSelected2013pA, par, accept);
+  }
+  return accept;
+}
+
+//______________________________________________________________________
+Bool_t AliAnalysisUtils::EvaluateVertexSelected2013pA(AliVEvent *event)
 {
   Bool_t accept = kFALSE;
   
@@ -153,6 +224,18 @@ Bool_t AliAnalysisUtils::IsPileUpEvent(AliVEvent *event)
 
 //______________________________________________________________________
 Bool_t AliAnalysisUtils::IsPileUpMV(AliVEvent *event)
+{
+  const Double_t par[kMaxCachePar] = {Double_t(fMinPlpContribMV), fMaxPlpChi2MV, fMinWDistMV, Double_t(fCheckPlpFromDifferentBCMV), 0, 0};
+  DecisionCache *cache = GetEventCache(event);
+  Bool_t isPileUp = kFALSE;
+  if (cache && FindCachedDecision(*cache, kPileUpMV, par, isPileUp)) return isPileUp;
+  isPileUp = EvaluatePileUpMV(event);
+  if (cache) AddCachedDecision(*cache, kPileUpMV, par, isPileUp);
+  return isPileUp;
+}
+
+//______________________________________________________________________
+Bool_t AliAnalysisUtils::EvaluatePileUpMV(AliVEvent *event)
 {
   // check for multi-vertexer pile-up
   const AliAODEvent *aod = dynamic_cast<const AliAODEvent*>(event);
@@ -202,6 +285,22 @@ Bool_t AliAnalysisUtils::IsPileUpMV(AliVEvent *event)
 
 //______________________________________________________________________
 Bool_t AliAnalysisUtils::IsPileUpSPD(AliVEvent *event)
+{
+  Double_t par[kMaxCachePar] = {0., Double_t(fMinPlpContribSPD), fMinPlpZdistSPD, fnSigmaPlpZdistSPD, fnSigmaPlpDiamXYSPD, fnSigmaPlpDiamZSPD};
+  if (fUseSPDCutInMultBins) { // the SPD cuts are not used
+    par[0] = 1.;
+    for (Int_t ip = 1; ip < kMaxCachePar; ip++) par[ip] = 0.;
+  }
+  DecisionCache *cache = GetEventCache(event);
+  Bool_t isPileUp = kFALSE;
+  if (cache && FindCachedDecision(*cache, kPileUpSPD, par, isPileUp)) return isPileUp;
+  isPileUp = EvaluatePileUpSPD(event);
+  if (cache) AddCachedDecision(*cache, kPileUpSPD, par, isPileUp);
+  return isPileUp;
+}
+
+//______________________________________________________________________
+Bool_t AliAnalysisUtils::EvaluatePileUpSPD(AliVEvent *event)
 {
   // check for SPD pile-up
   const AliAODEvent *aod = dynamic_cast<const AliAODEvent*>(event);
@@ -241,6 +340,17 @@ Bool_t AliAnalysisUtils::IsOutOfBunchPileUp(AliVEvent *event)
 
 //______________________________________________________________________
 Bool_t AliAnalysisUtils::IsSPDClusterVsTrackletBG(AliVEvent *event){
+  const Double_t par[kMaxCachePar] = {fASPDCvsTCut, fBSPDCvsTCut, 0, 0, 0, 0};
+  DecisionCache *cache = GetEventCache(event);
+  Bool_t isBG = kFALSE;
+  if (cache && FindCachedDecision(*cache, kSPDClusterVsTrackletBG, par, isBG)) return isBG;
+  isBG = EvaluateSPDClusterVsTrackletBG(event);
+  if (cache) AddCachedDecision(*cache, kSPDClusterVsTrackletBG, par, isBG);
+  return isBG;
+}
+
+//______________________________________________________________________
+Bool_t AliAnalysisUtils::EvaluateSPDClusterVsTrackletBG(AliVEvent *event){
   Int_t nClustersLayer0 = event->GetNumberOfITSClusters(0);
   Int_t nClustersLayer1 = event->GetNumberOfITSClusters(1);
   Int_t nTracklets      = event->GetMultiplicity()->GetNumberOfTracklets();
@@ -14,6 +14,7 @@
 #include <TObject.h>
 #include <TString.h>
 #include <TClonesArray.h>
+#include <vector>
 
 class AliVEvent;
 class AliVVertex;
@@ -46,6 +47,9 @@ class AliAnalysisUtils : public TObject {
   void SetMaxVtxZ(Float_t z=1e6) {fMaxVtxZ=z;}
   void SetCutOnZVertexSPD(Bool_t iscut=true) { fCutOnZVertexSPD = iscut; }
   
+  // decisions of the vertex, pileup and background checks are shared per event by all the instances with the same cuts
+  void SetUseDecisionCache(Bool_t use=kTRUE) { fUseDecisionCache = use; }
+  
   //general pileup selection settings
   void SetUseMVPlpSelection(Bool_t useMVPlpSelection) { fUseMVPlpSelection = useMVPlpSelection;}
   void SetUseOutOfBunchPileUp(Bool_t useOutOfBunchPileUp) { fUseOutOfBunchPileUp = useOutOfBunchPileUp;}
@@ -91,7 +95,32 @@ class AliAnalysisUtils : public TObject {
 
  private:
   
+  enum ECheck { kVertexSelected2013pA = 0, kPileUpMV, kPileUpSPD, kSPDClusterVsTrackletBG };
+  enum { kMaxCachePar = 6 };
+  struct CachedDecision {
+    Int_t fCheck;
+    Double_t fPar[kMaxCachePar];
+    Bool_t fDecision;
+  };
+  struct DecisionCache {
+    DecisionCache() : fEvent(0x0), fEntry(-1), fIsAOD(kTRUE), fDecisions() {}
+    const AliVEvent *fEvent;
+    Long64_t fEntry;
+    Bool_t fIsAOD;
+    std::vector<CachedDecision> fDecisions;
+  };
+  static DecisionCache& GetDecisionCache();
+  DecisionCache* GetEventCache(const AliVEvent *event) const;
+  static Bool_t FindCachedDecision(const DecisionCache &cache, Int_t check, const Double_t *par, Bool_t &decision);
+  static void AddCachedDecision(DecisionCache &cache, Int_t check, const Double_t *par, Bool_t decision);
+  
+  Bool_t EvaluateVertexSelected2013pA(AliVEvent *event);
+  Bool_t EvaluatePileUpMV(AliVEvent *event);
+  Bool_t EvaluatePileUpSPD(AliVEvent *event);
+  Bool_t EvaluateSPDClusterVsTrackletBG(AliVEvent *event);
+  
   Bool_t fisAOD; // flag for AOD:1 or ESD:0
+  Bool_t fUseDecisionCache; // share the decisions of the same event between the instances
   
   Int_t fMinVtxContr; // minimum vertex contributors
   Float_t fMaxVtxZ;   // maximum |z| of primary vertex
@@ -121,7 +150,7 @@ class AliAnalysisUtils : public TObject {
   AliAnalysisUtils(const AliAnalysisUtils& obj); // copy constructor
   AliAnalysisUtils& operator=(const AliAnalysisUtils& other); // assignment
     
-  ClassDef(AliAnalysisUtils,3) // base helper class
+  ClassDef(AliAnalysisUtils,4) // base helper class
 };
 #endif
  
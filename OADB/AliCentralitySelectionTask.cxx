@@ -52,6 +52,7 @@
 #include "AliCentrality.h"
 #include "AliOADBCentrality.h"
 #include "AliOADBContainer.h"
+#include "AliOADBObjectCache.h"
 #include "AliMultiplicity.h"
 #include "AliAODHandler.h"
 #include "AliAODHeader.h"
@@ -889,6 +890,7 @@ AliCentralitySelectionTask::AliCentralitySelectionTask(const AliCentralitySelect
   fHOutVertexT0(ana.fHOutVertexT0)
 {
   // Copy Constructor	
+  FreezeLookups();
 
 }
 
@@ -1699,60 +1701,60 @@ void AliCentralitySelectionTask::UserExec(Option_t */*option*/)
   }
 
   // ***** Centrality Selection
-  if(fHtempV0M) fCentV0M = fHtempV0M->GetBinContent(fHtempV0M->FindBin((v0Corr)));
-  if(fHtempV0A) fCentV0A = fHtempV0A->GetBinContent(fHtempV0A->FindBin((multV0ACorr)));
-  if(fHtempV0A0) fCentV0A0 = fHtempV0A0->GetBinContent(fHtempV0A0->FindBin((multV0A0Corr)));
-  if(fHtempV0A123) fCentV0A123 = fHtempV0A123->GetBinContent(fHtempV0A123->FindBin((multV0A123Corr)));
-  if(fHtempV0C) fCentV0C = fHtempV0C->GetBinContent(fHtempV0C->FindBin((multV0CCorr)));
-  if(fHtempV0A23) fCentV0A23 = fHtempV0A23->GetBinContent(fHtempV0A23->FindBin((multV0A23Corr)));
-  if(fHtempV0C01) fCentV0C01 = fHtempV0C01->GetBinContent(fHtempV0C01->FindBin((multV0C01Corr)));
-  if(fHtempV0S)  fCentV0S = fHtempV0S->GetBinContent(fHtempV0S->FindBin((multV0SCorr)));
-  if(fHtempV0MEq) fCentV0MEq = fHtempV0MEq->GetBinContent(fHtempV0MEq->FindBin((multV0AEq+multV0CEq)));
-  if(fHtempV0AEq) fCentV0AEq = fHtempV0AEq->GetBinContent(fHtempV0AEq->FindBin((multV0AEq)));
-  if(fHtempV0CEq) fCentV0CEq = fHtempV0CEq->GetBinContent(fHtempV0CEq->FindBin((multV0CEq)));
-  if(fHtempFMD) fCentFMD = fHtempFMD->GetBinContent(fHtempFMD->FindBin((multFMDA+multFMDC)));
-  if(fHtempTRK) fCentTRK = fHtempTRK->GetBinContent(fHtempTRK->FindBin(nTracks));
-  if(fHtempTKL) fCentTKL = fHtempTKL->GetBinContent(fHtempTKL->FindBin(nTracklets));
-  if(fHtempCL0) fCentCL0 = fHtempCL0->GetBinContent(fHtempCL0->FindBin(nClusters[0]));
-  if(fHtempCL1) fCentCL1 = fHtempCL1->GetBinContent(fHtempCL1->FindBin(spdCorr));
-  if(fHtempCND) fCentCND = fHtempCND->GetBinContent(fHtempCND->FindBin(multCND));
+  if(fHtempV0M) fCentV0M = fLookup[kLookupV0M].Eval((v0Corr));
+  if(fHtempV0A) fCentV0A = fLookup[kLookupV0A].Eval((multV0ACorr));
+  if(fHtempV0A0) fCentV0A0 = fLookup[kLookupV0A0].Eval((multV0A0Corr));
+  if(fHtempV0A123) fCentV0A123 = fLookup[kLookupV0A123].Eval((multV0A123Corr));
+  if(fHtempV0C) fCentV0C = fLookup[kLookupV0C].Eval((multV0CCorr));
+  if(fHtempV0A23) fCentV0A23 = fLookup[kLookupV0A23].Eval((multV0A23Corr));
+  if(fHtempV0C01) fCentV0C01 = fLookup[kLookupV0C01].Eval((multV0C01Corr));
+  if(fHtempV0S)  fCentV0S = fLookup[kLookupV0S].Eval((multV0SCorr));
+  if(fHtempV0MEq) fCentV0MEq = fLookup[kLookupV0MEq].Eval((multV0AEq+multV0CEq));
+  if(fHtempV0AEq) fCentV0AEq = fLookup[kLookupV0AEq].Eval((multV0AEq));
+  if(fHtempV0CEq) fCentV0CEq = fLookup[kLookupV0CEq].Eval((multV0CEq));
+  if(fHtempFMD) fCentFMD = fLookup[kLookupFMD].Eval((multFMDA+multFMDC));
+  if(fHtempTRK) fCentTRK = fLookup[kLookupTRK].Eval(nTracks);
+  if(fHtempTKL) fCentTKL = fLookup[kLookupTKL].Eval(nTracklets);
+  if(fHtempCL0) fCentCL0 = fLookup[kLookupCL0].Eval(nClusters[0]);
+  if(fHtempCL1) fCentCL1 = fLookup[kLookupCL1].Eval(spdCorr);
+  if(fHtempCND) fCentCND = fLookup[kLookupCND].Eval(multCND);
   if(fHtempZNA) {
-    if(znaFired) fCentZNA = fHtempZNA->GetBinContent(fHtempZNA->FindBin(znaTower));
+    if(znaFired) fCentZNA = fLookup[kLookupZNA].Eval(znaTower);
     else fCentZNA = 101;
   }
   if(fHtempZNC) {
-    if(zncFired) fCentZNC = fHtempZNC->GetBinContent(fHtempZNC->FindBin(zncTower));
+    if(zncFired) fCentZNC = fLookup[kLookupZNC].Eval(zncTower);
     else fCentZNC = 101;
   }
   if(fHtempZPA) {
-    if(znaFired) fCentZPA = fHtempZPA->GetBinContent(fHtempZPA->FindBin(zpaTower));
+    if(znaFired) fCentZPA = fLookup[kLookupZPA].Eval(zpaTower);
     else fCentZPA = 101;
   }
   if(fHtempZPC) {
-    if(zpcFired) fCentZPC = fHtempZPC->GetBinContent(fHtempZPC->FindBin(zpcTower));
+    if(zpcFired) fCentZPC = fLookup[kLookupZPC].Eval(zpcTower);
     else fCentZPC = 101;
   }
 
 
-  if(fHtempV0MvsFMD) fCentV0MvsFMD = fHtempV0MvsFMD->GetBinContent(fHtempV0MvsFMD->FindBin((multV0A+multV0C)));
-  if(fHtempTKLvsV0M) fCentTKLvsV0M = fHtempTKLvsV0M->GetBinContent(fHtempTKLvsV0M->FindBin(nTracklets));
+  if(fHtempV0MvsFMD) fCentV0MvsFMD = fLookup[kLookupV0MvsFMD].Eval((multV0A+multV0C));
+  if(fHtempTKLvsV0M) fCentTKLvsV0M = fLookup[kLookupTKLvsV0M].Eval(nTracklets);
   if(fHtempZEMvsZDC) fCentZEMvsZDC = fHtempZEMvsZDC->GetBinContent(fHtempZEMvsZDC->FindBin(zem1Energy+zem2Energy,zncEnergy+znaEnergy+zpcEnergy+zpaEnergy));
 
-  if(fHtempNPA) fCentNPA = fHtempNPA->GetBinContent(fHtempNPA->FindBin(Npart));
-  if(fHtempV0Mtrue) fCentV0Mtrue = fHtempV0Mtrue->GetBinContent(fHtempV0Mtrue->FindBin((multV0ACorr+multV0CCorr)));
-  if(fHtempV0Atrue) fCentV0Atrue = fHtempV0Atrue->GetBinContent(fHtempV0Atrue->FindBin((multV0ACorr)));
-  if(fHtempV0Ctrue) fCentV0Ctrue = fHtempV0Ctrue->GetBinContent(fHtempV0Ctrue->FindBin((multV0CCorr)));
-  if(fHtempV0MEqtrue) fCentV0MEqtrue = fHtempV0MEqtrue->GetBinContent(fHtempV0MEqtrue->FindBin((multV0AEq+multV0CEq)));
-  if(fHtempV0AEqtrue) fCentV0AEqtrue = fHtempV0AEqtrue->GetBinContent(fHtempV0AEqtrue->FindBin((multV0AEq)));
-  if(fHtempV0CEqtrue) fCentV0CEqtrue = fHtempV0CEqtrue->GetBinContent(fHtempV0CEqtrue->FindBin((multV0CEq)));
-  if(fHtempFMDtrue) fCentFMDtrue = fHtempFMDtrue->GetBinContent(fHtempFMDtrue->FindBin((multFMDA+multFMDC)));
-  if(fHtempTRKtrue) fCentTRKtrue = fHtempTRKtrue->GetBinContent(fHtempTRKtrue->FindBin(nTracks));
-  if(fHtempTKLtrue) fCentTKLtrue = fHtempTKLtrue->GetBinContent(fHtempTKLtrue->FindBin(nTracklets));
-  if(fHtempCL0true) fCentCL0true = fHtempCL0true->GetBinContent(fHtempCL0true->FindBin(nClusters[0]));
-  if(fHtempCL1true) fCentCL1true = fHtempCL1true->GetBinContent(fHtempCL1true->FindBin(spdCorr));
-  if(fHtempCNDtrue) fCentCNDtrue = fHtempCNDtrue->GetBinContent(fHtempCNDtrue->FindBin(multCND));
-  if(fHtempZNAtrue) fCentZNAtrue = fHtempZNAtrue->GetBinContent(fHtempZNAtrue->FindBin(znaTower));
-  if(fHtempZNCtrue) fCentZNCtrue = fHtempZNCtrue->GetBinContent(fHtempZNCtrue->FindBin(zncTower));
+  if(fHtempNPA) fCentNPA = fLookup[kLookupNPA].Eval(Npart);
+  if(fHtempV0Mtrue) fCentV0Mtrue = fLookup[kLookupV0Mtrue].Eval((multV0ACorr+multV0CCorr));
+  if(fHtempV0Atrue) fCentV0Atrue = fLookup[kLookupV0Atrue].Eval((multV0ACorr));
+  if(fHtempV0Ctrue) fCentV0Ctrue = fLookup[kLookupV0Ctrue].Eval((multV0CCorr));
+  if(fHtempV0MEqtrue) fCentV0MEqtrue = fLookup[kLookupV0MEqtrue].Eval((multV0AEq+multV0CEq));
+  if(fHtempV0AEqtrue) fCentV0AEqtrue = fLookup[kLookupV0AEqtrue].Eval((multV0AEq));
+  if(fHtempV0CEqtrue) fCentV0CEqtrue = fLookup[kLookupV0CEqtrue].Eval((multV0CEq));
+  if(fHtempFMDtrue) fCentFMDtrue = fLookup[kLookupFMDtrue].Eval((multFMDA+multFMDC));
+  if(fHtempTRKtrue) fCentTRKtrue = fLookup[kLookupTRKtrue].Eval(nTracks);
+  if(fHtempTKLtrue) fCentTKLtrue = fLookup[kLookupTKLtrue].Eval(nTracklets);
+  if(fHtempCL0true) fCentCL0true = fLookup[kLookupCL0true].Eval(nClusters[0]);
+  if(fHtempCL1true) fCentCL1true = fLookup[kLookupCL1true].Eval(spdCorr);
+  if(fHtempCNDtrue) fCentCNDtrue = fLookup[kLookupCNDtrue].Eval(multCND);
+  if(fHtempZNAtrue) fCentZNAtrue = fLookup[kLookupZNAtrue].Eval(znaTower);
+  if(fHtempZNCtrue) fCentZNCtrue = fLookup[kLookupZNCtrue].Eval(zncTower);
    
 
   // ***** Cleaning
@@ -2008,11 +2010,12 @@ Int_t AliCentralitySelectionTask::SetupRun(const AliVEvent* const esd)
   TString fileName =(Form("%s/COMMON/CENTRALITY/data/centrality.root", AliAnalysisManager::GetOADBPath()));
   AliInfo(Form("Setup Centrality Selection for run %d with file %s\n",fCurrentRun,fileName.Data()));
 
-  AliOADBContainer *con = new AliOADBContainer("OADB");
-  con->InitFromFile(fileName,"Centrality");
+  // the container is shared with the other instances of the process
+  AliOADBContainer *con = AliOADBObjectCache::GetContainer(fileName,"Centrality");
+  if (!con) AliFatal(Form("Cannot read the centrality OADB from %s", fileName.Data()));
 
   AliOADBCentrality*  centOADB = 0;
-  centOADB = (AliOADBCentrality*)(con->GetObject(fCurrentRun));
+  centOADB = (AliOADBCentrality*)(AliOADBObjectCache::GetObject(fileName,"Centrality",fCurrentRun));
   if (!centOADB) {
     AliWarning(Form("Centrality OADB does not exist for run %d, using Default \n",fCurrentRun ));
     centOADB  = (AliOADBCentrality*)(con->GetDefaultObject("oadbDefault"));
@@ -2096,6 +2099,8 @@ Int_t AliCentralitySelectionTask::SetupRun(const AliVEvent* const esd)
    }
 
 
+  FreezeLookups();
+
     TString path = gSystem->ExpandPathName(fileName.Data());
   if (!fHtempV0M) AliWarning(Form("Calibration for V0M does not exist in %s", path.Data()));
   if (!fHtempV0A) AliWarning(Form("Calibration for V0A does not exist in %s", path.Data()));
@@ -2162,6 +2167,50 @@ Int_t AliCentralitySelectionTask::SetupRun(const AliVEvent* const esd)
 
 
 
+//________________________________________________________________________
+void AliCentralitySelectionTask::FreezeLookups()
+{
+  // Copy the 1D calibration histograms of the run into the flat lookup tables used per event
+  fLookup[kLookupV0M].Set(fHtempV0M);
+  fLookup[kLookupV0A].Set(fHtempV0A);
+  fLookup[kLookupV0A0].Set(fHtempV0A0);
+  fLookup[kLookupV0A123].Set(fHtempV0A123);
+  fLookup[kLookupV0C].Set(fHtempV0C);
+  fLookup[kLookupV0A23].Set(fHtempV0A23);
+  fLookup[kLookupV0C01].Set(fHtempV0C01);
+  fLookup[kLookupV0S].Set(fHtempV0S);
+  fLookup[kLookupV0MEq].Set(fHtempV0MEq);
+  fLookup[kLookupV0AEq].Set(fHtempV0AEq);
+  fLookup[kLookupV0CEq].Set(fHtempV0CEq);
+  fLookup[kLookupFMD].Set(fHtempFMD);
+  fLookup[kLookupTRK].Set(fHtempTRK);
+  fLookup[kLookupTKL].Set(fHtempTKL);
+  fLookup[kLookupCL0].Set(fHtempCL0);
+  fLookup[kLookupCL1].Set(fHtempCL1);
+  fLookup[kLookupCND].Set(fHtempCND);
+  fLookup[kLookupZNA].Set(fHtempZNA);
+  fLookup[kLookupZNC].Set(fHtempZNC);
+  fLookup[kLookupZPA].Set(fHtempZPA);
+  fLookup[kLookupZPC].Set(fHtempZPC);
+  fLookup[kLookupV0MvsFMD].Set(fHtempV0MvsFMD);
+  fLookup[kLookupTKLvsV0M].Set(fHtempTKLvsV0M);
+  fLookup[kLookupNPA].Set(fHtempNPA);
+  fLookup[kLookupV0Mtrue].Set(fHtempV0Mtrue);
+  fLookup[kLookupV0Atrue].Set(fHtempV0Atrue);
+  fLookup[kLookupV0Ctrue].Set(fHtempV0Ctrue);
+  fLookup[kLookupV0MEqtrue].Set(fHtempV0MEqtrue);
+  fLookup[kLookupV0AEqtrue].Set(fHtempV0AEqtrue);
+  fLookup[kLookupV0CEqtrue].Set(fHtempV0CEqtrue);
+  fLookup[kLookupFMDtrue].Set(fHtempFMDtrue);
+  fLookup[kLookupTRKtrue].Set(fHtempTRKtrue);
+  fLookup[kLookupTKLtrue].Set(fHtempTKLtrue);
+  fLookup[kLookupCL0true].Set(fHtempCL0true);
+  fLookup[kLookupCL1true].Set(fHtempCL1true);
+  fLookup[kLookupCNDtrue].Set(fHtempCNDtrue);
+  fLookup[kLookupZNAtrue].Set(fHtempZNAtrue);
+  fLookup[kLookupZNCtrue].Set(fHtempZNCtrue);
+}
+
 //________________________________________________________________________
 Bool_t AliCentralitySelectionTask::IsOutlierV0MSPD(Float_t spd, Float_t v0, Int_t cent) const
 {
@@ -10,6 +10,7 @@
 //*****************************************************
 
 #include "AliAnalysisTaskSE.h"
+#include "AliPercentileLookup.h"
 
 class TFile;
 class TH1F;
@@ -46,6 +47,7 @@ class AliCentralitySelectionTask : public AliAnalysisTaskSE {
  private:
 
   Int_t SetupRun(const AliVEvent* const esd);
+  void  FreezeLookups();
   Bool_t IsOutlierV0MSPD(Float_t spd, Float_t v0, Int_t cent) const;
   Bool_t IsOutlierV0MTPC(Int_t tracks, Float_t v0, Int_t cent) const;
   Bool_t IsOutlierV0MZDC(Float_t zdc, Float_t v0) const;
@@ -193,6 +195,15 @@ class AliCentralitySelectionTask : public AliAnalysisTaskSE {
   TH1F    *fHtempZPAtrue;       // histogram with centrality true (sim) vs multiplicity using ZPA
   TH1F    *fHtempZPCtrue;       // histogram with centrality true (sim) vs multiplicity using ZPC
 
+  enum ELookup { kLookupV0M, kLookupV0A, kLookupV0A0, kLookupV0A123, kLookupV0C, kLookupV0A23, kLookupV0C01,
+                  kLookupV0S, kLookupV0MEq, kLookupV0AEq, kLookupV0CEq, kLookupFMD, kLookupTRK, kLookupTKL,
+                  kLookupCL0, kLookupCL1, kLookupCND, kLookupZNA, kLookupZNC, kLookupZPA, kLookupZPC,
+                  kLookupV0MvsFMD, kLookupTKLvsV0M, kLookupNPA, kLookupV0Mtrue, kLookupV0Atrue,
+                  kLookupV0Ctrue, kLookupV0MEqtrue, kLookupV0AEqtrue, kLookupV0CEqtrue, kLookupFMDtrue,
+                  kLookupTRKtrue, kLookupTKLtrue, kLookupCL0true, kLookupCL1true, kLookupCNDtrue,
+                  kLookupZNAtrue, kLookupZNCtrue, kNLookups };
+  AliPercentileLookup fLookup[kNLookups]; //! per-run copies of the 1D calibration histograms above
+
   TList   *fOutputList; // output list
   
 
@@ -327,7 +338,7 @@ class AliCentralitySelectionTask : public AliAnalysisTaskSE {
   TH1F *fHOutVertex ;           //control histogram for vertex SPD
   TH1F *fHOutVertexT0 ;         //control histogram for vertex T0
 
-  ClassDef(AliCentralitySelectionTask, 31);
+  ClassDef(AliCentralitySelectionTask, 32);
 };
 
 #endif
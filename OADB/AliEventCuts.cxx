@@ -25,6 +25,7 @@ using std::vector;
 #include <AliMCEvent.h>
 #include <AliMCEventHandler.h>
 #include <AliMultSelection.h>
+#include <AliMultSelectionCuts.h>
 #include <AliMultSelectionTask.h>
 #include <AliVEventHandler.h>
 #include <AliVMultiplicity.h>
@@ -97,6 +98,7 @@ AliEventCuts::AliEventCuts(bool saveplots) : TList(),
   fFlag{BIT(kNoCuts)},
   fCentEstimators{"V0M","CL0"},
   fCentPercentiles{-1.f},
+  fCentEstimatorIndex{-1,-1},
   fPrimaryVertex{nullptr},
   fNewEvent{true},
   fOverrideAutoTriggerMask{false},
@@ -143,6 +145,7 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
   const int current_run = ev->GetRunNumber();
   if (current_run != fCurrentRun) {
     fCurrentRun = current_run;
+    fCentEstimatorIndex[0] = fCentEstimatorIndex[1] = -1;
     if (!fManualMode) {
       ::Info("AliEventCuts::AcceptEvent","Current run (%i) is different from the previous (%i): setting automatically the corresponding event cuts.",current_run,fCurrentRun);
       AutomaticSetup(ev);
@@ -176,17 +179,21 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
   /// Use of trigger classes overrides the trigger mask
   /// (i.e. if trigger mask is not fired but we see the trigger class we want we enable the trigger bit)
   /// A special bit is set in this case
-  TString classes = ev->GetFiredTriggerClasses();
   if (fTriggerClasses.empty())
     fFlag |= BIT(kTriggerClasses);
-  for (const std::string& myClass : fTriggerClasses) {
-    if (classes.Contains(myClass.data()) && !myClass.empty()) {
-      fFlag |= BIT(kTrigger);
-      fFlag |= BIT(kTriggerClasses);
-      break;
+  else {
+    TString classes = ev->GetFiredTriggerClasses();
+    for (const std::string& myClass : fTriggerClasses) {
+      if (classes.Contains(myClass.data()) && !myClass.empty()) {
+        fFlag |= BIT(kTrigger);
+        fFlag |= BIT(kTriggerClasses);
+        break;
+      }
     }
   }
 
+  AliAODEvent* aodEv = dynamic_cast<AliAODEvent*>(ev);
+
   /// Vertex existance
   const AliVVertex* vtTrc = ev->GetPrimaryVertex();
   bool isTrackV = true;
@@ -194,7 +201,7 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
   const AliVVertex* vtSPD = ev->GetPrimaryVertexSPD();
   /// On current AODs primary vertex could be from TPC or invalid SPD vertex
   /// The following check should be applied only on AOD.
-  bool goodAODvtx = (dynamic_cast<AliAODEvent*>(ev) ? GoodPrimaryAODVertex(ev) : true) || !fCheckAODvertex;
+  bool goodAODvtx = (aodEv ? GoodPrimaryAODVertex(ev) : true) || !fCheckAODvertex;
 
   if (vtSPD->GetNContributors() > 0) fFlag |= BIT(kVertexSPD);
   if (vtTrc->GetNContributors() > 1 && isTrackV && goodAODvtx) fFlag |= BIT(kVertexTracks);
@@ -246,8 +253,8 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
   int nCluSDDSSD=0;
   for(Int_t iLay=2; iLay<6; iLay++) nCluSDDSSD+=mult->GetNumberOfITSClusters(iLay);
   int nCluTPC=0;
-  if (dynamic_cast<AliAODEvent*>(ev)) nCluTPC=dynamic_cast<AliAODEvent*>(ev)->GetNumberOfTPCClusters();
-  else if (dynamic_cast<AliESDEvent*>(ev)) nCluTPC=dynamic_cast<AliESDEvent*>(ev)->GetNumberOfTPCClusters();
+  if (aodEv) nCluTPC=aodEv->GetNumberOfTPCClusters();
+  else if (AliESDEvent* esdEv = dynamic_cast<AliESDEvent*>(ev)) nCluTPC=esdEv->GetNumberOfTPCClusters();
   if(fUseVariablesCorrelationCuts || fTOFvsFB32[0] || fUseStrongVarCorrelationCut ||
      fUseTPCTracklCorrelationCut) ComputeTrackMultiplicity(ev);
   const double its_tpcclus_limit = PolN(double(nCluTPC),fITSvsTPCcluPolCut,2);
@@ -282,12 +289,12 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
         AliFatal("The multiplicity selection framework has been request but no AliMultSelection object was found attached to the Event."
                  " Did you run the AliMultSelectionTask?");
       }
-      fCentPercentiles[0] = cent->GetMultiplicityPercentile(fCentEstimators[0].data(), fMultSelectionEvCuts);
-      fCentPercentiles[1] = cent->GetMultiplicityPercentile(fCentEstimators[1].data(), fMultSelectionEvCuts);
+      fCentPercentiles[0] = GetMultSelectionPercentile(cent, 0);
+      fCentPercentiles[1] = GetMultSelectionPercentile(cent, 1);
     }
     const auto& x = fCentPercentiles[1];
     const double center = x * fEstimatorsCorrelationCoef[1] + fEstimatorsCorrelationCoef[0];
-    const double sigma = fEstimatorsSigmaPars[0] + fEstimatorsSigmaPars[1] * x + fEstimatorsSigmaPars[2] * x * x + fEstimatorsSigmaPars[3] * x * x * x;
+    const double sigma = fEstimatorsSigmaPars[0] + x * (fEstimatorsSigmaPars[1] + x * (fEstimatorsSigmaPars[2] + x * fEstimatorsSigmaPars[3]));
     if ((!fUseEstimatorsCorrelationCut || fMC ||
           (fCentPercentiles[0] >= center - fDeltaEstimatorNsigma[0] * sigma && fCentPercentiles[0] <= center + fDeltaEstimatorNsigma[1] * sigma))
         && fCentPercentiles[0] >= fMinCentrality
@@ -1048,6 +1055,28 @@ void  AliEventCuts::OverridePileUpCuts(int minContrib, float minZdist, float nSi
   fOverrideAutoPileUpCuts = ov;
 }
 
+float AliEventCuts::GetMultSelectionPercentile(AliMultSelection* cent, int iEst) {
+  /// Same as AliMultSelection::GetMultiplicityPercentile, the estimator is looked up by name only once per run.
+  /// The cached index is checked against the name, in case the estimator list changes within the run.
+  AliMultEstimator* cached = cent->GetEstimator(fCentEstimatorIndex[iEst]);
+  if (fCentEstimatorIndex[iEst] >= 0 && (!cached || fCentEstimators[iEst] != cached->GetName()))
+    fCentEstimatorIndex[iEst] = -1;
+  if (fCentEstimatorIndex[iEst] == -1) {
+    fCentEstimatorIndex[iEst] = -2;
+    for (long iE = 0; iE < cent->GetNEstimators(); ++iE) {
+      AliMultEstimator* est = cent->GetEstimator(iE);
+      if (est && fCentEstimators[iEst] == est->GetName()) {
+        fCentEstimatorIndex[iEst] = iE;
+        break;
+      }
+    }
+  }
+  AliMultEstimator* est = cent->GetEstimator(fCentEstimatorIndex[iEst]);
+  if (!est) return AliMultSelectionCuts::kNoCalib;
+  if (fMultSelectionEvCuts && cent->GetEvSelCode() > 0) return cent->GetEvSelCode();
+  return est->GetPercentile();
+}
+
 bool AliEventCuts::GoodPrimaryAODVertex(AliVEvent* ev) {
   AliAODEvent* aodEv = dynamic_cast<AliAODEvent*>(ev);
   if (!aodEv) {
@@ -17,6 +17,7 @@
 #include "AliEMCALLEDEventsCut.h"
 
 class AliESDtrackCuts;
+class AliMultSelection;
 class TList;
 class TH1D;
 class TH1I;
@@ -125,7 +126,7 @@ class AliEventCuts : public TList {
     std::string       GetCentralityEstimator (unsigned int estimator = 0) const;
     const AliVVertex* GetPrimaryVertex() const { return fPrimaryVertex; }
 
-    void          SetCentralityEstimators (std::string first = "V0M", std::string second = "CL0") { fCentEstimators[0] = first; fCentEstimators[1] = second; }
+    void          SetCentralityEstimators (std::string first = "V0M", std::string second = "CL0") { fCentEstimators[0] = first; fCentEstimators[1] = second; fCentEstimatorIndex[0] = fCentEstimatorIndex[1] = -1; }
     void          SetCentralityRange (float min, float max) { fMinCentrality = min; fMaxCentrality = max; }
     void          SetMaxVertexZposition (float max) { fMinVtz = -fabs(max); fMaxVtz = fabs(max); }
     void          SelectOnlyInelGt0(bool toogle) { fOverrideInelGt0 = true; fSelectInelGt0 = toogle; }
@@ -198,6 +199,7 @@ class AliEventCuts : public TList {
     void          AutomaticSetup (AliVEvent *ev);
     void          ComputeTrackMultiplicity(AliVEvent *ev);
     template<typename F> F PolN(F x, F* coef, int n);
+    float         GetMultSelectionPercentile(AliMultSelection* cent, int iEst);
 
     bool          fManualMode;                    ///< if true the cuts are not loaded automatically looking at the run number
     bool          fSavePlots;                     ///< if true the plots are automatically added to this object
@@ -206,6 +208,7 @@ class AliEventCuts : public TList {
 
     std::string   fCentEstimators[2];             ///< Centrality estimators: the first is used as main estimators, that is correlated with the second to monitor spurious events.
     float         fCentPercentiles[2];            ///< Centrality percentiles
+    long          fCentEstimatorIndex[2];         //!<! Index of the estimators in the AliMultSelection list, resolved on the first event of the run (-1 not resolved, -2 not found)
     AliVVertex   *fPrimaryVertex;                 //!<! Primary vertex pointer
 
     ///
@@ -245,14 +248,14 @@ class AliEventCuts : public TList {
     AliESDtrackCuts* fFB32trackCuts; //!<! Cuts corresponding to FB32 in the ESD (used only for correlations cuts in ESDs)
     AliESDtrackCuts* fTPConlyCuts;   //!<! Cuts corresponding to the standalone TPC cuts in the ESDs (used only for correlations cuts in ESDs)
 
-    ClassDef(AliEventCuts, 16)
+    ClassDef(AliEventCuts, 17)
 };
 
 template<typename F> F AliEventCuts::PolN(F x,F* coef, int n) {
   if (n < 1) ::Fatal("AliEventCuts::PolN","PolN should be used only for n>=1.");
-  F ret = coef[0] + coef[1] * x;
-  for (int i = 2; i <= n; ++i)
-    ret += coef[i] * std::pow(x,i);
+  F ret = coef[n];
+  for (int i = n - 1; i >= 0; --i)
+    ret = ret * x + coef[i];
   return ret;
 }
 
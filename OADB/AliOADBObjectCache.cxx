@@ -0,0 +1,161 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "TStopwatch.h"
+#include "TSystem.h"
+
+#include "AliOADBContainer.h"
+
+#include "AliOADBObjectCache.h"
+
+namespace {
+  /// A loaded container and its users
+  struct CacheEntry {
+    AliOADBContainer* fContainer = 0x0;  ///< container, 0x0 if it could not be read
+    Int_t fNUsers = 0;                    ///< number of Acquire() not yet released
+    std::map<std::string, TObject*> fObjects; ///< objects already looked up, keyed by run, default and pass name
+  };
+
+  /// Load statistics of a file
+  struct FileStats {
+    Int_t fNLoads = 0;       ///< number of containers read from the file
+    Int_t fNRequests = 0;    ///< number of GetContainer() and GetObject() calls
+    Double_t fTime = 0.;     ///< total real time spent reading, s
+    Long_t fMemory = 0;      ///< total increase of the resident memory while reading, kB
+  };
+
+  struct Cache {
+    std::recursive_mutex fMutex;
+    std::map<std::string, CacheEntry> fEntries;  ///< keyed by file and container name
+    std::map<std::string, FileStats> fStats;     ///< keyed by file name
+    Bool_t fReportAtExit = kFALSE;
+  };
+
+  Cache& GetCache()
+  {
+    static Cache cache;
+    return cache;
+  }
+
+  std::string MakeKey(const char* fileName, const char* containerName)
+  {
+    return std::string(fileName) + "#" + containerName;
+  }
+
+  /// Entry of the container, read from the file on the first call (the caller holds the mutex)
+  CacheEntry& LoadEntry(const char* fileName, const char* containerName)
+  {
+    Cache& cache = GetCache();
+    FileStats& stats = cache.fStats[fileName];
+    ++stats.fNRequests;
+
+    const std::string key = MakeKey(fileName, containerName);
+    auto found = cache.fEntries.find(key);
+    if (found != cache.fEntries.end()) return found->second;
+
+    CacheEntry& entry = cache.fEntries[key];
+    ProcInfo_t before, after;
+    gSystem->GetProcInfo(&before);
+    TStopwatch timer;
+    AliOADBContainer* cont = new AliOADBContainer("OADB");
+    if (cont->InitFromFile(fileName, containerName)) {
+      ::Error("AliOADBObjectCache::LoadEntry", "Cannot read the container %s from %s", containerName, fileName);
+      delete cont;
+      cont = 0x0;
+    }
+    timer.Stop();
+    gSystem->GetProcInfo(&after);
+
+    entry.fContainer = cont;
+    ++stats.fNLoads;
+    stats.fTime += timer.RealTime();
+    stats.fMemory += after.fMemResident - before.fMemResident;
+    return entry;
+  }
+}
+
+//______________________________________________________________________________
+AliOADBContainer* AliOADBObjectCache::GetContainer(const char* fileName, const char* containerName)
+{
+  std::lock_guard<std::recursive_mutex> lock(GetCache().fMutex);
+  return LoadEntry(fileName, containerName).fContainer;
+}
+
+//______________________________________________________________________________
+TObject* AliOADBObjectCache::GetObject(const char* fileName, const char* containerName, Int_t run,
+                                       const char* defaultName/* = ""*/, const char* passName/* = ""*/)
+{
+  std::lock_guard<std::recursive_mutex> lock(GetCache().fMutex);
+  CacheEntry& entry = LoadEntry(fileName, containerName);
+  if (!entry.fContainer) return 0x0;
+
+  const std::string key = std::to_string(run) + "#" + defaultName + "#" + passName;
+  auto found = entry.fObjects.find(key);
+  if (found != entry.fObjects.end()) return found->second;
+
+  TObject* obj = entry.fContainer->GetObject(run, defaultName, passName);
+  entry.fObjects[key] = obj;
+  return obj;
+}
+
+//______________________________________________________________________________
+void AliOADBObjectCache::Acquire(const char* fileName, const char* containerName)
+{
+  std::lock_guard<std::recursive_mutex> lock(GetCache().fMutex);
+  ++LoadEntry(fileName, containerName).fNUsers;
+}
+
+//______________________________________________________________________________
+void AliOADBObjectCache::Release(const char* fileName, const char* containerName)
+{
+  Cache& cache = GetCache();
+  std::lock_guard<std::recursive_mutex> lock(cache.fMutex);
+  auto found = cache.fEntries.find(MakeKey(fileName, containerName));
+  if (found == cache.fEntries.end() || found->second.fNUsers <= 0) return;
+  if (--found->second.fNUsers > 0) return;
+
+  delete found->second.fContainer;
+  cache.fEntries.erase(found);
+}
+
+//______________________________________________________________________________
+void AliOADBObjectCache::PrintReport()
+{
+  Cache& cache = GetCache();
+  std::lock_guard<std::recursive_mutex> lock(cache.fMutex);
+  printf("AliOADBObjectCache: %d containers in memory\n", Int_t(cache.fEntries.size()));
+  for (const auto& stats : cache.fStats) {
+    printf("  %s: %d loads, %d requests, %.3f s, %ld kB\n", stats.first.data(), stats.second.fNLoads,
+           stats.second.fNRequests, stats.second.fTime, stats.second.fMemory);
+  }
+}
+
+//______________________________________________________________________________
+void AliOADBObjectCache::SetPrintReportAtExit(Bool_t print/* = kTRUE*/)
+{
+  Cache& cache = GetCache();
+  std::lock_guard<std::recursive_mutex> lock(cache.fMutex);
+  static Bool_t registered = kFALSE;
+  cache.fReportAtExit = print;
+  if (print && !registered) {
+    std::atexit([]() { if (GetCache().fReportAtExit) AliOADBObjectCache::PrintReport(); });
+    registered = kTRUE;
+  }
+}
@@ -0,0 +1,45 @@
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+#ifndef ALIOADBOBJECTCACHE_H
+#define ALIOADBOBJECTCACHE_H
+
+/// \file AliOADBObjectCache.h
+/// \brief Process-wide cache of OADB containers shared by all the users
+
+#include "Rtypes.h"
+
+class TObject;
+class AliOADBContainer;
+
+/// \class AliOADBObjectCache
+/// \brief Process-wide cache of OADB containers shared by all the users
+///
+/// An OADB container is read the first time it is requested and then shared by all the
+/// tasks (wagons) of the process, which saves the repeated file opening and the duplicate
+/// copies in memory. The objects returned by GetObject() are owned by the container and must not
+/// be modified or deleted by the caller; clone them if needed.
+///
+/// Users keeping a container across runs should call Acquire() once (e.g. at the first run)
+/// and Release() in their destructor: the container is deleted when the last user releases it.
+/// Containers used without Acquire() stay in memory until the end of the process.
+///
+/// The access is serialized by a mutex. The load time and the resident memory increase of
+/// each file are recorded and printed by PrintReport(), which can be scheduled at the end of the
+/// job with SetPrintReportAtExit().
+class AliOADBObjectCache {
+  public:
+    static AliOADBContainer* GetContainer(const char* fileName, const char* containerName);
+    static TObject*          GetObject(const char* fileName, const char* containerName, Int_t run,
+                                       const char* defaultName = "", const char* passName = "");
+
+    static void Acquire(const char* fileName, const char* containerName);
+    static void Release(const char* fileName, const char* containerName);
+
+    static void PrintReport();
+    static void SetPrintReportAtExit(Bool_t print = kTRUE);
+
+  private:
+    AliOADBObjectCache();
+};
+
+#endif
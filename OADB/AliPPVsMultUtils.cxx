@@ -85,6 +85,40 @@ AliPPVsMultUtils &AliPPVsMultUtils::operator=(const AliPPVsMultUtils &c)
     return *this;
 }
 
+//_____________________________________________________________________________
+AliPPVsMultUtils::PercentileCache& AliPPVsMultUtils::GetPercentileCache()
+{
+    //Shared by all the instances: the calibration depends only on the run
+    static PercentileCache cache;
+    return cache;
+}
+
+//_____________________________________________________________________________
+Int_t AliPPVsMultUtils::GetEstimatorIndex( const TString& lMethod )
+{
+    static const char* lNames[kNEstimators] = {
+        "V0M", "V0A", "V0C", "V0MEq", "V0AEq", "V0CEq", "V0B", "V0Apartial", "V0Cpartial", "V0S", "V0SB"
+    };
+    for( Int_t iEst = 0; iEst < kNEstimators; iEst++ ) if ( lMethod == lNames[iEst] ) return iEst;
+    return -1;
+}
+
+//_____________________________________________________________________________
+Int_t AliPPVsMultUtils::GetEventSelectionCode( AliVEvent *event, PercentileCache &cache )
+{
+    //Embedded event selection: code of the last failed check (0 if all pass), evaluated once per event
+    if ( cache.fEvSelCode > 0 ) {
+        Int_t lCode = 0;
+        if(IsSelectedTrigger                        ( event ) == kFALSE ) lCode = -200;
+        if(IsINELgtZERO                         ( event ) == kFALSE ) lCode = -201;
+        if(IsAcceptedVertexPosition             ( event ) == kFALSE ) lCode = -202;
+        if(IsNotPileupSPDInMultBins             ( event ) == kFALSE ) lCode = -203;
+        if(HasNoInconsistentSPDandTrackVertices ( event ) == kFALSE ) lCode = -204;
+        cache.fEvSelCode = lCode;
+    }
+    return cache.fEvSelCode;
+}
+
 //_____________________________________________________________________________
 Float_t AliPPVsMultUtils::MinVal( Float_t A, Float_t B ) {
     if( A < B ) {
@@ -141,6 +175,25 @@ Float_t AliPPVsMultUtils::GetMultiplicityPercentile(AliVEvent *event, TString lM
     }
 
     Float_t lreturnval = -1;
+    const Int_t lEstimator = GetEstimatorIndex( lMethod );
+
+    //Result cached by a previous call (of any instance) on the same event
+    AliAnalysisManager *lManager = AliAnalysisManager::GetAnalysisManager();
+    const Bool_t lCacheable = ( lManager != 0x0 );
+    const Long64_t lEntry = lCacheable ? lManager->GetCurrentEntry() : -1;
+    PercentileCache &cache = GetPercentileCache();
+    if ( lCacheable && cache.fValid && cache.fEvent == event && cache.fEntry == lEntry && cache.fRunNumber == lRequestedRunNumber ) {
+        if ( lEstimator >= 0 ) lreturnval = cache.fPercentile[lEstimator];
+        if ( lEmbedEventSelection ) {
+            const Int_t lEvSelCode = GetEventSelectionCode( event, cache );
+            if ( lEvSelCode ) lreturnval = lEvSelCode;
+        }
+        return lreturnval;
+    }
+    cache.fValid = kFALSE;
+    cache.fEvent = event;
+    cache.fEntry = lEntry;
+    cache.fRunNumber = lRequestedRunNumber;
 
     //Get VZERO Information for multiplicity later
     AliVVZERO* esdV0 = event->GetVZEROData();
@@ -206,37 +259,23 @@ Float_t AliPPVsMultUtils::GetMultiplicityPercentile(AliVEvent *event, TString lM
         multV0Cpartial += mult;
     }
 
-    if ( lMethod == "V0M" ) lreturnval =
-            fBoundaryHisto_V0M -> GetBinContent( fBoundaryHisto_V0M->FindBin(multV0A+multV0C) );
-    if ( lMethod == "V0A" ) lreturnval =
-            fBoundaryHisto_V0A -> GetBinContent( fBoundaryHisto_V0A->FindBin(multV0A) );
-    if ( lMethod == "V0C" ) lreturnval =
-            fBoundaryHisto_V0C -> GetBinContent( fBoundaryHisto_V0C->FindBin(multV0C) );
-    //equalized
-    if ( lMethod == "V0MEq" ) lreturnval =
-            fBoundaryHisto_V0MEq -> GetBinContent( fBoundaryHisto_V0MEq->FindBin(multV0AEq+multV0CEq) );
-    if ( lMethod == "V0AEq" ) lreturnval =
-            fBoundaryHisto_V0AEq -> GetBinContent( fBoundaryHisto_V0AEq->FindBin(multV0AEq) );
-    if ( lMethod == "V0CEq" ) lreturnval =
-            fBoundaryHisto_V0CEq -> GetBinContent( fBoundaryHisto_V0CEq->FindBin(multV0CEq) );
-    //extra stuff
-    if ( lMethod == "V0B" ) lreturnval =
-            fBoundaryHisto_V0B -> GetBinContent( fBoundaryHisto_V0B->FindBin( MinVal( multV0A / fAverageAmplitudes->GetBinContent(1) , multV0C / fAverageAmplitudes->GetBinContent(2) ) ) );
-    if ( lMethod == "V0Apartial" ) lreturnval =
-            fBoundaryHisto_V0Apartial -> GetBinContent( fBoundaryHisto_V0Apartial->FindBin( multV0Apartial ) );
-    if ( lMethod == "V0Cpartial" ) lreturnval =
-            fBoundaryHisto_V0Cpartial -> GetBinContent( fBoundaryHisto_V0Cpartial->FindBin( multV0Cpartial ) );
-    if ( lMethod == "V0S" ) lreturnval =
-            fBoundaryHisto_V0S -> GetBinContent( fBoundaryHisto_V0S->FindBin( (multV0Apartial/fAverageAmplitudes->GetBinContent(3)) + (multV0Cpartial/fAverageAmplitudes->GetBinContent(4)) ) );
-    if ( lMethod == "V0SB" ) lreturnval =
-            fBoundaryHisto_V0SB -> GetBinContent( fBoundaryHisto_V0SB->FindBin( MinVal( multV0Apartial / fAverageAmplitudes->GetBinContent(3) , multV0Cpartial / fAverageAmplitudes->GetBinContent(4) ) ) );
-
+    //All the estimators are evaluated at once and kept for the other calls on the same event
+    const Double_t lAmplitudes[kNEstimators] = {
+        multV0A+multV0C, multV0A, multV0C,
+        multV0AEq+multV0CEq, multV0AEq, multV0CEq,
+        MinVal( multV0A / fAverageAmplitudes->GetBinContent(1) , multV0C / fAverageAmplitudes->GetBinContent(2) ),
+        multV0Apartial, multV0Cpartial,
+        (multV0Apartial/fAverageAmplitudes->GetBinContent(3)) + (multV0Cpartial/fAverageAmplitudes->GetBinContent(4)),
+        MinVal( multV0Apartial / fAverageAmplitudes->GetBinContent(3) , multV0Cpartial / fAverageAmplitudes->GetBinContent(4) )
+    };
+    for( Int_t iEst = 0; iEst < kNEstimators; iEst++ ) cache.fPercentile[iEst] = fLookup[iEst].Eval( lAmplitudes[iEst] );
+    cache.fValid = lCacheable;
+    cache.fEvSelCode = 1;
+
+    if ( lEstimator >= 0 ) lreturnval = cache.fPercentile[lEstimator];
     if ( lEmbedEventSelection ) {
-        if(IsSelectedTrigger                        ( event ) == kFALSE ) lreturnval = -200;
-        if(IsINELgtZERO                         ( event ) == kFALSE ) lreturnval = -201;
-        if(IsAcceptedVertexPosition             ( event ) == kFALSE ) lreturnval = -202;
-        if(IsNotPileupSPDInMultBins             ( event ) == kFALSE ) lreturnval = -203;
-        if(HasNoInconsistentSPDandTrackVertices ( event ) == kFALSE ) lreturnval = -204;
+        const Int_t lEvSelCode = GetEventSelectionCode( event, cache );
+        if ( lEvSelCode ) lreturnval = lEvSelCode;
     }
 
     return lreturnval;
@@ -247,6 +286,7 @@ Bool_t AliPPVsMultUtils::LoadCalibration(Int_t lLoadThisCalibration)
 //To be called if starting analysis on a new run
 {
     //If Histograms exist, de-allocate to prevent memory leakage
+    for( Int_t iEst = 0; iEst < kNEstimators; iEst++ ) fLookup[iEst].Reset();
     if( fBoundaryHisto_V0M ) {
         fBoundaryHisto_V0M->Delete();
         fBoundaryHisto_V0M = 0x0;
@@ -435,6 +475,14 @@ Bool_t AliPPVsMultUtils::LoadCalibration(Int_t lLoadThisCalibration)
     fBoundaryHisto_V0SB->SetDirectory(0);
     fAverageAmplitudes->SetDirectory(0);
 
+    //Flat copies for the per-event lookup, in the order of GetEstimatorIndex
+    const TH1F *lBoundaryHistos[kNEstimators] = {
+        fBoundaryHisto_V0M, fBoundaryHisto_V0A, fBoundaryHisto_V0C, fBoundaryHisto_V0MEq, fBoundaryHisto_V0AEq,
+        fBoundaryHisto_V0CEq, fBoundaryHisto_V0B, fBoundaryHisto_V0Apartial, fBoundaryHisto_V0Cpartial,
+        fBoundaryHisto_V0S, fBoundaryHisto_V0SB
+    };
+    for( Int_t iEst = 0; iEst < kNEstimators; iEst++ ) fLookup[iEst].Set( lBoundaryHistos[iEst] );
+
     //AliInfo("Closing");
     if( lCalibFile_V0M ) {
         lCalibFile_V0M->Close();
@@ -3,6 +3,7 @@
 
 #include "TObject.h"
 #include "AliVEvent.h"
+#include "AliPercentileLookup.h"
 
 class AliVEvent;
 class AliVVertex;
@@ -45,6 +46,22 @@ public:
 
 private:
 
+    enum { kNEstimators = 11 };
+
+    //Percentiles of the last event, shared by all the instances
+    struct PercentileCache {
+        PercentileCache() : fValid(kFALSE), fEvent(0x0), fEntry(-1), fRunNumber(-1), fEvSelCode(1) {}
+        Bool_t fValid;
+        const AliVEvent *fEvent;
+        Long64_t fEntry;
+        Int_t fRunNumber;
+        Int_t fEvSelCode; //positive if not yet evaluated
+        Float_t fPercentile[kNEstimators];
+    };
+    static PercentileCache& GetPercentileCache();
+    static Int_t GetEstimatorIndex( const TString& lMethod );
+    static Int_t GetEventSelectionCode( AliVEvent *event, PercentileCache &cache );
+
     Int_t fRunNumber; // for control of run changes
     Bool_t fCalibrationLoaded; // control flag
 
@@ -63,8 +80,10 @@ private:
 
     //To Store <V0A>, <V0C>, <V0Apartial> and <V0Cpartial> on a run-per-run basis
     TH1D *fAverageAmplitudes; 
+
+    AliPercentileLookup fLookup[kNEstimators]; //! flat copies of the boundary histograms
     
-    ClassDef(AliPPVsMultUtils,3) // base helper class
+    ClassDef(AliPPVsMultUtils,4) // base helper class
 };
 #endif
 
@@ -0,0 +1,38 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+#include <TAxis.h>
+#include <TH1.h>
+
+#include "AliPercentileLookup.h"
+
+ClassImp(AliPercentileLookup)
+
+//______________________________________________________________________________
+void AliPercentileLookup::Set(const TH1* h)
+{
+  Reset();
+  if (!h) return;
+
+  const TAxis* axis = h->GetXaxis();
+  fNBins = axis->GetNbins();
+  fXmin = axis->GetXmin();
+  fXmax = axis->GetXmax();
+  const TArrayD* bins = axis->GetXbins();
+  if (bins->GetSize()) fEdges.assign(bins->GetArray(), bins->GetArray() + bins->GetSize());
+
+  fContent.resize(fNBins + 2);
+  for (Int_t i = 0; i <= fNBins + 1; i++) fContent[i] = h->GetBinContent(i);
+}
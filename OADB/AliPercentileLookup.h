@@ -0,0 +1,47 @@
+#ifndef ALIPERCENTILELOOKUP_H
+#define ALIPERCENTILELOOKUP_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/// \class AliPercentileLookup
+/// \brief Frozen copy of a 1D calibration histogram for percentile lookups
+///
+/// Eval(x) returns exactly h->GetBinContent(h->FindBin(x)) of the histogram given to Set(),
+/// with the bin index computed directly (fixed bins) or by binary search (variable bins),
+/// without virtual calls. Set() is meant to be called once per run.
+
+#include <algorithm>
+#include <vector>
+
+#include <Rtypes.h>
+
+class TH1;
+
+class AliPercentileLookup {
+ public:
+  AliPercentileLookup() : fNBins(0), fXmin(0.), fXmax(0.), fEdges(), fContent() {}
+
+  void     Set(const TH1* h);
+  void     Reset() { fNBins = 0; fEdges.clear(); fContent.clear(); }
+  Bool_t   IsSet() const { return !fContent.empty(); }
+
+  Double_t Eval(Double_t x) const {
+    Int_t bin;
+    if (x < fXmin) bin = 0;
+    else if (!(x < fXmax)) bin = fNBins + 1; // also catches NaN
+    else if (fEdges.empty()) bin = 1 + Int_t(fNBins * (x - fXmin) / (fXmax - fXmin));
+    else bin = std::upper_bound(fEdges.begin(), fEdges.end(), x) - fEdges.begin();
+    return fContent[bin];
+  }
+
+ private:
+  Int_t                 fNBins;   ///< number of bins
+  Double_t              fXmin;    ///< lower edge of the axis
+  Double_t              fXmax;    ///< upper edge of the axis
+  std::vector<Double_t> fEdges;   ///< bin edges, only for variable bins
+  std::vector<Double_t> fContent; ///< bin contents, including underflow and overflow
+
+  ClassDef(AliPercentileLookup, 1);
+};
+
+#endif
@@ -66,6 +66,9 @@
 //           Michele Floris, CERN
 //-------------------------------------------------------------------------
 #include <vector>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
 
 #include <Riostream.h>
 #include <TH1F.h>
@@ -96,6 +99,7 @@
 #include "TPRegexp.h"
 #include "TFile.h"
 #include "AliOADBContainer.h"
+#include "AliOADBObjectCache.h"
 #include "AliOADBPhysicsSelection.h"
 #include "AliOADBFillingScheme.h"
 #include "AliOADBTriggerAnalysis.h"
@@ -111,6 +115,150 @@
 
 class StringToRegexp : public std::map<std::string, TPRegexp> {};
 
+// Trigger logics compiled to postfix code. The operands are slots holding
+// the value of one trigger (including the offline flag): each slot is
+// evaluated once per event and shared by all the trigger classes.
+class TriggerLogicPrograms {
+public:
+  enum EOp { kSlot, kConst, kNot, kNeg, kOr, kAnd, kEq, kNe, kLt, kLe, kGt, kGe, kAdd, kSub, kMul, kDiv };
+  struct Op {
+    Int_t fType;
+    Int_t fSlot;
+    Double_t fValue;
+  };
+  struct Program {
+    Program() : fValid(kFALSE), fCode() {}
+    Bool_t fValid;          // kFALSE: not compiled, the TFormula is used
+    std::vector<Op> fCode;
+  };
+
+  TriggerLogicPrograms() : fOnline(NTRIGGERLOGICS), fOffline(NTRIGGERLOGICS), fSlotTrigger(), fSlotValue(), fSlotStamp(), fStamp(0) {}
+
+  void Reset() {
+    fOnline.assign(NTRIGGERLOGICS, Program());
+    fOffline.assign(NTRIGGERLOGICS, Program());
+    fSlotTrigger.clear();
+    fSlotValue.clear();
+    fSlotStamp.clear();
+  }
+  Int_t Slot(Int_t trigger) {
+    for (size_t i = 0; i < fSlotTrigger.size(); ++i)
+      if (fSlotTrigger[i] == trigger) return i;
+    fSlotTrigger.push_back(trigger);
+    fSlotValue.push_back(0);
+    fSlotStamp.push_back(0);
+    return fSlotTrigger.size() - 1;
+  }
+  Bool_t Compile(const char* logic, Bool_t offline, Program& program);
+
+  std::vector<Program>   fOnline;      // per trigger logic index
+  std::vector<Program>   fOffline;     // per trigger logic index
+  std::vector<Int_t>     fSlotTrigger; // trigger of each slot
+  std::vector<Int_t>     fSlotValue;   // value of each slot for the event fSlotStamp
+  std::vector<ULong64_t> fSlotStamp;   // event counter at which the slot was evaluated
+  ULong64_t              fStamp;       // counter of the processed events
+
+private:
+  // Recursive descent over the TFormula syntax used in the OADB:
+  // || && ! comparisons + - * / parentheses, numbers and trigger names
+  struct Parser {
+    TriggerLogicPrograms* fPrograms;
+    const char* fPos;
+    Int_t fOfflineFlag;
+    std::vector<Op>* fCode;
+
+    void Skip() { while (*fPos == ' ' || *fPos == '\t') ++fPos; }
+    Bool_t Accept(const char* token) {
+      Skip();
+      size_t n = strlen(token);
+      if (strncmp(fPos, token, n)) return kFALSE;
+      // do not take "<" from "<=" or "!" from "!="
+      if (n == 1 && (token[0] == '<' || token[0] == '>' || token[0] == '!') && fPos[1] == '=') return kFALSE;
+      fPos += n;
+      return kTRUE;
+    }
+    void Emit(Int_t type, Int_t slot = -1, Double_t value = 0) { Op op = {type, slot, value}; fCode->push_back(op); }
+    Bool_t Or()  { if (!And()) return kFALSE; while (Accept("||")) { if (!And()) return kFALSE; Emit(kOr); } return kTRUE; }
+    Bool_t And() { if (!Eq()) return kFALSE;  while (Accept("&&")) { if (!Eq()) return kFALSE;  Emit(kAnd); } return kTRUE; }
+    Bool_t Eq() {
+      if (!Rel()) return kFALSE;
+      while (true) {
+        Int_t type = Accept("==") ? kEq : Accept("!=") ? kNe : -1;
+        if (type < 0) return kTRUE;
+        if (!Rel()) return kFALSE;
+        Emit(type);
+      }
+    }
+    Bool_t Rel() {
+      if (!Add()) return kFALSE;
+      while (true) {
+        Int_t type = Accept("<=") ? kLe : Accept(">=") ? kGe : Accept("<") ? kLt : Accept(">") ? kGt : -1;
+        if (type < 0) return kTRUE;
+        if (!Add()) return kFALSE;
+        Emit(type);
+      }
+    }
+    Bool_t Add() {
+      if (!Mul()) return kFALSE;
+      while (true) {
+        Int_t type = Accept("+") ? kAdd : Accept("-") ? kSub : -1;
+        if (type < 0) return kTRUE;
+        if (!Mul()) return kFALSE;
+        Emit(type);
+      }
+    }
+    Bool_t Mul() {
+      if (!Unary()) return kFALSE;
+      while (true) {
+        Int_t type = Accept("*") ? kMul : Accept("/") ? kDiv : -1;
+        if (type < 0) return kTRUE;
+        if (!Unary()) return kFALSE;
+        Emit(type);
+      }
+    }
+    Bool_t Unary() {
+      if (Accept("!")) { if (!Unary()) return kFALSE; Emit(kNot); return kTRUE; }
+      if (Accept("-")) { if (!Unary()) return kFALSE; Emit(kNeg); return kTRUE; }
+      if (Accept("+")) return Unary();
+      return Primary();
+    }
+    Bool_t Primary() {
+      Skip();
+      if (Accept("(")) return Or() && Accept(")");
+      if (isdigit(*fPos) || *fPos == '.') {
+        char* end = 0;
+        Double_t value = strtod(fPos, &end);
+        if (end == fPos) return kFALSE;
+        fPos = end;
+        Emit(kConst, -1, value);
+        return kTRUE;
+      }
+      if (isalpha(*fPos)) {
+        const char* begin = fPos;
+        while (isalnum(*fPos)) ++fPos;
+        std::string name(begin, fPos);
+        TInterpreter::EErrorCode error;
+        Int_t bit = gInterpreter->ProcessLine(Form("AliTriggerAnalysis::k%s;", name.c_str()), &error);
+        if (error > 0) return kFALSE; // left to the TFormula path, which reports it
+        Emit(kSlot, fPrograms->Slot(bit | fOfflineFlag));
+        return kTRUE;
+      }
+      return kFALSE;
+    }
+  };
+};
+
+Bool_t TriggerLogicPrograms::Compile(const char* logic, Bool_t offline, Program& program) {
+  program = Program();
+  Parser parser = {this, logic, offline ? (Int_t)AliTriggerAnalysis::kOfflineFlag : 0, &program.fCode};
+  parser.Skip();
+  if (!*logic || !parser.Or()) return kFALSE;
+  parser.Skip();
+  if (*parser.fPos) return kFALSE;
+  program.fValid = kTRUE;
+  return kTRUE;
+}
+
 ClassImp(AliPhysicsSelection)
 
 AliPhysicsSelection::AliPhysicsSelection() :
@@ -132,7 +280,8 @@ fPSOADB(0),
 fFillOADB(0),
 fTriggerOADB(0),
 fTriggerToFormula(new StringToFormula()),
-fTriggerToRegexp(new StringToRegexp())
+fTriggerToRegexp(new StringToRegexp()),
+fTriggerPrograms(new TriggerLogicPrograms())
 {
   // constructor
   fCollTrigClasses.SetOwner(1);
@@ -162,7 +311,8 @@ AliPhysicsSelection::AliPhysicsSelection(const char *name) :
  fFillOADB(0),
  fTriggerOADB(0),
  fTriggerToFormula(new StringToFormula()),
- fTriggerToRegexp(new StringToRegexp())
+ fTriggerToRegexp(new StringToRegexp()),
+ fTriggerPrograms(new TriggerLogicPrograms())
  {
    // constructor
    fCollTrigClasses.SetOwner(1);
@@ -179,6 +329,7 @@ AliPhysicsSelection::~AliPhysicsSelection(){
   if (fTriggerOADB)  delete fTriggerOADB;
   delete fTriggerToFormula;
   delete fTriggerToRegexp;
+  delete fTriggerPrograms;
 }
 
 UInt_t AliPhysicsSelection::CheckTriggerClass(const AliVEvent* event, const char* trigger, Int_t& triggerLogic) const {
@@ -286,6 +437,73 @@ Bool_t AliPhysicsSelection::EvaluateTriggerLogic(const AliVEvent* event,
   return trg_formula.EvalPar(dummy_val, paras.data());
 }
 
+/// Evaluate the hardware or offline trigger logic with the given index of the
+/// OADB object. The compiled logic is used if available, the trigger values
+/// are computed once per event; otherwise the TFormula path is taken.
+Bool_t AliPhysicsSelection::EvaluateTriggerLogic(const AliVEvent* event,
+						 AliTriggerAnalysis* triggerAnalysis,
+						 Int_t triggerLogic, Bool_t offline){
+  if (triggerLogic < 0 || triggerLogic >= NTRIGGERLOGICS ||
+      !(offline ? fTriggerPrograms->fOffline : fTriggerPrograms->fOnline)[triggerLogic].fValid) {
+    TString logic = offline ? fPSOADB->GetOfflineTrigger(triggerLogic) : fPSOADB->GetHardwareTrigger(triggerLogic);
+    return EvaluateTriggerLogic(event, triggerAnalysis, logic.Data(), offline);
+  }
+
+  typedef TriggerLogicPrograms P;
+  P& progs = *fTriggerPrograms;
+  const std::vector<P::Op>& code = (offline ? progs.fOffline : progs.fOnline)[triggerLogic].fCode;
+  std::vector<Double_t> stack;
+  stack.reserve(code.size());
+  for (size_t i = 0; i < code.size(); ++i) {
+    const P::Op& op = code[i];
+    if (op.fType == P::kSlot) {
+      if (progs.fSlotStamp[op.fSlot] != progs.fStamp) {
+        typedef AliTriggerAnalysis::Trigger Trigger;
+        progs.fSlotValue[op.fSlot] = triggerAnalysis->EvaluateTrigger(event, static_cast<Trigger>(progs.fSlotTrigger[op.fSlot]));
+        progs.fSlotStamp[op.fSlot] = progs.fStamp;
+      }
+      stack.push_back(progs.fSlotValue[op.fSlot]);
+      continue;
+    }
+    if (op.fType == P::kConst) { stack.push_back(op.fValue); continue; }
+    if (op.fType == P::kNot) { stack.back() = !stack.back(); continue; }
+    if (op.fType == P::kNeg) { stack.back() = -stack.back(); continue; }
+    Double_t b = stack.back();
+    stack.pop_back();
+    Double_t& a = stack.back();
+    switch (op.fType) {
+      case P::kOr:  a = (a || b); break;
+      case P::kAnd: a = (a && b); break;
+      case P::kEq:  a = (a == b); break;
+      case P::kNe:  a = (a != b); break;
+      case P::kLt:  a = (a <  b); break;
+      case P::kLe:  a = (a <= b); break;
+      case P::kGt:  a = (a >  b); break;
+      case P::kGe:  a = (a >= b); break;
+      case P::kAdd: a = a + b; break;
+      case P::kSub: a = a - b; break;
+      case P::kMul: a = a * b; break;
+      case P::kDiv: a = b != 0 ? a / b : 0; break;
+    }
+  }
+  return stack.back();
+}
+
+void AliPhysicsSelection::CompileTriggerLogics(){
+  // compile the trigger logics of the current OADB object; the logics that
+  // cannot be compiled are left to the TFormula path
+  fTriggerPrograms->Reset();
+  if (!fPSOADB) return;
+  Int_t nCompiled = 0;
+  for (Int_t i = 0; i < NTRIGGERLOGICS; ++i) {
+    TString online  = fPSOADB->GetHardwareTrigger(i);
+    TString offline = fPSOADB->GetOfflineTrigger(i);
+    if (online.Length()  && fTriggerPrograms->Compile(online.Data(),  kFALSE, fTriggerPrograms->fOnline[i]))  nCompiled++;
+    if (offline.Length() && fTriggerPrograms->Compile(offline.Data(), kTRUE,  fTriggerPrograms->fOffline[i])) nCompiled++;
+  }
+  AliInfo(Form("Compiled %d trigger logics using %d trigger inputs", nCompiled, (Int_t)fTriggerPrograms->fSlotTrigger.size()));
+}
+
 //______________________________________________________________________________
 UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
   // checks if the given event is a collision candidate
@@ -302,6 +520,9 @@ UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
     if (eventType != 7) return kFALSE;
   }
   
+  // new event for the trigger values shared by the trigger logics
+  fTriggerPrograms->fStamp++;
+  
   UInt_t accept = 0;
   Int_t nColl = fCollTrigClasses.GetEntries();
   Int_t nBG   = fBGTrigClasses.GetEntries();
@@ -315,8 +536,8 @@ UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
     Int_t triggerLogic = 0;
     UInt_t singleTriggerResult = CheckTriggerClass(event, triggerClass, triggerLogic);
     if (!singleTriggerResult) continue;
-    Bool_t onlineDecision  = EvaluateTriggerLogic(event, triggerAnalysis, fPSOADB->GetHardwareTrigger(triggerLogic), kFALSE);
-    Bool_t offlineDecision = EvaluateTriggerLogic(event, triggerAnalysis, fPSOADB->GetOfflineTrigger(triggerLogic), kTRUE);
+    Bool_t onlineDecision  = EvaluateTriggerLogic(event, triggerAnalysis, triggerLogic, kFALSE);
+    Bool_t offlineDecision = EvaluateTriggerLogic(event, triggerAnalysis, triggerLogic, kTRUE);
     triggerAnalysis->FillHistograms(event,onlineDecision,offlineDecision);
     if (!onlineDecision) continue;
     if (!offlineDecision) continue;
@@ -362,29 +583,31 @@ Bool_t AliPhysicsSelection::Initialize(Int_t runNumber){
   /// Open OADB file and fetch OADB objects
   TString oadbfilename = AliPhysicsSelection::GetOADBFileName();
   
-  TFile * foadb = TFile::Open(oadbfilename);
-  if(!foadb->IsOpen()) AliFatal(Form("Cannot open OADB file %s", oadbfilename.Data()));
-  
+  /// The containers are shared with the other users of the process, the objects are cloned
+  /// since they are owned (and partly modified) by this object
   if(!fPSOADB || !fUsingCustomClasses) { // if it's already set and custom class is required, we use the one provided by the user
     AliInfo("Using Standard OADB");
-    AliOADBContainer * psContainer = (AliOADBContainer*) foadb->Get("physSel");
-    if (!psContainer) AliFatal("Cannot fetch OADB container for Physics selection");
-    fPSOADB = (AliOADBPhysicsSelection*) psContainer->GetObject(runNumber, fIsPP ? "oadbDefaultPP" : "oadbDefaultPbPb",fPassName);
-    if (!fPSOADB) AliFatal(Form("Cannot find physics selection object for run %d", runNumber));
+    if (!AliOADBObjectCache::GetContainer(oadbfilename, "physSel")) AliFatal("Cannot fetch OADB container for Physics selection");
+    TObject * ps = AliOADBObjectCache::GetObject(oadbfilename, "physSel", runNumber, fIsPP ? "oadbDefaultPP" : "oadbDefaultPbPb",fPassName);
+    if (!ps) AliFatal(Form("Cannot find physics selection object for run %d", runNumber));
+    delete fPSOADB;
+    fPSOADB = (AliOADBPhysicsSelection*) ps->Clone();
   } else {
     AliInfo("Using Custom OADB");
   }
   if(!fFillOADB || !fUsingCustomClasses) { // if it's already set and custom class is required, we use the one provided by the user
-    AliOADBContainer * fillContainer = (AliOADBContainer*) foadb->Get("fillScheme");
-    if (!fillContainer) AliFatal("Cannot fetch OADB container for filling scheme");
-    fFillOADB = (AliOADBFillingScheme*) fillContainer->GetObject(runNumber, "Default",fPassName);
-    if (!fFillOADB) AliFatal(Form("Cannot find  filling scheme object for run %d", runNumber));
+    if (!AliOADBObjectCache::GetContainer(oadbfilename, "fillScheme")) AliFatal("Cannot fetch OADB container for filling scheme");
+    TObject * fill = AliOADBObjectCache::GetObject(oadbfilename, "fillScheme", runNumber, "Default",fPassName);
+    if (!fill) AliFatal(Form("Cannot find  filling scheme object for run %d", runNumber));
+    delete fFillOADB;
+    fFillOADB = (AliOADBFillingScheme*) fill->Clone();
   }
   if(!fTriggerOADB || !fUsingCustomClasses) { // if it's already set and custom class is required, we use the one provided by the user
-    AliOADBContainer * triggerContainer = (AliOADBContainer*) foadb->Get("trigAnalysis");
-    if (!triggerContainer) AliFatal("Cannot fetch OADB container for trigger analysis");
-    fTriggerOADB = (AliOADBTriggerAnalysis*) triggerContainer->GetObject(runNumber, "Default",fPassName);
-    if (!fTriggerOADB) AliFatal(Form("Cannot find  trigger analysis object for run %d", runNumber));
+    if (!AliOADBObjectCache::GetContainer(oadbfilename, "trigAnalysis")) AliFatal("Cannot fetch OADB container for trigger analysis");
+    TObject * trig = AliOADBObjectCache::GetObject(oadbfilename, "trigAnalysis", runNumber, "Default",fPassName);
+    if (!trig) AliFatal(Form("Cannot find  trigger analysis object for run %d", runNumber));
+    delete fTriggerOADB;
+    fTriggerOADB = (AliOADBTriggerAnalysis*) trig->Clone();
     fTriggerOADB->Print();
   }
   
@@ -487,6 +710,7 @@ Bool_t AliPhysicsSelection::Initialize(Int_t runNumber){
     }
   }
   
+  CompileTriggerLogics();
   fCurrentRun = runNumber;
 
   TH1::AddDirectory(oldStatus);
@@ -20,7 +20,7 @@
 #include "AliVEvent.h"
 #include "AliVEventHandler.h"
 #include "AliAnalysisManager.h"
-#include "AliOADBContainer.h"
+#include "AliOADBObjectCache.h"
 
 #include "AliTimeRangeCut.h"
 
@@ -70,10 +70,8 @@ void AliTimeRangeCut::InitFromRunNumber(const Int_t run)
   printf("pass: %s\n", passName.Data());
 
   // ===| Get the AliTimeRangeMasking object |===
-  AliOADBContainer cont("TimeRangeMasking");
-  cont.InitFromFile(Form("%s/COMMON/PHYSICSSELECTION/data/TimeRangeMasking.root", fOADBPath.Data()), "TimeRangeMasking");
-
-  fTimeRangeMasking = (AliTimeRangeMasking<ULong64_t, UShort_t>*)cont.GetObject(run, "", passName);
+  const TString fileName = Form("%s/COMMON/PHYSICSSELECTION/data/TimeRangeMasking.root", fOADBPath.Data());
+  fTimeRangeMasking = (AliTimeRangeMasking<ULong64_t, UShort_t>*)AliOADBObjectCache::GetObject(fileName, "TimeRangeMasking", run, "", passName);
 
 }
 
@@ -93,10 +91,8 @@ UShort_t AliTimeRangeCut::GetMask(const AliVEvent* event) const
 //______________________________________________________________________________
 UShort_t AliTimeRangeCut::GetMask(const ULong64_t gid) const
 {
-  AliTimeRangeMask<ULong64_t, UShort_t>* range = fTimeRangeMasking->FindTimeRangeMask(gid);
-
-  if (!range) return 0;
-  return range->GetMaskReasons();
+  if (!fTimeRangeMasking) return 0;
+  return fTimeRangeMasking->GetMaskReasons(gid);
 }
 
 //______________________________________________________________________________
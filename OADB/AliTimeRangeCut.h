@@ -31,10 +31,13 @@ class AliVEvent;
 ///     or in case the time range has been masked for different reasons, but one is only interested in a specific reason
 ///     `const Bool_t cutThisEvent = fTimeRangeCut.CutEvent(InputEvent(), bitmask);`
 ///     for the bit definitions see [AliTimeRangeMask](@ref AliTimeRangeMask)
+///
+/// The masking object of a run is loaded once per process and shared by all the instances,
+/// the lookup of the global id is a binary search in its index of merged ranges.
 class AliTimeRangeCut : public TObject {
   public:
     AliTimeRangeCut() : fOADBPath(), fTimeRangeMasking(0x0), fLastRun(-1) {}
-    ~AliTimeRangeCut() { delete fTimeRangeMasking; }
+    ~AliTimeRangeCut() {}
 
     void InitFromEvent(const AliVEvent* event); 
     void InitFromRunNumber(const Int_t run);
@@ -54,7 +57,7 @@ class AliTimeRangeCut : public TObject {
     AliTimeRangeCut& operator= (const AliTimeRangeCut&);
 
     TString fOADBPath; ///< OADB path
-    AliTimeRangeMasking<ULong64_t, UShort_t>* fTimeRangeMasking; //!< Time Range masksking object
+    const AliTimeRangeMasking<ULong64_t, UShort_t>* fTimeRangeMasking; //!< Time Range masksking object, owned by the AliOADBObjectCache
     Int_t fLastRun; //!< last set run number
 
     ClassDef(AliTimeRangeCut, 1)
@@ -13,7 +13,9 @@
  * provided "as is" without express or implied warranty.                  *
  **************************************************************************/
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 
 #include "AliLog.h"
 
@@ -88,7 +90,11 @@ templateClassImp(AliTimeRangeMasking)
 template<typename time_type, typename bitmap_type>
 AliTimeRangeMasking<time_type, bitmap_type>::AliTimeRangeMasking()
   : TObject(),
-    fArrTimeRanges("AliTimeRangeMask<ULong64_t, UShort_t>", 10)
+    fArrTimeRanges("AliTimeRangeMask<ULong64_t, UShort_t>", 10),
+    fIndexStart(),
+    fIndexEnd(),
+    fIndexReasons(),
+    fIndexBuilt(kFALSE)
 {
 }
 
@@ -110,6 +116,7 @@ AliTimeRangeMask<time_type, bitmap_type>* AliTimeRangeMasking<time_type, bitmap_
     return nullptr;
   }
 
+  fIndexBuilt = kFALSE;
   return new(fArrTimeRanges[fArrTimeRanges.GetEntriesFast()]) AliTimeRangeMask<time_type, bitmap_type>(start, end, reasons);
 }
 
@@ -123,6 +130,59 @@ AliTimeRangeMask<time_type, bitmap_type>* AliTimeRangeMasking<time_type, bitmap_
   return nullptr;
 }
 
+template<typename time_type, typename bitmap_type>
+void AliTimeRangeMasking<time_type, bitmap_type>::BuildIndex() const
+{
+  // split the masks at all their boundaries into elementary ranges,
+  // merge the reasons of the masks overlapping in each of them and
+  // join the neighbouring ranges with the same reasons
+  fIndexStart.clear();
+  fIndexEnd.clear();
+  fIndexReasons.clear();
+
+  const time_type maxTime = std::numeric_limits<time_type>::max();
+  const Int_t nRanges = fArrTimeRanges.GetEntriesFast();
+  std::vector<time_type> bounds;
+  for (Int_t iRange = 0; iRange < nRanges; ++iRange) {
+    const auto range = (AliTimeRangeMask<time_type, bitmap_type>*)fArrTimeRanges.UncheckedAt(iRange);
+    bounds.push_back(range->GetStart());
+    if (range->GetEnd() < maxTime) bounds.push_back(range->GetEnd() + 1);
+  }
+  std::sort(bounds.begin(), bounds.end());
+  bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+  for (size_t iBound = 0; iBound < bounds.size(); ++iBound) {
+    const time_type first = bounds[iBound];
+    const time_type last  = (iBound + 1 < bounds.size()) ? bounds[iBound + 1] - 1 : maxTime;
+    bitmap_type reasons = 0;
+    for (Int_t iRange = 0; iRange < nRanges; ++iRange) {
+      const auto range = (AliTimeRangeMask<time_type, bitmap_type>*)fArrTimeRanges.UncheckedAt(iRange);
+      if (range->GetStart() <= first && range->GetEnd() >= first) reasons |= range->GetMaskReasons();
+    }
+    if (!reasons) continue;
+    if (!fIndexEnd.empty() && fIndexReasons.back() == reasons && fIndexEnd.back() + 1 == first) {
+      fIndexEnd.back() = last;
+      continue;
+    }
+    fIndexStart.push_back(first);
+    fIndexEnd.push_back(last);
+    fIndexReasons.push_back(reasons);
+  }
+
+  fIndexBuilt = kTRUE;
+}
+
+template<typename time_type, typename bitmap_type>
+bitmap_type AliTimeRangeMasking<time_type, bitmap_type>::GetMaskReasons(time_type time) const
+{
+  if (!fIndexBuilt) BuildIndex();
+
+  const auto next = std::upper_bound(fIndexStart.begin(), fIndexStart.end(), time);
+  if (next == fIndexStart.begin()) return 0;
+  const size_t index = (next - fIndexStart.begin()) - 1;
+  return (time <= fIndexEnd[index]) ? fIndexReasons[index] : 0;
+}
+
 template<typename time_type, typename bitmap_type>
 void AliTimeRangeMasking<time_type, bitmap_type>::Print(Option_t* option) const
 {
@@ -82,12 +82,22 @@ class AliTimeRangeMasking : public TObject {
 
     AliTimeRangeMask<time_type, bitmap_type>* FindTimeRangeMask(time_type time) const;
 
+    /// OR of the reasons of all the masks containing time, binary search in the index built on the first call
+    bitmap_type GetMaskReasons(time_type time) const;
+
     virtual void Print(Option_t* option = "") const;
 
   private:
+    void BuildIndex() const;
+
     TClonesArray fArrTimeRanges;
 
-    ClassDef(AliTimeRangeMasking, 1);
+    mutable std::vector<time_type>   fIndexStart;   //!< start of the sorted, disjoint ranges of the index
+    mutable std::vector<time_type>   fIndexEnd;     //!< end of the sorted, disjoint ranges of the index
+    mutable std::vector<bitmap_type> fIndexReasons; //!< merged reasons of the ranges of the index
+    mutable Bool_t                   fIndexBuilt;   //!< if the index is up to date
+
+    ClassDef(AliTimeRangeMasking, 2);
 };
 
 #endif
@@ -22,6 +22,7 @@
 // Current support and development: Evgeny Kryshen, PNPI
 //-------------------------------------------------------------------------
 
+#include <cstring>
 #include <TObjString.h>
 #include "TF1.h"
 #include "TH1F.h"
@@ -48,6 +49,7 @@
 #include "AliVCaloTrigger.h"
 #include "AliAODTZERO.h"
 #include "AliAODEvent.h"
+#include "AliAnalysisManager.h"
 ClassImp(AliTriggerAnalysis)
 
 AliTriggerAnalysis::AliTriggerAnalysis(TString name) :
@@ -113,7 +115,13 @@ fHistFMDSum(0),
 fHistT0(0),
 fHistOFOvsTKLAcc(0),
 fHistV0MOnVsOfAcc(0),
-fTriggerClasses(new TMap)
+fTriggerClasses(new TMap),
+fCacheDecisions(kTRUE),
+fCacheEvent(0),
+fCacheEntry(-1),
+fCacheRun(-1),
+fCacheOrbit(0),
+fCacheBC(0)
 {
   // constructor
   fHistList->SetName("histos");
@@ -131,6 +139,7 @@ void AliTriggerAnalysis::SetParameters(AliOADBTriggerAnalysis* oadb){
   fZDCCutZNATimeCorrMin = oadb->GetZDCCutZNATimeCorrMin();
   fZDCCutZNCTimeCorrMax = oadb->GetZDCCutZNCTimeCorrMax();
   fZDCCutZNCTimeCorrMin = oadb->GetZDCCutZNCTimeCorrMin();
+  ResetDecisionCache();
   fSPDClsVsTklA         = oadb->GetSPDClsVsTklA();
   fSPDClsVsTklB         = oadb->GetSPDClsVsTklB();
   fV0C012vsTklA         = oadb->GetV0C012vsTklA();
@@ -424,8 +433,60 @@ Bool_t AliTriggerAnalysis::IsTriggerBitFired(const AliVEvent* event, ULong64_t t
 }
 
 
+//-------------------------------------------------------------------------------------------------
+Bool_t AliTriggerAnalysis::UseDecisionCache(const AliVEvent* event){
+  // checks if the decision cache can be used for this event, clears it on a new event
+  // the cache is only used inside the analysis manager event loop, where the
+  // current entry identifies the event also if the event object is reused
+  if (!fCacheDecisions || fSPDGFOEfficiency || !event) return kFALSE;
+  AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+  if (!mgr) return kFALSE;
+  Long64_t entry = mgr->GetCurrentEntry();
+  Int_t run      = event->GetRunNumber();
+  UInt_t orbit   = event->GetOrbitNumber();
+  UShort_t bc    = event->GetBunchCrossNumber();
+  if (event==fCacheEvent && entry==fCacheEntry && run==fCacheRun && orbit==fCacheOrbit && bc==fCacheBC) return kTRUE;
+  fCacheEvent = event;
+  fCacheEntry = entry;
+  fCacheRun   = run;
+  fCacheOrbit = orbit;
+  fCacheBC    = bc;
+  memset(fCacheDone, 0, sizeof(fCacheDone));
+  return kTRUE;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+Bool_t AliTriggerAnalysis::GetCachedDecision(Int_t mode, UInt_t trigger, Int_t& value) const {
+  if (!(fCacheDone[mode][trigger/64] & (1ull << (trigger%64)))) return kFALSE;
+  value = fCacheValue[mode][trigger];
+  return kTRUE;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+void AliTriggerAnalysis::SetCachedDecision(Int_t mode, UInt_t trigger, Int_t value){
+  fCacheDone[mode][trigger/64] |= 1ull << (trigger%64);
+  fCacheValue[mode][trigger] = value;
+}
+
+
 //-------------------------------------------------------------------------------------------------
 Int_t AliTriggerAnalysis::EvaluateTrigger(const AliVEvent* event, Trigger trigger){
+  // evaluates a given trigger, repeated requests in the same event are served from the cache
+  UInt_t triggerNoFlags = (UInt_t) trigger % (UInt_t) kStartOfFlags;
+  Int_t mode = (trigger & kOfflineFlag) ? kCacheOffline : kCacheOnline;
+  if (!UseDecisionCache(event)) return EvaluateTriggerNoCache(event, trigger);
+  Int_t value = 0;
+  if (GetCachedDecision(mode, triggerNoFlags, value)) return value;
+  value = EvaluateTriggerNoCache(event, trigger);
+  SetCachedDecision(mode, triggerNoFlags, value);
+  return value;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+Int_t AliTriggerAnalysis::EvaluateTriggerNoCache(const AliVEvent* event, Trigger trigger){
   // evaluates a given trigger
   // trigger combinations are not supported, for that see IsOfflineTriggerFired
 
@@ -552,10 +613,23 @@ Int_t AliTriggerAnalysis::EvaluateTrigger(const AliVEvent* event, Trigger trigge
 
 //-------------------------------------------------------------------------------------------------
 Bool_t AliTriggerAnalysis::IsOfflineTriggerFired(const AliVEvent* event, Trigger trigger){
-  // checks if an event has been triggered "offline"
+  // checks if an event has been triggered "offline", repeated requests in the same event are served from the cache
   UInt_t triggerNoFlags = (UInt_t) trigger % (UInt_t) kStartOfFlags;
   if (trigger & kOneParticle) AliError("AliTriggerAnalysis::kOneParticle functionality is obsolete");
   if (trigger & kOneTrack)    AliError("AliTriggerAnalysis::kOneTrack functionality is obsolete");
+  if (!UseDecisionCache(event)) return IsOfflineTriggerFiredNoCache(event, trigger);
+  Int_t value = 0;
+  if (GetCachedDecision(kCacheOfflineFired, triggerNoFlags, value)) return value;
+  value = IsOfflineTriggerFiredNoCache(event, trigger);
+  SetCachedDecision(kCacheOfflineFired, triggerNoFlags, value);
+  return value;
+}
+
+
+//-------------------------------------------------------------------------------------------------
+Bool_t AliTriggerAnalysis::IsOfflineTriggerFiredNoCache(const AliVEvent* event, Trigger trigger){
+  // checks if an event has been triggered "offline"
+  UInt_t triggerNoFlags = (UInt_t) trigger % (UInt_t) kStartOfFlags;
 
   Bool_t decision = kFALSE;
   switch (triggerNoFlags) {
@@ -45,8 +45,10 @@ public:
   AliTriggerAnalysis(TString name="default");
   virtual ~AliTriggerAnalysis();
   void EnableHistograms(Bool_t isLowFlux = kFALSE);
-  void SetAnalyzeMC(Bool_t flag = kTRUE) { fMC = flag; }
-  void ApplyPileupCuts(Bool_t val = kTRUE) { fPileupCutsEnabled = val; }
+  void SetAnalyzeMC(Bool_t flag = kTRUE) { fMC = flag; ResetDecisionCache(); }
+  void ApplyPileupCuts(Bool_t val = kTRUE) { fPileupCutsEnabled = val; ResetDecisionCache(); }
+  void SetCacheDecisions(Bool_t flag = kTRUE) { fCacheDecisions = flag; ResetDecisionCache(); }
+  void ResetDecisionCache() { fCacheEvent = 0; }
   void SetParameters(AliOADBTriggerAnalysis* oadb);
   Bool_t IsTriggerFired(const AliVEvent* event, Trigger trigger);
   Int_t EvaluateTrigger(const AliVEvent* event, Trigger trigger);
@@ -86,8 +88,8 @@ public:
   void FillHistograms(const AliVEvent* event, Bool_t onlineDecision, Bool_t offlineDecision);
   void FillTriggerClasses(const AliVEvent* event);
   
-  void SetSPDGFOEfficiency(TH1F* hist) { fSPDGFOEfficiency = hist; }
-  void SetDoFMD(Bool_t flag = kTRUE) {fDoFMD = flag;}
+  void SetSPDGFOEfficiency(TH1F* hist) { fSPDGFOEfficiency = hist; ResetDecisionCache(); }
+  void SetDoFMD(Bool_t flag = kTRUE) {fDoFMD = flag; ResetDecisionCache(); }
   
   TObject* GetHistogram(const char* histName);
   TList* GetHistList() { return fHistList; }
@@ -98,6 +100,14 @@ public:
   void Browse(TBrowser *b);
 
 protected:
+  // per-event cache of the EvaluateTrigger and IsOfflineTriggerFired results
+  enum { kCacheOnline = 0, kCacheOffline, kCacheOfflineFired, kNCacheModes, kNCacheWords = kStartOfFlags/64 };
+  Int_t  EvaluateTriggerNoCache(const AliVEvent* event, Trigger trigger);
+  Bool_t IsOfflineTriggerFiredNoCache(const AliVEvent* event, Trigger trigger);
+  Bool_t UseDecisionCache(const AliVEvent* event);
+  Bool_t GetCachedDecision(Int_t mode, UInt_t trigger, Int_t& value) const;
+  void   SetCachedDecision(Int_t mode, UInt_t trigger, Int_t value);
+
   Int_t FMDHitCombinations(const AliESDEvent* aEsd, AliceSide side, Int_t fillHists = 0);
   
   TH1F* fSPDGFOEfficiency;   //! FO efficiency applied in SPDFiredChips. function of chip number (bin 1..400: first layer; 401..1200: second layer)
@@ -165,8 +175,17 @@ protected:
   TH2F* fHistV0MOnVsOfAcc;   //! V0M online vs V0M offline distribution for threshold efficiency studies
 
   TMap* fTriggerClasses;     // counts the active trigger classes (uses the full string)
+
+  Bool_t fCacheDecisions;                                   // serve repeated trigger requests of an event from the cache
+  const AliVEvent* fCacheEvent;                             //! event of the cached decisions
+  Long64_t  fCacheEntry;                                    //! analysis manager entry of the cached decisions
+  Int_t     fCacheRun;                                      //! run of the cached decisions
+  UInt_t    fCacheOrbit;                                    //! orbit of the cached decisions
+  UShort_t  fCacheBC;                                       //! bunch crossing of the cached decisions
+  ULong64_t fCacheDone[kNCacheModes][kNCacheWords];         //! bitmask of the cached decisions
+  Int_t     fCacheValue[kNCacheModes][kStartOfFlags];       //! cached decisions
   
-  ClassDef(AliTriggerAnalysis, 35)
+  ClassDef(AliTriggerAnalysis, 36)
 private:
   AliTriggerAnalysis(const AliTriggerAnalysis&);
   AliTriggerAnalysis& operator=(const AliTriggerAnalysis&);
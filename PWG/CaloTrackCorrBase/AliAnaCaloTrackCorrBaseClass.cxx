@@ -73,6 +73,7 @@ fInputAODBranch(0x0),         fInputAODName(""),
 fOutputAODBranch(0x0),        fNewAOD(kFALSE),
 fOutputAODName(""),           fOutputAODClassName(""),
 fAODObjArrayName(""),         fAddToHistogramsName(""),
+fConcurrentExecution(kFALSE), fDependencyBranches(""),
 fCaloPID(0x0),                fCaloUtils(0x0),
 fFidCut(0x0),                 fHisto(0x0),
 fIC(0x0),                                    
@@ -767,6 +768,9 @@ void AliAnaCaloTrackCorrBaseClass::InitParameters()
   fAddToHistogramsName = "";
   fAODObjArrayName     = "Ref";
   
+  fConcurrentExecution = kFALSE;
+  fDependencyBranches  = "";
+  
   fNCocktailGenNames = 7;
   // Order matters, here cocktail of MC LHC14a1a
   fCocktailGenNames[0] = ""; // First must be always empty
@@ -1492,6 +1496,31 @@ Bool_t AliAnaCaloTrackCorrBaseClass::IsTrackMatched(AliVCluster * cluster, AliVE
   return GetCaloPID()->IsTrackMatched(cluster, fCaloUtils, event, bEoP, bRes); 
 } 
 
+//__________________________________________________________________
+/// \return names of the AOD branches and other shared objects accessed
+/// by the analysis, separated by ";": the input branch, the output branch
+/// if a new one is created and those added with AddDependencyBranch().
+/// Used by the maker to decide which analysis can be executed concurrently.
+//__________________________________________________________________
+TString AliAnaCaloTrackCorrBaseClass::GetDependencyBranches() const
+{
+  TString branches = fInputAODName;
+  
+  if ( fNewAOD && fOutputAODName.Length() > 0 )
+  {
+    if ( branches.Length() > 0 ) branches += ";";
+    branches += fOutputAODName;
+  }
+  
+  if ( fDependencyBranches.Length() > 0 )
+  {
+    if ( branches.Length() > 0 ) branches += ";";
+    branches += fDependencyBranches;
+  }
+  
+  return branches;
+}
+
 //__________________________________________________________________
 /// Print some relevant parameters set for the analysis.
 //__________________________________________________________________
@@ -1506,6 +1535,7 @@ void AliAnaCaloTrackCorrBaseClass::Print(const Option_t * opt) const
   printf("Output AOD Class name: =  %s\n",      fOutputAODClassName.Data());
   printf("Name of reference array      : %s\n", fAODObjArrayName.Data());
   printf("String added histograms name : %s\n", fAddToHistogramsName.Data());
+  printf("Concurrent execution: =   %d, dependencies <%s>\n", fConcurrentExecution, GetDependencyBranches().Data());
 
   printf("pT/E range          = [%2.2f,%2.2f]\n", fMinPt,fMaxPt) ;
   printf("Pair time cut       = %2.2f",fPairTimeCut);
@@ -139,6 +139,17 @@ public:
   virtual TClonesArray * GetInputAODBranch()               const { return fInputAODBranch  ; }
   virtual TClonesArray * GetOutputAODBranch()              const { if(fNewAOD) return fOutputAODBranch; else return fInputAODBranch ; }
   virtual TClonesArray * GetAODBranch(TString & aodBranchName) const ;
+  
+  // Concurrent execution in the maker, only for analysis not modifying
+  // the reader, calorimeter utils or other shared helpers per event
+  
+  virtual Bool_t         IsConcurrentExecutionOn()         const { return fConcurrentExecution   ; }
+  virtual void           SwitchOnConcurrentExecution()           { fConcurrentExecution = kTRUE  ; }
+  virtual void           SwitchOffConcurrentExecution()          { fConcurrentExecution = kFALSE ; }
+  
+  virtual void           AddDependencyBranch(TString name)       { if(fDependencyBranches.Length() > 0) fDependencyBranches += ";" ;
+                                                                   fDependencyBranches += name   ; }
+  virtual TString        GetDependencyBranches()           const ;
 	
   // Track cluster arrays access methods
   
@@ -150,6 +161,11 @@ public:
   virtual TObjArray*     GetEMCALClusters()                const ;
   virtual TObjArray*     GetPHOSClusters()                 const ;
   
+  // Kinematics of the objects in the arrays above, filled if requested in the reader
+  const AliCaloTrackReader::KinematicsArrays & GetCTSKinematics()   const { return fReader->GetCTSKinematics()   ; }
+  const AliCaloTrackReader::KinematicsArrays & GetEMCALKinematics() const { return fReader->GetEMCALKinematics() ; }
+  const AliCaloTrackReader::KinematicsArrays & GetPHOSKinematics()  const { return fReader->GetPHOSKinematics()  ; }
+  
   // Jets
   
   virtual TClonesArray*  GetNonStandardJets()              const { return fReader->GetNonStandardJets() ;}
@@ -460,6 +476,8 @@ private:
   TString                    fOutputAODClassName;  ///<  Type of aod objects to be stored in the TClonesArray (AliCaloTrackParticle, AliCaloTrackParticleCorrelation ...).	
   TString                    fAODObjArrayName ;    ///<  Name of ref array kept in a TList in AliAODParticleCorrelation with clusters or track. references.
   TString                    fAddToHistogramsName; ///<  Add this string to histograms name.
+  Bool_t                     fConcurrentExecution; ///<  Analysis can be executed by the maker concurrently with others not sharing AOD branches.
+  TString                    fDependencyBranches ; ///<  Other branches or shared objects read or written, names separated by ";".
   
   // Analysis helper classes access pointers
   AliCaloPID               * fCaloPID;             ///< PID calculation utils.
@@ -483,7 +501,7 @@ private:
   AliAnaCaloTrackCorrBaseClass & operator = (const AliAnaCaloTrackCorrBaseClass & bc) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliAnaCaloTrackCorrBaseClass,33) ;
+  ClassDef(AliAnaCaloTrackCorrBaseClass,34) ;
   /// \endcond
 
 } ;
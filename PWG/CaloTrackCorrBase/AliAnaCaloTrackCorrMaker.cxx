@@ -14,9 +14,13 @@
  **************************************************************************/
 
 #include <cstdlib>
+#include <atomic>
+#include <thread>
 
 // --- ROOT system ---
+#include <TROOT.h>
 #include <TObjString.h>
+#include <TObjArray.h>
 #include <TClonesArray.h>
 #include <TList.h>
 #include <TH1F.h>
@@ -58,6 +62,7 @@ fScaleFactor(-1),
 fFillDataControlHisto(1),     fFillCentralityChecks(0),
 fSumw2(0),
 fCheckPtHard(0),
+fNThreads(1),                 fAnalysisWaves(),
 // Control histograms
 fhNEventsIn(0),               fhNEvents(0),                       fhNEvents0Tracks(0),
 fhNExoticEvents(0),           fhNEventsNoTriggerFound(0),
@@ -118,6 +123,8 @@ fFillDataControlHisto(maker.fFillDataControlHisto),
 fFillCentralityChecks(maker.fFillCentralityChecks),
 fSumw2(maker.fSumw2),
 fCheckPtHard(maker.fCheckPtHard),
+fNThreads(maker.fNThreads),
+fAnalysisWaves(),
 fhNEventsIn(maker.fhNEventsIn),
 fhNEvents(maker.fhNEvents),
 fhNEvents0Tracks(maker.fhNEvents0Tracks),
@@ -1173,6 +1180,7 @@ void AliAnaCaloTrackCorrMaker::Print(const Option_t * opt) const
   printf("Make sumw2                 =     %d\n", fSumw2   ) ;
   printf("Scale factor               =     %e\n", fScaleFactor  ) ;
   printf("Check pT hard              =     %d\n", fCheckPtHard   ) ;
+  printf("Number of threads          =     %d\n", fNThreads   ) ;
   printf("Number of analysis tasks   =     %d\n", fAnalysisContainer->GetEntries()) ;
     
   if(!strcmp("all",opt))
@@ -1193,6 +1201,85 @@ void AliAnaCaloTrackCorrMaker::Print(const Option_t * opt) const
   }
 }
 
+//_____________________________________________________________________________________
+/// Set the number of threads for the concurrent analysis execution.
+//_____________________________________________________________________________________
+void AliAnaCaloTrackCorrMaker::SetNThreads(Int_t n)
+{
+  fNThreads = TMath::Max(n,1);
+  
+  if ( fNThreads > 1 ) ROOT::EnableThreadSafety();
+  
+  fAnalysisWaves.clear();
+}
+
+//_____________________________________________________________________________________
+/// Group the analysis in waves executed one after the other. An analysis goes
+/// in the wave after the last one containing an earlier analysis it depends on,
+/// that is sharing one of the branches given by GetDependencyBranches(), or any earlier
+/// analysis if one of the two is not switched on for concurrent execution.
+/// The order of the analysis in a given AOD branch chain is thus preserved.
+//_____________________________________________________________________________________
+void AliAnaCaloTrackCorrMaker::BuildAnalysisSchedule()
+{
+  fAnalysisWaves.clear();
+  
+  Int_t nana = fAnalysisContainer->GetEntries() ;
+  
+  std::vector<Int_t> level(nana,0);
+  std::vector< std::vector<TString> > branches(nana);
+  
+  for(Int_t iana = 0; iana < nana; iana++)
+  {
+    AliAnaCaloTrackCorrBaseClass * ana = ((AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(iana)) ;
+    
+    TObjArray * names = ana->GetDependencyBranches().Tokenize(";");
+    for(Int_t iname = 0; iname < names->GetEntriesFast(); iname++)
+      branches[iana].push_back(((TObjString*) names->At(iname))->GetString());
+    delete names;
+    
+    for(Int_t jana = 0; jana < iana; jana++)
+    {
+      AliAnaCaloTrackCorrBaseClass * prev = ((AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(jana)) ;
+      
+      Bool_t depends = !ana->IsConcurrentExecutionOn() || !prev->IsConcurrentExecutionOn();
+      for(UInt_t i = 0; i < branches[iana].size() && !depends; i++)
+      {
+        for(UInt_t j = 0; j < branches[jana].size() && !depends; j++)
+          if ( branches[iana][i] == branches[jana][j] ) depends = kTRUE;
+      }
+      
+      if ( depends && level[jana] + 1 > level[iana] ) level[iana] = level[jana] + 1;
+    }
+    
+    if ( level[iana] >= (Int_t) fAnalysisWaves.size() ) fAnalysisWaves.resize(level[iana]+1);
+    fAnalysisWaves[level[iana]].push_back(iana);
+    
+    AliDebug(1,Form("Analysis %d <%s> in execution wave %d",iana,ana->GetName(),level[iana]));
+  }
+}
+
+//_____________________________________________________________________________________
+/// Execute for this event the analysis at position iana in the list.
+//_____________________________________________________________________________________
+void AliAnaCaloTrackCorrMaker::ProcessAnalysis(Int_t iana, UInt_t isMBTrigger, UInt_t isTrigger)
+{
+  AliAnaCaloTrackCorrBaseClass * ana = ((AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(iana)) ;
+  
+  //Fill pool for mixed event for the analysis that need it
+  if(!fReader->IsEventTriggerAtSEOn() && isMBTrigger)
+  {
+    ana->FillEventMixPool();
+    if(!isTrigger) return; // pool filled do not try to fill AODs or histograms if trigger is not MB
+  }
+  
+  //Make analysis, create aods in aod branch and in some cases fill histograms
+  if(fMakeAOD  )  ana->MakeAnalysisFillAOD()  ;
+  
+  //Make further analysis with aod branch and fill histograms
+  if(fMakeHisto)  ana->MakeAnalysisFillHistograms()  ;
+}
+
 //_____________________________________________________________________________________
 /// Main method, analysis are executed here:
 /// * 1) Clean-up arrays and stuff, access OADB (once), geometry (once), etc.
@@ -1279,25 +1366,49 @@ void AliAnaCaloTrackCorrMaker::ProcessEvent(Int_t iEntry, const char * currentFi
   AliDebug(1,"*** Begin analysis ***");
   
   Int_t nana = fAnalysisContainer->GetEntries() ;
-  for(Int_t iana = 0; iana <  nana; iana++)
+  
+  if ( fNThreads <= 1 )
   {
-    AliAnaCaloTrackCorrBaseClass * ana = ((AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(iana)) ;
-    
-    ana->ConnectInputOutputAODBranches(); // Sets branches for each analysis
-    
-    //Fill pool for mixed event for the analysis that need it
-    if(!fReader->IsEventTriggerAtSEOn() && isMBTrigger)
+    for(Int_t iana = 0; iana <  nana; iana++)
     {
-      ana->FillEventMixPool();
-      if(!isTrigger) continue; // pool filled do not try to fill AODs or histograms if trigger is not MB
+      ((AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(iana))->ConnectInputOutputAODBranches(); // Sets branches for each analysis
+      
+      ProcessAnalysis(iana, isMBTrigger, isTrigger);
     }
+  }
+  else
+  {
+    if ( fAnalysisWaves.empty() ) BuildAnalysisSchedule();
     
-    //Make analysis, create aods in aod branch and in some cases fill histograms
-    if(fMakeAOD  )  ana->MakeAnalysisFillAOD()  ;
-    
-    //Make further analysis with aod branch and fill histograms
-    if(fMakeHisto)  ana->MakeAnalysisFillHistograms()  ;
+    // Branches set for all analysis before any is executed
+    for(Int_t iana = 0; iana <  nana; iana++)
+      ((AliAnaCaloTrackCorrBaseClass *) fAnalysisContainer->At(iana))->ConnectInputOutputAODBranches();
     
+    for(UInt_t iwave = 0; iwave < fAnalysisWaves.size(); iwave++)
+    {
+      const std::vector<Int_t> & wave = fAnalysisWaves[iwave];
+      Int_t nInWave  = wave.size();
+      Int_t nThreads = TMath::Min(fNThreads, nInWave);
+      
+      if ( nThreads <= 1 )
+      {
+        for(Int_t i = 0; i < nInWave; i++) ProcessAnalysis(wave[i], isMBTrigger, isTrigger);
+        continue;
+      }
+      
+      // Each analysis fills only its own histograms and output branch
+      std::atomic<Int_t> next(0);
+      auto work = [&]()
+      {
+        for(Int_t i = next++; i < nInWave; i = next++)
+          ProcessAnalysis(wave[i], isMBTrigger, isTrigger);
+      };
+      
+      std::vector<std::thread> threads;
+      for(Int_t ithr = 1; ithr < nThreads; ithr++) threads.push_back(std::thread(work));
+      work();
+      for(UInt_t ithr = 0; ithr < threads.size(); ithr++) threads[ithr].join();
+    }
   }
 	
   fReader->ResetLists();
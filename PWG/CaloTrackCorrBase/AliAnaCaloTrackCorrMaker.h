@@ -28,6 +28,9 @@ class TClonesArray;
 #include<TObject.h>
 class TH1F;
 
+// --- Standard library ---
+#include <vector>
+
 // --- Analysis system ---
 #include "AliCaloTrackReader.h" 
 #include "AliCalorimeterUtils.h"
@@ -87,6 +90,11 @@ class AliAnaCaloTrackCorrMaker : public TObject {
 
   void    SetScaleFactor(Double_t scale)   { fScaleFactor = scale  ; } 
 
+  /// Number of threads to execute concurrently the analysis switched on with
+  /// SwitchOnConcurrentExecution() and not sharing AOD branches, 1 is sequential.
+  void    SetNThreads(Int_t n) ;
+  Int_t   GetNThreads()              const { return fNThreads      ; }
+
   void    SetCaloUtils(AliCalorimeterUtils * cu) { fCaloUtils = cu ; }
   void    SetReader(AliCaloTrackReader * re)     { fReader = re    ; }
   
@@ -110,6 +118,10 @@ class AliAnaCaloTrackCorrMaker : public TObject {
   
  private:
   
+  void    BuildAnalysisSchedule();
+  
+  void    ProcessAnalysis(Int_t iana, UInt_t isMBTrigger, UInt_t isTrigger);
+  
   // General Data members
   
   AliCaloTrackReader  *  fReader ;                   ///<  Pointer to AliCaloTrackReader.
@@ -139,6 +151,10 @@ class AliAnaCaloTrackCorrMaker : public TObject {
   Bool_t   fSumw2 ;                                  ///<  Call the histograms method Sumw2() after initialization, off by default, too large memory booking, use carefully
     
   Bool_t   fCheckPtHard ;                            ///< For MC done in pT-Hard bins, plot specific histogram
+  
+  Int_t    fNThreads ;                               ///<  Number of threads for the concurrent analysis execution.
+  
+  std::vector< std::vector<Int_t> > fAnalysisWaves;  //!<! Analysis indices per execution wave, analysis in the same wave are independent.
     
   // Control histograms
   
@@ -221,7 +237,7 @@ class AliAnaCaloTrackCorrMaker : public TObject {
   AliAnaCaloTrackCorrMaker & operator = (const AliAnaCaloTrackCorrMaker & ) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliAnaCaloTrackCorrMaker,27) ;
+  ClassDef(AliAnaCaloTrackCorrMaker,28) ;
   /// \endcond
 
 } ;
@@ -172,7 +172,11 @@ fInputBackgroundJetBranchName("jets"),
 fAcceptEventsWithBit(0),     fRejectEventsWithBit(0),         
 fRejectEMCalTriggerEventsL1HighWithL1Low(0),
 fRemoveCentralityTriggerOutliers(0),
-fMomentum(),                 fParRun(kFALSE),                 fCurrentParIndex(0),
+fMomentum(),
+fFillKinematicsArrays(kFALSE),
+fCTSKinematics(),            fEMCALKinematics(),
+fDCALKinematics(),           fPHOSKinematics(),
+fParRun(kFALSE),                 fCurrentParIndex(0),
 fOutputContainer(0x0),       fhEMCALClusterEtaPhi(0),         fhEMCALClusterEtaPhiFidCut(0),     
 fhEMCALClusterDisToBadE(0),  fhEMCALClusterTimeE(0),      
 fhEMCALClusterBadTrigger(0), fhCentralityBadTrigger(0),       fhEMCALClusterCentralityBadTrigger(0),
@@ -2944,6 +2948,8 @@ void AliCaloTrackReader::FillInputCTSSelectTrack(AliVTrack * track, Int_t itrack
   
   fCTSTracks->Add(track);
   
+  if ( fFillKinematicsArrays ) fCTSKinematics.Add(fMomentum, fMomentum.P(), tof, 0, 0.);
+  
   // TODO, check if remove
   if ( fMixedEvent )  track->SetID(itrack);
 }
@@ -3430,6 +3436,12 @@ void AliCaloTrackReader::FillInputEMCALSelectCluster(AliVCluster * clus, Int_t i
   if      ( bEMCAL ) fEMCALClusters->Add(clus);
   else if ( bDCAL  ) fDCALClusters ->Add(clus);
   
+  if ( fFillKinematicsArrays )
+  {
+    if      ( bEMCAL ) fEMCALKinematics.Add(fMomentum, clus->E(), tof, clus->GetNCells(), clus->GetM02());
+    else if ( bDCAL  ) fDCALKinematics .Add(fMomentum, clus->E(), tof, clus->GetNCells(), clus->GetM02());
+  }
+  
   // TODO, not sure if needed anymore
   if (fMixedEvent)
     clus->SetID(iclus) ;
@@ -3703,6 +3715,9 @@ void AliCaloTrackReader::FillInputPHOS()
                     fMomentum.E(),fMomentum.Pt(),RadToDeg(GetPhi(fMomentum.Phi())),fMomentum.Eta()));
     
     fPHOSClusters->Add(clus);
+    
+    if ( fFillKinematicsArrays ) 
+      fPHOSKinematics.Add(fMomentum, clus->E(), clus->GetTOF()*1e9, clus->GetNCells(), clus->GetM02());
 
     // TODO Dead code? remove?
     if (fMixedEvent)
@@ -4734,6 +4749,11 @@ void AliCaloTrackReader::ResetLists()
   if(fEMCALClusters)   fEMCALClusters -> Clear("C");
   if(fPHOSClusters)    fPHOSClusters  -> Clear("C");
   
+  fCTSKinematics  .Clear();
+  fEMCALKinematics.Clear();
+  fDCALKinematics .Clear();
+  fPHOSKinematics .Clear();
+  
   fV0ADC[0] = 0;   fV0ADC[1] = 0;
   fV0Mul[0] = 0;   fV0Mul[1] = 0;
   
@@ -31,6 +31,9 @@ class TTree ;
 class TArrayI ;
 class TObjString;
 #include <TRandom3.h>
+#include <TLorentzVector.h>
+#include <TMath.h>
+#include <vector>
 
 //--- ANALYSIS system ---
 #include "AliVEvent.h"
@@ -62,6 +65,31 @@ class AliCaloTrackReader : public TObject {
 
 public: 
   
+  /// \struct KinematicsArrays
+  /// \brief Kinematics of the selected tracks or clusters, same order as the corresponding TObjArray.
+  /// Filled by the reader when *SwitchOnKinematicsArrays()*, avoids recalculating
+  /// the momentum of each object in every analysis. Phi in [0,2pi[, time in ns.
+  struct KinematicsArrays
+  {
+    std::vector<Float_t> fE;
+    std::vector<Float_t> fPt;
+    std::vector<Float_t> fEta;
+    std::vector<Float_t> fPhi;
+    std::vector<Float_t> fTime;
+    std::vector<Int_t>   fNCells;
+    std::vector<Float_t> fM02;
+    
+    void  Clear() { fE.clear(); fPt.clear(); fEta.clear(); fPhi.clear(); 
+                    fTime.clear(); fNCells.clear(); fM02.clear() ; }
+    Int_t GetSize()                                  const { return fPt.size() ; }
+    void  Add(const TLorentzVector & mom, Float_t e, Float_t time, Int_t nCells, Float_t m02)
+    { 
+      Float_t phi = mom.Phi(); if ( phi < 0 ) phi += TMath::TwoPi();
+      fE.push_back(e); fPt.push_back(mom.Pt()); fEta.push_back(mom.Eta()); fPhi.push_back(phi);
+      fTime.push_back(time); fNCells.push_back(nCells); fM02.push_back(m02);
+    }
+  };
+  
                   AliCaloTrackReader() ; // ctor
   virtual        ~AliCaloTrackReader() ; // virtual dtor
   void            DeletePointers();
@@ -349,6 +377,16 @@ public:
   virtual TObjArray*     GetDCALClusters()           const { return fDCALClusters           ; }
   virtual TObjArray*     GetPHOSClusters()           const { return fPHOSClusters           ; }
   virtual AliVCaloCells* GetEMCALCells()             const { return fEMCALCells             ; }
+  
+  void             SwitchOnKinematicsArrays()              { fFillKinematicsArrays = kTRUE  ; }
+  void             SwitchOffKinematicsArrays()             { fFillKinematicsArrays = kFALSE ; }
+  Bool_t           IsKinematicsArraysFilled()        const { return fFillKinematicsArrays   ; }
+  
+  /// \return kinematics of the objects in GetCTSTracks(), empty if not filled.
+  const KinematicsArrays & GetCTSKinematics()        const { return fCTSKinematics          ; }
+  const KinematicsArrays & GetEMCALKinematics()      const { return fEMCALKinematics        ; }
+  const KinematicsArrays & GetDCALKinematics()       const { return fDCALKinematics         ; }
+  const KinematicsArrays & GetPHOSKinematics()       const { return fPHOSKinematics         ; }
   virtual AliVCaloCells* GetPHOSCells()              const { return fPHOSCells              ; }
   
   //-------------------------------------
@@ -1236,6 +1274,12 @@ public:
   
   TLorentzVector   fMomentum;                      //!<! Temporal TLorentzVector container, avoid declaration of TLorentzVectors per event.
 
+  Bool_t           fFillKinematicsArrays;          ///<  Fill the kinematics arrays of the selected tracks and clusters.
+  KinematicsArrays fCTSKinematics;                 //!<! Kinematics of the tracks in fCTSTracks.
+  KinematicsArrays fEMCALKinematics;               //!<! Kinematics of the clusters in fEMCALClusters.
+  KinematicsArrays fDCALKinematics;                //!<! Kinematics of the clusters in fDCALClusters.
+  KinematicsArrays fPHOSKinematics;                //!<! Kinematics of the clusters in fPHOSClusters.
+
   // Handle runs affected by PAR
   Bool_t           fParRun;                        ///<  Flag set true when run affected by PAR
   Short_t          fCurrentParIndex;               //!<! temporal PAR number based on event global to get L1 phase correction in PAR runs
@@ -1301,7 +1345,7 @@ public:
   AliCaloTrackReader & operator = (const AliCaloTrackReader & r) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliCaloTrackReader,97) ;
+  ClassDef(AliCaloTrackReader,98) ;
   /// \endcond
 
 } ;
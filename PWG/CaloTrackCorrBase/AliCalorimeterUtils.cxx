@@ -478,6 +478,9 @@ void AliCalorimeterUtils::AccessOADB(AliVEvent* event)
       delete contTRF;
     }//End of Time L1 phase racalibration 
     
+    // Gather the calibration maps of this run per cell, for the cell loops of AliEMCALRecoUtils
+    fEMCALRecoUtils->FillFlatCellCalibration();
+    
   }// EMCAL
   
   // PHOS
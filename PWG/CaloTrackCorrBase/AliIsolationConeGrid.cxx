@@ -0,0 +1,413 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// --- ROOT system ---
+#include <TMath.h>
+
+// --- AliRoot system ---
+#include "AliIsolationConeGrid.h"
+
+/// \cond CLASSIMP
+ClassImp(AliIsolationConeGrid) ;
+/// \endcond
+
+namespace
+{
+  /// Cells closer than this to the region border are checked particle by particle.
+  const Double_t kBorderTolerance = 1.e-5;
+}
+
+//____________________________________________
+/// Default constructor, |eta| < 1, 0.1 x 0.1 cells.
+//____________________________________________
+AliIsolationConeGrid::AliIsolationConeGrid() :
+TObject(),
+fEtaMin(0), fEtaMax(0), fNEtaBins(0), fNPhiBins(0),
+fEtaStep(0), fPhiStep(0),
+fBuilt(kFALSE),
+fEta(), fPhi(), fPt(),
+fCellFirst(), fSortedIndex(),
+fSortedEta(), fSortedPhi(), fSortedPt(),
+fRowCumPt(), fRowCumN(),
+fRowEtaLow(), fRowEtaHigh()
+{
+  SetBinning(-1., 1., 20, 63);
+}
+
+//____________________________________________
+/// Constructor with the grid binning.
+//____________________________________________
+AliIsolationConeGrid::AliIsolationConeGrid(Float_t etaMin, Float_t etaMax, Int_t nEtaBins, Int_t nPhiBins) :
+TObject(),
+fEtaMin(0), fEtaMax(0), fNEtaBins(0), fNPhiBins(0),
+fEtaStep(0), fPhiStep(0),
+fBuilt(kFALSE),
+fEta(), fPhi(), fPt(),
+fCellFirst(), fSortedIndex(),
+fSortedEta(), fSortedPhi(), fSortedPt(),
+fRowCumPt(), fRowCumN(),
+fRowEtaLow(), fRowEtaHigh()
+{
+  SetBinning(etaMin, etaMax, nEtaBins, nPhiBins);
+}
+
+//____________________________________________
+/// Set the eta range and the number of cells,
+/// the particles already added are kept.
+//____________________________________________
+void AliIsolationConeGrid::SetBinning(Float_t etaMin, Float_t etaMax, Int_t nEtaBins, Int_t nPhiBins)
+{
+  fNEtaBins = TMath::Max(nEtaBins, 1);
+  fNPhiBins = TMath::Max(nPhiBins, 1);
+  fEtaMin   = etaMin;
+  fEtaMax   = etaMax > etaMin ? etaMax : etaMin + 1.;
+  fEtaStep  = (fEtaMax - fEtaMin) / fNEtaBins;
+  fPhiStep  = TMath::TwoPi() / fNPhiBins;
+  fBuilt    = kFALSE;
+}
+
+//____________________________________________
+/// Remove all the particles, to be called at the
+/// beginning of each event.
+//____________________________________________
+void AliIsolationConeGrid::Reset()
+{
+  fEta.clear();
+  fPhi.clear();
+  fPt .clear();
+  fBuilt = kFALSE;
+}
+
+//____________________________________________
+/// Add one particle, *Build()* must be called
+/// before any query.
+//____________________________________________
+void AliIsolationConeGrid::Add(Float_t eta, Float_t phi, Float_t pt)
+{
+  Double_t phiNorm = phi - TMath::TwoPi()*TMath::Floor(phi/TMath::TwoPi());
+  if ( phiNorm >= TMath::TwoPi() ) phiNorm = 0;
+
+  fEta.push_back(eta);
+  fPhi.push_back(phiNorm);
+  fPt .push_back(pt);
+  fBuilt = kFALSE;
+}
+
+//____________________________________________
+/// Eta row of the grid, particles out of the
+/// eta range go to the first or last row.
+//____________________________________________
+Int_t AliIsolationConeGrid::GetEtaRow(Double_t eta) const
+{
+  Double_t x = (eta - fEtaMin) / fEtaStep;
+  if ( x <  0         ) return 0;
+  if ( x >= fNEtaBins ) return fNEtaBins-1;
+  return (Int_t) x;
+}
+
+//____________________________________________
+/// Sort the particles by cell and fill the
+/// cumulative sums of each eta row.
+//____________________________________________
+void AliIsolationConeGrid::Build()
+{
+  Int_t nCells = fNEtaBins*fNPhiBins;
+  Int_t nPart  = fEta.size();
+
+  fCellFirst.assign(nCells+1, 0);
+  fRowCumPt .assign(fNEtaBins*(fNPhiBins+1), 0.);
+  fRowCumN  .assign(fNEtaBins*(fNPhiBins+1), 0 );
+  fRowEtaLow .resize(fNEtaBins);
+  fRowEtaHigh.resize(fNEtaBins);
+  for(Int_t irow = 0; irow < fNEtaBins; irow++)
+  {
+    fRowEtaLow [irow] = fEtaMin +  irow   *fEtaStep;
+    fRowEtaHigh[irow] = fEtaMin + (irow+1)*fEtaStep;
+  }
+
+  // Count per cell
+  std::vector<Int_t> cell(nPart);
+  for(Int_t ip = 0; ip < nPart; ip++)
+  {
+    Int_t irow = GetEtaRow(fEta[ip]);
+    Int_t iphi = TMath::Min((Int_t) (fPhi[ip] / fPhiStep), fNPhiBins-1);
+    cell[ip] = irow*fNPhiBins + iphi;
+    fCellFirst[cell[ip]+1]++;
+
+    if ( fEta[ip] < fRowEtaLow [irow] ) fRowEtaLow [irow] = fEta[ip];
+    if ( fEta[ip] > fRowEtaHigh[irow] ) fRowEtaHigh[irow] = fEta[ip];
+
+    Int_t icum = irow*(fNPhiBins+1) + iphi + 1;
+    fRowCumPt[icum] += fPt[ip];
+    fRowCumN [icum] ++;
+  }
+
+  for(Int_t icell = 0; icell < nCells; icell++)
+    fCellFirst[icell+1] += fCellFirst[icell];
+
+  for(Int_t irow = 0; irow < fNEtaBins; irow++)
+  {
+    Int_t offset = irow*(fNPhiBins+1);
+    for(Int_t iphi = 1; iphi <= fNPhiBins; iphi++)
+    {
+      fRowCumPt[offset+iphi] += fRowCumPt[offset+iphi-1];
+      fRowCumN [offset+iphi] += fRowCumN [offset+iphi-1];
+    }
+  }
+
+  // Sort by cell, keep the adding order inside the cell
+  fSortedIndex.resize(nPart);
+  fSortedEta  .resize(nPart);
+  fSortedPhi  .resize(nPart);
+  fSortedPt   .resize(nPart);
+  std::vector<Int_t> next(fCellFirst.begin(), fCellFirst.end()-1);
+  for(Int_t ip = 0; ip < nPart; ip++)
+  {
+    Int_t k = next[cell[ip]]++;
+    fSortedIndex[k] = ip;
+    fSortedEta  [k] = fEta[ip];
+    fSortedPhi  [k] = fPhi[ip];
+    fSortedPt   [k] = fPt [ip];
+  }
+
+  fBuilt = kTRUE;
+}
+
+//____________________________________________
+/// \return true if the particle is in the region.
+//____________________________________________
+Bool_t AliIsolationConeGrid::IsInside(const Region & reg, Float_t eta, Float_t phi) const
+{
+  Double_t dPhi = phi - reg.fPhi;
+  dPhi -= TMath::TwoPi()*TMath::Nint(dPhi/TMath::TwoPi());
+
+  if ( reg.fCone )
+  {
+    Double_t dEta = eta - reg.fEta;
+    return ( dEta*dEta + dPhi*dPhi <= reg.fR*reg.fR );
+  }
+
+  return ( eta >= reg.fEtaLow && eta <= reg.fEtaHigh && TMath::Abs(dPhi) <= reg.fHalfPhi );
+}
+
+//____________________________________________
+/// Add the particles of one eta row within wOut in phi of
+/// the region center. The cells within wIn are fully contained
+/// and taken from the cumulative sums when only the sums are requested.
+//____________________________________________
+void AliIsolationConeGrid::AccumulateRow(const Region & reg, Int_t row, Double_t wOut, Double_t wIn,
+                                         Double_t & sum, Int_t & n, std::vector<Int_t> * indices) const
+{
+  Int_t binOutLow  = (Int_t) TMath::Floor((reg.fPhi - wOut) / fPhiStep);
+  Int_t binOutHigh = (Int_t) TMath::Floor((reg.fPhi + wOut) / fPhiStep);
+  if ( binOutHigh - binOutLow + 1 > fNPhiBins )
+  {
+    binOutLow  = 0;
+    binOutHigh = fNPhiBins-1;
+  }
+
+  Int_t binInLow = 0;
+  Int_t nBinsIn  = 0;
+  if ( wIn >= TMath::Pi() )
+  {
+    nBinsIn = fNPhiBins;
+  }
+  else if ( wIn > 0 )
+  {
+    binInLow = (Int_t) TMath::Ceil ((reg.fPhi - wIn) / fPhiStep);
+    nBinsIn  = (Int_t) TMath::Floor((reg.fPhi + wIn) / fPhiStep) - binInLow;
+  }
+
+  Int_t offset = row*(fNPhiBins+1);
+  if ( nBinsIn > 0 && !indices )
+  {
+    Int_t first = ModPhiBin(binInLow);
+    Int_t last  = first + nBinsIn;
+    if ( last <= fNPhiBins )
+    {
+      sum += fRowCumPt[offset+last] - fRowCumPt[offset+first];
+      n   += fRowCumN [offset+last] - fRowCumN [offset+first];
+    }
+    else
+    {
+      sum += fRowCumPt[offset+fNPhiBins] - fRowCumPt[offset+first] + fRowCumPt[offset+last-fNPhiBins];
+      n   += fRowCumN [offset+fNPhiBins] - fRowCumN [offset+first] + fRowCumN [offset+last-fNPhiBins];
+    }
+  }
+
+  for(Int_t bin = binOutLow; bin <= binOutHigh; bin++)
+  {
+    Int_t  iphi   = ModPhiBin(bin);
+    Bool_t inside = ( nBinsIn > 0 && ModPhiBin(iphi - binInLow) < nBinsIn );
+
+    if ( inside && !indices ) continue;
+
+    Int_t icell = row*fNPhiBins + iphi;
+    for(Int_t k = fCellFirst[icell]; k < fCellFirst[icell+1]; k++)
+    {
+      if ( !inside && !IsInside(reg, fSortedEta[k], fSortedPhi[k]) ) continue;
+
+      if ( indices ) indices->push_back(fSortedIndex[k]);
+      else         { sum += fSortedPt[k]; n++; }
+    }
+  }
+}
+
+//____________________________________________
+/// Loop over the eta rows crossed by the region.
+//____________________________________________
+void AliIsolationConeGrid::Accumulate(const Region & reg, Double_t & sum, Int_t & n, std::vector<Int_t> * indices) const
+{
+  if ( !fBuilt || fEta.empty() ) return;
+
+  Double_t etaLow  = reg.fCone ? reg.fEta - reg.fR : reg.fEtaLow;
+  Double_t etaHigh = reg.fCone ? reg.fEta + reg.fR : reg.fEtaHigh;
+  if ( etaHigh < etaLow ) return;
+
+  Int_t rowLow  = GetEtaRow(etaLow);
+  Int_t rowHigh = GetEtaRow(etaHigh);
+
+  for(Int_t row = rowLow; row <= rowHigh; row++)
+  {
+    if ( fRowCumN[row*(fNPhiBins+1)+fNPhiBins] == 0 ) continue;
+
+    Double_t low  = fRowEtaLow [row];
+    Double_t high = fRowEtaHigh[row];
+
+    Double_t wOut = 0, wIn = -1;
+    if ( reg.fCone )
+    {
+      Double_t dEtaMax = TMath::Max(TMath::Abs(low-reg.fEta), TMath::Abs(high-reg.fEta));
+      Double_t dEtaMin = 0;
+      if ( reg.fEta < low || reg.fEta > high )
+        dEtaMin = TMath::Min(TMath::Abs(low-reg.fEta), TMath::Abs(high-reg.fEta));
+
+      if ( dEtaMin > reg.fR ) continue;
+
+      wOut = TMath::Sqrt(reg.fR*reg.fR - dEtaMin*dEtaMin);
+      if ( dEtaMax < reg.fR )
+        wIn = TMath::Sqrt(reg.fR*reg.fR - dEtaMax*dEtaMax) - kBorderTolerance;
+    }
+    else
+    {
+      if ( high < reg.fEtaLow || low > reg.fEtaHigh ) continue;
+
+      wOut = reg.fHalfPhi;
+      if ( low > reg.fEtaLow + kBorderTolerance && high < reg.fEtaHigh - kBorderTolerance )
+        wIn = reg.fHalfPhi - kBorderTolerance;
+    }
+
+    AccumulateRow(reg, row, wOut, wIn, sum, n, indices);
+  }
+}
+
+//____________________________________________
+/// \return sum pT of the particles at distance <= r.
+/// \param n: if non null, number of particles, output.
+//____________________________________________
+Float_t AliIsolationConeGrid::GetConeSum(Float_t eta, Float_t phi, Float_t r, Int_t * n) const
+{
+  Region reg = { kTRUE, eta, phi, r, 0, 0, 0 };
+
+  Double_t sum  = 0;
+  Int_t    npart = 0;
+  Accumulate(reg, sum, npart, 0x0);
+
+  if ( n ) *n = npart;
+  return sum;
+}
+
+//____________________________________________
+/// Cone sums for nR radii around the same direction.
+/// \param sums: array of nR entries, output.
+/// \param n: if non null, array of nR entries with the number of particles, output.
+//____________________________________________
+void AliIsolationConeGrid::GetConeSums(Float_t eta, Float_t phi, Int_t nR, const Float_t * r,
+                                       Float_t * sums, Int_t * n) const
+{
+  for(Int_t ir = 0; ir < nR; ir++)
+    sums[ir] = GetConeSum(eta, phi, r[ir], n ? &n[ir] : 0x0);
+}
+
+//____________________________________________
+/// \return sum pT of the particles with etaMin <= eta <= etaMax
+/// and phiMin <= phi <= phiMax, the phi interval may cross 0.
+//____________________________________________
+Float_t AliIsolationConeGrid::GetRectangleSum(Float_t etaMin, Float_t etaMax, Float_t phiMin, Float_t phiMax, Int_t * n) const
+{
+  Double_t halfPhi = 0.5*(phiMax-phiMin);
+  if ( halfPhi >= TMath::Pi() ) halfPhi = TMath::TwoPi();
+  Region reg = { kFALSE, 0, 0.5*(phiMin+phiMax), 0, etaMin, etaMax, halfPhi };
+
+  Double_t sum  = 0;
+  Int_t    npart = 0;
+  if ( halfPhi >= 0 ) Accumulate(reg, sum, npart, 0x0);
+
+  if ( n ) *n = npart;
+  return sum;
+}
+
+//____________________________________________
+/// \return sum pT in the band |dphi| <= r along all eta, cone excluded.
+//____________________________________________
+Float_t AliIsolationConeGrid::GetEtaBandSum(Float_t eta, Float_t phi, Float_t r) const
+{
+  Float_t etaRange = TMath::Max(TMath::Abs(fEtaMin), TMath::Abs(fEtaMax)) + 1.e3;
+  return GetRectangleSum(-etaRange, etaRange, phi-r, phi+r) - GetConeSum(eta, phi, r);
+}
+
+//____________________________________________
+/// \return sum pT in the band |deta| <= r and |dphi| <= maxDPhi, cone excluded.
+//____________________________________________
+Float_t AliIsolationConeGrid::GetPhiBandSum(Float_t eta, Float_t phi, Float_t r, Float_t maxDPhi) const
+{
+  return GetRectangleSum(eta-r, eta+r, phi-maxDPhi, phi+maxDPhi) - GetConeSum(eta, phi, r);
+}
+
+//____________________________________________
+/// \return sum pT of the two cones at +-90 degrees in phi, not averaged.
+//____________________________________________
+Float_t AliIsolationConeGrid::GetPerpConesSum(Float_t eta, Float_t phi, Float_t r) const
+{
+  return GetConeSum(eta, phi+TMath::PiOver2(), r) + GetConeSum(eta, phi-TMath::PiOver2(), r);
+}
+
+//____________________________________________
+/// Append the indices of the particles at distance <= r.
+//____________________________________________
+void AliIsolationConeGrid::GetIndicesInCone(Float_t eta, Float_t phi, Float_t r, std::vector<Int_t> & indices) const
+{
+  Region reg = { kTRUE, eta, phi, r, 0, 0, 0 };
+
+  Double_t sum  = 0;
+  Int_t    npart = 0;
+  Accumulate(reg, sum, npart, &indices);
+}
+
+//____________________________________________
+/// Append the indices of the particles in the rectangle.
+//____________________________________________
+void AliIsolationConeGrid::GetIndicesInRectangle(Float_t etaMin, Float_t etaMax, Float_t phiMin, Float_t phiMax,
+                                                 std::vector<Int_t> & indices) const
+{
+  Double_t halfPhi = 0.5*(phiMax-phiMin);
+  if ( halfPhi <  0           ) return;
+  if ( halfPhi >= TMath::Pi() ) halfPhi = TMath::TwoPi();
+  Region reg = { kFALSE, 0, 0.5*(phiMin+phiMax), 0, etaMin, etaMax, halfPhi };
+
+  Double_t sum  = 0;
+  Int_t    npart = 0;
+  Accumulate(reg, sum, npart, &indices);
+}
@@ -0,0 +1,109 @@
+#ifndef ALIISOLATIONCONEGRID_H
+#define ALIISOLATIONCONEGRID_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice     */
+
+//_________________________________________________________________________
+/// \class AliIsolationConeGrid
+/// \ingroup CaloTrackCorrelationsBase
+/// \brief Per event eta-phi grid of particles for fast cone and band sums.
+///
+/// The particles of the event (tracks or clusters) are added with *Add()*
+/// and sorted by cell in *Build()*, which also fills per eta row the
+/// cumulative pT sums along phi. A cone or band sum is then obtained
+/// adding the cells fully inside the region from the cumulative sums,
+/// only the particles in the cells crossed by the region border are
+/// checked one by one, so the result is the same as looping over all the
+/// particles. Phi is periodic, particles outside the eta range of the
+/// grid are kept in the first or last eta row.
+///
+/// The indices returned by the *GetIndicesIn...()* methods are those of
+/// the order of the *Add()* calls.
+//_________________________________________________________________________
+
+#include <vector>
+
+#include <TObject.h>
+
+class AliIsolationConeGrid : public TObject {
+
+ public:
+
+  AliIsolationConeGrid() ;
+  AliIsolationConeGrid(Float_t etaMin, Float_t etaMax, Int_t nEtaBins, Int_t nPhiBins) ;
+
+  /// Virtual destructor.
+  virtual ~AliIsolationConeGrid() { ; }
+
+  void       SetBinning(Float_t etaMin, Float_t etaMax, Int_t nEtaBins, Int_t nPhiBins) ;
+
+  void       Reset() ;
+  void       Add(Float_t eta, Float_t phi, Float_t pt) ;
+  void       Build() ;
+
+  Int_t      GetNParticles()                                 const { return fEta.size() ; }
+  Bool_t     IsBuilt()                                       const { return fBuilt      ; }
+
+  Float_t    GetConeSum      (Float_t eta, Float_t phi, Float_t r, Int_t * n = 0x0) const ;
+  void       GetConeSums     (Float_t eta, Float_t phi, Int_t nR, const Float_t * r,
+                              Float_t * sums, Int_t * n = 0x0) const ;
+  Float_t    GetRectangleSum (Float_t etaMin, Float_t etaMax, Float_t phiMin, Float_t phiMax, Int_t * n = 0x0) const ;
+  Float_t    GetEtaBandSum   (Float_t eta, Float_t phi, Float_t r) const ;
+  Float_t    GetPhiBandSum   (Float_t eta, Float_t phi, Float_t r, Float_t maxDPhi = 4.) const ;
+  Float_t    GetPerpConesSum (Float_t eta, Float_t phi, Float_t r) const ;
+
+  // Indices are appended to the vector, to allow the union of several regions
+  void       GetIndicesInCone     (Float_t eta, Float_t phi, Float_t r, std::vector<Int_t> & indices) const ;
+  void       GetIndicesInRectangle(Float_t etaMin, Float_t etaMax, Float_t phiMin, Float_t phiMax,
+                                   std::vector<Int_t> & indices) const ;
+
+ private:
+
+  /// \struct Region
+  /// \brief Cone of radius fR or rectangle |dphi| <= fHalfPhi, fEtaLow <= eta <= fEtaHigh.
+  struct Region
+  {
+    Bool_t   fCone;
+    Double_t fEta;
+    Double_t fPhi;
+    Double_t fR;
+    Double_t fEtaLow;
+    Double_t fEtaHigh;
+    Double_t fHalfPhi;
+  };
+
+  void       Accumulate   (const Region & reg, Double_t & sum, Int_t & n, std::vector<Int_t> * indices) const ;
+  void       AccumulateRow(const Region & reg, Int_t row, Double_t wOut, Double_t wIn,
+                           Double_t & sum, Int_t & n, std::vector<Int_t> * indices) const ;
+  Bool_t     IsInside     (const Region & reg, Float_t eta, Float_t phi) const ;
+  Int_t      GetEtaRow    (Double_t eta) const ;
+  Int_t      ModPhiBin    (Int_t bin)    const { Int_t m = bin % fNPhiBins ; return m < 0 ? m + fNPhiBins : m ; }
+
+  Float_t    fEtaMin;                   ///<  Lower eta limit of the grid.
+  Float_t    fEtaMax;                   ///<  Upper eta limit of the grid.
+  Int_t      fNEtaBins;                 ///<  Number of eta rows.
+  Int_t      fNPhiBins;                 ///<  Number of phi cells per row, covering [0,2pi[.
+  Double_t   fEtaStep;                  ///<  Eta width of the rows.
+  Double_t   fPhiStep;                  ///<  Phi width of the cells.
+
+  Bool_t                fBuilt;         //!<! Build() called after the last Add().
+  std::vector<Float_t>  fEta;           //!<! Eta of the added particles.
+  std::vector<Float_t>  fPhi;           //!<! Phi of the added particles, in [0,2pi[.
+  std::vector<Float_t>  fPt;            //!<! pT of the added particles.
+  std::vector<Int_t>    fCellFirst;     //!<! First sorted particle of each cell, one more entry than cells.
+  std::vector<Int_t>    fSortedIndex;   //!<! Index of the sorted particles in the added order.
+  std::vector<Float_t>  fSortedEta;     //!<! Eta of the sorted particles.
+  std::vector<Float_t>  fSortedPhi;     //!<! Phi of the sorted particles.
+  std::vector<Float_t>  fSortedPt;      //!<! pT of the sorted particles.
+  std::vector<Double_t> fRowCumPt;      //!<! Cumulative pT along phi per row, fNPhiBins+1 entries per row.
+  std::vector<Int_t>    fRowCumN;       //!<! Cumulative number of particles along phi per row.
+  std::vector<Float_t>  fRowEtaLow;     //!<! Lower eta of each row, including the particles outside the grid.
+  std::vector<Float_t>  fRowEtaHigh;    //!<! Upper eta of each row, including the particles outside the grid.
+
+  /// \cond CLASSIMP
+  ClassDef(AliIsolationConeGrid,1) ;
+  /// \endcond
+
+} ;
+
+#endif //ALIISOLATIONCONEGRID_H
@@ -14,6 +14,7 @@
  **************************************************************************/
 
 // --- ROOT system ---
+#include <algorithm>
 #include <TObjArray.h>
 #include <TH3F.h>
 #include <TCustomBinning.h>
@@ -41,6 +42,9 @@
 ClassImp(AliIsolationCut) ;
 /// \endcond
 
+/// Margin added to the grid regions, the particles found are selected as without grid.
+static const Float_t kConeGridMargin = 1.e-3;
+
 //____________________________________
 /// Default constructor. Initialize parameters
 //____________________________________
@@ -58,6 +62,9 @@ fUseLeadingPtUEFactor(0), fLeadingPtUEFactor(10000),
 fUseMaxPtUE(0),      fMaxPtUE(1000),
 fJetRhoTaskName(""),
 fDebug(0),           fMomentum(),                   fTrackVector(),
+fUseConeGrid(0),     fTrackGrid(),                  fClusterGrid(),
+fTrackGridEvent(-1), fClusterGridEvent(-1),         fClusterGridCalo(-1),
+fGridIndices(),
 fEMCEtaSize(-1),     fEMCPhiMin(-1),                fEMCPhiMax(-1),
 fTPCEtaSize(-1),     fTPCPhiSize(-1),
 // Histograms
@@ -262,13 +269,39 @@ void AliIsolationCut::CalculateCaloSignalInCone
   TObjArray * refclusters  = 0x0;
   Int_t       nclusterrefs = 0;
   
+  // Use the kinematics stored by the reader for its own cluster arrays
+  const AliCaloTrackReader::KinematicsArrays * kine = 0x0;
+  if ( !bgCls && !useRefs && !reader->GetMixedEvent() && reader->IsKinematicsArraysFilled() )
+  {
+    if      ( calorimeter == AliFiducialCut::kPHOS  ) kine = &reader->GetPHOSKinematics();
+    else if ( calorimeter == AliFiducialCut::kEMCAL ) kine = &reader->GetEMCALKinematics();
+    if ( kine && kine->GetSize() != plNe->GetEntriesFast() ) kine = 0x0;
+  }
+  
+  // With the grid, loop only over the clusters close to the candidate
+  Bool_t useGrid = ( fUseConeGrid && kine );
+  if ( useGrid )
+  {
+    if ( fClusterGridEvent != reader->GetEventNumber() || fClusterGridCalo != calorimeter ||
+         fClusterGrid.GetNParticles() != kine->GetSize() )
+    {
+      BuildConeGrid(fClusterGrid, kine->fEta, kine->fPhi, kine->fPt);
+      fClusterGridEvent = reader->GetEventNumber();
+      fClusterGridCalo  = calorimeter;
+    }
+    
+    GetConeGridCandidates(fClusterGrid, etaC, phiC, fGridIndices);
+  }
+  
   //
   // Get the clusters in the cone
   //
   //printf("Loop calo\n");
 
-  for(Int_t ipr = 0;ipr < plNe->GetEntries() ; ipr ++ )
+  Int_t nClusters = useGrid ? (Int_t) fGridIndices.size() : plNe->GetEntries();
+  for(Int_t iloop = 0; iloop < nClusters; iloop++ )
   {
+    Int_t ipr = useGrid ? fGridIndices[iloop] : iloop;
     AliVCluster * calo = dynamic_cast<AliVCluster *>(plNe->At(ipr)) ;
     
     if ( calo )
@@ -292,12 +325,21 @@ void AliIsolationCut::CalculateCaloSignalInCone
         if ( fPartInCone == kNeutralAndCharged && matched ) continue ;
       }
       
-      // Assume that come from vertex in straight line
-      calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
-      
-      pt  = fMomentum.Pt()  ;
-      eta = fMomentum.Eta() ;
-      phi = fMomentum.Phi() ;
+      if ( kine )
+      {
+        pt  = kine->fPt [ipr];
+        eta = kine->fEta[ipr];
+        phi = kine->fPhi[ipr];
+      }
+      else
+      {
+        // Assume that come from vertex in straight line
+        calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
+        
+        pt  = fMomentum.Pt()  ;
+        eta = fMomentum.Eta() ;
+        phi = fMomentum.Phi() ;
+      }
     }
     else
     {// Mixed event stored in AliCaloTrackParticles
@@ -442,8 +484,13 @@ void AliIsolationCut::CalculateCaloSignalInCone
   // Get the UE clusters out of the cone
   //
 
-  for(Int_t ipr = 0;ipr < plNe->GetEntries() ; ipr ++ )
+  if ( useGrid )
+    useGrid = GetConeGridUECandidates(fClusterGrid, etaC, phiC, ptC, kFALSE, fGridIndices);
+
+  Int_t nUEClusters = useGrid ? (Int_t) fGridIndices.size() : plNe->GetEntries();
+  for(Int_t iloop = 0; iloop < nUEClusters; iloop++ )
   {
+    Int_t ipr = useGrid ? fGridIndices[iloop] : iloop;
     AliVCluster * calo = dynamic_cast<AliVCluster *>(plNe->At(ipr)) ;
 
     if ( calo )
@@ -467,12 +514,21 @@ void AliIsolationCut::CalculateCaloSignalInCone
         if ( fPartInCone == kNeutralAndCharged && matched ) continue ;
       }
 
-      // Assume that come from vertex in straight line
-      calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
+      if ( kine )
+      {
+        pt  = kine->fPt [ipr];
+        eta = kine->fEta[ipr];
+        phi = kine->fPhi[ipr];
+      }
+      else
+      {
+        // Assume that come from vertex in straight line
+        calo->GetMomentum(fMomentum,reader->GetVertex(evtIndex)) ;
 
-      pt  = fMomentum.Pt()  ;
-      eta = fMomentum.Eta() ;
-      phi = fMomentum.Phi() ;
+        pt  = fMomentum.Pt()  ;
+        eta = fMomentum.Eta() ;
+        phi = fMomentum.Phi() ;
+      }
     }
     else
     {// Mixed event stored in AliCaloTrackParticles
@@ -654,6 +710,69 @@ void AliIsolationCut::CalculateCaloSignalInCone
   if ( bFillAOD && refclusters ) pCandidate->AddObjArray(refclusters);  
 }
 
+//_________________________________________________________________________
+/// Fill the eta-phi grid with the kinematics of the reader arrays.
+//_________________________________________________________________________
+void AliIsolationCut::BuildConeGrid(AliIsolationConeGrid & grid, const std::vector<Float_t> & eta,
+                                    const std::vector<Float_t> & phi, const std::vector<Float_t> & pt) const
+{
+  grid.Reset();
+  for(UInt_t i = 0; i < pt.size(); i++) grid.Add(eta[i], phi[i], pt[i]);
+  grid.Build();
+}
+
+//_________________________________________________________________________
+/// Indices of the particles that can be inside the candidate cone,
+/// sorted to keep the order of the input arrays.
+//_________________________________________________________________________
+void AliIsolationCut::GetConeGridCandidates(const AliIsolationConeGrid & grid, Float_t eta, Float_t phi,
+                                            std::vector<Int_t> & indices) const
+{
+  indices.clear();
+  grid.GetIndicesInCone(eta, phi, fConeSize+kConeGridMargin, indices);
+  std::sort(indices.begin(), indices.end());
+}
+
+//_________________________________________________________________________
+/// Indices of the particles that can be in the UE regions used by the 
+/// selected isolation method, sorted to keep the order of the input arrays.
+/// eturn false if all the particles are needed, eta-phi histograms filled for all.
+//_________________________________________________________________________
+Bool_t AliIsolationCut::GetConeGridUECandidates(const AliIsolationConeGrid & grid, Float_t eta, Float_t phi, Float_t pt,
+                                                Bool_t charged, std::vector<Int_t> & indices) const
+{
+  if ( fFillHistograms && fFillEtaPhiHistograms && pt > fEtaPhiHistogramsMinPt ) return kFALSE;
+
+  indices.clear();
+
+  Float_t band = fConeSize+fConeSizeBandGap+kConeGridMargin;
+  if ( fICMethod > kSumBkgSubIC )
+  {
+    // eta and phi bands
+    grid.GetIndicesInRectangle(-10., 10., phi-band, phi+band, indices);
+    grid.GetIndicesInRectangle(eta-band, eta+band, phi-TMath::PiOver2()-kConeGridMargin, 
+                               phi+TMath::PiOver2()+kConeGridMargin, indices);
+  }
+
+  if ( charged && fICMethod == kSumBkgSubIC )
+  {
+    grid.GetIndicesInCone(eta, phi+TMath::PiOver2(), fConeSize+kConeGridMargin, indices);
+    grid.GetIndicesInCone(eta, phi-TMath::PiOver2(), fConeSize+kConeGridMargin, indices);
+  }
+
+  if ( charged && fICMethod == kSumBkgSubPerpBandIC )
+  {
+    Float_t width = fConeSize+kConeGridMargin;
+    grid.GetIndicesInRectangle(-10., 10., phi+TMath::PiOver2()-width, phi+TMath::PiOver2()+width, indices);
+    grid.GetIndicesInRectangle(-10., 10., phi-TMath::PiOver2()-width, phi-TMath::PiOver2()+width, indices);
+  }
+
+  std::sort(indices.begin(), indices.end());
+  indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+
+  return kTRUE;
+}
+
 //_________________________________________________________________________________________________________________________________
 /// Get the pt sum of the tracks inside the cone and UE regions, the leading track pT and number of clusters.
 /// Pass the calculated pT values, but also set them in pCandidate
@@ -756,12 +875,35 @@ void AliIsolationCut::CalculateTrackSignalInCone
   TObjArray * reftracks  = 0x0;
   Int_t       ntrackrefs = 0;
 
+  // Use the kinematics stored by the reader for its own track array
+  const AliCaloTrackReader::KinematicsArrays * kine = 0x0;
+  if ( !bgTrk && !useRefs && !reader->GetMixedEvent() && reader->IsKinematicsArraysFilled() )
+  {
+    kine = &reader->GetCTSKinematics();
+    if ( kine->GetSize() != plCTS->GetEntriesFast() ) kine = 0x0;
+  }
+
+  // With the grid, loop only over the tracks close to the candidate
+  Bool_t useGrid = ( fUseConeGrid && kine );
+  if ( useGrid )
+  {
+    if ( fTrackGridEvent != reader->GetEventNumber() || fTrackGrid.GetNParticles() != kine->GetSize() )
+    {
+      BuildConeGrid(fTrackGrid, kine->fEta, kine->fPhi, kine->fPt);
+      fTrackGridEvent = reader->GetEventNumber();
+    }
+
+    GetConeGridCandidates(fTrackGrid, etaTrig, phiTrig, fGridIndices);
+  }
+
   //-----------------------------------------------------------
   // Get the tracks in cone
   //-----------------------------------------------------------
 
-  for(Int_t ipr = 0;ipr < plCTS->GetEntries() ; ipr ++ )
+  Int_t nTracks = useGrid ? (Int_t) fGridIndices.size() : plCTS->GetEntries();
+  for(Int_t iloop = 0; iloop < nTracks; iloop++ )
   {
+    Int_t ipr = useGrid ? fGridIndices[iloop] : iloop;
     AliVTrack* track = dynamic_cast<AliVTrack*>(plCTS->At(ipr)) ;
 
     if ( track )
@@ -782,10 +924,19 @@ void AliIsolationCut::CalculateTrackSignalInCone
         if ( contained ) continue ;
       }
 
-      fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
-      ptTrack  = fTrackVector.Pt();
-      etaTrack = fTrackVector.Eta();
-      phiTrack = fTrackVector.Phi() ;
+      if ( kine )
+      {
+        ptTrack  = kine->fPt [ipr];
+        etaTrack = kine->fEta[ipr];
+        phiTrack = kine->fPhi[ipr];
+      }
+      else
+      {
+        fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+        ptTrack  = fTrackVector.Pt();
+        etaTrack = fTrackVector.Eta();
+        phiTrack = fTrackVector.Phi() ;
+      }
     }
     else
     {// Mixed event stored in AliCaloTrackParticles
@@ -919,8 +1070,13 @@ void AliIsolationCut::CalculateTrackSignalInCone
   // Select the UE tracks
   //-----------------------------------------------------------
 
-  for(Int_t ipr = 0;ipr < plCTS->GetEntries() ; ipr ++ )
+  if ( useGrid )
+    useGrid = GetConeGridUECandidates(fTrackGrid, etaTrig, phiTrig, ptTrig, kTRUE, fGridIndices);
+
+  Int_t nUETracks = useGrid ? (Int_t) fGridIndices.size() : plCTS->GetEntries();
+  for(Int_t iloop = 0; iloop < nUETracks; iloop++ )
   {
+    Int_t ipr = useGrid ? fGridIndices[iloop] : iloop;
     AliVTrack* track = dynamic_cast<AliVTrack*>(plCTS->At(ipr)) ;
 
     if ( track )
@@ -941,10 +1097,19 @@ void AliIsolationCut::CalculateTrackSignalInCone
         if ( contained ) continue ;
       }
 
-      fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
-      ptTrack  = fTrackVector.Pt();
-      etaTrack = fTrackVector.Eta();
-      phiTrack = fTrackVector.Phi() ;
+      if ( kine )
+      {
+        ptTrack  = kine->fPt [ipr];
+        etaTrack = kine->fEta[ipr];
+        phiTrack = kine->fPhi[ipr];
+      }
+      else
+      {
+        fTrackVector.SetXYZ(track->Px(),track->Py(),track->Pz());
+        ptTrack  = fTrackVector.Pt();
+        etaTrack = fTrackVector.Eta();
+        phiTrack = fTrackVector.Phi() ;
+      }
     }
     else
     {// Mixed event stored in AliCaloTrackParticles
@@ -5105,6 +5270,7 @@ void AliIsolationCut::Print(const Option_t * opt) const
   if ( fICMethod == kSumBkgSubJetRhoIC )
     printf("Jet rho task name = %s\n",fJetRhoTaskName.Data());
   printf("Cone Size          =     %1.2f\n", fConeSize   ) ;
+  printf("Use cone grid      =     %d\n",    fUseConeGrid) ;
   printf("Cone Size UE Gap   =     %1.2f\n", fConeSizeBandGap ) ;
   printf("pT threshold       =     >%2.1f;<%2.1f\n", fPtThreshold, fPtThresholdMax) ;
   printf("Sum pT threshold   =     >%2.1f;<%2.1f, gap = %2.1f\n", fSumPtThreshold, fSumPtThresholdMax, fSumPtThresholdGap) ;
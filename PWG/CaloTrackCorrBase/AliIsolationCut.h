@@ -24,12 +24,14 @@ class TObjArray ;
 class TList ;
 class TH3F ;
 #include <TLorentzVector.h>
+#include <vector>
 
 // --- ANALYSIS system ---
 class AliCaloTrackParticleCorrelation ;
 class AliCaloTrackReader ;
 class AliCaloPID ;
 class AliHistogramRanges ;
+#include "AliIsolationConeGrid.h"
 
 class AliIsolationCut : public TObject {
 
@@ -213,6 +215,11 @@ class AliIsolationCut : public TObject {
   void       SwitchOnFillHighMultHistograms ()                 { fFillHighMultHistograms = kTRUE  ; }
   void       SwitchOffFillHighMultHistograms()                 { fFillHighMultHistograms = kFALSE ; }
   
+  /// Loop only over the particles close to the cone and UE regions of the candidate,
+  /// found with an eta-phi grid. Needs AliCaloTrackReader::SwitchOnKinematicsArrays().
+  void       SwitchOnConeGrid ()                               { fUseConeGrid = kTRUE  ; }
+  void       SwitchOffConeGrid()                               { fUseConeGrid = kFALSE ; }
+  
   void       SwitchOnConeExcessCorrection ()                   { fMakeConeExcessCorr = kTRUE  ; }
   void       SwitchOffConeExcessCorrection()                   { fMakeConeExcessCorr = kFALSE ; }
   
@@ -290,6 +297,14 @@ class AliIsolationCut : public TObject {
 
   TVector3   fTrackVector;                             //!<! Track moment, temporal object.
   
+  Bool_t     fUseConeGrid;                             ///< Select the particles in cone and UE regions with an eta-phi grid.
+  AliIsolationConeGrid fTrackGrid;                     //!<! Grid of the reader tracks of the current event.
+  AliIsolationConeGrid fClusterGrid;                   //!<! Grid of the reader clusters of the current event.
+  Int_t      fTrackGridEvent;                          //!<! Event number of the tracks in fTrackGrid.
+  Int_t      fClusterGridEvent;                        //!<! Event number of the clusters in fClusterGrid.
+  Int_t      fClusterGridCalo;                         //!<! Calorimeter of the clusters in fClusterGrid.
+  std::vector<Int_t> fGridIndices;                     //!<! Indices of the particles to loop over.
+  
   Float_t    fEMCEtaSize;                              ///< Eta size of Calo
   Float_t    fEMCPhiMin;                               ///< Minimim Phi limit of Calo
   Float_t    fEMCPhiMax;                               ///< Maximum Phi limit of Calo
@@ -572,6 +587,13 @@ class AliIsolationCut : public TObject {
   /// Trigger pT vs iso cone energy UE subtracted vs leading UE cluster in cone pT per centrality bin
   TH3F **  fhTrigPtVsSumPtUEBandSubVsLeadClusterFracInConePtCent; //![GetNCentrBin()]
 
+  void       BuildConeGrid(AliIsolationConeGrid & grid, const std::vector<Float_t> & eta,
+                           const std::vector<Float_t> & phi, const std::vector<Float_t> & pt) const ;
+  void       GetConeGridCandidates  (const AliIsolationConeGrid & grid, Float_t eta, Float_t phi,
+                                     std::vector<Int_t> & indices) const ;
+  Bool_t     GetConeGridUECandidates(const AliIsolationConeGrid & grid, Float_t eta, Float_t phi, Float_t pt,
+                                     Bool_t charged, std::vector<Int_t> & indices) const ;
+
   /// Copy constructor not implemented.
   AliIsolationCut(              const AliIsolationCut & g) ;
 
@@ -579,7 +601,7 @@ class AliIsolationCut : public TObject {
   AliIsolationCut & operator = (const AliIsolationCut & g) ; 
 
   /// \cond CLASSIMP
-  ClassDef(AliIsolationCut,29) ;
+  ClassDef(AliIsolationCut,30) ;
   /// \endcond
 
 } ;
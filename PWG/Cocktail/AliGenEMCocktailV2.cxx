@@ -74,7 +74,9 @@ AliGenEMCocktailV2::AliGenEMCocktailV2():AliGenCocktail(),
   fDynPtRange(kFALSE),
   fForceConv(kFALSE),
   fSelectedParticles(kGenHadrons),
-  fUseFixedEP(kFALSE)  
+  fUseFixedEP(kFALSE),
+  fUseTables(kFALSE),
+  fTableBins(10000)
 {
   // Constructor
 }
@@ -198,6 +200,11 @@ void AliGenEMCocktailV2::CreateCocktail()
     }
     AliGenEMlibV2::SetFlowParametrizations(fParametrizationFile, fV2ParametrizationDir);
   }    
+
+  // tables over the nominal pt range, the stretched ranges above are evaluated directly
+  AliGenEMlibV2::SetUseTables(fUseTables, fPtMin, fPtMax, fTableBins);
+  if (fUseTables)
+    AliInfo(Form("Tabulated pt and v2 parametrizations with %d intervals",fTableBins));
   
   
 
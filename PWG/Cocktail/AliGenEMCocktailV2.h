@@ -72,6 +72,7 @@ public:
   static  void    SetMtScalingFactors();
   static  Bool_t  SetPtYDistributions();
   void    SetFixedEventPlane(Bool_t toFix=kTRUE){fUseFixedEP=toFix;} //Default is random
+  void    SetUseSamplingTables(Bool_t useTables=kTRUE, Int_t nBins=10000)  { fUseTables = useTables; fTableBins = nBins; }
  
   // getters
   Bool_t    GetDynamicalPtRangeOption()       const                   { return fDynPtRange;               }
@@ -140,8 +141,10 @@ private:
   Bool_t        fForceConv;                             // select whether you want to force all gammas to convert imidediately
   UInt_t        fSelectedParticles;                     // which particles to simulate, allows to switch on and off 32 different particles
   Bool_t        fUseFixedEP;                            // use random Event Plane or fixed Psi=0
+  Bool_t        fUseTables;                             // use the tabulated pt and v2 parametrizations of AliGenEMlibV2
+  Int_t         fTableBins;                             // number of intervals of the tables
   
-  ClassDef(AliGenEMCocktailV2,9)                        // cocktail for EM physics
+  ClassDef(AliGenEMCocktailV2,10)                        // cocktail for EM physics
 };
 
 #endif
@@ -34,6 +34,7 @@
 #include "AliGenEMlibV2.h"
 #include "TH1D.h"
 #include <TObjString.h>
+#include <algorithm>
 
 using std::cout;
 using std::endl;
@@ -50,6 +51,13 @@ Int_t AliGenEMlibV2::fgSelectedCentrality       = AliGenEMlibV2::kpp;
 Int_t AliGenEMlibV2::fgSelectedV2Systematic     = AliGenEMlibV2::kNoV2Sys;
 TF1*  AliGenEMlibV2::fV2Parametrization[]={0x0} ;
 Int_t AliGenEMlibV2::fV2RefParameterization[] = {0} ;
+Bool_t   AliGenEMlibV2::fgUseTables   = kFALSE;
+Double_t AliGenEMlibV2::fgTablePtMin  = 0.;
+Double_t AliGenEMlibV2::fgTablePtMax  = 50.;
+Int_t    AliGenEMlibV2::fgTableBins   = 10000;
+std::vector<Double_t> AliGenEMlibV2::fgPtTable[28];
+std::vector<Double_t> AliGenEMlibV2::fgPtCDF[28];
+std::vector<Double_t> AliGenEMlibV2::fgV2Table[28];
 
 Double_t AliGenEMlibV2::CrossOverLc(double a, double b, double x){
   if(x<b-a/2) return 1.0;
@@ -1330,6 +1338,8 @@ Double_t AliGenEMlibV2::GetTAA(Int_t cent){
 //--------------------------------------------------------------------------
 Bool_t AliGenEMlibV2::SetPtParametrizations(TString fileName, TString dirName) {
 
+  ResetTables();
+
   // open parametrizations file
   TFile* fParametrizationFile = TFile::Open(fileName.Data());
   if (!fParametrizationFile) AliFatalClass(Form("File %s not found",fileName.Data()));
@@ -1398,6 +1408,8 @@ Bool_t AliGenEMlibV2::SetFlowParametrizations(TString fileName, TString dirName)
   //If dirname is not zero, read parameterizations from file
   //for particles with missing parametrizations the Mt scaling is applied
 
+  ResetTables();
+
   if(dirName.Length()==0){ //use built-in parameterizations, do nothing
     return kTRUE;
   }
@@ -1478,6 +1490,8 @@ TF1* AliGenEMlibV2::GetPtParametrization(Int_t np) {
 //--------------------------------------------------------------------------
 void AliGenEMlibV2::SetMtScalingFactors(TString fileName, TString dirName) {
 
+  ResetTables();
+
   // set collision system
   Int_t selectedCol;
   switch (fgSelectedCollisionsSystem){
@@ -1639,11 +1653,10 @@ TH2F* AliGenEMlibV2::GetPtYDistribution(Int_t np) {
 typedef Double_t (*GenFunc) (const Double_t*,  const Double_t*);
 typedef Int_t (*GenFuncIp) (TRandom *);
 
-GenFunc AliGenEMlibV2::GetPt(Int_t param, const char * tname) const
+GenFunc AliGenEMlibV2::PtFunc(Int_t param)
 {
   // Return pointer to pT parameterisation
   GenFunc func=0;
-  TString sname(tname);
 
   switch (param) {
     case kDirectRealGamma:
@@ -1933,11 +1946,10 @@ GenFuncIp AliGenEMlibV2::GetIp(Int_t param, const char * tname) const
   return func;
 }
 
-GenFunc AliGenEMlibV2::GetV2(Int_t param, const char * tname) const
+GenFunc AliGenEMlibV2::V2Func(Int_t param)
 {
   // Return pointer to v2-parameterisation
   GenFunc func=0;
-  TString sname(tname);
 
   switch (param) {
     case kDirectRealGamma:
@@ -2030,3 +2042,140 @@ GenFunc AliGenEMlibV2::GetV2(Int_t param, const char * tname) const
   }
   return func;
 }
+
+//--------------------------------------------------------------------------
+//
+//                          Tabulated parametrizations
+//
+//--------------------------------------------------------------------------
+namespace {
+  template <Int_t np> Double_t PtTabulated(const Double_t *px, const Double_t */*dummy*/) { return AliGenEMlibV2::EvalPtTable(np, px[0]); }
+  template <Int_t np> Double_t V2Tabulated(const Double_t *px, const Double_t */*dummy*/) { return AliGenEMlibV2::EvalV2Table(np, px[0]); }
+
+  const GenFunc kPtTabulated[28] = {
+    PtTabulated<0>, PtTabulated<1>, PtTabulated<2>, PtTabulated<3>,
+    PtTabulated<4>, PtTabulated<5>, PtTabulated<6>, PtTabulated<7>,
+    PtTabulated<8>, PtTabulated<9>, PtTabulated<10>, PtTabulated<11>,
+    PtTabulated<12>, PtTabulated<13>, PtTabulated<14>, PtTabulated<15>,
+    PtTabulated<16>, PtTabulated<17>, PtTabulated<18>, PtTabulated<19>,
+    PtTabulated<20>, PtTabulated<21>, PtTabulated<22>, PtTabulated<23>,
+    PtTabulated<24>, PtTabulated<25>, PtTabulated<26>, PtTabulated<27>
+  };
+  const GenFunc kV2Tabulated[28] = {
+    V2Tabulated<0>, V2Tabulated<1>, V2Tabulated<2>, V2Tabulated<3>,
+    V2Tabulated<4>, V2Tabulated<5>, V2Tabulated<6>, V2Tabulated<7>,
+    V2Tabulated<8>, V2Tabulated<9>, V2Tabulated<10>, V2Tabulated<11>,
+    V2Tabulated<12>, V2Tabulated<13>, V2Tabulated<14>, V2Tabulated<15>,
+    V2Tabulated<16>, V2Tabulated<17>, V2Tabulated<18>, V2Tabulated<19>,
+    V2Tabulated<20>, V2Tabulated<21>, V2Tabulated<22>, V2Tabulated<23>,
+    V2Tabulated<24>, V2Tabulated<25>, V2Tabulated<26>, V2Tabulated<27>
+  };
+}
+
+GenFunc AliGenEMlibV2::GetPt(Int_t param, const char * /*tname*/) const
+{
+  // Return pointer to pT parameterisation, tabulated if requested
+  GenFunc func=PtFunc(param);
+  if (func && fgUseTables && BuildTables(param)) func=kPtTabulated[param];
+  return func;
+}
+
+GenFunc AliGenEMlibV2::GetV2(Int_t param, const char * /*tname*/) const
+{
+  // Return pointer to v2-parameterisation, tabulated if requested
+  GenFunc func=V2Func(param);
+  if (func && fgUseTables && BuildTables(param)) func=kV2Tabulated[param];
+  return func;
+}
+
+void AliGenEMlibV2::SetUseTables(Bool_t useTables, Double_t ptMin, Double_t ptMax, Int_t nBins)
+{
+  // Switch on the tabulated parametrizations for the generators created afterwards
+  fgUseTables  = useTables;
+  fgTablePtMin = ptMin;
+  fgTablePtMax = ptMax;
+  fgTableBins  = nBins;
+  ResetTables();
+}
+
+void AliGenEMlibV2::ResetTables()
+{
+  // Tables are computed again at the next use, to be called when the parametrizations change
+  for (Int_t i=0; i<28; i++) {
+    fgPtTable[i].clear();
+    fgPtCDF[i].clear();
+    fgV2Table[i].clear();
+  }
+}
+
+Bool_t AliGenEMlibV2::BuildTables(Int_t np)
+{
+  // Compute the pt, cumulative pt and v2 tables of particle np
+  if (np<0 || np>=28 || fgTableBins<1 || fgTablePtMax<=fgTablePtMin) return kFALSE;
+  if (!fgPtTable[np].empty()) return kTRUE;
+
+  GenFunc ptFunc = PtFunc(np);
+  GenFunc v2Func = V2Func(np);
+  if (!ptFunc || !v2Func) return kFALSE;
+  if (np<26 && !fPtParametrization[np]) return kFALSE;
+
+  const Double_t step = (fgTablePtMax-fgTablePtMin)/fgTableBins;
+  std::vector<Double_t> ptTable(fgTableBins+1), cdf(fgTableBins+1), v2Table(fgTableBins+1);
+  for (Int_t i=0; i<=fgTableBins; i++) {
+    Double_t pt = fgTablePtMin+i*step;
+    ptTable[i] = ptFunc(&pt, (Double_t*) 0);
+    v2Table[i] = v2Func(&pt, (Double_t*) 0);
+    cdf[i]     = (i==0) ? 0. : cdf[i-1]+0.5*step*(TMath::Max(ptTable[i-1],0.)+TMath::Max(ptTable[i],0.));
+  }
+  fgPtCDF[np].swap(cdf);
+  fgV2Table[np].swap(v2Table);
+  fgPtTable[np].swap(ptTable);
+  AliInfoClass(Form("Tables of particle %d: %d intervals in pT %.2f - %.2f GeV/c",np,fgTableBins,fgTablePtMin,fgTablePtMax));
+  return kTRUE;
+}
+
+Double_t AliGenEMlibV2::EvalTable(const std::vector<Double_t> &table, Bool_t logInterpolation, Double_t pt)
+{
+  // Interpolation between the nodes, in log for the steeply falling pt spectra
+  Double_t x = (pt-fgTablePtMin)/(fgTablePtMax-fgTablePtMin)*fgTableBins;
+  Int_t i = TMath::Min((Int_t) x, fgTableBins-1);
+  Double_t f = x-i;
+  Double_t lo = table[i], hi = table[i+1];
+  if (logInterpolation && lo>0. && hi>0.) return lo*TMath::Power(hi/lo, f);
+  return lo+f*(hi-lo);
+}
+
+Double_t AliGenEMlibV2::EvalPtTable(Int_t np, Double_t pt)
+{
+  // Tabulated pt parametrization of particle np
+  if (fgPtTable[np].empty() || pt<fgTablePtMin || pt>fgTablePtMax) return PtFunc(np)(&pt, (Double_t*) 0);
+  return EvalTable(fgPtTable[np], kTRUE, pt);
+}
+
+Double_t AliGenEMlibV2::EvalV2Table(Int_t np, Double_t pt)
+{
+  // Tabulated v2 parametrization of particle np
+  if (fgV2Table[np].empty() || pt<fgTablePtMin || pt>fgTablePtMax) return V2Func(np)(&pt, (Double_t*) 0);
+  return EvalTable(fgV2Table[np], kFALSE, pt);
+}
+
+Double_t AliGenEMlibV2::RandomPt(Int_t np, TRandom *ran)
+{
+  // pT of particle np in the table range from the inverse of the cumulative distribution
+  if (!BuildTables(np) || fgPtCDF[np].back()<=0.) return -1.;
+  const std::vector<Double_t> &cdf = fgPtCDF[np];
+  Double_t u = ran->Rndm()*cdf.back();
+  Int_t i = std::upper_bound(cdf.begin(), cdf.end(), u)-cdf.begin()-1;
+  i = TMath::Max(0, TMath::Min(i, fgTableBins-1));
+  Double_t width = cdf[i+1]-cdf[i];
+  Double_t f = (width>0.) ? (u-cdf[i])/width : 0.;
+  return fgTablePtMin+(i+f)*(fgTablePtMax-fgTablePtMin)/fgTableBins;
+}
+
+Int_t AliGenEMlibV2::RandomPt(Int_t np, Int_t n, Double_t *pt, TRandom *ran)
+{
+  // Batch of n pT values of particle np, returns the number of values filled
+  if (!BuildTables(np) || fgPtCDF[np].back()<=0.) return 0;
+  for (Int_t i=0; i<n; i++) pt[i] = RandomPt(np, ran);
+  return n;
+}
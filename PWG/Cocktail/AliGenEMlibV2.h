@@ -20,6 +20,7 @@
 #include "TF1.h"
 #include "TH1D.h"
 #include "TH2F.h"
+#include <vector>
 
 class iostream;
 class TRandom;
@@ -53,6 +54,7 @@ public:
     fgSelectedCollisionsSystem  = collisionSystem;
     fgSelectedCentrality        = centSelect;
     fgSelectedV2Systematic      = v2sys;
+    ResetTables();
   }
   
   GenFunc   GetPt(Int_t param, const char * tname=0) const;
@@ -69,6 +71,20 @@ public:
   static TH1D*  GetMtScalingFactors();
   static TH2F*  GetPtYDistribution(Int_t np);
 
+  // Tabulated pt and v2 parametrizations: GetPt and GetV2 return functions
+  // interpolating in tables computed once per particle and selected
+  // parameters, outside of [ptMin,ptMax] the parametrizations are evaluated.
+  // The tables also provide the inverse CDF of the pt distributions, once
+  // built with BuildTables they are read only and RandomPt can be called
+  // from several threads with independent random generators.
+  static void     SetUseTables(Bool_t useTables, Double_t ptMin=0., Double_t ptMax=50., Int_t nBins=10000);
+  static Bool_t   BuildTables(Int_t np);
+  static void     ResetTables();
+  static Double_t EvalPtTable(Int_t np, Double_t pt);
+  static Double_t EvalV2Table(Int_t np, Double_t pt);
+  static Double_t RandomPt(Int_t np, TRandom *ran);
+  static Int_t    RandomPt(Int_t np, Int_t n, Double_t *pt, TRandom *ran);
+
   static Int_t fgSelectedCollisionsSystem;                                                      // selected pT parameter
   static Int_t fgSelectedCentrality;                                                            // selected Centrality
   static Int_t fgSelectedV2Systematic;                                                          // selected v2 systematics, usefully values: -1,0,1
@@ -267,6 +283,10 @@ public:
   static Double_t V2SigmaMi(const Double_t *px, const Double_t *dummy);
 
 private:
+  static GenFunc  PtFunc(Int_t param);
+  static GenFunc  V2Func(Int_t param);
+  static Double_t EvalTable(const std::vector<Double_t> &table, Bool_t logInterpolation, Double_t pt);
+
   static TF1*     fPtParametrization[26];     // pt paramtrizations
   static TF1*     fPtParametrizationProton;   // pt paramtrization
   static TH1D*    fMtFactorHisto;             // mt scaling factors
@@ -274,6 +294,14 @@ private:
   static TF1*     fV2Parametrization[27];     // pt paramtrizations
   static Int_t    fV2RefParameterization[27]; // ID of a hadron used for parameterization of V2 for Et scaling
 
+  static Bool_t   fgUseTables;                // use the tabulated parametrizations
+  static Double_t fgTablePtMin;               // range of the tables
+  static Double_t fgTablePtMax;               //
+  static Int_t    fgTableBins;                // number of intervals of the tables
+  static std::vector<Double_t> fgPtTable[28]; // pt parametrization at the nodes
+  static std::vector<Double_t> fgPtCDF[28];   // cumulative pt distribution at the nodes
+  static std::vector<Double_t> fgV2Table[28]; // v2 at the nodes
+
   ClassDef(AliGenEMlibV2,7);
 };
 
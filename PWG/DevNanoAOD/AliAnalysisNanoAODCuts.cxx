@@ -931,8 +931,8 @@ void AliNanoAODSimpleSetter::SetNanoAODTrack (const AliAODTrack * aodTrack, AliN
 
   // PID
   
-  // Initialize PID track mapping
-  static const Bool_t bPIDFilled = AliNanoAODTrack::InitPIDIndex();
+  // Initialize PID track mapping (cheap after the first call)
+  const Bool_t bPIDFilled = AliNanoAODTrack::InitPIDIndex();
   
   // PID variables
   if (bPIDFilled)
@@ -966,7 +966,11 @@ void AliNanoAODSimpleSetter::SetNanoAODTrack (const AliAODTrack * aodTrack, AliN
 
   // additional fields which are to be moved to AliNanoAODTrack
   // TPC clusters
-  static const Int_t cstTPCClusterInfo21 = AliNanoAODTrackMapping::GetInstance()->GetVarIndex("cstTPCClusterInfo21");
-  if (cstTPCClusterInfo21 != -1)
-    nanoTrack->SetVar(cstTPCClusterInfo21, aodTrack->GetTPCClusterInfo(2,1));
+  // the index is cached per mapping, several outputs with different variables can be filtered
+  if (fTrackMapping != AliNanoAODTrackMapping::GetInstance()) {
+    fTrackMapping = AliNanoAODTrackMapping::GetInstance();
+    fCstTPCClusterInfo21 = AliNanoAODTrackMapping::GetInstance()->GetVarIndex("cstTPCClusterInfo21");
+  }
+  if (fCstTPCClusterInfo21 != -1)
+    nanoTrack->SetVar(fCstTPCClusterInfo21, aodTrack->GetTPCClusterInfo(2,1));
 }
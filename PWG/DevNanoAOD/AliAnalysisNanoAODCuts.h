@@ -8,6 +8,7 @@
 #include <map>
 
 class AliEventCuts;
+class AliNanoAODTrackMapping;
 
 class AliAnalysisNanoAODTrackCuts : public AliAnalysisCuts
 {
@@ -285,7 +286,7 @@ private:
 class AliNanoAODSimpleSetter : public AliNanoAODCustomSetter
 {
 public:
-  AliNanoAODSimpleSetter() : fInitialized(kFALSE), fMultMap() {;}
+  AliNanoAODSimpleSetter() : fInitialized(kFALSE), fMultMap(), fTrackMapping(0), fCstTPCClusterInfo21(-1) {;}
   virtual ~AliNanoAODSimpleSetter(){;}
 
   virtual void SetNanoAODHeader(const AliAODEvent * event   , AliNanoAODHeader * head ,TString varListHeader  );
@@ -296,6 +297,8 @@ protected:
   
   Bool_t fInitialized;
   std::map<TString,int> fMultMap;
+  const AliNanoAODTrackMapping* fTrackMapping; //! mapping of the cached track indices
+  Int_t fCstTPCClusterInfo21;                  //! index of cstTPCClusterInfo21
 
   ClassDef(AliNanoAODSimpleSetter, 2)
 
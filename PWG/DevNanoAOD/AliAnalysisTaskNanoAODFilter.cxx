@@ -28,6 +28,9 @@
 #include "TCanvas.h"
 #include "TList.h"
 
+#include <functional>
+#include <thread>
+
 #include "AliAnalysisTaskSE.h"
 #include "AliAnalysisManager.h"
 #include "AliStack.h"
@@ -63,7 +66,10 @@ AliAnalysisTaskNanoAODFilter::AliAnalysisTaskNanoAODFilter() // All data members
   fNmultBins(100),
   fMinMult(0),
   fMaxMult(100),
-  fNormalisation(0x0)
+  fNormalisation(0x0),
+  fExtraReplicators(),
+  fExtraFileNames(),
+  fParallelTrackSelection(kFALSE)
 
 {
   // Dummy constructor ALWAYS needed for I/O.
@@ -84,7 +90,10 @@ AliAnalysisTaskNanoAODFilter::AliAnalysisTaskNanoAODFilter(const char *name, Boo
    fNmultBins(100),
    fMinMult(0),
    fMaxMult(100),
-   fNormalisation(0x0)
+   fNormalisation(0x0),
+  fExtraReplicators(),
+  fExtraFileNames(),
+  fParallelTrackSelection(kFALSE)
 
 {
   // Constructor
@@ -104,6 +113,8 @@ AliAnalysisTaskNanoAODFilter::~AliAnalysisTaskNanoAODFilter()
   // (the list is owner and will clean-up these histograms). Protect in PROOF case.
   
   delete fReplicator;
+  for (UInt_t i = 0; i < fExtraReplicators.size(); i++)
+    delete fExtraReplicators[i];
   if (fQAOutput) 
     delete fQAOutput;
   delete fNormalisation;
@@ -127,6 +138,11 @@ void AliAnalysisTaskNanoAODFilter::UserCreateOutputObjects()
 }
 
 void AliAnalysisTaskNanoAODFilter::AddFilteredAOD(const char* aodfilename, const char* title)
+{
+  AddFilteredAOD(aodfilename, title, fReplicator);
+}
+
+void AliAnalysisTaskNanoAODFilter::AddFilteredAOD(const char* aodfilename, const char* title, AliNanoAODReplicator* replicator)
 {
   // The replicator is added to the extension
 
@@ -138,16 +154,16 @@ void AliAnalysisTaskNanoAODFilter::AddFilteredAOD(const char* aodfilename, const
     AliFatal("Cannot get extension");
   }
   
-  fReplicator->SetMCMode(fMCMode);
+  replicator->SetMCMode(fMCMode);
      
-  if (!fInputArrayName.IsNull()) fReplicator->SetInputArrayName(fInputArrayName);
-  if (!fOutputArrayName.IsNull()) fReplicator->SetOutputArrayName(fOutputArrayName);
+  if (!fInputArrayName.IsNull()) replicator->SetInputArrayName(fInputArrayName);
+  if (!fOutputArrayName.IsNull()) replicator->SetOutputArrayName(fOutputArrayName);
 
   ext->DropUnspecifiedBranches(); // all branches not part of a FilterBranch call (below) will be dropped
       
-  ext->FilterBranch("tracks",fReplicator);
-  ext->FilterBranch("vertices",fReplicator);  
-  ext->FilterBranch("header",fReplicator);  
+  ext->FilterBranch("tracks",replicator);
+  ext->FilterBranch("vertices",replicator);  
+  ext->FilterBranch("header",replicator);  
             
   if ( fMCMode > 0 ) 
     {
@@ -156,15 +172,35 @@ void AliAnalysisTaskNanoAODFilter::AddFilteredAOD(const char* aodfilename, const
       // For events w/o muon, mcparticles array will be empty and mcheader will be dummy
       // (e.g. strlen(GetGeneratorName())==0)
       
-      ext->FilterBranch("mcparticles",fReplicator);
-      ext->FilterBranch("mcHeader",fReplicator);
+      ext->FilterBranch("mcparticles",replicator);
+      ext->FilterBranch("mcHeader",replicator);
     }
 }
 
+AliNanoAODReplicator* AliAnalysisTaskNanoAODFilter::AddOutput(const char* aodfilename, const char* varListTrack, AliAnalysisCuts* trkCuts, AliNanoAODCustomSetter* setter)
+{
+  // The header variables are taken from the main output, they can be changed on the returned replicator
+
+  AliNanoAODReplicator* replicator = new AliNanoAODReplicator(Form("NanoAODReplicator_%s", aodfilename), "remove non interesting tracks, writes special tracks array tracks");
+  replicator->SetVarListTrack(varListTrack);
+  replicator->SetVarListHeader(fReplicator->GetVarListHeader());
+  replicator->SetTrackCuts(trkCuts);
+  if (setter)
+    replicator->AddCustomSetter(setter);
+  if (fSaveCutsFlag && trkCuts)
+    fQAOutput->Add(trkCuts);
+
+  fExtraReplicators.push_back(replicator);
+  fExtraFileNames.push_back(aodfilename);
+  return replicator;
+}
+
 void AliAnalysisTaskNanoAODFilter::Init()
 {
   // Initialization
   AddFilteredAOD("AliAOD.NanoAOD.root", "NanoAODTracksEvents");
+  for (UInt_t i = 0; i < fExtraReplicators.size(); i++)
+    AddFilteredAOD(fExtraFileNames[i], "NanoAODTracksEvents", fExtraReplicators[i]);
 }
 
 void AliAnalysisTaskNanoAODFilter::UserExec(Option_t *) 
@@ -198,14 +234,27 @@ void AliAnalysisTaskNanoAODFilter::UserExec(Option_t *)
   } else
     fNormalisation->FillSelected(kTRUE, kTRUE, kTRUE, kTRUE, 0);
 
+  if (fParallelTrackSelection && !fExtraReplicators.empty()) {
+    // only the track cuts run concurrently, the NanoAOD tracks are built one output after the other
+    // (the track mapping is a singleton and the output arrays are not thread safe)
+    std::vector<std::thread> threads;
+    threads.emplace_back(&AliNanoAODReplicator::PreselectTracks, fReplicator, std::cref(*lAODevent));
+    for (UInt_t i = 0; i < fExtraReplicators.size(); i++)
+      threads.emplace_back(&AliNanoAODReplicator::PreselectTracks, fExtraReplicators[i], std::cref(*lAODevent));
+    for (UInt_t i = 0; i < threads.size(); i++)
+      threads[i].join();
+  }
+
   AliAODHandler* handler = dynamic_cast<AliAODHandler*>(AliAnalysisManager::GetAnalysisManager()->GetOutputEventHandler());
   if ( handler ){
-    AliAODExtension *extNanoAOD = handler->GetFilteredAOD("AliAOD.NanoAOD.root");
-   if ( extNanoAOD ) {				
-     extNanoAOD->SetEvent(lAODevent);
-     extNanoAOD->SelectEvent();
-     extNanoAOD->FinishEvent();
-   }
+    for (Int_t i = -1; i < (Int_t) fExtraFileNames.size(); i++) {
+      AliAODExtension *extNanoAOD = handler->GetFilteredAOD(i < 0 ? "AliAOD.NanoAOD.root" : fExtraFileNames[i].Data());
+      if ( extNanoAOD ) {				
+        extNanoAOD->SetEvent(lAODevent);
+        extNanoAOD->SelectEvent();
+        extNanoAOD->FinishEvent();
+      }
+    }
   }
 }
 
@@ -217,8 +266,16 @@ void AliAnalysisTaskNanoAODFilter::FinishTaskOutput() {
 
   // We save here the user info
 
+  AddUserInfo("AliAOD.NanoAOD.root", fReplicator, kFALSE);
+  // the mapping is cloned, the same variable list may be used by several outputs
+  for (UInt_t i = 0; i < fExtraReplicators.size(); i++)
+    AddUserInfo(fExtraFileNames[i], fExtraReplicators[i], kTRUE);
+}
+
+void AliAnalysisTaskNanoAODFilter::AddUserInfo(const char* aodfilename, AliNanoAODReplicator* replicator, Bool_t cloneMapping)
+{
   AliAODHandler* handler = dynamic_cast<AliAODHandler*>(AliAnalysisManager::GetAnalysisManager()->GetOutputEventHandler());
-  AliAODExtension *extNanoAOD = handler->GetFilteredAOD("AliAOD.NanoAOD.root");
+  AliAODExtension *extNanoAOD = handler->GetFilteredAOD(aodfilename);
 
   // copy production version info
   AliVEventHandler* inputHandler = AliAnalysisManager::GetAnalysisManager()->GetInputEventHandler();
@@ -229,8 +286,9 @@ void AliAnalysisTaskNanoAODFilter::FinishTaskOutput() {
   }
   
   Printf("****************************************************************");
-  extNanoAOD->GetTree()->GetUserInfo()->Add(AliNanoAODTrackMapping::GetInstance(fReplicator->GetVarListTrack()));
-  AliNanoAODTrackMapping::GetInstance()->Print();
+  AliNanoAODTrackMapping* mapping = AliNanoAODTrackMapping::Select(replicator->GetVarListTrack());
+  extNanoAOD->GetTree()->GetUserInfo()->Add(cloneMapping ? mapping->Clone() : mapping);
+  mapping->Print();
   Printf("****************************************************************");
   
   extNanoAOD->GetTree()->GetUserInfo()->Add(fNormalisation->Clone());
@@ -23,6 +23,7 @@ class AliNanoFilterNormalisation;
 #include "AliNanoAODTrack.h"
 #include "AliPID.h"
 #include <list>
+#include <vector>
 
 class AliAnalysisTaskNanoAODFilter : public AliAnalysisTaskSE {
 public:
@@ -41,6 +42,12 @@ public:
   void  SetMCMode (Int_t var) { fMCMode = var;}
   void  AddFilteredAOD(const char* aodfilename, const char* title);
 
+  // Additional NanoAOD written in the same pass, with its own track cuts, variables and setter.
+  // The event cuts are shared. The returned replicator can be configured further (V0s, header variables...).
+  AliNanoAODReplicator* AddOutput(const char* aodfilename, const char* varListTrack, AliAnalysisCuts* trkCuts = 0, AliNanoAODCustomSetter* setter = 0);
+  // evaluate the track cuts of the outputs concurrently, one thread per output; only for cut objects without side effects
+  void  SetParallelTrackSelection(Bool_t var) { fParallelTrackSelection = var; }
+
   void  AddEvtCuts     (AliAnalysisCuts * var           ) { fEvtCuts.push_back(var);}
   void  SetTrkCuts     (AliAnalysisCuts * var           ) { fReplicator->SetTrackCuts(var); if (fSaveCutsFlag) fQAOutput->Add(var);}
   void  AddSetter      (AliNanoAODCustomSetter * var    ) { fReplicator->AddCustomSetter(var); }
@@ -51,6 +58,7 @@ public:
   void  SetVarFiredTriggerClasses (TString var          ) { fReplicator->SetVarListHeaderTC(var);}
   void  SaveVzero(Bool_t var)                             { fReplicator->SetSaveVzero(var); }
   void  SaveZDC(Bool_t var)                               { fReplicator->SetSaveZDC(var); }
+  void  SaveColumnarTracks(Bool_t var)                    { fReplicator->SetSaveColumnarTracks(var); } // in addition one branch per track variable, see AliNanoAODColumn
   void  SaveV0s(Bool_t var, AliAnalysisCuts* v0Cuts = 0)  { fReplicator->SetSaveV0s(var); fReplicator->SetV0Cuts(v0Cuts); if (fSaveCutsFlag && v0Cuts) fQAOutput->Add(v0Cuts); }
   void  SaveCascades(Bool_t var, AliAnalysisCuts* cuts = 0) { fReplicator->SetSaveCascades(var); fReplicator->SetCascadeCuts(cuts); if (fSaveCutsFlag && cuts) fQAOutput->Add(cuts); }
   void  SaveConversionPhotons(Bool_t var, AliAnalysisCuts* cuts = 0) { fReplicator->SetSaveConversionPhotons(var); fReplicator->SetConversionPhotonCuts(cuts); if (fSaveCutsFlag && cuts) fQAOutput->Add(cuts); }
@@ -89,10 +97,17 @@ protected:
   Float_t fMinMult;     // min value of the axis of normalisation historgram
   Float_t fMaxMult;     // min value of the axis of normalisation historgram
 
+  std::vector<AliNanoAODReplicator*> fExtraReplicators; // replicators of the additional outputs
+  std::vector<TString> fExtraFileNames;                 // file names of the additional outputs
+  Bool_t fParallelTrackSelection;                       // evaluate the track cuts of all the outputs in parallel
+
+  void AddFilteredAOD(const char* aodfilename, const char* title, AliNanoAODReplicator* replicator);
+  void AddUserInfo(const char* aodfilename, AliNanoAODReplicator* replicator, Bool_t cloneMapping);
+
   AliAnalysisTaskNanoAODFilter(const AliAnalysisTaskNanoAODFilter&); // not implemented
   AliAnalysisTaskNanoAODFilter& operator=(const AliAnalysisTaskNanoAODFilter&); // not implemented
 
-  ClassDef(AliAnalysisTaskNanoAODFilter, 9); // Nano AOD Filter Task
+  ClassDef(AliAnalysisTaskNanoAODFilter, 10); // Nano AOD Filter Task
 };
 
 #endif
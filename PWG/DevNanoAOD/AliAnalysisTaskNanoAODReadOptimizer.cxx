@@ -0,0 +1,179 @@
+#include "AliAnalysisTaskNanoAODReadOptimizer.h"
+#include <AliAnalysisManager.h>
+#include <AliInputEventHandler.h>
+#include <AliLog.h>
+#include <AliVEvent.h>
+
+#include "AliNanoAODColumn.h"
+#include "AliNanoAODTrackMapping.h"
+
+#include <TBranch.h>
+#include <TChain.h>
+#include <TFile.h>
+#include <TMath.h>
+#include <TRegexp.h>
+#include <TTree.h>
+
+ClassImp(AliAnalysisTaskNanoAODReadOptimizer)
+
+AliAnalysisTaskNanoAODReadOptimizer::AliAnalysisTaskNanoAODReadOptimizer(std::string taskName) : AliAnalysisTaskSE{taskName.data()},
+  fLearnEvents{100},
+  fCacheClusters{1},
+  fArrayName{"tracks"},
+  fDisabledBranches{},
+  fKeptBranches{},
+  fEvents{0},
+  fOptimized{false}
+{
+  DefineInput(0, TChain::Class());
+}
+
+void AliAnalysisTaskNanoAODReadOptimizer::UserCreateOutputObjects() {
+  // the other tasks of the train read their columns starting from the first event
+  AliNanoAODColumnarView::ResetAccessedColumns();
+  AliNanoAODColumnarView::SetRecordAccess(kTRUE);
+}
+
+Bool_t AliAnalysisTaskNanoAODReadOptimizer::UserNotify() {
+  // the branch status is kept by the chain, the cache is set up again for every file
+  if (fOptimized) {
+    TTree* tree = GetInputTree();
+    if (tree)
+      SetCache(tree);
+  }
+  return kTRUE;
+}
+
+void AliAnalysisTaskNanoAODReadOptimizer::UserExec(Option_t *) {
+  if (fOptimized)
+    return;
+  if (++fEvents > fLearnEvents)
+    Optimize();
+}
+
+TTree* AliAnalysisTaskNanoAODReadOptimizer::GetInputTree() const {
+  AliInputEventHandler* handler = dynamic_cast<AliInputEventHandler*>(AliAnalysisManager::GetAnalysisManager()->GetInputEventHandler());
+  if (!handler) {
+    AliError("Missing input handler");
+    return nullptr;
+  }
+  return handler->GetTree();
+}
+
+void AliAnalysisTaskNanoAODReadOptimizer::Optimize() {
+  fOptimized = true;
+  AliNanoAODColumnarView::SetRecordAccess(kFALSE);
+
+  TTree* tree = GetInputTree();
+  if (!tree) {
+    AliError("Missing input tree, reading all the branches");
+    return;
+  }
+
+  auto isKept = [this](const TString& name) {
+    for (const auto& kept : fKeptBranches)
+      if (name == kept || name.Index(TRegexp(kept, kTRUE)) == 0)
+        return true;
+    return false;
+  };
+  auto disable = [this, tree](const char* name) {
+    tree->SetBranchStatus(name, 0);
+    // the object keeps the content of the last entry read, drop it
+    TObject* obj = InputEvent() ? InputEvent()->FindListObject(name) : nullptr;
+    if (obj)
+      obj->Clear();
+  };
+
+  // track columns not read in the learning events
+  AliNanoAODTrackMapping* mapping = AliNanoAODTrackMapping::GetInstance();
+  const std::set<TString>& accessed = AliNanoAODColumnarView::GetAccessedColumns();
+  Int_t nColumns = 0;
+  Int_t nDisabled = 0;
+  if (mapping) {
+    std::vector<TString> columns;
+    for (Int_t i = 0; i < mapping->GetSize(); i++)
+      columns.push_back(AliNanoAODColumn::GetColumnName(fArrayName, mapping->GetVarName(i)));
+    for (Int_t i = 0; i < mapping->GetSizeInt(); i++)
+      columns.push_back(AliNanoAODColumn::GetColumnName(fArrayName, mapping->GetVarNameInt(i)));
+    for (const auto& column : columns) {
+      if (!tree->GetBranch(column))
+        continue;
+      nColumns++;
+      if (accessed.count(column) || isKept(column))
+        continue;
+      disable(column);
+      nDisabled++;
+    }
+  }
+  if (nColumns > 0)
+    AliInfo(Form("%d of the %d track columns not read in the first %d events, switched off", nDisabled, nColumns, fLearnEvents));
+  else
+    AliInfo(Form("No track columns in the input, the %s branch is read in full", fArrayName.Data()));
+
+  for (const auto& name : fDisabledBranches) {
+    disable(name);
+    AliInfo(Form("Branch %s switched off", name.Data()));
+  }
+
+  SetCache(tree);
+}
+
+void AliAnalysisTaskNanoAODReadOptimizer::SetCache(TTree* tree) {
+  // cache size from the compressed bytes of the active branches of the current file
+  TTree* current = tree->GetTree();
+  if (!current || current->GetEntries() <= 0)
+    return;
+
+  Long64_t zipActive = 0;
+  Long64_t zipAll = 0;
+  std::vector<TString> active;
+  TIter next(current->GetListOfBranches());
+  while (TBranch* branch = (TBranch*) next()) {
+    const Long64_t zip = branch->GetZipBytes("*");
+    zipAll += zip;
+    if (!current->GetBranchStatus(branch->GetName()))
+      continue;
+    zipActive += zip;
+    active.push_back(branch->GetName());
+  }
+  if (zipActive <= 0)
+    return;
+
+  // entries per cluster, the auto flush is given in bytes if negative
+  Long64_t clusterEntries = current->GetAutoFlush();
+  if (clusterEntries < 0)
+    clusterEntries = -clusterEntries * current->GetEntries() / TMath::Max(zipAll, 1LL);
+  if (clusterEntries <= 0)
+    clusterEntries = fLearnEvents;
+  clusterEntries = TMath::Min(clusterEntries, current->GetEntries());
+
+  const Long64_t cacheSize = zipActive / current->GetEntries() * clusterEntries * fCacheClusters;
+  tree->SetCacheSize(TMath::Max(cacheSize, 1024LL));
+  for (const auto& name : active)
+    tree->AddBranchToCache(name, kTRUE);
+  tree->StopCacheLearningPhase();
+
+  AliInfo(Form("%s: %d active branches, %.1f of %.1f MB, cache of %.1f MB", current->GetCurrentFile() ? current->GetCurrentFile()->GetName() : current->GetName(),
+               (Int_t) active.size(), zipActive / 1.e6, zipAll / 1.e6, cacheSize / 1.e6));
+}
+
+AliAnalysisTaskNanoAODReadOptimizer* AliAnalysisTaskNanoAODReadOptimizer::AddTask(std::string name, Int_t learnEvents) {
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  if (!mgr) {
+    ::Error("AliAnalysisTaskNanoAODReadOptimizer::AddTask", "No analysis manager to connect to.");
+    return nullptr;
+  }
+
+  if (!mgr->GetInputEventHandler()) {
+    ::Error("AliAnalysisTaskNanoAODReadOptimizer::AddTask", "This task requires an input event handler");
+    return nullptr;
+  }
+
+  AliAnalysisTaskNanoAODReadOptimizer *task = new AliAnalysisTaskNanoAODReadOptimizer(name);
+  task->SetLearnEvents(learnEvents);
+  mgr->AddTask(task);
+
+  mgr->ConnectInput(task, 0, mgr->GetCommonInputContainer());
+
+  return task;
+}
@@ -0,0 +1,56 @@
+#ifndef AliAnalysisTaskNanoAODReadOptimizer_H
+#define AliAnalysisTaskNanoAODReadOptimizer_H
+
+// Learns which branches of the NanoAOD input the analyses of the train
+// read in the first events, switches off the others and sizes the
+// TTreeCache to the footprint of the remaining branches.
+//
+// The track columns (see AliNanoAODColumn) are learnt automatically from
+// the accesses through AliNanoAODColumnarView. Event level branches can
+// not be traced and are switched off explicitly with DisableBranch(),
+// KeepBranch() protects columns which are read only in rare events.
+
+#include "AliAnalysisTaskSE.h"
+
+#include <TString.h>
+
+#include <vector>
+
+class TTree;
+
+class AliAnalysisTaskNanoAODReadOptimizer : public AliAnalysisTaskSE {
+  public:
+  AliAnalysisTaskNanoAODReadOptimizer(std::string taskName = "AliAnalysisTaskNanoAODReadOptimizer");
+  virtual ~AliAnalysisTaskNanoAODReadOptimizer() {}
+
+  virtual void UserCreateOutputObjects();
+  virtual Bool_t UserNotify();
+  virtual void UserExec(Option_t *);
+
+  void SetLearnEvents(Int_t n) { fLearnEvents = n; }
+  void SetCacheClusters(Int_t n) { fCacheClusters = n; }
+  void SetTracksArrayName(const char* name) { fArrayName = name; }
+  // branch names, wildcards as in TTree::SetBranchStatus
+  void DisableBranch(const char* name) { fDisabledBranches.push_back(name); }
+  void KeepBranch(const char* name) { fKeptBranches.push_back(name); }
+
+  static AliAnalysisTaskNanoAODReadOptimizer* AddTask(std::string name = "AliAnalysisTaskNanoAODReadOptimizer", Int_t learnEvents = 100);
+
+  private:
+  TTree* GetInputTree() const;
+  void Optimize();
+  void SetCache(TTree* tree);
+
+  Int_t fLearnEvents;                      // number of events to learn the accessed columns from
+  Int_t fCacheClusters;                    // number of clusters of the active branches held in the cache
+  TString fArrayName;                      // tracks array the columns belong to
+  std::vector<TString> fDisabledBranches;  // branches switched off after the learning
+  std::vector<TString> fKeptBranches;      // columns kept even if not read while learning
+
+  Int_t fEvents;                           //! events processed so far
+  Bool_t fOptimized;                       //! learning done, branches switched off
+
+  ClassDef(AliAnalysisTaskNanoAODReadOptimizer, 1);
+};
+
+#endif
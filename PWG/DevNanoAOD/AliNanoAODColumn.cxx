@@ -0,0 +1,124 @@
+#include "AliNanoAODColumn.h"
+
+#include "AliVEvent.h"
+#include "AliLog.h"
+#include "AliNanoAODTrackMapping.h"
+
+ClassImp(AliNanoAODColumn)
+
+Bool_t AliNanoAODColumnarView::fgRecordAccess = kFALSE;
+std::set<TString> AliNanoAODColumnarView::fgAccessedColumns;
+
+AliNanoAODColumn::AliNanoAODColumn():
+  TNamed(),
+  fIsInt(kFALSE),
+  fValues(),
+  fIntValues()
+{
+  // default ctor
+}
+
+AliNanoAODColumn::AliNanoAODColumn(const char* name, Bool_t isInt):
+  TNamed(name, name),
+  fIsInt(isInt),
+  fValues(),
+  fIntValues()
+{
+  // ctor
+}
+
+void AliNanoAODColumn::Clear(Option_t* /*opt*/)
+{
+  // drop the values of the previous event, keeping the allocated memory
+  fValues.clear();
+  fIntValues.clear();
+}
+
+AliNanoAODColumnarView::AliNanoAODColumnarView(const char* arrayName):
+  fArrayName(arrayName),
+  fNames(),
+  fNamesInt(),
+  fNTracks(0),
+  fColumns(),
+  fIntColumns(),
+  fLabels(0x0),
+  fFlags(0x0)
+{
+  // ctor
+}
+
+void AliNanoAODColumnarView::InitNames()
+{
+  // build the column names once from the track mapping
+  AliNanoAODTrackMapping* mapping = AliNanoAODTrackMapping::GetInstance();
+  if (!mapping)
+    return;
+
+  fNames.resize(mapping->GetSize());
+  for (Int_t i = 0; i < mapping->GetSize(); i++)
+    fNames[i] = AliNanoAODColumn::GetColumnName(fArrayName, mapping->GetVarName(i));
+  fNamesInt.resize(mapping->GetSizeInt());
+  for (Int_t i = 0; i < mapping->GetSizeInt(); i++)
+    fNamesInt[i] = AliNanoAODColumn::GetColumnName(fArrayName, mapping->GetVarNameInt(i));
+
+  fColumns.assign(fNames.size(), 0x0);
+  fIntColumns.assign(fNamesInt.size(), 0x0);
+}
+
+Bool_t AliNanoAODColumnarView::Attach(const AliVEvent* event)
+{
+  // point to the columns of the event, to be called once per event.
+  // Returns kFALSE if the event does not hold columnar tracks.
+
+  fNTracks = 0;
+  fLabels = 0x0;
+  fFlags = 0x0;
+  if (fNames.empty() && fNamesInt.empty())
+    InitNames();
+  fColumns.assign(fNames.size(), 0x0);
+  fIntColumns.assign(fNamesInt.size(), 0x0);
+
+  if (!event)
+    return kFALSE;
+
+  AliNanoAODColumn* labels = dynamic_cast<AliNanoAODColumn*> (event->FindListObject(AliNanoAODColumn::GetColumnName(fArrayName, "label")));
+  if (!labels)
+    return kFALSE;
+  fNTracks = labels->GetSize();
+  fLabels = labels->GetIntValues();
+
+  AliNanoAODColumn* flags = dynamic_cast<AliNanoAODColumn*> (event->FindListObject(AliNanoAODColumn::GetColumnName(fArrayName, "flags")));
+  if (flags)
+    fFlags = flags->GetIntValues();
+
+  for (UInt_t i = 0; i < fNames.size(); i++) {
+    AliNanoAODColumn* column = dynamic_cast<AliNanoAODColumn*> (event->FindListObject(fNames[i]));
+    if (column && column->GetSize() == fNTracks)
+      fColumns[i] = column->GetValues();
+  }
+  for (UInt_t i = 0; i < fNamesInt.size(); i++) {
+    AliNanoAODColumn* column = dynamic_cast<AliNanoAODColumn*> (event->FindListObject(fNamesInt[i]));
+    if (column && column->GetSize() == fNTracks)
+      fIntColumns[i] = column->GetIntValues();
+  }
+
+  return kTRUE;
+}
+
+const Float_t* AliNanoAODColumnarView::GetColumn(const char* varName) const
+{
+  AliNanoAODTrackMapping* mapping = AliNanoAODTrackMapping::GetInstance();
+  return mapping ? GetColumn(mapping->GetVarIndex(varName)) : 0x0;
+}
+
+const Int_t* AliNanoAODColumnarView::GetIntColumn(const char* varName) const
+{
+  AliNanoAODTrackMapping* mapping = AliNanoAODTrackMapping::GetInstance();
+  return mapping ? GetIntColumn(mapping->GetVarIndex(varName)) : 0x0;
+}
+
+void AliNanoAODColumnarView::RecordAccess(const std::vector<TString>& names, Int_t index)
+{
+  if (index >= 0 && index < (Int_t) names.size())
+    fgAccessedColumns.insert(names[index]);
+}
@@ -0,0 +1,107 @@
+#ifndef _ALINANOAODCOLUMN_H_
+#define _ALINANOAODCOLUMN_H_
+
+// AliNanoAODColumn, AliNanoAODColumnarView
+
+// Columnar (struct of arrays) storage of the NanoAOD tracks. Each
+// variable of the track mapping is written in its own branch, holding
+// the values of all the tracks of the event contiguously, in the same
+// order as the tracks array. The columns are named
+// <tracks array>_<variable>, the MC label and the nano flags are stored
+// in the <tracks array>_label and <tracks array>_flags columns.
+//
+// AliNanoAODColumnarView gives read-only access to the columns of the
+// current event without copying them, e.g.
+//
+//   AliNanoAODColumnarView view;
+//   if (view.Attach(InputEvent())) {
+//     const Float_t* pt = view.GetColumn("pt");
+//     for (Int_t i = 0; i < view.GetNTracks(); i++) ... pt[i] ...
+//   }
+//
+// While SetRecordAccess(kTRUE) is active the names of the columns read
+// through any view are collected, see AliAnalysisTaskNanoAODReadOptimizer.
+
+#include "TNamed.h"
+#include "TString.h"
+
+#include <set>
+#include <vector>
+
+class AliVEvent;
+
+class AliNanoAODColumn : public TNamed
+{
+public:
+  AliNanoAODColumn();
+  AliNanoAODColumn(const char* name, Bool_t isInt);
+  virtual ~AliNanoAODColumn() {;}
+
+  virtual void Clear(Option_t* opt = "");
+
+  static TString GetColumnName(const char* arrayName, const char* varName) { return TString::Format("%s_%s", arrayName, varName); }
+
+  Bool_t IsInt() const { return fIsInt; }
+  Int_t GetSize() const { return fIsInt ? fIntValues.size() : fValues.size(); }
+  const Float_t* GetValues() const { return fValues.empty() ? 0x0 : &fValues[0]; }
+  const Int_t* GetIntValues() const { return fIntValues.empty() ? 0x0 : &fIntValues[0]; }
+
+  void Reserve(Int_t n) { if (fIsInt) fIntValues.reserve(n); else fValues.reserve(n); }
+  void Add(Float_t value) { fValues.push_back(value); }
+  void AddInt(Int_t value) { fIntValues.push_back(value); }
+
+private:
+  Bool_t fIsInt;                    // true if the column holds integer values
+  std::vector<Float_t> fValues;     // values of the tracks of the event
+  std::vector<Int_t> fIntValues;    // integer values of the tracks of the event
+
+  ClassDef(AliNanoAODColumn, 1)
+};
+
+class AliNanoAODColumnarView
+{
+public:
+  AliNanoAODColumnarView(const char* arrayName = "tracks");
+  virtual ~AliNanoAODColumnarView() {;}
+
+  Bool_t Attach(const AliVEvent* event);
+
+  Int_t GetNTracks() const { return fNTracks; }
+
+  // by index of the track mapping, 0x0 if the variable was not stored
+  const Float_t* GetColumn(Int_t index) const { if (fgRecordAccess) RecordAccess(fNames, index); return (index >= 0 && index < (Int_t) fColumns.size()) ? fColumns[index] : 0x0; }
+  const Int_t* GetIntColumn(Int_t index) const { if (fgRecordAccess) RecordAccess(fNamesInt, index); return (index >= 0 && index < (Int_t) fIntColumns.size()) ? fIntColumns[index] : 0x0; }
+  // by variable name, resolved through the track mapping
+  const Float_t* GetColumn(const char* varName) const;
+  const Int_t* GetIntColumn(const char* varName) const;
+
+  const Int_t* GetLabels() const { return fLabels; }
+  const Int_t* GetFlags() const { return fFlags; }
+
+  Float_t GetValue(Int_t index, Int_t track) const { if (fgRecordAccess) RecordAccess(fNames, index); return fColumns[index][track]; }
+  Int_t GetIntValue(Int_t index, Int_t track) const { if (fgRecordAccess) RecordAccess(fNamesInt, index); return fIntColumns[index][track]; }
+
+  // names of the columns read since the recording was switched on
+  static void SetRecordAccess(Bool_t record) { fgRecordAccess = record; }
+  static Bool_t GetRecordAccess() { return fgRecordAccess; }
+  static const std::set<TString>& GetAccessedColumns() { return fgAccessedColumns; }
+  static void ResetAccessedColumns() { fgAccessedColumns.clear(); }
+
+private:
+  void InitNames();
+  static void RecordAccess(const std::vector<TString>& names, Int_t index);
+
+  static Bool_t fgRecordAccess;               // collect the names of the columns which are read
+  static std::set<TString> fgAccessedColumns; // columns read while recording
+
+  TString fArrayName;                    //! name of the tracks array the columns belong to
+  std::vector<TString> fNames;           //! column names of the float variables
+  std::vector<TString> fNamesInt;        //! column names of the integer variables
+  Int_t fNTracks;                        //! number of tracks in the attached event
+  std::vector<const Float_t*> fColumns;  //! float columns of the attached event
+  std::vector<const Int_t*> fIntColumns; //! integer columns of the attached event
+  const Int_t* fLabels;                  //! label column of the attached event
+  const Int_t* fFlags;                   //! flags column of the attached event
+};
+
+#endif /* _ALINANOAODCOLUMN_H_ */
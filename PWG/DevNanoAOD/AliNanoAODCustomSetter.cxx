@@ -1,3 +1,32 @@
 #include "AliNanoAODCustomSetter.h"
 
+#include "AliNanoAODTrackMapping.h"
+
 ClassImp(AliNanoAODCustomSetter)
+
+void AliNanoAODCustomSetter::SetNanoAODTracks(Int_t nTracks, const AliAODTrack * const * aodTracks, AliNanoAODTrack * const * spTracks)
+{
+  // Set the custom variables of all the stored tracks of the event
+  for (Int_t i = 0; i < nTracks; i++)
+    SetNanoAODTrack(aodTracks[i], spTracks[i]);
+}
+
+Int_t AliNanoAODCustomSetter::AddTrackVariable(const char * varName)
+{
+  // Declare a track variable set by this setter, returns the id to be used with GetTrackVarIndex()
+  fTrackVarNames.push_back(varName);
+  fTrackMapping = 0;
+  return fTrackVarNames.size() - 1;
+}
+
+void AliNanoAODCustomSetter::UpdateTrackVarIndexes()
+{
+  // Resolve the declared variables when the track mapping changes (e.g. for several outputs)
+  AliNanoAODTrackMapping * mapping = AliNanoAODTrackMapping::GetInstance();
+  if (mapping == fTrackMapping)
+    return;
+  fTrackMapping = mapping;
+  fTrackVarIndexes.resize(fTrackVarNames.size());
+  for (UInt_t i = 0; i < fTrackVarNames.size(); i++)
+    fTrackVarIndexes[i] = mapping ? mapping->GetVarIndex(fTrackVarNames[i]) : -1;
+}
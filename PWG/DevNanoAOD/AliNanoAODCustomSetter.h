@@ -5,26 +5,49 @@
 
 // Virtual class which implements the basic interface for setting
 // custom variables in special tracks and headers
+//
+// The track variables set by a setter can be declared once with
+// AddTrackVariable(), their indexes in the current track mapping are
+// then returned by GetTrackVarIndex() without name lookups.
+// SetNanoAODTracks() receives all the stored tracks of the event at
+// once; the default calls SetNanoAODTrack() for each of them, setters
+// override it to process the tracks together.
 
 // Author: Michele Floris, michele.floris@cern.ch
 
 #include "TNamed.h"
+#include "TString.h"
+
+#include <vector>
 
 class AliAODEvent;
 class AliAODTrack;
 class AliNanoAODHeader;
 class AliNanoAODTrack;
+class AliNanoAODTrackMapping;
 
 
 class AliNanoAODCustomSetter : public TNamed
 {
 public:
-  AliNanoAODCustomSetter(const char * name = "AliNanoAODCustomSetter") : TNamed(name,name) {;}
+  AliNanoAODCustomSetter(const char * name = "AliNanoAODCustomSetter") : TNamed(name,name), fTrackVarNames(), fTrackVarIndexes(), fTrackMapping(0) {;}
   virtual ~AliNanoAODCustomSetter() {;}
   virtual void SetNanoAODHeader(const AliAODEvent * event   , AliNanoAODHeader * head , TString varListHeader  ) =0;
   virtual void SetNanoAODTrack (const AliAODTrack * aodTrack, AliNanoAODTrack * spTrack) =0;
+  virtual void SetNanoAODTracks(Int_t nTracks, const AliAODTrack * const * aodTracks, AliNanoAODTrack * const * spTracks);
+
+protected:
+  Int_t AddTrackVariable(const char * varName);
+  Int_t GetTrackVarIndex(Int_t var) { UpdateTrackVarIndexes(); return fTrackVarIndexes[var]; }
+
+private:
+  void UpdateTrackVarIndexes();
+
+  std::vector<TString> fTrackVarNames;      //! declared track variables
+  std::vector<Int_t> fTrackVarIndexes;      //! their indexes in fTrackMapping, -1 if not in the mapping
+  AliNanoAODTrackMapping * fTrackMapping;   //! mapping the indexes were resolved with
 
-  ClassDef(AliNanoAODCustomSetter, 1)
+  ClassDef(AliNanoAODCustomSetter, 2)
 };
 
 
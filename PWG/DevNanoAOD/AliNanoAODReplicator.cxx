@@ -70,6 +70,7 @@ class AliAODRecoDecay;
 #include "AliNanoAODCustomSetter.h"
 #include "AliV0ReaderV1.h"
 #include "AliAnalysisNanoAODCuts.h"
+#include "AliNanoAODColumn.h"
 
 using std::cout;
 using std::endl;
@@ -102,17 +103,23 @@ AliAODBranchReplicator(),
   fV0s(0x0),
   fCascades(0x0),
   fConversionPhotons(0x0),
+  fColumns(0x0),
   fSaveZDC(0),
   fSaveVzero(0),
   fSaveV0s(0),
   fSaveCascades(kFALSE),
   fSaveConversionPhotons(kFALSE),
+  fSaveColumnarTracks(kFALSE),
   fPhotonFromDeltas(kFALSE),
   fDeltaAODBranchName(""),
   fInputArrayName(""),
   fOutputArrayName("tracks"),
   fKeepDaughters(),
-  fClonedVertices()
+  fClonedVertices(),
+  fTrackSelection(),
+  fTrackSelectionDone(kFALSE),
+  fSetterAODTracks(),
+  fSetterNanoTracks()
   {
   // Default ctor. we need it to avoid instantiating a wrong mapping when reading from file
   }
@@ -142,17 +149,23 @@ AliNanoAODReplicator::AliNanoAODReplicator(const char* name, const char* title)
   fV0s(0x0),
   fCascades(0x0),
   fConversionPhotons(0x0),
+  fColumns(0x0),
   fSaveZDC(0),
   fSaveVzero(0),
   fSaveV0s(0),
   fSaveCascades(kFALSE),
   fSaveConversionPhotons(kFALSE),
+  fSaveColumnarTracks(kFALSE),
   fPhotonFromDeltas(kFALSE),
   fDeltaAODBranchName(""),
   fInputArrayName(""),
   fOutputArrayName("tracks"),
   fKeepDaughters(),
-  fClonedVertices()
+  fClonedVertices(),
+  fTrackSelection(),
+  fTrackSelectionDone(kFALSE),
+  fSetterAODTracks(),
+  fSetterNanoTracks()
 {
   // default ctor
 }
@@ -163,6 +176,7 @@ AliNanoAODReplicator::~AliNanoAODReplicator()
   // dtor
   delete fTrackCuts;
   delete fList;
+  delete fColumns;
 }
 
 //_____________________________________________________________________________
@@ -564,7 +578,7 @@ TList* AliNanoAODReplicator::GetList() const
       // sanity checks
       if (fSaveConversionPhotons) {
         // check if id field is in fVarList
-        AliNanoAODTrackMapping::GetInstance(fVarList);
+        AliNanoAODTrackMapping::Select(fVarList);
         if (AliNanoAODTrackMapping::GetInstance()->GetVarIndex("ID") == -1)
           AliFatal("Conversion Photons requested but field 'id' missing in track variables");
       }
@@ -628,6 +642,21 @@ TList* AliNanoAODReplicator::GetList() const
       fVertices = new TClonesArray("AliAODVertex",2);
       fVertices->SetName("vertices");    
       fList->Add(fVertices);
+
+      if (fSaveColumnarTracks) {
+        // one branch per variable, the list owns the columns
+        AliNanoAODTrackMapping* mapping = AliNanoAODTrackMapping::Select(fVarList);
+        fColumns = new TObjArray(mapping->GetSize() + mapping->GetSizeInt() + 2);
+        for (Int_t i = 0; i < mapping->GetSize(); i++)
+          fColumns->Add(new AliNanoAODColumn(AliNanoAODColumn::GetColumnName(fOutputArrayName, mapping->GetVarName(i)), kFALSE));
+        for (Int_t i = 0; i < mapping->GetSizeInt(); i++)
+          fColumns->Add(new AliNanoAODColumn(AliNanoAODColumn::GetColumnName(fOutputArrayName, mapping->GetVarNameInt(i)), kTRUE));
+        fColumns->Add(new AliNanoAODColumn(AliNanoAODColumn::GetColumnName(fOutputArrayName, "label"), kTRUE));
+        fColumns->Add(new AliNanoAODColumn(AliNanoAODColumn::GetColumnName(fOutputArrayName, "flags"), kTRUE));
+        TIter nextColumn(fColumns);
+        while (TObject* column = nextColumn())
+          fList->Add(column);
+      }
     
       if ( fMCMode > 0 )
       {
@@ -661,6 +690,9 @@ AliAODVertex* AliNanoAODReplicator::CloneAndStoreVertex(AliAODVertex* toClone)
 void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
 {
   // Replicate (and filter if filters are there) the relevant parts we're interested in AODEvent
+
+  // several replicators with different track variables may run in the same job
+  AliNanoAODTrackMapping::Select(fVarList);
   
   fTracks->Clear("C");
   
@@ -823,9 +855,14 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
   }
   
   std::map<TObject*, AliNanoAODTrack*> trackAssociation;
+
+  const Bool_t usePreselection = fTrackSelectionDone && (Int_t) fTrackSelection.size() == entries;
+  fTrackSelectionDone = kFALSE;
   
   // Tracks
   Int_t ntracks(0);
+  fSetterAODTracks.clear();
+  fSetterNanoTracks.clear();
   for(Int_t j=0; j<entries; j++) {
     AliVTrack *track = 0x0;
     if (particleArray) track = (AliVTrack*)particleArray->At(j);
@@ -834,7 +871,9 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
     AliAODTrack *aodtrack = (AliAODTrack*) track;
 
     Bool_t selected = kFALSE;
-    if (!fTrackCuts || fTrackCuts->IsSelected(aodtrack)) 
+    if (usePreselection)
+      selected = fTrackSelection[j];
+    else if (!fTrackCuts || fTrackCuts->IsSelected(aodtrack)) 
       selected = kTRUE;
     
     // store tracks needed for V0s
@@ -851,12 +890,19 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
       continue;
 
     AliNanoAODTrack* nanoTrack = new((*fTracks)[ntracks++]) AliNanoAODTrack (aodtrack, fVarList);
-
-    for (std::list<AliNanoAODCustomSetter*>::iterator it = fCustomSetters.begin(); it != fCustomSetters.end(); ++it)
-      (*it)->SetNanoAODTrack(aodtrack, nanoTrack);
+    if (!fCustomSetters.empty()) {
+      fSetterAODTracks.push_back(aodtrack);
+      fSetterNanoTracks.push_back(nanoTrack);
+    }
     
     trackAssociation[aodtrack] = nanoTrack;
   }
+
+  // custom variables, for all the stored tracks of the event at once
+  if (!fSetterNanoTracks.empty()) {
+    for (std::list<AliNanoAODCustomSetter*>::iterator it = fCustomSetters.begin(); it != fCustomSetters.end(); ++it)
+      (*it)->SetNanoAODTracks(fSetterNanoTracks.size(), &fSetterAODTracks[0], &fSetterNanoTracks[0]);
+  }
   
   // Replace references to stored tracks. 
   // NOTE this has to respect the order in which they were stored (e.g. for a V0 the first daugther needs to be the positive one).
@@ -878,6 +924,9 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
     }
   }
   
+  if (fColumns)
+    FillColumns();
+
   AliDebug(1,Form("tracks=%d vertices=%d", fTracks->GetEntries(),fVertices->GetEntries())); 
   
   // Finally, deal with MC information, if needed
@@ -886,6 +935,57 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
   }
 }
 
+void AliNanoAODReplicator::PreselectTracks(const AliAODEvent& source)
+{
+  // Evaluate only the track cuts, the decisions are used by the next ReplicateAndFilter().
+  // Only the cuts and the (const) source event are accessed, so that this can run
+  // concurrently for several replicators.
+
+  Int_t entries = 0;
+  TClonesArray* particleArray = 0x0;
+  if (!fInputArrayName.IsNull()) {
+    particleArray = static_cast<TClonesArray*> (source.FindListObject(fInputArrayName.Data()));
+    entries = particleArray->GetEntries();
+  } else {
+    entries = source.GetNumberOfTracks();
+  }
+
+  fTrackSelection.resize(entries);
+  for (Int_t j = 0; j < entries; j++) {
+    TObject* track = particleArray ? particleArray->At(j) : source.GetTrack(j);
+    fTrackSelection[j] = (!fTrackCuts || fTrackCuts->IsSelected(track));
+  }
+  fTrackSelectionDone = kTRUE;
+}
+
+void AliNanoAODReplicator::FillColumns()
+{
+  // Copy the stored tracks column by column, after the custom setters were applied.
+  // The columns are in the order of GetList(): float variables, integer variables, label, flags
+
+  AliNanoAODTrackMapping* mapping = AliNanoAODTrackMapping::GetInstance();
+  const Int_t nVars = mapping->GetSize();
+  const Int_t nVarsInt = mapping->GetSizeInt();
+  const Int_t ntracks = fTracks->GetEntriesFast();
+
+  for (Int_t iCol = 0; iCol < fColumns->GetEntriesFast(); iCol++) {
+    AliNanoAODColumn* column = static_cast<AliNanoAODColumn*> (fColumns->UncheckedAt(iCol));
+    column->Clear();
+    column->Reserve(ntracks);
+    for (Int_t j = 0; j < ntracks; j++) {
+      AliNanoAODTrack* nanoTrack = static_cast<AliNanoAODTrack*> (fTracks->UncheckedAt(j));
+      if (iCol < nVars)
+        column->Add(nanoTrack->GetVar(iCol));
+      else if (iCol < nVars + nVarsInt)
+        column->AddInt(nanoTrack->GetVarInt(iCol - nVars));
+      else if (iCol == nVars + nVarsInt)
+        column->AddInt(nanoTrack->GetLabel());
+      else
+        column->AddInt(nanoTrack->GetNanoFlags());
+    }
+  }
+}
+
 void AliNanoAODReplicator::Terminate()
 {
 }
@@ -16,6 +16,7 @@
 
 #include <iostream>
 #include <list>
+#include <vector>
 //
 // Implementation of a branch replicator 
 // to produce nano AOD.
@@ -52,6 +53,7 @@ class AliNanoAODTrack;
 class AliAODTrack;
 class AliNanoAODCustomSetter;
 class AliAODZDC;
+class TObjArray;
 
 class AliNanoAODReplicator : public AliAODBranchReplicator
 {
@@ -65,6 +67,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   virtual TList* GetList() const ; // FIXME: This is declared const in the interface
   
   virtual void ReplicateAndFilter(const AliAODEvent& source);	
+  void PreselectTracks(const AliAODEvent& source);
 
   virtual void Terminate();
 
@@ -86,6 +89,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   void SetSaveV0s(Bool_t b)    { fSaveV0s = b; }
   void SetSaveCascades(Bool_t b) { fSaveCascades = b; }
   void SetSaveConversionPhotons(Bool_t b) { fSaveConversionPhotons = b; }
+  void SetSaveColumnarTracks(Bool_t b) { fSaveColumnarTracks = b; }
   void SetPhotonDeltaBranchName(TString name) {
     fPhotonFromDeltas = true;
     fDeltaAODBranchName = name;
@@ -107,6 +111,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   void RelabelAODPhotonCandidates(AliAODConversionPhoton *PhotonCandidate);
   void FilterMC(const AliAODEvent& source);
   AliAODVertex* CloneAndStoreVertex(AliAODVertex* toClone);
+  void FillColumns();
  
   AliAnalysisCuts* fTrackCuts; // decides which tracks to keep
   AliAnalysisCuts* fV0Cuts;    // decides which V0s to keep
@@ -141,12 +146,14 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   mutable TClonesArray* fV0s;    //! internal array of AliAODv0
   mutable TClonesArray* fCascades;    //! internal array of AliAODcascade
   mutable TClonesArray* fConversionPhotons;    //! internal array of AliAODConversionPhoton
+  mutable TObjArray* fColumns;    //! columnar copy of the tracks, one AliNanoAODColumn per variable
     
   Bool_t fSaveZDC;    // if kTRUE AliAODZDC will be saved in AliAODEvent
   Bool_t fSaveVzero;  // if kTRUE AliAODVZERO will be saved in AliAODEvent
   Bool_t fSaveV0s;    // if kTRUE AliAODv0 will be saved in AliAODEvent
   Bool_t fSaveCascades; // if kTRUE AliAODcascade will be saved in AliAODEvent
   Bool_t fSaveConversionPhotons; // If kTRUE gamme conversions are stored (needs delta AOD)
+  Bool_t fSaveColumnarTracks; // if kTRUE the tracks are also stored as one branch per variable (AliNanoAODColumn)
   Bool_t fPhotonFromDeltas; // If kTRUE gamma conversions will be directly taken from the Delta AOD
   TString fDeltaAODBranchName; // Name of the photon branch in the Delta AOD
 
@@ -155,11 +162,15 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   
   std::map<AliAODVertex*, std::vector<TObject*> > fKeepDaughters; //! Tracks needed as references to V0s and cascades
   std::map<AliAODVertex*, AliAODVertex*> fClonedVertices; //! avoid that vertices are stored several times
+  std::vector<Char_t> fTrackSelection; //! track cut decisions from PreselectTracks(), per input track
+  Bool_t fTrackSelectionDone; //! fTrackSelection is valid for the next ReplicateAndFilter()
+  std::vector<const AliAODTrack*> fSetterAODTracks; //! input tracks of the stored tracks, passed to the custom setters
+  std::vector<AliNanoAODTrack*> fSetterNanoTracks;  //! stored tracks of the event, passed to the custom setters
 
   AliNanoAODReplicator(const AliNanoAODReplicator&);
   AliNanoAODReplicator& operator=(const AliNanoAODReplicator&);
 
-  ClassDef(AliNanoAODReplicator, 7) // Branch replicator for ESD to muon AOD.
+  ClassDef(AliNanoAODReplicator, 9) // Branch replicator for ESD to muon AOD.
 };
 
 #endif
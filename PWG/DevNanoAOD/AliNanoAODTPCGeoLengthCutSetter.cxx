@@ -18,7 +18,11 @@ ClassImp(AliNanoAODTPCGeoLengthCutSetter)
       fRequireCutGeoNcrNclGeom1Pt(1.5),
       fCutGeoNcrNclFractionNcr(0.85),
       fCutGeoNcrNclFractionNcl(0.7),
-      fIndex(-1) {}
+      fIndex(-1),
+      fCutLength(),
+      fPass() {
+  fIndex = AddTrackVariable("cstTPCGeoLength");
+}
 
 AliNanoAODTPCGeoLengthCutSetter::~AliNanoAODTPCGeoLengthCutSetter() {}
 
@@ -28,36 +32,70 @@ void AliNanoAODTPCGeoLengthCutSetter::SetNanoAODHeader(const AliAODEvent* event,
   fMagField = event->GetMagneticField();
 }
 
+Double_t AliNanoAODTPCGeoLengthCutSetter::GetCutLength(
+    const AliAODTrack* aodTrack) const {
+  const Double_t pt = aodTrack->Pt();
+  const Double_t oneOverPt = (pt > 0) ? 1. / pt : 0.;
+  return fRequireCutGeoNcrNclLength -
+         TMath::Power(oneOverPt, fRequireCutGeoNcrNclGeom1Pt);
+}
+
+Bool_t AliNanoAODTPCGeoLengthCutSetter::PassClusterCuts(
+    const AliAODTrack* aodTrack,
+    Double_t cutLength) const {
+  // cuts which do not need the length in the active zone
+  if (aodTrack->GetTPCCrossedRows() < fCutGeoNcrNclFractionNcr * cutLength)
+    return kFALSE;
+  if (aodTrack->GetTPCNcls() < fCutGeoNcrNclFractionNcl * cutLength)
+    return kFALSE;
+  return kTRUE;
+}
+
+Bool_t AliNanoAODTPCGeoLengthCutSetter::PassLengthCut(
+    const AliAODTrack* aodTrack,
+    Double_t cutLength) const {
+  // the length in the active zone needs a (costly) conversion to an ESD track
+  AliESDtrack esdTrack(aodTrack);
+  esdTrack.SetTPCClusterMap(aodTrack->GetTPCClusterMap());
+  esdTrack.SetTPCSharedMap(aodTrack->GetTPCSharedMap());
+  esdTrack.SetTPCPointsF(aodTrack->GetTPCNclsF());
+  return esdTrack.GetLengthInActiveZone(fMode, fDeltaY, fDeltaZ, fMagField) >=
+         cutLength;
+}
+
 void AliNanoAODTPCGeoLengthCutSetter::SetNanoAODTrack(
     const AliAODTrack* aodTrack,
     AliNanoAODTrack* spTrack) {
-  if (fIndex == -1)
-    fIndex =
-        AliNanoAODTrackMapping::GetInstance()->GetVarIndex("cstTPCGeoLength");
-  if (fIndex == -1)
-    fIndex = -2;  // prevent useless run.
-
-  if (fIndex >= 0) {
-    auto checkResult = true;
-    AliESDtrack fESDTrack(aodTrack);
-    fESDTrack.SetTPCClusterMap(aodTrack->GetTPCClusterMap());
-    fESDTrack.SetTPCSharedMap(aodTrack->GetTPCSharedMap());
-    fESDTrack.SetTPCPointsF(aodTrack->GetTPCNclsF());
-
-    auto nCrossedRowsTPC = fESDTrack.GetTPCCrossedRows();
-    auto lengthInActiveZoneTPC = fESDTrack.GetLengthInActiveZone(
-        fMode, fDeltaY, fDeltaZ, fMagField);
-    auto cutGeoNcrNclLength = fRequireCutGeoNcrNclLength -
-                              TMath::Power(TMath::Abs(fESDTrack.GetSigned1Pt()),
-                                           fRequireCutGeoNcrNclGeom1Pt);
-
-    if (lengthInActiveZoneTPC < cutGeoNcrNclLength)
-      checkResult = false;
-    if (nCrossedRowsTPC < fCutGeoNcrNclFractionNcr * cutGeoNcrNclLength)
-      checkResult = false;
-    if (fESDTrack.GetTPCncls() < fCutGeoNcrNclFractionNcl * cutGeoNcrNclLength)
-      checkResult = false;
-
-    spTrack->SetVar(fIndex, (checkResult) ? 1. : 0.);
+  const Int_t index = GetTrackVarIndex(fIndex);
+  if (index < 0)
+    return;
+
+  const Double_t cutLength = GetCutLength(aodTrack);
+  const Bool_t checkResult = PassClusterCuts(aodTrack, cutLength) &&
+                             PassLengthCut(aodTrack, cutLength);
+  spTrack->SetVar(index, (checkResult) ? 1. : 0.);
+}
+
+void AliNanoAODTPCGeoLengthCutSetter::SetNanoAODTracks(
+    Int_t nTracks,
+    const AliAODTrack* const* aodTracks,
+    AliNanoAODTrack* const* spTracks) {
+  // Same cut as SetNanoAODTrack, done in passes over all the tracks: the
+  // length cut and the cluster cuts first, the length in the active zone
+  // only for the tracks which survive them.
+  const Int_t index = GetTrackVarIndex(fIndex);
+  if (index < 0 || nTracks <= 0)
+    return;
+
+  fCutLength.resize(nTracks);
+  fPass.resize(nTracks);
+  for (Int_t i = 0; i < nTracks; i++)
+    fCutLength[i] = GetCutLength(aodTracks[i]);
+  for (Int_t i = 0; i < nTracks; i++)
+    fPass[i] = PassClusterCuts(aodTracks[i], fCutLength[i]);
+  for (Int_t i = 0; i < nTracks; i++) {
+    if (fPass[i])
+      fPass[i] = PassLengthCut(aodTracks[i], fCutLength[i]);
+    spTracks[i]->SetVar(index, (fPass[i]) ? 1. : 0.);
   }
-};
\ No newline at end of file
+}
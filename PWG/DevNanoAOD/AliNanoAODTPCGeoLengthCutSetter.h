@@ -7,6 +7,8 @@
 #include "AliNanoAODHeader.h"
 #include "AliNanoAODTrack.h"
 
+#include <vector>
+
 class AliNanoAODTPCGeoLengthCutSetter : public AliNanoAODCustomSetter {
  public:
   AliNanoAODTPCGeoLengthCutSetter(
@@ -17,6 +19,9 @@ class AliNanoAODTPCGeoLengthCutSetter : public AliNanoAODCustomSetter {
                                 TString varListHeader);
   virtual void SetNanoAODTrack(const AliAODTrack* aodTrack,
                                AliNanoAODTrack* spTrack);
+  virtual void SetNanoAODTracks(Int_t nTracks,
+                                const AliAODTrack* const* aodTracks,
+                                AliNanoAODTrack* const* spTracks);
 
   int fMode;
   Double_t fDeltaY;
@@ -28,10 +33,16 @@ class AliNanoAODTPCGeoLengthCutSetter : public AliNanoAODCustomSetter {
   Double_t fCutGeoNcrNclFractionNcl;
 
  protected:
+  Double_t GetCutLength(const AliAODTrack* aodTrack) const;
+  Bool_t PassClusterCuts(const AliAODTrack* aodTrack, Double_t cutLength) const;
+  Bool_t PassLengthCut(const AliAODTrack* aodTrack, Double_t cutLength) const;
+
   bool fGoodToGo;
-  int fIndex;
+  int fIndex;  //! id of the cstTPCGeoLength variable
+  std::vector<Double_t> fCutLength;  //! length cut of the tracks of the event
+  std::vector<Char_t> fPass;         //! cut result of the tracks of the event
 
-  ClassDef(AliNanoAODTPCGeoLengthCutSetter, 1)
+  ClassDef(AliNanoAODTPCGeoLengthCutSetter, 2)
 };
 
 #endif /* AliNanoAODTPCGeoLengthCutSetter_h */
@@ -34,6 +34,9 @@
 ClassImp(AliNanoAODTrack)
 
 Int_t AliNanoAODTrack::fgPIDIndexes[ENanoPIDResponse::kLAST][AliPID::kSPECIESC] = { -1 };
+const AliNanoAODTrackMapping* AliNanoAODTrack::fgPIDIndexesMapping = 0;
+Int_t AliNanoAODTrack::fgKinIndexes[kKinLAST] = { -1 };
+const AliNanoAODTrackMapping* AliNanoAODTrack::fgKinIndexesMapping = 0;
   
 //______________________________________________________________________________
 AliNanoAODTrack::AliNanoAODTrack() : 
@@ -75,6 +78,9 @@ AliNanoAODTrack::AliNanoAODTrack(AliAODTrack * aodTrack, const char * vars) :
   if (AliNanoAODTrackMapping::GetInstance()->GetPt() != -1)               SetVar(AliNanoAODTrackMapping::GetInstance()->GetPt()               , aodTrack->Pt()                      );
   if (AliNanoAODTrackMapping::GetInstance()->GetPhi() != -1)              SetVar(AliNanoAODTrackMapping::GetInstance()->GetPhi()              , aodTrack->Phi()                     );
   if (AliNanoAODTrackMapping::GetInstance()->GetTheta() != -1)            SetVar(AliNanoAODTrackMapping::GetInstance()->GetTheta()            , aodTrack->Theta()                   );
+  if (AliNanoAODTrackMapping::GetInstance()->GetPx() != -1)               SetVar(AliNanoAODTrackMapping::GetInstance()->GetPx()               , aodTrack->Px()                      );
+  if (AliNanoAODTrackMapping::GetInstance()->GetPy() != -1)               SetVar(AliNanoAODTrackMapping::GetInstance()->GetPy()               , aodTrack->Py()                      );
+  if (AliNanoAODTrackMapping::GetInstance()->GetPz() != -1)               SetVar(AliNanoAODTrackMapping::GetInstance()->GetPz()               , aodTrack->Pz()                      );
   if (AliNanoAODTrackMapping::GetInstance()->GetChi2PerNDF() != -1)       SetVar(AliNanoAODTrackMapping::GetInstance()->GetChi2PerNDF()       , aodTrack->Chi2perNDF()              );  
   if (AliNanoAODTrackMapping::GetInstance()->GetPosX() != -1)             SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosX()             , position[0]                         );
   if (AliNanoAODTrackMapping::GetInstance()->GetPosY() != -1)             SetVar(AliNanoAODTrackMapping::GetInstance()->GetPosY()             , position[1]                         );
@@ -351,6 +357,7 @@ template <typename T> void AliNanoAODTrack::SetP(const T *p, const Bool_t cartes
       SetVar(AliNanoAODTrackMapping::GetInstance()->GetPhi()     , p[1]);  
       SetVar(AliNanoAODTrackMapping::GetInstance()->GetTheta()   , p[2]);  
   }
+  UpdateCartesianMomentum();
 }
 
 /*
@@ -450,10 +457,37 @@ Bool_t AliNanoAODTrack::GetPxPyPz(Double_t p[3]) const
     //---------------------------------------------------------------------
     // This function returns the global track momentum components
     //---------------------------------------------------------------------
-  p[0]=Px(); p[1]=Py(); p[2]=Pz();
+  return PxPyPz(p);
+}
+
+//______________________________________________________________________________
+Bool_t AliNanoAODTrack::PxPyPz(Double_t p[3]) const 
+{
+  // momentum components, pt and phi are read only once if computed
+
+  Int_t ipx = GetKinIndex(kKinPx);
+  if (ipx >= 0) {
+    p[0] = GetVar(ipx); p[1] = GetVar(GetKinIndex(kKinPy)); p[2] = GetVar(GetKinIndex(kKinPz));
+  } else {
+    Double_t pt = Pt(), phi = Phi();
+    p[0] = pt * TMath::Cos(phi); p[1] = pt * TMath::Sin(phi); p[2] = pt / TMath::Tan(Theta());
+  }
   return kTRUE;
 }
 
+//______________________________________________________________________________
+void AliNanoAODTrack::UpdateCartesianMomentum() 
+{
+  // keep the stored px, py, pz consistent with pt, phi, theta
+
+  Int_t ipx = GetKinIndex(kKinPx);
+  if (ipx < 0) return;
+  Double_t pt = GetVar(GetKinIndex(kKinPt)), phi = GetVar(GetKinIndex(kKinPhi)), theta = GetVar(GetKinIndex(kKinTheta));
+  SetVar(ipx, pt * TMath::Cos(phi));
+  SetVar(GetKinIndex(kKinPy), pt * TMath::Sin(phi));
+  SetVar(GetKinIndex(kKinPz), pt / TMath::Tan(theta));
+}
+
 
 
 //_____________________________________________________________________________
@@ -552,16 +586,19 @@ void  AliNanoAODTrack::Clear(Option_t * /*opt*/) {
 
 Bool_t AliNanoAODTrack::InitPIDIndex()
 {
-  AliWarningClass("Intializing PID tables. Please call this only once (e.g. by using a static member)!");
-  static Bool_t initialized = kFALSE;
+  // the tables are filled again only if the mapping was switched (AliNanoAODTrackMapping::Select)
   static Bool_t anyFilled = kFALSE;
-  if (initialized)
+  AliNanoAODTrackMapping* mapping = AliNanoAODTrackMapping::GetInstance();
+  if (fgPIDIndexesMapping == mapping)
     return anyFilled;
-  initialized = kTRUE;
+  if (!fgPIDIndexesMapping)
+    AliWarningClass("Intializing PID tables. Please call this only once (e.g. by using a static member)!");
+  fgPIDIndexesMapping = mapping;
+  anyFilled = kFALSE;
 
   for (Int_t r = 0; r<kLAST; r++) {
     for (Int_t p = 0; p<AliPID::kSPECIESC; p++) {
-      Int_t index = AliNanoAODTrackMapping::GetInstance()->GetVarIndex(GetPIDVarName((ENanoPIDResponse) r, (AliPID::EParticleType) p));
+      Int_t index = mapping->GetVarIndex(GetPIDVarName((ENanoPIDResponse) r, (AliPID::EParticleType) p));
       fgPIDIndexes[r][p] = index;
       if (index != -1)
         anyFilled = kTRUE;
@@ -570,6 +607,22 @@ Bool_t AliNanoAODTrack::InitPIDIndex()
   return anyFilled;
 }
 
+//______________________________________________________________________________
+void AliNanoAODTrack::InitKinIndexes()
+{
+  // resolve the kinematic slots once, the cartesian ones only if all three are stored
+
+  AliNanoAODTrackMapping *mapping = AliNanoAODTrackMapping::GetInstance();
+  fgKinIndexes[kKinPt]    = mapping->GetPt();
+  fgKinIndexes[kKinPhi]   = mapping->GetPhi();
+  fgKinIndexes[kKinTheta] = mapping->GetTheta();
+  Bool_t cartesian = mapping->GetPx() != -1 && mapping->GetPy() != -1 && mapping->GetPz() != -1;
+  fgKinIndexes[kKinPx]    = cartesian ? mapping->GetPx() : -1;
+  fgKinIndexes[kKinPy]    = cartesian ? mapping->GetPy() : -1;
+  fgKinIndexes[kKinPz]    = cartesian ? mapping->GetPz() : -1;
+  fgKinIndexesMapping = mapping;
+}
+
 //_______________________________________________________
 void  AliNanoAODTrack::GetImpactParameters(Float_t &xy,Float_t &z) const {
   xy = DCA();
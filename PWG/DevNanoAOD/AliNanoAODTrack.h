@@ -48,6 +48,17 @@ public:
     kLAST = 2
   };
   
+  // kinematic variables, see GetKinIndex()
+  enum ENanoKinIndex {
+    kKinPt = 0,
+    kKinPhi,
+    kKinTheta,
+    kKinPx,
+    kKinPy,
+    kKinPz,
+    kKinLAST
+  };
+
   enum ENanoFlags {
     kNanoCharge = 0, // (0 -> negative | 1 -> positive)
     kNanoHasTOFPID,
@@ -81,16 +92,17 @@ public:
   virtual void Clear(Option_t * opt) ;
   
   // kinematics
-  virtual Double_t OneOverPt() const { return (Pt() != 0.) ? 1./Pt() : -999.; }
-  virtual Double_t Phi()       const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPhi());   }
-  virtual Double_t Theta()     const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetTheta()); }
+  // the px, py, pz variables are used if they are stored, otherwise computed from pt, phi, theta
+  virtual Double_t OneOverPt() const { Double_t pt = Pt(); return (pt != 0.) ? 1./pt : -999.; }
+  virtual Double_t Phi()       const { return GetVar(GetKinIndex(kKinPhi));   }
+  virtual Double_t Theta()     const { return GetVar(GetKinIndex(kKinTheta)); }
   
-  virtual Double_t Px() const { return Pt() * TMath::Cos(Phi()); }
-  virtual Double_t Py() const { return Pt() * TMath::Sin(Phi()); }
-  virtual Double_t Pz() const { return Pt() / TMath::Tan(Theta()); }
-  virtual Double_t Pt() const { return GetVar(AliNanoAODTrackMapping::GetInstance()->GetPt()); }
-  virtual Double_t P()  const { return TMath::Sqrt(Pt()*Pt()+Pz()*Pz()); }
-  virtual Bool_t   PxPyPz(Double_t p[3]) const { p[0] = Px(); p[1] = Py(); p[2] = Pz(); return kTRUE; }
+  virtual Double_t Px() const { Int_t i = GetKinIndex(kKinPx); return i >= 0 ? GetVar(i) : Pt() * TMath::Cos(Phi()); }
+  virtual Double_t Py() const { Int_t i = GetKinIndex(kKinPy); return i >= 0 ? GetVar(i) : Pt() * TMath::Sin(Phi()); }
+  virtual Double_t Pz() const { Int_t i = GetKinIndex(kKinPz); return i >= 0 ? GetVar(i) : Pt() / TMath::Tan(Theta()); }
+  virtual Double_t Pt() const { return GetVar(GetKinIndex(kKinPt)); }
+  virtual Double_t P()  const { Double_t pt = Pt(), pz = Pz(); return TMath::Sqrt(pt*pt+pz*pz); }
+  virtual Bool_t   PxPyPz(Double_t p[3]) const;
 
   virtual Double_t Xv() const { return GetProdVertex() ? GetProdVertex()->GetX() : -999.; }
   virtual Double_t Yv() const { return GetProdVertex() ? GetProdVertex()->GetY() : -999.; }
@@ -309,9 +321,9 @@ public:
 
 
   void SetOneOverPt(Double_t oneOverPt) { fVars[AliNanoAODTrackMapping::GetInstance()->GetPt()] = 1. / oneOverPt; }
-  void SetPt(Double_t pt) { fVars[AliNanoAODTrackMapping::GetInstance()->GetPt()] = pt; };
-  void SetPhi(Double_t phi) { fVars[AliNanoAODTrackMapping::GetInstance()->GetPhi()] = phi; }
-  void SetTheta(Double_t theta) { fVars[AliNanoAODTrackMapping::GetInstance()->GetTheta()] = theta; }
+  void SetPt(Double_t pt) { fVars[GetKinIndex(kKinPt)] = pt; UpdateCartesianMomentum(); };
+  void SetPhi(Double_t phi) { fVars[GetKinIndex(kKinPhi)] = phi; UpdateCartesianMomentum(); }
+  void SetTheta(Double_t theta) { fVars[GetKinIndex(kKinTheta)] = theta; UpdateCartesianMomentum(); }
   template <typename T> void SetP(const T *p, Bool_t cartesian = kTRUE);// TODO: WHAT IS THIS FOR?
   void SetP() {AliFatal("Not Implemented");}
 
@@ -356,10 +368,15 @@ public:
   virtual void GetImpactParameters(Float_t &xy,Float_t &z) const;  
 
   // PID access functions
-  static Int_t GetPIDIndex(ENanoPIDResponse r, AliPID::EParticleType p)  { return fgPIDIndexes[r][p]; }
+  static Int_t GetPIDIndex(ENanoPIDResponse r, AliPID::EParticleType p)  { if (fgPIDIndexesMapping && fgPIDIndexesMapping != AliNanoAODTrackMapping::GetInstance()) InitPIDIndex(); return fgPIDIndexes[r][p]; }
   static const char* GetPIDVarName(ENanoPIDResponse r, AliPID::EParticleType p) {  return Form("PID.%d.%s", r, AliPID::ParticleShortName(p)); }
   static Bool_t InitPIDIndex();
 
+  // slots of the kinematic variables, resolved again only if the mapping was switched
+  // (see AliNanoAODTrackMapping::Select)
+  static Int_t GetKinIndex(ENanoKinIndex i) { if (fgKinIndexesMapping != AliNanoAODTrackMapping::GetInstance()) InitKinIndexes(); return fgKinIndexes[i]; }
+  static void InitKinIndexes();
+
 
   /// NanoAOD information that cannot be retrieved with the same interface of AliAODtrack
   bool   IsTRDrefit() { return TESTBIT(fNanoFlags, ENanoFlags::kTRDrefit); }
@@ -379,6 +396,11 @@ private :
   mutable const AliDetectorPID* fDetectorPID; //!<! transient object to cache calibrated PID information
 
   static Int_t fgPIDIndexes[ENanoPIDResponse::kLAST][AliPID::kSPECIESC];
+  static const AliNanoAODTrackMapping* fgPIDIndexesMapping; // mapping fgPIDIndexes was filled from
+  static Int_t fgKinIndexes[kKinLAST];
+  static const AliNanoAODTrackMapping* fgKinIndexesMapping; // mapping fgKinIndexes was filled from
+
+  void UpdateCartesianMomentum();
   
   const AliAODEvent* fAODEvent;     //! 
 
@@ -4,6 +4,7 @@
 #include "TObjString.h"
 #include "AliLog.h"
 #include <iostream>
+#include <map>
 #include "AliAnalysisManager.h"
 #include "AliVEventHandler.h"
 
@@ -20,6 +21,9 @@ AliNanoAODTrackMapping::AliNanoAODTrackMapping() :
   fPt(-1),      	  
   fPhi(-1),		  
   fTheta(-1),		  
+  fPx(-1),
+  fPy(-1),
+  fPz(-1),
   fChi2PerNDF(-1),	  
   fPosX(-1),		  
   fPosY(-1),		  
@@ -78,6 +82,9 @@ AliNanoAODTrackMapping::AliNanoAODTrackMapping(const char * mappingString) :
   fPt(-1),      	  
   fPhi(-1),		  
   fTheta(-1),		  
+  fPx(-1),
+  fPy(-1),
+  fPz(-1),
   fChi2PerNDF(-1),	  
   fPosX(-1),		  
   fPosY(-1),		  
@@ -150,6 +157,9 @@ AliNanoAODTrackMapping::AliNanoAODTrackMapping(const char * mappingString) :
     if     (var == "pt"               ) fPt                = index++;
     else if(var == "phi"              ) fPhi               = index++;
     else if(var == "theta"            ) fTheta             = index++; // FIXME: consider adding a "eta" variable explicitly (possibly with a check for theta aldready there), so that you don't have to carry over also "theta" in case you only need eta.
+    else if(var == "px"               ) fPx                = index++;
+    else if(var == "py"               ) fPy                = index++;
+    else if(var == "pz"               ) fPz                = index++;
     else if(var == "chi2perNDF"       ) fChi2PerNDF        = index++;
     else if(var == "posx"             ) fPosX              = index++;
     else if(var == "posy"             ) fPosY              = index++;
@@ -217,6 +227,9 @@ Int_t AliNanoAODTrackMapping::GetVarIndex(TString varName){
     if     (varName == "pt"               ) return fPt               ;
     else if(varName == "phi"              ) return fPhi              ;
     else if(varName == "theta"            ) return fTheta            ; 
+    else if(varName == "px"               ) return fPx               ;
+    else if(varName == "py"               ) return fPy               ;
+    else if(varName == "pz"               ) return fPz               ;
     else if(varName == "chi2perNDF"       ) return fChi2PerNDF       ;
     else if(varName == "posx"             ) return fPosX             ;
     else if(varName == "posy"             ) return fPosY             ;
@@ -277,6 +290,9 @@ const char * AliNanoAODTrackMapping::GetVarName(Int_t index) const {
     if     (index == fPt               )  return "pt"               ;
     else if(index == fPhi              )  return "phi"              ;
     else if(index == fTheta            )  return "theta"            ;
+    else if(index == fPx               )  return "px"               ;
+    else if(index == fPy               )  return "py"               ;
+    else if(index == fPz               )  return "pz"               ;
     else if(index == fChi2PerNDF       )  return "chi2perNDF"       ;
     else if(index == fPosX             )  return "posx"             ;
     else if(index == fPosY             )  return "posy"             ;
@@ -358,6 +374,30 @@ void  AliNanoAODTrackMapping::Print(const Option_t* /*opt*/) const {
     std::cout << " " << ivar << " " << GetVarNameInt(ivar) << std::endl;
 }
 
+AliNanoAODTrackMapping * AliNanoAODTrackMapping::Select(const char * vars)
+{
+  /// Switch the singleton to the mapping of vars, created on the first call.
+  /// The mappings are kept for the whole job.
+
+  static std::map<TString, AliNanoAODTrackMapping*> mappings;
+
+  if (fInstance && fMappingString == vars)
+    return fInstance;
+  if (fInstance)
+    mappings[fMappingString] = fInstance;
+
+  std::map<TString, AliNanoAODTrackMapping*>::iterator it = mappings.find(vars);
+  if (it != mappings.end()) {
+    fInstance = it->second;
+    fMappingString = vars;
+  } else {
+    fInstance = 0;
+    fInstance = new AliNanoAODTrackMapping(vars);
+    mappings[vars] = fInstance;
+  }
+  return fInstance;
+}
+
 void  AliNanoAODTrackMapping::LoadInstance() 
 {
   if(!fInstance) { // try to get it from the current file
@@ -27,6 +27,10 @@ public:
     
     return fInstance;
   }  
+
+  // make the mapping of the variable list the current instance, to filter
+  // several NanoAODs with different track variables in the same job
+  static AliNanoAODTrackMapping * Select(const char * vars);
   
 
   const char * GetVarName(Int_t index) const;
@@ -43,6 +47,9 @@ public:
   Int_t GetPt()               const { return fPt;               }
   Int_t GetPhi()              const { return fPhi;              }
   Int_t GetTheta()            const { return fTheta;            }
+  Int_t GetPx()               const { return fPx;               }
+  Int_t GetPy()               const { return fPy;               }
+  Int_t GetPz()               const { return fPz;               }
   Int_t GetChi2PerNDF()       const { return fChi2PerNDF;       }
   Int_t GetPosX()             const { return fPosX;             }
   Int_t GetPosY()             const { return fPosY;             }
@@ -99,6 +106,9 @@ private:
   Int_t fPt;      	  ///< Mapping variable
   Int_t fPhi;		  ///< Mapping variable
   Int_t fTheta;		  ///< Mapping variable
+  Int_t fPx;		  ///< Mapping variable, optional cartesian momentum
+  Int_t fPy;		  ///< Mapping variable, optional cartesian momentum
+  Int_t fPz;		  ///< Mapping variable, optional cartesian momentum
   Int_t fChi2PerNDF;	  ///< Mapping variable
   Int_t fPosX;		  ///< Mapping variable
   Int_t fPosY;		  ///< Mapping variable
@@ -146,7 +156,7 @@ private:
   static AliNanoAODTrackMapping * fInstance; ///< instance, needed for the singleton implementation
   static TString fMappingString; ///< the string which this class was initialized with
   std::map<TString,int> fMapCstVar;// Map of indexes of custom variables: CACHE THIS TO CONST INTs IN YOUR TASK TO AVOID CONTINUOUS STRING COMPARISONS
-  ClassDef(AliNanoAODTrackMapping, 3)
+  ClassDef(AliNanoAODTrackMapping, 4)
   
 };
 
@@ -23,11 +23,14 @@
 #pragma link C++ class AliNanoAODSimpleSetterCRCZDC+;
 #pragma link C++ class AliNanoAODSimpleSetterJet+;
 #pragma link C++ class AliNanoAODTrackMapping+;
+#pragma link C++ class AliNanoAODColumn+;
+#pragma link C++ class AliNanoAODColumnarView;
 #pragma link C++ class AliAnalysisTaskNanoSimple;
 #pragma link C++ class AliAnalysisTaskNanoValidator;
 
 #pragma link C++ class AliAnalysisTaskNanoAODskimming+;
 #pragma link C++ class AliNanoFilterNormalisation+;
 #pragma link C++ class AliAnalysisTaskNanoAODnormalisation+;
+#pragma link C++ class AliAnalysisTaskNanoAODReadOptimizer+;
 
 #endif
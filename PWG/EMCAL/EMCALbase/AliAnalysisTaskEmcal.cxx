@@ -47,10 +47,12 @@
 #include "AliAnalysisManager.h"
 #include "AliCentrality.h"
 #include "AliEmcalDownscaleFactorsOCDB.h"
+#include "AliEmcalFiredTriggerClasses.h"
 #include "AliEMCALGeometry.h"
 #include "AliEmcalMCPartonInfo.h"
 #include "AliEmcalPythiaFileHandler.h"
 #include "AliEmcalPythiaInfo.h"
+#include "AliEmcalTimingMonitor.h"
 #include "AliEMCALTriggerPatchInfo.h"
 #include "AliESDEvent.h"
 #include "AliAODInputHandler.h"
@@ -88,6 +90,9 @@ AliAnalysisTaskEmcal::AliAnalysisTaskEmcal() :
   fLocalInitialized(kFALSE),
   fFileChanged(kTRUE),
   fCreateHisto(kTRUE),
+  fDoTimingMonitor(kFALSE),
+  fTimingMemorySampling(0),
+  fTimingMonitor(nullptr),
   fCaloCellsName(),
   fCaloTriggersName(),
   fCaloTriggerPatchInfoName(),
@@ -212,6 +217,9 @@ AliAnalysisTaskEmcal::AliAnalysisTaskEmcal(const char *name, Bool_t histo) :
   fLocalInitialized(kFALSE),
   fFileChanged(kFALSE),
   fCreateHisto(histo),
+  fDoTimingMonitor(kFALSE),
+  fTimingMemorySampling(0),
+  fTimingMonitor(nullptr),
   fCaloCellsName(),
   fCaloTriggersName(),
   fCaloTriggerPatchInfoName(),
@@ -337,6 +345,7 @@ AliAnalysisTaskEmcal::~AliAnalysisTaskEmcal()
   if(fOutput) delete fOutput;
   if(fAliAnalysisUtils) delete fAliAnalysisUtils;
   if(fPythiaInfo) delete fPythiaInfo;
+  if(fTimingMonitor) delete fTimingMonitor;
 }
 
 void AliAnalysisTaskEmcal::SetClusPtCut(Double_t cut, Int_t c)
@@ -406,6 +415,21 @@ void AliAnalysisTaskEmcal::UserCreateOutputObjects()
   fOutput->SetUseScaling(fUsePtHardBinScaling);
   fOutput->SetOwner();
 
+  if (fDoTimingMonitor) {
+    // the order of the steps must match ETimingStep_t
+    fTimingMonitor = new AliEmcalTimingMonitor;
+    fTimingMonitor->AddStep("RetrieveEventObjects");
+    fTimingMonitor->AddStep("IsEventSelected");
+    fTimingMonitor->AddStep("Run");
+    fTimingMonitor->AddStep("FillHistograms");
+    TIter nextPartColl(&fParticleCollArray);
+    while (AliEmcalContainer *cont = static_cast<AliEmcalContainer*>(nextPartColl())) fTimingMonitor->AddCounter(cont->GetName());
+    TIter nextClusColl(&fClusterCollArray);
+    while (AliEmcalContainer *cont = static_cast<AliEmcalContainer*>(nextClusColl())) fTimingMonitor->AddCounter(cont->GetName());
+    fTimingMonitor->SetMemorySampling(fTimingMemorySampling);
+    fTimingMonitor->CreateOutput(fOutput);
+  }
+
   if (fForceBeamType == kpp)
     fNcentBins = 1;
 
@@ -596,11 +620,10 @@ Bool_t AliAnalysisTaskEmcal::FillGeneralHistograms()
     fHistEventPlane->Fill(fEPV0);
   }
 
-  std::unique_ptr<TObjArray> triggerClasses(InputEvent()->GetFiredTriggerClasses().Tokenize(" "));
-  TObjString* triggerClass(nullptr);
-  for(auto trg : *triggerClasses){
-    triggerClass = static_cast<TObjString*>(trg);
-    fHistTriggerClasses->Fill(triggerClass->GetString(), 1);
+  auto firedclasses = PWG::EMCAL::AliEmcalFiredTriggerClasses::Instance();
+  firedclasses->Update(InputEvent());     // no-op if already decoded for this event
+  for(const auto &trg : firedclasses->GetClasses()){
+    fHistTriggerClasses->Fill(trg.fName.data(), 1);
   }
 
   if(fCountDownscaleCorrectedEvents){
@@ -634,7 +657,20 @@ void AliAnalysisTaskEmcal::UserExec(Option_t *option)
     fFileChanged = kFALSE;
   }
 
-  if (!RetrieveEventObjects())
+  if (fTimingMonitor) {
+    fTimingMonitor->NextEvent();
+    fTimingMonitor->Start(kTimingRetrieveEventObjects);
+  }
+  Bool_t retrieved = RetrieveEventObjects();
+  if (fTimingMonitor) {
+    fTimingMonitor->Stop(kTimingRetrieveEventObjects);
+    Int_t icounter = 0;
+    TIter nextPartColl(&fParticleCollArray);
+    while (AliEmcalContainer *cont = static_cast<AliEmcalContainer*>(nextPartColl())) fTimingMonitor->FillCount(icounter++, cont->GetNEntries());
+    TIter nextClusColl(&fClusterCollArray);
+    while (AliEmcalContainer *cont = static_cast<AliEmcalContainer*>(nextClusColl())) fTimingMonitor->FillCount(icounter++, cont->GetNEntries());
+  }
+  if (!retrieved)
     return;
 
   if(InputEvent()->GetRunNumber() != fRunNumber){
@@ -682,7 +718,10 @@ void AliAnalysisTaskEmcal::UserExec(Option_t *option)
     fHistEvents->Fill(fPtHardBinGlobal);
   }
 
-  if (IsEventSelected()) {
+  if (fTimingMonitor) fTimingMonitor->Start(kTimingIsEventSelected);
+  Bool_t selected = IsEventSelected();
+  if (fTimingMonitor) fTimingMonitor->Stop(kTimingIsEventSelected);
+  if (selected) {
     if (fGeneralHistograms) fHistEventCount->Fill("Accepted",1);
   }
   else {
@@ -695,11 +734,17 @@ void AliAnalysisTaskEmcal::UserExec(Option_t *option)
       return;
   }
 
-  if (!Run())
+  if (fTimingMonitor) fTimingMonitor->Start(kTimingRun);
+  Bool_t runOK = Run();
+  if (fTimingMonitor) fTimingMonitor->Stop(kTimingRun);
+  if (!runOK)
     return;
 
   if (fCreateHisto) {
-    if (!FillHistograms())
+    if (fTimingMonitor) fTimingMonitor->Start(kTimingFillHistograms);
+    Bool_t filled = FillHistograms();
+    if (fTimingMonitor) fTimingMonitor->Stop(kTimingFillHistograms);
+    if (!filled)
       return;
   }
 
@@ -1554,6 +1599,9 @@ Bool_t AliAnalysisTaskEmcal::RetrieveEventObjects()
   fVertexSPD[2] = 0;
   fNVertSPDCont = 0;
 
+  // fired trigger classes decoded once per event for all wagons
+  PWG::EMCAL::AliEmcalFiredTriggerClasses::Instance()->Update(InputEvent());
+
   if (fGeneratePythiaInfoObject && MCEvent()) {
     GeneratePythiaInfoObject(MCEvent());
   }
@@ -47,6 +47,7 @@ class AliAODTrack;
 class AliEmcalPythiaInfo;
 class AliAODInputHandler;
 class AliESDInputHandler;
+class AliEmcalTimingMonitor;
 
 #include "Rtypes.h"
 #include "TArrayI.h"
@@ -315,6 +316,17 @@ class AliAnalysisTaskEmcal : public AliAnalysisTaskSE {
     kBinningUnknown
   };
 
+  /**
+   * @enum ETimingStep_t
+   * @brief Steps of the event loop in the timing monitor
+   */
+  enum ETimingStep_t {
+    kTimingRetrieveEventObjects = 0,  ///< RetrieveEventObjects()
+    kTimingIsEventSelected = 1,       ///< IsEventSelected()
+    kTimingRun = 2,                   ///< Run()
+    kTimingFillHistograms = 3         ///< FillHistograms()
+  };
+
   /**
    * @brief Default constructor.
    */
@@ -503,6 +515,19 @@ class AliAnalysisTaskEmcal : public AliAnalysisTaskSE {
    */
   void                        SetMakeGeneralHistograms(Bool_t g)                    { fGeneralHistograms = g                              ; }
 
+  /**
+   * @brief Switch on/off the timing instrumentation of the event loop
+   *
+   * The wall and CPU time of the event retrieval, the event selection, Run() and
+   * FillHistograms() are monitored (see AliEmcalTimingMonitor), together with the
+   * number of entries of the particle and cluster containers. The output is written to
+   * the list "TimingMonitor" in the output of the task.
+   *
+   * @param b If true the timing instrumentation is enabled
+   * @param memorySampling Sample the resident memory every n-th event (0: never)
+   */
+  void                        SetTimingMonitor(Bool_t b, Int_t memorySampling = 0)  { fDoTimingMonitor = b; fTimingMemorySampling = memorySampling; }
+
   /**
    * @brief Switch on/off getting \f$ p_{t,hard}\f$ bin from the file path.
    *
@@ -1324,6 +1349,9 @@ class AliAnalysisTaskEmcal : public AliAnalysisTaskSE {
   Bool_t                      fLocalInitialized;           ///< whether or not the task has been already initialized
   Bool_t					            fFileChanged;				         //!<! Signal triggered when the file has changed
   Bool_t                      fCreateHisto;                ///< whether or not create histograms
+  Bool_t                      fDoTimingMonitor;            ///< whether or not the timing of the event loop is monitored
+  Int_t                       fTimingMemorySampling;       ///< sampling period (events) of the resident memory in the timing monitor
+  AliEmcalTimingMonitor      *fTimingMonitor;              //!<!timing monitor of the event loop
   TString                     fCaloCellsName;              ///< name of calo cell collection
   TString                     fCaloTriggersName;           ///< name of calo triggers collection
   TString                     fCaloTriggerPatchInfoName;   ///< trigger patch info array name
@@ -1439,7 +1467,7 @@ class AliAnalysisTaskEmcal : public AliAnalysisTaskSE {
   AliAnalysisTaskEmcal &operator=(const AliAnalysisTaskEmcal&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskEmcal, 22) // EMCAL base analysis task
+  ClassDef(AliAnalysisTaskEmcal, 23) // EMCAL base analysis task
   /// \endcond
 };
 
@@ -173,7 +173,10 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper() :
   fPythiaCrossSectionFromFile(0.),
   fPythiaPtHard(0.),
   fPrintTimingInfoToLog(false),
-  fTimer()
+  fTimer(),
+  fNFilesToPrefetch(1),
+  fTreeCacheSize(0),
+  fNextFileToPrefetch(0)
 {
   if (fgInstance != nullptr) {
     AliError("An instance of AliAnalysisTaskEmcalEmbeddingHelper already exists: it will be deleted!!!");
@@ -250,7 +253,10 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
   fPythiaCrossSectionFromFile(0.),
   fPythiaPtHard(0.),
   fPrintTimingInfoToLog(false),
-  fTimer()
+  fTimer(),
+  fNFilesToPrefetch(1),
+  fTreeCacheSize(0),
+  fNextFileToPrefetch(0)
 {
   if (fgInstance != 0) {
     AliError("An instance of AliAnalysisTaskEmcalEmbeddingHelper already exists: it will be deleted!!!");
@@ -336,6 +342,8 @@ void AliAnalysisTaskEmcalEmbeddingHelper::RetrieveTaskPropertiesFromYAMLConfig()
   res = fYAMLConfig.GetProperty("randomFileAccess", fRandomFileAccess, false);
   res = fYAMLConfig.GetProperty("createHisto", fCreateHisto, false);
   res = fYAMLConfig.GetProperty("printTimingInfoInLog", fPrintTimingInfoToLog, false);
+  res = fYAMLConfig.GetProperty("nFilesToPrefetch", fNFilesToPrefetch, false);
+  res = fYAMLConfig.GetProperty("treeCacheSize", fTreeCacheSize, false);
   // More general embedding helper properties
   res = fYAMLConfig.GetProperty("filePattern", fFilePattern, false);
   res = fYAMLConfig.GetProperty("inputFilename", fInputFilename, false);
@@ -942,6 +950,7 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
       // fCurrentEntry and fLowerEntry are automatically reset in InitTree()
       fFileNumber = 0;
       fUpperEntry = 0;
+      fNextFileToPrefetch = 0;
 
       // Re-init back to the start
       InitTree();
@@ -1419,6 +1428,12 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::SetupInputFiles()
   // Keep track of the total number of files in the TChain to ensure that we don't start repeating within the chain
   fMaxNumberOfFiles = fChain->GetListOfFiles()->GetEntries();
 
+  // The cache is owned by the chain, so it is kept when moving to the next file
+  if (fTreeCacheSize > 0) {
+    fChain->SetCacheSize(fTreeCacheSize);
+  }
+  fNextFileToPrefetch = 0;
+
   if (fFilenames.size() > fMaxNumberOfFiles) {
     AliErrorStream() << "Number of input files (" << fFilenames.size() << ") is larger than the number of available files (" << fMaxNumberOfFiles << "). Something went wrong when adding some of those files to the TChain!\n";
   }
@@ -1536,11 +1551,18 @@ void AliAnalysisTaskEmcalEmbeddingHelper::InitTree()
     std::cout << "InitTree() has started for file " << (fFilenameIndex + fFileNumber + 1) % fMaxNumberOfFiles << fChain->GetCurrentFile()->GetName() << "..." << std::endl;
   }
   
-  // Load first entry of the (next) file so that we can query information about it
+  // Load the tree of the (next) file so that we can query information about it
   // (it is inaccessible otherwise).
   // Since fUpperEntry is the total number of entries, loading it will retrieve the
   // next tree (in the next file) since entries are indexed starting from 0.
-  fChain->GetEntry(fUpperEntry);
+  // LoadTree() only reads the tree header. The entry itself is read in GetNextEntry(),
+  // which may start at a random offset.
+  fChain->LoadTree(fUpperEntry);
+  if (fTreeCacheSize > 0) {
+    // Read all branches from the start rather than going through the learning phase
+    fChain->AddBranchToCache("*", kTRUE);
+    fChain->StopCacheLearningPhase();
+  }
 
   // Determine tree size and current entry
   // Set the limits of the new tree
@@ -1567,6 +1589,9 @@ void AliAnalysisTaskEmcalEmbeddingHelper::InitTree()
     fFileNumber++;
   }
 
+  // Open the next files in the background while this one is processed
+  PrefetchFiles();
+
   // Add to the count the number of files which were embedded
   fHistManager.FillTH1("fHistNumberOfFilesEmbedded", 1);
   fHistManager.FillTH1("fHistAbsoluteFileNumber", (fFileNumber + fFilenameIndex) % fMaxNumberOfFiles);
@@ -1610,6 +1635,33 @@ void AliAnalysisTaskEmcalEmbeddingHelper::InitTree()
 
 }
 
+/**
+ * Request an asynchronous open of the next fNFilesToPrefetch files in the TChain (and of their
+ * pythia cross section files), so that moving to the next file in InitTree() does not wait for
+ * the file to be opened on remote storage. TFile::Open() picks up the pending requests, so the
+ * TChain uses the prefetched files without any further bookkeeping.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::PrefetchFiles()
+{
+  if (fNFilesToPrefetch == 0 || fMaxNumberOfFiles == 0) { return; }
+
+  // fFileNumber is the position of the current file within the TChain
+  if (fNextFileToPrefetch <= fFileNumber) {
+    fNextFileToPrefetch = fFileNumber + 1;
+  }
+  UInt_t lastFile = std::min(fFileNumber + fNFilesToPrefetch, fMaxNumberOfFiles - 1);
+
+  TObjArray * files = fChain->GetListOfFiles();
+  for (; fNextFileToPrefetch <= lastFile; fNextFileToPrefetch++) {
+    const char * filename = files->At(fNextFileToPrefetch)->GetTitle();
+    AliDebugStream(3) << "Prefetching file \"" << filename << "\".\n";
+    TFile::AsyncOpen(filename);
+    if (fNextFileToPrefetch < fPythiaCrossSectionFilenames.size()) {
+      TFile::AsyncOpen(fPythiaCrossSectionFilenames.at(fNextFileToPrefetch).c_str());
+    }
+  }
+}
+
 /**
  * Extract pythia information from a cross section file. Modified from AliAnalysisTaskEmcal::PythiaInfoFromFile().
  *
@@ -2007,6 +2059,8 @@ std::string AliAnalysisTaskEmcalEmbeddingHelper::toString(bool includeFileList)
   tempSS << "File list filename: \"" << fFileListFilename << "\"\n";
   tempSS << "Tree name: " << fTreeName << "\n";
   tempSS << "Print timing info to log: " << fPrintTimingInfoToLog << "\n";
+  tempSS << "Number of files to prefetch: " << fNFilesToPrefetch << "\n";
+  tempSS << "TTreeCache size: " << fTreeCacheSize << "\n";
   tempSS << "Random event number access: " << fRandomEventNumberAccess << "\n";
   tempSS << "Random file access: " << fRandomFileAccess << "\n";
   tempSS << "Starting file index: " << fFilenameIndex << "\n";
@@ -136,6 +136,10 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   void SetAOD(const char * treeName = "aodTree")                  { fTreeName     = treeName; }
   /// Set whether to print and plot execution time of InitTree()
   void SetPrintTimingInfoToLog(bool b)                            { fPrintTimingInfoToLog = b;}
+  /// Set the number of files which are opened asynchronously ahead of the current file (0 disables prefetching)
+  void SetNumberOfFilesToPrefetch(UInt_t n)                       { fNFilesToPrefetch = n; }
+  /// Set the size of the TTreeCache of the embedded chain in bytes (0 keeps the ROOT default)
+  void SetTreeCacheSize(Long64_t size)                            { fTreeCacheSize = size; }
   /**
    * Enable to begin embedding at a random entry in each embedded file. Will then loop around in order
    * so that all entries are made available.
@@ -298,6 +302,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   std::string     GenerateUniqueFileListFilename() const;
   std::string     RemoveTrailingSlashes(std::string filename) const;
   void            DetermineFirstFileToEmbed();
+  void            PrefetchFiles();
   void            SetupEmbedding()      ;
   Bool_t          SetupInputFiles()     ;
   std::string     ConstructFullPythiaXSecFilename(std::string inputFilename, const std::string & pythiaFilename, bool testIfExists) const;
@@ -386,6 +391,9 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   
   bool                                          fPrintTimingInfoToLog; ///< Flag to print time to execute InitTree(), for logging purposes
   TStopwatch                                    fTimer            ;    //!<! Timer for the InitTree() function
+  UInt_t                                        fNFilesToPrefetch ; ///< Number of files opened asynchronously ahead of the current file
+  Long64_t                                      fTreeCacheSize    ; ///< Size of the TTreeCache of the embedded chain in bytes. 0 keeps the ROOT default
+  UInt_t                                        fNextFileToPrefetch; //!<! Position in the TChain of the next file to be prefetched
 
   static AliAnalysisTaskEmcalEmbeddingHelper   *fgInstance        ; //!<! Global instance of this class
 
@@ -394,7 +402,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   AliAnalysisTaskEmcalEmbeddingHelper &operator=(const AliAnalysisTaskEmcalEmbeddingHelper&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 14);
+  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 15);
   /// \endcond
 };
 #endif
@@ -12,7 +12,6 @@
  * about the suitability of this software for any purpose. It is          *
  * provided "as is" without express or implied warranty.                  *
  **************************************************************************/
-#include <sstream>
 #include <array>
 #include <memory>
 
@@ -57,6 +56,7 @@
 
 #include "AliMultSelection.h"
 
+#include "AliEmcalFiredTriggerClasses.h"
 #include "AliAnalysisTaskEmcalLight.h"
 
 Double_t AliAnalysisTaskEmcalLight::fgkEMCalDCalPhiDivide = 4.;
@@ -72,6 +72,7 @@ AliAnalysisTaskEmcalLight::AliAnalysisTaskEmcalLight() :
   fUseBuiltinEventSelection(kFALSE),
   fCentBins(),
   fCentralityEstimation(kNewCentrality),
+  fRequiredEventObjects(kAllEventObjects),
   fAliEventCuts(),
   fIsPythia(kFALSE),
   fIsMonteCarlo(kFALSE),
@@ -107,6 +108,8 @@ AliAnalysisTaskEmcalLight::AliAnalysisTaskEmcalLight() :
   fMaximumEventWeight(1e6),
   fInhibit(kFALSE),
   fLocalInitialized(kFALSE),
+  fRetrievedEventObjects(kAllEventObjects),
+  fFiredTriggerClassesGeneration(0),
   fWarnMissingCentrality(kTRUE),
   fDataType(kAOD),
   fGeom(0),
@@ -152,6 +155,7 @@ AliAnalysisTaskEmcalLight::AliAnalysisTaskEmcalLight(const char *name, Bool_t hi
   fUseBuiltinEventSelection(kFALSE),
   fCentBins(6),
   fCentralityEstimation(kNewCentrality),
+  fRequiredEventObjects(kAllEventObjects),
   fAliEventCuts(),
   fIsPythia(kFALSE),
   fIsMonteCarlo(kFALSE),
@@ -187,6 +191,8 @@ AliAnalysisTaskEmcalLight::AliAnalysisTaskEmcalLight(const char *name, Bool_t hi
   fMaximumEventWeight(1e6),
   fInhibit(kFALSE),
   fLocalInitialized(kFALSE),
+  fRetrievedEventObjects(kAllEventObjects),
+  fFiredTriggerClassesGeneration(0),
   fWarnMissingCentrality(kTRUE),
   fDataType(kAOD),
   fGeom(0),
@@ -814,9 +820,37 @@ void AliAnalysisTaskEmcalLight::ExecOnce()
 
   }
 
+  fRetrievedEventObjects = fRequiredEventObjects | GetBaseEventObjects();
+  fFiredTriggerClassesGeneration = 0;
+
   fLocalInitialized = kTRUE;
 }
 
+UInt_t AliAnalysisTaskEmcalLight::GetBaseEventObjects() const
+{
+  UInt_t objects = 0;
+
+  if (!fAcceptedTriggerClasses.empty() || !fRejectedTriggerClasses.empty()) objects |= kEventTriggerClasses;
+  if (fIsMonteCarlo && fMCRejectFilter) objects |= kEventMCHeader;
+
+  if (fUseBuiltinEventSelection) {
+    if (fTriggerSelectionBitMap != 0) objects |= kEventTriggerBits;
+    if (fMinCent < fMaxCent && fMaxCent > 0) objects |= kEventCentrality;
+    objects |= kEventVertex;
+    if (fMaxVzDiff >= 0) objects |= kEventVertexSPD;
+    if (fIsMonteCarlo) objects |= kEventMCHeader;
+  }
+
+  if (fGeneralHistograms && fCreateHisto) {
+    objects |= kEventVertex | kEventTriggerClasses;
+    if (fCentralityEstimation != kNoCentrality) objects |= kEventCentrality;
+    if (fForceBeamType != kpp) objects |= kEventPlaneV0;
+    if (fIsMonteCarlo) objects |= kEventMCHeader;
+  }
+
+  return objects;
+}
+
 AliAnalysisTaskEmcalLight::EBeamType_t AliAnalysisTaskEmcalLight::GetBeamType()
 {
   if (fForceBeamType != kNA)
@@ -1017,31 +1051,45 @@ Bool_t AliAnalysisTaskEmcalLight::RetrieveEventObjects()
   fVertexSPD[2] = 0;
   fNVertSPDCont = 0;
 
-  fFiredTriggerClasses.clear();
-  std::stringstream firedClasses(InputEvent()->GetFiredTriggerClasses().Data());
-  while (firedClasses.good()) {
-    std::string trgClass;
-    firedClasses >> trgClass;
-    if (!trgClass.empty()) fFiredTriggerClasses.push_back(trgClass);
-  }
-
-  if (fDataType == kESD) {
-    fFiredTriggerBitMap = static_cast<AliInputEventHandler*>(AliAnalysisManager::GetAnalysisManager()->GetInputEventHandler())->IsEventSelected();
+  if (IsEventObjectRetrieved(kEventTriggerClasses)) {
+    // Decoded once per event for all the tasks, copied only when the classes change
+    auto firedclasses = PWG::EMCAL::AliEmcalFiredTriggerClasses::Instance();
+    firedclasses->Update(InputEvent());
+    if (firedclasses->GetGeneration() != fFiredTriggerClassesGeneration) {
+      fFiredTriggerClasses.clear();
+      for (const auto &trgclass : firedclasses->GetClasses()) fFiredTriggerClasses.push_back(trgclass.fName);
+      fFiredTriggerClassesGeneration = firedclasses->GetGeneration();
+    }
   }
   else {
-    fFiredTriggerBitMap = static_cast<AliVAODHeader*>(InputEvent()->GetHeader())->GetOfflineTrigger();
+    fFiredTriggerClasses.clear();
+    fFiredTriggerClassesGeneration = 0;
   }
 
-  const AliVVertex *vert = InputEvent()->GetPrimaryVertex();
-  if (vert) {
-    vert->GetXYZ(fVertex);
-    fNVertCont = vert->GetNContributors();
+  fFiredTriggerBitMap = 0;
+  if (IsEventObjectRetrieved(kEventTriggerBits)) {
+    if (fDataType == kESD) {
+      fFiredTriggerBitMap = static_cast<AliInputEventHandler*>(AliAnalysisManager::GetAnalysisManager()->GetInputEventHandler())->IsEventSelected();
+    }
+    else {
+      fFiredTriggerBitMap = static_cast<AliVAODHeader*>(InputEvent()->GetHeader())->GetOfflineTrigger();
+    }
   }
 
-  const AliVVertex *vertSPD = InputEvent()->GetPrimaryVertexSPD();
-  if (vertSPD) {
-    vertSPD->GetXYZ(fVertexSPD);
-    fNVertSPDCont = vertSPD->GetNContributors();
+  if (IsEventObjectRetrieved(kEventVertex)) {
+    const AliVVertex *vert = InputEvent()->GetPrimaryVertex();
+    if (vert) {
+      vert->GetXYZ(fVertex);
+      fNVertCont = vert->GetNContributors();
+    }
+  }
+
+  if (IsEventObjectRetrieved(kEventVertexSPD)) {
+    const AliVVertex *vertSPD = InputEvent()->GetPrimaryVertexSPD();
+    if (vertSPD) {
+      vertSPD->GetXYZ(fVertexSPD);
+      fNVertSPDCont = vertSPD->GetNContributors();
+    }
   }
 
   fBeamType = GetBeamType();
@@ -1052,7 +1100,10 @@ Bool_t AliAnalysisTaskEmcalLight::RetrieveEventObjects()
   fEPV0A   = -999;
   fEPV0C   = -999;
 
-  if (fCentralityEstimation == kNewCentrality) {
+  if (!IsEventObjectRetrieved(kEventCentrality)) {
+    // Not read by the task: as without centrality estimation
+  }
+  else if (fCentralityEstimation == kNewCentrality) {
     // New centrality estimation (AliMultSelection)
     // See https://twiki.cern.ch/twiki/bin/viewauth/ALICE/AliMultSelectionCalibStatus for calibration status period-by-period)
     AliMultSelection *MultSelection = static_cast<AliMultSelection*>(InputEvent()->FindListObject("MultSelection"));
@@ -1073,7 +1124,7 @@ Bool_t AliAnalysisTaskEmcalLight::RetrieveEventObjects()
       if(fWarnMissingCentrality) AliWarning(Form("%s: Could not retrieve centrality information! Assuming 99", GetName()));
     }
   }
-  if (!fCentBins.empty() && fCentralityEstimation != kNoCentrality) {
+  if (!fCentBins.empty() && fCentralityEstimation != kNoCentrality && IsEventObjectRetrieved(kEventCentrality)) {
     for (auto cent_it = fCentBins.begin(); cent_it != fCentBins.end() - 1; cent_it++) {
       if (fCent >= *cent_it && fCent < *(cent_it+1)) fCentBin = cent_it - fCentBins.begin();
     }
@@ -1082,7 +1133,7 @@ Bool_t AliAnalysisTaskEmcalLight::RetrieveEventObjects()
     fCentBin = 0;
   }
 
-  if (fBeamType == kAA || fBeamType == kpA ) {
+  if ((fBeamType == kAA || fBeamType == kpA) && IsEventObjectRetrieved(kEventPlaneV0)) {
     AliEventplane *aliEP = InputEvent()->GetEventplane();
     if (aliEP) {
       fEPV0  = aliEP->GetEventplane("V0" ,InputEvent());
@@ -1093,7 +1144,7 @@ Bool_t AliAnalysisTaskEmcalLight::RetrieveEventObjects()
     }
   }
 
-  if (fIsMonteCarlo && MCEvent()) {
+  if (fIsMonteCarlo && MCEvent() && IsEventObjectRetrieved(kEventMCHeader)) {
     AliGenEventHeader* header = MCEvent()->GenEventHeader();
     if (fMCEventHeaderName.IsNull()) {
       fMCHeader = header;
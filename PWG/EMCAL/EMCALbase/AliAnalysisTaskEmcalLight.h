@@ -109,6 +109,26 @@ class AliAnalysisTaskEmcalLight : public AliAnalysisTaskSE {
     kOldCentrality = 2  //!< Old centrality estimation (AliCentrality, works only on Run-1 PbPb and pPb)
   };
 
+  /**
+   * @enum EEventObject_t
+   * @brief Event-level quantities retrieved by RetrieveEventObjects
+   *
+   * A derived task declares the ones it reads with SetRequiredEventObjects,
+   * the ones needed by the event selection and general histograms of the
+   * base class are added automatically. The others are not retrieved and
+   * keep their reset values.
+   */
+  enum EEventObject_t {
+    kEventVertex          = BIT(0), //!< Primary vertex (fVertex, fNVertCont)
+    kEventVertexSPD       = BIT(1), //!< SPD vertex (fVertexSPD, fNVertSPDCont)
+    kEventTriggerClasses  = BIT(2), //!< Fired trigger classes (fFiredTriggerClasses)
+    kEventTriggerBits     = BIT(3), //!< Fired trigger bit map (fFiredTriggerBitMap)
+    kEventCentrality      = BIT(4), //!< Centrality and centrality bin (fCent, fCentBin)
+    kEventPlaneV0         = BIT(5), //!< V0 event plane (fEPV0, fEPV0A, fEPV0C)
+    kEventMCHeader        = BIT(6), //!< MC header, pt-hard, cross section, trials and event weight
+    kAllEventObjects      = 0x7f    //!< All event-level quantities (default)
+  };
+
   /**
    * @brief Default constructor.
    */
@@ -190,6 +210,9 @@ class AliAnalysisTaskEmcalLight : public AliAnalysisTaskSE {
   void                        SetCentBins(const std::vector<double>& bins)          { fCentBins = std::vector<double>(bins)               ; }
   Int_t                       GetNCentBins()                                  const { return fCentBins.size() > 1 ? fCentBins.size() - 1 : 1; }
   void                        SetSwitchOffLHC15oFaultyBranches(Bool_t b)            { fSwitchOffLHC15oFaultyBranches = b                  ; }
+  void                        SetRequiredEventObjects(UInt_t objects)               { fRequiredEventObjects = objects                     ; }
+  void                        AddRequiredEventObjects(UInt_t objects)               { fRequiredEventObjects |= objects                    ; }
+  UInt_t                      GetRequiredEventObjects()                       const { return fRequiredEventObjects                        ; }
 
   // Event selection
   void                        SetWarnMissingCentrality(Bool_t doWarn)               { fWarnMissingCentrality = doWarn                     ; }
@@ -536,6 +559,14 @@ class AliAnalysisTaskEmcalLight : public AliAnalysisTaskSE {
    */
   static EBeamType_t          BeamTypeFromRunNumber(Int_t runnumber);
 
+  /**
+   * Event-level quantities needed by the configured event selection and
+   * general histograms of the base class
+   * \return bit map of EEventObject_t values
+   */
+  UInt_t                      GetBaseEventObjects() const;
+  Bool_t                      IsEventObjectRetrieved(UInt_t object) const { return (fRetrievedEventObjects & object) != 0; }
+
   static Double_t             fgkEMCalDCalPhiDivide;       ///<  phi value used to distinguish between DCal and EMCal
 
   // Task configuration
@@ -546,6 +577,7 @@ class AliAnalysisTaskEmcalLight : public AliAnalysisTaskSE {
   Bool_t                      fUseBuiltinEventSelection;   ///< use builtin (old) event selection
   std::vector<double>         fCentBins;                   ///< how many centrality bins
   ECentralityEstimation_t     fCentralityEstimation;       ///< Centrality estimation
+  UInt_t                      fRequiredEventObjects;       ///< event-level quantities read by the task (EEventObject_t)
   AliEventCuts                fAliEventCuts;               ///< Event cut object
 
   // Input data
@@ -592,6 +624,8 @@ class AliAnalysisTaskEmcalLight : public AliAnalysisTaskSE {
   // Service fields
   Bool_t                      fInhibit;                    //!<!inhibit execution of the task
   Bool_t                      fLocalInitialized;           //!<!whether or not the task has been already initialized
+  UInt_t                      fRetrievedEventObjects;      //!<!event-level quantities retrieved in RetrieveEventObjects
+  ULong64_t                   fFiredTriggerClassesGeneration; //!<!generation of the shared fired trigger classes copied into fFiredTriggerClasses
   Bool_t                      fWarnMissingCentrality;      //!<!switch for verbosity in centrality information
   EDataType_t                 fDataType;                   //!<!data type (ESD or AOD)
   AliEMCALGeometry           *fGeom;                       //!<!emcal geometry
@@ -634,7 +668,7 @@ class AliAnalysisTaskEmcalLight : public AliAnalysisTaskSE {
   AliAnalysisTaskEmcalLight(const AliAnalysisTaskEmcalLight&);            // not implemented
   AliAnalysisTaskEmcalLight &operator=(const AliAnalysisTaskEmcalLight&); // not implemented
 
-  ClassDef(AliAnalysisTaskEmcalLight, 5);
+  ClassDef(AliAnalysisTaskEmcalLight, 6);
 };
 
 #endif
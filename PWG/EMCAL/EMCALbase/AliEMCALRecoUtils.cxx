@@ -18,6 +18,8 @@
 #include <TArrayI.h>
 #include <TArrayF.h>
 #include <TObjArray.h>
+#include <map>
+#include <vector>
 
 // STEER includes
 #include "AliVCluster.h"
@@ -304,6 +306,9 @@ AliEMCALRecoUtils & AliEMCALRecoUtils::operator = (const AliEMCALRecoUtils & rec
   fMatchedTrackIndex = reco.fMatchedTrackIndex;
   fMatchedClusterIndex = reco.fMatchedClusterIndex;
 
+  // flat cell calibration is filled again from the assigned maps
+  ClearFlatCellCalibration();
+
   for (Int_t j = 0; j < 4  ; j++)
    fBadStatusSelection[j] = reco.fBadStatusSelection[j] ;
 
@@ -413,6 +418,22 @@ Bool_t AliEMCALRecoUtils::AcceptCalibrateCell(Int_t absID, Int_t bc,
   if ( absID < 0 || absID >= 24*48*geom->GetNumberOfSuperModules() )
     return kFALSE;
 
+  // Calibration gathered at run change
+  if ( fFlatCellStatus.GetSize() == 24*48*geom->GetNumberOfSuperModules() )
+  {
+    Float_t  ampCell  = cells->GetCellAmplitude(absID);
+    Double_t timeCell = cells->GetCellTime(absID);
+    if ( !AcceptCalibrateCellFlat(absID, bc, !(cells->GetCellHighGain(absID)), ampCell, timeCell) )
+    {
+      if ( fFlatCellStatus[absID] < 0 ) { amp=0; time = 1.e9; }
+      return kFALSE;
+    }
+
+    amp  = ampCell;
+    time = timeCell;
+    return kTRUE;
+  }
+
   Int_t imod = -1, iphi =-1, ieta=-1,iTower = -1, iIphi = -1, iIeta = -1, status=0;
 
   if (!geom->GetCellIndex(absID,imod,iTower,iIphi,iIeta)){
@@ -615,48 +636,70 @@ Bool_t AliEMCALRecoUtils::ClusterContainsBadChannel(const AliEMCALGeometry* geom
 }
 
 ///
-/// Calculate the energy in the cross around the energy of a given cell.
-/// Used in exotic clusters/cells rejection.
+/// Get the 4 cells in cross of the given cell, not in corners. In case of cell in
+/// eta = 0 border, the cross cell is taken in the neighbouring super module depending
+/// on the SM shift. The cells are computed once per geometry and kept in a table.
 ///
-/// \param absID: controlled cell absolute ID number
-/// \param tcell: time of cell under control
-/// \param cells: full list of cells
-/// \param bc: bunch crossing number
-/// \param cellMinEn: add the cell energy if large enough (for high energy clusters)
-/// \param useWeight: add the cell energy if w > 0
-/// \param energy: cluster or cell max energy, used for weight calculation
-///
-/// \return float E_cross
+/// \param geom: EMCal geometry
+/// \param absID: cell absolute ID number
+/// \param absID1: cell at row+1, -1 if none
+/// \param absID2: cell at row-1, -1 if none
+/// \param absID3: cell at col+1, -1 if none
+/// \param absID4: cell at col-1, -1 if none
 ///
 //___________________________________________________________________________
-Float_t AliEMCALRecoUtils::GetECross(Int_t absID, Double_t tcell,
-                                     AliVCaloCells* cells, Int_t bc,
-                                     Bool_t useWeight, Float_t energy )
+void AliEMCALRecoUtils::GetCellCrossNeighbours(AliEMCALGeometry * geom, Int_t absID,
+                                               Int_t & absID1, Int_t & absID2, Int_t & absID3, Int_t & absID4)
 {
-  AliEMCALGeometry * geom = AliEMCALGeometry::GetInstance();
+  // Geometry instances live until the end of the process, the table is kept per instance
+  static std::map<const AliEMCALGeometry *, std::vector<Int_t> > tables;
 
-  if(!geom)
+  std::vector<Int_t> & table = tables[geom];
+  if ( table.empty() )
   {
-    AliError("No instance of the geometry is available");
-    return -1;
+    const Int_t nCells = 24*48*geom->GetNumberOfSuperModules();
+    table.resize(4*nCells, -2);
+    Int_t imod = -1, iTower = -1, iIphi = -1, iIeta = -1;
+    for (Int_t icell = 0; icell < nCells; icell++)
+    {
+      // not existing cells are not tabulated
+      if ( !geom->GetCellIndex(icell,imod,iTower,iIphi,iIeta) ) continue;
+      ComputeCellCrossNeighbours(geom, icell, table[4*icell], table[4*icell+1], table[4*icell+2], table[4*icell+3]);
+    }
   }
 
+  if ( absID >= 0 && 4*absID < (Int_t)table.size() && table[4*absID] > -2 )
+  {
+    absID1 = table[4*absID];
+    absID2 = table[4*absID+1];
+    absID3 = table[4*absID+2];
+    absID4 = table[4*absID+3];
+  }
+  else
+    ComputeCellCrossNeighbours(geom, absID, absID1, absID2, absID3, absID4);
+}
+
+///
+/// Compute the 4 cells in cross of the given cell from the geometry, see GetCellCrossNeighbours().
+///
+//___________________________________________________________________________
+void AliEMCALRecoUtils::ComputeCellCrossNeighbours(AliEMCALGeometry * geom, Int_t absID,
+                                                   Int_t & absID1, Int_t & absID2, Int_t & absID3, Int_t & absID4)
+{
   Int_t imod = -1, iphi =-1, ieta=-1,iTower = -1, iIphi = -1, iIeta = -1;
   geom->GetCellIndex(absID,imod,iTower,iIphi,iIeta);
   geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,iphi,ieta);
 
-  // Get close cells index, energy and time, not in corners
-
-  Int_t absID1 = -1;
-  Int_t absID2 = -1;
+  absID1 = -1;
+  absID2 = -1;
 
   if ( iphi < AliEMCALGeoParams::fgkEMCALRows-1) absID1 = geom->GetAbsCellIdFromCellIndexes(imod, iphi+1, ieta);
   if ( iphi > 0 )                                absID2 = geom->GetAbsCellIdFromCellIndexes(imod, iphi-1, ieta);
 
   // In case of cell in eta = 0 border, depending on SM shift the cross cell index
 
-  Int_t absID3 = -1;
-  Int_t absID4 = -1;
+  absID3 = -1;
+  absID4 = -1;
 
   if ( ieta == AliEMCALGeoParams::fgkEMCALCols-1 && !(imod%2) )
   {
@@ -675,6 +718,39 @@ Float_t AliEMCALRecoUtils::GetECross(Int_t absID, Double_t tcell,
     if ( ieta > 0 )
       absID4 = geom-> GetAbsCellIdFromCellIndexes(imod, iphi, ieta-1);
   }
+}
+
+///
+/// Calculate the energy in the cross around the energy of a given cell.
+/// Used in exotic clusters/cells rejection.
+///
+/// \param absID: controlled cell absolute ID number
+/// \param tcell: time of cell under control
+/// \param cells: full list of cells
+/// \param bc: bunch crossing number
+/// \param cellMinEn: add the cell energy if large enough (for high energy clusters)
+/// \param useWeight: add the cell energy if w > 0
+/// \param energy: cluster or cell max energy, used for weight calculation
+///
+/// \return float E_cross
+///
+//___________________________________________________________________________
+Float_t AliEMCALRecoUtils::GetECross(Int_t absID, Double_t tcell,
+                                     AliVCaloCells* cells, Int_t bc,
+                                     Bool_t useWeight, Float_t energy )
+{
+  AliEMCALGeometry * geom = AliEMCALGeometry::GetInstance();
+
+  if(!geom)
+  {
+    AliError("No instance of the geometry is available");
+    return -1;
+  }
+
+  // Get close cells index, energy and time, not in corners
+
+  Int_t absID1 = -1, absID2 = -1, absID3 = -1, absID4 = -1;
+  GetCellCrossNeighbours(geom, absID, absID1, absID2, absID3, absID4);
 
   //printf("IMOD %d, AbsId %d, a %d, b %d, c %d e %d \n",imod,absID,absID1,absID2,absID3,absID4);
 
@@ -732,17 +808,10 @@ Bool_t AliEMCALRecoUtils::IsCellNextToCluster(Int_t absID, Float_t eThresh, AliV
     return -1;
   }
 
-  Int_t imod = -1, iphi =-1, ieta=-1,iTower = -1, iIphi = -1, iIeta = -1;
-  geom->GetCellIndex(absID,imod,iTower,iIphi,iIeta);
-  geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,iphi,ieta);
-
   // Get close cells index, energy and time, not in corners
 
-  Int_t absID1 = -1;
-  Int_t absID2 = -1;
-
-  if ( iphi < AliEMCALGeoParams::fgkEMCALRows-1) absID1 = geom->GetAbsCellIdFromCellIndexes(imod, iphi+1, ieta);
-  if ( iphi > 0 )                                absID2 = geom->GetAbsCellIdFromCellIndexes(imod, iphi-1, ieta);
+  Int_t absID1 = -1, absID2 = -1, absID3 = -1, absID4 = -1;
+  GetCellCrossNeighbours(geom, absID, absID1, absID2, absID3, absID4);
 
   // check the first two cells
   Float_t  ecell1  = 0, ecell2  = 0;
@@ -754,28 +823,6 @@ Bool_t AliEMCALRecoUtils::IsCellNextToCluster(Int_t absID, Float_t eThresh, AliV
   if(ecell1 > eThresh) return kTRUE;
   if(ecell2 > eThresh) return kTRUE;
 
-  // In case of cell in eta = 0 border, depending on SM shift the cross cell index
-
-  Int_t absID3 = -1;
-  Int_t absID4 = -1;
-
-  if ( ieta == AliEMCALGeoParams::fgkEMCALCols-1 && !(imod%2) )
-  {
-    absID3 = geom-> GetAbsCellIdFromCellIndexes(imod+1, iphi, 0);
-    absID4 = geom-> GetAbsCellIdFromCellIndexes(imod,   iphi, ieta-1);
-  }
-  else if ( ieta == 0 && imod%2 )
-  {
-    absID3 = geom-> GetAbsCellIdFromCellIndexes(imod,   iphi, ieta+1);
-    absID4 = geom-> GetAbsCellIdFromCellIndexes(imod-1, iphi, AliEMCALGeoParams::fgkEMCALCols-1);
-  }
-  else
-  {
-    if ( ieta < AliEMCALGeoParams::fgkEMCALCols-1 )
-      absID3 = geom-> GetAbsCellIdFromCellIndexes(imod, iphi, ieta+1);
-    if ( ieta > 0 )
-      absID4 = geom-> GetAbsCellIdFromCellIndexes(imod, iphi, ieta-1);
-  }
 
 
   Float_t  ecell3  = 0, ecell4  = 0;
@@ -1781,6 +1828,7 @@ Bool_t AliEMCALRecoUtils::GetIsNCellCorrected(AliVCluster* cluster, AliVCaloCell
 //____________________________________________________________________
 void AliEMCALRecoUtils::SetEMCALBadChannelStatusSelection(Bool_t all, Bool_t dead, Bool_t hot, Bool_t warm)
 {
+  ClearFlatCellCalibration();
   fBadStatusSelection[0] = all;  // declare all as bad if true, never mind the other settings
   fBadStatusSelection[1] = dead;
   fBadStatusSelection[2] = hot;
@@ -2288,6 +2336,7 @@ void AliEMCALRecoUtils::InitParameters()
 //_____________________________________________________
 void AliEMCALRecoUtils::InitEMCALRecalibrationFactors()
 {
+  ClearFlatCellCalibration();
   AliDebug(2,"AliCalorimeterUtils::InitEMCALRecalibrationFactors()");
 
   // In order to avoid rewriting the same histograms
@@ -2322,6 +2371,7 @@ void AliEMCALRecoUtils::InitEMCALRecalibrationFactors()
 //_____________________________________________________
 void AliEMCALRecoUtils::InitEMCALRecalibrationFactors1D()
 {
+  ClearFlatCellCalibration();
   AliDebug(2,"AliCalorimeterUtils::InitEMCALRecalibrationFactors1D()");
 
   // In order to avoid rewriting the same histograms
@@ -2351,6 +2401,7 @@ void AliEMCALRecoUtils::InitEMCALRecalibrationFactors1D()
 //_____________________________________________________
 void AliEMCALRecoUtils::InitEMCALSingleChannelRecalibrationFactors()
 {
+  ClearFlatCellCalibration();
   AliDebug(2,"AliCalorimeterUtils::InitEMCALSingleChannelRecalibrationFactors()");
 
   // In order to avoid rewriting the same histograms
@@ -2386,6 +2437,7 @@ void AliEMCALRecoUtils::InitEMCALSingleChannelRecalibrationFactors()
 //_________________________________________________________
 void AliEMCALRecoUtils::InitEMCALTimeRecalibrationFactors()
 {
+  ClearFlatCellCalibration();
   AliDebug(2,"AliCalorimeterUtils::InitEMCALRecalibrationFactors()");
 
   // In order to avoid rewriting the same histograms
@@ -2452,6 +2504,7 @@ void AliEMCALRecoUtils::InitEMCALTimeRecalibrationFactors()
 //____________________________________________________
 void AliEMCALRecoUtils::InitEMCALBadChannelStatusMap()
 {
+  ClearFlatCellCalibration();
   AliDebug(2,"AliEMCALRecoUtils::InitEMCALBadChannelStatusMap()");
 
   // In order to avoid rewriting the same histograms
@@ -2477,6 +2530,7 @@ void AliEMCALRecoUtils::InitEMCALBadChannelStatusMap()
 //____________________________________________________
 void AliEMCALRecoUtils::InitEMCALBadChannelStatusMap1D()
 {
+  ClearFlatCellCalibration();
   AliDebug(2,"AliEMCALRecoUtils::InitEMCALBadChannelStatusMap1D()");
 
   fUse1Dmap = kTRUE;
@@ -2585,7 +2639,7 @@ void AliEMCALRecoUtils::RecalibrateClusterEnergy(const AliEMCALGeometry* geom,
 //_______________________________________________________________________
 void AliEMCALRecoUtils::RecalibrateCells(AliVCaloCells * cells, Int_t bc)
 {
-  if (!IsRecalibrationOn() && !IsTimeRecalibrationOn() && !IsL1PhaseInTimeRecalibrationOn() && !IsBadChannelsRemovalSwitchedOn() && !IsSingleChannelRecalibrationOn())
+  if (!IsCellRecalibrationOn())
     return;
 
   if (!cells)
@@ -2624,6 +2678,167 @@ void AliEMCALRecoUtils::RecalibrateCells(AliVCaloCells * cells, Int_t bc)
   fCellsRecalibrated = kTRUE;
 }
 
+///
+/// Gather the bad channel status, the energy and the time calibration of each cell
+/// into flat arrays indexed by the absolute cell ID, removing the geometry and histogram
+/// lookups from AcceptCalibrateCell(), AcceptCalibrateCellFlat() and RecalibrateCellTime().
+/// To be called once the calibration maps are loaded, typically when the run changes.
+/// All available maps are gathered, independent of the recalibration switches, which
+/// are checked when the calibration is applied.
+///
+//_______________________________________________________________________
+void AliEMCALRecoUtils::FillFlatCellCalibration()
+{
+  AliEMCALGeometry* geom = AliEMCALGeometry::GetInstance();
+
+  if(!geom){
+    AliError("No instance of the geometry is available");
+    ClearFlatCellCalibration();
+    return;
+  }
+
+  const Int_t nCells = 24*48*geom->GetNumberOfSuperModules();
+
+  fFlatCellStatus.Set(nCells);
+  fFlatCellSM.Set(nCells);
+  fFlatCellGain.Set(nCells);
+  fFlatCellSingleChannelGain.Set(nCells);
+  fFlatCellTimeShift.Set(8*nCells);
+  fFlatCellTimeShift.Reset(0);
+
+  const Bool_t fillTime = fEMCALTimeRecalibrationFactors && fEMCALTimeRecalibrationFactors->GetEntriesFast() > 0;
+
+  Int_t imod = -1, iphi =-1, ieta=-1,iTower = -1, iIphi = -1, iIeta = -1, status=0;
+
+  for (Int_t absID = 0; absID < nCells; absID++)
+  {
+    fFlatCellGain[absID] = 1.;
+    fFlatCellSingleChannelGain[absID] = 1.;
+
+    if (!geom->GetCellIndex(absID,imod,iTower,iIphi,iIeta)){
+      fFlatCellStatus[absID] = -1;
+      fFlatCellSM[absID] = 0;
+      continue;
+    }
+
+    geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,iphi,ieta);
+
+    fFlatCellSM[absID] = imod;
+    fFlatCellStatus[absID] = 0;
+
+    // Only maps which exist for the super module are read, missing ones leave the defaults
+    if ( fEMCALBadChannelMap && fEMCALBadChannelMap->At(fUse1Dmap ? 0 : imod) ){
+      Bool_t bad = kFALSE;
+
+      if(fUse1Dmap)
+        bad = GetEMCALChannelStatus1D(absID,status);
+      else
+        bad = GetEMCALChannelStatus(imod, ieta, iphi,status);
+
+      if ( bad ) fFlatCellStatus[absID] = 1;
+    }
+
+    if ( fEMCALRecalibrationFactors && fEMCALRecalibrationFactors->At(fUse1Drecalib ? 0 : imod) ){
+      if(fUse1Drecalib)
+        fFlatCellGain[absID] = GetEMCALChannelRecalibrationFactor1D(absID);
+      else
+        fFlatCellGain[absID] = GetEMCALChannelRecalibrationFactor(imod,ieta,iphi);
+    }
+
+    if ( fEMCALSingleChannelRecalibrationFactors && fEMCALSingleChannelRecalibrationFactors->GetEntries() > imod &&
+         fEMCALSingleChannelRecalibrationFactors->At(imod) )
+      fFlatCellSingleChannelGain[absID] = GetEMCALSingleChannelRecalibrationFactor(imod,ieta,iphi);
+
+    if ( fillTime ){
+      for (Int_t ibc = 0; ibc < 4; ibc++){
+        if ( fEMCALTimeRecalibrationFactors->At(fDoUseMergedBC ? 0 : ibc) )
+          fFlatCellTimeShift[ibc*nCells+absID] = GetEMCALChannelTimeRecalibrationFactor(ibc,absID,kFALSE);
+        // low gain cells use the high gain calibration if there is no low gain one
+        Int_t indexLG = fDoUseMergedBC ? 1 : ibc+4;
+        if ( fEMCALTimeRecalibrationFactors->GetEntriesFast() > indexLG && fEMCALTimeRecalibrationFactors->At(indexLG) )
+          fFlatCellTimeShift[(ibc+4)*nCells+absID] = GetEMCALChannelTimeRecalibrationFactor(ibc,absID,kTRUE);
+        else
+          fFlatCellTimeShift[(ibc+4)*nCells+absID] = fFlatCellTimeShift[ibc*nCells+absID];
+      }
+    }
+  }
+}
+
+///
+/// Reset the flat per-cell calibration, it has to be filled again before
+/// AcceptCalibrateCellFlat() can be used.
+///
+//_______________________________________________________________________
+void AliEMCALRecoUtils::ClearFlatCellCalibration()
+{
+  fFlatCellStatus.Set(0);
+  fFlatCellSM.Set(0);
+  fFlatCellGain.Set(0);
+  fFlatCellSingleChannelGain.Set(0);
+  fFlatCellTimeShift.Set(0);
+}
+
+///
+/// Same as AcceptCalibrateCell() but the amplitude and time are given as input
+/// instead of being read from the cells, so that several corrections can be applied
+/// one after the other to a cell in a single loop. The calibration is taken from the
+/// flat arrays filled by FillFlatCellCalibration().
+///
+/// \param absID: absolute cell ID
+/// \param bc: bunch crossing number returned by esdevent->GetBunchCrossNumber()
+/// \param isLowGain: cell is low gain
+/// \param amp: input cell energy, recalibrated on output
+/// \param time: input cell time, recalibrated on output
+/// \return kFALSE if the cell does not exist or is bad
+///
+//_______________________________________________________________________
+Bool_t AliEMCALRecoUtils::AcceptCalibrateCellFlat(Int_t absID, Int_t bc, Bool_t isLowGain,
+                                                  Float_t & amp, Double_t & time)
+{
+  const Int_t nCells = fFlatCellStatus.GetSize();
+
+  if ( absID < 0 || absID >= nCells )
+    return kFALSE;
+
+  const Char_t status = fFlatCellStatus[absID];
+
+  if ( status < 0 ){
+    // cell absID does not exist
+    amp=0; time = 1.e9;
+    return kFALSE;
+  }
+
+  if ( status > 0 && IsBadChannelsRemovalSwitchedOn() )
+    return kFALSE;
+
+  //Recalibrate energy
+  if (!fCellsRecalibrated && IsRecalibrationOn()){
+    // take out non lin from shaper for low gain cells
+    if(fUseShaperNonlin && isLowGain){
+      amp = CorrectShaperNonLin(amp,1.);
+    }
+
+    amp *= fFlatCellGain[absID];
+
+    if (IsSingleChannelRecalibrationOn())
+      amp *= fFlatCellSingleChannelGain[absID];
+  }
+
+  // Recalibrate time
+  if (IsTimeECorrectionOn())
+    CorrectCellTimeVsE(amp, time, isLowGain);
+  time-=fConstantTimeShift*1e-9; // only in case of old Run1 simulation
+
+  //Recalibrate time with L1 phase
+  RecalibrateCellTimeL1Phase(fFlatCellSM[absID], bc, time, fCurrentParNumber);
+
+  // Correct for cable length and other delays
+  if (!fCellsRecalibrated && IsTimeRecalibrationOn() && bc >= 0)
+    time -= fFlatCellTimeShift[(bc%4 + 4*(fLowGain && isLowGain))*nCells + absID]*1.e-9;
+
+  return kTRUE;
+}
+
 ///
 /// Recalibrate all the cells with energy>40 GeV for the shaper nonlinearity
 ///
@@ -2704,7 +2919,10 @@ Double_t AliEMCALRecoUtils::GetLowGainSlewing (Double_t energy) const
 void AliEMCALRecoUtils::RecalibrateCellTime(Int_t absId, Int_t bc, Double_t & celltime, Bool_t isLGon) const
 {
   if (!fCellsRecalibrated && IsTimeRecalibrationOn() && bc >= 0) {
-    if(fLowGain)
+    const Int_t nCells = fFlatCellStatus.GetSize();
+    if(absId >= 0 && absId < nCells)
+      celltime -= fFlatCellTimeShift[(bc%4 + 4*(fLowGain && isLGon))*nCells + absId]*1.e-9;
+    else if(fLowGain)
       celltime -= GetEMCALChannelTimeRecalibrationFactor(bc%4,absId,isLGon)*1.e-9;
     else
       celltime -= GetEMCALChannelTimeRecalibrationFactor(bc%4,absId,kFALSE)*1.e-9;
@@ -4946,6 +5164,7 @@ void AliEMCALRecoUtils::SetTracksMatchedToCluster(const AliVEvent *event)
 }
 
 void AliEMCALRecoUtils::SetEMCALChannelRecalibrationFactors(const TObjArray *map) {
+  ClearFlatCellCalibration();
   if(fEMCALRecalibrationFactors) fEMCALRecalibrationFactors->Clear();
   else {
     fEMCALRecalibrationFactors = new TObjArray(map->GetEntries());
@@ -4970,6 +5189,7 @@ void AliEMCALRecoUtils::SetEMCALChannelRecalibrationFactors(const TObjArray *map
 }
 
 void AliEMCALRecoUtils::SetEMCALChannelRecalibrationFactors(Int_t iSM , const TH2F* h) {
+  ClearFlatCellCalibration();
   if(!fEMCALRecalibrationFactors){
     fEMCALRecalibrationFactors = new TObjArray(iSM);
     fEMCALRecalibrationFactors->SetOwner(true);
@@ -4982,6 +5202,7 @@ void AliEMCALRecoUtils::SetEMCALChannelRecalibrationFactors(Int_t iSM , const TH
 }
 
 void AliEMCALRecoUtils::SetEMCALChannelRecalibrationFactors1D(const TH1S* h) {
+  ClearFlatCellCalibration();
   if(!fEMCALRecalibrationFactors){
     fEMCALRecalibrationFactors = new TObjArray(1);
     fEMCALRecalibrationFactors->SetOwner(true);
@@ -5017,6 +5238,7 @@ TH2F * AliEMCALRecoUtils::GetEMCALChannelRecalibrationFactors(Int_t iSM) const{
  Setting EMCAL and DCAL single channel calibration factors using a map
  */
 void AliEMCALRecoUtils::SetEMCALSingleChannelRecalibrationFactors(const TObjArray *map) {
+  ClearFlatCellCalibration();
   if(fEMCALSingleChannelRecalibrationFactors) fEMCALSingleChannelRecalibrationFactors->Clear();
   else {
     fEMCALSingleChannelRecalibrationFactors = new TObjArray(map->GetEntries());
@@ -5037,6 +5259,7 @@ void AliEMCALRecoUtils::SetEMCALSingleChannelRecalibrationFactors(const TObjArra
  Setting EMCAL and DCAL single channel calibration factors using an SM by SM histogram
  */
 void AliEMCALRecoUtils::SetEMCALSingleChannelRecalibrationFactors(Int_t iSM , const TH2F* h) {
+  ClearFlatCellCalibration();
   if(!fEMCALSingleChannelRecalibrationFactors){
     fEMCALSingleChannelRecalibrationFactors = new TObjArray(iSM);
     fEMCALSingleChannelRecalibrationFactors->SetOwner(true);
@@ -5049,6 +5272,7 @@ void AliEMCALRecoUtils::SetEMCALSingleChannelRecalibrationFactors(Int_t iSM , co
 }
 
 void AliEMCALRecoUtils::SetEMCALChannelStatusMap(const TObjArray *map) {
+  ClearFlatCellCalibration();
   if(fEMCALBadChannelMap) fEMCALBadChannelMap->Clear();
   else {
     fEMCALBadChannelMap = new TObjArray(map->GetEntries());
@@ -5073,6 +5297,7 @@ void AliEMCALRecoUtils::SetEMCALChannelStatusMap(const TObjArray *map) {
 }
 
 void AliEMCALRecoUtils::SetEMCALChannelStatusMap(Int_t iSM , const TH2I* h) {
+  ClearFlatCellCalibration();
   if(!fEMCALBadChannelMap){
     fEMCALBadChannelMap = new TObjArray(iSM);
     fEMCALBadChannelMap->SetOwner(true);
@@ -5085,6 +5310,7 @@ void AliEMCALRecoUtils::SetEMCALChannelStatusMap(Int_t iSM , const TH2I* h) {
 }
 
 void AliEMCALRecoUtils::SetEMCALChannelStatusMap1D(const TH1C* h) {
+  ClearFlatCellCalibration();
   fUse1Dmap = kTRUE;
   if(!fEMCALBadChannelMap){
     fEMCALBadChannelMap = new TObjArray(1);
@@ -5125,6 +5351,7 @@ void  AliEMCALRecoUtils::SetEMCALTimeVsEHighGainSlewingCorr(const TSpline3 *spli
 }
 
 void  AliEMCALRecoUtils::SetEMCALChannelTimeRecalibrationFactors(const TObjArray *map) {
+  ClearFlatCellCalibration();
   if(fEMCALTimeRecalibrationFactors) fEMCALTimeRecalibrationFactors->Clear();
   else {
     fEMCALTimeRecalibrationFactors = new TObjArray(map->GetEntries());
@@ -5142,6 +5369,7 @@ void  AliEMCALRecoUtils::SetEMCALChannelTimeRecalibrationFactors(const TObjArray
 }
 
 void  AliEMCALRecoUtils::SetEMCALChannelTimeRecalibrationFactors(Int_t bc, const TH1* h){
+  ClearFlatCellCalibration();
   if(!fEMCALTimeRecalibrationFactors){
     fEMCALTimeRecalibrationFactors = new TObjArray(bc);
     fEMCALTimeRecalibrationFactors->SetOwner(true);
@@ -192,6 +192,18 @@ public:
   Bool_t   AcceptCalibrateCell(Int_t absId, Int_t bc,
                                Float_t & amp, Double_t & time, AliVCaloCells* cells) ; // Energy and Time
   void     RecalibrateCells(AliVCaloCells * cells, Int_t bc) ; // Energy and Time
+  Bool_t   IsCellRecalibrationOn()                 const { return IsRecalibrationOn() || IsTimeRecalibrationOn() || IsL1PhaseInTimeRecalibrationOn() ||
+                                                                  IsBadChannelsRemovalSwitchedOn() || IsSingleChannelRecalibrationOn() ; }
+  void     SetCellsRecalibrated()                        { fCellsRecalibrated = kTRUE ; }
+
+  // Flat per-cell calibration indexed by absolute cell ID, filled once per run. When filled it is
+  // used by AcceptCalibrateCell(), RecalibrateCells() and RecalibrateCellTime(). Setting new maps
+  // clears it, maps modified through the histogram getters require to fill it again.
+  void     FillFlatCellCalibration() ;
+  Bool_t   HasFlatCellCalibration()                const { return fFlatCellStatus.GetSize() > 0 ; }
+  void     ClearFlatCellCalibration() ;
+  Bool_t   AcceptCalibrateCellFlat(Int_t absId, Int_t bc, Bool_t isLowGain,
+                                   Float_t & amp, Double_t & time) ; // Energy and Time, input amplitude and time
   void     RecalibrateClusterEnergy(const AliEMCALGeometry* geom, AliVCluster* cluster, AliVCaloCells * cells, Int_t bc=-1) ; // Energy and time
   void     ResetCellsCalibrated()                        { fCellsRecalibrated = kFALSE; }
 
@@ -201,7 +213,7 @@ public:
   void     SwitchOffRecalibration()                      { fRecalibration = kFALSE ; }
   void     SwitchOnRecalibration()                       { fRecalibration = kTRUE  ;
                                                            if(!fEMCALRecalibrationFactors)InitEMCALRecalibrationFactors() ; }
-  void     SetUse1DRecalibration(Bool_t use)             { fUse1Drecalib = use; }
+  void     SetUse1DRecalibration(Bool_t use)             { fUse1Drecalib = use; ClearFlatCellCalibration() ; }
   void     InitEMCALRecalibrationFactors() ;
   void     InitEMCALRecalibrationFactors1D() ;
   TObjArray* GetEMCALRecalibrationFactorsArray()   const { return fEMCALRecalibrationFactors ; }
@@ -220,10 +232,12 @@ public:
     else return 1 ; }
   void     SetEMCALChannelRecalibrationFactor(Int_t iSM , Int_t iCol, Int_t iRow, Double_t c = 1) {
     if(!fEMCALRecalibrationFactors) InitEMCALRecalibrationFactors() ;
+    ClearFlatCellCalibration() ;
     ((TH2F*)fEMCALRecalibrationFactors->At(iSM))->SetBinContent(iCol,iRow,c) ; }
 
   void     SetEMCALChannelRecalibrationFactor1D(UInt_t icell, Double_t c = 1) {
     if(!fEMCALRecalibrationFactors) InitEMCALRecalibrationFactors1D() ;
+    ClearFlatCellCalibration() ;
     ((TH1S*)fEMCALRecalibrationFactors->At(0))->SetBinContent(icell,c) ; }
 
   // Recalibrate channels energy with run dependent corrections
@@ -247,6 +261,7 @@ public:
   void     SetEMCALSingleChannelRecalibrationFactors(Int_t iSM , const TH2F* h);
   void     SetEMCALSingleChannelRecalibrationFactor(Int_t iSM , Int_t iCol, Int_t iRow, Double_t c = 1) {
     if(!fEMCALSingleChannelRecalibrationFactors) InitEMCALSingleChannelRecalibrationFactors() ;
+    ClearFlatCellCalibration() ;
     ((TH2F*)fEMCALSingleChannelRecalibrationFactors->At(iSM))->SetBinContent(iCol,iRow,c) ; }
 
   // Time Recalibration
@@ -270,7 +285,7 @@ public:
       return nullptr;
   }
 
-  void     SetUseOneHistForAllBCs(Bool_t useOneHist)     { fDoUseMergedBC = useOneHist ; }
+  void     SetUseOneHistForAllBCs(Bool_t useOneHist)     { fDoUseMergedBC = useOneHist ; ClearFlatCellCalibration() ; }
   void     SetConstantTimeShift(Float_t shift)           { fConstantTimeShift = shift  ; }
 
   void     RecalibrateCellTime(Int_t absId, Int_t bc, Double_t & time,Bool_t isLGon = kFALSE) const;
@@ -291,6 +306,7 @@ public:
     } else return 0 ; }
   void     SetEMCALChannelTimeRecalibrationFactor(Int_t bc, Int_t absID, Double_t c = 0, Bool_t isLGon=kFALSE) {
     if(!fEMCALTimeRecalibrationFactors) InitEMCALTimeRecalibrationFactors() ;
+    ClearFlatCellCalibration() ;
     if(fDoUseMergedBC)
       ((TH1S*)fEMCALTimeRecalibrationFactors->At(isLGon))->SetBinContent(absID,c) ;
     else
@@ -364,7 +380,7 @@ public:
   void     SwitchOffBadChannelsRemoval()                 { fRemoveBadChannels = kFALSE     ; }
   void     SwitchOnBadChannelsRemoval ()                 { fRemoveBadChannels = kTRUE ;
                                                            if(!fEMCALBadChannelMap)InitEMCALBadChannelStatusMap() ; }
-  void     SetUse1DBadChannelMap(Bool_t use)             { fUse1Dmap = use;}
+  void     SetUse1DBadChannelMap(Bool_t use)             { fUse1Dmap = use; ClearFlatCellCalibration() ; }
   Bool_t   IsDistanceToBadChannelRecalculated()    const { return fRecalDistToBadChannels   ; }
   void     SwitchOffDistToBadChannelRecalculation()      { fRecalDistToBadChannels = kFALSE ; }
   void     SwitchOnDistToBadChannelRecalculation()       { fRecalDistToBadChannels = kTRUE  ;
@@ -374,18 +390,20 @@ public:
   void     InitEMCALBadChannelStatusMap1D() ;
   void     SetEMCALBadChannelStatusSelection(Bool_t all, Bool_t dead, Bool_t hot, Bool_t warm);
   void     SetWarmChannelAsGood()
-           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kWarning] = kFALSE; }
+           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kWarning] = kFALSE; ClearFlatCellCalibration() ; }
   void     SetDeadChannelAsGood()
-           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kDead]    = kFALSE; }
+           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kDead]    = kFALSE; ClearFlatCellCalibration() ; }
   void     SetHotChannelAsGood()
-           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kHot]     = kFALSE; }
+           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kHot]     = kFALSE; ClearFlatCellCalibration() ; }
   Bool_t   GetEMCALChannelStatus(Int_t iSM , Int_t iCol, Int_t iRow, Int_t & status) const ;
   Bool_t   GetEMCALChannelStatus1D(Int_t iCell, Int_t & status) const ;
   void     SetEMCALChannelStatus(Int_t iSM , Int_t iCol, Int_t iRow, Double_t status = 1) {
     if(!fEMCALBadChannelMap)InitEMCALBadChannelStatusMap()               ;
+    ClearFlatCellCalibration()                                           ;
     ((TH2I*)fEMCALBadChannelMap->At(iSM))->SetBinContent(iCol,iRow,status)    ; }
   void     SetEMCALChannelStatus1D(Int_t iCell, Double_t status = 1) {
     if(!fEMCALBadChannelMap)InitEMCALBadChannelStatusMap1D()               ;
+    ClearFlatCellCalibration()                                             ;
     ((TH1C*)fEMCALBadChannelMap->At(0))->SetBinContent(iCell,status)    ; }
   TH2I *   GetEMCALChannelStatusMap(Int_t iSM)     const;
   TH1C *   GetEMCALChannelStatusMap1D()     const { return (TH1C*)fEMCALBadChannelMap->At(0) ; }
@@ -549,6 +567,8 @@ public:
   Float_t  GetECross(Int_t absID, Double_t tcell, AliVCaloCells* cells, Int_t bc,
                      Bool_t useWeight = kFALSE, Float_t energyClus = 0.);
   Bool_t   IsCellNextToCluster(Int_t absID, Float_t eThresh, AliVCaloCells* cells, Int_t bc = -1);
+  static void GetCellCrossNeighbours(AliEMCALGeometry * geom, Int_t absID,
+                                     Int_t & absID1, Int_t & absID2, Int_t & absID3, Int_t & absID4);
   Float_t  GetExoticCellFractionCut()           const { return fExoticCellFraction     ; }
   Float_t  GetExoticCellDiffTimeCut()           const { return fExoticCellDiffTime     ; }
   Float_t  GetExoticCellMinAmplitudeCut()       const { return fExoticCellMinAmplitude ; }
@@ -597,6 +617,9 @@ public:
   void     RecalculateCellLabelsRemoveAddedGenerator( Int_t absID, AliVCluster* clus, AliMCEvent* mc,
                                                       Float_t & amp, TArrayI & labeArr, TArrayF & eDepArr ) const;
 private:
+  static void ComputeCellCrossNeighbours(AliEMCALGeometry * geom, Int_t absID,
+                                         Int_t & absID1, Int_t & absID2, Int_t & absID3, Int_t & absID4);
+
 
   // Position recalculation
   Float_t    fMisalTransShift[15];       ///< Cluster position translation shift parameters
@@ -732,8 +755,15 @@ private:
   TString    fMCGenerToAccept[5];        ///<  List with name of generators that should not be included
   Bool_t     fMCGenerToAcceptForTrack;   ///<  Activate the removal of tracks entering the track matching that come from a particular generator
 
+  // Flat per-cell calibration, indexed by absolute cell ID
+  TArrayC    fFlatCellStatus;            //!<! 0 good, 1 bad (if bad channel removal was on when filled), -1 cell not existing
+  TArrayC    fFlatCellSM;                //!<! Super module of the cell
+  TArrayF    fFlatCellGain;              //!<! Energy recalibration factor
+  TArrayF    fFlatCellSingleChannelGain; //!<! Single channel recalibration factor
+  TArrayF    fFlatCellTimeShift;         //!<! Time recalibration (ns), 4 BC high gain then 4 BC low gain, each of the cell size
+
   /// \cond CLASSIMP
-  ClassDef(AliEMCALRecoUtils, 38) ;
+  ClassDef(AliEMCALRecoUtils, 39) ;
   /// \endcond
 
 };
@@ -24,8 +24,13 @@
  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
  ************************************************************************************/
+#include <cstring>
+#include <map>
+#include <tuple>
+#include <TBufferFile.h>
 #include <TClonesArray.h>
 #include "AliVEvent.h"
+#include "AliVHeader.h"
 #include "AliLog.h"
 #include "AliNamedArrayI.h"
 #include "AliVParticle.h"
@@ -37,6 +42,19 @@
 
 ClassImp(AliEmcalContainer);
 
+namespace {
+/// Selection result shared between containers with identical configuration
+struct AliEmcalAcceptCacheEntry {
+  std::vector<Int_t>  fIndices;
+  std::vector<UInt_t> fReasons;
+};
+
+/// Shared selection results of the current event, keyed by array, size and cut configuration
+typedef std::map<std::tuple<const TClonesArray *, Int_t, ULong64_t>, AliEmcalAcceptCacheEntry> AliEmcalAcceptCacheRegistry;
+AliEmcalAcceptCacheRegistry gAcceptCacheRegistry;
+ULong64_t gAcceptCacheRegistryEvent = 0;
+}
+
 AliEmcalContainer::AliEmcalContainer():
   TObject(),
   fName(),
@@ -56,10 +74,19 @@ AliEmcalContainer::AliEmcalContainer():
   fMaxMCLabel(-1),
   fMassHypothesis(-1),
   fIsEmbedding(kFALSE),
+  fCacheAccepted(kFALSE),
+  fShareAcceptCache(kFALSE),
   fClArray(0),
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fAcceptIndices(),
+  fRejectionReasons(),
+  fAcceptCacheValid(kFALSE),
+  fAcceptCacheArray(0),
+  fAcceptCacheEntries(0),
+  fAcceptCacheConfig(0),
+  fAcceptCacheEvent(0),
   fClassName()
 {
   fVertex[0] = 0;
@@ -86,10 +113,19 @@ AliEmcalContainer::AliEmcalContainer(const char *name):
   fMaxMCLabel(-1),
   fMassHypothesis(-1),
   fIsEmbedding(kFALSE),
+  fCacheAccepted(kFALSE),
+  fShareAcceptCache(kFALSE),
   fClArray(0),
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fAcceptIndices(),
+  fRejectionReasons(),
+  fAcceptCacheValid(kFALSE),
+  fAcceptCacheArray(0),
+  fAcceptCacheEntries(0),
+  fAcceptCacheConfig(0),
+  fAcceptCacheEvent(0),
   fClassName()
 {
   fVertex[0] = 0;
@@ -162,18 +198,90 @@ void AliEmcalContainer::NextEvent(const AliVEvent * event)
   // Get the right event (either the current event of the embedded event)
   event = AliEmcalContainerUtils::GetEvent(event, fIsEmbedding);
 
+  fAcceptCacheValid = kFALSE;
+  fAcceptCacheEvent = 0;
+
   if (!event) return;
 
   GetVertexFromEvent(event);
+
+  if (fShareAcceptCache) {
+    // the event pointer alone is not enough, as the same object is reused by the input handler
+    const AliVHeader *header = event->GetHeader();
+    fAcceptCacheEvent = reinterpret_cast<ULong_t>(event) ^ (static_cast<ULong64_t>(event->GetRunNumber()) << 40);
+    if (header) fAcceptCacheEvent ^= header->GetEventIdAsLong() * 0x9E3779B97F4A7C15ULL;
+    if (!fAcceptCacheEvent) fAcceptCacheEvent = 1;
+  }
 }
 
 Int_t AliEmcalContainer::GetNAcceptEntries() const{
-  Int_t result = 0;
-  for(int index = 0; index < GetNEntries(); index++){
-    UInt_t rejectionReason = 0;
-    if(AcceptObject(index, rejectionReason)) result++;
+  return GetAcceptedIndices().size();
+}
+
+const std::vector<Int_t> &AliEmcalContainer::GetAcceptedIndices() const {
+  FillAcceptCache();
+  return fAcceptIndices;
+}
+
+UInt_t AliEmcalContainer::GetCachedRejectionReason(Int_t i) const {
+  FillAcceptCache();
+  if (i < 0 || i >= static_cast<Int_t>(fRejectionReasons.size())) return kNullObject;
+  return fRejectionReasons[i];
+}
+
+ULong64_t AliEmcalContainer::GetCutConfigHash() const {
+  TBufferFile buffer(TBuffer::kWrite);
+  const_cast<AliEmcalContainer *>(this)->Streamer(buffer);
+  ULong64_t hash = TString::Hash(buffer.Buffer(), buffer.Length());
+  const char *clname = ClassName();
+  return (hash << 32) | TString::Hash(clname, strlen(clname));
+}
+
+void AliEmcalContainer::FillAcceptCache() const {
+  const Int_t nentries = GetNEntries();
+  ULong64_t config = 0;
+  if (fCacheAccepted) {
+    config = GetCutConfigHash();
+    if (fAcceptCacheValid && fAcceptCacheArray == fClArray && fAcceptCacheEntries == nentries && fAcceptCacheConfig == config) return;
+  }
+
+  AliEmcalAcceptCacheEntry *shared = NULL;
+  Bool_t fromRegistry = kFALSE;
+  if (fCacheAccepted && fShareAcceptCache && fAcceptCacheEvent && fClArray) {
+    if (gAcceptCacheRegistryEvent != fAcceptCacheEvent) {
+      gAcceptCacheRegistry.clear();
+      gAcceptCacheRegistryEvent = fAcceptCacheEvent;
+    }
+    auto key = std::make_tuple(static_cast<const TClonesArray *>(fClArray), nentries, config);
+    auto found = gAcceptCacheRegistry.find(key);
+    if (found != gAcceptCacheRegistry.end()) {
+      fAcceptIndices = found->second.fIndices;
+      fRejectionReasons = found->second.fReasons;
+      fromRegistry = kTRUE;
+    }
+    else {
+      shared = &gAcceptCacheRegistry[key];
+    }
+  }
+
+  if (!fromRegistry) {
+    fAcceptIndices.clear();
+    fRejectionReasons.assign(nentries, 0);
+    for (Int_t index = 0; index < nentries; index++) {
+      UInt_t rejectionReason = 0;
+      if (AcceptObject(index, rejectionReason)) fAcceptIndices.push_back(index);
+      fRejectionReasons[index] = rejectionReason;
+    }
+    if (shared) {
+      shared->fIndices = fAcceptIndices;
+      shared->fReasons = fRejectionReasons;
+    }
   }
-  return result;
+
+  fAcceptCacheValid = fCacheAccepted;
+  fAcceptCacheArray = fClArray;
+  fAcceptCacheEntries = nentries;
+  fAcceptCacheConfig = config;
 }
 
 Int_t AliEmcalContainer::GetIndexFromLabel(Int_t lab) const
@@ -37,6 +37,7 @@ class AliVEvent;
 class AliNamedArrayI;
 class AliVParticle;
 
+#include <vector>
 #include <TNamed.h>
 #include <TClonesArray.h>
 
@@ -96,6 +97,12 @@ typedef EMCALIterableContainer::AliEmcalIterableContainerT<TObject, EMCALIterabl
  * }
  * ~~~
  *
+ * The selection can be cached per event (SetCacheAcceptedIndices): the accepted
+ * indices and the rejection reasons are then evaluated once and reused by
+ * GetNAcceptEntries and the accepted iterators. Containers with identical cut
+ * configuration connected to the same array can in addition share the result
+ * within the event, i.e. across wagons of a train.
+ *
  * The usage of EMCAL containers is described under \subpage EMCALcontainers
  */
 class AliEmcalContainer : public TObject {
@@ -229,6 +236,44 @@ class AliEmcalContainer : public TObject {
    */
   Int_t                       GetNAcceptEntries() const;
 
+  /**
+   * @brief Get the indices of the accepted entries in the container
+   *
+   * With caching enabled the selection is evaluated only once per event and
+   * cut configuration, otherwise it is evaluated at each call.
+   * @return Indices of the accepted entries in ascending order
+   */
+  const std::vector<Int_t>   &GetAcceptedIndices() const;
+
+  /**
+   * @brief Get the rejection reason of an entry from the selection cache
+   * @param[in] i Index of the entry in the container
+   * @return Rejection reason bitmap (0 for accepted entries)
+   */
+  UInt_t                      GetCachedRejectionReason(Int_t i) const;
+
+  /**
+   * @brief Enable the per-event cache of the selection result
+   *
+   * The cache is invalidated in NextEvent and whenever the cut configuration,
+   * the array or its size changes. It must be invalidated by hand (InvalidateAcceptCache)
+   * in case objects inside the array are modified after the first selection in the event.
+   * @param[in] doCache If true the selection result is cached
+   * @param[in] share If true the result is shared with identical containers in the same event
+   */
+  void                        SetCacheAcceptedIndices(Bool_t doCache, Bool_t share = kFALSE) { fCacheAccepted = doCache; fShareAcceptCache = share; InvalidateAcceptCache(); }
+  void                        InvalidateAcceptCache()               { fAcceptCacheValid = kFALSE          ; }
+  Bool_t                      IsCacheAcceptedIndices()        const { return fCacheAccepted             ; }
+
+  /**
+   * @brief Checksum of the cut configuration, used as key of the selection cache
+   *
+   * Built from the streamed persistent members, so cuts of derived classes are
+   * included automatically.
+   * @return Checksum of the configuration
+   */
+  ULong64_t                   GetCutConfigHash() const;
+
   /**
    * @brief Reset the iterator to a given index
    * 
@@ -372,6 +417,11 @@ class AliEmcalContainer : public TObject {
    */
   void                        GetVertexFromEvent(const AliVEvent * event);
 
+  /**
+   * @brief Evaluate the selection for all entries into the cache
+   */
+  void                        FillAcceptCache() const;
+
   TString                     fName;                    ///< object name
   TString                     fClArrayName;             ///< name of branch
   TString                     fBaseClassName;           ///< name of the base class that this container can handle
@@ -389,11 +439,20 @@ class AliEmcalContainer : public TObject {
   Int_t                       fMaxMCLabel;              ///< maximum MC label
   Double_t                    fMassHypothesis;          ///< if < 0 it will use a PID mass when available
   Bool_t                      fIsEmbedding;             ///< if true, this container will connect to an external event
+  Bool_t                      fCacheAccepted;           ///< cache the selection result per event
+  Bool_t                      fShareAcceptCache;        ///< share the cached selection result with identical containers
   TClonesArray               *fClArray;                 //!<! Pointer to array in input event
   Int_t                       fCurrentID;               //!<! current ID for automatic loops
   AliNamedArrayI             *fLabelMap;                //!<! Label-Index map
   Double_t                    fVertex[3];               //!<! event vertex array
   TClass                     *fLoadedClass;             //!<! Class of the objects contained in the TClonesArray
+  mutable std::vector<Int_t>  fAcceptIndices;           //!<! cached indices of accepted entries
+  mutable std::vector<UInt_t> fRejectionReasons;        //!<! cached rejection reason of each entry
+  mutable Bool_t              fAcceptCacheValid;        //!<! cache filled for the current event
+  mutable const TClonesArray *fAcceptCacheArray;        //!<! array the cache was filled for
+  mutable Int_t               fAcceptCacheEntries;      //!<! number of entries the cache was filled for
+  mutable ULong64_t           fAcceptCacheConfig;       //!<! cut configuration the cache was filled for
+  ULong64_t                   fAcceptCacheEvent;        //!<! identifier of the current event
 
  private:
   TString                     fClassName;               ///< name of the class in the TClonesArray
@@ -401,6 +460,6 @@ class AliEmcalContainer : public TObject {
   AliEmcalContainer(const AliEmcalContainer& obj); // copy constructor
   AliEmcalContainer& operator=(const AliEmcalContainer& other); // assignment
 
-  ClassDef(AliEmcalContainer,9);
+  ClassDef(AliEmcalContainer,10);
 };
 #endif
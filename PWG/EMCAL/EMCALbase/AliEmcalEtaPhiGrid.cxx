@@ -0,0 +1,146 @@
+/**************************************************************************
+ * Copyright(c) 1998-2021, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <algorithm>
+#include <cmath>
+
+#include <TMath.h>
+
+#include "AliEmcalEtaPhiGrid.h"
+
+/**
+ * Default constructor, the grid is empty.
+ */
+AliEmcalEtaPhiGrid::AliEmcalEtaPhiGrid() :
+  fNEntries(0),
+  fEtaMin(0),
+  fEtaBinWidth(0),
+  fNEta(0),
+  fNPhi(0),
+  fCellOffset(),
+  fCellEntries(),
+  fAlwaysEntries()
+{
+}
+
+/**
+ * Sort the objects into the grid. The storage is kept from one call to the next.
+ *
+ * @param eta Eta of the objects
+ * @param phi Phi of the objects, any range
+ * @param distance Maximum distance in eta and in phi of the neighbourhood queries
+ */
+void AliEmcalEtaPhiGrid::Fill(const std::vector<Double_t>& eta, const std::vector<Double_t>& phi, Double_t distance)
+{
+  fNEntries = eta.size();
+  fNEta = 0;
+  fNPhi = 0;
+  fCellEntries.clear();
+  fAlwaysEntries.clear();
+
+  if (phi.size() != eta.size() || !(distance > 0) || !std::isfinite(distance)) return;
+
+  fEtaMin = 0;
+  Double_t etaMax = 0;
+  Bool_t first = kTRUE;
+  for (Int_t i = 0; i < fNEntries; i++) {
+    if (!std::isfinite(eta[i]) || !std::isfinite(phi[i])) continue;
+    if (first || eta[i] < fEtaMin) fEtaMin = eta[i];
+    if (first || eta[i] > etaMax) etaMax = eta[i];
+    first = kFALSE;
+  }
+
+  // bins are made slightly larger than the distance, so that an object within the
+  // distance is never more than one bin away despite the rounding of the bin index
+  fEtaBinWidth = distance * (1. + 1e-6);
+  Double_t nEta = (etaMax - fEtaMin) / fEtaBinWidth + 1;
+  fNPhi = TMath::Max(1, Int_t(TMath::TwoPi() / fEtaBinWidth));
+  if (nEta * fNPhi > 1e6) {
+    // too fine a grid for the spread of the objects, let the caller loop over all pairs
+    fNPhi = 0;
+    return;
+  }
+  fNEta = Int_t(nEta);
+
+  const Int_t nCells = fNEta * fNPhi;
+  fCellOffset.assign(nCells + 1, 0);
+
+  std::vector<Int_t> cellOfEntry(fNEntries, -1);
+  for (Int_t i = 0; i < fNEntries; i++) {
+    if (!std::isfinite(eta[i]) || !std::isfinite(phi[i])) {
+      fAlwaysEntries.push_back(i);
+      continue;
+    }
+    Int_t ieta = TMath::Min(fNEta - 1, Int_t((eta[i] - fEtaMin) / fEtaBinWidth));
+    cellOfEntry[i] = ieta * fNPhi + PhiBin(phi[i]);
+    fCellOffset[cellOfEntry[i] + 1]++;
+  }
+  for (Int_t icell = 0; icell < nCells; icell++) fCellOffset[icell + 1] += fCellOffset[icell];
+
+  // objects are filled in increasing index order within each grid cell
+  fCellEntries.resize(fCellOffset[nCells]);
+  std::vector<Int_t> next(fCellOffset.begin(), fCellOffset.end() - 1);
+  for (Int_t i = 0; i < fNEntries; i++) {
+    if (cellOfEntry[i] < 0) continue;
+    fCellEntries[next[cellOfEntry[i]]++] = i;
+  }
+}
+
+/**
+ * Phi bin of a position, phi is brought to [0, 2pi).
+ */
+Int_t AliEmcalEtaPhiGrid::PhiBin(Double_t phi) const
+{
+  Double_t phiNorm = phi - TMath::TwoPi() * std::floor(phi / TMath::TwoPi());
+  return TMath::Min(fNPhi - 1, Int_t(phiNorm / TMath::TwoPi() * fNPhi));
+}
+
+/**
+ * Get the objects which can be within the distance given in Fill() of a position, in
+ * increasing index order. If the grid is not valid or the position is not finite,
+ * all objects are returned.
+ *
+ * @param[in] eta Eta of the position
+ * @param[in] phi Phi of the position
+ * @param[out] candidates Indices of the candidate objects
+ */
+void AliEmcalEtaPhiGrid::GetCandidates(Double_t eta, Double_t phi, std::vector<Int_t>& candidates) const
+{
+  candidates.clear();
+
+  if (!IsValid() || !std::isfinite(eta) || !std::isfinite(phi)) {
+    candidates.resize(fNEntries);
+    for (Int_t i = 0; i < fNEntries; i++) candidates[i] = i;
+    return;
+  }
+
+  candidates.insert(candidates.end(), fAlwaysEntries.begin(), fAlwaysEntries.end());
+
+  Double_t etaPos = (eta - fEtaMin) / fEtaBinWidth;
+  if (etaPos >= -1 && etaPos < fNEta + 1) {
+    Int_t ieta = Int_t(std::floor(etaPos));
+    Int_t iphi = PhiBin(phi);
+    // with less than 3 phi bins all of them are neighbours
+    Int_t nPhiNeighbours = TMath::Min(fNPhi, 3);
+    for (Int_t jeta = TMath::Max(0, ieta - 1); jeta <= TMath::Min(fNEta - 1, ieta + 1); jeta++) {
+      for (Int_t k = 0; k < nPhiNeighbours; k++) {
+        Int_t jphi = nPhiNeighbours < 3 ? k : (iphi - 1 + k + fNPhi) % fNPhi;
+        Int_t icell = jeta * fNPhi + jphi;
+        candidates.insert(candidates.end(), fCellEntries.begin() + fCellOffset[icell], fCellEntries.begin() + fCellOffset[icell + 1]);
+      }
+    }
+  }
+
+  std::sort(candidates.begin(), candidates.end());
+}
@@ -0,0 +1,46 @@
+#ifndef ALIEMCALETAPHIGRID_H
+#define ALIEMCALETAPHIGRID_H
+/* Copyright(c) 1998-2021, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <vector>
+#include <Rtypes.h>
+
+/**
+ * @class AliEmcalEtaPhiGrid
+ * @ingroup EMCALCOREFW
+ * @brief Spatial index of objects in eta-phi
+ *
+ * The objects (e.g. clusters, or tracks at the calorimeter surface) are sorted into a grid
+ * of cells with a size not smaller than the requested distance, stored in a compact
+ * offset/index table. GetCandidates() returns, in increasing order, the indices of all the
+ * objects that can be within that distance in eta and in phi (with the phi periodicity)
+ * of a given position, so that a pair loop can be restricted to the neighbourhood
+ * without changing its result. Objects with a non finite position are always candidates.
+ */
+class AliEmcalEtaPhiGrid {
+ public:
+  AliEmcalEtaPhiGrid();
+
+  void Fill(const std::vector<Double_t>& eta, const std::vector<Double_t>& phi, Double_t distance);
+  void GetCandidates(Double_t eta, Double_t phi, std::vector<Int_t>& candidates) const;
+
+  /// Number of objects in the grid
+  Int_t GetNEntries() const { return fNEntries; }
+  /// False if the grid could not be set up, in which case all objects are candidates
+  Bool_t IsValid() const { return fNEta > 0; }
+
+ protected:
+  Int_t PhiBin(Double_t phi) const;
+
+  Int_t                fNEntries;       ///< Number of objects
+  Double_t             fEtaMin;         ///< Lower edge of the first eta bin
+  Double_t             fEtaBinWidth;    ///< Width of the eta bins
+  Int_t                fNEta;           ///< Number of eta bins
+  Int_t                fNPhi;           ///< Number of phi bins in [0, 2pi)
+  std::vector<Int_t>   fCellOffset;     ///< Start of each grid cell in fCellEntries (size fNEta*fNPhi+1)
+  std::vector<Int_t>   fCellEntries;    ///< Object indices sorted by grid cell
+  std::vector<Int_t>   fAlwaysEntries;  ///< Objects with a non finite position
+};
+
+#endif
@@ -0,0 +1,120 @@
+/************************************************************************************
+ * Copyright (C) 2021, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#include "AliEmcalDownscaleFactorsOCDB.h"
+#include "AliVEvent.h"
+
+#include "AliEmcalFiredTriggerClasses.h"
+
+/// \cond CLASSIMP
+ClassImp(PWG::EMCAL::AliEmcalFiredTriggerClasses)
+/// \endcond
+
+using namespace PWG::EMCAL;
+
+AliEmcalFiredTriggerClasses *AliEmcalFiredTriggerClasses::fgInstance = nullptr;
+
+AliEmcalFiredTriggerClasses::AliEmcalFiredTriggerClasses() :
+  TObject(),
+  fTriggerString(),
+  fClasses(),
+  fDownscaleFactors(),
+  fDownscaleRun(-1),
+  fGeneration(0)
+{
+}
+
+AliEmcalFiredTriggerClasses *AliEmcalFiredTriggerClasses::Instance(){
+  if(!fgInstance) {
+    fgInstance = new AliEmcalFiredTriggerClasses;
+  }
+  return fgInstance;
+}
+
+Bool_t AliEmcalFiredTriggerClasses::Update(const AliVEvent *event){
+  if(!event) return Decode("");
+  return Decode(event->GetFiredTriggerClasses().Data());
+}
+
+Bool_t AliEmcalFiredTriggerClasses::Decode(const char *triggerstring){
+  if(!triggerstring) triggerstring = "";
+  if(fGeneration && fTriggerString == triggerstring) return false;
+
+  fTriggerString = triggerstring;
+  fClasses.clear();
+  fDownscaleFactors.clear();
+  fDownscaleRun = -1;
+  fGeneration++;
+
+  std::size_t pos = 0, length = fTriggerString.length();
+  while(pos < length) {
+    std::size_t end = fTriggerString.find(' ', pos);
+    if(end == std::string::npos) end = length;
+    if(end > pos) {
+      // components separated by '-', the trigger cluster is the remainder
+      TriggerClass trgclass;
+      trgclass.fName = fTriggerString.substr(pos, end - pos);
+      std::string *components[3] = {&trgclass.fTriggerClass, &trgclass.fBunchCrossing, &trgclass.fPastFutureProtection};
+      std::size_t start = 0;
+      for(auto component : components) {
+        if(start > trgclass.fName.length()) break;
+        std::size_t sep = trgclass.fName.find('-', start);
+        if(sep == std::string::npos) sep = trgclass.fName.length();
+        *component = trgclass.fName.substr(start, sep - start);
+        start = sep + 1;
+      }
+      if(start < trgclass.fName.length()) trgclass.fTriggerCluster = trgclass.fName.substr(start);
+      fClasses.emplace_back(trgclass);
+    }
+    pos = end + 1;
+  }
+  return true;
+}
+
+Int_t AliEmcalFiredTriggerClasses::FindClass(const char *name) const {
+  for(std::size_t i = 0; i < fClasses.size(); i++) {
+    if(fClasses[i].fName == name) return i;
+  }
+  return -1;
+}
+
+Int_t AliEmcalFiredTriggerClasses::FindTriggerClass(const char *triggerclass) const {
+  for(std::size_t i = 0; i < fClasses.size(); i++) {
+    const std::string &input = fClasses[i].fTriggerClass;
+    if(input.length() > 1 && !input.compare(1, std::string::npos, triggerclass)) return i;   // remove C from trigger class part
+  }
+  return -1;
+}
+
+Double_t AliEmcalFiredTriggerClasses::GetDownscaleFactor(std::size_t index) const {
+  AliEmcalDownscaleFactorsOCDB *downscalefactors = AliEmcalDownscaleFactorsOCDB::Instance();
+  if(fDownscaleRun != downscalefactors->GetCurrentRun() || fDownscaleFactors.size() != fClasses.size()) {
+    fDownscaleFactors.clear();
+    for(const auto &trgclass : fClasses) fDownscaleFactors.push_back(downscalefactors->GetDownscaleFactorForTriggerClass(trgclass.fName.data()));
+    fDownscaleRun = downscalefactors->GetCurrentRun();
+  }
+  return fDownscaleFactors[index];
+}
@@ -0,0 +1,157 @@
+/************************************************************************************
+ * Copyright (C) 2021, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#ifndef ALIEMCALFIREDTRIGGERCLASSES_H
+#define ALIEMCALFIREDTRIGGERCLASSES_H
+
+#include <string>
+#include <vector>
+#include <TObject.h>
+
+class AliVEvent;
+
+namespace PWG {
+
+namespace EMCAL {
+
+/**
+ * @class AliEmcalFiredTriggerClasses
+ * @brief Decoded fired trigger classes of the current event, shared among wagons
+ * @ingroup EMCALCOREFW
+ *
+ * The fired trigger class string of the event is split once into the trigger
+ * classes and their components (trigger input, bunch crossing, past-future
+ * protection, trigger cluster). The downscale factors of the classes are taken
+ * from AliEmcalDownscaleFactorsOCDB on first request and kept until the run
+ * loaded in the OCDB handler changes. Every consumer calls Update() with the
+ * input event, the string is decoded again only if it differs from the one
+ * decoded last, so all wagons of a train share one decoding per event.
+ *
+ * ~~~{.cxx}
+ * auto fired = PWG::EMCAL::AliEmcalFiredTriggerClasses::Instance();
+ * fired->Update(fInputEvent);
+ * for(std::size_t i = 0; i < fired->GetNumberOfClasses(); i++) {
+ *   if(fired->GetClass(i).fTriggerCluster != "CENT") continue;
+ *   double weight = 1./fired->GetDownscaleFactor(i);
+ * }
+ * ~~~
+ */
+class AliEmcalFiredTriggerClasses : public TObject {
+public:
+
+  /**
+   * @struct TriggerClass
+   * @brief Components of a trigger class, i.e. CINT7-B-NOPF-CENT
+   */
+  struct TriggerClass {
+    std::string fName;                    ///< Full class name
+    std::string fTriggerClass;            ///< Trigger input class (CINT7)
+    std::string fBunchCrossing;           ///< Bunch crossing type (B)
+    std::string fPastFutureProtection;    ///< Past-future protection (NOPF)
+    std::string fTriggerCluster;          ///< Trigger cluster (CENT)
+  };
+
+  /**
+   * Get the instance shared by all wagons, created on first call
+   * @return Fired trigger classes handler
+   */
+  static AliEmcalFiredTriggerClasses *Instance();
+
+  /**
+   * Destructor
+   */
+  virtual ~AliEmcalFiredTriggerClasses() {}
+
+  /**
+   * Decode the fired trigger classes of the event if they differ from the
+   * trigger classes decoded last
+   * @param[in] event Input event
+   * @return True if the trigger string was decoded again
+   */
+  Bool_t Update(const AliVEvent *event);
+
+  /**
+   * Decode a trigger class string (classes separated by blanks)
+   * @param[in] triggerstring Fired trigger classes
+   * @return True if the trigger string was decoded again
+   */
+  Bool_t Decode(const char *triggerstring);
+
+  std::size_t GetNumberOfClasses() const { return fClasses.size(); }
+  const TriggerClass &GetClass(std::size_t index) const { return fClasses[index]; }
+  const std::vector<TriggerClass> &GetClasses() const { return fClasses; }
+
+  /**
+   * Find a fired trigger class by its full name
+   * @param[in] name Full name of the class (CINT7-B-NOPF-CENT)
+   * @return Index of the class, -1 if not fired
+   */
+  Int_t FindClass(const char *name) const;
+
+  /**
+   * Find the first fired trigger class with a given trigger input
+   * @param[in] triggerclass Trigger input without leading C (INT7)
+   * @return Index of the class, -1 if not fired
+   */
+  Int_t FindTriggerClass(const char *triggerclass) const;
+  Bool_t HasTriggerClass(const char *triggerclass) const { return FindTriggerClass(triggerclass) >= 0; }
+
+  /**
+   * Get the downscale factor of a fired class from the downscale factors
+   * loaded in AliEmcalDownscaleFactorsOCDB (1. if not found)
+   * @param[in] index Index of the fired class
+   * @return Downscale factor
+   */
+  Double_t GetDownscaleFactor(std::size_t index) const;
+
+  /**
+   * Get the number of decodings so far, changes whenever the classes change
+   * @return Generation of the decoded classes
+   */
+  ULong64_t GetGeneration() const { return fGeneration; }
+
+private:
+  std::string                                 fTriggerString;           //!<! Trigger string decoded last
+  std::vector<TriggerClass>                   fClasses;                 //!<! Fired trigger classes
+  mutable std::vector<Double_t>               fDownscaleFactors;        //!<! Downscale factors of the fired classes
+  mutable Int_t                               fDownscaleRun;            //!<! Run of the downscale factors (-1: not loaded)
+  ULong64_t                                   fGeneration;              //!<! Number of decodings
+  static AliEmcalFiredTriggerClasses          *fgInstance;              ///< Singleton object
+
+  AliEmcalFiredTriggerClasses();
+  AliEmcalFiredTriggerClasses(const AliEmcalFiredTriggerClasses &);
+  AliEmcalFiredTriggerClasses &operator=(const AliEmcalFiredTriggerClasses &);
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalFiredTriggerClasses, 1);
+  /// \endcond
+};
+
+}
+
+}
+
+#endif /* ALIEMCALFIREDTRIGGERCLASSES_H */
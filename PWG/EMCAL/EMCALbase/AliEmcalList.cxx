@@ -95,6 +95,23 @@ Long64_t AliEmcalList::Merge(TCollection *hlist)
   return hlist->GetEntries() + 1;
 }
 
+//________________________________________________________________________
+Int_t AliEmcalList::GetFilledPtHardBin() const
+{
+  TH1* xsection = static_cast<TH1*>(FindObject(fNameXsec.Data()));
+  return xsection ? GetFilledBinNumber(xsection) : 0;
+}
+
+//________________________________________________________________________
+Double_t AliEmcalList::GetPtHardScalingFactor() const
+{
+  TH1* xsection = static_cast<TH1*>(FindObject(fNameXsec.Data()));
+  TH1* ntrials  = static_cast<TH1*>(FindObject(fNameNTrials.Data()));
+  if(!(xsection && ntrials))
+    AliFatal("Scaled merging is active but AliEmcalList does not contain fHistXsection or fHistTrials. Do not activate scaling for those lists or include these histograms.");
+  return GetScalingFactor(xsection, ntrials);
+}
+
 //________________________________________________________________________
 void AliEmcalList::ScaleAllHistograms(TCollection *hlist, Double_t scalingFactor)
 {
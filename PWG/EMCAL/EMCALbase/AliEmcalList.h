@@ -97,6 +97,29 @@ public:
    */
   void                        SetNameTrials(const char *name) { fNameNTrials = name; }
 
+  /**
+   * @brief Get the \f$p_{t}\f$-hard bin filled in the cross section histogram of this list
+   * @return Bin number, 0 if no or more than one bin is filled (e.g. list already merged over \f$p_{t}\f$-hard bins)
+   */
+  Int_t                       GetFilledPtHardBin() const;
+
+  /**
+   * @brief Get the weight of the \f$p_{t}\f$-hard bin of this list (cross section divided by the number of trials)
+   * @return Weight, 1 if the list is already merged over \f$p_{t}\f$-hard bins
+   *
+   * Fatal if the list does not contain the cross section or trials histogram.
+   */
+  Double_t                    GetPtHardScalingFactor() const;
+
+  /**
+   * @brief Scale all histograms in the list, except for the scaling histograms and profiles, as done in the last merge level
+   * @param scalingFactor Scaling factor to be applied on the histograms
+   *
+   * Used by PWG::EMCAL::AliEmcalListMerger to apply the same scaling as Merge() when merging
+   * the inputs one by one.
+   */
+  void                        ScaleHistograms(Double_t scalingFactor) { ScaleAllHistograms(this, scalingFactor); }
+
 private:
   // ####### Helper functions
 
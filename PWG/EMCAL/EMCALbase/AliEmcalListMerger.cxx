@@ -0,0 +1,310 @@
+/************************************************************************************
+ * Copyright (C) 2021, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#include <algorithm>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <TClass.h>
+#include <TDirectory.h>
+#include <TFile.h>
+#include <TH1.h>
+#include <TKey.h>
+#include <TList.h>
+#include <TROOT.h>
+
+#include "AliEmcalList.h"
+#include "AliLog.h"
+
+#include "AliEmcalListMerger.h"
+
+/// \cond CLASSIMP
+ClassImp(PWG::EMCAL::AliEmcalListMerger)
+/// \endcond
+
+using namespace PWG::EMCAL;
+
+namespace {
+
+/**
+ * Make collections read from file owners of their (nested) content,
+ * such that deleting the input after merging frees all its objects.
+ */
+void SetOwnerRecursive(TObject *obj) {
+  TCollection *coll = dynamic_cast<TCollection *>(obj);
+  if(!coll) return;
+  coll->SetOwner(kTRUE);
+  TIter next(coll);
+  while(TObject *entry = next()) SetOwnerRecursive(entry);
+}
+
+}
+
+AliEmcalListMerger::AliEmcalListMerger() :
+  TObject(),
+  fInputFiles(),
+  fOutputFile(),
+  fNThreads(1),
+  fMaxMemory(0.),
+  fMergeLevel(kAutoLevel)
+{
+}
+
+Bool_t AliEmcalListMerger::Merge() {
+  if(!fInputFiles.size() || !fOutputFile.length()) {
+    AliErrorStream() << "Input or output files not specified" << std::endl;
+    return kFALSE;
+  }
+
+  // The keys to be merged are defined by the first input file
+  std::vector<MergeKey> keys;
+  TFile *reference = TFile::Open(fInputFiles[0].c_str());
+  if(!reference || reference->IsZombie()) {
+    AliErrorStream() << "Cannot open input file " << fInputFiles[0] << std::endl;
+    delete reference;
+    return kFALSE;
+  }
+  CollectKeys(reference, "", keys);
+  reference->Close();
+  delete reference;
+  // Large keys first, so that they are not left alone at the end
+  std::stable_sort(keys.begin(), keys.end(), [](const MergeKey &a, const MergeKey &b) { return a.fMemory > b.fMemory; });
+  AliInfoStream() << "Merging " << keys.size() << " keys from " << fInputFiles.size() << " files with " << fNThreads << " thread(s)" << std::endl;
+
+  TFile *output = TFile::Open(fOutputFile.c_str(), "RECREATE");
+  if(!output || output->IsZombie()) {
+    AliErrorStream() << "Cannot create output file " << fOutputFile << std::endl;
+    delete output;
+    return kFALSE;
+  }
+
+  // Histograms read from the inputs must not be attached to the input files
+  Bool_t addDirectory = TH1::AddDirectoryStatus();
+  TH1::AddDirectory(kFALSE);
+  if(fNThreads > 1) ROOT::EnableThreadSafety();
+
+  std::mutex schedulerMutex;
+  std::condition_variable keyDone;
+  UInt_t nextKey = 0;
+  Double_t memoryInUse = 0.;
+  Int_t nactive = 0, nfailed = 0;
+  auto worker = [&]() {
+    std::vector<TFile *> files(fInputFiles.size(), nullptr);
+    while(true) {
+      UInt_t ikey = 0;
+      {
+        std::unique_lock<std::mutex> lock(schedulerMutex);
+        keyDone.wait(lock, [&]() {
+          return nextKey >= keys.size() || fMaxMemory <= 0. || nactive == 0 || memoryInUse + keys[nextKey].fMemory <= fMaxMemory;
+        });
+        if(nextKey >= keys.size()) break;
+        ikey = nextKey++;
+        memoryInUse += keys[ikey].fMemory;
+        nactive++;
+      }
+      TObject *merged = MergeInputs(keys[ikey], files);
+      {
+        // Writing to the output file is serialized
+        std::lock_guard<std::mutex> lock(schedulerMutex);
+        if(merged) WriteObject(output, keys[ikey], merged);
+        else nfailed++;
+      }
+      delete merged;
+      {
+        std::lock_guard<std::mutex> lock(schedulerMutex);
+        memoryInUse -= keys[ikey].fMemory;
+        nactive--;
+      }
+      keyDone.notify_all();
+    }
+    for(auto file : files) {
+      if(!file) continue;
+      file->Close();
+      delete file;
+    }
+  };
+
+  if(fNThreads > 1) {
+    std::vector<std::thread> workers;
+    for(Int_t ithread = 0; ithread < fNThreads; ithread++) workers.push_back(std::thread(worker));
+    for(auto &thread : workers) thread.join();
+  } else {
+    worker();
+  }
+
+  output->Close();
+  delete output;
+  TH1::AddDirectory(addDirectory);
+
+  if(nfailed) AliErrorStream() << nfailed << " keys could not be merged" << std::endl;
+  return nfailed == 0;
+}
+
+void AliEmcalListMerger::CollectKeys(TDirectory *dir, const std::string &path, std::vector<MergeKey> &keys) const {
+  std::set<std::string> found;
+  TIter next(dir->GetListOfKeys());
+  while(TKey *key = static_cast<TKey *>(next())) {
+    // Only the highest cycle, which comes first in the list of keys
+    std::string name = key->GetName();
+    if(!found.insert(name).second) continue;
+    TClass *keyclass = TClass::GetClass(key->GetClassName());
+    if(keyclass && keyclass->InheritsFrom(TDirectory::Class())) {
+      TDirectory *subdir = dir->GetDirectory(name.c_str());
+      if(subdir) CollectKeys(subdir, path.length() ? path + "/" + name : name, keys);
+      continue;
+    }
+    // Result and input in memory, in addition the second sum for scaled lists with unknown merge level
+    Double_t factor = (fMergeLevel == kAutoLevel && keyclass && keyclass->InheritsFrom(AliEmcalList::Class())) ? 3. : 2.;
+    keys.push_back({path, name, factor * key->GetObjlen() / (1024. * 1024.)});
+  }
+}
+
+TObject *AliEmcalListMerger::ReadObject(std::vector<TFile *> &files, UInt_t ifile, const MergeKey &key) const {
+  if(!files[ifile]) {
+    files[ifile] = TFile::Open(fInputFiles[ifile].c_str());
+    if(files[ifile] && files[ifile]->IsZombie()) {
+      delete files[ifile];
+      files[ifile] = nullptr;
+    }
+    if(!files[ifile]) {
+      AliErrorStream() << "Cannot open input file " << fInputFiles[ifile] << std::endl;
+      return nullptr;
+    }
+  }
+  TDirectory *dir = key.fDirectory.length() ? files[ifile]->GetDirectory(key.fDirectory.c_str()) : files[ifile];
+  TObject *obj = dir ? dir->Get(key.fName.c_str()) : nullptr;
+  if(!obj) {
+    AliWarningStream() << "Object " << key.fName << " not found in " << fInputFiles[ifile] << std::endl;
+    return nullptr;
+  }
+  SetOwnerRecursive(obj);
+  return obj;
+}
+
+TObject *AliEmcalListMerger::MergeInputs(const MergeKey &key, std::vector<TFile *> &files) const {
+  TObject *result = nullptr;
+  UInt_t ifile = 0;
+  for(; ifile < files.size() && !result; ifile++) result = ReadObject(files, ifile, key);
+  if(!result) return nullptr;
+
+  AliEmcalList *emcallist = dynamic_cast<AliEmcalList *>(result);
+  if(emcallist && emcallist->IsUseScaling()) return MergeScaledLists(key, files, ifile, emcallist);
+
+  for(; ifile < files.size(); ifile++) {
+    TObject *input = ReadObject(files, ifile, key);
+    if(!input) continue;
+    if(!MergeInto(result, input)) {
+      AliErrorStream() << "Objects of type " << result->ClassName() << " cannot be merged - " << key.fName << " is taken from the first input" << std::endl;
+      delete input;
+      break;
+    }
+    delete input;
+  }
+  return result;
+}
+
+TObject *AliEmcalListMerger::MergeScaledLists(const MergeKey &key, std::vector<TFile *> &files, UInt_t ifile, AliEmcalList *first) const {
+  // As in AliEmcalList::Merge, the merge level is determined from the pt-hard bin of the first list
+  Int_t ptHardBin = first->GetFilledPtHardBin();
+  Double_t weight = first->GetPtHardScalingFactor();
+  AliEmcalList *unscaled = nullptr, *scaled = nullptr;
+  if(fMergeLevel == kLastLevel) {
+    scaled = first;
+  } else {
+    unscaled = first;
+    if(fMergeLevel == kAutoLevel) {
+      scaled = static_cast<AliEmcalList *>(first->Clone());
+      SetOwnerRecursive(scaled);
+    }
+  }
+  if(scaled) scaled->ScaleHistograms(weight);
+
+  for(; ifile < files.size(); ifile++) {
+    TObject *obj = ReadObject(files, ifile, key);
+    AliEmcalList *input = dynamic_cast<AliEmcalList *>(obj);
+    if(!input) {
+      if(obj) AliErrorStream() << key.fName << " in " << fInputFiles[ifile] << " is not an AliEmcalList - skipped" << std::endl;
+      delete obj;
+      continue;
+    }
+    if(unscaled && scaled && input->GetFilledPtHardBin() != ptHardBin) {
+      // Different pt-hard bins: last merge level, the unscaled sum is not needed any more
+      AliInfoStream() << "===== LAST LEVEL OF MERGING for " << key.fName << " =====" << std::endl;
+      delete unscaled;
+      unscaled = nullptr;
+    }
+    if(unscaled) MergeInto(unscaled, input);
+    if(scaled) {
+      input->ScaleHistograms(input->GetPtHardScalingFactor());
+      MergeInto(scaled, input);
+    }
+    delete input;
+  }
+
+  if(unscaled && scaled) {
+    // All inputs from the same pt-hard bin
+    delete scaled;
+    scaled = nullptr;
+  }
+  return unscaled ? unscaled : scaled;
+}
+
+Bool_t AliEmcalListMerger::MergeInto(TObject *target, TObject *input) const {
+  TList inputs;
+  inputs.Add(input);
+  if(AliEmcalList *emcallist = dynamic_cast<AliEmcalList *>(target)) {
+    // Scaling is handled by the merger, plain list merging
+    emcallist->TList::Merge(&inputs);
+    return kTRUE;
+  }
+  if(TCollection *coll = dynamic_cast<TCollection *>(target)) {
+    coll->Merge(&inputs);
+    return kTRUE;
+  }
+  ROOT::MergeFunc_t mergefunc = target->IsA()->GetMerge();
+  if(!mergefunc) return kFALSE;
+  mergefunc(target, &inputs, nullptr);
+  return kTRUE;
+}
+
+void AliEmcalListMerger::WriteObject(TFile *output, const MergeKey &key, TObject *merged) const {
+  TDirectory *dir = output;
+  if(key.fDirectory.length()) {
+    dir = output->GetDirectory(key.fDirectory.c_str());
+    if(!dir) {
+      output->mkdir(key.fDirectory.c_str());
+      dir = output->GetDirectory(key.fDirectory.c_str());
+    }
+  }
+  if(!dir) {
+    AliErrorStream() << "Cannot create directory " << key.fDirectory << " in the output file" << std::endl;
+    return;
+  }
+  dir->WriteTObject(merged, key.fName.c_str(), "SingleKey");
+}
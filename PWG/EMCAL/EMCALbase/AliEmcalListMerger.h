@@ -0,0 +1,164 @@
+/************************************************************************************
+ * Copyright (C) 2021, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#ifndef ALIEMCALLISTMERGER_H
+#define ALIEMCALLISTMERGER_H
+
+#include <string>
+#include <vector>
+#include <TObject.h>
+
+class TDirectory;
+class TFile;
+class AliEmcalList;
+
+namespace PWG {
+
+namespace EMCAL {
+
+/**
+ * @class AliEmcalListMerger
+ * @brief Streaming merger of analysis output files with \f$p_{t}\f$-hard scaling of AliEmcalLists
+ * @ingroup EMCALCOREFW
+ * @since Sept 21, 2021
+ *
+ * Merges the output files key by key: for each object (key) of the first input file the
+ * corresponding objects of all inputs are read one after the other and merged into the
+ * result, which is written to the output file before the next key is processed. Only the
+ * result and the current input of a key are held in memory instead of all input lists.
+ * Independent keys can be merged in parallel threads, with a ceiling on the estimated
+ * memory of the keys processed at the same time (a key exceeding the ceiling alone is
+ * processed when no other key is in memory).
+ *
+ * AliEmcalLists with scaling enabled are merged with the same semantics as AliEmcalList::Merge()
+ * on all inputs at once: if the inputs come from different \f$p_{t}\f$-hard bins (last merge level),
+ * each input is scaled with its own cross section / trials weight. As the merge level is only
+ * known after all inputs are read, in the automatic mode both the scaled and the unscaled sum are
+ * kept until a second \f$p_{t}\f$-hard bin is found. This is avoided by setting the merge level
+ * explicitly.
+ *
+ * ~~~{.cxx}
+ * PWG::EMCAL::AliEmcalListMerger merger;
+ * for(auto f : inputfiles) merger.AddInputFile(f);
+ * merger.SetOutputFile("AnalysisResults.root");
+ * merger.SetNThreads(4);
+ * merger.SetMaxMemory(2000.);    // MB
+ * merger.Merge();
+ * ~~~
+ *
+ * The keys to be merged are taken from the first input file, objects only present in later
+ * inputs are not merged.
+ */
+class AliEmcalListMerger : public TObject {
+public:
+  /**
+   * @enum EMergeLevel_t
+   * @brief Merge level of the scaled AliEmcalLists
+   */
+  enum EMergeLevel_t {
+    kAutoLevel = -1,            ///< Determined from the filled \f$p_{t}\f$-hard bins, as in AliEmcalList::Merge()
+    kIntermediateLevel = 0,     ///< All inputs from the same \f$p_{t}\f$-hard bin, no scaling
+    kLastLevel = 1              ///< Inputs from different \f$p_{t}\f$-hard bins, each input is scaled
+  };
+
+  /**
+   * @brief Constructor
+   */
+  AliEmcalListMerger();
+
+  /**
+   * @brief Destructor
+   */
+  virtual ~AliEmcalListMerger() {}
+
+  /**
+   * @brief Add a file to be merged
+   * @param filename Name of the input file (can be on AliEn)
+   */
+  void                        AddInputFile(const char *filename) { fInputFiles.push_back(filename); }
+
+  /**
+   * @brief Set the name of the file with the merged output (recreated)
+   * @param filename Name of the output file
+   */
+  void                        SetOutputFile(const char *filename) { fOutputFile = filename; }
+
+  /**
+   * @brief Set the number of threads merging independent keys
+   * @param nthreads Number of threads
+   */
+  void                        SetNThreads(Int_t nthreads) { fNThreads = nthreads > 0 ? nthreads : 1; }
+
+  /**
+   * @brief Set the ceiling on the estimated memory of the keys merged at the same time
+   * @param megabytes Maximum memory in MB, no ceiling if not positive
+   */
+  void                        SetMaxMemory(Double_t megabytes) { fMaxMemory = megabytes; }
+
+  /**
+   * @brief Set the merge level of the scaled AliEmcalLists
+   * @param level Merge level
+   */
+  void                        SetMergeLevel(EMergeLevel_t level) { fMergeLevel = level; }
+
+  /**
+   * @brief Merge all input files into the output file
+   * @return True if all keys were merged and written
+   */
+  Bool_t                      Merge();
+
+private:
+  /**
+   * @struct MergeKey
+   * @brief Object to be merged, identified by directory and name in the input files
+   */
+  struct MergeKey {
+    std::string               fDirectory;     ///< Directory path in the file, empty for the top directory
+    std::string               fName;          ///< Name of the key
+    Double_t                  fMemory;        ///< Estimated memory during merging, in MB
+  };
+
+  void                        CollectKeys(TDirectory *dir, const std::string &path, std::vector<MergeKey> &keys) const;
+  TObject                    *ReadObject(std::vector<TFile *> &files, UInt_t ifile, const MergeKey &key) const;
+  TObject                    *MergeInputs(const MergeKey &key, std::vector<TFile *> &files) const;
+  TObject                    *MergeScaledLists(const MergeKey &key, std::vector<TFile *> &files, UInt_t ifirst, AliEmcalList *first) const;
+  Bool_t                      MergeInto(TObject *target, TObject *input) const;
+  void                        WriteObject(TFile *output, const MergeKey &key, TObject *merged) const;
+
+  std::vector<std::string>    fInputFiles;    ///< Files to be merged
+  std::string                 fOutputFile;    ///< File with the merged output
+  Int_t                       fNThreads;      ///< Number of threads merging independent keys
+  Double_t                    fMaxMemory;     ///< Ceiling on the estimated memory of the keys merged at the same time (MB)
+  EMergeLevel_t               fMergeLevel;    ///< Merge level of the scaled AliEmcalLists
+
+  ClassDef(AliEmcalListMerger, 1);
+};
+
+}
+
+}
+
+#endif
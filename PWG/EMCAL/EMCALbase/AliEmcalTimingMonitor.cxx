@@ -0,0 +1,155 @@
+/************************************************************************************
+ * Copyright (C) 2021, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#include <iostream>
+#include <cstring>
+#include <iomanip>
+#include <TH1D.h>
+#include <TList.h>
+#include <TMath.h>
+#include <TProfile.h>
+#include <TSystem.h>
+#include "AliEmcalTimingMonitor.h"
+
+AliEmcalTimingMonitor::AliEmcalTimingMonitor():
+  fListOutput(nullptr),
+  fStepNames(),
+  fCounterNames(),
+  fHistWallTime(),
+  fHistCPUTime(),
+  fProfWallTime(nullptr),
+  fProfCPUTime(nullptr),
+  fProfMemory(nullptr),
+  fProfCounts(nullptr),
+  fStopwatch(),
+  fMemorySampling(0),
+  fEvent(0),
+  fMemoryAtStart(0)
+{
+}
+
+Int_t AliEmcalTimingMonitor::AddStep(const char *name) {
+  fStepNames.push_back(name);
+  return fStepNames.size() - 1;
+}
+
+Int_t AliEmcalTimingMonitor::AddCounter(const char *name) {
+  fCounterNames.push_back(name);
+  return fCounterNames.size() - 1;
+}
+
+void AliEmcalTimingMonitor::CreateOutput(TList *output) {
+  fListOutput = new TList;
+  fListOutput->SetName("TimingMonitor");
+  fListOutput->SetOwner();
+  output->Add(fListOutput);
+
+  // times between 1 us and 10 s in logarithmic bins
+  const Int_t kNBinsTime = 140;
+  std::vector<Double_t> timebins(kNBinsTime + 1);
+  for(Int_t ib = 0; ib <= kNBinsTime; ib++) timebins[ib] = TMath::Power(10., -6. + 7. * ib / kNBinsTime);
+
+  const Int_t nsteps = fStepNames.size();
+  fProfWallTime = new TProfile("fProfWallTime", "Mean wall time per event;;t (s)", nsteps, 0, nsteps);
+  fProfCPUTime = new TProfile("fProfCPUTime", "Mean CPU time per event;;t (s)", nsteps, 0, nsteps);
+  fProfMemory = new TProfile("fProfMemory", "Mean change of the resident memory;;#Delta mem (kB)", nsteps, 0, nsteps);
+  for(Int_t istep = 0; istep < nsteps; istep++) {
+    const char *step = fStepNames[istep].data();
+    fProfWallTime->GetXaxis()->SetBinLabel(istep + 1, step);
+    fProfCPUTime->GetXaxis()->SetBinLabel(istep + 1, step);
+    fProfMemory->GetXaxis()->SetBinLabel(istep + 1, step);
+    fHistWallTime.push_back(new TH1D(Form("fHistWallTime_%s", step), Form("Wall time per event of %s;t (s);events", step), kNBinsTime, timebins.data()));
+    fHistCPUTime.push_back(new TH1D(Form("fHistCPUTime_%s", step), Form("CPU time per event of %s;t (s);events", step), kNBinsTime, timebins.data()));
+  }
+  fListOutput->Add(fProfWallTime);
+  fListOutput->Add(fProfCPUTime);
+  if(fMemorySampling > 0) fListOutput->Add(fProfMemory);
+  else {
+    delete fProfMemory;
+    fProfMemory = nullptr;
+  }
+  for(Int_t istep = 0; istep < nsteps; istep++) {
+    fListOutput->Add(fHistWallTime[istep]);
+    fListOutput->Add(fHistCPUTime[istep]);
+  }
+
+  if(fCounterNames.size()) {
+    const Int_t ncounters = fCounterNames.size();
+    fProfCounts = new TProfile("fProfCounts", "Mean counts per event;;counts", ncounters, 0, ncounters);
+    for(Int_t icounter = 0; icounter < ncounters; icounter++) fProfCounts->GetXaxis()->SetBinLabel(icounter + 1, fCounterNames[icounter].data());
+    fListOutput->Add(fProfCounts);
+  }
+}
+
+void AliEmcalTimingMonitor::Start(Int_t step) {
+  if(!fListOutput) return;
+  if(fProfMemory && fEvent % fMemorySampling == 0) fMemoryAtStart = GetResidentMemory();
+  fStopwatch.Start(kTRUE);
+}
+
+void AliEmcalTimingMonitor::Stop(Int_t step) {
+  if(!fListOutput) return;
+  fStopwatch.Stop();
+  Double_t wall = fStopwatch.RealTime(), cpu = fStopwatch.CpuTime();
+  fHistWallTime[step]->Fill(wall);
+  fHistCPUTime[step]->Fill(cpu);
+  fProfWallTime->Fill(step, wall);
+  fProfCPUTime->Fill(step, cpu);
+  if(fProfMemory && fEvent % fMemorySampling == 0) fProfMemory->Fill(step, GetResidentMemory() - fMemoryAtStart);
+}
+
+void AliEmcalTimingMonitor::FillCount(Int_t counter, Double_t count) {
+  if(fProfCounts) fProfCounts->Fill(counter, count);
+}
+
+Long_t AliEmcalTimingMonitor::GetResidentMemory() {
+  ProcInfo_t procinfo;
+  gSystem->GetProcInfo(&procinfo);
+  return procinfo.fMemResident;
+}
+
+void AliEmcalTimingMonitor::PrintSummary(const TList *list, const char *prefix) {
+  if(!list) return;
+  TIter next(list);
+  while(TObject *obj = next()) {
+    TList *sublist = dynamic_cast<TList *>(obj);
+    if(!sublist) continue;
+    if(TString(sublist->GetName()) != "TimingMonitor") {
+      PrintSummary(sublist, Form("%s%s%s", prefix, strlen(prefix) ? "/" : "", sublist->GetName()));
+      continue;
+    }
+    TProfile *wall = dynamic_cast<TProfile *>(sublist->FindObject("fProfWallTime")),
+             *cpu = dynamic_cast<TProfile *>(sublist->FindObject("fProfCPUTime"));
+    if(!(wall && cpu)) continue;
+    std::cout << "Timing of " << prefix << std::endl;
+    for(Int_t ib = 1; ib <= wall->GetNbinsX(); ib++) {
+      std::cout << "  " << std::setw(40) << std::left << wall->GetXaxis()->GetBinLabel(ib) << std::right
+                << " wall " << std::setw(10) << wall->GetBinContent(ib) * 1e3 << " ms"
+                << "  cpu " << std::setw(10) << cpu->GetBinContent(ib) * 1e3 << " ms"
+                << "  (" << wall->GetBinEntries(ib) << " calls)" << std::endl;
+    }
+  }
+}
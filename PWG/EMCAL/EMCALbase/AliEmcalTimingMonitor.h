@@ -0,0 +1,121 @@
+/************************************************************************************
+ * Copyright (C) 2021, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#ifndef ALIEMCALTIMINGMONITOR_H
+#define ALIEMCALTIMINGMONITOR_H
+
+#include <string>
+#include <vector>
+#include <TStopwatch.h>
+
+class TH1;
+class TList;
+class TProfile;
+
+/**
+ * @class AliEmcalTimingMonitor
+ * @brief Wall and CPU time of the processing steps of a task
+ * @ingroup EMCALCOREFW
+ *
+ * Steps (correction components, parts of the event loop, ...) are registered
+ * with AddStep() before the output is created with CreateOutput(). For each step
+ * the wall and CPU time per event is histogrammed, and the mean per step is kept
+ * in summary profiles, so that the contributions of the steps can be compared
+ * directly. Optionally the change of the resident memory during a step is sampled
+ * every n-th event, and counts (e.g. number of entries of the containers) can be
+ * recorded per label. All output goes to a dedicated list named "TimingMonitor".
+ *
+ * The summary of all monitors found in an output list can be printed with
+ * PrintSummary(), see also AliEmcalDebugTask::SetPrintTimingSummary().
+ */
+class AliEmcalTimingMonitor {
+public:
+  AliEmcalTimingMonitor();
+  virtual ~AliEmcalTimingMonitor() {}
+
+  /**
+   * @brief Register a new step
+   * @param name Name of the step
+   * @return Index of the step used in Start() and Stop()
+   */
+  Int_t AddStep(const char *name);
+
+  /**
+   * @brief Register a new label for counts
+   * @param name Name of the label
+   * @return Index of the label used in FillCount()
+   */
+  Int_t AddCounter(const char *name);
+
+  /**
+   * @brief Sample the resident memory every n-th event (0: never)
+   * @param n Sampling period in events
+   */
+  void SetMemorySampling(Int_t n) { fMemorySampling = n; }
+
+  /**
+   * @brief Create the histograms for all registered steps
+   * @param output Output list of the task, the list "TimingMonitor" is added to it
+   */
+  void CreateOutput(TList *output);
+
+  /**
+   * @brief Must be called once per event before the first step
+   */
+  void NextEvent() { fEvent++; }
+
+  void Start(Int_t step);
+  void Stop(Int_t step);
+  void FillCount(Int_t counter, Double_t count);
+
+  Bool_t IsInitialized() const { return fListOutput != nullptr; }
+
+  /**
+   * @brief Print the mean wall and CPU time per step of all monitors in the list (searched recursively)
+   * @param list Output list
+   * @param prefix Name printed in front of each monitor
+   */
+  static void PrintSummary(const TList *list, const char *prefix = "");
+
+protected:
+  static Long_t GetResidentMemory();
+
+  TList                            *fListOutput;             ///< Output list of the monitor (not owned)
+  std::vector<std::string>          fStepNames;              ///< Names of the steps
+  std::vector<std::string>          fCounterNames;           ///< Names of the counters
+  std::vector<TH1 *>                fHistWallTime;           ///< Wall time per event for each step
+  std::vector<TH1 *>                fHistCPUTime;            ///< CPU time per event for each step
+  TProfile                         *fProfWallTime;           ///< Mean wall time per step
+  TProfile                         *fProfCPUTime;            ///< Mean CPU time per step
+  TProfile                         *fProfMemory;             ///< Mean change of the resident memory per step
+  TProfile                         *fProfCounts;             ///< Mean counts per label
+  TStopwatch                        fStopwatch;              ///< Stopwatch of the current step
+  Int_t                             fMemorySampling;         ///< Sampling period for the resident memory
+  Long64_t                          fEvent;                  ///< Event counter
+  Long_t                            fMemoryAtStart;          ///< Resident memory at the start of the current step
+};
+
+#endif /* ALIEMCALTIMINGMONITOR_H */
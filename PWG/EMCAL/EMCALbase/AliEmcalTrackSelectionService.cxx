@@ -0,0 +1,141 @@
+/************************************************************************************
+ * Copyright (C) 2021, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#include <TClonesArray.h>
+#include "AliAnalysisManager.h"
+#include "AliEmcalTrackSelection.h"
+#include "AliEmcalTrackSelectionService.h"
+#include "AliEmcalTrackSelResultCombined.h"
+#include "AliEmcalTrackSelResultPtr.h"
+#include "AliLog.h"
+#include "AliPicoTrack.h"
+#include "AliVTrack.h"
+
+/// \cond CLASSIMP
+ClassImp(PWG::EMCAL::AliEmcalTrackSelectionService)
+/// \endcond
+
+using namespace PWG::EMCAL;
+
+AliEmcalTrackSelectionService *AliEmcalTrackSelectionService::fgInstance = nullptr;
+
+AliEmcalTrackSelectionService::AliEmcalTrackSelectionService():
+  TObject(),
+  fSelections(),
+  fSlots(),
+  fMasks()
+{
+}
+
+AliEmcalTrackSelectionService::~AliEmcalTrackSelectionService() {
+  for(auto sel : fSelections) delete sel;
+  if(fgInstance == this) fgInstance = nullptr;
+}
+
+AliEmcalTrackSelectionService *AliEmcalTrackSelectionService::Instance() {
+  if(!fgInstance) fgInstance = new AliEmcalTrackSelectionService;
+  return fgInstance;
+}
+
+Int_t AliEmcalTrackSelectionService::FindSelection(const char *key) const {
+  auto found = fSlots.find(key);
+  if(found == fSlots.end()) return -1;
+  return found->second;
+}
+
+Int_t AliEmcalTrackSelectionService::RegisterSelection(const char *key, AliEmcalTrackSelection *selection) {
+  Int_t slot = FindSelection(key);
+  if(slot >= 0) {
+    AliErrorGeneralStream("AliEmcalTrackSelectionService") << "Selection " << key << " already registered" << std::endl;
+    return -1;
+  }
+  if(!selection || fSelections.size() >= kMaxSelections) return -1;
+  slot = fSelections.size();
+  fSelections.push_back(selection);
+  fSlots[key] = slot;
+  AliInfoGeneralStream("AliEmcalTrackSelectionService") << "Shared track selection " << key << " registered in slot " << slot << std::endl;
+  return slot;
+}
+
+const std::vector<ULong64_t> &AliEmcalTrackSelectionService::GetSelectionMasks(const TClonesArray *tracks, Int_t slot) {
+  TrackArrayMasks &masks = fMasks[tracks];
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  Long64_t entry = mgr ? mgr->GetCurrentEntry() : -1;
+  if(!mgr || entry != masks.fEntry || tracks->GetEntriesFast() != masks.fNTracks) {
+    // new event - all selections used with this array have to be evaluated again
+    masks.fEntry = entry;
+    masks.fNTracks = tracks->GetEntriesFast();
+    masks.fEvaluatedSlots = 0;
+    masks.fMasks.assign(masks.fNTracks, 0);
+  }
+  masks.fUsedSlots |= (1 << slot);
+  if(!(masks.fEvaluatedSlots & (1 << slot))) EvaluateSelections(tracks, masks, masks.fUsedSlots & ~masks.fEvaluatedSlots);
+  return masks.fMasks;
+}
+
+void AliEmcalTrackSelectionService::EvaluateSelections(const TClonesArray *tracks, TrackArrayMasks &masks, UInt_t slots) {
+  for(Int_t itrk = 0; itrk < masks.fNTracks; itrk++) {
+    AliVTrack *trk = static_cast<AliVTrack *>(tracks->UncheckedAt(itrk));
+    if(!trk) continue;
+    ULong64_t &trackmask = masks.fMasks[itrk];
+    for(UInt_t islot = 0; islot < fSelections.size(); islot++) {
+      if(!(slots & (1 << islot))) continue;
+      ULong64_t code = EncodeSelectionResult(fSelections[islot]->IsTrackAccepted(trk));
+      trackmask |= code << (kNBitsPerSelection * islot);
+    }
+  }
+  masks.fEvaluatedSlots |= slots;
+}
+
+UChar_t AliEmcalTrackSelectionService::EncodeSelectionResult(const AliEmcalTrackSelResultPtr &result) {
+  if(!result) return 0;
+  return 0x1 | (GetHybridDefinition(result) << 1);
+}
+
+AliEmcalTrackSelResultHybrid::HybridType_t AliEmcalTrackSelectionService::GetHybridDefinition(const AliEmcalTrackSelResultPtr &result) {
+  AliEmcalTrackSelResultHybrid::HybridType_t hybridDefinition = AliEmcalTrackSelResultHybrid::kUndefined;
+  if(auto hybriddata = dynamic_cast<const AliEmcalTrackSelResultHybrid *>(result.GetUserInfo())) {
+    hybridDefinition = hybriddata->GetHybridTrackType();
+  } else {
+    if(auto combineddata = dynamic_cast<const AliEmcalTrackSelResultCombined *>(result.GetUserInfo())){
+      for(int icut = 0; icut < combineddata->GetNumberOfSelectionResults(); icut++){
+        try{
+          auto cutresult = GetHybridDefinition((*combineddata)[icut]);
+          if(cutresult != AliEmcalTrackSelResultHybrid::kUndefined) hybridDefinition = cutresult;
+        } catch(AliEmcalTrackSelResultCombined::IndexException &e) {
+          AliErrorGeneralStream("AliEmcalTrackSelectionService") << "Index error: " << e.what() << std::endl;
+        }
+      }
+    }
+  }
+  return hybridDefinition;
+}
+
+AliVTrack *AliEmcalTrackSelectionService::GetSelectedTrack(AliVTrack *track) {
+  if(!track) return nullptr;
+  if(AliPicoTrack *picotrack = dynamic_cast<AliPicoTrack *>(track)) return picotrack->GetTrack();
+  return track;
+}
@@ -0,0 +1,164 @@
+/************************************************************************************
+ * Copyright (C) 2021, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#ifndef ALIEMCALTRACKSELECTIONSERVICE_H
+#define ALIEMCALTRACKSELECTIONSERVICE_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include <TObject.h>
+#include "AliEmcalTrackSelResultHybrid.h"
+
+class TClonesArray;
+class AliEmcalTrackSelection;
+class AliVTrack;
+
+namespace PWG {
+
+namespace EMCAL {
+
+class AliEmcalTrackSelResultPtr;
+
+/**
+ * @class AliEmcalTrackSelectionService
+ * @brief Per-event evaluation of track selections shared between track containers
+ * @ingroup EMCALCOREFW
+ *
+ * Track containers using the same predefined track selection on the same track
+ * array register the selection under a common key and obtain a slot. Once per
+ * event and track array all registered selections are evaluated in a single
+ * loop over the tracks, and the results are stored in one packed 64-bit mask
+ * per track (4 bits per slot: acceptance and hybrid track type). The containers
+ * read their slot from the mask instead of evaluating the selection themselves.
+ *
+ * The service owns the registered selection objects.
+ */
+class AliEmcalTrackSelectionService : public TObject {
+public:
+  enum {
+    kNBitsPerSelection = 4,                                 ///< Number of bits in the track mask per selection
+    kMaxSelections = 64 / kNBitsPerSelection                ///< Max. number of selections which can be registered
+  };
+
+  /**
+   * @brief Get the service instance (created on first call)
+   * @return The service
+   */
+  static AliEmcalTrackSelectionService *Instance();
+
+  /**
+   * @brief Destructor, deleting the registered selections
+   */
+  virtual ~AliEmcalTrackSelectionService();
+
+  /**
+   * @brief Find the slot of a selection registered under a key
+   * @param key Key of the selection
+   * @return Slot of the selection, -1 if not registered
+   */
+  Int_t FindSelection(const char *key) const;
+
+  /**
+   * @brief Register a new selection
+   * @param key Key of the selection
+   * @param selection Selection (ownership is transferred to the service)
+   * @return Slot of the selection, -1 if all slots are in use (selection is not taken over)
+   */
+  Int_t RegisterSelection(const char *key, AliEmcalTrackSelection *selection);
+
+  /**
+   * @brief Get the selection masks of the tracks in the array for the current event
+   * @param tracks Track array
+   * @param slot Slot which will be read from the masks
+   * @return Packed selection masks, one per track in the array
+   *
+   * The masks are evaluated for all selections used with this track array the first time
+   * they are requested in an event, later calls only return the cached result.
+   */
+  const std::vector<ULong64_t> &GetSelectionMasks(const TClonesArray *tracks, Int_t slot);
+
+  /**
+   * @brief Encode the result of a track selection into the 4-bit selection code
+   * @param result Track selection result
+   * @return Selection code (bit 0: accepted, bits 1-3: hybrid track type)
+   */
+  static UChar_t EncodeSelectionResult(const AliEmcalTrackSelResultPtr &result);
+
+  /**
+   * @brief Find the hybrid track type in the selection result or in any of its combined results
+   * @param result Track selection result
+   * @return Hybrid track type, kUndefined if the result does not contain a hybrid selection
+   */
+  static AliEmcalTrackSelResultHybrid::HybridType_t GetHybridDefinition(const AliEmcalTrackSelResultPtr &result);
+
+  /**
+   * @brief Get the track as it is returned in the selection result (the underlying track for pico tracks)
+   * @param track Track in the track array
+   * @return Track object
+   */
+  static AliVTrack *GetSelectedTrack(AliVTrack *track);
+
+  static UChar_t GetSelectionCode(ULong64_t mask, Int_t slot) { return (mask >> (kNBitsPerSelection * slot)) & 0xF; }
+  static Bool_t IsAccepted(UChar_t code) { return code & 0x1; }
+  static AliEmcalTrackSelResultHybrid::HybridType_t GetHybridType(UChar_t code) { return static_cast<AliEmcalTrackSelResultHybrid::HybridType_t>(code >> 1); }
+
+private:
+  /**
+   * @struct TrackArrayMasks
+   * @brief Cached selection masks of one track array
+   */
+  struct TrackArrayMasks {
+    TrackArrayMasks(): fMasks(), fEntry(-1), fNTracks(-1), fUsedSlots(0), fEvaluatedSlots(0) {}
+    std::vector<ULong64_t>      fMasks;             ///< Packed selection masks
+    Long64_t                    fEntry;             ///< Entry of the analysis manager the masks were evaluated for
+    Int_t                       fNTracks;           ///< Number of tracks the masks were evaluated for
+    UInt_t                      fUsedSlots;         ///< Slots requested for this array
+    UInt_t                      fEvaluatedSlots;    ///< Slots evaluated in the current event
+  };
+
+  AliEmcalTrackSelectionService();
+  AliEmcalTrackSelectionService(const AliEmcalTrackSelectionService &);
+  AliEmcalTrackSelectionService &operator=(const AliEmcalTrackSelectionService &);
+
+  void EvaluateSelections(const TClonesArray *tracks, TrackArrayMasks &masks, UInt_t slots);
+
+  static AliEmcalTrackSelectionService               *fgInstance;    //!<! Service instance
+
+  std::vector<AliEmcalTrackSelection *>               fSelections;   //!<! Registered selections (owned)
+  std::map<std::string, Int_t>                        fSlots;        //!<! Slot of the selections by key
+  std::map<const TClonesArray *, TrackArrayMasks>     fMasks;        //!<! Selection masks by track array
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalTrackSelectionService, 0);
+  /// \endcond
+};
+
+}
+
+}
+
+#endif /* ALIEMCALTRACKSELECTIONSERVICE_H */
@@ -0,0 +1,92 @@
+/************************************************************************************
+ * Copyright (C) 2021, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#include <TClonesArray.h>
+#include "AliEmcalTrackView.h"
+#include "AliVTrack.h"
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalTrackView)
+/// \endcond
+
+AliEmcalTrackView::AliEmcalTrackView():
+  TNamed(),
+  fSource(nullptr),
+  fViewIndex(),
+  fSourceIndex(),
+  fEtaEmc(),
+  fPhiEmc(),
+  fPtEmc(),
+  fIsEmc(),
+  fTrackType(),
+  fLabel()
+{
+}
+
+AliEmcalTrackView::AliEmcalTrackView(const char *name):
+  TNamed(name, name),
+  fSource(nullptr),
+  fViewIndex(),
+  fSourceIndex(),
+  fEtaEmc(),
+  fPhiEmc(),
+  fPtEmc(),
+  fIsEmc(),
+  fTrackType(),
+  fLabel()
+{
+}
+
+void AliEmcalTrackView::Reset(const TClonesArray *source) {
+  fSource = source;
+  fViewIndex.assign(source ? source->GetEntriesFast() : 0, -1);
+  fSourceIndex.clear();
+  fEtaEmc.clear();
+  fPhiEmc.clear();
+  fPtEmc.clear();
+  fIsEmc.clear();
+  fTrackType.clear();
+  fLabel.clear();
+}
+
+Int_t AliEmcalTrackView::AddTrack(Int_t sourceIndex, Double_t etaEmc, Double_t phiEmc, Double_t ptEmc, Bool_t isEmc, Char_t trackType, Int_t label) {
+  if(sourceIndex < 0 || sourceIndex >= (Int_t)fViewIndex.size()) return -1;
+  Int_t index = fSourceIndex.size();
+  fViewIndex[sourceIndex] = index;
+  fSourceIndex.push_back(sourceIndex);
+  fEtaEmc.push_back(etaEmc);
+  fPhiEmc.push_back(phiEmc);
+  fPtEmc.push_back(ptEmc);
+  fIsEmc.push_back(isEmc);
+  fTrackType.push_back(trackType);
+  fLabel.push_back(label);
+  return index;
+}
+
+AliVTrack *AliEmcalTrackView::GetTrack(Int_t i) const {
+  if(!fSource || i < 0 || i >= GetNTracks()) return nullptr;
+  return static_cast<AliVTrack *>(fSource->UncheckedAt(fSourceIndex[i]));
+}
@@ -0,0 +1,119 @@
+/************************************************************************************
+ * Copyright (C) 2021, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#ifndef ALIEMCALTRACKVIEW_H
+#define ALIEMCALTRACKVIEW_H
+
+#include <vector>
+#include <TNamed.h>
+
+class TClonesArray;
+class AliVTrack;
+
+/**
+ * @class AliEmcalTrackView
+ * @brief Selection of tracks of an input track array without copying the tracks
+ * @ingroup EMCALCOREFW
+ *
+ * Produced by AliEmcalPicoTrackMaker and AliEmcalAodTrackFilterTask in view mode
+ * instead of a new array with track copies. The view stores the indices of the
+ * accepted tracks in the input array, together with the track properties the
+ * producers used to set on the copies (coordinates on the EMCal surface, track
+ * type, label), in column-wise arrays. AliTrackContainer can operate on the input
+ * array restricted to the tracks in the view, see AliTrackContainer::SetTrackViewName.
+ * The view is reset in each event keeping its memory.
+ */
+class AliEmcalTrackView : public TNamed {
+public:
+  AliEmcalTrackView();
+  AliEmcalTrackView(const char *name);
+  virtual ~AliEmcalTrackView() {}
+
+  /**
+   * @brief Start a new event on the input track array
+   * @param source Input track array
+   */
+  void Reset(const TClonesArray *source);
+
+  /**
+   * @brief Add a track of the input array to the view
+   * @param sourceIndex Index of the track in the input array
+   * @param etaEmc \f$\eta\f$ on the EMCal surface
+   * @param phiEmc \f$\phi\f$ on the EMCal surface
+   * @param ptEmc \f$p_{t}\f$ on the EMCal surface
+   * @param isEmc True if the track points to the EMCal acceptance
+   * @param trackType Track type (see AliPicoTrack::GetTrackType)
+   * @param label MC label stored with the track
+   * @return Index of the track in the view
+   */
+  Int_t AddTrack(Int_t sourceIndex, Double_t etaEmc, Double_t phiEmc, Double_t ptEmc, Bool_t isEmc, Char_t trackType, Int_t label);
+
+  const TClonesArray *GetSource() const { return fSource; }
+  Int_t GetNTracks() const { return fSourceIndex.size(); }
+  AliVTrack *GetTrack(Int_t i) const;
+
+  /**
+   * @brief Get the index in the view of a track in the input array
+   * @param sourceIndex Index of the track in the input array
+   * @return Index in the view, -1 if the track is not part of the view
+   */
+  Int_t GetViewIndex(Int_t sourceIndex) const { return sourceIndex >= 0 && sourceIndex < (Int_t)fViewIndex.size() ? fViewIndex[sourceIndex] : -1; }
+  Bool_t Contains(Int_t sourceIndex) const { return GetViewIndex(sourceIndex) >= 0; }
+
+  Int_t GetSourceIndex(Int_t i) const { return fSourceIndex[i]; }
+  Double_t GetTrackEtaOnEMCal(Int_t i) const { return fEtaEmc[i]; }
+  Double_t GetTrackPhiOnEMCal(Int_t i) const { return fPhiEmc[i]; }
+  Double_t GetTrackPtOnEMCal(Int_t i) const { return fPtEmc[i]; }
+  Bool_t IsEMCAL(Int_t i) const { return fIsEmc[i]; }
+  Char_t GetTrackType(Int_t i) const { return fTrackType[i]; }
+  Int_t GetLabel(Int_t i) const { return fLabel[i]; }
+
+  const Int_t *GetSourceIndices() const { return fSourceIndex.data(); }
+  const Double_t *GetTrackEtasOnEMCal() const { return fEtaEmc.data(); }
+  const Double_t *GetTrackPhisOnEMCal() const { return fPhiEmc.data(); }
+  const Double_t *GetTrackPtsOnEMCal() const { return fPtEmc.data(); }
+
+protected:
+  const TClonesArray             *fSource;           //!<! Input track array
+  std::vector<Int_t>              fViewIndex;        //!<! Index in the view for each track of the input array (-1 if not selected)
+  std::vector<Int_t>              fSourceIndex;      //!<! Index of the track in the input array
+  std::vector<Double_t>           fEtaEmc;           //!<! Eta on the EMCal surface
+  std::vector<Double_t>           fPhiEmc;           //!<! Phi on the EMCal surface
+  std::vector<Double_t>           fPtEmc;            //!<! Pt on the EMCal surface
+  std::vector<Char_t>             fIsEmc;            //!<! Track points to EMCal
+  std::vector<Char_t>             fTrackType;        //!<! Track type
+  std::vector<Int_t>              fLabel;            //!<! MC label
+
+private:
+  AliEmcalTrackView(const AliEmcalTrackView &);
+  AliEmcalTrackView &operator=(const AliEmcalTrackView &);
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalTrackView, 1);
+  /// \endcond
+};
+
+#endif /* ALIEMCALTRACKVIEW_H */
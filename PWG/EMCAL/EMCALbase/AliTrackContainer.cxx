@@ -38,6 +38,7 @@
 #include "AliTLorentzVector.h"
 #include "AliEmcalTrackSelectionAOD.h"
 #include "AliEmcalTrackSelectionESD.h"
+#include "AliEmcalTrackSelectionService.h"
 #include "AliEmcalTrackSelResultPtr.h"
 #include "AliEmcalTrackSelResultCombined.h"
 #include "AliEmcalTrackSelResultHybrid.h"
@@ -68,6 +69,10 @@ AliTrackContainer::AliTrackContainer():
   fITSHybridTrackDistinction(kFALSE),
   fAODFilterBits(0),
   fTrackCutsPeriod(),
+  fShareTrackSelection(kTRUE),
+  fSharedSelectionSlot(-1),
+  fTrackViewName(),
+  fTrackView(0),
   fEmcalTrackSelection(0),
   fFilteredTracks(),
   fTrackTypes(5000)
@@ -85,6 +90,10 @@ AliTrackContainer::AliTrackContainer(const char *name, const char *period):
   fITSHybridTrackDistinction(kFALSE),
   fAODFilterBits(0),
   fTrackCutsPeriod(period),
+  fShareTrackSelection(kTRUE),
+  fSharedSelectionSlot(-1),
+  fTrackViewName(),
+  fTrackView(0),
   fEmcalTrackSelection(0),
   fFilteredTracks(),
   fTrackTypes(5000)
@@ -103,6 +112,7 @@ void AliTrackContainer::SetArray(const AliVEvent *event)
 {
   AliParticleContainer::SetArray(event);
 
+  fSharedSelectionSlot = -1;
   if (fTrackFilterType == AliEmcalTrackSelection::kNoTrackFilter) {
     if (fEmcalTrackSelection) delete fEmcalTrackSelection;
     fEmcalTrackSelection = 0;
@@ -145,7 +155,18 @@ void AliTrackContainer::SetArray(const AliVEvent *event)
         AliInfo(Form("Using track cuts %d (no data period was provided!)", fTrackFilterType));
       }
 
-      if (fLoadedClass->InheritsFrom("AliAODTrack")) {
+      Bool_t isAOD = fLoadedClass->InheritsFrom("AliAODTrack");
+      TString sharedKey = TString::Format("%s_%d_%s", isAOD ? "AOD" : "ESD", fTrackFilterType, fTrackCutsPeriod.Data());
+      if (fShareTrackSelection && (isAOD || fLoadedClass->InheritsFrom("AliESDtrack"))) {
+        fSharedSelectionSlot = PWG::EMCAL::AliEmcalTrackSelectionService::Instance()->FindSelection(sharedKey);
+        if (fSharedSelectionSlot >= 0) {
+          AliInfo(Form("Objects are of type %s: using shared track selection %s.", fLoadedClass->GetName(), sharedKey.Data()));
+          fEmcalTrackSelection = 0;
+          return;
+        }
+      }
+
+      if (isAOD) {
         AliInfo(Form("Objects are of type %s: AOD track selection will be done.", fLoadedClass->GetName()));
         fEmcalTrackSelection = new AliEmcalTrackSelectionAOD(fTrackFilterType, fTrackCutsPeriod);
       }
@@ -156,6 +177,12 @@ void AliTrackContainer::SetArray(const AliVEvent *event)
       else {
         AliWarning(Form("Objects are of type %s: no track filtering will be done!!", fLoadedClass->GetName()));
       }
+
+      if (fEmcalTrackSelection && fShareTrackSelection) {
+        // ownership of the selection goes to the service, the selection is evaluated there
+        fSharedSelectionSlot = PWG::EMCAL::AliEmcalTrackSelectionService::Instance()->RegisterSelection(sharedKey, fEmcalTrackSelection);
+        if (fSharedSelectionSlot >= 0) fEmcalTrackSelection = 0;
+      }
     }
   }
 }
@@ -165,9 +192,7 @@ void AliTrackContainer::NextEvent(const AliVEvent * event)
   AliParticleContainer::NextEvent(event);
 
   fTrackTypes.Reset(kUndefined);
-  if (fEmcalTrackSelection) {
-    auto acceptedTracks = fEmcalTrackSelection->GetAcceptedTracks(fClArray);
-
+  if (fEmcalTrackSelection || fSharedSelectionSlot >= 0) {
     TObjArray *trackarray(fFilteredTracks.GetData());
     if(!trackarray){
       trackarray = new TObjArray;
@@ -178,14 +203,29 @@ void AliTrackContainer::NextEvent(const AliVEvent * event)
       trackarray->Clear();
     }
 
+    // Selection results are either read from the masks of the shared selection or
+    // evaluated directly, in both cases as packed selection code per track
+    const std::vector<ULong64_t> *sharedMasks = 0;
+    if (fSharedSelectionSlot >= 0) sharedMasks = &(PWG::EMCAL::AliEmcalTrackSelectionService::Instance()->GetSelectionMasks(fClArray, fSharedSelectionSlot));
+
     int naccepted(0), nrejected(0), nhybridTracks1(0), nhybridTracks2a(0), nhybridTracks2b(0), nhybridTracks3(0);
-    Int_t i = 0;
-    for(auto accresult : *acceptedTracks) {
-      if (i >= fTrackTypes.GetSize()) fTrackTypes.Set((i+1)*2);
-      PWG::EMCAL::AliEmcalTrackSelResultPtr *selectionResult = static_cast<PWG::EMCAL::AliEmcalTrackSelResultPtr *>(accresult);
-      AliVTrack *vTrack = selectionResult->GetTrack();
+    const Int_t ntracks = fClArray->GetEntriesFast();
+    if (ntracks > fTrackTypes.GetSize()) fTrackTypes.Set(ntracks*2);
+    for (Int_t i = 0; i < ntracks; i++) {
+      AliVTrack *inputTrack = static_cast<AliVTrack *>(fClArray->UncheckedAt(i));
+      AliVTrack *vTrack = 0;
+      UChar_t selectionCode = 0;
+      if (sharedMasks) {
+        selectionCode = PWG::EMCAL::AliEmcalTrackSelectionService::GetSelectionCode((*sharedMasks)[i], fSharedSelectionSlot);
+        vTrack = PWG::EMCAL::AliEmcalTrackSelectionService::GetSelectedTrack(inputTrack);
+      }
+      else if (inputTrack) {
+        PWG::EMCAL::AliEmcalTrackSelResultPtr selectionResult = fEmcalTrackSelection->IsTrackAccepted(inputTrack);
+        selectionCode = PWG::EMCAL::AliEmcalTrackSelectionService::EncodeSelectionResult(selectionResult);
+        vTrack = selectionResult.GetTrack();
+      }
       trackarray->AddLast(vTrack);
-      if (!(*selectionResult) || !vTrack) {
+      if (!PWG::EMCAL::AliEmcalTrackSelectionService::IsAccepted(selectionCode) || !vTrack) {
         nrejected++;
         fTrackTypes[i] = kRejected;
       }
@@ -193,7 +233,7 @@ void AliTrackContainer::NextEvent(const AliVEvent * event)
         // track is accepted;
         naccepted++;
         if (IsHybridTrackSelection()) {
-          switch(GetHybridDefinition(*selectionResult)) {
+          switch(PWG::EMCAL::AliEmcalTrackSelectionService::GetHybridType(selectionCode)) {
             case PWG::EMCAL::AliEmcalTrackSelResultHybrid::kHybridGlobal:
               fTrackTypes[i] = kHybridGlobal;
               nhybridTracks1++;
@@ -216,7 +256,6 @@ void AliTrackContainer::NextEvent(const AliVEvent * event)
           };
         }
       }
-     i++;
     }
     AliDebugStream(1) << "Accepted: " << naccepted << ", Rejected: " << nrejected << ", hybrid: (" << nhybridTracks1 << " | [" << nhybridTracks2a << " | " << nhybridTracks2b  << "] | " << nhybridTracks3 << ")" << std::endl;
   }
@@ -224,6 +263,21 @@ void AliTrackContainer::NextEvent(const AliVEvent * event)
     fFilteredTracks.SetOwner(false);
     fFilteredTracks.SetObject(fClArray);
   }
+
+  if (!fTrackViewName.IsNull()) {
+    if (!fTrackView) {
+      fTrackView = dynamic_cast<const AliEmcalTrackView *>(event->FindListObject(fTrackViewName));
+      if (!fTrackView) AliError(Form("Track view %s not found in the event, all tracks are rejected", fTrackViewName.Data()));
+    }
+    if (fTrackView && fTrackView->GetSource() != fClArray) {
+      AliError(Form("Track view %s was not produced on the array %s", fTrackViewName.Data(), fClArray ? fClArray->GetName() : ""));
+    }
+    const Int_t ntracks = fClArray ? fClArray->GetEntriesFast() : 0;
+    if (ntracks > fTrackTypes.GetSize()) fTrackTypes.Set(ntracks*2);
+    for (Int_t i = 0; i < ntracks; i++) {
+      if (!fTrackView || !fTrackView->Contains(i)) fTrackTypes[i] = kRejected;
+    }
+  }
 }
 
 AliVTrack* AliTrackContainer::GetTrack(Int_t i) const
@@ -486,22 +540,7 @@ bool AliTrackContainer::IsHybridTrackSelection() const {
 }
 
 PWG::EMCAL::AliEmcalTrackSelResultHybrid::HybridType_t AliTrackContainer::GetHybridDefinition(const PWG::EMCAL::AliEmcalTrackSelResultPtr &selectionResult) const {
-  PWG::EMCAL::AliEmcalTrackSelResultHybrid::HybridType_t hybridDefinition = PWG::EMCAL::AliEmcalTrackSelResultHybrid::kUndefined;
-  if(auto hybriddata = dynamic_cast<const PWG::EMCAL::AliEmcalTrackSelResultHybrid *>(selectionResult.GetUserInfo())) {
-    hybridDefinition = hybriddata->GetHybridTrackType();
-  } else {
-    if(auto combineddata = dynamic_cast<const PWG::EMCAL::AliEmcalTrackSelResultCombined *>(selectionResult.GetUserInfo())){
-      for(int icut = 0; icut < combineddata->GetNumberOfSelectionResults(); icut++){
-        try{
-          auto cutresult = GetHybridDefinition((*combineddata)[icut]);
-          if(cutresult != PWG::EMCAL::AliEmcalTrackSelResultHybrid::kUndefined) hybridDefinition = cutresult;
-        } catch(PWG::EMCAL::AliEmcalTrackSelResultCombined::IndexException &e) {
-          AliErrorStream() << "Index error: " << e.what() << std::endl;
-        }
-      }
-    }
-  }
-  return hybridDefinition;
+  return PWG::EMCAL::AliEmcalTrackSelectionService::GetHybridDefinition(selectionResult);
 }
 
 Bool_t AliTrackContainer::CheckArrayConsistency() const {
@@ -39,6 +39,7 @@ class AliTLorentzVector;
 #include "AliVTrack.h"
 #include "AliEmcalTrackSelection.h"
 #include "AliEmcalTrackSelResultHybrid.h"
+#include "AliEmcalTrackView.h"
 #include "AliParticleContainer.h"
 
 #if !(defined(__CINT__) || defined(__MAKECINT__))
@@ -437,6 +438,25 @@ class AliTrackContainer : public AliParticleContainer {
   void                        SetFilterHybridTracks(Bool_t f)                   { if (f) fTrackFilterType = AliEmcalTrackSelection::kHybridTracks; else fTrackFilterType = AliEmcalTrackSelection::kNoTrackFilter; }   // legacy method
   void                        SetITSHybridTrackDistinction(Bool_t doUse)        { fITSHybridTrackDistinction = doUse; }
 
+  /**
+   * @brief Share the predefined track selection with other containers on the same track array
+   * @param doShare If true the selection is evaluated by PWG::EMCAL::AliEmcalTrackSelectionService
+   *
+   * Containers with the same track filter type and period share one selection object, which
+   * is evaluated only once per event. Not used for custom track filters.
+   */
+  void                        SetShareTrackSelection(Bool_t doShare)            { fShareTrackSelection = doShare; }
+
+  /**
+   * @brief Restrict the container to the tracks of a track view
+   * @param name Name of the AliEmcalTrackView in the event
+   *
+   * Tracks of the array which are not part of the view are rejected. The view has
+   * to be produced on the same array the container operates on.
+   */
+  void                        SetTrackViewName(const char *name)                { fTrackViewName = name; }
+  const AliEmcalTrackView    *GetTrackView()                              const { return fTrackView; }
+
   void                        SetTrackCutsPeriod(const char* period)            { fTrackCutsPeriod = period; }
 
   /**
@@ -546,6 +566,10 @@ class AliTrackContainer : public AliParticleContainer {
   Bool_t                      fITSHybridTrackDistinction;     ///< Distinct hybrid tracks via SPD information
   UInt_t                      fAODFilterBits;                 ///< track filter bits
   TString                     fTrackCutsPeriod;               ///< period string used to generate track cuts
+  Bool_t                      fShareTrackSelection;           ///< share the predefined track selection via the track selection service
+  Int_t                       fSharedSelectionSlot;           //!<! slot of the shared track selection (-1 if not shared)
+  TString                     fTrackViewName;                 ///< name of the track view restricting the accepted tracks
+  const AliEmcalTrackView    *fTrackView;                     //!<! track view restricting the accepted tracks
   AliEmcalTrackSelection     *fEmcalTrackSelection;  //!<! track selection object
   TrackOwnerHandler           fFilteredTracks;                //!<! tracks filtered using fEmcalTrackSelection
   TArrayC                     fTrackTypes;                    //!<! track types
@@ -554,7 +578,7 @@ class AliTrackContainer : public AliParticleContainer {
   AliTrackContainer(const AliTrackContainer& obj); // copy constructor
   AliTrackContainer& operator=(const AliTrackContainer& other); // assignment
 
-  ClassDef(AliTrackContainer,1);
+  ClassDef(AliTrackContainer,3);
 };
 
 #endif
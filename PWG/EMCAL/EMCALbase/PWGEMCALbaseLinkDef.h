@@ -27,6 +27,7 @@
 #pragma link C++ class AliTrackContainer+;
 #pragma link C++ class AliTrackContainer::TrackOwnerHandler+;
 #pragma link C++ class AliEmcalList+;
+#pragma link C++ class AliEmcalTrackView+;
 #pragma link C++ class std::map<std::string, AliParticleContainer*>+;
 #pragma link C++ class std::pair<std::string, AliParticleContainer*>+;
 #pragma link C++ class std::map<std::string, AliClusterContainer*>+;
@@ -35,11 +36,14 @@
 #pragma link C++ namespace PWG;
 #pragma link C++ namespace PWG::EMCAL;
 #pragma link C++ class PWG::EMCAL::AliEmcalDownscaleFactorsOCDB+;
+#pragma link C++ class PWG::EMCAL::AliEmcalFiredTriggerClasses+;
+#pragma link C++ class PWG::EMCAL::AliEmcalListMerger+;
 #pragma link C++ class PWG::EMCAL::AliEmcalTrackSelResultPtr+;
 #pragma link C++ class PWG::EMCAL::AliEmcalTrackSelResultUserPtr+;
 #pragma link C++ class PWG::EMCAL::AliEmcalTrackSelResultUserStorage+;
 #pragma link C++ class PWG::EMCAL::AliEmcalTrackSelResultCombined+;
 #pragma link C++ class PWG::EMCAL::AliEmcalTrackSelResultHybrid+;
+#pragma link C++ class PWG::EMCAL::AliEmcalTrackSelectionService+;
 #pragma link C++ class PWG::EMCAL::AliEmcalAODFilterBitCuts+;
 #pragma link C++ class PWG::EMCAL::AliEmcalCutBase+;
 #pragma link C++ class PWG::EMCAL::AliEmcalVCutsWrapper+;
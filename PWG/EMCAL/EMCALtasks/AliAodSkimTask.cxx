@@ -8,6 +8,7 @@
 #include <TMath.h>
 #include <TProfile.h>
 #include <TSystem.h>
+#include <TTree.h>
 #include <AliAODEvent.h>
 #include <AliAODHandler.h>
 #include <AliAODInputHandler.h>
@@ -27,8 +28,8 @@ AliAodSkimTask::AliAodSkimTask(const char* name) :
   fDoCopyHeader(1),  fDoCopyVZERO(1),  fDoCopyTZERO(1),  fDoCopyVertices(1),  fDoCopyTOF(1), fDoCopyTracklets(1), fDoCopyTracks(1), fDoRemoveTracks(0), fDoCleanTracks(0),
   fDoRemCovMat(0), fDoRemPid(0), fDoCopyTrigger(1), fDoCopyPTrigger(0), fDoCopyCells(1), fDoCopyPCells(0), fDoCopyClusters(1), fDoCopyDiMuons(0),  fDoCopyTrdTracks(0),
   fDoCopyV0s(0), fDoCopyCascades(0), fDoCopyZDC(1), fDoCopyConv(0), fDoCopyKinks(0), fDoCopyMC(1), fDoCopyMCHeader(1), fDoVertWoRefs(0), fDoVertMain(0), fDoCleanTracklets(0),
-  fDoCopyUserTree(0), fDoPhosFilt(0), fDoRemoveMcParts(0), fCutMcIsPrimary(0), fCutMcIsPhysPrimary(0), fCutMcPt(-1), fCutMcY(1.0), fCutMcPhos(0), fCutMcEmcal(0),
-  fTrials(0), fPyxsec(0), fPytrials(0), fPypthardbin(0), fAOD(0), fAODMcHeader(0), fOutputList(0), fHevs(0), fHclus(0), fHtrack(0)
+  fDoCopyUserTree(0), fDoPhosFilt(0), fDoRemoveMcParts(0), fCutMcIsPrimary(0), fCutMcIsPhysPrimary(0), fCutMcPt(-1), fCutMcY(1.0), fCutMcPhos(0), fCutMcEmcal(0), fDoDirectCopy(0),
+  fTrials(0), fPyxsec(0), fPytrials(0), fPypthardbin(0), fAOD(0), fAODMcHeader(0), fOutputList(0), fHevs(0), fHclus(0), fHtrack(0), fDirectObjs()
 {
   if (name) {
     DefineInput(0, TChain::Class());
@@ -102,6 +103,8 @@ void AliAodSkimTask::CopyCascades()
   if (out->GetEntries()>0) { // just checking if the deletion of previous event worked
     AliFatal(Form("%s: Previous event not deleted. This should not happen!",GetName()));
   }
+  if (DirectCopy(in,out))
+    return;
   out->AbsorbObjects(in);
 }
 
@@ -115,6 +118,8 @@ void AliAodSkimTask::CopyCells()
   AliAODEvent *evin = dynamic_cast<AliAODEvent*>(InputEvent());
   AliAODCaloCells *out = eout->GetEMCALCells();
   AliAODCaloCells *in  = evin->GetEMCALCells();
+  if (DirectCopy(in,out))
+    return;
   *out = *in;
 }
 
@@ -128,6 +133,8 @@ void AliAodSkimTask::CopyCellsP()
   AliAODEvent *evin = dynamic_cast<AliAODEvent*>(InputEvent());
   AliAODCaloCells *out = eout->GetPHOSCells();
   AliAODCaloCells *in  = evin->GetPHOSCells();
+  if (DirectCopy(in,out))
+    return;
   *out = *in;
 }
 
@@ -144,6 +151,8 @@ void AliAodSkimTask::CopyClusters()
   if (out->GetEntries()>0) { // just checking if the deletion of previous event worked
     AliFatal(Form("%s: Previous clusters not deleted. This should not happen!",GetName()));
   }
+  if (DirectCopy(in,out))
+    return;
   out->AbsorbObjects(in);
 }
 
@@ -185,6 +194,8 @@ void AliAodSkimTask::CopyDimuons()
   if (out->GetEntries()>0) { // just checking if the deletion of previous event worked
     AliFatal(Form("%s: Previous dimuons not deleted. This should not happen!",GetName()));
   }
+  if (DirectCopy(in,out))
+    return;
   out->AbsorbObjects(in);
 }
 
@@ -215,6 +226,8 @@ void AliAodSkimTask::CopyKinks()
   if (out->GetEntries()>0) { // just checking if the deletion of previous event worked
     AliFatal(Form("%s: Previous kinks not deleted. This should not happen!",GetName()));
   }
+  if (DirectCopy(in,out))
+    return;
   out->AbsorbObjects(in);
 }
 
@@ -239,6 +252,8 @@ void AliAodSkimTask::CopyMc()
       AliFatal(Form("%s: Previous mcparticles not deleted. This should not happen!",GetName()));
     }
     out->AbsorbObjects(in);
+    if (!fDoRemoveMcParts)
+      return;
     for (Int_t i=0;i<out->GetEntriesFast();++i) {
       AliAODMCParticle *mc = static_cast<AliAODMCParticle*>(out->At(i));
       if (!KeepMcPart(mc))
@@ -302,6 +317,8 @@ void AliAodSkimTask::CopyTof()
   AliAODEvent *evin = dynamic_cast<AliAODEvent*>(InputEvent());
   AliTOFHeader *out = const_cast<AliTOFHeader*>(eout->GetTOFHeader());
   const AliTOFHeader *in = evin->GetTOFHeader();
+  if (DirectCopy(in,out))
+    return;
   *out = *in;
 }
 
@@ -315,6 +332,8 @@ void AliAodSkimTask::CopyTracklets()
   AliAODEvent *evin = dynamic_cast<AliAODEvent*>(InputEvent());
   AliAODTracklets *out = eout->GetTracklets();
   AliAODTracklets *in  = evin->GetTracklets();
+  if (!fDoCleanTracklets && DirectCopy(in,out))
+    return;
   *out = *in;
   if (fDoCleanTracklets) {
     Int_t n=in->GetNumberOfTracklets();
@@ -336,7 +355,12 @@ void AliAodSkimTask::CopyTracks()
   if (out->GetEntries()>0) { // just checking if the deletion of previous event worked
     AliFatal(Form("%s: Previous tracks not deleted. This should not happen!",GetName()));
   }
+  const Bool_t modify = fDoRemoveTracks || fDoCleanTracks || fDoVertMain;
+  if (!modify && DirectCopy(in,out))
+    return;
   out->AbsorbObjects(in);
+  if (!modify)
+    return;
   for (Int_t i=0;i<out->GetEntries();++i) {
     AliAODTrack *t = static_cast<AliAODTrack*>(out->At(i));
     if (KeepTrack(t)) {
@@ -363,6 +387,8 @@ void AliAodSkimTask::CopyTrdTracks()
   if (out->GetEntries()>0) { // just checking if the deletion of previous event worked
     AliFatal(Form("%s: Previous trdtracks not deleted. This should not happen!",GetName()));
   }
+  if (DirectCopy(in,out))
+    return;
   out->AbsorbObjects(in);
 }
 
@@ -376,6 +402,8 @@ void AliAodSkimTask::CopyTrigger()
   AliAODEvent *evin = dynamic_cast<AliAODEvent*>(InputEvent());
   AliAODCaloTrigger *out = eout->GetCaloTrigger("EMCAL");
   AliAODCaloTrigger *in  = evin->GetCaloTrigger("EMCAL");
+  if (DirectCopy(in,out))
+    return;
   *out = *in;
 }
 
@@ -389,6 +417,8 @@ void AliAodSkimTask::CopyTriggerP()
   AliAODEvent *evin = dynamic_cast<AliAODEvent*>(InputEvent());
   AliAODCaloTrigger *out = eout->GetCaloTrigger("PHOS");
   AliAODCaloTrigger *in  = evin->GetCaloTrigger("PHOS");
+  if (DirectCopy(in,out))
+    return;
   *out = *in;
 }
 
@@ -402,6 +432,8 @@ void AliAodSkimTask::CopyTZero()
   AliAODEvent *evin = dynamic_cast<AliAODEvent*>(InputEvent());
   AliAODTZERO *out = eout->GetTZEROData();
   AliAODTZERO *in  = evin->GetTZEROData();
+  if (DirectCopy(in,out))
+    return;
   *out = *in;
 }
 
@@ -418,6 +450,8 @@ void AliAodSkimTask::CopyV0s()
   if (out->GetEntries()>0) { // just checking if the deletion of previous event worked
     AliFatal(Form("%s: Previous v0s not deleted. This should not happen!",GetName()));
   }
+  if (DirectCopy(in,out))
+    return;
   out->AbsorbObjects(in);
 }
 
@@ -434,7 +468,12 @@ void AliAodSkimTask::CopyVertices()
   if (out->GetEntries()>0) { // just checking if the deletion of previous event worked
     AliFatal(Form("%s: Previous vertices not deleted. This should not happen!",GetName()));
   }
+  const Bool_t modify = fDoVertWoRefs || fDoVertMain;
+  if (!modify && DirectCopy(in,out))
+    return;
   out->AbsorbObjects(in);
+  if (!modify)
+    return;
   Int_t marked=-1;
   for (Int_t i=0; i<out->GetEntries(); ++i) {
     AliAODVertex *v = static_cast<AliAODVertex*>(out->At(i));
@@ -471,6 +510,8 @@ void AliAodSkimTask::CopyVZero()
   AliAODEvent *evin = dynamic_cast<AliAODEvent*>(InputEvent());
   AliAODVZERO *out = eout->GetVZEROData();
   AliAODVZERO *in  = evin->GetVZEROData();
+  if (DirectCopy(in,out))
+    return;
   *out = *in;
 }
 
@@ -484,9 +525,33 @@ void AliAodSkimTask::CopyZdc()
   AliAODEvent *evin = dynamic_cast<AliAODEvent*>(InputEvent());
   AliAODZDC *out = eout->GetZDCData();
   AliAODZDC *in  = evin->GetZDCData();
+  if (DirectCopy(in,out))
+    return;
   *out = *in;
 }
 
+Bool_t AliAodSkimTask::DirectCopy(const TObject *in, const TObject *out)
+{
+  // Let the output branch of out point to the input object, which is then written as is.
+  // The branch address is only reset when the input object changes, e.g. for a new input file.
+  if (!fDoDirectCopy || !in || !out)
+    return kFALSE;
+  AliAnalysisManager *man = AliAnalysisManager::GetAnalysisManager();
+  AliAODHandler *oh = (AliAODHandler*)man->GetOutputEventHandler();
+  TTree *tout = oh->GetTree();
+  if (!tout)
+    return kFALSE;
+  TBranch *br = tout->GetBranch(out->GetName());
+  if (!br)
+    return kFALSE;
+  TObject *&obj = fDirectObjs[br];
+  if (obj!=in) {
+    obj = const_cast<TObject*>(in);
+    br->SetAddress(&obj);
+  }
+  return kTRUE;
+}
+
 Bool_t AliAodSkimTask::IsDcalAcc(Double_t phi, Double_t eta)
 {
   const Double_t etamin=0.22*0.9;
@@ -710,7 +775,7 @@ Bool_t AliAodSkimTask::SelectEvent()
 
 const char *AliAodSkimTask::Str() const
 {
-  return Form("%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d",
+  return Form("%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d",
               fDoCopyHeader,
               fDoCopyVZERO,
               fDoCopyTZERO,
@@ -731,7 +796,8 @@ const char *AliAodSkimTask::Str() const
               fDoCopyConv,
               fDoCopyKinks,
               fDoCopyMC,
-              fDoCopyMCHeader);
+              fDoCopyMCHeader,
+              fDoDirectCopy);
 }
 
 void AliAodSkimTask::Terminate(Option_t *)
@@ -823,8 +889,10 @@ void AliAodSkimTask::UserExec(Option_t *)
     AliAODEvent *eout = dynamic_cast<AliAODEvent*>(oh->GetAOD());
     Int_t  run = eout->GetRunNumber();
     AliAODVertex *v=(AliAODVertex*)eout->GetVertices()->At(0);
-    Int_t   vzn = v->GetNContributors();
-    Double_t vz = v->GetZ();
+    if (!v) // not filled for direct copies
+      v=(AliAODVertex*)fAOD->GetVertices()->At(0);
+    Int_t   vzn = v ? v->GetNContributors() : 0;
+    Double_t vz = v ? v->GetZ() : 0;
     cout << "AliAodSkimTask " << GetName() << " debug run " << run << " " << vzn << " " << vz << endl;
   }
 
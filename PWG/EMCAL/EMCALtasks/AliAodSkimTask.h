@@ -6,11 +6,17 @@
 ///
 /// Class to skim AOD files with the idea to keep the skimmed file as close as possible to the original AOD.
 ///
+/// With SetDirectCopy(kTRUE) the output branches of the objects which are copied unmodified point
+/// to the input objects, which are then written without being copied (or absorbed) into the output
+/// event. The corresponding objects of the output event stay empty in this mode.
+///
 /// \author C.Loizides
 
 #include <AliAnalysisTaskSE.h>
 #include <TString.h>
+#include <map>
 class AliAODMCHeader;
+class TBranch;
 class TH1F;
 
 class AliAodSkimTask: public AliAnalysisTaskSE
@@ -46,6 +52,7 @@ class AliAodSkimTask: public AliAnalysisTaskSE
     void                  SetCopyVZERO(Bool_t b)              {fDoCopyVZERO=b;}
     void                  SetCopyVertices(Bool_t b)           {fDoCopyVertices=b;}
     void                  SetCopyZDC(Bool_t b)                {fDoCopyZDC=b;}
+    void                  SetDirectCopy(Bool_t b)             {fDoDirectCopy=b;}
     void                  SetCutFilterBit(UInt_t b)           {fCutFilterBit=b;}
     void                  SetCutMcIsPrimary(Bool_t b)         {fCutMcIsPrimary=b;}
     void                  SetCutMcIsPhysicalPrimary(Bool_t b) {fCutMcIsPhysPrimary=b;}
@@ -65,7 +72,8 @@ class AliAodSkimTask: public AliAnalysisTaskSE
     const char           *Str() const;
   protected:
     virtual void          CleanTrack(AliAODTrack *t);
-    const char           *GetVersion() const { return "1.6"; }
+    Bool_t                DirectCopy(const TObject *in, const TObject *out);
+    const char           *GetVersion() const { return "1.7"; }
     virtual Bool_t        KeepMcPart(AliAODMCParticle *p);
     Bool_t                IsDcalAcc(Double_t phi, Double_t eta);
     Bool_t                IsPhosAcc(Double_t phi, Double_t eta);
@@ -146,6 +154,7 @@ class AliAodSkimTask: public AliAnalysisTaskSE
     Bool_t                fCutMcY;                //  if true cut on mc particles with |y|<fCutMcY
     Bool_t                fCutMcPhos;             //  if true cut particles not in PHOS
     Bool_t                fCutMcEmcal;            //  if true cut particles not in Emcal
+    Bool_t                fDoDirectCopy;          //  if true write unmodified branches directly from the input objects
     UInt_t                fTrials;                //! events seen since last acceptance
     Float_t               fPyxsec;                //! pythia xsection
     Float_t               fPytrials;              //! pythia trials
@@ -156,9 +165,10 @@ class AliAodSkimTask: public AliAnalysisTaskSE
     TH1F                 *fHevs;                  //! events processed/accepted
     TH1F                 *fHclus;                 //! cluster distribution
     TH1F                 *fHtrack;                //! track distribution
+    std::map<TBranch*,TObject*> fDirectObjs;      //! input objects the output branches point to
 
     AliAodSkimTask(const AliAodSkimTask&);             // not implemented
     AliAodSkimTask& operator=(const AliAodSkimTask&);  // not implemented
-    ClassDef(AliAodSkimTask, 10); // AliAodSkimTask
+    ClassDef(AliAodSkimTask, 11); // AliAodSkimTask
 };
 #endif
@@ -10,7 +10,9 @@
 #include <AliAODTrack.h>
 #include <AliAnalysisManager.h>
 #include <AliEMCALRecoUtils.h>
+#include <AliExternalTrackParam.h>
 #include <AliLog.h>
+#include "AliEmcalTrackView.h"
 
 ClassImp(AliEmcalAodTrackFilterTask)
 
@@ -29,8 +31,10 @@ AliEmcalAodTrackFilterTask::AliEmcalAodTrackFilterTask() :
   fKeepInvMassTag(kFALSE),
   fDist(440),
   fTrackEfficiency(0),
+  fViewMode(kFALSE),
   fTracksIn(0),
-  fTracksOut(0)
+  fTracksOut(0),
+  fTrackView(0)
 {
   // Constructor.
 
@@ -53,8 +57,10 @@ AliEmcalAodTrackFilterTask::AliEmcalAodTrackFilterTask(const char *name) :
   fKeepInvMassTag(kFALSE),
   fDist(440),
   fTrackEfficiency(0),
+  fViewMode(kFALSE),
   fTracksIn(0),
-  fTracksOut(0)
+  fTracksOut(0),
+  fTrackView(0)
 {
   // Constructor.
 
@@ -74,8 +80,13 @@ void AliEmcalAodTrackFilterTask::UserCreateOutputObjects()
 {
   // Create my user objects.
 
-  fTracksOut = new TClonesArray("AliAODTrack");
-  fTracksOut->SetName(fTracksOutName);
+  if (fViewMode) {
+    fTrackView = new AliEmcalTrackView(fTracksOutName);
+  }
+  else {
+    fTracksOut = new TClonesArray("AliAODTrack");
+    fTracksOut->SetName(fTracksOutName);
+  }
 }
 
 //________________________________________________________________________
@@ -103,9 +114,17 @@ void AliEmcalAodTrackFilterTask::UserExec(Option_t *)
   }
 
   // add tracks to event if not yet there
-  fTracksOut->Delete();
-  if (!(InputEvent()->FindListObject(fTracksOutName))) {
-    InputEvent()->AddObject(fTracksOut);
+  if (fTrackView) {
+    fTrackView->Reset(fTracksIn);
+    if (!(InputEvent()->FindListObject(fTracksOutName))) {
+      InputEvent()->AddObject(fTrackView);
+    }
+  }
+  else {
+    fTracksOut->Delete();
+    if (!(InputEvent()->FindListObject(fTracksOutName))) {
+      InputEvent()->AddObject(fTracksOut);
+    }
   }
 
   // loop over tracks
@@ -153,6 +172,12 @@ void AliEmcalAodTrackFilterTask::UserExec(Option_t *)
         continue;
     }
 
+    if (fTrackView) {
+      AddTrackToView(iTracks, track, type);
+      ++nacc;
+      continue;
+    }
+
     AliAODTrack *newt = new ((*fTracksOut)[nacc]) AliAODTrack(*track);
     newt->SetUniqueID(0);
     newt->ResetBit(TObject::kHasUUID);
@@ -205,3 +230,49 @@ void AliEmcalAodTrackFilterTask::UserExec(Option_t *)
     ++nacc;
   }
 }
+
+//________________________________________________________________________
+void AliEmcalAodTrackFilterTask::AddTrackToView(Int_t index, const AliAODTrack *track, Int_t type)
+{
+  // Add track to the view: same propagation and label settings as for
+  // the track copies, the input track is not modified.
+
+  Double_t etaEmc = track->GetTrackEtaOnEMCal(), phiEmc = track->GetTrackPhiOnEMCal(), ptEmc = track->GetTrackPtOnEMCal();
+  Bool_t propthistrack = kFALSE;
+  if (fDoPropagation)
+    propthistrack = kTRUE;
+  else if (!track->IsExtrapolatedToEMCAL()) {
+    if (fAttemptProp)
+      propthistrack = kTRUE;
+    else if (fAttemptPropMatch && track->IsEMCAL())
+      propthistrack = kTRUE;
+  }
+  if (propthistrack) {
+    etaEmc = phiEmc = ptEmc = -999;
+    AliExternalTrackParam trackParam;
+    Float_t eta = -999, phi = -999, pt = -999;
+    if (track->Pt() >= 0.35 && trackParam.CopyFromVTrack(track) &&
+        AliEMCALRecoUtilsBase::ExtrapolateTrackToEMCalSurface(&trackParam, fDist, 0.1396, 20, eta, phi, pt)) {
+      etaEmc = eta;
+      phiEmc = phi;
+      ptEmc = pt;
+    }
+  }
+
+  Int_t label = 0;
+  if (fIsMC) {
+    if (fUseNegativeLabels)
+      label = track->GetLabel();
+    else
+      label = TMath::Abs(track->GetLabel());
+  }
+  if(fKeepInvMassTag && !fIsMC && (track->GetLabel() == 1011000 ||
+      track->GetLabel() == 1012000 ||
+      track->GetLabel() == 1021000 ||
+      track->GetLabel() == 1022000 ||
+      track->GetLabel() == 1031000 ||
+      track->GetLabel() == 1032000))
+    label = track->GetLabel();
+
+  fTrackView->AddTrack(index, etaEmc, phiEmc, ptEmc, track->IsEMCAL(), type, label);
+}
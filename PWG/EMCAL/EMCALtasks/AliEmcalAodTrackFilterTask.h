@@ -2,6 +2,8 @@
 #define ALIEMCALAODTRACKFILTERTASK_H
 
 class TClonesArray;
+class AliAODTrack;
+class AliEmcalTrackView;
 
 #include <TF1.h>
 
@@ -27,10 +29,12 @@ class AliEmcalAodTrackFilterTask : public AliAnalysisTaskSE {
   void               SetTrackEfficiency(Double_t eff = 0.95)              { fTrackEfficiency  = new TF1("eff", "[0]", 0, 500); fTrackEfficiency->FixParameter(0,eff); }
   void               SetKeepInvMassTag(Bool_t f)                          { fKeepInvMassTag = f ; }
   void               SetTrackEfficiency(TF1* eff)                         { fTrackEfficiency  = eff  ; }
+  void               SetViewMode(Bool_t b)                                { fViewMode          = b   ; }
 
  protected:
   void               UserCreateOutputObjects();
   void               UserExec(Option_t *option);
+  void               AddTrackToView(Int_t index, const AliAODTrack *track, Int_t type);
 
   Int_t              fAODfilterBits[2];     // AOD track filter bit map
   TString            fTracksOutName;        // name of output track array
@@ -45,13 +49,15 @@ class AliEmcalAodTrackFilterTask : public AliAnalysisTaskSE {
   Bool_t             fKeepInvMassTag;     // if true then pass in track container labels for tagging tracks in jets
   Double_t           fDist;                 // distance to surface (440cm default)
   TF1               *fTrackEfficiency;      // track efficiency
+  Bool_t             fViewMode;             // publish an AliEmcalTrackView on the input tracks instead of track copies
   TClonesArray      *fTracksIn;             //!track array in
   TClonesArray      *fTracksOut;            //!track array out
+  AliEmcalTrackView *fTrackView;            //!track view out (view mode)
 
  private:
   AliEmcalAodTrackFilterTask(const AliEmcalAodTrackFilterTask&);            // not implemented
   AliEmcalAodTrackFilterTask &operator=(const AliEmcalAodTrackFilterTask&); // not implemented
 
-  ClassDef(AliEmcalAodTrackFilterTask, 4); // Task to filter Aod tracks
+  ClassDef(AliEmcalAodTrackFilterTask, 5); // Task to filter Aod tracks
 };
 #endif
@@ -31,6 +31,7 @@
 #include <TArrayD.h>
 #include <TClonesArray.h>
 #include <TGrid.h>
+#include <TH1.h>
 #include <THashList.h>
 #include <THistManager.h>
 #include <TLinearBinning.h>
@@ -62,7 +63,25 @@ AliEmcalCellMonitorTask::AliEmcalCellMonitorTask() :
    fBadChannelContainer(""),
    fNumberOfCells(12288),
    fOldRun(-1),
-   fMaskedCells()
+   fMaskedCells(),
+   fCellMaskStatus(),
+   fCellSM(),
+   fCellCol(),
+   fCellRow(),
+   fCellCounts(),
+   fCellSumAmplitude(),
+   fCellSumAmplitude2(),
+   fAccAmplitude(),
+   fAccAmplitudeCut(),
+   fAccTime(),
+   fAccTimeOutlier(),
+   fAccTimeMain(),
+   fAccFrequency(),
+   fAccClusterOccurrency(),
+   fAccAmplitudeFractionCluster(),
+   fAccCountSM(),
+   fAccAmpSM(),
+   fAccAmpTimeCorrSM()
 {
 
 }
@@ -78,7 +97,25 @@ AliEmcalCellMonitorTask::AliEmcalCellMonitorTask(const char *name) :
    fBadChannelContainer(""),
    fNumberOfCells(12288),
    fOldRun(-1),
-   fMaskedCells()
+   fMaskedCells(),
+   fCellMaskStatus(),
+   fCellSM(),
+   fCellCol(),
+   fCellRow(),
+   fCellCounts(),
+   fCellSumAmplitude(),
+   fCellSumAmplitude2(),
+   fAccAmplitude(),
+   fAccAmplitudeCut(),
+   fAccTime(),
+   fAccTimeOutlier(),
+   fAccTimeMain(),
+   fAccFrequency(),
+   fAccClusterOccurrency(),
+   fAccAmplitudeFractionCluster(),
+   fAccCountSM(),
+   fAccAmpSM(),
+   fAccAmpTimeCorrSM()
 {
   DefineOutput(1, TList::Class());
 }
@@ -99,11 +136,16 @@ void AliEmcalCellMonitorTask::ExecOnce(){
     fGeometry = AliEMCALGeometry::GetInstanceFromRunNumber(fInputEvent->GetRunNumber());
   fNumberOfCells = fGeometry->GetNCells();
   CreateHistograms();
+  InitAccumulators();
 }
 
 void AliEmcalCellMonitorTask::RunChanged(){
   if(fBadChannelContainer.Length()) LoadCellMasking();
-  for(auto cellID : fMaskedCells) fHistManager->FillTH1("cellMasking", cellID);
+  fCellMaskStatus.assign(fNumberOfCells, kFALSE);
+  for(auto cellID : fMaskedCells) {
+    fHistManager->FillTH1("cellMasking", cellID);
+    if(cellID >= 0 && cellID < fNumberOfCells) fCellMaskStatus[cellID] = kTRUE;
+  }
 }
 
 void AliEmcalCellMonitorTask::UserExec(Option_t *){
@@ -133,25 +175,24 @@ void AliEmcalCellMonitorTask::UserExec(Option_t *){
   Double_t amplitude, celltime, efrac;
   Int_t mclabel;
 
-  Int_t sm, mod, meta, mphi, ieta, iphi;
   for(int icell = 0; icell < emcalcells->GetNumberOfCells(); icell++){
     emcalcells->GetCell(icell, cellNumber, amplitude, celltime, mclabel, efrac);
+    if(cellNumber < 0 || cellNumber >= fNumberOfCells) continue;
     if(IsCellMasked(cellNumber)) continue;
-    fHistManager->FillTH2("cellAmplitude", amplitude, cellNumber);
+    fAccAmplitude.Fill2D(amplitude, cellNumber);
     if(amplitude < fMinCellAmplitude) continue;
-    fHistManager->FillTH1("cellAmplitudeCut", amplitude, cellNumber);
-    fHistManager->FillTH1("cellFrequency", cellNumber);
-    fHistManager->FillTH2("cellTime", celltime, cellNumber);
-    if(celltime >= 1e-6) fHistManager->FillTH2("cellTimeOutlier", celltime, cellNumber);
-    if(celltime > -5e-8 && celltime < 1e-7) fHistManager->FillTH2("cellTimeMain", celltime, cellNumber);
-
-    // Get Cell index in eta-phi of sm
-    fGeometry->GetCellIndex(cellNumber, sm, mod, mphi, meta);
-    fGeometry->GetCellPhiEtaIndexInSModule(sm, mod, mphi, meta, iphi, ieta);
+    fAccAmplitudeCut.Fill2D(amplitude, cellNumber);
+    fAccTime.Fill2D(celltime, cellNumber);
+    if(celltime >= 1e-6) fAccTimeOutlier.Fill2D(celltime, cellNumber);
+    if(celltime > -5e-8 && celltime < 1e-7) fAccTimeMain.Fill2D(celltime, cellNumber);
 
-    fHistManager->FillTH2(Form("cellCountSM%d", sm), ieta, iphi);
-    fHistManager->FillTH2(Form("cellAmpSM%d", sm), ieta, iphi, amplitude);
-    fHistManager->FillTH2(Form("cellAmpTimeCorrSM%d", sm), celltime, amplitude);
+    // Frequency, count rate and integrated amplitude in col-row space from the per-cell sums
+    fCellCounts[cellNumber]++;
+    fCellSumAmplitude[cellNumber] += amplitude;
+    fCellSumAmplitude2[cellNumber] += amplitude * amplitude;
+
+    Int_t sm = fCellSM[cellNumber];
+    if(sm >= 0 && sm < static_cast<Int_t>(fAccAmpTimeCorrSM.size())) fAccAmpTimeCorrSM[sm].Fill2D(celltime, amplitude);
   }
 
   // Cluster loop
@@ -163,8 +204,8 @@ void AliEmcalCellMonitorTask::UserExec(Option_t *){
         myclust = dynamic_cast<const AliVCluster *>(*clusteriter);
         if(!myclust) continue;
         for(int icell = 0; icell < myclust->GetNCells(); icell++){
-          fHistManager->FillTH1("cellClusterOccurrency", myclust->GetCellAbsId(icell));
-          fHistManager->FillTH2("cellAmplitudeFractionCluster", myclust->GetCellAbsId(icell), myclust->GetCellAmplitudeFraction(icell));
+          fAccClusterOccurrency.Fill1D(myclust->GetCellAbsId(icell));
+          fAccAmplitudeFractionCluster.Fill2D(myclust->GetCellAbsId(icell), myclust->GetCellAmplitudeFraction(icell));
         }
       }
     } else {
@@ -174,6 +215,10 @@ void AliEmcalCellMonitorTask::UserExec(Option_t *){
   PostData(1, fHistManager->GetListOfHistograms());
 }
 
+void AliEmcalCellMonitorTask::FinishTaskOutput(){
+  if(fLocalInitialized) FlushAccumulators();
+}
+
 void AliEmcalCellMonitorTask::CreateHistograms(){
   fHistManager->CreateTH1("events", "Number of events", 1, 0.5, 1.5);
   fHistManager->CreateTH1("cellMasking", "Monitoring for masked cells", TLinearBinning(fNumberOfCells, -0.5, fNumberOfCells - 0.5));
@@ -195,6 +240,68 @@ void AliEmcalCellMonitorTask::CreateHistograms(){
   }
 }
 
+void AliEmcalCellMonitorTask::InitAccumulators(){
+  fAccAmplitude = AliEmcalQAAccumulator(fHistManager->FindObject("cellAmplitude"));
+  fAccAmplitudeCut = AliEmcalQAAccumulator(fHistManager->FindObject("cellAmplitudeCut"));
+  fAccTime = AliEmcalQAAccumulator(fHistManager->FindObject("cellTime"));
+  fAccTimeOutlier = AliEmcalQAAccumulator(fHistManager->FindObject("cellTimeOutlier"));
+  fAccTimeMain = AliEmcalQAAccumulator(fHistManager->FindObject("cellTimeMain"));
+  fAccFrequency = AliEmcalQAAccumulator(fHistManager->FindObject("cellFrequency"));
+  fAccClusterOccurrency = AliEmcalQAAccumulator(fHistManager->FindObject("cellClusterOccurrency"));
+  fAccAmplitudeFractionCluster = AliEmcalQAAccumulator(fHistManager->FindObject("cellAmplitudeFractionCluster"));
+  fAccCountSM.clear();
+  fAccAmpSM.clear();
+  fAccAmpTimeCorrSM.clear();
+  for(int ism = 0; ism < 20; ++ism){
+    fAccCountSM.push_back(AliEmcalQAAccumulator(fHistManager->FindObject(Form("cellCountSM%d", ism))));
+    fAccAmpSM.push_back(AliEmcalQAAccumulator(fHistManager->FindObject(Form("cellAmpSM%d", ism))));
+    fAccAmpTimeCorrSM.push_back(AliEmcalQAAccumulator(fHistManager->FindObject(Form("cellAmpTimeCorrSM%d", ism))));
+  }
+
+  fCellCounts.assign(fNumberOfCells, 0);
+  fCellSumAmplitude.assign(fNumberOfCells, 0.);
+  fCellSumAmplitude2.assign(fNumberOfCells, 0.);
+  fCellMaskStatus.assign(fNumberOfCells, kFALSE);
+
+  // Cell index in eta-phi of sm, once for all cells
+  fCellSM.assign(fNumberOfCells, -1);
+  fCellCol.assign(fNumberOfCells, -1);
+  fCellRow.assign(fNumberOfCells, -1);
+  Int_t sm, mod, meta, mphi, ieta, iphi;
+  for(int icell = 0; icell < fNumberOfCells; icell++){
+    fGeometry->GetCellIndex(icell, sm, mod, mphi, meta);
+    fGeometry->GetCellPhiEtaIndexInSModule(sm, mod, mphi, meta, iphi, ieta);
+    fCellSM[icell] = sm;
+    fCellCol[icell] = ieta;
+    fCellRow[icell] = iphi;
+  }
+}
+
+void AliEmcalCellMonitorTask::FlushAccumulators(){
+  TH1 *hfrequency = fAccFrequency.GetHistogram();
+  for(int icell = 0; icell < fNumberOfCells; icell++){
+    if(!fCellCounts[icell]) continue;
+    Double_t counts = static_cast<Double_t>(fCellCounts[icell]);
+    if(hfrequency) fAccFrequency.AddToBin(hfrequency->FindFixBin(icell), counts, counts, fCellCounts[icell]);
+    Int_t sm = fCellSM[icell];
+    if(sm >= 0 && sm < static_cast<Int_t>(fAccCountSM.size())) {
+      TH1 *hcount = fAccCountSM[sm].GetHistogram(), *hamp = fAccAmpSM[sm].GetHistogram();
+      if(hcount) fAccCountSM[sm].AddToBin(hcount->FindFixBin(fCellCol[icell], fCellRow[icell]), counts, counts, fCellCounts[icell]);
+      if(hamp) fAccAmpSM[sm].AddToBin(hamp->FindFixBin(fCellCol[icell], fCellRow[icell]), fCellSumAmplitude[icell], fCellSumAmplitude2[icell], fCellCounts[icell]);
+    }
+  }
+  fCellCounts.assign(fNumberOfCells, 0);
+  fCellSumAmplitude.assign(fNumberOfCells, 0.);
+  fCellSumAmplitude2.assign(fNumberOfCells, 0.);
+
+  AliEmcalQAAccumulator *accumulators[] = {&fAccAmplitude, &fAccAmplitudeCut, &fAccTime, &fAccTimeOutlier, &fAccTimeMain,
+                                           &fAccFrequency, &fAccClusterOccurrency, &fAccAmplitudeFractionCluster};
+  for(auto acc : accumulators) acc->Flush();
+  for(auto &acc : fAccCountSM) acc.Flush();
+  for(auto &acc : fAccAmpSM) acc.Flush();
+  for(auto &acc : fAccAmpTimeCorrSM) acc.Flush();
+}
+
 void AliEmcalCellMonitorTask::LoadCellMasking(){
   if(!fBadChannelContainer.Length()) return;
   AliInfoStream() << GetName() << ": Loading bad channel map from " <<fBadChannelContainer << std::endl;
@@ -213,9 +320,11 @@ void AliEmcalCellMonitorTask::LoadCellMasking(){
 void AliEmcalCellMonitorTask::SetBadCell(Int_t cellId){
   if(std::find(fMaskedCells.begin(), fMaskedCells.end(), cellId) != fMaskedCells.end()) return;
   fMaskedCells.push_back(cellId);
+  if(cellId >= 0 && cellId < static_cast<Int_t>(fCellMaskStatus.size())) fCellMaskStatus[cellId] = kTRUE;
 }
 
 bool AliEmcalCellMonitorTask::IsCellMasked(Int_t cellId) const {
+  if(cellId >= 0 && cellId < static_cast<Int_t>(fCellMaskStatus.size())) return fCellMaskStatus[cellId];
   return (std::find(fMaskedCells.begin(), fMaskedCells.end(), cellId) != fMaskedCells.end());
 }
 
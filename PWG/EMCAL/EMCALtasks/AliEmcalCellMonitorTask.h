@@ -28,6 +28,7 @@
 #define ALIEMCALCELLMONITOR_H_
 
 #include "AliAnalysisTaskSE.h"
+#include "AliEmcalQAAccumulator.h"
 #include <TCustomBinning.h>
 #include <TString.h>
 #include <vector>
@@ -91,6 +92,10 @@ namespace EMCAL {
  * ~~~
  * $ALICE_PHYSICS/PWG/EMCAL/AddEmcalCellMonitorTask.C
  * ~~~
+ *
+ * The per-cell quantities are accumulated in flat per-cell arrays during
+ * the event loop (see AliEmcalQAAccumulator) and added to the histograms in
+ * FinishTaskOutput, before the output is written and merged.
  */
 class AliEmcalCellMonitorTask : public AliAnalysisTaskSE {
 public:
@@ -204,6 +209,11 @@ protected:
    */
   virtual void UserExec(Option_t *);
 
+  /**
+   * Add the per-cell accumulators to the output histograms
+   */
+  virtual void FinishTaskOutput();
+
   /**
    * Perform initializations of the task which require a
    * run number (only available as soon as the first event
@@ -251,6 +261,19 @@ protected:
    */
   void LoadCellMasking();
 
+  /**
+   * Set up the accumulators of the per-cell histograms and the
+   * position of the cells in the supermodules. Called in ExecOnce
+   * after the histograms are created.
+   */
+  void InitAccumulators();
+
+  /**
+   * Add the per-cell counts and amplitude sums to the count rate and
+   * integrated amplitude histograms, and update the histogram statistics
+   */
+  void FlushAccumulators();
+
 private:
   Bool_t                              fLocalInitialized;    ///< Check whether task is initialized (for ExecOnce)
   THistManager                        *fHistManager;        //!<! Histogram handler
@@ -265,12 +288,32 @@ private:
   Int_t                               fOldRun;              //!<! Old Run number (for run change check)
 
   std::vector<Int_t>                  fMaskedCells;         ///< Vector of masked cells
+  std::vector<Bool_t>                 fCellMaskStatus;      //!<! Masking status per cell (from fMaskedCells)
+
+  std::vector<Int_t>                  fCellSM;              //!<! Supermodule of each cell
+  std::vector<Int_t>                  fCellCol;             //!<! Column of each cell in the supermodule
+  std::vector<Int_t>                  fCellRow;             //!<! Row of each cell in the supermodule
+  std::vector<ULong64_t>              fCellCounts;          //!<! Number of hits above the amplitude cut per cell
+  std::vector<Double_t>               fCellSumAmplitude;    //!<! Summed amplitude above the amplitude cut per cell
+  std::vector<Double_t>               fCellSumAmplitude2;   //!<! Summed squared amplitude above the amplitude cut per cell
+
+  AliEmcalQAAccumulator               fAccAmplitude;        //!<! cellAmplitude
+  AliEmcalQAAccumulator               fAccAmplitudeCut;     //!<! cellAmplitudeCut
+  AliEmcalQAAccumulator               fAccTime;             //!<! cellTime
+  AliEmcalQAAccumulator               fAccTimeOutlier;      //!<! cellTimeOutlier
+  AliEmcalQAAccumulator               fAccTimeMain;         //!<! cellTimeMain
+  AliEmcalQAAccumulator               fAccFrequency;        //!<! cellFrequency
+  AliEmcalQAAccumulator               fAccClusterOccurrency;  //!<! cellClusterOccurrency
+  AliEmcalQAAccumulator               fAccAmplitudeFractionCluster; //!<! cellAmplitudeFractionCluster
+  std::vector<AliEmcalQAAccumulator>  fAccCountSM;          //!<! cellCountSM<i>
+  std::vector<AliEmcalQAAccumulator>  fAccAmpSM;            //!<! cellAmpSM<i>
+  std::vector<AliEmcalQAAccumulator>  fAccAmpTimeCorrSM;    //!<! cellAmpTimeCorrSM<i>
 
   AliEmcalCellMonitorTask(const AliEmcalCellMonitorTask &ref);
   AliEmcalCellMonitorTask &operator=(const AliEmcalCellMonitorTask &ref);
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCellMonitorTask, 1);
+  ClassDef(AliEmcalCellMonitorTask, 2);
   /// \endcond
 };
 
@@ -5,8 +5,11 @@
 
 #include "AliEmcalClusTrackMatcherTask.h"
 
+#include <vector>
+
 #include <TClonesArray.h>
 #include <TClass.h>
+#include <TVector3.h>
 
 #include <AliAODCaloCluster.h>
 #include <AliESDCaloCluster.h>
@@ -16,6 +19,7 @@
 #include <AliEMCALRecoUtils.h>
 
 #include "AliEmcalParticle.h"
+#include "AliEmcalEtaPhiGrid.h"
 #include "AliParticleContainer.h"
 #include "AliClusterContainer.h"
 
@@ -36,6 +40,7 @@ AliEmcalClusTrackMatcherTask::AliEmcalClusTrackMatcherTask() :
   fEmcalClusters(0),
   fNEmcalTracks(0),
   fNEmcalClusters(0),
+  fClusterGrid(0),
   fHistMatchEtaAll(0),
   fHistMatchPhiAll(0)
 {
@@ -66,6 +71,7 @@ AliEmcalClusTrackMatcherTask::AliEmcalClusTrackMatcherTask(const char *name, Boo
   fEmcalClusters(0),
   fNEmcalTracks(0),
   fNEmcalClusters(0),
+  fClusterGrid(0),
   fHistMatchEtaAll(0),
   fHistMatchPhiAll(0)
 {
@@ -85,6 +91,8 @@ AliEmcalClusTrackMatcherTask::AliEmcalClusTrackMatcherTask(const char *name, Boo
 AliEmcalClusTrackMatcherTask::~AliEmcalClusTrackMatcherTask()
 {
   // Destructor.
+
+  delete fClusterGrid;
 }
 
 //________________________________________________________________________
@@ -283,11 +291,27 @@ void AliEmcalClusTrackMatcherTask::DoMatching()
 
   const Double_t maxd2 = fMaxDistance*fMaxDistance;
 
+  // index the clusters in eta-phi, so that each track is only tested against the clusters
+  // in its neighbourhood (same matches, in the same order, as testing all the clusters)
+  if (!fClusterGrid) fClusterGrid = new AliEmcalEtaPhiGrid;
+  std::vector<Double_t> clusterEta(fNEmcalClusters), clusterPhi(fNEmcalClusters);
+  for (Int_t icluster = 0; icluster < fNEmcalClusters; icluster++) {
+    AliVCluster* cluster = static_cast<AliEmcalParticle*>(fEmcalClusters->At(icluster))->GetCluster();
+    Float_t pos[3] = {0};
+    cluster->GetPosition(pos);
+    TVector3 cpos(pos);
+    clusterEta[icluster] = cpos.Eta();
+    clusterPhi[icluster] = cpos.Phi();
+  }
+  fClusterGrid->Fill(clusterEta, clusterPhi, TMath::Abs(fMaxDistance));
+
+  std::vector<Int_t> candidates;
   for (Int_t itrack = 0; itrack < fNEmcalTracks; itrack++) {
     AliEmcalParticle* emcalTrack = static_cast<AliEmcalParticle*>(fEmcalTracks->At(itrack));
     AliVTrack* track = emcalTrack->GetTrack();
 
-    for (Int_t icluster = 0; icluster < fNEmcalClusters; icluster++) {
+    fClusterGrid->GetCandidates(track->GetTrackEtaOnEMCal(), track->GetTrackPhiOnEMCal(), candidates);
+    for (Int_t icluster : candidates) {
       AliEmcalParticle* emcalCluster = static_cast<AliEmcalParticle*>(fEmcalClusters->At(icluster));
       AliVCluster* cluster = emcalCluster->GetCluster();
 
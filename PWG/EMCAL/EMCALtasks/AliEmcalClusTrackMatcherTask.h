@@ -3,6 +3,8 @@
 
 #include "AliAnalysisTaskEmcal.h"
 
+class AliEmcalEtaPhiGrid;
+
 class AliEmcalClusTrackMatcherTask : public AliAnalysisTaskEmcal {
  public:
   AliEmcalClusTrackMatcherTask();
@@ -42,6 +44,7 @@ class AliEmcalClusTrackMatcherTask : public AliAnalysisTaskEmcal {
   TClonesArray *fEmcalClusters;         //!emcal clusters
   Int_t         fNEmcalTracks;          //!number of emcal tracks
   Int_t         fNEmcalClusters;        //!number of emcal clusters
+  AliEmcalEtaPhiGrid *fClusterGrid;     //!eta-phi index of the emcal clusters
   TH1          *fHistMatchEtaAll;       //!deta distribution
   TH1          *fHistMatchPhiAll;       //!dphi distribution
   TH1          *fHistMatchEta[10][9][2]; //!deta distribution
@@ -51,6 +54,6 @@ class AliEmcalClusTrackMatcherTask : public AliAnalysisTaskEmcal {
   AliEmcalClusTrackMatcherTask(const AliEmcalClusTrackMatcherTask&);            // not implemented
   AliEmcalClusTrackMatcherTask &operator=(const AliEmcalClusTrackMatcherTask&); // not implemented
 
-  ClassDef(AliEmcalClusTrackMatcherTask, 8) // Cluster-Track matching task
+  ClassDef(AliEmcalClusTrackMatcherTask, 9) // Cluster-Track matching task
 };
 #endif
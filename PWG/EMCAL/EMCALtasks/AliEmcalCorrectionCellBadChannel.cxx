@@ -130,6 +130,26 @@ Bool_t AliEmcalCorrectionCellBadChannel::Run()
   return kTRUE;
 }
 
+/**
+ * Configure the reco utils for the fused cell loop of the correction task,
+ * same configuration as in Run().
+ */
+Bool_t AliEmcalCorrectionCellBadChannel::PrepareCellKernel()
+{
+  AliEmcalCorrectionComponent::Run();
+
+  if (!fEventManager.InputEvent()) {
+    AliError("Event ptr = 0, returning");
+    return kFALSE;
+  }
+
+  Bool_t runChanged = CheckIfRunChanged();
+
+  fRecoUtils->SwitchOnBadChannelsRemoval();
+
+  return InitCellKernel(runChanged);
+}
+
 /**
  * This function is called if the run changes (it inherits from the base component),
  * to load a new bad channel and fill relevant variables.
@@ -141,6 +141,35 @@ Bool_t AliEmcalCorrectionCellEnergy::Run()
   return kTRUE;
 }
 
+/**
+ * Configure the reco utils for the fused cell loop of the correction task,
+ * same configuration as in Run().
+ */
+Bool_t AliEmcalCorrectionCellEnergy::PrepareCellKernel()
+{
+  AliEmcalCorrectionComponent::Run();
+
+  if (!fEventManager.InputEvent()) {
+    AliError("Event ptr = 0, returning");
+    return kFALSE;
+  }
+
+  Bool_t runChanged = CheckIfRunChanged();
+
+  fRecoUtils->SwitchOnRecalibration();
+
+  return InitCellKernel(runChanged);
+}
+
+/**
+ * Switch off the recalibration after the fused cell loop, as at the end of Run().
+ */
+void AliEmcalCorrectionCellEnergy::FinishCellKernel()
+{
+  AliEmcalCorrectionComponent::FinishCellKernel();
+  fRecoUtils->SwitchOffRecalibration();
+}
+
 /**
  * Initialize the energy calibration.
  */
@@ -32,6 +32,11 @@ class AliEmcalCorrectionCellEnergy : public AliEmcalCorrectionComponent {
   void UserCreateOutputObjects();
   Bool_t Run();
   Bool_t CheckIfRunChanged();
+
+  // Fused cell loop, not used when the QA histograms are requested
+  Bool_t IsCellKernel() const { return !fCreateHisto; }
+  Bool_t PrepareCellKernel();
+  void FinishCellKernel();
   
 protected:
   TH1F* fCellEnergyDistBefore;        //!<! cell energy distribution, before energy calibration
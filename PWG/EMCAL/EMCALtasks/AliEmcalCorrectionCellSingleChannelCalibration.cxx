@@ -122,6 +122,35 @@ Bool_t AliEmcalCorrectionCellSingleChannelCalibration::Run()
   return kTRUE;
 }
 
+/**
+ * Configure the reco utils for the fused cell loop of the correction task,
+ * same configuration as in Run().
+ */
+Bool_t AliEmcalCorrectionCellSingleChannelCalibration::PrepareCellKernel()
+{
+  AliEmcalCorrectionComponent::Run();
+
+  if (!fEventManager.InputEvent()) {
+    AliError("Event ptr = 0, returning");
+    return kFALSE;
+  }
+
+  Bool_t runChanged = CheckIfRunChanged();
+
+  fRecoUtils->SwitchOnRecalibration();
+
+  return InitCellKernel(runChanged);
+}
+
+/**
+ * Switch off the recalibration after the fused cell loop, as at the end of Run().
+ */
+void AliEmcalCorrectionCellSingleChannelCalibration::FinishCellKernel()
+{
+  AliEmcalCorrectionComponent::FinishCellKernel();
+  fRecoUtils->SwitchOffRecalibration();
+}
+
 /**
  * Initialize the energy calibration.
  */
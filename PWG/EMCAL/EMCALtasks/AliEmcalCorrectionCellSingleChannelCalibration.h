@@ -33,6 +33,11 @@ class AliEmcalCorrectionCellSingleChannelCalibration : public AliEmcalCorrection
   void UserCreateOutputObjects();
   Bool_t Run();
   Bool_t CheckIfRunChanged();
+
+  // Fused cell loop, not used when the QA histograms are requested
+  Bool_t IsCellKernel() const { return !fCreateHisto; }
+  Bool_t PrepareCellKernel();
+  void FinishCellKernel();
   
  protected:
   TH1F* fCellSingleChannelEnergyDistBefore;        //!<! cell energy distribution, before energy calibration
@@ -154,6 +154,39 @@ Bool_t AliEmcalCorrectionCellTimeCalib::Run()
   return kTRUE;
 }
 
+/**
+ * Configure the reco utils for the fused cell loop of the correction task,
+ * same configuration as in Run().
+ */
+Bool_t AliEmcalCorrectionCellTimeCalib::PrepareCellKernel()
+{
+  AliEmcalCorrectionComponent::Run();
+
+  if (!fEventManager.InputEvent()) {
+    AliError("Event ptr = 0, returning");
+    return kFALSE;
+  }
+
+  Bool_t runChanged = CheckIfRunChanged();
+
+  if (fCalibrateTimeVsE)
+    fRecoUtils->SwitchOnTimeECorrection();
+  else
+    fRecoUtils->SwitchOffTimeECorrection();
+
+  if (fCalibrateTime)
+    fRecoUtils->SwitchOnTimeRecalibration();
+  else
+    fRecoUtils->SwitchOffTimeRecalibration();
+
+  if (fCalibrateTimeL1Phase)
+    fRecoUtils->SwitchOnL1PhaseInTimeRecalibration();
+  else
+    fRecoUtils->SwitchOffL1PhaseInTimeRecalibration();
+
+  return InitCellKernel(runChanged);
+}
+
 
 /**
  * Initialize the energy dependent time calibration.
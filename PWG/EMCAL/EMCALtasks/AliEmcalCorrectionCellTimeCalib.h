@@ -32,6 +32,10 @@ class AliEmcalCorrectionCellTimeCalib : public AliEmcalCorrectionComponent {
   void UserCreateOutputObjects();
   Bool_t Run();
   Bool_t CheckIfRunChanged();
+
+  // Fused cell loop, not used when the QA histograms are requested
+  Bool_t IsCellKernel() const { return !fCreateHisto; }
+  Bool_t PrepareCellKernel();
   
 protected:
   TH1F* fCellTimeDistBefore;            //!<! cell energy distribution, before time calibration
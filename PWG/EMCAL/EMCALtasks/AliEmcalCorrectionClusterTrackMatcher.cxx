@@ -3,8 +3,11 @@
 
 #include "AliEmcalCorrectionClusterTrackMatcher.h"
 
+#include <vector>
+
 #include <TH1.h>
 #include <TList.h>
+#include <TVector3.h>
 
 #include "AliClusterContainer.h"
 #include "AliParticleContainer.h"
@@ -13,6 +16,7 @@
 #include "AliAODCaloCluster.h"
 #include "AliVParticle.h"
 #include "AliEmcalParticle.h"
+#include "AliEmcalEtaPhiGrid.h"
 #include "AliEMCALGeometry.h"
 #include "AliMCEvent.h"
 
@@ -44,6 +48,7 @@ AliEmcalCorrectionClusterTrackMatcher::AliEmcalCorrectionClusterTrackMatcher() :
   fEmcalClusters(0),
   fNEmcalTracks(0),
   fNEmcalClusters(0),
+  fClusterGrid(0),
   fHistMatchEtaAll(0),
   fHistMatchPhiAll(0),
   fNMCGenerToAccept(0),
@@ -66,6 +71,7 @@ AliEmcalCorrectionClusterTrackMatcher::AliEmcalCorrectionClusterTrackMatcher() :
  */
 AliEmcalCorrectionClusterTrackMatcher::~AliEmcalCorrectionClusterTrackMatcher()
 {
+  delete fClusterGrid;
 }
 
 /**
@@ -378,11 +384,27 @@ void AliEmcalCorrectionClusterTrackMatcher::DoMatching()
 {
   const Double_t maxd2 = fMaxDistance*fMaxDistance;
 
+  // index the clusters in eta-phi, so that each track is only tested against the clusters
+  // in its neighbourhood (same matches, in the same order, as testing all the clusters)
+  if (!fClusterGrid) fClusterGrid = new AliEmcalEtaPhiGrid;
+  std::vector<Double_t> clusterEta(fNEmcalClusters), clusterPhi(fNEmcalClusters);
+  for (Int_t icluster = 0; icluster < fNEmcalClusters; icluster++) {
+    AliVCluster* cluster = static_cast<AliEmcalParticle*>(fEmcalClusters->At(icluster))->GetCluster();
+    Float_t pos[3] = {0};
+    cluster->GetPosition(pos);
+    TVector3 cpos(pos);
+    clusterEta[icluster] = cpos.Eta();
+    clusterPhi[icluster] = cpos.Phi();
+  }
+  fClusterGrid->Fill(clusterEta, clusterPhi, TMath::Abs(fMaxDistance));
+
+  std::vector<Int_t> candidates;
   for (Int_t itrack = 0; itrack < fNEmcalTracks; itrack++) {
     AliEmcalParticle* emcalTrack = static_cast<AliEmcalParticle*>(fEmcalTracks->At(itrack));
     AliVTrack* track = emcalTrack->GetTrack();
 
-    for (Int_t icluster = 0; icluster < fNEmcalClusters; icluster++) {
+    fClusterGrid->GetCandidates(track->GetTrackEtaOnEMCal(), track->GetTrackPhiOnEMCal(), candidates);
+    for (Int_t icluster : candidates) {
       AliEmcalParticle* emcalCluster = static_cast<AliEmcalParticle*>(fEmcalClusters->At(icluster));
       AliVCluster* cluster = emcalCluster->GetCluster();
       
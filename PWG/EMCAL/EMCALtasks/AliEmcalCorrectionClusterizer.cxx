@@ -862,7 +862,11 @@ void AliEmcalCorrectionClusterizer::Init()
   else
     fRecoUtils->SwitchOffDistToBadChannelRecalculation();
   
-  CheckIfRunChanged();
+  Bool_t runChanged = CheckIfRunChanged();
+
+  // the clusterizer (or unfolder) is set up once per run, as in AliAnalysisTaskEMCALClusterizeFast
+  if (!runChanged && (fJustUnfold ? fUnfolder != 0 : fClusterizer != 0))
+    return;
   
   if (fJustUnfold){
     // init the unfolding afterburner
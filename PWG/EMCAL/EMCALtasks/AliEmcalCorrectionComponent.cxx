@@ -52,7 +52,8 @@ AliEmcalCorrectionComponent::AliEmcalCorrectionComponent() :
   fRecoUtils(0),
   fOutput(0),
   fBasePath(""),
-  fCustomBadChannelFilePath("")
+  fCustomBadChannelFilePath(""),
+  fCellKernelBC(-1)
 
 {
   fVertex[0] = 0;
@@ -88,7 +89,8 @@ AliEmcalCorrectionComponent::AliEmcalCorrectionComponent(const char * name) :
   fRecoUtils(0),
   fOutput(0),
   fBasePath(""),
-  fCustomBadChannelFilePath("")
+  fCustomBadChannelFilePath(""),
+  fCellKernelBC(-1)
 {
   fVertex[0] = 0;
   fVertex[1] = 0;
@@ -209,24 +211,91 @@ void AliEmcalCorrectionComponent::UpdateCells()
   Int_t bunchCrossNo = fEventManager.InputEvent()->GetBunchCrossNumber();
   
   if (fRecoUtils){
-    //In case of PAR run check global event ID
-    if(fRecoUtils->IsParRun()){
-      Short_t currentParIndex = 0;
-      ULong64_t globalEventID = (ULong64_t)bunchCrossNo + (ULong64_t)fEventManager.InputEvent()->GetOrbitNumber() * (ULong64_t)3564 + (ULong64_t)fEventManager.InputEvent()->GetPeriodNumber() * (ULong64_t)59793994260;
-      for(Short_t ipar=0;ipar<fRecoUtils->GetNPars();ipar++){
-        if(globalEventID >= fRecoUtils->GetGlobalIDPar(ipar)) {
-          currentParIndex++;
-        }
-      }
-      fRecoUtils->SetCurrentParNumber(currentParIndex);      
-    }
-    //end of PAR run settings
+    UpdateParNumber(bunchCrossNo);
+
+    // Maps loaded when the run changed are gathered per cell once, setting new maps clears them
+    if (fRecoUtils->IsCellRecalibrationOn() && !fRecoUtils->HasFlatCellCalibration())
+      fRecoUtils->FillFlatCellCalibration();
 
     fRecoUtils->RecalibrateCells(fCaloCells, bunchCrossNo);
   }
   fCaloCells->Sort();
 }
 
+/**
+ * In case of PAR run set the current PAR index of the reco utils from the global event ID
+ */
+void AliEmcalCorrectionComponent::UpdateParNumber(Int_t bunchCrossNo)
+{
+  if(fRecoUtils->IsParRun()){
+    Short_t currentParIndex = 0;
+    ULong64_t globalEventID = (ULong64_t)bunchCrossNo + (ULong64_t)fEventManager.InputEvent()->GetOrbitNumber() * (ULong64_t)3564 + (ULong64_t)fEventManager.InputEvent()->GetPeriodNumber() * (ULong64_t)59793994260;
+    for(Short_t ipar=0;ipar<fRecoUtils->GetNPars();ipar++){
+      if(globalEventID >= fRecoUtils->GetGlobalIDPar(ipar)) {
+        currentParIndex++;
+      }
+    }
+    fRecoUtils->SetCurrentParNumber(currentParIndex);
+  }
+}
+
+/**
+ * Common part of PrepareCellKernel(), to be called once the reco utils are configured
+ * for the event. The flat per-cell calibration of the reco utils is filled again when
+ * the run changes.
+ *
+ * @param runChanged Value returned by CheckIfRunChanged() for this event
+ * @return kTRUE if ApplyCellKernel() has to be called for the cells of this event
+ */
+Bool_t AliEmcalCorrectionComponent::InitCellKernel(Bool_t runChanged)
+{
+  if (runChanged)
+    fRecoUtils->ClearFlatCellCalibration();
+
+  if (fCaloCells->GetNumberOfCells()<=0)
+  {
+    AliDebug(2, Form("Number of EMCAL cells = %d, returning", fCaloCells->GetNumberOfCells()));
+    return kFALSE;
+  }
+
+  // mark the cells not recalibrated
+  fRecoUtils->ResetCellsCalibrated();
+
+  if (!fRecoUtils->IsCellRecalibrationOn())
+    return kFALSE;
+
+  fCellKernelBC = fEventManager.InputEvent()->GetBunchCrossNumber();
+  UpdateParNumber(fCellKernelBC);
+
+  if (!fRecoUtils->HasFlatCellCalibration())
+    fRecoUtils->FillFlatCellCalibration();
+
+  return fRecoUtils->HasFlatCellCalibration();
+}
+
+/**
+ * Apply the correction of the component to one cell, using the calibration gathered
+ * by InitCellKernel().
+ *
+ * @param absId Absolute cell ID
+ * @param isLowGain True for low gain cells
+ * @param[in,out] amp Cell energy
+ * @param[in,out] time Cell time
+ * @return kFALSE if the cell has to be removed
+ */
+Bool_t AliEmcalCorrectionComponent::ApplyCellKernel(Short_t absId, Bool_t isLowGain, Float_t & amp, Double_t & time)
+{
+  return fRecoUtils->AcceptCalibrateCellFlat(absId, fCellKernelBC, isLowGain, amp, time);
+}
+
+/**
+ * Called after the loop over the cells in which ApplyCellKernel() was used.
+ */
+void AliEmcalCorrectionComponent::FinishCellKernel()
+{
+  fRecoUtils->SetCellsRecalibrated();
+}
+
 /**
  * Check whether the run changed.
  */
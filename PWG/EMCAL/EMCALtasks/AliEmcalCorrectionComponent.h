@@ -60,6 +60,12 @@ class AliEmcalCorrectionComponent : public TNamed {
   void FillCellQA(TH1F* h);
   Int_t InitBadChannels();
 
+  // Cell level corrections run in a single loop over the cells, see AliEmcalCorrectionTask::RunCellKernels()
+  virtual Bool_t IsCellKernel() const { return kFALSE; }
+  virtual Bool_t PrepareCellKernel() { return kFALSE; }
+  virtual void FinishCellKernel();
+  Bool_t ApplyCellKernel(Short_t absId, Bool_t isLowGain, Float_t & amp, Double_t & time);
+
   // Containers and cells
   AliParticleContainer   *AddParticleContainer(const char *n)                    { return AliEmcalContainerUtils::AddContainer<AliParticleContainer>(n, fParticleCollArray); }
   AliTrackContainer      *AddTrackContainer(const char *n)                       { return AliEmcalContainerUtils::AddContainer<AliTrackContainer>(n, fParticleCollArray); }
@@ -136,13 +142,17 @@ class AliEmcalCorrectionComponent : public TNamed {
   
   TString                fBasePath;                       ///< Base folder path to get root files
   TString                fCustomBadChannelFilePath;       ///< Custom path to bad channel map OADB file
+  Int_t                  fCellKernelBC;                   //!<! Bunch crossing number used by ApplyCellKernel()
+
+  void UpdateParNumber(Int_t bunchCrossNo);
+  Bool_t InitCellKernel(Bool_t runChanged);
 
  private:
   AliEmcalCorrectionComponent(const AliEmcalCorrectionComponent &);               // Not implemented
   AliEmcalCorrectionComponent &operator=(const AliEmcalCorrectionComponent &);    // Not implemented
   
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCorrectionComponent, 9); // EMCal correction component
+  ClassDef(AliEmcalCorrectionComponent, 10); // EMCal correction component
   /// \endcond
 };
 
@@ -5,6 +5,7 @@
 
 #include "AliEmcalCorrectionTask.h"
 #include "AliEmcalCorrectionComponent.h"
+#include "AliEmcalTimingMonitor.h"
 
 #include <vector>
 #include <set>
@@ -60,6 +61,10 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask() :
   fBeamType(kNA),
   fForceBeamType(kNA),
   fNeedEmcalGeom(kTRUE),
+  fFuseCellKernels(kTRUE),
+  fDoTimingMonitor(kFALSE),
+  fTimingMemorySampling(0),
+  fTimingMonitor(0),
   fGeom(0),
   fParticleCollArray(),
   fClusterCollArray(),
@@ -105,6 +110,10 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask(const char * name) :
   fBeamType(kNA),
   fForceBeamType(kNA),
   fNeedEmcalGeom(kTRUE),
+  fFuseCellKernels(kTRUE),
+  fDoTimingMonitor(kFALSE),
+  fTimingMemorySampling(0),
+  fTimingMonitor(0),
   fGeom(0),
   fParticleCollArray(),
   fClusterCollArray(),
@@ -150,6 +159,10 @@ AliEmcalCorrectionTask::AliEmcalCorrectionTask(const AliEmcalCorrectionTask & ta
   fBeamType(task.fBeamType),
   fForceBeamType(task.fForceBeamType),
   fNeedEmcalGeom(task.fNeedEmcalGeom),
+  fFuseCellKernels(task.fFuseCellKernels),
+  fDoTimingMonitor(task.fDoTimingMonitor),
+  fTimingMemorySampling(task.fTimingMemorySampling),
+  fTimingMonitor(0),
   fGeom(task.fGeom),
   fParticleCollArray(*(static_cast<TObjArray *>(task.fParticleCollArray.Clone()))),
   fClusterCollArray(*(static_cast<TObjArray *>(task.fClusterCollArray.Clone()))),
@@ -213,6 +226,10 @@ void swap(AliEmcalCorrectionTask & first, AliEmcalCorrectionTask & second)
   swap(first.fBeamType, second.fBeamType);
   swap(first.fForceBeamType, second.fForceBeamType);
   swap(first.fNeedEmcalGeom, second.fNeedEmcalGeom);
+  swap(first.fFuseCellKernels, second.fFuseCellKernels);
+  swap(first.fDoTimingMonitor, second.fDoTimingMonitor);
+  swap(first.fTimingMemorySampling, second.fTimingMemorySampling);
+  swap(first.fTimingMonitor, second.fTimingMonitor);
   swap(first.fGeom, second.fGeom);
   swap(first.fParticleCollArray, second.fParticleCollArray);
   swap(first.fClusterCollArray, second.fClusterCollArray);
@@ -227,6 +244,7 @@ void swap(AliEmcalCorrectionTask & first, AliEmcalCorrectionTask & second)
 AliEmcalCorrectionTask::~AliEmcalCorrectionTask()
 {
   // Destructor
+  if (fTimingMonitor) delete fTimingMonitor;
 }
 
 void AliEmcalCorrectionTask::Initialize(bool removeDummyTask)
@@ -1047,6 +1065,17 @@ void AliEmcalCorrectionTask::UserCreateOutputObjects()
 
   UserCreateOutputObjectsComponents();
 
+  if (fDoTimingMonitor)
+  {
+    // One step per component, the order must match fCorrectionComponents
+    fTimingMonitor = new AliEmcalTimingMonitor;
+    for (auto component : fCorrectionComponents) fTimingMonitor->AddStep(component->GetName());
+    fTimingMonitor->AddStep("FusedCellKernels");
+    fTimingMonitor->AddStep("RetrieveEventObjects");
+    fTimingMonitor->SetMemorySampling(fTimingMemorySampling);
+    fTimingMonitor->CreateOutput(fOutput);
+  }
+
   PostData(1, fOutput);
 }
 
@@ -1103,7 +1132,14 @@ void AliEmcalCorrectionTask::UserExec(Option_t *option)
     return;
 
   // Get the objects for each event
-  if (!RetrieveEventObjects())
+  const Int_t kStepRetrieve = fCorrectionComponents.size() + 1;
+  if (fTimingMonitor) {
+    fTimingMonitor->NextEvent();
+    fTimingMonitor->Start(kStepRetrieve);
+  }
+  Bool_t retrieved = RetrieveEventObjects();
+  if (fTimingMonitor) fTimingMonitor->Stop(kStepRetrieve);
+  if (!retrieved)
     return;
 
   // Call run for each correction
@@ -1313,8 +1349,33 @@ Bool_t AliEmcalCorrectionTask::Run()
     component->SetCentralityBin(fCentBin);
     component->SetCentrality(fCent);
     component->SetVertex(fVertex);
+  }
 
-    component->Run();
+  for (std::size_t iComp = 0; iComp < fCorrectionComponents.size(); iComp++)
+  {
+    AliEmcalCorrectionComponent * component = fCorrectionComponents[iComp];
+
+    // Consecutive cell level components working on the same cells are run in a single loop over the cells
+    std::size_t nKernels = 0;
+    if (fFuseCellKernels) {
+      while (iComp + nKernels < fCorrectionComponents.size() && fCorrectionComponents[iComp + nKernels]->IsCellKernel() &&
+             fCorrectionComponents[iComp + nKernels]->GetCaloCells() == component->GetCaloCells()) {
+        nKernels++;
+      }
+    }
+
+    if (nKernels > 1) {
+      // the fused loop cannot be split between the components
+      if (fTimingMonitor) fTimingMonitor->Start(fCorrectionComponents.size());
+      RunCellKernels(iComp, nKernels);
+      if (fTimingMonitor) fTimingMonitor->Stop(fCorrectionComponents.size());
+      iComp += nKernels - 1;
+    }
+    else {
+      if (fTimingMonitor) fTimingMonitor->Start(iComp);
+      component->Run();
+      if (fTimingMonitor) fTimingMonitor->Stop(iComp);
+    }
   }
 
   PostData(1, fOutput);
@@ -1322,6 +1383,59 @@ Bool_t AliEmcalCorrectionTask::Run()
   return kTRUE;
 }
 
+/**
+ * Run several cell level components in a single loop over the cells. For each cell the
+ * correction of each component is applied in the order of execution, using the calibration
+ * gathered per run by the components, and the cells are sorted only once at the end.
+ * The result is the same as running the components one after the other.
+ *
+ * @param[in] first Index of the first component in fCorrectionComponents
+ * @param[in] n Number of components
+ */
+void AliEmcalCorrectionTask::RunCellKernels(std::size_t first, std::size_t n)
+{
+  AliVCaloCells * cells = fCorrectionComponents[first]->GetCaloCells();
+
+  fCellKernels.clear();
+  for (std::size_t iComp = first; iComp < first + n; iComp++)
+  {
+    if (fCorrectionComponents[iComp]->PrepareCellKernel()) {
+      fCellKernels.push_back(fCorrectionComponents[iComp]);
+    }
+  }
+
+  if (fCellKernels.empty() || !cells) return;
+
+  Short_t absId = -1;
+  Double_t ecellin = 0, tcellin = 0, efrac = 0;
+  Int_t mclabel = -1;
+  Int_t nCells = cells->GetNumberOfCells();
+  for (Int_t iCell = 0; iCell < nCells; iCell++)
+  {
+    cells->GetCell(iCell, absId, ecellin, tcellin, mclabel, efrac);
+    Bool_t isCellHG = cells->GetCellHighGain(absId);
+
+    Float_t ecell = ecellin;
+    Double_t tcell = tcellin;
+    for (auto kernel : fCellKernels)
+    {
+      if (!kernel->ApplyCellKernel(absId, !isCellHG, ecell, tcell)) {
+        ecell = 0;
+        tcell = -1;
+      }
+    }
+
+    cells->SetCell(iCell, absId, ecell, tcell, mclabel, efrac, isCellHG);
+  }
+
+  for (auto kernel : fCellKernels)
+  {
+    kernel->FinishCellKernel();
+  }
+
+  cells->Sort();
+}
+
 /**
  * Executed when the file is changed. Also calls UserNotify() for each component.
  */
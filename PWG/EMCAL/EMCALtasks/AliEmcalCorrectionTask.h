@@ -5,6 +5,7 @@ class AliEmcalCorrectionCellContainer;
 class AliEmcalCorrectionComponent;
 class AliEMCALGeometry;
 class AliVEvent;
+class AliEmcalTimingMonitor;
 
 #include <AliAnalysisTaskSE.h>
 #include <AliVCluster.h>
@@ -100,6 +101,9 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   // Set
   void                        SetForceBeamType(BeamType f)                          { fForceBeamType     = f                              ; }
   void                        SetNeedEmcalGeometry(Bool_t b)                        { fNeedEmcalGeom     = b                              ; }
+  void                        SetFuseCellKernels(Bool_t b)                          { fFuseCellKernels   = b                              ; }
+  /// Monitor wall/CPU time per component (and the resident memory every n-th event) in the list "TimingMonitor" of the output
+  void                        SetTimingMonitor(Bool_t b, Int_t memorySampling = 0)  { fDoTimingMonitor   = b ; fTimingMemorySampling = memorySampling; }
   // Centrality options
   void                        SetUseNewCentralityEstimation(Bool_t b)               { fUseNewCentralityEstimation = b                     ; }
   void                        SetCentralityEstimator(const char * c)                { fCentEst           = c                              ; }
@@ -146,6 +150,7 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   // Aditional steering functions
   virtual void ExecOnce();
   virtual Bool_t Run();
+  void RunCellKernels(std::size_t first, std::size_t n);
 
   /**
    * EMCal Correction Task AddTask. Should be used by most users, except for those on the LEGO train
@@ -240,6 +245,11 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   BeamType                    fBeamType;                   //!<! Event beam type
   BeamType                    fForceBeamType;              ///< forced beam type
   Bool_t                      fNeedEmcalGeom;              ///< whether or not the task needs the emcal geometry
+  Bool_t                      fFuseCellKernels;            ///< run consecutive cell level components in a single loop over the cells
+  std::vector <AliEmcalCorrectionComponent *> fCellKernels; //!<! components applied in the current fused loop over the cells
+  Bool_t                      fDoTimingMonitor;            ///< monitor the timing of the components
+  Int_t                       fTimingMemorySampling;       ///< sampling period (events) of the resident memory in the timing monitor
+  AliEmcalTimingMonitor      *fTimingMonitor;              //!<! timing monitor of the components
   AliEMCALGeometry           *fGeom;                       //!<! Emcal geometry
 
   TObjArray                   fParticleCollArray;          ///< Particle/track collection array
@@ -249,7 +259,7 @@ class AliEmcalCorrectionTask : public AliAnalysisTaskSE {
   TList *                     fOutput;                     //!<! Output for histograms
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCorrectionTask, 9); // EMCal correction task
+  ClassDef(AliEmcalCorrectionTask, 11); // EMCal correction task
   /// \endcond
 };
 
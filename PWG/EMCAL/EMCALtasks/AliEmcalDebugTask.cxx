@@ -9,7 +9,9 @@
 #include <TFile.h>
 #include <TRandom3.h>
 #include <TSystem.h>
+#include "AliAnalysisDataContainer.h"
 #include "AliAnalysisManager.h"
+#include "AliEmcalTimingMonitor.h"
 #include "AliESDEvent.h"
 #include "AliInputEventHandler.h"
 #include "AliLog.h"
@@ -22,6 +24,7 @@ AliEmcalDebugTask::AliEmcalDebugTask() :
   fId(0),
   fFileTest(),
   fPrintEnv(0),
+  fPrintTimingSummary(0),
   fOutput(0),
   fFileName(),
   fRand(0)
@@ -35,6 +38,7 @@ AliEmcalDebugTask::AliEmcalDebugTask(const char *name) :
   fId(0),
   fFileTest(),
   fPrintEnv(0),
+  fPrintTimingSummary(0),
   fOutput(0),
   fFileName(),
   fRand(0)
@@ -105,3 +109,24 @@ void AliEmcalDebugTask::UserExec(Option_t *)
   AliInfo(Form("New file: %s", fFileName.Data()));
   fOutput->Add(new TNamed(Form("%u:%u",fId,fRand),fFileName.Data()));
 }
+
+//________________________________________________________________________
+void AliEmcalDebugTask::Terminate(Option_t *) 
+{
+  // Print the timing summary of the tasks run in the same train.
+
+  if (!fPrintTimingSummary)
+    return;
+
+  AliAnalysisManager *am = AliAnalysisManager::GetAnalysisManager();
+  if (!am)
+    return;
+
+  TIter next(am->GetOutputs());
+  AliAnalysisDataContainer *cont = 0;
+  while ((cont = static_cast<AliAnalysisDataContainer*>(next()))) {
+    TList *list = dynamic_cast<TList*>(cont->GetData());
+    if (list)
+      AliEmcalTimingMonitor::PrintSummary(list, cont->GetName());
+  }
+}
@@ -14,14 +14,17 @@ class AliEmcalDebugTask : public AliAnalysisTaskSE {
   void        SetId(UInt_t id)           { fId       = id; }
   void        SetFileTest(const char *n) { fFileTest =  n; }
   void        SetPrintEnv(Bool_t b)      { fPrintEnv = b;  }
+  void        SetPrintTimingSummary(Bool_t b) { fPrintTimingSummary = b; }
 
  protected:
   void        UserCreateOutputObjects();
   void        UserExec(Option_t *option);
+  void        Terminate(Option_t *option);
 
   UInt_t      fId;         //id to be stored in the output file
   TString     fFileTest;   //path name test 
   Bool_t      fPrintEnv;   //print env if true
+  Bool_t      fPrintTimingSummary; //print the timing monitors of all the outputs in Terminate
   TList      *fOutput;     //!output list
   TString     fFileName;   //!current file name
   UInt_t      fRand;       //!random number
@@ -30,7 +33,7 @@ class AliEmcalDebugTask : public AliAnalysisTaskSE {
   AliEmcalDebugTask(const AliEmcalDebugTask&);            // not implemented
   AliEmcalDebugTask &operator=(const AliEmcalDebugTask&); // not implemented
 
-  ClassDef(AliEmcalDebugTask, 1); // Class to be able to run on skimmed ESDs
+  ClassDef(AliEmcalDebugTask, 2); // Class to be able to run on skimmed ESDs
 };
 
 #endif
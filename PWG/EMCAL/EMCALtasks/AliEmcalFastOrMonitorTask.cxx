@@ -69,7 +69,23 @@ AliEmcalFastOrMonitorTask::AliEmcalFastOrMonitorTask() :
   fNameMaskedCellOADB(AliDataFile::GetFileNameOADB("EMCAL/EMCALBadChannels.root").data()),
   fMaskedFastorOADB(nullptr),
   fMaskedCellOADB(nullptr),
-  fRecoUtils(nullptr)
+  fRecoUtils(nullptr),
+  fFastorEta(),
+  fFastorPhi(),
+  fAccFrequencyL0(),
+  fAccFrequencyL1(),
+  fAccColRowFrequencyL0(),
+  fAccColRowFrequencyL1(),
+  fAccAmplitude(),
+  fAccTimeSum(),
+  fAccNL0Times(),
+  fAccTransverseTimeSum(),
+  fAccEnergyFastorCell(),
+  fAccEnergyFastorCellL0(),
+  fAccEnergyFastorCellL0Amp(),
+  fAccCellTimeBefore(),
+  fAccCellTimeAfter(),
+  fAccCellEnergyCount()
 {
   SetNeedEmcalGeom(kTRUE);
 }
@@ -88,7 +104,23 @@ AliEmcalFastOrMonitorTask::AliEmcalFastOrMonitorTask(const char *name) :
   fNameMaskedCellOADB(AliDataFile::GetFileNameOADB("EMCAL/EMCALBadChannels.root").data()),
   fMaskedFastorOADB(nullptr),
   fMaskedCellOADB(nullptr),
-  fRecoUtils(nullptr)
+  fRecoUtils(nullptr),
+  fFastorEta(),
+  fFastorPhi(),
+  fAccFrequencyL0(),
+  fAccFrequencyL1(),
+  fAccColRowFrequencyL0(),
+  fAccColRowFrequencyL1(),
+  fAccAmplitude(),
+  fAccTimeSum(),
+  fAccNL0Times(),
+  fAccTransverseTimeSum(),
+  fAccEnergyFastorCell(),
+  fAccEnergyFastorCellL0(),
+  fAccEnergyFastorCellL0Amp(),
+  fAccCellTimeBefore(),
+  fAccCellTimeAfter(),
+  fAccCellEnergyCount()
 {
   SetNeedEmcalGeom(kTRUE);
   DefineOutput(1, TList::Class());
@@ -163,6 +195,7 @@ void AliEmcalFastOrMonitorTask::UserCreateOutputObjects() {
 void AliEmcalFastOrMonitorTask::UserExecOnce(){
   int nrow = fGeom->GetTriggerMappingVersion() == 2 ? 104 : 64;
   fCellData.Allocate(48, nrow);
+  InitAccumulators();
 
   if(fNameMaskedCellOADB.Length()){
     fMaskedCellOADB = new AliOADBContainer("AliEMCALBadChannels");
@@ -231,21 +264,22 @@ bool AliEmcalFastOrMonitorTask::Run() {
     triggerdata->GetPosition(globCol, globRow);
     fGeom->GetTriggerMapping()->GetAbsFastORIndexFromPositionInEMCAL(globCol, globRow, fastOrID);
     if(amp > 1e-5){
-      fHistosQA->FillTH2("hFastOrColRowFrequencyL0", globCol, globRow);
-      fHistosQA->FillTH1("hFastOrFrequencyL0", fastOrID);
+      fAccColRowFrequencyL0.Fill2D(globCol, globRow);
+      fAccFrequencyL0.Fill1D(fastOrID);
     }
     if(l1timesum){
-      fHistosQA->FillTH2("hFastOrColRowFrequencyL1", globCol, globRow);
-      fHistosQA->FillTH1("hFastOrFrequencyL1", fastOrID);
+      fAccColRowFrequencyL1.Fill2D(globCol, globRow);
+      fAccFrequencyL1.Fill1D(fastOrID);
     }
-    if(std::find(fMaskedFastors.begin(), fMaskedFastors.end(), fastOrID) == fMaskedFastors.end()){
-      fHistosQA->FillTH2("hFastOrAmplitude", fastOrID, amp);
-      fHistosQA->FillTH2("hFastOrTimeSum", fastOrID, l1timesum);
-      fHistosQA->FillTH2("hFastOrNL0Times", fastOrID, nl0times);
-      fHistosQA->FillTH2("hFastOrTransverseTimeSum", fastOrID, GetTransverseTimeSum(fastOrID, l1timesum, fVertex));
-      fHistosQA->FillTH2("hEnergyFastorCell", fCellData(globCol, globRow), l1timesum * EMCALTrigger::kEMCL1ADCtoGeV);
-      fHistosQA->FillTH2("hEnergyFastorCellL0", fCellData(globCol, globRow), amp * kEMCL0ADCtoGeV);
-      fHistosQA->FillTH2("hEnergyFastorCellL0Amp", fCellData(globCol, globRow), amp);
+    // fMaskedFastors is sorted in RunChanged
+    if(!std::binary_search(fMaskedFastors.begin(), fMaskedFastors.end(), fastOrID)){
+      fAccAmplitude.Fill2D(fastOrID, amp);
+      fAccTimeSum.Fill2D(fastOrID, l1timesum);
+      fAccNL0Times.Fill2D(fastOrID, nl0times);
+      fAccTransverseTimeSum.Fill2D(fastOrID, GetTransverseTimeSum(fastOrID, l1timesum, fVertex));
+      fAccEnergyFastorCell.Fill2D(fCellData(globCol, globRow), l1timesum * EMCALTrigger::kEMCL1ADCtoGeV);
+      fAccEnergyFastorCellL0.Fill2D(fCellData(globCol, globRow), amp * kEMCL0ADCtoGeV);
+      fAccEnergyFastorCellL0Amp.Fill2D(fCellData(globCol, globRow), amp);
       int ncellmasked = 0;
       if(fRecoUtils){
         int fastorCells[4];
@@ -286,12 +320,12 @@ void AliEmcalFastOrMonitorTask::LoadEventCellData(){
     int position = fCaloCells->GetCellNumber(icell);
     double amplitude = fCaloCells->GetAmplitude(icell),
            celltimeNS = fCaloCells->GetTime(icell) * kSecToNanoSec;
-    if(amplitude > 0) fHistosQA->FillTH2("hCellTimeBefore", celltimeNS, amplitude);
+    if(amplitude > 0) fAccCellTimeBefore.Fill2D(celltimeNS, amplitude);
     if(celltimeNS < fMinCellTimeNS || celltimeNS > fMaxCellTimeNS) continue;
     if(amplitude > 0){
       AliDebugStream(1) << "Found cell time " << celltimeNS << " nanosec" << std::endl;
-      fHistosQA->FillTH2("hCellTimeAfter", celltimeNS, amplitude);
-      fHistosQA->FillTH1("hCellEnergyCount", position);
+      fAccCellTimeAfter.Fill2D(celltimeNS, amplitude);
+      fAccCellEnergyCount.Fill1D(position);
       int absFastor, col, row;
       fGeom->GetTriggerMapping()->GetFastORIndexFromCellIndex(position, absFastor);
       fGeom->GetPositionInEMCALFromAbsFastORIndex(absFastor, col, row);
@@ -301,6 +335,14 @@ void AliEmcalFastOrMonitorTask::LoadEventCellData(){
 }
 
 Double_t AliEmcalFastOrMonitorTask::GetTransverseTimeSum(Int_t fastorAbsID, Double_t adc, const Double_t *vertex) const{
+  if(fastorAbsID >= 0 && fastorAbsID < static_cast<Int_t>(fFastorEta.size())){
+    TVector3 fastorPos, vertexPos(vertex[0], vertex[1], vertex[2]);
+    fastorPos.SetPtEtaPhi(fGeom->GetIPDistance(), fFastorEta[fastorAbsID], fFastorPhi[fastorAbsID]);
+    fastorPos -= vertexPos;
+    TLorentzVector evec(fastorPos, adc);
+    return evec.Et();
+  }
+
   Int_t cellIDs[4];
   fGeom->GetTriggerMapping()->GetCellIndexFromFastORIndex(fastorAbsID, cellIDs);
   std::vector<double> eta, phi;
@@ -321,6 +363,50 @@ Double_t AliEmcalFastOrMonitorTask::GetTransverseTimeSum(Int_t fastorAbsID, Doub
   return evec.Et();
 }
 
+void AliEmcalFastOrMonitorTask::FinishTaskOutput(){
+  FlushAccumulators();
+}
+
+void AliEmcalFastOrMonitorTask::InitAccumulators(){
+  fAccFrequencyL0 = AliEmcalQAAccumulator(fHistosQA->FindObject("hFastOrFrequencyL0"));
+  fAccFrequencyL1 = AliEmcalQAAccumulator(fHistosQA->FindObject("hFastOrFrequencyL1"));
+  fAccColRowFrequencyL0 = AliEmcalQAAccumulator(fHistosQA->FindObject("hFastOrColRowFrequencyL0"));
+  fAccColRowFrequencyL1 = AliEmcalQAAccumulator(fHistosQA->FindObject("hFastOrColRowFrequencyL1"));
+  fAccAmplitude = AliEmcalQAAccumulator(fHistosQA->FindObject("hFastOrAmplitude"));
+  fAccTimeSum = AliEmcalQAAccumulator(fHistosQA->FindObject("hFastOrTimeSum"));
+  fAccNL0Times = AliEmcalQAAccumulator(fHistosQA->FindObject("hFastOrNL0Times"));
+  fAccTransverseTimeSum = AliEmcalQAAccumulator(fHistosQA->FindObject("hFastOrTransverseTimeSum"));
+  fAccEnergyFastorCell = AliEmcalQAAccumulator(fHistosQA->FindObject("hEnergyFastorCell"));
+  fAccEnergyFastorCellL0 = AliEmcalQAAccumulator(fHistosQA->FindObject("hEnergyFastorCellL0"));
+  fAccEnergyFastorCellL0Amp = AliEmcalQAAccumulator(fHistosQA->FindObject("hEnergyFastorCellL0Amp"));
+  fAccCellTimeBefore = AliEmcalQAAccumulator(fHistosQA->FindObject("hCellTimeBefore"));
+  fAccCellTimeAfter = AliEmcalQAAccumulator(fHistosQA->FindObject("hCellTimeAfter"));
+  fAccCellEnergyCount = AliEmcalQAAccumulator(fHistosQA->FindObject("hCellEnergyCount"));
+
+  // FastOR position for the transverse time sum: mean eta and phi of the 4 cells
+  int nfastor = 48 * (fGeom->GetTriggerMappingVersion() == 2 ? 104 : 64);
+  fFastorEta.assign(nfastor, 0.);
+  fFastorPhi.assign(nfastor, 0.);
+  Int_t cellIDs[4];
+  for(int ifastor = 0; ifastor < nfastor; ifastor++){
+    if(!fGeom->GetTriggerMapping()->GetCellIndexFromFastORIndex(ifastor, cellIDs)) continue;
+    double eta[4], phi[4];
+    for(int i = 0; i < 4; i++) fGeom->EtaPhiFromIndex(cellIDs[i], eta[i], phi[i]);
+    fFastorEta[ifastor] = TMath::Mean(4, eta);
+    fFastorPhi[ifastor] = TMath::Mean(4, phi);
+  }
+}
+
+void AliEmcalFastOrMonitorTask::FlushAccumulators(){
+  AliEmcalQAAccumulator *accumulators[] = {
+    &fAccFrequencyL0, &fAccFrequencyL1, &fAccColRowFrequencyL0, &fAccColRowFrequencyL1,
+    &fAccAmplitude, &fAccTimeSum, &fAccNL0Times, &fAccTransverseTimeSum,
+    &fAccEnergyFastorCell, &fAccEnergyFastorCellL0, &fAccEnergyFastorCellL0Amp,
+    &fAccCellTimeBefore, &fAccCellTimeAfter, &fAccCellEnergyCount
+  };
+  for(auto acc : accumulators) acc->Flush();
+}
+
 bool AliEmcalFastOrMonitorTask::IsCellMasked(int absCellID) const {
   if(!fRecoUtils) return false; // In case bad cells are not initialized declare cell as good
   Int_t smcell, modcell, colcell, rowcell, colcellsm, rowcellsm, channelstatus;
@@ -29,7 +29,9 @@
 
 #include "AliAnalysisTaskEmcal.h"
 #include "AliEMCALTriggerDataGrid.h"
+#include "AliEmcalQAAccumulator.h"
 #include <TString.h>
+#include <vector>
 
 class AliEMCALGeometry;
 class AliOADBContainer;
@@ -174,6 +176,13 @@ protected:
    */
   virtual void UserExecOnce();
 
+  /**
+   * @brief Add the accumulated per-FastOR and per-cell entries to the output histograms
+   *
+   * Called on the worker before the output is written and merged.
+   */
+  virtual void FinishTaskOutput();
+
   /**
    * @brief Run-dependent setup of the task
    *
@@ -216,6 +225,18 @@ protected:
    */
   bool IsCellMasked(int absCellID) const;
 
+  /**
+   * @brief Set up the accumulators of the FastOR and cell histograms
+   * and the mean eta and phi of the cells of each FastOR
+   */
+  void InitAccumulators();
+
+  /**
+   * @brief Update the entries and statistics of the histograms
+   * filled via the accumulators
+   */
+  void FlushAccumulators();
+
   THistManager                            *fHistosQA;           //!<! Histogram handler
   Bool_t                                  fLocalInitialized;  ///< Switch whether task is initialized (for ExecOnce)
   Int_t                                   fOldRun;            ///< Old Run (for RunChanged())
@@ -234,10 +255,27 @@ protected:
   AliOADBContainer                        *fMaskedCellOADB;   //!<! OADB container with masked cells
   AliEMCALRecoUtils                       *fRecoUtils;        //!<! EMCAL reco utils (for bad channel handling)
 
+  std::vector<double>                     fFastorEta;         //!<! Mean eta of the cells of each FastOR
+  std::vector<double>                     fFastorPhi;         //!<! Mean phi of the cells of each FastOR
+  AliEmcalQAAccumulator                   fAccFrequencyL0;    //!<! hFastOrFrequencyL0
+  AliEmcalQAAccumulator                   fAccFrequencyL1;    //!<! hFastOrFrequencyL1
+  AliEmcalQAAccumulator                   fAccColRowFrequencyL0; //!<! hFastOrColRowFrequencyL0
+  AliEmcalQAAccumulator                   fAccColRowFrequencyL1; //!<! hFastOrColRowFrequencyL1
+  AliEmcalQAAccumulator                   fAccAmplitude;      //!<! hFastOrAmplitude
+  AliEmcalQAAccumulator                   fAccTimeSum;        //!<! hFastOrTimeSum
+  AliEmcalQAAccumulator                   fAccNL0Times;       //!<! hFastOrNL0Times
+  AliEmcalQAAccumulator                   fAccTransverseTimeSum; //!<! hFastOrTransverseTimeSum
+  AliEmcalQAAccumulator                   fAccEnergyFastorCell;  //!<! hEnergyFastorCell
+  AliEmcalQAAccumulator                   fAccEnergyFastorCellL0; //!<! hEnergyFastorCellL0
+  AliEmcalQAAccumulator                   fAccEnergyFastorCellL0Amp; //!<! hEnergyFastorCellL0Amp
+  AliEmcalQAAccumulator                   fAccCellTimeBefore; //!<! hCellTimeBefore
+  AliEmcalQAAccumulator                   fAccCellTimeAfter;  //!<! hCellTimeAfter
+  AliEmcalQAAccumulator                   fAccCellEnergyCount; //!<! hCellEnergyCount
+
   AliEmcalFastOrMonitorTask(const AliEmcalFastOrMonitorTask &);
   AliEmcalFastOrMonitorTask &operator=(const AliEmcalFastOrMonitorTask &);
 
-  ClassDef(AliEmcalFastOrMonitorTask, 1);
+  ClassDef(AliEmcalFastOrMonitorTask, 2);
 };
 
 } /* namespace EMCAL */
@@ -12,6 +12,7 @@
 #include "AliESDtrack.h"
 #include "AliESDtrackCuts.h"
 #include "AliEmcalPicoTrackMaker.h"
+#include "AliEmcalTrackView.h"
 #include "AliLog.h"
 #include "AliPicoTrack.h"
 #include "AliVTrack.h"
@@ -34,10 +35,12 @@ AliEmcalPicoTrackMaker::AliEmcalPicoTrackMaker() :
   fMaxTrackPhi(10),
   fTrackEfficiency(1),
   fCopyMCFlag(kFALSE),
+  fViewMode(kFALSE),
   fTracksIn(0),
   fTracksOut(0),
   fMCParticles(0),
   fMCParticlesMap(0),
+  fTrackView(0),
   fInit(kFALSE)
 {
   // Constructor.
@@ -60,10 +63,12 @@ AliEmcalPicoTrackMaker::AliEmcalPicoTrackMaker(const char *name) :
   fMaxTrackPhi(10),
   fTrackEfficiency(1),
   fCopyMCFlag(kFALSE),
+  fViewMode(kFALSE),
   fTracksIn(0),
   fTracksOut(0),
   fMCParticles(0),
   fMCParticlesMap(0),
+  fTrackView(0),
   fInit(kFALSE)
 {
   // Constructor.
@@ -101,18 +106,25 @@ void AliEmcalPicoTrackMaker::UserExec(Option_t *)
       return;
     }
     
-    fTracksOut = new TClonesArray("AliPicoTrack");
-    fTracksOut->SetName(fTracksOutName);    
-
     // add tracks to event if not yet there
     if (InputEvent()->FindListObject(fTracksOutName)) {
       AliFatal(Form("Object %s already present in the event!",fTracksOutName.Data()));
     }
+    else if (fViewMode) {
+      // tracks stay in the input array, only the selection and the EMCal coordinates are published
+      fTrackView = new AliEmcalTrackView(fTracksOutName);
+      InputEvent()->AddObject(fTrackView);
+    }
     else {
+      fTracksOut = new TClonesArray("AliPicoTrack");
+      fTracksOut->SetName(fTracksOutName);
       InputEvent()->AddObject(fTracksOut);
     }
 
-    if (fCopyMCFlag) {
+    if (fCopyMCFlag && fViewMode) {
+      AliWarning("MC flags are not stored in the track view");
+    }
+    else if (fCopyMCFlag) {
       fMCParticles = dynamic_cast<TClonesArray*>(InputEvent()->FindListObject(fMCParticlesName));
       if (!fMCParticles) {
 	AliError(Form("Could not retrieve MC particles %s!", fMCParticlesName.Data())); 
@@ -130,7 +142,8 @@ void AliEmcalPicoTrackMaker::UserExec(Option_t *)
     fInit = kTRUE;
   }
 
-  fTracksOut->Delete();
+  if (fTrackView) fTrackView->Reset(fTracksIn);
+  else fTracksOut->Delete();
 
   // loop over tracks
   const Int_t Ntracks = fTracksIn->GetEntriesFast();
@@ -160,6 +173,13 @@ void AliEmcalPicoTrackMaker::UserExec(Option_t *)
 	track->GetTrackPhiOnEMCal() < 190 * TMath::DegToRad())
       isEmc = kTRUE;
 
+    if (fTrackView) {
+      fTrackView->AddTrack(iTracks, track->GetTrackEtaOnEMCal(), track->GetTrackPhiOnEMCal(), track->GetTrackPtOnEMCal(),
+                           isEmc, AliPicoTrack::GetTrackType(track), track->GetLabel());
+      ++nacc;
+      continue;
+    }
+
     AliPicoTrack *picotrack = new ((*fTracksOut)[nacc]) AliPicoTrack(track->Pt(), 
 								     track->Eta(), 
 								     track->Phi(), 
@@ -4,6 +4,7 @@
 class TClonesArray;
 class AliVParticle;
 class AliNamedArrayI;
+class AliEmcalTrackView;
 
 #include "AliAnalysisTaskSE.h"
 
@@ -21,6 +22,7 @@ class AliEmcalPicoTrackMaker : public AliAnalysisTaskSE {
   void               SetTracksOutName(const char *name)                { fTracksOutName     = name; }
   void               SetMCParticlesName(const char *name)              { fMCParticlesName   = name; }
   void               SetCopyMCFlag(Bool_t c, const char* name)         { fCopyMCFlag        = c   ; fMCParticlesName  = name; }
+  void               SetViewMode(Bool_t b)                             { fViewMode          = b   ; }
   
 
  protected:
@@ -41,16 +43,18 @@ class AliEmcalPicoTrackMaker : public AliAnalysisTaskSE {
   Double_t           fMaxTrackPhi;          // cut on track phi
   Double_t           fTrackEfficiency;      // track efficiency
   Bool_t             fCopyMCFlag;           // copy MC flag
+  Bool_t             fViewMode;             // publish an AliEmcalTrackView on the input tracks instead of pico track copies
   TClonesArray      *fTracksIn;             //!track array in
   TClonesArray      *fTracksOut;            //!track array out
   TClonesArray      *fMCParticles;          //!MC particle array
   AliNamedArrayI    *fMCParticlesMap;       //!MC particle map
+  AliEmcalTrackView *fTrackView;            //!track view out (view mode)
   Bool_t             fInit;                 //!true = task initialized
 
  private:
   AliEmcalPicoTrackMaker(const AliEmcalPicoTrackMaker&);            // not implemented
   AliEmcalPicoTrackMaker &operator=(const AliEmcalPicoTrackMaker&); // not implemented
 
-  ClassDef(AliEmcalPicoTrackMaker, 8); // Task to make PicoTracks in AOD/ESD events
+  ClassDef(AliEmcalPicoTrackMaker, 9); // Task to make PicoTracks in AOD/ESD events
 };
 #endif
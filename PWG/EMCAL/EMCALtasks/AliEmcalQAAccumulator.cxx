@@ -0,0 +1,101 @@
+/**************************************************************************************
+ * Copyright (C) 2021, Copyright Holders of the ALICE Collaboration                   *
+ * All rights reserved.                                                               *
+ *                                                                                    *
+ * Redistribution and use in source and binary forms, with or without                 *
+ * modification, are permitted provided that the following conditions are met:        *
+ *     * Redistributions of source code must retain the above copyright               *
+ *       notice, this list of conditions and the following disclaimer.                *
+ *     * Redistributions in binary form must reproduce the above copyright            *
+ *       notice, this list of conditions and the following disclaimer in the          *
+ *       documentation and/or other materials provided with the distribution.         *
+ *     * Neither the name of the <organization> nor the                               *
+ *       names of its contributors may be used to endorse or promote products         *
+ *       derived from this software without specific prior written permission.        *
+ *                                                                                    *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND    *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED      *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE             *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY                *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES         *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;       *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND        *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT         *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS      *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                       *
+ **************************************************************************************/
+#include <TArrayD.h>
+#include <TH1.h>
+
+#include "AliEmcalQAAccumulator.h"
+
+/// \cond CLASSIMP
+ClassImp(PWG::EMCAL::AliEmcalQAAccumulator);
+/// \endcond
+
+using namespace PWG::EMCAL;
+
+AliEmcalQAAccumulator::AliEmcalQAAccumulator():
+  fHist(nullptr),
+  fXaxis(nullptr),
+  fYaxis(nullptr),
+  fNbinsX(0),
+  fContent(nullptr),
+  fSumw2(nullptr),
+  fEntries(0)
+{
+
+}
+
+AliEmcalQAAccumulator::AliEmcalQAAccumulator(TObject *hist):
+  fHist(dynamic_cast<TH1 *>(hist)),
+  fXaxis(nullptr),
+  fYaxis(nullptr),
+  fNbinsX(0),
+  fContent(nullptr),
+  fSumw2(nullptr),
+  fEntries(0)
+{
+  if(!fHist) return;
+  // Direct access only for fixed-size double precision 1D and 2D histograms
+  TArrayD *content = dynamic_cast<TArrayD *>(fHist);
+  if(!content || fHist->GetDimension() > 2 || fHist->CanExtendAllAxes()) return;
+  fContent = content->GetArray();
+  fSumw2 = fHist->GetSumw2N() ? fHist->GetSumw2()->GetArray() : nullptr;
+  fXaxis = fHist->GetXaxis();
+  fYaxis = fHist->GetYaxis();
+  fNbinsX = fXaxis->GetNbins() + 2;
+}
+
+void AliEmcalQAAccumulator::Add(Int_t bin, Double_t x, Double_t y, Double_t weight) {
+  if(!fHist) return;
+  if(!fContent) {
+    if(fHist->GetDimension() == 1) fHist->Fill(x, weight);
+    else fHist->Fill(x, y, weight);
+    return;
+  }
+  fContent[bin] += weight;
+  if(fSumw2) fSumw2[bin] += weight * weight;
+  fEntries++;
+}
+
+void AliEmcalQAAccumulator::AddToBin(Int_t bin, Double_t content, Double_t sumw2, ULong64_t entries) {
+  if(!fHist || !entries) return;
+  if(!fContent) {
+    fHist->AddBinContent(bin, content);
+    if(fHist->GetSumw2N()) fHist->GetSumw2()->GetArray()[bin] += sumw2;
+    fHist->SetEntries(fHist->GetEntries() + entries);
+    return;
+  }
+  fContent[bin] += content;
+  if(fSumw2) fSumw2[bin] += sumw2;
+  fEntries += entries;
+}
+
+void AliEmcalQAAccumulator::Flush() {
+  if(!fHist || !fContent || !fEntries) return;
+  Double_t entries = fHist->GetEntries() + fEntries;
+  fHist->ResetStats();
+  fHist->SetEntries(entries);
+  fEntries = 0;
+}
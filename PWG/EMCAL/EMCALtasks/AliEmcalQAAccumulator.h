@@ -0,0 +1,131 @@
+/**************************************************************************************
+ * Copyright (C) 2021, Copyright Holders of the ALICE Collaboration                   *
+ * All rights reserved.                                                               *
+ *                                                                                    *
+ * Redistribution and use in source and binary forms, with or without                 *
+ * modification, are permitted provided that the following conditions are met:        *
+ *     * Redistributions of source code must retain the above copyright               *
+ *       notice, this list of conditions and the following disclaimer.                *
+ *     * Redistributions in binary form must reproduce the above copyright            *
+ *       notice, this list of conditions and the following disclaimer in the          *
+ *       documentation and/or other materials provided with the distribution.         *
+ *     * Neither the name of the <organization> nor the                               *
+ *       names of its contributors may be used to endorse or promote products         *
+ *       derived from this software without specific prior written permission.        *
+ *                                                                                    *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND    *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED      *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE             *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY                *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES         *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;       *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND        *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT         *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS      *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                       *
+ **************************************************************************************/
+#ifndef ALIEMCALQAACCUMULATOR_H
+#define ALIEMCALQAACCUMULATOR_H
+
+#include <Rtypes.h>
+#include <TAxis.h>
+
+class TH1;
+class TObject;
+
+namespace PWG {
+
+namespace EMCAL {
+
+/**
+ * @class AliEmcalQAAccumulator
+ * @brief Deferred filling of a QA histogram with many small fills
+ * @ingroup EMCALFWTASKS
+ *
+ * The QA tasks fill per-channel histograms (channel ID vs. amplitude or
+ * time) once for each hit. The accumulator adds the hits directly to the
+ * flat bin array of the histogram ([channel][bin] for histograms with the
+ * channel on the y-axis) and keeps only the number of fills; the number of
+ * entries and the statistics of the histogram are updated in Flush(), which
+ * the task calls at the end of the job (FinishTaskOutput). Histograms which
+ * do not use double precision contents are filled normally.
+ *
+ * ~~~{.cxx}
+ * AliEmcalQAAccumulator cellTime(fHistManager->FindObject("cellTime"));
+ * cellTime.Fill2D(celltime, cellID);  // for each cell
+ * cellTime.Flush();                 // in FinishTaskOutput
+ * ~~~
+ */
+class AliEmcalQAAccumulator {
+public:
+
+  /**
+   * @brief Dummy constructor, without histogram
+   */
+  AliEmcalQAAccumulator();
+
+  /**
+   * @brief Constructor
+   * @param[in] hist Histogram to be filled (1D or 2D)
+   */
+  AliEmcalQAAccumulator(TObject *hist);
+
+  /**
+   * @brief Destructor
+   */
+  ~AliEmcalQAAccumulator() {}
+
+  /**
+   * @brief Fill a 1D histogram
+   * @param[in] x Value
+   * @param[in] weight Weight
+   */
+  void Fill1D(Double_t x, Double_t weight = 1.) { Add(fXaxis ? fXaxis->FindFixBin(x) : 0, x, 0., weight); }
+
+  /**
+   * @brief Fill a 2D histogram
+   * @param[in] x Value on the x-axis
+   * @param[in] y Value on the y-axis
+   * @param[in] weight Weight
+   */
+  void Fill2D(Double_t x, Double_t y, Double_t weight = 1.) { Add(fXaxis ? fXaxis->FindFixBin(x) + fNbinsX * fYaxis->FindFixBin(y) : 0, x, y, weight); }
+
+  /**
+   * @brief Add the counts per bin to a bin of the histogram, i.e. from a
+   * per-channel accumulator
+   * @param[in] bin Global bin of the histogram
+   * @param[in] content Sum of the weights
+   * @param[in] sumw2 Sum of the squared weights
+   * @param[in] entries Number of fills
+   */
+  void AddToBin(Int_t bin, Double_t content, Double_t sumw2, ULong64_t entries);
+
+  /**
+   * @brief Update the number of entries and the statistics of the histogram
+   */
+  void Flush();
+
+  TH1 *GetHistogram() const { return fHist; }
+  ULong64_t GetNPendingEntries() const { return fEntries; }
+
+private:
+  void Add(Int_t bin, Double_t x, Double_t y, Double_t weight);
+
+  TH1                        *fHist;          //!<! Histogram filled
+  const TAxis                *fXaxis;         //!<! x-axis of the histogram, null if the histogram is filled normally
+  const TAxis                *fYaxis;         //!<! y-axis of the histogram
+  Int_t                       fNbinsX;        //!<! Number of bins on the x-axis, including under- and overflow
+  Double_t                   *fContent;       //!<! Bin contents of the histogram
+  Double_t                   *fSumw2;         //!<! Sum of the squared weights, null if not stored
+  ULong64_t                   fEntries;       //!<! Number of fills not yet added to the entries of the histogram
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalQAAccumulator, 1);
+  /// \endcond
+};
+
+}
+
+}
+
+#endif /* ALIEMCALQAACCUMULATOR_H */
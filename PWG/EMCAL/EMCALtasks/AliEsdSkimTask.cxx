@@ -32,7 +32,7 @@ AliEsdSkimTask::AliEsdSkimTask(const char *opt) :
   fDoV0s(1), fDoCascades(0), fDoKinks(0), fDoErrorLogs(1),  fEmcNames(""), 
   fDoMiniTracks(0), fTracks("Tracks"), fPhosClusOnly(0), fEmcalClusOnly(0),
   fDoSaveBytes(0), fDoCent(1), fDoRP(1), fRemoveCP(0), fResetCov(0), fDoAllTracks(1),
-  fDoPicoTracks(0), fCheckCond(0)
+  fDoPicoTracks(0), fCheckCond(0), fDoDirectCopy(0), fDirectObjs()
 {
   // Constructor.
 
@@ -116,7 +116,8 @@ void AliEsdSkimTask::UserExec(Option_t */*opt*/)
   AliESDRun *run = dynamic_cast<AliESDRun*>(objsout->FindObject("AliESDRun"));
   if (run) {
     am->LoadBranch("AliESDRun.");
-    *run = *esdin->GetESDRun();
+    if (!DirectCopy(esdin->GetESDRun(), run))
+      *run = *esdin->GetESDRun();
   }
   AliCentrality *cent = dynamic_cast<AliCentrality*>(objsout->FindObject("Centrality"));
   if (cent) {
@@ -152,70 +153,80 @@ void AliEsdSkimTask::UserExec(Option_t */*opt*/)
     AliESDZDC *zdc = dynamic_cast<AliESDZDC*>(objsout->FindObject("AliESDZDC"));
     if (zdc) {
       am->LoadBranch("AliESDZDC.");
-      *zdc = *esdin->GetESDZDC();
+      if (!DirectCopy(esdin->GetESDZDC(), zdc))
+        *zdc = *esdin->GetESDZDC();
     }
   }
   if (fDoV0) {
     AliESDVZERO *v0 = dynamic_cast<AliESDVZERO*>(objsout->FindObject("AliESDVZERO"));
     if (v0) {
       am->LoadBranch("AliESDVZERO.");
-      *v0 = *esdin->GetVZEROData();
+      if (!DirectCopy(esdin->GetVZEROData(), v0))
+        *v0 = *esdin->GetVZEROData();
     }
   }
   if (fDoT0) {
     AliESDTZERO *t0 = dynamic_cast<AliESDTZERO*>(objsout->FindObject("AliESDTZERO"));
     if (t0) {
       am->LoadBranch("AliESDTZERO.");
-      *t0 = *esdin->GetESDTZERO();
+      if (!DirectCopy(esdin->GetESDTZERO(), t0))
+        *t0 = *esdin->GetESDTZERO();
     }
   }
   if (fDoTPCv) {
     AliESDVertex *tpcv = dynamic_cast<AliESDVertex*>(objsout->FindObject("TPCVertex"));
     if (tpcv) {
       am->LoadBranch("TPCVertex.");
-      *tpcv = *esdin->GetPrimaryVertexTPC();
+      if (!DirectCopy(esdin->GetPrimaryVertexTPC(), tpcv))
+        *tpcv = *esdin->GetPrimaryVertexTPC();
     }
   }
   if (fDoSPDv) {
     AliESDVertex *spdv = dynamic_cast<AliESDVertex*>(objsout->FindObject("SPDVertex"));
     if (spdv) {
       am->LoadBranch("SPDVertex.");
-      *spdv = *esdin->GetPrimaryVertexSPD();
+      if (!DirectCopy(esdin->GetPrimaryVertexSPD(), spdv))
+        *spdv = *esdin->GetPrimaryVertexSPD();
     }
   }
   if (fDoPriv) {
     AliESDVertex *priv = dynamic_cast<AliESDVertex*>(objsout->FindObject("PrimaryVertex"));
     if (priv) {
       am->LoadBranch("PrimaryVertex.");
-      *priv = *esdin->GetPrimaryVertexTracks();
+      if (!DirectCopy(esdin->GetPrimaryVertexTracks(), priv))
+        *priv = *esdin->GetPrimaryVertexTracks();
     }
   }
   if (fDoEmCs) {
     AliESDCaloCells *ecells = dynamic_cast<AliESDCaloCells*>(objsout->FindObject("EMCALCells"));
     if (ecells) {
       am->LoadBranch("EMCALCells.");
-      *ecells = *esdin->GetEMCALCells();
+      if (!DirectCopy(esdin->GetEMCALCells(), ecells))
+        *ecells = *esdin->GetEMCALCells();
     }
   }
   if (fDoPCs) {
     AliESDCaloCells *pcells = dynamic_cast<AliESDCaloCells*>(objsout->FindObject("PHOSCells"));
     if (pcells) {
       am->LoadBranch("PHOSCells.");
-      *pcells = *esdin->GetPHOSCells();
+      if (!DirectCopy(esdin->GetPHOSCells(), pcells))
+        *pcells = *esdin->GetPHOSCells();
     }
   }
   if (fDoEmT) {
     AliESDCaloTrigger *etrig = dynamic_cast<AliESDCaloTrigger*>(objsout->FindObject("EMCALTrigger"));
     if (etrig) {
       am->LoadBranch("EMCALTrigger.");
-      *etrig = *esdin->GetCaloTrigger("EMCAL");
+      if (!DirectCopy(esdin->GetCaloTrigger("EMCAL"), etrig))
+        *etrig = *esdin->GetCaloTrigger("EMCAL");
     }
   }
   if (fDoPT) {
     AliESDCaloTrigger *ptrig = dynamic_cast<AliESDCaloTrigger*>(objsout->FindObject("PHOSTrigger"));
     if (ptrig) {
       am->LoadBranch("PHOSTrigger.");
-      *ptrig = *esdin->GetCaloTrigger("PHOS");
+      if (!DirectCopy(esdin->GetCaloTrigger("PHOS"), ptrig))
+        *ptrig = *esdin->GetCaloTrigger("PHOS");
     }
   }
   if (fDoFmd) {
@@ -223,7 +234,8 @@ void AliEsdSkimTask::UserExec(Option_t */*opt*/)
     if (fmd) {
       am->LoadBranch("AliESDFMD.");
       if (!fDoSaveBytes) {
-        *fmd = *esdin->GetFMDData();
+        if (!DirectCopy(esdin->GetFMDData(), fmd))
+          *fmd = *esdin->GetFMDData();
       }
     }
   }
@@ -232,7 +244,8 @@ void AliEsdSkimTask::UserExec(Option_t */*opt*/)
     if (mult) {
       am->LoadBranch("AliMultiplicity.");
       if (!fDoSaveBytes) {
-        *mult = *esdin->GetMultiplicity();
+        if (!DirectCopy(esdin->GetMultiplicity(), mult))
+          *mult = *esdin->GetMultiplicity();
       } else {
         const AliMultiplicity *multin = esdin->GetMultiplicity();;
         mult->SetFiredChips(0, multin->GetNumberOfFiredChips(0));
@@ -246,7 +259,8 @@ void AliEsdSkimTask::UserExec(Option_t */*opt*/)
     AliTOFHeader *tofh = dynamic_cast<AliTOFHeader*>(objsout->FindObject("AliTOFHeader"));
     if (tofh) {
       am->LoadBranch("AliTOFHeader.");
-      *tofh = *esdin->GetTOFHeader();
+      if (!DirectCopy(esdin->GetTOFHeader(), tofh))
+        *tofh = *esdin->GetTOFHeader();
     }
   }
   if (fDoPileup) {
@@ -408,31 +422,63 @@ void AliEsdSkimTask::UserExec(Option_t */*opt*/)
   if (fDoV0s) {
     TClonesArray *out = dynamic_cast<TClonesArray*>(objsout->FindObject("V0s"));
     TClonesArray *in  = dynamic_cast<TClonesArray*>(objsin->FindObject("V0s"));
-    if (out)
-      out->AbsorbObjects(in);
+    if (out) {
+      am->LoadBranch("V0s");
+      if (!DirectCopy(in, out))
+        out->AbsorbObjects(in);
+    }
   }
   if (fDoCascades) {
     TClonesArray *out = dynamic_cast<TClonesArray*>(objsout->FindObject("Cascades"));
     TClonesArray *in  = dynamic_cast<TClonesArray*>(objsin->FindObject("Cascades"));
-    if (out)
-      out->AbsorbObjects(in);
+    if (out) {
+      am->LoadBranch("Cascades");
+      if (!DirectCopy(in, out))
+        out->AbsorbObjects(in);
+    }
   }
   if (fDoKinks) {
     TClonesArray *out = dynamic_cast<TClonesArray*>(objsout->FindObject("Kinks"));
     TClonesArray *in  = dynamic_cast<TClonesArray*>(objsin->FindObject("Kinks"));
-    if (out)
-      out->AbsorbObjects(in);
+    if (out) {
+      am->LoadBranch("Kinks");
+      if (!DirectCopy(in, out))
+        out->AbsorbObjects(in);
+    }
   }
   if (fDoErrorLogs) {
     TClonesArray *out = dynamic_cast<TClonesArray*>(objsout->FindObject("AliRawDataErrorLogs"));
     TClonesArray *in  = dynamic_cast<TClonesArray*>(objsin->FindObject("AliRawDataErrorLogs"));
-    if (out)
-      out->AbsorbObjects(in);
+    if (out) {
+      am->LoadBranch("AliRawDataErrorLogs");
+      if (!DirectCopy(in, out))
+        out->AbsorbObjects(in);
+    }
   }
 
   fTree->Fill();
 }
 
+//_________________________________________________________________________________________________
+Bool_t AliEsdSkimTask::DirectCopy(const TObject *in, const TObject *out)
+{
+  // Let the output branch of out point to the input object, which is then written as is.
+
+  if (!fDoDirectCopy || !in || !out)
+    return kFALSE;
+  TBranch *br = fTree->GetBranch(Form("%s.", out->GetName()));
+  if (!br)
+    br = fTree->GetBranch(out->GetName());
+  if (!br)
+    return kFALSE;
+  TObject *&obj = fDirectObjs[br];
+  if (obj!=in) {
+    obj = const_cast<TObject*>(in);
+    br->SetAddress(&obj);
+  }
+  return kTRUE;
+}
+
 //_________________________________________________________________________________________________
 void AliEsdSkimTask::UserCreateOutputObjects() 
 {
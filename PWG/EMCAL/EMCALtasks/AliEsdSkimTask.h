@@ -5,7 +5,9 @@
 
 #include "AliPhysicsSelectionTask.h"
 #include "AliESDtrack.h"
+#include <map>
 
+class TBranch;
 class TTree;
 class AliESDEvent;
 class AliESDtrackCuts;
@@ -51,6 +53,7 @@ class AliEsdSkimTask : public AliAnalysisTaskSE {
   void SetDoCascades(Bool_t b)     { fDoCascades    = b; }
   void SetDoKinks(Bool_t b)        { fDoKinks       = b; }
   void SetDoErrorLogs(Bool_t b)    { fDoErrorLogs   = b; }
+  void SetDirectCopy(Bool_t b)     { fDoDirectCopy  = b; }
 
  protected:
   AliESDEvent     *fEvent;        //!esd event
@@ -90,11 +93,15 @@ class AliEsdSkimTask : public AliAnalysisTaskSE {
   Bool_t           fDoAllTracks;  // if true then keep full tracks
   Bool_t           fDoPicoTracks; // if true then do pico tracks
   Int_t            fCheckCond;    // if !=0 check certain conditions before event is accepted
+  Bool_t           fDoDirectCopy; // if true write unmodified branches directly from the input objects
+  std::map<TBranch*,TObject*> fDirectObjs; //!input objects the output branches point to
+
+  Bool_t           DirectCopy(const TObject *in, const TObject *out);
 
  private:
   AliEsdSkimTask(const AliEsdSkimTask&);            // not implemented
   AliEsdSkimTask &operator=(const AliEsdSkimTask&); // not implemented
 
- ClassDef(AliEsdSkimTask, 6); // Esd trimming and skimming task
+ ClassDef(AliEsdSkimTask, 7); // Esd trimming and skimming task
 };
 #endif
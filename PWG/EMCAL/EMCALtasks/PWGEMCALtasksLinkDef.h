@@ -63,6 +63,7 @@
 #pragma link C++ class PWG::EMCAL::AliEmcalTriggerRejectionMaker+;
 #pragma link C++ class PWG::EMCAL::AliEmcalCellMonitorTask+;
 #pragma link C++ class PWG::EMCAL::AliEmcalFastOrMonitorTask+;
+#pragma link C++ class PWG::EMCAL::AliEmcalQAAccumulator+;
 #pragma link C++ class PWG::EMCAL::AliAnalysisTaskEmcalTriggerSelection+;
 #pragma link C++ class PWG::EMCAL::AliAnalysisTaskEmcalTriggerNormalization+;
 #pragma link C++ class PWG::EMCAL::AliEmcalMCPartonInfoCreator+;
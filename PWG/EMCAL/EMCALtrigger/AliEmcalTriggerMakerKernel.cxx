@@ -24,6 +24,7 @@
  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS      *
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                       *
  **************************************************************************************/
+#include <algorithm>
 #include <iostream>
 #include <vector>
 #include <cstring>
@@ -93,6 +94,8 @@ AliEmcalTriggerMakerKernel::AliEmcalTriggerMakerKernel():
   fPatchEnergySimpleSmeared(nullptr),
   fLevel0TimeMap(nullptr),
   fTriggerBitMap(nullptr),
+  fSmearedEnergySums(),
+  fNRowsSmearedEnergySums(0),
   fADCtoGeV(1.)
 {
   memset(fThresholdConstants, 0, sizeof(Int_t) * 12);
@@ -140,6 +143,8 @@ void AliEmcalTriggerMakerKernel::Init(){
     // Allocate container for energy smearing (if enabled)
     fPatchEnergySimpleSmeared = new AliEMCALTriggerDataGrid<double>;
     fPatchEnergySimpleSmeared->Allocate(48, nrows);
+    fNRowsSmearedEnergySums = nrows;
+    fSmearedEnergySums.resize((kColsEta + 1) * (nrows + 1));
   }
 }
 
@@ -579,6 +584,9 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
   bkgPatchMask = 1 << fTriggerBitConfig->GetBkgBit();
       //l0PatchMask = 1 << fTriggerBitConfig->GetLevel0Bit();
 
+  // Patch sums of the smeared energy are taken from the summed-area table
+  if (fPatchEnergySimpleSmeared) BuildSmearedEnergySums();
+
   std::vector<AliEMCALTriggerRawPatch> patches;
   if (fPatchFinder) {
     if (useL0amp) {
@@ -628,12 +636,7 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
     fullpatch.SetOffSet(offset);
     if(fPatchEnergySimpleSmeared){
       // Add smeared energy
-      double energysmear = 0;
-      for(int icol = 0; icol < fullpatch.GetPatchSize(); icol++){
-        for(int irow = 0; irow < fullpatch.GetPatchSize(); irow++){
-          energysmear += (*fPatchEnergySimpleSmeared)(fullpatch.GetColStart() + icol, fullpatch.GetRowStart() + irow);
-        }
-      }
+      double energysmear = GetSmearedPatchEnergy(fullpatch.GetColStart(), fullpatch.GetRowStart(), fullpatch.GetPatchSize());
       AliDebugStream(1) << "Patch size(" << fullpatch.GetPatchSize() <<") energy " << fullpatch.GetPatchE() << " smeared " << energysmear << std::endl;
       fullpatch.SetSmearedEnergy(energysmear);
     }
@@ -659,19 +662,36 @@ void AliEmcalTriggerMakerKernel::CreateTriggerPatches(const AliVEvent *inputeven
     fullpatch.SetTriggerBitConfig(fTriggerBitConfig);
     if(fPatchEnergySimpleSmeared){
       // Add smeared energy
-      double energysmear = 0;
-      for(int icol = 0; icol < fullpatch.GetPatchSize(); icol++){
-        for(int irow = 0; irow < fullpatch.GetPatchSize(); irow++){
-          energysmear += (*fPatchEnergySimpleSmeared)(fullpatch.GetColStart() + icol, fullpatch.GetRowStart() + irow);
-        }
-      }
-      fullpatch.SetSmearedEnergy(energysmear);
+      fullpatch.SetSmearedEnergy(GetSmearedPatchEnergy(fullpatch.GetColStart(), fullpatch.GetRowStart(), fullpatch.GetPatchSize()));
     }
     outputcont.push_back(fullpatch);
   }
   // std::cout << "Finished finding trigger patches" << std::endl;
 }
 
+void AliEmcalTriggerMakerKernel::BuildSmearedEnergySums(){
+  // One pass over the grid: row-major table with (kColsEta + 1) entries per row,
+  // first row and column are 0
+  const int stride = kColsEta + 1;
+  for(int icol = 0; icol < stride; icol++) fSmearedEnergySums[icol] = 0.;
+  for(int irow = 0; irow < fNRowsSmearedEnergySums; irow++){
+    double rowsum = 0.;
+    fSmearedEnergySums[(irow + 1) * stride] = 0.;
+    for(int icol = 0; icol < kColsEta; icol++){
+      rowsum += (*fPatchEnergySimpleSmeared)(icol, irow);
+      fSmearedEnergySums[(irow + 1) * stride + icol + 1] = fSmearedEnergySums[irow * stride + icol + 1] + rowsum;
+    }
+  }
+}
+
+double AliEmcalTriggerMakerKernel::GetSmearedPatchEnergy(Int_t col, Int_t row, Int_t size) const {
+  const int stride = kColsEta + 1;
+  int colmax = std::min(col + size, static_cast<Int_t>(kColsEta)), rowmax = std::min(row + size, fNRowsSmearedEnergySums);
+  if(col < 0 || row < 0 || colmax <= col || rowmax <= row) return 0.;
+  return fSmearedEnergySums[rowmax * stride + colmax] - fSmearedEnergySums[row * stride + colmax]
+       - fSmearedEnergySums[rowmax * stride + col] + fSmearedEnergySums[row * stride + col];
+}
+
 double AliEmcalTriggerMakerKernel::GetL0TriggerChannelAmplitude(Int_t col, Int_t row) const{
   double amp = 0;
   try {
@@ -572,6 +572,24 @@ protected:
    */
   bool HasPHOSOverlap(const AliEMCALTriggerRawPatch &patch) const;
 
+  /**
+   * @brief Build the summed-area table of the smeared energy grid
+   *
+   * Entry (col, row) of the table contains the sum of all channels with
+   * column < col and row < row, so that the sum of any patch is obtained
+   * from four entries, independent of the patch size.
+   */
+  void BuildSmearedEnergySums();
+
+  /**
+   * @brief Get the smeared energy of a patch from the summed-area table
+   * @param[in] col Starting column of the patch
+   * @param[in] row Starting row of the patch
+   * @param[in] size Size of the patch (in FastORs)
+   * @return Sum of the smeared energies in the patch
+   */
+  double GetSmearedPatchEnergy(Int_t col, Int_t row, Int_t size) const;
+
   std::set<Short_t>                         fBadChannels;                 ///< Container of bad channels
   std::set<Short_t>                         fOfflineBadChannels;          ///< Abd ID of offline bad channels
   TArrayF                                   fFastORPedestal;              ///< FastOR pedestal
@@ -617,10 +635,12 @@ protected:
   AliEMCALTriggerDataGrid<char>             *fLevel0TimeMap;              //!<! Map needed to store the level0 times
   AliEMCALTriggerDataGrid<int>              *fTriggerBitMap;              //!<! Map of trigger bits
   Double_t                                  fRhoValues[kNIndRho];         //!<! Rho values for background subtraction (only online ADC)
+  std::vector<double>                       fSmearedEnergySums;           //!<! Summed-area table of the smeared energy grid
+  Int_t                                     fNRowsSmearedEnergySums;      //!<! Number of rows of the smeared energy grid
 
   Double_t                                  fADCtoGeV;                    //!<! Conversion factor from ADC to GeV
 
-  ClassDef(AliEmcalTriggerMakerKernel, 4);
+  ClassDef(AliEmcalTriggerMakerKernel, 5);
 };
 
 #endif
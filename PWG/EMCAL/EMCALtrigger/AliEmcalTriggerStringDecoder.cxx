@@ -25,6 +25,7 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
  ************************************************************************************/
 #include <sstream>
+#include "AliEmcalFiredTriggerClasses.h"
 #include "AliEmcalTriggerStringDecoder.h"
 
 ClassImp(PWG::EMCAL::Triggerinfo);
@@ -54,3 +55,16 @@ std::vector<Triggerinfo> Triggerinfo::DecodeTriggerString(EMCAL_STRINGVIEW trigg
   }
   return result;
 }
+
+const std::vector<Triggerinfo> &Triggerinfo::FiredTriggerClasses(const AliVEvent *event) {
+  static std::vector<Triggerinfo> result;
+  static ULong64_t generation = 0;
+  auto fired = AliEmcalFiredTriggerClasses::Instance();
+  fired->Update(event);
+  if(fired->GetGeneration() != generation) {
+    result.clear();
+    for(const auto &c : fired->GetClasses()) result.emplace_back(Triggerinfo{c.fTriggerClass, c.fBunchCrossing, c.fPastFutureProtection, c.fTriggerCluster});
+    generation = fired->GetGeneration();
+  }
+  return result;
+}
@@ -31,6 +31,8 @@
 #include <TObject.h>
 #include "AliEmcalStringView.h"
 
+class AliVEvent;
+
 namespace PWG {
 
 namespace EMCAL {
@@ -89,6 +91,20 @@ public:
    * @return std::vector<Triggerinfo> Trigger info objects for all trigger classes found in the trigger string
    */
   static std::vector<PWG::EMCAL::Triggerinfo> DecodeTriggerString(EMCAL_STRINGVIEW triggerstring);
+
+  /**
+   * @brief Trigger info objects of the fired trigger classes of an event
+   * 
+   * The trigger string of the event is decoded once per event by the shared
+   * AliEmcalFiredTriggerClasses handler, and all callers get the same vector
+   * until the fired trigger classes change. The entries have the same order as
+   * in AliEmcalFiredTriggerClasses, so the downscale factor of entry i is
+   * AliEmcalFiredTriggerClasses::Instance()->GetDownscaleFactor(i).
+   * 
+   * @param event Input event
+   * @return const std::vector<Triggerinfo>& Trigger info objects for all fired trigger classes
+   */
+  static const std::vector<PWG::EMCAL::Triggerinfo> &FiredTriggerClasses(const AliVEvent *event);
 private:
   std::string fTriggerClass;              ///< Trigger class
   std::string fBunchCrossing;             ///< Bunch crossing type
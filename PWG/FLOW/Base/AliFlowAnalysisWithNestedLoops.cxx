@@ -27,6 +27,10 @@
 
 #define AliFlowAnalysisWithNestedLoops_cxx
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
 #include "Riostream.h"
 #include "AliFlowCommonConstants.h"
 #include "AliFlowCommonHist.h"
@@ -48,6 +52,27 @@ using std::endl;
 using std::cout;
 ClassImp(AliFlowAnalysisWithNestedLoops)
 
+namespace {
+ // Split the outer index range [0,nOuter) into nThreads contiguous chunks and process chunk t with
+ // func(first,last,t). Chunk 0 runs in the calling thread; with one thread (or a tiny range) it is just a plain call.
+ template<typename Func> void RunOverOuterIndex(Int_t nThreads, Int_t nOuter, Func &func)
+ {
+  if(nThreads <= 1 || nOuter < 2*nThreads)
+  {
+   func(0,nOuter,0);
+   return;
+  }
+  std::vector<std::thread> workers;
+  workers.reserve(nThreads-1);
+  for(Int_t t=1;t<nThreads;t++)
+  {
+   workers.emplace_back(func,(Int_t)((Long64_t)nOuter*t/nThreads),(Int_t)((Long64_t)nOuter*(t+1)/nThreads),t);
+  }
+  func(0,nOuter/nThreads,0);
+  for(auto &worker : workers){worker.join();}
+ }
+}
+
 //================================================================================================================
 
 AliFlowAnalysisWithNestedLoops::AliFlowAnalysisWithNestedLoops(): 
@@ -59,6 +84,7 @@ fAnalysisSettings(NULL),
 fOppositeChargesPOI(kFALSE),
 fEvaluateDifferential3pCorrelator(kFALSE), 
 fPrintOnTheScreen(kTRUE),
+fNThreads(1),
 fCommonHists(NULL),
 fnBinsPhi(0),
 fPhiMin(0),
@@ -123,6 +149,13 @@ AliFlowAnalysisWithNestedLoops::~AliFlowAnalysisWithNestedLoops()
  // Destructor.
  
  delete fHistList;
+ for(auto clone : fRADThreadClones){delete clone;}
+ for(auto clone : f3pThreadClones){delete clone;}
+ for(auto clone : f5pThreadClones){delete clone;}
+ for(Int_t sd=0;sd<2;sd++)
+ {
+  for(auto clone : f3pDiffThreadClones[sd]){delete clone;}
+ }
 
 } // end of AliFlowAnalysisWithNestedLoops::~AliFlowAnalysisWithNestedLoops()
 
@@ -780,42 +813,46 @@ void AliFlowAnalysisWithNestedLoops::BookEverythingForMH()
 void AliFlowAnalysisWithNestedLoops::EvaluateNestedLoopsForRAD(AliFlowEventSimple *anEvent)
 {
  // Evaluate nested loops needed for calculation of relative angle distribution.
+ // The outer loop is split over fNThreads threads, each filling its own clone of fRelativeAngleDistribution.
  
- Double_t dPhi1=0., dPhi2=0.; // azimuthal angles in the laboratory frame
- AliFlowTrackSimple *aftsTrack = NULL; // simple track
-  
- // Loop over data and store for each distinct pair phi1-phi2 in fRelativeAngleDistribution:
+ // Copy the azimuthal angles of RPs out of the event once:
  Int_t nPrim = anEvent->NumberOfTracks();  // nPrim = total number of primary tracks, i.e. nPrim = nRP + nPOI + rest, where:
                                            // nRP   = # of particles used to determine the reaction plane ("Reference Particles");
                                            // nPOI  = # of particles of interest for a detailed flow analysis ("Particles of Interest");
                                            // rest  = # of particles which are not niether RPs nor POIs.  
- // Start nested loops over data:
+ std::vector<Double_t> phi;
+ phi.reserve(nPrim);
  for(Int_t i=0;i<nPrim;i++) 
  { 
-  aftsTrack=anEvent->GetTrack(i);
-  if(aftsTrack)
+  AliFlowTrackSimple *aftsTrack = anEvent->GetTrack(i);
+  if(!aftsTrack)
+  {
+   cout<<endl;
+   cout<<" WARNING (NL): No particle! (i.e. aftsTrack is a NULL pointer in AFAWNL::Make().)"<<endl;
+   cout<<endl;       
+   continue;
+  }
+  if(!aftsTrack->InRPSelection()) continue; // consider only tracks which are RPs 
+  phi.push_back(aftsTrack->Phi());
+ } // end of for(Int_t i=0;i<nPrim;i++) 
+ Int_t nRP = phi.size();
+
+ // Store for each distinct pair phi1-phi2 in fRelativeAngleDistribution:
+ this->PrepareThreadClones(fRelativeAngleDistribution,fRADThreadClones);
+ auto loop = [&](Int_t first, Int_t last, Int_t slot)
+ {
+  TH1 *rad = (slot == 0 ? fRelativeAngleDistribution : fRADThreadClones[slot-1]);
+  for(Int_t i=first;i<last;i++)
   {
-   if(!aftsTrack->InRPSelection()) continue; // consider only tracks which are RPs 
-   dPhi1 = aftsTrack->Phi();
-   for(Int_t j=0;j<nPrim;j++) 
+   for(Int_t j=0;j<nRP;j++) 
    { 
     if(j==i) continue; // eliminating trivial contribution from autocorrelation
-    aftsTrack=anEvent->GetTrack(j);
-    if(aftsTrack)
-    {
-     if(!aftsTrack->InRPSelection()) continue; // consider only tracks which are RPs 
-     dPhi2 = aftsTrack->Phi();
-     // Fill the histogram:
-     fRelativeAngleDistribution->Fill(dPhi1-dPhi2);
-    }
-   } // end of for(Int_t j=0;j<nPrim;j++)
-  } else // to if(aftsTrack)
-    {
-     cout<<endl;
-     cout<<" WARNING (NL): No particle! (i.e. aftsTrack is a NULL pointer in AFAWNL::Make().)"<<endl;
-     cout<<endl;       
-    }
- } // end of for(Int_t i=0;i<nPrim;i++) 
+    rad->Fill(phi[i]-phi[j]);
+   }
+  }
+ };
+ RunOverOuterIndex(fNThreads,nRP,loop);
+ this->MergeThreadClones(fRelativeAngleDistribution,fRADThreadClones);
  
 } // end of void AliFlowAnalysisWithNestedLoops::EvaluateNestedLoopsForRAD(AliFlowEventSimple *anEvent)
 
@@ -825,120 +862,181 @@ void AliFlowAnalysisWithNestedLoops::EvaluateNestedLoopsForMH(AliFlowEventSimple
 {
  // Evaluate nested loops needed for mixed harmonics.
  // Remark: phi labels the azimuthal angle of RP particle and psi labels azimuthal angle of POI particle.
+ // The outermost loop is split over fNThreads threads with per-thread profiles, merged in thread order.
   
  Int_t nPrim = anEvent->NumberOfTracks(); 
- Int_t nRP = anEvent->GetEventNSelTracksRP(); 
- AliFlowTrackSimple *aftsTrack = NULL;
- Double_t phi1=0.,phi2=0.,phi3=0.,phi4=0.,phi5=0.; // azimuthal angles of RPs
- Double_t psi1=0.,psi2=0.; // azimuthal angles of POIs
- Int_t charge1=0,charge2=0; // charge of POIs
- Double_t pt1=0.,pt2=0.; // transverse momenta of POIs
  Int_t n = fHarmonic; 
+
+ // Copy RPs and POIs out of the event once. POIs are sorted by charge and then by pt, so that
+ // with fOppositeChargesPOI the same-charge block is skipped as a whole in the differential loop:
+ std::vector<Double_t> rpPhi;
+ std::vector<Int_t> rpIndex; // index in the event, needed to remove autocorrelations between RPs and POIs
+ std::vector<Int_t> poiOrder;
+ rpPhi.reserve(nPrim);
+ rpIndex.reserve(nPrim);
+ for(Int_t i=0;i<nPrim;i++)
+ {
+  AliFlowTrackSimple *aftsTrack = anEvent->GetTrack(i);
+  if(!aftsTrack){continue;}
+  if(aftsTrack->InRPSelection())
+  {
+   rpPhi.push_back(aftsTrack->Phi());
+   rpIndex.push_back(i);
+  }
+  if(fEvaluateDifferential3pCorrelator && aftsTrack->InPOISelection()){poiOrder.push_back(i);}
+ }
+ Int_t nRP = rpPhi.size();
  
  // Evaluting correlator cos[n(phi1+phi2-2*phi3)] with three nested loops:
  if(nRP>=3)
  {
-  for(Int_t i1=0;i1<nPrim;i1++)
+  this->PrepareThreadClones(f3pCorrelatorPro,f3pThreadClones);
+  auto loop3p = [&](Int_t first, Int_t last, Int_t slot)
   {
-   aftsTrack=anEvent->GetTrack(i1);
-   if(!(aftsTrack->InRPSelection())) continue;
-   phi1 = aftsTrack->Phi();  
-   for(Int_t i2=0;i2<nPrim;i2++)
+   TH1 *pro = (slot == 0 ? (TH1*)f3pCorrelatorPro : f3pThreadClones[slot-1]);
+   for(Int_t i1=first;i1<last;i1++)
    {
-    if(i2==i1) continue;
-    aftsTrack = anEvent->GetTrack(i2);
-    if(!(aftsTrack->InRPSelection())) continue;
-    phi2 = aftsTrack->Phi();
-    for(Int_t i3=0;i3<nPrim;i3++)
+    for(Int_t i2=0;i2<nRP;i2++)
     {
-     if(i3==i1||i3==i2) continue;
-     aftsTrack=anEvent->GetTrack(i3);
-     if(!(aftsTrack->InRPSelection())) continue;
-     phi3 = aftsTrack->Phi();
-     f3pCorrelatorPro->Fill(0.5,cos(n*(phi1+phi2-2.*phi3)),1.);
-    } // end of for(Int_t i3=0;i3<nPrim;i3++)  
-   } // end of for(Int_t i2=0;i2<nPrim;i2++)  
-  } // end of for(Int_t i1=0;i1<nPrim;i1++)
+     if(i2==i1) continue;
+     for(Int_t i3=0;i3<nRP;i3++)
+     {
+      if(i3==i1||i3==i2) continue;
+      static_cast<TProfile*>(pro)->Fill(0.5,cos(n*(rpPhi[i1]+rpPhi[i2]-2.*rpPhi[i3])),1.);
+     } // end of for(Int_t i3=0;i3<nRP;i3++)  
+    } // end of for(Int_t i2=0;i2<nRP;i2++)  
+   } // end of for(Int_t i1=first;i1<last;i1++)
+  };
+  RunOverOuterIndex(fNThreads,nRP,loop3p);
+  this->MergeThreadClones(f3pCorrelatorPro,f3pThreadClones);
  }
  
  // Evaluting correlator cos[n(2*phi1+2*phi2+2*phi3-3*phi4-3*phi5)] with five nested loops: 
  if(nRP>=5)
  {
-  for(Int_t i1=0;i1<nPrim;i1++)
+  this->PrepareThreadClones(f5pCorrelatorPro,f5pThreadClones);
+  auto loop5p = [&](Int_t first, Int_t last, Int_t slot)
   {
-   aftsTrack=anEvent->GetTrack(i1);
-   if(!(aftsTrack->InRPSelection())) continue;  
-   phi1=aftsTrack->Phi();
-   for(Int_t i2=0;i2<nPrim;i2++)
+   TH1 *pro = (slot == 0 ? (TH1*)f5pCorrelatorPro : f5pThreadClones[slot-1]);
+   for(Int_t i1=first;i1<last;i1++)
    {
-    if(i2==i1)continue;
-    aftsTrack=anEvent->GetTrack(i2);
-    if(!(aftsTrack->InRPSelection())) continue;
-    phi2=aftsTrack->Phi();
-    for(Int_t i3=0;i3<nPrim;i3++)
+    for(Int_t i2=0;i2<nRP;i2++)
     {
-     if(i3==i1||i3==i2)continue;
-     aftsTrack=anEvent->GetTrack(i3);
-     if(!(aftsTrack->InRPSelection())) continue;
-     phi3=aftsTrack->Phi();
-     for(Int_t i4=0;i4<nPrim;i4++)
+     if(i2==i1)continue;
+     for(Int_t i3=0;i3<nRP;i3++)
      {
-      if(i4==i1||i4==i2||i4==i3)continue;
-      aftsTrack=anEvent->GetTrack(i4);
-      if(!(aftsTrack->InRPSelection())) continue;
-      phi4=aftsTrack->Phi();
-      for(Int_t i5=0;i5<nPrim;i5++)
+      if(i3==i1||i3==i2)continue;
+      Double_t phi123 = 2.*n*(rpPhi[i1]+rpPhi[i2]+rpPhi[i3]);
+      for(Int_t i4=0;i4<nRP;i4++)
       {
-       if(i5==i1||i5==i2||i5==i3||i5==i4)continue;
-       aftsTrack=anEvent->GetTrack(i5);
-       if(!(aftsTrack->InRPSelection())) continue;
-       phi5=aftsTrack->Phi();
-       f5pCorrelatorPro->Fill(0.5,cos(2.*n*phi1+2.*n*phi2+2.*n*phi3-3.*n*phi4-3.*n*phi5),1.);
-      } // end of for(Int_t i5=0;i5<nPrim;i5++)
-     } // end of for(Int_t i4=0;i4<nPrim;i4++)  
-    } // end of for(Int_t i3=0;i3<nPrim;i3++)
-   } // end of for(Int_t i2=0;i2<nPrim;i2++)
-  } // end of for(Int_t i1=0;i1<nPrim;i1++)
- } // end of if(nPrim>=5) 
+       if(i4==i1||i4==i2||i4==i3)continue;
+       for(Int_t i5=0;i5<nRP;i5++)
+       {
+        if(i5==i1||i5==i2||i5==i3||i5==i4)continue;
+        static_cast<TProfile*>(pro)->Fill(0.5,cos(phi123-3.*n*rpPhi[i4]-3.*n*rpPhi[i5]),1.);
+       } // end of for(Int_t i5=0;i5<nRP;i5++)
+      } // end of for(Int_t i4=0;i4<nRP;i4++)  
+     } // end of for(Int_t i3=0;i3<nRP;i3++)
+    } // end of for(Int_t i2=0;i2<nRP;i2++)
+   } // end of for(Int_t i1=first;i1<last;i1++)
+  };
+  RunOverOuterIndex(fNThreads,nRP,loop5p);
+  this->MergeThreadClones(f5pCorrelatorPro,f5pThreadClones);
+ } // end of if(nRP>=5) 
 
  // Evaluting correlator cos[n(psi1+psi2-2*phi3)] with three nested loops:
  if(!fEvaluateDifferential3pCorrelator){return;}
- for(Int_t i1=0;i1<nPrim;i1++)
- {
-  aftsTrack=anEvent->GetTrack(i1);
-  if(!(aftsTrack->InPOISelection())){continue;}
-  psi1 = aftsTrack->Phi();  
-  pt1 = aftsTrack->Pt();     
-  charge1 = aftsTrack->Charge();     
-  for(Int_t i2=0;i2<nPrim;i2++)
+ std::sort(poiOrder.begin(),poiOrder.end(),[anEvent](Int_t a, Int_t b)
+ {
+  AliFlowTrackSimple *ta = anEvent->GetTrack(a), *tb = anEvent->GetTrack(b);
+  if(ta->Charge() != tb->Charge()){return ta->Charge() < tb->Charge();}
+  return ta->Pt() < tb->Pt();
+ });
+ Int_t nPOI = poiOrder.size();
+ std::vector<Double_t> poiPhi(nPOI), poiPt(nPOI);
+ std::vector<Int_t> poiCharge(nPOI);
+ std::vector<Int_t> groupBegin; // first POI of each block of equal charge, terminated by nPOI
+ for(Int_t p=0;p<nPOI;p++)
+ {
+  AliFlowTrackSimple *aftsTrack = anEvent->GetTrack(poiOrder[p]);
+  poiPhi[p] = aftsTrack->Phi();
+  poiPt[p] = aftsTrack->Pt();
+  poiCharge[p] = aftsTrack->Charge();
+  if(p==0 || poiCharge[p] != poiCharge[p-1]){groupBegin.push_back(p);}
+ }
+ groupBegin.push_back(nPOI);
+ Int_t nGroups = groupBegin.size()-1;
+
+ this->PrepareThreadClones(f3pCorrelatorVsPtSumDiffDirectPro[0],f3pDiffThreadClones[0]);
+ this->PrepareThreadClones(f3pCorrelatorVsPtSumDiffDirectPro[1],f3pDiffThreadClones[1]);
+ auto loopDiff = [&](Int_t first, Int_t last, Int_t slot)
+ {
+  TH1 *proSum = (slot == 0 ? (TH1*)f3pCorrelatorVsPtSumDiffDirectPro[0] : f3pDiffThreadClones[0][slot-1]);
+  TH1 *proDiff = (slot == 0 ? (TH1*)f3pCorrelatorVsPtSumDiffDirectPro[1] : f3pDiffThreadClones[1][slot-1]);
+  for(Int_t i1=first;i1<last;i1++)
   {
-   if(i2==i1){continue;}
-   aftsTrack = anEvent->GetTrack(i2);
-   if(!(aftsTrack->InPOISelection())){continue;}
-   psi2 = aftsTrack->Phi();
-   pt2 = aftsTrack->Pt();
-   charge2 = aftsTrack->Charge();     
-   if(fOppositeChargesPOI && charge1 == charge2){continue;}
-   for(Int_t i3=0;i3<nPrim;i3++)
+   for(Int_t g=0;g<nGroups;g++)
    {
-    if(i3==i1||i3==i2){continue;}
-    aftsTrack=anEvent->GetTrack(i3);
-    if(!(aftsTrack->InRPSelection())){continue;}
-    phi3 = aftsTrack->Phi();
-    // Evaluate and store differential correlator cos[n(psi1+psi2-2*phi3)]:
-    Double_t ptSum = (pt1+pt2)/2.;
-    Double_t ptDiff = TMath::Abs(pt1-pt2);
-    Double_t diff3pCorrelator = TMath::Cos(n*(psi1+psi2-2.*phi3));
-    f3pCorrelatorVsPtSumDiffDirectPro[0]->Fill(ptSum,diff3pCorrelator,1.);
-    f3pCorrelatorVsPtSumDiffDirectPro[1]->Fill(ptDiff,diff3pCorrelator,1.);
-   } // end of for(Int_t i3=0;i3<nPrim;i3++)  
-  } // end of for(Int_t i2=0;i2<nPrim;i2++)  
- } // end of for(Int_t i1=0;i1<nPrim;i1++)
+    if(fOppositeChargesPOI && poiCharge[groupBegin[g]] == poiCharge[i1]){continue;}
+    for(Int_t i2=groupBegin[g];i2<groupBegin[g+1];i2++)
+    {
+     if(i2==i1){continue;}
+     // Evaluate and store differential correlator cos[n(psi1+psi2-2*phi3)]:
+     Double_t ptSum = (poiPt[i1]+poiPt[i2])/2.;
+     Double_t ptDiff = TMath::Abs(poiPt[i1]-poiPt[i2]);
+     for(Int_t i3=0;i3<nRP;i3++)
+     {
+      if(rpIndex[i3]==poiOrder[i1]||rpIndex[i3]==poiOrder[i2]){continue;}
+      Double_t diff3pCorrelator = TMath::Cos(n*(poiPhi[i1]+poiPhi[i2]-2.*rpPhi[i3]));
+      static_cast<TProfile*>(proSum)->Fill(ptSum,diff3pCorrelator,1.);
+      static_cast<TProfile*>(proDiff)->Fill(ptDiff,diff3pCorrelator,1.);
+     } // end of for(Int_t i3=0;i3<nRP;i3++)  
+    } // end of for(Int_t i2=groupBegin[g];i2<groupBegin[g+1];i2++)  
+   } // end of for(Int_t g=0;g<nGroups;g++)
+  } // end of for(Int_t i1=first;i1<last;i1++)
+ };
+ RunOverOuterIndex(fNThreads,nPOI,loopDiff);
+ this->MergeThreadClones(f3pCorrelatorVsPtSumDiffDirectPro[0],f3pDiffThreadClones[0]);
+ this->MergeThreadClones(f3pCorrelatorVsPtSumDiffDirectPro[1],f3pDiffThreadClones[1]);
 
 } // end of void AliFlowAnalysisWithNestedLoops::EvaluateNestedLoopsForMH(AliFlowEventSimple *anEvent)
 
 //================================================================================================================
 
+void AliFlowAnalysisWithNestedLoops::PrepareThreadClones(TH1 *hist, std::vector<TH1*> &clones)
+{
+ // Make sure there is one empty clone of 'hist' for each worker thread beyond the first.
+ // Clones are created here, in the calling thread, since booking histograms is not thread-safe.
+
+ if(!hist){return;}
+ while((Int_t)clones.size() < fNThreads-1)
+ {
+  TH1 *clone = static_cast<TH1*>(hist->Clone(Form("%s_thread%d",hist->GetName(),(Int_t)clones.size()+1)));
+  clone->SetDirectory(0);
+  clone->Reset();
+  clones.push_back(clone);
+ }
+
+} // end of void AliFlowAnalysisWithNestedLoops::PrepareThreadClones(TH1 *hist, std::vector<TH1*> &clones)
+
+//================================================================================================================
+
+void AliFlowAnalysisWithNestedLoops::MergeThreadClones(TH1 *hist, std::vector<TH1*> &clones)
+{
+ // Add the per-thread accumulators to 'hist' in thread order, so that the result does not depend on scheduling.
+
+ if(!hist){return;}
+ for(auto clone : clones)
+ {
+  if(clone->GetEntries() == 0){continue;}
+  hist->Add(clone);
+  clone->Reset();
+ }
+
+} // end of void AliFlowAnalysisWithNestedLoops::MergeThreadClones(TH1 *hist, std::vector<TH1*> &clones)
+
+//================================================================================================================
+
 void AliFlowAnalysisWithNestedLoops::PrintOnTheScreen()
 {
  // Print on the screen.
@@ -17,8 +17,11 @@
 #ifndef ALIFLOWANALYSISWITHNESTEDLOOPS_H
 #define ALIFLOWANALYSISWITHNESTEDLOOPS_H
 
+#include <vector>
+
 class TList;
 class TDirectoryFile;
+class TH1;
 class TH1F;
 class TH1D;
 class TProfile;
@@ -69,6 +72,8 @@ class AliFlowAnalysisWithNestedLoops
   virtual void WriteHistograms(TDirectoryFile *outputFileName);  
   virtual void CheckPointersForRAD(TString where);
   virtual void CheckPointersForMH(TString where);
+  virtual void PrepareThreadClones(TH1 *hist, std::vector<TH1*> &clones);
+  virtual void MergeThreadClones(TH1 *hist, std::vector<TH1*> &clones);
   // 6.) Setters and getters:
   void SetHistList(TList* const hl) {this->fHistList = hl;}
   TList* GetHistList() const {return this->fHistList;}  
@@ -86,6 +91,8 @@ class AliFlowAnalysisWithNestedLoops
   Bool_t GetEvaluateDifferential3pCorrelator() const {return this->fEvaluateDifferential3pCorrelator;};      
   void SetPrintOnTheScreen(Bool_t const pots) {this->fPrintOnTheScreen = pots;};
   Bool_t GetPrintOnTheScreen() const {return this->fPrintOnTheScreen;};   
+  void SetNumberOfThreads(Int_t const nt) {this->fNThreads = (nt > 0 ? nt : 1);};
+  Int_t GetNumberOfThreads() const {return this->fNThreads;};
   void SetCommonHists(AliFlowCommonHist* const ch) {this->fCommonHists = ch;};
   AliFlowCommonHist* GetCommonHists() const {return this->fCommonHists;};
   void SetWeightsList(TList* const wl) {this->fWeightsList = (TList*)wl->Clone();}
@@ -141,6 +148,7 @@ class AliFlowAnalysisWithNestedLoops
   Bool_t fOppositeChargesPOI; // two POIs, psi1 and psi2, in correlator <<cos[psi1+psi2-2phi3)]>> will be taken with opposite charges  
   Bool_t fEvaluateDifferential3pCorrelator; // evaluate <<cos[psi1+psi2-2phi3)]>>, where psi1 and psi2 are two POIs   
   Bool_t fPrintOnTheScreen; // print or not on the screen
+  Int_t fNThreads; // number of threads over which the outer loop index is split (1 = sequential)
   // 1.) Common:
   AliFlowCommonHist *fCommonHists; // common control histograms (filled only with events with 3 or more tracks for 3-p correlators) 
   Int_t fnBinsPhi; // number of phi bins
@@ -178,6 +186,11 @@ class AliFlowAnalysisWithNestedLoops
   TProfile *f3pCorrelatorPro; // 3-p correlator <<cos[n(phi1+phi2-2phi3)]>>  
   TProfile *f5pCorrelatorPro; // 5-p correlator <<cos[n(2phi1+2phi2+2phi3-3phi4-3phi5)]>>  
   TProfile *f3pCorrelatorVsPtSumDiffDirectPro[2]; // differential 3-p correlator cos[n(2phi1-psi2-psi3)] vs [(p1+p2)/2,|p1-p2|]
+  // 6.) Per-thread accumulators, merged into the objects above in thread order after each event:
+  std::vector<TH1*> fRADThreadClones; //! clones of fRelativeAngleDistribution
+  std::vector<TH1*> f3pThreadClones; //! clones of f3pCorrelatorPro
+  std::vector<TH1*> f5pThreadClones; //! clones of f5pCorrelatorPro
+  std::vector<TH1*> f3pDiffThreadClones[2]; //! clones of f3pCorrelatorVsPtSumDiffDirectPro[2]
   
   ClassDef(AliFlowAnalysisWithNestedLoops, 0);
 };
@@ -72,6 +72,7 @@ ClassImp(AliFlowAnalysisWithQCumulants)
 AliFlowAnalysisWithQCumulants::AliFlowAnalysisWithQCumulants(): 
  // 0.) base:
  fHistList(NULL),
+ fPrintAllocationReport(kFALSE),
  // 1.) common:
  fBookOnlyBasicCCH(kTRUE),
  fCommonHists(NULL),
@@ -286,7 +287,8 @@ void AliFlowAnalysisWithQCumulants::Init()
  // f) Store harmonic which will be estimated;
  // g) Store flags for mixed harmonics;
  // h) Store flags for control histograms;
- // i) Store bootstrap flags.
+ // i) Store bootstrap flags;
+ // j) Print the allocation report if requested.
   
  //save old value and prevent histograms from being added to directory
  //to avoid name clashes in case multiple analaysis objects are used
@@ -325,6 +327,8 @@ void AliFlowAnalysisWithQCumulants::Init()
  this->StoreControlHistogramsFlags();
  // i) Store bootstrap flags:
  this->StoreBootstrapFlags();
+ // j) Print the allocation report if requested:
+ if(fPrintAllocationReport){this->PrintAllocationReport();}
 
  TH1::AddDirectory(oldHistAddStatus);
 
@@ -16351,6 +16355,82 @@ void AliFlowAnalysisWithQCumulants::CrossCheckSettings()
 
 //=======================================================================================================================
 
+void AliFlowAnalysisWithQCumulants::SetRequiredObservables(UInt_t observables)
+{
+ // Declare up front which observables are needed. Only the accumulators for those get booked in Init(),
+ // the reference flow is always calculated. Has to be called before Init() and overrides the individual setters.
+
+ if(fHistList && fHistList->GetEntries() > 0)
+ {
+  cout<<"WARNING (QC): SetRequiredObservables() called after Init(), ignored."<<endl;
+  return;
+ }
+
+ fCalculateDiffFlow = (observables & (kQCDiffFlow|kQCDiffFlowVsEta|kQC2DDiffFlow|kQCDiffFlowNestedLoops));
+ fCalculateDiffFlowVsEta = (observables & kQCDiffFlowVsEta);
+ fCalculate2DDiffFlow = (observables & kQC2DDiffFlow);
+ fCalculateMixedHarmonics = (observables & (kQCMixedHarmonics|kQCMixedHarmonicsVsM));
+ fCalculateMixedHarmonicsVsM = (observables & kQCMixedHarmonicsVsM);
+ fCalculateCumulantsVsM = (observables & kQCCumulantsVsM);
+ fCalculateAllCorrelationsVsM = (observables & kQCAllCorrelationsVsM);
+ fStoreDistributions = (observables & kQCDistributions);
+ fStoreControlHistograms = (observables & kQCControlHistograms);
+ fUseBootstrap = (observables & (kQCBootstrap|kQCBootstrapVsM));
+ fUseBootstrapVsM = (observables & kQCBootstrapVsM);
+ fEvaluateIntFlowNestedLoops = (observables & kQCIntFlowNestedLoops);
+ fEvaluateDiffFlowNestedLoops = (observables & kQCDiffFlowNestedLoops);
+ fStorePhiDistributionForOneEvent = (observables & kQCPhiDistributionForOneEvent);
+
+} // end of void AliFlowAnalysisWithQCumulants::SetRequiredObservables(UInt_t observables)
+
+//=======================================================================================================================
+
+Long64_t AliFlowAnalysisWithQCumulants::GetAllocatedBytes(TList *list, Bool_t verbose, Int_t depth) const
+{
+ // Estimate the memory held by the bin arrays of all histograms and profiles in 'list' (by default fHistList),
+ // nested lists included. With verbose = kTRUE the subtotal of each list is printed.
+
+ if(!list){list = fHistList;}
+ if(!list){return 0;}
+
+ Long64_t total = 0;
+ TIter next(list);
+ while(TObject *obj = next())
+ {
+  if(obj->InheritsFrom("TList"))
+  {
+   total += this->GetAllocatedBytes(static_cast<TList*>(obj),verbose,depth+1);
+   continue;
+  }
+  TH1 *hist = dynamic_cast<TH1*>(obj);
+  if(!hist){continue;}
+  Long64_t nCells = hist->GetNcells();
+  Int_t cellSize = sizeof(Double_t);
+  if(dynamic_cast<TArrayF*>(obj) || dynamic_cast<TArrayI*>(obj)){cellSize = 4;}
+  else if(dynamic_cast<TArrayS*>(obj)){cellSize = 2;}
+  else if(dynamic_cast<TArrayC*>(obj)){cellSize = 1;}
+  total += nCells*cellSize + (Long64_t)hist->GetSumw2N()*sizeof(Double_t);
+  if(obj->InheritsFrom("TProfile") || obj->InheritsFrom("TProfile2D") || obj->InheritsFrom("TProfile3D"))
+  {
+   // bin entries and (if enabled) sum of squared weights:
+   Int_t nBinSumw2 = 0;
+   if(TProfile *p = dynamic_cast<TProfile*>(obj)){nBinSumw2 = p->GetBinSumw2()->GetSize();}
+   else if(TProfile2D *p2 = dynamic_cast<TProfile2D*>(obj)){nBinSumw2 = p2->GetBinSumw2()->GetSize();}
+   total += (nCells + nBinSumw2)*sizeof(Double_t);
+  }
+ }
+
+ if(verbose)
+ {
+  cout<<"QC: "<<TString(' ',2*depth).Data()<<list->GetName()<<": "<<total<<" bytes"<<endl;
+ }
+
+ return total;
+
+} // end of Long64_t AliFlowAnalysisWithQCumulants::GetAllocatedBytes(TList *list, Bool_t verbose, Int_t depth) const
+
+//=======================================================================================================================
+
 void AliFlowAnalysisWithQCumulants::CalculateIntFlowSumOfEventWeights()
 {
  // Calculate sum of linear and quadratic event weights for correlations.
@@ -39,6 +39,24 @@ class AliFlowCommonHistResults;
 
 class AliFlowAnalysisWithQCumulants{
  public:
+  // observables which can be requested in one go via SetRequiredObservables():
+  enum EQCObservables {
+   kQCRefFlow = 0, // reference flow only (always booked)
+   kQCDiffFlow = 1<<0, // differential flow vs pt
+   kQCDiffFlowVsEta = 1<<1, // differential flow vs eta (implies kQCDiffFlow)
+   kQC2DDiffFlow = 1<<2, // 2D differential flow vs (pt,eta)
+   kQCMixedHarmonics = 1<<3,
+   kQCMixedHarmonicsVsM = 1<<4, // implies kQCMixedHarmonics
+   kQCCumulantsVsM = 1<<5,
+   kQCAllCorrelationsVsM = 1<<6,
+   kQCDistributions = 1<<7, // distributions of reference flow correlations
+   kQCControlHistograms = 1<<8,
+   kQCBootstrap = 1<<9,
+   kQCBootstrapVsM = 1<<10, // implies kQCBootstrap
+   kQCIntFlowNestedLoops = 1<<11,
+   kQCDiffFlowNestedLoops = 1<<12,
+   kQCPhiDistributionForOneEvent = 1<<13
+  };
   AliFlowAnalysisWithQCumulants();
   virtual ~AliFlowAnalysisWithQCumulants(); 
   // 0.) methods called in the constructor:
@@ -186,12 +204,17 @@ class AliFlowAnalysisWithQCumulants{
   TProfile* MakeEtaProjection(TProfile2D *profilePtEta) const;
   virtual void WriteHistograms(TString outputFileName);
   virtual void WriteHistograms(TDirectoryFile *outputFileName);
+  virtual void SetRequiredObservables(UInt_t observables);
+  virtual Long64_t GetAllocatedBytes(TList *list = NULL, Bool_t verbose = kFALSE, Int_t depth = 0) const;
+  virtual void PrintAllocationReport() const {this->GetAllocatedBytes(fHistList,kTRUE);};
   
   // **** SETTERS and GETTERS ****
   
   // 0.) base:
   void SetHistList(TList* const hlist) {this->fHistList = hlist;} 
   TList* GetHistList() const {return this->fHistList;} 
+  void SetPrintAllocationReport(Bool_t const par) {this->fPrintAllocationReport = par;};
+  Bool_t GetPrintAllocationReport() const {return this->fPrintAllocationReport;};
   
   // 1.) common:
   void SetBookOnlyBasicCCH(Bool_t const bobcch) {this->fBookOnlyBasicCCH = bobcch;};
@@ -557,6 +580,7 @@ class AliFlowAnalysisWithQCumulants{
   
   // 0.) base:
   TList* fHistList; // base list to hold all output object
+  Bool_t fPrintAllocationReport; // print bytes allocated per output list at the end of Init()
   
   // 1.) common:
   Bool_t fBookOnlyBasicCCH; // book only basis common control histrograms (by default book them all)
@@ -847,7 +871,7 @@ class AliFlowAnalysisWithQCumulants{
   TH2D *fBootstrapCumulants; // x-axis => QC{2}, QC{4}, QC{6}, QC{8}; y-axis => subsample # 
   TH2D *fBootstrapCumulantsVsM[4]; // index => QC{2}, QC{4}, QC{6}, QC{8}; x-axis => multiplicity; y-axis => subsample # 
 
-  ClassDef(AliFlowAnalysisWithQCumulants, 4);
+  ClassDef(AliFlowAnalysisWithQCumulants, 5);
 
 };
 
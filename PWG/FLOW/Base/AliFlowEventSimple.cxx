@@ -391,12 +391,11 @@ void AliFlowEventSimple::Generate(Int_t nParticles,
 
   for (Int_t i=0; i<nParticles; i++)
   {
-    AliFlowTrackSimple* track = new AliFlowTrackSimple();
+    AliFlowTrackSimple* track = AddTrackInPlace();
     track->SetPhi( gRandom->Uniform(phiMin,phiMax) );
     track->SetEta( gRandom->Uniform(etaMin,etaMax) );
     track->SetPt( ptDist->GetRandom() );
     track->SetCharge( (gRandom->Uniform()-0.5<0)?-1:1 );
-    AddTrack(track);
   }
   if(fUseExternalSymmetryPlanes) {
     Double_t betaParameter = gRandom->Gaus(0.,1.3);
@@ -504,6 +503,28 @@ AliFlowTrackSimple* AliFlowEventSimple::MakeNewTrack()
    return t;
 }
 
+//-----------------------------------------------------------------------
+AliFlowTrackSimple* AliFlowEventSimple::AddTrackInPlace()
+{
+  //add a track without allocating: the track left in the next slot by a previous
+  //event (see ClearFast()) is cleared and reused, a new one is made only if the
+  //collection is exhausted. The track is already counted, the caller just fills it.
+  AliFlowTrackSimple* track = NULL;
+  if (fNumberOfTracks < fTrackCollection->GetEntriesFast())
+    track = static_cast<AliFlowTrackSimple*>(fTrackCollection->UncheckedAt(fNumberOfTracks));
+  if (track)
+  {
+    track->Clear();
+  }
+  else
+  {
+    track = new AliFlowTrackSimple();
+    fTrackCollection->AddAtAndExpand(track,fNumberOfTracks);
+  }
+  TrackAdded();
+  return track;
+}
+
 //-----------------------------------------------------------------------
 AliFlowVector AliFlowEventSimple::GetQ( Int_t n,
                                         TList *weightsList,
@@ -73,7 +73,10 @@ fPi(TMath::Pi()),
 fUniformEfficiency(kTRUE),
 fPtMin(0.5),
 fPtMax(1.0),
-fPtProbability(0.75) 
+fPtProbability(0.75),
+fReuseEvent(kFALSE),
+fEvent(NULL),
+fTrack(NULL)
 {
  // Constructor.
   
@@ -91,6 +94,8 @@ AliFlowEventSimpleMakerOnTheFly::~AliFlowEventSimpleMakerOnTheFly()
 
  if(fPtSpectra){delete fPtSpectra;}
  if(fPhiDistribution){delete fPhiDistribution;}
+ if(fEvent){delete fEvent;}
+ if(fTrack){delete fTrack;}
 
 } // end of AliFlowEventSimpleMakerOnTheFly::~AliFlowEventSimpleMakerOnTheFly()	
 
@@ -198,15 +203,26 @@ AliFlowEventSimple* AliFlowEventSimpleMakerOnTheFly::CreateEventOnTheFly(AliFlow
   fPhiDistribution->SetParameter(2,gRandom->Uniform(fMinV2,fMaxV2));
  } 
 
- // d) Create event 'on the fly':
- AliFlowEventSimple *pEvent = new AliFlowEventSimple(iMult); 
+ // d) Create event 'on the fly' (or refill the previous one in place, without any per-track allocation):
+ AliFlowEventSimple *pEvent = NULL;
+ if(fReuseEvent)
+ {
+  if(!fEvent){fEvent = new AliFlowEventSimple(fNTimes*iMult);} 
+  else {fEvent->ClearFast();}
+  pEvent = fEvent;
+ } else
+   {
+    pEvent = new AliFlowEventSimple(iMult); 
+   }
  pEvent->SetReferenceMultiplicity(iMult);
  pEvent->SetMCReactionPlaneAngle(dReactionPlane); 
  Int_t nRPs = 0; // number of particles tagged RP in this event
  Int_t nPOIs = 0; // number of particles tagged POI in this event
+ if(!fTrack){fTrack = new AliFlowTrackSimple();}
  for(Int_t p=0;p<iMult;p++)
  {
-  AliFlowTrackSimple *pTrack = new AliFlowTrackSimple();
+  AliFlowTrackSimple *pTrack = fTrack;
+  pTrack->Clear();
   pTrack->SetPt(fPtSpectra->GetRandom()); 
   if(fPtDependentV2 && !fUniformFluctuationsV2)
   {
@@ -218,13 +234,11 @@ AliFlowEventSimple* AliFlowEventSimpleMakerOnTheFly::CreateEventOnTheFly(AliFlow
   } // end of if(fPtDependentV2)  
   // Check pT efficiency:
   if(!fUniformEfficiency && !this->AcceptPt(pTrack)){
-    delete pTrack;
     continue;
   }
   pTrack->SetPhi(fPhiDistribution->GetRandom());
   // Check uniform acceptance:
   if(!fUniformAcceptance && !this->AcceptPhi(pTrack)){
-    delete pTrack;
     continue;
   }
   pTrack->SetEta(gRandom->Uniform(-1.,1.));
@@ -250,15 +264,11 @@ AliFlowEventSimple* AliFlowEventSimpleMakerOnTheFly::CreateEventOnTheFly(AliFlow
   {
    pTrack->SetForSubevent(1);
   }  
-  pEvent->AddTrack(pTrack);
-  // Simulating nonflow:
-  if(fNTimes>1)
+  // Simulating nonflow (the same particle fNTimes times):
+  for(Int_t nt=0;nt<TMath::Max(fNTimes,1);nt++)
   {
-   for(Int_t nt=1;nt<fNTimes;nt++)
-   {
-    pEvent->AddTrack(pTrack->Clone());  
-   } 
-  } // end of if(fNTimes>1)       
+   *(pEvent->AddTrackInPlace()) = *pTrack;
+  }
  } // end of for(Int_t p=0;p<iMult;p++)
  pEvent->SetNumberOfRPs(fNTimes*nRPs);
  pEvent->SetNumberOfPOIs(fNTimes*nPOIs);
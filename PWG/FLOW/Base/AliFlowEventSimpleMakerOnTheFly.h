@@ -90,6 +90,8 @@ class AliFlowEventSimpleMakerOnTheFly{
   Double_t GetPtMax() const {return this->fPtMax;} 
   void SetPtProbability(Double_t ptp) {this->fPtProbability = ptp;}
   Double_t GetPtProbability() const {return this->fPtProbability;} 
+  void SetReuseEvent(Bool_t re) {this->fReuseEvent = re;}
+  Bool_t GetReuseEvent() const {return this->fReuseEvent;} 
 
  private:
   AliFlowEventSimpleMakerOnTheFly(const AliFlowEventSimpleMakerOnTheFly& anAnalysis); // copy constructor
@@ -130,8 +132,11 @@ class AliFlowEventSimpleMakerOnTheFly{
   Double_t fPtMin; // non-uniform efficiency vs pT starts at pT = fPtMin
   Double_t fPtMax; // non-uniform efficiency vs pT ends at pT = fPtMax
   Double_t fPtProbability; // particles emitted in fPtMin <= pT < fPtMax are taken with probability fPtProbability 
+  Bool_t fReuseEvent; // refill the same event (and its tracks) in place for each call, instead of a new one; event is owned by the maker
+  AliFlowEventSimple *fEvent; //! event refilled in place when fReuseEvent is set
+  AliFlowTrackSimple *fTrack; //! scratch track for sampling, copied into the event only when accepted
 
-  ClassDef(AliFlowEventSimpleMakerOnTheFly,1) // macro for rootcint
+  ClassDef(AliFlowEventSimpleMakerOnTheFly,2) // macro for rootcint
 };
  
 #endif
@@ -948,15 +948,17 @@ void AliFlowEvent::Fill( AliFlowTrackCuts* rpCuts,
 
   if (sourceRP==sourcePOI)
   {
-    //loop over tracks
+    //loop over tracks, rp and poi cuts are evaluated together
+    AliFlowTrackCuts* cuts[2] = {rpCuts, poiCuts};
     Int_t numberOfInputObjects = rpCuts->GetNumberOfInputObjects();
     for (Int_t i=0; i<numberOfInputObjects; i++)
     {
       //get input object (particle)
       TObject* particle = rpCuts->GetInputObject(i);
 
-      Bool_t rp = rpCuts->IsSelected(particle,i);
-      Bool_t poi = poiCuts->IsSelected(particle,i);
+      UInt_t mask = AliFlowTrackCuts::IsSelected(2,cuts,particle,i);
+      Bool_t rp = mask&1;
+      Bool_t poi = mask&2;
 
       if (!(rp||poi)) continue;
 
@@ -211,7 +211,8 @@ AliFlowTrackCuts::AliFlowTrackCuts():
   fMaxITSclusterShared(0),
   fCutITSChi2(kFALSE),
   fMaxITSChi2(0),
-  fRun(0)
+  fRun(0),
+  fShared(NULL)
 {
   //io constructor 
   SetPriors(); //init arrays
@@ -363,7 +364,8 @@ AliFlowTrackCuts::AliFlowTrackCuts(const char* name):
   fMaxITSclusterShared(0),
   fCutITSChi2(kFALSE),
   fMaxITSChi2(0),
-  fRun(0)
+  fRun(0),
+  fShared(NULL)
 {
   //constructor
   SetTitle("AliFlowTrackCuts");
@@ -518,7 +520,8 @@ AliFlowTrackCuts::AliFlowTrackCuts(const AliFlowTrackCuts& that):
   fMaxITSclusterShared(0),
   fCutITSChi2(kFALSE),
   fMaxITSChi2(0),
-  fRun(0)
+  fRun(0),
+  fShared(NULL)
 {
   //copy constructor
   if (that.fTPCpidCuts) fTPCpidCuts = new TMatrixF(*(that.fTPCpidCuts));
@@ -858,6 +861,64 @@ Bool_t AliFlowTrackCuts::IsSelected(TObject* obj, Int_t id)
   return kFALSE;  //default when passed wrong type of object
 }
 
+//-----------------------------------------------------------------------
+void AliFlowTrackCuts::SharedTrackInfo::Reset(const TObject* obj)
+{
+  //forget the sub-results of the previous object
+  fObject=obj;
+  fHasDCA=kFALSE;
+  for (Int_t i=0; i<2; i++)
+    for (Int_t j=0; j<AliPID::kSPECIESC; j++) fHasNSigma[i][j]=kFALSE;
+  fNESDtrackCuts=0;
+}
+
+//-----------------------------------------------------------------------
+UInt_t AliFlowTrackCuts::IsSelected(Int_t nCuts, AliFlowTrackCuts* const* cuts, TObject* obj, Int_t id)
+{
+  //check several cut objects on the same object, sharing what they have in common
+  if (nCuts>32) nCuts=32;
+  SharedTrackInfo shared;
+  shared.Reset(obj);
+  UInt_t mask=0;
+  for (Int_t i=0; i<nCuts; i++)
+  {
+    cuts[i]->fShared=&shared;
+    if (cuts[i]->IsSelected(obj,id)) mask|=(1u<<i);
+    cuts[i]->fShared=NULL;
+  }
+  return mask;
+}
+
+//-----------------------------------------------------------------------
+void AliFlowTrackCuts::SelectTracks(Int_t nCuts, AliFlowTrackCuts* const* cuts, std::vector<UInt_t>& masks)
+{
+  //selection masks of all input objects of the first cut object
+  masks.clear();
+  if (nCuts<1) return;
+  Int_t n=cuts[0]->GetNumberOfInputObjects();
+  masks.resize(TMath::Max(n,0));
+  for (Int_t i=0; i<n; i++)
+    masks[i]=IsSelected(nCuts,cuts,cuts[0]->GetInputObject(i),i);
+}
+
+//-----------------------------------------------------------------------
+Float_t AliFlowTrackCuts::GetNSigma(Int_t detector, const AliVTrack* track)
+{
+  //n-sigma of fParticleID, evaluated once per object for all cut objects
+  Int_t idet=-1;
+  if (detector==AliPIDResponse::kTPC) idet=0;
+  else if (detector==AliPIDResponse::kTOF) idet=1;
+  Bool_t cache=(fShared && fShared->fObject==track && idet>=0 && fParticleID>=0 && fParticleID<AliPID::kSPECIESC);
+  if (cache && fShared->fHasNSigma[idet][fParticleID]) return fShared->fNSigma[idet][fParticleID];
+  Float_t nsigma=fPIDResponse->NumberOfSigmas((AliPIDResponse::EDetector)detector,track,fParticleID);
+  if (cache)
+  {
+    fShared->fNSigma[idet][fParticleID]=nsigma;
+    fShared->fHasNSigma[idet][fParticleID]=kTRUE;
+  }
+  return nsigma;
+}
+
 //-----------------------------------------------------------------------
 Bool_t AliFlowTrackCuts::IsSelectedMCtruth(TObject* obj, Int_t id)
 {
@@ -1635,7 +1696,11 @@ Bool_t AliFlowTrackCuts::PassesAODcuts(const AliAODTrack* track, Bool_t passedFi
       // allowed only for tracks inside the beam pipe
       Double_t pos[3] = {-99., -99., -99.};
       track->GetPosition(pos);
-      if(pos[0]*pos[0]+pos[1]*pos[1] <= 3.*3.) {
+      if (fShared && fShared->fObject==track && fShared->fHasDCA) {
+        DCAxy = fShared->fDCA[0];
+        DCAz = fShared->fDCA[1];
+      }
+      else if(pos[0]*pos[0]+pos[1]*pos[1] <= 3.*3.) {
         AliAODTrack copy(*track);       // stack copy
         Double_t b[2] = {-99., -99.};
         Double_t bCov[3] = {-99., -99., -99.};
@@ -1644,6 +1709,11 @@ Bool_t AliFlowTrackCuts::PassesAODcuts(const AliAODTrack* track, Bool_t passedFi
           DCAz = b[1];
         }
       }
+      if (fShared && fShared->fObject==track) {
+        fShared->fDCA[0] = DCAxy;
+        fShared->fDCA[1] = DCAz;
+        fShared->fHasDCA = kTRUE;
+      }
     }
     if (fCutDCAToVertexXYAOD) {
       if (TMath::Abs(DCAxy)>fMaxDCAxyAOD) pass=kFALSE;
@@ -1787,7 +1857,23 @@ Bool_t AliFlowTrackCuts::PassesESDcuts(AliESDtrack* track)
   //some stuff is still handled by AliESDtrackCuts class - delegate
   if (fAliESDtrackCuts)
   {
-    if (!fAliESDtrackCuts->IsSelected(track)) pass=kFALSE;
+    //the same AliESDtrackCuts object may be used by several cut objects
+    Int_t icached=-1;
+    if (fShared && fShared->fObject==track)
+      for (Int_t i=0; i<fShared->fNESDtrackCuts; i++)
+        if (fShared->fESDtrackCuts[i]==fAliESDtrackCuts) icached=i;
+    Bool_t passESDcuts=kFALSE;
+    if (icached>=0) passESDcuts=fShared->fESDtrackCutsPass[icached];
+    else
+    {
+      passESDcuts=fAliESDtrackCuts->IsSelected(track);
+      if (fShared && fShared->fObject==track && fShared->fNESDtrackCuts<SharedTrackInfo::kMaxESDtrackCuts)
+      {
+        fShared->fESDtrackCuts[fShared->fNESDtrackCuts]=fAliESDtrackCuts;
+        fShared->fESDtrackCutsPass[fShared->fNESDtrackCuts++]=passESDcuts;
+      }
+    }
+    if (!passESDcuts) pass=kFALSE;
   }
  
   //PID part with pid QA
@@ -4126,8 +4212,8 @@ Bool_t AliFlowTrackCuts::PassesTPCTOFNsigmaCut(const AliAODTrack* track)
     // check TPC status
     if(track->GetTPCsignal() < 10) return kFALSE;
 
-    Float_t nsigmaTPC = fPIDResponse->NumberOfSigmas(AliPIDResponse::kTPC,track,fParticleID);
-    Float_t nsigmaTOF = fPIDResponse->NumberOfSigmas(AliPIDResponse::kTOF,track,fParticleID);
+    Float_t nsigmaTPC = GetNSigma(AliPIDResponse::kTPC,track);
+    Float_t nsigmaTOF = GetNSigma(AliPIDResponse::kTOF,track);
 
     Float_t nsigma2 = nsigmaTPC*nsigmaTPC + nsigmaTOF*nsigmaTOF;
 
@@ -4150,8 +4236,8 @@ Bool_t AliFlowTrackCuts::PassesTPCTOFNsigmaCut(const AliESDtrack* track)
     // check TPC status
     if(track->GetTPCsignal() < 10) return kFALSE;
 
-    Float_t nsigmaTPC = fPIDResponse->NumberOfSigmas(AliPIDResponse::kTPC,track,fParticleID);
-    Float_t nsigmaTOF = fPIDResponse->NumberOfSigmas(AliPIDResponse::kTOF,track,fParticleID);
+    Float_t nsigmaTPC = GetNSigma(AliPIDResponse::kTPC,track);
+    Float_t nsigmaTOF = GetNSigma(AliPIDResponse::kTOF,track);
 
     Float_t nsigma2 = nsigmaTPC*nsigmaTPC + nsigmaTOF*nsigmaTOF;
 
@@ -4180,8 +4266,8 @@ Bool_t AliFlowTrackCuts::PassesTPCTOFNsigmaPurityCut(const AliAODTrack* track)
      Double_t LowPtPIDTPCnsigHigh_Kaon[2] ={3,2.2};
      */
     
-    Float_t nsigmaTPC = fPIDResponse->NumberOfSigmas(AliPIDResponse::kTPC,track,fParticleID);
-    Float_t nsigmaTOF = fPIDResponse->NumberOfSigmas(AliPIDResponse::kTOF,track,fParticleID);
+    Float_t nsigmaTPC = GetNSigma(AliPIDResponse::kTPC,track);
+    Float_t nsigmaTOF = GetNSigma(AliPIDResponse::kTOF,track);
     
     int index = (fParticleID-2)*60 + p_int;
     if ( (track->IsOn(AliAODTrack::kITSin))){
@@ -5347,7 +5433,7 @@ Bool_t AliFlowTrackCuts::PassesTPCTPCTOFNsigmaCut(const AliAODTrack* track){
   }
   if(pass){
     Double_t Pt = track->Pt();
-    Float_t nsigmaTPC = fPIDResponse->NumberOfSigmas(AliPIDResponse::kTPC,track,fParticleID);
+    Float_t nsigmaTPC = GetNSigma(AliPIDResponse::kTPC,track);
     Float_t nsigma2 = 999.;
     if(Pt < fPtTOFPIDoff){
       nsigma2 = nsigmaTPC*nsigmaTPC;
@@ -5356,7 +5442,7 @@ Bool_t AliFlowTrackCuts::PassesTPCTPCTOFNsigmaCut(const AliAODTrack* track){
       if (((track->GetStatus()&AliVTrack::kTOFout)==0)&&((track->GetStatus()&AliVTrack::kTIME)==0)){
         pass = kFALSE;
       }else{
-        Float_t nsigmaTOF = fPIDResponse->NumberOfSigmas(AliPIDResponse::kTOF,track,fParticleID);
+        Float_t nsigmaTOF = GetNSigma(AliPIDResponse::kTOF,track);
         nsigma2 = nsigmaTPC*nsigmaTPC + nsigmaTOF*nsigmaTOF;
       }
     }
@@ -10,6 +10,7 @@
 #ifndef ALIFLOWTRACKCUTS_H
 #define ALIFLOWTRACKCUTS_H
 
+#include <vector>
 #include <TMatrix.h>
 #include <TList.h>
 #include "AliFlowTrackSimpleCuts.h"
@@ -244,6 +245,12 @@ class AliFlowTrackCuts : public AliFlowTrackSimpleCuts {
 
   virtual Bool_t IsSelected(TObject* obj, Int_t id=-666);
   virtual Bool_t IsSelectedMCtruth(TObject* obj, Int_t id=-666);
+  //evaluate up to 32 cut objects on the same object: bit i of the mask is the
+  //selection of cuts[i], and each of them is ready for FillFlowTrack() afterwards.
+  //DCA recalculation, PID n-sigmas and AliESDtrackCuts decisions are shared.
+  static UInt_t IsSelected(Int_t nCuts, AliFlowTrackCuts* const* cuts, TObject* obj, Int_t id=-666);
+  //masks for all input objects of cuts[0], the cuts must read the same event
+  static void SelectTracks(Int_t nCuts, AliFlowTrackCuts* const* cuts, std::vector<UInt_t>& masks);
   AliVParticle* GetTrack() const {return fTrack;}
   AliMCParticle* GetMCparticle() const {return fMCparticle;}
   //AliFlowTrack* MakeFlowTrack() const;
@@ -380,6 +387,7 @@ class AliFlowTrackCuts : public AliFlowTrackSimpleCuts {
   Bool_t TPCTOFagree(const AliVTrack *track);
   // end part added by F. Noferini
   Bool_t PassesTPCTPCTOFNsigmaCut(const AliAODTrack* track); // added by B. Hohlweger
+  Float_t GetNSigma(Int_t detector, const AliVTrack* track); //AliPIDResponse n-sigma of fParticleID, shared between cut objects
 
   //the cuts
   AliESDtrackCuts* fAliESDtrackCuts; //alianalysis cuts
@@ -532,8 +540,23 @@ class AliFlowTrackCuts : public AliFlowTrackSimpleCuts {
   Bool_t fCutITSChi2;                   // cut fMaxITSChi2
   Double_t  fMaxITSChi2;                // fMaxITSChi2
   Int_t         fRun;                   // run number
-  
-  ClassDef(AliFlowTrackCuts,21)
+
+  //sub-results of the current object shared by several cut objects, see IsSelected(Int_t,...)
+  struct SharedTrackInfo {
+    enum {kMaxESDtrackCuts=4};
+    const TObject* fObject;                                     //object the entries belong to
+    Bool_t fHasDCA;                                             //recalculated AOD DCA available
+    Double_t fDCA[2];                                           //recalculated AOD DCA xy,z
+    Bool_t fHasNSigma[2][AliPID::kSPECIESC];                    //TPC,TOF n-sigmas available
+    Float_t fNSigma[2][AliPID::kSPECIESC];                      //TPC,TOF n-sigmas
+    Int_t fNESDtrackCuts;                                       //decisions of AliESDtrackCuts objects
+    const AliESDtrackCuts* fESDtrackCuts[kMaxESDtrackCuts];     //
+    Bool_t fESDtrackCutsPass[kMaxESDtrackCuts];                 //
+    void Reset(const TObject* obj);
+  };
+  SharedTrackInfo* fShared;             //! shared sub-results while evaluating several cut objects
+
+  ClassDef(AliFlowTrackCuts,22)
 };
 
 #endif
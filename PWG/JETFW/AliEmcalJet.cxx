@@ -64,7 +64,10 @@ AliEmcalJet::AliEmcalJet() :
   fJetShapeProperties(0),
   fJetAcceptanceType(0),
   fParticleConstituents(),
-  fClusterConstituents()
+  fClusterConstituents(),
+  fConstituentTable(nullptr),
+  fConstituentTableOffset(0),
+  fNTableConstituents(0)
 {
   fClosestJets[0] = 0;
   fClosestJets[1] = 0;
@@ -116,7 +119,10 @@ AliEmcalJet::AliEmcalJet(Double_t px, Double_t py, Double_t pz) :
   fJetShapeProperties(0),
   fJetAcceptanceType(0),
   fParticleConstituents(),
-  fClusterConstituents()
+  fClusterConstituents(),
+  fConstituentTable(nullptr),
+  fConstituentTableOffset(0),
+  fNTableConstituents(0)
 {
   if (fPt != 0) {
     fPhi = TVector2::Phi_0_2pi(TMath::ATan2(py, px));
@@ -173,7 +179,10 @@ AliEmcalJet::AliEmcalJet(Double_t pt, Double_t eta, Double_t phi, Double_t m) :
   fJetShapeProperties(0),
   fJetAcceptanceType(0),
   fParticleConstituents(),
-  fClusterConstituents()
+  fClusterConstituents(),
+  fConstituentTable(nullptr),
+  fConstituentTableOffset(0),
+  fNTableConstituents(0)
 {
   fPhi = TVector2::Phi_0_2pi(fPhi);
 
@@ -224,7 +233,10 @@ AliEmcalJet::AliEmcalJet(const AliEmcalJet& jet) :
   fJetShapeProperties(0),
   fJetAcceptanceType(jet.fJetAcceptanceType),
   fParticleConstituents(jet.fParticleConstituents),
-  fClusterConstituents(jet.fClusterConstituents)
+  fClusterConstituents(jet.fClusterConstituents),
+  fConstituentTable(jet.fConstituentTable),
+  fConstituentTableOffset(jet.fConstituentTableOffset),
+  fNTableConstituents(jet.fNTableConstituents)
 
 {
   // Copy constructor.
@@ -296,6 +308,9 @@ AliEmcalJet& AliEmcalJet::operator=(const AliEmcalJet& jet)
     fJetAcceptanceType  = jet.fJetAcceptanceType;
     fParticleConstituents = jet.fParticleConstituents;
     fClusterConstituents = jet.fClusterConstituents;
+    fConstituentTable = jet.fConstituentTable;
+    fConstituentTableOffset = jet.fConstituentTableOffset;
+    fNTableConstituents = jet.fNTableConstituents;
   }
 
   return *this;
@@ -677,6 +692,7 @@ void AliEmcalJet::Clear(Option_t */*option*/)
   fHasGhost = kFALSE;
   fClusterConstituents.clear();
   fParticleConstituents.clear();
+  SetConstituentTableRange(nullptr, 0, 0);
 }
 
 /**
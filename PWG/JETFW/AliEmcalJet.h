@@ -22,6 +22,7 @@
 #include "AliEmcalJetShapeProperties.h"
 #include "AliEmcalClusterJetConstituent.h"
 #include "AliEmcalParticleJetConstituent.h"
+#include "AliEmcalJetConstituentTable.h"
 
 /**
  * @class AliEmcalJet
@@ -241,6 +242,39 @@ class AliEmcalJet : public AliVParticle
    */
   bool HasParticleConstituent(const AliVParticle *const part) const;
 
+  /**
+   * @brief Get the per-event constituent table the constituents of this jet are stored in
+   * @return Constituent table (nullptr if the jet finder did not fill one)
+   */
+  const PWG::JETFW::AliEmcalJetConstituentTable *GetConstituentTable() const { return fConstituentTable; }
+
+  /**
+   * @brief Get the first row of the constituents of this jet in the constituent table
+   * @return Row offset
+   */
+  Int_t GetConstituentTableOffset() const { return fConstituentTableOffset; }
+
+  /**
+   * @brief Get the number of rows of the constituents of this jet in the constituent table
+   * @return Number of table constituents (0 if there is no table)
+   */
+  Int_t GetNumberOfTableConstituents() const { return fConstituentTable ? fNTableConstituents : 0; }
+
+  /// Transverse momenta of the constituents, GetNumberOfTableConstituents() entries (nullptr if there is no table)
+  const Double_t *GetConstituentPts() const { return fConstituentTable ? fConstituentTable->GetPt() + fConstituentTableOffset : nullptr; }
+  /// Pseudorapidities of the constituents
+  const Double_t *GetConstituentEtas() const { return fConstituentTable ? fConstituentTable->GetEta() + fConstituentTableOffset : nullptr; }
+  /// Azimuths of the constituents
+  const Double_t *GetConstituentPhis() const { return fConstituentTable ? fConstituentTable->GetPhi() + fConstituentTableOffset : nullptr; }
+  /// Masses of the constituents
+  const Double_t *GetConstituentMasses() const { return fConstituentTable ? fConstituentTable->GetM() + fConstituentTableOffset : nullptr; }
+  /// Charges of the constituents
+  const Short_t *GetConstituentCharges() const { return fConstituentTable ? fConstituentTable->GetCharge() + fConstituentTableOffset : nullptr; }
+  /// Global indices of the constituents in the particle or cluster containers
+  const Int_t *GetConstituentGlobalIndices() const { return fConstituentTable ? fConstituentTable->GetGlobalIndex() + fConstituentTableOffset : nullptr; }
+  /// Constituent type flags (1 for clusters, 0 for particles)
+  const Char_t *GetConstituentIsCluster() const { return fConstituentTable ? fConstituentTable->GetIsCluster() + fConstituentTableOffset : nullptr; }
+
   // Fragmentation function
   Double_t          GetZ(const Double_t trkPx, const Double_t trkPy, const Double_t trkPz)  const;
   Double_t          GetZ(const AliVParticle* trk )                                          const;
@@ -325,6 +359,8 @@ class AliEmcalJet : public AliVParticle
 
   // Sorting methods
   void              SortConstituents();
+  void              SetConstituentTableRange(const PWG::JETFW::AliEmcalJetConstituentTable *table, Int_t offset, Int_t n)
+                                                       { fConstituentTable = table; fConstituentTableOffset = offset; fNTableConstituents = n; }
   std::vector<int>  GetPtSortedTrackConstituentIndexes(TClonesArray *tracks) const;
 
   // Trigger
@@ -435,6 +471,9 @@ class AliEmcalJet : public AliVParticle
 
   std::vector<PWG::JETFW::AliEmcalParticleJetConstituent>      fParticleConstituents;  ///< List of particle constituents
   std::vector<PWG::JETFW::AliEmcalClusterJetConstituent>       fClusterConstituents;   ///< List of cluster constituents
+  const PWG::JETFW::AliEmcalJetConstituentTable               *fConstituentTable;      //!<! Per-event constituent table (owned by the jet finder)
+  Int_t                                                        fConstituentTableOffset; //!<! First row of the constituents in the constituent table
+  Int_t                                                        fNTableConstituents;    //!<! Number of rows of the constituents in the constituent table
 
  private:
   /**
@@ -447,7 +486,7 @@ class AliEmcalJet : public AliVParticle
   };
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalJet,19);
+  ClassDef(AliEmcalJet,20);
   /// \endcond
 };
 
@@ -0,0 +1,117 @@
+/************************************************************************************
+ * Copyright (C) 2021, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#include <TLorentzVector.h>
+#include <TMath.h>
+#include "AliVParticle.h"
+#include "AliEmcalJetConstituentTable.h"
+
+ClassImp(PWG::JETFW::AliEmcalJetConstituentTable)
+
+namespace PWG {
+
+namespace JETFW {
+
+AliEmcalJetConstituentTable::AliEmcalJetConstituentTable() :
+  TNamed(),
+  fPt(),
+  fEta(),
+  fPhi(),
+  fM(),
+  fCharge(),
+  fGlobalIndex(),
+  fIsCluster()
+{
+
+}
+
+AliEmcalJetConstituentTable::AliEmcalJetConstituentTable(const char *name) :
+  TNamed(name, name),
+  fPt(),
+  fEta(),
+  fPhi(),
+  fM(),
+  fCharge(),
+  fGlobalIndex(),
+  fIsCluster()
+{
+
+}
+
+/**
+ * Remove all rows, the allocated memory is kept for the next event.
+ */
+void AliEmcalJetConstituentTable::Clear(Option_t *)
+{
+  fPt.clear();
+  fEta.clear();
+  fPhi.clear();
+  fM.clear();
+  fCharge.clear();
+  fGlobalIndex.clear();
+  fIsCluster.clear();
+}
+
+void AliEmcalJetConstituentTable::Reserve(UInt_t n)
+{
+  fPt.reserve(n);
+  fEta.reserve(n);
+  fPhi.reserve(n);
+  fM.reserve(n);
+  fCharge.reserve(n);
+  fGlobalIndex.reserve(n);
+  fIsCluster.reserve(n);
+}
+
+Int_t AliEmcalJetConstituentTable::AddParticle(const AliVParticle *part, Int_t globalIndex)
+{
+  fPt.push_back(part->Pt());
+  fEta.push_back(part->Eta());
+  fPhi.push_back(part->Phi());
+  fM.push_back(part->M());
+  fCharge.push_back(part->Charge());
+  fGlobalIndex.push_back(globalIndex);
+  fIsCluster.push_back(0);
+  return fPt.size() - 1;
+}
+
+Int_t AliEmcalJetConstituentTable::AddCluster(const TLorentzVector &mom, Int_t globalIndex)
+{
+  Double_t phi = mom.Phi();
+  if (phi < 0) phi += TMath::TwoPi();
+  fPt.push_back(mom.Pt());
+  fEta.push_back(mom.Eta());
+  fPhi.push_back(phi);
+  fM.push_back(mom.M());
+  fCharge.push_back(0);
+  fGlobalIndex.push_back(globalIndex);
+  fIsCluster.push_back(1);
+  return fPt.size() - 1;
+}
+
+}
+
+}
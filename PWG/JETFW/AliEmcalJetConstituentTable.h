@@ -0,0 +1,106 @@
+/************************************************************************************
+ * Copyright (C) 2021, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#ifndef ALIEMCALJETCONSTITUENTTABLE_H
+#define ALIEMCALJETCONSTITUENTTABLE_H
+
+#include <vector>
+#include <TNamed.h>
+
+class AliVParticle;
+class TLorentzVector;
+
+namespace PWG {
+
+namespace JETFW {
+
+/**
+ * @class AliEmcalJetConstituentTable
+ * @brief Per-event table with the kinematics of the constituents of all jets of a jet branch
+ * @ingroup JETFW
+ *
+ * The constituents of each jet occupy a contiguous range of rows, which the jet
+ * refers to via AliEmcalJet::GetConstituentTableOffset() and
+ * AliEmcalJet::GetNumberOfTableConstituents(). The columns are stored as separate
+ * arrays, so that loops over the constituents of a jet read contiguous memory
+ * instead of calling the virtual accessors of each constituent object.
+ *
+ * The table is filled by the jet finder and added to the event next to the jet
+ * branch. It is not meant to be written to file.
+ */
+class AliEmcalJetConstituentTable : public TNamed {
+public:
+  AliEmcalJetConstituentTable();
+  AliEmcalJetConstituentTable(const char *name);
+  virtual ~AliEmcalJetConstituentTable() {}
+
+  virtual void Clear(Option_t *option = "");
+  void Reserve(UInt_t n);
+
+  /**
+   * @brief Add a particle (track) constituent
+   * @param part Particle
+   * @param globalIndex Global index of the particle in the particle containers of the jet finder
+   * @return Row of the constituent
+   */
+  Int_t AddParticle(const AliVParticle *part, Int_t globalIndex);
+
+  /**
+   * @brief Add a cluster constituent
+   * @param mom Cluster momentum vector as used in the jet finding
+   * @param globalIndex Global index of the cluster in the cluster containers of the jet finder
+   * @return Row of the constituent
+   */
+  Int_t AddCluster(const TLorentzVector &mom, Int_t globalIndex);
+
+  Int_t           GetNRows()                 const { return fPt.size(); }
+  const Double_t *GetPt()                    const { return fPt.data(); }
+  const Double_t *GetEta()                   const { return fEta.data(); }
+  const Double_t *GetPhi()                   const { return fPhi.data(); }
+  const Double_t *GetM()                     const { return fM.data(); }
+  const Short_t  *GetCharge()                const { return fCharge.data(); }
+  const Int_t    *GetGlobalIndex()           const { return fGlobalIndex.data(); }
+  const Char_t   *GetIsCluster()             const { return fIsCluster.data(); }
+
+private:
+  std::vector<Double_t>      fPt;            ///< Transverse momentum
+  std::vector<Double_t>      fEta;           ///< Pseudorapidity
+  std::vector<Double_t>      fPhi;           ///< Azimuth, in [0, 2pi) for clusters
+  std::vector<Double_t>      fM;             ///< Mass
+  std::vector<Short_t>       fCharge;        ///< Charge (0 for clusters)
+  std::vector<Int_t>         fGlobalIndex;   ///< Global index in the particle or cluster containers
+  std::vector<Char_t>        fIsCluster;     ///< 1 for cluster constituents, 0 for particles
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalJetConstituentTable, 1);
+  /// \endcond
+};
+
+}
+
+}
+
+#endif
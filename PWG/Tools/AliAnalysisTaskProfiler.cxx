@@ -0,0 +1,356 @@
+/**************************************************************************
+ * Copyright(c) 1998-2015, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <chrono>
+#include <ctime>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include <TH1D.h>
+#include <TList.h>
+#include <TObjArray.h>
+#include <TSystem.h>
+#include <TTree.h>
+
+#include "AliAnalysisDataContainer.h"
+#include "AliAnalysisDataSlot.h"
+#include "AliAnalysisManager.h"
+#include "AliAnalysisTaskProfiler.h"
+
+#if defined(__GNUC__) && !defined(__APPLE__)
+/// Allocation counter of a preloaded malloc wrapper (LD_PRELOAD), used if no
+/// counter is set with SetAllocationCounter(): the wrapper defines this
+/// function returning the number and bytes of the allocations so far.
+extern "C" void AliAnalysisTaskProfilerCountAllocations(unsigned long long *nAllocations, unsigned long long *nBytes) __attribute__((weak));
+#endif
+
+ClassImp(AliAnalysisTaskProfiler)
+
+namespace {
+
+struct Stamp_t {
+  Double_t  fCPU = 0;         // process CPU time [s]
+  Double_t  fWall = 0;        // [s]
+  Double_t  fHeap = 0;        // heap in use [bytes]
+  ULong64_t fNAlloc = 0;      // allocations so far
+  ULong64_t fAllocBytes = 0;  // allocated bytes so far
+  Long_t    fRSS = 0;         // resident memory [kB], sampled events only
+};
+
+struct Usage_t {
+  Double_t fCPU = 0;
+  Double_t fWall = 0;
+  Double_t fHeap = 0;
+  Double_t fNAlloc = 0;
+  Double_t fAllocBytes = 0;
+  Double_t fRSS = 0;
+};
+
+// Shared by the probes of the train, which run one after the other
+struct State_t {
+  AliAnalysisTaskProfiler *fOwner = nullptr;
+  Int_t    fNEventsSample = 0;
+  Bool_t   fHeapTracking = kFALSE;
+  std::vector<Usage_t> fUsage;   // since the last flush: event loop, then the wagons
+  Stamp_t  fLast;
+  Bool_t   fHasLast = kFALSE;
+  Bool_t   fSampling = kFALSE;   // current event sampled
+  Long64_t fNEvents = 0;
+  Long64_t fNEventsFlushed = 0;
+  // tree entry
+  Int_t    fEntryWagon = 0;
+  Long64_t fEntryEvents = 0;
+  Usage_t  fEntryUsage;
+  Double_t fEntryRSS = 0;
+};
+
+State_t &State()
+{
+  static State_t state;
+  return state;
+}
+
+AliAnalysisTaskProfiler::AllocationCounter_t gAllocationCounter = nullptr;
+
+Double_t HeapInUse()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+  struct mallinfo2 info = mallinfo2();
+  return Double_t(info.uordblks) + Double_t(info.hblkhd);
+#elif defined(__GLIBC__)
+  struct mallinfo info = mallinfo();
+  return Double_t((UInt_t)info.uordblks) + Double_t((UInt_t)info.hblkhd);
+#else
+  return 0;
+#endif
+}
+
+void Measure(Stamp_t &stamp, Bool_t heap, Bool_t rss)
+{
+  stamp.fCPU = Double_t(std::clock()) / CLOCKS_PER_SEC;
+  stamp.fWall = std::chrono::duration<Double_t>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  stamp.fHeap = heap ? HeapInUse() : 0;
+  stamp.fNAlloc = 0;
+  stamp.fAllocBytes = 0;
+  if (gAllocationCounter) {
+    gAllocationCounter(stamp.fNAlloc, stamp.fAllocBytes);
+  }
+#if defined(__GNUC__) && !defined(__APPLE__)
+  else if (AliAnalysisTaskProfilerCountAllocations) {
+    unsigned long long n = 0, bytes = 0;
+    AliAnalysisTaskProfilerCountAllocations(&n, &bytes);
+    stamp.fNAlloc = n;
+    stamp.fAllocBytes = bytes;
+  }
+#endif
+  stamp.fRSS = 0;
+  if (rss) {
+    ProcInfo_t info;
+    gSystem->GetProcInfo(&info);
+    stamp.fRSS = info.fMemResident;
+  }
+}
+
+}
+
+//________________________________________________________________________
+AliAnalysisTaskProfiler::AliAnalysisTaskProfiler() :
+  AliAnalysisTaskSE(),
+  fProbeIndex(0),
+  fNEventsSample(1000),
+  fHeapTracking(kFALSE),
+  fWagonNames(),
+  fOutput(nullptr),
+  fHistCPUTime(nullptr),
+  fHistWallTime(nullptr),
+  fHistHeapGrowth(nullptr),
+  fHistAllocations(nullptr),
+  fHistAllocatedBytes(nullptr),
+  fHistRSSGrowth(nullptr),
+  fHistEvents(nullptr),
+  fSampleTree(nullptr)
+{
+}
+
+//________________________________________________________________________
+AliAnalysisTaskProfiler::AliAnalysisTaskProfiler(const char *name, Int_t probeIndex) :
+  AliAnalysisTaskSE(name),
+  fProbeIndex(probeIndex),
+  fNEventsSample(1000),
+  fHeapTracking(kFALSE),
+  fWagonNames(),
+  fOutput(nullptr),
+  fHistCPUTime(nullptr),
+  fHistWallTime(nullptr),
+  fHistHeapGrowth(nullptr),
+  fHistAllocations(nullptr),
+  fHistAllocatedBytes(nullptr),
+  fHistRSSGrowth(nullptr),
+  fHistEvents(nullptr),
+  fSampleTree(nullptr)
+{
+  // only the probe in front of the first wagon has an output
+  if (!fProbeIndex) DefineOutput(1, TList::Class());
+}
+
+//________________________________________________________________________
+AliAnalysisTaskProfiler::~AliAnalysisTaskProfiler()
+{
+  if (State().fOwner == this) State().fOwner = nullptr;
+  delete fOutput;
+}
+
+//________________________________________________________________________
+AliAnalysisTaskProfiler *AliAnalysisTaskProfiler::AddProfiler(Int_t nEventsSample, Bool_t heapTracking, const char *name)
+{
+  // Probes around all the wagons added so far.
+
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  if (!mgr) {
+    ::Error("AliAnalysisTaskProfiler::AddProfiler", "No analysis manager to connect to.");
+    return nullptr;
+  }
+  AliAnalysisDataContainer *input = mgr->GetCommonInputContainer();
+  if (!input) {
+    ::Error("AliAnalysisTaskProfiler::AddProfiler", "No input container, the input handler has to be set first.");
+    return nullptr;
+  }
+
+  // wagons are the top tasks, reading the common input
+  TObjArray *tasks = mgr->GetTasks();
+  std::vector<AliAnalysisTask *> wagons, others;
+  std::vector<TString> names;
+  for (Int_t i = 0; i < tasks->GetEntriesFast(); i++) {
+    AliAnalysisTask *task = static_cast<AliAnalysisTask *>(tasks->At(i));
+    if (!task) continue;
+    if (task->GetNinputs() > 0 && task->GetInputSlot(0)->GetContainer() == input) {
+      wagons.push_back(task);
+      names.push_back(task->GetName());
+    } else {
+      others.push_back(task);
+    }
+  }
+
+  AliAnalysisTaskProfiler *owner = new AliAnalysisTaskProfiler(name, 0);
+  owner->SetNEventsSample(nEventsSample);
+  owner->SetHeapTracking(heapTracking);
+  owner->SetWagonNames(names);
+  mgr->AddTask(owner);
+  mgr->ConnectInput(owner, 0, input);
+  mgr->ConnectOutput(owner, 1, mgr->CreateContainer(name, TList::Class(), AliAnalysisManager::kOutputContainer,
+                                                    Form("%s:%s", AliAnalysisManager::GetCommonFileName(), name)));
+
+  std::vector<AliAnalysisTask *> ordered(1, owner);
+  for (UInt_t i = 0; i < wagons.size(); i++) {
+    AliAnalysisTaskProfiler *probe = new AliAnalysisTaskProfiler(Form("%s_%u", name, i + 1), i + 1);
+    mgr->AddTask(probe);
+    mgr->ConnectInput(probe, 0, input);
+    ordered.push_back(wagons[i]);
+    ordered.push_back(probe);
+  }
+
+  // the top tasks are executed in the order of the task list
+  tasks->Clear();
+  for (auto task : ordered) tasks->Add(task);
+  for (auto task : others) tasks->Add(task);
+
+  return owner;
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskProfiler::SetAllocationCounter(AllocationCounter_t counter)
+{
+  gAllocationCounter = counter;
+}
+
+//________________________________________________________________________
+TH1 *AliAnalysisTaskProfiler::CreateWagonHistogram(const char *name, const char *title)
+{
+  const Int_t nBins = fWagonNames.size() + 1;
+  TH1 *h = new TH1D(name, title, nBins, 0, nBins);
+  h->GetXaxis()->SetBinLabel(1, "event loop");
+  for (Int_t i = 1; i < nBins; i++) h->GetXaxis()->SetBinLabel(i + 1, fWagonNames[i - 1].Data());
+  fOutput->Add(h);
+  return h;
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskProfiler::UserCreateOutputObjects()
+{
+  State_t &state = State();
+  if (fProbeIndex) return;
+
+  state.fOwner = this;
+  state.fNEventsSample = fNEventsSample;
+  state.fHeapTracking = fHeapTracking;
+  state.fUsage.assign(fWagonNames.size() + 1, Usage_t());
+  state.fHasLast = kFALSE;
+  state.fNEvents = 0;
+  state.fNEventsFlushed = 0;
+
+  fOutput = new TList();
+  fOutput->SetOwner();
+  fHistCPUTime = CreateWagonHistogram("fHistCPUTime", "CPU time;;t_{CPU} (s)");
+  fHistWallTime = CreateWagonHistogram("fHistWallTime", "Wall time;;t_{wall} (s)");
+  fHistHeapGrowth = CreateWagonHistogram("fHistHeapGrowth", "Heap growth;;bytes");
+  fHistAllocations = CreateWagonHistogram("fHistAllocations", "Allocations;;allocations");
+  fHistAllocatedBytes = CreateWagonHistogram("fHistAllocatedBytes", "Allocated bytes;;bytes");
+  fHistRSSGrowth = CreateWagonHistogram("fHistRSSGrowth", Form("Resident memory growth, every %d events;;kB", fNEventsSample));
+  fHistEvents = new TH1D("fHistEvents", "Events;;events", 1, 0, 1);
+  fOutput->Add(fHistEvents);
+
+  fSampleTree = new TTree("fSampleTree", Form("Per wagon usage every %d events", fNEventsSample));
+  fSampleTree->Branch("wagon", &state.fEntryWagon, "wagon/I");
+  fSampleTree->Branch("events", &state.fEntryEvents, "events/L");
+  fSampleTree->Branch("cpu", &state.fEntryUsage.fCPU, "cpu/D");
+  fSampleTree->Branch("wall", &state.fEntryUsage.fWall, "wall/D");
+  fSampleTree->Branch("heap", &state.fEntryUsage.fHeap, "heap/D");
+  fSampleTree->Branch("nalloc", &state.fEntryUsage.fNAlloc, "nalloc/D");
+  fSampleTree->Branch("allocbytes", &state.fEntryUsage.fAllocBytes, "allocbytes/D");
+  fSampleTree->Branch("rss", &state.fEntryUsage.fRSS, "rss/D");
+  fSampleTree->Branch("rssTotal", &state.fEntryRSS, "rssTotal/D");
+  fOutput->Add(fSampleTree);
+
+  PostData(1, fOutput);
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskProfiler::UserExec(Option_t *)
+{
+  // Usage since the previous probe, attributed to the wagon in between.
+
+  State_t &state = State();
+  const Int_t nBins = state.fUsage.size();
+  if (!state.fOwner || fProbeIndex >= nBins) return;
+
+  const Bool_t isLast = fProbeIndex == nBins - 1;
+  if (fProbeIndex == 0) {
+    state.fNEvents++;
+    state.fSampling = state.fNEventsSample > 0 && state.fNEvents % state.fNEventsSample == 0;
+  }
+  // the last probe of the event before a sampled one starts the event loop measurement
+  const Bool_t rss = state.fSampling || (isLast && state.fNEventsSample > 0 && (state.fNEvents + 1) % state.fNEventsSample == 0);
+
+  Stamp_t now;
+  Measure(now, state.fHeapTracking, rss);
+  if (state.fHasLast) {
+    Usage_t &usage = state.fUsage[fProbeIndex];
+    usage.fCPU += now.fCPU - state.fLast.fCPU;
+    usage.fWall += now.fWall - state.fLast.fWall;
+    usage.fHeap += now.fHeap - state.fLast.fHeap;
+    usage.fNAlloc += Double_t(now.fNAlloc - state.fLast.fNAlloc);
+    usage.fAllocBytes += Double_t(now.fAllocBytes - state.fLast.fAllocBytes);
+    if (state.fSampling && state.fLast.fRSS > 0 && now.fRSS > 0) usage.fRSS += now.fRSS - state.fLast.fRSS;
+  }
+  state.fLast = now;
+  state.fHasLast = kTRUE;
+
+  if (isLast && state.fSampling) state.fOwner->Flush();
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskProfiler::Flush()
+{
+  // Usage since the previous flush into the histograms and the tree.
+
+  State_t &state = State();
+  if (!fOutput) return;
+
+  state.fEntryEvents = state.fNEvents;
+  state.fEntryRSS = state.fLast.fRSS;
+  for (UInt_t i = 0; i < state.fUsage.size(); i++) {
+    Usage_t &usage = state.fUsage[i];
+    fHistCPUTime->Fill(i, usage.fCPU);
+    fHistWallTime->Fill(i, usage.fWall);
+    fHistHeapGrowth->Fill(i, usage.fHeap);
+    fHistAllocations->Fill(i, usage.fNAlloc);
+    fHistAllocatedBytes->Fill(i, usage.fAllocBytes);
+    fHistRSSGrowth->Fill(i, usage.fRSS);
+    state.fEntryWagon = i;
+    state.fEntryUsage = usage;
+    fSampleTree->Fill();
+    usage = Usage_t();
+  }
+  fHistEvents->Fill(0., state.fNEvents - state.fNEventsFlushed);
+  state.fNEventsFlushed = state.fNEvents;
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskProfiler::FinishTaskOutput()
+{
+  if (fProbeIndex || State().fOwner != this) return;
+  Flush();
+  PostData(1, fOutput);
+}
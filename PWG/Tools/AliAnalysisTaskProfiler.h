@@ -0,0 +1,82 @@
+#ifndef ALIANALYSISTASKPROFILER_H
+#define ALIANALYSISTASKPROFILER_H
+/* Copyright(c) 1998-2015, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <vector>
+#include <TString.h>
+#include "AliAnalysisTaskSE.h"
+
+class TH1;
+class TList;
+class TTree;
+
+/**
+ * \class AliAnalysisTaskProfiler
+ * \brief Per wagon CPU time, wall time, heap and memory usage of a train.
+ *
+ * AddProfiler() puts a probe task in front of the first wagon and after each
+ * wagon of the train (top tasks of the analysis manager); the resources used
+ * between two consecutive probes are those of the wagon in between, the ones
+ * between the last probe of an event and the first of the next event those of
+ * the event loop (input, handlers). It has to be called after all the wagons
+ * are added and before AliAnalysisManager::InitAnalysis().
+ *
+ * Measured per wagon:
+ *  - CPU and wall time,
+ *  - heap growth (bytes in use, glibc only, SetHeapTracking()),
+ *  - number and bytes of the allocations, if an allocation counter is set with
+ *    SetAllocationCounter() or provided by a preloaded library (see the cxx),
+ *  - resident memory growth, measured within the events sampled every N events.
+ * The first probe owns the output: one histogram per quantity with a bin per
+ * wagon, and a tree with one entry per wagon every N events.
+ */
+class AliAnalysisTaskProfiler : public AliAnalysisTaskSE {
+public:
+  /// Number and bytes of the allocations done so far by the process
+  typedef void (*AllocationCounter_t)(ULong64_t &nAllocations, ULong64_t &nBytes);
+
+  AliAnalysisTaskProfiler();
+  AliAnalysisTaskProfiler(const char *name, Int_t probeIndex);
+  virtual ~AliAnalysisTaskProfiler();
+
+  static AliAnalysisTaskProfiler *AddProfiler(Int_t nEventsSample = 1000, Bool_t heapTracking = kFALSE, const char *name = "Profiler");
+  static void SetAllocationCounter(AllocationCounter_t counter);
+
+  virtual void UserCreateOutputObjects();
+  virtual void UserExec(Option_t *);
+  virtual void FinishTaskOutput();
+  virtual void Terminate(Option_t *) {}
+
+  void SetNEventsSample(Int_t nEvents) { fNEventsSample = nEvents; }
+  void SetHeapTracking(Bool_t b) { fHeapTracking = b; }
+  void SetWagonNames(const std::vector<TString> &names) { fWagonNames = names; }
+
+  Int_t GetProbeIndex() const { return fProbeIndex; }
+  Int_t GetNWagons() const { return fWagonNames.size(); }
+
+private:
+  AliAnalysisTaskProfiler(const AliAnalysisTaskProfiler &);
+  AliAnalysisTaskProfiler &operator=(const AliAnalysisTaskProfiler &);
+
+  TH1 *CreateWagonHistogram(const char *name, const char *title);
+  void Flush();
+
+  Int_t                 fProbeIndex;         ///< 0 for the owner in front of the first wagon, i after wagon i
+  Int_t                 fNEventsSample;      ///< events between two samples (tree entries, resident memory)
+  Bool_t                fHeapTracking;       ///< heap in use measured at each probe (mallinfo)
+  std::vector<TString>  fWagonNames;         ///< names of the wagons, owner only
+  TList                *fOutput;             //!<! output list, owner only
+  TH1                  *fHistCPUTime;        //!<! CPU time per wagon [s]
+  TH1                  *fHistWallTime;       //!<! wall time per wagon [s]
+  TH1                  *fHistHeapGrowth;     //!<! heap growth per wagon [bytes]
+  TH1                  *fHistAllocations;    //!<! allocations per wagon
+  TH1                  *fHistAllocatedBytes; //!<! allocated bytes per wagon
+  TH1                  *fHistRSSGrowth;      //!<! resident memory growth per wagon in the sampled events [kB]
+  TH1                  *fHistEvents;         //!<! number of events
+  TTree                *fSampleTree;         //!<! per wagon values every fNEventsSample events
+
+  ClassDef(AliAnalysisTaskProfiler, 1);
+};
+
+#endif /* ALIANALYSISTASKPROFILER_H */
@@ -0,0 +1,197 @@
+// $Id$
+//
+// Per event store of named values shared between wagons.
+//
+// Producers register a named slot once (e.g. in UserCreateOutputObjects)
+// and get an integer key; consumers look up the key once by name and then
+// read the values of each event by key, without the string comparisons of
+// FindListObject(). Values are valid for the event in which they were set
+// (the current entry of the analysis manager). Slots flagged with
+// SetLegacyExport() are also copied to AliNamedArrayI/AliNamedString objects
+// in the list of objects of the event by ExportToEvent(), for the consumers
+// still using FindListObject().
+
+#include <iostream>
+
+#include <TArrayI.h>
+
+#include "AliAnalysisManager.h"
+#include "AliLog.h"
+#include "AliNamedArrayI.h"
+#include "AliNamedString.h"
+#include "AliVEvent.h"
+
+#include "AliEventBlackboard.h"
+
+ClassImp(AliEventBlackboard)
+
+//________________________________________________________________________
+AliEventBlackboard::AliEventBlackboard() : 
+  TNamed("AliEventBlackboard","AliEventBlackboard"),
+  fSlots(),
+  fKeys(),
+  fInts(),
+  fDoubles(),
+  fStrings(),
+  fEntry(0)
+{
+  // Dummy constructor.
+
+}
+
+//________________________________________________________________________
+AliEventBlackboard::AliEventBlackboard(const char *name) : 
+  TNamed(name,name),
+  fSlots(),
+  fKeys(),
+  fInts(),
+  fDoubles(),
+  fStrings(),
+  fEntry(0)
+{
+  // Standard constructor.
+
+}
+
+//________________________________________________________________________
+AliEventBlackboard *AliEventBlackboard::Instance()
+{
+  // Blackboard shared by all the tasks of the job.
+
+  static AliEventBlackboard instance("AliEventBlackboard");
+  return &instance;
+}
+
+//________________________________________________________________________
+Int_t AliEventBlackboard::Register(const char *name, ESlotType_t type, Int_t size)
+{
+  // Register a slot, the key of an already registered slot with the same
+  // name is returned if type and size match, -1 otherwise.
+
+  std::map<std::string,Int_t>::const_iterator found = fKeys.find(name);
+  if (found != fKeys.end()) {
+    const Slot &slot = fSlots[found->second];
+    if (slot.fType != type || slot.fSize != size) {
+      AliError(Form("Slot %s already registered with a different type or size", name));
+      return -1;
+    }
+    return found->second;
+  }
+  if (size < 1) {
+    AliError(Form("Invalid size %d for slot %s", size, name));
+    return -1;
+  }
+
+  Slot slot;
+  slot.fName   = name;
+  slot.fType   = type;
+  slot.fSize   = size;
+  slot.fEntry  = -1;
+  slot.fExport = kFALSE;
+  switch (type) {
+  case kInt:
+    slot.fOffset = fInts.size();
+    fInts.resize(fInts.size()+size, -1);
+    break;
+  case kDouble:
+    slot.fOffset = fDoubles.size();
+    fDoubles.resize(fDoubles.size()+size, 0.);
+    break;
+  case kString:
+    slot.fOffset = fStrings.size();
+    fStrings.resize(fStrings.size()+1);
+    break;
+  }
+  fSlots.push_back(slot);
+  Int_t key = fSlots.size()-1;
+  fKeys[slot.fName] = key;
+  return key;
+}
+
+//________________________________________________________________________
+void AliEventBlackboard::SetLegacyExport(Int_t key, Bool_t b)
+{
+  // Flag the slot for ExportToEvent(), only integer and string slots.
+
+  if (key < 0 || key >= (Int_t)fSlots.size()) return;
+  if (fSlots[key].fType == kDouble) {
+    AliWarning(Form("No legacy object for the double slot %s", fSlots[key].fName.c_str()));
+    return;
+  }
+  fSlots[key].fExport = b;
+}
+
+//________________________________________________________________________
+Int_t AliEventBlackboard::GetKey(const char *name) const
+{
+  // Key of the slot.
+
+  std::map<std::string,Int_t>::const_iterator found = fKeys.find(name);
+  return found != fKeys.end() ? found->second : -1;
+}
+
+//________________________________________________________________________
+Long64_t AliEventBlackboard::GetEntry() const
+{
+  // Current event.
+
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  return mgr ? mgr->GetCurrentEntry() : fEntry;
+}
+
+//________________________________________________________________________
+void AliEventBlackboard::ExportToEvent(AliVEvent *event) const
+{
+  // Copy the exported slots set in this event to the list of objects of
+  // the event, creating the objects on the first call.
+
+  if (!event) return;
+  for (std::vector<Slot>::const_iterator slot = fSlots.begin(); slot != fSlots.end(); ++slot) {
+    if (!slot->fExport || slot->fEntry != GetEntry()) continue;
+    TObject *obj = event->FindListObject(slot->fName.c_str());
+    if (slot->fType == kInt) {
+      AliNamedArrayI *array = dynamic_cast<AliNamedArrayI*>(obj);
+      if (!array) {
+        if (obj) continue;
+        array = new AliNamedArrayI(slot->fName.c_str(), slot->fSize);
+        event->AddObject(array);
+      }
+      array->Set(slot->fSize, &fInts[slot->fOffset]);
+    }
+    else {
+      AliNamedString *string = dynamic_cast<AliNamedString*>(obj);
+      if (!string) {
+        if (obj) continue;
+        string = new AliNamedString(slot->fName.c_str());
+        event->AddObject(string);
+      }
+      string->SetString(fStrings[slot->fOffset].c_str());
+    }
+  }
+}
+
+//________________________________________________________________________
+void AliEventBlackboard::Reset()
+{
+  // Remove all the slots, the keys become invalid.
+
+  fSlots.clear();
+  fKeys.clear();
+  fInts.clear();
+  fDoubles.clear();
+  fStrings.clear();
+}
+
+//________________________________________________________________________
+void AliEventBlackboard::Print(Option_t * /*option*/) const
+{
+  // Print the registered slots.
+
+  static const char *types[3] = {"int", "double", "string"};
+  std::cout << GetName() << ": " << fSlots.size() << " slots" << std::endl;
+  for (UInt_t key = 0; key < fSlots.size(); key++) {
+    const Slot &slot = fSlots[key];
+    std::cout << "  " << key << ": " << slot.fName << " (" << types[slot.fType] << "[" << slot.fSize << "]"
+              << (slot.fExport ? ", exported" : "") << ")" << std::endl;
+  }
+}
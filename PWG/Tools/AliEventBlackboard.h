@@ -0,0 +1,83 @@
+#ifndef ALIEVENTBLACKBOARD_H
+#define ALIEVENTBLACKBOARD_H
+
+// $Id$
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <TNamed.h>
+
+class AliVEvent;
+
+class AliEventBlackboard : public TNamed {
+ public:
+  enum ESlotType_t { kInt = 0, kDouble = 1, kString = 2 };
+
+  AliEventBlackboard();
+  AliEventBlackboard(const char *name);
+
+  static AliEventBlackboard *Instance();
+
+  // producers, once per job: the returned key is valid for the whole job
+  Int_t       RegisterInt(const char *name, Int_t size = 1)            { return Register(name, kInt, size)      ; }
+  Int_t       RegisterDouble(const char *name, Int_t size = 1)         { return Register(name, kDouble, size)   ; }
+  Int_t       RegisterString(const char *name)                         { return Register(name, kString, 1)      ; }
+  void        SetLegacyExport(Int_t key, Bool_t b = kTRUE);
+
+  // consumers, once per job: -1 if the slot is not registered
+  Int_t       GetKey(const char *name)                           const;
+  Int_t       GetSize(Int_t key)                                 const { return fSlots[key].fSize             ; }
+  ESlotType_t GetType(Int_t key)                                 const { return fSlots[key].fType             ; }
+  const char *GetSlotName(Int_t key)                             const { return fSlots[key].fName.c_str()     ; }
+  Int_t       GetNSlots()                                        const { return fSlots.size()                 ; }
+
+  // per event access by key
+  void        SetInt(Int_t key, Int_t value, Int_t index = 0)          { fInts[fSlots[key].fOffset+index] = value    ; Touch(key); }
+  void        SetDouble(Int_t key, Double_t value, Int_t index = 0)    { fDoubles[fSlots[key].fOffset+index] = value ; Touch(key); }
+  void        SetString(Int_t key, const char *value)                  { fStrings[fSlots[key].fOffset] = value       ; Touch(key); }
+  Bool_t      HasValue(Int_t key)                                const { return fSlots[key].fEntry == GetEntry()      ; }
+  Int_t       GetInt(Int_t key, Int_t index = 0)                 const { return HasValue(key) ? fInts[fSlots[key].fOffset+index] : -1                 ; }
+  Double_t    GetDouble(Int_t key, Int_t index = 0)              const { return HasValue(key) ? fDoubles[fSlots[key].fOffset+index] : 0.              ; }
+  const char *GetString(Int_t key)                               const { return HasValue(key) ? fStrings[fSlots[key].fOffset].c_str() : ""            ; }
+  const Int_t    *GetIntArray(Int_t key)                         const { return &fInts[fSlots[key].fOffset]    ; }
+  const Double_t *GetDoubleArray(Int_t key)                      const { return &fDoubles[fSlots[key].fOffset] ; }
+
+  // without an analysis manager the event has to be set explicitly
+  void        SetEntry(Long64_t entry)                                 { fEntry = entry ; }
+  Long64_t    GetEntry()                                         const;
+
+  // AliNamedArrayI/AliNamedString copies of the exported slots for FindListObject()
+  void        ExportToEvent(AliVEvent *event)                    const;
+
+  void        Reset();
+  void        Print(Option_t *option = "")                       const;
+
+ protected:
+  struct Slot {
+    std::string fName;   // name, also used for the legacy objects
+    ESlotType_t fType;   // value type
+    Int_t       fOffset; // first value in the storage of the type
+    Int_t       fSize;   // number of values
+    Long64_t    fEntry;  // event in which the values were set
+    Bool_t      fExport; // copied to the event by ExportToEvent()
+  };
+
+  Int_t       Register(const char *name, ESlotType_t type, Int_t size);
+  void        Touch(Int_t key)                                         { fSlots[key].fEntry = GetEntry() ; }
+
+  std::vector<Slot>           fSlots;    //! registered slots, indexed by key
+  std::map<std::string,Int_t> fKeys;     //! key of each slot name
+  std::vector<Int_t>          fInts;     //! integer values of all slots
+  std::vector<Double_t>       fDoubles;  //! double values of all slots
+  std::vector<std::string>    fStrings;  //! string values of all slots
+  Long64_t                    fEntry;    //! event, if not taken from the analysis manager
+
+ private:
+  AliEventBlackboard(const AliEventBlackboard&);             // not implemented
+  AliEventBlackboard& operator=(const AliEventBlackboard&);  // not implemented
+
+  ClassDef(AliEventBlackboard, 1); // Per event store of named values accessed by key
+};
+#endif
@@ -29,6 +29,7 @@
 #include "AliStack.h"            
 #include "AliVTrack.h"      
 #include "TParticle.h"
+#include "TMath.h"
 #include "AliAODMCParticle.h" 
 #include "AliPIDResponse.h"   
 #include "AliPIDCombined.h"   
@@ -44,7 +45,7 @@ const char * kParticleSpeciesName[]={"Pions","Kaons","Protons","Undefined"} ;
 
 ClassImp(AliHelperPID)
 
-AliHelperPID::AliHelperPID() : TNamed("HelperPID", "PID object"),fisMC(0), fPIDType(kNSigmaTPCTOF), fNSigmaPID(3), fBayesCut(0.8), fPIDResponse(0x0), fPIDCombined(0x0),fOutputList(0x0),fRequestTOFPID(1),fRemoveTracksT0Fill(0),fUseExclusiveNSigma(0),fPtTOFPID(.6),fHasTOFPID(0){
+AliHelperPID::AliHelperPID() : TNamed("HelperPID", "PID object"),fisMC(0), fPIDType(kNSigmaTPCTOF), fNSigmaPID(3), fBayesCut(0.8), fPIDResponse(0x0), fPIDCombined(0x0),fOutputList(0x0),fRequestTOFPID(1),fRemoveTracksT0Fill(0),fUseExclusiveNSigma(0),fPtTOFPID(.6),fHasTOFPID(0),fUseCache(kTRUE),fCache(),fCacheGeneration(1),fCacheEntry(-1),fInCacheFill(kFALSE){
 
   // Fixing Leaks 
   Bool_t oldStatus = TH1::AddDirectoryStatus();
@@ -175,6 +176,15 @@ Int_t AliHelperPID::GetParticleSpecies(AliVTrack * trk, Bool_t FIllQAHistos){
     AliFatal("Cannot get pid response");
   }
   
+  //decision already taken for this track in this event: restore the data members from the cache
+  TrackPIDCache *cache = GetTrackCache(trk);
+  if(cache && cache->fSpecies>=0 && !FIllQAHistos){
+    CalculateNSigmas(trk,kFALSE);
+    for(Int_t ipart=0;ipart<kNSpecies;ipart++)fHasDoubleCounting[ipart]=cache->fHasDoubleCounting[ipart];
+    if(fPIDType==kBayes && cache->fSpecies!=kSpUndefined)FillBayesQA(trk,cache->fSpecies,cache->fBayesProb);
+    return cache->fSpecies;
+  }
+  
   //calculate nsigmas (used also by the bayesian)
   CalculateNSigmas(trk,FIllQAHistos);//fill the data member fnsigmas with the nsigmas value [ipart][iPID]
   
@@ -206,6 +216,13 @@ Int_t AliHelperPID::GetParticleSpecies(AliVTrack * trk, Bool_t FIllQAHistos){
     }
   }
 
+  //store the decision, the track entry is fetched again as the cache is keyed by track
+  cache = GetTrackCache(trk);
+  if(cache){
+    cache->fSpecies = ID;
+    for(Int_t ipart=0;ipart<kNSpecies;ipart++)cache->fHasDoubleCounting[ipart]=fHasDoubleCounting[ipart];
+  }
+
   if(FIllQAHistos){
     //Fill PID signal plot
     if(ID != kSpUndefined){
@@ -273,18 +290,15 @@ Int_t AliHelperPID::GetIDBayes(AliVTrack * trk, Bool_t FIllQAHistos){
   
   //probabilities are normalized to one, if the cut is above .5 there is no problem
   if(probBayes[AliPID::kPion]>fBayesCut && IDs[kSpPion]==1){
-    TH2F *h=GetHistogram2D(Form("BayesRec_%d",kSpPion));
-    h->Fill(trk->Pt(),probBayes[AliPID::kPion]);
+    FillBayesQA(trk,kSpPion,probBayes[AliPID::kPion]);
     return kSpPion;
   }
   else if(probBayes[AliPID::kKaon]>fBayesCut && IDs[kSpKaon]==1){
-    TH2F *h=GetHistogram2D(Form("BayesRec_%d",kSpKaon));
-    h->Fill(trk->Pt(),probBayes[AliPID::kKaon]);
+    FillBayesQA(trk,kSpKaon,probBayes[AliPID::kKaon]);
     return kSpKaon;
   }
   else if(probBayes[AliPID::kProton]>fBayesCut && IDs[kSpProton]==1){
-    TH2F *h=GetHistogram2D(Form("BayesRec_%d",kSpProton));
-    h->Fill(trk->Pt(),probBayes[AliPID::kProton]);
+    FillBayesQA(trk,kSpProton,probBayes[AliPID::kProton]);
     return kSpProton;
   }
   else{
@@ -309,8 +323,42 @@ UInt_t AliHelperPID::CalcPIDCombined(const AliVTrack *track,const AliPIDResponse
 
 //////////////////////////////////////////////////////////////////////////////////////////////////
 
+void AliHelperPID::FillBayesQA(AliVTrack * trk, Int_t species, Double_t prob){
+  //fill the Bayesian probability of the identified track, the probability is kept in the cache
+  TrackPIDCache *cache = GetTrackCache(trk);
+  if(cache)cache->fBayesProb=prob;
+  if(fInCacheFill)return;//filled when the track is requested
+  TH2F *h=GetHistogram2D(Form("BayesRec_%d",species));
+  h->Fill(trk->Pt(),prob);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
 void AliHelperPID::CalculateNSigmas(AliVTrack * trk, Bool_t FIllQAHistos){ 
-  //defines data member fnsigmas
+  //defines data member fnsigmas, taken from the cache if already calculated for the track in this event
+  TrackPIDCache *cache = GetTrackCache(trk);
+  if(cache && (cache->fStatus & TrackPIDCache::kNSigmaDone)){
+    for(Int_t ipart=0;ipart<kNSpecies;ipart++)
+      for(Int_t ipid=0;ipid<=kNSigmaPIDType;ipid++)
+	fnsigmas[ipart][ipid]=cache->fNSigmas[ipart][ipid];
+    CheckTOF(trk);
+  }else{
+    ComputeNSigmas(trk);
+    cache = GetTrackCache(trk);
+    if(cache){
+      for(Int_t ipart=0;ipart<kNSpecies;ipart++)
+	for(Int_t ipid=0;ipid<=kNSigmaPIDType;ipid++)
+	  cache->fNSigmas[ipart][ipid]=fnsigmas[ipart][ipid];
+      cache->fStatus |= TrackPIDCache::kNSigmaDone;
+    }
+  }
+  if(FIllQAHistos)FillNSigmaQA(trk);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+void AliHelperPID::ComputeNSigmas(AliVTrack * trk){ 
+  //defines data member fnsigmas from the PID response
   
   // Compute nsigma for each hypthesis
   AliVParticle *inEvHMain = dynamic_cast<AliVParticle *>(trk);
@@ -370,15 +418,17 @@ void AliHelperPID::CalculateNSigmas(AliVTrack * trk, Bool_t FIllQAHistos){
   fnsigmas[kSpPion][kNSigmaTPCTOF]=nsigmaTPCTOFkPion;
   fnsigmas[kSpKaon][kNSigmaTPCTOF]=nsigmaTPCTOFkKaon;
   fnsigmas[kSpProton][kNSigmaTPCTOF]=nsigmaTPCTOFkProton;
-  
-  if(FIllQAHistos){
-    //Fill NSigma SeparationPlot
-    for(Int_t ipart=0;ipart<kNSpecies;ipart++){
-      for(Int_t ipid=0;ipid<=kNSigmaPIDType;ipid++){
-	if((ipid!=kNSigmaTPC) && (!fHasTOFPID) && trk->Pt()<fPtTOFPID)continue;//not filling TOF and combined if no TOF PID
-	TH2F *h=GetHistogram2D(Form("NSigma_%d_%d",ipart,ipid));
-	h->Fill(trk->Pt(),fnsigmas[ipart][ipid]);
-      }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+void AliHelperPID::FillNSigmaQA(AliVTrack * trk){ 
+  //Fill NSigma SeparationPlot
+  for(Int_t ipart=0;ipart<kNSpecies;ipart++){
+    for(Int_t ipid=0;ipid<=kNSigmaPIDType;ipid++){
+      if((ipid!=kNSigmaTPC) && (!fHasTOFPID) && trk->Pt()<fPtTOFPID)continue;//not filling TOF and combined if no TOF PID
+      TH2F *h=GetHistogram2D(Form("NSigma_%d_%d",ipart,ipid));
+      h->Fill(trk->Pt(),fnsigmas[ipart][ipid]);
     }
   }
 }
@@ -603,6 +653,13 @@ void AliHelperPID::CheckTOF(AliVTrack * trk)
 {
   //check if the particle has TOF Matching
   
+  //already checked for this track in this event
+  TrackPIDCache *cache = GetTrackCache(trk);
+  if(cache && (cache->fStatus & TrackPIDCache::kTOFDone)){
+    fHasTOFPID=cache->fHasTOFPID;
+    return;
+  }
+  
   //get the PIDResponse
   if(fPIDResponse->CheckPIDStatus(AliPIDResponse::kTOF,trk)==0)fHasTOFPID=kFALSE;
   else fHasTOFPID=kTRUE;
@@ -615,6 +672,58 @@ void AliHelperPID::CheckTOF(AliVTrack * trk)
       Int_t startTimeMask = fPIDResponse->GetTOFResponse().GetStartTimeMask(trk->P());
       if (startTimeMask < 0)fHasTOFPID=kFALSE; 
     }
+  
+  if(cache){
+    cache->fHasTOFPID=fHasTOFPID;
+    cache->fStatus |= TrackPIDCache::kTOFDone;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+AliHelperPID::TrackPIDCache* AliHelperPID::GetTrackCache(AliVTrack * trk)
+{
+  //entry of the track in the per-event cache, 0x0 if the cache is not used
+  //the cache is valid for one entry of the analysis manager and is keyed by the track ID,
+  //the entry is re-evaluated if the track object or its pt differ
+  if(!fUseCache || !trk)return 0x0;
+  AliAnalysisManager *man = AliAnalysisManager::GetAnalysisManager();
+  if(!man)return 0x0;
+  Long64_t entry = man->GetCurrentEntry();
+  if(entry!=fCacheEntry){
+    fCacheEntry=entry;
+    fCacheGeneration++;
+  }
+  
+  Int_t id = trk->GetID();
+  UInt_t index = id>=0 ? 2*id : -2*id-1;
+  if(index>=fCache.size())fCache.resize(TMath::Max(index+1,(UInt_t)(2*fCache.size())));
+  TrackPIDCache &track = fCache[index];
+  Float_t pt = trk->Pt();
+  if(track.fGeneration!=fCacheGeneration || track.fTrack!=trk || track.fPt!=pt){
+    track.fTrack=trk;
+    track.fPt=pt;
+    track.fGeneration=fCacheGeneration;
+    track.fStatus=0;
+    track.fSpecies=-1;
+    track.fBayesProb=0.;
+  }
+  return &track;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+void AliHelperPID::FillCache(AliVEvent *event)
+{
+  //evaluate the n-sigmas, TOF matching and decision of all the tracks of the event in one pass,
+  //the following GetParticleSpecies() calls for these tracks only read the cache
+  if(!event || !fUseCache || !AliAnalysisManager::GetAnalysisManager())return;
+  fInCacheFill=kTRUE;
+  for(Int_t itrk=0;itrk<event->GetNumberOfTracks();itrk++){
+    AliVTrack *trk = dynamic_cast<AliVTrack*>(event->GetTrack(itrk));
+    if(trk)GetParticleSpecies(trk,kFALSE);
+  }
+  fInCacheFill=kFALSE;
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////
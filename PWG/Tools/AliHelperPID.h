@@ -14,6 +14,7 @@ class AliPIDResponse;
 class AliPIDCombined;  
 
 #include "TNamed.h"
+#include <vector>
 
 namespace AliHelperPIDNameSpace {
   
@@ -67,29 +68,34 @@ class AliHelperPID : public TNamed
   Bool_t GetisMC(){return   fisMC;}
   void SetisMC(Bool_t mc){fisMC=mc;}
   //PID Type
-  void SetPIDType(PIDType_t PIDType) { fPIDType = PIDType; }
+  void SetPIDType(PIDType_t PIDType) { fPIDType = PIDType; ResetCache(); }
   PIDType_t GetPIDType() {return fPIDType; }
   //NSigma cut
-  void SetNSigmaCut(Double_t nsigma) { fNSigmaPID = nsigma; }
+  void SetNSigmaCut(Double_t nsigma) { fNSigmaPID = nsigma; ResetCache(); }
   Double_t GetNSigmaCut() {return fNSigmaPID; }
   //TOF PID
-  void SetfRequestTOFPID(Bool_t tof){fRequestTOFPID=tof;}//fRequestTOFPID
+  void SetfRequestTOFPID(Bool_t tof){fRequestTOFPID=tof; ResetCache();}//fRequestTOFPID
   Bool_t GetfRequestTOFPID(){return   fRequestTOFPID;}//fRequestTOFPID
-  void SetfRemoveTracksT0Fill(Bool_t tof){fRemoveTracksT0Fill=tof;}//fRemoveTracksT0Fill
+  void SetfRemoveTracksT0Fill(Bool_t tof){fRemoveTracksT0Fill=tof; ResetCache();}//fRemoveTracksT0Fill
   Bool_t GetfRemoveTracksT0Fill(){return   fRemoveTracksT0Fill;}//fRemoveTracksT0Fill
   //Exclusive NSIgma
-  void SetfUseExclusiveNSigma(Bool_t nsigEx){fUseExclusiveNSigma=nsigEx;}//fUseExclusiveNSigma
+  void SetfUseExclusiveNSigma(Bool_t nsigEx){fUseExclusiveNSigma=nsigEx; ResetCache();}//fUseExclusiveNSigma
   Bool_t GetfUseExclusiveNSigma(){return   fUseExclusiveNSigma;}//fUseExclusiveNSigma
   //lower pt fot TOF PID
   Double_t GetPtTOFPID(){return   fPtTOFPID;}
-  void SetfPtTOFPID(Double_t pttof){fPtTOFPID=pttof;}
+  void SetfPtTOFPID(Double_t pttof){fPtTOFPID=pttof; ResetCache();}
   //set PID Combined
-  void SetPIDCombined(AliPIDCombined *obj){fPIDCombined=obj;}
+  void SetPIDCombined(AliPIDCombined *obj){fPIDCombined=obj; ResetCache();}
   //void SetPIDCombined(AliPIDCombined *obj){Printf("void AliHelperPID::SetPIDCombined(AliPIDCombined *obj) not implemented");}  //FIXME Left for backward compatibility, not the PIDCombined onject is created in the constructor as done in /ANALYSIS/AliAnalysisTaskPIDCombined.cxx (Jul 15th 2014)
   AliPIDCombined *GetPIDCombined(){return fPIDCombined;}
   //set cut on beyesian probability
-  void SetBayesCut(Double_t cut){fBayesCut=cut;}
+  void SetBayesCut(Double_t cut){fBayesCut=cut; ResetCache();}
   Double_t GetBayesCut(){return fBayesCut;}
+  //per-event cache of the n-sigmas, TOF matching and decision, by track ID (only with an analysis manager)
+  void SetUseCache(Bool_t cache){fUseCache=cache; ResetCache();}
+  Bool_t GetUseCache(){return fUseCache;}
+  void ResetCache(){fCacheGeneration++;}//invalidate all cached tracks
+  void FillCache(AliVEvent *event);//evaluate the PID of all tracks of the event in one pass
   
   //getters of the other data members
   TList * GetOutputList() {return fOutputList;}//get the TList with histos
@@ -116,6 +122,25 @@ class AliHelperPID : public TNamed
   Long64_t Merge(TCollection* list);
   
  private:
+
+  //cached PID information of one track, valid for fGeneration
+  struct TrackPIDCache {
+    enum { kTOFDone = BIT(0), kNSigmaDone = BIT(1) };
+    const AliVTrack *fTrack;   // track the entry was evaluated for
+    Float_t fPt;               // pt of the track, against reused track objects
+    UInt_t fGeneration;        // generation of the cache the entry belongs to
+    UChar_t fStatus;           // kTOFDone, kNSigmaDone
+    Bool_t fHasTOFPID;         // result of CheckTOF
+    Short_t fSpecies;          // result of GetParticleSpecies, -1 if not evaluated
+    Double_t fBayesProb;       // probability of the species for the Bayesian PID
+    Bool_t fHasDoubleCounting[kNSpecies]; // fHasDoubleCounting after GetParticleSpecies
+    Double_t fNSigmas[kNSpecies][kNSigmaPIDType+1]; // nsigma values
+  };
+
+  TrackPIDCache *GetTrackCache(AliVTrack *trk);
+  void ComputeNSigmas(AliVTrack *trk);
+  void FillNSigmaQA(AliVTrack *trk);
+  void FillBayesQA(AliVTrack *trk, Int_t species, Double_t prob);
   
   Bool_t fisMC;
   PIDType_t fPIDType; // PID type
@@ -131,11 +156,16 @@ class AliHelperPID : public TNamed
   Bool_t fUseExclusiveNSigma;//if true returns the identity only if no double counting
   Double_t fPtTOFPID; //lower pt bound for the TOF pid
   Bool_t fHasTOFPID;
+  Bool_t fUseCache; //per-event cache of the PID decisions by track ID
+  std::vector<TrackPIDCache> fCache; //! cached tracks, indexed by ID (negative IDs interleaved)
+  UInt_t fCacheGeneration; //! current generation of the cache, incremented per event and setting change
+  Long64_t fCacheEntry; //! analysis manager entry of the cache
+  Bool_t fInCacheFill; //! in FillCache(), no QA histograms are filled
   
   AliHelperPID(const AliHelperPID&);
   AliHelperPID& operator=(const AliHelperPID&);
   
-  ClassDef(AliHelperPID, 8);
+  ClassDef(AliHelperPID, 9);
   
 };
 #endif
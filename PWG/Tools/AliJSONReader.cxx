@@ -5,12 +5,166 @@
  *      Author: markusfasel
  */
 
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
 #include <TList.h>
 #include <TString.h>
+#include <TSystem.h>
 
 #include "AliJSONData.h"
 #include "AliJSONReader.h"
 
+namespace {
+
+/*
+ * Selection of keys by full path, shared by the tree and map builders
+ */
+class AliJSONPathSelection {
+public:
+  AliJSONPathSelection(const std::vector<std::string> &keys):
+    fKeys(keys),
+    fPaths(),
+    fInside()
+  {
+    fPaths.push_back("");
+    fInside.push_back(keys.empty());
+  }
+
+  bool Enter(const char *key){
+    std::string path = Child(key);
+    bool inside = fInside.back() || IsSelected(path);
+    if(!(inside || IsParent(path))) return false;
+    fPaths.push_back(path);
+    fInside.push_back(inside);
+    return true;
+  }
+
+  void Leave(){
+    fPaths.pop_back();
+    fInside.pop_back();
+  }
+
+  bool Accept(const char *key, std::string &path) const {
+    path = Child(key);
+    return fInside.back() || IsSelected(path);
+  }
+
+private:
+  std::string Child(const char *key) const {
+    return fPaths.back().length() ? fPaths.back() + "/" + key : std::string(key);
+  }
+
+  bool IsSelected(const std::string &path) const {
+    for(std::vector<std::string>::const_iterator it = fKeys.begin(); it != fKeys.end(); it++)
+      if(path == *it) return true;
+    return false;
+  }
+
+  bool IsParent(const std::string &path) const {
+    // the path leads to a selected key
+    for(std::vector<std::string>::const_iterator it = fKeys.begin(); it != fKeys.end(); it++)
+      if(it->length() > path.length() && (*it)[path.length()] == '/' && !it->compare(0, path.length(), path)) return true;
+    return false;
+  }
+
+  const std::vector<std::string> &fKeys;
+  std::vector<std::string> fPaths;
+  std::vector<bool> fInside;
+};
+
+/*
+ * Builds the same TList tree as AliJSONReader::Decode, in the order of the document
+ */
+class AliJSONTreeBuilder : public AliJSONStreamHandler {
+public:
+  AliJSONTreeBuilder(const std::vector<std::string> &keys):
+    AliJSONStreamHandler(),
+    fSelection(keys),
+    fLists(),
+    fPath()
+  {
+    fLists.push_back(new TList);
+  }
+
+  virtual ~AliJSONTreeBuilder(){
+    // only left in case of a syntax error
+    for(std::vector<TList *>::iterator it = fLists.begin(); it != fLists.end(); it++){
+      (*it)->SetOwner(kTRUE);
+      delete *it;
+    }
+  }
+
+  virtual bool BeginObject(const char *key){
+    if(!fSelection.Enter(key)) return false;
+    TList *entries = new TList;
+    entries->SetName(key);
+    fLists.push_back(entries);
+    return true;
+  }
+
+  virtual void EndObject(){
+    TList *entries = fLists.back();
+    fLists.pop_back();
+    fSelection.Leave();
+    if(entries->GetEntries()) fLists.back()->Add(entries);
+    else delete entries;
+  }
+
+  virtual void Value(const char *key, const char *value){
+    if(fSelection.Accept(key, fPath)) fLists.back()->Add(new AliJSONData(key, value));
+  }
+
+  TList *Release(){
+    TList *result = fLists.front();
+    fLists.clear();
+    return result;
+  }
+
+private:
+  AliJSONPathSelection fSelection;
+  std::vector<TList *> fLists;
+  std::string fPath;
+};
+
+class AliJSONMapBuilder : public AliJSONStreamHandler {
+public:
+  AliJSONMapBuilder(const std::vector<std::string> &keys, AliJSONTypedMap &result):
+    AliJSONStreamHandler(),
+    fSelection(keys),
+    fResult(result),
+    fPath()
+  {
+  }
+  virtual ~AliJSONMapBuilder() {}
+
+  virtual bool BeginObject(const char *key) { return fSelection.Enter(key); }
+  virtual void EndObject() { fSelection.Leave(); }
+  virtual void Value(const char *key, const char *value){
+    if(fSelection.Accept(key, fPath)) fResult.Insert(fPath.c_str(), value);
+  }
+
+private:
+  AliJSONPathSelection fSelection;
+  AliJSONTypedMap &fResult;
+  std::string fPath;
+};
+
+int SkipWhitespace(std::istream &in){
+  int c = in.peek();
+  while(c == ' ' || c == '\t' || c == '\n' || c == '\r'){
+    in.get();
+    c = in.peek();
+  }
+  return c;
+}
+
+}
+
 AliJSONSyntaxTreeNode::AliJSONSyntaxTreeNode(const char *name, AliJSONSyntaxTreeNode *mother):
     fName(name),
     fMotherNode(mother),
@@ -130,3 +284,209 @@ void AliJSONReader::AddNodeToList(AliJSONSyntaxTreeNode* node, TList* consumer)
     AddNodeToList(*it, entries);
   consumer->Add(entries);
 }
+
+bool AliJSONReader::Stream(std::istream &in, AliJSONStreamHandler &handler) const {
+  int c = SkipWhitespace(in);
+  if(c != '{' && c != '[') return false;
+  in.get();
+  return StreamObject(in, handler, c == '{' ? '}' : ']');
+}
+
+bool AliJSONReader::StreamFile(const char *filename, AliJSONStreamHandler &handler) const {
+  TString fname(filename);
+  gSystem->ExpandPathName(fname);
+  std::ifstream in(fname.Data());
+  if(!in.good()) return false;
+  return Stream(in, handler);
+}
+
+bool AliJSONReader::StreamObject(std::istream &in, AliJSONStreamHandler &handler, char closing) const {
+  /*
+   * Parse the content of an object or array, the opening bracket is already consumed
+   */
+  std::string key, value;
+  int index(0);
+  while(true){
+    int c = SkipWhitespace(in);
+    if(c == EOF) return false;
+    if(c == closing){
+      in.get();
+      return true;
+    }
+    if(c == ','){
+      in.get();
+      continue;
+    }
+    if(closing == '}'){
+      if(!ReadToken(in, key)) return false;
+      if(SkipWhitespace(in) != ':') return false;
+      in.get();
+      c = SkipWhitespace(in);
+    } else {
+      key = TString::Format("%d", index++).Data();
+    }
+    if(c == '{' || c == '['){
+      in.get();
+      if(handler.BeginObject(key.c_str())){
+        if(!StreamObject(in, handler, c == '{' ? '}' : ']')) return false;
+        handler.EndObject();
+      } else if(!SkipContainer(in)) return false;
+    } else {
+      if(!ReadToken(in, value)) return false;
+      handler.Value(key.c_str(), value.c_str());
+    }
+  }
+}
+
+bool AliJSONReader::SkipContainer(std::istream &in) const {
+  int depth(1), c;
+  bool instring(false);
+  while((c = in.get()) != EOF){
+    if(instring){
+      if(c == '\\') in.get();
+      else if(c == '"') instring = false;
+    } else if(c == '"') instring = true;
+    else if(c == '{' || c == '[') depth++;
+    else if((c == '}' || c == ']') && !--depth) return true;
+  }
+  return false;
+}
+
+bool AliJSONReader::ReadToken(std::istream &in, std::string &token) const {
+  /*
+   * Read a key or simple value, either quoted (with escape sequences) or bare
+   */
+  token.clear();
+  int c = in.peek();
+  if(c == '"'){
+    in.get();
+    while((c = in.get()) != EOF){
+      if(c == '"') return true;
+      if(c != '\\'){
+        token += char(c);
+        continue;
+      }
+      switch(c = in.get()){
+      case 'b': token += '\b'; break;
+      case 'f': token += '\f'; break;
+      case 'n': token += '\n'; break;
+      case 'r': token += '\r'; break;
+      case 't': token += '\t'; break;
+      case 'u': {
+        char hex[5] = {0, 0, 0, 0, 0};
+        in.read(hex, 4);
+        long code = strtol(hex, NULL, 16);
+        if(code < 0x80) token += char(code);
+        else token += std::string("\\u") + hex;   // non-ascii kept escaped
+        break;
+      }
+      case EOF: return false;
+      default: token += char(c);
+      };
+    }
+    return false;
+  }
+  while(c != EOF && c != ',' && c != ':' && c != '}' && c != ']' && c != ' ' && c != '\t' && c != '\n' && c != '\r'){
+    token += char(in.get());
+    c = in.peek();
+  }
+  return token.length() > 0;
+}
+
+TList *AliJSONReader::DecodeSelected(std::istream &in, const std::vector<std::string> &keys) const {
+  AliJSONTreeBuilder builder(keys);
+  if(!Stream(in, builder)) return NULL;
+  return builder.Release();
+}
+
+TList *AliJSONReader::DecodeFileSelected(const char *filename, const std::vector<std::string> &keys) const {
+  AliJSONTreeBuilder builder(keys);
+  if(!StreamFile(filename, builder)) return NULL;
+  return builder.Release();
+}
+
+bool AliJSONReader::LoadMap(std::istream &in, AliJSONTypedMap &result, const std::vector<std::string> &keys) const {
+  AliJSONMapBuilder builder(keys, result);
+  return Stream(in, builder);
+}
+
+bool AliJSONReader::LoadMapFromFile(const char *filename, AliJSONTypedMap &result, const std::vector<std::string> &keys) const {
+  AliJSONMapBuilder builder(keys, result);
+  return StreamFile(filename, builder);
+}
+
+AliJSONTypedMap::AliJSONTypedMap():
+    fBools(),
+    fInts(),
+    fDoubles(),
+    fStrings()
+{
+}
+
+void AliJSONTypedMap::Insert(const char *key, const char *value) {
+  fBools.erase(key);
+  fInts.erase(key);
+  fDoubles.erase(key);
+  fStrings.erase(key);
+
+  if(!strcmp(value, "true")) { fBools[key] = kTRUE; return; }
+  if(!strcmp(value, "false")) { fBools[key] = kFALSE; return; }
+  if(*value){
+    char *end(NULL);
+    errno = 0;
+    long intval = strtol(value, &end, 10);
+    if(!*end && !errno && intval >= INT_MIN && intval <= INT_MAX) { fInts[key] = intval; return; }
+    double doubleval = strtod(value, &end);
+    if(!*end && !errno) { fDoubles[key] = doubleval; return; }
+  }
+  fStrings[key] = value;
+}
+
+void AliJSONTypedMap::Clear() {
+  fBools.clear();
+  fInts.clear();
+  fDoubles.clear();
+  fStrings.clear();
+}
+
+AliJSONTypedMap::EType_t AliJSONTypedMap::GetType(const char *key) const {
+  if(fBools.find(key) != fBools.end()) return kBool;
+  if(fInts.find(key) != fInts.end()) return kInt;
+  if(fDoubles.find(key) != fDoubles.end()) return kDouble;
+  if(fStrings.find(key) != fStrings.end()) return kString;
+  return kUndefined;
+}
+
+Bool_t AliJSONTypedMap::GetBool(const char *key, Bool_t defaultval) const {
+  std::map<std::string, Bool_t>::const_iterator found = fBools.find(key);
+  return found != fBools.end() ? found->second : defaultval;
+}
+
+Int_t AliJSONTypedMap::GetInt(const char *key, Int_t defaultval) const {
+  std::map<std::string, Int_t>::const_iterator found = fInts.find(key);
+  return found != fInts.end() ? found->second : defaultval;
+}
+
+Double_t AliJSONTypedMap::GetDouble(const char *key, Double_t defaultval) const {
+  // integer values are converted
+  std::map<std::string, Double_t>::const_iterator found = fDoubles.find(key);
+  if(found != fDoubles.end()) return found->second;
+  std::map<std::string, Int_t>::const_iterator foundint = fInts.find(key);
+  return foundint != fInts.end() ? foundint->second : defaultval;
+}
+
+const char *AliJSONTypedMap::GetString(const char *key, const char *defaultval) const {
+  std::map<std::string, std::string>::const_iterator found = fStrings.find(key);
+  return found != fStrings.end() ? found->second.c_str() : defaultval;
+}
+
+void AliJSONTypedMap::Print() const {
+  for(std::map<std::string, Bool_t>::const_iterator it = fBools.begin(); it != fBools.end(); it++)
+    std::cout << it->first << ": " << (it->second ? "true" : "false") << std::endl;
+  for(std::map<std::string, Int_t>::const_iterator it = fInts.begin(); it != fInts.end(); it++)
+    std::cout << it->first << ": " << it->second << std::endl;
+  for(std::map<std::string, Double_t>::const_iterator it = fDoubles.begin(); it != fDoubles.end(); it++)
+    std::cout << it->first << ": " << it->second << std::endl;
+  for(std::map<std::string, std::string>::const_iterator it = fStrings.begin(); it != fStrings.end(); it++)
+    std::cout << it->first << ": " << it->second << std::endl;
+}
@@ -9,11 +9,66 @@
 #define _ALIJSONREADER_H_
 
 #include "AliJSONData.h"
+#include <istream>
+#include <map>
 #include <string>
 #include <vector>
 
 class TList;
 
+/*
+ * Callbacks of the streaming (SAX-style) parser of AliJSONReader.
+ * Arrays are handled as objects with the element index as key.
+ * Returning false in BeginObject skips the full subtree, which is then
+ * only scanned but not decoded.
+ */
+class AliJSONStreamHandler {
+public:
+  AliJSONStreamHandler() {}
+  virtual ~AliJSONStreamHandler() {}
+
+  virtual bool BeginObject(const char * /*key*/) { return true; }
+  virtual void EndObject() {}
+  virtual void Value(const char *key, const char *value) = 0;
+};
+
+/*
+ * Compact typed key-value store, filled by AliJSONReader::LoadMap.
+ * Keys of nested objects are the full path separated by '/'.
+ */
+class AliJSONTypedMap {
+public:
+  enum EType_t {
+    kUndefined,
+    kBool,
+    kInt,
+    kDouble,
+    kString
+  };
+
+  AliJSONTypedMap();
+  ~AliJSONTypedMap() {}
+
+  void Insert(const char *key, const char *value);
+  void Clear();
+
+  EType_t GetType(const char *key) const;
+  bool Has(const char *key) const { return GetType(key) != kUndefined; }
+  Bool_t GetBool(const char *key, Bool_t defaultval = kFALSE) const;
+  Int_t GetInt(const char *key, Int_t defaultval = 0) const;
+  Double_t GetDouble(const char *key, Double_t defaultval = 0.) const;
+  const char *GetString(const char *key, const char *defaultval = "") const;
+  size_t GetSize() const { return fBools.size() + fInts.size() + fDoubles.size() + fStrings.size(); }
+
+  void Print() const;
+
+private:
+  std::map<std::string, Bool_t> fBools;
+  std::map<std::string, Int_t> fInts;
+  std::map<std::string, Double_t> fDoubles;
+  std::map<std::string, std::string> fStrings;
+};
+
 class AliJSONSyntaxTreeNode{
 public:
   AliJSONSyntaxTreeNode(const char *name, AliJSONSyntaxTreeNode *mother);
@@ -45,7 +100,32 @@ public:
 
   TList *Decode(const char *jsosnstring) const;
 
+  /*
+   * Streaming interface: the input is parsed in a single pass and the callbacks
+   * of the handler are called, nothing is kept in memory by the reader.
+   */
+  bool Stream(std::istream &in, AliJSONStreamHandler &handler) const;
+  bool StreamFile(const char *filename, AliJSONStreamHandler &handler) const;
+
+  /*
+   * Same output as Decode, but only the requested keys (full path separated by '/',
+   * selecting an object selects all its content) are materialized. An empty
+   * selection decodes everything. Returns NULL in case of a syntax error.
+   */
+  TList *DecodeSelected(std::istream &in, const std::vector<std::string> &keys) const;
+  TList *DecodeFileSelected(const char *filename, const std::vector<std::string> &keys) const;
+
+  /*
+   * Load the (selected) values into a typed map instead of a TObject tree
+   */
+  bool LoadMap(std::istream &in, AliJSONTypedMap &result, const std::vector<std::string> &keys = std::vector<std::string>()) const;
+  bool LoadMapFromFile(const char *filename, AliJSONTypedMap &result, const std::vector<std::string> &keys = std::vector<std::string>()) const;
+
 private:
+  bool StreamObject(std::istream &in, AliJSONStreamHandler &handler, char closing) const;
+  bool SkipContainer(std::istream &in) const;
+  bool ReadToken(std::istream &in, std::string &token) const;
+
   void AddNodeToList(AliJSONSyntaxTreeNode *node, TList *consumer) const;
 };
 
@@ -0,0 +1,263 @@
+// $Id$
+//
+// Per event index of the MC mother chains.
+//
+// Built once per event from the AOD MC array or the MC event by a single
+// pass over the particles: mother and pdg per label, flags of the c/b
+// quarks and charm/beauty hadrons among the ancestors, the closest charm and
+// beauty hadron ancestor, and the generator header the particle (or its
+// closest generated ancestor) comes from. The origin checks of the analysis
+// utilities answer from it instead of walking the mother chain for every
+// candidate. The index is shared by all the tasks of the job and rebuilt when
+// the event (current entry of the analysis manager) or the source changes.
+
+#include <TClonesArray.h>
+#include <TList.h>
+#include <TMath.h>
+
+#include "AliAnalysisManager.h"
+#include "AliAODMCHeader.h"
+#include "AliGenCocktailEventHeader.h"
+#include "AliGenEventHeader.h"
+#include "AliMCEvent.h"
+#include "AliVParticle.h"
+
+#include "AliMCAncestryIndex.h"
+
+ClassImp(AliMCAncestryIndex)
+
+namespace {
+  // particle accessors for Build()
+  struct ArrayParticles {
+    ArrayParticles(TClonesArray *array) : fArray(array) {}
+    AliVParticle *operator()(Int_t i) const { return static_cast<AliVParticle*>(fArray->UncheckedAt(i)); }
+    TClonesArray *fArray;
+  };
+  struct EventParticles {
+    EventParticles(AliMCEvent *event) : fEvent(event) {}
+    AliVParticle *operator()(Int_t i) const { return fEvent->GetTrack(i); }
+    AliMCEvent *fEvent;
+  };
+}
+
+//________________________________________________________________________
+AliMCAncestryIndex::AliMCAncestryIndex() :
+  TNamed("AliMCAncestryIndex","AliMCAncestryIndex"),
+  fMother(),
+  fPdg(),
+  fFlags(),
+  fCharmAncestor(),
+  fBeautyAncestor(),
+  fHeader(),
+  fHeaderNames(),
+  fSource(0),
+  fAODHeader(0),
+  fEntryBuilt(-1),
+  fEntry(-1)
+{
+  // Dummy constructor.
+
+}
+
+//________________________________________________________________________
+AliMCAncestryIndex::AliMCAncestryIndex(const char *name) :
+  TNamed(name,name),
+  fMother(),
+  fPdg(),
+  fFlags(),
+  fCharmAncestor(),
+  fBeautyAncestor(),
+  fHeader(),
+  fHeaderNames(),
+  fSource(0),
+  fAODHeader(0),
+  fEntryBuilt(-1),
+  fEntry(-1)
+{
+  // Standard constructor.
+
+}
+
+//________________________________________________________________________
+AliMCAncestryIndex *AliMCAncestryIndex::Instance()
+{
+  // Index shared by all the tasks of the job.
+
+  static AliMCAncestryIndex instance("AliMCAncestryIndex");
+  return &instance;
+}
+
+//________________________________________________________________________
+Long64_t AliMCAncestryIndex::GetEntry() const
+{
+  // Current event, -1 if unknown (the index is then rebuilt at every update).
+
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  return mgr ? mgr->GetCurrentEntry() : fEntry;
+}
+
+//________________________________________________________________________
+Bool_t AliMCAncestryIndex::Update(TClonesArray *arrayMC, AliAODMCHeader *header)
+{
+  // Index of the AOD MC particles, with the cocktail headers of the AOD MC header if given.
+  // Without header an index built with the header of the event is kept.
+
+  if (!arrayMC) return kFALSE;
+
+  Int_t n = arrayMC->GetEntriesFast();
+  if (GetEntry() >= 0 && IsBuiltFor(arrayMC) && (!header || header == fAODHeader) && n == GetNParticles())
+    return kTRUE;
+
+  SetHeaders(header ? header->GetCocktailHeaders() : 0, n);
+  Build(ArrayParticles(arrayMC), n);
+  fSource = arrayMC;
+  fAODHeader = header;
+  fEntryBuilt = GetEntry();
+  return kTRUE;
+}
+
+//________________________________________________________________________
+Bool_t AliMCAncestryIndex::Update(AliMCEvent *mcEvent)
+{
+  // Index of the particles of the MC event, with its generator headers.
+
+  if (!mcEvent) return kFALSE;
+
+  Int_t n = mcEvent->GetNumberOfTracks();
+  if (GetEntry() >= 0 && IsBuiltFor(mcEvent) && n == GetNParticles())
+    return kTRUE;
+
+  AliGenEventHeader *genHeader = mcEvent->GenEventHeader();
+  AliGenCocktailEventHeader *cocktail = dynamic_cast<AliGenCocktailEventHeader*>(genHeader);
+  if (cocktail) {
+    SetHeaders(cocktail->GetHeaders(), n);
+  }
+  else if (genHeader) {
+    TList single;
+    single.Add(genHeader);
+    SetHeaders(&single, n);
+  }
+  else {
+    SetHeaders(0, n);
+  }
+  Build(EventParticles(mcEvent), n);
+  fSource = mcEvent;
+  fAODHeader = 0;
+  fEntryBuilt = GetEntry();
+  return kTRUE;
+}
+
+//________________________________________________________________________
+void AliMCAncestryIndex::SetHeaders(TList *headers, Int_t n)
+{
+  // Header index of the generated particles, from the consecutive label
+  // ranges of the headers (NProduced); -1 for the particles after the last
+  // range, they get the header of their ancestor in Build().
+
+  fHeaderNames.clear();
+  fHeader.assign(n, -1);
+  if (!headers) return;
+
+  Int_t first = 0;
+  for (Int_t ih = 0; ih < headers->GetEntries(); ih++) {
+    AliGenEventHeader *gh = static_cast<AliGenEventHeader*>(headers->At(ih));
+    fHeaderNames.push_back(gh->GetName());
+    Int_t last = TMath::Min(first + gh->NProduced(), n);
+    for (Int_t i = first; i < last; i++) fHeader[i] = ih;
+    first += gh->NProduced();
+  }
+}
+
+//________________________________________________________________________
+UInt_t AliMCAncestryIndex::OwnFlags(Int_t pdg) const
+{
+  // Flags contributed by an ancestor with the given pdg code.
+
+  Int_t abspdg = TMath::Abs(pdg);
+  UInt_t flags = 0;
+  if (abspdg == 4) flags |= kCharmQuark;
+  if (abspdg == 5) flags |= kBeautyQuark;
+  if ((abspdg > 400 && abspdg < 500) || (abspdg > 4000 && abspdg < 5000)) flags |= kCharmHadron;
+  if ((abspdg > 500 && abspdg < 600) || (abspdg > 5000 && abspdg < 6000)) flags |= kBeautyHadron;
+  return flags;
+}
+
+//________________________________________________________________________
+template <class T> void AliMCAncestryIndex::Build(const T &get, Int_t n)
+{
+  // One pass over the particles; the values of a particle are those of its
+  // mother completed with the mother itself, the chains are resolved from the
+  // top so that each particle is processed once. Missing mothers end the
+  // chain, as a loop in the chain does.
+
+  fMother.assign(n, -1);
+  fPdg.assign(n, 0);
+  fFlags.assign(n, 0);
+  fCharmAncestor.assign(n, -1);
+  fBeautyAncestor.assign(n, -1);
+
+  for (Int_t i = 0; i < n; i++) {
+    AliVParticle *part = get(i);
+    if (!part) continue;
+    Int_t mother = part->GetMother();
+    fMother[i] = (mother >= 0 && mother < n && mother != i) ? mother : -1;
+    fPdg[i] = part->PdgCode();
+  }
+
+  // 0: to do, 1: on the current chain, 2: done
+  std::vector<Char_t> state(n, 0);
+  std::vector<Int_t> chain;
+  for (Int_t i = 0; i < n; i++) {
+    if (state[i] == 2) continue;
+
+    chain.clear();
+    Int_t label = i;
+    while (label >= 0 && state[label] == 0) {
+      state[label] = 1;
+      chain.push_back(label);
+      label = fMother[label];
+    }
+
+    for (Int_t j = chain.size()-1; j >= 0; j--) {
+      Int_t k = chain[j];
+      Int_t mother = fMother[k];
+      if (mother >= 0 && state[mother] == 2) {
+        UInt_t own = OwnFlags(fPdg[mother]);
+        fFlags[k] = fFlags[mother] | own;
+        fCharmAncestor[k] = (own & kCharmHadron) ? mother : fCharmAncestor[mother];
+        fBeautyAncestor[k] = (own & kBeautyHadron) ? mother : fBeautyAncestor[mother];
+        if (fHeader[k] < 0) fHeader[k] = fHeader[mother];
+      }
+      state[k] = 2;
+    }
+  }
+}
+
+//________________________________________________________________________
+const char *AliMCAncestryIndex::GetHeaderName(Int_t label) const
+{
+  // Name of the generator header, "" if none.
+
+  Int_t ih = GetHeaderIndex(label);
+  return (ih >= 0 && ih < (Int_t)fHeaderNames.size()) ? fHeaderNames[ih].Data() : "";
+}
+
+//________________________________________________________________________
+Int_t AliMCAncestryIndex::CheckHFOrigin(Int_t label, Bool_t searchUpToQuark) const
+{
+  // Charm origin of a particle: 5 if a beauty hadron is among the ancestors, 4 otherwise.
+
+  UInt_t flags = GetAncestorFlags(label);
+  if (searchUpToQuark && !(flags & (kCharmQuark | kBeautyQuark))) return 0;
+  return (flags & kBeautyHadron) ? 5 : 4;
+}
+
+//________________________________________________________________________
+void AliMCAncestryIndex::Reset()
+{
+  // Forget the current event.
+
+  fSource = 0;
+  fAODHeader = 0;
+  fEntryBuilt = -1;
+}
@@ -0,0 +1,82 @@
+#ifndef ALIMCANCESTRYINDEX_H
+#define ALIMCANCESTRYINDEX_H
+
+// $Id$
+
+#include <vector>
+
+#include <TNamed.h>
+
+class TList;
+class TClonesArray;
+class AliMCEvent;
+class AliAODMCHeader;
+
+class AliMCAncestryIndex : public TNamed {
+ public:
+  // flags of the ancestors of a particle (the particle itself excluded)
+  enum EAncestorFlag_t {
+    kCharmQuark    = BIT(0),  // c quark
+    kBeautyQuark   = BIT(1),  // b quark
+    kCharmHadron   = BIT(2),  // |pdg| in (400,500) or (4000,5000)
+    kBeautyHadron  = BIT(3)   // |pdg| in (500,600) or (5000,6000)
+  };
+
+  AliMCAncestryIndex();
+  AliMCAncestryIndex(const char *name);
+
+  static AliMCAncestryIndex *Instance();
+
+  // build the index if it is not built for this event and source yet; kFALSE if no source
+  Bool_t      Update(TClonesArray *arrayMC, AliAODMCHeader *header = 0);
+  Bool_t      Update(AliMCEvent *mcEvent);
+  Bool_t      IsBuiltFor(const TObject *source)                const { return fSource && fSource == source && fEntryBuilt == GetEntry(); }
+
+  // per label, labels outside of the event return -1 / 0
+  Int_t       GetNParticles()                                  const { return fMother.size()                             ; }
+  Bool_t      IsValid(Int_t label)                             const { return label >= 0 && label < (Int_t)fMother.size() ; }
+  Int_t       GetMother(Int_t label)                           const { return IsValid(label) ? fMother[label] : -1        ; }
+  Int_t       GetPdg(Int_t label)                              const { return IsValid(label) ? fPdg[label] : 0            ; }
+  UInt_t      GetAncestorFlags(Int_t label)                    const { return IsValid(label) ? fFlags[label] : 0          ; }
+  Bool_t      HasAncestor(Int_t label, UInt_t flags)           const { return (GetAncestorFlags(label) & flags) != 0      ; }
+  // closest ancestor which is a charm (beauty) hadron, -1 if none
+  Int_t       GetCharmHadronAncestor(Int_t label)              const { return IsValid(label) ? fCharmAncestor[label] : -1 ; }
+  Int_t       GetBeautyHadronAncestor(Int_t label)             const { return IsValid(label) ? fBeautyAncestor[label] : -1; }
+  // generator header of the particle or of its closest ancestor produced by a generator, -1 if none
+  Int_t       GetHeaderIndex(Int_t label)                      const { return IsValid(label) ? fHeader[label] : -1        ; }
+  const char *GetHeaderName(Int_t label)                       const;
+  const AliAODMCHeader *GetAODHeader()                         const { return fAODHeader                                  ; }
+
+  // 4 (prompt) or 5 (feed-down) as AliVertexingHFUtils::CheckOrigin, 0 if searchUpToQuark and no c or b quark ancestor
+  Int_t       CheckHFOrigin(Int_t label, Bool_t searchUpToQuark = kTRUE) const;
+
+  // without an analysis manager the event has to be set explicitly
+  void        SetEntry(Long64_t entry)                               { fEntry = entry ; }
+  Long64_t    GetEntry()                                       const;
+
+  void        Reset();
+
+ protected:
+  template <class T> void Build(const T &get, Int_t n);
+  void        SetHeaders(TList *headers, Int_t n);
+  UInt_t      OwnFlags(Int_t pdg)                              const;
+
+  std::vector<Int_t>       fMother;          //! mother label
+  std::vector<Int_t>       fPdg;             //! pdg code
+  std::vector<UInt_t>      fFlags;           //! EAncestorFlag_t of the ancestors
+  std::vector<Int_t>       fCharmAncestor;   //! closest charm hadron ancestor
+  std::vector<Int_t>       fBeautyAncestor;  //! closest beauty hadron ancestor
+  std::vector<Int_t>       fHeader;          //! generator header index
+  std::vector<TString>     fHeaderNames;     //! names of the generator headers
+  const TObject           *fSource;          //! MC array or event the index was built for
+  const AliAODMCHeader    *fAODHeader;       //! header used for the AOD index
+  Long64_t                 fEntryBuilt;      //! event the index was built for
+  Long64_t                 fEntry;           //! event, if not taken from the analysis manager
+
+ private:
+  AliMCAncestryIndex(const AliMCAncestryIndex&);             // not implemented
+  AliMCAncestryIndex& operator=(const AliMCAncestryIndex&);  // not implemented
+
+  ClassDef(AliMCAncestryIndex, 1); // Per event index of the MC mother chains
+};
+#endif
@@ -60,7 +60,10 @@ fHistMCFractions(nullptr), fHistMCWeights(nullptr), fMCEvent(nullptr),
 fMultOrCent(0), fNPartTypes(6), fNCentralities(0),
 fbTaskStatus(AliMCSpectraWeights::TaskState::kAllEmpty),
 fFlag(AliMCSpectraWeights::SysFlag::kNominal), fUseMultiplicity(kTRUE),
-fUseMBFractions(kFALSE) {}
+fUseMBFractions(kFALSE), fWeightTable(), fTableFlags(), fTableNCentBins(0),
+fTableNPtBins(0), fTableNominalIndex(0), fTableSysIndex(-1),
+fTableSysFlag(AliMCSpectraWeights::SysFlag::kNominal), fTableCentBin(-1),
+fCachedWeightNominal(), fCachedWeightSys() {}
 
 /**
  *  @brief standard way for constuctor
@@ -81,7 +84,10 @@ fHistMCGenPrimTrackParticle(nullptr), fHistDataFractions(nullptr),
 fHistMCFractions(nullptr), fHistMCWeights(nullptr), fMCEvent(nullptr),
 fMultOrCent(0), fNPartTypes(6), fNCentralities(0),
 fbTaskStatus(AliMCSpectraWeights::TaskState::kAllEmpty), fFlag(flag),
-fUseMultiplicity(kTRUE), fUseMBFractions(kFALSE) {
+fUseMultiplicity(kTRUE), fUseMBFractions(kFALSE), fWeightTable(),
+fTableFlags(), fTableNCentBins(0), fTableNPtBins(0), fTableNominalIndex(0),
+fTableSysIndex(-1), fTableSysFlag(AliMCSpectraWeights::SysFlag::kNominal),
+fTableCentBin(-1), fCachedWeightNominal(), fCachedWeightSys() {
 #ifdef __AliMCSpectraWeights_DebugTiming__
     auto t1 = std::chrono::high_resolution_clock::now();
 #endif
@@ -328,6 +334,9 @@ void AliMCSpectraWeights::Init() {
         }
     }
 
+    if (fbTaskStatus == AliMCSpectraWeights::TaskState::kMCWeightCalculated)
+        AliMCSpectraWeights::FillWeightTable();
+
 DebugPCC("AliMCSpectraWeights::INFO: Init finished with status " << fbTaskStatus
          << std::endl);
 #ifdef __AliMCSpectraWeights_DebugTiming__
@@ -883,6 +892,7 @@ void AliMCSpectraWeights::CountEventMult() {
 #endif
     DebugPCC("Count event multiplicity ");
     fMultOrCent = 0;
+    AliMCSpectraWeights::ResetEventCache();
     const float lowPtCut = 0.05;
     const float eta = 0.5;
     //    if (fstCollisionSystem.find("pp") != std::string::npos)
@@ -966,27 +976,147 @@ int const AliMCSpectraWeights::CheckAndIdentifyParticle(TParticle* part) {
     return AliMCSpectraWeights::IdentifyMCParticle(part);
 }
 
-int const AliMCSpectraWeights::FindBinEntry(float pt, int const part) {
-    auto const icent = AliMCSpectraWeights::GetCentFromMult(fMultOrCent);
+/**
+ *  @brief fill the dense weight table from the weight histograms
+ *
+ *  One float per systematic flag, particle species, centrality bin and pt
+ *  bin (both including under- and overflow), such that the per particle
+ *  lookup is a direct index computation. Non-positive weights are stored as 1.
+ */
+void AliMCSpectraWeights::FillWeightTable() {
+#ifdef __AliMCSpectraWeights_DebugTiming__
+    auto t1 = std::chrono::high_resolution_clock::now();
+#endif
+    fWeightTable.clear();
+    fTableFlags.clear();
+    if (!fHistMCWeights)
+        return;
+
+    if (fDoSystematics)
+        fTableFlags = fAllSystematicFlags;
+    auto const _itNominal = std::find(fTableFlags.begin(), fTableFlags.end(),
+                                      AliMCSpectraWeights::SysFlag::kNominal);
+    fTableNominalIndex = _itNominal - fTableFlags.begin();
+    if (_itNominal == fTableFlags.end())
+        fTableFlags.push_back(AliMCSpectraWeights::SysFlag::kNominal);
+
+    fTableNPtBins = fHistMCWeights->GetXaxis()->GetNbins() + 2;
+    fTableNCentBins = fHistMCWeights->GetYaxis()->GetNbins() + 2;
+    fWeightTable.assign(fTableFlags.size() * fNPartTypes * fTableNCentBins *
+                        fTableNPtBins, 1.f);
+
+    for (int iflag = 0; iflag < static_cast<int>(fTableFlags.size()); ++iflag) {
+        TH3F* hist = fHistMCWeights;
+        if (fDoSystematics) {
+            auto const _itHist = fHistMCWeightsSys.find(fTableFlags[iflag]);
+            hist = _itHist != fHistMCWeightsSys.end() ? _itHist->second : nullptr;
+        }
+        if (!hist)
+            continue;
+        for (int ipart = 0; ipart < fNPartTypes; ++ipart) {
+            int const _iBinPart = hist->GetZaxis()->FindBin(ipart);
+            for (int icent = 0; icent < fTableNCentBins; ++icent) {
+                float* row = &fWeightTable[((iflag * fNPartTypes + ipart) *
+                                            fTableNCentBins + icent) * fTableNPtBins];
+                for (int ipt = 0; ipt < fTableNPtBins; ++ipt) {
+                    float const weight = hist->GetBinContent(ipt, icent, _iBinPart);
+                    row[ipt] = weight > 0 ? weight : 1;
+                }
+            }
+        }
+    }
+
+    AliMCSpectraWeights::ResetEventCache();
+    // force the lookup of the systematic flag
+    fTableSysIndex = -1;
+    fTableSysFlag = fFlag;
+    auto const _itSys = std::find(fTableFlags.begin(), fTableFlags.end(), fFlag);
+    if (_itSys != fTableFlags.end())
+        fTableSysIndex = _itSys - fTableFlags.begin();
+#ifdef __AliMCSpectraWeights_DebugTiming__
+    auto t2 = std::chrono::high_resolution_clock::now();
+    auto duration =
+    std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+    DebugChrono("FillWeightTable took " << duration << " microseconds\n");
+#endif
+}
+
+/**
+ *  @brief forget the per event centrality bin and the weights cached by label
+ */
+void AliMCSpectraWeights::ResetEventCache() {
+    fTableCentBin = -1;
+    std::fill(fCachedWeightNominal.begin(), fCachedWeightNominal.end(), -1.f);
+    std::fill(fCachedWeightSys.begin(), fCachedWeightSys.end(), -1.f);
+}
+
+/**
+ *  @brief weight of the particle from the dense table
+ *  @param[in] part MC particle
+ *  @param[in] sysIndex index of the systematic flag in the table
+ *  @return weight, 1 if the particle is not weighted
+ */
+float const AliMCSpectraWeights::GetTableWeight(TParticle* part,
+                                                int const sysIndex) {
+    int const particleType =
+    AliMCSpectraWeights::CheckAndIdentifyParticle(part);
+    if (particleType < 0 || particleType >= fNPartTypes) {
+        DebugPCC("Can't find particle type\n");
+        return 1;
+    }
+    float pt = part->Pt();
     if (pt < 0.15) {
         DebugPCC("Warning: pt too low; pt = " << pt << "\n");
-        return -1;
+        return 1;
     }
     if (pt >= 20) {
         DebugPCC("Info: pt too high; pt = " << pt << "; set to 19.9\n");
         pt = 19.9;
     }
-    std::array<float, 3> binEntry{
-        pt, static_cast<float>(AliMCSpectraWeights::GetMultFromCent(icent)),
-        static_cast<float>(part)};
-    auto const _iBin = GetBinFromTH3(
-                                     fHistMCWeightsSys[AliMCSpectraWeights::SysFlag::kNominal], binEntry);
-    DebugPCC("Found bin at " << _iBin << "\n");
-    return _iBin;
+    // the centrality bin only changes with the event
+    if (fTableCentBin < 0) {
+        auto const icent = AliMCSpectraWeights::GetCentFromMult(fMultOrCent);
+        fTableCentBin = fHistMCWeights->GetYaxis()->FindBin(static_cast<float>(
+                                        AliMCSpectraWeights::GetMultFromCent(icent)));
+    }
+    // same as TAxis::FindBin for the variable pt binning of the histograms
+    int const _iBinPt =
+    std::upper_bound(fBinsPt.begin(), fBinsPt.end(), pt) - fBinsPt.begin();
+    return fWeightTable[((sysIndex * fNPartTypes + particleType) * fTableNCentBins +
+                         fTableCentBin) * fTableNPtBins + _iBinPt];
+}
+
+/**
+ *  @brief weight of the particle, evaluated once per event and MC label
+ *  @param[in] part MC particle
+ *  @param[in] mcLabel label of the particle, no caching if negative
+ *  @param[in] sysIndex index of the systematic flag in the table
+ *  @param[in,out] cache weights of the current event by label
+ *  @return weight
+ */
+float const AliMCSpectraWeights::GetCachedWeight(TParticle* part, int const mcLabel,
+                                                 int const sysIndex,
+                                                 std::vector<float>& cache) {
+    if (mcLabel < 0)
+        return AliMCSpectraWeights::GetTableWeight(part, sysIndex);
+    if (mcLabel >= static_cast<int>(cache.size()))
+        cache.resize(mcLabel + 1, -1.f);
+    if (cache[mcLabel] < 0)
+        cache[mcLabel] = AliMCSpectraWeights::GetTableWeight(part, sysIndex);
+    return cache[mcLabel];
 }
 
+/**
+ *  @brief nominal weight of the particle
+ *  @param[in] mcGenParticle MC particle
+ *  @param[in] mcLabel label of the particle; if >= 0 the weight is evaluated
+ *  only once per event, such that a particle reached via a track and via the
+ *  MC loop is looked up only once
+ *  @return weight
+ */
 float const
-AliMCSpectraWeights::GetMCSpectraWeightNominal(TParticle* mcGenParticle) {
+AliMCSpectraWeights::GetMCSpectraWeightNominal(TParticle* mcGenParticle,
+                                               int mcLabel) {
 #ifdef __AliMCSpectraWeights_DebugTiming__
     auto t1 = std::chrono::high_resolution_clock::now();
 #endif
@@ -994,26 +1124,13 @@ AliMCSpectraWeights::GetMCSpectraWeightNominal(TParticle* mcGenParticle) {
         DebugPCC("Warning: Status not kMCWeightCalculated\n");
         return 1;
     }
-    int const particleType =
-    AliMCSpectraWeights::CheckAndIdentifyParticle(mcGenParticle);
-    if (particleType < 0) {
-        DebugPCC("Can't find particle type\n");
+    if (fWeightTable.empty())
+        AliMCSpectraWeights::FillWeightTable();
+    if (fWeightTable.empty())
         return 1;
-    }
-    auto const _iBin =
-    AliMCSpectraWeights::FindBinEntry(mcGenParticle->Pt(), particleType);
-    if (_iBin < 0) {
-        DebugPCC("Can't find bin\n");
-        return 1;
-    }
-    float weight = fHistMCWeightsSys[AliMCSpectraWeights::SysFlag::kNominal]
-    ->GetBinContent(_iBin);
-    if (weight <= 0) {
-        DebugPCC("ERROR: negative weight; set to 1\n");
-        weight = 1;
-    }
+    float const weight = AliMCSpectraWeights::GetCachedWeight(
+                         mcGenParticle, mcLabel, fTableNominalIndex, fCachedWeightNominal);
     DebugPCC("GetMCSpectraWeight: nominal");
-    DebugPCC(fstPartTypes[particleType] << " ");
     DebugPCC("pT: " << mcGenParticle->Pt() << " ");
     DebugPCC("weight: " << weight << "\n");
 #ifdef __AliMCSpectraWeights_DebugTiming__
@@ -1026,8 +1143,15 @@ AliMCSpectraWeights::GetMCSpectraWeightNominal(TParticle* mcGenParticle) {
     return weight;
 }
 
+/**
+ *  @brief weight of the particle for the systematic variation of the event
+ *  @param[in] mcGenParticle MC particle
+ *  @param[in] mcLabel label of the particle, see GetMCSpectraWeightNominal()
+ *  @return weight
+ */
 float const
-AliMCSpectraWeights::GetMCSpectraWeightSystematics(TParticle* mcGenParticle) {
+AliMCSpectraWeights::GetMCSpectraWeightSystematics(TParticle* mcGenParticle,
+                                                   int mcLabel) {
 #ifdef __AliMCSpectraWeights_DebugTiming__
     auto t1 = std::chrono::high_resolution_clock::now();
 #endif
@@ -1035,25 +1159,24 @@ AliMCSpectraWeights::GetMCSpectraWeightSystematics(TParticle* mcGenParticle) {
         DebugPCC("Warning: Status not kMCWeightCalculated\n");
         return 1;
     }
-    int const particleType =
-    AliMCSpectraWeights::CheckAndIdentifyParticle(mcGenParticle);
-    if (particleType < 0) {
-        DebugPCC("Can't find particle type\n");
+    if (fWeightTable.empty())
+        AliMCSpectraWeights::FillWeightTable();
+    if (fWeightTable.empty())
         return 1;
+    // the flag is drawn per event, the cached weights are only valid for one flag
+    if (fFlag != fTableSysFlag) {
+        auto const _itSys = std::find(fTableFlags.begin(), fTableFlags.end(), fFlag);
+        fTableSysIndex = _itSys != fTableFlags.end() ? _itSys - fTableFlags.begin() : -1;
+        fTableSysFlag = fFlag;
+        std::fill(fCachedWeightSys.begin(), fCachedWeightSys.end(), -1.f);
     }
-    auto const _iBin =
-    AliMCSpectraWeights::FindBinEntry(mcGenParticle->Pt(), particleType);
-    if (_iBin < 0) {
-        DebugPCC("Can't find bin\n");
+    if (fTableSysIndex < 0) {
+        DebugPCC("Warning: no weights for the systematic flag\n");
         return 1;
     }
-    float weight = fHistMCWeightsSys[fFlag]->GetBinContent(_iBin);
-    if (weight <= 0) {
-        DebugPCC("ERROR: negative weight; set to 1\n");
-        weight = 1;
-    }
+    float const weight = AliMCSpectraWeights::GetCachedWeight(
+                         mcGenParticle, mcLabel, fTableSysIndex, fCachedWeightSys);
     DebugPCC("GetMCSpectraWeight: with systematics");
-    DebugPCC(fstPartTypes[particleType] << " ");
     DebugPCC("pT: " << mcGenParticle->Pt() << " ");
     DebugPCC("weight: " << weight << "\n");
 #ifdef __AliMCSpectraWeights_DebugTiming__
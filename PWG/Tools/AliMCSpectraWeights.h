@@ -112,6 +112,18 @@ class AliMCSpectraWeights : public TNamed {
                                  dependent ones*/
     bool fDoSystematics;
 
+    // dense weight table filled at Init, avoiding the TH3F lookups per particle
+    std::vector<float> fWeightTable;   //! weights [sys flag][species][cent bin][pt bin], bins include under-/overflow
+    std::vector<AliMCSpectraWeights::SysFlag> fTableFlags; //! systematic flags in the order of the table
+    int fTableNCentBins;               //! number of centrality bins of the table
+    int fTableNPtBins;                 //! number of pt bins of the table
+    int fTableNominalIndex;            //! table index of the nominal weights
+    int fTableSysIndex;                //! table index of fTableSysFlag, -1 if not in the table
+    SysFlag fTableSysFlag;             //! flag for which fTableSysIndex was determined
+    int fTableCentBin;                 //! centrality bin of the current event, -1 if not yet determined
+    std::vector<float> fCachedWeightNominal; //! nominal weight per MC label of the current event, < 0 if not evaluated
+    std::vector<float> fCachedWeightSys;     //! weight with systematics per MC label of the current event, < 0 if not evaluated
+
     // functions
     // intern getter
     std::string const GetFunctionFromSysFlag(SysFlag flag) const;           //!
@@ -133,7 +145,11 @@ class AliMCSpectraWeights : public TNamed {
     bool CorrectFractionsforRest();                            //!
 
     int const CheckAndIdentifyParticle(TParticle* part);
-    int const FindBinEntry(float pt, int const part);
+    void FillWeightTable();                                    //!
+    void ResetEventCache();                                    //!
+    float const GetTableWeight(TParticle* part, int const sysIndex); //!
+    float const GetCachedWeight(TParticle* part, int const mcLabel, int const sysIndex,
+                                std::vector<float>& cache);    //!
     
     // private = to be deleted
     AliMCSpectraWeights(const AliMCSpectraWeights&);//copy
@@ -153,12 +169,14 @@ class AliMCSpectraWeights : public TNamed {
     GetMCSpectraWeight(TParticle* mcGenParticle,
                        AliMCEvent* mcEvent); /*!< old; should not be used */
     float const
-    GetMCSpectraWeightNominal(TParticle* mcGenParticle);/*!< main function to use. Will
+    GetMCSpectraWeightNominal(TParticle* mcGenParticle, int mcLabel = -1);/*!< main function to use. Will
                                                          deliver correct weights to
                                                          re-weight the abundances of
-                                                         different particle species */
+                                                         different particle species.
+                                                         With mcLabel >= 0 the weight is
+                                                         evaluated once per event and label */
     float const
-    GetMCSpectraWeightSystematics(TParticle* mcGenParticle);
+    GetMCSpectraWeightSystematics(TParticle* mcGenParticle, int mcLabel = -1);
 
     void FillMCSpectra(
         AliMCEvent* mcEvent); /*!< function to fill internal mc spectra for
@@ -196,7 +214,7 @@ class AliMCSpectraWeights : public TNamed {
 
     int const IdentifyMCParticle(TParticle* mcParticle);
 
-    ClassDef(AliMCSpectraWeights, 1);
+    ClassDef(AliMCSpectraWeights, 2);
 };
 
 struct AliMCSpectraWeightsHandler : public TNamed {
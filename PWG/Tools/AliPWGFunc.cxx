@@ -25,9 +25,38 @@
 #include "TH1.h"
 #include "TSpline.h"
 #include "AliLog.h"
+#include <vector>
 
 ClassImp(AliPWGFunc)
 
+Int_t AliPWGFunc::fgNQuadR = 32;
+Int_t AliPWGFunc::fgNQuadPhi = 16;
+Int_t AliPWGFunc::fgNQuadY = 16;
+
+namespace {
+
+  // Gauss-Legendre nodes and weights on [min, max], kept per thread
+  struct Quadrature {
+    Quadrature() : fN(0), fMin(0), fMax(0), fX(), fW() {}
+    void Set(Int_t n, Double_t min, Double_t max) {
+      if (n == fN && min == fMin && max == fMax) return;
+      fN = n; fMin = min; fMax = max;
+      fX.resize(n); fW.resize(n);
+      AliPWGFunc::GaussLegendre(n, &fX[0], &fW[0]);
+      for (Int_t i = 0; i < n; i++) {
+        fX[i] = 0.5*(max-min)*fX[i] + 0.5*(max+min);
+        fW[i] *= 0.5*(max-min);
+      }
+    }
+    Int_t fN;
+    Double_t fMin;
+    Double_t fMax;
+    std::vector<Double_t> fX;
+    std::vector<Double_t> fW;
+  };
+
+}
+
 AliPWGFunc::AliPWGFunc () : fLastFunc(0),  fLineWidth(1), fVarType(kdNdpt) {
 
   // ctor
@@ -1013,3 +1042,158 @@ TF1 * AliPWGFunc::GetFermiDiracdNdpt(Double_t mass, Double_t temp, Double_t norm
 //   fLastFunc->SetLineWidth(fLineWidth);
 //   return fLastFunc;
 // }
+
+//_____________________________________________________________________
+// Batch kernels
+
+void AliPWGFunc::GaussLegendre(Int_t n, Double_t * x, Double_t * w) {
+
+  // nodes and weights of the n points Gauss-Legendre quadrature on [-1,1]
+
+  for (Int_t i = 0; i < (n+1)/2; i++) {
+    Double_t z = TMath::Cos(TMath::Pi()*(i+0.75)/(n+0.5));
+    Double_t dp = 1;
+    for (Int_t iter = 0; iter < 100; iter++) {
+      Double_t p1 = 1, p2 = 0;
+      for (Int_t j = 0; j < n; j++) {
+        Double_t p3 = p2;
+        p2 = p1;
+        p1 = ((2*j+1)*z*p2 - j*p3)/(j+1);
+      }
+      dp = n*(z*p1 - p2)/(z*z - 1);
+      Double_t z1 = z;
+      z = z1 - p1/dp;
+      if (TMath::Abs(z - z1) < 1e-15) break;
+    }
+    x[i] = -z;
+    x[n-1-i] = z;
+    w[i] = w[n-1-i] = 2/((1-z*z)*dp*dp);
+  }
+}
+
+void AliPWGFunc::BatchBGdNdPt(Int_t n, const Double_t * x, const Double_t * p, Double_t * values) {
+
+  // BGBW 1/pt dNdpt, parameters as StaticBGdNdPt
+
+  Double_t mass     = p[0];
+  Double_t beta_max = p[1];
+  Double_t temp     = p[2];
+  Double_t nprof    = p[3];
+  Double_t norm     = p[4];
+
+  static thread_local Quadrature quad;
+  static thread_local std::vector<Double_t> sinhRho, coshRho, weight;
+  quad.Set(fgNQuadR, 0., 1.);
+  sinhRho.resize(quad.fN); coshRho.resize(quad.fN); weight.resize(quad.fN);
+
+  // velocity profile, independent of pt
+  for (Int_t k = 0; k < quad.fN; k++) {
+    Double_t r = quad.fX[k];
+    Double_t beta = beta_max * TMath::Power(r, nprof);
+    if (beta > 0.9999999999999999) beta = 0.9999999999999999;
+    Double_t rho = TMath::ATanH(beta);
+    sinhRho[k] = TMath::SinH(rho)/temp;
+    coshRho[k] = TMath::CosH(rho)/temp;
+    weight[k]  = quad.fW[k]*r;
+  }
+
+  for (Int_t i = 0; i < n; i++) {
+    Double_t pT = x[i];
+    Double_t mT = TMath::Sqrt(mass*mass+pT*pT);
+    Double_t sum = 0;
+    for (Int_t k = 0; k < quad.fN; k++) {
+      Double_t arg00 = pT*sinhRho[k];
+      if (arg00 > 700.) arg00 = 700.; // avoid FPE
+      sum += weight[k]*TMath::BesselI0(arg00)*TMath::BesselK1(mT*coshRho[k]);
+    }
+    values[i] = norm*mT*sum;
+  }
+}
+
+void AliPWGFunc::BatchBGdNdPtTimesPt(Int_t n, const Double_t * x, const Double_t * p, Double_t * values) {
+
+  // BGBW dNdpt
+  BatchBGdNdPt(n, x, p, values);
+  for (Int_t i = 0; i < n; i++) values[i] *= x[i];
+}
+
+void AliPWGFunc::BatchTsallisdNdPt(Int_t n, const Double_t * x, const Double_t * p, Double_t * values) {
+
+  // Tsallis BW 1/pt dNdpt, parameters as StaticTsallisdNdPt. The integrand is
+  // even in phi and y, only the positive half of both is integrated.
+
+  Double_t mass = p[0];
+  Double_t beta = p[1];
+  Double_t temp = p[2];
+  Double_t q    = p[3];
+  Double_t norm = p[4];
+  Double_t ymax = p[5];
+
+  static thread_local Quadrature quadR, quadPhi, quadY;
+  static thread_local std::vector<Double_t> sinhRho, coshRho, cosPhi, coshY, wR, wPhiY;
+  quadR.Set(fgNQuadR, 0., 1.);
+  quadPhi.Set(fgNQuadPhi, 0., TMath::Pi());
+  quadY.Set(fgNQuadY, 0., ymax);
+  sinhRho.resize(quadR.fN); coshRho.resize(quadR.fN); wR.resize(quadR.fN);
+  cosPhi.resize(quadPhi.fN); coshY.resize(quadY.fN); wPhiY.resize(quadPhi.fN*quadY.fN);
+
+  Double_t scale = (q-1)/temp;
+  for (Int_t k = 0; k < quadR.fN; k++) {
+    Double_t r = quadR.fX[k];
+    Double_t rho = TMath::ATanH(beta*r); // TODO: implement different velocity profiles
+    sinhRho[k] = scale*TMath::SinH(rho);
+    coshRho[k] = scale*TMath::CosH(rho);
+    wR[k] = 4*quadR.fW[k]*r;
+  }
+  for (Int_t j = 0; j < quadPhi.fN; j++) cosPhi[j] = TMath::Cos(quadPhi.fX[j]);
+  for (Int_t l = 0; l < quadY.fN; l++) coshY[l] = TMath::CosH(quadY.fX[l]);
+  for (Int_t j = 0; j < quadPhi.fN; j++)
+    for (Int_t l = 0; l < quadY.fN; l++)
+      wPhiY[j*quadY.fN+l] = quadPhi.fW[j]*quadY.fW[l]*coshY[l];
+
+  Double_t expo = -1/(q-1);
+  for (Int_t i = 0; i < n; i++) {
+    Double_t pt = x[i];
+    Double_t mt = TMath::Sqrt(mass*mass+pt*pt);
+    Double_t sum = 0;
+    for (Int_t k = 0; k < quadR.fN; k++) {
+      Double_t sumPhiY = 0;
+      for (Int_t j = 0; j < quadPhi.fN; j++) {
+        Double_t transverse = 1 - pt*sinhRho[k]*cosPhi[j];
+        for (Int_t l = 0; l < quadY.fN; l++)
+          sumPhiY += wPhiY[j*quadY.fN+l]*TMath::Power(transverse + mt*coshY[l]*coshRho[k], expo);
+      }
+      sum += wR[k]*sumPhiY;
+    }
+    values[i] = norm*mt*sum;
+  }
+}
+
+void AliPWGFunc::BatchTsallisdNdPtTimesPt(Int_t n, const Double_t * x, const Double_t * p, Double_t * values) {
+
+  // Tsallis BW dNdpt
+  BatchTsallisdNdPt(n, x, p, values);
+  for (Int_t i = 0; i < n; i++) values[i] *= x[i];
+}
+
+void AliPWGFunc::BatchLevidNdPt(Int_t n, const Double_t * x, const Double_t * p, Double_t * values) {
+
+  // Levi function, parameters as GetLevidNdpt (norm, n, T, mass)
+
+  Double_t norm = p[0];
+  Double_t nexp = p[1];
+  Double_t temp = p[2];
+  Double_t mass = p[3];
+
+  Double_t nT = nexp*temp;
+  Double_t constant = norm*(nexp-1)*(nexp-2)/(nT*(nT+mass*(nexp-2)));
+  for (Int_t i = 0; i < n; i++)
+    values[i] = constant*TMath::Power(1 + (TMath::Sqrt(mass*mass+x[i]*x[i]) - mass)/nT, -nexp);
+}
+
+void AliPWGFunc::BatchLevidNdPtTimesPt(Int_t n, const Double_t * x, const Double_t * p, Double_t * values) {
+
+  // Levi function times pt
+  BatchLevidNdPt(n, x, p, values);
+  for (Int_t i = 0; i < n; i++) values[i] *= x[i];
+}
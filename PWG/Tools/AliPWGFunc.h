@@ -28,6 +28,8 @@ class AliPWGFunc : public TObject {
 public:
   // define the variables used for the function
   typedef enum {kdNdpt,kOneOverPtdNdpt,kOneOverMtdNdmt,kdNdmt,kOneOverMtdNdmtMinusM} VarType_t;
+  // batch evaluation of a function at n points x, same parameters p as the corresponding TF1
+  typedef void (*BatchFunc_t)(Int_t n, const Double_t * x, const Double_t * p, Double_t * values);
 
   AliPWGFunc();
   ~AliPWGFunc();
@@ -192,6 +194,20 @@ protected:
   static Double_t StaticUA1Func(const double * x, const double* p);
   static Double_t StaticUA1FuncOneOverPt(const double * x, const double* p) ;
 
+  // Batch (vectorized) kernels: all the points are evaluated in one call, the
+  // quantities not depending on pt are computed once per quadrature node.
+  // Blast waves use a fixed Gauss-Legendre quadrature instead of the adaptive
+  // integration of the TF1 versions.
+  static void BatchBGdNdPt(Int_t n, const Double_t * x, const Double_t * p, Double_t * values);
+  static void BatchBGdNdPtTimesPt(Int_t n, const Double_t * x, const Double_t * p, Double_t * values);
+  static void BatchTsallisdNdPt(Int_t n, const Double_t * x, const Double_t * p, Double_t * values);
+  static void BatchTsallisdNdPtTimesPt(Int_t n, const Double_t * x, const Double_t * p, Double_t * values);
+  static void BatchLevidNdPt(Int_t n, const Double_t * x, const Double_t * p, Double_t * values);
+  static void BatchLevidNdPtTimesPt(Int_t n, const Double_t * x, const Double_t * p, Double_t * values);
+  static void SetBatchQuadraturePoints(Int_t nr, Int_t nphi = 16, Int_t ny = 16) { fgNQuadR = nr; fgNQuadPhi = nphi; fgNQuadY = ny; }
+  // nodes and weights of the n points Gauss-Legendre quadrature on [-1,1]
+  static void GaussLegendre(Int_t n, Double_t * x, Double_t * w);
+
 
 private:
 
@@ -199,6 +215,10 @@ private:
   TF1 * fLastFunc;     // Last function returned
   Width_t fLineWidth;  // Line width
   VarType_t fVarType;  // Variable types (e.g. dNdpt vs pt, 1/mt dNdmt vs mt...) 
+
+  static Int_t fgNQuadR;   // quadrature points in r for the batch blast waves
+  static Int_t fgNQuadPhi; // quadrature points in phi for the batch Tsallis blast wave
+  static Int_t fgNQuadY;   // quadrature points in y for the batch Tsallis blast wave
   
   AliPWGFunc(const AliPWGFunc&);            // not implemented
   AliPWGFunc& operator=(const AliPWGFunc&); // not implemented
@@ -20,6 +20,11 @@
 #include "TSpline.h"
 #include <iostream>
 #include "TGraphAsymmErrors.h"
+#include "Math/Factory.h"
+#include "Math/Functor.h"
+#include "Math/Minimizer.h"
+#include "Math/MinimizerOptions.h"
+#include <thread>
 
 using namespace std;
 
@@ -1478,3 +1483,189 @@ void AliPWGHistoTools::ScaleGraph(TGraph * g1, Double_t scale) {
 
 
 }
+
+Bool_t AliPWGHistoTools::FitGlobalBGBW(Int_t nspectra, TH1 ** h, const Double_t * mass, const Float_t * min, const Float_t * max,
+				       Double_t * par, Double_t * parErr, Int_t nthreads) {
+
+  // Global BGBW fit of dN/dpt spectra, see the header for the parameters.
+  // min and max can be 0 to use the full range of the histograms.
+
+  AliPWGBatchFitter fitter(AliPWGFunc::BatchBGdNdPtTimesPt, 5, 4);
+  Int_t ibeta = fitter.AddParameter("#beta", par[0], 0., 0.99);
+  Int_t itemp = fitter.AddParameter("T", par[1], 0.01, 1.);
+  Int_t iprof = fitter.AddParameter("n", par[2], 0.01, 10.);
+  std::vector<Int_t> inorm(nspectra);
+  for (Int_t ispectrum = 0; ispectrum < nspectra; ispectrum++) {
+    Int_t imass = fitter.AddParameter(Form("mass_%d", ispectrum), mass[ispectrum]);
+    fitter.FixParameter(imass);
+    inorm[ispectrum] = fitter.AddParameter(Form("norm_%d", ispectrum), par[3+ispectrum]);
+    Int_t index[5] = {imass, ibeta, itemp, iprof, inorm[ispectrum]};
+    fitter.AddSpectrum(h[ispectrum], index, min ? min[ispectrum] : 0, max ? max[ispectrum] : 100);
+  }
+  fitter.SetNThreads(nthreads);
+  Bool_t ok = fitter.Fit();
+
+  Int_t global[3] = {ibeta, itemp, iprof};
+  for (Int_t ipar = 0; ipar < 3+nspectra; ipar++) {
+    Int_t index = ipar < 3 ? global[ipar] : inorm[ipar-3];
+    par[ipar] = fitter.GetParameter(index);
+    if (parErr) parErr[ipar] = fitter.GetParError(index);
+  }
+  cout << "--- Global BGBW fit: chi2/ndf = " << fitter.GetChi2() << "/" << fitter.GetNDF() << " ---" << endl;
+  return ok;
+}
+
+//_____________________________________________________________________
+// AliPWGBatchFitter
+
+AliPWGBatchFitter::AliPWGBatchFitter(AliPWGFunc::BatchFunc_t func, Int_t nLocalPar, Int_t normPar) :
+  fFunc(func), fNLocalPar(nLocalPar), fNormPar(normPar), fNThreads(1), fNPointsPerBin(1),
+  fParNames(), fPar(), fParErr(), fParLow(), fParHigh(), fParFixed(),
+  fHistos(), fMin(), fMax(), fSpectra(), fChi2(0), fNDF(0) {
+  // ctor
+}
+
+Int_t AliPWGBatchFitter::AddParameter(const char * name, Double_t value, Double_t low, Double_t high) {
+
+  // add a global parameter, returns its index
+  fParNames.push_back(name);
+  fPar.push_back(value);
+  fParErr.push_back(0);
+  fParLow.push_back(low);
+  fParHigh.push_back(high);
+  fParFixed.push_back(kFALSE);
+  return fPar.size()-1;
+}
+
+Int_t AliPWGBatchFitter::AddSpectrum(const TH1 * h, const Int_t * parIndex, Float_t min, Float_t max) {
+
+  // add a spectrum fitted in [min,max], returns its index
+  Spectrum spectrum;
+  spectrum.fParIndex.assign(parIndex, parIndex+fNLocalPar);
+  spectrum.fCached = kFALSE;
+  spectrum.fChi2 = 0;
+  fSpectra.push_back(spectrum);
+  fHistos.push_back(h);
+  fMin.push_back(min);
+  fMax.push_back(max);
+  return fSpectra.size()-1;
+}
+
+void AliPWGBatchFitter::PrepareSpectra() {
+
+  // fill the bins and the evaluation points of the spectra
+
+  Int_t npoints = TMath::Max(fNPointsPerBin, 1);
+  std::vector<Double_t> nodes(npoints), weights(npoints);
+  AliPWGFunc::GaussLegendre(npoints, &nodes[0], &weights[0]);
+
+  fNDF = 0;
+  for (UInt_t ispectrum = 0; ispectrum < fSpectra.size(); ispectrum++) {
+    Spectrum & spectrum = fSpectra[ispectrum];
+    const TH1 * h = fHistos[ispectrum];
+    spectrum.fY.clear(); spectrum.fErr2.clear(); spectrum.fX.clear(); spectrum.fW.clear();
+    spectrum.fCached = kFALSE;
+    for (Int_t ibin = 1; ibin <= h->GetNbinsX(); ibin++) {
+      Double_t centre = h->GetBinCenter(ibin);
+      Double_t error  = h->GetBinError(ibin);
+      if (centre < fMin[ispectrum] || centre > fMax[ispectrum] || error <= 0) continue;
+      spectrum.fY.push_back(h->GetBinContent(ibin));
+      spectrum.fErr2.push_back(error*error);
+      Double_t width = h->GetBinWidth(ibin);
+      for (Int_t ipoint = 0; ipoint < npoints; ipoint++) {
+        spectrum.fX.push_back(centre + 0.5*width*nodes[ipoint]);
+        spectrum.fW.push_back(0.5*weights[ipoint]);
+      }
+    }
+    spectrum.fValues.resize(spectrum.fX.size());
+    fNDF += spectrum.fY.size();
+  }
+  for (UInt_t ipar = 0; ipar < fPar.size(); ipar++)
+    if (!fParFixed[ipar]) fNDF--;
+}
+
+void AliPWGBatchFitter::EvalSpectrum(Spectrum & spectrum, const Double_t * par) const {
+
+  // chi2 of one spectrum, the model is only re-evaluated if its parameters changed
+
+  spectrum.fChi2 = 0;
+  if (spectrum.fX.empty()) return;
+
+  std::vector<Double_t> local(fNLocalPar);
+  for (Int_t ipar = 0; ipar < fNLocalPar; ipar++) local[ipar] = par[spectrum.fParIndex[ipar]];
+  Double_t norm = 1;
+  if (fNormPar >= 0) {
+    norm = local[fNormPar];
+    local[fNormPar] = 1;
+  }
+  if (!spectrum.fCached || local != spectrum.fCachedPar) {
+    fFunc(spectrum.fX.size(), &spectrum.fX[0], &local[0], &spectrum.fValues[0]);
+    spectrum.fCachedPar = local;
+    spectrum.fCached = kTRUE;
+  }
+
+  Int_t npoints = spectrum.fX.size()/spectrum.fY.size();
+  for (UInt_t ibin = 0; ibin < spectrum.fY.size(); ibin++) {
+    Double_t model = 0;
+    for (Int_t ipoint = ibin*npoints; ipoint < Int_t(ibin+1)*npoints; ipoint++)
+      model += spectrum.fW[ipoint]*spectrum.fValues[ipoint];
+    Double_t diff = spectrum.fY[ibin] - norm*model;
+    spectrum.fChi2 += diff*diff/spectrum.fErr2[ibin];
+  }
+}
+
+Double_t AliPWGBatchFitter::Chi2(const Double_t * par) {
+
+  // total chi2, the spectra are shared between the threads
+
+  Int_t nthreads = TMath::Min(fNThreads, Int_t(fSpectra.size()));
+  if (nthreads <= 1) {
+    for (UInt_t ispectrum = 0; ispectrum < fSpectra.size(); ispectrum++) EvalSpectrum(fSpectra[ispectrum], par);
+  } else {
+    std::vector<std::thread> threads;
+    for (Int_t ithread = 0; ithread < nthreads; ithread++)
+      threads.push_back(std::thread([this, par, ithread, nthreads]() {
+        for (UInt_t ispectrum = ithread; ispectrum < fSpectra.size(); ispectrum += nthreads) EvalSpectrum(fSpectra[ispectrum], par);
+      }));
+    for (UInt_t ithread = 0; ithread < threads.size(); ithread++) threads[ithread].join();
+  }
+
+  Double_t chi2 = 0;
+  for (UInt_t ispectrum = 0; ispectrum < fSpectra.size(); ispectrum++) chi2 += fSpectra[ispectrum].fChi2;
+  return chi2;
+}
+
+Bool_t AliPWGBatchFitter::Fit() {
+
+  // minimize the total chi2 with the default minimizer
+
+  PrepareSpectra();
+  ROOT::Math::Minimizer * minimizer = ROOT::Math::Factory::CreateMinimizer(ROOT::Math::MinimizerOptions::DefaultMinimizerType(),
+									   ROOT::Math::MinimizerOptions::DefaultMinimizerAlgo());
+  if (!minimizer) {
+    Printf("ERROR: AliPWGBatchFitter: cannot create the minimizer");
+    return kFALSE;
+  }
+  ROOT::Math::Functor fcn(this, &AliPWGBatchFitter::Chi2, fPar.size());
+  minimizer->SetFunction(fcn);
+  minimizer->SetErrorDef(1);
+  for (UInt_t ipar = 0; ipar < fPar.size(); ipar++) {
+    Double_t step = fPar[ipar] != 0 ? 0.1*TMath::Abs(fPar[ipar]) : 0.01;
+    if (fParFixed[ipar])
+      minimizer->SetFixedVariable(ipar, fParNames[ipar], fPar[ipar]);
+    else if (fParLow[ipar] < fParHigh[ipar])
+      minimizer->SetLimitedVariable(ipar, fParNames[ipar], fPar[ipar], step, fParLow[ipar], fParHigh[ipar]);
+    else
+      minimizer->SetVariable(ipar, fParNames[ipar], fPar[ipar], step);
+  }
+
+  Bool_t ok = minimizer->Minimize();
+  if (ok) minimizer->Hesse();
+  for (UInt_t ipar = 0; ipar < fPar.size(); ipar++) {
+    fPar[ipar] = minimizer->X()[ipar];
+    fParErr[ipar] = minimizer->Errors() ? minimizer->Errors()[ipar] : 0;
+  }
+  fChi2 = minimizer->MinValue();
+  delete minimizer;
+  return ok;
+}
@@ -15,6 +15,9 @@
 
 #include "TObject.h"
 #include "TH1.h"
+#include "AliPWGFunc.h"
+#include <string>
+#include <vector>
 
 class TF1;
 class TH1D;
@@ -88,6 +91,12 @@ public:
   static Double_t dMtdptFunction(Double_t *x, Double_t *p) ;
   static Double_t GetdMtdEta(TH1 *hData, TF1 * fExtrapolation, Double_t mass) ;
 
+  // Global BGBW fit of dN/dpt spectra of several species, with common beta,
+  // T and n and one normalization per spectrum. par and parErr must hold
+  // 3+nspectra values (beta, T, n, norm[0..nspectra-1]), par is the starting value.
+  static Bool_t FitGlobalBGBW(Int_t nspectra, TH1 ** h, const Double_t * mass, const Float_t * min, const Float_t * max,
+			      Double_t * par, Double_t * parErr = 0, Int_t nthreads = 1);
+
   //  static Bool_t Compare2Plots(TObject * obj1, TObject * obj2);
 
 
@@ -103,4 +112,82 @@ private:
 
 };
 
+// ----------------------------------------------------------------------
+// Simultaneous chi2 fit of many spectra with a batch evaluated model
+// (see AliPWGFunc::BatchFunc_t). The local parameters of each spectrum
+// are mapped to global parameters, so that parameters can be shared
+// between spectra. If the normalization parameter is given, the model is
+// evaluated without it and cached per spectrum: changing the norm of one
+// spectrum, or any parameter not used by a spectrum, does not re-evaluate
+// the model. The spectra are evaluated in parallel if nthreads > 1.
+// ----------------------------------------------------------------------
+
+class AliPWGBatchFitter {
+
+public:
+
+  AliPWGBatchFitter(AliPWGFunc::BatchFunc_t func, Int_t nLocalPar, Int_t normPar = -1);
+  ~AliPWGBatchFitter() {}
+
+  // limits are used if low < high
+  Int_t  AddParameter(const char * name, Double_t value, Double_t low = 0, Double_t high = 0);
+  void   FixParameter(Int_t ipar, Bool_t fix = kTRUE) { fParFixed[ipar] = fix; }
+  void   SetParameter(Int_t ipar, Double_t value) { fPar[ipar] = value; }
+  // parIndex: global parameter of each local parameter
+  Int_t  AddSpectrum(const TH1 * h, const Int_t * parIndex, Float_t min = 0, Float_t max = 100);
+  void   SetNThreads(Int_t nthreads) { fNThreads = nthreads; }
+  // number of points per bin for the bin average, 1 evaluates at the bin centre
+  void   SetNPointsPerBin(Int_t npoints) { fNPointsPerBin = npoints; }
+
+  Bool_t Fit();
+
+  Int_t    GetNParameters() const { return fPar.size(); }
+  Int_t    GetNSpectra() const { return fSpectra.size(); }
+  Double_t GetParameter(Int_t ipar) const { return fPar[ipar]; }
+  Double_t GetParError(Int_t ipar) const { return fParErr[ipar]; }
+  Double_t GetChi2() const { return fChi2; }
+  Int_t    GetNDF() const { return fNDF; }
+
+  Double_t Chi2(const Double_t * par);
+
+private:
+
+  struct Spectrum {
+    std::vector<Int_t>    fParIndex;  // global index of the local parameters
+    std::vector<Double_t> fY;         // bin content
+    std::vector<Double_t> fErr2;      // squared bin error
+    std::vector<Double_t> fX;         // evaluation points, fNPointsPerBin per bin
+    std::vector<Double_t> fW;         // weights of the evaluation points
+    std::vector<Double_t> fValues;    // model at the evaluation points
+    std::vector<Double_t> fCachedPar; // parameters of fValues
+    Bool_t                fCached;    // fValues filled
+    Double_t              fChi2;
+  };
+
+  void PrepareSpectra();
+  void EvalSpectrum(Spectrum & spectrum, const Double_t * par) const;
+
+  AliPWGFunc::BatchFunc_t  fFunc;          // model
+  Int_t                    fNLocalPar;     // number of parameters of the model
+  Int_t                    fNormPar;       // local normalization parameter, -1 if none
+  Int_t                    fNThreads;      // threads for the chi2 evaluation
+  Int_t                    fNPointsPerBin; // evaluation points per bin
+  std::vector<std::string> fParNames;
+  std::vector<Double_t>    fPar;
+  std::vector<Double_t>    fParErr;
+  std::vector<Double_t>    fParLow;
+  std::vector<Double_t>    fParHigh;
+  std::vector<Bool_t>      fParFixed;
+  std::vector<const TH1 *> fHistos;
+  std::vector<Float_t>     fMin;
+  std::vector<Float_t>     fMax;
+  std::vector<Spectrum>    fSpectra;
+  Double_t                 fChi2;
+  Int_t                    fNDF;
+
+  AliPWGBatchFitter(const AliPWGBatchFitter&);            // not implemented
+  AliPWGBatchFitter& operator=(const AliPWGBatchFitter&); // not implemented
+
+};
+
 #endif
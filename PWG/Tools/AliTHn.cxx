@@ -39,9 +39,58 @@
 #include "TArrayD.h"
 #include "THnSparse.h"
 #include "TMath.h"
+#include "TBits.h"
+#include "TFile.h"
+#include "TObjArray.h"
+#include "TDirectory.h"
+
+#include <thread>
+#include <vector>
 
 templateClassImp(AliTHnT)
 
+Int_t AliTHnBase::fgNThreads = 1;
+
+namespace {
+  // splits [0,n) into AliTHnBase::GetNThreads() chunks with boundaries at multiples of <align> and calls func(first,last)
+  // for each; chunk 0 runs in the calling thread, small ranges are processed in one call
+  template<typename Func> void RunInChunks(Long64_t n, Long64_t align, Func& func)
+  {
+    const Long64_t kMinChunk = 1 << 16;
+    Int_t nThreads = AliTHnBase::GetNThreads();
+    if (nThreads <= 1 || n < kMinChunk * nThreads)
+    {
+      func(0, n);
+      return;
+    }
+    
+    std::vector<Long64_t> bounds(nThreads+1, n);
+    bounds[0] = 0;
+    for (Int_t t=1; t<nThreads; t++)
+      bounds[t] = n * t / nThreads / align * align;
+    
+    std::vector<std::thread> workers;
+    workers.reserve(nThreads-1);
+    for (Int_t t=1; t<nThreads; t++)
+      workers.emplace_back(func, bounds[t], bounds[t+1]);
+    func(bounds[0], bounds[1]);
+    for (auto& worker : workers)
+      worker.join();
+  }
+}
+
+Double_t AliTHnBase::EstimateSize(Int_t nSteps, Int_t nVars, const Int_t* nBins, Int_t elementSize, Bool_t sumw2)
+{
+  // returns the memory in bytes needed by a dense container with nSteps steps and nVars axes with nBins bins each
+  // (all steps filled, sumw2 included if requested); a Double_t to avoid overflow for large configurations
+  
+  Double_t size = 1;
+  for (Int_t i=0; i<nVars; i++)
+    size *= nBins[i];
+  
+  return size * nSteps * elementSize * ((sumw2) ? 2 : 1);
+}
+
 template <class TemplateArray, typename TemplateType>
 AliTHnT<TemplateArray, TemplateType>::AliTHnT() : 
   AliTHnBase(),
@@ -254,59 +303,133 @@ Long64_t AliTHnT<TemplateArray, TemplateType>::Merge(TCollection* list)
     if (entry == 0) 
       continue;
 
-    for (Int_t i=0; i<fNSteps; i++)
-    {
-      if (entry->fValues[i])
-      {
-	if (!fValues[i])
-	  fValues[i] = new TemplateArray(fNBins);
-      
-	for (Long64_t l = 0; l<fNBins; l++)
-	  fValues[i]->GetArray()[l] += entry->fValues[i]->GetArray()[l];
-      }
-
-      if (entry->fSumw2[i])
-      {
-	if (!fSumw2[i])
-	  fSumw2[i] = new TemplateArray(fNBins);
-      
-	for (Long64_t l = 0; l<fNBins; l++)
-	  fSumw2[i]->GetArray()[l] += entry->fSumw2[i]->GetArray()[l];
-      }
-    }
+    AddBuffers(entry);
     
     count++;
   }
+  
+  delete iter;
 
   return count+1;
 }
 
+//____________________________________________________________________
 template <class TemplateArray, typename TemplateType>
-void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep, Double_t weight)
+Long64_t AliTHnT<TemplateArray, TemplateType>::MergeFromFiles(const TCollection* fileNames, const char* path)
 {
-  // fills an entry
-
-  // fill axis cache
-  if (!axisCache)
+  // merges the AliTHnT found at <path> in each of the files <fileNames> (TObjString) into this
+  // the files are read one after the other, so only one sibling is in memory at a time
+  // the first part of <path> is read from the file (may contain directories), the following parts
+  // are looked up in the collections read, e.g. "PWG4_PhiCorrelations/histosPhiCorrelations/fTrackHist"
+  // Returns the number of merged objects (including this).
+  
+  if (!fileNames)
+    return 0;
+  
+  TObjArray* tokens = TString(path).Tokenize("/");
+  
+  Long64_t count = 0;
+  TIter next(fileNames);
+  while (TObject* fileName = next())
   {
-    axisCache = new TAxis*[fNVars];
-    fNbinsCache = new Int_t[fNVars];
-    for (Int_t i=0; i<fNVars; i++)
+    TFile* file = TFile::Open(fileName->GetName());
+    if (!file || file->IsZombie())
     {
-      axisCache[i] = GetAxis(i, 0);
-      fNbinsCache[i] = axisCache[i]->GetNbins();
+      AliError(Form("Could not open %s", fileName->GetName()));
+      delete file;
+      continue;
     }
     
-    fLastVars = new Double_t[fNVars];
-    fLastBins = new Int_t[fNVars];
+    // directories and the first object from the file, then collections
+    TObject* top = 0;
+    TObject* obj = 0;
+    TString dirPath;
+    for (Int_t i=0; i<tokens->GetEntriesFast(); i++)
+    {
+      const char* token = tokens->At(i)->GetName();
+      if (!top)
+      {
+        dirPath += (dirPath.Length() > 0) ? Form("/%s", token) : token;
+        TObject* tmp = file->Get(dirPath);
+        if (tmp && !tmp->InheritsFrom(TDirectory::Class()))
+          top = obj = tmp;
+      }
+      else if (obj && obj->InheritsFrom(TCollection::Class()))
+        obj = ((TCollection*) obj)->FindObject(token);
+      else
+        obj = 0;
+    }
     
-    // initial values to prevent checking for 0 below
-    for (Int_t i=0; i<fNVars; i++)
+    AliTHnT* entry = dynamic_cast<AliTHnT*> (obj);
+    if (entry)
     {
-      fLastBins[i] = axisCache[i]->FindBin(var[i]);
-      fLastVars[i] = var[i];
+      TList single;
+      single.Add(entry);
+      Merge(&single);
+      count++;
+    }
+    else
+      AliError(Form("%s not found in %s", path, fileName->GetName()));
+    
+    if (top && top->InheritsFrom(TCollection::Class()))
+      ((TCollection*) top)->SetOwner(kTRUE);
+    delete top;
+    file->Close();
+    delete file;
+  }
+  
+  delete tokens;
+  
+  return count+1;
+}
+
+//____________________________________________________________________
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::AddBuffers(const AliTHnT* entry)
+{
+  // adds the dense buffers of <entry> to this, the bins are split in chunks over fgNThreads threads
+  // a missing sumw2 means sumw2 == values (only weights 1 filled)
+  
+  for (Int_t i=0; i<fNSteps; i++)
+  {
+    if (!entry->fValues[i])
+      continue;
+    
+    const TemplateType* entryValues = entry->fValues[i]->GetArray();
+    
+    if (entry->fSumw2[i] || fSumw2[i])
+    {
+      if (!fSumw2[i])
+        fSumw2[i] = (fValues[i]) ? new TemplateArray(*fValues[i]) : new TemplateArray(fNBins);
+      
+      TemplateType* target = fSumw2[i]->GetArray();
+      const TemplateType* source = (entry->fSumw2[i]) ? entry->fSumw2[i]->GetArray() : entryValues;
+      auto add = [target, source](Long64_t first, Long64_t last) {
+        for (Long64_t l=first; l<last; l++)
+          target[l] += source[l];
+      };
+      RunInChunks(fNBins, 1, add);
     }
+    
+    if (!fValues[i])
+      fValues[i] = new TemplateArray(fNBins);
+    
+    TemplateType* target = fValues[i]->GetArray();
+    auto add = [target, entryValues](Long64_t first, Long64_t last) {
+      for (Long64_t l=first; l<last; l++)
+        target[l] += entryValues[l];
+    };
+    RunInChunks(fNBins, 1, add);
   }
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep, Double_t weight)
+{
+  // fills an entry
+
+  if (!axisCache)
+    InitCache();
   
   // calculate global bin index
   Long64_t bin = 0;
@@ -334,13 +457,114 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 //     Printf("%lld", bin);
   }
 
+  CreateStep(istep, weight != 1);
+
+  fValues[istep]->GetArray()[bin] += weight;
+  if (fSumw2[istep])
+    fSumw2[istep]->GetArray()[bin] += weight * weight;
+  
+//   Printf("%f", fValues[istep][bin]);
+  
+  // debug
+//   AliCFContainer::Fill(var, istep, weight);
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::FillBins(Int_t nEntries, const Int_t *bins, Int_t istep, const Double_t *weights)
+{
+  // fills nEntries entries given by their TAxis bin indices (row-major, fNVars per entry, e.g. from FindBin)
+  // weights is either 0 (all weights 1) or holds one weight per entry
+  // entries with an under/overflow bin on any axis are skipped as in Fill
+  
+  if (nEntries <= 0)
+    return;
+  
+  if (!axisCache)
+    InitCache();
+  
+  Bool_t needSumw2 = kFALSE;
+  if (weights)
+    for (Int_t j=0; j<nEntries && !needSumw2; j++)
+      if (weights[j] != 1)
+        needSumw2 = kTRUE;
+  
+  CreateStep(istep, needSumw2);
+  
+  TemplateType* values = fValues[istep]->GetArray();
+  TemplateType* sumw2 = (fSumw2[istep]) ? fSumw2[istep]->GetArray() : 0;
+  
+  for (Int_t j=0; j<nEntries; j++)
+  {
+    const Int_t* entryBins = bins + j * fNVars;
+    
+    Long64_t bin = 0;
+    Int_t i = 0;
+    for (; i<fNVars; i++)
+    {
+      if (entryBins[i] < 1 || entryBins[i] > fNbinsCache[i])
+        break;
+      bin = bin * fNbinsCache[i] + entryBins[i] - 1;
+    }
+    if (i < fNVars)
+      continue;
+    
+    Double_t weight = (weights) ? weights[j] : 1;
+    values[bin] += weight;
+    if (sumw2)
+      sumw2[bin] += weight * weight;
+  }
+}
+
+template <class TemplateArray, typename TemplateType>
+Int_t AliTHnT<TemplateArray, TemplateType>::FindBin(Int_t var, Double_t value)
+{
+  // returns the TAxis bin of value on axis var, using the same cache as Fill
+  
+  if (!axisCache)
+    InitCache();
+  
+  if (fLastVars[var] != value)
+  {
+    fLastBins[var] = axisCache[var]->FindBin(value);
+    fLastVars[var] = value;
+  }
+  
+  return fLastBins[var];
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::InitCache()
+{
+  // fills axis cache
+  
+  axisCache = new TAxis*[fNVars];
+  fNbinsCache = new Int_t[fNVars];
+  fLastVars = new Double_t[fNVars];
+  fLastBins = new Int_t[fNVars];
+  
+  for (Int_t i=0; i<fNVars; i++)
+  {
+    axisCache[i] = GetAxis(i, 0);
+    fNbinsCache[i] = axisCache[i]->GetNbins();
+    
+    // initial values to prevent checking for 0 in Fill: an underflow value and its bin
+    fLastVars[i] = axisCache[i]->GetXmin() - 1;
+    fLastBins[i] = 0;
+  }
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::CreateStep(Int_t istep, Bool_t sumw2)
+{
+  // creates the containers of step istep if not done yet
+  
   if (!fValues[istep])
   {
     fValues[istep] = new TemplateArray(fNBins);
     AliInfo(Form("Created values container for step %d", istep));
   }
 
-  if (weight != 1)
+  if (sumw2)
   {
     // initialize with already filled entries (which have been filled with weight == 1), in this case fSumw2 := fValues
     if (!fSumw2[istep])
@@ -349,15 +573,6 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
       AliInfo(Form("Created sumw2 container for step %d", istep));
     }
   }
-
-  fValues[istep]->GetArray()[bin] += weight;
-  if (fSumw2[istep])
-    fSumw2[istep]->GetArray()[bin] += weight * weight;
-  
-//   Printf("%f", fValues[istep][bin]);
-  
-  // debug
-//   AliCFContainer::Fill(var, istep, weight);
 }
 
 template <class TemplateArray, typename TemplateType>
@@ -381,6 +596,10 @@ template <class TemplateArray, typename TemplateType>
 void AliTHnT<TemplateArray, TemplateType>::FillContainer(AliCFContainer* cont)
 {
   // fills the information stored in the buffer in this class into the container <cont>
+  // only the bins flagged in the occupancy map of the step are visited
+  
+  Int_t* binIdx = new Int_t[fNVars];
+  Int_t* nBins  = new Int_t[fNVars];
   
   for (Int_t i=0; i<fNSteps; i++)
   {
@@ -395,54 +614,67 @@ void AliTHnT<TemplateArray, TemplateType>::FillContainer(AliCFContainer* cont)
     
     THnSparse* target = cont->GetGrid(i)->GetGrid();
     
-    Int_t* binIdx = new Int_t[fNVars];
-    Int_t* nBins  = new Int_t[fNVars];
     for (Int_t j=0; j<fNVars; j++)
-    {
-      binIdx[j] = 1;
       nBins[j] = target->GetAxis(j)->GetNbins();
-    }
     
-    Long64_t count = 0;
+    TBits occupancy;
+    BuildOccupancy(i, occupancy);
     
-    while (1)
+    Long64_t count = 0;
+    for (UInt_t globalBin = occupancy.FirstSetBit(); globalBin < occupancy.GetNbits(); globalBin = occupancy.FirstSetBit(globalBin+1))
     {
-//       for (Int_t j=0; j<fNVars; j++)
-// 	printf("%d ", binIdx[j]);
-      
-      Long64_t globalBin = GetGlobalBinIndex(binIdx);
-//       Printf(" --> %lld", globalBin);
-      
-      if (source[globalBin] != 0)
+      // global bin index --> TAxis bin indices (inverse of GetGlobalBinIndex)
+      Long64_t remainder = globalBin;
+      for (Int_t j=fNVars-1; j>=0; j--)
       {
-	target->SetBinContent(binIdx, source[globalBin]);
-	target->SetBinError(binIdx, TMath::Sqrt(sourceSumw2[globalBin]));
-	
-	count++;
+        binIdx[j] = remainder % nBins[j] + 1;
+        remainder /= nBins[j];
       }
       
-      binIdx[fNVars-1]++;
-      
-      for (Int_t j=fNVars-1; j>0; j--)
-      {
-	if (binIdx[j] > nBins[j])
-	{
-	  binIdx[j] = 1;
-	  binIdx[j-1]++;
-	}
-      }
+      target->SetBinContent(binIdx, source[globalBin]);
+      target->SetBinError(binIdx, TMath::Sqrt(sourceSumw2[globalBin]));
       
-      if (binIdx[0] > nBins[0])
-	break;
+      count++;
     }
     
-    AliInfo(Form("Step %d: copied %lld entries out of %lld bins", i, count, GetGlobalBinIndex(binIdx)));
+    AliInfo(Form("Step %d: copied %lld entries out of %lld bins", i, count, fNBins));
+  }
+  
+  delete[] binIdx;
+  delete[] nBins;
+}
 
-    delete[] binIdx;
-    delete[] nBins;
-  }  
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::BuildOccupancy(Int_t step, TBits& occupancy) const
+{
+  // flags the non-empty bins of step <step> in <occupancy>
+  // the scan is split in chunks over fgNThreads threads; chunk boundaries are multiples of 8 bins so that
+  // the threads never write into the same byte of the bit map
+  
+  occupancy.ResetAllBits();
+  if (!fValues[step] || fNBins == 0)
+    return;
+  
+  if (fNBins > kMaxUInt)
+  {
+    AliFatal(Form("%lld bins exceed the size of the occupancy map", fNBins));
+    return;
+  }
+  
+  // allocate the full map before the threads start
+  occupancy.SetBitNumber(fNBins-1, kFALSE);
+  
+  const TemplateType* source = fValues[step]->GetArray();
+  auto scan = [source, &occupancy](Long64_t first, Long64_t last) {
+    for (Long64_t l=first; l<last; l++)
+      if (source[l] != 0)
+        occupancy.SetBitNumber(l);
+  };
+  
+  RunInChunks(fNBins, 8, scan);
 }
 
+template <class TemplateArray, typename TemplateType>
 template <class TemplateArray, typename TemplateType>
 void AliTHnT<TemplateArray, TemplateType>::FillParent()
 {
@@ -15,6 +15,7 @@
 #include "AliCFContainer.h"
 
 class TArray;
+class TBits;
 class TArrayF;
 class TArrayD;
 class TCollection;
@@ -26,7 +27,9 @@ public:
   AliTHnBase(const Char_t* name, const Char_t* title,const Int_t nSelStep, const Int_t nVarIn, const Int_t* nBinIn) : AliCFContainer(name, title, nSelStep, nVarIn, nBinIn) { }
   
   virtual void Fill(const Double_t *var, Int_t istep, Double_t weight=1.) = 0;
+  virtual void FillBins(Int_t nEntries, const Int_t *bins, Int_t istep, const Double_t *weights=0) = 0;
   virtual void FillParent() = 0;
+  virtual Int_t FindBin(Int_t var, Double_t value) = 0;
   virtual void FillContainer(AliCFContainer* cont) = 0;
 
   virtual TArray* GetValues(Int_t step) = 0;
@@ -35,6 +38,14 @@ public:
   virtual void DeleteContainers() = 0;
   virtual void ReduceAxis() = 0;  
   
+  static Double_t EstimateSize(Int_t nSteps, Int_t nVars, const Int_t* nBins, Int_t elementSize, Bool_t sumw2 = kTRUE);
+  
+  static void SetNThreads(Int_t nThreads) { fgNThreads = nThreads; }
+  static Int_t GetNThreads() { return fgNThreads; }
+  
+protected:
+  static Int_t fgNThreads; // number of threads used in Merge and FillParent
+  
   ClassDef(AliTHnBase, 1) // AliTHn base class
 };
 
@@ -48,7 +59,9 @@ class AliTHnT : public AliTHnBase
   virtual ~AliTHnT();
   
   virtual void Fill(const Double_t *var, Int_t istep, Double_t weight=1.) ;
+  virtual void FillBins(Int_t nEntries, const Int_t *bins, Int_t istep, const Double_t *weights=0);
   virtual void FillParent();
+  virtual Int_t FindBin(Int_t var, Double_t value);
   virtual void FillContainer(AliCFContainer* cont);
   
   virtual TArray* GetValues(Int_t step) { return fValues[step]; }
@@ -62,9 +75,14 @@ class AliTHnT : public AliTHnBase
   virtual void Copy(TObject& c) const;
 
   virtual Long64_t Merge(TCollection* list);
+  Long64_t MergeFromFiles(const TCollection* fileNames, const char* path);
   
 protected:
   void Init();
+  void InitCache();
+  void CreateStep(Int_t istep, Bool_t sumw2);
+  void AddBuffers(const AliTHnT* entry);
+  void BuildOccupancy(Int_t step, TBits& occupancy) const;
   Long64_t GetGlobalBinIndex(const Int_t* binIdx);
   
   Long64_t fNBins;   // number of total bins
@@ -5,6 +5,10 @@
 
 #include <cstdio>
 #include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <sstream>
 
 #include <TSystem.h>
 #include <TGrid.h>
@@ -18,6 +22,26 @@ ClassImp(PWG::Tools::AliYAMLConfiguration);
 namespace PWG {
 namespace Tools {
 
+namespace {
+
+/**
+ * @struct DocumentCache
+ * @brief Parsed YAML documents shared by all the configurations of the process, keyed by the content hash.
+ */
+struct DocumentCache {
+  std::mutex fMutex;                                                    ///< Protects the map.
+  bool fEnabled = true;                                                 ///< Use the cache when loading documents.
+  std::multimap<std::size_t, std::pair<std::string, YAML::Node> > fDocuments; ///< Content hash -> (content, parsed document).
+};
+
+DocumentCache & GetDocumentCache()
+{
+  static DocumentCache cache;
+  return cache;
+}
+
+} // namespace
+
 /**
  * Default constructor.
  *
@@ -27,6 +51,7 @@ namespace Tools {
 AliYAMLConfiguration::AliYAMLConfiguration(const std::string prefixString, const std::string delimiterCharacter):
   TObject(),
   fConfigurations(),
+  fBindings(),
   fConfigurationsStrings(),
   fInitialized(false),
   fPrefixString(prefixString),
@@ -66,8 +91,11 @@ int AliYAMLConfiguration::AddConfiguration(std::string configurationFilename, st
     return -1;
   }
 
-  // Create node from filename
-  auto node = YAML::LoadFile(configurationFilename);
+  // Create node from the file content (parsed only once per process for identical content)
+  std::ifstream inputFile(configurationFilename);
+  std::stringstream content;
+  content << inputFile.rdbuf();
+  auto node = LoadDocument(content.str());
 
   if (node.IsNull() == true) {
     AliErrorStream() << "The node at configuration filename \"" << configurationFilename << "\" is null and will not be added!\n";
@@ -378,16 +406,129 @@ bool AliYAMLConfiguration::Reinitialize()
 
     for (const auto & configStrPair : fConfigurationsStrings)
     {
-      YAML::Node node = YAML::Load(configStrPair.second);
+      YAML::Node node = LoadDocument(configStrPair.second);
       fConfigurations.push_back(std::make_pair(configStrPair.first, node));
     }
 
     returnValue = true;
   }
 
+  ResolveBindings();
+
   return returnValue;
 }
 
+/**
+ * Resolve all the bound properties again, for example after adding a configuration
+ * which overrides some of the bound values.
+ *
+ * @return True if all the bound properties were set.
+ */
+bool AliYAMLConfiguration::ResolveBindings()
+{
+  if (fConfigurations.size() == 0) {
+    return fBindings.size() == 0;
+  }
+
+  bool returnValue = true;
+  for (auto & binding : fBindings) {
+    returnValue = binding() && returnValue;
+  }
+
+  return returnValue;
+}
+
+/**
+ * Parse a YAML document. If the cache is enabled, identical content is only parsed once per
+ * process and each call returns a copy of the cached document, such that the configurations
+ * can be modified independently.
+ *
+ * @param[in] content Content of the YAML document.
+ *
+ * @return The parsed document.
+ */
+YAML::Node AliYAMLConfiguration::LoadDocument(const std::string & content)
+{
+  DocumentCache & cache = GetDocumentCache();
+  std::lock_guard<std::mutex> lock(cache.fMutex);
+  if (cache.fEnabled == false) {
+    return YAML::Load(content);
+  }
+
+  const std::size_t hash = std::hash<std::string>()(content);
+  auto range = cache.fDocuments.equal_range(hash);
+  for (auto it = range.first; it != range.second; it++) {
+    // Compare the content to be safe against hash collisions
+    if (it->second.first == content) {
+      AliDebugGeneralStream("AliYAMLConfiguration", 2) << "Using cached YAML document with hash " << hash << "\n";
+      return YAML::Clone(it->second.second);
+    }
+  }
+
+  YAML::Node node = YAML::Load(content);
+  cache.fDocuments.insert(std::make_pair(hash, std::make_pair(content, node)));
+  return YAML::Clone(node);
+}
+
+/**
+ * Enable or disable the process wide cache of the parsed documents.
+ *
+ * @param[in] useCache True if the cache should be used.
+ */
+void AliYAMLConfiguration::SetUseDocumentCache(bool useCache)
+{
+  DocumentCache & cache = GetDocumentCache();
+  std::lock_guard<std::mutex> lock(cache.fMutex);
+  cache.fEnabled = useCache;
+  if (useCache == false) {
+    cache.fDocuments.clear();
+  }
+}
+
+/**
+ * Remove all the parsed documents from the process wide cache.
+ */
+void AliYAMLConfiguration::ClearDocumentCache()
+{
+  DocumentCache & cache = GetDocumentCache();
+  std::lock_guard<std::mutex> lock(cache.fMutex);
+  cache.fDocuments.clear();
+}
+
+/**
+ * @return Number of parsed documents in the process wide cache.
+ */
+unsigned int AliYAMLConfiguration::GetNCachedDocuments()
+{
+  DocumentCache & cache = GetDocumentCache();
+  std::lock_guard<std::mutex> lock(cache.fMutex);
+  return cache.fDocuments.size();
+}
+
+/**
+ * Join the elements of a property path with the delimiter used by GetProperty(...).
+ *
+ * @param[in] propertyPath Path to the property in the YAML file.
+ *
+ * @return The joined property name.
+ */
+std::string AliYAMLConfiguration::JoinPropertyPath(const std::vector<std::string> & propertyPath) const
+{
+  // Combine the requested names together
+  std::string requestedName = "";
+  for (auto & str : propertyPath)
+  {
+    if (requestedName.length() > 0) {
+      requestedName += ":" + str;
+    }
+    else {
+      requestedName = str;
+    }
+  }
+
+  return requestedName;
+}
+
 /**
  * Check if value is a shared parameter, meaning we should look
  * at another node. Also edits the input string to remove "sharedParameters:"
@@ -9,6 +9,9 @@
 #include <string>
 #include <vector>
 #include <ostream>
+#if !(defined(__CINT__) || defined(__MAKECINT__))
+#include <functional>
+#endif
 
 #include <TObject.h>
 #include <TString.h>
@@ -124,6 +127,25 @@
  * Given the limitations, YAML anchors are recommended for more advanced usage as they can
  * be much more sophisticated.
  *
+ * Notes on parsing and binding:
+ *
+ * Parsed documents are kept in a process wide cache keyed by the hash of the file (or streamed
+ * string) content, so several wagons reading the same configuration parse it only once. Each
+ * configuration receives its own copy of the cached document, so WriteProperty(...) never affects
+ * other configurations. The cache can be disabled with SetUseDocumentCache(false).
+ *
+ * Properties which are needed often (for example per event or per run) should not be retrieved
+ * with GetProperty(...) each time, since every call walks the YAML nodes by the string path.
+ * Instead, bind them once to plain members of the task:
+ *
+ * ~~~{.cxx}
+ * // Resolved immediately and again whenever ResolveBindings() or Reinitialize() is called.
+ * fYAMLConfig.Bind({"hello", "world", "exampleValue"}, fExampleValue);
+ * ~~~
+ *
+ * The bindings store references to the bound members and are not streamed, so they should be
+ * created after Reinitialize(), for example in `UserCreateOutputObjects()`.
+ *
  * @author Raymond Ehlers <raymond.ehlers@yale.edu>, Yale University
  * @date Sept 19, 2017
  */
@@ -247,6 +269,18 @@ class AliYAMLConfiguration : public TObject {
   bool GetProperty(std::string propertyName, T & property, const bool requiredProperty = true) const;
   /** @} */
 
+  /** @{
+   * @name Bind a property to a variable, resolved once instead of at every access
+   */
+  template<typename T>
+  bool Bind(const std::vector<std::string> propertyPath, T & property, const bool requiredProperty = true);
+  template<typename T>
+  bool Bind(const std::string & propertyName, T & property, const bool requiredProperty = true);
+  bool ResolveBindings();
+  void ClearBindings()                                                                         { fBindings.clear(); }
+  unsigned int GetNBindings()                                                           const { return fBindings.size(); }
+  /** @} */
+
   /** @{
    * @name Write a property to a particular configuration
    */
@@ -282,6 +316,14 @@ class AliYAMLConfiguration : public TObject {
   void Print(Option_t* /* opt */ = "") const;
   /** @} */
 
+  /** @{
+   * @name Process wide cache of the parsed documents.
+   */
+  static void SetUseDocumentCache(bool useCache);
+  static void ClearDocumentCache();
+  static unsigned int GetNCachedDocuments();
+  /** @} */
+
  protected:
 
   // Utility functions
@@ -316,7 +358,11 @@ class AliYAMLConfiguration : public TObject {
   template<typename T>
   void WriteValue(YAML::Node & node, std::string propertyName, T & proeprty);
 
+  static YAML::Node LoadDocument(const std::string & content);
+  std::string JoinPropertyPath(const std::vector<std::string> & propertyPath) const;
+
   std::vector<std::pair<std::string, YAML::Node> > fConfigurations;         //!<! Contains all YAML configurations. The first element has the highest precedence.
+  std::vector<std::function<bool()> > fBindings;                            //!<! Bound properties, re-resolved by ResolveBindings().
   #endif
   std::vector<std::pair<std::string, std::string> > fConfigurationsStrings; ///<  Contains all YAML configurations as strings so that they can be streamed.
 
@@ -325,7 +371,7 @@ class AliYAMLConfiguration : public TObject {
   std::string fDelimiter;                     ///< Delimiter character to separate each level of the request.
 
   /// \cond CLASSIMP
-  ClassDef(AliYAMLConfiguration, 1); // YAML Configuration
+  ClassDef(AliYAMLConfiguration, 2); // YAML Configuration
   /// \endcond
 };
 
@@ -450,20 +496,50 @@ bool AliYAMLConfiguration::GetProperty(std::vector <std::string> propertyPath, c
 template<typename T>
 bool AliYAMLConfiguration::GetProperty(const std::vector <std::string> propertyPath, T & property, const bool requiredProperty) const
 {
-  // Combine the requested names together
-  std::string requestedName = "";
-  for (auto & str : propertyPath)
-  {
-    if (requestedName.length() > 0) {
-      requestedName += ":" + str;
-    }
-    else {
-      requestedName = str;
-    }
-  }
-
   // Pass on the properly requested call
-  return GetProperty(requestedName, property, requiredProperty);
+  return GetProperty(JoinPropertyPath(propertyPath), property, requiredProperty);
+}
+
+/**
+ * Helper function for Bind(...). Each value in the property path will be joined together in the same
+ * way as for GetProperty(...).
+ *
+ * @param[in] propertyPath Path to the property in the YAML file.
+ * @param[out] property Variable bound to the property.
+ * @param[in] requiredProperty True if the property is required
+ *
+ * @return True if the property was set successfully
+ */
+template<typename T>
+bool AliYAMLConfiguration::Bind(const std::vector <std::string> propertyPath, T & property, const bool requiredProperty)
+{
+  return Bind(JoinPropertyPath(propertyPath), property, requiredProperty);
+}
+
+/**
+ * Bind a property to a variable. The property path is resolved here (if there are configurations
+ * available) and then only when ResolveBindings() is called, such that the bound variable can be
+ * read directly in the hot path. The variable must outlive the binding (or ClearBindings() must be
+ * called before it goes out of scope).
+ *
+ * @param[in] propertyName Name of the property to bind
+ * @param[out] property Variable bound to the property
+ * @param[in] requiredProperty True if the property is required
+ *
+ * @return True if the property was set successfully (false also if no configuration is available yet)
+ */
+template<typename T>
+bool AliYAMLConfiguration::Bind(const std::string & propertyName, T & property, const bool requiredProperty)
+{
+  T * target = &property;
+  fBindings.push_back([this, propertyName, target, requiredProperty]() {
+    return GetProperty(propertyName, *target, requiredProperty);
+  });
+
+  if (fConfigurations.size() == 0) {
+    return false;
+  }
+  return fBindings.back()();
 }
 
 /**
@@ -12,6 +12,8 @@
 #pragma link C++ class AliLatexTable+;
 #pragma link C++ class AliNamedArrayI+;
 #pragma link C++ class AliNamedString+;
+#pragma link C++ class AliEventBlackboard+;
+#pragma link C++ class AliMCAncestryIndex+;
 #pragma link C++ class AliPWGFunc+;
 #pragma link C++ class AliPWGHistoTools+;
 #pragma link C++ typedef AliTHn;
@@ -21,6 +23,8 @@
 #pragma link C++ class AliTHnT<TArrayD, Double_t>+;
 #pragma link C++ class THistManager+;
 #pragma link C++ class AliJSONReader+;
+#pragma link C++ class AliJSONStreamHandler+;
+#pragma link C++ class AliJSONTypedMap+;
 #pragma link C++ class AliJSONData+;
 #pragma link C++ class AliJSONValue+;
 #pragma link C++ class AliJSONInt+;
@@ -29,6 +33,7 @@
 #pragma link C++ class AliJSONBool+;
 #pragma link C++ class AliJSONString+;
 #pragma link C++ class AliAnalysisTaskDummy+;
+#pragma link C++ class AliAnalysisTaskProfiler+;
 #pragma link C++ class AliTLorentzVector+;
 #if ROOT_VERSION_CODE > ROOT_VERSION(6,4,0)
 #pragma link C++ class AliMCSpectraWeights+;
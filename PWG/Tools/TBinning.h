@@ -3,6 +3,7 @@
 /* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
  * See cxx source for full Copyright notice                               */
 
+#include <TArrayD.h>
 #include <TObject.h>
 
 /**
@@ -19,6 +20,11 @@
  * ~~~{.cxx}
  * void CreateBinEdges(TArrayD &binedges) const.
  * ~~~
+ *
+ * Binnings can also be used to find bins without a TAxis, following the
+ * TAxis convention (0: underflow, 1 to nbins, nbins+1: overflow). The default
+ * implementation of FindBin creates the bin edges on each call, classes
+ * implementing the binning provide a faster lookup.
  */
 class TBinning : public TObject {
 public:
@@ -46,6 +52,43 @@ public:
    */
   virtual void CreateBinEdges(TArrayD &binedges) const = 0;
 
+  /**
+   * Get the number of bins
+   * @return Number of bins
+   */
+  virtual Int_t GetNbins() const { TArrayD edges; CreateBinEdges(edges); return edges.GetSize() - 1; }
+
+  /**
+   * Find the bin of a value, with the same convention as TAxis::FindFixBin
+   * @param[in] x Value
+   * @return Bin number (0 for underflow, nbins+1 for overflow)
+   */
+  virtual Int_t FindBin(Double_t x) const { TArrayD edges; CreateBinEdges(edges); return FindBinInEdges(edges.GetArray(), edges.GetSize(), x); }
+
+  /**
+   * Find the bin of a value in an array of bin edges in increasing order.
+   *
+   * Binary search with a fixed number of steps for a given number of
+   * edges, the search interval is halved without branching on the
+   * comparison.
+   * @param[in] edges Bin edges
+   * @param[in] nedges Number of bin edges (number of bins + 1)
+   * @param[in] x Value
+   * @return Bin number (0 for underflow, nbins+1 for overflow)
+   */
+  static Int_t FindBinInEdges(const Double_t *edges, Int_t nedges, Double_t x) {
+    if(nedges < 2 || x < edges[0]) return 0;
+    if(!(x < edges[nedges-1])) return nedges;
+    const Double_t *base = edges;
+    Int_t len = nedges - 1;
+    while(len > 1){
+      Int_t half = len / 2;
+      base += (base[half] <= x) ? half : 0;
+      len -= half;
+    }
+    return base - edges + 1;
+  }
+
   ClassDef(TBinning, 1);
 };
 
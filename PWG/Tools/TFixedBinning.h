@@ -0,0 +1,96 @@
+#ifndef TFIXEDBINNING_H
+#define TFIXEDBINNING_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <exception>
+#include <Rtypes.h>
+#include <TArrayD.h>
+#include <TBinning.h>
+
+/**
+ * @class TFixedBinning
+ * @brief Bin finder for a binning with the number of bins fixed at compile time
+ * @ingroup Histmanager
+ *
+ * The bin edges are stored in a member array of NBINS+1 values, and the
+ * binary search in FindBin has a number of steps known at compile time,
+ * so that it can be fully unrolled. Useful for bin lookups in loops
+ * without a TAxis, the bin numbers follow the TAxis convention.
+ *
+ * ~~~{.cxx}
+ * const Double_t ptedges[7] = {0., 0.5, 1., 2., 5., 10., 20.};
+ * TFixedBinning<6> ptbinning(ptedges);
+ * Int_t bin = ptbinning.FindBin(pt);
+ * ~~~
+ *
+ * The edges can also be taken from a TBinning, e.g. TLinearBinning or TCustomBinning.
+ */
+template<Int_t NBINS>
+class TFixedBinning {
+public:
+
+  /**
+   * @class BinningMismatchException
+   * @brief Exception indicating that the number of bins of the source binning does not match
+   * @ingroup Histmanager
+   */
+  class BinningMismatchException : public std::exception {
+  public:
+    BinningMismatchException() {}
+    virtual ~BinningMismatchException() throw() {}
+    virtual const char *what() const throw() { return "Number of bins does not match the fixed binning."; }
+  };
+
+  /**
+   * Constructor, defining the bin edges from a c-array
+   * @param[in] binedges NBINS+1 bin edges in increasing order
+   */
+  TFixedBinning(const Double_t *binedges) {
+    for(Int_t i = 0; i <= NBINS; i++) fEdges[i] = binedges[i];
+  }
+
+  /**
+   * Constructor, taking the bin edges from a binning description
+   * @param[in] binning Binning with NBINS bins
+   * @throw BinningMismatchException in case the binning has a different number of bins
+   */
+  TFixedBinning(const TBinning &binning) {
+    TArrayD binedges;
+    binning.CreateBinEdges(binedges);
+    if(binedges.GetSize() != NBINS + 1) throw BinningMismatchException();
+    for(Int_t i = 0; i <= NBINS; i++) fEdges[i] = binedges[i];
+  }
+
+  /**
+   * Get the number of bins
+   * @return Number of bins
+   */
+  static Int_t GetNbins() { return NBINS; }
+
+  /**
+   * Get the lower edge of a bin
+   * @param[in] bin Bin number (1 to NBINS+1)
+   * @return Lower edge of the bin
+   */
+  Double_t GetBinLowEdge(Int_t bin) const { return fEdges[bin-1]; }
+
+  /**
+   * Find the bin of a value, same convention as TAxis::FindFixBin
+   * @param[in] x Value
+   * @return Bin number (0 for underflow, NBINS+1 for overflow)
+   */
+  Int_t FindBin(Double_t x) const {
+    if(x < fEdges[0]) return 0;
+    if(!(x < fEdges[NBINS])) return NBINS + 1;
+    const Double_t *base = fEdges;
+    for(Int_t len = NBINS; len > 1; len -= len / 2)
+      base += (base[len / 2] <= x) ? len / 2 : 0;
+    return base - fEdges + 1;
+  }
+
+private:
+  Double_t fEdges[NBINS + 1];     ///< Bin edges
+};
+
+#endif /* TFIXEDBINNING_H */
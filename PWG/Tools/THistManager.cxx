@@ -12,15 +12,21 @@
  * about the suitability of this software for any purpose. It is          *
  * provided "as is" without express or implied warranty.                  *
  **************************************************************************/
+#include <algorithm>
 #include <cfloat>
 #include <cstring>
 #include <iostream>   // for unit tests
 #include <sstream>
 #include <string>
 #include <exception>
+#include <map>
+#include <mutex>
+#include <thread>
 #include <vector>
+#include <atomic>
 #include <TArrayD.h>
 #include <TAxis.h>
+#include <TClass.h>
 #include <TH1.h>
 #include <TH2.h>
 #include <TH3.h>
@@ -30,6 +36,7 @@
 #include <TObjArray.h>
 #include <TObjString.h>
 #include <TProfile.h>
+#include <TROOT.h>
 #include <TString.h>
 
 #include "TBinning.h"
@@ -42,14 +49,22 @@ ClassImp(THistManager)
 THistManager::THistManager():
 		TNamed(),
 		fHistos(NULL),
-		fIsOwner(true)
+		fIsOwner(true),
+		fCountNamedFills(false),
+		fNamedFillCounts(),
+		fThreadSharding(false),
+		fShards(nullptr)
 {
 }
 
 THistManager::THistManager(const char *name):
 		TNamed(name, Form("Histogram container %s", name)),
 		fHistos(NULL),
-		fIsOwner(true)
+		fIsOwner(true),
+		fCountNamedFills(false),
+		fNamedFillCounts(),
+		fThreadSharding(false),
+		fShards(nullptr)
 {
 	fHistos = new THashList();
 	fHistos->SetName(Form("histos%s", name));
@@ -57,9 +72,127 @@ THistManager::THistManager(const char *name):
 }
 
 THistManager::~THistManager(){
+	DeleteShards();
+	delete fShards;
 	if(fHistos && fIsOwner) delete fHistos;
 }
 
+/// Per-thread copies of the histograms of a THistManager
+struct THistManagerShards {
+  struct Shard {
+    std::thread::id                     fThread;    ///< Thread filling the shard
+    std::map<const TObject *, TObject *> fClones;    ///< Copies of the master objects, only accessed by fThread
+  };
+  std::mutex            fMutex;     ///< Protects fShards and the creation of the copies
+  std::vector<Shard *>  fShards;    ///< Shards of all the threads
+  ULong64_t             fId;        ///< Identifies the shards in the thread-local lookup, renewed on merge
+};
+
+namespace {
+  std::atomic<ULong64_t> gShardId(0);
+
+  Long64_t EstimateMemory(const TObject *o){
+    // bins are stored in double precision
+    if(const TProfile *prof = dynamic_cast<const TProfile *>(o))
+      return Long64_t(prof->GetNcells()) * sizeof(Double_t) * (3 + (prof->GetSumw2N() ? 1 : 0));
+    if(const TH1 *hist = dynamic_cast<const TH1 *>(o))
+      return Long64_t(hist->GetNcells()) * sizeof(Double_t) * (hist->GetSumw2N() ? 2 : 1);
+    if(const THnSparse *sparse = dynamic_cast<const THnSparse *>(o))
+      return sparse->GetNbins() * (sizeof(Double_t) * (sparse->GetCalculateErrors() ? 2 : 1) + sparse->GetNdimensions() * sizeof(Int_t));
+    return 0;
+  }
+}
+
+void THistManager::SetThreadSharding(Bool_t doShard) {
+  if(!doShard) MergeShards();
+  if(doShard && !fShards){
+    ROOT::EnableThreadSafety();
+    fShards = new THistManagerShards;
+    fShards->fId = ++gShardId;
+  }
+  fThreadSharding = doShard;
+}
+
+TObject *THistManager::GetShardObject(TObject *master) const {
+  static thread_local std::map<ULong64_t, THistManagerShards::Shard *> threadShards;
+  THistManagerShards::Shard *&shard = threadShards[fShards->fId];
+  if(!shard){
+    std::lock_guard<std::mutex> lock(fShards->fMutex);
+    shard = new THistManagerShards::Shard;
+    shard->fThread = std::this_thread::get_id();
+    fShards->fShards.push_back(shard);
+  }
+  TObject *&clone = shard->fClones[master];
+  if(!clone){
+    std::lock_guard<std::mutex> lock(fShards->fMutex);
+    clone = master->Clone();
+    if(TH1 *hist = dynamic_cast<TH1 *>(clone)){
+      hist->SetDirectory(nullptr);
+      hist->Reset();
+    } else if(THnBase *hn = dynamic_cast<THnBase *>(clone)){
+      hn->Reset();
+    }
+  }
+  return clone;
+}
+
+void THistManager::MergeShards() {
+  if(!fShards) return;
+  std::lock_guard<std::mutex> lock(fShards->fMutex);
+  for(std::vector<THistManagerShards::Shard *>::iterator shard = fShards->fShards.begin(); shard != fShards->fShards.end(); ++shard){
+    for(std::map<const TObject *, TObject *>::iterator clone = (*shard)->fClones.begin(); clone != (*shard)->fClones.end(); ++clone){
+      TObject *master = const_cast<TObject *>(clone->first);
+      if(TH1 *hist = dynamic_cast<TH1 *>(master)) hist->Add(static_cast<TH1 *>(clone->second));
+      else if(THnBase *hn = dynamic_cast<THnBase *>(master)) hn->Add(static_cast<THnBase *>(clone->second));
+    }
+  }
+  DeleteShards();
+  // shards created afterwards get a new identifier, invalidating the thread-local lookups
+  fShards->fId = ++gShardId;
+}
+
+void THistManager::DeleteShards() {
+  if(!fShards) return;
+  for(std::vector<THistManagerShards::Shard *>::iterator shard = fShards->fShards.begin(); shard != fShards->fShards.end(); ++shard){
+    for(std::map<const TObject *, TObject *>::iterator clone = (*shard)->fClones.begin(); clone != (*shard)->fClones.end(); ++clone)
+      delete clone->second;
+    delete *shard;
+  }
+  fShards->fShards.clear();
+}
+
+Int_t THistManager::GetNShards() const {
+  if(!fShards) return 0;
+  std::lock_guard<std::mutex> lock(fShards->fMutex);
+  return fShards->fShards.size();
+}
+
+Long64_t THistManager::GetShardMemory(Int_t ishard) const {
+  if(!fShards) return 0;
+  std::lock_guard<std::mutex> lock(fShards->fMutex);
+  Long64_t memory(0);
+  for(Int_t i = 0; i < Int_t(fShards->fShards.size()); i++){
+    if(ishard >= 0 && i != ishard) continue;
+    const THistManagerShards::Shard *shard = fShards->fShards[i];
+    for(std::map<const TObject *, TObject *>::const_iterator clone = shard->fClones.begin(); clone != shard->fClones.end(); ++clone)
+      memory += EstimateMemory(clone->second);
+  }
+  return memory;
+}
+
+void THistManager::PrintShardMemory() const {
+  Int_t nshards = GetNShards();
+  std::cout << "Histogram manager " << GetName() << ": " << nshards << " thread shards" << std::endl;
+  for(Int_t i = 0; i < nshards; i++){
+    size_t nobjects(0);
+    {
+      std::lock_guard<std::mutex> lock(fShards->fMutex);
+      if(i < Int_t(fShards->fShards.size())) nobjects = fShards->fShards[i]->fClones.size();
+    }
+    std::cout << "  shard " << i << ": " << nobjects << " histograms, " << GetShardMemory(i)/1024. << " kB" << std::endl;
+  }
+}
+
 THashList* THistManager::CreateHistoGroup(const char *groupname) {
   // At first step check whether the group already exists.
   THashList *foundgroup = FindGroup(groupname);
@@ -354,7 +487,7 @@ THnSparse* THistManager::CreateTHnSparse(const char *name, const char *title, in
   return hsparse;
 }
 
-void THistManager::CreateTProfile(const char* name, const char* title, int nbinsX, double xmin, double xmax, Option_t *opt) {
+TProfile* THistManager::CreateTProfile(const char* name, const char* title, int nbinsX, double xmin, double xmax, Option_t *opt) {
   TString dirname(basename(name)), hname(histname(name));
   THashList *parent(FindGroup(dirname));
   if(!parent) parent = CreateHistoGroup(dirname);
@@ -362,9 +495,10 @@ void THistManager::CreateTProfile(const char* name, const char* title, int nbins
 		Fatal("THistManager::CreateTProfile", "Object %s already exists in group %s", hname.Data(), dirname.Data());
   TProfile *hist = new TProfile(hname, title, nbinsX, xmin, xmax, opt);
   parent->Add(hist);
+  return hist;
 }
 
-void THistManager::CreateTProfile(const char* name, const char* title, int nbinsX, const double* xbins, Option_t *opt) {
+TProfile* THistManager::CreateTProfile(const char* name, const char* title, int nbinsX, const double* xbins, Option_t *opt) {
   TString dirname(basename(name)), hname(histname(name));
   THashList *parent(FindGroup(dirname));
   if(!parent) parent = CreateHistoGroup(dirname);
@@ -372,9 +506,10 @@ void THistManager::CreateTProfile(const char* name, const char* title, int nbins
 		Fatal("THistManager::CreateTHnSparse", "Object %s already exists in group %s", hname.Data(), dirname.Data());
   TProfile *hist = new TProfile(hname, title, nbinsX, xbins, opt);
   parent->Add(hist);
+  return hist;
 }
 
-void THistManager::CreateTProfile(const char* name, const char* title, const TArrayD& xbins, Option_t *opt){
+TProfile* THistManager::CreateTProfile(const char* name, const char* title, const TArrayD& xbins, Option_t *opt){
   TString dirname(basename(name)), hname(histname(name));
   THashList *parent(FindGroup(dirname));
   if(!parent) parent = CreateHistoGroup(dirname);
@@ -382,16 +517,17 @@ void THistManager::CreateTProfile(const char* name, const char* title, const TAr
 		Fatal("THistManager::CreateTHnSparse", "Object %s already exists in group %s", hname.Data(), dirname.Data());
   TProfile *hist = new TProfile(hname.Data(), title, xbins.GetSize()-1, xbins.GetArray(), opt);
   parent->Add(hist);
+  return hist;
 }
 
-void THistManager::CreateTProfile(const char *name, const char *title, const TBinning &xbins, Option_t *opt){
+TProfile* THistManager::CreateTProfile(const char *name, const char *title, const TBinning &xbins, Option_t *opt){
   TArrayD myxbins;
   try{
     xbins.CreateBinEdges(myxbins);
   } catch (std::exception &e){
     Fatal("THistManager::CreateProfile", "Exception raised: %s", e.what());
   }
-  CreateTProfile(name, title, myxbins, opt);
+  return CreateTProfile(name, title, myxbins, opt);
 }
 
 void THistManager::SetObject(TObject * const o, const char *group) {
@@ -409,13 +545,14 @@ void THistManager::SetObject(TObject * const o, const char *group) {
 }
 
 void THistManager::FillTH1(const char *name, double x, double weight, Option_t *opt) {
+	CountNamedFill(name);
 	TString dirname(basename(name)), hname(histname(name));
 	THashList *parent(FindGroup(dirname));
 	if(!parent){
 		Fatal("THistManager::FillTH1", "Parent group %s does not exist", dirname.Data());
 		return;
 	}
-	TH1 *hist = dynamic_cast<TH1 *>(parent->FindObject(hname));
+	TH1 *hist = static_cast<TH1 *>(ShardObject(dynamic_cast<TH1 *>(parent->FindObject(hname))));
 	if(!hist){
 		Fatal("THistManager::FillTH1", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
@@ -432,13 +569,14 @@ void THistManager::FillTH1(const char *name, double x, double weight, Option_t *
 }
 
 void THistManager::FillTH1(const char *name, const char *label, double weight, Option_t *opt) {
+	CountNamedFill(name);
   TString dirname(basename(name)), hname(histname(name));
   THashList *parent(FindGroup(dirname));
   if(!parent){
     Fatal("THistManager::FillTH1", "Parent group %s does not exist", dirname.Data());
     return;
   }
-  TH1 *hist = dynamic_cast<TH1 *>(parent->FindObject(hname));
+  TH1 *hist = static_cast<TH1 *>(ShardObject(dynamic_cast<TH1 *>(parent->FindObject(hname))));
   if(!hist){
     Fatal("THistManager::FillTH1", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
     return;
@@ -456,13 +594,14 @@ void THistManager::FillTH1(const char *name, const char *label, double weight, O
 }
 
 void THistManager::FillTH2(const char *name, double x, double y, double weight, Option_t *opt) {
+	CountNamedFill(name);
 	TString dirname(basename(name)), hname(histname(name));
 	THashList *parent(FindGroup(dirname));
 	if(!parent){
 		Fatal("THistManager::FillTH2", "Parent group %s does not exist", dirname.Data());
 		return;
 	}
-	TH2 *hist = dynamic_cast<TH2 *>(parent->FindObject(hname));
+	TH2 *hist = static_cast<TH2 *>(ShardObject(dynamic_cast<TH2 *>(parent->FindObject(hname))));
 	if(!hist){
 		Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
@@ -481,13 +620,14 @@ void THistManager::FillTH2(const char *name, double x, double y, double weight,
 }
 
 void THistManager::FillTH2(const char *name, double *point, double weight, Option_t *opt) {
+	CountNamedFill(name);
 	TString dirname(basename(name)), hname(histname(name));
 	THashList *parent(FindGroup(dirname));
 	if(!parent){
 		Fatal("THistManager::FillTH2", "Parent group %s does not exist", dirname.Data());
 		return;
 	}
-	TH2 *hist = dynamic_cast<TH2 *>(parent->FindObject(hname));
+	TH2 *hist = static_cast<TH2 *>(ShardObject(dynamic_cast<TH2 *>(parent->FindObject(hname))));
 	if(!hist){
 		Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
@@ -506,13 +646,14 @@ void THistManager::FillTH2(const char *name, double *point, double weight, Optio
 }
 
 void THistManager::FillTH2(const char *name, const char *labelX, const char *labelY, double weight, Option_t *opt) {
+	CountNamedFill(name);
   TString dirname(basename(name)), hname(histname(name));
   THashList *parent(FindGroup(dirname));
   if(!parent){
     Fatal("THistManager::FillTH2", "Parent group %s does not exist", dirname.Data());
     return;
   }
-  TH2 *hist = dynamic_cast<TH2 *>(parent->FindObject(hname));
+  TH2 *hist = static_cast<TH2 *>(ShardObject(dynamic_cast<TH2 *>(parent->FindObject(hname))));
   if(!hist){
     Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
     return;
@@ -531,13 +672,14 @@ void THistManager::FillTH2(const char *name, const char *labelX, const char *lab
 }
 
 void THistManager::FillTH3(const char* name, double x, double y, double z, double weight, Option_t *opt) {
+	CountNamedFill(name);
 	TString dirname(basename(name)), hname(histname(name));
 	THashList *parent(FindGroup(dirname));
 	if(!parent){
 		Fatal("THistManager::FillTH3", "Parent group %s does not exist", dirname.Data());
 		return;
 	}
-	TH3 *hist = dynamic_cast<TH3 *>(parent->FindObject(hname));
+	TH3 *hist = static_cast<TH3 *>(ShardObject(dynamic_cast<TH3 *>(parent->FindObject(hname))));
 	if(!hist){
 		Fatal("THistManager::FillTH3", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
@@ -560,13 +702,14 @@ void THistManager::FillTH3(const char* name, double x, double y, double z, doubl
 }
 
 void THistManager::FillTH3(const char* name, const double* point, double weight, Option_t *opt) {
+	CountNamedFill(name);
 	TString dirname(basename(name)), hname(histname(name));
 	THashList *parent(FindGroup(dirname));
 	if(!parent){
 		Fatal("THistManager::FillTH3", "Parent group %s does not exist", dirname.Data());
 		return;
 	}
-	TH3 *hist = dynamic_cast<TH3 *>(parent->FindObject(hname));
+	TH3 *hist = static_cast<TH3 *>(ShardObject(dynamic_cast<TH3 *>(parent->FindObject(hname))));
 	if(!hist){
 		Fatal("THistManager::FillTH3", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
@@ -589,13 +732,14 @@ void THistManager::FillTH3(const char* name, const double* point, double weight,
 }
 
 void THistManager::FillTHnSparse(const char *name, const double *x, double weight, Option_t *opt) {
+	CountNamedFill(name);
 	TString dirname(basename(name)), hname(histname(name));
 	THashList *parent(FindGroup(dirname));
 	if(!parent){
 		Fatal("THistManager::FillTHnSparse", "Parent group %s does not exist", dirname.Data());
 		return;
 	}
-	THnSparseD *hist = dynamic_cast<THnSparseD *>(parent->FindObject(hname));
+	THnSparseD *hist = static_cast<THnSparseD *>(ShardObject(dynamic_cast<THnSparseD *>(parent->FindObject(hname))));
 	if(!hist){
 		Fatal("THistManager::FillTHnSparse", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
@@ -615,16 +759,132 @@ void THistManager::FillTHnSparse(const char *name, const double *x, double weigh
 }
 
 void THistManager::FillProfile(const char* name, double x, double y, double weight){
+	CountNamedFill(name);
   TString dirname(basename(name)), hname(histname(name));
   THashList *parent(FindGroup(dirname));
   if(!parent)
 		Fatal("THistManager::FillTProfile", "Parent group %s does not exist", dirname.Data());
-  TProfile *hist = dynamic_cast<TProfile *>(parent->FindObject(hname));
+  TProfile *hist = static_cast<TProfile *>(ShardObject(dynamic_cast<TProfile *>(parent->FindObject(hname))));
   if(!hist)
 		Fatal("THistManager::FillTProfile", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
   hist->Fill(x, y, weight);
 }
 
+UInt_t THistManager::DecodeWeightAxes(Option_t *opt, const TClass *cl) {
+  TString optstring(opt);
+  if(!cl || !optstring.Contains("w")) return 0;
+  UInt_t axes(0);
+  if(cl->InheritsFrom(THnSparse::Class())){
+    for(Int_t iaxis = 0; iaxis < 32; iaxis++)
+      if(optstring.Contains(Form("w%d", iaxis))) axes |= 1 << iaxis;
+  } else if(cl->InheritsFrom(TProfile::Class())){
+    // no weighting options for profiles
+  } else if(cl->InheritsFrom(TH2::Class()) || cl->InheritsFrom(TH3::Class())){
+    if(optstring.Contains("wx")) axes |= 1;
+    if(optstring.Contains("wy")) axes |= 2;
+    if(optstring.Contains("wz") && cl->InheritsFrom(TH3::Class())) axes |= 4;
+  } else if(cl->InheritsFrom(TH1::Class())){
+    axes |= 1;
+  }
+  return axes;
+}
+
+namespace {
+  // inverse bin width at x, 1 in the first and last bin as for the name-based fills
+  double InverseBinWidth(const TAxis *axis, double x){
+    Int_t bin = axis->FindBin(x);
+    if(bin != 0 && bin != axis->GetNbins()) return 1./axis->GetBinWidth(bin);
+    return 1.;
+  }
+}
+
+void THistManager::Fill(const THistHandle<TH1> &hist, double x, double weight) const {
+  TH1 *h = static_cast<TH1 *>(ShardObject(hist.Get()));
+  if(!h){
+    Fatal("THistManager::Fill", "Invalid handle");
+    return;
+  }
+  if(hist.GetWeightAxes()){
+    Int_t bin = h->GetXaxis()->FindBin(x);
+    if(bin != 0 && bin != h->GetXaxis()->GetNbins()) weight = 1./h->GetXaxis()->GetBinWidth(bin);
+  }
+  h->Fill(x, weight);
+}
+
+void THistManager::Fill(const THistHandle<TH1> &hist, const char *label, double weight) const {
+  TH1 *h = static_cast<TH1 *>(ShardObject(hist.Get()));
+  if(!h){
+    Fatal("THistManager::Fill", "Invalid handle");
+    return;
+  }
+  h->Fill(label, weight);
+}
+
+void THistManager::Fill(const THistHandle<TH2> &hist, double x, double y, double weight) const {
+  TH2 *h = static_cast<TH2 *>(ShardObject(hist.Get()));
+  if(!h){
+    Fatal("THistManager::Fill", "Invalid handle");
+    return;
+  }
+  UInt_t axes = hist.GetWeightAxes();
+  if(axes){
+    weight = 1.;
+    if(axes & 1) weight *= InverseBinWidth(h->GetXaxis(), x);
+    if(axes & 2) weight *= InverseBinWidth(h->GetYaxis(), y);
+  }
+  h->Fill(x, y, weight);
+}
+
+void THistManager::Fill(const THistHandle<TH3> &hist, double x, double y, double z, double weight) const {
+  TH3 *h = static_cast<TH3 *>(ShardObject(hist.Get()));
+  if(!h){
+    Fatal("THistManager::Fill", "Invalid handle");
+    return;
+  }
+  UInt_t axes = hist.GetWeightAxes();
+  if(axes){
+    weight = 1.;
+    if(axes & 1) weight *= InverseBinWidth(h->GetXaxis(), x);
+    if(axes & 2) weight *= InverseBinWidth(h->GetYaxis(), y);
+    if(axes & 4) weight *= InverseBinWidth(h->GetZaxis(), z);
+  }
+  h->Fill(x, y, z, weight);
+}
+
+void THistManager::Fill(const THistHandle<THnSparse> &hist, const double *x, double weight) const {
+  THnSparse *h = static_cast<THnSparse *>(ShardObject(hist.Get()));
+  if(!h){
+    Fatal("THistManager::Fill", "Invalid handle");
+    return;
+  }
+  UInt_t axes = hist.GetWeightAxes();
+  if(axes){
+    weight = 1.;
+    for(Int_t iaxis = 0; iaxis < std::min(h->GetNdimensions(), 32); iaxis++)
+      if(axes & (1 << iaxis)) weight *= InverseBinWidth(h->GetAxis(iaxis), x[iaxis]);
+  }
+  h->Fill(x, weight);
+}
+
+void THistManager::Fill(const THistHandle<TProfile> &hist, double x, double y, double weight) const {
+  TProfile *h = static_cast<TProfile *>(ShardObject(hist.Get()));
+  if(!h){
+    Fatal("THistManager::Fill", "Invalid handle");
+    return;
+  }
+  h->Fill(x, y, weight);
+}
+
+void THistManager::PrintNamedFillCounts(Int_t nmax) const {
+  std::vector<std::pair<ULong64_t, std::string> > counts;
+  for(std::map<std::string, ULong64_t>::const_iterator it = fNamedFillCounts.begin(); it != fNamedFillCounts.end(); ++it)
+    counts.push_back(std::make_pair(it->second, it->first));
+  std::sort(counts.rbegin(), counts.rend());
+  std::cout << "Name-based fills in histogram manager " << GetName() << ":" << std::endl;
+  for(size_t i = 0; i < counts.size() && (nmax < 0 || i < size_t(nmax)); i++)
+    std::cout << "  " << counts[i].second << ": " << counts[i].first << std::endl;
+}
+
 TObject *THistManager::FindObject(const char *name) const {
 	TString dirname(basename(name)), hname(histname(name));
 	THashList *parent(FindGroup(dirname));
@@ -1030,6 +1290,108 @@ namespace TestTHistManager {
     return success ? 0 : 1;
   }
 
+  int THistManagerTestSuite::TestFillHandleHistograms(){
+    THistManager testmgr("testmgr");
+
+    THistHandle<TH1> test1 = testmgr.CreateTH1("Group1/Test1", "Test Histogram 1D", 1, 0., 1.);
+    THistHandle<TH2> test2 = testmgr.CreateTH2("Group1/Test2", "Test Histogram 2D", 1, 0., 1., 1, 0., 1.);
+    THistHandle<TH3> test3 = testmgr.CreateTH3("Test3", "Test Histogram 3D", 1, 0., 1., 1, 0., 1., 1, 0., 1.);
+    int nbins[4] = {1,1,1,1}; double min[4] = {0.,0.,0.,0.}, max[4] = {1.,1.,1.,1.};
+    THistHandle<THnSparse> testN = testmgr.CreateTHnSparse("TestN", "Test Histogram NSparse", 4, nbins, min, max);
+    THistHandle<TProfile> testProfile = testmgr.CreateTProfile("Group2/Subgroup1/TestProfile", "Test TProfile", 1, 0., 1.);
+    testmgr.SetCountNamedFills();
+
+    double point[4] = {0.5, 0.5, 0.5, 0.5};
+    for(int i = 0; i < 100; i++){
+      testmgr.Fill(test1, 0.5);
+      testmgr.Fill(test2, 0.5, 0.5);
+      testmgr.Fill(test3, 0.5, 0.5, 0.5);
+      testmgr.Fill(testN, point);
+      testmgr.Fill(testProfile, 0.5, 1.);
+      testmgr.FillTH1("Group1/Test1", 0.5);
+    }
+
+    // Evaluate test
+    bool success(true);
+    if(!testmgr.GetHandle<TH2>("Group1/Test2").IsValid() || testmgr.GetHandle<TH2>("Group1/Test1").IsValid()){
+      std::cout << "GetHandle: Lookup of Group1/Test2 failed or type mismatch of Group1/Test1 not detected" << std::endl;
+      success = false;
+    }
+    if(TMath::Abs(test1->GetBinContent(1) - 200) > DBL_EPSILON){
+      std::cout << "Group1/Test1: Mismatch in values, expected 200, found " << test1->GetBinContent(1) << std::endl;
+      success = false;
+    }
+    if(TMath::Abs(test2->GetBinContent(1, 1) - 100) > DBL_EPSILON){
+      std::cout << "Group1/Test2: Mismatch in values, expected 100, found " << test2->GetBinContent(1, 1) << std::endl;
+      success = false;
+    }
+    if(TMath::Abs(test3->GetBinContent(1, 1, 1) - 100) > DBL_EPSILON){
+      std::cout << "Test3: Mismatch in values, expected 100, found " << test3->GetBinContent(1, 1, 1) << std::endl;
+      success = false;
+    }
+    int index[4] = {1,1,1,1};
+    if(TMath::Abs(testN->GetBinContent(index) - 100) > DBL_EPSILON){
+      std::cout << "TestN: Mismatch in values, expected 100, found " << testN->GetBinContent(index) << std::endl;
+      success = false;
+    }
+    if(TMath::Abs(testProfile->GetBinContent(1) - 1) > DBL_EPSILON){
+      std::cout << "Group2/Subgroup1/TestProfile: Mismatch in values, expected 1, found " << testProfile->GetBinContent(1) << std::endl;
+      success = false;
+    }
+    const std::map<std::string, ULong64_t> &counts = testmgr.GetNamedFillCounts();
+    if(counts.size() != 1 || counts.begin()->first != "Group1/Test1" || counts.begin()->second != 100){
+      std::cout << "Named fill counts: expected 100 fills of Group1/Test1 only" << std::endl;
+      success = false;
+    }
+    return success ? 0 : 1;
+  }
+
+  int THistManagerTestSuite::TestFillThreadShards(){
+    THistManager testmgr("testmgr");
+
+    THistHandle<TH1> test1 = testmgr.CreateTH1("Test1", "Test Histogram 1D", 1, 0., 1.);
+    testmgr.CreateTH2("Group1/Test2", "Test Histogram 2D", 1, 0., 1., 1, 0., 1.);
+    testmgr.SetThreadSharding();
+
+    const int kNThreads = 4;
+    std::vector<std::thread> workers;
+    for(int ithread = 0; ithread < kNThreads; ithread++){
+      workers.push_back(std::thread([&testmgr, &test1](){
+        for(int i = 0; i < 100; i++){
+          testmgr.Fill(test1, 0.5);
+          testmgr.FillTH2("Group1/Test2", 0.5, 0.5);
+        }
+      }));
+    }
+    for(auto &worker : workers) worker.join();
+
+    // Evaluate test
+    bool success(true);
+    if(testmgr.GetNShards() != kNThreads){
+      std::cout << "Shards: expected " << kNThreads << ", found " << testmgr.GetNShards() << std::endl;
+      success = false;
+    }
+    if(test1->GetEntries() > 0){
+      std::cout << "Test1: Filled before merging the shards" << std::endl;
+      success = false;
+    }
+    testmgr.MergeShards();
+    if(testmgr.GetNShards()){
+      std::cout << "Shards: not deleted after merging" << std::endl;
+      success = false;
+    }
+    if(TMath::Abs(test1->GetBinContent(1) - 100 * kNThreads) > DBL_EPSILON){
+      std::cout << "Test1: Mismatch in values, expected " << 100 * kNThreads << ", found " << test1->GetBinContent(1) << std::endl;
+      success = false;
+    }
+    TH2 *test2 = dynamic_cast<TH2 *>(testmgr.FindObject("Group1/Test2"));
+    if(!test2 || TMath::Abs(test2->GetBinContent(1, 1) - 100 * kNThreads) > DBL_EPSILON){
+      std::cout << "Group1/Test2: Not found or mismatch in values, expected " << 100 * kNThreads << std::endl;
+      success = false;
+    }
+    return success ? 0 : 1;
+  }
+
   int TestRunAll(){
     int testresult(0);
     THistManagerTestSuite testsuite;
@@ -1050,6 +1412,14 @@ namespace TestTHistManager {
     testresult += testsuite.TestFillGroupedHistograms();
     std::cout << "Result after test: " << testresult << std::endl;
 
+    std::cout << "Running test: Fill Handle" << std::endl;
+    testresult += testsuite.TestFillHandleHistograms();
+    std::cout << "Result after test: " << testresult << std::endl;
+
+    std::cout << "Running test: Fill Thread Shards" << std::endl;
+    testresult += testsuite.TestFillThreadShards();
+    std::cout << "Result after test: " << testresult << std::endl;
+
     return testresult;
   }
 
@@ -1072,4 +1442,14 @@ namespace TestTHistManager {
     THistManagerTestSuite testsuite;
     return testsuite.TestFillGroupedHistograms();
   }
+
+  int TestRunFillHandle(){
+    THistManagerTestSuite testsuite;
+    return testsuite.TestFillHandleHistograms();
+  }
+
+  int TestRunFillThreadShards(){
+    THistManagerTestSuite testsuite;
+    return testsuite.TestFillThreadShards();
+  }
 }
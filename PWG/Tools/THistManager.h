@@ -7,6 +7,8 @@
 #include <TIterator.h>
 #include <TNamed.h>
 #include <iterator>
+#include <map>
+#include <string>
 
 class TArrayD;
 class TAxis;
@@ -17,12 +19,45 @@ class TH2;
 class TH3;
 class THnSparse;
 class TProfile;
+class TClass;
+struct THistManagerShards;
 
 /**
  * @defgroup Histmanager Histogram manager
  * @brief Histogram manager and components needed to make it work.
  */
 
+/**
+ * @class THistHandle
+ * @brief Typed reference to a histogram inside the THistManager
+ * @ingroup Histmanager
+ *
+ * A handle is built from the pointer returned by the Create methods
+ * or obtained via THistManager::GetHandle. The Fill methods of the
+ * THistManager taking a handle go directly to the histogram, without
+ * looking up the histogram by name. Bin width weighting options are
+ * decoded once when the handle is obtained via GetHandle.
+ */
+template<class H>
+class THistHandle {
+public:
+  THistHandle(): fHist(nullptr), fWeightAxes(0) { }
+  THistHandle(H *hist, UInt_t weightaxes = 0): fHist(hist), fWeightAxes(weightaxes) { }
+
+  H *Get() const { return fHist; }
+  H *operator->() const { return fHist; }
+  Bool_t IsValid() const { return fHist != nullptr; }
+
+  /**
+   * @brief Axes using the inverse bin width as weight (bit i for axis i)
+   */
+  UInt_t GetWeightAxes() const { return fWeightAxes; }
+
+private:
+  H           *fHist;         ///< Histogram inside the THistManager
+  UInt_t      fWeightAxes;    ///< Axes using the inverse bin width as weight
+};
+
 /**
  * @class THistManager
  * @brief Container class for histograms
@@ -480,8 +515,9 @@ public:
 	 * @param[in] xmin min. value in x-direction
 	 * @param[in] xmax max. value in x-direction
 	 * @param[in] opt Further options
+	 * @return The newly created profile
 	 */
-  void CreateTProfile(const char *name, const char *title, int nbinsX, double xmin, double xmax, Option_t *opt = "");
+  TProfile* CreateTProfile(const char *name, const char *title, int nbinsX, double xmin, double xmax, Option_t *opt = "");
 
   /**
    * @brief Create a new TProfile within the container.
@@ -493,8 +529,9 @@ public:
    * @param[in] nbinsX Number of bins in x-direction
    * @param[in] xbins binning in x-direction
    * @param[in] opt Further options
+   * @return The newly created profile
    */
-  void CreateTProfile(const char *name, const char *title, int nbinsX, const double *xbins, Option_t *opt = "");
+  TProfile* CreateTProfile(const char *name, const char *title, int nbinsX, const double *xbins, Option_t *opt = "");
 
   /**
    * @brief Create a new TProfile within the container.
@@ -505,8 +542,9 @@ public:
    * @param[in] title Title of the profile histogram
    * @param[in] xbins binning in x-direction
    * @param[in] opt Further options
+   * @return The newly created profile
    */
-  void CreateTProfile(const char *name, const char *title, const TArrayD &xbins, Option_t *opt = "");
+  TProfile* CreateTProfile(const char *name, const char *title, const TArrayD &xbins, Option_t *opt = "");
 
   /**
    * @brief Create a new TProfile within the container.
@@ -517,8 +555,9 @@ public:
    * @param[in] title Title of the profile histogram
    * @param[in] xbins User binning
    * @param[in] opt Further options
+   * @return The newly created profile
    */
-  void CreateTProfile(const char *name, const char *title, const TBinning &xbins, Option_t *opt = "");
+  TProfile* CreateTProfile(const char *name, const char *title, const TBinning &xbins, Option_t *opt = "");
 
   /**
    * @brief Set a new group into the container into the parent group
@@ -634,6 +673,134 @@ public:
 	 */
   void FillProfile(const char *name, double x, double y, double weight = 1.);
 
+  /**
+   * @brief Get handle for fast filling of a histogram within the container.
+   *
+   * The histogram is looked up once by name (using the common group notation).
+   * The bin width weighting options of the name-based Fill methods are decoded
+   * once and stored in the handle: "w" for TH1, "wx", "wy", "wz" for TH2 and TH3,
+   * "w<iaxis>" for THnSparse. The handle is not valid if no histogram of the
+   * requested type exists.
+   * @param[in] name Name of the histogram
+   * @param[in] opt Optional filling arguments
+   * @return Handle to the histogram
+   */
+  template<class H>
+  THistHandle<H> GetHandle(const char *name, Option_t *opt = "") const {
+    return THistHandle<H>(dynamic_cast<H *>(FindObject(name)), DecodeWeightAxes(opt, H::Class()));
+  }
+
+  /**
+   * @brief Fill a 1D histogram via its handle
+   * @param[in] hist Handle of the histogram
+   * @param[in] x x-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void Fill(const THistHandle<TH1> &hist, double x, double weight = 1.) const;
+
+  /**
+   * @brief Fill a 1D histogram with a label via its handle
+   * @param[in] hist Handle of the histogram
+   * @param[in] label the bin label
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void Fill(const THistHandle<TH1> &hist, const char *label, double weight = 1.) const;
+
+  /**
+   * @brief Fill a 2D histogram via its handle
+   * @param[in] hist Handle of the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void Fill(const THistHandle<TH2> &hist, double x, double y, double weight = 1.) const;
+
+  /**
+   * @brief Fill a 3D histogram via its handle
+   * @param[in] hist Handle of the histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] z z-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void Fill(const THistHandle<TH3> &hist, double x, double y, double z, double weight = 1.) const;
+
+  /**
+   * @brief Fill a n-dimensional histogram via its handle
+   * @param[in] hist Handle of the histogram
+   * @param[in] x coordinates of the data
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void Fill(const THistHandle<THnSparse> &hist, const double *x, double weight = 1.) const;
+
+  /**
+   * @brief Fill a profile histogram via its handle
+   * @param[in] hist Handle of the profile histogram
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void Fill(const THistHandle<TProfile> &hist, double x, double y, double weight = 1.) const;
+
+  /**
+   * @brief Count the name-based fills per histogram.
+   *
+   * Debug mode to find the histograms filled most often by name,
+   * which profit most from migrating to handles.
+   * @param[in] doCount If true the fills are counted
+   */
+  void SetCountNamedFills(Bool_t doCount = kTRUE) { fCountNamedFills = doCount; }
+
+  /**
+   * @brief Print the number of name-based fills per histogram, most frequent first.
+   * @param[in] nmax Max. number of histograms printed (all if negative)
+   */
+  void PrintNamedFillCounts(Int_t nmax = -1) const;
+
+  /**
+   * @brief Get the number of name-based fills per histogram.
+   * @return Map of the histogram names to the number of name-based fills
+   */
+  const std::map<std::string, ULong64_t> &GetNamedFillCounts() const { return fNamedFillCounts; }
+
+  /**
+   * @brief Fill per-thread copies of the histograms.
+   *
+   * With the sharding enabled the Fill methods can be called from several
+   * threads without locks: each thread fills its own copy (shard) of the
+   * histogram, created on the first fill of the histogram from the thread.
+   * The shards are added to the histograms in the container with
+   * MergeShards(), to be called when no thread is filling anymore, i.e.
+   * in the FinishTaskOutput of the task. Histograms must not be created
+   * while other threads are filling, and the counting of name-based fills
+   * must not be enabled.
+   * @param[in] doShard If true fills go to the shards, if false the shards are merged
+   */
+  void SetThreadSharding(Bool_t doShard = kTRUE);
+
+  /**
+   * @brief Add the content of the thread shards to the histograms in the container and delete the shards.
+   */
+  void MergeShards();
+
+  /**
+   * @brief Get the number of threads with shards
+   * @return Number of shards
+   */
+  Int_t GetNShards() const;
+
+  /**
+   * @brief Estimate the memory of the histograms in a shard.
+   * @param[in] ishard Index of the shard (all shards if negative)
+   * @return Estimated memory in bytes
+   */
+  Long64_t GetShardMemory(Int_t ishard = -1) const;
+
+  /**
+   * @brief Print the number of histograms and the estimated memory of each shard.
+   */
+  void PrintShardMemory() const;
+
   /**
    * @brief Create forward iterator starting at the beginning of the
    * container
@@ -719,11 +886,49 @@ private:
 	 */
 	TString histname(const TString &path) const;
 
+	/**
+	 * @brief Decode the bin width weighting options of a histogram type.
+	 * @param[in] opt Filling options
+	 * @param[in] cl Class of the histogram
+	 * @return Axes using the inverse bin width as weight (bit i for axis i)
+	 */
+	static UInt_t DecodeWeightAxes(Option_t *opt, const TClass *cl);
+
+	/**
+	 * @brief Count a name-based fill in the debug mode
+	 * @param[in] name Name of the histogram
+	 */
+	void CountNamedFill(const char *name) { if(fCountNamedFills) fNamedFillCounts[name]++; }
+
+	/**
+	 * @brief Object to fill: the master object, or its copy for the current thread
+	 * if the sharding is enabled
+	 * @param[in] master Histogram in the container
+	 * @return Object to fill
+	 */
+	TObject *ShardObject(TObject *master) const { return (fThreadSharding && master) ? GetShardObject(master) : master; }
+
+	/**
+	 * @brief Get the copy of a histogram for the current thread, created on first request
+	 * @param[in] master Histogram in the container
+	 * @return Copy of the histogram for the current thread
+	 */
+	TObject *GetShardObject(TObject *master) const;
+
+	/**
+	 * @brief Delete the thread shards without merging
+	 */
+	void DeleteShards();
+
 	THashList *fHistos;                   ///< List of histograms
 	bool fIsOwner;                        ///< Set the ownership
+	bool fCountNamedFills;                //!<! Count the name-based fills per histogram
+	std::map<std::string, ULong64_t> fNamedFillCounts;  //!<! Number of name-based fills per histogram
+	bool fThreadSharding;                 //!<! Fill per-thread copies of the histograms
+	THistManagerShards *fShards;          //!<! Per-thread copies of the histograms
 
   /// \cond CLASSIMP
-	ClassDef(THistManager, 1);  // Container for histograms
+	ClassDef(THistManager, 3);  // Container for histograms
   /// \endcond
 };
 
@@ -845,6 +1050,37 @@ public:
    * @return 0 if test is passed, 1 if it failed
    */
   int TestFillGroupedHistograms();
+
+  /**
+   * Purpose of the test: Check whether histograms are filled correctly via handles
+   * Relies on: TestBuildSimpleHistograms, TestBuildGroupedHistograms
+   *
+   * Creating histograms of all types, partly in groups, keeping the handles
+   * returned by the create functions, and filling each 100 times via the handle.
+   * The 1D histogram is in addition filled 100 times by name with the count of
+   * name-based fills enabled.
+   *
+   * Test passed:
+   * - All histograms have the expected value (200 for the 1D histogram, 100 for the others, 1 for profile)
+   * - GetHandle finds the histogram of the matching type only
+   * - Only the 100 name-based fills are counted
+   * @return 0 if test is passed, 1 if it failed
+   */
+  int TestFillHandleHistograms();
+
+  /**
+   * Purpose of the test: Check whether histograms filled from several threads are merged correctly
+   * Relies on: TestFillHandleHistograms
+   *
+   * Fill a TH1 via its handle and a TH2 in a group by name, each 100 times
+   * from 4 threads with the thread sharding enabled.
+   *
+   * Test passed:
+   * - One shard per thread is created, the histograms in the container are not filled before the merge
+   * - After the merge the shards are deleted and the histograms contain 400 entries in bin 1
+   * @return 0 if test is passed, 1 if it failed
+   */
+  int TestFillThreadShards();
 };
 
 /**
@@ -882,5 +1118,19 @@ int TestRunFillSimple();
  */
 int TestRunFillGrouped();
 
+/**
+ * Run the test for filling histograms via handles. See @ref THistManagerTestSuite
+ * for details.
+ * @return 0 if test is passed, 1 if failed
+ */
+int TestRunFillHandle();
+
+/**
+ * Run the test for filling histograms from several threads. See @ref THistManagerTestSuite
+ * for details.
+ * @return 0 if test is passed, 1 if failed
+ */
+int TestRunFillThreadShards();
+
 }
 #endif
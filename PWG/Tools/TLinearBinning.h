@@ -114,6 +114,28 @@ public:
    */
   virtual void CreateBinEdges(TArrayD &binedges) const;
 
+  /**
+   * Get the number of bins
+   * @return Number of bins
+   */
+  virtual Int_t GetNbins() const { return fNbins; }
+
+  /**
+   * Find the bin of a value, see FindFixBin
+   * @param[in] x Value
+   * @return Bin number (0 for underflow, nbins+1 for overflow)
+   */
+  virtual Int_t FindBin(Double_t x) const { return FindFixBin(x); }
+
+  /**
+   * Find the bin of a value in closed form, same as TAxis::FindFixBin for
+   * an axis with fixed bins. Non-virtual, to be inlined in loops.
+   * @param[in] x Value
+   * @return Bin number (0 for underflow, nbins+1 for overflow)
+   * @throw LimitsNotSetException in case the limits are not set
+   */
+  inline Int_t FindFixBin(Double_t x) const;
+
 private:
   Int_t                                 fNbins;     ///< Number of bins
   Double_t                              fMinimum;   ///< Minimum of the binning
@@ -130,4 +152,11 @@ void TLinearBinning::Set(Int_t nbins, Double_t min, Double_t max){
   fLimitsSet = true;
 }
 
+Int_t TLinearBinning::FindFixBin(Double_t x) const {
+  if(!fLimitsSet) throw LimitsNotSetException();
+  if(x < fMinimum) return 0;
+  if(!(x < fMaximum)) return fNbins + 1;
+  return 1 + Int_t(fNbins * (x - fMinimum) / (fMaximum - fMinimum));
+}
+
 #endif /* TLINEARBINNING_H */
@@ -37,6 +37,13 @@ TVariableBinning::TVariableBinning(const TArrayD &binedges):
 
 }
 
+TVariableBinning::TVariableBinning(const TBinning &binning):
+  TBinning(),
+  fBinEdges()
+{
+  binning.CreateBinEdges(fBinEdges);
+}
+
 void TVariableBinning::CreateBinEdges(TArrayD &binedges) const {
   if(!fBinEdges.GetSize()){
     throw LimitsNotSetException();
@@ -107,6 +107,13 @@ public:
    */
   TVariableBinning(const TArrayD &binedges);
 
+  /**
+   * Constructor, taking the bin edges from another binning,
+   * e.g. to get a fast bin lookup for a TCustomBinning
+   * @param[in] binning Binning providing the bin edges
+   */
+  TVariableBinning(const TBinning &binning);
+
   /**
    * Destructor
    */
@@ -138,6 +145,32 @@ public:
    */
   virtual void CreateBinEdges(TArrayD &binedges) const;
 
+  /**
+   * Get the number of bins
+   * @return Number of bins
+   */
+  virtual Int_t GetNbins() const { return fBinEdges.GetSize() ? fBinEdges.GetSize() - 1 : 0; }
+
+  /**
+   * Find the bin of a value, see FindFixBin
+   * @param[in] x Value
+   * @return Bin number (0 for underflow, nbins+1 for overflow)
+   */
+  virtual Int_t FindBin(Double_t x) const { return FindFixBin(x); }
+
+  /**
+   * Find the bin of a value via a binary search in the bin edges, same as
+   * TAxis::FindFixBin for an axis with variable bins. Non-virtual, to be
+   * inlined in loops.
+   * @param[in] x Value
+   * @return Bin number (0 for underflow, nbins+1 for overflow)
+   * @throw LimitsNotSetException in case the bin edges are not set
+   */
+  Int_t FindFixBin(Double_t x) const {
+    if(!fBinEdges.GetSize()) throw LimitsNotSetException();
+    return FindBinInEdges(fBinEdges.GetArray(), fBinEdges.GetSize(), x);
+  }
+
 private:
   TArrayD                         fBinEdges;
 
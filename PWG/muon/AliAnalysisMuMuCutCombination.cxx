@@ -28,7 +28,8 @@ AliAnalysisMuMuCutCombination::AliAnalysisMuMuCutCombination()
 : TObject(), fCuts(0x0), fName(""),
 fIsEventCutter(kFALSE), fIsEventHandlerCutter(kFALSE),
 fIsTrackCutter(kFALSE), fIsTrackPairCutter(kFALSE),
-fIsTriggerClassCutter(kFALSE)
+fIsTriggerClassCutter(kFALSE),
+fHasMasks(kFALSE), fEventMask(0), fTrackMask(0), fTrackPairMask(0)
 {
   /// Default ctor.
 }
@@ -63,6 +64,7 @@ void AliAnalysisMuMuCutCombination::Add(AliAnalysisMuMuCutElement* ce)
   if (!fCuts->FindObject(ce))
   {
     fCuts->Add(ce);
+    fHasMasks = kFALSE;
     fName += ce->GetName();
 
     fIsEventCutter = fIsEventCutter || ce->IsEventCutter();
@@ -276,6 +278,39 @@ Bool_t AliAnalysisMuMuCutCombination::Pass(const AliVParticle& p1, const AliVPar
   return kTRUE;
 }
 
+//_____________________________________________________________________________
+Bool_t AliAnalysisMuMuCutCombination::Pass(const AliVEventHandler& eventHandler, ULong64_t eventMask) const
+{
+  /// Whether or not the event handler is passing the cut, eventMask being the cut elements it passes
+
+  if (!fHasMasks) return Pass(eventHandler);
+
+  if ( !IsEventCutter() && !IsEventHandlerCutter() ) return kFALSE;
+
+  return ( ( eventMask & fEventMask ) == fEventMask );
+}
+
+//_____________________________________________________________________________
+Bool_t AliAnalysisMuMuCutCombination::Pass(const AliVParticle& particle, ULong64_t trackMask) const
+{
+  /// Whether or not the particle is passing the cut, trackMask being the cut elements it passes
+
+  if (!fHasMasks) return Pass(particle);
+
+  return ( ( trackMask & fTrackMask ) == fTrackMask );
+}
+
+//_____________________________________________________________________________
+Bool_t AliAnalysisMuMuCutCombination::Pass(const AliVParticle& p1, const AliVParticle& p2,
+                                           ULong64_t trackPairMask) const
+{
+  /// Whether or not the particle pair is passing the cut, trackPairMask being the cut elements it passes
+
+  if (!fHasMasks) return Pass(p1,p2);
+
+  return ( ( trackPairMask & fTrackPairMask ) == fTrackPairMask );
+}
+
 //_____________________________________________________________________________
 Bool_t AliAnalysisMuMuCutCombination::Pass(const TString& firedTriggerClasses,
                                            TString& acceptedTriggerClasses,
@@ -315,6 +350,19 @@ Bool_t AliAnalysisMuMuCutCombination::Pass(const TString& firedTriggerClasses,
   return rv;
 }
 
+//_____________________________________________________________________________
+void AliAnalysisMuMuCutCombination::SetMasks(Bool_t hasMasks, ULong64_t eventMask,
+                                             ULong64_t trackMask, ULong64_t trackPairMask)
+{
+  /// Set the bits (given by the registry) of the cut elements of this combination.
+  /// hasMasks is false if some of the elements do not have a bit.
+
+  fHasMasks = hasMasks && fCuts;
+  fEventMask = eventMask;
+  fTrackMask = trackMask;
+  fTrackPairMask = trackPairMask;
+}
+
 //_____________________________________________________________________________
 void AliAnalysisMuMuCutCombination::Print(Option_t* opt) const
 {
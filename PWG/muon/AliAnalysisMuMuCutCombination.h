@@ -35,6 +35,18 @@ public:
   Bool_t Pass(const TString& firedTriggerClasses, TString& acceptedTriggerClasses,
               UInt_t L0, UInt_t L1, UInt_t L2) const;
 
+  /// Same as above, but using the bit masks of the cut elements the object passes
+  /// (see AliAnalysisMuMuCutRegistry::GetEventMask, GetTrackMask and GetTrackPairMask)
+  Bool_t Pass(const AliVEventHandler& eventHandler, ULong64_t eventMask) const;
+
+  Bool_t Pass(const AliVParticle& particle, ULong64_t trackMask) const;
+
+  Bool_t Pass(const AliVParticle& p1, const AliVParticle& p2, ULong64_t trackPairMask) const;
+
+  void SetMasks(Bool_t hasMasks, ULong64_t eventMask, ULong64_t trackMask, ULong64_t trackPairMask);
+
+  const TObjArray* GetCutElements() const { return fCuts; }
+
   const char* GetName() const { return fName.Data(); }
 
   Bool_t IsEventCutter() const { return fIsEventCutter; }
@@ -64,7 +76,12 @@ private:
   Bool_t fIsTrackPairCutter; // whether or not the combination cuts on track pairs
   Bool_t fIsTriggerClassCutter; // whether or not the combination cuts on trigger class
 
-  ClassDef(AliAnalysisMuMuCutCombination,1) // combination of 1 or more individual cuts
+  Bool_t fHasMasks; //! whether the masks below can be used
+  ULong64_t fEventMask; //! bits of the event cut elements
+  ULong64_t fTrackMask; //! bits of the track cut elements
+  ULong64_t fTrackPairMask; //! bits of the track pair cut elements
+
+  ClassDef(AliAnalysisMuMuCutCombination,2) // combination of 1 or more individual cuts
 };
 
 #endif
@@ -17,6 +17,9 @@
 
 #include <TObjString.h>
 #include "TMethodCall.h"
+#include "TFunction.h"
+#include "TInterpreter.h"
+#include "RVersion.h"
 #include "AliLog.h"
 #include "Riostream.h"
 #include "AliVParticle.h"
@@ -29,7 +32,8 @@ AliAnalysisMuMuCutElement::AliAnalysisMuMuCutElement()
 : TObject(), fName(""), fIsEventCutter(kFALSE), fIsEventHandlerCutter(kFALSE),
 fIsTrackCutter(kFALSE), fIsTrackPairCutter(kFALSE), fIsTriggerClassCutter(kFALSE),
 fCutObject(0x0), fCutMethodName(""), fCutMethodPrototype(""),
-fDefaultParameters(""), fNofParams(0), fCutMethod(0x0), fCallParams(), fDoubleParams()
+fDefaultParameters(""), fNofParams(0), fCutMethod(0x0), fCallParams(), fDoubleParams(),
+fCutFunction(0x0), fCallArgs(), fIntParams()
 {
   /// Default ctor, leading to an invalid cut object
 }
@@ -44,7 +48,8 @@ AliAnalysisMuMuCutElement::AliAnalysisMuMuCutElement(ECutType expectedType,
 fIsTrackCutter(kFALSE), fIsTrackPairCutter(kFALSE), fIsTriggerClassCutter(kFALSE),
 fCutObject(&cutObject), fCutMethodName(cutMethodName),
 fCutMethodPrototype(cutMethodPrototype),fDefaultParameters(defaultParameters),
-fNofParams(0), fCutMethod(0x0), fCallParams(), fDoubleParams()
+fNofParams(0), fCutMethod(0x0), fCallParams(), fDoubleParams(),
+fCutFunction(0x0), fCallArgs(), fIntParams()
 {
   /**
    * Construct a cut, which is a proxy to another method of (most probably) another object
@@ -81,6 +86,14 @@ Bool_t AliAnalysisMuMuCutElement::CallCutMethod(Long_t p) const
 
   fCallParams[0] = p;
 
+  if ( fCutFunction )
+  {
+    Bool_t pass(kFALSE);
+    fCallArgs[0] = reinterpret_cast<void*>(p);
+    fCutFunction(fCutObject,fCallArgs.size(),&fCallArgs[0],&pass);
+    return pass;
+  }
+
   fCutMethod->SetParamPtrs(&fCallParams[0],fCallParams.size());
   Long_t result;
   fCutMethod->Execute(fCutObject,result);
@@ -101,6 +114,15 @@ Bool_t AliAnalysisMuMuCutElement::CallCutMethod(Long_t p1, Long_t p2) const
   fCallParams[0] = p1;
   fCallParams[1] = p2;
 
+  if ( fCutFunction )
+  {
+    Bool_t pass(kFALSE);
+    fCallArgs[0] = reinterpret_cast<void*>(p1);
+    fCallArgs[1] = reinterpret_cast<void*>(p2);
+    fCutFunction(fCutObject,fCallArgs.size(),&fCallArgs[0],&pass);
+    return pass;
+  }
+
   fCutMethod->SetParamPtrs(&fCallParams[0],fCallParams.size());
   Long_t result;
   fCutMethod->Execute(fCutObject,result);
@@ -354,6 +376,7 @@ void AliAnalysisMuMuCutElement::Init(ECutType expectedType) const
     TObjArray* paramValues = fDefaultParameters.Tokenize(",");
 
     fDoubleParams.resize(paramValues->GetEntries());
+    fIntParams.resize(paramValues->GetEntries());
 
     Int_t nparams = paramValues->GetEntries();
 
@@ -361,6 +384,7 @@ void AliAnalysisMuMuCutElement::Init(ECutType expectedType) const
     // method
 
     fCallParams.resize(nparams+nMainPar);
+    fCallArgs.assign(nparams+nMainPar,0x0);
 
     if ( nMainPar == 2 )
     {
@@ -381,15 +405,19 @@ void AliAnalysisMuMuCutElement::Init(ECutType expectedType) const
       {
         fDoubleParams[i] = pValue.Atof();
         fCallParams[i+nMainPar] = reinterpret_cast<Long_t>(&fDoubleParams[i]);
+        fCallArgs[i+nMainPar] = &fDoubleParams[i];
       }
       else if ( pType.Contains("Int_t") )
       {
         fCallParams[i+nMainPar] = pValue.Atoi();
+        fIntParams[i] = pValue.Atoi();
+        fCallArgs[i+nMainPar] = &fIntParams[i];
       }
       else
       {
         AliError(Form("Got a parameter of type %s which I don't exactly know how to deal with. Expect something bad to happen...",pType.Data()));
         fCallParams[i+nMainPar] = reinterpret_cast<Long_t>(&pValue);
+        fCallArgs.clear(); // no direct call then
       }
     }
 
@@ -447,6 +475,37 @@ void AliAnalysisMuMuCutElement::Init(ECutType expectedType) const
     delete fCutMethod;
     fCutMethod=0x0;
   }
+
+  InitCutFunction();
+}
+
+//_____________________________________________________________________________
+void AliAnalysisMuMuCutElement::InitCutFunction() const
+{
+  /// Get the compiled wrapper the interpreter uses to call the cut method,
+  /// so that each cut can be called directly instead of going through
+  /// TMethodCall::Execute. The arguments are given to the wrapper
+  /// by address : the references directly, the Int_t and Double_t parameters
+  /// through fIntParams and fDoubleParams.
+
+  fCutFunction = 0x0;
+
+  if ( !fCutMethod ) return;
+
+  if ( !fIsTriggerClassCutter && ( fCallArgs.empty() || (Int_t)fCallArgs.size() > fNofParams ) ) return;
+
+  // the wrapper writes the result as a Bool_t
+  TString returnType(fCutMethod->GetMethod() ? fCutMethod->GetMethod()->GetReturnTypeName() : "");
+  if ( returnType != "Bool_t" && returnType != "bool" ) return;
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,4,0)
+  TInterpreter::CallFuncIFacePtr_t iface = gCling->CallFunc_IFacePtr(fCutMethod->GetCallFunc());
+
+  if ( iface.fKind == TInterpreter::CallFuncIFacePtr_t::kGeneric )
+  {
+    fCutFunction = iface.fGeneric;
+  }
+#endif
 }
 
 //_____________________________________________________________________________
@@ -520,6 +579,14 @@ Bool_t AliAnalysisMuMuCutElement::Pass(const TString& firedTriggerClasses,
 
   acceptedTriggerClasses = "";
 
+  if ( fCutFunction )
+  {
+    Bool_t pass(kFALSE);
+    void* args[] = { const_cast<TString*>(&firedTriggerClasses), &acceptedTriggerClasses, &L0, &L1, &L2 };
+    fCutFunction(fCutObject,fNofParams,args,&pass);
+    return pass;
+  }
+
   Long_t result;
   Long_t params[] = { reinterpret_cast<Long_t>(&firedTriggerClasses),
     reinterpret_cast<Long_t>(&acceptedTriggerClasses),
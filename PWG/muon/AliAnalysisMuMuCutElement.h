@@ -83,6 +83,8 @@ private:
   Bool_t CallCutMethod(Long_t p) const;
   Bool_t CallCutMethod(Long_t p1, Long_t p2) const;
 
+  void InitCutFunction() const;
+
   Int_t CountOccurences(const TString& prototype, const char* search) const;
 
   /// not implemented on purpose
@@ -109,7 +111,14 @@ private:
   mutable std::vector<Long_t> fCallParams; //! vector of parameters for the fCutMethod
   mutable std::vector<Double_t> fDoubleParams; //! temporary vector to hold the references
 
-  ClassDef(AliAnalysisMuMuCutElement,1) // One piece of a cut combination
+  /// compiled wrapper of the cut method, as generated by the interpreter
+  typedef void (*CutFunction)(void* obj, int nargs, void** args, void* ret);
+
+  mutable CutFunction fCutFunction; //! direct call to the cut method (0x0 : use fCutMethod)
+  mutable std::vector<void*> fCallArgs; //! addresses of the arguments for fCutFunction
+  mutable std::vector<Int_t> fIntParams; //! storage of the Int_t parameters for fCallArgs
+
+  ClassDef(AliAnalysisMuMuCutElement,2) // One piece of a cut combination
 };
 
 class AliAnalysisMuMuCutElementBar : public AliAnalysisMuMuCutElement
@@ -137,6 +146,9 @@ public:
 
   void Print(Option_t* opt="") const;
 
+  /// the cut element we're the negation of
+  const AliAnalysisMuMuCutElement* GetCutElement() const { return fCutElement; }
+
 private:
 
   /// not implemented on purpose
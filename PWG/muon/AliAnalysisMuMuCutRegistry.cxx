@@ -23,18 +23,24 @@
  *
  * This class also defines a few default control cut elements aptly named AlwaysTrue.
  *
+ * For the event loop, GetEventMask, GetTrackMask and GetTrackPairMask evaluate each cut
+ * element once per object, and the cut combinations then only have to test
+ * their bits (see the AliAnalysisMuMuCutCombination::Pass methods taking a mask).
+ *
  */
 
 #include <utility>
 #include "AliLog.h"
 #include "TMethodCall.h"
 #include "AliVEvent.h"
+#include "AliVEventHandler.h"
 #include <set>
 #include "AliAnalysisMuMuCutElement.h"
 #include "AliAnalysisMuMuCutCombination.h"
 #include "TObjArray.h"
 #include "Riostream.h"
 #include "TList.h"
+#include "TMath.h"
 
 ClassImp(AliAnalysisMuMuCutRegistry)
 
@@ -42,7 +48,11 @@ ClassImp(AliAnalysisMuMuCutRegistry)
 AliAnalysisMuMuCutRegistry::AliAnalysisMuMuCutRegistry()
 : TObject(),
 fCutElements(0x0),
-fCutCombinations(0x0)
+fCutCombinations(0x0),
+fMasksBuilt(kFALSE),
+fEventBits(),
+fTrackBits(),
+fTrackPairBits()
 {
   /// ctor
 }
@@ -83,6 +93,8 @@ Int_t AliAnalysisMuMuCutRegistry::AddCutCombination(const TObjArray& cutElements
 
   GetCutCombinations(AliAnalysisMuMuCutElement::kAny)->Add(cutCombination);
 
+  fMasksBuilt = kFALSE;
+
   if ( cutCombination->IsEventCutter() || cutCombination->IsEventHandlerCutter() )
   {
     GetCutCombinations(AliAnalysisMuMuCutElement::kEvent)->Add(cutCombination);
@@ -198,6 +210,146 @@ Int_t AliAnalysisMuMuCutRegistry::AddCutCombination(AliAnalysisMuMuCutElement* c
   return AddCutCombination(cutElements);
 }
 
+//_____________________________________________________________________________
+void AliAnalysisMuMuCutRegistry::BuildMasks() const
+{
+  /// Assign one bit to each event, track and track pair cut element used by
+  /// the combinations (the index of the element in the array of its type),
+  /// and give the combinations the masks of their elements.
+  /// Combinations with a cut element beyond the 64th of its type, or an element
+  /// not in the registry, keep evaluating their cuts one by one.
+
+  fMasksBuilt = kTRUE;
+
+  AliAnalysisMuMuCutElement::ECutType cutTypes[] = { AliAnalysisMuMuCutElement::kEvent,
+    AliAnalysisMuMuCutElement::kTrack, AliAnalysisMuMuCutElement::kTrackPair };
+  std::vector<MaskBit>* bits[] = { &fEventBits, &fTrackBits, &fTrackPairBits };
+
+  MaskBit none = { 0x0, -1 };
+
+  for ( Int_t t = 0; t < 3; ++t )
+  {
+    const TObjArray* elements = GetCutElements(cutTypes[t]);
+    bits[t]->assign(elements ? TMath::Min(elements->GetEntriesFast(),64) : 0,none);
+  }
+
+  const TObjArray* combinations = GetCutCombinations(AliAnalysisMuMuCutElement::kAny);
+
+  if (!combinations) return;
+
+  TIter next(combinations);
+  AliAnalysisMuMuCutCombination* cutCombination;
+
+  while ( ( cutCombination = static_cast<AliAnalysisMuMuCutCombination*>(next()) ) )
+  {
+    ULong64_t masks[] = { 0, 0, 0 };
+    Bool_t ok(kTRUE);
+
+    TIter nextCut(cutCombination->GetCutElements());
+    AliAnalysisMuMuCutElement* ce;
+
+    while ( ( ce = static_cast<AliAnalysisMuMuCutElement*>(nextCut()) ) )
+    {
+      // same type as in AddCutElement, trigger class cuts do not have bits
+      Int_t t(-1);
+      if ( ce->IsEventCutter() || ce->IsEventHandlerCutter() ) t = 0;
+      else if ( ce->IsTrackCutter() ) t = 1;
+      else if ( ce->IsTrackPairCutter() ) t = 2;
+      if ( t < 0 ) continue;
+
+      Int_t i = GetCutElements(cutTypes[t]) ? GetCutElements(cutTypes[t])->IndexOf(ce) : -1;
+      if ( i < 0 || i >= (Int_t)bits[t]->size() )
+      {
+        ok = kFALSE;
+        continue;
+      }
+      masks[t] |= ( 1ULL << i );
+      (*bits[t])[i].fCut = static_cast<const AliAnalysisMuMuCutElement*>(GetCutElements(cutTypes[t])->At(i));
+    }
+
+    cutCombination->SetMasks(ok,masks[0],masks[1],masks[2]);
+  }
+
+  // the negation of an element already evaluated is taken from its bit
+
+  for ( Int_t t = 0; t < 3; ++t )
+  {
+    for ( Int_t i = 0; i < (Int_t)bits[t]->size(); ++i )
+    {
+      const AliAnalysisMuMuCutElementBar* bar = dynamic_cast<const AliAnalysisMuMuCutElementBar*>((*bits[t])[i].fCut);
+      if ( !bar ) continue;
+      Int_t j = GetCutElements(cutTypes[t])->IndexOf(bar->GetCutElement());
+      if ( j < 0 || j >= i ) continue;
+      (*bits[t])[i].fNegationOf = j;
+      (*bits[t])[j].fCut = static_cast<const AliAnalysisMuMuCutElement*>(GetCutElements(cutTypes[t])->At(j));
+    }
+  }
+}
+
+//_____________________________________________________________________________
+ULong64_t AliAnalysisMuMuCutRegistry::GetEventMask(const AliVEventHandler& eventHandler) const
+{
+  /// Evaluate each event cut element used by the combinations once
+
+  if (!fMasksBuilt) BuildMasks();
+
+  const AliVEvent* event = eventHandler.GetEvent();
+
+  ULong64_t mask(0);
+
+  for ( size_t i = 0; i < fEventBits.size(); ++i )
+  {
+    const MaskBit& bit = fEventBits[i];
+    if ( !bit.fCut ) continue;
+    Bool_t pass;
+    if ( bit.fNegationOf >= 0 ) pass = !( mask & ( 1ULL << bit.fNegationOf ) );
+    else pass = bit.fCut->IsEventCutter() ? bit.fCut->Pass(*event) : bit.fCut->Pass(eventHandler);
+    if ( pass ) mask |= ( 1ULL << i );
+  }
+
+  return mask;
+}
+
+//_____________________________________________________________________________
+ULong64_t AliAnalysisMuMuCutRegistry::GetTrackMask(const AliVParticle& particle) const
+{
+  /// Evaluate each track cut element used by the combinations once
+
+  if (!fMasksBuilt) BuildMasks();
+
+  ULong64_t mask(0);
+
+  for ( size_t i = 0; i < fTrackBits.size(); ++i )
+  {
+    const MaskBit& bit = fTrackBits[i];
+    if ( !bit.fCut ) continue;
+    Bool_t pass = ( bit.fNegationOf >= 0 ) ? !( mask & ( 1ULL << bit.fNegationOf ) ) : bit.fCut->Pass(particle);
+    if ( pass ) mask |= ( 1ULL << i );
+  }
+
+  return mask;
+}
+
+//_____________________________________________________________________________
+ULong64_t AliAnalysisMuMuCutRegistry::GetTrackPairMask(const AliVParticle& p1, const AliVParticle& p2) const
+{
+  /// Evaluate each track pair cut element used by the combinations once
+
+  if (!fMasksBuilt) BuildMasks();
+
+  ULong64_t mask(0);
+
+  for ( size_t i = 0; i < fTrackPairBits.size(); ++i )
+  {
+    const MaskBit& bit = fTrackPairBits[i];
+    if ( !bit.fCut ) continue;
+    Bool_t pass = ( bit.fNegationOf >= 0 ) ? !( mask & ( 1ULL << bit.fNegationOf ) ) : bit.fCut->Pass(p1,p2);
+    if ( pass ) mask |= ( 1ULL << i );
+  }
+
+  return mask;
+}
+
 //_____________________________________________________________________________
 AliAnalysisMuMuCutElement*
 AliAnalysisMuMuCutRegistry::CreateCutElement(AliAnalysisMuMuCutElement::ECutType type,
@@ -233,6 +385,7 @@ AliAnalysisMuMuCutRegistry::AddCutElement(AliAnalysisMuMuCutElement* ce)
     if (!GetCutElements(AliAnalysisMuMuCutElement::kAny)->FindObject(ce))
     {
       GetCutElements(AliAnalysisMuMuCutElement::kAny)->Add(ce);
+      fMasksBuilt = kFALSE;
       if ( ce->IsEventCutter() || ce->IsEventHandlerCutter() )
       {
         GetCutElements(AliAnalysisMuMuCutElement::kEvent)->Add(ce);
@@ -15,6 +15,7 @@
 #include "TString.h"
 #include "TMethodCall.h"
 #include "AliAnalysisMuMuCutElement.h"
+#include <vector>
 
 class AliVEvent;
 class AliAnalysisMuMuCutElementBar;
@@ -72,6 +73,12 @@ public:
   const TObjArray* GetCutElements(AliAnalysisMuMuCutElement::ECutType type) const;
   TObjArray* GetCutElements(AliAnalysisMuMuCutElement::ECutType type);
 
+  /// Bit masks of the cut elements (used by the cut combinations) an object passes,
+  /// bit i standing for the i-th element of GetCutElements(type)
+  ULong64_t GetEventMask(const AliVEventHandler& eventHandler) const;
+  ULong64_t GetTrackMask(const AliVParticle& particle) const;
+  ULong64_t GetTrackPairMask(const AliVParticle& p1, const AliVParticle& p2) const;
+
   virtual void Print(Option_t* opt="") const;
 
   Bool_t AlwaysTrue(const AliVEvent& /*event*/) const { return kTRUE; }
@@ -93,12 +100,26 @@ private:
                                               const char* cutMethodPrototype,
                                               const char* defaultParameters);
 
+  void BuildMasks() const;
+
+  /// one bit of the cut element masks
+  struct MaskBit
+  {
+    const AliAnalysisMuMuCutElement* fCut; // cut element to evaluate (0x0 if not used by any combination)
+    Int_t fNegationOf; // bit of the cut fCut is the negation of, if already evaluated (-1 otherwise)
+  };
+
 private:
 
   mutable TObjArray* fCutElements; // cut elements
   mutable TObjArray* fCutCombinations; // cut combinations
 
-  ClassDef(AliAnalysisMuMuCutRegistry,1) // storage for cut pointers
+  mutable Bool_t fMasksBuilt; //! whether the bits below and the combination masks are up to date
+  mutable std::vector<MaskBit> fEventBits; //! bits of the event cut elements
+  mutable std::vector<MaskBit> fTrackBits; //! bits of the track cut elements
+  mutable std::vector<MaskBit> fTrackPairBits; //! bits of the track pair cut elements
+
+  ClassDef(AliAnalysisMuMuCutRegistry,2) // storage for cut pointers
 };
 
 #endif
@@ -45,6 +45,7 @@
 #include <algorithm>
 #include <cassert>
 #include <set>
+#include <vector>
 ///
 /// \ class AliAnalysisTaskMuMu
 ///
@@ -389,6 +390,22 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
   // The main part, loop over subanalysis and fill histo
   if ( !IsHistogrammingDisabled() && !fDisableHistoLoop ){
 
+    // Evaluate each track and track pair cut element once, the cut
+    // combinations below only test the bits of their elements
+    std::vector<AliVParticle*> muonTracks;
+    for (Int_t i = 0; i < nTracks; ++i){
+      AliVParticle* tracki = AliAnalysisMuonUtility::GetTrack(i,Event());
+      if ( AliAnalysisMuonUtility::IsMuonTrack(tracki) ) muonTracks.push_back(tracki);
+    }
+    const Int_t nMuonTracks = muonTracks.size();
+
+    std::vector<ULong64_t> trackMasks(nMuonTracks);
+    std::vector<ULong64_t> pairMasks(nMuonTracks*nMuonTracks);
+    for (Int_t i = 0; i < nMuonTracks; ++i){
+      trackMasks[i] = fCutRegistry->GetTrackMask(*muonTracks[i]);
+      for (Int_t j = i+1; j < nMuonTracks; ++j) pairMasks[i*nMuonTracks+j] = fCutRegistry->GetTrackPairMask(*muonTracks[i],*muonTracks[j]);
+    }
+
     while ( ( analysis = static_cast<AliAnalysisMuMuBase*>(nextAnalysis()) ) )
     {
 
@@ -404,12 +421,11 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
       AliCodeTimerAuto(Form("%s (FillHistosForEvent)",analysis->ClassName()),1);
       analysis->FillHistosForEvent(eventSelection,triggerClassName,centrality); // Implemented in AliAnalysisMuMuNch at the moment
 
-      // --- Loop on all event tracks ---
-      for (Int_t i = 0; i < nTracks; ++i){
+      // --- Loop on all event muon tracks ---
+      for (Int_t i = 0; i < nMuonTracks; ++i){
 
         // Get track
-        AliVParticle* tracki = AliAnalysisMuonUtility::GetTrack(i,Event());
-       if (!AliAnalysisMuonUtility::IsMuonTrack(tracki) ) continue;
+        AliVParticle* tracki = muonTracks[i];
 
         nextTrackCut.Reset();
         AliAnalysisMuMuCutCombination* trackCut;
@@ -417,7 +433,7 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
         // Loop on all track selections and fill histos for track that pass it
         while ( ( trackCut = static_cast<AliAnalysisMuMuCutCombination*>(nextTrackCut()) ) )
         {
-          if ( trackCut->Pass(*tracki) )
+          if ( trackCut->Pass(*tracki,trackMasks[i]) )
           {
             AliCodeTimerAuto(Form("%s (FillHistosForTrack)",analysis->ClassName()),2);
             analysis->FillHistosForTrack(eventSelection,triggerClassName,centrality,trackCut->GetName(),*tracki);
@@ -426,12 +442,9 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
 
         // --- loop on muon track pairs (no mix) ---
 
-        for (Int_t j = i+1; j < nTracks; ++j){
+        for (Int_t j = i+1; j < nMuonTracks; ++j){
           // Get track
-          AliVParticle    * trackj = 0x0;
-          trackj = AliAnalysisMuonUtility::GetTrack(j,Event());
-
-          if (!AliAnalysisMuonUtility::IsMuonTrack(trackj) ) continue;
+          AliVParticle    * trackj = muonTracks[j];
 
           nextPairCut.Reset();
           AliAnalysisMuMuCutCombination* pairCut;
@@ -440,9 +453,9 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
           while ( ( pairCut = static_cast<AliAnalysisMuMuCutCombination*>(nextPairCut()) ) )
           {
             // Weither or not the pairs pass the tests
-            Bool_t testi  = (pairCut->IsTrackCutter()) ? pairCut->Pass(*tracki) : kTRUE;
-            Bool_t testj  = (pairCut->IsTrackCutter()) ? pairCut->Pass(*trackj) : kTRUE;
-            Bool_t testij = pairCut->Pass(*tracki,*trackj);
+            Bool_t testi  = (pairCut->IsTrackCutter()) ? pairCut->Pass(*tracki,trackMasks[i]) : kTRUE;
+            Bool_t testj  = (pairCut->IsTrackCutter()) ? pairCut->Pass(*trackj,trackMasks[j]) : kTRUE;
+            Bool_t testij = pairCut->Pass(*tracki,*trackj,pairMasks[i*nMuonTracks+j]);
 
             if ( ( testi && testj ) && testij )
             {
@@ -471,6 +484,8 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
             currentPool = FindPool(cent,Form("%s/%s/%s",eventSelection,triggerClassName,trackCut->GetName()));
             if(!currentPool) continue;
 
+            Bool_t testi  = trackCut->Pass(*tracki,trackMasks[i]);
+
             for (Int_t iTrack2 = 0; iTrack2 < currentPool->GetSize(); ++iTrack2)
             {
               // Get track
@@ -478,7 +493,6 @@ void AliAnalysisTaskMuMu::FillHistos(const char* eventSelection,
               trackj = static_cast<AliVParticle*>(currentPool->At(iTrack2));
 
               // Weither or not the pairs pass the tests
-              Bool_t testi  = trackCut->Pass(*tracki);
               Bool_t testj  = trackCut->Pass(*trackj);
               Bool_t testij = pairCut->Pass(*tracki,*trackj);
 
@@ -513,9 +527,10 @@ void AliAnalysisTaskMuMu::FillPoolsWithTracks(const char* eventSelection,
     if( !AliAnalysisMuonUtility::IsMuonTrack(trackj) ) continue;
 
     // Fill pools
+    const ULong64_t trackMask = fCutRegistryMix->GetTrackMask(*trackj);
     nextTrackCut.Reset();
     while ( ( trackCut = static_cast<AliAnalysisMuMuCutCombination*>(nextTrackCut()) ) ){
-      if(!trackCut->Pass(*trackj)) continue;
+      if(!trackCut->Pass(*trackj,trackMask)) continue;
 
       TString poolName = Form("%s/%s/%s",eventSelection,triggerClassName,trackCut->GetName());
       if( !FindPool( cent,poolName.Data() ) ) CreateCentralityPools(poolName.Data());
@@ -899,9 +914,12 @@ void AliAnalysisTaskMuMu::UserExec(Option_t* /*opt*/)
   TIter nextEventCutCombinationMix(CutRegistryMix()->GetCutCombinations(AliAnalysisMuMuCutElement::kEvent));
   AliAnalysisMuMuCutCombination* cutCombinationMix;
 
+  // each event cut element is evaluated once, the combinations test their bits
+  const ULong64_t eventMask = CutRegistry()->GetEventMask(*fInputHandler);
+
   // loop over cut combination on event level. Fill counters
   while ( ( cutCombination = static_cast<AliAnalysisMuMuCutCombination*>(nextEventCutCombination()))){
-    if ( cutCombination->Pass(*fInputHandler) )
+    if ( cutCombination->Pass(*fInputHandler,eventMask) )
     {
       // Fill counters
       FillCounters(cutCombination->GetName(), "EVERYTHING",  "ALL", fCurrentRunNumber);
@@ -923,12 +941,14 @@ void AliAnalysisTaskMuMu::UserExec(Option_t* /*opt*/)
     nextEventCutCombination.Reset();
 
     while ( ( cutCombination = static_cast<AliAnalysisMuMuCutCombination*>(nextEventCutCombination())) ){
-      if ( cutCombination->Pass(*fInputHandler) ) Fill(cutCombination->GetName(),tname->String().Data());
+      if ( cutCombination->Pass(*fInputHandler,eventMask) ) Fill(cutCombination->GetName(),tname->String().Data());
     }
   }
 
   if(fMix){
 
+    const ULong64_t eventMaskMix = CutRegistryMix()->GetEventMask(*fInputHandler);
+
     GetSelectedTrigClassesInEventMix(Event(),selectedTriggerClasses);
     TIter nextmix(&selectedTriggerClasses);
     nextmix.Reset();
@@ -937,7 +957,7 @@ void AliAnalysisTaskMuMu::UserExec(Option_t* /*opt*/)
       nextEventCutCombinationMix.Reset();
 
       while ( ( cutCombinationMix = static_cast<AliAnalysisMuMuCutCombination*>(nextEventCutCombinationMix())) ){
-        if ( cutCombinationMix->Pass(*fInputHandler) ) FillPools(cutCombinationMix->GetName(),tname->String().Data());
+        if ( cutCombinationMix->Pass(*fInputHandler,eventMaskMix) ) FillPools(cutCombinationMix->GetName(),tname->String().Data());
       }
     }
   }
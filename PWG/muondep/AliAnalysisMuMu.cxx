@@ -1784,7 +1784,7 @@ AliAnalysisMuMuSpectra* AliAnalysisMuMu::FitParticle(const char* particle,const
 
         if(!okMCtails) continue;
 
-        added += ( r->AddFit(fitType->String().Data()) == kTRUE );
+        added += ( r->QueueFit(fitType->String().Data()) == kTRUE );
       }
 
       // Config. for mpt (see function type)
@@ -1828,7 +1828,7 @@ AliAnalysisMuMuSpectra* AliAnalysisMuMu::FitParticle(const char* particle,const
 
           GetParametersFromResult(sMinvfitType,fitMinv);//FIXME: Think about if this is necessary
 
-          added += ( r->AddFit(sMinvfitType.Data()) == kTRUE );
+          added += ( r->QueueFit(sMinvfitType.Data()) == kTRUE );
 
           nSubFit++;
         }
@@ -1875,7 +1875,7 @@ AliAnalysisMuMuSpectra* AliAnalysisMuMu::FitParticle(const char* particle,const
 
           GetParametersFromResult(sMinvfitType,fitMinv);//FIXME: Think about if this is necessary
 
-          added += ( r->AddFit(sMinvfitType.Data()) == kTRUE );
+          added += ( r->QueueFit(sMinvfitType.Data()) == kTRUE );
 
           nSubFit++;
         }
@@ -1931,7 +1931,7 @@ AliAnalysisMuMuSpectra* AliAnalysisMuMu::FitParticle(const char* particle,const
             continue; //return 0x0;
           }
 
-          added += ( r->AddFit(sMinvFitType.Data()) == kTRUE );
+          added += ( r->QueueFit(sMinvFitType.Data()) == kTRUE );
 
           nSubFit++;
         }
@@ -1957,12 +1957,15 @@ AliAnalysisMuMuSpectra* AliAnalysisMuMu::FitParticle(const char* particle,const
           continue;
         }
         // Here we call  FINALLY the fit functions
-        added += ( r->AddFit(fitType->String().Data()) == kTRUE );
+        added += ( r->QueueFit(fitType->String().Data()) == kTRUE );
       }
 
       std::cout << "-------------------------------------" << std::endl;
       std::cout << "" << std::endl;
     }
+    // with several fit threads (AliAnalysisMuMuJpsiResult::SetNofFitThreads) the fits were only queued
+    if ( r->NofQueuedFits() ) added = r->RunQueuedFits();
+
     if ( !added )
     {
       delete fitTypeArray;
@@ -17,6 +17,8 @@
 
 ClassImp(AliAnalysisMuMuJpsiResult)
 
+Int_t AliAnalysisMuMuJpsiResult::fgNofFitThreads = 1;
+
 #include <TObjString.h>
 #include "TF1.h"
 #include "TProfile.h"
@@ -29,17 +31,22 @@ ClassImp(AliAnalysisMuMuJpsiResult)
 #include "TMap.h"
 #include "TMath.h"
 #include "TMethodCall.h"
+#include "TROOT.h"
+#include "TStopwatch.h"
 #include "TObjArray.h"
 #include "TParameter.h"
 #include "AliAnalysisMuMuBinning.h"
 #include "AliLog.h"
 #include <map>
 #include <iostream>
+#include <atomic>
+#include <thread>
 
 #include "Fit/Fitter.h"
 #include "Fit/BinData.h"
 #include "Fit/Chi2FCN.h"
 #include "Math/WrappedMultiTF1.h"
+#include "Math/MinimizerOptions.h"
 #include "HFitInterface.h"
 #include "TMinuit.h"
 #include "TCanvas.h"
@@ -88,6 +95,80 @@ namespace {
   const TString kKeySPsiP     = "FSigmaPsiP"; //Factor to fix the psi' sigma to sigmaJPsi*SigmaPsiP (Usually factor SigmaPsiP = 1, 0.9 and 1.1)
   const TString kKeyMinvRS    = "MinvRS"; // FIXME: not very correct since "MinvRS" is in AliAnalysisMuMu::GetParametersFromResult
 
+  typedef void (AliAnalysisMuMuJpsiResult::*FitMethod)();
+
+  //____________________________________________________________________________
+  FitMethod GetFitMethod(const TString& name)
+  {
+    /// compiled lookup of the FitXXX methods, so that the fits running in
+    /// several threads do not all go through the interpreter
+#define FITMETHOD(f) { #f, &AliAnalysisMuMuJpsiResult::f }
+    static const std::map<std::string,FitMethod> fitMethods = {
+      FITMETHOD(FitPSICOUNT),
+      FITMETHOD(FitPSICB2),
+      FITMETHOD(FitPSINA60NEW),
+      FITMETHOD(FitPSIPSIPRIMECB2VWG),
+      FITMETHOD(FitPSIPSIPRIMECB2VWG2),
+      FITMETHOD(FitPSIPSIPRIMECB2POL1POL2),
+      FITMETHOD(FitPSIPSIPRIMECB2POL2POL3),
+      FITMETHOD(FitPSIPSIPRIMECB2POL2POL3V2),
+      FITMETHOD(FitPSIPSIPRIMECB2POL2EXP),
+      FITMETHOD(FitPSIPSIPRIMENA60NEWVWG),
+      FITMETHOD(FitPSIPSIPRIMENA60NEWVWG2),
+      FITMETHOD(FitPSIPSIPRIMENA60NEWPOL1POL2),
+      FITMETHOD(FitPSIPSIPRIMENA60NEWPOL2POL3),
+      FITMETHOD(FitPSIPSIPRIMENA60NEWPOL2EXP),
+      FITMETHOD(FitPSIPSIPRIMECB2POL4EXP),
+      FITMETHOD(FitPSIPSIPRIMENA60NEWPOL4EXP),
+      FITMETHOD(FitPSIPSIPRIMECB2VWGINDEPTAILS),
+      FITMETHOD(FitMPTPSIPSIPRIMECB2VWG_BKGMPTPOL2),
+      FITMETHOD(FitMPTPSIPSIPRIMECB2POL1POL2_BKGMPTPOL2),
+      FITMETHOD(FitMPTPSIPSIPRIMECB2VWG_BKGMPTPOL2EXP),
+      FITMETHOD(FitMPTPSIPSIPRIMECB2POL1POL2_BKGMPTPOL2EXP),
+      FITMETHOD(FitMPTPSIPSIPRIMECB2POL2EXP_BKGMPTPOL2),
+      FITMETHOD(FitMPTPSIPSIPRIMECB2POL2EXP_BKGMPTPOL2EXP),
+      FITMETHOD(FitMPTPSIPSIPRIMECB2VWG_BKGMPTLIN),
+      FITMETHOD(FitMPTPSIPSIPRIMECB2VWG_BKGMPTPOL3),
+      FITMETHOD(FitMPTPSIPSIPRIMECB2VWG_BKGMPTPOL4),
+      FITMETHOD(FitMPTPSIPSIPRIMECB2VWGINDEPTAILS_BKGMPTPOL2),
+      FITMETHOD(FitMPTPSIPSIPRIMENA60NEWVWG_BKGMPTPOL2),
+      FITMETHOD(FitMPTPSIPSIPRIMENA60NEWVWG_BKGMPTPOL2EXP),
+      FITMETHOD(FitMPTPSIPSIPRIMENA60NEWPOL1POL2_BKGMPTPOL2),
+      FITMETHOD(FitMPTPSIPSIPRIMENA60NEWPOL1POL2_BKGMPTPOL2EXP),
+      FITMETHOD(FitMPTPSIPSIPRIMENA60NEWPOL2EXP_BKGMPTPOL2),
+      FITMETHOD(FitMPTPSIPSIPRIMENA60NEWPOL2EXP_BKGMPTPOL2EXP),
+      FITMETHOD(FitMPTPSI_HFUNCTION),
+      FITMETHOD(FitMV2PSIPSIPRIMECB2VWG_BKGMV2POL2),
+      FITMETHOD(FitMV2PSIPSIPRIMECB2VWG_BKGMV2POL2EXP),
+      FITMETHOD(FitMV2PSIPSIPRIMECB2VWG_BKGMV2POL3),
+      FITMETHOD(FitMV2PSIPSIPRIMECB2VWG_BKGMV2POL4),
+      FITMETHOD(FitMV2PSIPSIPRIMECB2VWG2_BKGMV2POLEXP),
+      FITMETHOD(FitMV2PSIPSIPRIMECB2VWG2_BKGMV2POL2EXP),
+      FITMETHOD(FitMV2PSIPSIPRIMECB2VWG2_BKGMV2POL4),
+      FITMETHOD(FitMV2PSIPSIPRIMECB2VWG2_BKGMV2POL4Cheb),
+      FITMETHOD(FitMV2PSIPSIPRIMECB2POL2POL3_BKGMV2POL2),
+      FITMETHOD(FitMV2PSIPSIPRIMECB2POL2POL3_BKGMV2POLEXP),
+      FITMETHOD(FitMV2PSIPSIPRIMECB2POL2POL3_BKGMV2POL2EXP),
+      FITMETHOD(FitMV2PSIPSIPRIMECB2POL2POL3_BKGMV2POL4),
+      FITMETHOD(FitMV2PSIPSIPRIMECB2POL2POL3_BKGMV2POL4Cheb),
+      FITMETHOD(FitMV2PSIPSIPRIMENA60NEWVWG2_BKGMV2POL2),
+      FITMETHOD(FitMV2PSIPSIPRIMENA60NEWVWG2_BKGMV2POLEXP),
+      FITMETHOD(FitMV2PSIPSIPRIMENA60NEWVWG2_BKGMV2POL2EXP),
+      FITMETHOD(FitMV2PSIPSIPRIMENA60NEWVWG2_BKGMV2POL4),
+      FITMETHOD(FitMV2PSIPSIPRIMENA60NEWVWG2_BKGMV2POL4Cheb),
+      FITMETHOD(FitMV2PSIPSIPRIMENA60NEWPOL2POL3_BKGMV2POL2),
+      FITMETHOD(FitMV2PSIPSIPRIMENA60NEWPOL2POL3_BKGMV2POLEXP),
+      FITMETHOD(FitMV2PSIPSIPRIMENA60NEWPOL2POL3_BKGMV2POL2EXP),
+      FITMETHOD(FitMV2PSIPSIPRIMENA60NEWPOL2POL3_BKGMV2POL4),
+      FITMETHOD(FitMV2PSIPSIPRIMENA60NEWPOL2POL3_BKGMV2POL4Cheb)
+    };
+#undef FITMETHOD
+    std::map<std::string,FitMethod>::const_iterator it = fitMethods.find(name.Data());
+    return ( it != fitMethods.end() ) ? it->second : 0x0;
+  }
+
+  Bool_t gRunningFitThreads = kFALSE; // set while RunQueuedFits runs fits in several threads
+
 }
 
 //_____________________________________________________________________________
@@ -281,6 +362,7 @@ AliAnalysisMuMuJpsiResult::~AliAnalysisMuMuJpsiResult()
 {
   // dtor
   delete fHisto;
+  for ( size_t i = 0; i < fQueuedFits.size(); ++i ) delete fQueuedFits[i];
 }
 
 //_____________________________________________________________________________
@@ -3624,8 +3706,11 @@ void AliAnalysisMuMuJpsiResult::FitPSIPSIPRIMECB2POL2POL3V2()
   if ( static_cast<int>(fitResult) /*||  static_cast<int>(fitResult->CovMatrixStatus())!=3*/ ) ProcessMinvFit(fitResult,fitTotal,bckInit,fitOption,13,5); // Further attempts to fit if the first one fails
   //___________
 
-   new TCanvas;
-  fHisto->DrawCopy();
+  if ( !gRunningFitThreads )
+  {
+    new TCanvas;
+    fHisto->DrawCopy();
+  }
   return;
 
 
@@ -12510,61 +12595,187 @@ Bool_t AliAnalysisMuMuJpsiResult::AddFit(const char* fitType)
 {
   // Add a fit to this result
 
-  if ( !fHisto ) return kFALSE;
+  AliAnalysisMuMuJpsiResult* r = CreateFit(fitType);
+
+  if ( !r ) return kFALSE;
+
+  if ( !RunFit(r) )
+  {
+    delete r;
+    return kFALSE;
+  }
+
+  return AdoptFit(r);
+}
+
+//_____________________________________________________________________________
+Bool_t AliAnalysisMuMuJpsiResult::QueueFit(const char* fitType)
+{
+  /// Prepare a fit to be run by RunQueuedFits. With a single fit thread
+  /// the fit is done right away.
+
+  if ( fgNofFitThreads <= 1 ) return AddFit(fitType);
+
+  AliAnalysisMuMuJpsiResult* r = CreateFit(fitType);
+
+  if ( !r ) return kFALSE;
+
+  fQueuedFits.push_back(r);
+
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+Int_t AliAnalysisMuMuJpsiResult::RunQueuedFits()
+{
+  /// Run the queued fits in fgNofFitThreads threads, and adopt the valid
+  /// subresults in the order they were queued. Return the number of adopted fits.
+
+  const Int_t nFits = fQueuedFits.size();
+  if ( !nFits ) return 0;
+
+  const Int_t nThreads = TMath::Min(TMath::Max(fgNofFitThreads,1),nFits);
+
+  std::vector<Int_t> fitOK(nFits,0); // not vector<bool>, each thread writes its own elements
+  TStopwatch timer;
+
+  if ( nThreads > 1 )
+  {
+    // the fit functions must not go to the global lists, and TMinuit
+    // is a global : use Minuit2 (which is thread safe) for these fits
+    ROOT::EnableThreadSafety();
+    Bool_t addToGlobalList = TF1::DefaultAddToGlobalList(kFALSE);
+    Bool_t addDirectory = TH1::AddDirectoryStatus();
+    TH1::AddDirectory(kFALSE);
+    std::string minimizer = ROOT::Math::MinimizerOptions::DefaultMinimizerType();
+    std::string algorithm = ROOT::Math::MinimizerOptions::DefaultMinimizerAlgo();
+    ROOT::Math::MinimizerOptions::SetDefaultMinimizer("Minuit2");
+    MassMap();
+    GetFitMethod("");
+    gRunningFitThreads = kTRUE;
+
+    std::atomic<Int_t> next(0);
+    auto work = [&]()
+    {
+      for ( Int_t i = next++; i < nFits; i = next++ ) fitOK[i] = RunFit(fQueuedFits[i]);
+    };
+
+    std::vector<std::thread> workers;
+    for ( Int_t t = 1; t < nThreads; ++t ) workers.emplace_back(work);
+    work();
+    for ( size_t t = 0; t < workers.size(); ++t ) workers[t].join();
+
+    gRunningFitThreads = kFALSE;
+    ROOT::Math::MinimizerOptions::SetDefaultMinimizer(minimizer.c_str(),algorithm.c_str());
+    TH1::AddDirectory(addDirectory);
+    TF1::DefaultAddToGlobalList(addToGlobalList);
+  }
+  else
+  {
+    for ( Int_t i = 0; i < nFits; ++i ) fitOK[i] = RunFit(fQueuedFits[i]);
+  }
+
+  Int_t nAdopted(0);
+  for ( Int_t i = 0; i < nFits; ++i )
+  {
+    if ( fitOK[i] ) nAdopted += ( AdoptFit(fQueuedFits[i]) == kTRUE );
+    else delete fQueuedFits[i];
+  }
+  fQueuedFits.clear();
+
+  AliInfo(Form("%d fits in %d threads : %d adopted, %.1f s",nFits,nThreads,nAdopted,timer.RealTime()));
+
+  return nAdopted;
+}
+
+//_____________________________________________________________________________
+AliAnalysisMuMuJpsiResult* AliAnalysisMuMuJpsiResult::CreateFit(const char* fitType) const
+{
+  /// Create the subresult for a given fit type (not fitted yet)
+
+  if ( !fHisto ) return 0x0;
 
   TH1* histo = static_cast<TH1*>(fHisto->Clone(fitType));
 
-  AliAnalysisMuMuJpsiResult* r = new AliAnalysisMuMuJpsiResult(GetParticle(),*histo,fitType);
+  AliAnalysisMuMuJpsiResult* r = new AliAnalysisMuMuJpsiResult(fParticle.Data(),*histo,fitType);
+
+  delete histo;
 
   if ( !r->IsValid() )
   {
     delete r;
-    return kFALSE;
+    return 0x0;
   }
 
-  TMethodCall callEnv;
+  return r;
+}
+
+//_____________________________________________________________________________
+Bool_t AliAnalysisMuMuJpsiResult::RunFit(AliAnalysisMuMuJpsiResult* r) const
+{
+  /// Call the fit method of the subresult r, and record the time it took.
+  /// Return whether the fit gave a valid result
 
   TString fittingMethod(r->GetFitFunctionMethodName().Data());
 
   std::cout << "+Using fitting method " << fittingMethod.Data() << "..." << std::endl;
   std::cout << "" << std::endl;
 
-  callEnv.InitWithPrototype(IsA(),fittingMethod.Data(),"");
+  TStopwatch timer;
+
+  FitMethod fitMethod = GetFitMethod(fittingMethod);
 
-  if (callEnv.IsValid())
+  if ( fitMethod )
   {
-    callEnv.Execute(r);// here fit Method ("fit<SOMETHING>") is called and the fit is proceed.
+    (r->*fitMethod)();
   }
   else
   {
-    AliError(Form("Could not get the method %s",fittingMethod.Data()));
-    delete r;
-    return kFALSE;
-  }
+    // methods not in the compiled list are found through the interpreter
+    TMethodCall callEnv;
 
-  if ( r->IsValid() )
-  {
-    StdoutToAliDebug(1,r->Print(););
-    r->SetBin(Bin());
-    r->SetNofTriggers(NofTriggers());
-    r->SetNofRuns(NofRuns());
-
-    Bool_t adoptOK = AdoptSubResult(r);
-    if ( adoptOK ) {
+    callEnv.InitWithPrototype(IsA(),fittingMethod.Data(),"");
 
-      std::cout << "Subresult " << r->GetName() << " adopted in " << GetName() <<  std::endl;
-      if(IsValidValue(r->Weight()))  SetWeight(Weight()+r->Weight());
-      else SetWeight(Weight()+1);
+    if (callEnv.IsValid())
+    {
+      callEnv.Execute(r);// here fit Method ("fit<SOMETHING>") is called and the fit is proceed.
+    }
+    else
+    {
+      AliError(Form("Could not get the method %s",fittingMethod.Data()));
+      return kFALSE;
     }
-    else AliError(Form("Could not adopt subresult %s",r->GetName()));
   }
-  else
-  {
-    delete r;
-    r=0x0;
+
+  timer.Stop();
+
+  if ( !r->IsValid() ) return kFALSE;
+
+  r->Set("FitTime",timer.RealTime(),0.0);
+
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+Bool_t AliAnalysisMuMuJpsiResult::AdoptFit(AliAnalysisMuMuJpsiResult* r)
+{
+  /// Adopt the fitted subresult r
+
+  StdoutToAliDebug(1,r->Print(););
+  r->SetBin(Bin());
+  r->SetNofTriggers(NofTriggers());
+  r->SetNofRuns(NofRuns());
+
+  Bool_t adoptOK = AdoptSubResult(r);
+  if ( adoptOK ) {
+
+    std::cout << "Subresult " << r->GetName() << " adopted in " << GetName() <<  std::endl;
+    if(IsValidValue(r->Weight()))  SetWeight(Weight()+r->Weight());
+    else SetWeight(Weight()+1);
   }
+  else AliError(Form("Could not adopt subresult %s",r->GetName()));
 
-  return (r!=0x0);
+  return kTRUE;
 }
 
 //_____________________________________________________________________________
@@ -13632,6 +13843,16 @@ Bool_t AliAnalysisMuMuJpsiResult::CheckFitStatus(TFitResultPtr &fitResult)
     isok =kFALSE;
     AliDebug(1,Form("Fit rejected because of covariant matrix : %d",fitResult->CovMatrixStatus()));
   }
+  // gMinuit is shared by all the fits, the threads only have their own fit result
+  if ( gRunningFitThreads || !gMinuit )
+  {
+    if ( !fitResult->IsValid() )
+    {
+      isok =kFALSE;
+      AliDebug(1,"Minimizer status is not ok !");
+    }
+    return isok;
+  }
   TString minuitStatus = gMinuit->fCstatu;
   if(!minuitStatus.Contains("SUCCESSFUL") && !minuitStatus.Contains("OK") && !minuitStatus.Contains("PROBLEMS")){
     isok =kFALSE;
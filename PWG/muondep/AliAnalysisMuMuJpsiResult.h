@@ -33,6 +33,7 @@ FitType: func=PSIPSIPRIMECB2VWG:rebin=1:histoType=minv:alJPsi=0.974323:nlJPsi=7.
 #include <TString.h>
 #include "AliAnalysisMuMuResult.h"
 #include "AliAnalysisMuMuBinning.h"
+#include <vector>
 
 class TH1;
 class THashList;
@@ -80,6 +81,17 @@ public:
 
   Bool_t AddFit(const char* fitType);
 
+  /** Fits can be run in several threads : QueueFit prepares the subresult (and
+   runs it right away, as AddFit, with a single fit thread), RunQueuedFits
+   runs the queued fits and adopts the valid ones in the order they were queued.
+   */
+  Bool_t QueueFit(const char* fitType);
+  Int_t RunQueuedFits();
+  Int_t NofQueuedFits() const { return fQueuedFits.size(); }
+
+  static void SetNofFitThreads(Int_t n) { fgNofFitThreads = n; }
+  static Int_t NofFitThreads() { return fgNofFitThreads; }
+
   /** All the fit functions should have a prototype starting like :
 
    AliAnalysisMuMuJpsiResult* FitXXX();
@@ -377,6 +389,10 @@ private:
   Bool_t StrongCorrelation(TFitResultPtr& fitResult, TF1* fitFunction, Int_t npar1, Int_t npar2, Double_t fixValueIfWrong);
 
   Bool_t CheckFitStatus(TFitResultPtr &fitResult);
+
+  AliAnalysisMuMuJpsiResult* CreateFit(const char* fitType) const;
+  Bool_t RunFit(AliAnalysisMuMuJpsiResult* r) const;
+  Bool_t AdoptFit(AliAnalysisMuMuJpsiResult* r);
 private:
   Int_t fNofRuns; // number of runs used to get this result
   Int_t fNofTriggers; // number of trigger analyzed
@@ -396,7 +412,11 @@ private:
   TString fParticle;
   TString fMinvRS; // minv spectra range and sigmaPsiP factor for the mpt fits
 
-  ClassDef(AliAnalysisMuMuJpsiResult,8) // a class to hold invariant mass analysis results (counts, yields, AccxEff, R_AB, etc...)
+  std::vector<AliAnalysisMuMuJpsiResult*> fQueuedFits; //! subresults waiting for RunQueuedFits
+
+  static Int_t fgNofFitThreads; // number of threads used by RunQueuedFits
+
+  ClassDef(AliAnalysisMuMuJpsiResult,9) // a class to hold invariant mass analysis results (counts, yields, AccxEff, R_AB, etc...)
 };
 
 #endif
@@ -65,6 +65,7 @@
 #include "TPythia6Decayer.h"
 #include "TParticle.h"
 #include "TBits.h"
+#include "AliCFFlatParticles.h"
 ClassImp(AliAnalysisTaskCFTree)
 
 //-----------------------------------------------------------------------------
@@ -163,11 +164,13 @@ fStoreMuonOrigin(0),
 fApplyPhysicsSelectionCut(0),
 fStoreOnlyEventsWithMuons(0),
 fStoreCutBitsInTrackMask(0),
+fFlatFormat(0),
 fDecayArray(0x0),
 fDecayer(0x0),
 fMapping(0x0)
 {
   Info("AliAnalysisTaskCFTree","Calling Constructor");
+  for (Int_t i=0; i<AliCFTreeMapping::kNFlatCollections; i++) fFlat[i]=0x0;
   fMuonTrackCuts->SetCustomParamFromRun(197388,"muon_pass2");
   fMuonTrackCuts->SetAllowDefaultParams(kTRUE);
   fMuonTrackCuts->SetFilterMask(AliMuonTrackCuts::kMuPdca);
@@ -264,12 +267,14 @@ void AliAnalysisTaskCFTree::UserCreateOutputObjects(){
   fTree->Branch("nchCL1mc",&fNchCL1mc);
   fTree->Branch("evcutspassed",&fEventCutsPassed);
 
-  if (fTracks)      fTree->Branch("tracks",&fTracks);
-  if (fTracklets)   fTree->Branch("tracklets",&fTracklets);
-  if (fMuons)       fTree->Branch("muons",&fMuons);
-  if (fMcParticles) fTree->Branch("mcparticles",&fMcParticles);
+  if (!fFlatFormat) {
+    if (fTracks)      fTree->Branch("tracks",&fTracks);
+    if (fTracklets)   fTree->Branch("tracklets",&fTracklets);
+    if (fMuons)       fTree->Branch("muons",&fMuons);
+    if (fMcParticles) fTree->Branch("mcparticles",&fMcParticles);
+    if (fMcMuons)     fTree->Branch("mcmuons",&fMcMuons);
+  }
   if (fMuonOrigin)  fTree->Branch("muon_origin",&fMuonOrigin);
-  if (fMcMuons)     fTree->Branch("mcmuons",&fMcMuons);
 
   fMapping = new AliCFTreeMapping();
   Int_t iParameter=0; // Mapping Tracks
@@ -306,6 +311,26 @@ void AliAnalysisTaskCFTree::UserCreateOutputObjects(){
     if (fStoreMcTracks) fMapping->MappingMCTracks()[i]=iParameter++; else fMapping->MappingMCTracks()[i]=-1;
   }
 
+  if (fFlatFormat) {
+    // pt: log scale 2e-4 (1 MeV - 490 GeV), tracklet dphi: 2e-5 (|dphi|<0.65), eta: 2e-4 (|eta|<6.5), phi: 1.4e-4 (-pi - 2pi)
+    const char* names[AliCFTreeMapping::kNFlatCollections] = {"tracks","tracklets","muons","mcparticles","mcmuons"};
+    TClonesArray* arrays[AliCFTreeMapping::kNFlatCollections] = {fTracks,fTracklets,fMuons,fMcParticles,fMcMuons};
+    Int_t nData[AliCFTreeMapping::kNFlatCollections] = {0,
+      fStoreMcTracklets ? AliCFTreeMapping::kMappingTracklets : 0,
+      fStoreMcMuons ? AliCFTreeMapping::kMappingMuons : AliCFTreeMapping::kMuonMCPt,
+      AliCFTreeMapping::kMappingMCTracks, 0};
+    for (Int_t i=0; i<AliCFTreeMapping::kMappingTracks; i++) if (fMapping->MappingTracks()[i]>=nData[0]) nData[0]=fMapping->MappingTracks()[i]+1;
+    for (Int_t i=0; i<AliCFTreeMapping::kNFlatCollections; i++) {
+      if (!arrays[i]) continue;
+      if (i==AliCFTreeMapping::kFlatTracklets) fMapping->SetQuantization(i,AliCFTreeMapping::kFlatPt,-0.65536,2.e-5);
+      else fMapping->SetQuantization(i,AliCFTreeMapping::kFlatPt,TMath::Log(1.e-3),2.e-4,kTRUE);
+      fMapping->SetQuantization(i,AliCFTreeMapping::kFlatEta,-6.5536,2.e-4);
+      fMapping->SetQuantization(i,AliCFTreeMapping::kFlatPhi,-TMath::Pi(),3.*TMath::Pi()/65535.);
+      fFlat[i] = new AliCFFlatParticles(names[i],i,nData[i]);
+      fFlat[i]->Branch(fTree,fMapping);
+    }
+  }
+
   fTree->GetUserInfo()->Add(fMapping);	//to retreive it afterwards one needs fTree->GetUserInfo()->At(0)
 
   fUtils = new AliAnalysisUtils();
@@ -813,6 +838,10 @@ void AliAnalysisTaskCFTree::UserExec(Option_t *){
     fNchCL1mc = countNchCL1Mc;
   }
 
+  if (fFlatFormat) {
+    TClonesArray* arrays[AliCFTreeMapping::kNFlatCollections] = {fTracks,fTracklets,fMuons,fMcParticles,fMcMuons};
+    for (Int_t i=0; i<AliCFTreeMapping::kNFlatCollections; i++) if (fFlat[i]) fFlat[i]->Fill(arrays[i]);
+  }
   if (!fStoreOnlyEventsWithMuons) fTree->Fill();
   else { if (fMuons) if (fMuons->GetEntriesFast()>0) fTree->Fill(); }
 
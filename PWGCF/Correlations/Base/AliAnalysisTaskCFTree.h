@@ -23,6 +23,7 @@ class TClonesArray;
 class AliAnalysisFilter;
 class AliVTrack;
 class AliCFParticle;
+class AliCFFlatParticles;
 class AliAnalysisUtils;
 class AliMuonTrackCuts;
 class TPythia6Decayer;
@@ -68,6 +69,8 @@ class AliAnalysisTaskCFTree : public AliAnalysisTaskSE {
   void SetApplyPhysicsSelectionCut(Bool_t val=kTRUE) { fApplyPhysicsSelectionCut = val; }
   void SetStoreOnlyEventsWithMuons(Bool_t val=kTRUE) { fStoreOnlyEventsWithMuons = val; }
   void SetStoreCutBitsInTrackMask(Bool_t val=kTRUE)  { fStoreCutBitsInTrackMask  = val; }
+  // fixed-layout branches with quantized kinematics instead of TClonesArrays, read with AliCFFlatParticles
+  void SetFlatFormat(Bool_t val=kTRUE)               { fFlatFormat               = val; }
  protected:
   AliAnalysisTaskCFTree(const  AliAnalysisTaskCFTree &task);
   AliAnalysisTaskCFTree& operator=(const  AliAnalysisTaskCFTree &task);
@@ -173,10 +176,12 @@ class AliAnalysisTaskCFTree : public AliAnalysisTaskSE {
   Bool_t fApplyPhysicsSelectionCut; // skip events not passing fSelectionBit mask
   Bool_t fStoreOnlyEventsWithMuons; // if kTRUE store only events with at least one muon
   Bool_t fStoreCutBitsInTrackMask;  // if kTRUE modify additional bits in track mask
+  Bool_t fFlatFormat;               // if kTRUE store particles in the flat format
+  AliCFFlatParticles* fFlat[AliCFTreeMapping::kNFlatCollections]; //! flat branches of tracks, tracklets, muons, MC particles, MC muons
   TClonesArray* fDecayArray;
   TPythia6Decayer* fDecayer;
 
-  ClassDef(AliAnalysisTaskCFTree,9);
+  ClassDef(AliAnalysisTaskCFTree,10);
 };
 #endif
 
@@ -0,0 +1,222 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// Fixed-layout (flat) storage of a collection of AliCFParticles in the tree
+//
+// Branches for prefix "tracks":
+//   tracks_n, tracks_nd                      number of particles, of additional parameters
+//   tracks_pt, tracks_eta, tracks_phi        [tracks_n] UShort_t, quantized with the AliCFTreeMapping
+//   tracks_charge, tracks_mask, tracks_bits  [tracks_n]
+//   tracks_data                              [tracks_nd] additional parameters, tracks_nd/tracks_n per particle
+//
+// Reading:
+//   AliCFFlatParticles tracks("tracks",AliCFTreeMapping::kFlatTracks);
+//   tracks.SetBranchAddresses(tree);
+//   tree->GetEntry(i);
+//   for (Int_t j=0; j<tracks.GetEntriesFast(); j++) tracks.Pt(j) ...
+//   or TClonesArray* arr = tracks.GetParticles(); for the AliCFParticle interface
+
+#include "AliCFFlatParticles.h"
+#include "AliCFParticle.h"
+#include "AliCFTreeMapping.h"
+#include "TTree.h"
+#include "TList.h"
+#include "TClonesArray.h"
+
+ClassImp(AliCFFlatParticles)
+
+AliCFFlatParticles::AliCFFlatParticles() :
+TObject(),
+fPrefix(),
+fCollection(0),
+fNData(0),
+fMapping(0x0),
+fTree(0x0),
+fCapacity(0),
+fN(0),
+fND(0),
+fPt(),
+fEta(),
+fPhi(),
+fCharge(),
+fMask(),
+fBits(),
+fData(),
+fParticles(0x0)
+{
+}
+
+AliCFFlatParticles::AliCFFlatParticles(const char* prefix, Int_t collection, Int_t nData) :
+TObject(),
+fPrefix(prefix),
+fCollection(collection),
+fNData(nData),
+fMapping(0x0),
+fTree(0x0),
+fCapacity(0),
+fN(0),
+fND(0),
+fPt(),
+fEta(),
+fPhi(),
+fCharge(),
+fMask(),
+fBits(),
+fData(),
+fParticles(0x0)
+{
+}
+
+AliCFFlatParticles::~AliCFFlatParticles()
+{
+  if (fParticles) { fParticles->Delete(); delete fParticles; }
+}
+
+//-----------------------------------------------------------------------------
+void AliCFFlatParticles::Resize(Int_t n, Int_t nd)
+{
+  // vectors are never empty to have valid addresses
+  if (n>fCapacity) {
+    fCapacity = n;
+    fPt.resize(n);
+    fEta.resize(n);
+    fPhi.resize(n);
+    fCharge.resize(n);
+    fMask.resize(n);
+    fBits.resize(n);
+  }
+  if (nd<1) nd=1;
+  if (nd>(Int_t) fData.size()) fData.resize(nd);
+}
+
+//-----------------------------------------------------------------------------
+void AliCFFlatParticles::SetAddresses()
+{
+  const char* p = fPrefix.Data();
+  fTree->SetBranchAddress(Form("%s_n",p),&fN);
+  fTree->SetBranchAddress(Form("%s_nd",p),&fND);
+  fTree->SetBranchAddress(Form("%s_pt",p),&fPt[0]);
+  fTree->SetBranchAddress(Form("%s_eta",p),&fEta[0]);
+  fTree->SetBranchAddress(Form("%s_phi",p),&fPhi[0]);
+  fTree->SetBranchAddress(Form("%s_charge",p),&fCharge[0]);
+  fTree->SetBranchAddress(Form("%s_mask",p),&fMask[0]);
+  fTree->SetBranchAddress(Form("%s_bits",p),&fBits[0]);
+  fTree->SetBranchAddress(Form("%s_data",p),&fData[0]);
+}
+
+//-----------------------------------------------------------------------------
+void AliCFFlatParticles::Branch(TTree* tree, const AliCFTreeMapping* mapping)
+{
+  fTree = tree;
+  fMapping = mapping;
+  Resize(2000,2000*fNData);
+  const char* p = fPrefix.Data();
+  fTree->Branch(Form("%s_n",p),&fN,Form("%s_n/I",p));
+  fTree->Branch(Form("%s_nd",p),&fND,Form("%s_nd/I",p));
+  fTree->Branch(Form("%s_pt",p),&fPt[0],Form("%s_pt[%s_n]/s",p,p));
+  fTree->Branch(Form("%s_eta",p),&fEta[0],Form("%s_eta[%s_n]/s",p,p));
+  fTree->Branch(Form("%s_phi",p),&fPhi[0],Form("%s_phi[%s_n]/s",p,p));
+  fTree->Branch(Form("%s_charge",p),&fCharge[0],Form("%s_charge[%s_n]/B",p,p));
+  fTree->Branch(Form("%s_mask",p),&fMask[0],Form("%s_mask[%s_n]/i",p,p));
+  fTree->Branch(Form("%s_bits",p),&fBits[0],Form("%s_bits[%s_n]/s",p,p));
+  fTree->Branch(Form("%s_data",p),&fData[0],Form("%s_data[%s_nd]/F",p,p));
+}
+
+//-----------------------------------------------------------------------------
+void AliCFFlatParticles::Fill(const TClonesArray* particles)
+{
+  // copy the particles of the event, call before TTree::Fill
+  fN = particles ? particles->GetEntriesFast() : 0;
+  fND = fN*fNData;
+  if (fN>fCapacity || fND>(Int_t) fData.size()) {
+    Resize(fN,fND);
+    SetAddresses();
+  }
+  for (Int_t i=0; i<fN; i++) {
+    AliCFParticle* part = (AliCFParticle*) particles->UncheckedAt(i);
+    fPt[i]     = fMapping->Quantize(fCollection,AliCFTreeMapping::kFlatPt,part->Pt());
+    fEta[i]    = fMapping->Quantize(fCollection,AliCFTreeMapping::kFlatEta,part->Eta());
+    fPhi[i]    = fMapping->Quantize(fCollection,AliCFTreeMapping::kFlatPhi,part->Phi());
+    fCharge[i] = part->Charge();
+    fMask[i]   = part->Mask();
+    fBits[i]   = part->TestBits(0x3ff<<14)>>14;
+    Float_t* data = &fData[i*fNData];
+    Int_t nData = part->GetSize()<fNData ? part->GetSize() : fNData;
+    for (Int_t j=0; j<nData; j++) data[j] = part->GetAt(j);
+    for (Int_t j=nData; j<fNData; j++) data[j] = 0;
+  }
+}
+
+//-----------------------------------------------------------------------------
+Bool_t AliCFFlatParticles::SetBranchAddresses(TTree* tree, const AliCFTreeMapping* mapping)
+{
+  if (!tree) return kFALSE;
+  if (!mapping && tree->GetUserInfo()) {
+    TIter next(tree->GetUserInfo());
+    TObject* obj = 0;
+    while ((obj = next()) && !mapping) mapping = dynamic_cast<AliCFTreeMapping*>(obj);
+  }
+  if (!mapping || !mapping->HasQuantization(fCollection) || !tree->GetBranch(Form("%s_n",fPrefix.Data()))) {
+    Error("SetBranchAddresses","No flat branches %s in the tree",fPrefix.Data());
+    return kFALSE;
+  }
+  fTree = tree;
+  fMapping = mapping;
+  // buffers for the largest event of the whole tree (or chain)
+  Resize(Int_t(tree->GetMaximum(Form("%s_n",fPrefix.Data()))),Int_t(tree->GetMaximum(Form("%s_nd",fPrefix.Data()))));
+  if (fCapacity<1) Resize(1,1);
+  SetAddresses();
+  return kTRUE;
+}
+
+//-----------------------------------------------------------------------------
+Float_t AliCFFlatParticles::Pt(Int_t i) const
+{
+  return fMapping->Dequantize(fCollection,AliCFTreeMapping::kFlatPt,fPt[i]);
+}
+
+//-----------------------------------------------------------------------------
+Float_t AliCFFlatParticles::Eta(Int_t i) const
+{
+  return fMapping->Dequantize(fCollection,AliCFTreeMapping::kFlatEta,fEta[i]);
+}
+
+//-----------------------------------------------------------------------------
+Float_t AliCFFlatParticles::Phi(Int_t i) const
+{
+  return fMapping->Dequantize(fCollection,AliCFTreeMapping::kFlatPhi,fPhi[i]);
+}
+
+//-----------------------------------------------------------------------------
+TClonesArray* AliCFFlatParticles::GetParticles()
+{
+  // AliCFParticles of the current entry, the objects are reused from event to event
+  if (!fParticles) fParticles = new TClonesArray("AliCFParticle",fCapacity>0 ? fCapacity : 1);
+  fParticles->Clear();
+  Int_t nData = GetNData();
+  for (Int_t i=0; i<fN; i++) {
+    AliCFParticle* part = (AliCFParticle*) fParticles->ConstructedAt(i);
+    part->SetPt(Pt(i));
+    part->SetEta(Eta(i));
+    part->SetPhi(Phi(i));
+    part->SetCharge(fCharge[i]);
+    part->SetMask(fMask[i]);
+    part->ResetBit(0x3ff<<14);
+    part->SetBit(UInt_t(fBits[i])<<14);
+    part->Set(nData);
+    for (Int_t j=0; j<nData; j++) part->SetAt(fData[i*nData+j],j);
+  }
+  return fParticles;
+}
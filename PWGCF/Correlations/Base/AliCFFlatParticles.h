@@ -0,0 +1,70 @@
+#ifndef AliCFFlatParticles_h
+#define AliCFFlatParticles_h
+
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+// Fixed-layout (flat) storage of a collection of AliCFParticles in the tree
+// one array branch per variable: quantized pt, eta, phi (see AliCFTreeMapping),
+// charge, mask, track bits and the additional parameters
+// the reader side rebuilds AliCFParticles for code using the TClonesArray interface
+
+#include "TObject.h"
+#include "TString.h"
+#include <vector>
+
+class TTree;
+class TClonesArray;
+class AliCFParticle;
+class AliCFTreeMapping;
+
+class AliCFFlatParticles : public TObject {
+ public:
+  AliCFFlatParticles();
+  AliCFFlatParticles(const char* prefix, Int_t collection, Int_t nData=0);
+  virtual ~AliCFFlatParticles();
+
+  // writing
+  void Branch(TTree* tree, const AliCFTreeMapping* mapping);
+  void Fill(const TClonesArray* particles);
+
+  // reading, mapping is taken from the user info of the tree if not given
+  Bool_t SetBranchAddresses(TTree* tree, const AliCFTreeMapping* mapping=0);
+  Int_t GetEntriesFast() const { return fN; }
+  Int_t GetNData() const { return fN>0 ? fND/fN : fNData; }
+  Float_t Pt(Int_t i) const;
+  Float_t Eta(Int_t i) const;
+  Float_t Phi(Int_t i) const;
+  Short_t Charge(Int_t i) const { return fCharge[i]; }
+  UInt_t Mask(Int_t i) const { return fMask[i]; }
+  Float_t Data(Int_t i, Int_t j) const { return fData[i*GetNData()+j]; }
+  TClonesArray* GetParticles();
+
+ protected:
+  AliCFFlatParticles(const AliCFFlatParticles&);
+  AliCFFlatParticles& operator=(const AliCFFlatParticles&);
+
+  void Resize(Int_t n, Int_t nd);
+  void SetAddresses();
+
+  TString fPrefix;                  //  branch name prefix
+  Int_t fCollection;                //  AliCFTreeMapping::kFlatTracks, ...
+  Int_t fNData;                     //  additional parameters per particle
+  const AliCFTreeMapping* fMapping; //! quantization
+  TTree* fTree;                     //! tree with the branches
+  Int_t fCapacity;                  //! allocated particles
+  Int_t fN;                         //! tree var: number of particles
+  Int_t fND;                        //! tree var: number of additional parameters
+  std::vector<UShort_t> fPt;        //! tree var: quantized pt
+  std::vector<UShort_t> fEta;       //! tree var: quantized eta
+  std::vector<UShort_t> fPhi;       //! tree var: quantized phi
+  std::vector<Char_t> fCharge;      //! tree var: charge
+  std::vector<UInt_t> fMask;        //! tree var: filter bit mask
+  std::vector<UShort_t> fBits;      //! tree var: TObject bits 14-23 (AliAODTrack status bits)
+  std::vector<Float_t> fData;       //! tree var: additional parameters
+  TClonesArray* fParticles;         //! AliCFParticles rebuilt on reading
+
+  ClassDef(AliCFFlatParticles,1);
+};
+
+#endif
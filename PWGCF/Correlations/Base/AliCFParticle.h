@@ -56,7 +56,7 @@ class AliCFParticle : public AliVParticle, public TArrayF {
   virtual void SetEta(Double_t eta)      { fEta    = eta;    }
   virtual void SetPhi(Double_t phi)      { fPhi    = phi;    }
   virtual void SetCharge(Short_t charge) { fCharge = charge; }
-  virtual void SetMask(Short_t mask)     { fMask   = mask;   }
+  virtual void SetMask(UInt_t mask)      { fMask   = mask;   }
  protected:
   Float_t fPt;
   Float_t fEta;
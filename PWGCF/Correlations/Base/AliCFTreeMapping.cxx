@@ -19,13 +19,50 @@
 //
 
 #include "AliCFTreeMapping.h"
+#include "TMath.h"
 
 AliCFTreeMapping::AliCFTreeMapping() : fMappingTracks(), fMappingTracklets(), fMappingMuons(), fMappingMCTracks()
 {
 //constructor
+  for (Int_t i=0; i<kNFlatCollections; i++) {
+    for (Int_t j=0; j<kNFlatVariables; j++) {
+      fQuantOffset[i][j]=0;
+      fQuantStep[i][j]=0;
+      fQuantLog[i][j]=kFALSE;
+    }
+  }
 }
 
 AliCFTreeMapping::~AliCFTreeMapping()
 {
 //destructor
 }
+
+void AliCFTreeMapping::SetQuantization(Int_t coll, Int_t var, Double_t offset, Double_t step, Bool_t logScale)
+{
+  if (coll<0 || coll>=kNFlatCollections || var<0 || var>=kNFlatVariables) return;
+  fQuantOffset[coll][var]=offset;
+  fQuantStep[coll][var]=step;
+  fQuantLog[coll][var]=logScale;
+}
+
+UShort_t AliCFTreeMapping::Quantize(Int_t coll, Int_t var, Double_t value) const
+{
+  // values outside of the range are clamped to the first or last step
+  Double_t step = fQuantStep[coll][var];
+  if (step<=0) return 0;
+  if (fQuantLog[coll][var]) {
+    if (value<=0) return 0;
+    value = TMath::Log(value);
+  }
+  Double_t q = (value-fQuantOffset[coll][var])/step+0.5;
+  if (q<=0) return 0;
+  if (q>=65535) return 65535;
+  return (UShort_t) q;
+}
+
+Float_t AliCFTreeMapping::Dequantize(Int_t coll, Int_t var, UShort_t q) const
+{
+  Double_t value = fQuantOffset[coll][var]+q*fQuantStep[coll][var];
+  return fQuantLog[coll][var] ? TMath::Exp(value) : value;
+}
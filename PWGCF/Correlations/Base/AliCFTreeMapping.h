@@ -22,18 +22,30 @@ class AliCFTreeMapping : public TObject {
   enum {kTklptMC=0, kTkletaMC, kTklphiMC, kTklpdg, kMappingTracklets};
   enum {kMuonDCA=0, kMuonChi2perNDF, kMuonRabs, kMuonpDCA, kMuonMCPt, kMuonMCEta, kMuonMCPhi, kMuonMCPdg, kMuonMCprimPt, kMuonMCprimEta, kMuonMCprimPhi, kMuonMCprimPdg, kMuonMCoriginpt, kMuonMCoriginEta, kMuonMCoriginPhi, kMuonMCoriginPdg, kMappingMuons};
   enum {kMCindex=0, kMCLabel, kMCIsPhysPrim, kMCmotherpdg, kMappingMCTracks};
+  // particle collections and kinematic variables of the flat (fixed-layout) tree format
+  enum {kFlatTracks=0, kFlatTracklets, kFlatMuons, kFlatMCTracks, kFlatMCMuons, kNFlatCollections};
+  enum {kFlatPt=0, kFlatEta, kFlatPhi, kNFlatVariables};
 
   Int_t* MappingTracks() { return fMappingTracks; }
   Int_t* MappingTracklets() { return fMappingTracklets; }
   Int_t* MappingMuons() { return fMappingMuons; }
   Int_t* MappingMCTracks() { return fMappingMCTracks; }
 
+  // kinematics of the flat format are stored as UShort_t: value = offset + q*step (log(value) for log scale)
+  void SetQuantization(Int_t coll, Int_t var, Double_t offset, Double_t step, Bool_t logScale=kFALSE);
+  Bool_t HasQuantization(Int_t coll) const { return coll>=0 && coll<kNFlatCollections && fQuantStep[coll][kFlatPt]>0; }
+  UShort_t Quantize(Int_t coll, Int_t var, Double_t value) const;
+  Float_t Dequantize(Int_t coll, Int_t var, UShort_t q) const;
+
  protected:
   Int_t fMappingTracks[kMappingTracks];		//  mapping array of positions of additional parameters of the AliCFParticle tracks
   Int_t fMappingTracklets[kMappingTracklets];	//  mapping array of positions of additional parameters of the AliCFParticle tracklets
   Int_t fMappingMuons [kMappingMuons];		//  mapping array of positions of additional parameters of the AliCFParticle muons
   Int_t fMappingMCTracks[kMappingMCTracks];	//  mapping array of positions of additional parameters of the AliCFParticle MC generated tracks
+  Double_t fQuantOffset[kNFlatCollections][kNFlatVariables]; //  offset of the quantized kinematics in the flat format
+  Double_t fQuantStep[kNFlatCollections][kNFlatVariables];   //  step of the quantized kinematics, 0 if the format is not used
+  Bool_t fQuantLog[kNFlatCollections][kNFlatVariables];      //  log scale of the quantized kinematics
 
-  ClassDef(AliCFTreeMapping,2);
+  ClassDef(AliCFTreeMapping,3);
 };
 #endif
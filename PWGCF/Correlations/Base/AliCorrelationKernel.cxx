@@ -0,0 +1,407 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//
+//
+// two-particle correlation kernel
+// the particles of an event are given as arrays, the variables of trigger particles, associated particles and
+// of the event are translated to bin indices once, only delta eta and delta phi are done per pair
+// the bin indices are collected per step and filled with AliTHnBase::FillBins
+// the events of a mixing pool are distributed over threads; each thread fills its own buffer which is
+// flushed in pool order, so that the result is identical to the serial one
+//
+//
+
+#include "AliCorrelationKernel.h"
+#include "AliTHn.h"
+#include "AliLog.h"
+#include "TAxis.h"
+#include "TArrayD.h"
+#include "TMath.h"
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+//____________________________________________________________________
+void AliCorrelationKernel::Particles::Clear()
+{
+  fEta.clear();
+  fPhi.clear();
+  fPt.clear();
+  fWeight.clear();
+  fStep.clear();
+  fID.clear();
+  fID1.clear();
+  fID2.clear();
+}
+
+//____________________________________________________________________
+void AliCorrelationKernel::Particles::Add(Double_t eta, Double_t phi, Double_t pt, Double_t weight, Int_t step, Int_t id, Int_t id1, Int_t id2)
+{
+  fEta.push_back(eta);
+  fPhi.push_back(phi);
+  fPt.push_back(pt);
+  fWeight.push_back(weight);
+  fStep.push_back(step);
+  fID.push_back(id);
+  fID1.push_back(id1);
+  fID2.push_back(id2);
+}
+
+//____________________________________________________________________
+AliCorrelationKernel::Config::Config() :
+  fTriggerAxes(),
+  fTriggerStep(0),
+  fTriggerWeighted(kTRUE),
+  fPairAxes(),
+  fPairStep(0),
+  fPairWeight(kWeightProduct),
+  fPhiRange(kPhiHalfPi),
+  fSelection(0)
+{
+}
+
+//____________________________________________________________________
+AliCorrelationKernel::AliCorrelationKernel() :
+  fConfig(),
+  fNThreads(1),
+  fBinnings(),
+  fBuffers()
+{
+}
+
+//____________________________________________________________________
+Double_t AliCorrelationKernel::RangePhi(Double_t dPhi, Int_t phiRange)
+{
+  // same as RangePhi, RangePhi_FMD and RangePhi2 of AliAnalysisTaskSEpPbCorrelationsYS
+
+  if (phiRange == kPhiHalfPi)
+  {
+    if (dPhi < -TMath::Pi() / 2)
+      dPhi += 2 * TMath::Pi();
+    if (dPhi > 3 * TMath::Pi() / 2)
+      dPhi -= 2 * TMath::Pi();
+    return dPhi;
+  }
+
+  dPhi = TMath::ATan2(TMath::Sin(dPhi), TMath::Cos(dPhi));
+  if (phiRange == kPhiAtan2HalfPi)
+  {
+    if (dPhi < (-0.5 * TMath::Pi() - 0.0001))
+      dPhi += 2 * TMath::Pi();
+  }
+  else if (dPhi < -1.178097)
+    dPhi += 2 * TMath::Pi();
+  return dPhi;
+}
+
+//____________________________________________________________________
+Int_t AliCorrelationKernel::Axis::FindBin(Double_t x) const
+{
+  if (x < fMin)
+    return 0;
+  if (!(x < fMax))
+    return fNbins + 1;
+  if (fEdges.empty())
+    return 1 + Int_t(fNbins * (x - fMin) / (fMax - fMin));
+  return std::upper_bound(fEdges.begin(), fEdges.end(), x) - fEdges.begin();
+}
+
+//____________________________________________________________________
+void AliCorrelationKernel::Buffer::Clear()
+{
+  for (UInt_t i=0; i<fBins.size(); i++)
+  {
+    fBins[i].clear();
+    fWeights[i].clear();
+  }
+}
+
+//____________________________________________________________________
+void AliCorrelationKernel::Buffer::Add(Int_t step, const Int_t* bins, Int_t nBins, Double_t weight)
+{
+  if (step >= (Int_t) fBins.size())
+  {
+    fBins.resize(step+1);
+    fWeights.resize(step+1);
+  }
+  fBins[step].insert(fBins[step].end(), bins, bins + nBins);
+  fWeights[step].push_back(weight);
+}
+
+//____________________________________________________________________
+const AliCorrelationKernel::Binning* AliCorrelationKernel::GetBinning(AliTHnBase* hist, const std::vector<Int_t>& axes)
+{
+  // axes of the container, cached per container
+
+  for (UInt_t i=0; i<fBinnings.size(); i++)
+    if (fBinnings[i].fHist == hist)
+      return (fBinnings[i].fAxes.empty()) ? 0 : &fBinnings[i];
+
+  Binning binning;
+  binning.fHist = hist;
+  if (hist->GetNVar() != (Int_t) axes.size())
+    AliErrorClass(Form("%s has %d axes, %d variables configured: not filled", hist->GetName(), hist->GetNVar(), (Int_t) axes.size()));
+  else
+  {
+    for (Int_t i=0; i<hist->GetNVar(); i++)
+    {
+      const TAxis* axis = hist->GetAxis(i, 0);
+      Axis a;
+      a.fNbins = axis->GetNbins();
+      a.fMin = axis->GetXmin();
+      a.fMax = axis->GetXmax();
+      if (axis->GetXbins()->GetSize() > 0)
+        a.fEdges.assign(axis->GetXbins()->GetArray(), axis->GetXbins()->GetArray() + axis->GetXbins()->GetSize());
+      binning.fAxes.push_back(a);
+    }
+  }
+  fBinnings.push_back(binning);
+
+  return (fBinnings.back().fAxes.empty()) ? 0 : &fBinnings.back();
+}
+
+//____________________________________________________________________
+void AliCorrelationKernel::Triggers(const Particles& triggers, const Binning* binning, const Double_t* eventVars, Buffer& out) const
+{
+  const std::vector<Int_t>& axes = fConfig.fTriggerAxes;
+  const Int_t nAxes = axes.size();
+  std::vector<Int_t> row(nAxes);
+
+  for (Int_t i=0; i<triggers.Size(); i++)
+  {
+    Int_t step = (fConfig.fTriggerStep >= 0) ? fConfig.fTriggerStep : triggers.fStep[i];
+    if (step < 0)
+      continue;
+
+    Bool_t inRange = kTRUE;
+    for (Int_t ax=0; ax<nAxes && inRange; ax++)
+    {
+      Double_t value = 0;
+      switch (axes[ax])
+      {
+        case kTriggerPt:  value = triggers.fPt[i]; break;
+        case kTriggerEta: value = triggers.fEta[i]; break;
+        case kTriggerPhi: value = triggers.fPhi[i]; break;
+        default:
+          if (axes[ax] < kEventVar)
+            inRange = kFALSE;
+          else
+            value = eventVars[axes[ax] - kEventVar];
+      }
+      row[ax] = binning->fAxes[ax].FindBin(value);
+      if (row[ax] < 1 || row[ax] > binning->fAxes[ax].fNbins)
+        inRange = kFALSE;
+    }
+    if (!inRange)
+      continue;
+
+    out.Add(step, &row[0], nAxes, (fConfig.fTriggerWeighted) ? triggers.fWeight[i] : 1.);
+  }
+}
+
+//____________________________________________________________________
+void AliCorrelationKernel::Pairs(const Particles& triggers, const Particles& assocs, const Binning* binning, const Double_t* eventVars, Double_t pairScale, Buffer& out) const
+{
+  // event, trigger and associated particle bins once, delta eta and delta phi per pair
+  // pairs with a bin outside of the axis range are skipped as in AliTHn::Fill
+
+  const std::vector<Int_t>& axes = fConfig.fPairAxes;
+  const std::vector<Axis>& histAxes = binning->fAxes;
+  const Int_t nAxes = axes.size();
+  const Int_t nAssoc = assocs.Size();
+  std::vector<Int_t> row(nAxes, 0);
+
+  for (Int_t ax=0; ax<nAxes; ax++)
+  {
+    if (axes[ax] < kEventVar)
+      continue;
+    row[ax] = histAxes[ax].FindBin(eventVars[axes[ax] - kEventVar]);
+    if (row[ax] < 1 || row[ax] > histAxes[ax].fNbins)
+      return;
+  }
+
+  std::vector<Int_t> assocAxes;
+  for (Int_t ax=0; ax<nAxes; ax++)
+    if (axes[ax] == kAssocPt || axes[ax] == kAssocEta)
+      assocAxes.push_back(ax);
+  const Int_t nAssocAxes = assocAxes.size();
+  std::vector<Int_t> assocBins(nAssoc * nAssocAxes);
+  std::vector<Bool_t> assocInRange(nAssoc, kTRUE);
+  for (Int_t j=0; j<nAssoc; j++)
+    for (Int_t k=0; k<nAssocAxes; k++)
+    {
+      Int_t ax = assocAxes[k];
+      Int_t bin = histAxes[ax].FindBin((axes[ax] == kAssocPt) ? assocs.fPt[j] : assocs.fEta[j]);
+      assocBins[j*nAssocAxes+k] = bin;
+      if (bin < 1 || bin > histAxes[ax].fNbins)
+        assocInRange[j] = kFALSE;
+    }
+
+  const UInt_t selection = fConfig.fSelection;
+
+  for (Int_t i=0; i<triggers.Size(); i++)
+  {
+    const Double_t triggerEta = triggers.fEta[i];
+    const Double_t triggerPhi = triggers.fPhi[i];
+    const Double_t triggerPt = triggers.fPt[i];
+    const Int_t triggerID = triggers.fID[i];
+
+    Bool_t inRange = kTRUE;
+    for (Int_t ax=0; ax<nAxes && inRange; ax++)
+    {
+      Double_t value = 0;
+      switch (axes[ax])
+      {
+        case kTriggerPt:  value = triggerPt; break;
+        case kTriggerEta: value = triggerEta; break;
+        case kTriggerPhi: value = triggerPhi; break;
+        default: continue;
+      }
+      row[ax] = histAxes[ax].FindBin(value);
+      if (row[ax] < 1 || row[ax] > histAxes[ax].fNbins)
+        inRange = kFALSE;
+    }
+    if (!inRange)
+      continue;
+
+    for (Int_t j=0; j<nAssoc; j++)
+    {
+      if (!assocInRange[j])
+        continue;
+      if ((selection & kPtOrdering) && triggerPt < assocs.fPt[j])
+        continue;
+      if ((selection & kExcludeSameID) && triggerID == assocs.fID[j])
+        continue;
+      if ((selection & kExcludeDaughters) && (triggerID == assocs.fID1[j] || triggerID == assocs.fID2[j]))
+        continue;
+      if ((selection & kExcludeSamePosition) && triggerPhi == assocs.fPhi[j] && triggerEta == assocs.fEta[j])
+        continue;
+
+      Int_t step = (fConfig.fPairStep >= 0) ? fConfig.fPairStep : assocs.fStep[j];
+      if (step < 0)
+        continue;
+
+      for (Int_t k=0; k<nAssocAxes; k++)
+        row[assocAxes[k]] = assocBins[j*nAssocAxes+k];
+
+      for (Int_t ax=0; ax<nAxes && inRange; ax++)
+      {
+        if (axes[ax] == kDEta)
+          row[ax] = histAxes[ax].FindBin(triggerEta - assocs.fEta[j]);
+        else if (axes[ax] == kDPhi)
+          row[ax] = histAxes[ax].FindBin(RangePhi(triggerPhi - assocs.fPhi[j], fConfig.fPhiRange));
+        else
+          continue;
+        if (row[ax] < 1 || row[ax] > histAxes[ax].fNbins)
+          inRange = kFALSE;
+      }
+      if (!inRange)
+      {
+        inRange = kTRUE;
+        continue;
+      }
+
+      Double_t weight = pairScale;
+      if (fConfig.fPairWeight == kWeightAssoc)
+        weight = assocs.fWeight[j] * pairScale;
+      else if (fConfig.fPairWeight == kWeightProduct)
+        weight = triggers.fWeight[i] * assocs.fWeight[j] * pairScale;
+
+      out.Add(step, &row[0], nAxes, weight);
+    }
+  }
+}
+
+//____________________________________________________________________
+void AliCorrelationKernel::Flush(Buffer& buffer, AliTHnBase* hist) const
+{
+  for (UInt_t step=0; step<buffer.fBins.size(); step++)
+  {
+    if (buffer.fWeights[step].empty())
+      continue;
+    if ((Int_t) step >= hist->GetNStep())
+    {
+      AliErrorClass(Form("%s: step %d does not exist", hist->GetName(), step));
+      continue;
+    }
+    hist->FillBins(buffer.fWeights[step].size(), &buffer.fBins[step][0], step, &buffer.fWeights[step][0]);
+  }
+}
+
+//____________________________________________________________________
+void AliCorrelationKernel::Fill(const Particles& triggers, const Particles& assocs, AliTHnBase* triggerHist, AliTHnBase* pairHist, const Double_t* eventVars, Double_t pairScale)
+{
+  std::vector<const Particles*> pool(1, &assocs);
+
+  // the same event is one pool event whose triggers are filled once
+  const Int_t nThreads = fNThreads;
+  fNThreads = 1;
+  FillMixed(triggers, pool, triggerHist, pairHist, eventVars, pairScale);
+  fNThreads = nThreads;
+}
+
+//____________________________________________________________________
+void AliCorrelationKernel::FillMixed(const Particles& triggers, const std::vector<const Particles*>& pool, AliTHnBase* triggerHist, AliTHnBase* pairHist, const Double_t* eventVars, Double_t pairScale)
+{
+  const Int_t nEvents = pool.size();
+  if (nEvents == 0 || triggers.Size() == 0)
+    return;
+
+  // the trigger fills are the same for all pool events
+  const Binning* triggerBinning = (triggerHist && !fConfig.fTriggerAxes.empty()) ? GetBinning(triggerHist, fConfig.fTriggerAxes) : 0;
+  if (triggerBinning)
+  {
+    Buffer triggerBuffer;
+    Triggers(triggers, triggerBinning, eventVars, triggerBuffer);
+    for (Int_t iEvent=0; iEvent<nEvents; iEvent++)
+      Flush(triggerBuffer, triggerHist);
+  }
+
+  const Binning* pairBinning = (pairHist && !fConfig.fPairAxes.empty()) ? GetBinning(pairHist, fConfig.fPairAxes) : 0;
+  if (!pairBinning)
+    return;
+
+  const Int_t nThreads = TMath::Min(fNThreads, nEvents);
+  if ((Int_t) fBuffers.size() < nThreads)
+    fBuffers.resize(nThreads);
+
+  // rounds of nThreads pool events to bound the size of the buffers
+  for (Int_t first=0; first<nEvents; first+=nThreads)
+  {
+    const Int_t nRound = TMath::Min(nThreads, nEvents - first);
+
+    if (nRound == 1)
+    {
+      fBuffers[0].Clear();
+      Pairs(triggers, *pool[first], pairBinning, eventVars, pairScale, fBuffers[0]);
+    }
+    else
+    {
+      std::vector<std::thread> workers;
+      for (Int_t t=0; t<nRound; t++)
+      {
+        fBuffers[t].Clear();
+        workers.push_back(std::thread(&AliCorrelationKernel::Pairs, this, std::cref(triggers), std::cref(*pool[first+t]), pairBinning, eventVars, pairScale, std::ref(fBuffers[t])));
+      }
+      for (UInt_t t=0; t<workers.size(); t++)
+        workers[t].join();
+    }
+
+    for (Int_t t=0; t<nRound; t++)
+      Flush(fBuffers[t], pairHist);
+  }
+}
@@ -0,0 +1,117 @@
+#ifndef AliCorrelationKernel_H
+#define AliCorrelationKernel_H
+
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+// two-particle correlation kernel on particle arrays
+// trigger and pair variables are mapped to the axes of AliTHn containers and filled as bin indices
+// mixed events of a pool are processed in parallel, the fills are merged in pool order
+
+#include "Rtypes.h"
+#include <vector>
+
+class AliTHnBase;
+
+class AliCorrelationKernel
+{
+ public:
+  // variables of the container axes, kEventVar+i is the i-th value of the event array
+  enum EVariable { kDEta = 0, kDPhi, kTriggerPt, kTriggerEta, kTriggerPhi, kAssocPt, kAssocEta, kEventVar };
+  // range of delta phi: [-pi/2, 3pi/2) by one shift, atan2 shifted below -pi/2, atan2 shifted below -3pi/8 (V0A-V0C)
+  enum EPhiRange { kPhiHalfPi = 0, kPhiAtan2HalfPi, kPhiAtan2V0 };
+  enum EWeight { kWeightUnit = 0, kWeightAssoc, kWeightProduct };
+  // pairs which are skipped
+  enum ESelection { kPtOrdering = 1<<0,         // associated pt above trigger pt
+                    kExcludeSameID = 1<<1,      // same id
+                    kExcludeDaughters = 1<<2,   // trigger id is one of the daughter ids of the associated particle
+                    kExcludeSamePosition = 1<<3 // same eta and phi
+                  };
+
+  struct Particles
+  {
+    void Clear();
+    void Add(Double_t eta, Double_t phi, Double_t pt, Double_t weight, Int_t step = 0, Int_t id = -1, Int_t id1 = -1, Int_t id2 = -1);
+    Int_t Size() const { return fEta.size(); }
+
+    std::vector<Double_t> fEta;
+    std::vector<Double_t> fPhi;
+    std::vector<Double_t> fPt;
+    std::vector<Double_t> fWeight;
+    std::vector<Int_t> fStep;   // e.g. species of the candidate
+    std::vector<Int_t> fID;
+    std::vector<Int_t> fID1;    // daughters
+    std::vector<Int_t> fID2;
+  };
+
+  struct Config
+  {
+    Config();
+
+    std::vector<Int_t> fTriggerAxes;  // EVariable per axis of the trigger container, trigger variables and event values only; empty: not filled
+    Int_t fTriggerStep;               // step of the trigger container, < 0: step of the trigger particle
+    Bool_t fTriggerWeighted;          // weight of the trigger particle, otherwise 1
+    std::vector<Int_t> fPairAxes;     // EVariable per axis of the pair container; empty: not filled
+    Int_t fPairStep;                  // step of the pair container, < 0: step of the associated particle, negative steps are skipped
+    Int_t fPairWeight;                // EWeight
+    Int_t fPhiRange;                  // EPhiRange for kDPhi
+    UInt_t fSelection;                // ESelection bits
+  };
+
+  AliCorrelationKernel();
+  virtual ~AliCorrelationKernel() { }
+
+  void SetConfig(const Config& config) { fConfig = config; fBinnings.clear(); }
+  const Config& GetConfig() const { return fConfig; }
+  void SetNThreads(Int_t nThreads) { fNThreads = (nThreads > 0) ? nThreads : 1; }
+  Int_t GetNThreads() const { return fNThreads; }
+
+  // same event; pair weights are multiplied by pairScale
+  void Fill(const Particles& triggers, const Particles& assocs, AliTHnBase* triggerHist, AliTHnBase* pairHist, const Double_t* eventVars, Double_t pairScale = 1.);
+  // mixed events; triggers and pairs are filled once per pool event
+  void FillMixed(const Particles& triggers, const std::vector<const Particles*>& pool, AliTHnBase* triggerHist, AliTHnBase* pairHist, const Double_t* eventVars, Double_t pairScale);
+
+  static Double_t RangePhi(Double_t dPhi, Int_t phiRange);
+
+ private:
+  AliCorrelationKernel(const AliCorrelationKernel&);
+  AliCorrelationKernel& operator=(const AliCorrelationKernel&);
+
+  struct Axis
+  {
+    Int_t FindBin(Double_t x) const;  // as TAxis::FindBin
+
+    Int_t fNbins;
+    Double_t fMin;
+    Double_t fMax;
+    std::vector<Double_t> fEdges;     // empty for fixed bins
+  };
+
+  struct Binning
+  {
+    const AliTHnBase* fHist;
+    std::vector<Axis> fAxes;
+  };
+
+  // bin indices and weights per step
+  struct Buffer
+  {
+    void Clear();
+    void Add(Int_t step, const Int_t* bins, Int_t nBins, Double_t weight);
+
+    std::vector<std::vector<Int_t> > fBins;
+    std::vector<std::vector<Double_t> > fWeights;
+  };
+
+  const Binning* GetBinning(AliTHnBase* hist, const std::vector<Int_t>& axes);
+  void Triggers(const Particles& triggers, const Binning* binning, const Double_t* eventVars, Buffer& out) const;
+  void Pairs(const Particles& triggers, const Particles& assocs, const Binning* binning, const Double_t* eventVars, Double_t pairScale, Buffer& out) const;
+  void Flush(Buffer& buffer, AliTHnBase* hist) const;
+
+  Config fConfig;
+  Int_t fNThreads;                     // threads over the events of a pool
+  std::vector<Binning> fBinnings;      // per container
+  std::vector<Buffer> fBuffers;        // per thread
+};
+
+#endif
@@ -38,6 +38,11 @@
 #include "TH2F.h"
 #include "TMath.h"
 
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <vector>
+
 ClassImp(AliTwoPlusOneContainer)
 
 AliTwoPlusOneContainer::AliTwoPlusOneContainer(const char* name, const char* uEHist_name, const char* binning, Double_t alpha) : 
@@ -58,7 +63,8 @@ AliTwoPlusOneContainer::AliTwoPlusOneContainer(const char* name, const char* uEH
   fUseBackgroundSameOneSide(0),
   fUseSmallerPtAssoc(0),
   fEfficiencyCorrection(0),
-  fMergeCount(0)
+  fMergeCount(0),
+  fNThreads(1)
 {
   // Constructor
   //
@@ -115,7 +121,8 @@ AliTwoPlusOneContainer::AliTwoPlusOneContainer(const AliTwoPlusOneContainer &c)
   fUseBackgroundSameOneSide(0),
   fUseSmallerPtAssoc(0),
   fEfficiencyCorrection(0),
-  fMergeCount(0)
+  fMergeCount(0),
+  fNThreads(1)
 {
   //
   // AliTwoPlusOneContainer copy constructor
@@ -130,6 +137,7 @@ AliTwoPlusOneContainer::AliTwoPlusOneContainer(const AliTwoPlusOneContainer &c)
   fPtAssocMax = ((AliTwoPlusOneContainer &) c).getPtAssocMax();
   fAlpha = ((AliTwoPlusOneContainer &) c).fAlpha;
   fMergeCount = ((AliTwoPlusOneContainer &) c).fMergeCount;
+  fNThreads = ((AliTwoPlusOneContainer &) c).fNThreads;
 }
 
 //____________________________________________________________________
@@ -219,6 +227,78 @@ void AliTwoPlusOneContainer::FillParticleDist(Double_t centrality, Float_t zVtx,
 }
 
 
+namespace {
+  // particle list with the values used in the loops, read once per call
+  struct TPOParticles {
+    std::vector<AliVParticle*> fPart;
+    std::vector<Double_t> fPt;
+    std::vector<Double_t> fEta;
+    std::vector<Double_t> fPhi;
+    std::vector<Double_t> fEff;
+
+    // particles with ptMin <= pt <= ptMax, sorted by increasing pt if sortPt (otherwise in the order of the list)
+    void Set(TObjArray* list, Double_t ptMin, Double_t ptMax, Bool_t sortPt)
+    {
+      Int_t n = list->GetEntriesFast();
+      std::vector<std::pair<Double_t, Int_t> > sel;
+      sel.reserve(n);
+      for (Int_t i=0; i<n; i++) {
+        Double_t pt = ((AliVParticle*) list->UncheckedAt(i))->Pt();
+        if (pt>=ptMin && pt<=ptMax)
+          sel.push_back(std::make_pair(pt, i));
+      }
+      if (sortPt)
+        std::stable_sort(sel.begin(), sel.end(), [](const std::pair<Double_t, Int_t>& a, const std::pair<Double_t, Int_t>& b) { return a.first < b.first; });
+      fPart.resize(sel.size()); fPt.resize(sel.size()); fEta.resize(sel.size()); fPhi.resize(sel.size());
+      fEff.assign(sel.size(), 1.);
+      for (UInt_t i=0; i<sel.size(); i++) {
+        fPart[i] = (AliVParticle*) list->UncheckedAt(sel[i].second);
+        fPt[i] = sel[i].first;
+        fEta[i] = fPart[i]->Eta();
+        fPhi[i] = fPart[i]->Phi();
+      }
+    }
+    Int_t Size() const { return fPart.size(); }
+  };
+
+  // fills produced for a chunk of trigger 1 particles, applied to the histograms at the end of the event
+  struct TPOFills {
+    std::vector<Double_t> fEventVars[2];   // 4 values per fill, near side (step) and away side (step+1)
+    std::vector<Double_t> fEventWeights[2];
+    std::vector<Double_t> fTrackVars[2];   // 7 values per fill
+    std::vector<Double_t> fTrackWeights[2];
+    std::vector<Double_t> fTriggerPairs;   // pt 1, pt 2 of the used trigger combinations
+    Int_t fFoundTriggers;
+
+    void Clear()
+    {
+      for (Int_t i=0; i<2; i++) {
+        fEventVars[i].clear(); fEventWeights[i].clear();
+        fTrackVars[i].clear(); fTrackWeights[i].clear();
+      }
+      fTriggerPairs.clear();
+      fFoundTriggers = 0;
+    }
+  };
+
+  // brings delta phi in the range -pi/2 to 3pi/2
+  inline Double_t TPODeltaPhi(Double_t dphi)
+  {
+    if(dphi>1.5*TMath::Pi()) dphi -= TMath::TwoPi();
+    else if(dphi<-0.5*TMath::Pi()) dphi += TMath::TwoPi();
+    return dphi;
+  }
+
+  // second trigger particle accepted for a trigger 1
+  struct TPOTrigger2 {
+    AliVParticle* fPart;
+    Double_t fPt;
+    Double_t fEta;
+    Double_t fPhi;
+    Double_t fEff;
+  };
+}
+
 //____________________________________________________________________
 Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx, AliTwoPlusOneContainer::PlotKind step, TObjArray* triggerNear, TObjArray* triggerAway, TObjArray* assocNear, TObjArray* assocAway, Double_t weight, Bool_t is1plus1, Bool_t isBackgroundSame, Bool_t applyEfficiency)
 {
@@ -228,334 +308,279 @@ Int_t AliTwoPlusOneContainer::FillCorrelations(Double_t centrality, Float_t zVtx
   //several booleans in this container change the behaviour of the container:
   //fUseLeadingPt: decides if a particle is only accepted as trigger particle if it has the highest pT within an circle with the radius of alpha
   //fUseAllT1: in case multiple trigger 2 are accepted, the near side yield is filled for each found away side yield
+  //the values of the particles are read once per call; the associated particles are sorted by pT, the trigger 1 candidates are
+  //split in chunks over fNThreads threads and the fills of the chunks are applied in the order of the trigger 1 particles
   AliCFContainer* track_hist = fTwoPlusOne->GetTrackHist(AliUEHist::kToward);
   AliCFContainer* event_hist = fTwoPlusOne->GetEventHist();
   AliUEHist::CFStep stepUEHist = static_cast<AliUEHist::CFStep>(step);
 
   //in case of the computation of the background in the same event there are two possible positions: delta phi = +/- pi/2
   //both positions are used so the results could only be weighted with 0.5*weight
+  Double_t alpha = fAlpha;
   if(isBackgroundSame && !fUseBackgroundSameOneSide)
-     fAlpha*= 0.5;
-
-  //return variable: found triggers
-  Int_t found_triggers = 0;
-
-  //efficiency value which is multiplied with the weight
-  //this value is always adjusted to the correct value just before the usage
-  Double_t efficiency = 1.;
+     alpha *= 0.5;
 
-  for (Int_t i=0; i<triggerNear->GetEntriesFast(); i++){
-    AliVParticle* part = (AliVParticle*) triggerNear->UncheckedAt(i);
-    
-    Double_t part_pt = part->Pt();
-
-    if(part_pt<fTriggerPt1Min || part_pt>fTriggerPt1Max)
-      continue;
-
-    Double_t part_eta = part->Eta();
-    Double_t part_phi = part->Phi();
-
-    //search for second trigger particle
-    //entries is the number of particles in the event, so there can only be less particles within the trigger 2 conditions
-    Int_t ind_found = 0;
-    Int_t ind_max_found_pt = -1;
-    Int_t triggerAway_entries = triggerAway->GetEntriesFast();
-    AliVParticle* found_particle[triggerAway_entries];
-    Double_t found_particle_efficiency[triggerAway_entries];
-
-    Bool_t do_not_use_T1 = false;
-
-    //in case only the leading pt of a jet should be used, check every particle on the trigger near side if it's closer than alpha and if it has a higher pt than trigger 1
-    if(fUseLeadingPt){
-      for (Int_t i2=0; i2<triggerNear->GetEntriesFast(); i2++){
-	if(i==i2)
-	  continue;
-
-	AliVParticle* part_i2 = (AliVParticle*) triggerNear->UncheckedAt(i2);
-
-	if(part_i2->Pt()<=part_pt)
-	  continue;
-    
-	Double_t dphi_check = part_phi-part_i2->Phi(); 
-	if(dphi_check>1.5*TMath::Pi()) dphi_check -= TMath::TwoPi();
-	else if(dphi_check<-0.5*TMath::Pi()) dphi_check += TMath::TwoPi();
+  //trigger 1 candidates in the order of the list, all near side triggers sorted by pT for the leading particle check
+  TPOParticles trig1, nearAll, trig2, assocN, assocA;
+  trig1.Set(triggerNear, fTriggerPt1Min, fTriggerPt1Max, kFALSE);
+  if(trig1.Size()==0)
+    return 0;
+  if(fUseLeadingPt)
+    nearAll.Set(triggerNear, -1e30, 1e30, kTRUE);
+  if(!is1plus1)
+    trig2.Set(triggerAway, fTriggerPt2Min, 1e30, kFALSE);
+  assocN.Set(assocNear, fPtAssocMin, fPtAssocMax, kTRUE);
+  if(!is1plus1)
+    assocA.Set(assocAway, fPtAssocMin, fPtAssocMax, kTRUE);
+
+  //the efficiencies are evaluated once per particle and call
+  if(applyEfficiency){
+    TPOParticles* lists[4] = {&trig1, &trig2, &assocN, &assocA};
+    for (Int_t l=0; l<4; l++)
+      for (Int_t i=0; i<lists[l]->Size(); i++)
+	lists[l]->fEff[i] = getEfficiency(lists[l]->fPt[i], lists[l]->fEta[i], centrality, zVtx);
+  }
 
-	if(TMath::Abs(dphi_check)<fAlpha){
-	  do_not_use_T1 = true;
-	  break;
+  const Double_t pt2Center = (fTriggerPt2Max+fTriggerPt2Min)/2;
+  const Bool_t fillTriggerPairs = (step==AliTwoPlusOneContainer::kSameNS || step==AliTwoPlusOneContainer::kMixedNS);
+
+  auto processTriggers = [&](Int_t first, Int_t last, TPOFills& out) {
+    std::vector<TPOTrigger2> found;
+    found.reserve(trig2.Size()+1);
+
+    for (Int_t i=first; i<last; i++){
+      AliVParticle* part = trig1.fPart[i];
+      Double_t part_pt = trig1.fPt[i];
+      Double_t part_eta = trig1.fEta[i];
+      Double_t part_phi = trig1.fPhi[i];
+
+      //in case only the leading pt of a jet should be used, check every particle on the trigger near side if it's closer than alpha and if it has a higher pt than trigger 1
+      //(nearAll is sorted by increasing pt, only the particles at the end have a higher pt)
+      Bool_t do_not_use_T1 = kFALSE;
+      if(fUseLeadingPt){
+	for (Int_t i2=nearAll.Size()-1; i2>=0 && nearAll.fPt[i2]>part_pt; i2--){
+	  if(TMath::Abs(TPODeltaPhi(part_phi-nearAll.fPhi[i2]))<alpha){
+	    do_not_use_T1 = kTRUE;
+	    break;
+	  }
 	}
       }
-    }
 
-    //if there is a particle with higher energy than T1 closer than alpha to T1, do not use this T1
-     if(do_not_use_T1)
-      continue;
+      //if there is a particle with higher energy than T1 closer than alpha to T1, do not use this T1
+      if(do_not_use_T1)
+	continue;
 
-    //have to fake the away side triggers for the 1+1 analysis
-    if(is1plus1){
-      found_particle[ind_found] = part;//in 1plus1 use first trigger particle also as pseudo second trigger particle
-      found_particle_efficiency[ind_found] = 1.0;
-      ind_max_found_pt = ind_found;
-      ind_found = 1;
-    }else{
-      //normal 2+1 analysis
-      for (Int_t j=0; j<triggerAway_entries; j++){
-	AliVParticle* part2 = (AliVParticle*) triggerAway->UncheckedAt(j);
-
-	Double_t part2_pt = part2->Pt();
-	//check if pT of trigger 2 has enough energy to be a trigger
-	//maximum energy is checked later after checking this particle may have to much energy for trigger 1 or 2
-	if(part2_pt<fTriggerPt2Min)
-	  continue;
+      found.clear();
+      Int_t ind_max_found_pt = -1;
+      //have to fake the away side triggers for the 1+1 analysis
+      if(is1plus1){
+	TPOTrigger2 t2 = {part, part_pt, part_eta, part_phi, 1.0};//in 1plus1 use first trigger particle also as pseudo second trigger particle
+	found.push_back(t2);
+	ind_max_found_pt = 0;
+      }else{
+	//normal 2+1 analysis, trig2 contains only particles above the minimum pT of trigger 2
+	for (Int_t j=0; j<trig2.Size(); j++){
+	  // don't use the same particle (is in any case impossible because the Delta phi angle will be 0)
+	  if(part==trig2.fPart[j])
+	    continue;
 
-	// don't use the same particle (is in any case impossible because the Delta phi angle will be 0)
-	if(part==part2){
-	  continue;
-	}
-	
-	Double_t dphi_triggers = part_phi-part2->Phi();
-	if(dphi_triggers>1.5*TMath::Pi()) dphi_triggers -= TMath::TwoPi();
-	else if(dphi_triggers<-0.5*TMath::Pi()) dphi_triggers += TMath::TwoPi();
-      
-	//if 2+1 analysis check if trigger particles have a delta phi = pi +/- alpha
-	if(!isBackgroundSame)
-	  dphi_triggers -= TMath::Pi();
-	else if(isBackgroundSame){
-	  //shift defined area of delta phi
-	  if(dphi_triggers>TMath::Pi()) dphi_triggers -= TMath::TwoPi();
-	
-	  if(!fUseBackgroundSameOneSide){
-	    //look at delta phi = +/- pi/2
-	    if(dphi_triggers<0)
-	      dphi_triggers += 0.5*TMath::Pi();
-	    else if(dphi_triggers>0)
+	  Double_t part2_pt = trig2.fPt[j];
+	  Double_t dphi_triggers = TPODeltaPhi(part_phi-trig2.fPhi[j]);
+
+	  //if 2+1 analysis check if trigger particles have a delta phi = pi +/- alpha
+	  if(!isBackgroundSame)
+	    dphi_triggers -= TMath::Pi();
+	  else{
+	    //shift defined area of delta phi
+	    if(dphi_triggers>TMath::Pi()) dphi_triggers -= TMath::TwoPi();
+
+	    if(!fUseBackgroundSameOneSide){
+	      //look at delta phi = +/- pi/2
+	      if(dphi_triggers<0)
+		dphi_triggers += 0.5*TMath::Pi();
+	      else if(dphi_triggers>0)
+		dphi_triggers -= 0.5*TMath::Pi();
+	    }else{
 	      dphi_triggers -= 0.5*TMath::Pi();
-	  }else if(fUseBackgroundSameOneSide){
-	    dphi_triggers -= 0.5*TMath::Pi();
+	    }
 	  }
-	}
-	if(TMath::Abs(dphi_triggers)>fAlpha)
-	  continue;
-
-	//check if pT of trigger 2 is too high
-	if(part2_pt>fTriggerPt2Max || part2_pt>=part_pt){
-	  //pt of trigger 2 needs to be smaller than the pt of trigger 1 (to have an ordering if both pt are close to each other)
-	  if(fUseLeadingPt){
-	    do_not_use_T1 = true;
-	    break;
-	  }else
+	  if(TMath::Abs(dphi_triggers)>alpha)
 	    continue;
-	}
 
-	found_particle[ind_found] = part2;
-	if(applyEfficiency)
-	  found_particle_efficiency[ind_found] = getEfficiency(part2_pt, part2->Eta(), centrality, zVtx);
-	if(ind_max_found_pt==-1 || part2_pt>found_particle[ind_max_found_pt]->Pt()) ind_max_found_pt = ind_found;
-	ind_found++;
-      }//end loop to search for the second trigger particle
-    }//end if for 1+1 
+	  //check if pT of trigger 2 is too high
+	  if(part2_pt>fTriggerPt2Max || part2_pt>=part_pt){
+	    //pt of trigger 2 needs to be smaller than the pt of trigger 1 (to have an ordering if both pt are close to each other)
+	    if(fUseLeadingPt){
+	      do_not_use_T1 = kTRUE;
+	      break;
+	    }else
+	      continue;
+	  }
 
-    //if there is a particle with higher energy than T1 or max(T2) within Delta phi = pi +/- alpha to T1, do not use this T1
-    if(do_not_use_T1)
-      continue;
+	  TPOTrigger2 t2 = {trig2.fPart[j], part2_pt, trig2.fEta[j], trig2.fPhi[j], trig2.fEff[j]};
+	  if(ind_max_found_pt==-1 || part2_pt>found[ind_max_found_pt].fPt) ind_max_found_pt = found.size();
+	  found.push_back(t2);
+	}//end loop to search for the second trigger particle
+      }//end if for 1+1
 
-    //if no second trigger particle was found continue to search for the next first trigger particle
-    if(ind_found==0)
-      continue;
-    else{
-      found_triggers += ind_found;
-    }
+      //if there is a particle with higher energy than T1 or max(T2) within Delta phi = pi +/- alpha to T1, do not use this T1
+      //if no second trigger particle was found continue to search for the next first trigger particle
+      if(do_not_use_T1 || found.empty())
+	continue;
+      out.fFoundTriggers += found.size();
 
-    //use only the highest energetic particle on the away side, if there is only 1 away side trigger this is already the case
-    if(fUseLeadingPt && ind_found>1){
-      found_particle[0] = found_particle[ind_max_found_pt];
-      found_particle_efficiency[0] = found_particle_efficiency[ind_max_found_pt];
-      ind_found=1;
-      ind_max_found_pt = 0;
-    }
+      //use only the highest energetic particle on the away side, if there is only 1 away side trigger this is already the case
+      if(fUseLeadingPt && found.size()>1){
+	found[0] = found[ind_max_found_pt];
+	found.resize(1);
+	ind_max_found_pt = 0;
+      }
+      const TPOTrigger2& maxT2 = found[ind_max_found_pt];
+      const Int_t ind_found = found.size();
 
-    //define efficiency for the found trigger 1 particle
-    Double_t part_efficiency = 1.0;
-    if(applyEfficiency)
-      part_efficiency = getEfficiency(part_pt, part_eta, centrality, zVtx);
-  
-    //the energy of the second trigger particle is set for the near side to the maximum energy of all trigger 2 particles on the away side
-    // this leads to the fact that the number of accepted trigger combinations can be artificial smaller than the real number if there is a cut on the pT 2 energy from the top; cutting away the smallest energy of pT 2 is still save; this is the reason why it is not allowed to use a cut on the top pt of trigger particle 2
-    //fill trigger particles
-    if(ind_found>0){
-      Double_t vars[4];
+      Double_t part_efficiency = trig1.fEff[i];
+
+      //the energy of the second trigger particle is set for the near side to the maximum energy of all trigger 2 particles on the away side
+      // this leads to the fact that the number of accepted trigger combinations can be artificial smaller than the real number if there is a cut on the pT 2 energy from the top; cutting away the smallest energy of pT 2 is still save; this is the reason why it is not allowed to use a cut on the top pt of trigger particle 2
+      //fill trigger particles
+      Double_t vars[7];
       vars[0] = part_pt;
       vars[1] = centrality;
       vars[2] = zVtx;
-      vars[3] = found_particle[ind_max_found_pt]->Pt();
-      if(is1plus1)
-	vars[3] = (fTriggerPt2Max+fTriggerPt2Min)/2;
-
-      if(is1plus1){
-	if(applyEfficiency)
-	  efficiency = part_efficiency;
-	event_hist->Fill(vars, stepUEHist, weight*efficiency);//near side (one times)
-
-      }else if(!is1plus1){
-	if(!fUseAllT1){
-	  if(applyEfficiency)
-	    efficiency = part_efficiency*found_particle_efficiency[ind_max_found_pt];
-	  event_hist->Fill(vars, stepUEHist, weight*efficiency);//near side (one times)
-	}
-
-	for(Int_t k=0; k< ind_found; k++){
-	  vars[3] = found_particle[k]->Pt();
-	  if(applyEfficiency)
-	    efficiency = part_efficiency*found_particle_efficiency[k];
-
-	  event_hist->Fill(vars, stepUEHist+1, weight*efficiency);//away side
-
-	  if(fUseAllT1)
-	    event_hist->Fill(vars, stepUEHist, weight*efficiency);//near side (for every away side)
-	    
-	}
+      vars[3] = (is1plus1) ? pt2Center : maxT2.fPt;
+      if(is1plus1 || !fUseAllT1){
+	out.fEventVars[0].insert(out.fEventVars[0].end(), vars, vars+4);//near side (one times)
+	out.fEventWeights[0].push_back(weight*part_efficiency*maxT2.fEff);
       }
-
-      //fill fTriggerPt only once, choosed kSameNS
-      if(step==AliTwoPlusOneContainer::kSameNS)
-	for(Int_t k=0; k< ind_found; k++)
-	  fTriggerPt->Fill(part_pt, found_particle[k]->Pt());
-
-      //fill asymmetry only for kSameNS and kMixedNS
-      if(step==AliTwoPlusOneContainer::kSameNS||step==AliTwoPlusOneContainer::kMixedNS){
-	for(Int_t k=0; k< ind_found; k++){
-	  Float_t asymmetry = (part_pt-found_particle[k]->Pt())/(part_pt+found_particle[k]->Pt());
-	  if(step==AliTwoPlusOneContainer::kSameNS){
-	    fAsymmetry->Fill(asymmetry);
-	  }else{
-	    fAsymmetryMixed->Fill(asymmetry);
+      if(!is1plus1){
+	for(Int_t k=0; k<ind_found; k++){
+	  vars[3] = found[k].fPt;
+	  Double_t w = weight*part_efficiency*found[k].fEff;
+	  out.fEventVars[1].insert(out.fEventVars[1].end(), vars, vars+4);//away side
+	  out.fEventWeights[1].push_back(w);
+	  if(fUseAllT1){
+	    out.fEventVars[0].insert(out.fEventVars[0].end(), vars, vars+4);//near side (for every away side)
+	    out.fEventWeights[0].push_back(w);
 	  }
 	}
       }
-    }
-    
-    //add correlated particles on the near side
-    for (Int_t k=0; k<assocNear->GetEntriesFast(); k++){
-      AliVParticle* part3 = (AliVParticle*) assocNear->UncheckedAt(k);
-
-      Double_t part3_pt = part3->Pt();
-      if(part3_pt<fPtAssocMin || part3_pt>fPtAssocMax)
-	continue;
-
-      //do not add the trigger 1 particle
-      if(part==part3)
-	continue;
-
-      //use only pT,assoc which is samller than the trigger pT
-      if(fUseSmallerPtAssoc && part3_pt>=part_pt)
-	continue;
-
-      Double_t dphi_near = part_phi-part3->Phi(); 
-      if(dphi_near>1.5*TMath::Pi()) dphi_near -= TMath::TwoPi();
-      else if(dphi_near<-0.5*TMath::Pi()) dphi_near += TMath::TwoPi();
-
-      Double_t deta_near = part_eta-part3->Eta();
-      
-      Double_t vars[7];
-      vars[0] = deta_near;
-      vars[1] = part3_pt;
-      vars[2] = part_pt;
-      vars[3] = centrality;
-      vars[4] = dphi_near;
-      vars[5] = zVtx;
-      vars[6] = found_particle[ind_max_found_pt]->Pt();
-      if(is1plus1)
-	vars[6] = (fTriggerPt2Max+fTriggerPt2Min)/2;
+      if(fillTriggerPairs)
+	for(Int_t k=0; k<ind_found; k++){
+	  out.fTriggerPairs.push_back(part_pt);
+	  out.fTriggerPairs.push_back(found[k].fPt);
+	}
 
-      Double_t part3_efficiency = 1.;
-      if(applyEfficiency)
-	part3_efficiency = getEfficiency(part3_pt, part3->Eta(), centrality, zVtx);
+      //add correlated particles on the near side, assocN is sorted by pt
+      //use only pT,assoc which is samller than the trigger pT if fUseSmallerPtAssoc
+      Int_t nNear = assocN.Size();
+      if(fUseSmallerPtAssoc)
+	nNear = std::lower_bound(assocN.fPt.begin(), assocN.fPt.end(), part_pt) - assocN.fPt.begin();
+      for (Int_t k=0; k<nNear; k++){
+	AliVParticle* part3 = assocN.fPart[k];
+	//do not add the trigger 1 particle
+	if(part==part3)
+	  continue;
 
-      if(is1plus1){
-	if(applyEfficiency)
-	  efficiency = part_efficiency*part3_efficiency;
+	vars[0] = part_eta-assocN.fEta[k];
+	vars[1] = assocN.fPt[k];
+	vars[2] = part_pt;
+	vars[3] = centrality;
+	vars[4] = TPODeltaPhi(part_phi-assocN.fPhi[k]);
+	vars[5] = zVtx;
+	Double_t w = weight*part_efficiency*assocN.fEff[k];
 
-	track_hist->Fill(vars, stepUEHist, weight*efficiency);
-      }else if(!is1plus1){
-	if(!fUseAllT1){
+	if(is1plus1){
+	  vars[6] = pt2Center;
+	  out.fTrackVars[0].insert(out.fTrackVars[0].end(), vars, vars+7);
+	  out.fTrackWeights[0].push_back(w);
+	}else if(!fUseAllT1){
 	  //do not add the trigger 2 particle with the highest pT
-	  if(found_particle[ind_max_found_pt]==part3)
+	  if(maxT2.fPart==part3)
 	    continue;
-
-	  if(applyEfficiency)
-	    efficiency = part_efficiency*found_particle_efficiency[ind_max_found_pt]*part3_efficiency;
-	  
-	  track_hist->Fill(vars, stepUEHist, weight*efficiency);
+	  vars[6] = maxT2.fPt;
+	  out.fTrackVars[0].insert(out.fTrackVars[0].end(), vars, vars+7);
+	  out.fTrackWeights[0].push_back(w*maxT2.fEff);
 	}else
-	  for(int l=0; l<ind_found; l++){
+	  for(Int_t l=0; l<ind_found; l++){
 	    //do not add the trigger 2 particle
-	    if(found_particle[l]==part3)
+	    if(found[l].fPart==part3)
 	      continue;
-	    
-	    vars[6] = found_particle[l]->Pt();
-	    if(applyEfficiency)
-	      efficiency = part_efficiency*found_particle_efficiency[l]*part3_efficiency;
-
-	    track_hist->Fill(vars, stepUEHist, weight*efficiency);//fill NS for all AS triggers
+	    vars[6] = found[l].fPt;
+	    out.fTrackVars[0].insert(out.fTrackVars[0].end(), vars, vars+7);//fill NS for all AS triggers
+	    out.fTrackWeights[0].push_back(w*found[l].fEff);
 	  }
       }
-    }
-
-    //search only for the distribution of the 2nd trigger particle
-    if(is1plus1)
-      continue;
-
-    //add correlated particles on the away side
-    for (Int_t k=0; k<assocAway->GetEntriesFast(); k++){
-      AliVParticle* part3 = (AliVParticle*) assocAway->UncheckedAt(k);
-	
-      Double_t part3_pt = part3->Pt();
-      if(part3_pt<fPtAssocMin || part3_pt>fPtAssocMax)
-	continue;
 
-      //do not add the trigger 1 particle
-      if(part==part3)
+      //search only for the distribution of the 2nd trigger particle
+      if(is1plus1)
 	continue;
 
-      Double_t part3_efficiency = 1.;
-      if(applyEfficiency)
-	part3_efficiency = getEfficiency(part3_pt, part3->Eta(), centrality, zVtx);
-
-      for(int l=0; l<ind_found; l++){
-	//do not add the trigger 2 particle
-	if(found_particle[l]==part3)
-	  continue;
-
-	//use only pT,assoc which is samller than the trigger pT
-	if(fUseSmallerPtAssoc && part3_pt>=found_particle[l]->Pt())
-	  continue;
-
-	Double_t dphi_away = found_particle[l]->Phi()-part3->Phi();
-	if(dphi_away>1.5*TMath::Pi()) dphi_away -= TMath::TwoPi();
-	else if(dphi_away<-0.5*TMath::Pi()) dphi_away += TMath::TwoPi();
-	
-	Double_t deta_away = found_particle[l]->Eta()-part3->Eta();
-      
-	Double_t vars[7];
-	vars[0] = deta_away;
-	vars[1] = part3_pt;
+      //add correlated particles on the away side, one batch per trigger combination
+      for(Int_t l=0; l<ind_found; l++){
+	const TPOTrigger2& t2 = found[l];
+	Int_t nAway = assocA.Size();
+	if(fUseSmallerPtAssoc)
+	  nAway = std::lower_bound(assocA.fPt.begin(), assocA.fPt.end(), t2.fPt) - assocA.fPt.begin();
 	vars[2] = part_pt;
 	vars[3] = centrality;
-	vars[4] = dphi_away;
 	vars[5] = zVtx;
-	vars[6] = found_particle[l]->Pt();
-
-	if(applyEfficiency)
-	  efficiency = part_efficiency*found_particle_efficiency[l]*part3_efficiency;
-
-	track_hist->Fill(vars, stepUEHist+1, weight*efficiency);//step +1 is the AS to the NS plot of step
+	vars[6] = t2.fPt;
+	Double_t w = weight*part_efficiency*t2.fEff;
+	for (Int_t k=0; k<nAway; k++){
+	  AliVParticle* part3 = assocA.fPart[k];
+	  //do not add the trigger 1 and the trigger 2 particle
+	  if(part==part3 || t2.fPart==part3)
+	    continue;
+	  vars[0] = t2.fEta-assocA.fEta[k];
+	  vars[1] = assocA.fPt[k];
+	  vars[4] = TPODeltaPhi(t2.fPhi-assocA.fPhi[k]);
+	  out.fTrackVars[1].insert(out.fTrackVars[1].end(), vars, vars+7);//step +1 is the AS to the NS plot of step
+	  out.fTrackWeights[1].push_back(w*assocA.fEff[k]);
+	}
       }
-    }
-  }//end loop to search for the first trigger particle
+    }//end loop to search for the first trigger particle
+  };
+
+  const Int_t kMinTriggersPerThread = 4;
+  Int_t nThreads = TMath::Max(1, TMath::Min(fNThreads, trig1.Size()/kMinTriggersPerThread));
+  std::vector<TPOFills> fills(nThreads);
+  for (Int_t t=0; t<nThreads; t++)
+    fills[t].Clear();
+  if(nThreads==1)
+    processTriggers(0, trig1.Size(), fills[0]);
+  else{
+    std::vector<std::thread> workers;
+    for (Int_t t=1; t<nThreads; t++)
+      workers.push_back(std::thread(processTriggers, trig1.Size()*t/nThreads, trig1.Size()*(t+1)/nThreads, std::ref(fills[t])));
+    processTriggers(0, trig1.Size()/nThreads, fills[0]);
+    for (UInt_t t=0; t<workers.size(); t++)
+      workers[t].join();
+  }
 
-  //put fAlpha back on the old value in case this is for background same
-  if(isBackgroundSame && !fUseBackgroundSameOneSide)
-     fAlpha*= 2;
+  //the histograms are filled here, chunk by chunk in the order of the trigger 1 particles
+  Int_t found_triggers = 0;
+  for (Int_t t=0; t<nThreads; t++){
+    const TPOFills& out = fills[t];
+    found_triggers += out.fFoundTriggers;
+    for (Int_t s=0; s<2; s++){
+      if(!out.fEventWeights[s].empty())
+	event_hist->FillN(&out.fEventVars[s][0], out.fEventWeights[s].size(), stepUEHist+s, &out.fEventWeights[s][0]);
+      if(!out.fTrackWeights[s].empty())
+	track_hist->FillN(&out.fTrackVars[s][0], out.fTrackWeights[s].size(), stepUEHist+s, &out.fTrackWeights[s][0]);
+    }
+    for (UInt_t k=0; k<out.fTriggerPairs.size(); k+=2){
+      Double_t pt1 = out.fTriggerPairs[k], pt2 = out.fTriggerPairs[k+1];
+      //fill fTriggerPt only once, choosed kSameNS
+      if(step==AliTwoPlusOneContainer::kSameNS)
+	fTriggerPt->Fill(pt1, pt2);
+      //fill asymmetry only for kSameNS and kMixedNS
+      Float_t asymmetry = (pt1-pt2)/(pt1+pt2);
+      if(step==AliTwoPlusOneContainer::kSameNS)
+	fAsymmetry->Fill(asymmetry);
+      else if(step==AliTwoPlusOneContainer::kMixedNS)
+	fAsymmetryMixed->Fill(asymmetry);
+    }
+  }
 
   return found_triggers;
 }
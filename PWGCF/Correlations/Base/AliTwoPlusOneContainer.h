@@ -50,6 +50,7 @@ class AliTwoPlusOneContainer : public TNamed
   void SetUseBackgroundSameOneSide(Bool_t flag) { fUseBackgroundSameOneSide = flag; }
   void SetUseSmallerPtAssoc(Bool_t flag) { fUseSmallerPtAssoc = flag; }
   void SetEfficiencyCorrection(THnF* hist)   { fEfficiencyCorrection = hist;   }
+  void SetNThreads(Int_t nThreads) { fNThreads = nThreads; } // threads used by FillCorrelations for the trigger 1 particles
 
   AliTwoPlusOneContainer(const AliTwoPlusOneContainer &c);
   AliTwoPlusOneContainer& operator=(const AliTwoPlusOneContainer& c);
@@ -80,8 +81,9 @@ protected:
   Bool_t fUseSmallerPtAssoc;         //use only associated particles with less pT than the trigger particles
   THnF* fEfficiencyCorrection;   // if non-0 this efficiency correction is applied on the fly to the filling for trigger particles. The factor is multiplicative, i.e. should contain 1/efficiency
   Int_t fMergeCount;	             // counts how many objects have been merged together
+  Int_t fNThreads;                   //! threads for the trigger 1 loop of FillCorrelations
   
-  ClassDef(AliTwoPlusOneContainer, 10)  // underlying event histogram container
+  ClassDef(AliTwoPlusOneContainer, 11)  // underlying event histogram container
 };
 
 
@@ -40,6 +40,7 @@
 ClassImp(AliUEHist)
 
 const Int_t AliUEHist::fgkCFSteps = 11;
+Double_t AliUEHist::fgDenseSizeLimit = 4e9;
 
 AliUEHist::AliUEHist(const char* reqHist, const char* binning) : 
   TObject(),
@@ -138,11 +139,14 @@ AliUEHist::AliUEHist(const char* reqHist, const char* binning) :
   
   Int_t useVtxAxis = 0;
   Int_t useAliTHn = 1; // 0 = don't use | 1 = with float | 2 = with double
+  Bool_t useDense = kFALSE; // event and efficiency containers as AliTHn as well
   
   if (TString(reqHist).Contains("Sparse"))
     useAliTHn = 0;
   if (TString(reqHist).Contains("Double"))
     useAliTHn = 2;
+  if (TString(reqHist).Contains("Dense") && useAliTHn > 0)
+    useDense = kTRUE;
   
   // selection depending on requested histogram
   Int_t axis = -1; // 0 = pT,lead, 1 = phi,lead
@@ -262,6 +266,20 @@ AliUEHist::AliUEHist(const char* reqHist, const char* binning) :
     trackAxisTitle[6] = "Trigger 2 p_{T} (GeV/c)";
   }
     
+  // preflight: estimated size of the dense track containers (all steps filled, with sumw2)
+  if (axis >= 2 && useAliTHn > 0)
+  {
+    Int_t elementSize = (useAliTHn == 2) ? sizeof(Double_t) : sizeof(Float_t);
+    Double_t size = initRegions * AliTHnBase::EstimateSize(nSteps, nTrackVars, iTrackBin, elementSize);
+    AliInfo(Form("Estimated size of the dense track containers: %.1f MB", size / 1024 / 1024));
+    if (size > fgDenseSizeLimit)
+    {
+      AliWarning(Form("Estimated size above the limit of %.1f MB, using sparse containers instead", fgDenseSizeLimit / 1024 / 1024));
+      useAliTHn = 0;
+      useDense = kFALSE;
+    }
+  }
+  
   for (UInt_t i=0; i<initRegions; i++)
   {
     if (axis >= 2 && useAliTHn == 1)
@@ -299,7 +317,12 @@ AliUEHist::AliUEHist(const char* reqHist, const char* binning) :
     nEventVars = 4;
     iEventBin[3] = iTrackBin[6];
   }
-  fEventHist = new AliCFContainer("fEventHist", title, nSteps, nEventVars, iEventBin);
+  if (useDense && useAliTHn == 2)
+    fEventHist = new AliTHnD("fEventHist", title, nSteps, nEventVars, iEventBin);
+  else if (useDense)
+    fEventHist = new AliTHn("fEventHist", title, nSteps, nEventVars, iEventBin);
+  else
+    fEventHist = new AliCFContainer("fEventHist", title, nSteps, nEventVars, iEventBin);
   
   fEventHist->SetBinLimits(0, trackBins[2]);
   fEventHist->SetVarTitle(0, trackAxisTitle[2]);
@@ -325,7 +348,16 @@ AliUEHist::AliUEHist(const char* reqHist, const char* binning) :
   iTrackBin[2] = kNSpeciesBins;
   iTrackBin[4] = nVertexBinsEff;
 
-  fTrackHistEfficiency = new AliCFContainer("fTrackHistEfficiency", "Tracking efficiency", 6, 5, iTrackBin);
+  if (useDense && AliTHnBase::EstimateSize(6, 5, iTrackBin, sizeof(Float_t)) > fgDenseSizeLimit)
+  {
+    AliWarning("Estimated size of the efficiency container above the limit, using a sparse container");
+    useDense = kFALSE;
+  }
+  
+  if (useDense)
+    fTrackHistEfficiency = new AliTHn("fTrackHistEfficiency", "Tracking efficiency", 6, 5, iTrackBin);
+  else
+    fTrackHistEfficiency = new AliCFContainer("fTrackHistEfficiency", "Tracking efficiency", 6, 5, iTrackBin);
   fTrackHistEfficiency->SetBinLimits(0, etaBins);
   fTrackHistEfficiency->SetVarTitle(0, etaTitle);
   fTrackHistEfficiency->SetBinLimits(1, pTBinsFine);
@@ -442,6 +474,25 @@ AliUEHist::AliUEHist(const AliUEHist &c) :
   ((AliUEHist &) c).Copy(*this);
 }
 
+//____________________________________________________________________
+void AliUEHist::FillParent()
+{
+  // fills the THnSparse of all dense (AliTHn) containers and deletes the dense buffers
+  // to be called once on the merged output before projecting
+  
+  AliCFContainer* containers[] = { fTrackHist[0], fTrackHist[1], fTrackHist[2], fTrackHist[3], fEventHist, fTrackHistEfficiency };
+  
+  for (UInt_t i=0; i<sizeof(containers) / sizeof(AliCFContainer*); i++)
+  {
+    if (!containers[i] || !containers[i]->InheritsFrom(AliTHnBase::Class()))
+      continue;
+    
+    AliTHnBase* dense = (AliTHnBase*) containers[i];
+    dense->FillParent();
+    dense->DeleteContainers();
+  }
+}
+
 //____________________________________________________________________
 void AliUEHist::SetStepNames(AliCFContainer* container)
 {
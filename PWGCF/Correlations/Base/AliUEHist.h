@@ -34,6 +34,8 @@ class AliUEHist : public TObject
   enum Region { kToward = 0, kAway, kMin, kMax };
   
   static const Int_t fgkCFSteps;
+  static void SetDenseSizeLimit(Double_t limit) { fgDenseSizeLimit = limit; }
+  static Double_t GetDenseSizeLimit() { return fgDenseSizeLimit; }
   enum CFStep { kCFStepAll = 0, kCFStepTriggered, kCFStepVertex, kCFStepAnaTopology, kCFStepTrackedOnlyPrim, kCFStepTracked, kCFStepReconstructed, kCFStepRealLeading, kCFStepBiasStudy, kCFStepBiasStudy2, kCFStepCorrected };
   
   const char* GetRegionTitle(Region region);
@@ -141,6 +143,8 @@ class AliUEHist : public TObject
   
   static TString CombineBinning(TString defaultBinning, TString customBinning);
   
+  void FillParent();
+  
 protected:
   Double_t* GetBinning(const char* configuration, const char* tag, Int_t& nBins);
   void SetStepNames(AliCFContainer* container);
@@ -178,6 +182,8 @@ protected:
   
   TString fHistogramType;             // what is stored in this histogram
   
+  static Double_t fgDenseSizeLimit;   // maximal estimated size (bytes) of the dense (AliTHn) containers, sparse containers are used above
+  
   ClassDef(AliUEHist, 16) // underlying event histogram container
 };
 
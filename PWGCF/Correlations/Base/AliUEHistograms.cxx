@@ -36,6 +36,9 @@
 #include "TH3F.h"
 #include "TMath.h"
 #include "TLorentzVector.h"
+#include "TArrayI.h"
+#include "TArrayD.h"
+#include "AliTHn.h"
 
 ClassImp(AliUEHistograms)
 
@@ -162,6 +165,9 @@ AliUEHistograms::AliUEHistograms(const char* name, const char* histograms, const
     else if (histogramsStr.Contains("D"))
       configStr += "Double";
     
+    if (histogramsStr.Contains("F"))
+      configStr += "Dense";
+    
     fNumberDensityPhi = new AliUEHist(configStr, binningStr);
   }
   
@@ -711,6 +717,14 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
       }
     }
     
+    // with a dense track container all pairs of one trigger particle are filled in one go from precomputed bin indices
+    AliTHnBase* denseTrackHist = 0;
+    Int_t nDenseVars = fNumberDensityPhi->GetTrackHist(AliUEHist::kToward)->GetNVar();
+    if (fNumberDensityPhi->GetTrackHist(AliUEHist::kToward)->InheritsFrom(AliTHnBase::Class()) && nDenseVars <= 6)
+      denseTrackHist = (AliTHnBase*) fNumberDensityPhi->GetTrackHist(AliUEHist::kToward);
+    TArrayI denseBins((denseTrackHist) ? jMax * nDenseVars : 0);
+    TArrayD denseWeights((denseTrackHist) ? jMax : 0);
+    
     for (Int_t i=0; i<particles->GetEntriesFast(); i++)
     {
       AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
@@ -738,6 +752,17 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  continue;
 	}
 	
+      // trigger pT, centrality and zVtx bins are the same for all pairs of this trigger
+      Int_t nDense = 0;
+      Int_t triggerBins[6] = { 0, 0, 0, 0, 0, 0 };
+      if (denseTrackHist)
+      {
+        triggerBins[2] = denseTrackHist->FindBin(2, triggerParticle->Pt());
+        triggerBins[3] = denseTrackHist->FindBin(3, centrality);
+        if (nDenseVars > 5)
+          triggerBins[5] = denseTrackHist->FindBin(5, zVtx);
+      }
+	
       for (Int_t j=0; j<jMax; j++)
       {
         if (!mixed && i == j)
@@ -1020,10 +1045,21 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}
     
         // fill all in toward region and do not use the other regions
-	fNumberDensityPhi->GetTrackHist(AliUEHist::kToward)->Fill(vars, step, useWeight);
+	if (denseTrackHist)
+	{
+	  Int_t* entryBins = denseBins.GetArray() + nDense * nDenseVars;
+	  for (Int_t k=0; k<nDenseVars; k++)
+	    entryBins[k] = (k == 2 || k == 3 || k == 5) ? triggerBins[k] : denseTrackHist->FindBin(k, vars[k]);
+	  denseWeights[nDense++] = useWeight;
+	}
+	else
+	  fNumberDensityPhi->GetTrackHist(AliUEHist::kToward)->Fill(vars, step, useWeight);
 
 // 	Printf("%.2f %.2f --> %.2f", triggerEta, eta[j], vars[0]);
       }
+      
+      if (nDense > 0)
+        denseTrackHist->FillBins(nDense, denseBins.GetArray(), step, denseWeights.GetArray());
  
       if (firstTime)
       {
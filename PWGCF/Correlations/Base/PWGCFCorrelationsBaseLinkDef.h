@@ -9,6 +9,7 @@
 #pragma link C++ class AliAnalyseLeadingTrackUE+;
 #pragma link C++ class AliCFParticle+;
 #pragma link C++ class AliCFTreeMapping+;
+#pragma link C++ class AliCFFlatParticles+;
 #pragma link C++ class AliAnalysisTaskCFTree+;
 #pragma link C++ class AliTwoPlusOneContainer+;
 #pragma link C++ class AliAnalysisTaskNtuplizer+;
@@ -30,6 +30,7 @@
 #include "AliCFContainer.h"
 #include "AliGenEventHeader.h"
 #include "AliTHn.h"
+#include "AliCorrelationKernel.h"
 
 
 #include "AliAODEvent.h"
@@ -169,6 +170,9 @@ AliAnalysisTaskSEpPbCorrelationsYS::AliAnalysisTaskSEpPbCorrelationsYS()
       fvzero(0),
       fPoolMgr(0),
       fPoolMgr1(0),
+      fKernel(0),
+      fKernelMix(0),
+      fNThreadsMixing(1),
       poolmin(0),
       poolmax(0),
       fPoolMaxNEvents(2000),
@@ -397,6 +401,9 @@ AliAnalysisTaskSEpPbCorrelationsYS::AliAnalysisTaskSEpPbCorrelationsYS(const cha
       fvzero(0),
       fPoolMgr(0),
       fPoolMgr1(0),
+      fKernel(0),
+      fKernelMix(0),
+      fNThreadsMixing(1),
       poolmin(0),
       poolmax(0),
       fPoolMaxNEvents(2000),
@@ -584,6 +591,9 @@ AliAnalysisTaskSEpPbCorrelationsYS::~AliAnalysisTaskSEpPbCorrelationsYS()
     delete fPIDResponse;
     fPIDResponse = 0;
   }
+
+  delete fKernel;
+  delete fKernelMix;
 }
 void AliAnalysisTaskSEpPbCorrelationsYS::UserCreateOutputObjects() {
   fOutputList = new TList();
@@ -596,6 +606,7 @@ void AliAnalysisTaskSEpPbCorrelationsYS::UserCreateOutputObjects() {
   fOutputList1->SetOwner(kTRUE);
  fOutputList1->SetName("anahistos");
   DefineCorrOutput();
+  SetupCorrelationKernels();
 
   DefineVZEROOutput();
   PostData(2, fOutputList1);
@@ -4131,6 +4142,95 @@ Bool_t AliAnalysisTaskSEpPbCorrelationsYS::IsAcceptedDecayLength(const AliAODv0*
   return kTRUE;
 }
 
+namespace {
+  void ToKernelParticles(TObjArray *array, AliCorrelationKernel::Particles &particles) {
+    particles.Clear();
+    for (Int_t i = 0; i < array->GetEntriesFast(); i++) {
+      AliAssociatedTrackYS *track = (AliAssociatedTrackYS *)array->At(i);
+      if (!track) continue;
+      particles.Add(track->Eta(), track->Phi(), track->Pt(), track->Multiplicity(), track->WhichCandidate(),
+		    track->GetID(), track->GetIDFirstDaughter(), track->GetIDSecondDaughter());
+    }
+  }
+}
+
+void AliAnalysisTaskSEpPbCorrelationsYS::SetupCorrelationKernels() {
+  // axes of fHistTriggerTrack(Mix) and fHistReconstTrack(Mix) per analysis mode
+  // event values: 0 centrality, 1 z vertex, 2 fixed trigger pt of the ITS tracklets
+  typedef AliCorrelationKernel K;
+  const Int_t kCent = K::kEventVar, kZvtx = K::kEventVar + 1, kTrackletPt = K::kEventVar + 2;
+
+  K::Config same, mix;
+  if (fAnaMode == "TPCTPC") {
+    const Int_t trig[] = {K::kTriggerPt, kCent, kZvtx};
+    const Int_t pair[] = {K::kDEta, K::kAssocPt, K::kTriggerPt, kCent, K::kDPhi, kZvtx};
+    same.fTriggerAxes.assign(trig, trig + 3);
+    mix.fTriggerAxes.assign(trig, trig + 2);
+    if (fasso == "V0" || fasso == "Phi" || fasso == "Cascade" || fasso == "PID" || fasso == "hadron") {
+      same.fPairAxes.assign(pair, pair + 6);
+      if (fasso == "hadron") {
+	same.fPairStep = 0;
+	same.fPairWeight = K::kWeightProduct;
+      } else {
+	same.fPairStep = -1;
+	same.fPairWeight = K::kWeightUnit;
+      }
+      if (fasso == "V0" || fasso == "Phi")  same.fSelection = K::kExcludeDaughters;
+      if (fasso == "hadron" || fasso == "PID") same.fSelection = K::kPtOrdering | K::kExcludeSameID;
+      if (fasso == "Cascade") same.fSelection = K::kExcludeSameID | K::kExcludeDaughters;
+    }
+    mix.fPairAxes = same.fPairAxes;
+    mix.fPairStep = same.fPairStep;
+    mix.fPairWeight = same.fPairWeight;
+  } else if (fAnaMode == "TPCV0A" || fAnaMode == "TPCV0C" || fAnaMode == "TPCFMD" || fAnaMode == "TPCFMDC") {
+    const Int_t trig[] = {K::kTriggerPt, kCent, kZvtx, K::kTriggerEta};
+    const Int_t pair[] = {K::kDEta, K::kTriggerPt, K::kAssocEta, kCent, K::kDPhi, kZvtx, K::kTriggerEta};
+    same.fTriggerAxes.assign(trig, trig + 4);
+    mix.fTriggerAxes.assign(trig, trig + 2);
+    mix.fTriggerStep = -1;
+    same.fPairAxes.assign(pair, pair + (fptdiff ? 6 : 7));
+    mix.fPairAxes = same.fPairAxes;
+  } else if (fAnaMode == "ITSFMD" || fAnaMode == "ITSFMDC") {
+    const Int_t trig[] = {kTrackletPt, kCent, kZvtx, K::kTriggerEta};
+    const Int_t pair[] = {K::kDEta, kCent, K::kAssocEta, K::kDPhi, kZvtx, K::kTriggerEta};
+    same.fTriggerAxes.assign(trig, trig + 4);
+    mix.fTriggerAxes.assign(trig, trig + 2);
+    same.fTriggerStep = mix.fTriggerStep = -1;
+    same.fTriggerWeighted = mix.fTriggerWeighted = kFALSE;
+    same.fPairAxes.assign(pair, pair + 6);
+    mix.fPairAxes = same.fPairAxes;
+    same.fPairWeight = mix.fPairWeight = K::kWeightAssoc;
+  } else if (fAnaMode == "FMDFMD" || fAnaMode == "FMDFMD_Ctrig" || fAnaMode == "SECA" || fAnaMode == "SECC") {
+    const Int_t trig[] = {kCent, K::kTriggerEta, kZvtx};
+    const Int_t pairFMD[] = {K::kDEta, K::kAssocEta, K::kTriggerEta, kCent, K::kDPhi, kZvtx};
+    const Int_t pairSEC[] = {K::kDEta, K::kTriggerEta, kCent, K::kDPhi, kZvtx};
+    same.fTriggerAxes.assign(trig, trig + 3);
+    mix.fTriggerAxes.assign(trig, trig + 2);
+    if (fAnaMode.BeginsWith("FMDFMD")) same.fPairAxes.assign(pairFMD, pairFMD + 6);
+    else                               same.fPairAxes.assign(pairSEC, pairSEC + 5);
+    mix.fPairAxes = same.fPairAxes;
+    same.fPhiRange = mix.fPhiRange = K::kPhiAtan2HalfPi;
+    same.fSelection = K::kExcludeSamePosition;
+  } else if (fAnaMode == "V0AV0C") {
+    const Int_t trig[] = {kCent, K::kTriggerEta, K::kTriggerPhi};
+    const Int_t pair[] = {K::kAssocEta, K::kTriggerEta, kCent, K::kDPhi};
+    same.fTriggerAxes.assign(trig, trig + 3);
+    mix.fTriggerAxes = same.fTriggerAxes;
+    same.fPairAxes.assign(pair, pair + 4);
+    mix.fPairAxes = same.fPairAxes;
+    same.fPhiRange = mix.fPhiRange = K::kPhiAtan2V0;
+    same.fSelection = mix.fSelection = K::kExcludeSamePosition;
+  }
+
+  delete fKernel;
+  delete fKernelMix;
+  fKernel = new AliCorrelationKernel;
+  fKernel->SetConfig(same);
+  fKernelMix = new AliCorrelationKernel;
+  fKernelMix->SetConfig(mix);
+  fKernelMix->SetNThreads(fNThreadsMixing);
+}
+
 void AliAnalysisTaskSEpPbCorrelationsYS::FillCorrelationTracks( Double_t centrality, TObjArray *triggerArray, TObjArray *selectedTrackArray,AliTHn *triggerHist, AliTHn *associateHist, Bool_t twoTrackEfficiencyCut, Float_t twoTrackEfficiencyCutValue, Float_t fTwoTrackCutMinRadius,Float_t bSign, Int_t step) {
   twoTrackEfficiencyCut=kFALSE;
   twoTrackEfficiencyCutValue=0;
@@ -4138,246 +4238,13 @@ void AliAnalysisTaskSEpPbCorrelationsYS::FillCorrelationTracks( Double_t central
   bSign=0;
   step=1;//default
   if (!triggerHist || !associateHist)    return;
-  if(fAnaMode=="TPCTPC"){
-      Double_t binscontTrig[3];
-      Double_t binscont[6];
-      for (Int_t i = 0; i < triggerArray->GetEntriesFast(); i++) {
-	AliAssociatedTrackYS *trigger = (AliAssociatedTrackYS *)triggerArray->At(i);
-	if (!trigger)    continue;
-	Float_t triggerPt = trigger->Pt();
-	Float_t triggerEta = trigger->Eta();
-	Float_t triggerPhi = trigger->Phi();
-	Int_t trigFirstID = trigger->GetIDFirstDaughter();
-	Int_t trigSecondID = trigger->GetIDSecondDaughter();
-	Int_t trigID = trigger->GetID();
-	binscontTrig[0] = triggerPt;
-	binscontTrig[1] = centrality;
-	binscontTrig[2] = fPrimaryZVtx;
-	Float_t triggermultiplicity=trigger->Multiplicity();
-	/*
-	Float_t efficiency=999;
-	Int_t ivzbin=frefvz->GetXaxis()->FindBin(fPrimaryZVtx);
-	if(fefficalib){
-	Int_t iPt=fhcorr[ivzbin-1]->GetXaxis()->FindBin(triggerPt);
-	Int_t iEta=fhcorr[ivzbin-1]->GetYaxis()->FindBin(triggerEta);
-	Int_t iPhi=fhcorr[ivzbin-1]->GetZaxis()->FindBin(triggerPhi);
-	efficiency=fhcorr[ivzbin-1]->GetBinContent(iPt,iEta,iPhi);
-	}else efficiency=1.;
-	if(efficiency==0.) continue;
-	*/	
-	//	triggerHist->Fill(binscontTrig,0,1./efficiency);
-	triggerHist->Fill(binscontTrig,0,triggermultiplicity);
-	for (Int_t j = 0; j < selectedTrackArray->GetEntriesFast(); j++) {
-	  AliAssociatedTrackYS *associate =   (AliAssociatedTrackYS*)selectedTrackArray->At(j);
-	  if (!associate)        continue;
-	  Int_t AssoFirstID = associate->GetIDFirstDaughter();
-	  Int_t AssoSecondID = associate->GetIDSecondDaughter();
-	  if (fasso == "V0" || fasso == "Phi"){
-	    if (trigID == AssoFirstID || trigID == AssoSecondID){
-	      continue;
-	    }
-	  }
-	  if (fasso == "hadron" || fasso=="PID") {
-	    if (triggerPt < associate->Pt())          continue;
-	    if (trigID == associate->GetID())          continue;
-	  }
-	  if (fasso == "Cascade")  if (trigID == associate->GetID() || trigID == AssoFirstID ||  trigID == AssoSecondID)          continue;
-	  binscont[0] = triggerEta - associate->Eta();
-	  binscont[1] = associate->Pt();
-	  binscont[2] = triggerPt;
-	  binscont[3] = centrality;
-	  binscont[4] = RangePhi(triggerPhi - associate->Phi());
-	  binscont[5] = fPrimaryZVtx;
-	  Float_t assomultiplicity=associate->Multiplicity();
-	  /*
-	  Float_t efficiency1=999.;
-	  if(fefficalib){
-	  Int_t iPt1=fhcorr[ivzbin-1]->GetXaxis()->FindBin(associate->Pt());
-	  Int_t iEta1=fhcorr[ivzbin-1]->GetYaxis()->FindBin(associate->Eta());
-	  Int_t iPhi1=fhcorr[ivzbin-1]->GetZaxis()->FindBin(associate->Phi());
-	  efficiency1=fhcorr[ivzbin-1]->GetBinContent(iPt1,iEta1,iPhi1);
-	  }else  efficiency1=1.;
-	  if(efficiency1==0.) continue;
-	  */
-	  Int_t SpAsso = associate->WhichCandidate();
-	  if (fasso == "V0" || fasso == "Phi" || fasso == "Cascade" ||  (fasso == "PID")) {
-	    if (SpAsso < 0)          continue;
-	    associateHist->Fill(binscont, SpAsso);
-	  }else if(fasso=="hadron"){
-	    //	    associateHist->Fill(binscont, 0,1./(efficiency*efficiency1));
-	    associateHist->Fill(binscont, 0,triggermultiplicity*assomultiplicity);
-	  }
-	}
-      }
-  }else if (fAnaMode=="TPCV0A" || fAnaMode=="TPCV0C" || fAnaMode=="TPCFMD" || fAnaMode=="TPCFMDC"){
-    Double_t binscontTrig[4];
-    Double_t binscont[7];
-    Double_t binscont_ptdiff[6];
-    for(Int_t i=0;i<triggerArray->GetEntriesFast();i++){
-      AliAssociatedTrackYS* trigger = (AliAssociatedTrackYS*) triggerArray->At(i);
-      if(!trigger)continue;
-      Float_t  triggerEta  = trigger->Eta();
-      Float_t  triggerPhi  = trigger->Phi();
-      Float_t  triggerPt  = trigger->Pt();
-      binscontTrig[0]=triggerPt;
-      binscontTrig[1]=centrality;
-      binscontTrig[2]=fPrimaryZVtx;
-      binscontTrig[3]=triggerEta;
-      Float_t triggermultiplicity=trigger->Multiplicity();
-      Int_t SpAsso= trigger->WhichCandidate();
-      //      triggerHist->Fill(binscontTrig,0,1./efficiency);
-      triggerHist->Fill(binscontTrig,0,triggermultiplicity);
-      for (Int_t j=0; j<selectedTrackArray->GetEntriesFast(); j++){
-        AliAssociatedTrackYS* associate = (AliAssociatedTrackYS*) selectedTrackArray->At(j);
-        if(!associate)continue;
-        Float_t associatemultiplicity=associate->Multiplicity();
-        Float_t assophi=associate->Phi();
-        Float_t assoeta=associate->Eta();
-	if(!fptdiff){
-	  binscont[0]=triggerEta-associate->Eta();
-	  binscont[1]=triggerPt;
-	  binscont[2]=associate->Eta();
-	  binscont[3]=centrality;
-	  binscont[4]=RangePhi(triggerPhi-associate->Phi());
-	  binscont[5]=fPrimaryZVtx;
-	  binscont[6]=triggerEta;
-	}else{
-	  binscont_ptdiff[0]=triggerEta-associate->Eta();
-	  binscont_ptdiff[1]=triggerPt;
-	  binscont_ptdiff[2]=associate->Eta();
-	  binscont_ptdiff[3]=centrality;
-	  binscont_ptdiff[4]=RangePhi(triggerPhi-associate->Phi());
-	  binscont_ptdiff[5]=fPrimaryZVtx;
-	}
-	
-	//	associateHist->Fill(binscont, 0, (Double_t)associate->Multiplicity()/efficienc);
-	if(!fptdiff)associateHist->Fill(binscont, 0, (Double_t)associate->Multiplicity()*triggermultiplicity);
-	else associateHist->Fill(binscont_ptdiff, 0, (Double_t)associate->Multiplicity()*triggermultiplicity);
-	  
-      }
-    }
-  }else if (fAnaMode=="ITSFMD" || fAnaMode=="ITSFMDC"){
-    Double_t binscontTrig[4];
-    Double_t binscont[6];
-    for(Int_t i=0;i<triggerArray->GetEntriesFast();i++){
-      AliAssociatedTrackYS* trigger = (AliAssociatedTrackYS*) triggerArray->At(i);
-      if(!trigger)continue;
-      Float_t  triggerEta  = trigger->Eta();
-      Float_t  triggerPhi  = trigger->Phi();
-      Float_t  triggerPt  = 0.5;
-      binscontTrig[0]=triggerPt;
-      binscontTrig[1]=centrality;
-      binscontTrig[2]=fPrimaryZVtx;
-      binscontTrig[3]=triggerEta;
-      Int_t SpAsso= trigger->WhichCandidate();
-      triggerHist->Fill(binscontTrig,SpAsso);
-      for (Int_t j=0; j<selectedTrackArray->GetEntriesFast(); j++){
-        AliAssociatedTrackYS* associate = (AliAssociatedTrackYS*) selectedTrackArray->At(j);
-        if(!associate)continue;
-        Float_t associatemultiplicity=associate->Multiplicity();
-        Float_t assophi=associate->Phi();
-        Float_t assoeta=associate->Eta();
-        binscont[0]=triggerEta-associate->Eta();
-	binscont[1]=centrality;	
-	binscont[2]=associate->Eta();
-	binscont[3]=RangePhi(triggerPhi-associate->Phi());
-        binscont[4]=fPrimaryZVtx;
-        binscont[5]=triggerEta;
-	associateHist->Fill(binscont, 0, (Double_t)associate->Multiplicity());
-      }
-    }
- } else if(fAnaMode=="FMDFMD"|| fAnaMode=="FMDFMD_Ctrig"){
-    Double_t binscontTrig[3];
-    Double_t binscont[6];
-    for(Int_t i=0;i<triggerArray->GetEntriesFast();i++){
-      AliAssociatedTrackYS* trigger = (AliAssociatedTrackYS*) triggerArray->At(i);
-      if(!trigger)continue;
-      Float_t  triggerMultiplicity= trigger->Multiplicity();
-      Float_t  triggerEta  = trigger->Eta();
-      Float_t  triggerPhi  = trigger->Phi();
-      binscontTrig[0]=centrality;
-      binscontTrig[1]=triggerEta;
-      binscontTrig[2]=fPrimaryZVtx;
-      triggerHist->Fill(binscontTrig,0,(Double_t)triggerMultiplicity);
-      for (Int_t j=0; j<selectedTrackArray->GetEntriesFast(); j++){
-        AliAssociatedTrackYS* associate = (AliAssociatedTrackYS*) selectedTrackArray->At(j);
-        if(!associate)continue;
-        Float_t assophi=associate->Phi();
-        Float_t assoeta=associate->Eta();
-        Float_t mult=associate->Multiplicity()*triggerMultiplicity;
-        binscont[0]=triggerEta-associate->Eta();
-        binscont[1]=associate->Eta();
-        binscont[2]=triggerEta;
-        binscont[3]=centrality;
-        binscont[4]=RangePhi_FMD(triggerPhi-associate->Phi());
-        binscont[5]=fPrimaryZVtx;
-
-        Float_t dphivzero=triggerPhi-associate->Phi();
-        if(triggerPhi==assophi && triggerEta==assoeta) continue;
-        associateHist->Fill(binscont,0,(Double_t)mult);
-      }
-    }
-  }else if(fAnaMode=="SECA"||fAnaMode=="SECC"){
-    Double_t binscontTrig[3];
-    Double_t binscont[5];
-    for(Int_t i=0;i<triggerArray->GetEntriesFast();i++){
-      AliAssociatedTrackYS* trigger = (AliAssociatedTrackYS*) triggerArray->At(i);
-      if(!trigger)continue;
-      Float_t  triggerMultiplicity= trigger->Multiplicity();
-      Float_t  triggerEta  = trigger->Eta();
-      Float_t  triggerPhi  = trigger->Phi();
-      binscontTrig[0]=centrality;
-      binscontTrig[1]=triggerEta;
-      binscontTrig[2]=fPrimaryZVtx;
-      triggerHist->Fill(binscontTrig,0,(Double_t)triggerMultiplicity);
-      for (Int_t j=0; j<selectedTrackArray->GetEntriesFast(); j++){
-        AliAssociatedTrackYS* associate = (AliAssociatedTrackYS*) selectedTrackArray->At(j);
-        if(!associate)continue;
-        Float_t assophi=associate->Phi();
-        Float_t assoeta=associate->Eta();
-        Float_t mult=associate->Multiplicity()*triggerMultiplicity;
-        binscont[0]=triggerEta-associate->Eta();
-        binscont[1]=triggerEta;
-        binscont[2]=centrality;
-        binscont[3]=RangePhi_FMD(triggerPhi-associate->Phi());
-        binscont[4]=fPrimaryZVtx;
-        //        if(triggerEta>2.7 && triggerEta<2.8)cout<<triggerEta<<" "<<associate->Eta()<<" "<<binscont[0]<<endl;
-        Float_t dphivzero=triggerPhi-associate->Phi();
-        if(triggerPhi==assophi && triggerEta==assoeta) continue;
-        associateHist->Fill(binscont,0,(Double_t)mult);
-      }
-    }
-  }else if(fAnaMode=="V0AV0C"){
-    Double_t  binscont1[4];
-    Double_t  binscontTrig1[3];
-    for(Int_t i=0;i<triggerArray->GetEntriesFast();i++){
-      AliAssociatedTrackYS* trigger = (AliAssociatedTrackYS*) triggerArray->At(i);
-      if(!trigger)continue;
-      Double_t  triggerMultiplicity= trigger->Multiplicity();
-      Double_t  triggerEta  = trigger->Eta();
-      Double_t  triggerPhi  = trigger->Phi();
-      binscontTrig1[0]=centrality;
-      binscontTrig1[1]=triggerEta;
-      binscontTrig1[2]=triggerPhi;
-      triggerHist->Fill(binscontTrig1,0,(Double_t)triggerMultiplicity);
-      for (Int_t j=0; j<selectedTrackArray->GetEntriesFast(); j++){
-        AliAssociatedTrackYS* associate = (AliAssociatedTrackYS*) selectedTrackArray->At(j);
-        if(!associate)continue;
-        Double_t associatemultiplicity=associate->Multiplicity();
-        Double_t assophi=associate->Phi();
-        Double_t assoeta=associate->Eta();
-        binscont1[0]=associate->Eta();
-        binscont1[1]=triggerEta;
-        binscont1[2]=centrality;
-        binscont1[3]=RangePhi2(triggerPhi-associate->Phi());
-        if(triggerPhi==assophi && triggerEta==assoeta) continue;
-        Double_t dphivzero=triggerPhi-associate->Phi();
-        associateHist->Fill(binscont1,0,(Double_t)triggerMultiplicity*associatemultiplicity);
-      }
-    }
-  }
-
+  if (!fKernel) SetupCorrelationKernels();
 
+  AliCorrelationKernel::Particles triggers, assocs;
+  ToKernelParticles(triggerArray, triggers);
+  ToKernelParticles(selectedTrackArray, assocs);
+  const Double_t eventVars[3] = {centrality, fPrimaryZVtx, 0.5};
+  fKernel->Fill(triggers, assocs, triggerHist, associateHist, eventVars);
 }
 
 void AliAnalysisTaskSEpPbCorrelationsYS::FillCorrelationTracksMixing(Double_t centrality, Double_t pvxMix, Double_t poolmax, Double_t poolmin,    TObjArray *triggerArray, TObjArray *selectedTrackArray, AliTHn *triggerHist,    AliTHn *associateHist, Bool_t twoTrackEfficiencyCut,    Float_t twoTrackEfficiencyCutValue, Float_t fTwoTrackCutMinRadius,    Float_t bSign, Int_t step) {
@@ -4390,12 +4257,8 @@ void AliAnalysisTaskSEpPbCorrelationsYS::FillCorrelationTracksMixing(Double_t ce
   
   Double_t poolmax1=poolmax;
   Double_t poolmin1=poolmin;
-  /*
-  if (!triggerHist || !associateHist){
-    return;
-  }
-  */
-  Double_t counterMix = 0;
+  if (!fKernelMix) SetupCorrelationKernels();
+
   AliEventPool *pool = fPoolMgr->GetEventPool(centrality, pvxMix);
   if (!pool){
     AliFatal(Form("No pool found for centrality = %f, zVtx = %f", centrality,
@@ -4405,234 +4268,19 @@ void AliAnalysisTaskSEpPbCorrelationsYS::FillCorrelationTracksMixing(Double_t ce
     mixedDist ->Fill(centrality, pool->NTracksInPool());
     mixedDist2->Fill(centrality, pool->GetCurrentNEvents());
     Int_t nMix = pool->GetCurrentNEvents();
-    for (Int_t jMix = 0; jMix < nMix; jMix++) {  
-      TObjArray *mixEvents = pool->GetEvent(jMix);
-      if(fAnaMode=="TPCTPC"){
-        Double_t binscontTrig[2];
-        Double_t binscont[6];
-	for (Int_t i = 0; i < triggerArray->GetEntriesFast(); i++) {
-          AliAssociatedTrackYS *trig = (AliAssociatedTrackYS *)triggerArray->At(i);
-          if (!trig)          continue;
-          Double_t triggerPhi = trig->Phi();
-          Double_t triggerEta = trig->Eta();
-          Double_t triggerPt = trig->Pt();
-          counterMix++;
-          binscontTrig[0] = triggerPt;
-          binscontTrig[1] = centrality;
-	  Double_t triggermultiplicity=trig->Multiplicity();
-	  /*
-	  Float_t efficiency;
-	  Int_t ivzbin=frefvz->GetXaxis()->FindBin(fPrimaryZVtx);
-	  if(fefficalib){
-	    Int_t iPt=fhcorr[ivzbin-1]->GetXaxis()->FindBin(triggerPt);
-	    Int_t iEta=fhcorr[ivzbin-1]->GetYaxis()->FindBin(triggerEta);
-	    Int_t iPhi=fhcorr[ivzbin-1]->GetZaxis()->FindBin(triggerPhi);
-	    efficiency=fhcorr[ivzbin-1]->GetBinContent(iPt,iEta,iPhi);
-	  }else efficiency=1.;
-	  if(efficiency==0.) continue;
-	  */
-	  triggerHist->Fill(binscontTrig, 0,triggermultiplicity);
-          for (Int_t j = 0; j < mixEvents->GetEntriesFast(); j++) {
-            AliAssociatedTrackYS *associate =  (AliAssociatedTrackYS *)mixEvents->At(j);
-            if (!associate) continue;
-	    //if (triggerPt < associate->Pt())          continue;
-	    //if (trigID == associate->GetID())          continue;
-	    binscont[0] = triggerEta - associate->Eta();
-	    binscont[1] = associate->Pt();
-	    binscont[2] = triggerPt;
-	    binscont[3] = centrality;
-	    binscont[4] = RangePhi(triggerPhi - associate->Phi());
-	    binscont[5] = pvxMix;
-	    Double_t assomultiplicity=associate->Multiplicity();
-	    /*
-	    Float_t efficiency1;
-	    if(fefficalib){
-	      Int_t iPt1=fhcorr[ivzbin-1]->GetXaxis()->FindBin(associate->Pt());
-	      Int_t iEta1=fhcorr[ivzbin-1]->GetYaxis()->FindBin(associate->Eta());
-	      Int_t iPhi1=fhcorr[ivzbin-1]->GetZaxis()->FindBin(associate->Phi());
-	      efficiency1=fhcorr[ivzbin-1]->GetBinContent(iPt1,iEta1,iPhi1);
-	    }else efficiency1=1.;
-	    if(efficiency1==0.) continue;
-	    */
-	    Int_t SpAsso = associate->WhichCandidate();
-	    if (fasso == "V0" || fasso == "Phi" || fasso == "Cascade" || (fasso == "PID")) {
-	      if (SpAsso < 0)   continue;
-	      associateHist->Fill(binscont, SpAsso, 1. / (Double_t)nMix);
-	    }else if(fasso=="hadron"){
-	      associateHist->Fill(binscont, 0,triggermultiplicity*assomultiplicity/(Double_t)nMix);
-	    }
-	  }
-	}
-      }else if(fAnaMode=="TPCV0A" || fAnaMode=="TPCV0C" || fAnaMode=="TPCFMD" || fAnaMode=="TPCFMDC"){
-        Double_t binscontTrig[2];
-	Double_t binscont[7];
-	Double_t binscont_ptdiff[6];
-	//Double_t binscont[6];
-        for(Int_t i=0;i<triggerArray->GetEntriesFast();i++){
-          AliAssociatedTrackYS* trigger =(AliAssociatedTrackYS*) triggerArray->At(i);
-          if(!trigger)continue;
-          Double_t triggerPt   = trigger->Pt();
-          Double_t triggerEta  = trigger->Eta();
-          Double_t triggerPhi  = trigger->Phi();
-	  Int_t SpAsso=trigger->WhichCandidate();
-          counterMix++;
-          binscontTrig[0]=triggerPt;
-          binscontTrig[1]=centrality;
-	  Int_t ivzbin=frefvz->GetXaxis()->FindBin(fPrimaryZVtx);
-	  Double_t triggermultiplicity=trigger->Multiplicity();
-	  /*
-	  Float_t efficiency=999.;
-	  if(fefficalib){
-	    Int_t iPt=fhcorr[ivzbin-1]->GetXaxis()->FindBin(triggerPt);
-	    Int_t iEta=fhcorr[ivzbin-1]->GetYaxis()->FindBin(triggerEta);
-	    Int_t iPhi=fhcorr[ivzbin-1]->GetZaxis()->FindBin(triggerPhi);
-	    efficiency=fhcorr[ivzbin-1]->GetBinContent(iPt,iEta,iPhi);
-	  }else efficiency=1.;
-	  if(efficiency==0.) continue;
-	  */
-	  triggerHist->Fill(binscontTrig,SpAsso,triggermultiplicity);
-          for (Int_t j=0; j<mixEvents->GetEntriesFast(); j++){
-            AliAssociatedTrackYS* associate=(AliAssociatedTrackYS*)  mixEvents->At(j);
-            
-            if(!associate)continue;	
-	    if(!fptdiff){
-	      binscont[0]=triggerEta-associate->Eta();
-	      binscont[1]=triggerPt;
-	      binscont[2]=associate->Eta();
-	      binscont[3]=centrality;
-	      binscont[4]=RangePhi(triggerPhi-associate->Phi());
-	      binscont[5]=pvxMix;
-	      binscont[6]=triggerEta;
-	    }else{
-	      binscont_ptdiff[0]=triggerEta-associate->Eta();
-	      binscont_ptdiff[1]=triggerPt;
-	      binscont_ptdiff[2]=associate->Eta();
-	      binscont_ptdiff[3]=centrality;
-	      binscont_ptdiff[4]=RangePhi(triggerPhi-associate->Phi());
-	      binscont_ptdiff[5]=pvxMix;
-	    }
-	    if(!fptdiff)associateHist->Fill(binscont, 0,(Double_t)associate->Multiplicity()*triggermultiplicity/(Double_t)nMix);
-	    else associateHist->Fill(binscont_ptdiff, 0,(Double_t)associate->Multiplicity()*triggermultiplicity/(Double_t)nMix);
-  
-          }
-        }
-      }else if(fAnaMode=="ITSFMD" || fAnaMode=="ITSFMDC"){
-        Double_t binscontTrig[2];
-        Double_t binscont[6];
-        for(Int_t i=0;i<triggerArray->GetEntriesFast();i++){
-          AliAssociatedTrackYS* trigger =(AliAssociatedTrackYS*) triggerArray->At(i);
-          if(!trigger)continue;
-          Double_t triggerPt   = 0.5;
-          Double_t triggerEta  = trigger->Eta();
-          Double_t triggerPhi  = trigger->Phi();
-		  Int_t SpAsso=trigger->WhichCandidate();
-          counterMix++;
-          binscontTrig[0]=triggerPt;
-          binscontTrig[1]=centrality;
-          triggerHist->Fill(binscontTrig,SpAsso);
-          for (Int_t j=0; j<mixEvents->GetEntriesFast(); j++){
-            AliAssociatedTrackYS* associate=(AliAssociatedTrackYS*)  mixEvents->At(j);
-	    if(!associate)continue;
-            binscont[0]=triggerEta-associate->Eta();
-            binscont[1]=centrality;
-            binscont[2]=associate->Eta();
-            binscont[3]=RangePhi(triggerPhi-associate->Phi());
-            binscont[4]=pvxMix;
-            binscont[5]=triggerEta;
-	    associateHist->Fill(binscont, 0,(Double_t)associate->Multiplicity()/(Double_t)nMix);
-	  }
-        }
-      }else if(fAnaMode=="FMDFMD"||fAnaMode=="FMDFMD_Ctrig"){
-        Double_t binscontTrig[2];
-        Double_t binscont[6];
-        for(Int_t i=0;i<triggerArray->GetEntriesFast();i++){
-          AliAssociatedTrackYS* trigger = (AliAssociatedTrackYS*) triggerArray->At(i);
-        if(!trigger)continue;
-        Float_t triggerMultiplicity= trigger->Multiplicity();
-        Float_t  triggerEta  = trigger->Eta();
-        Float_t  triggerPhi  = trigger->Phi();
-        counterMix++;
-        binscontTrig[0]=centrality;
-        binscontTrig[1]=triggerEta;
-        triggerHist->Fill(binscontTrig,step,(Double_t)triggerMultiplicity);
-        for (Int_t j=0; j<mixEvents->GetEntriesFast(); j++){
-          AliAssociatedTrackYS* associate = (AliAssociatedTrackYS*) mixEvents->At(j);
-          if(!associate)continue;
-          //          Double_t associatemultiplicity=associate->Multiplicity();
-          Float_t assophi=associate->Phi();
-          Float_t assoeta=associate->Eta();
-          Float_t mult=triggerMultiplicity*associate->Multiplicity();
-          binscont[0]=triggerEta-associate->Eta();
-          binscont[1]=associate->Eta();
-          binscont[2]=triggerEta;
-          binscont[3]=centrality;
-          binscont[4]=RangePhi_FMD(triggerPhi-associate->Phi());
-          binscont[5]=pvxMix;
-          // if(triggerPhi==assophi && triggerEta==assoeta) continue;
-          //  associateHist->Fill(binscont,0,(Double_t)triggerMultiplicity*associatemultiplicity/(Double_t)nMix);
-          associateHist->Fill(binscont,0,mult/(Double_t)nMix);
-        }
-        }
-      }else if(fAnaMode=="SECA"||fAnaMode=="SECC"){
-        Double_t binscontTrig[2];
-        Double_t binscont[5];
-        for(Int_t i=0;i<triggerArray->GetEntriesFast();i++){
-          AliAssociatedTrackYS* trigger = (AliAssociatedTrackYS*) triggerArray->At(i);
-	  if(!trigger)continue;
-	  Float_t triggerMultiplicity= trigger->Multiplicity();
-	  Float_t  triggerEta  = trigger->Eta();
-	  Float_t  triggerPhi  = trigger->Phi();
-	  counterMix++;
-	  binscontTrig[0]=centrality;
-	  binscontTrig[1]=triggerEta;
-	  triggerHist->Fill(binscontTrig,step,(Double_t)triggerMultiplicity);
-	  for (Int_t j=0; j<mixEvents->GetEntriesFast(); j++){
-	    AliAssociatedTrackYS* associate = (AliAssociatedTrackYS*) mixEvents->At(j);
-	    if(!associate)continue;
-	    //          Double_t associatemultiplicity=associate->Multiplicity();
-	    Float_t assophi=associate->Phi();
-	    Float_t assoeta=associate->Eta();
-	    Float_t mult=triggerMultiplicity*associate->Multiplicity();
-	    binscont[0]=triggerEta-associate->Eta();
-	    binscont[1]=triggerEta;
-	    binscont[2]=centrality;
-	    binscont[3]=RangePhi_FMD(triggerPhi-associate->Phi());
-	    binscont[4]=pvxMix;
-	    //     if(triggerPhi==assophi && triggerEta==assoeta) continue;
-	    //  associateHist->Fill(binscont,0,(Double_t)triggerMultiplicity*associatemultiplicity/(Double_t)nMix);
-	    associateHist->Fill(binscont,0,mult/(Double_t)nMix);
-	  }
-        }
-      }else if (fAnaMode=="V0AV0C"){
-	Double_t  binscont1[4];
-	Double_t  binscontTrig1[3];
-	for(Int_t i=0;i<triggerArray->GetEntriesFast();i++){
-	  AliAssociatedTrackYS* trigger = (AliAssociatedTrackYS*) triggerArray->At(i);
-	  if(!trigger)continue;
-	  Double_t  triggerMultiplicity= trigger->Multiplicity();
-	  Double_t  triggerEta  = trigger->Eta();
-	  Double_t  triggerPhi  = trigger->Phi();
-	  counterMix++;
-	  binscontTrig1[0]=centrality;
-	  binscontTrig1[1]=triggerEta;
-	  binscontTrig1[2]=triggerPhi;
-	  triggerHist->Fill(binscontTrig1,step,(Double_t)triggerMultiplicity);
-	  for (Int_t j=0; j<mixEvents->GetEntriesFast(); j++){
-	    AliAssociatedTrackYS* associate = (AliAssociatedTrackYS*) mixEvents->At(j);
-	    if(!associate)continue;
-	    Double_t associatemultiplicity=associate->Multiplicity();
-	    Double_t assophi=associate->Phi();
-	    Double_t assoeta=associate->Eta();
-	    binscont1[0]=associate->Eta();
-	    binscont1[1]=triggerEta;
-	    binscont1[2]=centrality;
-	    binscont1[3]=RangePhi2(triggerPhi-associate->Phi());
-	    if(triggerPhi==assophi && triggerEta==assoeta) continue;
-	    associateHist->Fill(binscont1,0,(Double_t)triggerMultiplicity*associatemultiplicity/(Double_t)nMix);
-	  }
-	}
-      }
+
+    // all pool events at once, the kernel distributes them over fNThreadsMixing threads
+    AliCorrelationKernel::Particles triggers;
+    ToKernelParticles(triggerArray, triggers);
+    std::vector<AliCorrelationKernel::Particles> mixEvents(nMix);
+    std::vector<const AliCorrelationKernel::Particles*> mixPool(nMix);
+    for (Int_t jMix = 0; jMix < nMix; jMix++) {
+      ToKernelParticles(pool->GetEvent(jMix), mixEvents[jMix]);
+      mixPool[jMix] = &mixEvents[jMix];
     }
+    // trigger pt is the fixed value for ITS tracklets, otherwise not used as event value
+    const Double_t eventVars[3] = {centrality, pvxMix, 0.5};
+    fKernelMix->FillMixed(triggers, mixPool, triggerHist, associateHist, eventVars, 1. / (Double_t)nMix);
   }
   
   TObjArray* tracksClone=CloneTrack(selectedTrackArray);
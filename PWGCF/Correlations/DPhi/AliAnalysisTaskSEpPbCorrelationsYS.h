@@ -30,6 +30,7 @@ class AliAODv0;
 class THnSparse;
 class AliAODcascade;
 class AliAODVertex;
+class AliCorrelationKernel;
 //class AliForwardFlowResultStorage;
 
 
@@ -75,6 +76,7 @@ public:
   void SetMaxNEventsInPool(Int_t events) { fPoolMaxNEvents = events; }
   void SetMinNTracksInPool(Int_t tracks) { fPoolMinNTracks = tracks; }
   void SetMinEventsToMix(Int_t events) { fMinEventsToMix = events; }
+  void SetNThreadsMixing(Int_t threads) { fNThreadsMixing = threads; }
 
   void SetPoolPVzBinLimits(Int_t Nzvtxbins, const Double_t *ZvtxBins) {
     fNzVtxBins = Nzvtxbins;
@@ -121,6 +123,7 @@ private:
   Bool_t IsAcceptedCascadeOmega(const AliAODcascade *casc);
 
   TObjArray* CloneTrack(TObjArray* track);
+  void SetupCorrelationKernels();
   Double_t RangePhi(Double_t DPhi);
   Double_t RangePhi_FMD(Double_t DPhi);
   Double_t RangePhi2(Double_t DPhi);
@@ -246,6 +249,9 @@ private:
   // Event Pool for mixing
   AliEventPoolManager *fPoolMgr;  //  event pool manager for Event Mixing
   AliEventPoolManager *fPoolMgr1; //  event pool manager for Event Mixing
+  AliCorrelationKernel *fKernel;    //! same event correlations, configured from fAnaMode and fasso
+  AliCorrelationKernel *fKernelMix; //! mixed event correlations
+  Int_t fNThreadsMixing;           // threads over the events of a mixing pool
   Double_t poolmin;
   Double_t poolmax;
   Int_t fPoolMaxNEvents;   // set maximum number of events in the pool
@@ -387,7 +393,7 @@ private:
   TProfile* SP_uVZEROC2[8];
   TProfile* SP_uVZEROC3[8];
 
-  ClassDef(AliAnalysisTaskSEpPbCorrelationsYS, 2);
+  ClassDef(AliAnalysisTaskSEpPbCorrelationsYS, 3);
 };
 //---------------------------------------------------------------------------------------
 Float_t AliAnalysisTaskSEpPbCorrelationsYS::GetDPhiStar(
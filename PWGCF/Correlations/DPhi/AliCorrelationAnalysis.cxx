@@ -98,12 +98,14 @@ void AliCorrelationAnalysis::FillParentTHnSparse(TString fileName, Bool_t reduce
     ((AliTHn*) h->GetUEHist(2)->GetTrackHist(AliUEHist::kToward))->ReduceAxis();
   ((AliTHn*) h->GetUEHist(2)->GetTrackHist(AliUEHist::kToward))->FillParent();
   ((AliTHn*) h->GetUEHist(2)->GetTrackHist(AliUEHist::kToward))->DeleteContainers();
+  h->GetUEHist(2)->FillParent();
 
   AliUEHistograms* hMixed = (AliUEHistograms*) GetUEHistogram(fileName, 0, kTRUE, tag);
   if (reduce)
     ((AliTHn*) hMixed->GetUEHist(2)->GetTrackHist(AliUEHist::kToward))->ReduceAxis();
   ((AliTHn*) hMixed->GetUEHist(2)->GetTrackHist(AliUEHist::kToward))->FillParent();
   ((AliTHn*) hMixed->GetUEHist(2)->GetTrackHist(AliUEHist::kToward))->DeleteContainers();
+  hMixed->GetUEHist(2)->FillParent();
 
   TString fileNameNew(fileName);
 
@@ -151,11 +153,13 @@ void AliCorrelationAnalysis::PlotDeltaPhiEtaGap(const TString &fileNamePbPb, TSt
   if (h->GetUEHist(2)->GetTrackHist(AliUEHist::kToward)->GetGrid(6)->GetGrid()->GetNbins() == 0) {
     ((AliTHn*) h->GetUEHist(2)->GetTrackHist(AliUEHist::kToward))->FillParent();
     ((AliTHn*) h->GetUEHist(2)->GetTrackHist(AliUEHist::kToward))->DeleteContainers();
+    h->GetUEHist(2)->FillParent();
   }
 
   if (hMixed->GetUEHist(2)->GetTrackHist(AliUEHist::kToward)->GetGrid(6)->GetGrid()->GetNbins() == 0) {
     ((AliTHn*) hMixed->GetUEHist(2)->GetTrackHist(AliUEHist::kToward))->FillParent();
     ((AliTHn*) hMixed->GetUEHist(2)->GetTrackHist(AliUEHist::kToward))->DeleteContainers();
+    hMixed->GetUEHist(2)->FillParent();
   }
 
   if (symmetrizePt) {
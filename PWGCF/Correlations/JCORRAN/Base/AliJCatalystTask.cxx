@@ -42,6 +42,7 @@
 #include "AliJHistManager.h"
 #include "AliJRunTable.h"
 #include "AliJFFlucAnalysis.h" // TEMP for getting bins
+#include "AliJQvectorService.h"
 
 //#pragma GCC diagnostic warning "-Wall"
 //______________________________________________________________________________
@@ -78,6 +79,7 @@ AliJCatalystTask::AliJCatalystTask():
 	grEffCor(0),
 	fCentBinEff(0),
 	phiMapIndex(0),
+	fQvectorService(NULL),
 // QA part.
 	fMainList(NULL),
 	bSaveAllQA(kFALSE),
@@ -123,6 +125,7 @@ AliJCatalystTask::AliJCatalystTask(const char *name):
 	grEffCor(0),
 	fCentBinEff(0),
 	phiMapIndex(0),
+	fQvectorService(NULL),
 // QA part.
 	fMainList(NULL),
 	bSaveAllQA(kFALSE),
@@ -157,6 +160,7 @@ AliJCatalystTask::AliJCatalystTask(const AliJCatalystTask& ap) :
 	grEffCor(ap.grEffCor),
 	fCentBinEff(ap.fCentBinEff),
 	phiMapIndex(ap.phiMapIndex),
+	fQvectorService(NULL),
 // QA part.
 	fMainList(ap.fMainList),
 	bSaveAllQA(ap.bSaveAllQA),
@@ -182,6 +186,15 @@ AliJCatalystTask::~AliJCatalystTask()
 	delete fInputList;
 	delete fInputListALICE;
 	if (fMainList) {delete fMainList;}
+	delete fQvectorService;
+}
+
+//______________________________________________________________________________
+Int_t AliJCatalystTask::RequestQvectors(Double_t etaGap, Double_t etaMax, Double_t ptMin, Double_t ptMax)
+{
+	if(!fQvectorService)
+		fQvectorService = new AliJQvectorService(AliJFFlucAnalysis::kNH, AliJFFlucAnalysis::nKL);
+	return fQvectorService->AddConfiguration(etaGap, etaMax, ptMin, ptMax);
 }
 
 //________________________________________________________________________
@@ -223,6 +236,8 @@ void AliJCatalystTask::UserExec(Option_t* /*option*/)
 	fJCatalystEntry = fEntry;
 	fInputList->Clear();
 	fInputListALICE->Clear();
+	if(fQvectorService)
+		fQvectorService->Reset();
 
 	float fImpactParameter = .0; // setting 0 for the generator which doesn't have this info. 
 	double fvertex[3];
@@ -342,6 +357,8 @@ void AliJCatalystTask::UserExec(Option_t* /*option*/)
 	} // AOD
 	fZvert = fvertex[2];
 
+	if(fQvectorService)
+		fQvectorService->Fill(fInputList);
 }
 
 //______________________________________________________________________________
@@ -44,6 +44,7 @@ class AliAnalysisFilter;
 class AliJTrack;
 class TParticle;
 class TGraphErrors;
+class AliJQvectorService;
 class AliJCatalystTask : public AliAnalysisTaskSE {
 public:
 	AliJCatalystTask();
@@ -120,6 +121,10 @@ public:
 	bool GetIsGoodEvent(){ return fIsGoodEvent; }
 	void SetNoCentralityBin( bool nocent) { fnoCentBin = nocent;}
 	AliJCorrectionMapTask *GetAliJCorrectionMapTask() {return fJCorMapTask;}
+	// Q-vectors filled once per event from the track list, to be called
+	// before the first event. Returns the configuration index in the service.
+	Int_t RequestQvectors(Double_t etaGap, Double_t etaMax, Double_t ptMin = 0., Double_t ptMax = 0.);
+	AliJQvectorService *GetQvectorService() const{return fQvectorService;}
 
 // Methods to provide QA output.
   TList* GetCataList() const {return fMainList;}
@@ -170,6 +175,7 @@ private:
 	TGraphErrors *grEffCor; // for one cent
 	TAxis *fCentBinEff; // for different cent bin for MC eff
 	UInt_t phiMapIndex; //
+	AliJQvectorService *fQvectorService; //! Q-vectors shared by the analyses
 
 // Data members for the QA of the catalyst.
 	TList *fMainList;		// Mother list containing all possible output of the catalyst task.
@@ -195,6 +201,6 @@ private:
   TH1F *fVertexYHistogram[16][2];		//! 0: Vertex Y Before Corresponding, 1: Vertex Y After Corresponding Cut.
   TH1F *fVertexZHistogram[16][2];		//! 0: Vertex Z Before Corresponding, 1: Vertex Z After Corresponding Cut.
 
-	ClassDef(AliJCatalystTask, 2);
+	ClassDef(AliJCatalystTask, 3);
 };
 #endif // AliJCatalystTask_H
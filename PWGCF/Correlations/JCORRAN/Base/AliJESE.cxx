@@ -9,13 +9,14 @@
 #include <AliAODTrack.h>
 #include <AliAODHeader.h>
 #include <AliAODVZERO.h>
+#include "AliESEqnService.h"
 
-AliJESE::AliJESE(){
+AliJESE::AliJESE() : pservice(0), lastRun(0){
 	//
 }
 
 AliJESE::~AliJESE(){
-	//
+	delete pservice;
 }
 
 bool AliJESE::Initialize(){
@@ -51,6 +52,13 @@ bool AliJESE::Initialize(){
 	}
 	for(uint i = 0; i < 90; ++i)
 		psplineQ2c[i] = (TSpline3*)psplf->Get(Form("hqc2Int_%u",i));
+
+	// the splines are tabulated once, the gains and Q recentering are set per run in Getqc2Perc
+	delete pservice;
+	pservice = new AliESEqnService("ESEqnServiceJESE");
+	pservice->AddHarmonic(2);
+	pservice->SetPercentileSplines(AliESEqnService::kV0C,2,90,psplineQ2c);
+	lastRun = 0;
 	
 	return true;
 }
@@ -62,69 +70,31 @@ void AliJESE::Destroy(){
 
 double AliJESE::Getqc2Perc(AliAODEvent *pevent, float cent, uint runN){
 	//
-	TH1D *pmultV0 = (TH1D*)poadb[OBJECT_MULTV0]->GetObject(runN);
-	if(!pmultV0){
-		printf("No mult V0\n");
-		return -1.0;
-	}
-
-	AliAODVZERO *paodV0 = pevent->GetVZEROData();
-
-	double Qxc2 = 0.0, Qyc2 = 0.0, Nc = 0.0;
-	for(uint i = 0; i < 4; ++i){ //V0C
-		for(uint j = 0; j < 8; ++j){
-			uint iv0 = 8*i+j;
-			double mult = paodV0->GetMultiplicity(iv0);
-			double phiV0 = TMath::PiOver4()*(0.5+j);//iv0%8);
-			double multcorr = mult/pmultV0->GetBinContent(iv0+1)*pmultV0->GetBinContent(8*i+1);
-			if(multcorr < 0.0)
-				continue;
-			Qxc2 += TMath::Cos(2.0*phiV0)*multcorr;
-			Qyc2 += TMath::Sin(2.0*phiV0)*multcorr;
-			Nc += multcorr;
+	if(runN != lastRun){
+		TH1D *pmultV0 = (TH1D*)poadb[OBJECT_MULTV0]->GetObject(runN);
+		if(!pmultV0){
+			printf("No mult V0\n");
+			return -1.0;
 		}
-	}
-	if(Nc <= 0.0){
-		printf("Nc <= 0\n");
-		return -1.0;
+		pservice->SetChannelGains(pmultV0);
+		pservice->SetRecentering(AliESEqnService::kV0C,2,(TH1D*)poadb[OBJECT_QXC2M]->GetObject(runN),(TH1D*)poadb[OBJECT_QYC2M]->GetObject(runN));
+		lastRun = runN;
 	}
 
-	double Qxa2 = 0.0, Qya2 = 0.0, Na = 0.0;
-	for(uint i = 4; i < 8; ++i){ //V0A
-		for(uint j = 0; j < 8; ++j){
-			uint iv0 = 8*i+j;
-			double mult = paodV0->GetMultiplicity(iv0);
-			double phiV0 = TMath::PiOver4()*(0.5+j);//iv0%8);
-			double multcorr = mult/pmultV0->GetBinContent(iv0+1)*pmultV0->GetBinContent(8*i+1);
-			if(multcorr < 0.0)
-				continue;
-			Qxa2 += TMath::Cos(2.0*phiV0)*multcorr;
-			Qya2 += TMath::Sin(2.0*phiV0)*multcorr;
-			Na += multcorr;
-		}
-	}
-	if(Na <= 0.0){
+	if(!pservice->Process(pevent,cent))
+		return -1.0;
+	if(pservice->GetMultiplicity(AliESEqnService::kV0C) <= 0.0 || pservice->GetMultiplicity(AliESEqnService::kV0A) <= 0.0){
 		printf("Nc <= 0\n");
 		return -1.0;
 	}
-	
+
 	uint centIndex = (uint)TMath::Floor(cent);
 	if(centIndex >= 90){
 		printf("centIndex > 90\n");
 		return -1.0;
 	}
-	
-	/*double Qxa2corr = (Qxa2-((TH1D*)poadb[OBJECT_QXA2M]->GetObject(runN))->GetBinContent(centIndex+1))/((TH1D*)poadb[OBJECT_QXA2S]->GetObject(runN))->GetBinContent(centIndex+1);
-	double Qya2corr = (Qya2-((TH1D*)poadb[OBJECT_QYA2M]->GetObject(runN))->GetBinContent(centIndex+1))/((TH1D*)poadb[OBJECT_QYA2S]->GetObject(runN))->GetBinContent(centIndex+1);
-	double Qxc2corr = (Qxc2-((TH1D*)poadb[OBJECT_QXC2M]->GetObject(runN))->GetBinContent(centIndex+1))/((TH1D*)poadb[OBJECT_QXC2S]->GetObject(runN))->GetBinContent(centIndex+1);
-	double Qyc2corr = (Qyc2-((TH1D*)poadb[OBJECT_QYC2M]->GetObject(runN))->GetBinContent(centIndex+1))/((TH1D*)poadb[OBJECT_QYC2S]->GetObject(runN))->GetBinContent(centIndex+1);*/
-
-	double Qxc2corrSE = Qxc2-((TH1D*)poadb[OBJECT_QXC2M]->GetObject(runN))->GetBinContent(centIndex+1);
-	double Qyc2corrSE = Qyc2-((TH1D*)poadb[OBJECT_QYC2M]->GetObject(runN))->GetBinContent(centIndex+1);
-
-	double qc2 = TMath::Sqrt((Qxc2corrSE*Qxc2corrSE+Qyc2corrSE*Qyc2corrSE)/Nc);
-	double qc2f = psplineQ2c[centIndex]->Eval(qc2);
 
-	return qc2f;
+	// q2 of V0C recentered by the mean of the run, percentile from the splines
+	return pservice->GetPercentile(AliESEqnService::kV0C,pservice->GetHarmonicIndex(2));
 }
 
@@ -24,6 +24,8 @@ public:
 	class TFile *poadbf, *psplf;
 	class AliOADBContainer *poadb[OBJECT_COUNT];
 	class TSpline3 *psplineQ2c[90];
+	class AliESEqnService *pservice; // V0 q2 with the calibration of the current run
+	uint lastRun;
 };
 
 #endif
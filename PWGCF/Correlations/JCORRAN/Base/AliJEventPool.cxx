@@ -22,63 +22,52 @@
 // blah
 
 AliJEventPool::AliJEventPool(AliJCard *cardin, AliJHistogramInterface *histosin, AliJCorrelationInterface *coin, particleType particle ) :
+  fBins(),
   fcard(cardin),
   fcorrelations(coin),
   fhistos(histosin),
-  //ftk(NULL),
-  //ftk1(NULL),
-  //ftk2(NULL),
   fthisPoolType(particle),
-  fpoolList(NULL)
+  fColumnar(false),
+  fassoc(NULL)
 {       
   // constructor
-  
-  if(fcard->GetNoOfBins(kCentrType) > kMaxNoCentrBin ){
-    cout<<"ERROR: No of Centrality bins exceed max dim in AliJEventPool.h"<<endl;
-    exit(0);
-  }
-  for(int ic=0;ic<fcard->GetNoOfBins(kCentrType);ic++){
+
+  // photons, pi0 and MC tracks carry more than the base track, keep the objects
+  fColumnar = !( particle == kJPhoton || particle == kJDecayphoton ||
+                 particle == kJPizero || particle == kJEta || particle == kJHadronMC );
+
+  fBins.resize(fcard->GetNoOfBins(kCentrType));
+  for(size_t ic=0;ic<fBins.size();ic++){
     cout<<"Mixing pool depth for icbin = "<< ic << " is " << fcard->GetEventPoolDepth(ic) <<" for <"<<kParticleTypeStrName[particle] <<"> and prototype "<<kParticleProtoType[particle]<<endl;
-    if(fcard->GetEventPoolDepth(ic) > MAXNOEVENT ){
-      cout<<"ERROR: Event pool depth exeed max="<<MAXNOEVENT<<" in AliJEventPool.h"<<endl;
-      exit(0);
+    fBins[ic].fEvents.resize(fcard->GetEventPoolDepth(ic));
+    if( !fColumnar ){
+      for(size_t ie=0;ie<fBins[ic].fEvents.size(); ie++){
+        fBins[ic].fEvents[ie].fList = new TClonesArray(kParticleProtoType[particle],1500);
+      }
     }
   } cout <<endl; 
 
-  for(int ic=0;ic<fcard->GetNoOfBins(kCentrType);ic++){
-    for(int ie=0;ie<fcard->GetEventPoolDepth(ic); ie++){ 
-      fLists[ic][ie]  = new TClonesArray(kParticleProtoType[particle],1500);
-    }
-    flastAccepted[ic] = -1; //to start from 0
-    fwhereToStore[ic] = -1; //to start from 0
-    fnoMix[ic]    = 0;
-    fnoMixCut[ic] = 0;
-  }
-
-  //ftk  = new AliJBaseTrack;
-  //ftk1 = new AliJBaseTrack;
-  //ftk2 = new AliJBaseTrack;
-
+  fassoc = new AliJBaseTrack;
 }
 
 AliJEventPool::~AliJEventPool( ){
   // destructor
-  //delete ftk;
-  //delete ftk1;
-  //delete ftk2;
+  for(size_t ic=0;ic<fBins.size();ic++){
+    for(size_t ie=0;ie<fBins[ic].fEvents.size(); ie++) delete fBins[ic].fEvents[ie].fList;
+  }
+  delete fassoc;
 }  
 
 AliJEventPool::AliJEventPool(const AliJEventPool& obj) :
+  fBins(),
   fcard(obj.fcard),
   fcorrelations(obj.fcorrelations),
   fhistos(obj.fhistos),
-  //ftk(obj.ftk),
-  //ftk1(obj.ftk1),
-  //ftk2(obj.ftk2),
   fthisPoolType(obj.fthisPoolType),
-  fpoolList(obj.fpoolList)
+  fColumnar(obj.fColumnar),
+  fassoc(new AliJBaseTrack)
 {
-  // copy constructor
+  // copy constructor, the stored events are not copied
   JUNUSED(obj);
 }
 
@@ -87,7 +76,46 @@ AliJEventPool& AliJEventPool::operator=(const AliJEventPool& obj){
   JUNUSED(obj);
   return *this;
 }
-  
+
+//______________________________________________________________________________
+int AliJEventPool::PoolEvent::GetEntries() const {
+  // number of stored tracks
+  return fList ? fList->GetEntriesFast() : (int)fPt.size();
+}
+
+//______________________________________________________________________________
+void AliJEventPool::PoolEvent::Clear() {
+  // remove stored tracks, keeping the memory
+  if( fList ) fList->Clear();
+  fPt.clear(); fEta.clear(); fPhi.clear(); fMass.clear(); fWeight.clear();
+  fCharge.clear(); fID.clear(); fAssocBin.clear(); fType.clear();
+}
+
+//______________________________________________________________________________
+bool AliJEventPool::IsGoodForMix(PoolBin &bin, const PoolEvent &pooled, int cBin, int zBin, float cent, float thisMult, int iev){
+  // mixing cuts between the current and a pooled event
+  if( pooled.GetEntries()<=0 ) return false;
+  bin.fnoMix++;
+  if( fcard->SimilarCentrality(pooled.fcentrality, cent, cBin) &&
+      fcard->SimilarMultiplicity(pooled.fmult, thisMult) &&
+      fcard->GetBin(kZVertType, pooled.fZVertex)==zBin      &&
+      pooled.fevent != iev ){
+    bin.fnoMixCut++;
+    return true;
+  }
+  return false;
+}
+
+//______________________________________________________________________________
+void AliJEventPool::FillAssoc(const PoolEvent &pooled, int jj){
+  // rebuild associated track jj of a columnar pool in fassoc
+  fassoc->SetPtEtaPhiM( pooled.fPt[jj], pooled.fEta[jj], pooled.fPhi[jj], pooled.fMass[jj] );
+  fassoc->SetID( pooled.fID[jj] );
+  fassoc->SetParticleType( pooled.fType[jj] );
+  fassoc->SetCharge( pooled.fCharge[jj] );
+  fassoc->SetTrackEff( pooled.fWeight[jj] );
+  fassoc->SetAssocBin( pooled.fAssocBin[jj] );
+}
 
 //______________________________________________________________________________
 void AliJEventPool::Mix( TClonesArray *triggList, 
@@ -99,43 +127,66 @@ void AliJEventPool::Mix( TClonesArray *triggList,
     int noTrigg=triggList->GetEntriesFast();
     int noAssoc=0;
 
-    if ( cBin< 0 ) return;
-   
-//     cout << "c: " << cBin << endl;
-
-
-    for(int backCounter=0; backCounter <= flastAccepted[cBin]; backCounter++){
-        fpoolList = fLists [cBin] [backCounter];
-        noAssoc = fpoolList->GetEntries();
-
-        if(noAssoc<=0) continue;
-
-        //mixit=======
-        fnoMix[cBin]++;
-        
-        if( 
-                fcard->SimilarCentrality(fcentrality[cBin][backCounter], cent, cBin) &&
-                fcard->SimilarMultiplicity(fmult[cBin][backCounter], thisMult) &&
-                fcard->GetBin(kZVertType, fZVertex[cBin][backCounter])==zBin      &&
-                fevent[cBin][backCounter] != iev )
-        {
-            fnoMixCut[cBin]++;
-            //=================================================
-            // try to use only one track from each fevent
-            //=================================================
-            for(int ii=0;ii<noTrigg;ii++){
-                AliJBaseTrack *ftk1 = (AliJBaseTrack*)triggList->At(ii);        
-                //fhistos->fhTriggPtBin[kMixed][cBin][iptt]->Fill(ptt); //who needs that?
-                for(int jj=0;jj<noAssoc ;jj++){
-                    AliJBaseTrack *ftk2 = (AliJBaseTrack*)fpoolList->At(jj);
+    if ( cBin< 0 || cBin >= (int)fBins.size() ) return;
+    PoolBin &bin = fBins[cBin];
+
+    for(int backCounter=0; backCounter <= bin.flastAccepted; backCounter++){
+        const PoolEvent &pooled = bin.fEvents[backCounter];
+        if( !IsGoodForMix(bin, pooled, cBin, zBin, cent, thisMult, iev) ) continue;
+        noAssoc = pooled.GetEntries();
+
+        //=================================================
+        // try to use only one track from each fevent
+        //=================================================
+        for(int ii=0;ii<noTrigg;ii++){
+            AliJBaseTrack *ftk1 = (AliJBaseTrack*)triggList->At(ii);        
+            for(int jj=0;jj<noAssoc ;jj++){
+                AliJBaseTrack *ftk2 = fassoc;
+                if( fColumnar ){
+                    if(leadingParticle && ftk1->Pt() < pooled.fPt[jj]) continue;
+                    FillAssoc(pooled, jj);
+                } else {
+                    ftk2 = (AliJBaseTrack*)pooled.fList->At(jj);
                     if(leadingParticle && ftk1->Pt() < ftk2->Pt()) continue; // In leading particle correlations, accept only those associated particles whose pT is lower than that of the trigger
-                    fcorrelations->FillHisto(cFTyp,kMixed, cBin, zBin, ftk1, ftk2);
-                } //inner loop mixing
-            }//outer loop mixing
-        }//if good for mix
+                }
+                fcorrelations->FillHisto(cFTyp,kMixed, cBin, zBin, ftk1, ftk2);
+            } //inner loop mixing
+        }//outer loop mixing
     }//mixed fevent loop
 }
 
+//______________________________________________________________________________
+void AliJEventPool::Mix( TClonesArray *triggList, float cent, float Z, float thisMult, int iev,
+        MixKernel kernel, void *context ){
+  // mixer passing the columns of each pooled event to the kernel
+    if( !fColumnar ){
+        cout<<"ERROR: AliJEventPool::Mix with kernel needs a columnar pool, not <"<<kParticleTypeStrName[fthisPoolType]<<">"<<endl;
+        return;
+    }
+    int cBin = fcard->GetBin(kCentrType, cent);
+    int zBin = fcard->GetBin(kZVertType, Z);
+    int noTrigg=triggList->GetEntriesFast();
+
+    if ( cBin< 0 || cBin >= (int)fBins.size() ) return;
+    PoolBin &bin = fBins[cBin];
+
+    for(int backCounter=0; backCounter <= bin.flastAccepted; backCounter++){
+        const PoolEvent &pooled = bin.fEvents[backCounter];
+        if( !IsGoodForMix(bin, pooled, cBin, zBin, cent, thisMult, iev) ) continue;
+
+        TrackColumns assoc;
+        assoc.fN      = pooled.GetEntries();
+        assoc.fPt     = &pooled.fPt[0];
+        assoc.fEta    = &pooled.fEta[0];
+        assoc.fPhi    = &pooled.fPhi[0];
+        assoc.fWeight = &pooled.fWeight[0];
+        assoc.fCharge = &pooled.fCharge[0];
+        for(int ii=0;ii<noTrigg;ii++){
+            kernel(context, (AliJBaseTrack*)triggList->At(ii), assoc, cBin, zBin);
+        }
+    }
+}
+
 //______________________________________________________________________________
 void AliJEventPool::AcceptList(TClonesArray *inList, float cent, float Z, float inMult, int iev){
     //////////////////////////////////////////////////////////////
@@ -143,34 +194,56 @@ void AliJEventPool::AcceptList(TClonesArray *inList, float cent, float Z, float
     // mixing goes backwards 
     //////////////////////////////////////////////////////////////
     int cBin = fcard->GetBin(kCentrType, cent);
-    if (cBin <0 ) return;
-    flastAccepted[cBin]++;
-    fwhereToStore[cBin]++;
-    if( flastAccepted[cBin] >= fcard->GetEventPoolDepth(cBin) ) flastAccepted[cBin] = fcard->GetEventPoolDepth(cBin)-1;
-    if( fwhereToStore[cBin] >= fcard->GetEventPoolDepth(cBin) ) fwhereToStore[cBin] = 0;
-    fevent     [cBin][fwhereToStore[cBin]] = iev;
-    fZVertex   [cBin][fwhereToStore[cBin]] = Z;
-    fcentrality[cBin][fwhereToStore[cBin]] = cent;
-    fmult      [cBin][fwhereToStore[cBin]] = inMult;
-
-    fLists[cBin][fwhereToStore[cBin]]->Clear();
-    for(int i=0;i<inList->GetEntriesFast();i++){
+    if (cBin <0 || cBin >= (int)fBins.size() ) return;
+    PoolBin &bin = fBins[cBin];
+    long depth = bin.fEvents.size();
+    if( depth <= 0 ) return;
+    bin.flastAccepted++;
+    bin.fwhereToStore++;
+    if( bin.flastAccepted >= depth ) bin.flastAccepted = depth-1;
+    if( bin.fwhereToStore >= depth ) bin.fwhereToStore = 0;
+
+    PoolEvent &pooled = bin.fEvents[bin.fwhereToStore];
+    pooled.fevent      = iev;
+    pooled.fZVertex    = Z;
+    pooled.fcentrality = cent;
+    pooled.fmult       = inMult;
+    pooled.Clear();
+
+    int noTracks = inList->GetEntriesFast();
+    if( fColumnar ){
+        pooled.fPt.reserve(noTracks); pooled.fEta.reserve(noTracks); pooled.fPhi.reserve(noTracks);
+        pooled.fMass.reserve(noTracks); pooled.fWeight.reserve(noTracks); pooled.fCharge.reserve(noTracks);
+        pooled.fID.reserve(noTracks); pooled.fAssocBin.reserve(noTracks); pooled.fType.reserve(noTracks);
+        for(int i=0;i<noTracks;i++){
+            AliJBaseTrack *tk3 = (AliJBaseTrack*)inList->At(i);
+            pooled.fPt.push_back( tk3->Pt() );
+            pooled.fEta.push_back( tk3->Eta() );
+            pooled.fPhi.push_back( tk3->Phi() );
+            pooled.fMass.push_back( tk3->M() );
+            pooled.fWeight.push_back( tk3->GetTrackEff() );
+            pooled.fCharge.push_back( tk3->GetCharge() );
+            pooled.fID.push_back( tk3->GetID() );
+            pooled.fAssocBin.push_back( tk3->GetAssocBin() );
+            pooled.fType.push_back( tk3->GetParticleType() );
+        }
+        return;
+    }
+
+    TClonesArray &list = *pooled.fList;
+    for(int i=0;i<noTracks;i++){
 				if( fthisPoolType == kJPhoton || fthisPoolType == kJDecayphoton ){
 					AliJPhoton *tkp = (AliJPhoton*)inList->At(i);
-					new ((*fLists[cBin][fwhereToStore[cBin]])[i]) AliJPhoton(*tkp);
+					new (list[i]) AliJPhoton(*tkp);
 				}
 				else if( fthisPoolType == kJPizero || fthisPoolType == kJEta ){
 					AliJPiZero *tkpz = (AliJPiZero*)inList->At(i);
-					new ((*fLists[cBin][fwhereToStore[cBin]])[i]) AliJPiZero(*tkpz);
+					new (list[i]) AliJPiZero(*tkpz);
 				}
         else if ( fthisPoolType == kJHadronMC ){
           AliJMCTrack *mcTrack = (AliJMCTrack*)inList->At(i);
-          new ((*fLists[cBin][fwhereToStore[cBin]])[i]) AliJMCTrack(*mcTrack);
+          new (list[i]) AliJMCTrack(*mcTrack);
         }
-				else{
-					AliJBaseTrack *tk3 = (AliJBaseTrack*)inList->At(i);
-					new ((*fLists[cBin][fwhereToStore[cBin]])[i]) AliJBaseTrack(*tk3);
-				}
     }
 
 }
@@ -15,6 +15,8 @@ using namespace std;
 
 #include "AliJConst.h"
 
+#include <vector>
+
 class TClonesArray;
 class AliJBaseTrack;
 class AliJPhoton;
@@ -25,8 +27,13 @@ class AliJCorrelationInterface;
 class AliJHistogramInterface;
 class TH1D;
 
-#define   MAXNOEVENT 2000    // Maximum no of events in pools (400 used for QM anal.) 
-
+//==============================================================
+// Pool of events for mixing, one ring buffer per centrality bin
+// with the depth given by the card.
+// Tracks of hadron pools are stored as columns (pt, eta, phi,
+// mass, charge, efficiency, id, assoc bin, particle type); other
+// pools (photons, pi0, MC) keep copies of the track objects.
+//==============================================================
 class AliJEventPool {
 
     public:
@@ -34,44 +41,80 @@ class AliJEventPool {
       virtual ~AliJEventPool( );
       AliJEventPool(const AliJEventPool& obj);
       AliJEventPool& operator=(const AliJEventPool& obj);
-  
+
+      // associated tracks of one pooled event, see Mix with kernel
+      struct TrackColumns {
+        int           fN;        // number of tracks
+        const float  *fPt;       // pt
+        const float  *fEta;      // pseudorapidity
+        const float  *fPhi;      // azimuth
+        const float  *fWeight;   // track efficiency
+        const Char_t *fCharge;   // charge
+      };
+      // called for each trigger and each pooled event passing the mixing cuts
+      typedef void (*MixKernel)(void *context, AliJBaseTrack *trigger, const TrackColumns &assoc, int cBin, int zBin);
 
     public:
         void Mix( TClonesArray *triggList, 
                 corrFillType cFTyp, 
                 float cent, float Z, float thisMult, int iev, bool leadingParticle = false);
 
+        // same event selection as above, the kernel loops over the associated columns
+        void Mix( TClonesArray *triggList, float cent, float Z, float thisMult, int iev,
+                MixKernel kernel, void *context );
+
        //void MixRNDM( AliJEventPool *cross, void (AliJCorrelationInterface::*fillHisto)(fillType, int, AliJBaseTrack*, AliJBaseTrack*) );
 
         void AcceptList(TClonesArray *inList, float cent, float Z, float inMult, int iev);
 
         void Mysample(TH1D *fromh, TH1D *toh );
-        void PrintOut(){for(int i=0;i<kMaxNoCentrBin;i++)
-            cout<<"c: "<<i<<" mixed "<<fnoMix[i]<<" accepted "<<fnoMixCut[i]<<" "<<(fnoMix[i]>0?fnoMixCut[i]*1.0/fnoMix[i]:0)<< endl;}
+        void PrintOut(){for(size_t i=0;i<fBins.size();i++)
+            cout<<"c: "<<i<<" mixed "<<fBins[i].fnoMix<<" accepted "<<fBins[i].fnoMixCut<<" "<<(fBins[i].fnoMix>0?fBins[i].fnoMixCut*1.0/fBins[i].fnoMix:0)<< endl;}
 
-    protected:
+        bool IsColumnar() const { return fColumnar; }
 
-        int   fevent[kMaxNoCentrBin][MAXNOEVENT];  // comment me
-        float fZVertex[kMaxNoCentrBin][MAXNOEVENT];  // comment me
-        float fcentrality[kMaxNoCentrBin][MAXNOEVENT];  // comment me
-        float fmult[kMaxNoCentrBin][MAXNOEVENT];  // comment me
-        long  flastAccepted[kMaxNoCentrBin];  // comment me
-        long fwhereToStore[kMaxNoCentrBin];   // comment me
-        long fnoMix[kMaxNoCentrBin];  // comment me
-        long fnoMixCut[kMaxNoCentrBin];   // comment me
+    protected:
 
-        TClonesArray   *fLists[kMaxNoCentrBin][MAXNOEVENT]; // mix lists
+        // one stored event
+        struct PoolEvent {
+          int   fevent;       // event number
+          float fZVertex;     // z vertex
+          float fcentrality;  // centrality
+          float fmult;        // multiplicity
+          // columns of the tracks (columnar pools)
+          std::vector<float>  fPt, fEta, fPhi, fMass, fWeight;
+          std::vector<Char_t> fCharge;
+          std::vector<Int_t>  fID, fAssocBin;
+          std::vector<Short_t> fType;
+          TClonesArray *fList; // copies of the tracks (other pools)
+
+          PoolEvent() : fevent(-1), fZVertex(0), fcentrality(0), fmult(0), fPt(), fEta(), fPhi(), fMass(),
+                        fWeight(), fCharge(), fID(), fAssocBin(), fType(), fList(NULL) {}
+          int GetEntries() const;
+          void Clear();
+        };
+
+        // ring buffer of one centrality bin
+        struct PoolBin {
+          std::vector<PoolEvent> fEvents; // stored events
+          long  flastAccepted;  // index of the last filled slot while not full
+          long  fwhereToStore;  // slot of the last stored event
+          long  fnoMix;         // number of tried mixings
+          long  fnoMixCut;      // number of mixings passing the cuts
+          PoolBin() : fEvents(), flastAccepted(-1), fwhereToStore(-1), fnoMix(0), fnoMixCut(0) {}
+        };
+
+        // pooled event usable for mixing with the current one
+        bool IsGoodForMix(PoolBin &bin, const PoolEvent &pooled, int cBin, int zBin, float cent, float thisMult, int iev);
+        void FillAssoc(const PoolEvent &pooled, int jj);
+
+        std::vector<PoolBin> fBins; // pools of the centrality bins
         AliJCard  *fcard;  // card
         AliJCorrelationInterface *fcorrelations; // correlation object
         AliJHistogramInterface *fhistos;  // histos
-        //AliJBaseTrack *ftk; // track
-        //AliJBaseTrack *ftk1; // track
-        //AliJBaseTrack *ftk2; // track
         particleType fthisPoolType; // pool type
-
-        TClonesArray  *fpoolList;  // pool list
-
-        //int   trials[MAXNOEVENT];
+        bool  fColumnar;            // tracks stored as columns
+        AliJBaseTrack *fassoc;      // associated track rebuilt from the columns
 
 };
 
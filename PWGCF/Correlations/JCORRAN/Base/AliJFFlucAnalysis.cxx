@@ -6,6 +6,7 @@
 #include <TComplex.h>
 #include <TClonesArray.h>
 #include "AliJBaseTrack.h"
+#include "AliJQvectorService.h"
 #include "AliJFFlucAnalysis.h"
 #pragma GCC diagnostic warning "-Wall"
 
@@ -52,6 +53,8 @@ AliJFFlucAnalysis::AliJFFlucAnalysis() :
 	fQC_eta_cut_max = 0.8; // default setting
 	fQC_eta_gap_half = 0.4;
 	fImpactParameter = -1;
+	fQvectorService = 0;
+	fQvectorConfig = -1;
 }
 
 //________________________________________________________________________
@@ -97,6 +100,8 @@ AliJFFlucAnalysis::AliJFFlucAnalysis(const char *name) :
 	fQC_eta_cut_max = 0.8; // default setting
 	fQC_eta_gap_half = 0.4;
 	fImpactParameter = -1;
+	fQvectorService = 0;
+	fQvectorConfig = -1;
 }
 
 //Double_t AliJFFlucAnalysis::CentBin[8] = {0, 5, 10, 20, 30, 40, 50, 60};
@@ -150,6 +155,8 @@ AliJFFlucAnalysis::AliJFFlucAnalysis(const AliJFFlucAnalysis& a):
 	fh_cn_cn_2c_eta10(a.fh_cn_cn_2c_eta10)*/
 {
 	//copy constructor
+	fQvectorService = a.fQvectorService;
+	fQvectorConfig = a.fQvectorConfig;
 	//	DefineOutput(1, TList::Class() );
 }
 //________________________________________________________________________
@@ -838,6 +845,17 @@ void AliJFFlucAnalysis::CalculateQvectorsQC(double etamin, double etamax){
 			}
 		}
 	} // for max harmonics
+	if(fQvectorService){
+		// filled once per event for all the analyses of the train
+		for(int ih=0; ih<kNH; ih++){
+			for(int ik=0; ik<nKL; ik++){
+				QvectorQC[ih][ik] = fQvectorService->Q(fQvectorConfig,AliJQvectorService::kFull,ih,ik);
+				for(int isub=0; isub<2; isub++)
+					QvectorQCeta10[isub][ih][ik] = fQvectorService->Q(fQvectorConfig,AliJQvectorService::kSubA+isub,ih,ik);
+			}
+		}
+		return;
+	}
 	//Calculate Q-vector with particle loop
 	Long64_t ntracks = fInputList->GetEntriesFast(); // all tracks from Task input
 	for( Long64_t it=0; it<ntracks; it++){
@@ -8,6 +8,7 @@
 //#include <TF3.h>
 
 class TClonesArray;
+class AliJQvectorService;
 
 class AliJFFlucAnalysis{// : public AliAnalysisTaskSE {
 public:
@@ -61,6 +62,13 @@ public:
 	double Get_ScaledMoments( int k, int harmonics);
 	//AliJEfficiency* GetAliJEfficiency() const{return fEfficiency;}
 
+	// Q-vectors of the QC method from a shared service, configuration with the
+	// eta gap fEta_min and eta range fEta_max, instead of the own track loop
+	void SetQvectorService(AliJQvectorService *service, Int_t config){
+		fQvectorService = service;
+		fQvectorConfig = config;
+	}
+
 	// new function for QC method //
 	void CalculateQvectorsQC(double, double);
 	TComplex Q(int n, int p);
@@ -142,6 +150,8 @@ private:
 
 	TComplex QvectorQC[kNH][nKL];
 	TComplex QvectorQCeta10[2][kNH][nKL]; // ksub
+	AliJQvectorService *fQvectorService;//!
+	Int_t fQvectorConfig;
 
 	AliJHistManager * fHMG;//!
 
@@ -0,0 +1,100 @@
+#include <TClonesArray.h>
+#include <TMath.h>
+#include "AliGFWCumulant.h"
+#include "AliJBaseTrack.h"
+#include "AliJQvectorService.h"
+
+//______________________________________________________________________________
+AliJQvectorService::AliJQvectorService(Int_t nHarmonics, Int_t nPowers):
+	fNHarmonics(nHarmonics),
+	fNPowers(nPowers),
+	fConfigs(),
+	fQvectors()
+{
+	//
+}
+
+//______________________________________________________________________________
+AliJQvectorService::~AliJQvectorService()
+{
+	for(UInt_t i=0; i<fQvectors.size(); i++){
+		fQvectors[i]->DestroyComplexVectorArray();
+		delete fQvectors[i];
+	}
+}
+
+//______________________________________________________________________________
+Int_t AliJQvectorService::AddConfiguration(Double_t etaGap, Double_t etaMax, Double_t ptMin, Double_t ptMax)
+{
+	for(UInt_t i=0; i<fConfigs.size(); i++){
+		const Config &c = fConfigs[i];
+		if(c.fEtaGap == etaGap && c.fEtaMax == etaMax && c.fPtMin == ptMin && c.fPtMax == ptMax)
+			return i;
+	}
+	Config c = {etaGap, etaMax, ptMin, ptMax};
+	fConfigs.push_back(c);
+	for(int ir=0; ir<kNRegions; ir++){
+		AliGFWCumulant *q = new AliGFWCumulant();
+		q->CreateComplexVectorArray(fNHarmonics, fNPowers, 1);
+		fQvectors.push_back(q);
+	}
+	return fConfigs.size()-1;
+}
+
+//______________________________________________________________________________
+void AliJQvectorService::Reset()
+{
+	for(UInt_t i=0; i<fQvectors.size(); i++)
+		fQvectors[i]->ResetQs();
+}
+
+//______________________________________________________________________________
+void AliJQvectorService::Fill(const TClonesArray *tracks)
+{
+	Reset();
+	const Int_t ntracks = tracks->GetEntriesFast();
+	if(ntracks == 0 || fConfigs.empty())
+		return;
+
+	// track variables once for all configurations
+	fEta.resize(ntracks);
+	fPt.resize(ntracks);
+	fPhi.resize(ntracks);
+	fWeight.resize(ntracks);
+	fPtBin.assign(ntracks, 0);
+	for(Int_t it=0; it<ntracks; it++){
+		AliJBaseTrack *itrack = (AliJBaseTrack*)tracks->At(it);
+		fEta[it] = itrack->Eta();
+		fPt[it] = itrack->Pt();
+		fPhi[it] = itrack->Phi();
+		fWeight[it] = 1.0/(itrack->GetWeight()*itrack->GetTrackEff());
+	}
+
+	for(UInt_t ic=0; ic<fConfigs.size(); ic++){
+		const Config &c = fConfigs[ic];
+		const Bool_t ptCut = c.fPtMax > c.fPtMin;
+		for(int ir=0; ir<kNRegions; ir++)
+			fIndices[ir].clear();
+		for(Int_t it=0; it<ntracks; it++){
+			const Double_t eta = fEta[it];
+			if(eta < -c.fEtaMax || eta > c.fEtaMax)
+				continue;
+			if(ptCut && (fPt[it] <= c.fPtMin || fPt[it] >= c.fPtMax))
+				continue;
+			fIndices[kFull].push_back(it);
+			if(TMath::Abs(eta) > c.fEtaGap)
+				fIndices[(eta > 0.0)?kSubB:kSubA].push_back(it);
+		}
+		for(int ir=0; ir<kNRegions; ir++){
+			if(fIndices[ir].empty())
+				continue;
+			fQvectors[ic*kNRegions+ir]->FillArray(fIndices[ir].size(), &fIndices[ir][0], &fPtBin[0], &fPhi[0], &fWeight[0]);
+		}
+	}
+}
+
+//______________________________________________________________________________
+TComplex AliJQvectorService::Q(Int_t config, Int_t region, Int_t n, Int_t p) const
+{
+	return fQvectors[config*kNRegions+region]->Vec(n, p);
+}
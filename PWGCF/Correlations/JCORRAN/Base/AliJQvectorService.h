@@ -0,0 +1,67 @@
+#ifndef ALIJQVECTORSERVICE_H
+#define ALIJQVECTORSERVICE_H
+
+//______________________________________________________________________________
+// Q-vectors shared by the analyses running on the same catalyst output.
+// Each configuration (eta range, eta gap, optional pt range) is filled once
+// per event for the full range and the two subevents separated by the gap,
+// Q(n,p) = sum w^p exp(i n phi) with w = 1/(phi weight * efficiency) as in
+// AliJFFlucAnalysis. The sums are done by AliGFWCumulant, so that JCORRAN
+// and the generic framework agree numerically.
+//////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <TComplex.h>
+
+class TClonesArray;
+class AliGFWCumulant;
+
+class AliJQvectorService {
+public:
+	AliJQvectorService(Int_t nHarmonics = 13, Int_t nPowers = 5);
+	virtual ~AliJQvectorService();
+
+	enum REGION{
+		kFull,  // -etaMax <= eta <= etaMax
+		kSubA,  // eta < -etaGap
+		kSubB,  // eta > etaGap
+		kNRegions
+	};
+
+	// returns the index of the configuration, equal configurations are shared
+	Int_t AddConfiguration(Double_t etaGap, Double_t etaMax, Double_t ptMin = 0., Double_t ptMax = 0.);
+	Int_t GetNConfigurations() const{return fConfigs.size();}
+	Int_t GetNHarmonics() const{return fNHarmonics;}
+	Int_t GetNPowers() const{return fNPowers;}
+
+	void Reset();
+	void Fill(const TClonesArray *tracks);
+	// Q(-n,p) = Q(n,p)*
+	TComplex Q(Int_t config, Int_t region, Int_t n, Int_t p) const;
+
+private:
+	AliJQvectorService(const AliJQvectorService&); // not implemented
+	AliJQvectorService& operator=(const AliJQvectorService&); // not implemented
+
+	struct Config {
+		Double_t fEtaGap;
+		Double_t fEtaMax;
+		Double_t fPtMin;
+		Double_t fPtMax; // no pt cut if not above fPtMin
+	};
+
+	Int_t fNHarmonics;
+	Int_t fNPowers;
+	std::vector<Config> fConfigs;
+	std::vector<AliGFWCumulant*> fQvectors; // [config][region]
+
+	// tracks of the current event
+	std::vector<Double_t> fEta;
+	std::vector<Double_t> fPt;
+	std::vector<Double_t> fPhi;
+	std::vector<Double_t> fWeight;
+	std::vector<Int_t> fPtBin;
+	std::vector<Int_t> fIndices[kNRegions];
+};
+
+#endif
@@ -166,6 +166,11 @@ void AliJHSInterplayTask::UserCreateOutputObjects(){
 	if(flags & HSINT_PHI_CORRECTION)
 		fFFlucAna->AddFlags(AliJFFlucAnalysis::FLUC_PHI_CORRECTION);
 	// fFFlucAna->SetQCEtaCut( -0.8, 0.8, 0.4 ); // not used anymore and need to check with JP
+	// same eta and pt ranges as in UserExec
+	if(flags & HSINT_CATALYST_QVECTORS){
+		Int_t qconfig = fJCatalystTask->RequestQvectors(0.4, 0.8, 0.2, 5.);
+		fFFlucAna->SetQvectorService(fJCatalystTask->GetQvectorService(), qconfig);
+	}
 
 	fOutput->cd();
 	//fFFlucAna->SetEffConfig( fJCatalystTask->GetEffMode(), fJCatalystTask->GetEffFilterBit() );
@@ -45,7 +45,8 @@ class AliJHSInterplayTask : public AliAnalysisTaskSE {
 		enum HSINT{
 			HSINT_SCPT = 0x1,
 			HSINT_EBE_WEIGHTING = 0x2,
-			HSINT_PHI_CORRECTION = 0x4
+			HSINT_PHI_CORRECTION = 0x4,
+			HSINT_CATALYST_QVECTORS = 0x8 // Q-vectors from the catalyst, shared with the other wagons
 		};
 		void AddFlags(UInt_t flags1){
 			flags |= flags1;
@@ -22,6 +22,8 @@
 
 //ROOT
 #include <Riostream.h>
+#include <algorithm>
+#include <vector>
 #include <TCanvas.h>
 #include <TMath.h>
 #include <TAxis.h>
@@ -48,6 +50,94 @@ using std::cerr;
 
 ClassImp(AliBalancePsi)
 
+namespace {
+
+  // associated particles of one charge sign, sorted by pT
+  struct BFAssocTracks {
+    std::vector<Float_t>  fEta;
+    std::vector<Float_t>  fPhi;
+    std::vector<Float_t>  fPt;
+    std::vector<Double_t> fCorrection;
+    std::vector<Int_t>    fIndex;   // index in the particle array
+    std::vector<Int_t>    fPtBin;   // bin on the pT,assoc axis
+  };
+
+  // TAxis::FindBin without the call for fixed bin widths
+  class BFAxisBinner {
+  public:
+    explicit BFAxisBinner(TAxis *axis) :
+      fAxis(axis), fFixed(axis->GetXbins()->GetSize() == 0),
+      fNbins(axis->GetNbins()), fMin(axis->GetXmin()), fMax(axis->GetXmax()),
+      fScale(axis->GetNbins() / (axis->GetXmax() - axis->GetXmin())) { }
+    Int_t FindBin(Double_t x) const {
+      if (!fFixed) return fAxis->FindBin(x);
+      if (x < fMin) return 0;
+      if (x >= fMax) return fNbins + 1;
+      return 1 + Int_t(fScale * (x - fMin));
+    }
+  private:
+    TAxis   *fAxis;
+    Bool_t   fFixed;
+    Int_t    fNbins;
+    Double_t fMin, fMax, fScale;
+  };
+
+  // scratch buffers of the pairs of one trigger
+  struct BFPairBuffers {
+    std::vector<Double_t> fDeltaEta;
+    std::vector<Double_t> fDeltaPhi;
+    std::vector<Int_t>    fBins;
+    std::vector<Double_t> fWeights;
+  };
+
+  //____________________________________________________________________//
+  void FillPairsOfTrigger(AliTHn *hist, const BFAssocTracks &assoc, Int_t nAssoc,
+			  Float_t eta, Float_t phi, Double_t correction,
+			  const Int_t *trigBins, Int_t excludedIndex,
+			  const BFAxisBinner &etaBinner, const BFAxisBinner &phiBinner,
+			  BFPairBuffers &buf) {
+    // fills the pairs of a trigger with the first nAssoc associated particles,
+    // same variables as the pair loop of AliBalancePsi::CalculateBalance
+    if (nAssoc <= 0) return;
+    if ((Int_t)buf.fDeltaEta.size() < nAssoc) {
+      buf.fDeltaEta.resize(nAssoc);
+      buf.fDeltaPhi.resize(nAssoc);
+      buf.fBins.resize(nAssoc * kTrackVariablesPair);
+      buf.fWeights.resize(nAssoc);
+    }
+    Double_t *dEta = &buf.fDeltaEta[0];
+    Double_t *dPhi = &buf.fDeltaPhi[0];
+    const Float_t *assocEta = &assoc.fEta[0];
+    const Float_t *assocPhi = &assoc.fPhi[0];
+
+    // delta eta, delta phi between -pi/2 and 3pi/2
+    const Double_t kPi = TMath::Pi();
+    for (Int_t k = 0; k < nAssoc; k++) {
+      Double_t d = phi - assocPhi[k];
+      d += (d > kPi) ? -2.*kPi : 0.;
+      d += (d < -kPi) ? 2.*kPi : 0.;
+      d += (d < -kPi/2.) ? 2.*kPi : 0.;
+      dEta[k] = eta - assocEta[k];
+      dPhi[k] = d;
+    }
+
+    Int_t nEntries = 0;
+    for (Int_t k = 0; k < nAssoc; k++) {
+      if (assoc.fIndex[k] == excludedIndex) continue;
+      Int_t *bins = &buf.fBins[nEntries * kTrackVariablesPair];
+      bins[0] = trigBins[0];
+      bins[1] = etaBinner.FindBin(dEta[k]);
+      bins[2] = phiBinner.FindBin(dPhi[k]);
+      bins[3] = trigBins[3];
+      bins[4] = assoc.fPtBin[k];
+      bins[5] = trigBins[5];
+      buf.fWeights[nEntries] = correction * assoc.fCorrection[k];
+      nEntries++;
+    }
+    hist->FillBins(nEntries, &buf.fBins[0], 0, &buf.fWeights[0]);
+  }
+}
+
 //____________________________________________________________________//
 AliBalancePsi::AliBalancePsi() :
   TObject(), 
@@ -485,6 +575,33 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
     if (fResonancesLabelCut) secondMotherLabel[i] = (Int_t)((AliBFBasicParticle*) particlesSecond->At(i))->GetMotherLabel();
   }
   
+  // without pair cuts the pairs of a trigger are filled in one go from the
+  // associated particles split by charge and sorted by pT
+  const Bool_t bulkPairs = !(fResonancesCut || fResonancePhiCut || fResonancesLabelCut ||
+			     fHBTCut || fSameLabelMCCut || fConversionCut || fQCut);
+  BFAssocTracks assocPos, assocNeg;
+  BFPairBuffers pairBuffers;
+  if (bulkPairs) {
+    std::vector<Int_t> order;
+    order.reserve(jMax);
+    for (Int_t j = 0; j < jMax; j++)
+      if (secondTrigOrAssoc[j] != 0 && secondCharge[j] != 0) order.push_back(j);
+    std::stable_sort(order.begin(), order.end(),
+		     [&secondPt](Int_t a, Int_t b) { return secondPt[a] < secondPt[b]; });
+    for (size_t k = 0; k < order.size(); k++) {
+      Int_t j = order[k];
+      BFAssocTracks &assoc = (secondCharge[j] > 0) ? assocPos : assocNeg;
+      assoc.fEta.push_back(secondEta[j]);
+      assoc.fPhi.push_back(secondPhi[j]);
+      assoc.fPt.push_back(secondPt[j]);
+      assoc.fCorrection.push_back(secondCorrection[j]);
+      assoc.fIndex.push_back(j);
+      assoc.fPtBin.push_back(fHistPN->FindBin(4, secondPt[j]));
+    }
+  }
+  const BFAxisBinner etaBinner(fHistPN->GetAxis(1, 0));
+  const BFAxisBinner phiBinner(fHistPN->GetAxis(2, 0));
+
   //TLorenzVector implementation for resonances
   TLorentzVector vectorMother, vectorDaughter[2];
   TParticle pPion, pProton, pRho0, pK0s, pLambda, pKaon, pPhi;
@@ -560,6 +677,25 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
     //fill single particle histograms
     if(charge1 > 0)      fHistP->Fill(trackVariablesSingle,0,firstCorrection); //==========================correction
     else if(charge1 < 0) fHistN->Fill(trackVariablesSingle,0,firstCorrection);  //==========================correction
+
+    if (bulkPairs) {
+      if (charge1 == 0) continue;
+      Int_t trigBins[kTrackVariablesPair] = {0};
+      trigBins[0] = fHistPN->FindBin(0, trackVariablesSingle[0]);
+      trigBins[3] = fHistPN->FindBin(3, firstPt);
+      trigBins[5] = fHistPN->FindBin(5, vertexZ);
+      Int_t excludedIndex = (particlesMixed) ? -1 : i;
+      for (Int_t iCharge = 0; iCharge < 2; iCharge++) {
+	const BFAssocTracks &assoc = (iCharge == 0) ? assocPos : assocNeg;
+	AliTHn *hist = (charge1 > 0) ? ((iCharge == 0) ? fHistPP : fHistPN) : ((iCharge == 0) ? fHistNP : fHistNN);
+	// pT,Assoc <= pT,Trig with momentum ordering
+	Int_t nAssoc = (fMomentumOrdering) ?
+	  std::upper_bound(assoc.fPt.begin(), assoc.fPt.end(), firstPt) - assoc.fPt.begin() : assoc.fPt.size();
+	FillPairsOfTrigger(hist, assoc, nAssoc, firstEta, firstPhi, firstCorrection,
+			   trigBins, excludedIndex, etaBinner, phiBinner, pairBuffers);
+      }
+      continue;
+    }
     
     // 2nd particle loop
     for(Int_t j = 0; j < jMax; j++) {   
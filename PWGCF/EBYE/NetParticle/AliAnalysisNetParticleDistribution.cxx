@@ -20,6 +20,7 @@
 #include "AliAODTrack.h"
 #include "AliAODMCParticle.h"
 
+#include "AliAnalysisNetParticleMoments.h"
 #include "AliAnalysisNetParticleDistribution.h"
 
 using namespace std;
@@ -596,6 +597,13 @@ void  AliAnalysisNetParticleDistribution::AddHistSetCent(const Char_t *name, con
   Int_t nBinsCent         =  AliAnalysisNetParticleHelper::fgkfHistNBinsCent;
   Double_t centBinRange[] = {AliAnalysisNetParticleHelper::fgkfHistRangeCent[0], AliAnalysisNetParticleHelper::fgkfHistRangeCent[1]};
 
+  // -- Add moment accumulator - size independent of the number of events
+  list->Add(new AliAnalysisNetParticleMoments(Form("m%sNet%s", name, fHelper->GetParticleName(1).Data()), sTitle,
+					      fOrder, nBinsCent, 1, fHelper->GetNSubSamples()));
+
+  if (fHelper->GetModeDistCreation() == 2)
+    return;
+
   // -- Create Titles
   TString sNetTitle(Form("N_{%s} - N_{%s}", fHelper->GetParticleTitleLatex(1).Data(), fHelper->GetParticleTitleLatex(0).Data()));
   TString sSumTitle(Form("N_{%s} + N_{%s}", fHelper->GetParticleTitleLatex(1).Data(), fHelper->GetParticleTitleLatex(0).Data()));
@@ -726,6 +734,13 @@ void  AliAnalysisNetParticleDistribution::AddHistSetCentPt(const Char_t *name, c
   Int_t nBinsCent         =  AliAnalysisNetParticleHelper::fgkfHistNBinsCent;
   Double_t centBinRange[] = {AliAnalysisNetParticleHelper::fgkfHistRangeCent[0], AliAnalysisNetParticleHelper::fgkfHistRangeCent[1]};
 
+  // -- Add moment accumulator - size independent of the number of events
+  list->Add(new AliAnalysisNetParticleMoments(Form("m%sNet%s", name, fHelper->GetParticleName(1).Data()), sTitle,
+					      fOrder, nBinsCent, nBinsPt, fHelper->GetNSubSamples()));
+
+  if (fHelper->GetModeDistCreation() == 2)
+    return;
+
   // -- Create Titles
   TString sNetTitle(Form("N_{%s} - N_{%s}", fHelper->GetParticleTitleLatex(1).Data(), fHelper->GetParticleTitleLatex(0).Data()));
   TString sSumTitle(Form("N_{%s} + N_{%s}", fHelper->GetParticleTitleLatex(1).Data(), fHelper->GetParticleTitleLatex(0).Data()));
@@ -832,6 +847,13 @@ void AliAnalysisNetParticleDistribution::FillHistSetCent(const Char_t *name, Int
 
   // -----------------------------------------------------------------------------------------------
 
+  // -- Fill moment accumulator : n1 -> p, n2 -> pbar
+  (static_cast<AliAnalysisNetParticleMoments*>(list->FindObject(Form("m%sNet%s", name, fHelper->GetParticleName(1).Data()))))
+    ->Fill(Int_t(centralityBin), 0, np[idx][1], np[idx][0], fHelper->GetSubSampleIdx());
+
+  if (fHelper->GetModeDistCreation() == 2)
+    return;
+
   Int_t sumNp   = np[idx][1]+np[idx][0];  // p + pbar
   Int_t deltaNp = np[idx][1]-np[idx][0];  // p - pbar
 
@@ -925,6 +947,14 @@ void AliAnalysisNetParticleDistribution::FillHistSetCentPt(const Char_t *name, I
   // -- Select MC or Data
   Int_t ***npPt = (isMC) ? fMCNpPt : fNpPt;
 
+  // -- Fill moment accumulator : n1 -> p, n2 -> pbar
+  AliAnalysisNetParticleMoments *moments = static_cast<AliAnalysisNetParticleMoments*>(list->FindObject(Form("m%sNet%s", name, fHelper->GetParticleName(1).Data())));
+  for (Int_t idxPt  = 0; idxPt < AliAnalysisNetParticleHelper::fgkfHistNBinsPt; ++idxPt)
+    moments->Fill(Int_t(centralityBin), idxPt, npPt[idx][1][idxPt], npPt[idx][0][idxPt], fHelper->GetSubSampleIdx());
+
+  if (fHelper->GetModeDistCreation() == 2)
+    return;
+
   // -----------------------------------------------------------------------------------------------
 
   // -- Loop over the pt bins
@@ -110,6 +110,7 @@ class AliAnalysisNetParticleHelper : public TNamed {
 
   Int_t    GetSubSampleIdx()                   {return fSubSampleIdx;}
   Int_t    GetNSubSamples()                    {return fNSubSamples;}
+  Int_t    GetModeDistCreation()               {return fModeDistCreation;}
 
   /*
    * ---------------------------------------------------------------------------------
@@ -252,7 +253,7 @@ class AliAnalysisNetParticleHelper : public TNamed {
    *                             Members - private
    * ---------------------------------------------------------------------------------
    */
-  Int_t                 fModeDistCreation;         //  Dist creation mode       : 1 = on | 0 = off 
+  Int_t                 fModeDistCreation;         //  Dist creation mode       : 1 = on | 2 = moments only | 0 = off
   // =======================================================================
   AliInputEventHandler *fInputEventHandler;        //! Ptr to input event handler (ESD or AOD)
   AliPIDResponse       *fPIDResponse;              //! Ptr to PID response Object
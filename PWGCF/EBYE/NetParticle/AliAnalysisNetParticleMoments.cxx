@@ -0,0 +1,299 @@
+//-*- Mode: C++ -*-
+
+#include "TMath.h"
+#include "TCollection.h"
+
+#include "AliLog.h"
+
+#include "AliAnalysisNetParticleMoments.h"
+
+#include <vector>
+
+using namespace std;
+
+/**
+ * Class for NetParticle Moments
+ * -- Streaming accumulator of net-particle moments and cumulants
+ */
+
+ClassImp(AliAnalysisNetParticleMoments)
+
+/*
+ * ---------------------------------------------------------------------------------
+ *                            Constructor / Destructor
+ * ---------------------------------------------------------------------------------
+ */
+
+//________________________________________________________________________
+AliAnalysisNetParticleMoments::AliAnalysisNetParticleMoments() :
+  TNamed(),
+  fOrder(0),
+  fNCentBins(0),
+  fNPtBins(0),
+  fNSubSamples(0),
+  fSums() {
+  // Constructor - for I/O
+
+  fRedFact[0] = fRedFact[1] = NULL;
+}
+
+//________________________________________________________________________
+AliAnalysisNetParticleMoments::AliAnalysisNetParticleMoments(const Char_t* name, const Char_t* title,
+							     Int_t order, Int_t nCentBins, Int_t nPtBins, Int_t nSubSamples) :
+  TNamed(name, title),
+  fOrder((order > 0) ? order : 1),
+  fNCentBins((nCentBins > 0) ? nCentBins : 1),
+  fNPtBins((nPtBins > 0) ? nPtBins : 1),
+  fNSubSamples((nSubSamples > 0) ? nSubSamples : 0),
+  fSums() {
+  // Constructor
+
+  fRedFact[0] = fRedFact[1] = NULL;
+  fSums.Set((fNSubSamples+1)*fNCentBins*fNPtBins*GetNSums());
+}
+
+//________________________________________________________________________
+AliAnalysisNetParticleMoments::~AliAnalysisNetParticleMoments() {
+  // Destructor
+
+  for (Int_t ii = 0; ii < 2; ++ii)
+    if (fRedFact[ii]) delete[] fRedFact[ii];
+}
+
+/*
+ * ---------------------------------------------------------------------------------
+ *                                 Public Methods
+ * ---------------------------------------------------------------------------------
+ */
+
+//________________________________________________________________________
+void AliAnalysisNetParticleMoments::Fill(Int_t centBin, Int_t ptBin, Int_t n1, Int_t n2, Int_t subSample, Double_t weight) {
+  // Fill one event into the sums of all events and of its subsample
+
+  Int_t offsets[2] = {GetOffset(centBin, ptBin, -1), -1};
+  if (offsets[0] < 0)
+    return;
+  if (subSample >= 0)
+    offsets[1] = GetOffset(centBin, ptBin, subSample);
+
+  // -- Reduced factorials (n)_i = n!/(n-i)!
+  if (!fRedFact[0]) {
+    for (Int_t ii = 0; ii < 2; ++ii)
+      fRedFact[ii] = new Double_t[fOrder+1];
+  }
+
+  Int_t np[2] = {n1, n2};
+  for (Int_t ii = 0; ii < 2; ++ii) {
+    fRedFact[ii][0] = 1.;
+    for (Int_t kk = 1; kk <= fOrder; ++kk)
+      fRedFact[ii][kk] = fRedFact[ii][kk-1]*(np[ii]-kk+1);
+  }
+
+  const Double_t delta = n1 - n2;
+
+  for (Int_t idx = 0; idx < 2; ++idx) {
+    if (offsets[idx] < 0)
+      continue;
+
+    Double_t *sums = fSums.GetArray() + offsets[idx];
+
+    sums[0] += weight;
+
+    Double_t power = weight;
+    for (Int_t kk = 1; kk <= fOrder; ++kk) {
+      power *= delta;
+      sums[kk] += power;
+    }
+
+    Double_t *fact = sums + 1 + fOrder;
+    for (Int_t ii = 0; ii <= fOrder; ++ii) {
+      const Double_t wf1 = weight*fRedFact[0][ii];
+      for (Int_t kk = 0; kk <= fOrder; ++kk)
+	fact[ii*(fOrder+1)+kk] += wf1*fRedFact[1][kk];
+    }
+  }
+}
+
+//________________________________________________________________________
+Bool_t AliAnalysisNetParticleMoments::Add(const AliAnalysisNetParticleMoments* other) {
+  // Add the sums of another accumulator
+
+  if (!other)
+    return kFALSE;
+
+  if (other->fOrder != fOrder || other->fNCentBins != fNCentBins ||
+      other->fNPtBins != fNPtBins || other->fNSubSamples != fNSubSamples) {
+    AliError(Form("Binning of %s differs - not added", other->GetName()));
+    return kFALSE;
+  }
+
+  Double_t *sums = fSums.GetArray();
+  const Double_t *otherSums = other->fSums.GetArray();
+  for (Int_t ii = 0; ii < fSums.GetSize(); ++ii)
+    sums[ii] += otherSums[ii];
+
+  return kTRUE;
+}
+
+//________________________________________________________________________
+Long64_t AliAnalysisNetParticleMoments::Merge(TCollection* list) {
+  // Merge - returns the number of merged objects
+
+  if (!list)
+    return 0;
+
+  Long64_t nMerged = 0;
+
+  TIter next(list);
+  TObject *obj = NULL;
+  while ((obj = next())) {
+    if (obj == this)
+      continue;
+    if (Add(dynamic_cast<AliAnalysisNetParticleMoments*>(obj)))
+      ++nMerged;
+  }
+
+  return nMerged;
+}
+
+/*
+ * ---------------------------------------------------------------------------------
+ *                                     Results
+ * ---------------------------------------------------------------------------------
+ */
+
+//________________________________________________________________________
+Double_t AliAnalysisNetParticleMoments::GetNEvents(Int_t centBin, Int_t ptBin, Int_t subSample) const {
+  // Sum of event weights
+
+  Int_t offset = GetOffset(centBin, ptBin, subSample);
+  return (offset < 0) ? 0. : fSums[offset];
+}
+
+//________________________________________________________________________
+Double_t AliAnalysisNetParticleMoments::GetMoment(Int_t centBin, Int_t ptBin, Int_t k, Int_t subSample) const {
+  // Measured <(N1-N2)^k>
+
+  Int_t offset = GetOffset(centBin, ptBin, subSample);
+  if (offset < 0 || k < 0 || k > fOrder || fSums[offset] <= 0.)
+    return 0.;
+
+  return (k == 0) ? 1. : fSums[offset+k]/fSums[offset];
+}
+
+//________________________________________________________________________
+Double_t AliAnalysisNetParticleMoments::GetFactorialMoment(Int_t centBin, Int_t ptBin, Int_t i, Int_t k,
+							   Double_t eff1, Double_t eff2, Int_t subSample) const {
+  // Efficiency corrected factorial moment <(N1)_i (N2)_k>
+
+  Int_t offset = GetOffset(centBin, ptBin, subSample);
+  if (offset < 0 || i < 0 || k < 0 || i > fOrder || k > fOrder || fSums[offset] <= 0. || eff1 <= 0. || eff2 <= 0.)
+    return 0.;
+
+  return fSums[offset+1+fOrder+i*(fOrder+1)+k]/fSums[offset]/TMath::Power(eff1, i)/TMath::Power(eff2, k);
+}
+
+//________________________________________________________________________
+Double_t AliAnalysisNetParticleMoments::GetCumulant(Int_t centBin, Int_t ptBin, Int_t n,
+						    Double_t eff1, Double_t eff2, Int_t subSample) const {
+  // Efficiency corrected cumulant of N1-N2
+  //   kappa_n = m_n - sum_{m=1}^{n-1} C(n-1,m-1) kappa_m m_{n-m}
+
+  if (n < 1 || n > fOrder)
+    return 0.;
+
+  vector<Double_t> moments(fOrder+1);
+  if (!GetNetMoments(centBin, ptBin, eff1, eff2, subSample, &moments[0]))
+    return 0.;
+
+  vector<Double_t> cumulants(n+1, 0.);
+  for (Int_t nn = 1; nn <= n; ++nn) {
+    cumulants[nn] = moments[nn];
+    for (Int_t mm = 1; mm < nn; ++mm)
+      cumulants[nn] -= TMath::Binomial(nn-1, mm-1)*cumulants[mm]*moments[nn-mm];
+  }
+
+  return cumulants[n];
+}
+
+//________________________________________________________________________
+Double_t AliAnalysisNetParticleMoments::GetCumulantError(Int_t centBin, Int_t ptBin, Int_t n,
+							 Double_t eff1, Double_t eff2) const {
+  // Standard deviation of the subsample cumulants / sqrt(N subsamples)
+
+  Int_t nFilled = 0;
+  Double_t sum  = 0.;
+  Double_t sum2 = 0.;
+
+  for (Int_t sub = 0; sub < fNSubSamples; ++sub) {
+    if (GetNEvents(centBin, ptBin, sub) <= 0.)
+      continue;
+    Double_t value = GetCumulant(centBin, ptBin, n, eff1, eff2, sub);
+    sum  += value;
+    sum2 += value*value;
+    ++nFilled;
+  }
+
+  if (nFilled < 2)
+    return 0.;
+
+  Double_t mean     = sum/nFilled;
+  Double_t variance = (sum2 - nFilled*mean*mean)/(nFilled-1);
+
+  return (variance > 0.) ? TMath::Sqrt(variance/nFilled) : 0.;
+}
+
+/*
+ * ---------------------------------------------------------------------------------
+ *                                Methods - private
+ * ---------------------------------------------------------------------------------
+ */
+
+//________________________________________________________________________
+Int_t AliAnalysisNetParticleMoments::GetOffset(Int_t centBin, Int_t ptBin, Int_t subSample) const {
+  // Offset of the sums of a bin, -1 if out of range
+
+  if (centBin < 0 || centBin >= fNCentBins || ptBin < 0 || ptBin >= fNPtBins ||
+      subSample < -1 || subSample >= fNSubSamples)
+    return -1;
+
+  return (((subSample+1)*fNCentBins + centBin)*fNPtBins + ptBin)*GetNSums();
+}
+
+//________________________________________________________________________
+Bool_t AliAnalysisNetParticleMoments::GetNetMoments(Int_t centBin, Int_t ptBin, Double_t eff1, Double_t eff2,
+						    Int_t subSample, Double_t* moments) const {
+  // Net moments <(N1-N2)^n> for n = 0..order from the corrected factorial moments
+  //   <N1^a N2^b> = sum_i sum_k S(a,i) S(b,k) F_ik   (S : Stirling numbers of the second kind)
+  //   <(N1-N2)^n> = sum_j C(n,j) (-1)^(n-j) <N1^j N2^(n-j)>
+
+  if (GetNEvents(centBin, ptBin, subSample) <= 0. || eff1 <= 0. || eff2 <= 0.)
+    return kFALSE;
+
+  const Int_t nn = fOrder + 1;
+
+  vector<Double_t> stirling(nn*nn, 0.);
+  stirling[0] = 1.;
+  for (Int_t aa = 1; aa < nn; ++aa)
+    for (Int_t ii = 1; ii <= aa; ++ii)
+      stirling[aa*nn+ii] = ii*stirling[(aa-1)*nn+ii] + stirling[(aa-1)*nn+ii-1];
+
+  vector<Double_t> fact(nn*nn, 0.);
+  for (Int_t ii = 0; ii < nn; ++ii)
+    for (Int_t kk = 0; kk < nn-ii; ++kk)
+      fact[ii*nn+kk] = GetFactorialMoment(centBin, ptBin, ii, kk, eff1, eff2, subSample);
+
+  moments[0] = 1.;
+  for (Int_t order = 1; order < nn; ++order) {
+    moments[order] = 0.;
+    for (Int_t jj = 0; jj <= order; ++jj) {
+      Double_t raw = 0.;
+      for (Int_t ii = 0; ii <= jj; ++ii)
+	for (Int_t kk = 0; kk <= order-jj; ++kk)
+	  raw += stirling[jj*nn+ii]*stirling[(order-jj)*nn+kk]*fact[ii*nn+kk];
+      moments[order] += (((order-jj)%2) ? -1. : 1.)*TMath::Binomial(order, jj)*raw;
+    }
+  }
+
+  return kTRUE;
+}
@@ -0,0 +1,118 @@
+//-*- Mode: C++ -*-
+
+#ifndef ALIANALYSISNETPARTICLEMOMENTS_H
+#define ALIANALYSISNETPARTICLEMOMENTS_H
+
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/**
+ * Class for NetParticle Moments
+ * -- Streaming accumulator of the power sums of N1-N2 and of the factorial
+ *    moment sums <(N1)_i (N2)_k> per centrality (and pt) bin, for all events
+ *    and for every subsample. The size depends only on the number of bins
+ *    and the order, the merge adds the sums.
+ * -- Efficiency corrected factorial moments and net-particle cumulants
+ *    (binomial efficiency loss: F_ik / (eff1^i eff2^k))
+ */
+
+#include "TNamed.h"
+#include "TArrayD.h"
+
+class TCollection;
+
+class AliAnalysisNetParticleMoments : public TNamed {
+
+ public:
+
+  AliAnalysisNetParticleMoments();
+  AliAnalysisNetParticleMoments(const Char_t* name, const Char_t* title, Int_t order, Int_t nCentBins, Int_t nPtBins = 1, Int_t nSubSamples = 0);
+  virtual ~AliAnalysisNetParticleMoments();
+
+  /*
+   * ---------------------------------------------------------------------------------
+   *                                 Public Methods
+   * ---------------------------------------------------------------------------------
+   */
+
+  /** Fill one event : n1 particles, n2 anti-particles, subSample < 0 for no subsample */
+  void Fill(Int_t centBin, Int_t ptBin, Int_t n1, Int_t n2, Int_t subSample = -1, Double_t weight = 1.);
+
+  /** Add the sums of another accumulator with the same binning */
+  Bool_t Add(const AliAnalysisNetParticleMoments* other);
+
+  /** Merge - adds the sums */
+  virtual Long64_t Merge(TCollection* list);
+
+  /*
+   * ---------------------------------------------------------------------------------
+   *                                 Results - subSample < 0 for all events
+   * ---------------------------------------------------------------------------------
+   */
+
+  /** Sum of event weights */
+  Double_t GetNEvents(Int_t centBin, Int_t ptBin = 0, Int_t subSample = -1) const;
+
+  /** Measured <(N1-N2)^k> */
+  Double_t GetMoment(Int_t centBin, Int_t ptBin, Int_t k, Int_t subSample = -1) const;
+
+  /** Efficiency corrected factorial moment <(N1)_i (N2)_k> */
+  Double_t GetFactorialMoment(Int_t centBin, Int_t ptBin, Int_t i, Int_t k, Double_t eff1 = 1., Double_t eff2 = 1., Int_t subSample = -1) const;
+
+  /** Efficiency corrected cumulant of N1-N2 of order n */
+  Double_t GetCumulant(Int_t centBin, Int_t ptBin, Int_t n, Double_t eff1 = 1., Double_t eff2 = 1., Int_t subSample = -1) const;
+
+  /** Statistical uncertainty of the cumulant from the spread of the subsamples */
+  Double_t GetCumulantError(Int_t centBin, Int_t ptBin, Int_t n, Double_t eff1 = 1., Double_t eff2 = 1.) const;
+
+  /*
+   * ---------------------------------------------------------------------------------
+   *                                    Getter
+   * ---------------------------------------------------------------------------------
+   */
+
+  Int_t GetOrder()       const {return fOrder;}
+  Int_t GetNCentBins()   const {return fNCentBins;}
+  Int_t GetNPtBins()     const {return fNPtBins;}
+  Int_t GetNSubSamples() const {return fNSubSamples;}
+
+  ///////////////////////////////////////////////////////////////////////////////////
+
+ private:
+
+  AliAnalysisNetParticleMoments(const AliAnalysisNetParticleMoments&); // not implemented
+  AliAnalysisNetParticleMoments& operator=(const AliAnalysisNetParticleMoments&); // not implemented
+
+  /*
+   * ---------------------------------------------------------------------------------
+   *                                Methods - private
+   * ---------------------------------------------------------------------------------
+   */
+
+  /** Number of sums per bin : events, order power sums, (order+1)^2 factorial sums */
+  Int_t GetNSums() const {return 1 + fOrder + (fOrder+1)*(fOrder+1);}
+
+  /** Offset of the sums of a bin, -1 if out of range */
+  Int_t GetOffset(Int_t centBin, Int_t ptBin, Int_t subSample) const;
+
+  /** Net moments <(N1-N2)^n> for n = 0..order from the corrected factorial moments */
+  Bool_t GetNetMoments(Int_t centBin, Int_t ptBin, Double_t eff1, Double_t eff2, Int_t subSample, Double_t* moments) const;
+
+  /*
+   * ---------------------------------------------------------------------------------
+   *                             Members - private
+   * ---------------------------------------------------------------------------------
+   */
+
+  Int_t                 fOrder;                 //  Max order of the moments
+  Int_t                 fNCentBins;             //  N centrality bins
+  Int_t                 fNPtBins;               //  N pt bins
+  Int_t                 fNSubSamples;           //  N subsamples
+  TArrayD               fSums;                  //  Sums [subSample+1][cent][pt][sum]
+  // -----------------------------------------------------------------------
+  Double_t             *fRedFact[2];            //! Reduced factorials of the current event
+
+  ClassDef(AliAnalysisNetParticleMoments, 1);
+};
+
+#endif
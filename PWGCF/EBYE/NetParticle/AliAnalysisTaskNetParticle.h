@@ -152,7 +152,7 @@ class AliAnalysisTaskNetParticle : public AliAnalysisTaskSE {
   Int_t               fESDTrackCutMode;         //  ESD track cut mode       : 0 = clean | 1 = dirty
   Int_t               fModeEffCreation ;        //  Correction creation mode : 1 = on    | 0 = off
   Int_t               fModeDCACreation;         //  DCA creation mode        : 1 = on    | 0 = off
-  Int_t               fModeDistCreation;        //  Dist creation mode       : 1 = on    | 0 = off
+  Int_t               fModeDistCreation;        //  Dist creation mode       : 1 = on    | 2 = moments only | 0 = off
   Int_t               fModeQACreation;          //  QA creation mode         : 1 = on    | 0 = off
 
   // --- MC only -----------------------------------------------------------
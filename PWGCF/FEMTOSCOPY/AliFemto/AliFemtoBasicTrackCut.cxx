@@ -3,7 +3,9 @@
 ///
 
 #include "AliFemtoBasicTrackCut.h"
+#include "AliFemtoConfigObject.h"
 #include <cstdio>
+#include <typeinfo>
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
@@ -164,3 +166,25 @@ TList *AliFemtoBasicTrackCut::ListSettings()
 
   return settings_list;
 }
+
+bool AliFemtoBasicTrackCut::FillConfiguration(AliFemtoConfigObject &cfg) const
+{
+  // a derived class may cut on more than these settings
+  if (typeid(*this) != typeid(AliFemtoBasicTrackCut)) {
+    return false;
+  }
+
+  typedef AliFemtoConfigObject::RangeValue_t Range_t;
+  cfg.insert("class", TString("AliFemtoBasicTrackCut"));
+  cfg.insert("mass", Mass());
+  cfg.insert("charge", fCharge);
+  cfg.insert("nsigmapion", Range_t(fNSigmaPion[0], fNSigmaPion[1]));
+  cfg.insert("nsigmakaon", Range_t(fNSigmaKaon[0], fNSigmaKaon[1]));
+  cfg.insert("nsigmaproton", Range_t(fNSigmaProton[0], fNSigmaProton[1]));
+  cfg.insert("nhits", Range_t(fNHits[0], fNHits[1]));
+  cfg.insert("pt", Range_t(fPt[0], fPt[1]));
+  cfg.insert("rapidity", Range_t(fRapidity[0], fRapidity[1]));
+  cfg.insert("dca", Range_t(fDCA[0], fDCA[1]));
+
+  return true;
+}
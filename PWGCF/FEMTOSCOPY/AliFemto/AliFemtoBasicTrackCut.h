@@ -37,6 +37,7 @@ public:
 
   virtual AliFemtoString Report();
   virtual TList *ListSettings();
+  virtual bool FillConfiguration(AliFemtoConfigObject &cfg) const;
 
   void SetNSigmaPion(const float& lo, const float& hi);
   void SetNSigmaKaon(const float& lo, const float& hi);
@@ -7,6 +7,7 @@
 #include "AliFemtoPairCut.h"
 
 #include <TH3F.h>
+#include <TArrayD.h>
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
@@ -165,16 +166,12 @@ void AliFemtoCorrFctn3DLCMSSym::AddRealPair(AliFemtoPair* pair)
     return;
   }
 
-  const Double_t qout = (fUseLCMS) ? pair->QOutCMS() : pair->QOutPf(),
-                 qside = (fUseLCMS) ? pair->QSideCMS() : pair->QSidePf(),
-                 qlong = (fUseLCMS) ? pair->QLongCMS() : pair->QLongPf();
-
-  Int_t bin = fNumerator->FindBin(qout, qside, qlong);
+  Double_t qinv;
+  const Int_t bin = FindPairBin(pair, qinv);
 
   // avoid overflow bins
-  if (!(fNumerator->IsBinOverflow(bin) or fNumerator->IsBinUnderflow(bin))) {
-    fNumerator->Fill(qout, qside, qlong, 1.0);
-    fNumeratorW->Fill(qout, qside, qlong, pair->QInv());
+  if (bin >= 0) {
+    FillPairBin(fNumerator, fNumeratorW, bin, qinv);
   }
 }
 //____________________________
@@ -185,17 +182,62 @@ void AliFemtoCorrFctn3DLCMSSym::AddMixedPair(AliFemtoPair* pair)
     return;
   }
 
-  const Double_t qout = (fUseLCMS) ? pair->QOutCMS() : pair->QOutPf(),
-                 qside = (fUseLCMS) ? pair->QSideCMS() : pair->QSidePf(),
-                 qlong = (fUseLCMS) ? pair->QLongCMS() : pair->QLongPf();
-
-  Int_t bin = fDenominator->FindBin(qout, qside, qlong);
+  Double_t qinv;
+  const Int_t bin = FindPairBin(pair, qinv);
 
   // avoid overflow bins
-  if (!(fDenominator->IsBinOverflow(bin) or fDenominator->IsBinUnderflow(bin))) {
-    fDenominator->Fill(qout, qside, qlong, 1.0);
-    fDenominatorW->Fill(qout, qside, qlong, pair->QInv());
+  if (bin >= 0) {
+    FillPairBin(fDenominator, fDenominatorW, bin, qinv);
+  }
+}
+
+//____________________________
+Int_t AliFemtoCorrFctn3DLCMSSym::FindPairBin(const AliFemtoPair* pair, Double_t& qinv) const
+{
+  Double_t qout, qside, qlong;
+  if (fUseLCMS) {
+    pair->QLCMS(qout, qside, qlong);
+  } else {
+    qout = pair->QOutPf();
+    qside = pair->QSidePf();
+    qlong = pair->QLongPf();
+  }
+
+  const TAxis *xaxis = fNumerator->GetXaxis(),
+              *yaxis = fNumerator->GetYaxis(),
+              *zaxis = fNumerator->GetZaxis();
+  const Int_t ix = xaxis->FindFixBin(qout),
+              iy = yaxis->FindFixBin(qside),
+              iz = zaxis->FindFixBin(qlong);
+  if (ix < 1 || ix > xaxis->GetNbins()
+      || iy < 1 || iy > yaxis->GetNbins()
+      || iz < 1 || iz > zaxis->GetNbins()) {
+    return -1;
   }
+
+  qinv = pair->QInv();
+  return fNumerator->GetBin(ix, iy, iz);
+}
+
+//____________________________
+void AliFemtoCorrFctn3DLCMSSym::FillPairBin(TH3F* hist, TH3F* histW, Int_t bin, Double_t qinv)
+{
+  // same bin contents and errors as TH3::Fill; the statistics (means, rms)
+  // are recomputed from the bin contents when requested
+  hist->AddBinContent(bin, 1.0);
+  histW->AddBinContent(bin, qinv);
+
+  TArrayD *sumw2 = hist->GetSumw2(),
+          *sumw2W = histW->GetSumw2();
+  if (sumw2->fN) {
+    sumw2->fArray[bin] += 1.0;
+  }
+  if (sumw2W->fN) {
+    sumw2W->fArray[bin] += qinv * qinv;
+  }
+
+  hist->SetEntries(hist->GetEntries() + 1);
+  histW->SetEntries(histW->GetEntries() + 1);
 }
 
 void AliFemtoCorrFctn3DLCMSSym::SetUseLCMS(int aUseLCMS)
@@ -56,6 +56,13 @@ public:
 
 private:
 
+  /// Global bin of (qout, qside, qlong), -1 for under/overflow.
+  /// All four histograms share the same binning.
+  Int_t FindPairBin(const AliFemtoPair* aPair, Double_t& qinv) const;
+
+  /// Add one entry to the given bin of a histogram and its qinv-weighted partner
+  static void FillPairBin(TH3F* hist, TH3F* histW, Int_t bin, Double_t qinv);
+
   TH3F* fNumerator;     ///< Numerator
   TH3F* fDenominator;   ///< Denominator
   TH3F* fNumeratorW;    ///< Qinv-Weighted numerator
@@ -105,6 +105,7 @@ AliFemtoEvent::AliFemtoEvent():
   fV0Collection(nullptr),
   fXiCollection(nullptr),
   fKinkCollection(nullptr),
+  fOwnsTracks(true),
   fZDCN1Energy(0.0f),
   fZDCP1Energy(0.0f),
   fZDCN2Energy(0.0f),
@@ -161,6 +162,7 @@ AliFemtoEvent::AliFemtoEvent(const AliFemtoEvent& ev,
   fV0Collection(nullptr),
   fXiCollection(nullptr),
   fKinkCollection(nullptr),
+  fOwnsTracks(true),
   fZDCN1Energy(ev.fZDCN1Energy),
   fZDCP1Energy(ev.fZDCP1Energy),
   fZDCN2Energy(ev.fZDCN2Energy),
@@ -219,6 +221,7 @@ AliFemtoEvent::AliFemtoEvent(const AliFemtoEvent& ev):
   fV0Collection(nullptr),
   fXiCollection(nullptr),
   fKinkCollection(nullptr),
+  fOwnsTracks(true),
   fZDCN1Energy(ev.fZDCN1Energy),
   fZDCP1Energy(ev.fZDCP1Energy),
   fZDCN2Energy(ev.fZDCN2Energy),
@@ -291,6 +294,11 @@ AliFemtoEvent& AliFemtoEvent::operator=(const AliFemtoEvent& aEvent)
   fReactionPlaneAngle = aEvent.fReactionPlaneAngle;
   fEP = aEvent.fEP;
 
+  // recycled tracks belong to the reader, the copies will be ours
+  if (!fOwnsTracks) {
+    fTrackCollection->clear();
+    fOwnsTracks = true;
+  }
   copy_collection(*aEvent.fTrackCollection, *fTrackCollection);
   copy_collection(*aEvent.fV0Collection, *fV0Collection);
   copy_collection(*aEvent.fXiCollection, *fXiCollection);
@@ -307,9 +315,11 @@ AliFemtoEvent::~AliFemtoEvent()
   cout << " AliFemtoEvent::~AliFemtoEvent() " << endl;
 #endif
 
-  for (auto *track_ptr : *fTrackCollection) {
-    delete track_ptr;
-  } //added by M Chojnacki To avodid memory leak
+  if (fOwnsTracks) {
+    for (auto *track_ptr : *fTrackCollection) {
+      delete track_ptr;
+    } //added by M Chojnacki To avodid memory leak
+  }
   delete fTrackCollection;
 
   //must do the same for the V0 collection
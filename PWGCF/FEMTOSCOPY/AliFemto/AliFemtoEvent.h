@@ -54,6 +54,9 @@ public:
   AliFemtoXiCollection* XiCollection() const;
   AliFemtoKinkCollection* KinkCollection() const;
   AliFemtoTrackCollection* TrackCollection() const;
+  /// Tracks owned by a reader that recycles them are not deleted with the event
+  void SetOwnsTracks(bool owns);
+  bool OwnsTracks() const;
   double MagneticField() const;
   bool IsCollisionCandidate() const;
 
@@ -172,6 +175,7 @@ private:
   AliFemtoV0Collection*    fV0Collection;    ///< collection of V0s
   AliFemtoXiCollection*    fXiCollection;    ///< collection of Xis
   AliFemtoKinkCollection*  fKinkCollection;  ///< collection of kinks
+  bool fOwnsTracks;                          ///< delete the tracks with the event
 
   //for alice changed by Marek Chojnacki
   float        fZDCN1Energy;      ///< reconstructed energy in the neutron ZDC
@@ -189,6 +193,14 @@ private:
 };
 
 
+inline
+void AliFemtoEvent::SetOwnsTracks(bool owns)
+{ fOwnsTracks = owns; }
+
+inline
+bool AliFemtoEvent::OwnsTracks() const
+{ return fOwnsTracks; }
+
 inline
 void AliFemtoEvent::SetEventNumber(const unsigned short event)
 { fEventNumber = event; }
@@ -25,6 +25,7 @@
 #include "SystemOfUnits.h"
 
 #include "AliFemtoEvent.h"
+#include "AliFemtoTrackCut.h"
 #include "AliFemtoModelHiddenInfo.h"
 #include "AliFemtoModelGlobalHiddenInfo.h"
 #include "AliPID.h"
@@ -99,6 +100,9 @@ AliFemtoEventReaderNanoAOD::AliFemtoEventReaderNanoAOD():
   fPrimaryVertexCorrectionTPCPoints(kFALSE),
   fShiftPosition(0.),
   fCovMatPresent(kTRUE),
+  fUseTrackArena(kFALSE),
+  fTrackArena(),
+  fTrackArenaUsed(0),
   f1DcorrectionsPions(0),
   f1DcorrectionsKaons(0),
   f1DcorrectionsProtons(0),
@@ -173,6 +177,9 @@ AliFemtoEventReaderNanoAOD::AliFemtoEventReaderNanoAOD(const AliFemtoEventReader
   fPrimaryVertexCorrectionTPCPoints(aReader.fPrimaryVertexCorrectionTPCPoints),
   fShiftPosition(aReader.fShiftPosition),
   fCovMatPresent(kTRUE),
+  fUseTrackArena(aReader.fUseTrackArena),
+  fTrackArena(),
+  fTrackArenaUsed(0),
   f1DcorrectionsPions(aReader.f1DcorrectionsPions),
   f1DcorrectionsKaons(aReader.f1DcorrectionsKaons),
   f1DcorrectionsProtons(aReader.f1DcorrectionsProtons),
@@ -214,6 +221,9 @@ AliFemtoEventReaderNanoAOD::~AliFemtoEventReaderNanoAOD()
   delete fTree;
   delete fEvent;
   delete fAodFile;
+  for (auto *track : fTrackArena) {
+    delete track;
+  }
   //   if (fPWG2AODTracks) {
   //     fPWG2AODTracks->Delete();
   //     delete fPWG2AODTracks;
@@ -270,6 +280,7 @@ AliFemtoEventReaderNanoAOD &AliFemtoEventReaderNanoAOD::operator=(const AliFemto
   fPrimaryVertexCorrectionTPCPoints = aReader.fPrimaryVertexCorrectionTPCPoints;
   fShiftPosition = aReader.fShiftPosition;
   fCovMatPresent = aReader.fCovMatPresent;
+  fUseTrackArena = aReader.fUseTrackArena;
 
   f1DcorrectionsPions = aReader.f1DcorrectionsPions;
   f1DcorrectionsKaons = aReader.f1DcorrectionsKaons;
@@ -375,6 +386,9 @@ AliFemtoEvent *AliFemtoEventReaderNanoAOD::CopyAODtoFemtoEvent()
 
   AliFemtoEvent *tEvent = new AliFemtoEvent();
 
+  // the previous event has been deleted, its arena tracks can be reused
+  fTrackArenaUsed = 0;
+  tEvent->SetOwnsTracks(!fUseTrackArena);
 
 
   //AliNanoAODHeader *header = dynamic_cast<AliNanoAODHeader *>(fEvent->GetHeader());
@@ -606,6 +620,11 @@ AliFemtoEvent *AliFemtoEventReaderNanoAOD::CopyAODtoFemtoEvent()
     //AliExternalTrackParam *param = new AliExternalTrackParam(*aodtrack->GetInnerParam());
     trackCopy->SetInnerMomentum(aodtrack->GetTPCmomentum());
 
+    if (fTrackCut && !fTrackCut->Pass(trackCopy)) {
+      ReleaseFemtoTrack(trackCopy);
+      continue;
+    }
+
     tEvent->TrackCollection()->push_back(trackCopy); // Adding track to analysis
     realnofTracks++;                                 // Real number of tracks
   }
@@ -715,11 +734,36 @@ AliFemtoEvent *AliFemtoEventReaderNanoAOD::CopyAODtoFemtoEvent()
   return tEvent;
 }
 
+AliFemtoTrack *AliFemtoEventReaderNanoAOD::NewFemtoTrack()
+{
+  // an empty track, from the arena if it is used
+  if (!fUseTrackArena) {
+    return new AliFemtoTrack();
+  }
+  if (fTrackArenaUsed == fTrackArena.size()) {
+    fTrackArena.push_back(new AliFemtoTrack());
+    return fTrackArena[fTrackArenaUsed++];
+  }
+  AliFemtoTrack *track = fTrackArena[fTrackArenaUsed++];
+  *track = AliFemtoTrack();
+  return track;
+}
+
+void AliFemtoEventReaderNanoAOD::ReleaseFemtoTrack(AliFemtoTrack *track)
+{
+  // give back the last track obtained from NewFemtoTrack
+  if (!fUseTrackArena) {
+    delete track;
+  } else if (fTrackArenaUsed && fTrackArena[fTrackArenaUsed - 1] == track) {
+    fTrackArenaUsed--;
+  }
+}
+
 AliFemtoTrack *AliFemtoEventReaderNanoAOD::CopyAODtoFemtoTrack(AliNanoAODTrack *tAodTrack)
 {
   // Copy the track information from the AOD into the internal AliFemtoTrack
   // If it exists, use the additional information from the PWG2 AOD
-  AliFemtoTrack *tFemtoTrack = new AliFemtoTrack();
+  AliFemtoTrack *tFemtoTrack = NewFemtoTrack();
 
   // Primary Vertex position
   const AliVVertex* vertex = fEvent->GetPrimaryVertex();
@@ -8,6 +8,7 @@
 #include "AliFemtoEnumeration.h"
 
 #include <string>
+#include <vector>
 
 #include "TTree.h"
 #include "TChain.h"
@@ -87,6 +88,14 @@ public:
 
   void SetCovMatPresent(Bool_t pres){fCovMatPresent = pres;}
 
+  /// Take the tracks from an arena kept by the reader and reused at every
+  /// event instead of allocating them. The returned event does not own its
+  /// tracks and has to be deleted before the next one is read, as the
+  /// manager does. Tracks failing the reader's track cut (SetTrackCut) are
+  /// dropped before entering the event in either mode.
+  void SetUseTrackArena(Bool_t use) { fUseTrackArena = use; }
+  Bool_t GetUseTrackArena() const { return fUseTrackArena; }
+
 
   void Set1DCorrectionsPions(TH1D *h1);
   void Set1DCorrectionsKaons(TH1D *h1);
@@ -122,6 +131,9 @@ protected:
   virtual AliFemtoV0 *CopyAODtoFemtoV0(AliAODv0 *tAODv0);
   virtual AliFemtoXi *CopyAODtoFemtoXi(AliAODcascade *tAODxi);
 
+  AliFemtoTrack *NewFemtoTrack();
+  void ReleaseFemtoTrack(AliFemtoTrack *track);
+
 
   int            fNumberofEvent;    ///< number of Events in AOD file
   int            fCurEvent;         ///< number of current event
@@ -172,6 +184,9 @@ private:
   Bool_t fPrimaryVertexCorrectionTPCPoints; ///< Boolean determining if the reader should shift all TPC points to be relative to event vertex
   Double_t fShiftPosition; ///< radius at which the spatial position of the track in the shifted coordinate system is calculated
   Bool_t fCovMatPresent; /// flag if covariance matrix is not present in NanoAOD
+  Bool_t fUseTrackArena; ///< reuse the tracks of the previous event (see SetUseTrackArena)
+  std::vector<AliFemtoTrack*> fTrackArena; //!<! tracks reused from event to event
+  size_t fTrackArenaUsed;                  //!<! tracks of the arena given to the current event
 
   TH1D *f1DcorrectionsPions;    ///<file with corrections, pT dependant
   TH1D *f1DcorrectionsKaons;    ///<file with corrections, pT dependant
@@ -200,7 +215,7 @@ private:
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
-  ClassDef(AliFemtoEventReaderNanoAOD, 13);
+  ClassDef(AliFemtoEventReaderNanoAOD, 14);
   /// \endcond
 #endif
 
@@ -8,6 +8,8 @@
 ///////////////////////////////////////////////////////////////////////////
 
 #include "AliFemtoManager.h"
+#include "AliFemtoSimpleAnalysis.h"
+#include "AliFemtoSharedCutCache.h"
 //#include "AliFemtoParticleCollection.h"
 //#include "AliFemtoTrackCut.h"
 //#include "AliFemtoV0Cut.h"
@@ -25,7 +27,9 @@
 AliFemtoManager::AliFemtoManager():
   fAnalysisCollection(nullptr),
   fEventReader(nullptr),
-  fEventWriterCollection(nullptr)
+  fEventWriterCollection(nullptr),
+  fShareIdenticalCuts(false),
+  fSharedCutCache(nullptr)
 {
   // default constructor
   fAnalysisCollection = new AliFemtoAnalysisCollection;
@@ -35,7 +39,9 @@ AliFemtoManager::AliFemtoManager():
 AliFemtoManager::AliFemtoManager(const AliFemtoManager& aManager):
   fAnalysisCollection(new AliFemtoAnalysisCollection),
   fEventReader(aManager.fEventReader),
-  fEventWriterCollection(new AliFemtoEventWriterCollection)
+  fEventWriterCollection(new AliFemtoEventWriterCollection),
+  fShareIdenticalCuts(aManager.fShareIdenticalCuts),
+  fSharedCutCache(nullptr)
 {
   // copy constructor
   for (auto *analysis : *aManager.fAnalysisCollection) {
@@ -61,6 +67,7 @@ AliFemtoManager::~AliFemtoManager()
     delete writer;
   }
   delete fEventWriterCollection;
+  delete fSharedCutCache;
 }
 //____________________________
 AliFemtoManager& AliFemtoManager::operator=(const AliFemtoManager& aManager)
@@ -71,7 +78,7 @@ AliFemtoManager& AliFemtoManager::operator=(const AliFemtoManager& aManager)
   }
 
   fEventReader = aManager.fEventReader;
-
+  fShareIdenticalCuts = aManager.fShareIdenticalCuts;
 
   for (auto *analysis : *fAnalysisCollection) {
     delete analysis;
@@ -163,9 +170,29 @@ AliFemtoString AliFemtoManager::Report()
     report += analysis->Report();
   }
 
+  if (fSharedCutCache) {
+    report += "\nAliFemtoManager Reporting shared particle cuts\n";
+    report += fSharedCutCache->Report();
+  }
+
   return report;
 }
 //____________________________
+void AliFemtoManager::BuildSharedCutCache()
+{
+  // only AliFemtoSimpleAnalysis (and derived) know how to use the cache
+  fSharedCutCache = new AliFemtoSharedCutCache();
+  for (auto *analysis : *fAnalysisCollection) {
+    AliFemtoSimpleAnalysis *simple = dynamic_cast<AliFemtoSimpleAnalysis*>(analysis);
+    if (!simple) {
+      continue;
+    }
+    fSharedCutCache->Register(simple->FirstParticleCut());
+    fSharedCutCache->Register(simple->SecondParticleCut());
+    simple->SetSharedCutCache(fSharedCutCache);
+  }
+}
+//____________________________
 AliFemtoAnalysis* AliFemtoManager::Analysis( int n )
 {  // return pointer to n-th analysis
   if ( n < 0 || n > (int) fAnalysisCollection->size() ) {
@@ -209,11 +236,19 @@ int AliFemtoManager::ProcessEvent()
     writer->WriteHbtEvent(currentHbtEvent);
   }
 
+  if (fShareIdenticalCuts && !fSharedCutCache) {
+    BuildSharedCutCache();
+  }
+
   // loop over all the Analysis
   for (auto *analysis : *fAnalysisCollection) {
     analysis->ProcessEvent(currentHbtEvent);
   }
 
+  if (fSharedCutCache) {
+    fSharedCutCache->Clear();
+  }
+
   if (currentHbtEvent) {
     delete currentHbtEvent;
     currentHbtEvent = NULL;
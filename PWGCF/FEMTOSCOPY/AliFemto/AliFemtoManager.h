@@ -19,6 +19,8 @@
 #include "AliFemtoEventReader.h"
 #include "AliFemtoEventWriter.h"
 
+class AliFemtoSharedCutCache;
+
 
 /// \class AliFemtoManager
 /// \brief Main class for managing femtoscopic analyses
@@ -43,12 +45,22 @@
 /// operator private prevents potential dangling pointer (segfault)
 /// errors.
 ///
+/// With SetShareIdenticalCuts(true) particle cuts of different
+/// AliFemtoSimpleAnalysis objects with equal configuration (see
+/// AliFemtoParticleCut::FillConfiguration) are evaluated only once per
+/// event, the other analyses get copies of the selected particles.
+///
 class AliFemtoManager {
 
 private:
   AliFemtoAnalysisCollection* fAnalysisCollection;       ///< Collection of analyzes
   AliFemtoEventReader*        fEventReader;              ///< Event reader
   AliFemtoEventWriterCollection* fEventWriterCollection; ///< Event writer collection
+  bool                        fShareIdenticalCuts;       ///< Evaluate identical particle cuts once per event
+  AliFemtoSharedCutCache*     fSharedCutCache;           //!<! Shared particle selections, built with the first event
+
+  /// Register the particle cuts of all analyses in fSharedCutCache
+  void BuildSharedCutCache();
 
   AliFemtoManager(const AliFemtoManager& aManager);
   AliFemtoManager& operator=(const AliFemtoManager& aManager);
@@ -70,6 +82,11 @@ public:
   AliFemtoEventReader* EventReader();
   void SetEventReader(AliFemtoEventReader* r);
 
+  /// Share the particle selections of identical cuts between analyses,
+  /// must be set before the first event
+  void SetShareIdenticalCuts(bool share);
+  bool GetShareIdenticalCuts() const;
+
   /// Calls `Init()` on all owned EventWriters
   ///
   /// Returns 0 for success, 1 for failure.
@@ -99,4 +116,7 @@ inline void AliFemtoManager::SetEventWriter(AliFemtoEventWriter* writer){fEventW
 inline AliFemtoEventReader* AliFemtoManager::EventReader(){return fEventReader;}
 inline void AliFemtoManager::SetEventReader(AliFemtoEventReader* reader){fEventReader = reader;}
 
+inline void AliFemtoManager::SetShareIdenticalCuts(bool share){fShareIdenticalCuts = share;}
+inline bool AliFemtoManager::GetShareIdenticalCuts() const {return fShareIdenticalCuts;}
+
 #endif
@@ -14,6 +14,9 @@
 #include "AliFemtoModelWeightGeneratorLednicky.h"
 #include "AliFemtoModelHiddenInfo.h"
 #include "AliFemtoPair.h"
+#include <TFile.h>
+#include <TH3F.h>
+#include <TRandom3.h>
 //#include "StarCallf77.h"
 //#include <strstream.h>
 //#include <iomanip.h>
@@ -161,6 +164,15 @@ AliFemtoModelWeightGeneratorLednicky::AliFemtoModelWeightGeneratorLednicky()
   , fNumbNonId(0)
   , fKpKmModel(14)
   , fPhi_OffOn(1)
+  , fUseWeightTable(false)
+  , fTableNK(101)
+  , fTableNR(101)
+  , fTableNCos(21)
+  , fTableKMax(0.5)
+  , fTableRMax(50.)
+  , fWeightTableFile()
+  , fWeightTableFileRead(false)
+  , fWeightTables()
 {
   // default constructor
   fNumProcessPair = new int[fLLMax+1];
@@ -199,6 +211,15 @@ AliFemtoModelWeightGeneratorLednicky
   , fNumbNonId(aWeight.fNumbNonId)
   , fKpKmModel(aWeight.fKpKmModel)
   , fPhi_OffOn(aWeight.fPhi_OffOn)
+  , fUseWeightTable(aWeight.fUseWeightTable)
+  , fTableNK(aWeight.fTableNK)
+  , fTableNR(aWeight.fTableNR)
+  , fTableNCos(aWeight.fTableNCos)
+  , fTableKMax(aWeight.fTableKMax)
+  , fTableRMax(aWeight.fTableRMax)
+  , fWeightTableFile(aWeight.fWeightTableFile)
+  , fWeightTableFileRead(aWeight.fWeightTableFileRead)
+  , fWeightTables(aWeight.fWeightTables)
 {
   fNumProcessPair = new int[fLLMax+1];
   for (int i=1;i<=fLLMax;i++) {
@@ -246,6 +267,15 @@ AliFemtoModelWeightGeneratorLednicky::operator=(const AliFemtoModelWeightGenerat
   fNumProcessPair = new int[fLLMax+1];
   fKpKmModel = aWeight.fKpKmModel;
   fPhi_OffOn = aWeight.fPhi_OffOn;
+  fUseWeightTable = aWeight.fUseWeightTable;
+  fTableNK = aWeight.fTableNK;
+  fTableNR = aWeight.fTableNR;
+  fTableNCos = aWeight.fTableNCos;
+  fTableKMax = aWeight.fTableKMax;
+  fTableRMax = aWeight.fTableRMax;
+  fWeightTableFile = aWeight.fWeightTableFile;
+  fWeightTableFileRead = aWeight.fWeightTableFileRead;
+  fWeightTables = aWeight.fWeightTables;
 
   for (int i=1;i<=fLLMax;i++) {
     fNumProcessPair[i] = 0;
@@ -395,6 +425,18 @@ double AliFemtoModelWeightGeneratorLednicky::GenerateWeight(AliFemtoPair* aPair)
     return 0;
   }
 
+  if (fUseWeightTable && fI3c == 0 && fKStar <= fTableKMax && fRStar <= fTableRMax
+      && !(epoint1 == epoint2)) {
+    if (const std::vector<float> *table = WeightTable()) {
+      const double cosTheta = (fRStar > 0 && fKStar > 0)
+                            ? (fKStarOut*fRStarOut + fKStarSide*fRStarSide + fKStarLong*fRStarLong) / (fKStar*fRStar)
+                            : 1.0;
+      fWein = TableWeight(*table, fKStar, fRStar, cosTheta);
+      aPair->AddWeightToCache(this, fWein);
+      return fWein;
+    }
+  }
+
   double p1[] = {true_p1.x(), true_p1.y(), true_p1.z()},
          p2[] = {true_p2.x(), true_p2.y(), true_p2.z()};
 
@@ -453,6 +495,11 @@ AliFemtoModelWeightGeneratorLednicky::Report()
   tStr << "              3-Body : " << ((fI3c) ? "On"  : "Off") ;
   if (fI3c) tStr << " Mass=" <<  fNuclMass << " - Charge= " << fNuclCharge ;
   tStr << endl;
+  if (fUseWeightTable) {
+    tStr << "    Weight table : " << fTableNK << " x " << fTableNR << " x " << fTableNCos
+         << " nodes, k* <= " << fTableKMax << " GeV/c, r* <= " << fTableRMax << " fm, "
+         << fWeightTables.size() << " pair types" << endl;
+  }
   tStr << "    " << fNumProcessPair[0] << " Pairs have been Processed :" << endl;
   for (int i=1;i<=fLLMax;i++) {
     if (fNumProcessPair[i]) {
@@ -813,3 +860,210 @@ AliFemtoModelWeightGeneratorLednicky::Clone() const
   AliFemtoModelWeightGenerator* tmp = new AliFemtoModelWeightGeneratorLednicky(*this);
   return tmp;
 }
+
+//_____________________________________________
+void AliFemtoModelWeightGeneratorLednicky::SetWeightTable(int nK, double kMax, int nR, double rMax, int nCos)
+{
+  fTableNK = nK < 2 ? 2 : nK;
+  fTableNR = nR < 2 ? 2 : nR;
+  fTableNCos = nCos < 2 ? 2 : nCos;
+  fTableKMax = kMax;
+  fTableRMax = rMax;
+  fWeightTables.clear();
+}
+
+double AliFemtoModelWeightGeneratorLednicky::ExactWeight(double kStar, double rStar, double cosTheta)
+{
+  // weight of a pair at rest with the given k* along z and r* at angle theta
+  // to it, at equal times. The Fortran setup (FsiSetLL, FsiInit) has to be done
+  // by the caller. k* and r* are kept away from 0 where the exact code returns 0
+  const double k = kStar > 1.e-5 ? kStar : 1.e-5;
+  const double r = rStar > 1.e-3 ? rStar : 1.e-3;
+  const double sinTheta = sqrt(fmax(0., 1. - cosTheta*cosTheta));
+
+  double p1[] = {0., 0., k},
+         p2[] = {0., 0., -k};
+  fsimomentum(*p1, *p2);
+
+  double x1[] = {r*sinTheta, 0., r*cosTheta, 0.},
+         x2[] = {0., 0., 0., 0.};
+  fsiposition(*x1, *x2);
+
+  ltran12();
+  fsiw(1, fWeif, fWei, fWein);
+  return fI3c == 0 ? fWein : fWei;
+}
+
+double AliFemtoModelWeightGeneratorLednicky::TableWeight(const std::vector<float> &table,
+                                                         double kStar, double rStar, double cosTheta) const
+{
+  // trilinear interpolation between the table nodes
+  const double fk = kStar / fTableKMax * (fTableNK - 1),
+               fr = rStar / fTableRMax * (fTableNR - 1),
+               fc = (cosTheta + 1.) / 2. * (fTableNCos - 1);
+  const int ik = fk >= fTableNK - 1 ? fTableNK - 2 : (int)fk,
+            ir = fr >= fTableNR - 1 ? fTableNR - 2 : (int)fr,
+            ic = fc >= fTableNCos - 1 ? fTableNCos - 2 : (fc < 0 ? 0 : (int)fc);
+  const double dk = fk - ik, dr = fr - ir, dc = fmin(fmax(fc - ic, 0.), 1.);
+
+  const int strideR = fTableNCos, strideK = fTableNR * fTableNCos;
+  const float *v = &table[ik*strideK + ir*strideR + ic];
+
+  const double c00 = v[0]*(1-dc)               + v[1]*dc,
+               c01 = v[strideR]*(1-dc)         + v[strideR+1]*dc,
+               c10 = v[strideK]*(1-dc)         + v[strideK+1]*dc,
+               c11 = v[strideK+strideR]*(1-dc) + v[strideK+strideR+1]*dc;
+
+  return (c00*(1-dr) + c01*dr)*(1-dk) + (c10*(1-dr) + c11*dr)*dk;
+}
+
+void AliFemtoModelWeightGeneratorLednicky::BuildWeightTable()
+{
+  // tabulate the weights of the current pair type with the current settings
+  std::vector<float> &table = fWeightTables[fLL];
+  table.assign(fTableNK * fTableNR * fTableNCos, 0.);
+
+  FsiSetLL();
+  FsiInit();
+  for (int ik = 0; ik < fTableNK; ik++) {
+    const double k = fTableKMax * ik / (fTableNK - 1);
+    for (int ir = 0; ir < fTableNR; ir++) {
+      const double r = fTableRMax * ir / (fTableNR - 1);
+      for (int ic = 0; ic < fTableNCos; ic++) {
+        const double c = -1. + 2. * ic / (fTableNCos - 1);
+        table[(ik*fTableNR + ir)*fTableNCos + ic] = ExactWeight(k, r, c);
+      }
+    }
+  }
+  cout << "AliFemtoModelWeightGeneratorLednicky: built weight table for " << fLLName[fLL]
+       << " (" << fTableNK << " x " << fTableNR << " x " << fTableNCos << " nodes, k* <= "
+       << fTableKMax << " GeV/c, r* <= " << fTableRMax << " fm)" << endl;
+}
+
+const std::vector<float>* AliFemtoModelWeightGeneratorLednicky::WeightTable()
+{
+  // table of the current pair type, read or built on first use
+  if (fLL <= 0 || fLL > fLLMax) {
+    return nullptr;
+  }
+  if (!fWeightTableFileRead && !fWeightTableFile.empty()) {
+    fWeightTableFileRead = true;
+    LoadWeightTable(fWeightTableFile.c_str());
+  }
+  std::map<int, std::vector<float> >::const_iterator it = fWeightTables.find(fLL);
+  if (it == fWeightTables.end()) {
+    BuildWeightTable();
+    it = fWeightTables.find(fLL);
+  }
+  return &it->second;
+}
+
+bool AliFemtoModelWeightGeneratorLednicky::SaveWeightTable(const char *fileName) const
+{
+  // one TH3F per pair type, the bin centers being the table nodes
+  TFile file(fileName, "RECREATE");
+  if (file.IsZombie()) {
+    cout << "E-AliFemtoModelWeightGeneratorLednicky: cannot create " << fileName << endl;
+    return false;
+  }
+  const double hk = 0.5 * fTableKMax / (fTableNK - 1),
+               hr = 0.5 * fTableRMax / (fTableNR - 1),
+               hc = 1. / (fTableNCos - 1);
+  for (std::map<int, std::vector<float> >::const_iterator it = fWeightTables.begin();
+       it != fWeightTables.end(); ++it) {
+    TH3F hist(Form("LednickyWeights_LL%d", it->first), fLLName[it->first].c_str(),
+              fTableNK, -hk, fTableKMax + hk,
+              fTableNR, -hr, fTableRMax + hr,
+              fTableNCos, -1. - hc, 1. + hc);
+    hist.SetDirectory(nullptr);
+    for (int ik = 0; ik < fTableNK; ik++) {
+      for (int ir = 0; ir < fTableNR; ir++) {
+        for (int ic = 0; ic < fTableNCos; ic++) {
+          hist.SetBinContent(ik+1, ir+1, ic+1, it->second[(ik*fTableNR + ir)*fTableNCos + ic]);
+        }
+      }
+    }
+    file.WriteTObject(&hist);
+  }
+  file.Close();
+  return true;
+}
+
+bool AliFemtoModelWeightGeneratorLednicky::LoadWeightTable(const char *fileName)
+{
+  // read the tables written by SaveWeightTable; the grid of the file replaces
+  // the configured one
+  TFile *file = TFile::Open(fileName);
+  if (!file || file->IsZombie()) {
+    cout << "E-AliFemtoModelWeightGeneratorLednicky: cannot open " << fileName << endl;
+    delete file;
+    return false;
+  }
+  bool first = true;
+  int nLoaded = 0;
+  for (int ll = 1; ll <= fLLMax; ll++) {
+    TH3F *hist = dynamic_cast<TH3F*>(file->Get(Form("LednickyWeights_LL%d", ll)));
+    if (!hist) {
+      continue;
+    }
+    const int nK = hist->GetNbinsX(), nR = hist->GetNbinsY(), nCos = hist->GetNbinsZ();
+    const double kMax = hist->GetXaxis()->GetBinCenter(nK),
+                 rMax = hist->GetYaxis()->GetBinCenter(nR);
+    if (first) {
+      SetWeightTable(nK, kMax, nR, rMax, nCos);
+      first = false;
+    } else if (nK != fTableNK || nR != fTableNR || nCos != fTableNCos) {
+      cout << "W-AliFemtoModelWeightGeneratorLednicky: table " << hist->GetName()
+           << " has a different grid, ignored" << endl;
+      delete hist;
+      continue;
+    }
+    std::vector<float> &table = fWeightTables[ll];
+    table.resize(nK * nR * nCos);
+    for (int ik = 0; ik < nK; ik++) {
+      for (int ir = 0; ir < nR; ir++) {
+        for (int ic = 0; ic < nCos; ic++) {
+          table[(ik*nR + ir)*nCos + ic] = hist->GetBinContent(ik+1, ir+1, ic+1);
+        }
+      }
+    }
+    delete hist;
+    nLoaded++;
+  }
+  file->Close();
+  delete file;
+  cout << "AliFemtoModelWeightGeneratorLednicky: read " << nLoaded << " weight tables from " << fileName << endl;
+  return nLoaded > 0;
+}
+
+double AliFemtoModelWeightGeneratorLednicky::EstimateWeightTableError(int nSamples, double *maxError)
+{
+  const std::vector<float> *table = WeightTable();
+  if (!table || nSamples <= 0) {
+    return -1.;
+  }
+  // the table may have been read from file, make sure the Fortran is set up
+  FsiSetLL();
+  FsiInit();
+
+  TRandom3 rnd(4357);
+  double sum2 = 0., maxDiff = 0.;
+  for (int i = 0; i < nSamples; i++) {
+    const double k = rnd.Uniform(0., fTableKMax),
+                 r = rnd.Uniform(0., fTableRMax),
+                 c = rnd.Uniform(-1., 1.);
+    const double diff = fabs(TableWeight(*table, k, r, c) - ExactWeight(k, r, c));
+    sum2 += diff*diff;
+    if (diff > maxDiff) {
+      maxDiff = diff;
+    }
+  }
+  const double rms = sqrt(sum2 / nSamples);
+  cout << "AliFemtoModelWeightGeneratorLednicky: weight table of " << fLLName[fLL]
+       << ": RMS error " << rms << ", max error " << maxDiff
+       << " (" << nSamples << " points)" << endl;
+  if (maxError) {
+    *maxError = maxDiff;
+  }
+  return rms;
+}
@@ -11,6 +11,7 @@
 
 #include <vector>
 #include <string>
+#include <map>
 
 
 /// \class AliFemtoModelWeightGeneratorLednicky
@@ -21,6 +22,14 @@
 /// interation and strong interaction ot any combination of the three,
 /// as applicable.
 ///
+/// Optionally the weights are taken from a table in (k*, r*, cos theta*),
+/// interpolated trilinearly. The table of each pair type is built on first
+/// use with the current settings, or read from a file written by
+/// SaveWeightTable. Pairs outside the table range, and all pairs when the
+/// 3-body correction is on, are computed exactly. The weights are tabulated
+/// at t* = 0, so the table should only be used where the equal-time
+/// approximation is adequate.
+///
 class AliFemtoModelWeightGeneratorLednicky : public AliFemtoModelWeightGenerator {
 public:
   /// Constructor
@@ -78,6 +87,20 @@ public:
 
   virtual AliFemtoString Report();
 
+// >>> Tabulated weights
+  void SetUseWeightTable(bool use=true) { fUseWeightTable = use; }
+  /// Number of nodes and upper edges of the table (GeV/c, fm); clears existing tables
+  void SetWeightTable(int nK, double kMax, int nR, double rMax, int nCos);
+  /// File read on first use, tables missing from it are built
+  void SetWeightTableFile(const char *fileName) { fWeightTableFile = fileName; fWeightTableFileRead = false; }
+  bool LoadWeightTable(const char *fileName);
+  bool SaveWeightTable(const char *fileName) const;
+  void BuildWeightTable();   ///< (re)build the table of the current pair type
+  void ClearWeightTables() { fWeightTables.clear(); }
+  /// RMS (and optionally maximum) absolute difference between the table and
+  /// the exact weight of the current pair type at nSamples random points
+  double EstimateWeightTableError(int nSamples=1000, double *maxError=nullptr);
+
 protected:
   // Fsi weight output
   double  fWei;  // normal weight
@@ -124,8 +147,22 @@ protected:
   void FsiNucl();
   bool SetPid(const int aPid1,const int aPid2);
 
+  double ExactWeight(double kStar, double rStar, double cosTheta);
+  double TableWeight(const std::vector<float> &table, double kStar, double rStar, double cosTheta) const;
+  const std::vector<float>* WeightTable();
+
+  bool   fUseWeightTable;    // take the weights from the table where possible
+  int    fTableNK;           // number of k* nodes of the table
+  int    fTableNR;           // number of r* nodes of the table
+  int    fTableNCos;         // number of cos theta* nodes of the table
+  double fTableKMax;         // last k* node
+  double fTableRMax;         // last r* node
+  std::string fWeightTableFile;  // file the tables are read from
+  bool   fWeightTableFileRead;   //! file has been read
+  std::map<int, std::vector<float> > fWeightTables; //! tables per internal pair type
+
 #ifdef __ROOT__
-  ClassDef(AliFemtoModelWeightGeneratorLednicky, 2);
+  ClassDef(AliFemtoModelWeightGeneratorLednicky, 3);
 #endif
 };
 
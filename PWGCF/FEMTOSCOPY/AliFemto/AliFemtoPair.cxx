@@ -26,6 +26,11 @@ AliFemtoPair::AliFemtoPair():
   fDKLong(0.0),
   fCVK(0.0),
   fKStarCalc(0.0),
+  fLCMSParNotCalculated(1),
+  fQOutCMS(0.0),
+  fQSideCMS(0.0),
+  fQLongCMS(0.0),
+  fQInvCalc(0.0),
   fNonIdParNotCalculatedGlobal(0),
   fMergingParNotCalculated(0),
   fWeightedAvSep(0.0),
@@ -66,6 +71,11 @@ AliFemtoPair::AliFemtoPair(AliFemtoParticle* a, AliFemtoParticle* b):
   fDKLong(0.0),
   fCVK(0.0),
   fKStarCalc(0.0),
+  fLCMSParNotCalculated(1),
+  fQOutCMS(0.0),
+  fQSideCMS(0.0),
+  fQLongCMS(0.0),
+  fQInvCalc(0.0),
   fNonIdParNotCalculatedGlobal(0),
   fMergingParNotCalculated(0),
   fWeightedAvSep(0.0),
@@ -137,6 +147,11 @@ AliFemtoPair::AliFemtoPair(const AliFemtoPair &aPair):
   fDKLong(aPair.fDKLong),
   fCVK(aPair.fCVK),
   fKStarCalc(aPair.fKStarCalc),
+  fLCMSParNotCalculated(aPair.fLCMSParNotCalculated),
+  fQOutCMS(aPair.fQOutCMS),
+  fQSideCMS(aPair.fQSideCMS),
+  fQLongCMS(aPair.fQLongCMS),
+  fQInvCalc(aPair.fQInvCalc),
   fNonIdParNotCalculatedGlobal(aPair.fNonIdParNotCalculatedGlobal),
   fMergingParNotCalculated(aPair.fMergingParNotCalculated),
   fWeightedAvSep(aPair.fWeightedAvSep),
@@ -184,6 +199,12 @@ AliFemtoPair& AliFemtoPair::operator=(const AliFemtoPair &aPair)
   fCVK = aPair.fCVK;
   fKStarCalc = aPair.fKStarCalc;
 
+  fLCMSParNotCalculated = aPair.fLCMSParNotCalculated;
+  fQOutCMS = aPair.fQOutCMS;
+  fQSideCMS = aPair.fQSideCMS;
+  fQLongCMS = aPair.fQLongCMS;
+  fQInvCalc = aPair.fQInvCalc;
+
   fNonIdParNotCalculatedGlobal = aPair.fNonIdParNotCalculatedGlobal;
 
   fMergingParNotCalculated = aPair.fMergingParNotCalculated;
@@ -388,68 +409,38 @@ void AliFemtoPair::QYKPPF(double& qP, double& qT, double& q0) const
 
 
 //_________________
-double AliFemtoPair::QOutCMS() const
+void AliFemtoPair::CalcLCMSPar() const
 {
-  // relative momentum out component in lab frame
-  const AliFemtoThreeVector
-    &p1 = fTrack1->FourMomentum().vect(),
-    &p2 = fTrack2->FourMomentum().vect();
-
-  const double
-    dx = p1.x() - p2.x(),
-    px = p1.x() + p2.x(),
-
-    dy = p1.y() - p2.y(),
-    py = p1.y() + p2.y(),
-
-    k = dx*px + dy*py,
-    pt = ::sqrt(px*px + py*py);
-
-  return CHECKED_DIVIDE_ELSE_ZERO(k, pt);
-}
-
-//_________________
-double AliFemtoPair::QSideCMS() const
-{
-  // relative momentum side component in lab frame
-  const AliFemtoThreeVector
-    &p1 = fTrack1->FourMomentum().vect(),
-    &p2 = fTrack2->FourMomentum().vect();
+  // relative momentum components in the longitudinally comoving frame
+  // (out and side are the same as in the lab) and qinv
+  const AliFemtoLorentzVector
+    &tmp1 = fTrack1->FourMomentum(),
+    &tmp2 = fTrack2->FourMomentum();
 
   const double
-    x1 = p1.x(),
-    y1 = p1.y(),
-
-    x2 = p2.x(),
-    y2 = p2.y(),
-
-    xt = x1+x2,
-    yt = y1+y2,
+    x1 = tmp1.x(), y1 = tmp1.y(),
+    x2 = tmp2.x(), y2 = tmp2.y(),
 
-    k = 2.0 * (x2*y1 - x1*y2),
-    pt = ::sqrt(xt*xt + yt*yt);
+    dx = x1 - x2, px = x1 + x2,
+    dy = y1 - y2, py = y1 + y2,
+    pt = ::sqrt(px*px + py*py),
 
-  return CHECKED_DIVIDE_ELSE_ZERO(k, pt);
-}
-
-//_________________________
-double AliFemtoPair::QLongCMS() const
-{
-  // relative momentum component in lab frame
-  const AliFemtoLorentzVector
-    &tmp1 = fTrack1->FourMomentum(),
-    &tmp2 = fTrack2->FourMomentum();
+    dz = tmp1.z() - tmp2.z(),
+    zz = tmp1.z() + tmp2.z(),
+    dt = tmp1.t() - tmp2.t(),
+    tt = tmp1.t() + tmp2.t(),
 
-  double dz = tmp1.z() - tmp2.z();
-  double zz = tmp1.z() + tmp2.z();
+    beta = zz/tt,
+    gamma = 1.0/TMath::Sqrt((1.-beta)*(1.+beta));
 
-  double dt = tmp1.t() - tmp2.t();
-  double tt = tmp1.t() + tmp2.t();
+  fQOutCMS = CHECKED_DIVIDE_ELSE_ZERO(dx*px + dy*py, pt);
+  fQSideCMS = CHECKED_DIVIDE_ELSE_ZERO(2.0 * (x2*y1 - x1*y2), pt);
+  fQLongCMS = gamma * (dz - beta*dt);
 
-  double beta = zz/tt;
-  double gamma = 1.0/TMath::Sqrt((1.-beta)*(1.+beta));
+  const AliFemtoLorentzVector tDiff = tmp1 - tmp2;
+  fQInvCalc = -tDiff.m();
 
-  return gamma * (dz - beta*dt);
+  fLCMSParNotCalculated = 0;
 }
 
 //________________________________
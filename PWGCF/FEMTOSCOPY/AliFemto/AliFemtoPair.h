@@ -64,6 +64,10 @@ public:
   double QOutCMS() const;
   double QLongCMS() const;
 
+  /// All three LCMS components, computed once per pair and shared by all
+  /// correlation functions
+  void QLCMS(double &qout, double &qside, double &qlong) const;
+
   double KSide() const;
   double KOut() const;
   double KLong() const;
@@ -235,6 +239,13 @@ private:
   mutable double fKStarCalc; // momemntum of first particle in PRF - k*
   void CalcNonIdPar() const;
 
+  mutable short fLCMSParNotCalculated; // If the LCMS components and qinv were calculated
+  mutable double fQOutCMS;   // relative momentum out component in LCMS
+  mutable double fQSideCMS;  // relative momentum side component in LCMS
+  mutable double fQLongCMS;  // relative momentum long component in LCMS
+  mutable double fQInvCalc;  // qinv
+  void CalcLCMSPar() const;
+
   mutable short fNonIdParNotCalculatedGlobal; // If global k* was calculated
  /* mutable double fDKSideGlobal;
   mutable double fDKOutGlobal;
@@ -305,6 +316,7 @@ private:
 
 inline void AliFemtoPair::ResetParCalculated(){
   fNonIdParNotCalculated=1;
+  fLCMSParNotCalculated=1;
   fNonIdParNotCalculatedGlobal=1;
   fMergingParNotCalculated=1;
   fMergingParNotCalculatedTrkV0Pos=1;
@@ -348,8 +360,26 @@ inline double AliFemtoPair::KStar() const{
   return fKStarCalc;
 }
 inline double AliFemtoPair::QInv() const {
-  AliFemtoLorentzVector tDiff = (fTrack1->FourMomentum()-fTrack2->FourMomentum());
-  return -tDiff.m();
+  if(fLCMSParNotCalculated) CalcLCMSPar();
+  return fQInvCalc;
+}
+inline double AliFemtoPair::QOutCMS() const {
+  if(fLCMSParNotCalculated) CalcLCMSPar();
+  return fQOutCMS;
+}
+inline double AliFemtoPair::QSideCMS() const {
+  if(fLCMSParNotCalculated) CalcLCMSPar();
+  return fQSideCMS;
+}
+inline double AliFemtoPair::QLongCMS() const {
+  if(fLCMSParNotCalculated) CalcLCMSPar();
+  return fQLongCMS;
+}
+inline void AliFemtoPair::QLCMS(double &qout, double &qside, double &qlong) const {
+  if(fLCMSParNotCalculated) CalcLCMSPar();
+  qout = fQOutCMS;
+  qside = fQSideCMS;
+  qlong = fQLongCMS;
 }
 
 // Fabrice private <<<
@@ -13,6 +13,7 @@
 #include <TList.h>
 
 class AliFemtoAnalysis;
+class AliFemtoConfigObject;
 
 
 /// \class AliFemtoParticleCut
@@ -38,6 +39,11 @@ public:
 
   virtual AliFemtoParticleCut* Clone() { return NULL; }
 
+  /// Insert all settings which affect the selection into the map cfg.
+  /// Cuts giving equal configurations must select the same particles;
+  /// the default returns false, meaning the configuration is unknown.
+  virtual bool FillConfiguration(AliFemtoConfigObject &) const { return false; }
+
   virtual AliFemtoParticleType Type() = 0;    ///< Pure virtual function which returns the particle type
 
   /// The following allows "back-pointing" from the CorrFctn to the "parent" Analysis
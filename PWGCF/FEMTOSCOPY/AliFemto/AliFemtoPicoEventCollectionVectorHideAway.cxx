@@ -6,6 +6,14 @@
 //                                                                       //
 ///////////////////////////////////////////////////////////////////////////
 #include "AliFemtoPicoEventCollectionVectorHideAway.h"
+#include "AliFemtoParticle.h"
+#include "AliFemtoTrack.h"
+#include "AliFemtoV0.h"
+#include "AliFemtoXi.h"
+#include "AliFemtoKink.h"
+#include "AliFemtoModelHiddenInfo.h"
+#include <iostream>
+#include <TString.h>
 
 // -----------------------------------
 AliFemtoPicoEventCollectionVectorHideAway::AliFemtoPicoEventCollectionVectorHideAway(int bx, double lx, double ux,
@@ -17,7 +25,13 @@ AliFemtoPicoEventCollectionVectorHideAway::AliFemtoPicoEventCollectionVectorHide
   fMaxx(ux),  fMaxy(uy),  fMaxz(uz),
   fStepx(0),  fStepy(0),  fStepz(0),
   fCollection(0),
-  fCollectionVector(0)
+  fCollectionVector(0),
+  fMemoryBudget(0),
+  fBinMemory(),
+  fBinLastUse(),
+  fNLookups(0),
+  fLastBin(-1),
+  fNEvicted(0)
 {
   // basic constructor
   fBinsTot = fBinsx * fBinsy * fBinsz;
@@ -32,6 +46,8 @@ AliFemtoPicoEventCollectionVectorHideAway::AliFemtoPicoEventCollectionVectorHide
     fCollection = new AliFemtoPicoEventCollection();
     fCollectionVector.push_back(fCollection);
   }
+  fBinMemory.assign(fBinsTot, 0);
+  fBinLastUse.assign(fBinsTot, 0);
 }
 // -----------------------------------
 AliFemtoPicoEventCollection* AliFemtoPicoEventCollectionVectorHideAway::PicoEventCollection(int ix, int iy, int iz) { 
@@ -42,6 +58,15 @@ AliFemtoPicoEventCollection* AliFemtoPicoEventCollectionVectorHideAway::PicoEven
   int bin = ix + iy*fBinsx + iz*fBinsy*fBinsx; 
 //   cout << " AliFemtoPicoEventCollectionVectorHideAway::PicoEventCollection(...) - bin(ix,iy,iz): ";
 //   cout << bin << "(" << ix <<"," << iy << "," << iz <<")" << endl;
+
+  // the caller only modifies the collection it got from the previous
+  // lookup, so that is the only bin whose memory has to be updated
+  if (fMemoryBudget) {
+    if (fLastBin >= 0) UpdateBinMemory(fLastBin);
+    EnforceMemoryBudget(bin);
+  }
+  fBinLastUse[bin] = ++fNLookups;
+  fLastBin = bin;
   return fCollectionVector[bin]; 
 }
 // -----------------------------------
@@ -66,7 +91,13 @@ AliFemtoPicoEventCollectionVectorHideAway::AliFemtoPicoEventCollectionVectorHide
   fMaxx(0),  fMaxy(0),  fMaxz(0),
   fStepx(0),  fStepy(0),  fStepz(0),
   fCollection(0),
-  fCollectionVector(0)
+  fCollectionVector(0),
+  fMemoryBudget(0),
+  fBinMemory(),
+  fBinLastUse(),
+  fNLookups(0),
+  fLastBin(-1),
+  fNEvicted(0)
 {
   // copy constructor
   fBinsTot = aColl.fBinsTot;
@@ -85,9 +116,15 @@ AliFemtoPicoEventCollectionVectorHideAway::AliFemtoPicoEventCollectionVectorHide
   fCollection = aColl.fCollection;
 
   fCollectionVector.clear();
-  for (int iter=0; aColl.fCollectionVector.size();iter++){
+  for (unsigned int iter=0; iter<aColl.fCollectionVector.size();iter++){
     fCollectionVector.push_back(aColl.fCollectionVector[iter]);
   }
+  fMemoryBudget = aColl.fMemoryBudget;
+  fBinMemory = aColl.fBinMemory;
+  fBinLastUse = aColl.fBinLastUse;
+  fNLookups = aColl.fNLookups;
+  fLastBin = aColl.fLastBin;
+  fNEvicted = aColl.fNEvicted;
 }
 //___________________________________
 AliFemtoPicoEventCollectionVectorHideAway::~AliFemtoPicoEventCollectionVectorHideAway()
@@ -119,12 +156,120 @@ AliFemtoPicoEventCollectionVectorHideAway& AliFemtoPicoEventCollectionVectorHide
 
   fCollectionVector.clear();
 
-  for (int iter=0; aColl.fCollectionVector.size();iter++){
+  for (unsigned int iter=0; iter<aColl.fCollectionVector.size();iter++){
     fCollectionVector.push_back(aColl.fCollectionVector[iter]);
   }
+  fMemoryBudget = aColl.fMemoryBudget;
+  fBinMemory = aColl.fBinMemory;
+  fBinLastUse = aColl.fBinLastUse;
+  fNLookups = aColl.fNLookups;
+  fLastBin = aColl.fLastBin;
+  fNEvicted = aColl.fNEvicted;
 
   return *this;
 }
 unsigned int AliFemtoPicoEventCollectionVectorHideAway::GetBinXNumber(double x) { return (int)floor( (x-fMinx)/fStepx ); }
 unsigned int AliFemtoPicoEventCollectionVectorHideAway::GetBinYNumber(double y) { return (int)floor( (y-fMiny)/fStepy ); }
 unsigned int AliFemtoPicoEventCollectionVectorHideAway::GetBinZNumber(double z) { return (int)floor( (z-fMinz)/fStepz ); }
+//___________________________________
+ULong64_t AliFemtoPicoEventCollectionVectorHideAway::EstimatedSize(AliFemtoPicoEvent *event)
+{
+  // approximate heap size of a pico event: the particles, what they point to
+  // and the list nodes holding them
+  const ULong64_t listNode = sizeof(AliFemtoParticle*) + 2*sizeof(void*);
+  ULong64_t size = sizeof(AliFemtoPicoEvent);
+  AliFemtoParticleCollection *colls[3] = {event->FirstParticleCollection(),
+                                          event->SecondParticleCollection(),
+                                          event->ThirdParticleCollection()};
+  for (int ic=0; ic<3; ic++) {
+    if (!colls[ic]) continue;
+    size += sizeof(AliFemtoParticleCollection);
+    for (AliFemtoParticleIterator it=colls[ic]->begin(); it!=colls[ic]->end(); ++it) {
+      const AliFemtoParticle *part = *it;
+      size += listNode + sizeof(AliFemtoParticle);
+      if (part->Track()) size += sizeof(AliFemtoTrack);
+      if (part->V0())    size += sizeof(AliFemtoV0);
+      if (part->Xi())    size += sizeof(AliFemtoXi);
+      if (part->Kink())  size += sizeof(AliFemtoKink);
+      if (part->HiddenInfo()) size += sizeof(AliFemtoModelHiddenInfo);
+    }
+  }
+  return size;
+}
+//___________________________________
+void AliFemtoPicoEventCollectionVectorHideAway::UpdateBinMemory(int bin)
+{
+  // recompute the estimated memory of the events buffered in a bin
+  ULong64_t size = 0;
+  AliFemtoPicoEventCollection *coll = fCollectionVector[bin];
+  for (AliFemtoPicoEventIterator it=coll->begin(); it!=coll->end(); ++it)
+    size += EstimatedSize(*it);
+  fBinMemory[bin] = size;
+}
+//___________________________________
+void AliFemtoPicoEventCollectionVectorHideAway::EnforceMemoryBudget(int keepBin)
+{
+  // drop the oldest events (back of the list) of the least recently used
+  // bins until the buffers fit in the budget; keepBin is about to be used
+  // and is left alone
+  ULong64_t total = 0;
+  for (int i=0; i<fBinsTot; i++) total += fBinMemory[i];
+
+  while (total > fMemoryBudget) {
+    int lru = -1;
+    for (int i=0; i<fBinsTot; i++) {
+      if (i == keepBin || fCollectionVector[i]->empty()) continue;
+      if (lru < 0 || fBinLastUse[i] < fBinLastUse[lru]) lru = i;
+    }
+    if (lru < 0) break;
+
+    AliFemtoPicoEventCollection *coll = fCollectionVector[lru];
+    AliFemtoPicoEvent *oldest = coll->back();
+    const ULong64_t size = EstimatedSize(oldest);
+    coll->pop_back();
+    delete oldest;
+    fNEvicted++;
+
+    const ULong64_t freed = size < fBinMemory[lru] ? size : fBinMemory[lru];
+    fBinMemory[lru] -= freed;
+    total -= freed;
+  }
+}
+//___________________________________
+ULong64_t AliFemtoPicoEventCollectionVectorHideAway::GetBinMemory(int bin)
+{
+  // estimated memory of the events buffered in a bin
+  if (bin < 0 || bin >= fBinsTot) return 0;
+  UpdateBinMemory(bin);
+  return fBinMemory[bin];
+}
+//___________________________________
+ULong64_t AliFemtoPicoEventCollectionVectorHideAway::GetMemory()
+{
+  // estimated memory of all buffered events
+  ULong64_t total = 0;
+  for (int i=0; i<fBinsTot; i++) total += GetBinMemory(i);
+  return total;
+}
+//___________________________________
+void AliFemtoPicoEventCollectionVectorHideAway::PrintOccupancy()
+{
+  // number of events and estimated memory of each non-empty bin
+  ULong64_t total = 0;
+  unsigned int nEvents = 0;
+  std::cout << "AliFemtoPicoEventCollectionVectorHideAway: " << fBinsTot << " mixing bins ("
+            << fBinsx << " x " << fBinsy << " x " << fBinsz << ")" << std::endl;
+  for (int i=0; i<fBinsTot; i++) {
+    const ULong64_t mem = GetBinMemory(i);
+    const unsigned int n = fCollectionVector[i]->size();
+    total += mem;
+    nEvents += n;
+    if (!n) continue;
+    std::cout << Form("  bin %4d (%3d,%3d,%3d): %3u events %10.1f kB", i,
+                      i%fBinsx, (i/fBinsx)%fBinsy, i/(fBinsx*fBinsy), n, mem/1024.) << std::endl;
+  }
+  std::cout << Form("  total: %u events %.1f MB", nEvents, total/1048576.);
+  if (fMemoryBudget)
+    std::cout << Form(" (budget %.1f MB, %u events dropped)", fMemoryBudget/1048576., fNEvicted);
+  std::cout << std::endl;
+}
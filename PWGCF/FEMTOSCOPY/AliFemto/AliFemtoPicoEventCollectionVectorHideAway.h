@@ -3,6 +3,9 @@
 // AliFemtoPicoEventCollectionVectorHideAway: a helper class for         //
 // managing many mixing buffers with up to three variables used for      //
 // binning.                                                              //
+// Optionally the buffers are kept within a memory budget: when the      //
+// estimated size of all buffered pico events exceeds it, the oldest     //
+// events of the least recently used bins are dropped.                   //
 //                                                                       //
 ///////////////////////////////////////////////////////////////////////////
 
@@ -14,6 +17,7 @@
 #include <vector>
 #include <list>
 #include <float.h>
+#include <Rtypes.h>
 #include <limits.h>
 
 #if !defined(ST_NO_NAMESPACES)
@@ -35,7 +39,20 @@ public:
   unsigned int GetBinXNumber(double x);
   unsigned int GetBinYNumber(double y);
   unsigned int GetBinZNumber(double z);
+
+  void SetMemoryBudget(ULong64_t bytes) { fMemoryBudget = bytes; } // 0: no limit
+  ULong64_t GetMemoryBudget() const { return fMemoryBudget; }
+  ULong64_t GetMemory();                               // estimated size of all buffered events
+  ULong64_t GetBinMemory(int bin);                     // estimated size of the events of one bin
+  unsigned int GetNEvictedEvents() const { return fNEvicted; }
+  void PrintOccupancy();
+
+  static ULong64_t EstimatedSize(AliFemtoPicoEvent *event);
+
 private:
+  void UpdateBinMemory(int bin);
+  void EnforceMemoryBudget(int keepBin);
+
   int fBinsTot;                                        // Total number of bins 
   int fBinsx,fBinsy,fBinsz;                            // Number of bins on x, y, z axis
   double fMinx,fMiny,fMinz;                            // Minima on x, y, z axis
@@ -43,6 +60,13 @@ private:
   double fStepx,fStepy,fStepz;                         // Steps on x, y, z axis
   AliFemtoPicoEventCollection* fCollection;            // Pico event collection
   AliFemtoPicoEventCollectionVector fCollectionVector; // Collection vector
+
+  ULong64_t fMemoryBudget;                             // memory budget of all bins in bytes, 0: no limit
+  vector<ULong64_t> fBinMemory;                        // estimated memory per bin when last updated
+  vector<ULong64_t> fBinLastUse;                       // lookup counter of the last use of each bin
+  ULong64_t fNLookups;                                 // number of lookups
+  int fLastBin;                                        // bin returned by the last lookup, -1: none
+  unsigned int fNEvicted;                              // number of events dropped to fit the budget
 };
 
 #endif
@@ -0,0 +1,183 @@
+///
+/// \file AliFemtoSharedCutCache.cxx
+///
+
+#include "AliFemtoSharedCutCache.h"
+#include "AliFemtoEvent.h"
+#include "AliFemtoParticle.h"
+#include "AliFemtoTrackCut.h"
+#include "AliFemtoV0Cut.h"
+#include "AliFemtoKinkCut.h"
+#include "AliFemtoXiTrackCut.h"
+
+#include <TString.h>
+
+#include <iostream>
+
+namespace {
+
+/// Evaluate the cut on all candidates, keeping the result and a copy of the
+/// accepted particles
+template <class TrackCollectionType, class TrackCutType>
+void RecordParticles(TrackCutType *cut,
+                     TrackCollectionType *candidates,
+                     AliFemtoParticleCollection *output,
+                     std::vector<bool> &pass,
+                     std::vector<AliFemtoParticle*> &particles)
+{
+  pass.reserve(candidates->size());
+  for (const auto &candidate : *candidates) {
+    const Bool_t passes = cut->Pass(candidate);
+    cut->FillCutMonitor(candidate, passes);
+    pass.push_back(passes);
+    if (passes) {
+      AliFemtoParticle *particle = new AliFemtoParticle(candidate, cut->Mass());
+      particles.push_back(new AliFemtoParticle(*particle));
+      output->push_back(particle);
+    }
+  }
+}
+
+/// Fill the monitors and the output from a previous evaluation
+template <class TrackCollectionType, class TrackCutType>
+void ReplayParticles(TrackCutType *cut,
+                     TrackCollectionType *candidates,
+                     AliFemtoParticleCollection *output,
+                     const std::vector<bool> &pass,
+                     const std::vector<AliFemtoParticle*> &particles)
+{
+  size_t iCandidate = 0, iParticle = 0;
+  for (const auto &candidate : *candidates) {
+    const Bool_t passes = pass[iCandidate++];
+    cut->FillCutMonitor(candidate, passes);
+    if (passes) {
+      output->push_back(new AliFemtoParticle(*particles[iParticle++]));
+    }
+  }
+}
+
+template <class TrackCollectionType, class TrackCutType>
+void FillFromSlot(bool filled,
+                  TrackCutType *cut,
+                  TrackCollectionType *candidates,
+                  AliFemtoParticleCollection *output,
+                  std::vector<bool> &pass,
+                  std::vector<AliFemtoParticle*> &particles)
+{
+  if (filled) {
+    ReplayParticles(cut, candidates, output, pass, particles);
+  } else {
+    RecordParticles(cut, candidates, output, pass, particles);
+  }
+}
+
+}
+
+//_____________________________
+AliFemtoSharedCutCache::AliFemtoSharedCutCache():
+  fSlots(),
+  fCutSlot()
+{
+}
+
+//_____________________________
+AliFemtoSharedCutCache::~AliFemtoSharedCutCache()
+{
+  Clear();
+}
+
+//_____________________________
+void AliFemtoSharedCutCache::Register(AliFemtoParticleCut *cut)
+{
+  if (!cut || fCutSlot.count(cut)) {
+    return;
+  }
+  AliFemtoConfigObject config = AliFemtoConfigObject(AliFemtoConfigObject::MapValue_t());
+  if (!cut->FillConfiguration(config)) {
+    return;
+  }
+  config.insert("type", static_cast<Int_t>(cut->Type()));
+
+  size_t slot = 0;
+  for (; slot < fSlots.size(); ++slot) {
+    if (fSlots[slot].fConfig == config) {
+      break;
+    }
+  }
+  if (slot == fSlots.size()) {
+    fSlots.push_back(Slot());
+    fSlots.back().fConfig = config;
+    fSlots.back().fNCuts = 0;
+    fSlots.back().fFilled = false;
+    fSlots.back().fNReused = 0;
+  }
+  fSlots[slot].fNCuts++;
+  fCutSlot[cut] = slot;
+}
+
+//_____________________________
+bool AliFemtoSharedCutCache::IsShared(const AliFemtoParticleCut *cut) const
+{
+  std::map<const AliFemtoParticleCut*, size_t>::const_iterator it = fCutSlot.find(cut);
+  return it != fCutSlot.end() && fSlots[it->second].fNCuts > 1;
+}
+
+//_____________________________
+void AliFemtoSharedCutCache::FillParticleCollection(AliFemtoParticleCut *cut,
+                                                    const AliFemtoEvent *event,
+                                                    AliFemtoParticleCollection *output)
+{
+  Slot &slot = fSlots[fCutSlot.find(cut)->second];
+  const bool filled = slot.fFilled;
+
+  switch (cut->Type()) {
+  case hbtTrack:
+    FillFromSlot(filled, static_cast<AliFemtoTrackCut*>(cut), event->TrackCollection(), output, slot.fPass, slot.fParticles);
+    break;
+  case hbtV0:
+    FillFromSlot(filled, static_cast<AliFemtoV0Cut*>(cut), event->V0Collection(), output, slot.fPass, slot.fParticles);
+    break;
+  case hbtXi:
+    FillFromSlot(filled, static_cast<AliFemtoXiTrackCut*>(cut), event->XiCollection(), output, slot.fPass, slot.fParticles);
+    break;
+  case hbtKink:
+    FillFromSlot(filled, static_cast<AliFemtoKinkCut*>(cut), event->KinkCollection(), output, slot.fPass, slot.fParticles);
+    break;
+  default:
+    std::cout << "E-AliFemtoSharedCutCache::FillParticleCollection: "
+            "Undefined Particle Cut type!!! (" << cut->Type() << ")\n";
+    return;
+  }
+
+  if (filled) {
+    slot.fNReused++;
+  }
+  slot.fFilled = true;
+}
+
+//_____________________________
+void AliFemtoSharedCutCache::Clear()
+{
+  for (auto &slot : fSlots) {
+    for (auto *particle : slot.fParticles) {
+      delete particle;
+    }
+    slot.fParticles.clear();
+    slot.fPass.clear();
+    slot.fFilled = false;
+  }
+}
+
+//_____________________________
+AliFemtoString AliFemtoSharedCutCache::Report() const
+{
+  TString report;
+  for (const auto &slot : fSlots) {
+    if (slot.fNCuts < 2) {
+      continue;
+    }
+    report += TString::Format("Particle cut shared by %d analyses, %llu collections filled from the cache\n  %s\n",
+                              slot.fNCuts, slot.fNReused, slot.fConfig.Stringify().Data());
+  }
+  return AliFemtoString(report.Data());
+}
@@ -0,0 +1,68 @@
+///
+/// \file AliFemtoSharedCutCache.h
+///
+
+#ifndef ALIFEMTOSHAREDCUTCACHE_H
+#define ALIFEMTOSHAREDCUTCACHE_H
+
+#include "AliFemtoTypes.h"
+#include "AliFemtoConfigObject.h"
+#include "AliFemtoParticleCollection.h"
+
+#include <vector>
+#include <map>
+
+class AliFemtoParticle;
+class AliFemtoParticleCut;
+class AliFemtoEvent;
+
+/// \class AliFemtoSharedCutCache
+/// \brief Particles selected by identical particle cuts of different analyses
+///
+/// The manager registers the particle cuts of its analyses; cuts with equal
+/// configuration (AliFemtoParticleCut::FillConfiguration) share a slot. The
+/// first analysis filling its collection with a shared cut evaluates it and
+/// the result is stored; the following ones get copies of the stored
+/// particles. The cut monitors of every analysis are filled as usual, the
+/// pass/fail counters inside the cuts only count the first evaluation.
+///
+class AliFemtoSharedCutCache {
+public:
+  AliFemtoSharedCutCache();
+  ~AliFemtoSharedCutCache();
+
+  /// Add a cut of an analysis; cuts without configuration are ignored
+  void Register(AliFemtoParticleCut *cut);
+
+  /// An identical cut was registered by another analysis
+  bool IsShared(const AliFemtoParticleCut *cut) const;
+
+  /// Fill the output with the particles of the event passing the cut,
+  /// evaluating it only if no identical cut was evaluated in this event
+  void FillParticleCollection(AliFemtoParticleCut *cut,
+                              const AliFemtoEvent *event,
+                              AliFemtoParticleCollection *output);
+
+  /// Drop the stored results, to be called after each event
+  void Clear();
+
+  AliFemtoString Report() const;
+
+private:
+  AliFemtoSharedCutCache(const AliFemtoSharedCutCache &);
+  AliFemtoSharedCutCache &operator=(const AliFemtoSharedCutCache &);
+
+  struct Slot {
+    AliFemtoConfigObject fConfig;                ///< configuration of the cuts
+    int fNCuts;                                  ///< number of registered cuts
+    bool fFilled;                                ///< evaluated in this event
+    std::vector<bool> fPass;                     ///< result for each candidate
+    std::vector<AliFemtoParticle*> fParticles;   ///< particles passing the cut
+    ULong64_t fNReused;                          ///< collections filled from the cache
+  };
+
+  std::vector<Slot> fSlots;                                 ///< one per distinct configuration
+  std::map<const AliFemtoParticleCut*, size_t> fCutSlot;    ///< slot of each registered cut
+};
+
+#endif
@@ -9,10 +9,16 @@
 #include "AliFemtoXiCut.h"
 #include "AliFemtoXiTrackCut.h"
 #include "AliFemtoPicoEvent.h"
+#include "AliFemtoSharedCutCache.h"
 
+#include <TH1.h>
+#include <TList.h>
+
+#include <algorithm>
 #include <string>
 #include <iostream>
 #include <iterator>
+#include <thread>
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
@@ -183,7 +189,11 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis():
   fMinSizePartCollection(0),
   fVerbose(kTRUE),
   fPerformSharedDaughterCut(kFALSE),
-  fEnablePairMonitors(kFALSE)
+  fEnablePairMonitors(kFALSE),
+  fNThreads(1),
+  fThreadPairCuts(),
+  fThreadCorrFctns(),
+  fSharedCutCache(nullptr)
 {
   // Default constructor
   fCorrFctnCollection = new AliFemtoCorrFctnCollection;
@@ -205,7 +215,11 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis(const AliFemtoSimpleAnalysis& a):
   fMinSizePartCollection(a.fMinSizePartCollection),
   fVerbose(a.fVerbose),
   fPerformSharedDaughterCut(a.fPerformSharedDaughterCut),
-  fEnablePairMonitors(a.fEnablePairMonitors)
+  fEnablePairMonitors(a.fEnablePairMonitors),
+  fNThreads(a.fNThreads),
+  fThreadPairCuts(),
+  fThreadCorrFctns(),
+  fSharedCutCache(nullptr)
 {
   /// Copy constructor
 
@@ -292,6 +306,8 @@ AliFemtoSimpleAnalysis::~AliFemtoSimpleAnalysis()
     cout << " AliFemtoSimpleAnalysis::~AliFemtoSimpleAnalysis()" << endl;
   }
 
+  DeleteThreadClones();
+
   // will not double-delete particle cut
   if (fFirstParticleCut == fSecondParticleCut) {
     fSecondParticleCut = nullptr;
@@ -326,6 +342,8 @@ AliFemtoSimpleAnalysis& AliFemtoSimpleAnalysis::operator=(const AliFemtoSimpleAn
   if (this == &aAna)
     return *this;
 
+  DeleteThreadClones();
+
   // clear second particle cut to avoid double delete
   if (fFirstParticleCut == fSecondParticleCut) {
     fSecondParticleCut = nullptr;
@@ -402,10 +420,30 @@ AliFemtoSimpleAnalysis& AliFemtoSimpleAnalysis::operator=(const AliFemtoSimpleAn
   fVerbose = aAna.fVerbose;
   fPerformSharedDaughterCut = aAna.fPerformSharedDaughterCut;
   fEnablePairMonitors = aAna.fEnablePairMonitors;
+  fNThreads = aAna.fNThreads;
 
   return *this;
 }
 //______________________
+void AliFemtoSimpleAnalysis::FillParticleCollection(AliFemtoParticleCut *cut,
+                                                    const AliFemtoEvent *hbtEvent,
+                                                    AliFemtoParticleCollection *collection)
+{
+  /// Use the result of an identical cut of another analysis if available.
+  /// The shared daughter cut of V0s and Xis removes candidates depending on
+  /// the whole collection, these are always evaluated here.
+
+  const bool sharedDaughters = fPerformSharedDaughterCut
+                             && (cut->Type() == hbtV0 || cut->Type() == hbtXi);
+
+  if (fSharedCutCache && !sharedDaughters && fSharedCutCache->IsShared(cut)) {
+    fSharedCutCache->FillParticleCollection(cut, hbtEvent, collection);
+    cut->FillCutMonitor(hbtEvent, collection);
+  } else {
+    FillHbtParticleCollection(cut, hbtEvent, collection, fPerformSharedDaughterCut);
+  }
+}
+//______________________
 AliFemtoCorrFctn* AliFemtoSimpleAnalysis::CorrFctn(int n)
 {
   /// return pointer to n-th correlation function
@@ -489,17 +527,15 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
   // Subroutine fills fPicoEvent'a FirstParticleCollection with tracks from
   // hbtEvent which pass fFirstParticleCut. Uses cut's "Type()" to determine
   // which track collection to pull from hbtEvent.
-  FillHbtParticleCollection(fFirstParticleCut,
-                            hbtEvent,
-                            fPicoEvent->FirstParticleCollection(),
-                            fPerformSharedDaughterCut);
+  FillParticleCollection(fFirstParticleCut,
+                         hbtEvent,
+                         fPicoEvent->FirstParticleCollection());
 
   // fill second particle cut if not analyzing identical particles
   if ( !AnalyzeIdenticalParticles() ) {
-      FillHbtParticleCollection(fSecondParticleCut,
-                                hbtEvent,
-                                fPicoEvent->SecondParticleCollection(),
-                                fPerformSharedDaughterCut);
+      FillParticleCollection(fSecondParticleCut,
+                             hbtEvent,
+                             fPicoEvent->SecondParticleCollection());
   }
 
   const UInt_t coll_1_size = collection1->size(),
@@ -598,6 +634,11 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
   // "Seed" this here.
   bool swpart = fNeventsProcessed % 2;
 
+  if (fNThreads > 1 && !enablePairMonitors && PrepareThreadClones()) {
+    MakePairsThreaded(these_are_real_pairs, partCollection1, partCollection2, swpart);
+    return;
+  }
+
   // Setup iterator ranges
   //
   // The outer loop alway starts at beginning of particle collection 1.
@@ -680,6 +721,184 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
   delete tPair;
 }
 //_________________________
+void AliFemtoSimpleAnalysis::MakePairsThreaded(bool realPairs,
+                                               AliFemtoParticleCollection *partCollection1,
+                                               AliFemtoParticleCollection *partCollection2,
+                                               bool swpart)
+{
+/// Same pairs as the loops of MakePairs. The rows of the outer loop are split
+/// in contiguous chunks with about the same number of pairs, and every row
+/// starts with the particle swap flag the sequential loop would have.
+
+  const bool identical = (partCollection2 == nullptr);
+  const std::vector<const AliFemtoParticle*> parts1(partCollection1->begin(), partCollection1->end());
+  const std::vector<const AliFemtoParticle*> parts2 = identical
+                                                    ? std::vector<const AliFemtoParticle*>()
+                                                    : std::vector<const AliFemtoParticle*>(partCollection2->begin(), partCollection2->end());
+  const std::vector<const AliFemtoParticle*> &inner = identical ? parts1 : parts2;
+
+  const size_t nRows = identical ? (parts1.empty() ? 0 : parts1.size() - 1) : parts1.size();
+  std::vector<ULong64_t> pairsBefore(nRows + 1, 0);
+  for (size_t row = 0; row < nRows; ++row) {
+    pairsBefore[row + 1] = pairsBefore[row] + (identical ? inner.size() - row - 1 : inner.size());
+  }
+  const ULong64_t nPairs = pairsBefore[nRows];
+  if (nPairs == 0) {
+    return;
+  }
+
+  const UInt_t nThreads = std::min(static_cast<size_t>(fNThreads), nRows);
+  std::vector<size_t> firstRow(nThreads + 1, nRows);
+  firstRow[0] = 0;
+  for (UInt_t t = 1; t < nThreads; ++t) {
+    firstRow[t] = std::lower_bound(pairsBefore.begin(), pairsBefore.end(), nPairs * t / nThreads)
+                - pairsBefore.begin();
+  }
+
+  auto makePairs = [&](UInt_t t) {
+    AliFemtoPairCut *pairCut = (t == 0) ? fPairCut : fThreadPairCuts[t - 1];
+    AliFemtoCorrFctnCollection *corrFctns = (t == 0) ? fCorrFctnCollection : fThreadCorrFctns[t - 1];
+    AliFemtoPair pair;
+    for (size_t row = firstRow[t]; row < firstRow[t + 1]; ++row) {
+      // the sequential loop flips the flag once per pair
+      bool swap = swpart != (pairsBefore[row] % 2 == 1);
+      if (!identical) {
+        pair.SetTrack1(parts1[row]);
+      }
+      for (size_t col = identical ? row + 1 : 0; col < inner.size(); ++col) {
+        if (!identical) {
+          pair.SetTrack2(inner[col]);
+        } else {
+          pair.SetTrack1(swap ? inner[col] : parts1[row]);
+          pair.SetTrack2(swap ? parts1[row] : inner[col]);
+          swap = !swap;
+        }
+        if (!pairCut->Pass(&pair)) {
+          continue;
+        }
+        for (auto &corrFctn : *corrFctns) {
+          if (realPairs)
+            corrFctn->AddRealPair(&pair);
+          else
+            corrFctn->AddMixedPair(&pair);
+        }
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for (UInt_t t = 1; t < nThreads; ++t) {
+    workers.emplace_back(makePairs, t);
+  }
+  makePairs(0);
+  for (auto &worker : workers) {
+    worker.join();
+  }
+}
+//_________________________
+bool AliFemtoSimpleAnalysis::PrepareThreadClones()
+{
+  /// Clones are made here, in the calling thread, since booking histograms is
+  /// not thread-safe. They start empty and are only merged in Finish().
+
+  if (fThreadPairCuts.size() + 1 == fNThreads) {
+    return true;
+  }
+  DeleteThreadClones();
+
+  bool mergeable = true;
+  for (UInt_t t = 1; t < fNThreads && mergeable; ++t) {
+    AliFemtoPairCut *pairCut = fPairCut->Clone();
+    AliFemtoCorrFctnCollection *corrFctns = new AliFemtoCorrFctnCollection;
+    fThreadPairCuts.push_back(pairCut);
+    fThreadCorrFctns.push_back(corrFctns);
+    if (!pairCut) {
+      mergeable = false;
+      break;
+    }
+    pairCut->SetAnalysis(this);
+
+    for (auto &cf : *fCorrFctnCollection) {
+      AliFemtoCorrFctn *clone = cf->Clone();
+      if (!clone) {
+        mergeable = false;
+        break;
+      }
+      corrFctns->push_back(clone);
+
+      TList *original = cf->GetOutputList(),
+            *cloned = clone->GetOutputList();
+      mergeable = (original->GetEntries() == cloned->GetEntries());
+      TIter next(cloned);
+      while (TObject *obj = next()) {
+        TH1 *hist = dynamic_cast<TH1*>(obj);
+        if (!hist) {
+          mergeable = false;
+          break;
+        }
+        hist->SetDirectory(nullptr);
+        hist->Reset();
+      }
+      delete original;
+      delete cloned;
+      if (!mergeable) {
+        break;
+      }
+    }
+  }
+
+  if (!mergeable) {
+    cerr << " WARNING [AliFemtoSimpleAnalysis::PrepareThreadClones()] correlation functions"
+            " cannot be cloned and merged, making pairs in one thread" << endl;
+    DeleteThreadClones();
+    fNThreads = 1;
+  }
+  return mergeable;
+}
+//_________________________
+void AliFemtoSimpleAnalysis::MergeThreadClones()
+{
+  /// Add the histograms of the worker threads to the correlation functions,
+  /// in thread order, and reset them
+
+  for (auto &corrFctns : fThreadCorrFctns) {
+    auto original = fCorrFctnCollection->begin();
+    for (auto &clone : *corrFctns) {
+      TList *originalList = (*original)->GetOutputList(),
+            *clonedList = clone->GetOutputList();
+      TIter nextOriginal(originalList),
+            nextCloned(clonedList);
+      while (TObject *obj = nextOriginal()) {
+        TH1 *hist = dynamic_cast<TH1*>(obj),
+            *histClone = static_cast<TH1*>(nextCloned());
+        if (hist && histClone && histClone->GetEntries() > 0) {
+          hist->Add(histClone);
+          histClone->Reset();
+        }
+      }
+      delete originalList;
+      delete clonedList;
+      ++original;
+    }
+  }
+}
+//_________________________
+void AliFemtoSimpleAnalysis::DeleteThreadClones()
+{
+  for (auto &pairCut : fThreadPairCuts) {
+    delete pairCut;
+  }
+  fThreadPairCuts.clear();
+
+  for (auto &corrFctns : fThreadCorrFctns) {
+    for (auto &cf : *corrFctns) {
+      delete cf;
+    }
+    delete corrFctns;
+  }
+  fThreadCorrFctns.clear();
+}
+//_________________________
 void AliFemtoSimpleAnalysis::EventBegin(const AliFemtoEvent* ev)
 {
   /// Perform initialization operations at the beginning of the event processing
@@ -692,6 +911,19 @@ void AliFemtoSimpleAnalysis::EventBegin(const AliFemtoEvent* ev)
   for (auto &cf : *fCorrFctnCollection) {
     cf->EventBegin(ev);
   }
+
+  // the clones of the worker threads need the EventBegin of this event too
+  if (fNThreads > 1 && !fEnablePairMonitors) {
+    PrepareThreadClones();
+  }
+  for (auto &pairCut : fThreadPairCuts) {
+    pairCut->EventBegin(ev);
+  }
+  for (auto &corrFctns : fThreadCorrFctns) {
+    for (auto &cf : *corrFctns) {
+      cf->EventBegin(ev);
+    }
+  }
 }
 //_________________________
 void AliFemtoSimpleAnalysis::EventEnd(const AliFemtoEvent* ev)
@@ -705,12 +937,23 @@ void AliFemtoSimpleAnalysis::EventEnd(const AliFemtoEvent* ev)
   for (auto &cf : *fCorrFctnCollection) {
     cf->EventEnd(ev);
   }
+
+  for (auto &pairCut : fThreadPairCuts) {
+    pairCut->EventEnd(ev);
+  }
+  for (auto &corrFctns : fThreadCorrFctns) {
+    for (auto &cf : *corrFctns) {
+      cf->EventEnd(ev);
+    }
+  }
 }
 //_________________________
 void AliFemtoSimpleAnalysis::Finish()
 {
   // Perform finishing operations after all events are processed
 
+  MergeThreadClones();
+
   for (auto &cf : *fCorrFctnCollection) {
     cf->Finish();
   }
@@ -16,7 +16,10 @@
 #include "AliFemtoV0SharedDaughterCut.h"
 #include "AliFemtoXiSharedDaughterCut.h"
 
+#include <vector>
+
 class AliFemtoPicoEventCollectionVectorHideAway;
+class AliFemtoSharedCutCache;
 class AliFemtoPicoEvent;
 
 ///
@@ -48,6 +51,13 @@ class AliFemtoPicoEvent;
 /// analysis finishes (there is no more events to process) Finish() is
 /// called.
 ///
+/// With SetNumberOfThreads(n > 1) the pairs of each MakePairs call are split
+/// over n threads. Each extra thread fills its own clones of the pair cut and
+/// of the correlation functions, which are added to the originals in Finish().
+/// This requires that all correlation function outputs are histograms and is
+/// not used when the pair monitors are enabled. The pass/fail statistics of
+/// the pair cut only count the pairs of the first thread.
+///
 class AliFemtoSimpleAnalysis : public AliFemtoAnalysis {
 
 // friend class AliFemtoLikeSignAnalysis;
@@ -99,6 +109,13 @@ public:
   void SetEnablePairMonitors(Bool_t aEnable);
   Bool_t EnablePairMonitors();
 
+  void SetNumberOfThreads(UInt_t nThreads);
+  UInt_t GetNumberOfThreads() const;
+
+  /// Particle selections shared with other analyses, owned by the manager
+  /// (see AliFemtoManager::SetShareIdenticalCuts)
+  void SetSharedCutCache(AliFemtoSharedCutCache *cache);
+
   unsigned int NumEventsToMix() const;
   void SetNumEventsToMix(const unsigned int& NumberOfEventsToMix);
   AliFemtoPicoEvent* CurrentPicoEvent();
@@ -140,7 +157,8 @@ public:
   /// Returns number of events which have been passed to ProcessEvent.
   int GetNeventsProcessed() const;
 
-  /// Calls Finish method on all correlation functions
+  /// Merges the correlation functions filled by the worker threads and calls
+  /// Finish method on all correlation functions
   virtual void Finish();
 
 protected:
@@ -148,6 +166,12 @@ protected:
   /// Increment fNeventsProcessed - is this method neccessary?
   void AddEventProcessed();
 
+  /// Fill the collection with the particles of the event passing the cut,
+  /// through fSharedCutCache if the cut is shared
+  void FillParticleCollection(AliFemtoParticleCut *cut,
+                              const AliFemtoEvent *hbtEvent,
+                              AliFemtoParticleCollection *collection);
+
   /// Build pairs, check pair cuts, and call CFs' AddRealPair() or
   /// AddMixedPair() methods. If no second particle collection is
   /// specfied, make pairs within first particle collection.
@@ -159,6 +183,18 @@ protected:
                  AliFemtoParticleCollection* ParticlesPssingCut2=NULL,
                  Bool_t enablePairMonitors=kFALSE);
 
+  /// Pairs of MakePairs split over fNThreads threads, see SetNumberOfThreads
+  void MakePairsThreaded(bool realPairs,
+                         AliFemtoParticleCollection* ParticlesPassingCut1,
+                         AliFemtoParticleCollection* ParticlesPassingCut2,
+                         bool swpart);
+
+  /// Clones of the pair cut and the correlation functions for the worker
+  /// threads. Returns false (and falls back to one thread) if they cannot be merged.
+  bool PrepareThreadClones();
+  void MergeThreadClones();
+  void DeleteThreadClones();
+
   AliFemtoPicoEventCollectionVectorHideAway* fPicoEventCollectionVectorHideAway; //!<! Mixing Buffer used for Analyses which wrap this one
 
   AliFemtoPairCut*             fPairCut;             ///< cut applied to pairs
@@ -177,6 +213,12 @@ protected:
   Bool_t fVerbose;
   Bool_t fPerformSharedDaughterCut;
   Bool_t fEnablePairMonitors;
+  UInt_t fNThreads;                                             ///< number of threads making the pairs
+
+  std::vector<AliFemtoPairCut*> fThreadPairCuts;                //!<! pair cut of each worker thread
+  std::vector<AliFemtoCorrFctnCollection*> fThreadCorrFctns;    //!<! correlation functions of each worker thread
+
+  AliFemtoSharedCutCache *fSharedCutCache;                      //!<! selections shared between analyses, not owned
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
@@ -305,4 +347,19 @@ inline void AliFemtoSimpleAnalysis::SetEnablePairMonitors(Bool_t aEnable)
   fEnablePairMonitors = aEnable;
 }
 
+inline void AliFemtoSimpleAnalysis::SetNumberOfThreads(UInt_t nThreads)
+{
+  fNThreads = nThreads > 0 ? nThreads : 1;
+}
+
+inline UInt_t AliFemtoSimpleAnalysis::GetNumberOfThreads() const
+{
+  return fNThreads;
+}
+
+inline void AliFemtoSimpleAnalysis::SetSharedCutCache(AliFemtoSharedCutCache *cache)
+{
+  fSharedCutCache = cache;
+}
+
 #endif
@@ -33,7 +33,8 @@ AliFemtoVertexMultAnalysis::AliFemtoVertexMultAnalysis(UInt_t binsVertex,
   fUnderFlowVertexZ(0),
   fMultBins(binsMult),
   fOverFlowMult(0),
-  fUnderFlowMult(0)
+  fUnderFlowMult(0),
+  fMixingMemoryBudget(0)
 {
   fVertexZ[0] = minVertex;
   fVertexZ[1] = maxVertex;
@@ -91,7 +92,8 @@ AliFemtoVertexMultAnalysis::AliFemtoVertexMultAnalysis(const AliFemtoVertexMultA
   fUnderFlowVertexZ(0),
   fMultBins(orig.fMultBins),
   fOverFlowMult(0),
-  fUnderFlowMult(0)
+  fUnderFlowMult(0),
+  fMixingMemoryBudget(orig.fMixingMemoryBudget)
 {
   fVertexZ[0] = orig.fVertexZ[0];
   fVertexZ[1] = orig.fVertexZ[1];
@@ -114,6 +116,7 @@ AliFemtoVertexMultAnalysis::AliFemtoVertexMultAnalysis(const AliFemtoVertexMultA
     fMult[0],
     fMult[1]
   );
+  fPicoEventCollectionVectorHideAway->SetMemoryBudget(fMixingMemoryBudget);
 
   if (fVerbose) {
     cout << " AliFemtoVertexMultAnalysis::AliFemtoVertexMultAnalysis(const AliFemtoVertexMultAnalysis&) - analysis copied " << endl;
@@ -156,6 +159,8 @@ AliFemtoVertexMultAnalysis& AliFemtoVertexMultAnalysis::operator=(const AliFemto
     fMult[0],
     fMult[1]
   );
+  fMixingMemoryBudget = rhs.fMixingMemoryBudget;
+  fPicoEventCollectionVectorHideAway->SetMemoryBudget(fMixingMemoryBudget);
 
   return *this;
 }
@@ -166,6 +171,18 @@ AliFemtoVertexMultAnalysis::~AliFemtoVertexMultAnalysis()
   delete fPicoEventCollectionVectorHideAway;
 }
 
+//____________________________
+void AliFemtoVertexMultAnalysis::SetMixingMemoryBudget(ULong64_t bytes)
+{
+  fMixingMemoryBudget = bytes;
+  fPicoEventCollectionVectorHideAway->SetMemoryBudget(bytes);
+}
+
+void AliFemtoVertexMultAnalysis::PrintMixingOccupancy() const
+{
+  fPicoEventCollectionVectorHideAway->PrintOccupancy();
+}
+
 //____________________________
 AliFemtoString AliFemtoVertexMultAnalysis::Report()
 {
@@ -182,6 +199,12 @@ AliFemtoString AliFemtoVertexMultAnalysis::Report()
           + TString::Format("Events are mixed in %d Mult bins in the range %E cm to %E cm.\n", fMultBins, fMult[0], fMult[1])
           + TString::Format("Events underflowing: %d\n", fUnderFlowMult)
           + TString::Format("Events overflowing: %d\n", fOverFlowMult)
+          + (fMixingMemoryBudget
+             ? TString::Format("Mixing buffers: %.1f MB of %.1f MB budget, %u events dropped\n",
+                               fPicoEventCollectionVectorHideAway->GetMemory() / 1048576.,
+                               fMixingMemoryBudget / 1048576.,
+                               fPicoEventCollectionVectorHideAway->GetNEvictedEvents())
+             : TString())
           + TString::Format("Now adding AliFemtoSimpleAnalysis(base) Report\n")
           + AliFemtoSimpleAnalysis::Report();
 
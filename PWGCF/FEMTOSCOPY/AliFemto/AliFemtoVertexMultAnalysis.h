@@ -61,6 +61,14 @@ public:
   virtual UInt_t OverflowMult() const;      ///< Number of events above multiplicity range
   virtual UInt_t UnderflowMult() const;     ///< Number of events below multiplicity range
 
+  /// Limit the estimated memory of all mixing buffers (0 means no limit).
+  /// Above it the oldest events of the least recently used bins are dropped.
+  void SetMixingMemoryBudget(ULong64_t bytes);
+  ULong64_t GetMixingMemoryBudget() const { return fMixingMemoryBudget; }
+
+  /// Print the number of events and estimated memory of each mixing bin
+  void PrintMixingOccupancy() const;
+
 protected:
 
   Double_t fVertexZ[2];     ///< min/max z-vertex position allowed to be processed
@@ -73,9 +81,11 @@ protected:
   UInt_t fOverFlowMult;     ///< number of events encountered which had too large multiplicity
   UInt_t fUnderFlowMult;    ///< number of events encountered which had too small multiplicity
 
+  ULong64_t fMixingMemoryBudget; ///< memory budget of the mixing buffers in bytes, 0: no limit
+
 #ifdef __ROOT__
   /// \cond CLASSIMP
-  ClassDef(AliFemtoVertexMultAnalysis, 1);
+  ClassDef(AliFemtoVertexMultAnalysis, 2);
   /// \endcond
 #endif
 
@@ -45,7 +45,9 @@
 **************************************************************************/
 
 #include "AliFemtoESDTrackCut.h"
+#include "AliFemtoConfigObject.h"
 #include <cstdio>
+#include <typeinfo>
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
@@ -614,6 +616,57 @@ TList *AliFemtoESDTrackCut::ListSettings()
   return tListSetttings;
 }
 
+bool AliFemtoESDTrackCut::FillConfiguration(AliFemtoConfigObject &cfg) const
+{
+  // a derived class may cut on more than these settings
+  if (typeid(*this) != typeid(AliFemtoESDTrackCut)) {
+    return false;
+  }
+
+  typedef AliFemtoConfigObject::RangeValue_t Range_t;
+  cfg.insert("class", TString("AliFemtoESDTrackCut"));
+  cfg.insert("mass", Mass());
+  cfg.insert("charge", fCharge);
+  cfg.insert("pt", Range_t(fPt[0], fPt[1]));
+  cfg.insert("rapidity", Range_t(fRapidity[0], fRapidity[1]));
+  cfg.insert("eta", Range_t(fEta[0], fEta[1]));
+  cfg.insert("pidprobelectron", Range_t(fPidProbElectron[0], fPidProbElectron[1]));
+  cfg.insert("pidprobpion", Range_t(fPidProbPion[0], fPidProbPion[1]));
+  cfg.insert("pidprobkaon", Range_t(fPidProbKaon[0], fPidProbKaon[1]));
+  cfg.insert("pidprobproton", Range_t(fPidProbProton[0], fPidProbProton[1]));
+  cfg.insert("pidprobmuon", Range_t(fPidProbMuon[0], fPidProbMuon[1]));
+  cfg.insert("clusterrequirementspd", static_cast<int>(fCutClusterRequirementITS[0]));
+  cfg.insert("clusterrequirementsdd", static_cast<int>(fCutClusterRequirementITS[1]));
+  cfg.insert("clusterrequirementssd", static_cast<int>(fCutClusterRequirementITS[2]));
+  cfg.insert("label", fLabel);
+  cfg.insert("status", fStatus);
+  cfg.insert("pidmethod", static_cast<int>(fPIDMethod));
+  cfg.insert("nsigmatpctof", fNsigmaTPCTOF);
+  cfg.insert("nsigmatpconly", fNsigmaTPConly);
+  cfg.insert("nsigma", fNsigma);
+  cfg.insert("nsigmamass", fNsigmaMass);
+  cfg.insert("mintpcclsf", static_cast<int>(fminTPCclsF));
+  cfg.insert("mintpcncls", static_cast<int>(fminTPCncls));
+  cfg.insert("minitscls", fminITScls);
+  cfg.insert("maxitschindof", fMaxITSchiNdof);
+  cfg.insert("maxtpcchindof", fMaxTPCchiNdof);
+  cfg.insert("maxsigmatovertex", fMaxSigmaToVertex);
+  cfg.insert("removekinks", fRemoveKinks);
+  cfg.insert("removeitsfake", fRemoveITSFake);
+  cfg.insert("mostprobable", fMostProbable);
+  cfg.insert("impactxy", Range_t(fMinImpactXY, fMaxImpactXY));
+  cfg.insert("maximpactz", fMaxImpactZ);
+  cfg.insert("maximpactxyptoff", fMaxImpactXYPtOff);
+  cfg.insert("maximpactxyptnrm", fMaxImpactXYPtNrm);
+  cfg.insert("maximpactxyptpow", fMaxImpactXYPtPow);
+  cfg.insert("pfortofpid", Range_t(fMinPforTOFpid, fMaxPforTOFpid));
+  cfg.insert("pfortpcpid", Range_t(fMinPforTPCpid, fMaxPforTPCpid));
+  cfg.insert("pforitspid", Range_t(fMinPforITSpid, fMaxPforITSpid));
+  cfg.insert("electronrejection", fElectronRejection);
+
+  return true;
+}
+
 void AliFemtoESDTrackCut::SetRemoveKinks(const bool& flag)
 {
   fRemoveKinks = flag;
@@ -27,6 +27,7 @@ public:
 
   virtual AliFemtoString Report();
   virtual TList *ListSettings();
+  virtual bool FillConfiguration(AliFemtoConfigObject &cfg) const;
   virtual AliFemtoParticleType Type(){return hbtTrack;}
 
   void SetPt(const float& lo, const float& hi);
@@ -83,6 +83,57 @@ bool AliFemtoDreamHigherPairMath::PassesPairSelection(
   return pass;
 }
 
+bool AliFemtoDreamHigherPairMath::PassesPairSelection(
+    int iHC, const AliFemtoDreamParticleSoA& soa1, size_t iPart1,
+    const AliFemtoDreamParticleSoA& soa2, size_t iPart2,
+    AliFemtoDreamBasePart& part1, AliFemtoDreamBasePart& part2,
+    float RelativeK, bool SEorME) {
+  //The plots need the full DeltaEtaDeltaPhi
+  if (fHists->GetEtaPhiPlots()) {
+    return PassesPairSelection(iHC, part1, part2, RelativeK, SEorME, false);
+  }
+  if (!(fRejPairs.at(iHC) && fDoDeltaEtaDeltaPhiCut)) {
+    return true;
+  }
+  unsigned int DoThisPair = fWhichPairs.at(iHC);
+  unsigned int nDaug1 = (unsigned int) DoThisPair / 10;
+  unsigned int nDaug2 = (unsigned int) DoThisPair % 10;
+  //inconsistent configurations are reported by DeltaEtaDeltaPhi
+  if (nDaug1 > 9 || nDaug1 > soa1.GetNPhiAtRadii(iPart1)
+      || nDaug2 > soa2.GetNPhiAtRadii(iPart2)
+      || (nDaug1 == 1 ? 1 : nDaug1 + 1) > soa1.GetNEta(iPart1)
+      || (nDaug2 == 1 ? 1 : nDaug2 + 1) > soa2.GetNEta(iPart2)) {
+    return DeltaEtaDeltaPhi(iHC, part1, part2, SEorME, RelativeK);
+  }
+  for (unsigned int iDaug1 = 0; iDaug1 < nDaug1; ++iDaug1) {
+    const float *phiAtRad1 = soa1.GetPhiAtRadii(iPart1, iDaug1);
+    const unsigned int nRad1 = soa1.GetNRadii(iPart1, iDaug1);
+    const float etaPar1 = soa1.GetEta(iPart1, (nDaug1 == 1) ? 0 : iDaug1 + 1);
+    for (unsigned int iDaug2 = 0; iDaug2 < nDaug2; ++iDaug2) {
+      const float *phiAtRad2 = soa2.GetPhiAtRadii(iPart2, iDaug2);
+      const unsigned int nRad2 = soa2.GetNRadii(iPart2, iDaug2);
+      const float etaPar2 = soa2.GetEta(iPart2, (nDaug2 == 1) ? 0 : iDaug2 + 1);
+      const float deta = etaPar1 - etaPar2;
+      const int size = (nRad1 > nRad2) ? nRad2 : nRad1;
+      float dphiAvg = 0;
+      for (int iRad = 0; iRad < size; ++iRad) {
+        float dphi = phiAtRad1[iRad] - phiAtRad2[iRad];
+        if (dphi > piHi) {
+          dphi += -piHi * 2;
+        } else if (dphi < -piHi) {
+          dphi += piHi * 2;
+        }
+        dphiAvg += TVector2::Phi_mpi_pi(dphi);
+      }
+      if ((dphiAvg / (float) size) * (dphiAvg / (float) size) / fDeltaPhiSqMax
+          + deta * deta / fDeltaEtaSqMax < 1.) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 bool AliFemtoDreamHigherPairMath::CommonAncestors(AliFemtoDreamBasePart& part1, AliFemtoDreamBasePart& part2) {
     bool IsCommon = false;
     if(part1.GetMotherID() == part2.GetMotherID()){
@@ -108,7 +159,7 @@ void AliFemtoDreamHigherPairMath::RecalculatePhiStar(
     AliWarning(
         "BField was most probably not set! PhiStar Calculation meaningless. \n");
   }
-  std::vector<TVector3> momenta = part.GetMomenta();
+  const std::vector<TVector3> &momenta = part.GetMomenta();
   unsigned int nPart = momenta.size();
   unsigned int counter = 0;
   part.ResizePhiAtRadii(0);
@@ -549,11 +600,11 @@ bool AliFemtoDreamHigherPairMath::DeltaEtaDeltaPhi(int Hist,
             Hist, nDaug2, (unsigned int)part2.GetPhiAtRaidius().size());
     AliWarning(outMessage.Data());
   }
-  std::vector<float> eta1 = part1.GetEta();
-  std::vector<float> eta2 = part2.GetEta();
+  const std::vector<float> &eta1 = part1.GetEta();
+  const std::vector<float> &eta2 = part2.GetEta();
 
   for (unsigned int iDaug1 = 0; iDaug1 < nDaug1; ++iDaug1) {
-    std::vector<float> PhiAtRad1 = part1.GetPhiAtRaidius().at(iDaug1);
+    const std::vector<float> &PhiAtRad1 = part1.GetPhiAtRaidius().at(iDaug1);
     float etaPar1;
     if (nDaug1 == 1) {
       etaPar1 = eta1.at(0);
@@ -561,7 +612,7 @@ bool AliFemtoDreamHigherPairMath::DeltaEtaDeltaPhi(int Hist,
       etaPar1 = eta1.at(iDaug1 + 1);
     }
     for (unsigned int iDaug2 = 0; iDaug2 < nDaug2; ++iDaug2) {
-      std::vector<float> phiAtRad2 = part2.GetPhiAtRaidius().at(iDaug2);
+      const std::vector<float> &phiAtRad2 = part2.GetPhiAtRaidius().at(iDaug2);
       float etaPar2;
       if (nDaug2 == 1) {
         etaPar2 = eta2.at(0);
@@ -13,6 +13,7 @@
 #include "AliFemtoDreamBasePart.h"
 #include "AliFemtoDreamCollConfig.h"
 #include "AliFemtoDreamCorrHists.h"
+#include "AliFemtoDreamParticleSoA.h"
 #include <vector>
 class AliFemtoDreamHigherPairMath {
  public:
@@ -34,6 +35,13 @@ class AliFemtoDreamHigherPairMath {
   bool PassesPairSelection(int iHC, AliFemtoDreamBasePart& part1,
                            AliFemtoDreamBasePart& part2, float RelativeK,
                            bool SEorME, bool Recalculate);
+  //same as above, the close pair rejection is evaluated on the flat daughter
+  //arrays of the SoA snapshots unless the eta/phi plots are filled
+  bool PassesPairSelection(int iHC, const AliFemtoDreamParticleSoA& soa1,
+                           size_t iPart1, const AliFemtoDreamParticleSoA& soa2,
+                           size_t iPart2, AliFemtoDreamBasePart& part1,
+                           AliFemtoDreamBasePart& part2, float RelativeK,
+                           bool SEorME);
   bool CommonAncestors(AliFemtoDreamBasePart& part1, AliFemtoDreamBasePart& part2);
   void RecalculatePhiStar(AliFemtoDreamBasePart &part);
   float FillSameEvent(int iHC, int Mult, float cent, AliFemtoDreamBasePart& part1,
@@ -5,7 +5,9 @@
  *      Author: bernhardhohlweger
  */
 
+#include <algorithm>
 #include <iostream>
+#include <unordered_map>
 #include "AliFemtoDreamPairCleaner.h"
 ClassImp(AliFemtoDreamPairCleaner)
 AliFemtoDreamPairCleaner::AliFemtoDreamPairCleaner()
@@ -57,184 +59,148 @@ AliFemtoDreamPairCleaner& AliFemtoDreamPairCleaner::operator=(
 void AliFemtoDreamPairCleaner::CleanTrackAndDecay(
     std::vector<AliFemtoDreamBasePart> *Tracks,
     std::vector<AliFemtoDreamBasePart> *Decay, int histnumber) {
+  //Daughter ID -> decays having it, a decay appears once per matching daughter
   int counter = 0;
+  std::unordered_map<int, std::vector<int>> daughterIndex;
+  daughterIndex.reserve(3 * Decay->size());
+  for (int iDecay = 0; iDecay < (int) Decay->size(); ++iDecay) {
+    for (auto itID : Decay->at(iDecay).GetIDTracks()) {
+      daughterIndex[itID].push_back(iDecay);
+    }
+  }
   for (auto itTrack = Tracks->begin(); itTrack != Tracks->end(); ++itTrack) {
-    //std::cout  << "New Track" << std::endl;
-    for (auto itDecay = Decay->begin(); itDecay != Decay->end(); ++itDecay) {
-      if (itDecay->UseParticle()) {
-        //std::cout  << "New v0" << std::endl;
-        std::vector<int> IDTrack = itTrack->GetIDTracks();
-        std::vector<int> IDDaug = itDecay->GetIDTracks();
-        for (auto itIDs = IDDaug.begin(); itIDs != IDDaug.end(); ++itIDs) {
-          //std::cout <<"ID of Track: "<<IDTrack.at(0)<<" IDs of Daughter: "
-          //              <<*itIDs<<'\n';
-          if (*itIDs == IDTrack.at(0)) {
-            itDecay->SetUse(false);
-            counter++;
-          }
-        }
-      } else {
-        continue;
+    if (daughterIndex.empty()) {
+      break;
+    }
+    auto itMatch = daughterIndex.find(itTrack->GetIDTracks().at(0));
+    if (itMatch == daughterIndex.end()) {
+      continue;
+    }
+    const std::vector<int> &decays = itMatch->second;
+    for (unsigned int iMatch = 0; iMatch < decays.size(); ++iMatch) {
+      AliFemtoDreamBasePart &decay = Decay->at(decays[iMatch]);
+      //all the shared daughters of the decay are counted at once
+      int nShared = 1;
+      while (iMatch + 1 < decays.size()
+          && decays[iMatch + 1] == decays[iMatch]) {
+        ++nShared;
+        ++iMatch;
+      }
+      if (decay.UseParticle()) {
+        decay.SetUse(false);
+        counter += nShared;
       }
     }
   }
   if (!fMinimalBooking)
     fHists->FillDaughtersSharedTrack(histnumber, counter);
 }
-void AliFemtoDreamPairCleaner::CleanDecayAndDecay(
+
+int AliFemtoDreamPairCleaner::CleanSharedDaughters(
     std::vector<AliFemtoDreamBasePart> *Decay1,
-    std::vector<AliFemtoDreamBasePart> *Decay2, int histnumber) {
+    std::vector<AliFemtoDreamBasePart> *Decay2, bool sameArray, CleanMode mode,
+    double mass) {
+  //Resolves the decays sharing a daughter with a hash map of the daughter IDs
+  //of Decay2. The pairs are visited in the same order as the nested loops over
+  //Decay1 and Decay2 (only the later ones of the same array if sameArray), so
+  //that the outcome of the sequential removal does not change.
   int counter = 0;
-  for (auto itDecay1 = Decay1->begin(); itDecay1 != Decay1->end(); ++itDecay1) {
-    for (auto itDecay2 = Decay2->begin(); itDecay2 != Decay2->end();
-          ++itDecay2) {
-      if (itDecay1->UseParticle()) {
-        if (itDecay2->UseParticle()) {
-          std::vector<int> IDDaug1 = itDecay1->GetIDTracks();
-          std::vector<int> IDDaug2 = itDecay2->GetIDTracks();
-          for (auto itID1s = IDDaug1.begin(); itID1s != IDDaug1.end();
-              ++itID1s) {
-            for (auto itID2s = IDDaug2.begin(); itID2s != IDDaug2.end();
-                ++itID2s) {
-              if (*itID1s == *itID2s) {
-                if (itDecay1->GetCPA() < itDecay2->GetCPA()) {
-                  itDecay1->SetUse(false);
-                  counter++;
-                } else {
-                  itDecay2->SetUse(false);
-                  counter++;
-                }
-              }
-            }
+  std::unordered_map<int, std::vector<int>> daughterIndex;
+  daughterIndex.reserve(3 * Decay2->size());
+  for (int iDecay = 0; iDecay < (int) Decay2->size(); ++iDecay) {
+    for (auto itID : Decay2->at(iDecay).GetIDTracks()) {
+      std::vector<int> &decays = daughterIndex[itID];
+      if (decays.empty() || decays.back() != iDecay) {
+        decays.push_back(iDecay);
+      }
+    }
+  }
+  std::vector<int> partners;
+  for (int iDecay1 = 0; iDecay1 < (int) Decay1->size(); ++iDecay1) {
+    AliFemtoDreamBasePart &decay1 = Decay1->at(iDecay1);
+    if (!decay1.UseParticle()) {
+      continue;
+    }
+    const std::vector<int> &IDDaug1 = decay1.GetIDTracks();
+    partners.clear();
+    for (auto itID1 : IDDaug1) {
+      auto itMatch = daughterIndex.find(itID1);
+      if (itMatch == daughterIndex.end()) {
+        continue;
+      }
+      for (auto iDecay2 : itMatch->second) {
+        if (!sameArray || iDecay2 > iDecay1) {
+          partners.push_back(iDecay2);
+        }
+      }
+    }
+    std::sort(partners.begin(), partners.end());
+    partners.erase(std::unique(partners.begin(), partners.end()),
+                   partners.end());
+    for (auto iDecay2 : partners) {
+      AliFemtoDreamBasePart &decay2 = Decay2->at(iDecay2);
+      if (!decay2.UseParticle()) {
+        continue;
+      }
+      int nShared = 0;
+      for (auto itID1 : IDDaug1) {
+        for (auto itID2 : decay2.GetIDTracks()) {
+          if (itID1 == itID2) {
+            ++nShared;
           }
-        } else {
-          continue;
         }
+      }
+      bool removeFirst = false;
+      if (mode == kHigherCPA) {
+        removeFirst = decay1.GetCPA() < decay2.GetCPA();
+      } else if (mode == kCloserInvMass) {
+        float massDiff1 = TMath::Abs(decay1.GetInvMass() - mass);
+        float massDiff2 = TMath::Abs(decay2.GetInvMass() - mass);
+        removeFirst = massDiff2 < massDiff1;
       } else {
+        //only the first shared daughter is resolved, then one of them is gone
+        removeFirst = gRandom->Uniform(0., 1.) > 0.5;
+        nShared = 1;
+      }
+      if (removeFirst) {
+        decay1.SetUse(false);
+      } else {
+        decay2.SetUse(false);
+      }
+      //every shared daughter was counted by the nested loops
+      counter += nShared;
+      if (removeFirst) {
         break;
       }
-    } 
+    }
   }
+  return counter;
+}
+
+void AliFemtoDreamPairCleaner::CleanDecayAndDecay(
+    std::vector<AliFemtoDreamBasePart> *Decay1,
+    std::vector<AliFemtoDreamBasePart> *Decay2, int histnumber) {
+  int counter = CleanSharedDaughters(Decay1, Decay2, false, kHigherCPA);
   if (!fMinimalBooking)
     fHists->FillDaughtersSharedDaughter(histnumber, counter);
 }
 
 void AliFemtoDreamPairCleaner::CleanDecay(
     std::vector<AliFemtoDreamBasePart> *Decay, int histnumber) {
-  int counter = 0;
-  for (std::vector<AliFemtoDreamBasePart>::iterator itDecay1 = Decay->begin();
-      itDecay1 != Decay->end(); ++itDecay1) {
-      //std::cout  << "New Particle 1" << std::endl;
-    for (auto itDecay2 = itDecay1 + 1; itDecay2 != Decay->end(); ++itDecay2) {
-      if (itDecay1->UseParticle()) {
-        if (itDecay2->UseParticle()) {
-          //std::cout  << "New Particle 2" << std::endl;
-          std::vector<int> IDDaug1 = itDecay1->GetIDTracks();
-          std::vector<int> IDDaug2 = itDecay2->GetIDTracks();
-          for (auto itID1s = IDDaug1.begin(); itID1s != IDDaug1.end();
-              ++itID1s) {
-            for (auto itID2s = IDDaug2.begin(); itID2s != IDDaug2.end();
-                ++itID2s) {
-              //std::cout <<"ID of Daug v01: "<<*itID1s<<" ID of Daug v02: "
-              //                  <<*itID2s<<'\n';
-              if (*itID1s == *itID2s) {
-                if (itDecay1->GetCPA() < itDecay2->GetCPA()) {
-                  itDecay1->SetUse(false);
-                  counter++;
-                } else {
-                  itDecay2->SetUse(false);
-                  counter++;
-                }
-              }
-            }
-          }
-        } else {
-          continue;
-        }
-      } else {
-        break;
-      }
-    } 
-  }
+  int counter = CleanSharedDaughters(Decay, Decay, true, kHigherCPA);
   if (!fMinimalBooking)
     fHists->FillDaughtersSharedDaughter(histnumber, counter);
 }
 
 void AliFemtoDreamPairCleaner::CleanDecayInvMass(std::vector<AliFemtoDreamBasePart> *Decay, int PDGCode, int histnumber) {
-  int counter = 0;
   double mass = TDatabasePDG::Instance()->GetParticle(PDGCode)->Mass();
-  for (std::vector<AliFemtoDreamBasePart>::iterator itDecay1 = Decay->begin();
-      itDecay1 != Decay->end(); ++itDecay1) {
-    //std::cout  << "New Particle 1" << std::endl;
-    for (auto itDecay2 = itDecay1 + 1; itDecay2 != Decay->end(); ++itDecay2) {
-      if (itDecay1->UseParticle()) {
-        if (itDecay2->UseParticle()) {
-          //std::cout  << "New Particle 2" << std::endl;
-          std::vector<int> IDDaug1 = itDecay1->GetIDTracks();
-          std::vector<int> IDDaug2 = itDecay2->GetIDTracks();
-          for (auto itID1s = IDDaug1.begin(); itID1s != IDDaug1.end();
-               ++itID1s) {
-            for (auto itID2s = IDDaug2.begin(); itID2s != IDDaug2.end();
-                 ++itID2s) {
-              //std::cout <<"ID of Daug v01: "<<*itID1s<<" ID of Daug v02: "
-              //                  <<*itID2s<<'\n';
-              if (*itID1s == *itID2s) {
-                float massDiff1 = TMath::Abs(itDecay1->GetInvMass() - mass);
-                float massDiff2 = TMath::Abs(itDecay2->GetInvMass() - mass);
-                if (massDiff2 < massDiff1) {
-                  itDecay1->SetUse(false);
-                  counter++;
-                } else {
-                  itDecay2->SetUse(false);
-                  counter++;
-                }
-              }
-            }
-          }
-        } else {
-          continue;
-        }
-      } else {
-        break;
-      }
-    }
-  }
+  int counter = CleanSharedDaughters(Decay, Decay, true, kCloserInvMass, mass);
   if (!fMinimalBooking)
     fHists->FillDaughtersSharedDaughter(histnumber, counter);
 }
 void AliFemtoDreamPairCleaner::CleanDecayAtRandom(std::vector<AliFemtoDreamBasePart> *Decay, int histnumber)
 {
-  int counter = 0;
-  for (std::vector<AliFemtoDreamBasePart>::iterator itDecay1 = Decay->begin();
-       itDecay1 != Decay->end(); ++itDecay1) {
-    for (auto itDecay2 = itDecay1 + 1; itDecay2 != Decay->end(); ++itDecay2) {
-      if (itDecay1->UseParticle()) {
-        if (itDecay2->UseParticle()) {
-          std::vector<int> IDDaug1 = itDecay1->GetIDTracks();
-          std::vector<int> IDDaug2 = itDecay2->GetIDTracks();
-          for (auto itID1s = IDDaug1.begin(); itID1s != IDDaug1.end(); ++itID1s) {
-            for (auto itID2s = IDDaug2.begin(); itID2s != IDDaug2.end(); ++itID2s) {
-              if(*itID1s == *itID2s){
-                if (itDecay1->UseParticle() && itDecay2->UseParticle()){
-                  if (gRandom->Uniform(0., 1.) > 0.5){
-                    itDecay1->SetUse(false);
-                    counter++;
-                  } else {
-                    itDecay2->SetUse(false);
-                    counter++;
-                  }
-                }
-              }
-            }
-          }
-        } else {
-          continue;
-        }
-      } else {
-        break;
-      }
-    } 
-  }
+  int counter = CleanSharedDaughters(Decay, Decay, true, kAtRandom);
   if (!fMinimalBooking)
     fHists->FillDaughtersSharedDaughter(histnumber, counter);
 }
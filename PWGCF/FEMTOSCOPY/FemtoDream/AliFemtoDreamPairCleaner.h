@@ -50,6 +50,10 @@ class AliFemtoDreamPairCleaner {
  private:
   double InvMassPair(TVector3 Part1, int PDG1, TVector3 Part2, int PDG2);
   double E2(int pdgCode, double Ptot2);
+  enum CleanMode {kHigherCPA, kCloserInvMass, kAtRandom};
+  int CleanSharedDaughters(std::vector<AliFemtoDreamBasePart> *Decay1,
+                           std::vector<AliFemtoDreamBasePart> *Decay2,
+                           bool sameArray, CleanMode mode, double mass = 0.);
   bool fMinimalBooking;
   int fCounter;
   std::vector<std::vector<AliFemtoDreamBasePart>> fParticles;
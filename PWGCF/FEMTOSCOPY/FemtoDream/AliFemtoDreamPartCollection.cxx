@@ -111,6 +111,33 @@ void AliFemtoDreamPartCollection::PrintEvent(int ZVtx, int Mult) {
   return;
 }
 
+size_t AliFemtoDreamPartCollection::GetBufferMemory(int ZVtx, int Mult) const {
+  return fZVtxMultBuffer.at(ZVtx).at(Mult).GetBufferMemory();
+}
+
+size_t AliFemtoDreamPartCollection::GetBufferMemory() const {
+  size_t mem = 0;
+  for (auto &itZVtx : fZVtxMultBuffer) {
+    for (auto &itMult : itZVtx) {
+      mem += itMult.GetBufferMemory();
+    }
+  }
+  return mem;
+}
+
+void AliFemtoDreamPartCollection::PrintBufferMemory() const {
+  std::cout << "Mixing buffer memory per (zvtx, mult) bin [kB], events of the first species in brackets\n";
+  for (unsigned int iZVtx = 0; iZVtx < fZVtxMultBuffer.size(); ++iZVtx) {
+    std::cout << "zvtx " << iZVtx << ":";
+    for (auto &itMult : fZVtxMultBuffer[iZVtx]) {
+      std::cout << '\t' << itMult.GetBufferMemory() / 1024 << " ("
+                << (fNSpecies > 0 ? itMult.GetNBufferedEvents(0) : 0) << ")";
+    }
+    std::cout << '\n';
+  }
+  std::cout << "Total: " << GetBufferMemory() / 1024 << " kB" << std::endl;
+}
+
 void AliFemtoDreamPartCollection::FindBin(float ZVtxPos, float Multiplicity,
                                           int *returnBins) {
   returnBins[0] = -99;
@@ -32,6 +32,10 @@ class AliFemtoDreamPartCollection {
   void SetEvent(std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
                 AliFemtoDreamEvent* evt);
   void PrintEvent(int ZVtx, int Mult);
+  //memory of the mixing buffers of one (zvtx, mult) bin, or of all of them
+  size_t GetBufferMemory(int ZVtx, int Mult) const;
+  size_t GetBufferMemory() const;
+  void PrintBufferMemory() const;
   TList* GetHistList() {
     return fHigherMath->GetHistList();
   }
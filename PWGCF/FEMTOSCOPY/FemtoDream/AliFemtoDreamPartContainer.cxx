@@ -12,13 +12,15 @@
 ClassImp(AliFemtoDreamPartContainer)
 AliFemtoDreamPartContainer::AliFemtoDreamPartContainer()
     : fPartBuffer(),
-      fMixingDepth(0) {
+      fMixingDepth(0),
+      fOldest(0) {
 
 }
 
 AliFemtoDreamPartContainer::AliFemtoDreamPartContainer(int MixingDepth)
     : fPartBuffer(),
-      fMixingDepth(MixingDepth) {
+      fMixingDepth(MixingDepth),
+      fOldest(0) {
 
 }
 
@@ -36,6 +38,7 @@ AliFemtoDreamPartContainer& AliFemtoDreamPartContainer::operator=(
 //  }
   this->fMixingDepth = obj.fMixingDepth;
   this->fPartBuffer = obj.fPartBuffer;
+  this->fOldest = obj.fOldest;
   return (*this);
 }
 
@@ -44,18 +47,19 @@ AliFemtoDreamPartContainer::~AliFemtoDreamPartContainer() {
 
 void AliFemtoDreamPartContainer::SetEvent(
     std::vector<AliFemtoDreamBasePart> &Particles) {
-  if (!(fPartBuffer.size() < fMixingDepth)) {
-//    std::cout << "Popping Front" << std::endl;
-    fPartBuffer.pop_front();
+  if (fPartBuffer.size() < fMixingDepth) {
+    fPartBuffer.push_back(Particles);
+  } else if (!fPartBuffer.empty()) {
+    //The assignment reuses the storage of the particles and of their
+    //daughter vectors, no allocation once the bin is in steady state
+    fPartBuffer[fOldest] = Particles;
+    fOldest = (fOldest + 1) % fPartBuffer.size();
   }
-  fPartBuffer.push_back(Particles);
-//  std::cout << "PartBuffer Size: "<<fPartBuffer.size()<<'\t'<<"Input Size: "
-//      << Particles.size() << '\n';
   return;
 }
 
 void AliFemtoDreamPartContainer::PrintLastEvent() {
-  for (std::deque<std::vector<AliFemtoDreamBasePart>>::iterator itEvt =
+  for (std::vector<std::vector<AliFemtoDreamBasePart>>::iterator itEvt =
       fPartBuffer.begin(); itEvt != fPartBuffer.end(); ++itEvt) {
     std::cout << "Printing Last Event with size: " << itEvt->size() << '\n';
     for (std::vector<AliFemtoDreamBasePart>::iterator itPart = itEvt->begin();
@@ -68,7 +72,33 @@ void AliFemtoDreamPartContainer::PrintLastEvent() {
 }
 std::vector<AliFemtoDreamBasePart> &AliFemtoDreamPartContainer::GetEvent(
     int Depth) {
-  std::deque<std::vector<AliFemtoDreamBasePart>>::iterator itEvt = fPartBuffer
-      .begin() + Depth;
-  return *itEvt;
+  return fPartBuffer[(fOldest + Depth) % fPartBuffer.size()];
+}
+
+std::deque<std::vector<AliFemtoDreamBasePart>> AliFemtoDreamPartContainer::GetEventBuffer() const {
+  std::deque<std::vector<AliFemtoDreamBasePart>> buffer;
+  for (unsigned int iDepth = 0; iDepth < fPartBuffer.size(); ++iDepth) {
+    buffer.push_back(fPartBuffer[(fOldest + iDepth) % fPartBuffer.size()]);
+  }
+  return buffer;
+}
+
+size_t AliFemtoDreamPartContainer::GetBufferMemory() const {
+  size_t mem = fPartBuffer.capacity() * sizeof(std::vector<AliFemtoDreamBasePart>);
+  for (auto &itEvt : fPartBuffer) {
+    mem += itEvt.capacity() * sizeof(AliFemtoDreamBasePart);
+    for (auto &itPart : itEvt) {
+      mem += itPart.GetMomenta().capacity() * sizeof(TVector3);
+      mem += (itPart.GetEta().capacity() + itPart.GetTheta().capacity()
+          + itPart.GetMCTheta().capacity() + itPart.GetPhi().capacity()
+          + itPart.GetMCPhi().capacity()) * sizeof(float);
+      mem += (itPart.GetIDTracks().capacity() + itPart.GetCharge().capacity())
+          * sizeof(int);
+      mem += itPart.GetXYZAtRadius().capacity() * sizeof(TVector3);
+      for (auto &itRad : itPart.GetPhiAtRaidius()) {
+        mem += sizeof(std::vector<float>) + itRad.capacity() * sizeof(float);
+      }
+    }
+  }
+  return mem;
 }
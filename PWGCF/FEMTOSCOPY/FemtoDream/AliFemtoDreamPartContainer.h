@@ -16,6 +16,9 @@
 //Class Containing the Particles from previous Events up to a certain mixing
 //depth for one Particle Species and Mult/ZVtx Bin
 //ZVtx bin.
+//The events are kept in a ring of slots which grows up to the mixing depth
+//with the occupancy of the bin. Once full, the oldest slot is overwritten in
+//place, reusing the storage of its particles.
 class AliFemtoDreamPartContainer {
  public:
   AliFemtoDreamPartContainer();
@@ -24,18 +27,20 @@ class AliFemtoDreamPartContainer {
   virtual ~AliFemtoDreamPartContainer();
   void PrintLastEvent();
   void SetEvent(std::vector<AliFemtoDreamBasePart> &Particles);
-  std::deque<std::vector<AliFemtoDreamBasePart>> GetEventBuffer() const {
-    return fPartBuffer;
-  }
-  ;
+  std::deque<std::vector<AliFemtoDreamBasePart>> GetEventBuffer() const;
+  //Depth 0 is the oldest event
   std::vector<AliFemtoDreamBasePart> &GetEvent(int Depth);
   unsigned int GetMixingDepth() const {
     return fPartBuffer.size();
   }
   ;
+  //approximate memory held by the buffer, including unused capacity
+  size_t GetBufferMemory() const;
  private:
-  std::deque<std::vector<AliFemtoDreamBasePart>> fPartBuffer;
-  unsigned int fMixingDepth;ClassDef(AliFemtoDreamPartContainer,2)
+  std::vector<std::vector<AliFemtoDreamBasePart>> fPartBuffer;
+  unsigned int fMixingDepth;
+  unsigned int fOldest;      // slot of the oldest event once the ring is full
+  ClassDef(AliFemtoDreamPartContainer,3)
   ;
 };
 
@@ -0,0 +1,100 @@
+/*
+ * AliFemtoDreamParticleSoA.cxx
+ *
+ * Struct-of-arrays snapshot of one particle species of an event
+ */
+#include "AliFemtoDreamParticleSoA.h"
+#include <cmath>
+#include "TMath.h"
+
+ClassImp(AliFemtoDreamParticleSoA)
+AliFemtoDreamParticleSoA::AliFemtoDreamParticleSoA()
+    : fMass(0.),
+      fPx(),
+      fPy(),
+      fPz(),
+      fE(),
+      fEta(),
+      fEtaBegin(),
+      fPhiAtRadii(),
+      fRowBegin(),
+      fPartRowBegin() {
+}
+
+AliFemtoDreamParticleSoA::~AliFemtoDreamParticleSoA() {
+}
+
+void AliFemtoDreamParticleSoA::Fill(
+    const std::vector<AliFemtoDreamBasePart> &Particles, double mass) {
+  //The capacity of the arrays is kept from one event to the next
+  const size_t nPart = Particles.size();
+  fMass = mass;
+  fPx.resize(nPart);
+  fPy.resize(nPart);
+  fPz.resize(nPart);
+  fE.resize(nPart);
+  fEta.clear();
+  fEtaBegin.resize(nPart + 1);
+  fPhiAtRadii.clear();
+  fRowBegin.clear();
+  fPartRowBegin.resize(nPart + 1);
+  fEtaBegin[0] = 0;
+  fPartRowBegin[0] = 0;
+  fRowBegin.push_back(0);
+  for (size_t iPart = 0; iPart < nPart; ++iPart) {
+    const AliFemtoDreamBasePart &part = Particles[iPart];
+    const TVector3 mom = part.GetMomentum();
+    fPx[iPart] = mom.X();
+    fPy[iPart] = mom.Y();
+    fPz[iPart] = mom.Z();
+    //same as TLorentzVector::SetXYZM
+    fE[iPart] = TMath::Sqrt(mom.Mag2() + mass * mass);
+    const std::vector<float> &eta = part.GetEta();
+    fEta.insert(fEta.end(), eta.begin(), eta.end());
+    fEtaBegin[iPart + 1] = fEta.size();
+    const std::vector<std::vector<float>> &phiAtRad = part.GetPhiAtRaidius();
+    for (auto &itRow : phiAtRad) {
+      fPhiAtRadii.insert(fPhiAtRadii.end(), itRow.begin(), itRow.end());
+      fRowBegin.push_back(fPhiAtRadii.size());
+    }
+    fPartRowBegin[iPart + 1] = fPartRowBegin[iPart] + phiAtRad.size();
+  }
+}
+
+void AliFemtoDreamParticleSoA::RelativePairMomenta(
+    const AliFemtoDreamParticleSoA &partOne, size_t iPart, size_t first,
+    std::vector<float> &kstar) const {
+  //In the pair rest frame p1* = -p2*, the k* = |p1*| follows from the
+  //invariants q = p1 - p2 and P = p1 + p2:
+  //  4 k*^2 = (q.P)^2 / P^2 - q^2,  q.P = m1^2 - m2^2
+  //which is the same as boosting both particles in the rest frame (see
+  //AliFemtoDreamHigherPairMath::RelativePairMomentum), without the boosts.
+  //The differences are taken directly, to avoid the cancellation of s-(m1+m2)^2
+  //for small k*.
+  const size_t nPart = GetSize();
+  kstar.resize(nPart);
+  const double px1 = partOne.fPx[iPart];
+  const double py1 = partOne.fPy[iPart];
+  const double pz1 = partOne.fPz[iPart];
+  const double e1 = partOne.fE[iPart];
+  const double dm2 = partOne.fMass * partOne.fMass - fMass * fMass;
+  const double *px2 = fPx.data();
+  const double *py2 = fPy.data();
+  const double *pz2 = fPz.data();
+  const double *e2 = fE.data();
+  float *out = kstar.data();
+  for (size_t i = first; i < nPart; ++i) {
+    const double sE = e1 + e2[i];
+    const double sPx = px1 + px2[i];
+    const double sPy = py1 + py2[i];
+    const double sPz = pz1 + pz2[i];
+    const double dE = e1 - e2[i];
+    const double dPx = px1 - px2[i];
+    const double dPy = py1 - py2[i];
+    const double dPz = pz1 - pz2[i];
+    const double s = sE * sE - sPx * sPx - sPy * sPy - sPz * sPz;
+    const double q2 = dE * dE - dPx * dPx - dPy * dPy - dPz * dPz;
+    const double k2 = 0.25 * (dm2 * dm2 / s - q2);
+    out[i] = (k2 > 0.) ? std::sqrt(k2) : 0.;
+  }
+}
@@ -0,0 +1,68 @@
+/*
+ * AliFemtoDreamParticleSoA.h
+ *
+ * Struct-of-arrays snapshot of one particle species of an event, used by the
+ * pair loops of AliFemtoDreamZVtxMultContainer
+ */
+
+#ifndef ALIFEMTODREAMPARTICLESOA_H_
+#define ALIFEMTODREAMPARTICLESOA_H_
+#include <vector>
+#include "Rtypes.h"
+
+#include "AliFemtoDreamBasePart.h"
+
+//The momenta and energies are kept in contiguous arrays, so that the relative
+//pair momentum of one particle with all the particles of the species is
+//computed in a single (vectorizable) loop. The daughter eta and the phi* at
+//the TPC radii are flattened, so that the close pair rejection does not need
+//to copy the vectors of AliFemtoDreamBasePart.
+class AliFemtoDreamParticleSoA {
+ public:
+  AliFemtoDreamParticleSoA();
+  virtual ~AliFemtoDreamParticleSoA();
+  void Fill(const std::vector<AliFemtoDreamBasePart> &Particles, double mass);
+  size_t GetSize() const {
+    return fPx.size();
+  }
+  double GetMass() const {
+    return fMass;
+  }
+  //k* of the particle iPart of partOne with the particles [first, GetSize())
+  //of this species, stored at the same index in kstar
+  void RelativePairMomenta(const AliFemtoDreamParticleSoA &partOne,
+                           size_t iPart, size_t first,
+                           std::vector<float> &kstar) const;
+  unsigned int GetNEta(size_t iPart) const {
+    return fEtaBegin[iPart + 1] - fEtaBegin[iPart];
+  }
+  float GetEta(size_t iPart, unsigned int iEta) const {
+    return fEta[fEtaBegin[iPart] + iEta];
+  }
+  unsigned int GetNPhiAtRadii(size_t iPart) const {
+    return fPartRowBegin[iPart + 1] - fPartRowBegin[iPart];
+  }
+  //phi* of the daughter iDaug, GetNRadii(iPart, iDaug) entries
+  const float *GetPhiAtRadii(size_t iPart, unsigned int iDaug) const {
+    return &fPhiAtRadii[fRowBegin[fPartRowBegin[iPart] + iDaug]];
+  }
+  unsigned int GetNRadii(size_t iPart, unsigned int iDaug) const {
+    const unsigned int iRow = fPartRowBegin[iPart] + iDaug;
+    return fRowBegin[iRow + 1] - fRowBegin[iRow];
+  }
+ private:
+  double fMass;                                 // mass of the species
+  std::vector<double> fPx;                      // momentum x
+  std::vector<double> fPy;                      // momentum y
+  std::vector<double> fPz;                      // momentum z
+  std::vector<double> fE;                       // energy with the species mass
+  std::vector<float> fEta;                      // eta of the particle and the daughters
+  std::vector<unsigned int> fEtaBegin;          // first eta of each particle
+  std::vector<float> fPhiAtRadii;               // phi* of all daughters at all radii
+  std::vector<unsigned int> fRowBegin;          // first radius of each daughter
+  std::vector<unsigned int> fPartRowBegin;      // first daughter of each particle
+ClassDef(AliFemtoDreamParticleSoA, 1)
+  ;
+};
+
+#endif /* ALIFEMTODREAMPARTICLESOA_H_ */
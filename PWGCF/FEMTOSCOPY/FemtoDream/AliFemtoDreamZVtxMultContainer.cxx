@@ -17,7 +17,11 @@ AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer()
       fPDGParticleSpecies(0),
       fWhichPairs(),
       fSummedPtLimit1(0.0),
-      fSummedPtLimit2(999.0){
+      fSummedPtLimit2(999.0),
+      fMasses(),
+      fPartSoA(),
+      fMixedSoA(),
+      fRelativeK() {
 }
 
 AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer(
@@ -27,7 +31,11 @@ AliFemtoDreamZVtxMultContainer::AliFemtoDreamZVtxMultContainer(
       fPDGParticleSpecies(conf->GetPDGCodes()),
       fWhichPairs(conf->GetWhichPairs()),
       fSummedPtLimit1(conf->GetSummedPtLimit1()),
-      fSummedPtLimit2(conf->GetSummedPtLimit2()){
+      fSummedPtLimit2(conf->GetSummedPtLimit2()),
+      fMasses(),
+      fPartSoA(),
+      fMixedSoA(),
+      fRelativeK() {
   TDatabasePDG::Instance()->AddParticle("deuteron", "deuteron", 1.8756134,
                                         kTRUE, 0.0, 1, "Nucleus", 1000010020);
   TDatabasePDG::Instance()->AddAntiParticle("anti-deuteron", -1000010020);
@@ -60,129 +68,134 @@ void AliFemtoDreamZVtxMultContainer::SetEvent(
   }
   //  }
 }
+size_t AliFemtoDreamZVtxMultContainer::GetBufferMemory() const {
+  size_t mem = 0;
+  for (auto &itContainer : fPartContainer) {
+    mem += itContainer.GetBufferMemory();
+  }
+  return mem;
+}
+
+void AliFemtoDreamZVtxMultContainer::FillParticleSoA(
+    std::vector<std::vector<AliFemtoDreamBasePart>> &Particles) {
+  //Snapshot of the species of the current event, built once per event so that
+  //the pair loops run over contiguous arrays
+  if (fMasses.size() != fPDGParticleSpecies.size()) {
+    fMasses.clear();
+    for (auto itPDG : fPDGParticleSpecies) {
+      fMasses.push_back(TDatabasePDG::Instance()->GetParticle(itPDG)->Mass());
+    }
+  }
+  fPartSoA.resize(Particles.size());
+  for (unsigned int iSpec = 0; iSpec < Particles.size(); ++iSpec) {
+    fPartSoA[iSpec].Fill(Particles[iSpec], fMasses[iSpec]);
+  }
+}
+
 void AliFemtoDreamZVtxMultContainer::PairParticlesSE(
     std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
     AliFemtoDreamHigherPairMath *HigherMath, int iMult, float cent) {
+  FillParticleSoA(Particles);
   int HistCounter = 0;
   //First loop over all the different Species
-  auto itPDGPar1 = fPDGParticleSpecies.begin();
-  for (auto itSpec1 = Particles.begin(); itSpec1 != Particles.end();
-      ++itSpec1) {
-    auto itPDGPar2 = fPDGParticleSpecies.begin();
-    itPDGPar2 += itSpec1 - Particles.begin();
-    for (auto itSpec2 = itSpec1; itSpec2 != Particles.end(); ++itSpec2) {
-      HigherMath->FillPairCounterSE(HistCounter, itSpec1->size(),
-                                    itSpec2->size());
+  for (unsigned int iSpec1 = 0; iSpec1 < Particles.size(); ++iSpec1) {
+    std::vector<AliFemtoDreamBasePart> &spec1 = Particles[iSpec1];
+    const AliFemtoDreamParticleSoA &soa1 = fPartSoA[iSpec1];
+    const int PDGPar1 = fPDGParticleSpecies[iSpec1];
+    for (unsigned int iSpec2 = iSpec1; iSpec2 < Particles.size(); ++iSpec2) {
+      std::vector<AliFemtoDreamBasePart> &spec2 = Particles[iSpec2];
+      const AliFemtoDreamParticleSoA &soa2 = fPartSoA[iSpec2];
+      const int PDGPar2 = fPDGParticleSpecies[iSpec2];
+      HigherMath->FillPairCounterSE(HistCounter, spec1.size(), spec2.size());
       //Now loop over the actual Particles and correlate them
-      for (auto itPart1 = itSpec1->begin(); itPart1 != itSpec1->end();
-          ++itPart1) {
-        AliFemtoDreamBasePart part1 = *itPart1;
-        std::vector<AliFemtoDreamBasePart>::iterator itPart2;
-        if (itSpec1 == itSpec2) {
-          itPart2 = itPart1 + 1;
-        } else {
-          itPart2 = itSpec2->begin();
-        }
-        while (itPart2 != itSpec2->end()) {
-          AliFemtoDreamBasePart part2 = *itPart2;
-          TLorentzVector PartOne, PartTwo;
-          PartOne.SetXYZM(
-              itPart1->GetMomentum().X(), itPart1->GetMomentum().Y(),
-              itPart1->GetMomentum().Z(),
-              TDatabasePDG::Instance()->GetParticle(*itPDGPar1)->Mass());
-          PartTwo.SetXYZM(
-              itPart2->GetMomentum().X(), itPart2->GetMomentum().Y(),
-              itPart2->GetMomentum().Z(),
-              TDatabasePDG::Instance()->GetParticle(*itPDGPar2)->Mass());
-          float RelativeK = HigherMath->RelativePairMomentum(PartOne, PartTwo);
-          if (!HigherMath->PassesPairSelection(HistCounter, *itPart1, *itPart2,
-                                               RelativeK, true, false)) {
-            ++itPart2;
+      for (size_t iPart1 = 0; iPart1 < spec1.size(); ++iPart1) {
+        const size_t first = (iSpec1 == iSpec2) ? iPart1 + 1 : 0;
+        soa2.RelativePairMomenta(soa1, iPart1, first, fRelativeK);
+        AliFemtoDreamBasePart &part1 = spec1[iPart1];
+        for (size_t iPart2 = first; iPart2 < spec2.size(); ++iPart2) {
+          AliFemtoDreamBasePart &part2 = spec2[iPart2];
+          float RelativeK = fRelativeK[iPart2];
+          if (!HigherMath->PassesPairSelection(HistCounter, soa1, iPart1, soa2,
+                                               iPart2, part1, part2, RelativeK,
+                                               true)) {
             continue;
           }
           RelativeK = HigherMath->FillSameEvent(HistCounter, iMult, cent,
                                                 part1,
-                                                *itPDGPar1,
+                                                PDGPar1,
                                                 part2,
-                                                *itPDGPar2,
+                                                PDGPar2,
 						fSummedPtLimit1,
 						fSummedPtLimit2);
-          HigherMath->MassQA(HistCounter, RelativeK, *itPart1, *itPDGPar1,
-                                                     *itPart2, *itPDGPar2);
-          HigherMath->SEDetaDPhiPlots(HistCounter, *itPart1, *itPDGPar1,
-                                      *itPart2, *itPDGPar2, RelativeK, false);
-          HigherMath->SEMomentumResolution(HistCounter, &(*itPart1), *itPDGPar1,
-                                           &(*itPart2), *itPDGPar2, RelativeK);
-          ++itPart2;
+          HigherMath->MassQA(HistCounter, RelativeK, part1, PDGPar1,
+                                                     part2, PDGPar2);
+          HigherMath->SEDetaDPhiPlots(HistCounter, part1, PDGPar1,
+                                      part2, PDGPar2, RelativeK, false);
+          HigherMath->SEMomentumResolution(HistCounter, &part1, PDGPar1,
+                                           &part2, PDGPar2, RelativeK);
         }
       }
       ++HistCounter;
-      itPDGPar2++;
     }
-    itPDGPar1++;
   }
 }
 
 void AliFemtoDreamZVtxMultContainer::PairParticlesME(
     std::vector<std::vector<AliFemtoDreamBasePart>> &Particles,
     AliFemtoDreamHigherPairMath *HigherMath, int iMult, float cent) {
+  FillParticleSoA(Particles);
   int HistCounter = 0;
-  auto itPDGPar1 = fPDGParticleSpecies.begin();
   //First loop over all the different Species
-  for (auto itSpec1 = Particles.begin(); itSpec1 != Particles.end();
-      ++itSpec1) {
+  for (unsigned int iSpec1 = 0; iSpec1 < Particles.size(); ++iSpec1) {
+    std::vector<AliFemtoDreamBasePart> &spec1 = Particles[iSpec1];
+    const AliFemtoDreamParticleSoA &soa1 = fPartSoA[iSpec1];
+    const int PDGPar1 = fPDGParticleSpecies[iSpec1];
     //We dont want to correlate the particles twice. Mixed Event Dist. of
     //Particle1 + Particle2 == Particle2 + Particle 1
-    int SkipPart = itSpec1 - Particles.begin();
-    auto itPDGPar2 = fPDGParticleSpecies.begin() + SkipPart;
-    for (auto itSpec2 = fPartContainer.begin() + SkipPart;
-        itSpec2 != fPartContainer.end(); ++itSpec2) {
-      if (itSpec1->size() > 0) {
+    for (unsigned int iSpec2 = iSpec1; iSpec2 < fPartContainer.size();
+        ++iSpec2) {
+      AliFemtoDreamPartContainer &container = fPartContainer[iSpec2];
+      const int PDGPar2 = fPDGParticleSpecies[iSpec2];
+      if (spec1.size() > 0) {
         HigherMath->FillEffectiveMixingDepth(HistCounter,
-                                             (int) itSpec2->GetMixingDepth());
+                                             (int) container.GetMixingDepth());
       }
-      for (int iDepth = 0; iDepth < (int) itSpec2->GetMixingDepth(); ++iDepth) {
-        std::vector<AliFemtoDreamBasePart> ParticlesOfEvent = itSpec2->GetEvent(
-            iDepth);
-        HigherMath->FillPairCounterME(HistCounter, itSpec1->size(),
+      for (int iDepth = 0; iDepth < (int) container.GetMixingDepth(); ++iDepth) {
+        std::vector<AliFemtoDreamBasePart> &ParticlesOfEvent = container
+            .GetEvent(iDepth);
+        HigherMath->FillPairCounterME(HistCounter, spec1.size(),
                                       ParticlesOfEvent.size());
-        for (auto itPart1 = itSpec1->begin(); itPart1 != itSpec1->end();
-            ++itPart1) {
-          for (auto itPart2 = ParticlesOfEvent.begin();
-              itPart2 != ParticlesOfEvent.end(); ++itPart2) {
-
-            TLorentzVector PartOne, PartTwo;
-            PartOne.SetXYZM(
-                itPart1->GetMomentum().X(), itPart1->GetMomentum().Y(),
-                itPart1->GetMomentum().Z(),
-                TDatabasePDG::Instance()->GetParticle(*itPDGPar1)->Mass());
-            PartTwo.SetXYZM(
-                itPart2->GetMomentum().X(), itPart2->GetMomentum().Y(),
-                itPart2->GetMomentum().Z(),
-                TDatabasePDG::Instance()->GetParticle(*itPDGPar2)->Mass());
-            float RelativeK = HigherMath->RelativePairMomentum(PartOne, PartTwo);
-            if (!HigherMath->PassesPairSelection(HistCounter, *itPart1, *itPart2,
-                                                 RelativeK, false, false)) {
+        if (spec1.empty() || ParticlesOfEvent.empty()) {
+          continue;
+        }
+        fMixedSoA.Fill(ParticlesOfEvent, fMasses[iSpec2]);
+        for (size_t iPart1 = 0; iPart1 < spec1.size(); ++iPart1) {
+          fMixedSoA.RelativePairMomenta(soa1, iPart1, 0, fRelativeK);
+          AliFemtoDreamBasePart &part1 = spec1[iPart1];
+          for (size_t iPart2 = 0; iPart2 < ParticlesOfEvent.size(); ++iPart2) {
+            AliFemtoDreamBasePart &part2 = ParticlesOfEvent[iPart2];
+            float RelativeK = fRelativeK[iPart2];
+            if (!HigherMath->PassesPairSelection(HistCounter, soa1, iPart1,
+                                                 fMixedSoA, iPart2, part1,
+                                                 part2, RelativeK, false)) {
               continue;
             }
             RelativeK = HigherMath->FillMixedEvent(
-                HistCounter, iMult, cent, *itPart1, *itPDGPar1,
-                *itPart2, *itPDGPar2,
+                HistCounter, iMult, cent, part1, PDGPar1,
+                part2, PDGPar2,
                 AliFemtoDreamCollConfig::kNone);
 
-            HigherMath->MEMassQA(HistCounter, RelativeK, *itPart1, *itPDGPar1,
-                                                         *itPart2, *itPDGPar2);
-            HigherMath->MEDetaDPhiPlots(HistCounter, *itPart1, *itPDGPar1,
-                                        *itPart2, *itPDGPar2, RelativeK, false);
-            HigherMath->MEMomentumResolution(HistCounter, &(*itPart1),
-                                             *itPDGPar1, &(*itPart2),
-                                             *itPDGPar2, RelativeK);
+            HigherMath->MEMassQA(HistCounter, RelativeK, part1, PDGPar1,
+                                                         part2, PDGPar2);
+            HigherMath->MEDetaDPhiPlots(HistCounter, part1, PDGPar1,
+                                        part2, PDGPar2, RelativeK, false);
+            HigherMath->MEMomentumResolution(HistCounter, &part1,
+                                             PDGPar1, &part2,
+                                             PDGPar2, RelativeK);
           }
         }
       }
       ++HistCounter;
-      ++itPDGPar2;
     }
-    ++itPDGPar1;
   }
 }
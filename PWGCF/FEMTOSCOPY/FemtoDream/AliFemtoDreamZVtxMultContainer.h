@@ -14,6 +14,7 @@
 #include "AliFemtoDreamCorrHists.h"
 #include "AliFemtoDreamPartContainer.h"
 #include "AliFemtoDreamHigherPairMath.h"
+#include "AliFemtoDreamParticleSoA.h"
 
 //Class containing the array buffer of the different particle species for one
 //Multiplicity bin
@@ -36,11 +37,17 @@ class AliFemtoDreamZVtxMultContainer {
   float ComputeDeltaPhi(AliFemtoDreamBasePart &part1,
                         AliFemtoDreamBasePart &part2);
   void SetEvent(std::vector<std::vector<AliFemtoDreamBasePart>> &Particles);
+  size_t GetBufferMemory() const;
+  unsigned int GetNBufferedEvents(unsigned int iSpecies) const {
+    return fPartContainer.at(iSpecies).GetMixingDepth();
+  }
   TString ClassName() {
     return "zVtxMult Container";
   }
   ;
  private:
+  void FillParticleSoA(
+      std::vector<std::vector<AliFemtoDreamBasePart>> &Particles);
   std::vector<AliFemtoDreamPartContainer> fPartContainer;
   std::vector<int> fPDGParticleSpecies;
   std::vector<unsigned int> fWhichPairs;
@@ -51,7 +58,11 @@ class AliFemtoDreamZVtxMultContainer {
 //  float fDeltaPhiEtaMax;
   float fSummedPtLimit1;
   float fSummedPtLimit2;
-ClassDef(AliFemtoDreamZVtxMultContainer, 4)
+  std::vector<double> fMasses;                   //! mass of each species
+  std::vector<AliFemtoDreamParticleSoA> fPartSoA;  //! species of the current event
+  AliFemtoDreamParticleSoA fMixedSoA;            //! species of the mixed event
+  std::vector<float> fRelativeK;                 //! k* of one particle with a species
+ClassDef(AliFemtoDreamZVtxMultContainer, 5)
   ;
 };
 
@@ -26,6 +26,7 @@
 #pragma link C++ class AliFemtoDreamCorrHists+;
 #pragma link C++ class AliFemtoDreamPartContainer+;
 #pragma link C++ class AliFemtoDreamZVtxMultContainer+;
+#pragma link C++ class AliFemtoDreamParticleSoA+;
 #pragma link C++ class AliFemtoDreamPartCollection+;
 #pragma link C++ class AliFemtoDreamAnalysis+;
 #pragma link C++ class AliAnalysisTaskFemtoDream+;
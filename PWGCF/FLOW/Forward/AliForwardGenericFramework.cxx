@@ -32,7 +32,13 @@ AliForwardGenericFramework::AliForwardGenericFramework(Int_t refbins):
   cumu_dW2A(),
   cumu_dW2TwoA(),
   cumu_dW22TwoTwoN(),
-  cumu_dW22TwoTwoD()
+  cumu_dW22TwoTwoD(),
+  fPhiCos(),
+  fPhiSin(),
+  fPhiCenter(),
+  fPhiTableBins(0),
+  fPhiTableMin(0),
+  fPhiTableMax(0)
 {
   Int_t rbins[4] = {2, 6, 4, 2} ; // kind (real or imaginary), n, p, eta
   Int_t dimensions = 4;
@@ -59,12 +65,54 @@ AliForwardGenericFramework::AliForwardGenericFramework(Int_t refbins):
 }
 
 
+//_____________________________________________________________________
+void AliForwardGenericFramework::FillPhiTables(const TAxis* phiAxis)
+{
+  Int_t nPhi = phiAxis->GetNbins();
+  if (!phiAxis->IsVariableBinSize() && nPhi == fPhiTableBins
+      && phiAxis->GetXmin() == fPhiTableMin && phiAxis->GetXmax() == fPhiTableMax) return;
+
+  fPhiTableBins = nPhi;
+  fPhiTableMin = phiAxis->GetXmin();
+  fPhiTableMax = phiAxis->GetXmax();
+  fPhiCenter.assign(nPhi+2, 0.);
+  fPhiCos.assign(5*(nPhi+2), 0.);
+  fPhiSin.assign(5*(nPhi+2), 0.);
+  for (Int_t phiBin = 1; phiBin <= nPhi; phiBin++) {
+    Double_t phi = phiAxis->GetBinCenter(phiBin);
+    fPhiCenter[phiBin] = phi;
+    for (Int_t n = 0; n <= 4; n++) {
+      fPhiCos[n*(nPhi+2)+phiBin] = TMath::Cos(n*phi);
+      fPhiSin[n*(nPhi+2)+phiBin] = TMath::Sin(n*phi);
+    }
+  }
+}
+
+
 //_____________________________________________________________________
 void AliForwardGenericFramework::CumulantsAccumulate(TH2D*& dNdetadphi, double cent, double zvertex, Bool_t useFMD, Bool_t doRefFlow, Bool_t doDiffFlow)
 {
-  for (Int_t etaBin = 1; etaBin <= dNdetadphi->GetNbinsX(); etaBin++) {
+  // The (eta,phi) cells are read directly from the bin array of dNdetadphi and the cos/sin of
+  // each phi bin come from a lookup table. Q-vector components are summed over phi for each eta
+  // row and filled into the THns once per row instead of once per cell.
+  const Int_t nEta = dNdetadphi->GetNbinsX();
+  const Int_t nPhi = dNdetadphi->GetNbinsY();
+  const Int_t stride = nEta + 2; // global bin = etaBin + (nEta+2)*phiBin
+  const Double_t* cells = dNdetadphi->GetArray();
+  FillPhiTables(dNdetadphi->GetYaxis());
+
+  const Bool_t fillq = (useFMD & !(fSettings.etagap)) ||
+                       (!(useFMD) && (fSettings.ref_mode & fSettings.kTPCref)) ||
+                       (useFMD && (fSettings.ref_mode & fSettings.kFMDref));
+  const Bool_t doSecCorr = useFMD && fSettings.sec_corr;
+  const Bool_t doInterpolate = useFMD && fSettings.doNUA && (fSettings.nua_mode & fSettings.kInterpolate);
+
+  Double_t sumRe[5][5]; // [n][p], p = 1..4
+  Double_t sumIm[5][5];
+
+  for (Int_t etaBin = 1; etaBin <= nEta; etaBin++) {
     if ((!fSettings.use_primaries_fwd && !fSettings.esd) && useFMD){
-      if (dNdetadphi->GetBinContent(etaBin, 0) == 0) continue; // No data expected for this eta 
+      if (cells[etaBin] == 0) continue; // No data expected for this eta
     }
     Double_t eta = dNdetadphi->GetXaxis()->GetBinCenter(etaBin);
     if (eta > fSettings.fEtaUpEdge || eta < fSettings.fEtaLowEdge) continue;
@@ -74,81 +122,86 @@ void AliForwardGenericFramework::CumulantsAccumulate(TH2D*& dNdetadphi, double c
     Double_t refEtaBin = fQvector->GetAxis(3)->FindBin(eta);
     Double_t refEta = fQvector->GetAxis(3)->GetBinCenter(refEtaBin);
 
-    for (Int_t phiBin = 1; phiBin <= dNdetadphi->GetNbinsY(); phiBin++) {//
-      /*
-      if (useFMD & fSettings.makeFakeHoles){
-        if ((etaBin > 124) & (etaBin < 138)){
-          if (phiBin == 18 || phiBin == 17) continue;
-        }
-        if ((etaBin > 167) & (etaBin < 186)){
-          if (phiBin == 14) continue;
-        }
+    // reference flow acceptance depends on eta only
+    Bool_t doRef = doRefFlow;
+    if (doRef && (fSettings.etagap) && TMath::Abs(eta)<=fSettings.gap) doRef = kFALSE;
+    if (doRef && (fSettings.ref_mode & fSettings.kTPCref)) {
+      if ((fSettings.TPC_maxeta > 0) & (TMath::Abs(eta) > fSettings.TPC_maxeta)) doRef = kFALSE;
+    }
+    if (doRef && (fSettings.ref_mode & fSettings.kFMDref)) {
+      if (TMath::Abs(eta) < fSettings.fmdlowcut) doRef = kFALSE;
+      if (TMath::Abs(eta) > fSettings.fmdhighcut) doRef = kFALSE;
+    }
+    if (!doRef && !doDiffFlow) continue;
+
+    // per-harmonic weight corrections depend on eta (and the event) only
+    Double_t corr[5] = {1., 1., 1., 1., 1.};
+    for (Int_t n = 2; n <= 4; n++) {
+      if (doSecCorr) corr[n] = applySecondaryCorr(n-1, eta, zvertex, cent, corr[n]);
+      if (doInterpolate && (((difEtaBin >= 24) && (difEtaBin < 27)) || (difEtaBin > 33))) {
+        corr[n] = applyInterpolateCorr(n,cent,difEtaBin,corr[n]);
       }
-      */
-      Double_t phi = dNdetadphi->GetYaxis()->GetBinCenter(phiBin);
-      Double_t weight = dNdetadphi->GetBinContent(etaBin, phiBin);
+    }
+
+    for (Int_t n = 0; n <= 4; n++) {
+      for (Int_t p = 1; p <= 4; p++) { sumRe[n][p] = 0.; sumIm[n][p] = 0.; }
+    }
+    Double_t autoCorr = 0.; // sum of weight*(weight-1), once per filled power as before
+    Bool_t filled = kFALSE;
+
+    for (Int_t phiBin = 1; phiBin <= nPhi; phiBin++) {
+      Double_t weight = cells[etaBin + stride*phiBin];
 
       if (fSettings.doNUA){
+        Double_t phi = fPhiCenter[phiBin];
         if (useFMD) weight = applyNUAforward(dNdetadphi, etaBin, phiBin, eta, phi, zvertex, weight);
         else weight = applyNUAcentral(eta, phi, zvertex, weight);
       }
-      
+
       if (!weight || weight == 0) continue;
       for (Int_t n = 0; n <= 4; n++) {
         // careful not to overwrite weight when doing sec. corr.
-        Double_t weight_n = weight;
-        if ((useFMD && fSettings.sec_corr) && n >=2) weight_n = applySecondaryCorr(n-1, eta, zvertex, cent, weight_n);
-
+        Double_t weight_n = weight*corr[n];
         if (!weight_n || weight_n == 0) continue;
+        filled = kTRUE;
 
-        if ((fSettings.doNUA && (fSettings.nua_mode & fSettings.kInterpolate)) && (n > 1)){
-          if (useFMD){
-            if (((difEtaBin >= 24) && (difEtaBin < 27)) || (difEtaBin > 33) ){
-              weight_n = applyInterpolateCorr(n,cent,difEtaBin,weight_n);
-            }           
-          }
-        }
-        
+        Double_t c = fPhiCos[n*(nPhi+2)+phiBin];
+        Double_t s = fPhiSin[n*(nPhi+2)+phiBin];
+        Double_t wp = weight_n;
         for (Int_t p = 1; p <= 4; p++) {
-          Double_t realPart = TMath::Power(weight_n, p)*TMath::Cos(n*phi);
-          Double_t imPart =   TMath::Power(weight_n, p)*TMath::Sin(n*phi);
+          sumRe[n][p] += wp*c;
+          sumIm[n][p] += wp*s;
+          wp *= weight_n;
+        }
+        if ((weight_n > 1.0) & !fSettings.etagap) autoCorr += 4*weight*(weight - 1);
+      } // End of n loop
+    } // End of phi loop
+    if (!filled) continue;
 
+    for (Int_t n = 0; n <= 4; n++) {
+      for (Int_t p = 1; p <= 4; p++) {
+        if (doDiffFlow){
           Double_t re[4] = {0.5, Double_t(n), Double_t(p), difEta};
           Double_t im[4] = {-0.5, Double_t(n), Double_t(p), difEta};
-
-          if (doDiffFlow){
-            fpvector->Fill(re, realPart);
-            fpvector->Fill(im, imPart);
-
-            if ((useFMD & !(fSettings.etagap)) ||
-                (!(useFMD) && (fSettings.ref_mode & fSettings.kTPCref)) ||
-                (useFMD && (fSettings.ref_mode & fSettings.kFMDref))) {
-              fqvector->Fill(re, realPart);
-              fqvector->Fill(im, imPart);
-              if ((weight_n > 1.0) & !fSettings.etagap) fAutoDiff->Fill(refEta,weight*(weight - 1));
-            }
+          fpvector->Fill(re, sumRe[n][p]);
+          fpvector->Fill(im, sumIm[n][p]);
+          if (fillq) {
+            fqvector->Fill(re, sumRe[n][p]);
+            fqvector->Fill(im, sumIm[n][p]);
           }
-
-          if (doRefFlow){
-            if ((fSettings.etagap) && TMath::Abs(eta)<=fSettings.gap) continue;
-
-            if (fSettings.ref_mode & fSettings.kTPCref) {           
-              if ((fSettings.TPC_maxeta > 0) & (TMath::Abs(eta) > fSettings.TPC_maxeta)) continue;
-            }
-            if (fSettings.ref_mode & fSettings.kFMDref) {
-              if (TMath::Abs(eta) < fSettings.fmdlowcut) continue;
-              if (TMath::Abs(eta) > fSettings.fmdhighcut) continue;
-            }
-
-            Double_t req[4] = {0.5, static_cast<Double_t>(n), static_cast<Double_t>(p), refEta};
-            Double_t imq[4] = {-0.5, static_cast<Double_t>(n), static_cast<Double_t>(p), refEta};
-            if ((weight_n > 1.0) & !fSettings.etagap) fAutoRef->Fill(refEta,weight*(weight - 1));  
-            fQvector->Fill(req, realPart);
-            fQvector->Fill(imq, imPart);
-          }
-        } // end p loop
-      } // End of n loop
-    } // End of phi loop
+        }
+        if (doRef){
+          Double_t req[4] = {0.5, static_cast<Double_t>(n), static_cast<Double_t>(p), refEta};
+          Double_t imq[4] = {-0.5, static_cast<Double_t>(n), static_cast<Double_t>(p), refEta};
+          fQvector->Fill(req, sumRe[n][p]);
+          fQvector->Fill(imq, sumIm[n][p]);
+        }
+      } // end p loop
+    } // End of n loop
+    if (autoCorr != 0) {
+      if (doDiffFlow && fillq) fAutoDiff->Fill(refEta,autoCorr);
+      if (doRef) fAutoRef->Fill(refEta,autoCorr);
+    }
   } // end of eta
   return;
 }
@@ -26,6 +26,7 @@
 #include "AliForwardSettings.h"
 #include "AliForwardNUATask.h"
 #include <iostream>
+#include <vector>
 
 /**
  * Class to handle cumulant calculations.
@@ -245,6 +246,16 @@ public:
   THnD* cumu_dW22TwoTwoN ;//! // Numerator of R_{n,n; 2}
   THnD* cumu_dW22TwoTwoD ;//! // Denominator of R_{n,n; 2}
 
+  // cos(n*phi), sin(n*phi) per phi bin (indexed [n*(nbins+2)+phiBin]) used in CumulantsAccumulate,
+  // rebuilt only when the phi binning of the input histogram changes
+  void FillPhiTables(const TAxis* phiAxis);
+  std::vector<Double_t> fPhiCos;//!
+  std::vector<Double_t> fPhiSin;//!
+  std::vector<Double_t> fPhiCenter;//!
+  Int_t fPhiTableBins;//!
+  Double_t fPhiTableMin;//!
+  Double_t fPhiTableMax;//!
+
 
 
   ClassDef(AliForwardGenericFramework, 1); // object for eta dependent cumulant ananlysis
@@ -48,6 +48,7 @@
 #include "TRandom3.h"
 
 #include "AliUniFlowCorrTask.h"
+#include "AliESEqnService.h"
 
 #include <iostream>
 
@@ -112,6 +113,8 @@ AliAnalysisTaskESEFlow::AliAnalysisTaskESEFlow() : AliAnalysisTaskSE(),
     fSplq3V0A{0},
     fh3Weights{nullptr},
     fhV0Calib{nullptr},
+    fESEService{nullptr},
+    fV0CalibRun{-1},
     
     fHistPDG{0},
 
@@ -278,6 +281,8 @@ AliAnalysisTaskESEFlow::AliAnalysisTaskESEFlow(const char* name, ColSystem colSy
     fSplq3V0A{0},
     fh3Weights{nullptr},
     fhV0Calib{nullptr},
+    fESEService{nullptr},
+    fV0CalibRun{-1},
 
     fHistPDG{0},
 
@@ -453,6 +458,23 @@ Bool_t AliAnalysisTaskESEFlow::InitializeTask()
         if(!LoadqSelection()) { AliFatal("\n \n \n \n \n \n \n \n \n \n q-Splines not loaded! Terminating! \n \n \n \n \n \n \n \n \n \n "); return kFALSE; }
     }
 
+    // V0 q-vectors and percentiles, the splines are tabulated once here
+    if(fV0RunByRunCalibration){
+        fESEService = new AliESEqnService();
+        fESEService->AddHarmonic(2);
+        fESEService->AddHarmonic(3);
+        if(!fMakeqSelectionRun){
+            if(fV0CEse){
+                fESEService->SetPercentileSplines(AliESEqnService::kV0C,2,90,fSplq2V0C,100.);
+                fESEService->SetPercentileSplines(AliESEqnService::kV0C,3,90,fSplq3V0C,100.);
+            }
+            if(fV0AEse){
+                fESEService->SetPercentileSplines(AliESEqnService::kV0A,2,90,fSplq2V0A,100.);
+                fESEService->SetPercentileSplines(AliESEqnService::kV0A,3,90,fSplq3V0A,100.);
+            }
+        }
+    }
+
     if(fSampling && fNumSamples < 2){
         AliFatal("Sampling used, but number of samples < 2! Terminating!");
         return kFALSE;
@@ -1411,8 +1433,8 @@ void AliAnalysisTaskESEFlow::CorrelationTask(const Float_t centrality, Int_t fSp
         Int_t q3ESECodeTPC = GetEsePercentileCode(q3TPCInp);
         if (q2ESECodeTPC<0) { printf("Problem with q_3 TPC percentile: negative percentile \n"); return; } 
         
-        Double_t q2V0CInp = 100.*fSplq2V0C[fSpCent]->Eval(qnV0C[0]);
-        Double_t q3V0CInp = 100.*fSplq3V0C[fSpCent]->Eval(qnV0C[1]);
+        Double_t q2V0CInp = fESEService->GetPercentile(AliESEqnService::kV0C, fESEService->GetHarmonicIndex(2));
+        Double_t q3V0CInp = fESEService->GetPercentile(AliESEqnService::kV0C, fESEService->GetHarmonicIndex(3));
 
         Int_t q2ESECodeV0C = GetEsePercentileCode(q2V0CInp);
         if (q2ESECodeV0C<0) { printf("Problem with q_2 V0C percentile: negative percentile \n"); return; } 
@@ -1421,8 +1443,8 @@ void AliAnalysisTaskESEFlow::CorrelationTask(const Float_t centrality, Int_t fSp
         
 
 
-        Double_t q2V0AInp = 100.*fSplq2V0A[fSpCent]->Eval(qnV0A[0]); // do q-selection for V0A
-        Double_t q3V0AInp = 100.*fSplq3V0A[fSpCent]->Eval(qnV0A[1]);
+        Double_t q2V0AInp = fESEService->GetPercentile(AliESEqnService::kV0A, fESEService->GetHarmonicIndex(2)); // do q-selection for V0A
+        Double_t q3V0AInp = fESEService->GetPercentile(AliESEqnService::kV0A, fESEService->GetHarmonicIndex(3));
 
         Int_t q2ESECodeV0A = GetEsePercentileCode(q2V0AInp);
         if (q2ESECodeV0A<0) { printf("Problem with q_2 V0A percentile: negative percentile \n"); return; } 
@@ -1993,93 +2015,31 @@ void AliAnalysisTaskESEFlow::ReducedqVectorsV0(const Float_t centrality,const In
     ResetReducedqVector(QxnV0ACorr);
     ResetReducedqVector(QynV0ACorr);
 
-    AliAODVZERO* aodV0 = fAOD->GetVZEROData();
-
-    Double_t MC=0;
-
-    Double_t MA=0;
-
-    for (Int_t iV0=0; iV0 < 64; ++iV0){
-
-        Double_t PhiV0 = TMath::PiOver4()*(0.5 + iV0 % 8);
-
-        Float_t multV0 = aodV0->GetMultiplicity(iV0);
-
-        if(iV0<32){
-
-            Double_t multCorC = -10;
-
-            //V0 calibration
-            if (iV0 < 8)
-                multCorC = multV0/fhV0Calib->GetBinContent(iV0+1)*fhV0Calib->GetBinContent(1);
-            else if (iV0 >= 8 && iV0 < 16)
-                multCorC = multV0/fhV0Calib->GetBinContent(iV0+1)*fhV0Calib->GetBinContent(9);
-            else if (iV0 >= 16 && iV0 < 24)
-                multCorC = multV0/fhV0Calib->GetBinContent(iV0+1)*fhV0Calib->GetBinContent(17);
-            else if (iV0 >= 24 && iV0 < 32)
-                multCorC = multV0/fhV0Calib->GetBinContent(iV0+1)*fhV0Calib->GetBinContent(25);
-            
-
-            if (multCorC < 0){
-                printf("Problem with multiplicity in V0C");
-                continue;
-            }
-
-            for(Int_t iHarm(0); iHarm < 2; ++iHarm)
-            {                
-                Double_t dCosC = multCorC * TMath::Cos( (iHarm+2) * PhiV0);
-                Double_t dSinC = multCorC * TMath::Sin( (iHarm+2) * PhiV0);
-                QxnV0C[iHarm] += dCosC;
-                QynV0C[iHarm] += dSinC;
-            }
-
-            MC += multCorC;
-        }
-        else {
-            Double_t multCorA = -10;
-
-            if (iV0 >= 32 && iV0 < 40)
-                multCorA = multV0/fhV0Calib->GetBinContent(iV0+1)*fhV0Calib->GetBinContent(33);
-            else if (iV0 >= 40 && iV0 < 48)
-                multCorA = multV0/fhV0Calib->GetBinContent(iV0+1)*fhV0Calib->GetBinContent(41);
-            else if (iV0 >= 48 && iV0 < 56)
-                multCorA = multV0/fhV0Calib->GetBinContent(iV0+1)*fhV0Calib->GetBinContent(49);
-            else if (iV0 >= 56 && iV0 < 64)
-                multCorA = multV0/fhV0Calib->GetBinContent(iV0+1)*fhV0Calib->GetBinContent(57);            
-
-            if (multCorA < 0){
-                printf("Problem with multiplicity in V0A");
-                continue;
-            }
-
-            for(Int_t iHarm(0); iHarm < 2; ++iHarm)
-            {                
-                Double_t dCosA = multCorA * TMath::Cos( (iHarm+2) * PhiV0);
-                Double_t dSinA = multCorA * TMath::Sin( (iHarm+2) * PhiV0);
-                QxnV0A[iHarm] += dCosA;
-                QynV0A[iHarm] += dSinA;
-            }
-
-            MA += multCorA;
-
-        }
-    }
+    // gain equalised, recentered V0 Q-vectors of the event, shared with the other tasks
+    fESEService->Process(fAOD, centrality);
+    fESEService->Publish(fAOD);
 
+    Double_t MC = fESEService->GetMultiplicity(AliESEqnService::kV0C);
+    Double_t MA = fESEService->GetMultiplicity(AliESEqnService::kV0A);
 
     for (Int_t iQn(0); iQn < 2; ++iQn){
-        QxnV0CEse[iQn] = QxnV0C[iQn] - fQnxV0Cm[iQn]->GetBinContent(SPCode+1);
-        QynV0CEse[iQn] = QynV0C[iQn] - fQnyV0Cm[iQn]->GetBinContent(SPCode+1);
+        Int_t iHarm = fESEService->GetHarmonicIndex(iQn+2);
+        QxnV0C[iQn] = fESEService->GetQx(AliESEqnService::kV0C, iHarm);
+        QynV0C[iQn] = fESEService->GetQy(AliESEqnService::kV0C, iHarm);
+        QxnV0A[iQn] = fESEService->GetQx(AliESEqnService::kV0A, iHarm);
+        QynV0A[iQn] = fESEService->GetQy(AliESEqnService::kV0A, iHarm);
 
-        QxnV0AEse[iQn] = QxnV0A[iQn] - fQnxV0Am[iQn]->GetBinContent(SPCode+1);
-        QynV0AEse[iQn] = QynV0A[iQn] - fQnyV0Am[iQn]->GetBinContent(SPCode+1);
+        QxnV0CEse[iQn] = fESEService->GetQxRecentered(AliESEqnService::kV0C, iHarm);
+        QynV0CEse[iQn] = fESEService->GetQyRecentered(AliESEqnService::kV0C, iHarm);
+        QxnV0AEse[iQn] = fESEService->GetQxRecentered(AliESEqnService::kV0A, iHarm);
+        QynV0AEse[iQn] = fESEService->GetQyRecentered(AliESEqnService::kV0A, iHarm);
 
         // recentering
         if (SPCode >88) { continue; }
-        QxnV0CCorr[iQn] = (QxnV0C[iQn] - fQnxV0Cm[iQn]->GetBinContent(SPCode+1))/fQnxV0Cs[iQn]->GetBinContent(SPCode+1);
-        QynV0CCorr[iQn] = (QynV0C[iQn] - fQnyV0Cm[iQn]->GetBinContent(SPCode+1))/fQnyV0Cs[iQn]->GetBinContent(SPCode+1);
-
-        QxnV0ACorr[iQn] = (QxnV0A[iQn] - fQnxV0Am[iQn]->GetBinContent(SPCode+1))/fQnxV0As[iQn]->GetBinContent(SPCode+1);
-        QynV0ACorr[iQn] = (QynV0A[iQn] - fQnyV0Am[iQn]->GetBinContent(SPCode+1))/fQnyV0As[iQn]->GetBinContent(SPCode+1);
+        QxnV0CCorr[iQn] = fESEService->GetQxRecentered(AliESEqnService::kV0C, iHarm, kTRUE);
+        QynV0CCorr[iQn] = fESEService->GetQyRecentered(AliESEqnService::kV0C, iHarm, kTRUE);
+        QxnV0ACorr[iQn] = fESEService->GetQxRecentered(AliESEqnService::kV0A, iHarm, kTRUE);
+        QynV0ACorr[iQn] = fESEService->GetQyRecentered(AliESEqnService::kV0A, iHarm, kTRUE);
     }
 
 
@@ -2105,19 +2065,13 @@ void AliAnalysisTaskESEFlow::ReducedqVectorsV0(const Float_t centrality,const In
     if(MC>0)
     {
         for(Int_t iHarm(0); iHarm < 2; ++iHarm)
-        {
-            Double_t dqnV0CEse = QxnV0CEse[iHarm]*QxnV0CEse[iHarm]+QynV0CEse[iHarm]*QynV0CEse[iHarm];
-            qnV0C[iHarm] = TMath::Sqrt(dqnV0CEse)/TMath::Sqrt(MC);
-        }
+            qnV0C[iHarm] = fESEService->Getqn(AliESEqnService::kV0C, fESEService->GetHarmonicIndex(iHarm+2));
         FillqnRedV0(centrality,"V0C");
     }
     if(MA>0)
     {
         for(Int_t iHarm(0); iHarm < 2; ++iHarm)
-        {
-            Double_t dqnV0AEse = QxnV0AEse[iHarm]*QxnV0AEse[iHarm]+QynV0AEse[iHarm]*QynV0AEse[iHarm];
-            qnV0A[iHarm] = TMath::Sqrt(dqnV0AEse)/TMath::Sqrt(MA);
-        }
+            qnV0A[iHarm] = fESEService->Getqn(AliESEqnService::kV0A, fESEService->GetHarmonicIndex(iHarm+2));
         FillqnRedV0(centrality,"V0A");
     }
 
@@ -2544,6 +2498,7 @@ Bool_t AliAnalysisTaskESEFlow::LoadV0Calibration()
     TList* listV0CalibRbr = nullptr;
 
     Int_t runno = fAOD->GetRunNumber();
+    if(runno==fV0CalibRun) { return kTRUE; }
 
     listV0CalibRbr = (TList*) fV0CalibList->FindObject(Form("%i",runno));
 
@@ -2566,6 +2521,13 @@ Bool_t AliAnalysisTaskESEFlow::LoadV0Calibration()
         fQnyV0As[i] = (TH1F*) listV0CalibRbr->FindObject(Form("hQy%iV0As",i+2));
     }
 
+    fESEService->SetChannelGains(fhV0Calib);
+    for (Int_t i(0);i<2;++i){
+        fESEService->SetRecentering(AliESEqnService::kV0C,i+2,fQnxV0Cm[i],fQnyV0Cm[i],fQnxV0Cs[i],fQnyV0Cs[i]);
+        fESEService->SetRecentering(AliESEqnService::kV0A,i+2,fQnxV0Am[i],fQnyV0Am[i],fQnxV0As[i],fQnyV0As[i]);
+    }
+    fV0CalibRun = runno;
+
     return kTRUE;
 }
 Bool_t AliAnalysisTaskESEFlow::LoadqSelection()
@@ -14,6 +14,8 @@
 
 #include "AliUniFlowCorrTask.h"
 
+class AliESEqnService;
+
 class AliAnalysisTaskESEFlow : public AliAnalysisTaskSE
 {
     public:
@@ -156,6 +158,8 @@ class AliAnalysisTaskESEFlow : public AliAnalysisTaskSE
 
         TH3F*                   fh3Weights; //!
         TH1F*                   fhV0Calib;  //!
+        AliESEqnService*        fESEService; //! V0 q2, q3 and percentiles, published in the event list (owned by it then)
+        Int_t                   fV0CalibRun; //! run of the loaded V0 calibration
         TH1F*                   fHistPDG; //!
 
         TFile*                  fFileTrackEff; //! NUE
@@ -442,7 +446,7 @@ class AliAnalysisTaskESEFlow : public AliAnalysisTaskSE
         std::vector<AliUniFlowCorrTask*>    fVecCorrTask;
 
 
-        ClassDef(AliAnalysisTaskESEFlow, 1);
+        ClassDef(AliAnalysisTaskESEFlow, 2);
 };
 
 #endif
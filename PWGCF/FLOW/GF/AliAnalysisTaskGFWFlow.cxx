@@ -377,7 +377,7 @@ void AliAnalysisTaskGFWFlow::UserExec(Option_t*) {
     };
     Bool_t filled;
     for(Int_t l_ind=0; l_ind<corrconfigs.size(); l_ind++) {
-      filled = FillFCs(corrconfigs.at(l_ind),l_Cent,0);//,DisableOL);
+      filled = FillFCs(corrconfigs.at(l_ind),corrplans.at(l_ind),l_Cent,0);
     };
     PostData(1,fFC);
     PostData(2,fMultiDist);
@@ -510,7 +510,7 @@ void AliAnalysisTaskGFWFlow::UserExec(Option_t*) {
     Double_t rndmn=rndm.Rndm();
     Bool_t filled;
     for(Int_t l_ind=0; l_ind<corrconfigs.size(); l_ind++) {
-      filled = FillFCs(corrconfigs.at(l_ind),cent,rndmn);//,DisableOL);
+      filled = FillFCs(corrconfigs.at(l_ind),corrplans.at(l_ind),cent,rndmn);
     };
     PostData(1,fFC);
     PostData(2,fMultiDist);
@@ -628,6 +628,7 @@ Bool_t AliAnalysisTaskGFWFlow::LoadWeights(Int_t runno) { //Cannot be used when
     };
     fWeights->CreateNUA();
     fWeights->CreateNUE();
+    fWeights->Freeze(); //Flat lookup tables for the event loop
     return kTRUE;
   } else {
     AliFatal("Weight list (for some reason) not set!\n");
@@ -714,25 +715,20 @@ Bool_t AliAnalysisTaskGFWFlow::FillFCs(TString head, TString hn, Double_t cent,
   };
   return kTRUE;
 };
-Bool_t AliAnalysisTaskGFWFlow::FillFCs(AliGFW::CorrConfig corconf, Double_t cent, Double_t rndmn, Bool_t DisableOverlap) {
+Bool_t AliAnalysisTaskGFWFlow::FillFCs(const AliGFW::CorrConfig &corconf, Int_t planHandle, Double_t cent, Double_t rndmn) {
   Double_t dnx, val;
-  dnx = fGFW->Calculate(corconf,0,kTRUE).Re();
+  dnx = fGFW->Calculate(planHandle,0,kTRUE).Re();
   if(dnx==0) return kFALSE;
   if(!corconf.pTDif) {
-    val = fGFW->Calculate(corconf,0,kFALSE).Re()/dnx;
+    val = fGFW->Calculate(planHandle,0,kFALSE).Re()/dnx;
     if(TMath::Abs(val)<1)
       fFC->FillProfile(corconf.Head.Data(),cent,val,dnx,rndmn);
     return kTRUE;
   };
-  /*Int_t binDisableOLFrom = fPtAxis->GetNbins()+1;
-  if(DisableOverlap)
-    binDisableOLFrom = fPtAxis->FindBin(fRFpTMax); //To stay in the right bin*/
-  Bool_t NeedToDisable=kFALSE;
   for(Int_t i=1;i<=fPtAxis->GetNbins();i++) {
-    //if(DisableOverlap) NeedToDisable=(i>=binDisableOLFrom);
-    dnx = fGFW->Calculate(corconf,i-1,kTRUE,NeedToDisable).Re();
+    dnx = fGFW->Calculate(planHandle,i-1,kTRUE).Re();
     if(dnx==0) continue;
-    val = fGFW->Calculate(corconf,i-1,kFALSE,NeedToDisable).Re()/dnx;
+    val = fGFW->Calculate(planHandle,i-1,kFALSE).Re()/dnx;
     if(TMath::Abs(val)<1)
       fFC->FillProfile(Form("%s_pt_%i",corconf.Head.Data(),i),cent,val,dnx,rndmn);
   };
@@ -812,5 +808,7 @@ void AliAnalysisTaskGFWFlow::CreateCorrConfigs() {
   corrconfigs.push_back(GetConf("MidGapNV52","poiGapNeg refGapNeg | olGapNeg {5} refGapPos {-5}", kTRUE));
   corrconfigs.push_back(GetConf("MidGapPV52","refGapPos {5} refGapNeg {-5}", kFALSE));
   corrconfigs.push_back(GetConf("MidGapPV52","poiGapPos refGapPos | olGapPos {5} refGapNeg {-5}", kTRUE));
-
+  //Compile all the correlators once, so that no parsing is done in the event loop
+  corrplans.clear();
+  for(Int_t i=0;i<(Int_t)corrconfigs.size();i++) corrplans.push_back(fGFW->CompileCorrelator(corrconfigs.at(i)));
 }
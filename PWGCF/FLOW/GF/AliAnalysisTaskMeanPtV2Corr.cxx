@@ -1105,6 +1105,7 @@ void AliAnalysisTaskMeanPtV2Corr::FillCK(AliAODEvent *fAOD, const Double_t &vz,
     if(!LoadMyWeights(fAOD->GetRunNumber())) return; //Only load wieghts for data
     Bool_t usingPseudoEff = (fPseudoEfficiency<1);
     nTotNoTracks=GetNtotTracks(fAOD,ptMin,ptMax,vtxp);
+    ClearGFWBatch();
     for(Int_t lTr=0;lTr<fAOD->GetNumberOfTracks();lTr++) {
       if(usingPseudoEff) if(fRndm->Uniform()>fPseudoEfficiency) continue;
       lTrack = (AliAODTrack*)fAOD->GetTrack(lTr);
@@ -1119,13 +1120,14 @@ void AliAnalysisTaskMeanPtV2Corr::FillCK(AliAODEvent *fAOD, const Double_t &vz,
       Double_t p1 = lTrack->Pt();
       Double_t weff = fEfficiencies[iCent]->GetBinContent(fEfficiencies[iCent]->FindBin(p1));
       if(weff==0) continue;
-      Double_t wacc = fWeights[0]->GetNUA(lTrack->Phi(),lTrack->Eta(),vz);
       weff = 1./weff;
       if(TMath::Abs(lTrack->Eta())<fEta)  { //for mean pt, only consider -0.4-0.4 region
         FillWPCounter(wp[0],weff,p1);
       }  //Actually, no need for if() statememnt now since GFW knows about eta's, so I can fill it all the time
-      fGFW->Fill(lTrack->Eta(),1,lTrack->Phi(),wacc*weff,3); //filling both gap (bit mask 1) and full (bit mas 2)
+      AddToGFWBatch(lTrack->Eta(),1,lTrack->Phi(),weff,3); //filling both gap (bit mask 1) and full (bit mas 2)
     };
+    ApplyNUAToGFWBatch(fWeights[0],vz); //NUA for all tracks at once
+    FillGFWBatch();
   };
   if(wp[0][0]==0) return; //if no single charged particles, then surely no PID either, no sense to continue
   fMultiVsV0MCorr[0]->Fill(l_Cent,nTotNoTracks);
@@ -1287,6 +1289,7 @@ void AliAnalysisTaskMeanPtV2Corr::CovSkipMpt(AliAODEvent *fAOD, const Double_t &
     if(!LoadMyWeights(fAOD->GetRunNumber())) return; //Only load wieghts for data
     Bool_t usingPseudoEff = (fPseudoEfficiency<1);
     nTotNoTracks=GetNtotTracks(fAOD,ptMin,ptMax,vtxp);
+    ClearGFWBatch();
     for(Int_t lTr=0;lTr<fAOD->GetNumberOfTracks();lTr++) {
       if(usingPseudoEff) if(fRndm->Uniform()>fPseudoEfficiency) continue;
       lTrack = (AliAODTrack*)fAOD->GetTrack(lTr);
@@ -1301,13 +1304,14 @@ void AliAnalysisTaskMeanPtV2Corr::CovSkipMpt(AliAODEvent *fAOD, const Double_t &
       Double_t p1 = lTrack->Pt();
       Double_t weff = fEfficiencies[iCent]->GetBinContent(fEfficiencies[iCent]->FindBin(p1));
       if(weff==0) continue;
-      Double_t wacc = fWeights[0]->GetNUA(lTrack->Phi(),lTrack->Eta(),vz);
       weff = 1./weff;
       if(TMath::Abs(lTrack->Eta())<fEta)  { //for mean pt, only consider -0.4-0.4 region
         FillWPCounter(wp,weff,p1);
       }  //Actually, no need for if() statememnt now since GFW knows about eta's, so I can fill it all the time
-      fGFW->Fill(lTrack->Eta(),1,lTrack->Phi(),wacc*weff,3); //filling both gap (bit mask 1) and full (bit mas 2)
+      AddToGFWBatch(lTrack->Eta(),1,lTrack->Phi(),weff,3); //filling both gap (bit mask 1) and full (bit mas 2)
     };
+    ApplyNUAToGFWBatch(fWeights[0],vz); //NUA for all tracks at once
+    FillGFWBatch();
   };
   if(wp[0]==0) return; //if no single charged particles, then surely no PID either, no sense to continue
   fMultiVsV0MCorr[0]->Fill(l_Cent,nTotNoTracks);
@@ -1515,8 +1519,14 @@ Bool_t AliAnalysisTaskMeanPtV2Corr::LoadMyWeights(const Int_t &lRunNo) {
   fWeights[0] = (AliGFWWeights*)fWeightList->FindObject(lBase.Data());
   if(!fWeights[0]) AliFatal(Form("Weights %s not not found in the list provided!\n",lBase.Data()));
   fWeights[0]->CreateNUA();
+  fWeights[0]->Freeze(); //Flat lookup tables for the event loop
   return kTRUE;
 }
+void AliAnalysisTaskMeanPtV2Corr::ApplyNUAToGFWBatch(AliGFWWeights *inWeights, Double_t vz) {
+  fBatchNUA.resize(fBatchPhi.size());
+  inWeights->GetNUA((Int_t)fBatchPhi.size(),fBatchPhi.data(),fBatchEta.data(),vz,fBatchNUA.data());
+  for(Int_t i=0;i<(Int_t)fBatchNUA.size();i++) fBatchWeight[i]*=fBatchNUA[i];
+}
 Double_t AliAnalysisTaskMeanPtV2Corr::GetMyWeight(Double_t eta, Double_t phi, Int_t pidind) {
   Int_t etaind = fNUAHist[pidind]->GetXaxis()->FindBin(eta);
   Int_t phiind = fNUAHist[pidind]->GetYaxis()->FindBin(phi);
@@ -150,6 +150,17 @@ class AliAnalysisTaskMeanPtV2Corr : public AliAnalysisTaskSE {
   AliGFWFlowContainer *fFC;
   AliGFW *fGFW; //! not stored
   vector<AliGFW::CorrConfig> corrconfigs; //! do not store
+  //Per-event track arrays for the batched AliGFW::Fill
+  vector<Double_t> fBatchEta; //! do not store
+  vector<Int_t> fBatchPtInd; //! do not store
+  vector<Double_t> fBatchPhi; //! do not store
+  vector<Double_t> fBatchWeight; //! do not store
+  vector<Int_t> fBatchMask; //! do not store
+  vector<Double_t> fBatchNUA; //! do not store
+  void ClearGFWBatch() { fBatchEta.clear(); fBatchPtInd.clear(); fBatchPhi.clear(); fBatchWeight.clear(); fBatchMask.clear(); };
+  void AddToGFWBatch(Double_t eta, Int_t ptind, Double_t phi, Double_t weight, Int_t mask) { fBatchEta.push_back(eta); fBatchPtInd.push_back(ptind); fBatchPhi.push_back(phi); fBatchWeight.push_back(weight); fBatchMask.push_back(mask); };
+  void ApplyNUAToGFWBatch(AliGFWWeights *inWeights, Double_t vz);
+  void FillGFWBatch() { fGFW->Fill((Int_t)fBatchEta.size(),fBatchEta.data(),fBatchPtInd.data(),fBatchPhi.data(),fBatchWeight.data(),fBatchMask.data()); };
   TList *fEfficiencyList;
   TH2D **fEfficiency; //TH2Ds for efficiency calculation
   TH1D **fEfficiencies; //TH1Ds for picking up efficiencies
@@ -221,6 +221,13 @@ AliAnalysisTaskUniFlow::AliAnalysisTaskUniFlow() : AliAnalysisTaskSE(),
   fCutChargedNumTPCclsMin{70},
   fCutChargedDCAzMax{0.0},
   fCutChargedDCAxyMax{0.0},
+  fVarChargedTrackFilterBit{},
+  fVarChargedNumTPCclsMin{},
+  fVarChargedDCAzMax{},
+  fVarChargedDCAxyMax{},
+  fVarCurrent{-1},
+  fVarCandidates{},
+  fVarCandMask{},
   fCutPIDUseAntiProtonOnly{kFALSE},
   fCutPIDnSigmaCombinedTOFrejection{kTRUE},
   fCutUseBayesPID{kFALSE},
@@ -523,6 +530,13 @@ AliAnalysisTaskUniFlow::AliAnalysisTaskUniFlow(const char* name, ColSystem colSy
   fCutChargedNumTPCclsMin{70},
   fCutChargedDCAzMax{0.0},
   fCutChargedDCAxyMax{0.0},
+  fVarChargedTrackFilterBit{},
+  fVarChargedNumTPCclsMin{},
+  fVarChargedDCAzMax{},
+  fVarChargedDCAxyMax{},
+  fVarCurrent{-1},
+  fVarCandidates{},
+  fVarCandMask{},
   fCutPIDUseAntiProtonOnly{kFALSE},
   fCutPIDnSigmaCombinedTOFrejection{kTRUE},
   fCutUseBayesPID{kFALSE},
@@ -874,6 +888,9 @@ void AliAnalysisTaskUniFlow::ListParameters() const
   printf("      fCutChargedNumTPCclsMin: (UShort_t) %d\n",    fCutChargedNumTPCclsMin);
   printf("      fCutChargedDCAzMax: (Double_t) %g (cm)\n",    fCutChargedDCAzMax);
   printf("      fCutChargedDCAxyMax: (Double_t) %g (cm)\n",    fCutChargedDCAxyMax);
+  for(Size_t iVar(0); iVar < fVarChargedTrackFilterBit.size(); ++iVar) {
+    printf("      charged variation %d: FB %d, TPC-cls %d, DCA-z %g (cm), DCA-xy %g (cm)\n", (Int_t) iVar+1, fVarChargedTrackFilterBit[iVar], fVarChargedNumTPCclsMin[iVar], fVarChargedDCAzMax[iVar], fVarChargedDCAxyMax[iVar]);
+  }
   printf("   -------- PID (pi,K,p) tracks ---------------------------------\n");
   printf("      fCutPIDUseAntiProtonOnly: (Bool_t) %s\n",  fCutPIDUseAntiProtonOnly ? "kTRUE" : "kFALSE");
   printf("      fCutPIDnSigmaCombinedTOFrejection: (Bool_t) %s\n",  fCutPIDnSigmaCombinedTOFrejection ? "kTRUE" : "kFALSE");
@@ -1203,6 +1220,8 @@ void AliAnalysisTaskUniFlow::UserExec(Option_t *)
   // NB: clear charged vectors because it might keep particles from previous event (not happen for other species)
   fVector[kRefs]->clear();
   fVector[kCharged]->clear();
+  fVarCandidates.clear();
+  fVarCandMask.clear();
 
   if(fAnalType != kMC) FilterCharged();
   else FilterChargedMC();
@@ -1215,10 +1234,7 @@ void AliAnalysisTaskUniFlow::UserExec(Option_t *)
   }
 
   // checking if there is at least 4/6/8 particles: needed to "properly" calculate correlations
-  UInt_t minNOfPar = 4;
-  if(fColSystem == kPbPb) minNOfPar = 8;
-  if(fUseGeneralFormula) minNOfPar = 12;
-  if(fVector[kRefs]->size() <= minNOfPar) { return; }
+  if(fVector[kRefs]->size() <= GetMinNumberOfRefs()) { return; }
 
   // estimate centrality & assign indexes (centrality/percentile, sampling, ...)
   if(fCentEstimator == kRFP) {
@@ -1760,19 +1776,32 @@ void AliAnalysisTaskUniFlow::ProcessMC() const
     }
 }
 // ============================================================================
-void AliAnalysisTaskUniFlow::FilterCharged() const
+void AliAnalysisTaskUniFlow::FilterCharged()
 {
   // Filtering input charged tracks for POIs (stored in fVector[kCharged]) or RFPs (fVector[kRefs])
   // If track passes all requirements its pointer is pushed to relevant vector container
+  // If charged cut variations are set, tracks passing any of them are cached with the bitmask of passed variations
   // *************************************************************
 
   Int_t iNumTracks = fEvent->GetNumberOfTracks();
   if(iNumTracks < 1) { return; }
 
+  Bool_t bVariations = !fVarChargedTrackFilterBit.empty();
+
   for(Int_t iTrack(0); iTrack < iNumTracks; iTrack++) {
     AliAODTrack* track = static_cast<AliAODTrack*>(fEvent->GetTrack(iTrack));
     if(!track) { continue; }
 
+    if(bVariations) {
+      UInt_t mask = GetChargedVariationMask(track);
+      if(mask) {
+        if(IsWithinRefs(track)) { mask |= (1u << fVarNumMax); }
+        if(IsWithinPOIs(track)) { mask |= (1u << (fVarNumMax+1)); }
+        fVarCandidates.push_back(track);
+        fVarCandMask.push_back(mask);
+      }
+    }
+
     // passing reconstruction criteria
     if(!IsChargedSelected(track)) { continue; }
 
@@ -1863,6 +1892,40 @@ Bool_t AliAnalysisTaskUniFlow::IsChargedSelected(const AliAODTrack* track) const
   return kTRUE;
 }
 // ============================================================================
+UInt_t AliAnalysisTaskUniFlow::GetChargedVariationMask(const AliAODTrack* track) const
+{
+  // Evaluates all charged cut variations for given track at once
+  // returns bitmask with bit iVar set if track passes variation iVar
+  // *************************************************************
+  if(!track) { return 0; }
+
+  // track DCA coordinates (computed once for all variations)
+  Double_t dDCAz = 0.0;
+  Double_t dDCAxy = 0.0;
+  const AliAODVertex* vertex = fEventAOD->GetPrimaryVertex();
+  if(vertex) {
+    Double_t dTrackXYZ[3] = {0.,0.,0.};
+    Double_t dVertexXYZ[3] = {0.,0.,0.};
+    track->GetXYZ(dTrackXYZ);
+    vertex->GetXYZ(dVertexXYZ);
+    dDCAz = TMath::Abs(dTrackXYZ[2] - dVertexXYZ[2]);
+    dDCAxy = TMath::Sqrt((dTrackXYZ[0] - dVertexXYZ[0])*(dTrackXYZ[0] - dVertexXYZ[0]) + (dTrackXYZ[1] - dVertexXYZ[1])*(dTrackXYZ[1] - dVertexXYZ[1]));
+  }
+
+  UInt_t mask = 0;
+  Int_t iNumVar = fVarChargedTrackFilterBit.size();
+  for(Int_t iVar(0); iVar < iNumVar; ++iVar) {
+    if(!track->TestFilterBit(fVarChargedTrackFilterBit[iVar])) { continue; }
+    if(track->GetTPCNcls() < fVarChargedNumTPCclsMin[iVar] && fVarChargedTrackFilterBit[iVar] != 2) { continue; }
+    if((fVarChargedDCAzMax[iVar] > 0. || fVarChargedDCAxyMax[iVar] > 0.) && !vertex) { continue; }
+    if(fVarChargedDCAzMax[iVar] > 0. && dDCAz > fVarChargedDCAzMax[iVar]) { continue; }
+    if(fVarChargedDCAxyMax[iVar] > 0. && dDCAxy > fVarChargedDCAxyMax[iVar]) { continue; }
+    mask |= (1u << iVar);
+  }
+
+  return mask;
+}
+// ============================================================================
 Bool_t AliAnalysisTaskUniFlow::IsWithinRefs(const AliVParticle* track) const
 {
   // Checking if (preselected) track fulfills acceptance criteria for RFPs
@@ -3413,7 +3476,7 @@ Bool_t AliAnalysisTaskUniFlow::ProcessCorrTask(const AliUniFlowCorrTask* task, c
               if(iNumHarm > 12) CalculateCorrelations(fVecCorrTask.at(iTask-6), kRefs);
               if(iNumHarm > 14) CalculateCorrelations(fVecCorrTask.at(iTask-7), kRefs);
             }
-            if(fCorrUsingGF) {
+            if(fCorrUsingGF && fVarCurrent < 0) {
               CalculateDihCorr(task);
               if(fCorrFill) CalculateDihCorrMixed(task);
             }
@@ -3424,6 +3487,9 @@ Bool_t AliAnalysisTaskUniFlow::ProcessCorrTask(const AliUniFlowCorrTask* task, c
         if(!task->fbDoPOIs) { continue; }
         if(!fProcessSpec[iSpec]) { continue; }
 
+        // charged cut variations: only charged POIs are varied
+        if(fVarCurrent >= 0 && iSpec != kCharged) { continue; }
+
         if(iSpec == kCharUnidentified) { continue; }
 
         if(fPIDonlyForRefs && (iSpec == kPion || iSpec == kKaon || iSpec == kProton)) { continue; }
@@ -4112,6 +4178,20 @@ Bool_t AliAnalysisTaskUniFlow::CalculateFlow()
   // if running in kSkipFlow mode, skip the remaining part
   if(fRunMode == kSkipFlow) { fEventCounter++; return kTRUE; }
 
+  if(!ProcessCorrTasks()) { return kFALSE; }
+  if(!CalculateFlowVariations()) { return kFALSE; }
+
+  fEventCounter++; // counter of processed events
+
+  return kTRUE;
+}
+// ============================================================================
+Bool_t AliAnalysisTaskUniFlow::ProcessCorrTasks()
+{
+  // processing all AliUniFlowCorrTask with current content of particle vectors
+  // returns kFALSE if something failes (with error), kTRUE otherwise
+  // *************************************************************
+
   // >>>> Using AliUniFlowCorrTask <<<<<
 
   Int_t iNumTasks = fVecCorrTask.size();
@@ -4142,11 +4222,62 @@ Bool_t AliAnalysisTaskUniFlow::CalculateFlow()
     doLowerOrder = kFALSE;
   }
 
-  fEventCounter++; // counter of processed events
-
   return kTRUE;
 }
 // ============================================================================
+Bool_t AliAnalysisTaskUniFlow::CalculateFlowVariations()
+{
+  // calculating Refs & charged POIs correlations for each charged cut variation
+  // particles are taken from the cache filled in FilterCharged(), so event & track decoding is done only once;
+  // other species (PID, V0s, Phi) are not varied; event class (centrality, sampling) is the nominal one
+  // *************************************************************
+  Int_t iNumVar = fVarChargedTrackFilterBit.size();
+  if(iNumVar < 1 || fAnalType == kMC) { return kTRUE; }
+
+  std::vector<AliVParticle*>* nominalVector[2] = { fVector[kRefs], fVector[kCharged] };
+  TList* nominalList[2] = { fListFlow[kRefs], fListFlow[kCharged] };
+
+  Bool_t bOK = kTRUE;
+  for(Int_t iVar(0); iVar < iNumVar && bOK; ++iVar) {
+    fVarVector[kRefs].clear();
+    fVarVector[kCharged].clear();
+    for(Size_t iCand(0); iCand < fVarCandidates.size(); ++iCand) {
+      UInt_t mask = fVarCandMask[iCand];
+      if(!(mask & (1u << iVar))) { continue; }
+      if(mask & (1u << fVarNumMax)) { fVarVector[kRefs].push_back(fVarCandidates[iCand]); }
+      if(mask & (1u << (fVarNumMax+1))) { fVarVector[kCharged].push_back(fVarCandidates[iCand]); }
+    }
+    if(fVarVector[kRefs].size() <= GetMinNumberOfRefs()) { continue; }
+    std::sort(fVarVector[kCharged].begin(), fVarVector[kCharged].end(), [this](const AliVParticle* a, const AliVParticle* b){ return this->sortPt(a, b); });
+
+    fVarCurrent = iVar;
+    fVector[kRefs] = &fVarVector[kRefs];
+    fVector[kCharged] = &fVarVector[kCharged];
+    fListFlow[kRefs] = fVarListFlow[kRefs][iVar];
+    fListFlow[kCharged] = fVarListFlow[kCharged][iVar];
+
+    bOK = ProcessCorrTasks();
+
+    fVector[kRefs] = nominalVector[kRefs];
+    fVector[kCharged] = nominalVector[kCharged];
+    fListFlow[kRefs] = nominalList[kRefs];
+    fListFlow[kCharged] = nominalList[kCharged];
+    fVarCurrent = -1;
+  }
+
+  return bOK;
+}
+// ============================================================================
+UInt_t AliAnalysisTaskUniFlow::GetMinNumberOfRefs() const
+{
+  // minimal number of RFPs (exclusive) needed to "properly" calculate correlations (4/8/12 particles)
+  // *************************************************************
+  UInt_t minNOfPar = 4;
+  if(fColSystem == kPbPb) minNOfPar = 8;
+  if(fUseGeneralFormula) minNOfPar = 12;
+  return minNOfPar;
+}
+// ============================================================================
 void AliAnalysisTaskUniFlow::FillFlowQVectorsForDih(const Double_t dWeight, const Double_t dPhi, const Double_t dEta, const Int_t harm)
 {
   // Filling Q flow vector with RFPs for dihadron correlation study
@@ -5389,6 +5520,17 @@ void AliAnalysisTaskUniFlow::AddCorr(std::vector<Int_t> harms, std::vector<Doubl
     fVecCorrTask.push_back(new AliUniFlowCorrTask(doRFPs, doPOIs, harms, gaps, maxPowVec));
 }
 // ============================================================================
+void AliAnalysisTaskUniFlow::AddChargedCutVariation(UInt_t filter, UShort_t tpcCls, Double_t dcaz, Double_t dcaxy)
+{
+    // adding charged track selection evaluated on top of the nominal one in the same pass;
+    // Refs & charged POIs correlations for variation i are stored in sub-lists 'var<i>' of the flow lists
+    if((Int_t) fVarChargedTrackFilterBit.size() >= fVarNumMax) { AliError(Form("Maximum number of charged cut variations (%d) reached!",fVarNumMax)); return; }
+    fVarChargedTrackFilterBit.push_back(filter);
+    fVarChargedNumTPCclsMin.push_back(tpcCls);
+    fVarChargedDCAzMax.push_back(dcaz);
+    fVarChargedDCAxyMax.push_back(dcaxy);
+}
+// ============================================================================
 void AliAnalysisTaskUniFlow::Terminate(Option_t* option)
 {
   // called on end of task, after all events are processed
@@ -7305,6 +7447,28 @@ void AliAnalysisTaskUniFlow::UserCreateOutputObjects()
       } // end-for {iSpec}
     } // end-for {iTask}
 
+    // cloning (empty) Refs & charged profiles for each charged cut variation
+    // NB: clones keep the original names, as they are searched by name while filling
+    for(Int_t iSpec(kRefs); iSpec <= kCharged; ++iSpec) {
+      fVarListFlow[iSpec].clear();
+      if(!fListFlow[iSpec]) { continue; }
+      for(Size_t iVar(0); iVar < fVarChargedTrackFilterBit.size(); ++iVar) {
+        TList* listVar = new TList();
+        listVar->SetOwner(kTRUE);
+        listVar->SetName(Form("var%d",(Int_t) iVar+1));
+        TIter next(fListFlow[iSpec]);
+        while(TObject* obj = next()) {
+          if(!obj->InheritsFrom("TProfile") && !obj->InheritsFrom("TProfile2D") && !obj->InheritsFrom("TProfile3D")) { continue; }
+          TH1* clone = (TH1*) obj->Clone();
+          clone->SetDirectory(0);
+          clone->Reset();
+          listVar->Add(clone);
+        }
+        fVarListFlow[iSpec].push_back(listVar);
+      }
+      for(auto listVar : fVarListFlow[iSpec]) { fListFlow[iSpec]->Add(listVar); }
+    }
+
     // Making THnSparse distribution of candidates
     // species independent
 
@@ -117,6 +117,7 @@ class AliAnalysisTaskUniFlow : public AliAnalysisTaskSE
       void                    SetChargedDCAxyMax(Double_t dcaxy) {  fCutChargedDCAxyMax = dcaxy; }
       void                    SetChargedNumTPCclsMin(UShort_t tpcCls) { fCutChargedNumTPCclsMin = tpcCls; }
       void                    SetChargedTrackFilterBit(UInt_t filter) { fCutChargedTrackFilterBit = filter; }
+      void                    AddChargedCutVariation(UInt_t filter, UShort_t tpcCls, Double_t dcaz, Double_t dcaxy); // systematics: extra charged selection evaluated in the same pass (Refs & charged POIs only)
       // PID (pi,K,p) setters
       void                    SetPIDUseAntiProtonOnly(Bool_t use = kTRUE) { fCutPIDUseAntiProtonOnly = use; }
       void                    SetPIDNumSigmasPionMax(Float_t numSigmas) { fCutPIDnSigmaMax[kPion] = numSigmas; }
@@ -191,6 +192,7 @@ class AliAnalysisTaskUniFlow : public AliAnalysisTaskSE
       static const Int_t      fFlowNumHarmonicsMax = 25; // maximum harmonics length of flow vector array
       static const Int_t      fFlowNumWeightPowersMax = 17; // maximum weight power length of flow vector array
       static const Int_t      fFlowBinNumberEtaSlices = 32; // number of eta bin slices (for correlation study)
+      static const Int_t      fVarNumMax = 30; // maximum number of charged cut variations (bits 30,31 of the mask are Refs/POIs acceptance)
 
       const char*             GetSpeciesName(PartSpecies species) const;
       const char*             GetSpeciesName(Int_t species) const { return GetSpeciesName(PartSpecies(species)); }
@@ -218,7 +220,7 @@ class AliAnalysisTaskUniFlow : public AliAnalysisTaskSE
       const char*             GetCentEstimatorLabel(CentEst est) const; // returns mult/cent estimator string with label or 'n/a' if not available
 
       void                    ProcessMC() const; // processing MC generated particles
-      void                    FilterCharged() const; // charged tracks filtering
+      void                    FilterCharged(); // charged tracks filtering (+ bitmask of passed cut variations)
       void                    FilterChargedMC() const; // charged tracks filtering
       void                    FilterPID() const; // pi,K,p filtering
       void                    FilterV0s() const; // K0s, Lambda, ALambda filtering
@@ -227,6 +229,9 @@ class AliAnalysisTaskUniFlow : public AliAnalysisTaskSE
       void                    CalculateCorrelations(const AliUniFlowCorrTask* task, PartSpecies species, Double_t dPt = -1.0, Double_t dMass = -1.0) const; // wrapper for correlations methods
       Bool_t                  ProcessCorrTask(const AliUniFlowCorrTask* task, const Int_t iTask, Bool_t doLowerOrder); // procesisng of AliUniFlowCorrTask
       Bool_t                  CalculateFlow(); // main (envelope) method for flow calculations in selected events
+      Bool_t                  ProcessCorrTasks(); // loop over all AliUniFlowCorrTask for current particle vectors
+      Bool_t                  CalculateFlowVariations(); // re-run correlations for each charged cut variation from cached tracks
+      UInt_t                  GetMinNumberOfRefs() const; // minimal number of RFPs needed to calculate correlations
 
       AliAODMCParticle*       GetMCParticle(Int_t label) const; // find corresponding MC particle from fArrayMC depending of AOD track label
       Bool_t                  CheckMCPDG(const AliVParticle* track, const Int_t iPDGCode) const; // check if track has an associated MC particle which is the same species
@@ -240,6 +245,7 @@ class AliAnalysisTaskUniFlow : public AliAnalysisTaskSE
       Bool_t                  IsWithinRefs(const AliVParticle* track) const; // check if track is in (pt,eta) acceptance for Refs (used for refs selection & autocorelations)
       Bool_t                  IsWithinPOIs(const AliVParticle* track) const; // check if track is in (pt,eta) acceptance for POIs
       Bool_t                  IsChargedSelected(const AliAODTrack* track) const; // charged track selection
+      UInt_t                  GetChargedVariationMask(const AliAODTrack* track) const; // bitmask of charged cut variations passed by track
       PartSpecies             IsPIDSelected(AliVParticle* track) const; // PID tracks selections
       PartSpecies             IsPIDSelectedMC(AliVParticle* track) const; // PID tracks selections
       Bool_t                  IsV0Selected(const AliAODv0* v0) const; // general (common) V0 selection
@@ -449,6 +455,15 @@ class AliAnalysisTaskUniFlow : public AliAnalysisTaskSE
       UShort_t                fCutChargedNumTPCclsMin;  // (-) Minimal number of TPC clusters used for track reconstruction
       Double_t                fCutChargedDCAzMax; // (cm) Maximal DCA-z cuts for tracks (pile-up rejection suggested for LHC16)
       Double_t                fCutChargedDCAxyMax; // (cm) Maximal DCA-xy cuts for tracks (pile-up rejection suggested for LHC16)
+      std::vector<UInt_t>     fVarChargedTrackFilterBit; // (-) filter bit per charged cut variation
+      std::vector<UShort_t>   fVarChargedNumTPCclsMin; // (-) minimal number of TPC clusters per charged cut variation
+      std::vector<Double_t>   fVarChargedDCAzMax; // (cm) maximal DCA-z per charged cut variation (<= 0 : no cut)
+      std::vector<Double_t>   fVarChargedDCAxyMax; // (cm) maximal DCA-xy per charged cut variation (<= 0 : no cut)
+      Int_t                   fVarCurrent; //! charged cut variation being processed (-1 : nominal)
+      std::vector<AliVParticle*> fVarCandidates; //! charged tracks passing at least one cut variation
+      std::vector<UInt_t>     fVarCandMask; //! bitmask of passed variations (+ Refs/POIs acceptance) per candidate
+      std::vector<AliVParticle*> fVarVector[2]; //! Refs & charged POIs of the variation being processed
+      std::vector<TList*>     fVarListFlow[2]; //! flow lists of Refs & charged POIs per variation (owned by fListFlow)
       // cuts & selection: PID selection
       Bool_t                  fCutPIDUseAntiProtonOnly; // [kFALSE] check proton PID charge to select AntiProtons only
       Bool_t                  fCutPIDnSigmaCombinedTOFrejection; // [kTRUE] flag for rejection candidates in TPC+TOF pt region if TOF is not available (if true and no TOF track is skipped, otherwise only TPC is used)
@@ -667,7 +682,7 @@ class AliAnalysisTaskUniFlow : public AliAnalysisTaskSE
       TH2D*			  		  fhQAV0sArmenterosLambda[QAindex::kNumQA];	//! Armenteros-Podolanski plot for Lambda candidates
       TH2D*			  		  fhQAV0sArmenterosALambda[QAindex::kNumQA];	//! Armenteros-Podolanski plot for ALambda candidates
 
-      ClassDef(AliAnalysisTaskUniFlow, 28);
+      ClassDef(AliAnalysisTaskUniFlow, 29);
 };
 
 #endif
@@ -0,0 +1,189 @@
+/*
+Reduced flow vectors q_n of the VZERO for event-shape engineering, see header
+*/
+#include "AliESEqnService.h"
+#include "AliVEvent.h"
+#include "AliVHeader.h"
+#include "AliVVZERO.h"
+#include "TH1.h"
+#include "TH2.h"
+#include "TSpline.h"
+#include "TMath.h"
+#include <cstring>
+AliESEqnService::AliESEqnService(const char *name):
+  TNamed(name,name),
+  fNHarmonics(0),
+  fEventKey(0),
+  fHasEvent(kFALSE),
+  fCentClass(-1)
+{
+  for(Int_t i=0;i<kNChannels;i++) fGainFactor[i]=1.;
+  for(Int_t i=0;i<kNSlots;i++) { fPercNq[i]=0; fQx[i]=0; fQy[i]=0; fqn[i]=-1; fPercentile[i]=-1; };
+  for(Int_t i=0;i<kNDetectors;i++) fMult[i]=0;
+};
+AliESEqnService::~AliESEqnService()
+{
+};
+AliESEqnService *AliESEqnService::Find(AliVEvent *ev, const char *name) {
+  if(!ev) return 0;
+  return dynamic_cast<AliESEqnService*>(ev->FindListObject(name));
+};
+void AliESEqnService::Publish(AliVEvent *ev) {
+  if(ev && !ev->FindListObject(GetName())) ev->AddObject(this);
+};
+Int_t AliESEqnService::AddHarmonic(Int_t n) {
+  Int_t ih = GetHarmonicIndex(n);
+  if(ih>=0) return ih;
+  if(fNHarmonics>=kMaxHarmonics) { printf("AliESEqnService: at most %i harmonics\n",kMaxHarmonics); return -1; };
+  ih = fNHarmonics++;
+  fHarmonics[ih] = n;
+  for(Int_t j=0;j<8;j++) {
+    Double_t phi = TMath::PiOver4()*(0.5+j);
+    fCos[ih][j] = TMath::Cos(n*phi);
+    fSin[ih][j] = TMath::Sin(n*phi);
+  };
+  fHasEvent=kFALSE;
+  return ih;
+};
+Int_t AliESEqnService::GetHarmonicIndex(Int_t n) const {
+  for(Int_t i=0;i<fNHarmonics;i++) if(fHarmonics[i]==n) return i;
+  return -1;
+};
+Int_t AliESEqnService::SlotOf(Int_t det, Int_t n) {
+  if(det<0 || det>=kNDetectors) return -1;
+  Int_t ih = AddHarmonic(n);
+  return (ih<0)?-1:Slot(det,ih);
+};
+void AliESEqnService::SetChannelGains(const TH1 *gains) {
+  //multiplicities are equalised to the first channel of each ring, mult*gain(ring)/gain(channel)
+  for(Int_t ch=0;ch<kNChannels;ch++) {
+    Double_t g = gains?gains->GetBinContent(ch+1):1.;
+    Double_t gRing = gains?gains->GetBinContent(8*(ch/8)+1):1.;
+    fGainFactor[ch] = (g>0)?gRing/g:0.;
+  };
+  fHasEvent=kFALSE;
+};
+void AliESEqnService::SetRecentering(Int_t det, Int_t n, const TH1 *meanX, const TH1 *meanY, const TH1 *sigmaX, const TH1 *sigmaY) {
+  Int_t s = SlotOf(det,n);
+  if(s<0) return;
+  const TH1 *hists[] = {meanX,meanY,sigmaX,sigmaY};
+  std::vector<Double_t> *targets[] = {&fMeanX[s],&fMeanY[s],&fSigmaX[s],&fSigmaY[s]};
+  for(Int_t i=0;i<4;i++) {
+    targets[i]->clear();
+    if(!hists[i]) continue;
+    targets[i]->resize(hists[i]->GetNbinsX());
+    for(Int_t b=0;b<hists[i]->GetNbinsX();b++) (*targets[i])[b] = hists[i]->GetBinContent(b+1);
+  };
+  fHasEvent=kFALSE;
+};
+void AliESEqnService::SetPercentileMap(Int_t det, Int_t n, const TH2 *map, Double_t scale) {
+  Int_t s = SlotOf(det,n);
+  if(s<0) return;
+  fPercQMin[s].clear(); fPercInvStep[s].clear(); fPercValues[s].clear(); fPercNq[s]=0;
+  if(!map) return;
+  Int_t nCent = map->GetNbinsX();
+  Int_t nq = map->GetNbinsY();
+  const TAxis *ax = map->GetYaxis();
+  fPercNq[s] = nq;
+  fPercQMin[s].assign(nCent,ax->GetBinCenter(1));
+  fPercInvStep[s].assign(nCent,1./ax->GetBinWidth(1));
+  fPercValues[s].resize(nCent*nq);
+  for(Int_t ic=0;ic<nCent;ic++)
+    for(Int_t iq=0;iq<nq;iq++) fPercValues[s][ic*nq+iq] = scale*map->GetBinContent(ic+1,iq+1);
+  fHasEvent=kFALSE;
+};
+void AliESEqnService::SetPercentileSplines(Int_t det, Int_t n, Int_t nCent, TSpline3 **splines, Double_t scale, Int_t nPoints) {
+  Int_t s = SlotOf(det,n);
+  if(s<0) return;
+  fPercQMin[s].clear(); fPercInvStep[s].clear(); fPercValues[s].clear(); fPercNq[s]=0;
+  if(!splines || nPoints<2) return;
+  fPercNq[s] = nPoints;
+  fPercQMin[s].assign(nCent,0.);
+  fPercInvStep[s].assign(nCent,0.);
+  fPercValues[s].assign(nCent*nPoints,-1.);
+  for(Int_t ic=0;ic<nCent;ic++) {
+    TSpline3 *sp = splines[ic];
+    if(!sp) continue; //inverse step 0 marks a missing class
+    Double_t qmin = sp->GetXmin(), qmax = sp->GetXmax();
+    if(qmax<=qmin) continue;
+    Double_t step = (qmax-qmin)/(nPoints-1);
+    fPercQMin[s][ic] = qmin;
+    fPercInvStep[s][ic] = 1./step;
+    for(Int_t iq=0;iq<nPoints;iq++) fPercValues[s][ic*nPoints+iq] = scale*sp->Eval(qmin+iq*step);
+  };
+  fHasEvent=kFALSE;
+};
+void AliESEqnService::ClearCalibration() {
+  SetChannelGains(0);
+  for(Int_t s=0;s<kNSlots;s++) {
+    fMeanX[s].clear(); fMeanY[s].clear(); fSigmaX[s].clear(); fSigmaY[s].clear();
+    fPercQMin[s].clear(); fPercInvStep[s].clear(); fPercValues[s].clear(); fPercNq[s]=0;
+  };
+  fHasEvent=kFALSE;
+};
+Double_t AliESEqnService::RecenteringValue(const std::vector<Double_t> &v, Double_t def) const {
+  if(fCentClass<0 || fCentClass>=(Int_t)v.size()) return def;
+  return v[fCentClass];
+};
+Double_t AliESEqnService::LookupPercentile(Int_t s, Double_t q) const {
+  //linear interpolation in the table of the centrality class, q outside of the table is clamped to its range
+  Int_t nq = fPercNq[s];
+  if(nq==0 || fCentClass<0 || fCentClass>=(Int_t)fPercQMin[s].size() || fPercInvStep[s][fCentClass]==0) return -1;
+  Double_t t = (q-fPercQMin[s][fCentClass])*fPercInvStep[s][fCentClass];
+  const Double_t *v = &fPercValues[s][fCentClass*nq];
+  if(t<=0) return v[0];
+  if(t>=nq-1) return v[nq-1];
+  Int_t i = (Int_t)t;
+  t-=i;
+  return v[i]+t*(v[i+1]-v[i]);
+};
+Bool_t AliESEqnService::Process(AliVEvent *ev, Double_t centrality) {
+  if(!ev) return kFALSE;
+  //same event as before: run, event id, number of tracks and centrality
+  ULong64_t key = ev->GetHeader()?ev->GetHeader()->GetEventIdAsLong():0;
+  Float_t fcent = centrality;
+  UInt_t centBits;
+  memcpy(&centBits,&fcent,sizeof(centBits));
+  key ^= ((ULong64_t)ev->GetRunNumber()<<40) ^ ((ULong64_t)ev->GetNumberOfTracks()<<20) ^ ((ULong64_t)centBits<<8);
+  if(fHasEvent && key==fEventKey) return kTRUE;
+  AliVVZERO *vzero = ev->GetVZEROData();
+  if(!vzero) return kFALSE;
+  fEventKey = key;
+  fHasEvent = kTRUE;
+  fCentClass = (centrality>=0)?(Int_t)centrality:-1;
+  for(Int_t s=0;s<kNSlots;s++) { fQx[s]=0; fQy[s]=0; fqn[s]=-1; fPercentile[s]=-1; };
+  //channels 0-31 are V0C, 32-63 V0A
+  for(Int_t det=0;det<kNDetectors;det++) {
+    Double_t mult=0;
+    Double_t *qx = &fQx[Slot(det,0)], *qy = &fQy[Slot(det,0)];
+    for(Int_t ch=32*det;ch<32*(det+1);ch++) {
+      Double_t m = vzero->GetMultiplicity(ch)*fGainFactor[ch];
+      if(m<0) continue;
+      Int_t j = ch%8;
+      for(Int_t ih=0;ih<fNHarmonics;ih++) {
+        qx[ih] += m*fCos[ih][j];
+        qy[ih] += m*fSin[ih][j];
+      };
+      mult+=m;
+    };
+    fMult[det]=mult;
+    if(mult<=0) continue;
+    for(Int_t ih=0;ih<fNHarmonics;ih++) {
+      Int_t s = Slot(det,ih);
+      Double_t dx = GetQxRecentered(det,ih), dy = GetQyRecentered(det,ih);
+      fqn[s] = TMath::Sqrt((dx*dx+dy*dy)/mult);
+      fPercentile[s] = LookupPercentile(s,fqn[s]);
+    };
+  };
+  return kTRUE;
+};
+Double_t AliESEqnService::GetQxRecentered(Int_t det, Int_t ih, Bool_t withWidth) const {
+  Int_t s = Slot(det,ih);
+  Double_t q = fQx[s]-RecenteringValue(fMeanX[s],0.);
+  return withWidth?q/RecenteringValue(fSigmaX[s],1.):q;
+};
+Double_t AliESEqnService::GetQyRecentered(Int_t det, Int_t ih, Bool_t withWidth) const {
+  Int_t s = Slot(det,ih);
+  Double_t q = fQy[s]-RecenteringValue(fMeanY[s],0.);
+  return withWidth?q/RecenteringValue(fSigmaY[s],1.):q;
+};
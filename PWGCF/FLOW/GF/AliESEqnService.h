@@ -0,0 +1,82 @@
+/*
+Reduced flow vectors q_n of the VZERO for event-shape engineering, computed once per event
+and shared by the tasks of a train through the event list (Publish/Find).
+Calibration: channel gain equalisation to the first channel of each ring, recentering by the
+mean (and width) per 1% centrality class, q_n percentiles from flat tables made of the
+calibration maps or splines when they are set, not in the event loop.
+*/
+#ifndef ALIESEQNSERVICE__H
+#define ALIESEQNSERVICE__H
+#include "TNamed.h"
+#include <vector>
+class AliVEvent;
+class TH1;
+class TH2;
+class TSpline3;
+class AliESEqnService: public TNamed
+{
+ public:
+  enum EDetector { kV0C=0, kV0A, kNDetectors };
+  enum { kNChannels=64, kMaxHarmonics=4 };
+  AliESEqnService(const char *name="ESEqnService");
+  ~AliESEqnService();
+  //Sharing through the event list; the first task publishes its service, the others find it
+  static AliESEqnService *Find(AliVEvent *ev, const char *name="ESEqnService");
+  void Publish(AliVEvent *ev);
+  //Harmonics computed for all detectors; returns the index of n
+  Int_t AddHarmonic(Int_t n);
+  Int_t GetHarmonicIndex(Int_t n) const;
+  Int_t GetNHarmonics() const { return fNHarmonics; };
+  //Calibration, bin i+1 of the recentering histograms holds the centrality class [i,i+1)
+  void SetChannelGains(const TH1 *gains); //e.g. V0MultCorr, bin ch+1 for channel ch
+  void SetRecentering(Int_t det, Int_t n, const TH1 *meanX, const TH1 *meanY, const TH1 *sigmaX=0, const TH1 *sigmaY=0);
+  //Percentiles; x: centrality in 1% classes, y: q_n, content: percentile (uniform q_n binning)
+  void SetPercentileMap(Int_t det, Int_t n, const TH2 *map, Double_t scale=1.);
+  //One spline per 1% centrality class, tabulated in nPoints over the range of the spline
+  void SetPercentileSplines(Int_t det, Int_t n, Int_t nCent, TSpline3 **splines, Double_t scale=1., Int_t nPoints=1000);
+  void ClearCalibration();
+  //Per event; repeated calls for the same event return the cached result
+  Bool_t Process(AliVEvent *ev, Double_t centrality);
+  void Reset() { fEventKey=0; fHasEvent=kFALSE; };
+  Double_t GetMultiplicity(Int_t det) const { return fMult[det]; };
+  Double_t GetQx(Int_t det, Int_t ih) const { return fQx[Slot(det,ih)]; };
+  Double_t GetQy(Int_t det, Int_t ih) const { return fQy[Slot(det,ih)]; };
+  //Recentered Q_n; divided by the width if withWidth and the widths are set
+  Double_t GetQxRecentered(Int_t det, Int_t ih, Bool_t withWidth=kFALSE) const;
+  Double_t GetQyRecentered(Int_t det, Int_t ih, Bool_t withWidth=kFALSE) const;
+  //|Q_n - <Q_n>|/sqrt(M), -1 if no multiplicity
+  Double_t Getqn(Int_t det, Int_t ih) const { return fqn[Slot(det,ih)]; };
+  //-1 if no table for the detector and harmonic, or the centrality is outside of it
+  Double_t GetPercentile(Int_t det, Int_t ih) const { return fPercentile[Slot(det,ih)]; };
+ private:
+  AliESEqnService(const AliESEqnService&);
+  AliESEqnService& operator=(const AliESEqnService&);
+  enum { kNSlots=kNDetectors*kMaxHarmonics };
+  Int_t Slot(Int_t det, Int_t ih) const { return det*kMaxHarmonics+ih; };
+  Int_t SlotOf(Int_t det, Int_t n);
+  Double_t RecenteringValue(const std::vector<Double_t> &v, Double_t def) const;
+  Double_t LookupPercentile(Int_t slot, Double_t q) const;
+  Int_t fNHarmonics; //!
+  Int_t fHarmonics[kMaxHarmonics]; //!
+  Double_t fCos[kMaxHarmonics][8]; //! cos(n phi) of the 8 sectors
+  Double_t fSin[kMaxHarmonics][8]; //!
+  Double_t fGainFactor[kNChannels]; //! gain of the first channel of the ring / gain of the channel
+  std::vector<Double_t> fMeanX[kNSlots]; //! per centrality class
+  std::vector<Double_t> fMeanY[kNSlots]; //!
+  std::vector<Double_t> fSigmaX[kNSlots]; //!
+  std::vector<Double_t> fSigmaY[kNSlots]; //!
+  std::vector<Double_t> fPercQMin[kNSlots]; //! per centrality class
+  std::vector<Double_t> fPercInvStep[kNSlots]; //!
+  Int_t fPercNq[kNSlots]; //! points per centrality class
+  std::vector<Double_t> fPercValues[kNSlots]; //! [cent][q]
+  ULong64_t fEventKey; //! identifies the processed event
+  Bool_t fHasEvent; //!
+  Int_t fCentClass; //!
+  Double_t fMult[kNDetectors]; //!
+  Double_t fQx[kNSlots]; //!
+  Double_t fQy[kNSlots]; //!
+  Double_t fqn[kNSlots]; //!
+  Double_t fPercentile[kNSlots]; //!
+  ClassDef(AliESEqnService,1);
+};
+#endif
@@ -98,6 +98,24 @@ void AliGFW::Fill(Double_t eta, Int_t ptin, Double_t phi, Double_t weight, Int_t
       fCumulants.at(i).FillArray(eta,ptin,phi,weight,SecondWeight);
   };
 };
+void AliGFW::Fill(Int_t nTracks, const Double_t *eta, const Int_t *ptin, const Double_t *phi, const Double_t *weight, const Int_t *mask, const Double_t *secondWeight) {
+  if(!fInitialized) CreateRegions();
+  if(!fInitialized) return;
+  if(nTracks<1) return;
+  if((Int_t)fRegionBucket.size()<nTracks) fRegionBucket.resize(nTracks);
+  Int_t *lBucket = fRegionBucket.data();
+  for(Int_t i=0;i<(Int_t)fRegions.size();++i) {
+    const Double_t lEtaMin = fRegions[i].EtaMin;
+    const Double_t lEtaMax = fRegions[i].EtaMax;
+    const Int_t lBitMask = fRegions[i].BitMask;
+    Int_t nInRegion=0;
+    for(Int_t j=0;j<nTracks;j++) {
+      lBucket[nInRegion] = j;
+      nInRegion += (lEtaMin<eta[j] && lEtaMax>eta[j] && (lBitMask&mask[j]))?1:0;
+    };
+    if(nInRegion) fCumulants[i].FillArray(nInRegion,lBucket,ptin,phi,weight,secondWeight);
+  };
+};
 TComplex AliGFW::TwoRec(Int_t n1, Int_t n2, Int_t p1, Int_t p2, Int_t ptbin, AliGFWCumulant *r1, AliGFWCumulant *r2, AliGFWCumulant *r3) {
   TComplex part1 = r1->Vec(n1,p1,ptbin);
   TComplex part2 = r2->Vec(n2,p2,ptbin);
@@ -360,6 +378,130 @@ TComplex AliGFW::Calculate(CorrConfig corconf, Int_t ptbin, Bool_t SetHarmsToZer
   // return retval;
 };
 
+Int_t AliGFW::AddPlanNode(CorrPlan &plan, Int_t region, Int_t har, Int_t pow, Bool_t ptdif, Int_t lead, const vector<Int_t> &subs, const vector<Double_t> &coefs) {
+  PlanNode lNode;
+  lNode.Region = region;
+  lNode.Har = har;
+  lNode.Pow = pow;
+  lNode.PtDif = ptdif;
+  lNode.Lead = lead;
+  lNode.SubFirst = (Int_t)plan.SubNodes.size();
+  lNode.NSub = (Int_t)subs.size();
+  plan.SubNodes.insert(plan.SubNodes.end(),subs.begin(),subs.end());
+  plan.SubCoefs.insert(plan.SubCoefs.end(),coefs.begin(),coefs.end());
+  plan.Nodes.push_back(lNode);
+  return (Int_t)plan.Nodes.size()-1;
+};
+Int_t AliGFW::CompileNode(CorrPlan &plan, std::map<vector<Int_t>,Int_t> &memo, Int_t qpoi, Int_t qref, Int_t qol, vector<Int_t> &hars, vector<Int_t> &pows) {
+  if((pows.at(0)!=1) && qol>-1) qpoi=qol; //Same as in RecursiveCorr
+  vector<Int_t> lKey {qpoi, qref, qol};
+  lKey.insert(lKey.end(),hars.begin(),hars.end());
+  lKey.insert(lKey.end(),pows.begin(),pows.end());
+  auto lFound = memo.find(lKey);
+  if(lFound!=memo.end()) return lFound->second;
+  vector<Int_t> lSubs;
+  vector<Double_t> lCoefs;
+  Int_t lNode;
+  if(hars.size()<2) lNode = AddPlanNode(plan, qpoi, hars.at(0), pows.at(0), kTRUE, -1, lSubs, lCoefs);
+  else if(hars.size()<3) { //Same as TwoRec
+    Int_t lLead = AddPlanNode(plan, qpoi, hars.at(0), pows.at(0), kTRUE, -1, lSubs, lCoefs);
+    if(qol>-1) {
+      lSubs.push_back(AddPlanNode(plan, qol, hars.at(0)+hars.at(1), pows.at(0)+pows.at(1), kTRUE, -1, vector<Int_t> {}, vector<Double_t> {}));
+      lCoefs.push_back(1);
+    };
+    lNode = AddPlanNode(plan, qref, hars.at(1), pows.at(1), kTRUE, lLead, lSubs, lCoefs);
+  } else {
+    Int_t harlast=hars.at(hars.size()-1);
+    Int_t powlast=pows.at(pows.size()-1);
+    hars.erase(hars.end()-1);
+    pows.erase(pows.end()-1);
+    Int_t lLead = CompileNode(plan, memo, qpoi, qref, qol, hars, pows);
+    Int_t lDegeneracy=1;
+    Int_t harSize = (Int_t)hars.size();
+    for(Int_t i=harSize-1;i>=0;i--) {
+      if(i>2) {
+        if(hars.at(i) == hars.at(i-1) && pows.at(i) == pows.at(i-1)) {
+          lDegeneracy++;
+          continue;
+        };
+      };
+      hars.at(i)+=harlast;
+      pows.at(i)+=powlast;
+      lSubs.push_back(CompileNode(plan, memo, qpoi, qref, qol, hars, pows));
+      lCoefs.push_back(lDegeneracy);
+      lDegeneracy=1;
+      hars.at(i)-=harlast;
+      pows.at(i)-=powlast;
+    };
+    hars.push_back(harlast);
+    pows.push_back(powlast);
+    lNode = AddPlanNode(plan, qref, harlast, powlast, kFALSE, lLead, lSubs, lCoefs); //RecursiveCorr takes this factor w/o pT bin
+  };
+  memo[lKey] = lNode;
+  return lNode;
+};
+Int_t AliGFW::CompileCorrelator(const CorrConfig &corconf, Bool_t DisableOverlap) {
+  if(corconf.Regs.size()==0) {
+    printf("AliGFW::CompileCorrelator: no regions in correlator %s, not compiling\n",corconf.Head.Data());
+    return -1;
+  };
+  CorrPlan lPlan;
+  lPlan.Head = corconf.Head;
+  lPlan.pTDif = corconf.pTDif;
+  for(Int_t i=0;i<(Int_t)corconf.Regs.size();i++) {
+    if(corconf.Regs.at(i).size()==0 || corconf.Hars.at(i).size()==0) {
+      printf("AliGFW::CompileCorrelator: empty subevent in correlator %s, not compiling\n",corconf.Head.Data());
+      return -1;
+    };
+    PlanSubEvent lSub;
+    lSub.Poi = corconf.Regs.at(i).at(0);
+    lSub.Ref = (corconf.Regs.at(i).size()>1)?corconf.Regs.at(i).at(1):corconf.Regs.at(i).at(0);
+    lSub.NMin = (Int_t)corconf.Hars.at(i).size();
+    if(lSub.Poi!=lSub.Ref) lSub.NMin--;
+    //Overlap logic as in Calculate(CorrConfig...)
+    Int_t ovl = corconf.Overlap.at(i);
+    Int_t qovl = -1;
+    if(ovl > -1) qovl = DisableOverlap?-1:ovl;
+    else if(lSub.Ref==lSub.Poi) qovl = lSub.Ref;
+    for(Int_t lZero=0;lZero<2;lZero++) {
+      vector<Int_t> hars = corconf.Hars.at(i);
+      if(lZero) for(Int_t j=0;j<(Int_t)hars.size();j++) hars.at(j) = 0;
+      vector<Int_t> pows(hars.size(),1);
+      std::map<vector<Int_t>,Int_t> lMemo; //Nodes of one subevent are kept contiguous
+      lSub.Begin[lZero] = (Int_t)lPlan.Nodes.size();
+      CompileNode(lPlan, lMemo, lSub.Poi, lSub.Ref, qovl, hars, pows);
+      lSub.End[lZero] = (Int_t)lPlan.Nodes.size();
+    };
+    lPlan.SubEvents.push_back(lSub);
+  };
+  if(fPlanValues.size()<lPlan.Nodes.size()) fPlanValues.resize(lPlan.Nodes.size());
+  fPlans.push_back(lPlan);
+  return (Int_t)fPlans.size()-1;
+};
+TComplex AliGFW::Calculate(Int_t planHandle, Int_t ptbin, Bool_t SetHarmsToZero) {
+  if(!fInitialized) return TComplex(0,0);
+  if(planHandle<0 || planHandle>=(Int_t)fPlans.size()) return TComplex(0,0);
+  const CorrPlan &lPlan = fPlans[planHandle];
+  Int_t lVar = SetHarmsToZero?1:0;
+  TComplex retval(1,1); //Same starting value as in Calculate(CorrConfig...), so that both give identical results
+  for(Int_t i=0;i<(Int_t)lPlan.SubEvents.size();i++) {
+    const PlanSubEvent &lSub = lPlan.SubEvents[i];
+    AliGFWCumulant &qref = fCumulants[lSub.Ref];
+    if(!qref.IsPtBinFilled(ptbin)) return TComplex(0,0);
+    if(!fCumulants[lSub.Poi].IsPtBinFilled(ptbin)) return TComplex(0,0);
+    if(qref.GetN() < lSub.NMin) return TComplex(0,0);
+    for(Int_t j=lSub.Begin[lVar];j<lSub.End[lVar];j++) {
+      const PlanNode &lNode = lPlan.Nodes[j];
+      TComplex val = fCumulants[lNode.Region].Vec(lNode.Har,lNode.Pow,lNode.PtDif?ptbin:0);
+      if(lNode.Lead>-1) val*=fPlanValues[lNode.Lead];
+      for(Int_t k=lNode.SubFirst;k<lNode.SubFirst+lNode.NSub;k++) val-=lPlan.SubCoefs[k]*fPlanValues[lPlan.SubNodes[k]];
+      fPlanValues[j]=val;
+    };
+    retval *= fPlanValues[lSub.End[lVar]-1];
+  };
+  return retval;
+};
+
 TComplex AliGFW::Calculate(Int_t poi, vector<Int_t> hars) {
   AliGFWCumulant *qpoi = &fCumulants.at(poi);
   return RecursiveCorr(qpoi, qpoi, qpoi, 0, hars);
@@ -8,6 +8,7 @@ Extention of Generic Flow (https://arxiv.org/abs/1312.3572)
 #include <vector>
 #include <utility>
 #include <algorithm>
+#include <map>
 #include "TString.h"
 #include "TObjArray.h"
 using std::vector;
@@ -50,6 +51,32 @@ class AliGFW {
     Bool_t pTDif=kFALSE;
     TString Head="";
   };
+  //Precompiled correlator: the recursion of RecursiveCorr() unrolled into a flat, index-based list of nodes.
+  //Each node evaluates to (value of Lead node) * Q(Region,Har,Pow) - sum_k SubCoefs[k]*(value of SubNodes[k]).
+  //Identical sub-expressions are compiled only once, so the evaluation is a single pass over the node list.
+  struct PlanNode {
+    Int_t Region; //Index of the cumulant (region) for the Q-vector factor
+    Int_t Har; //Harmonic of the Q-vector factor
+    Int_t Pow; //Power of the Q-vector factor
+    Bool_t PtDif; //If false, the factor is always taken from the first pT bin (as in RecursiveCorr)
+    Int_t Lead; //Node multiplying the Q-vector factor; -1 if none
+    Int_t SubFirst; //First index in SubNodes/SubCoefs
+    Int_t NSub; //Number of subtracted nodes
+  };
+  struct PlanSubEvent {
+    Int_t Poi, Ref; //Regions to check for filled pT bins
+    Int_t NMin; //Minimal number of entries in the reference region
+    Int_t Begin[2]; //First node; [0] for nominal harmonics, [1] for harmonics set to zero
+    Int_t End[2]; //One past the last (= root) node
+  };
+  struct CorrPlan {
+    vector<PlanSubEvent> SubEvents;
+    vector<PlanNode> Nodes;
+    vector<Int_t> SubNodes;
+    vector<Double_t> SubCoefs;
+    Bool_t pTDif=kFALSE;
+    TString Head="";
+  };
   AliGFW();
   ~AliGFW();
   vector<Region> fRegions;
@@ -59,11 +86,19 @@ class AliGFW {
   void AddRegion(TString refName, Int_t lNhar, Int_t *lNparVec, Double_t lEtaMin, Double_t lEtaMax, Int_t lNpT=1, Int_t BitMask=1);
   Int_t CreateRegions();
   void Fill(Double_t eta, Int_t ptin, Double_t phi, Double_t weight, Int_t mask, Double_t secondWeight=-1);
+  //Fill a whole event at once from contiguous per-track arrays; secondWeight can be 0 if not used
+  void Fill(Int_t nTracks, const Double_t *eta, const Int_t *ptin, const Double_t *phi, const Double_t *weight, const Int_t *mask, const Double_t *secondWeight=0);
   void Clear();// { for(auto ptr = fCumulants.begin(); ptr!=fCumulants.end(); ++ptr) ptr->ResetQs(); };
   AliGFWCumulant GetCumulant(Int_t index) { return fCumulants.at(index); };
   TComplex Calculate(TString config, Bool_t SetHarmsToZero=kFALSE);
   CorrConfig GetCorrelatorConfig(TString config, TString head = "", Bool_t ptdif=kFALSE);
   TComplex Calculate(CorrConfig corconf, Int_t ptbin, Bool_t SetHarmsToZero, Bool_t DisableOverlap=kFALSE);
+  //Compile a correlator once (e.g. in UserCreateOutputObjects); returns a handle to be used in the event loop, or -1 on failure
+  Int_t CompileCorrelator(const CorrConfig &corconf, Bool_t DisableOverlap=kFALSE);
+  Int_t CompileCorrelator(TString config, TString head="", Bool_t ptdif=kFALSE) { return CompileCorrelator(GetCorrelatorConfig(config,head,ptdif)); };
+  TComplex Calculate(Int_t planHandle, Int_t ptbin, Bool_t SetHarmsToZero=kFALSE);
+  const CorrPlan &GetCorrelatorPlan(Int_t planHandle) { return fPlans.at(planHandle); };
+  Int_t GetNCorrelatorPlans() { return (Int_t)fPlans.size(); };
  private:
   Bool_t fInitialized;
   void SplitRegions();
@@ -71,6 +106,12 @@ class AliGFW {
   TComplex TwoRec(Int_t n1, Int_t n2, Int_t p1, Int_t p2, Int_t ptbin, AliGFWCumulant*, AliGFWCumulant*, AliGFWCumulant*);
   TComplex RecursiveCorr(AliGFWCumulant *qpoi, AliGFWCumulant *qref, AliGFWCumulant *qol, Int_t ptbin, vector<Int_t> &hars, vector<Int_t> &pows); //POI, Ref. flow, overlapping region
   TComplex RecursiveCorr(AliGFWCumulant *qpoi, AliGFWCumulant *qref, AliGFWCumulant *qol, Int_t ptbin, vector<Int_t> &hars); //POI, Ref. flow, overlapping region
+  //Plan compilation; mirrors RecursiveCorr, but with region indices (-1 = no region) instead of cumulants
+  Int_t CompileNode(CorrPlan &plan, std::map<vector<Int_t>,Int_t> &memo, Int_t qpoi, Int_t qref, Int_t qol, vector<Int_t> &hars, vector<Int_t> &pows);
+  Int_t AddPlanNode(CorrPlan &plan, Int_t region, Int_t har, Int_t pow, Bool_t ptdif, Int_t lead, const vector<Int_t> &subs, const vector<Double_t> &coefs);
+  vector<CorrPlan> fPlans;
+  vector<TComplex> fPlanValues; //Buffer for node values, reused between calls
+  vector<Int_t> fRegionBucket; //Track indices of one region in batch filling, reused between calls
   //Deprecated and not used (for now):
   void AddRegion(Region inreg) { fRegions.push_back(inreg); };
   Region GetRegion(Int_t index) { return fRegions.at(index); };
@@ -5,7 +5,12 @@ Extention of Generic Flow (https://arxiv.org/abs/1312.3572)
 #include "AliGFWCumulant.h"
 
 AliGFWCumulant::AliGFWCumulant():
-  fQvector(0),
+  fQRe(0),
+  fQIm(0),
+  fHarOffset(0),
+  fPtStride(0),
+  fMaxPow(0),
+  fPrefactors(0),
   fUsed(kBlank),
   fNEntries(-1),
   fN(1),
@@ -26,48 +31,75 @@ void AliGFWCumulant::FillArray(Double_t eta, Int_t ptin, Double_t phi, Double_t
     CreateComplexVectorArray(1,1,1);
   if(fPt==1) ptin=0; //If one bin, then just fill it straight; otherwise, if ptin is out-of-range, do not fill
   else if(ptin<0 || ptin>=fPt) return;
+  FillTrack(ptin,TMath::Cos(phi),TMath::Sin(phi),weight,SecondWeight);
+};
+void AliGFWCumulant::FillArray(Int_t nIndices, const Int_t *indices, const Int_t *ptin, const Double_t *phi, const Double_t *weight, const Double_t *SecondWeight) {
+  if(!fInitialized)
+    CreateComplexVectorArray(1,1,1);
+  if(nIndices<1) return;
+  if((Int_t)fBatchCos.size()<nIndices) { fBatchCos.resize(nIndices); fBatchSin.resize(nIndices); };
+  //Trigonometric functions in a separate, branch-free loop, so that it can be vectorized
+  Double_t *lCos = fBatchCos.data();
+  Double_t *lSin = fBatchSin.data();
+  for(Int_t i=0;i<nIndices;i++) {
+    lCos[i] = TMath::Cos(phi[indices[i]]);
+    lSin[i] = TMath::Sin(phi[indices[i]]);
+  };
+  for(Int_t i=0;i<nIndices;i++) {
+    Int_t lTr = indices[i];
+    Int_t lPt = ptin[lTr];
+    if(fPt==1) lPt=0;
+    else if(lPt<0 || lPt>=fPt) continue;
+    FillTrack(lPt,lCos[i],lSin[i],weight[lTr],SecondWeight?SecondWeight[lTr]:-1);
+  };
+};
+void AliGFWCumulant::FillTrack(Int_t ptin, Double_t lCos1, Double_t lSin1, Double_t weight, Double_t SecondWeight) {
   fFilledPts[ptin] = kTRUE;
+  //Weight prefactors are the same for all harmonics, so calculate them once per track.
+  //Multiplication is cheaper than power. Also, if second weight is specified, then keep the first weight with power no more than 1,
+  //and use the other weight otherwise; this is important when POIs are a subset of REFs and have different weights than REFs
+  fPrefactors[0] = 1;
+  if(fMaxPow>1) fPrefactors[1] = weight;
+  for(Int_t lPow=2; lPow<fMaxPow; lPow++)
+    fPrefactors[lPow] = fPrefactors[lPow-1]*((SecondWeight>0)?SecondWeight:weight);
+  //Only one sin/cos evaluation per track; higher harmonics from angle-addition recurrence
+  Double_t lCos = 1;
+  Double_t lSin = 0;
+  Double_t *lRe = fQRe + ptin*fPtStride;
+  Double_t *lIm = fQIm + ptin*fPtStride;
   for(Int_t lN = 0; lN<fN; lN++) {
-    Double_t lSin = TMath::Sin(lN*phi); //No need to recalculate for each power
-    Double_t lCos = TMath::Cos(lN*phi); //No need to recalculate for each power
-    for(Int_t lPow=0; lPow<PW(lN); lPow++) {
-      Double_t lPrefactor = 0;
-      //Dont calculate it twice; multiplication is cheaper that power
-      //Also, if second weight is specified, then keep the first weight with power no more than 1, and us the other weight otherwise
-      //this is important when POIs are a subset of REFs and have different weights than REFs
-      if(SecondWeight>0 && lPow>1) lPrefactor = TMath::Power(SecondWeight, lPow-1)*weight;
-      else lPrefactor = TMath::Power(weight,lPow);
-      Double_t qsin = lPrefactor * lSin;
-      Double_t qcos = lPrefactor * lCos;
-      fQvector[ptin][lN][lPow](fQvector[ptin][lN][lPow].Re()+qcos,fQvector[ptin][lN][lPow].Im()+qsin);//+=TComplex(qcos,qsin);
+    Double_t *lReN = lRe + fHarOffset[lN];
+    Double_t *lImN = lIm + fHarOffset[lN];
+    const Int_t lNPow = fPowVec[lN];
+    for(Int_t lPow=0; lPow<lNPow; lPow++) {
+      lReN[lPow] += fPrefactors[lPow]*lCos;
+      lImN[lPow] += fPrefactors[lPow]*lSin;
     };
+    const Double_t lCosNext = lCos*lCos1 - lSin*lSin1;
+    lSin = lSin*lCos1 + lCos*lSin1;
+    lCos = lCosNext;
   };
   Inc();
 };
 void AliGFWCumulant::ResetQs() {
   if(!fNEntries) return; //If 0 entries, then no need to reset. Otherwise, if -1, then just initialized and need to set to 0.
-  for(Int_t i=0; i<fPt; i++) {
-    fFilledPts[i] = kFALSE;
-    for(Int_t lN=0;lN<fN;lN++) {
-      for(Int_t lPow=0;lPow<PW(lN);lPow++) {
-  	       fQvector[i][lN][lPow](0.,0.);
-      };
-    };
-  };
+  for(Int_t i=0; i<fPt; i++) fFilledPts[i] = kFALSE;
+  const Int_t lSize = fPt*fPtStride;
+  for(Int_t i=0; i<lSize; i++) { fQRe[i] = 0.; fQIm[i] = 0.; };
   fNEntries=0;
 };
 void AliGFWCumulant::DestroyComplexVectorArray() {
   if(!fInitialized) return;
-  for(Int_t l_n = 0; l_n<fN; l_n++) {
-    for(Int_t i=0;i<fPt;i++) {
-      delete [] fQvector[i][l_n];
-    };
-  };
-  for(Int_t i=0;i<fPt;i++) {
-    delete [] fQvector[i];
-  };
-  delete [] fQvector;
+  delete [] fQRe;
+  delete [] fQIm;
+  delete [] fHarOffset;
+  delete [] fPrefactors;
   delete [] fFilledPts;
+  fQRe=0;
+  fQIm=0;
+  fHarOffset=0;
+  fPrefactors=0;
+  fFilledPts=0;
   fInitialized=kFALSE;
   fNEntries=-1;
 };
@@ -85,21 +117,24 @@ void AliGFWCumulant::CreateComplexVectorArrayVarPower(Int_t N, vector<Int_t> Pow
   fPt=Pt;
   fFilledPts = new Bool_t[Pt];
   fPowVec = PowVec;
-  fQvector = new TComplex**[fPt];
-  for(Int_t i=0;i<fPt;i++) {
-    fQvector[i] = new TComplex*[fN];
-  };
+  fHarOffset = new Int_t[fN];
+  fPtStride = 0;
+  fMaxPow = 1;
   for(Int_t l_n=0;l_n<fN;l_n++) {
-    for(Int_t i=0;i<fPt;i++) {
-      fQvector[i][l_n] = new TComplex[PW(l_n)];
-    };
+    fHarOffset[l_n] = fPtStride;
+    fPtStride += ((PW(l_n)+kAlign-1)/kAlign)*kAlign; //pad each harmonic row
+    if(PW(l_n)>fMaxPow) fMaxPow = PW(l_n);
   };
+  fQRe = new Double_t[fPt*fPtStride];
+  fQIm = new Double_t[fPt*fPtStride];
+  fPrefactors = new Double_t[fMaxPow];
+  fNEntries=-1; //force the reset
   ResetQs();
   fInitialized=kTRUE;
 };
 TComplex AliGFWCumulant::Vec(Int_t n, Int_t p, Int_t ptbin) {
   if(!fInitialized) return 0;
   if(ptbin>=fPt || ptbin<0) ptbin=0;
-  if(n>=0) return fQvector[ptbin][n][p];
-  return TComplex::Conjugate(fQvector[ptbin][-n][p]);
+  if(n>=0) return TComplex(fQRe[ptbin*fPtStride+fHarOffset[n]+p],fQIm[ptbin*fPtStride+fHarOffset[n]+p]);
+  return TComplex(fQRe[ptbin*fPtStride+fHarOffset[-n]+p],-fQIm[ptbin*fPtStride+fHarOffset[-n]+p]);
 };
@@ -15,12 +15,25 @@ class AliGFWCumulant {
   ~AliGFWCumulant();
   void ResetQs();
   void FillArray(Double_t eta, Int_t ptin, Double_t phi, Double_t weight=1, Double_t SecondWeight=-1);
+  //Batch version: fills tracks indices[0..nIndices-1] of the per-event arrays. SecondWeight can be 0 if not used
+  void FillArray(Int_t nIndices, const Int_t *indices, const Int_t *ptin, const Double_t *phi, const Double_t *weight, const Double_t *SecondWeight=0);
   enum UsedFlags_t {kBlank = 0, kFull=1, kPt=2};
   void SetType(UInt_t infl) { DestroyComplexVectorArray(); fUsed = infl; };
   void Inc() { fNEntries++; };
   Int_t GetN() { return fNEntries; };
   // protected:
-  TComplex ***fQvector;
+  //Q-vectors are stored as structure-of-arrays: one buffer for real and one for imaginary parts,
+  //each laid out as [pt][harmonic][power]. Every (pt, harmonic) row is padded to kAlign doubles.
+  enum { kAlign = 4 };
+  Double_t *fQRe; //! Real parts
+  Double_t *fQIm; //! Imaginary parts
+  Int_t *fHarOffset; //! Offset of each harmonic within one pT bin
+  Int_t fPtStride; //! Number of entries per pT bin
+  Int_t fMaxPow; //! Largest power over all harmonics
+  Double_t *fPrefactors; //! Per-track weight powers, reused between tracks
+  vector<Double_t> fBatchCos; //! cos(phi) of the current batch
+  vector<Double_t> fBatchSin; //! sin(phi) of the current batch
+  void FillTrack(Int_t ptin, Double_t lCos1, Double_t lSin1, Double_t weight, Double_t SecondWeight);
   UInt_t fUsed;
   Int_t fNEntries;
   //Q-vectors. Could be done recursively, but maybe defining each one of them explicitly is easier to read
@@ -8,6 +8,8 @@ AliGFWFlowContainer::AliGFWFlowContainer():
   TNamed("",""),
   fProf(0),
   fProfRand(0),
+  fSubMoments(0),
+  fLeanSubsamples(kFALSE),
   fNRandom(0),
   fIDName("MidV"),
   fPtRebin(1),
@@ -24,6 +26,8 @@ AliGFWFlowContainer::AliGFWFlowContainer(const char *name):
   TNamed(name,name),
   fProf(0),
   fProfRand(0),
+  fSubMoments(0),
+  fLeanSubsamples(kFALSE),
   fNRandom(0),
   fIDName("MidV"),
   fPtRebin(1),
@@ -39,6 +43,7 @@ AliGFWFlowContainer::AliGFWFlowContainer(const char *name):
 AliGFWFlowContainer::~AliGFWFlowContainer() {
   delete fProf;
   delete fProfRand;
+  delete fSubMoments;
 };
 void AliGFWFlowContainer::Initialize(TObjArray *inputList, Int_t nMultiBins, Double_t *multiBins, Int_t nRandom) {
   if(!inputList) {
@@ -53,7 +58,10 @@ void AliGFWFlowContainer::Initialize(TObjArray *inputList, Int_t nMultiBins, Dou
   for(Int_t i=0;i<inputList->GetEntries();i++)
     fProf->GetYaxis()->SetBinLabel(i+1,inputList->At(i)->GetName());
   fProf->Sumw2();
-  if(nRandom) {
+  if(nRandom && fLeanSubsamples) {
+    fNRandom=nRandom;
+    fSubMoments = new AliProfileMoments(nRandom,fProf->GetNcells());
+  } else if(nRandom) {
     fNRandom=nRandom;
     fProfRand = new TObjArray();
     fProfRand->SetOwner(kTRUE);
@@ -77,7 +85,10 @@ void AliGFWFlowContainer::Initialize(TObjArray *inputList, Int_t nMultiBins, Dou
   fProf->Sumw2();
   for(Int_t i=0;i<inputList->GetEntries();i++)
     fProf->GetYaxis()->SetBinLabel(i+1,inputList->At(i)->GetName());
-  if(nRandom) {
+  if(nRandom && fLeanSubsamples) {
+    fNRandom=nRandom;
+    fSubMoments = new AliProfileMoments(nRandom,fProf->GetNcells());
+  } else if(nRandom) {
     fNRandom=nRandom;
     fProfRand = new TObjArray();
     fProfRand->SetOwner(kTRUE);
@@ -124,7 +135,8 @@ Int_t AliGFWFlowContainer::FillProfile(const char *hname, Double_t multi, Double
   fProf->Fill(multi,yin,corr,w);
   if(fNRandom) {
     Double_t rnind = rn*fNRandom;
-    ((TProfile2D*)fProfRand->At((Int_t)rnind))->Fill(multi,yin,corr,w);
+    if(fSubMoments) fSubMoments->Fill((Int_t)rnind,fProf->FindBin(multi,yin),corr,w);
+    else ((TProfile2D*)fProfRand->At((Int_t)rnind))->Fill(multi,yin,corr,w);
   };
   return 0;
 };
@@ -166,6 +178,22 @@ void AliGFWFlowContainer::OverrideProfileErrors(TProfile2D *inpf) {
     }
   }
 }
+Bool_t AliGFWFlowContainer::MaterializeSubProfiles() {
+  if(!fSubMoments) return kFALSE;
+  if(!fProf) { printf("AliGFWFlowContainer: main profile does not exist, cannot create subprofiles\n"); return kFALSE; };
+  if(fProfRand) delete fProfRand;
+  fProfRand = new TObjArray();
+  fProfRand->SetOwner(kTRUE);
+  for(Int_t i=0;i<fSubMoments->GetNSubs();i++) {
+    TProfile2D *lSub = (TProfile2D*)fProf->Clone(Form("%s_Rand_%i",fProf->GetName(),i));
+    lSub->SetDirectory(0);
+    fSubMoments->Export(i,lSub);
+    fProfRand->Add(lSub);
+  };
+  delete fSubMoments;
+  fSubMoments=0;
+  return kTRUE;
+};
 Long64_t AliGFWFlowContainer::Merge(TCollection *collist) {
   Long64_t nmerged=0;
   AliGFWFlowContainer *l_FC = 0;
@@ -180,6 +208,12 @@ Long64_t AliGFWFlowContainer::Merge(TCollection *collist) {
     } else
       tpro->Add(spro);
     nmerged++;
+    if(l_FC->fSubMoments && !fProfRand) { //Both lean: merge moment arrays directly
+      if(!fSubMoments) { fSubMoments = new AliProfileMoments(); fNRandom = l_FC->fNRandom; };
+      fSubMoments->Add(l_FC->fSubMoments);
+      continue;
+    };
+    MaterializeSubProfiles();
     TObjArray *tarr = l_FC->GetSubProfiles();
     if(!tarr)
       continue;
@@ -233,6 +267,12 @@ void AliGFWFlowContainer::PickAndMerge(TFile *tfi) {
     fProf->SetDirectory(0);
   } else
     tpro->Add(spro);
+  if(lfc->fSubMoments && !fProfRand) { //Both lean: merge moment arrays directly
+    if(!fSubMoments) { fSubMoments = new AliProfileMoments(); fNRandom = lfc->fNRandom; };
+    fSubMoments->Add(lfc->fSubMoments);
+    return;
+  };
+  MaterializeSubProfiles();
   TObjArray *tarr = lfc->GetSubProfiles();
   if(!tarr) {
     //printf("Target %s does not have subprofiles!\n",lfc->GetName());
@@ -264,6 +304,7 @@ Bool_t AliGFWFlowContainer::OverrideBinsWithZero(Int_t xb1, Int_t yb1, Int_t xb2
   return kTRUE;
 }
 Bool_t AliGFWFlowContainer::OverrideMainWithSub(Int_t ind, Bool_t ExcludeChosen) {
+  MaterializeSubProfiles();
   if(!fProfRand) {
     printf("Cannot override main profile with a randomized one. Random profile array does not exist.\n");
     return kFALSE;
@@ -294,6 +335,7 @@ Bool_t AliGFWFlowContainer::OverrideMainWithSub(Int_t ind, Bool_t ExcludeChosen)
   };
 };
 Bool_t AliGFWFlowContainer::RandomizeProfile(Int_t nSubsets) {
+  MaterializeSubProfiles();
   if(!fProfRand) {
     printf("Cannot randomize profile, random array does not exist.\n");
     return kFALSE;
@@ -15,6 +15,7 @@ Extention of Generic Flow (https://arxiv.org/abs/1312.3572)
 #include "TString.h"
 #include "TObjArray.h"
 #include "AliProfileSubset.h"
+#include "AliProfileMoments.h"
 #include "TRandom.h"
 #include "TString.h"
 #include "TCollection.h"
@@ -31,7 +32,7 @@ class AliGFWFlowContainer:public TNamed {
   Bool_t CreateBinsFromAxis(TAxis *inax);
   void SetXAxis(TAxis *inax);
   void SetXAxis();
-  void RebinMulti(Int_t rN) { if(fProf) fProf->RebinX(rN); };
+  void RebinMulti(Int_t rN) { if(fProf) { MaterializeSubProfiles(); fProf->RebinX(rN); }; };
   Int_t GetNMultiBins() { return fProf->GetNbinsX(); };
   Double_t GetMultiAtBin(Int_t bin) { return fProf->GetXaxis()->GetBinCenter(bin); };
   Int_t FillProfile(const char *hname, Double_t multi, Double_t y, Double_t w, Double_t rn);
@@ -43,7 +44,10 @@ class AliGFWFlowContainer:public TNamed {
   Bool_t OverrideMainWithSub(Int_t subind, Bool_t ExcludeChosen);
   Bool_t RandomizeProfile(Int_t nSubsets=0);
   Bool_t CreateStatisticsProfile(StatisticsType StatType, Int_t arg);
-  TObjArray *GetSubProfiles() { return fProfRand; };
+  TObjArray *GetSubProfiles() { MaterializeSubProfiles(); return fProfRand; };
+  //Lean mode (set before Initialize): subsamples are stored as moment arrays; TProfile2Ds are only created at readout
+  void SetLeanSubsamples(Bool_t newval) { fLeanSubsamples = newval; };
+  Bool_t MaterializeSubProfiles();
   Long64_t Merge(TCollection *collist);
   void SetIDName(TString newname); //! do not store
   void SetPtRebin(Int_t newval) { fPtRebin=newval; };
@@ -138,6 +142,8 @@ class AliGFWFlowContainer:public TNamed {
   TH1D *ProfToHist(TProfile *inpf);
   TProfile2D *fProf;
   TObjArray *fProfRand;
+  AliProfileMoments *fSubMoments; //Subsamples in lean mode
+  Bool_t fLeanSubsamples; //! do not store
   Int_t fNRandom;
   TString fIDName;
   Int_t fPtRebin; //! do not store
@@ -149,7 +155,7 @@ class AliGFWFlowContainer:public TNamed {
   Double_t *fbinsPt; //! Do not store; stored in fXAxis
   Bool_t fPropagateErrors; //! do not store
   TProfile *GetRefFlowProfile(const char *order, Double_t m1=-1, Double_t m2=-1);
-  ClassDef(AliGFWFlowContainer, 2);
+  ClassDef(AliGFWFlowContainer, 3);
 };
 
 
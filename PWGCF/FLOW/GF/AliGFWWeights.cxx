@@ -16,6 +16,8 @@ AliGFWWeights::AliGFWWeights():
   fNbinsPt(0),
   fbinsPt(0)
 {
+  fFrozen[0]=kFALSE;
+  fFrozen[1]=kFALSE;
 };
 AliGFWWeights::~AliGFWWeights()
 {
@@ -99,6 +101,7 @@ Double_t AliGFWWeights::GetWeight(Double_t phi, Double_t eta, Double_t vz, Doubl
   return 1;
 };
 Double_t AliGFWWeights::GetNUA(Double_t phi, Double_t eta, Double_t vz) {
+  if(fFrozen[0]) return GetFrozen(0,phi,eta,vz);
   if(!fAccInt) CreateNUA();
   Int_t xind = fAccInt->GetXaxis()->FindBin(phi);
   Int_t etaind = fAccInt->GetYaxis()->FindBin(eta);
@@ -108,6 +111,7 @@ Double_t AliGFWWeights::GetNUA(Double_t phi, Double_t eta, Double_t vz) {
   return 1;
 }
 Double_t AliGFWWeights::GetNUE(Double_t pt, Double_t eta, Double_t vz) {
+  if(fFrozen[1]) return GetFrozen(1,pt,eta,vz);
   if(!fEffInt) CreateNUE();
   Int_t xind = fEffInt->GetXaxis()->FindBin(pt);
   Int_t etaind = fEffInt->GetYaxis()->FindBin(eta);
@@ -116,6 +120,48 @@ Double_t AliGFWWeights::GetNUE(Double_t pt, Double_t eta, Double_t vz) {
   if(weight!=0) return 1./weight;
   return 1;
 }
+void AliGFWWeights::GetNUA(Int_t nTracks, const Double_t *phi, const Double_t *eta, Double_t vz, Double_t *nua) {
+  if(!fFrozen[0]) {
+    for(Int_t i=0;i<nTracks;i++) nua[i] = GetNUA(phi[i],eta[i],vz);
+    return;
+  };
+  //vz is the same for all tracks, so only the (phi, eta) slice is needed
+  const Int_t nx = fFrozenN[0][0]+2;
+  const Double_t *lSlice = fFrozenW[0].data() + FrozenBin(0,2,vz)*(fFrozenN[0][1]+2)*nx;
+  for(Int_t i=0;i<nTracks;i++) nua[i] = lSlice[FrozenBin(0,1,eta[i])*nx+FrozenBin(0,0,phi[i])];
+};
+Bool_t AliGFWWeights::FreezeHist(TH3D *inh, Int_t ind) {
+  fFrozen[ind]=kFALSE;
+  if(!inh) return kFALSE;
+  TAxis *lAx[] = {inh->GetXaxis(), inh->GetYaxis(), inh->GetZaxis()};
+  for(Int_t i=0;i<3;i++) {
+    if(lAx[i]->IsVariableBinSize()) {
+      printf("AliGFWWeights::Freeze: %s has variable binning, cannot freeze\n",inh->GetName());
+      return kFALSE;
+    };
+    fFrozenN[ind][i] = lAx[i]->GetNbins();
+    fFrozenLow[ind][i] = lAx[i]->GetXmin();
+    fFrozenInvW[ind][i] = fFrozenN[ind][i]/(lAx[i]->GetXmax()-lAx[i]->GetXmin());
+  };
+  Int_t nx = fFrozenN[ind][0]+2;
+  Int_t ny = fFrozenN[ind][1]+2;
+  Int_t nz = fFrozenN[ind][2]+2;
+  fFrozenW[ind].resize(nx*ny*nz);
+  for(Int_t iz=0;iz<nz;iz++)
+    for(Int_t iy=0;iy<ny;iy++)
+      for(Int_t ix=0;ix<nx;ix++) {
+        Double_t weight = inh->GetBinContent(ix,iy,iz);
+        fFrozenW[ind][(iz*ny+iy)*nx+ix] = (weight!=0)?1./weight:1;
+      };
+  fFrozen[ind]=kTRUE;
+  return kTRUE;
+};
+Bool_t AliGFWWeights::Freeze() {
+  if(!fAccInt) CreateNUA();
+  if(!FreezeHist(fAccInt,0)) return kFALSE;
+  if(fEffInt) FreezeHist(fEffInt,1); //Not created here, since CreateNUE() rebins the input
+  return kTRUE;
+};
 Double_t AliGFWWeights::FindMax(TH3D *inh, Int_t &ix, Int_t &iy, Int_t &iz) {
   Double_t maxv=inh->GetBinContent(1,1,1);
   for(Int_t i=1;i<=inh->GetNbinsX();i++)
@@ -158,6 +204,7 @@ void AliGFWWeights::CreateNUA(Bool_t IntegrateOverCentAndPt) {
   };
   TH3D *h3;
   TH1D *h1;
+  fFrozen[0]=kFALSE;
   if(fW_data->GetEntries()<1) return;
   if(IntegrateOverCentAndPt) {
     if(fAccInt) delete fAccInt;
@@ -206,6 +253,7 @@ void AliGFWWeights::CreateNUE(Bool_t IntegrateOverCentrality) {
   };
   TH3D *num=0;
   TH3D *den=0;
+  fFrozen[1]=kFALSE;
   if(fW_mcrec->GetEntries()<1 || fW_mcgen->GetEntries()<1) return;
   if(IntegrateOverCentrality) {
     num=(TH3D*)fW_mcrec->At(0);//->Clone(Form("temp_%s",fW_mcrec->At(0)->GetName()));
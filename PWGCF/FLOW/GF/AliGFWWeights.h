@@ -12,6 +12,7 @@ Extention of Generic Flow (https://arxiv.org/abs/1312.3572)
 #include "TFile.h"
 #include "TCollection.h"
 #include "TString.h"
+#include <vector>
 
 class AliGFWWeights: public TNamed
 {
@@ -23,6 +24,12 @@ class AliGFWWeights: public TNamed
   Double_t GetWeight(Double_t phi, Double_t eta, Double_t vz, Double_t pt, Double_t cent, Int_t htype); //htype: 0 for data, 1 for mc rec, 2 for mc gen
   Double_t GetNUA(Double_t phi, Double_t eta, Double_t vz); //This just fetches correction from integrated NUA, should speed up
   Double_t GetNUE(Double_t pt, Double_t eta, Double_t vz); //fetches weight from fEffInt
+  //Frozen mode: NUA (and NUE, if created) exported to dense flat tables, e.g. in NotifyRun. Must be redone if weights are modified
+  Bool_t Freeze();
+  void Unfreeze() { fFrozen[0]=kFALSE; fFrozen[1]=kFALSE; };
+  Bool_t IsFrozen() { return fFrozen[0]; };
+  //Batch lookup for the whole event (vz is the same for all tracks); uses frozen tables if available
+  void GetNUA(Int_t nTracks, const Double_t *phi, const Double_t *eta, Double_t vz, Double_t *nua);
   Bool_t IsDataFilled() { return fDataFilled; };
   Bool_t IsMCFilled() { return fMCFilled; };
   Double_t FindMax(TH3D *inh, Int_t &ix, Int_t &iy, Int_t &iz);
@@ -55,6 +62,21 @@ class AliGFWWeights: public TNamed
   TH3D *fAccInt; //!
   Int_t fNbinsPt; //! do not store
   Double_t *fbinsPt; //! do not store
+  //Flat tables; index 0 for NUA, 1 for NUE
+  Bool_t fFrozen[2]; //! do not store
+  std::vector<Double_t> fFrozenW[2]; //! inverse weights, incl. under- and overflow
+  Double_t fFrozenLow[2][3]; //! axis low edges
+  Double_t fFrozenInvW[2][3]; //! inverse bin widths
+  Int_t fFrozenN[2][3]; //! number of bins
+  Bool_t FreezeHist(TH3D *inh, Int_t ind);
+  Int_t FrozenBin(Int_t ind, Int_t axis, Double_t x) {
+    if(x<fFrozenLow[ind][axis]) return 0;
+    Int_t bin = 1+(Int_t)((x-fFrozenLow[ind][axis])*fFrozenInvW[ind][axis]);
+    return (bin>fFrozenN[ind][axis])?fFrozenN[ind][axis]+1:bin;
+  };
+  Double_t GetFrozen(Int_t ind, Double_t x, Double_t y, Double_t z) {
+    return fFrozenW[ind][(FrozenBin(ind,2,z)*(fFrozenN[ind][1]+2)+FrozenBin(ind,1,y))*(fFrozenN[ind][0]+2)+FrozenBin(ind,0,x)];
+  };
   void AddArray(TObjArray *targ, TObjArray *sour);
   const char *GetBinName(Double_t ptv, Double_t v0mv,const char *pf="") {
     Int_t ptind = 0;//GetPtBin(ptv);
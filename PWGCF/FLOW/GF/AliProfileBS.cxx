@@ -4,18 +4,21 @@ AliProfileBS::AliProfileBS():
   fListOfEntries(0),
   fProfInitialized(kFALSE),
   fNSubs(0),
+  fSubMoments(0),
   fMultiRebin(0),
   fMultiRebinEdges(0)
 {
 };
 AliProfileBS::~AliProfileBS() {
   delete fListOfEntries;
+  delete fSubMoments;
 };
 AliProfileBS::AliProfileBS(const char* name, const char* title, Int_t nbinsx, const Double_t* xbins):
   TProfile(name,title,nbinsx,xbins),
   fListOfEntries(0),
   fProfInitialized(kTRUE),
   fNSubs(0),
+  fSubMoments(0),
   fMultiRebin(0),
   fMultiRebinEdges(0)
 {};
@@ -24,12 +27,19 @@ AliProfileBS::AliProfileBS(const char* name, const char* title, Int_t nbinsx, Do
   fListOfEntries(0),
   fProfInitialized(kFALSE),
   fNSubs(0),
+  fSubMoments(0),
   fMultiRebin(0),
   fMultiRebinEdges(0)
 {};
-void AliProfileBS::InitializeSubsamples(Int_t nSub) {
+void AliProfileBS::InitializeSubsamples(Int_t nSub, Bool_t lean) {
   if(nSub<1) {printf("Number of subprofiles has to be > 0!\n"); return; };
-  if(fListOfEntries) delete fListOfEntries;
+  if(fListOfEntries) { delete fListOfEntries; fListOfEntries=0; };
+  if(fSubMoments) { delete fSubMoments; fSubMoments=0; };
+  if(lean) {
+    fSubMoments = new AliProfileMoments(nSub,GetNcells());
+    fNSubs = nSub;
+    return;
+  };
   fListOfEntries = new TList();
   fListOfEntries->SetOwner(kTRUE);
   TProfile *dummyPF = (TProfile*)this;
@@ -44,6 +54,7 @@ void AliProfileBS::FillProfile(const Double_t &xv, const Double_t& yv, const Dou
   if(!fNSubs) return;
   Int_t targetInd = rn*fNSubs;
   if(targetInd>=fNSubs) targetInd = 0;
+  if(fSubMoments) { fSubMoments->Fill(targetInd,fXaxis.FindBin(xv),yv,w); return; };
   ((TProfile*)fListOfEntries->At(targetInd))->Fill(xv,yv,w);
 }
 void AliProfileBS::FillProfile(const Double_t &xv, const Double_t &yv, const Double_t &w) {
@@ -51,6 +62,7 @@ void AliProfileBS::FillProfile(const Double_t &xv, const Double_t &yv, const Dou
 }
 void AliProfileBS::RebinMulti(Int_t nbins) {
   this->RebinX(nbins);
+  if(fSubMoments) fSubMoments->RebinX(nbins);
   if(!fListOfEntries) return;
   for(Int_t i=0;i<fListOfEntries->GetEntries();i++)
     ((TProfile*)fListOfEntries->At(i))->RebinX(nbins);
@@ -60,6 +72,13 @@ TH1 *AliProfileBS::getHist(Int_t ind) {
     if((TProfile*)this) return getHistRebinned((TProfile*)this);//((TProfile*)this)->ProjectionX(Form("%s_hist",this->GetName()));
     else { printf("Empty AliProfileBS addressed, cannot get a histogram\n"); return 0; };
   } else {
+    if(fSubMoments) {
+      if(ind>=fNSubs) { printf("Trying to fetch subprofile no %i out of %i, not possible\n",ind,fNSubs); return 0;};
+      TProfile *lSubPf = MakeSubProfile(ind);
+      TH1 *reth = getHistRebinned(lSubPf);
+      delete lSubPf;
+      return reth;
+    };
     if(!fListOfEntries) { printf("No subprofiles exist!\n"); return 0; };
     if(ind<fNSubs) return getHistRebinned((TProfile*)fListOfEntries->At(ind));////((TProfile*)fListOfEntries->At(ind))->ProjectionX(Form("%s_sub%i",((TProfile*)fListOfEntries->At(ind))->GetName(),ind));
     else { printf("Trying to fetch subprofile no %i out of %i, not possible\n",ind,fNSubs); return 0;};
@@ -72,6 +91,12 @@ Long64_t AliProfileBS::Merge(TCollection *collist) {
   AliProfileBS *l_PBS = 0;
   TIter all_PBS(collist);
   while ((l_PBS = ((AliProfileBS*) all_PBS()))) {
+    if(l_PBS->fSubMoments) { //Lean subsamples are merged directly on the moment arrays
+      if(!fSubMoments) { fSubMoments = new AliProfileMoments(); fNSubs = l_PBS->fNSubs; };
+      fSubMoments->Add(l_PBS->fSubMoments);
+      nmerged++;
+      continue;
+    };
     TList *tarL = l_PBS->fListOfEntries;
     if(!tarL) continue;
     if(!fListOfEntries) {
@@ -100,6 +125,11 @@ TH1 *AliProfileBS::getHistRebinned(TProfile *inpf) {
 }
 void AliProfileBS::MergeBS(AliProfileBS *target) {
   this->Add(target);
+  if(target->fSubMoments) {
+    if(!fSubMoments) { fSubMoments = new AliProfileMoments(); fNSubs = target->fNSubs; };
+    fSubMoments->Add(target->fSubMoments);
+    return;
+  };
   TList *tarL = target->fListOfEntries;
   if(!fListOfEntries) {
     if(!target->fListOfEntries) return;
@@ -108,3 +138,13 @@ void AliProfileBS::MergeBS(AliProfileBS *target) {
   }
   for(Int_t i=0; i<fListOfEntries->GetEntries(); i++) ((TProfile*)fListOfEntries->At(i))->Add((TProfile*)tarL->At(i));
 }
+TProfile *AliProfileBS::MakeSubProfile(Int_t ind) {
+  if(ind<0 || ind>=fNSubs) { printf("Trying to fetch subprofile no %i out of %i, not possible\n",ind,fNSubs); return 0; };
+  if(!fSubMoments) return (fListOfEntries)?(TProfile*)fListOfEntries->At(ind)->Clone(Form("%s_Subpf%i",GetName(),ind)):0;
+  TProfile *reth = new TProfile();
+  TProfile::Copy(*reth); //Plain TProfile, without copying the moments
+  reth->SetName(Form("%s_Subpf%i",GetName(),ind));
+  reth->SetDirectory(0);
+  fSubMoments->Export(ind,reth);
+  return reth;
+}
@@ -6,6 +6,7 @@
 #include "TList.h"
 #include "TString.h"
 #include "TCollection.h"
+#include "AliProfileMoments.h"
 
 
 class AliProfileBS: public TProfile {
@@ -16,19 +17,22 @@ public:
   AliProfileBS(const char* name, const char* title, Int_t nbinsx, Double_t xlow, Double_t xup);
   TList *fListOfEntries;
   void MergeBS(AliProfileBS *target);
-  void InitializeSubsamples(Int_t nSub);
+  void InitializeSubsamples(Int_t nSub, Bool_t lean=kFALSE); //lean: subsamples kept as moment arrays instead of TProfiles
   void FillProfile(const Double_t &xv, const Double_t &yv, const Double_t &w, const Double_t &rn);
   void FillProfile(const Double_t &xv, const Double_t &yv, const Double_t &w);
   Long64_t Merge(TCollection *collist);
   void RebinMulti(Int_t nbins);
   void RebinMulti(Int_t nbins, Double_t *binedges);
   TH1 *getHist(Int_t ind=-1);
-  Int_t getNSubs() { return fListOfEntries->GetEntries(); };
-  ClassDef(AliProfileBS,1);
+  Int_t getNSubs() { return fSubMoments?fSubMoments->GetNSubs():(fListOfEntries?fListOfEntries->GetEntries():0); };
+  TProfile *MakeSubProfile(Int_t ind); //New TProfile for subsample ind, owned by the caller
+  Bool_t IsLean() { return fSubMoments!=0; };
+  ClassDef(AliProfileBS,2);
 protected:
   TH1* getHistRebinned(TProfile *inpf); //Performs rebinning, if required, and returns a projection of profile
   Bool_t fProfInitialized;
   Int_t fNSubs;
+  AliProfileMoments *fSubMoments; //Subsamples in lean mode
   Int_t fMultiRebin; //! externaly set runtime, no need to store
   Double_t *fMultiRebinEdges; //! externaly set runtime, no need to store
 };
@@ -0,0 +1,105 @@
+/*
+Author: Vytautas Vislavicius
+Extention of Generic Flow (https://arxiv.org/abs/1312.3572)
+*/
+#include "AliProfileMoments.h"
+AliProfileMoments::AliProfileMoments():
+  TObject(),
+  fNSub(0),
+  fNBins(0),
+  fSumW(),
+  fSumWY(),
+  fSumWY2(),
+  fSumW2()
+{
+};
+AliProfileMoments::AliProfileMoments(Int_t nSub, Int_t nBins):
+  TObject(),
+  fNSub(0),
+  fNBins(0),
+  fSumW(),
+  fSumWY(),
+  fSumWY2(),
+  fSumW2()
+{
+  Initialize(nSub,nBins);
+};
+AliProfileMoments::~AliProfileMoments() {
+};
+void AliProfileMoments::Initialize(Int_t nSub, Int_t nBins) {
+  if(nSub<1 || nBins<1) { printf("AliProfileMoments: number of subsamples and bins has to be > 0!\n"); return; };
+  fNSub = nSub;
+  fNBins = nBins;
+  fSumW.assign(nSub*nBins,0.);
+  fSumWY.assign(nSub*nBins,0.);
+  fSumWY2.assign(nSub*nBins,0.);
+  fSumW2.assign(nSub*nBins,0.);
+};
+void AliProfileMoments::Reset() {
+  std::fill(fSumW.begin(),fSumW.end(),0.);
+  std::fill(fSumWY.begin(),fSumWY.end(),0.);
+  std::fill(fSumWY2.begin(),fSumWY2.end(),0.);
+  std::fill(fSumW2.begin(),fSumW2.end(),0.);
+};
+Bool_t AliProfileMoments::Add(const AliProfileMoments *other) {
+  if(!other) return kFALSE;
+  if(!other->fNSub) return kTRUE; //Nothing to add
+  if(!fNSub) Initialize(other->fNSub,other->fNBins);
+  if(fNSub!=other->fNSub || fNBins!=other->fNBins) {
+    printf("AliProfileMoments::Add: incompatible subsamples (%i x %i vs. %i x %i), not adding\n",fNSub,fNBins,other->fNSub,other->fNBins);
+    return kFALSE;
+  };
+  const Int_t lSize = (Int_t)fSumW.size();
+  for(Int_t i=0;i<lSize;i++) {
+    fSumW[i]+=other->fSumW[i];
+    fSumWY[i]+=other->fSumWY[i];
+    fSumWY2[i]+=other->fSumWY2[i];
+    fSumW2[i]+=other->fSumW2[i];
+  };
+  return kTRUE;
+};
+void AliProfileMoments::RebinX(Int_t ngroup) {
+  if(ngroup<=1 || !fNSub) return;
+  Int_t nOld = fNBins-2; //without under- and overflow
+  Int_t nNew = nOld/ngroup;
+  if(nNew<1) { printf("AliProfileMoments::RebinX: cannot group %i bins by %i\n",nOld,ngroup); return; };
+  vector<Double_t> *arrs[] = {&fSumW, &fSumWY, &fSumWY2, &fSumW2};
+  for(Int_t ia=0;ia<4;ia++) {
+    vector<Double_t> lNew((nNew+2)*fNSub,0.);
+    for(Int_t is=0;is<fNSub;is++) {
+      const Double_t *lOld = arrs[ia]->data()+is*fNBins;
+      Double_t *lTar = lNew.data()+is*(nNew+2);
+      lTar[0] = lOld[0];
+      for(Int_t ib=1;ib<=nOld;ib++) {
+        Int_t lNewBin = (ib-1)/ngroup+1;
+        if(lNewBin>nNew) lNewBin = nNew+1; //Leftover bins go to the overflow, as in TH1::Rebin
+        lTar[lNewBin]+=lOld[ib];
+      };
+      lTar[nNew+1]+=lOld[nOld+1];
+    };
+    arrs[ia]->swap(lNew);
+  };
+  fNBins = nNew+2;
+};
+template <typename T> void AliProfileMoments::ExportToProfile(Int_t sub, T *target) const {
+  if(!target || sub<0 || sub>=fNSub) return;
+  if(target->GetNcells()!=fNBins) {
+    printf("AliProfileMoments::Export: target has %i bins, expected %i\n",target->GetNcells(),fNBins);
+    return;
+  };
+  target->Reset();
+  if(!target->GetBinSumw2()->fN) target->Sumw2();
+  Double_t *lArr = target->GetArray();
+  Double_t *lSumw2 = target->GetSumw2()->fArray;
+  Double_t *lBinSumw2 = target->GetBinSumw2()->fArray;
+  const Int_t lOffset = sub*fNBins;
+  for(Int_t i=0;i<fNBins;i++) {
+    target->SetBinEntries(i,fSumW[lOffset+i]);
+    lArr[i] = fSumWY[lOffset+i];
+    lSumw2[i] = fSumWY2[lOffset+i];
+    lBinSumw2[i] = fSumW2[lOffset+i];
+  };
+  target->ResetStats();
+};
+void AliProfileMoments::Export(Int_t sub, TProfile *target) const { ExportToProfile(sub,target); };
+void AliProfileMoments::Export(Int_t sub, TProfile2D *target) const { ExportToProfile(sub,target); };
@@ -0,0 +1,46 @@
+/*
+Author: Vytautas Vislavicius
+Extention of Generic Flow (https://arxiv.org/abs/1312.3572)
+*/
+#ifndef ALIPROFILEMOMENTS__H
+#define ALIPROFILEMOMENTS__H
+//Compact storage of subsample profiles: for each [subsample][bin], keeps sum(w), sum(w*y), sum(w*y^2) and sum(w^2)
+//in contiguous arrays. Full TProfile/TProfile2D objects are only created on demand, when reading out.
+#include "TObject.h"
+#include "TProfile.h"
+#include "TProfile2D.h"
+#include <vector>
+#include <algorithm>
+using std::vector;
+class AliProfileMoments: public TObject {
+public:
+  AliProfileMoments();
+  AliProfileMoments(Int_t nSub, Int_t nBins);
+  ~AliProfileMoments();
+  void Initialize(Int_t nSub, Int_t nBins);
+  void Fill(Int_t sub, Int_t bin, Double_t y, Double_t w) {
+    Int_t ind = sub*fNBins+bin;
+    fSumW[ind]+=w;
+    fSumWY[ind]+=w*y;
+    fSumWY2[ind]+=w*y*y;
+    fSumW2[ind]+=w*w;
+  };
+  Bool_t Add(const AliProfileMoments *other);
+  void Reset();
+  void RebinX(Int_t ngroup); //Same bin grouping as TH1::RebinX; only for 1D profiles (bins incl. under- and overflow)
+  void Export(Int_t sub, TProfile *target) const; //target must have the same binning; its contents are overwritten
+  void Export(Int_t sub, TProfile2D *target) const;
+  Int_t GetNSubs() const { return fNSub; };
+  Int_t GetNBins() const { return fNBins; };
+  Long64_t GetSizeInBytes() const { return 4*(Long64_t)fSumW.size()*sizeof(Double_t); };
+protected:
+  Int_t fNSub; //Number of subsamples
+  Int_t fNBins; //Number of bins per subsample (incl. under- and overflow)
+  vector<Double_t> fSumW; //sum of weights
+  vector<Double_t> fSumWY; //sum of w*y
+  vector<Double_t> fSumWY2; //sum of w*y^2
+  vector<Double_t> fSumW2; //sum of w^2
+  template <typename T> void ExportToProfile(Int_t sub, T *target) const;
+  ClassDef(AliProfileMoments,1);
+};
+#endif
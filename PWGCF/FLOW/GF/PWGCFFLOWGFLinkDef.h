@@ -16,6 +16,7 @@
 #pragma link C++ class AliGFW+;
 #pragma link C++ class AliGFWWeights+;
 #pragma link C++ class AliProfileSubset+;
+#pragma link C++ class AliProfileMoments+;
 #pragma link C++ class AliProfileBS+;
 #pragma link C++ class AliCkContainer+;
 #pragma link C++ class AliGFWFlowContainer+;
@@ -25,6 +26,7 @@
 #pragma link C++ class AliAnalysisTaskUniFlowMultiStrange+;
 #pragma link C++ class AliAnalysisDecorrTask+;
 #pragma link C++ class AliAnalysisTaskESEFlow+;
+#pragma link C++ class AliESEqnService+;
 #pragma link C++ class AliAnalysisTaskFlowSquareBracket+;
 #pragma link C++ class AliAnalysisTaskNonlinearFlow+;
 #pragma link C++ class CorrelationCalculator+;
@@ -38,6 +38,7 @@
 #include "AliDielectronCF.h"
 #include "AliDielectronMC.h"
 #include "AliDielectronMixingHandler.h"
+#include "AliDielectronVarCache.h"
 #include "AliAnalysisTaskMultiDielectron.h"
 
 ClassImp(AliAnalysisTaskMultiDielectron)
@@ -67,7 +68,9 @@ AliAnalysisTaskMultiDielectron::AliAnalysisTaskMultiDielectron() :
   fTRDTriggerClass(AliDielectronEventCuts::kSEorQU),
   fEventFilter(0x0),
   fEventStat(0x0),
-  fEventStatTRDTrigger(0x0)
+  fEventStatTRDTrigger(0x0),
+  fShareTrackValues(kFALSE),
+  fVarCache(0x0)
 {
   //
   // Constructor
@@ -99,7 +102,9 @@ AliAnalysisTaskMultiDielectron::AliAnalysisTaskMultiDielectron(const char *name)
   fTRDTriggerClass(AliDielectronEventCuts::kSEorQU),
   fEventFilter(0x0),
   fEventStat(0x0),
-  fEventStatTRDTrigger(0x0)
+  fEventStatTRDTrigger(0x0),
+  fShareTrackValues(kFALSE),
+  fVarCache(0x0)
 {
   //
   // Constructor
@@ -136,6 +141,7 @@ AliAnalysisTaskMultiDielectron::~AliAnalysisTaskMultiDielectron()
   if(fEventStat)       { delete fEventStat;       fEventStat=0; }
   if(fEventStatTRDTrigger){ delete fEventStatTRDTrigger;fEventStatTRDTrigger=0; }
   if(fTriggerAnalysis) { delete fTriggerAnalysis; fTriggerAnalysis=0; }
+  if(fVarCache)        { delete fVarCache;        fVarCache=0; }
 }
 //_________________________________________________________________________________
 void AliAnalysisTaskMultiDielectron::UserCreateOutputObjects()
@@ -367,6 +373,13 @@ void AliAnalysisTaskMultiDielectron::UserExec(Option_t *)
   AliDielectronPair::SetBeamEnergy(InputEvent(), fBeamEnergy);
   AliDielectronPair::SetRandomizeDaughters(fRandomizeDaughters);
 
+  // share the track variables of this event among all instances
+  if (fShareTrackValues) {
+    if (!fVarCache) fVarCache=new AliDielectronVarCache;
+    fVarCache->SetEvent(InputEvent());
+    AliDielectronVarManager::SetVarCache(fVarCache);
+  }
+
   //Process event in all AliDielectron instances
   //   TIter nextDie(&fListDielectron);
   //   AliDielectron *die=0;
@@ -393,6 +406,9 @@ void AliAnalysisTaskMultiDielectron::UserExec(Option_t *)
     ++idie;
   }
 
+  // other tasks must not see the cache of this event
+  if (fVarCache) AliDielectronVarManager::SetVarCache(0x0);
+
   PostData(1, &fListHistos);
   PostData(2, &fListCF);
   PostData(3,fEventStat);
@@ -414,6 +430,9 @@ void AliAnalysisTaskMultiDielectron::FinishTaskOutput()
   AliDielectron *die2=0;
   fPairArray=0x0;
 
+  if (fVarCache) AliInfo(Form("Shared track variables: %lld rows computed, %lld fills served from the cache",
+                              fVarCache->GetNMisses(), fVarCache->GetNHits()));
+
   // main loop
   while ( (die=static_cast<AliDielectron*>(nextDie())) ){
     ic++;
@@ -23,6 +23,7 @@
 // #include "AliDielectronPID.h"
 
 class AliDielectron;
+class AliDielectronVarCache;
 class TH1D;
 class AliAnalysisCuts;
 class AliTriggerAnalysis;
@@ -71,6 +72,9 @@ public:
 
   void SetEvtVsTrkHistoExists( Bool_t exists = kTRUE ) {fEvtVsTrkHistExists = exists;}
 
+  void SetShareTrackValues(Bool_t share=kTRUE) { fShareTrackValues=share; }
+  Bool_t GetShareTrackValues() const { return fShareTrackValues; }
+
 protected:
   enum {kAllEvents=0, kSelectedEvents, kV0andEvents,  kTrdTriggeredEvents, kTrdTriggeredEventsMatched, kFilteredEvents, kPileupEvents, kNbinsEvent};
   TObjArray *fPairArray;             //! output array
@@ -107,9 +111,12 @@ protected:
   TH1D *fEventStat;                  //! Histogram with event statistics
   TH1D *fEventStatTRDTrigger;           //! Histogram with TRD trigger statistics
 
+  Bool_t fShareTrackValues;          // compute the track variables once per event for all instances
+  AliDielectronVarCache *fVarCache;  //! per-event track variable cache shared by the instances
+
   AliAnalysisTaskMultiDielectron(const AliAnalysisTaskMultiDielectron &c);
   AliAnalysisTaskMultiDielectron& operator= (const AliAnalysisTaskMultiDielectron &c);
 
-  ClassDef(AliAnalysisTaskMultiDielectron, 4); //Analysis Task handling multiple instances of AliDielectron
+  ClassDef(AliAnalysisTaskMultiDielectron, 5); //Analysis Task handling multiple instances of AliDielectron
 };
 #endif
@@ -169,6 +169,11 @@ AliDielectron::AliDielectron() :
   fDontClearArrays(kFALSE),
   fEventProcess(kTRUE),
   fUseGammaTracks(kTRUE),
+  fDeferPairKF(kFALSE),
+  fFastPairMassMin(0.),
+  fFastPairMassMax(0.),
+  fFastPairPtMin(0.),
+  fFastPairPtMax(1e30),
   fEstimatorFilename(""),
   fEstimatorObjArray(0x0),
   fTRDpidCorrectionFilename(""),
@@ -264,6 +269,11 @@ AliDielectron::AliDielectron(const char* name, const char* title) :
   fDontClearArrays(kFALSE),
   fEventProcess(kTRUE),
   fUseGammaTracks(kTRUE),
+  fDeferPairKF(kFALSE),
+  fFastPairMassMin(0.),
+  fFastPairMassMax(0.),
+  fFastPairPtMin(0.),
+  fFastPairPtMax(1e30),
   fEstimatorFilename(""),
   fEstimatorObjArray(0x0),
   fTRDpidCorrectionFilename(""),
@@ -351,6 +361,9 @@ void AliDielectron::Init()
       fTrackRotator->SetTrackArrays(&fTracks[0],&fTracks[1]);
     }
     fTrackRotator->SetPdgLegs(fPdgLeg1,fPdgLeg2);
+    //the fast pair pre-selection also defines the window of the fast track rotation
+    if (fFastPairMassMin<fFastPairMassMax)
+      fTrackRotator->SetFastPairWindow(fFastPairMassMin,fFastPairMassMax,fFastPairPtMin,fFastPairPtMax);
   }
   if (fDebugTree) fDebugTree->SetDielectron(this);
 
@@ -492,6 +505,10 @@ Bool_t AliDielectron::Process(AliVEvent *ev1, AliVEvent *ev2)
   AliDielectronVarManager::SetLegEffMap(fLegEffMap);
   AliDielectronVarManager::SetPairEffMap(fPairEffMap);
 
+  // settings entering the track variables select the slot of a shared track variable cache
+  if (AliDielectronVarManager::GetVarCache())
+    AliDielectronVarManager::GetVarCache()->SetSettingsTag(AliDielectronPID::GetCorrectionHash() ^ TString::Hash(&fLegEffMap, sizeof(fLegEffMap)));
+
   //in case we have MC load the MC event and process the MC particles
   // why do not apply the event cuts first ????
   if (AliDielectronMC::Instance()->ConnectMCEvent()){
@@ -822,6 +839,8 @@ void AliDielectron::FillHistograms(const AliVEvent *ev, Bool_t pairInfoOnly)
       Bool_t mergedtrkClass=fHistos->GetHistogramList()->FindObject(className2.Data())!=0x0;
       Bool_t trkClass=fHistos->GetHistogramList()->FindObject(className.Data())!=0x0;
       if (!trkClass && !mergedtrkClass) continue;
+      const Int_t trkHandle=trkClass ? fHistos->GetClassHandle(className) : -1;
+      const Int_t mergedtrkHandle=mergedtrkClass ? fHistos->GetClassHandle(className2) : -1;
 
       Double_t ntracks; 
       Double_t nPos = fTracks[0].GetEntriesFast();
@@ -852,9 +871,9 @@ void AliDielectron::FillHistograms(const AliVEvent *ev, Bool_t pairInfoOnly)
           AliDielectronVarManager::Fill(part, values);
         }
         if(trkClass)
-          fHistos->FillClass(className, AliDielectronVarManager::kNMaxValues, values);
+          fHistos->FillClass(trkHandle, values);
         if(mergedtrkClass && i<2)
-          fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values); //only ev1
+          fHistos->FillClass(mergedtrkHandle, values); //only ev1
       }
     }
   }
@@ -867,6 +886,8 @@ void AliDielectron::FillHistograms(const AliVEvent *ev, Bool_t pairInfoOnly)
     Bool_t pairClass=fHistos->GetHistogramList()->FindObject(className.Data())!=0x0;
     Bool_t legClass=fHistos->GetHistogramList()->FindObject(className2.Data())!=0x0;
     if (!pairClass&&!legClass) continue;
+    const Int_t pairHandle=pairClass ? fHistos->GetClassHandle(className) : -1;
+    const Int_t legHandle=legClass ? fHistos->GetClassHandle(className2) : -1;
     Int_t ntracks=PairArray(i)->GetEntriesFast();
     for (Int_t ipair=0; ipair<ntracks; ++ipair){
       AliDielectronPair *pair=static_cast<AliDielectronPair*>(PairArray(i)->UncheckedAt(ipair));
@@ -874,7 +895,7 @@ void AliDielectron::FillHistograms(const AliVEvent *ev, Bool_t pairInfoOnly)
       //fill pair information
       if (pairClass){
         AliDielectronVarManager::Fill(pair, values);
-        fHistos->FillClass(className, AliDielectronVarManager::kNMaxValues, values);
+        fHistos->FillClass(pairHandle, values);
       }
 
       //fill leg information, don't fill the information twice
@@ -883,12 +904,12 @@ void AliDielectron::FillHistograms(const AliVEvent *ev, Bool_t pairInfoOnly)
         AliVParticle *d2=pair->GetSecondDaughterP();
         if (!arrLegs.FindObject(d1)){
           AliDielectronVarManager::Fill(d1, values);
-          fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+          fHistos->FillClass(legHandle, values);
           arrLegs.Add(d1);
         }
         if (!arrLegs.FindObject(d2)){
           AliDielectronVarManager::Fill(d2, values);
-          fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+          fHistos->FillClass(legHandle, values);
           arrLegs.Add(d2);
         }
       }
@@ -1510,13 +1531,24 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
 
   UInt_t selectedMask=(1<<fPairFilter.GetCuts()->GetEntries())-1;
 
+  const Bool_t fastCut=fFastPairMassMin<fFastPairMassMax;
+  const Bool_t deferKF=fDeferPairKF||fastCut;
+  TLorentzVector fastMom;
+
   for (Int_t itrack1=0; itrack1<ntrack1; ++itrack1){
     Int_t end=ntrack2;
     if (arr1==arr2) end=itrack1;
     for (Int_t itrack2=0; itrack2<end; ++itrack2){
       //create the pair (direct pointer to the memory by this daughter reference are kept also for ME)
       candidate->SetTracks(&(*static_cast<AliVTrack*>(arrTracks1.UncheckedAt(itrack1))), fPdgLeg1,
-                           &(*static_cast<AliVTrack*>(arrTracks2.UncheckedAt(itrack2))), fPdgLeg2);
+                           &(*static_cast<AliVTrack*>(arrTracks2.UncheckedAt(itrack2))), fPdgLeg2, deferKF);
+
+      //fast pre-selection before the KF particles are constructed
+      if (fastCut){
+        candidate->GetFastMomentum(fastMom);
+        if (fastMom.M()<fFastPairMassMin || fastMom.M()>=fFastPairMassMax ||
+            fastMom.Pt()<fFastPairPtMin  || fastMom.Pt()>=fFastPairPtMax) continue;
+      }
       candidate->SetType(pairIndex);
 
       Int_t label=AliDielectronMC::Instance()->GetLabelMotherWithPdg(candidate,fPdgMother);
@@ -1550,6 +1582,8 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
       //histogram array for the pair
       if (fHistoArray) fHistoArray->Fill(pairIndex,candidate);
 
+      //stored pairs are always complete
+      candidate->BuildKF();
       //add the candidate to the candidate array
       PairArray(pairIndex)->Add(candidate);
       //get a new candidate
@@ -2403,6 +2437,8 @@ void AliDielectron::FillHistogramsFromPairArray(Bool_t pairInfoOnly/*=kFALSE*/)
   AliDielectronVarManager::SetFillMap(fUsedVars);
   AliDielectronVarManager::SetLegEffMap(fLegEffMap);
   AliDielectronVarManager::SetPairEffMap(fPairEffMap);
+  if (AliDielectronVarManager::GetVarCache())
+    AliDielectronVarManager::GetVarCache()->SetSettingsTag(AliDielectronPID::GetCorrectionHash() ^ TString::Hash(&fLegEffMap, sizeof(fLegEffMap)));
 
   //Fill event information
   if(!pairInfoOnly) {
@@ -209,6 +209,9 @@ public:
   void SetEventProcess(Bool_t setValue=kTRUE) { fEventProcess=setValue; }
   Bool_t GammaTracksUsed() const { return fUseGammaTracks; }
   void SetUseGammaTracks(Bool_t setValue=kTRUE) { fUseGammaTracks=setValue; }
+  void SetDeferPairKF(Bool_t setValue=kTRUE) { fDeferPairKF=setValue; }
+  void SetFastPairCut(Double_t massMin, Double_t massMax, Double_t ptMin=0., Double_t ptMax=1e30)
+    { fFastPairMassMin=massMin; fFastPairMassMax=massMax; fFastPairPtMin=ptMin; fFastPairPtMax=ptMax; }
   void  FillHistogramsFromPairArray(Bool_t pairInfoOnly=kFALSE);
 
   void FinishEvtVsTrkHistoClass();
@@ -310,6 +313,11 @@ private:
   Bool_t fDontClearArrays;      //Don't clear the arrays at the end of the Process function, needed for external use of pair and tracks
   Bool_t fEventProcess;         //Process event (or pair array)
   Bool_t fUseGammaTracks;       // use function SetGammaTracks for MCtruth photons
+  Bool_t fDeferPairKF;          // construct the pair KF particle only when needed by the pair cuts or for accepted pairs
+  Double_t fFastPairMassMin;    // fast pair pre-selection on the track 4-vector sum, off if min>=max
+  Double_t fFastPairMassMax;    // fast pair pre-selection on the track 4-vector sum
+  Double_t fFastPairPtMin;      // fast pair pre-selection on the track 4-vector sum
+  Double_t fFastPairPtMax;      // fast pair pre-selection on the track 4-vector sum
 
   void FillTrackArrays(AliVEvent * const ev, Int_t eventNr=0);
   void EventPlanePreFilter(Int_t arr1, Int_t arr2, TObjArray arrTracks1, TObjArray arrTracks2, const AliVEvent *ev);
@@ -353,7 +361,7 @@ private:
   AliDielectron(const AliDielectron &c);
   AliDielectron &operator=(const AliDielectron &c);
 
-  ClassDef(AliDielectron,19);
+  ClassDef(AliDielectron,20);
 };
 
 inline void AliDielectron::InitPairCandidateArrays()
@@ -60,6 +60,7 @@ AliDielectronCF::AliDielectronCF() :
   fVarBinLimitsLeg(0x0),
   fNCuts(0),
   fValues(0x0),
+  fFillSteps(0x0),
   fIsMCTruth(0x0),
   fStepForMCtruth(kFALSE),
   fStepForNoCutsMCmotherPid(kFALSE),
@@ -75,7 +76,8 @@ AliDielectronCF::AliDielectronCF() :
   fSignalsMC(0x0),
   fCfContainer(0x0),
   fHasMC(kFALSE),
-  fNAddSteps(0)
+  fNAddSteps(0),
+  fUseDenseBinIndex(kFALSE)
 {
   //
   // Default constructor
@@ -101,6 +103,7 @@ AliDielectronCF::AliDielectronCF(const char* name, const char* title) :
   fVarBinLimitsLeg(0x0),
   fNCuts(0),
   fValues(0x0),
+  fFillSteps(0x0),
   fIsMCTruth(0x0),
   fStepForMCtruth(kFALSE),
   fStepForNoCutsMCmotherPid(kFALSE),
@@ -116,7 +119,8 @@ AliDielectronCF::AliDielectronCF(const char* name, const char* title) :
   fSignalsMC(0x0),
   fCfContainer(0x0),
   fHasMC(kFALSE),
-  fNAddSteps(0)
+  fNAddSteps(0),
+  fUseDenseBinIndex(kFALSE)
 {
   //
   // Named constructor
@@ -139,6 +143,7 @@ AliDielectronCF::~AliDielectronCF()
   //
   if (fUsedVars) delete fUsedVars;
   if (fValues) delete [] fValues;
+  if (fFillSteps) delete [] fFillSteps;
   if (fIsMCTruth) delete [] fIsMCTruth;
   if (fVarBinLimits) delete fVarBinLimits;
   if (fVarBinLimitsLeg) delete fVarBinLimitsLeg;
@@ -297,6 +302,9 @@ void AliDielectronCF::InitialiseContainer(const AliAnalysisFilter& filter)
 
   // array for storing values
   fValues = new Double_t[fNVars+2*fNVarsLeg];
+  // array for storing the steps passed by a pair
+  fFillSteps = new Int_t[fNSteps];
+  if (fUseDenseBinIndex) fCfContainer->SetUseDenseIndex(kTRUE);
 
   // array for storing MC info
   if (fHasMC && fSignalsMC && fSignalsMC->GetEntries()>0) fIsMCTruth=new Bool_t[fSignalsMC->GetEntries()];
@@ -488,14 +496,16 @@ void AliDielectronCF::Fill(UInt_t mask, const AliDielectronPair *particle)
   // Fill steps //
   //============//
   // Pure MC steps are handled in FillMC
+  // the passed steps are collected and filled in one go
   Int_t step=0;
+  Int_t nFill=0;
   if (fStepForMCtruth && fIsMCTruth) step+=fSignalsMC->GetEntries();
   
   //No cuts (MC truth)
   if (fStepForNoCutsMCmotherPid && fIsMCTruth){
     for(Int_t i=0; i<fSignalsMC->GetEntries(); ++i) {
       if(fIsMCTruth[i]) {
-        fCfContainer->Fill(fValues,step);
+        fFillSteps[nFill++]=step;
       }
       ++step;
     }
@@ -507,20 +517,20 @@ void AliDielectronCF::Fill(UInt_t mask, const AliDielectronPair *particle)
       UInt_t cutMask=1<<iCut;
       if ((mask&cutMask)==cutMask) {
         if(!fStepsForMCtruthOnly) {
-          fCfContainer->Fill(fValues,step);
+          fFillSteps[nFill++]=step;
           ++step;
         }
         if (fHasMC){
           if ( fStepsForSignal && fIsMCTruth){
             for(Int_t i=0; i<fSignalsMC->GetEntries(); ++i) {
               if(fIsMCTruth[i]) {
-                fCfContainer->Fill(fValues,step);
+                fFillSteps[nFill++]=step;
               }
               ++step;
             }
           }
           if ( fStepsForBackground ){
-            if (isBackground) fCfContainer->Fill(fValues,step);
+            if (isBackground) fFillSteps[nFill++]=step;
             ++step;
           }
         }
@@ -537,7 +547,7 @@ void AliDielectronCF::Fill(UInt_t mask, const AliDielectronPair *particle)
       UInt_t cutMask=(1<<(iCut+1))-1;
       if ((mask&cutMask)==cutMask) {
         if(!fStepsForMCtruthOnly) {
-          fCfContainer->Fill(fValues,step);
+          fFillSteps[nFill++]=step;
           ++step;
         }
 
@@ -545,13 +555,13 @@ void AliDielectronCF::Fill(UInt_t mask, const AliDielectronPair *particle)
           if ( fStepsForSignal && fIsMCTruth){
             for(Int_t i=0; i<fSignalsMC->GetEntries(); ++i) {
               if(fIsMCTruth[i]) {
-                fCfContainer->Fill(fValues,step);
+                fFillSteps[nFill++]=step;
               }
               ++step;
             }
           }
           if ( fStepsForBackground ){
-            if (isBackground) fCfContainer->Fill(fValues,step);
+            if (isBackground) fFillSteps[nFill++]=step;
             ++step;
           }
         }
@@ -566,20 +576,20 @@ void AliDielectronCF::Fill(UInt_t mask, const AliDielectronPair *particle)
     UInt_t userMask=fStepMasks[iComb];
     if ((mask&userMask)==userMask) {
       if(!fStepsForMCtruthOnly) {
-        fCfContainer->Fill(fValues,step);
+        fFillSteps[nFill++]=step;
         ++step;
       }
       if (fHasMC){
         if ( fStepsForSignal && fIsMCTruth){
           for(Int_t i=0; i<fSignalsMC->GetEntries(); ++i) {
             if(fIsMCTruth[i]) {
-              fCfContainer->Fill(fValues,step);
+              fFillSteps[nFill++]=step;
             }
             ++step;
           }
         }
         if ( fStepsForBackground ){
-          if (isBackground) fCfContainer->Fill(fValues,step);
+          if (isBackground) fFillSteps[nFill++]=step;
           ++step;
         }
       }
@@ -592,7 +602,7 @@ void AliDielectronCF::Fill(UInt_t mask, const AliDielectronPair *particle)
   if (fStepForAfterAllCuts){
     if (mask == selectedMask){
       if(!fStepsForMCtruthOnly) {
-        fCfContainer->Fill(fValues,step);
+        fFillSteps[nFill++]=step;
         ++step;
       }
 
@@ -600,13 +610,13 @@ void AliDielectronCF::Fill(UInt_t mask, const AliDielectronPair *particle)
         if ( fStepsForSignal && fIsMCTruth){
           for(Int_t i=0; i<fSignalsMC->GetEntries(); ++i) {
             if(fIsMCTruth[i]) {
-              fCfContainer->Fill(fValues,step);
+              fFillSteps[nFill++]=step;
             }
             ++step;
           }
         }
         if ( fStepsForBackground ){
-          if (isBackground) fCfContainer->Fill(fValues,step);
+          if (isBackground) fFillSteps[nFill++]=step;
           ++step;
         }
       }
@@ -619,20 +629,20 @@ void AliDielectronCF::Fill(UInt_t mask, const AliDielectronPair *particle)
   if (fStepForPreFilter) {
     if (mask&(1<<fNCuts)) {
       if(!fStepsForMCtruthOnly) {
-        fCfContainer->Fill(fValues,step);
+        fFillSteps[nFill++]=step;
         ++step;
       }
       if (fHasMC){
         if ( fStepsForSignal && fIsMCTruth){
           for(Int_t i=0; i<fSignalsMC->GetEntries(); ++i) {
             if(fIsMCTruth[i]) {
-              fCfContainer->Fill(fValues,step);
+              fFillSteps[nFill++]=step;
             }
             ++step;
           }
         }
         if ( fStepsForBackground ){
-          if (isBackground) fCfContainer->Fill(fValues,step);
+          if (isBackground) fFillSteps[nFill++]=step;
           ++step;
         }
       }
@@ -645,6 +655,7 @@ void AliDielectronCF::Fill(UInt_t mask, const AliDielectronPair *particle)
   if (step!=fNSteps) {
     AliError("Something went wrong in the step filling!!!");
   }
+  fCfContainer->FillSteps(fValues,fFillSteps,nFill);
 }
 
 //________________________________________________________________
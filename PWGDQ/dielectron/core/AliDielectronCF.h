@@ -50,6 +50,7 @@ public:
   void SetStepsForSignal(Bool_t steps=kTRUE)           { fStepsForSignal=steps;           }
   void SetStepsForBackground(Bool_t steps=kTRUE)       { fStepsForBackground=steps;       }
   void SetStepsForMCtruthOnly(Bool_t steps=kTRUE)      { fStepsForMCtruthOnly=steps;       }
+  void SetUseDenseBinIndex(Bool_t use=kTRUE)           { fUseDenseBinIndex=use;           } // for containers with few bins
   
   void SetPdgMother(Int_t pdg) { fPdgMother=pdg; }
   void SetSignalsMC(TObjArray* array)    {fSignalsMC = array;}
@@ -93,6 +94,7 @@ private:
   Int_t           fNCuts;                      // Number of cuts in the filter concerned
 
   Double_t        *fValues;                    //! Value array for filling the container
+  Int_t           *fFillSteps;                 //! Steps passed by the current pair
   Bool_t          *fIsMCTruth;                 //! Buffer array for MC truth information
   
   Bool_t fStepForMCtruth;               //create a step for the MC truth
@@ -115,6 +117,7 @@ private:
 
   Bool_t fHasMC;                         //if MC info is available
   Int_t  fNAddSteps;                     //number of additional MC related steps per cut step
+  Bool_t fUseDenseBinIndex;              //use the dense bin index of the CF container grids
 
   TVectorD* MakeLogBinning(Int_t nbinsX, Double_t xmin, Double_t xmax) const;
   TVectorD* MakeLinBinning(Int_t nbinsX, Double_t xmin, Double_t xmax) const;
@@ -122,7 +125,7 @@ private:
   AliDielectronCF(const AliDielectronCF &c);
   AliDielectronCF &operator=(const AliDielectronCF &c);
   
-  ClassDef(AliDielectronCF,5)  //Dielectron Correction Framework handler
+  ClassDef(AliDielectronCF,6)  //Dielectron Correction Framework handler
 };
 
 #endif
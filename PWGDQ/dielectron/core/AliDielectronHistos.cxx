@@ -61,7 +61,8 @@ AliDielectronHistos::AliDielectronHistos() :
   fHistoList(),
   fList(0x0),
   fUsedVars(new TBits(AliDielectronVarManager::kNMaxValues)),
-  fReservedWords(new TString)
+  fReservedWords(new TString),
+  fHandles()
 {
   //
   // Default constructor
@@ -77,7 +78,8 @@ AliDielectronHistos::AliDielectronHistos(const char* name, const char* title) :
   fHistoList(),
   fList(0x0),
   fUsedVars(new TBits(AliDielectronVarManager::kNMaxValues)),
-  fReservedWords(new TString)
+  fReservedWords(new TString),
+  fHandles()
 {
   //
   // TNamed constructor
@@ -794,13 +796,164 @@ void AliDielectronHistos::FillClass(const char* histClass, Int_t nValues, const
     return;
   }
 
-  TIter nextHist(classTable);
-  TObject *obj=0;
-  while ( (obj=(TObject*)nextHist()) )  FillValues(obj, values);
+  Int_t handle=Int_t(classTable->GetUniqueID())-1;
+  if (handle<0 || handle>=(Int_t)fHandles.size() || fHandles[handle].fList!=classTable)
+    handle=GetClassHandle(histClass);
+  FillClass(handle, values);
 
   return;
 }
 
+//_____________________________________________________________________________
+Int_t AliDielectronHistos::GetClassHandle(const char* histClass)
+{
+  //
+  // Register class 'histClass' for filling with FillClass(handle, values)
+  // the histograms are resolved into (histogram, variables, weight) once,
+  // the handle stays valid if histograms are added or the list is exchanged
+  //
+  THashList *classTable=(THashList*)fHistoList.FindObject(histClass);
+  if (classTable){
+    Int_t handle=Int_t(classTable->GetUniqueID())-1;
+    if (handle>=0 && handle<(Int_t)fHandles.size() && fHandles[handle].fList==classTable) return handle;
+  }
+  for (UInt_t i=0; i<fHandles.size(); ++i){
+    if (fHandles[i].fName!=histClass) continue;
+    fHandles[i].fList=0x0;
+    if (classTable) classTable->SetUniqueID(i+1);
+    return i;
+  }
+
+  Int_t handle=fHandles.size();
+  fHandles.push_back(ClassHandle());
+  fHandles[handle].fName=histClass;
+  fHandles[handle].fList=0x0;
+  fHandles[handle].fNHists=0;
+  if (classTable) classTable->SetUniqueID(handle+1);
+  return handle;
+}
+
+//_____________________________________________________________________________
+void AliDielectronHistos::FillClass(Int_t handle, const Double_t *values)
+{
+  //
+  // Fill class registered with GetClassHandle
+  //
+  if (handle<0 || handle>=(Int_t)fHandles.size()) return;
+  ClassHandle &ch=fHandles[handle];
+  if (!ch.fList || ch.fList->GetEntries()!=ch.fNHists){
+    ch.fList=(THashList*)fHistoList.FindObject(ch.fName);
+    if (!ch.fList) return;
+    ch.fList->SetUniqueID(handle+1);
+    ResolveHandle(ch);
+  }
+
+  Double_t fill[20];
+  const UInt_t *vars=ch.fVars.empty() ? 0x0 : &ch.fVars[0];
+  for (std::vector<FillEntry>::const_iterator it=ch.fEntries.begin(); it!=ch.fEntries.end(); ++it){
+    const UInt_t *v=vars+it->fFirstVar;
+    const Bool_t weight=(it->fVarW>=0);
+    switch (it->fType){
+    case kFillTH1:
+      if (weight) ((TH1*)it->fObj)->Fill(values[v[0]], values[it->fVarW]);
+      else        ((TH1*)it->fObj)->Fill(values[v[0]]);
+      break;
+    case kFillTH2:
+      if (weight) ((TH2*)it->fObj)->Fill(values[v[0]], values[v[1]], values[it->fVarW]);
+      else        ((TH2*)it->fObj)->Fill(values[v[0]], values[v[1]]);
+      break;
+    case kFillTH3:
+      if (weight) ((TH3*)it->fObj)->Fill(values[v[0]], values[v[1]], values[v[2]], values[it->fVarW]);
+      else        ((TH3*)it->fObj)->Fill(values[v[0]], values[v[1]], values[v[2]]);
+      break;
+    case kFillProfile:
+      if (weight) ((TProfile*)it->fObj)->Fill(values[v[0]], values[v[1]], values[it->fVarW]);
+      else        ((TProfile*)it->fObj)->Fill(values[v[0]], values[v[1]]);
+      break;
+    case kFillProfile2D:
+      if (weight) ((TProfile2D*)it->fObj)->Fill(values[v[0]], values[v[1]], values[v[2]], values[it->fVarW]);
+      else        ((TProfile2D*)it->fObj)->Fill(values[v[0]], values[v[1]], values[v[2]]);
+      break;
+    case kFillProfile3D:
+      ((TProfile3D*)it->fObj)->Fill(values[v[0]], values[v[1]], values[v[2]], values[v[3]]);
+      break;
+    case kFillTHn:
+      for (Int_t i=0; i<it->fNVars; ++i) fill[i]=values[v[i]];
+      if (weight) ((THnBase*)it->fObj)->Fill(fill, values[it->fVarW]);
+      else        ((THnBase*)it->fObj)->Fill(fill);
+      break;
+    default:
+      FillValues(it->fObj, values);
+      break;
+    }
+  }
+}
+
+//_____________________________________________________________________________
+void AliDielectronHistos::ResolveHandle(ClassHandle &handle) const
+{
+  //
+  // decode the variables stored in the axes of all histograms in the class,
+  // same logic as in FillValues. Inclusive trigger maps and TProfile3Ds
+  // with weights are filled via FillValues
+  //
+  handle.fEntries.clear();
+  handle.fVars.clear();
+  handle.fNHists=handle.fList->GetEntries();
+
+  TIter nextHist(handle.fList);
+  TObject *obj=0;
+  while ( (obj=(TObject*)nextHist()) ){
+    UInt_t valueTypes=obj->GetUniqueID();
+    if (valueTypes==(UInt_t)AliDielectronHistos::kNoAutoFill) continue;
+
+    FillEntry entry;
+    entry.fObj=obj;
+    entry.fType=kFillGeneric;
+    entry.fFirstVar=handle.fVars.size();
+    entry.fNVars=0;
+    entry.fVarW=(valueTypes!=kNoWeights ? (Int_t)valueTypes : -1);
+
+    UInt_t vars[20];
+    if (obj->InheritsFrom(TH1::Class())){
+      TH1 *h=static_cast<TH1*>(obj);
+      Bool_t bprf=(h->IsA()==TProfile::Class() || h->IsA()==TProfile2D::Class() || h->IsA()==TProfile3D::Class());
+      vars[0]=h->GetXaxis()->GetUniqueID();
+      vars[1]=h->GetYaxis()->GetUniqueID();
+      vars[2]=h->GetZaxis()->GetUniqueID();
+      vars[3]=valueTypes;
+
+      Bool_t trigger=kFALSE;
+      for (Int_t i=0; i<4; ++i)
+        trigger|=(vars[i]==AliDielectronVarManager::kTriggerInclONL || vars[i]==AliDielectronVarManager::kTriggerInclOFF);
+
+      if (!trigger){
+        switch (h->GetDimension()){
+        case 1: entry.fType=bprf ? kFillProfile   : kFillTH1; entry.fNVars=bprf ? 2 : 1; break;
+        case 2: entry.fType=bprf ? kFillProfile2D : kFillTH2; entry.fNVars=bprf ? 3 : 2; break;
+        case 3:
+          if (!bprf){ entry.fType=kFillTH3; entry.fNVars=3; }
+          else { entry.fType=kFillProfile3D; entry.fNVars=4; entry.fVarW=-1; }
+          break;
+        default: continue;
+        }
+      }
+    } else if (obj->InheritsFrom(THnBase::Class())){
+      THnBase *h=static_cast<THnBase*>(obj);
+      if (h->GetNdimensions()<=20){
+        entry.fType=kFillTHn;
+        entry.fNVars=h->GetNdimensions();
+        for (Int_t i=0; i<entry.fNVars; ++i) vars[i]=h->GetAxis(i)->GetUniqueID();
+      }
+    } else {
+      continue;
+    }
+
+    handle.fVars.insert(handle.fVars.end(), vars, vars+entry.fNVars);
+    handle.fEntries.push_back(entry);
+  }
+}
+
 //_____________________________________________________________________________
 // void AliDielectronHistos::FillClass(const char* histClass, const TVectorD &vals)
 // {
@@ -22,9 +22,11 @@
 #include <TVectorDfwd.h>
 #include <THnBase.h>
 #include <TBits.h>
+#include <TString.h>
+
+#include <vector>
 
 class TH1;
-class TString;
 class TList;
 // class TVectorT<double>;
 
@@ -148,6 +150,8 @@ public:
   
 //   void FillClass(const char* histClass, const TVectorD &vals);
   void FillClass(const char* histClass, Int_t nValues, const Double_t *values);
+  Int_t GetClassHandle(const char* histClass);
+  void FillClass(Int_t handle, const Double_t *values);
   
   TObject* GetHist(const char* histClass, const char* name) const;
   TH1* GetHistogram(const char* histClass, const char* name) const;
@@ -155,7 +159,7 @@ public:
   TH1* GetHistogram(const char* cutClass, const char* histClass, const char* name) const;
 
   void SetHistogramList(THashList &list, Bool_t setOwner=kTRUE);
-  void ResetHistogramList(){fHistoList.Clear();}
+  void ResetHistogramList(){fHistoList.Clear(); ClearHandles();}
   const THashList* GetHistogramList() const {return &fHistoList;}
 
   void SetList(TList * const list) { fList=list; }
@@ -199,6 +203,27 @@ private:
 	TBits     *fUsedVars;            // list of used variables
 
   TString *fReservedWords;          //! list of reserved words
+
+  // histogram of a class with its decoded variables, see ResolveHandle
+  enum EFillType {kFillGeneric=0, kFillTH1, kFillTH2, kFillTH3, kFillProfile, kFillProfile2D, kFillProfile3D, kFillTHn};
+  struct FillEntry {
+    TObject *fObj;      // histogram
+    Int_t    fType;     // EFillType
+    Int_t    fFirstVar; // position of the first axis variable in ClassHandle::fVars
+    Int_t    fNVars;    // number of axis variables
+    Int_t    fVarW;     // weight variable, -1 if not weighted
+  };
+  struct ClassHandle {
+    TString    fName;                // class name
+    THashList *fList;                // class table, 0 if not resolved
+    Int_t      fNHists;              // number of histograms in the table when it was resolved
+    std::vector<FillEntry> fEntries; // histograms to be filled
+    std::vector<UInt_t> fVars;       // axis variables of all histograms
+  };
+  std::vector<ClassHandle> fHandles; //! classes resolved for filling, the handle is stored in the table unique ID
+
+  void ResolveHandle(ClassHandle &handle) const;
+  void ClearHandles() { for (std::vector<ClassHandle>::iterator it=fHandles.begin(); it!=fHandles.end(); ++it) it->fList=0x0; }
   void UserHistogramReservedWords(const char* histClass, const TObject *hist, UInt_t valTypes);
   void FillClass(THashTable *classTable, Int_t nValues, Double_t *values);
   
@@ -211,7 +236,7 @@ private:
   AliDielectronHistos(const AliDielectronHistos &hist);
   AliDielectronHistos& operator = (const AliDielectronHistos &hist);
 
-  ClassDef(AliDielectronHistos,4)
+  ClassDef(AliDielectronHistos,5)
 };
 
 #endif
@@ -825,6 +825,23 @@ void AliDielectronPID::SetCorrVal(Double_t run)
   }
 }
 
+//______________________________________________
+UInt_t AliDielectronPID::GetCorrectionHash()
+{
+  //
+  // hash of the static corrections entering the n-sigma values,
+  // used to separate the cached track variables of differently configured instances
+  //
+  const void *objects[] = { fgFitCorr, fgFunEtaCorr, fgFunCntrdCorr, fgFunWdthCorr, fgFunCntrdCorrITS,
+                            fgFunWdthCorrITS, fgFunCntrdCorrTOF, fgFunWdthCorrTOF, fgdEdxRunCorr };
+  UInt_t hash=TString::Hash(objects, sizeof(objects));
+  hash^=TString::Hash(fgFunCntrdCorrPU, sizeof(fgFunCntrdCorrPU))*3;
+  hash^=TString::Hash(fgFunWdthCorrPU, sizeof(fgFunWdthCorrPU))*5;
+  const Double_t values[] = { fgCorr, fgCorrdEdx, (Double_t)fgPIDCalibinPU };
+  hash^=TString::Hash(values, sizeof(values))*7;
+  return hash;
+}
+
 //______________________________________________
 Double_t AliDielectronPID::GetEtaCorr(const AliVTrack *track)
 {
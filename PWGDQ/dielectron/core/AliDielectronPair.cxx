@@ -44,7 +44,13 @@ AliDielectronPair::AliDielectronPair() :
   fD2(),
   fRefD1(),
   fRefD2(),
-  fKFUsage(kTRUE)
+  fKFUsage(kTRUE),
+  fKFBuilt(kTRUE),
+  fTrack1(0x0),
+  fTrack2(0x0),
+  fPid1(0),
+  fPid2(0),
+  fSwapped(kFALSE)
 {
   //
   // Default Constructor
@@ -63,7 +69,13 @@ AliDielectronPair::AliDielectronPair(AliVTrack * const particle1, Int_t pid1,
   fD2(),
   fRefD1(),
   fRefD2(),
-  fKFUsage(kTRUE)
+  fKFUsage(kTRUE),
+  fKFBuilt(kTRUE),
+  fTrack1(0x0),
+  fTrack2(0x0),
+  fPid1(0),
+  fPid2(0),
+  fSwapped(kFALSE)
 {
   //
   // Constructor with tracks
@@ -84,7 +96,13 @@ AliDielectronPair::AliDielectronPair(const AliKFParticle * const particle1,
   fD2(),
   fRefD1(),
   fRefD2(),
-  fKFUsage(kTRUE)
+  fKFUsage(kTRUE),
+  fKFBuilt(kTRUE),
+  fTrack1(0x0),
+  fTrack2(0x0),
+  fPid1(0),
+  fPid2(0),
+  fSwapped(kFALSE)
 {
   //
   // Constructor with tracks
@@ -103,7 +121,13 @@ AliDielectronPair::AliDielectronPair(const AliDielectronPair &pair) :
   fD2(pair.fD2),
   fRefD1(pair.fRefD1),
   fRefD2(pair.fRefD2),
-  fKFUsage(pair.fKFUsage)
+  fKFUsage(pair.fKFUsage),
+  fKFBuilt(pair.fKFBuilt),
+  fTrack1(pair.fTrack1),
+  fTrack2(pair.fTrack2),
+  fPid1(pair.fPid1),
+  fPid2(pair.fPid2),
+  fSwapped(pair.fSwapped)
 {
   //
   // Constructor with tracks
@@ -122,50 +146,80 @@ AliDielectronPair::~AliDielectronPair()
 
 //______________________________________________
 void AliDielectronPair::SetTracks(AliVTrack * const particle1, Int_t pid1,
-                                  AliVTrack * const particle2, Int_t pid2)
+                                  AliVTrack * const particle2, Int_t pid2, Bool_t deferKF)
 {
   //
   // Sort particles by pt, first particle larger Pt (if fRandomizeDaughters=kFALSE)
   // set AliKF daughters and pair
   // refParticle1 and 2 are the original tracks. In the case of track rotation
   // they are needed in the framework
+  // With deferKF the KF particles are only constructed on the first access
+  // (or by BuildKF), the tracks must stay valid until then
   //
+  fTrack1=particle1;
+  fTrack2=particle2;
+  fPid1=pid1;
+  fPid2=pid2;
+
+  if (fRandomizeDaughters) fSwapped=!(fRandom3.Rndm()>0.5);
+  else fSwapped=!(particle1->Pt()>particle2->Pt()); // usual behaviour, sort by pt
+
+  if (fSwapped){
+    fRefD1 = particle2;
+    fRefD2 = particle1;
+  } else {
+    fRefD1 = particle1;
+    fRefD2 = particle2;
+  }
+
+  fKFBuilt=kFALSE;
+  if (!deferKF) ConstructKF();
+}
+
+//______________________________________________
+void AliDielectronPair::ConstructKF() const
+{
+  //
+  // construct the KF daughters and pair from the tracks given in SetTracks
+  //
+  fKFBuilt=kTRUE;
+  if (!fTrack1 || !fTrack2) return;
+
   fPair.Initialize();
   fD1.Initialize();
   fD2.Initialize();
 
-  AliKFParticle kf1(*particle1,pid1);
-  AliKFParticle kf2(*particle2,pid2);
+  AliKFParticle kf1(*fTrack1,fPid1);
+  AliKFParticle kf2(*fTrack2,fPid2);
 
   fPair.AddDaughter(kf1);
   fPair.AddDaughter(kf2);
 
-  if (fRandomizeDaughters) {
-    if (fRandom3.Rndm()>0.5){
-      fRefD1 = particle1;
-      fRefD2 = particle2;
-      fD1+=kf1;
-      fD2+=kf2;
-    } else {
-      fRefD1 = particle2;
-      fRefD2 = particle1;
-      fD1+=kf2;
-      fD2+=kf1;
-    }
+  if (fSwapped){
+    fD1+=kf2;
+    fD2+=kf1;
+  } else {
+    fD1+=kf1;
+    fD2+=kf2;
   }
-  else { // usual behaviour, sort by pt
-    if (particle1->Pt()>particle2->Pt()){
-      fRefD1 = particle1;
-      fRefD2 = particle2;
-      fD1+=kf1;
-      fD2+=kf2;
-    } else {
-      fRefD1 = particle2;
-      fRefD2 = particle1;
-      fD1+=kf2;
-      fD2+=kf1;
-    }
+}
+
+//______________________________________________
+void AliDielectronPair::GetFastMomentum(TLorentzVector &mom) const
+{
+  //
+  // pair 4-vector as the sum of the track momenta with the mass of the leg pdg codes
+  // falls back to the KF pair if the tracks are not known
+  //
+  if (fKFBuilt || !fTrack1 || !fTrack2){
+    mom.SetPxPyPzE(Px(),Py(),Pz(),E());
+    return;
   }
+  TDatabasePDG *db=TDatabasePDG::Instance();
+  TLorentzVector mom2;
+  mom.SetXYZM(fTrack1->Px(),fTrack1->Py(),fTrack1->Pz(),db->GetParticle(fPid1)->Mass());
+  mom2.SetXYZM(fTrack2->Px(),fTrack2->Py(),fTrack2->Pz(),db->GetParticle(fPid2)->Mass());
+  mom+=mom2;
 }
 //______________________________________________
 void AliDielectronPair::SetGammaTracks(AliVTrack * const particle1, Int_t pid1,
@@ -177,6 +231,8 @@ void AliDielectronPair::SetGammaTracks(AliVTrack * const particle1, Int_t pid1,
   // refParticle1 and 2 are the original tracks. In the case of track rotation
   // they are needed in the framework
   //
+  fKFBuilt=kTRUE;
+  fTrack1=fTrack2=0x0;
   fD1.Initialize();
   fD2.Initialize();
 
@@ -224,6 +280,8 @@ void AliDielectronPair::SetTracks(const AliKFParticle * const particle1,
   // refParticle1 and 2 are the original tracks. In the case of track rotation
   // they are needed in the framework
   //
+  fKFBuilt=kTRUE;
+  fTrack1=fTrack2=0x0;
   fPair.Initialize();
   fD1.Initialize();
   fD2.Initialize();
@@ -268,6 +326,7 @@ void AliDielectronPair::GetThetaPhiCM(Double_t &thetaHE, Double_t &phiHE, Double
   //
   // Calculate theta and phi in helicity and Collins-Soper coordinate frame
   //
+  BuildKF();
   Double_t pxyz1[3]={fD1.GetPx(),fD1.GetPy(),fD1.GetPz()};
   Double_t pxyz2[3]={fD2.GetPx(),fD2.GetPy(),fD2.GetPz()};
   Double_t eleMass=AliPID::ParticleMass(AliPID::kElectron);
@@ -324,6 +383,7 @@ Double_t AliDielectronPair::PsiPair(Double_t MagField) const
 {
   //Following idea to use opening of colinear pairs in magnetic field from e.g. PHENIX
   //to ID conversions. Adapted from AliTRDv0Info class
+  BuildKF();
   Double_t x, y;//, z;
   x = fPair.GetX();
   y = fPair.GetY();
@@ -443,6 +503,7 @@ Double_t AliDielectronPair::ThetaPhiCM(Bool_t isHE, Bool_t isTheta) const {
   // The function calculates theta and phi in the mother rest frame with 
   // respect to the helicity coordinate system and Collins-Soper coordinate system
   // TO DO: generalize for different decays (only J/Psi->e+e- now)
+  BuildKF();
 
   // Laboratory frame 4-vectors:
   // projectile beam & target beam 4-mom
@@ -502,6 +563,7 @@ Double_t AliDielectronPair::GetCosPointingAngle(const AliVVertex *primVtx) const
   //
   // Calculate the poiting angle of the pair to the primary vertex and take the cosine
   //
+  BuildKF();
   if(!primVtx) return -1.;
 
   Double_t deltaPos[3]; //vector between the reference point and the V0 vertex
@@ -524,6 +586,7 @@ Double_t AliDielectronPair::GetArmAlpha() const
   //
   // Calculate the Armenteros-Podolanski Alpha
   //
+  BuildKF();
   Int_t qD1 = fD1.GetQ();
 
   TVector3 momNeg( (qD1<0?fD1.GetPx():fD2.GetPx()),
@@ -546,6 +609,7 @@ Double_t AliDielectronPair::GetArmPt() const
   //
   // Calculate the Armenteros-Podolanski Pt
   //
+  BuildKF();
   Int_t qD1 = fD1.GetQ();
 
   TVector3 momNeg( (qD1<0?fD1.GetPx():fD2.GetPx()),
@@ -606,6 +670,7 @@ Double_t AliDielectronPair::PhivPair(Double_t MagField) const
   /// at pi or at 0 depending on which leg has the higher momentum. (not checked yet)
   /// This expected ambiguity is not seen due to sorting of track arrays in this framework. 
   /// To reach the same result as for ULS (~pi), the legs are flipped for LS.
+  BuildKF();
 
   //Define local buffer variables for leg properties
   Double_t px1=-9999.,py1=-9999.,pz1=-9999.;
@@ -725,6 +790,7 @@ Double_t AliDielectronPair::PhivPair(Double_t MagField) const
 //______________________________________________
 Double_t AliDielectronPair::GetPairPlaneAngle(Double_t v0rpH2, Int_t VariNum)const
 {
+  BuildKF();
 
   // Calculate the angle between electron pair plane and variables
   // kv0rpH2 is reaction plane angle using V0-A,C,AC,Random
@@ -834,6 +900,7 @@ Double_t AliDielectronPair::GetPairPlaneAngle(Double_t v0rpH2, Int_t VariNum)con
 //_______________________________________________
 Double_t AliDielectronPair::PairPlaneMagInnerProduct(Double_t ZDCrpH1) const
 {
+  BuildKF();
 
   // Calculate inner product of the strong magnetic field and electron pair plane
 
@@ -905,6 +972,7 @@ void AliDielectronPair::SetBeamEnergy(AliVEvent *ev, Double_t beamEbyHand)
 
 Double_t AliDielectronPair::DeltaCotTheta() const
 {
+  BuildKF();
   Double_t px1 = fD1.GetPx();
   Double_t py1 = fD1.GetPy();
   Double_t pz1 = fD1.GetPz();
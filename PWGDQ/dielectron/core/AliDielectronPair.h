@@ -55,7 +55,7 @@ public:
 //TODO:  copy constructor + assignment operator
 
   void SetTracks(AliVTrack * const particle1, Int_t pid1,
-                 AliVTrack * const particle2, Int_t pid2);
+                 AliVTrack * const particle2, Int_t pid2, Bool_t deferKF=kFALSE);
 
   void SetGammaTracks(AliVTrack * const particle1, Int_t pid1,
 		      AliVTrack * const particle2, Int_t pid2);
@@ -70,33 +70,33 @@ public:
 
   //AliVParticle interface
   // kinematics
-  virtual Double_t Px() const { return fPair.GetPx(); }
-  virtual Double_t Py() const { return fPair.GetPy(); }
-  virtual Double_t Pz() const { return fPair.GetPz(); }
-  virtual Double_t Pt() const { return fPair.GetPt(); }
-  virtual Double_t P() const  { return fPair.GetP();  }
+  virtual Double_t Px() const { return KFPair().GetPx(); }
+  virtual Double_t Py() const { return KFPair().GetPy(); }
+  virtual Double_t Pz() const { return KFPair().GetPz(); }
+  virtual Double_t Pt() const { return KFPair().GetPt(); }
+  virtual Double_t P() const  { return KFPair().GetP();  }
   virtual Bool_t   PxPyPz(Double_t p[3]) const { p[0]=Px(); p[1]=Py(); p[2]=Pz(); return kTRUE; }
 
-  virtual Double_t Xv() const { return fPair.GetX(); }
-  virtual Double_t Yv() const { return fPair.GetY(); }
-  virtual Double_t Zv() const { return fPair.GetZ(); }
+  virtual Double_t Xv() const { return KFPair().GetX(); }
+  virtual Double_t Yv() const { return KFPair().GetY(); }
+  virtual Double_t Zv() const { return KFPair().GetZ(); }
   virtual Bool_t   XvYvZv(Double_t x[3]) const { x[0]=Xv(); x[1]=Yv(); x[2]=Zv(); return kTRUE; }
 
   virtual Double_t OneOverPt() const { return Pt()>0.?1./Pt():0.; }  //TODO: check
-  virtual Double_t Phi()       const { return fPair.GetPhi();}
+  virtual Double_t Phi()       const { return KFPair().GetPhi();}
   virtual Double_t Theta()     const { return Pz()!=0?TMath::ATan(Pt()/Pz()):0.; } //TODO: check
 
 
-  virtual Double_t E() const { return fPair.GetE();    }
-  virtual Double_t M() const { return fPair.GetMass(); }
+  virtual Double_t E() const { return KFPair().GetE(); }
+  virtual Double_t M() const { return KFPair().GetMass(); }
 
-  virtual Double_t Eta() const { return fPair.GetEta();}
+  virtual Double_t Eta() const { return KFPair().GetEta();}
   virtual Double_t Y()  const  {
     if((E()*E()-Px()*Px()-Py()*Py()-Pz()*Pz())>0.) return TLorentzVector(Px(),Py(),Pz(),E()).Rapidity();
     else return -1111.;
   }
 
-  virtual Short_t Charge() const    { return fPair.GetQ();}
+  virtual Short_t Charge() const    { return KFPair().GetQ();}
   virtual Int_t   GetLabel() const  { return fLabel;      }
   // PID
   virtual const Double_t *PID() const { return 0;} //TODO: check
@@ -115,22 +115,22 @@ public:
   void SetPdgCode(Int_t pdgCode) { fPdgCode=pdgCode; }
   Int_t PdgCode() const {return fPdgCode;}
 
-  void SetProductionVertex(const AliKFParticle &Vtx) { fPair.SetProductionVertex(Vtx); }
+  void SetProductionVertex(const AliKFParticle &Vtx) { BuildKF(); fPair.SetProductionVertex(Vtx); }
 
   //inter leg information
-  Double_t GetKFChi2()            const { return fPair.GetChi2();                               }
-  Int_t    GetKFNdf()             const { return fPair.GetNDF();                                }
-  Double_t OpeningAngle()         const { return fD1.GetAngle(fD2);                             }
-  Double_t OpeningAngleXY()       const { return fD1.GetAngleXY(fD2);                           }
-  Double_t OpeningAngleRZ()       const { return fD1.GetAngleRZ(fD2);                           }
-  Double_t DistanceDaughters()    const { return fD1.GetDistanceFromParticle(fD2);              }
-  Double_t DistanceDaughtersXY()  const { return fD1.GetDistanceFromParticleXY(fD2);            }
-  Double_t DeviationDaughters()   const { return fD1.GetDeviationFromParticle(fD2);             }
-  Double_t DeviationDaughtersXY() const { return fD1.GetDeviationFromParticleXY(fD2);           }
-  Double_t DeltaEta()             const { return TMath::Abs(fD1.GetEta()-fD2.GetEta());         }
+  Double_t GetKFChi2()            const { return KFPair().GetChi2();                            }
+  Int_t    GetKFNdf()             const { return KFPair().GetNDF();                             }
+  Double_t OpeningAngle()         const { return KFD1().GetAngle(KFD2());                       }
+  Double_t OpeningAngleXY()       const { return KFD1().GetAngleXY(KFD2());                     }
+  Double_t OpeningAngleRZ()       const { return KFD1().GetAngleRZ(KFD2());                     }
+  Double_t DistanceDaughters()    const { return KFD1().GetDistanceFromParticle(KFD2());        }
+  Double_t DistanceDaughtersXY()  const { return KFD1().GetDistanceFromParticleXY(KFD2());      }
+  Double_t DeviationDaughters()   const { return KFD1().GetDeviationFromParticle(KFD2());       }
+  Double_t DeviationDaughtersXY() const { return KFD1().GetDeviationFromParticleXY(KFD2());     }
+  Double_t DeltaEta()             const { return TMath::Abs(KFD1().GetEta()-KFD2().GetEta());   }
 //   Double_t DeltaPhi()             const { Double_t dphi=TMath::Abs(fD1.GetPhi()-fD2.GetPhi());
 //                                           return (dphi>TMath::Pi())?dphi-TMath::Pi():dphi;      }
-  Double_t DeltaPhi()             const { return fD1.GetAngleXY(fD2);     }
+  Double_t DeltaPhi()             const { return KFD1().GetAngleXY(KFD2());     }
   Double_t DeltaCotTheta()        const;
 
   // calculate cos(theta*) and phi* in HE and CS pictures
@@ -157,9 +157,15 @@ public:
 
 
   // internal KF particle
-  const AliKFParticle& GetKFParticle()       const { return fPair; }
-  const AliKFParticle& GetKFFirstDaughter()  const { return fD1;   }
-  const AliKFParticle& GetKFSecondDaughter() const { return fD2;   }
+  const AliKFParticle& GetKFParticle()       const { return KFPair(); }
+  const AliKFParticle& GetKFFirstDaughter()  const { return KFD1();   }
+  const AliKFParticle& GetKFSecondDaughter() const { return KFD2();   }
+
+  // cheap kinematics from the daughter tracks, does not need the KF particles
+  void GetFastMomentum(TLorentzVector &mom) const;
+  // construct the KF particles if SetTracks was called with deferKF
+  void BuildKF() const { if (!fKFBuilt) ConstructKF(); }
+  Bool_t IsKFBuilt() const { return fKFBuilt; }
 
   // daughter references
   void SetRefFirstDaughter(AliVParticle * const track)  {fRefD1 = track;}
@@ -179,19 +185,31 @@ private:
   Int_t    fPdgCode;      // pdg code in case it is a MC particle
   static Double_t fBeamEnergy; //!beam energy
 
-  AliKFParticle fPair;   // KF particle internally used for pair calculation
-  AliKFParticle fD1;     // KF particle first daughter
-  AliKFParticle fD2;     // KF particle1 second daughter
+  mutable AliKFParticle fPair;   // KF particle internally used for pair calculation
+  mutable AliKFParticle fD1;     // KF particle first daughter
+  mutable AliKFParticle fD2;     // KF particle1 second daughter
 
   TRef fRefD1;           // Reference to first daughter
   TRef fRefD2;           // Reference to second daughter
 
   Bool_t fKFUsage;       // Use KF for vertexing
 
+  mutable Bool_t fKFBuilt; //! KF particles are constructed
+  AliVTrack *fTrack1;      //! first track as given to SetTracks, for the deferred KF
+  AliVTrack *fTrack2;      //! second track as given to SetTracks, for the deferred KF
+  Int_t fPid1;             //! pdg code of the first track
+  Int_t fPid2;             //! pdg code of the second track
+  Bool_t fSwapped;         //! second track is the first daughter
+
+  void ConstructKF() const;
+  const AliKFParticle& KFPair() const { BuildKF(); return fPair; }
+  const AliKFParticle& KFD1()   const { BuildKF(); return fD1;   }
+  const AliKFParticle& KFD2()   const { BuildKF(); return fD2;   }
+
   static Bool_t   fRandomizeDaughters;
   static TRandom3 fRandom3;
 
-  ClassDef(AliDielectronPair,5)
+  ClassDef(AliDielectronPair,6)
 };
 
 #endif
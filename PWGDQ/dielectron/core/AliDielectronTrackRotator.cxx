@@ -84,12 +84,18 @@ AliDielectronTrackRotator::AliDielectronTrackRotator() :
   fMaximalEtaCut(999.),
   fWeight(0.),
   fRotateTrackCorrectionMap(),
-  fUseAccMap(kTRUE)
+  fUseAccMap(kTRUE),
+  fUseFastRotation(kFALSE),
+  fFastPairWindow(),
+  fRotAngles(),
+  fRotLegs(),
+  fRotAccepted()
 
 {
   //
   // Default Constructor
   //
+  fFastPairWindow[0]=0.; fFastPairWindow[1]=1e30; fFastPairWindow[2]=0.; fFastPairWindow[3]=1e30;
   gRandom->SetSeed();
 }
 
@@ -134,11 +140,17 @@ AliDielectronTrackRotator::AliDielectronTrackRotator(const char* name, const cha
   fMaximalEtaCut(999.),
   fWeight(0.),
   fRotateTrackCorrectionMap(),
-  fUseAccMap(kTRUE)
+  fUseAccMap(kTRUE),
+  fUseFastRotation(kFALSE),
+  fFastPairWindow(),
+  fRotAngles(),
+  fRotLegs(),
+  fRotAccepted()
 {
   //
   // Named Constructor
   //
+  fFastPairWindow[0]=0.; fFastPairWindow[1]=1e30; fFastPairWindow[2]=0.; fFastPairWindow[3]=1e30;
   gRandom->SetSeed();
 }
 
@@ -261,6 +273,8 @@ Bool_t AliDielectronTrackRotator::NextCombination()
       return kFALSE;
     }
 
+    if (fUseFastRotation) return NextFastCombination(nPos, nNeg);
+
     if (fCurrentIteration==fIterations){
       fCurrentIteration=0;
       ++fCurrentTackP;
@@ -303,32 +317,143 @@ Bool_t AliDielectronTrackRotator::RotateTracks()
   }
   fSameTracks = kFALSE;
 
+  if (!trackP||!trackN) {
+    fTrack1.Initialize();
+    fTrack2.Initialize();
+    fVTrackP=0x0;
+    fVTrackN=0x0;
+    return kFALSE;
+  }
+
+  Double_t angle  = fStartAnglePhi+(2*gRandom->Rndm()-1)*fConeAnglePhi;
+  Int_t    charge = TMath::Nint(gRandom->Rndm());
+  if( fKeepLocalY){// only rotate by multiples of one TPC chamber size
+    angle = (Int_t) ( angle /  TMath::Pi() * 9 ) ;
+  }
+
+  Int_t rotatedLeg=0;
+  if (fRotationType==kRotatePositive||(fRotationType==kRotateBothRandom&&charge==0)) rotatedLeg=1;
+  if (fRotationType==kRotateNegative||(fRotationType==kRotateBothRandom&&charge==1)) rotatedLeg=2;
+  BuildRotatedTracks(trackP, trackN, angle, rotatedLeg);
+
+  return kTRUE;
+}
+
+//______________________________________________
+void AliDielectronTrackRotator::BuildRotatedTracks(AliVTrack *trackP, AliVTrack *trackN, Double_t angle, Int_t rotatedLeg)
+{
+  //
+  // Build the KF legs and rotate leg 1 or 2 by angle
+  //
   fTrack1.Initialize();
   fTrack2.Initialize();
-  fVTrackP=0x0;
-  fVTrackN=0x0;
-  if (!trackP||!trackN) return kFALSE;
   fTrack1+=AliKFParticle(*trackP,fPdgLeg1);
   fTrack2+=AliKFParticle(*trackN,fPdgLeg2);
 
   fVTrackP=trackP;
   fVTrackN=trackN;
 
-  Double_t angle  = fStartAnglePhi+(2*gRandom->Rndm()-1)*fConeAnglePhi;
-  Int_t    charge = TMath::Nint(gRandom->Rndm());
-  if( fKeepLocalY){// only rotate by multiples of one TPC chamber size
-    angle = (Int_t) ( angle /  TMath::Pi() * 9 ) ;
-  }
+  if (rotatedLeg==1) AliDielectronHelper::RotateKFParticle(&fTrack1, angle, fEvent);
+  if (rotatedLeg==2) AliDielectronHelper::RotateKFParticle(&fTrack2, angle, fEvent);
+}
 
-  if (fRotationType==kRotatePositive||(fRotationType==kRotateBothRandom&&charge==0)){
-    AliDielectronHelper::RotateKFParticle(&fTrack1, angle, fEvent);
+//______________________________________________
+Bool_t AliDielectronTrackRotator::PrepareFastRotations(AliVTrack *trackP, AliVTrack *trackN)
+{
+  //
+  // Draw the angles of all the iterations of a track pair (same random sequence as RotateTracks())
+  // and flag the rotations with the pair mass and pt inside fFastPairWindow.
+  // RotateKFParticle() turns the momentum by -angle in the transverse plane
+  //
+  fRotAngles.resize(fIterations);
+  fRotLegs.resize(fIterations);
+  fRotAccepted.resize(fIterations);
+  for (UInt_t it=0; it<fIterations; ++it){
+    Double_t angle  = fStartAnglePhi+(2*gRandom->Rndm()-1)*fConeAnglePhi;
+    Int_t    charge = TMath::Nint(gRandom->Rndm());
+    if( fKeepLocalY){// only rotate by multiples of one TPC chamber size
+      angle = (Int_t) ( angle /  TMath::Pi() * 9 ) ;
+    }
+    Char_t rotatedLeg=0;
+    if (fRotationType==kRotatePositive||(fRotationType==kRotateBothRandom&&charge==0)) rotatedLeg=1;
+    if (fRotationType==kRotateNegative||(fRotationType==kRotateBothRandom&&charge==1)) rotatedLeg=2;
+    fRotAngles[it]=angle;
+    fRotLegs[it]=rotatedLeg;
   }
 
-  if (fRotationType==kRotateNegative||(fRotationType==kRotateBothRandom&&charge==1)){
-    AliDielectronHelper::RotateKFParticle(&fTrack2, angle, fEvent);
+  TDatabasePDG *db=TDatabasePDG::Instance();
+  const Double_t m1=db->GetParticle(fPdgLeg1)->Mass();
+  const Double_t m2=db->GetParticle(fPdgLeg2)->Mass();
+  const Double_t pt1=trackP->Pt(), pt2=trackN->Pt();
+  const Double_t pz1=trackP->Pz(), pz2=trackN->Pz();
+  const Double_t e1=TMath::Sqrt(m1*m1+pt1*pt1+pz1*pz1);
+  const Double_t e2=TMath::Sqrt(m2*m2+pt2*pt2+pz2*pz2);
+  const Double_t dphi=trackP->Phi()-trackN->Phi();
+  const Double_t mSum=m1*m1+m2*m2+2.*(e1*e2-pz1*pz2);
+  const Double_t ptSum=pt1*pt1+pt2*pt2;
+  const Double_t m2Min=(fFastPairWindow[0]>0. ? fFastPairWindow[0]*fFastPairWindow[0] : -1.);
+  const Double_t m2Max=fFastPairWindow[1]*fFastPairWindow[1];
+  const Double_t pt2Min=(fFastPairWindow[2]>0. ? fFastPairWindow[2]*fFastPairWindow[2] : -1.);
+  const Double_t pt2Max=fFastPairWindow[3]*fFastPairWindow[3];
+  const Double_t *angles=&fRotAngles[0];
+  const Char_t *legs=&fRotLegs[0];
+  Char_t *accepted=&fRotAccepted[0];
+  Bool_t any=kFALSE;
+  for (UInt_t it=0; it<fIterations; ++it){
+    const Double_t sign=(legs[it]==1 ? -1. : (legs[it]==2 ? 1. : 0.));
+    const Double_t cosPhi=TMath::Cos(dphi+sign*angles[it]);
+    const Double_t mass2=mSum-2.*pt1*pt2*cosPhi;
+    const Double_t pairPt2=ptSum+2.*pt1*pt2*cosPhi;
+    accepted[it]=(mass2>=m2Min && mass2<m2Max && pairPt2>=pt2Min && pairPt2<pt2Max);
+    any|=accepted[it];
   }
+  return any;
+}
 
-  return kTRUE;
+//______________________________________________
+Bool_t AliDielectronTrackRotator::NextFastCombination(Int_t nPos, Int_t nNeg)
+{
+  //
+  // Standard rotation, skipping the rotations outside fFastPairWindow without building the KF legs
+  //
+  fSameTracks=kFALSE;
+  while (kTRUE){
+    if (fCurrentIteration==fIterations){
+      fCurrentIteration=0;
+      ++fCurrentTackP;
+    }
+
+    if (fCurrentTackP==nPos){
+      ++fCurrentTackN;
+      fCurrentTackP=0;
+    }
+
+    if (fCurrentTackN==nNeg){
+      Reset();
+      return kFALSE;
+    }
+
+    AliVTrack *trackP=dynamic_cast<AliVTrack*>(fkArrTracksP->UncheckedAt(fCurrentTackP));
+    AliVTrack *trackN=dynamic_cast<AliVTrack*>(fkArrTracksN->UncheckedAt(fCurrentTackN));
+    if (!trackP||!trackN){
+      Reset();
+      return kFALSE;
+    }
+    if (trackP==trackN){
+      fCurrentIteration=fIterations;
+      continue;
+    }
+
+    if (fCurrentIteration==0 && !PrepareFastRotations(trackP, trackN)){
+      fCurrentIteration=fIterations;
+      continue;
+    }
+
+    const UInt_t it=fCurrentIteration++;
+    if (!fRotAccepted[it]) continue;
+    BuildRotatedTracks(trackP, trackN, fRotAngles[it], fRotLegs[it]);
+    return kTRUE;
+  }
 }
 
 //______________________________________________
@@ -61,6 +61,11 @@ public:
   void SetUseAcceptanceMap(Bool_t use)     {fUseAccMap = use;}
   void SetRotWeightMinPtBin (Int_t pTbin)  {fRotWeight_minPtBin = pTbin;}
   void SetRotWeightMaxPtBin (Int_t pTbin)  {fRotWeight_maxPtBin = pTbin;}
+  // standard rotation: compute the rotated pair mass and pt from the leg momenta for all the iterations of a pair,
+  // KF legs are built only for the rotations inside the pair window
+  void SetUseFastRotation(Bool_t fast=kTRUE) { fUseFastRotation=fast; }
+  void SetFastPairWindow(Double_t massMin, Double_t massMax, Double_t ptMin=0., Double_t ptMax=1e30)
+    { fFastPairWindow[0]=massMin; fFastPairWindow[1]=massMax; fFastPairWindow[2]=ptMin; fFastPairWindow[3]=ptMax; }
 
 
   //Getters
@@ -70,6 +75,7 @@ public:
   Double_t GetConeAnglePhi() const      { return fConeAnglePhi;  }
   Bool_t GetKeepLocalY() const          { return fKeepLocalY;  }
   Bool_t GetRotateAroundMother() const  { return fRotateAroundMother; }
+  Bool_t GetUseFastRotation() const     { return fUseFastRotation; }
 
   void SetEvent(AliVEvent * const ev)   { fEvent = ev;           }
   void SetPdgLegs(Int_t pdfLeg1, Int_t pdfLeg2) { fPdgLeg1=pdfLeg1; fPdgLeg2=pdfLeg2; }
@@ -182,7 +188,16 @@ private:
   TH2F fRotatePairCorrectionMap;
   TH1F fRotatePairCorrectionMap2;
 
+  Bool_t   fUseFastRotation;            // compute the rotated pair kinematics before building the KF legs
+  Double_t fFastPairWindow[4];          // mass and pt window of the fast rotation
+  std::vector<Double_t> fRotAngles;     //! rotation angles of the current track pair
+  std::vector<Char_t>   fRotLegs;       //! rotated leg (1 or 2) of each rotation
+  std::vector<Char_t>   fRotAccepted;   //! rotation inside fFastPairWindow
+
   Bool_t RotateTracks();
+  void   BuildRotatedTracks(AliVTrack *trackP, AliVTrack *trackN, Double_t angle, Int_t rotatedLeg);
+  Bool_t PrepareFastRotations(AliVTrack *trackP, AliVTrack *trackN);
+  Bool_t NextFastCombination(Int_t nPos, Int_t nNeg);
   void CalculatePairsFromRotationAroundMother();
   void CalculateLikeSignPairs();
   Double_t PhivPair(Double_t MagField, Int_t charge1, Int_t charge2, TVector3 dau1, TVector3 dau2); //const
@@ -191,7 +206,7 @@ private:
   AliDielectronTrackRotator(const AliDielectronTrackRotator &c);
   AliDielectronTrackRotator &operator=(const AliDielectronTrackRotator &c);
 
-  ClassDef(AliDielectronTrackRotator,2)         // Dielectron TrackRotator
+  ClassDef(AliDielectronTrackRotator,3)         // Dielectron TrackRotator
 };
 
 
@@ -0,0 +1,160 @@
+/*************************************************************************
+* Copyright(c) 1998-2009, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  *
+**************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+//                Dielectron track variable cache                        //
+//                                                                       //
+/*
+The task registers the cache with AliDielectronVarManager::SetVarCache
+and calls SetEvent for every event. AliDielectronVarManager::Fill then
+serves ESD/AOD tracks of that event from the cache:
+- the first request of a track computes all variables of the union of
+  the fill maps seen so far (a new fill map extends the union and
+  invalidates the rows),
+- the track variables [0,kPairMax) are copied from the cached row, the
+  event variables are taken from the current event data as usual.
+Tracks not belonging to the current event (e.g. from the mixing pools)
+are not cached. Instances with different PID corrections use different
+slots, selected by SetSettingsTag from AliDielectron::Process.
+*/
+///////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+
+#include <AliVEvent.h>
+
+#include "AliDielectronVarManager.h"
+#include "AliDielectronVarCache.h"
+
+//______________________________________________
+AliDielectronVarCache::AliDielectronVarCache() :
+  fTrackIndex(),
+  fSlots(),
+  fCurrentSlot(-1),
+  fNTracks(0),
+  fGeneration(0),
+  fUsedVars(AliDielectronVarManager::kNMaxValues),
+  fKnownMaps(),
+  fNHits(0),
+  fNMisses(0)
+{
+  //
+  // Default Constructor
+  //
+}
+
+//______________________________________________
+void AliDielectronVarCache::SetEvent(AliVEvent * const ev)
+{
+  //
+  // invalidate all rows and index the tracks of the new event
+  //
+  ++fGeneration;
+  fTrackIndex.clear();
+  fNTracks = ev ? ev->GetNumberOfTracks() : 0;
+  for (Int_t itrack=0; itrack<fNTracks; ++itrack)
+    fTrackIndex[ev->GetTrack(itrack)] = itrack;
+
+  for (UInt_t islot=0; islot<fSlots.size(); ++islot) {
+    if ((Int_t)fSlots[islot].fFilled.size() >= fNTracks) continue;
+    fSlots[islot].fRows.resize((size_t)fNTracks*AliDielectronVarManager::kPairMax);
+    fSlots[islot].fFilled.resize(fNTracks, 0);
+  }
+}
+
+//______________________________________________
+void AliDielectronVarCache::SetSettingsTag(UInt_t tag)
+{
+  //
+  // select the slot of the current track variable settings
+  //
+  if (fCurrentSlot>=0 && fSlots[fCurrentSlot].fTag==tag) return;
+
+  for (UInt_t islot=0; islot<fSlots.size(); ++islot) {
+    if (fSlots[islot].fTag!=tag) continue;
+    fCurrentSlot = islot;
+    return;
+  }
+
+  // correction objects cloned per event give a new tag each time, do not let the slots pile up
+  const UInt_t kMaxSlots=32;
+  if (fSlots.size()>=kMaxSlots) fSlots.clear();
+
+  Slot slot;
+  slot.fTag = tag;
+  slot.fRows.resize((size_t)fNTracks*AliDielectronVarManager::kPairMax);
+  slot.fFilled.resize(fNTracks, 0);
+  fSlots.push_back(slot);
+  fCurrentSlot = fSlots.size()-1;
+}
+
+//______________________________________________
+void AliDielectronVarCache::AddFillMap(const TBits *map)
+{
+  //
+  // extend the union of the fill maps by <map>
+  //
+  if (fKnownMaps.count(map)) return;
+
+  Bool_t grown = kFALSE;
+  for (UInt_t ibit=map->FirstSetBit(); ibit<map->GetNbits(); ibit=map->FirstSetBit(ibit+1)) {
+    if (fUsedVars.TestBitNumber(ibit)) continue;
+    fUsedVars.SetBitNumber(ibit);
+    grown = kTRUE;
+  }
+  // rows filled so far miss the new variables
+  if (grown) ++fGeneration;
+  fKnownMaps.insert(map);
+}
+
+//______________________________________________
+Bool_t AliDielectronVarCache::Fill(const TObject *track, Double_t * const values)
+{
+  //
+  // fill <values> for <track> from the cache, computing the row if needed
+  // returns kFALSE if the track cannot be served from the cache
+  //
+  TBits *map = AliDielectronVarManager::GetFillMap();
+  if (!map || fCurrentSlot<0) return kFALSE;
+
+  std::unordered_map<const TObject*, Int_t>::const_iterator it = fTrackIndex.find(track);
+  if (it==fTrackIndex.end()) return kFALSE;
+
+  AddFillMap(map);
+
+  Slot &slot = fSlots[fCurrentSlot];
+  const Int_t itrack = it->second;
+  Double_t *row = &slot.fRows[(size_t)itrack*AliDielectronVarManager::kPairMax];
+
+  if (slot.fFilled[itrack]!=fGeneration) {
+    // the row needs the full value array, the event part is not kept
+    Double_t full[AliDielectronVarManager::kNMaxValues];
+    AliDielectronVarManager::SetVarCache(0x0);
+    AliDielectronVarManager::SetFillMap(&fUsedVars);
+    AliDielectronVarManager::Fill(track, full);
+    AliDielectronVarManager::SetFillMap(map);
+    AliDielectronVarManager::SetVarCache(this);
+    memcpy(row, full, AliDielectronVarManager::kPairMax*sizeof(Double_t));
+    slot.fFilled[itrack] = fGeneration;
+    ++fNMisses;
+  }
+  else ++fNHits;
+
+  memcpy(values, row, AliDielectronVarManager::kPairMax*sizeof(Double_t));
+  const Double_t *data = AliDielectronVarManager::GetData();
+  for (Int_t i=AliDielectronVarManager::kPairMax; i<AliDielectronVarManager::kNMaxValues; ++i)
+    values[i] = data[i];
+  return kTRUE;
+}
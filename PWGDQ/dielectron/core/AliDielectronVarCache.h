@@ -0,0 +1,65 @@
+#ifndef ALIDIELECTRONVARCACHE_H
+#define ALIDIELECTRONVARCACHE_H
+/* Copyright(c) 1998-2009, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+///////////////////////////////////////////////////////////////////////////////////////////
+//                                                                                       //
+// Per-event cache of the track variables of AliDielectronVarManager                     //
+//                                                                                       //
+// Owned by the analysis task and shared by all its AliDielectron instances, so that    //
+// the track variables (PID, DCA, ...) are computed once per track and event for the     //
+// union of all fill maps instead of once per instance.                                  //
+//                                                                                       //
+///////////////////////////////////////////////////////////////////////////////////////////
+
+#include <set>
+#include <vector>
+#include <unordered_map>
+
+#include <TBits.h>
+
+class TObject;
+class AliVEvent;
+
+class AliDielectronVarCache {
+public:
+  AliDielectronVarCache();
+  virtual ~AliDielectronVarCache() {}
+
+  void SetEvent(AliVEvent * const ev);
+  void SetSettingsTag(UInt_t tag);
+  Bool_t Fill(const TObject *track, Double_t * const values);
+
+  const TBits& GetUsedVars() const { return fUsedVars; }
+  Long64_t GetNHits()   const { return fNHits; }
+  Long64_t GetNMisses() const { return fNMisses; }
+
+private:
+  /// cached rows of all tracks of the event for one setting of the
+  /// track variable corrections (see AliDielectronPID::GetCorrectionHash)
+  struct Slot {
+    UInt_t fTag;                        // settings tag
+    std::vector<Double_t> fRows;        // kPairMax values per track
+    std::vector<UInt_t> fFilled;        // generation in which the row was filled
+  };
+
+  void AddFillMap(const TBits *map);
+
+  std::unordered_map<const TObject*, Int_t> fTrackIndex;  // tracks of the current event --> row
+  std::vector<Slot> fSlots;                               // one slot per settings tag
+  Int_t fCurrentSlot;                                     // slot of the current settings
+  Int_t fNTracks;                                         // number of tracks in the current event
+  UInt_t fGeneration;                                     // increased per event and when fUsedVars grows
+
+  TBits fUsedVars;                                        // union of all fill maps seen
+  std::set<const TBits*> fKnownMaps;                      // fill maps already added to fUsedVars
+
+  Long64_t fNHits;                                        // number of fills served from the cache
+  Long64_t fNMisses;                                      // number of rows computed
+
+  AliDielectronVarCache(const AliDielectronVarCache &c);
+  AliDielectronVarCache &operator=(const AliDielectronVarCache &c);
+};
+
+#endif
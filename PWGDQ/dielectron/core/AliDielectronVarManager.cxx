@@ -757,6 +757,7 @@ TH3D*           AliDielectronVarManager::fgTRDpidEff[10][4] = {{0x0}};
 TObject*        AliDielectronVarManager::fgLegEffMap           = 0x0;
 TObject*        AliDielectronVarManager::fgPairEffMap          = 0x0;
 TBits*          AliDielectronVarManager::fgFillMap          = 0x0;
+AliDielectronVarCache* AliDielectronVarManager::fgVarCache  = 0x0;
 Double_t        AliDielectronVarManager::fgTRDpidEffCentRanges[10][4] = {{0.0}};
 TString         AliDielectronVarManager::fgQnCalibrationFilePath = "";
 Bool_t          AliDielectronVarManager::fgDoQnV0GainEqualization = kFALSE;
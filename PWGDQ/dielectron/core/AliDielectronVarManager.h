@@ -75,6 +75,7 @@
 #include "AliDielectronPID.h"
 #include "AliDielectronHelper.h"
 #include "AliDielectronQnEPcorrection.h"
+#include "AliDielectronVarCache.h"
 
 #include "AliAnalysisDataContainer.h"
 #include "AliAnalysisManager.h"
@@ -807,6 +808,9 @@ public:
   static void SetLegEffMap( TObject *map) { fgLegEffMap=map; }
   static void SetPairEffMap(TObject *map) { fgPairEffMap=map; }
   static void SetFillMap(   TBits   *map) { fgFillMap=map; }
+  static TBits* GetFillMap() { return fgFillMap; }
+  static void SetVarCache(AliDielectronVarCache *cache) { fgVarCache=cache; }
+  static AliDielectronVarCache* GetVarCache() { return fgVarCache; }
   static void SetQnCalibrationFilePath(const Char_t* filename, const Bool_t doV0GainEq, const Bool_t doV0recenter, const Bool_t doTPCrecenter) {
     fgQnCalibrationFilePath = filename;
     fgDoQnV0GainEqualization = doV0GainEq;
@@ -885,6 +889,7 @@ private:
   static TObject         *fgLegEffMap;             // single electron efficiencies
   static TObject         *fgPairEffMap;             // pair efficiencies
   static TBits           *fgFillMap;             // map for requested variable filling
+  static AliDielectronVarCache *fgVarCache;      // per-event track variable cache (owned by the task)
   static TString          fgQnCalibrationFilePath;  // file path to VZERO/TPC Qn calibrations
   static Bool_t           fgDoQnV0GainEqualization;  // flag for gain equalization of V0 for Qn vector
   static Bool_t           fgDoQnV0Recentering;  // flag for recentering of V0 for Qn vector
@@ -924,6 +929,8 @@ inline void AliDielectronVarManager::Fill(const TObject* object, Double_t * cons
   // Main function to fill all available variables according to the type of particle
   //
   if (!object) return;
+  if (fgVarCache && (object->IsA() == AliESDtrack::Class() || object->IsA() == AliAODTrack::Class()) &&
+      fgVarCache->Fill(object, values)) return;
   if      (object->IsA() == AliESDtrack::Class())       FillVarESDtrack(static_cast<const AliESDtrack*>(object), values);
   else if (object->IsA() == AliAODTrack::Class())       FillVarAODTrack(static_cast<const AliAODTrack*>(object), values);
   else if (object->IsA() == AliMCParticle::Class())     FillVarMCParticle(static_cast<const AliMCParticle*>(object), values);
@@ -24,6 +24,7 @@
 #include <TH1D.h>
 #include <TH2I.h>
 #include <TFile.h>
+#include <TROOT.h>
 #include <TBits.h>
 #include <TRandom.h>
 #include <TTimeStamp.h>
@@ -155,6 +156,14 @@ AliAnalysisTaskReducedTreeMaker::AliAnalysisTaskReducedTreeMaker() :
   fGammaMassRange(),
   fActiveBranches(""),
   fInactiveBranches(""),
+  fEventColumns(""),
+  fTrackColumns(""),
+  fPairColumns(""),
+  fTreeSplitLevel(99),
+  fTreeBasketSize(16000),
+  fTreeAutoFlush(0),
+  fTreeImplicitMT(kFALSE),
+  fTreeMTThreads(0),
   fTreeFile(0x0),
   fTree(0x0),
   fNevents(0),
@@ -233,6 +242,14 @@ AliAnalysisTaskReducedTreeMaker::AliAnalysisTaskReducedTreeMaker(const char *nam
   fGammaMassRange(),
   fActiveBranches(""),
   fInactiveBranches(""),
+  fEventColumns(""),
+  fTrackColumns(""),
+  fPairColumns(""),
+  fTreeSplitLevel(99),
+  fTreeBasketSize(16000),
+  fTreeAutoFlush(0),
+  fTreeImplicitMT(kFALSE),
+  fTreeMTThreads(0),
   fTreeFile(0x0),
   fTree(0x0),
   fNevents(0),
@@ -340,7 +357,19 @@ void AliAnalysisTaskReducedTreeMaker::UserCreateOutputObjects()
   };
 
   if(fWriteTree) {
-    fTree->Branch("Event",&fReducedEvent,16000,99);
+    fTree->Branch("Event",&fReducedEvent,fTreeBasketSize,fTreeSplitLevel);
+    if(fTreeAutoFlush!=0) fTree->SetAutoFlush(fTreeAutoFlush);
+    if(fTreeImplicitMT) {
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,10,0)
+      if(!ROOT::IsImplicitMTEnabled()) ROOT::EnableImplicitMT(fTreeMTThreads);
+      fTree->SetImplicitMT(kTRUE);
+#else
+      printf("AliAnalysisTaskReducedTreeMaker::UserCreateOutputObjects() WARNING: parallel compression needs ROOT >= 6.10, ignored\n");
+#endif
+    }
+
+    // declared column sets
+    ApplyTreeColumns();
 
     // if user set active branches
     TObjArray* aractive=fActiveBranches.Tokenize(";");
@@ -726,6 +755,49 @@ void AliAnalysisTaskReducedTreeMaker::UserExec(Option_t *option)
   }
 }
 
+//_________________________________________________________________________________
+void AliAnalysisTaskReducedTreeMaker::ApplyTreeColumns()
+{
+  //
+  // Switch off the branches which are not part of the declared column sets.
+  // Event columns are the data members of the event class, track and pair columns the data members
+  // of the objects in fTracks/fTracks2 and fCandidates. The array counters stay always on.
+  // Needs a split Event branch; the active/inactive branch lists are applied on top of this.
+  //
+  if(fEventColumns.IsNull() && fTrackColumns.IsNull() && fPairColumns.IsNull()) return;
+  if(fTreeSplitLevel<2) {
+    printf("AliAnalysisTaskReducedTreeMaker::ApplyTreeColumns() WARNING: column sets need a split Event branch, ignored\n");
+    return;
+  }
+
+  const Char_t* arrays[3] = {"fTracks", "fTracks2", "fCandidates"};
+  const Char_t* arrayColumns[3] = {fTrackColumns.Data(), fTrackColumns.Data(), fPairColumns.Data()};
+  for(Int_t ia=0; ia<3; ++ia) {
+    if(!arrayColumns[ia][0] || !fTree->GetBranch(arrays[ia])) continue;
+    fTree->SetBranchStatus(Form("%s.*", arrays[ia]), 0);
+    TObjArray* cols = TString(arrayColumns[ia]).Tokenize(";");
+    for(Int_t i=0; i<cols->GetEntries(); ++i)
+      fTree->SetBranchStatus(Form("%s.%s*", arrays[ia], cols->At(i)->GetName()), 1);
+    delete cols;
+  }
+
+  if(fEventColumns.IsNull()) return;
+  TBranch* eventBranch = fTree->GetBranch("Event");
+  if(!eventBranch) return;
+  TObjArray* cols = fEventColumns.Tokenize(";");
+  TObjArray* branches = eventBranch->GetListOfBranches();
+  for(Int_t ib=0; ib<branches->GetEntries(); ++ib) {
+    TString name = branches->At(ib)->GetName();
+    if(name.Index("[")>0) name.Remove(name.Index("["));
+    if(name.Index(".")>0) name.Remove(name.Index("."));
+    if(name=="fTracks" || name=="fTracks2" || name=="fCandidates") continue;
+    if(cols->FindObject(name.Data())) continue;
+    fTree->SetBranchStatus(branches->At(ib)->GetName(), 0);
+    fTree->SetBranchStatus(Form("%s.*", name.Data()), 0);
+  }
+  delete cols;
+}
+
 //_________________________________________________________________________________
 void AliAnalysisTaskReducedTreeMaker::FillStatisticsHistograms(Bool_t isSelected, UInt_t physSel, 
                                     UChar_t trdTrigMap, UInt_t emcalTrigMap, Double_t xbin, Double_t* percentiles, Int_t nEstimators) {
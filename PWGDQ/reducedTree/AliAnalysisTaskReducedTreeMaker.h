@@ -93,6 +93,15 @@ public:
   // TStrings with active or inactive branches
   void SetTreeActiveBranch(TString b)   {fActiveBranches+=b+";";}
   void SetTreeInactiveBranch(TString b) {fInactiveBranches+=b+";";}
+  // Declared column sets (";" separated data member names); an empty set keeps all the columns of that object
+  void SetTreeEventColumns(TString c)   {fEventColumns=c;}
+  void SetTreeTrackColumns(TString c)   {fTrackColumns=c;}
+  void SetTreePairColumns(TString c)    {fPairColumns=c;}
+  // Output tree layout and compression
+  void SetTreeSplitLevel(Int_t split=99)       {fTreeSplitLevel=split;}
+  void SetTreeBasketSize(Int_t size=16000)     {fTreeBasketSize=size;}
+  void SetTreeAutoFlush(Long64_t flush)        {fTreeAutoFlush=flush;}   // >0: entries, <0: bytes, 0: ROOT default
+  void SetTreeImplicitMT(Bool_t flag=kTRUE, Int_t nThreads=0) {fTreeImplicitMT=flag; fTreeMTThreads=nThreads;}
   
   // Select the type of information to be written
   void SetTreeWritingOption(Int_t option)         {fTreeWritingOption = option;}
@@ -197,6 +206,14 @@ public:
 
   TString fActiveBranches;          // list of active output tree branches
   TString fInactiveBranches;        // list of inactive output tree branches
+  TString fEventColumns;            // written event data members (empty: all)
+  TString fTrackColumns;            // written track data members (empty: all)
+  TString fPairColumns;             // written pair candidate data members (empty: all)
+  Int_t fTreeSplitLevel;            // split level of the Event branch
+  Int_t fTreeBasketSize;            // basket size of the Event branch
+  Long64_t fTreeAutoFlush;          // auto-flush setting of the tree (0: ROOT default)
+  Bool_t fTreeImplicitMT;           // compress the baskets in parallel ROOT tasks
+  Int_t fTreeMTThreads;             // size of the ROOT thread pool (0: ROOT decides)
 
   TFile *fTreeFile;                  //! output file containing the tree
   TTree *fTree;                      //! Reduced event tree
@@ -209,6 +226,7 @@ public:
   AliTimeRangeCut     fTimeRangeCut;      //! time range selection based on OADB
   Bool_t              fTimeRangeReject;   //  do not accept events if these are marked by fTimeRangeCut
   
+  void ApplyTreeColumns();                  // switch off the branches not in the declared column sets
   void FillEventInfo();                     // fill reduced event information
   void FillTrackInfo();                     // fill reduced track information
   void FillMCTruthInfo();                   // fill MC truth particles
@@ -240,6 +258,6 @@ public:
   AliAnalysisTaskReducedTreeMaker(const AliAnalysisTaskReducedTreeMaker &c);
   AliAnalysisTaskReducedTreeMaker& operator= (const AliAnalysisTaskReducedTreeMaker &c);
 
-  ClassDef(AliAnalysisTaskReducedTreeMaker, 19); //Analysis Task for creating a reduced event information tree
+  ClassDef(AliAnalysisTaskReducedTreeMaker, 20); //Analysis Task for creating a reduced event information tree
 };
 #endif
@@ -14,6 +14,8 @@
 #include <TList.h>
 #include <THashList.h>
 
+#include <vector>
+
 #include "AliReducedVarManager.h"
 
 class TAxis;
@@ -69,6 +71,8 @@ class AliHistogramManager : public TObject {
                         TAxis* axis);
   
   void FillHistClass(const Char_t* className, Float_t* values);
+  Int_t GetHistClassHandle(const Char_t* className);        // resolve a class once, -1 if it does not exist
+  void FillHistClass(Int_t handle, Float_t* values);        // fill a class resolved with GetHistClassHandle()
   
   void SetUseDefaultVariableNames(Bool_t flag) {fUseDefaultVariableNames = flag;};
   void SetDefaultVarNames(TString* vars, TString* units);
@@ -106,9 +110,27 @@ class AliHistogramManager : public TObject {
   TString fVariableUnits[AliReducedVarManager::kNVars];               //! variable units
   Int_t fNVars;                          // maximum number of variables
   
+  // histogram of a class with its decoded variables, see ResolveHandle()
+  enum EFillType {kFillTH1=0, kFillTH2, kFillTH3, kFillProfile, kFillProfile2D, kFillProfile3D, kFillTHn};
+  struct FillEntry {
+    TObject* fHist;      // histogram
+    Int_t    fType;      // EFillType
+    Int_t    fFirstVar;  // position of the first axis variable in ClassHandle::fVars
+    Int_t    fNVars;     // number of axis variables
+    Int_t    fVarW;      // weight variable, -1 if not weighted
+  };
+  struct ClassHandle {
+    THashList* fList;                // histogram class
+    std::vector<FillEntry> fEntries; // histograms to be filled
+    std::vector<Int_t> fVars;        // axis variables of all histograms
+  };
+  std::vector<ClassHandle> fHandles;     //! histogram classes resolved for filling, the handle is stored in the list unique ID
+  Bool_t fHandlesValid;                  //! false if histograms were added after the classes were resolved
+
   void MakeAxisLabels(TAxis* ax, const Char_t* labels);
+  void ResolveHandle(ClassHandle& handle) const;
   
-  ClassDef(AliHistogramManager, 4)
+  ClassDef(AliHistogramManager, 5)
 };
 
 #endif
@@ -14,6 +14,7 @@
 using std::cout;
 using std::endl;
 using std::flush;
+#include <cmath>
 
 #include <TMath.h>
 #include <TTimeStamp.h>
@@ -25,6 +26,58 @@ using std::flush;
 
 ClassImp(AliMixingHandler);
 
+namespace {
+  //
+  // Leg kinematics of one pool event stored as arrays, used by the mixed pair kernel
+  //
+  struct MixingLegs {
+    std::vector<Float_t> fPx;
+    std::vector<Float_t> fPy;
+    std::vector<Float_t> fPz;
+    std::vector<Float_t> fP2;
+    std::vector<ULong_t> fFlags;
+    std::vector<AliReducedBaseTrack*> fTracks;
+
+    void Fill(TList* list, ULong_t mixingMask) {
+      fPx.clear(); fPy.clear(); fPz.clear(); fP2.clear(); fFlags.clear(); fTracks.clear();
+      if(!list) return;
+      TIter next(list);
+      AliReducedBaseTrack* track=0x0;
+      while((track=(AliReducedBaseTrack*)next())) {
+        ULong_t flags = mixingMask & track->GetFlags();
+        if(!flags) continue;
+        fPx.push_back(track->Px()); fPy.push_back(track->Py()); fPz.push_back(track->Pz());
+        fP2.push_back(track->Px()*track->Px()+track->Py()*track->Py()+track->Pz()*track->Pz());
+        fFlags.push_back(flags);
+        fTracks.push_back(track);
+      }
+    }
+    Int_t Size() const {return fTracks.size();}
+  };
+
+  //
+  // Mass, pt and rapidity of leg i of a (mass m1) combined with all the legs of b (mass m2).
+  // Same mass formula as AliReducedVarManager::FillPairInfoME()
+  //
+  void MixedPairKernel(const MixingLegs& a, Int_t i, Float_t m1, const MixingLegs& b, Float_t m2,
+                       Float_t* mass, Float_t* pt, Float_t* rap) {
+    const Float_t px1 = a.fPx[i], py1 = a.fPy[i], pz1 = a.fPz[i];
+    const Float_t e1 = std::sqrt(m1*m1+a.fP2[i]);
+    const Float_t mm = m1*m1+m2*m2;
+    const Float_t* px2 = b.fPx.data(); const Float_t* py2 = b.fPy.data();
+    const Float_t* pz2 = b.fPz.data(); const Float_t* p22 = b.fP2.data();
+    const Int_t n = b.Size();
+    for(Int_t j=0; j<n; ++j) {
+      const Float_t e2 = std::sqrt(m2*m2+p22[j]);
+      const Float_t m = mm + 2.0f*(e1*e2 - px1*px2[j] - py1*py2[j] - pz1*pz2[j]);
+      mass[j] = (m>0.0f ? std::sqrt(m) : 0.0f);
+      const Float_t sx = px1+px2[j], sy = py1+py2[j], sz = pz1+pz2[j], se = e1+e2;
+      pt[j] = std::sqrt(sx*sx+sy*sy);
+      rap[j] = (se>std::abs(sz) ? 0.5f*std::log((se+sz)/(se-sz)) : 0.0f);
+    }
+  }
+}
+
 //_________________________________________________________________________
 AliMixingHandler::AliMixingHandler(Int_t mixingSetup /* = kMixResonanceLegs*/) :
   TNamed(),
@@ -41,6 +94,8 @@ AliMixingHandler::AliMixingHandler(Int_t mixingSetup /* = kMixResonanceLegs*/) :
   fPoolSize(),
   fIsInitialized(kFALSE),
   fMixLikeSign(kTRUE),
+  fUseVectorizedMixing(kFALSE),
+  fMixedPairCut(),
   fVariableLimits(),
   fVariables(),
   fNMixingVariables(0),
@@ -59,6 +114,9 @@ AliMixingHandler::AliMixingHandler(Int_t mixingSetup /* = kMixResonanceLegs*/) :
   }
   
   fPoolSize.Set(1);
+  fMixedPairCut[0] = 0.0; fMixedPairCut[1] = 1.0e+30;
+  fMixedPairCut[2] = 0.0; fMixedPairCut[3] = 1.0e+30;
+  fMixedPairCut[4] = -1.0e+30; fMixedPairCut[5] = 1.0e+30;
   fCrossPairsCuts.SetOwner(kTRUE);
   fLikePairsLeg1Cuts.SetOwner(kTRUE);
   fLikePairsLeg2Cuts.SetOwner(kTRUE);
@@ -81,6 +139,8 @@ AliMixingHandler::AliMixingHandler(const Char_t* name, const Char_t* title, Int_
   fPoolSize(),
   fIsInitialized(kFALSE),
   fMixLikeSign(kTRUE),
+  fUseVectorizedMixing(kFALSE),
+  fMixedPairCut(),
   fVariableLimits(),
   fVariables(),
   fNMixingVariables(0),
@@ -99,6 +159,9 @@ AliMixingHandler::AliMixingHandler(const Char_t* name, const Char_t* title, Int_
   }
   
   fPoolSize.Set(1);
+  fMixedPairCut[0] = 0.0; fMixedPairCut[1] = 1.0e+30;
+  fMixedPairCut[2] = 0.0; fMixedPairCut[3] = 1.0e+30;
+  fMixedPairCut[4] = -1.0e+30; fMixedPairCut[5] = 1.0e+30;
   fCrossPairsCuts.SetOwner(kTRUE);
   fLikePairsLeg1Cuts.SetOwner(kTRUE);
   fLikePairsLeg2Cuts.SetOwner(kTRUE);
@@ -453,6 +516,12 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
   Int_t entries = leg1Pool->GetEntries();
   if(entries<2) return;
   
+  if(fUseVectorizedMixing && fMixingSetup==kMixResonanceLegs) {
+    RunEventMixingVectorized(leg1Pool, leg2Pool, mixingMask, type, values);
+    ReleasePoolTracks(leg1Pool, leg2Pool, mixingMask);
+    return;
+  }
+  
   TObjArray* histClassArr = fHistClassNames.Tokenize(";");
   
   TIter iterEv1Leg1Pool(leg1Pool);
@@ -593,9 +662,112 @@ void AliMixingHandler::RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2
    }  // end second event loop
  }  // end first event loop
   
+  ReleasePoolTracks(leg1Pool, leg2Pool, mixingMask);
+}
+
+
+//_________________________________________________________________________
+void AliMixingHandler::RunEventMixingVectorized(TClonesArray* leg1Pool, TClonesArray* leg2Pool, ULong_t mixingMask,
+                                                Int_t type, Float_t* values) {
+  //
+  // Event mixing for resonance legs: same pairs and histograms as RunEventMixing(), but the legs of each pool
+  // event are copied once into arrays and the mass, pt and rapidity of a leg with all the legs of another event
+  // are computed in one loop. FillPairInfoME() runs only for the pairs inside the fMixedPairCut window.
+  //
+  Int_t entries = leg1Pool->GetEntries();
+  Float_t m1 = 0.0; Float_t m2 = 0.0;
+  AliReducedVarManager::GetLegMassAssumption(type, m1, m2);
+  
+  TObjArray* histClassArr = fHistClassNames.Tokenize(";");
+  std::vector<Int_t> histHandles(histClassArr->GetEntries());
+  for(Int_t i=0; i<histClassArr->GetEntries(); ++i) histHandles[i] = fHistos->GetHistClassHandle(histClassArr->At(i)->GetName());
+  delete histClassArr;
+  
+  std::vector<MixingLegs> legs1(entries);
+  std::vector<MixingLegs> legs2(entries);
+  Int_t maxLegs = 0;
+  for(Int_t iev=0; iev<entries; ++iev) {
+    legs1[iev].Fill((TList*)leg1Pool->At(iev), mixingMask);
+    legs2[iev].Fill((TList*)leg2Pool->At(iev), mixingMask);
+    maxLegs = TMath::Max(maxLegs, TMath::Max(legs1[iev].Size(), legs2[iev].Size()));
+  }
+  std::vector<Float_t> mass(maxLegs), pt(maxLegs), rap(maxLegs);
+  
+  for(Int_t iev1=0; iev1<entries; ++iev1) {                            // first event loop
+    const MixingLegs& ev1Leg1 = legs1[iev1];
+    const MixingLegs& ev1Leg2 = legs2[iev1];
+    for(Int_t iev2=0; iev2<entries; ++iev2) {                         // second event loop
+      if(iev1==iev2) continue;
+      const MixingLegs& ev2Leg1 = legs1[iev2];
+      const MixingLegs& ev2Leg2 = legs2[iev2];
+      
+      for(Int_t i=0; i<ev1Leg1.Size(); ++i) {
+        // cross-pairs (leg1 - leg2)
+        MixedPairKernel(ev1Leg1, i, m1, ev2Leg2, m2, mass.data(), pt.data(), rap.data());
+        FillMixedPairs(ev1Leg1.fTracks[i], ev1Leg1.fFlags[i], ev2Leg2.fTracks.data(), ev2Leg2.fFlags.data(),
+                       mass.data(), pt.data(), rap.data(), ev2Leg2.Size(), 1, type, values, histHandles);
+        if(!fMixLikeSign) continue;
+        // like-pairs (leg1 - leg1)
+        MixedPairKernel(ev1Leg1, i, m1, ev2Leg1, m2, mass.data(), pt.data(), rap.data());
+        FillMixedPairs(ev1Leg1.fTracks[i], ev1Leg1.fFlags[i], ev2Leg1.fTracks.data(), ev2Leg1.fFlags.data(),
+                       mass.data(), pt.data(), rap.data(), ev2Leg1.Size(), 0, type, values, histHandles);
+      }
+      
+      if(!fMixLikeSign) continue;
+      // like-pairs (leg2 - leg2)
+      for(Int_t i=0; i<ev1Leg2.Size(); ++i) {
+        MixedPairKernel(ev1Leg2, i, m1, ev2Leg2, m2, mass.data(), pt.data(), rap.data());
+        FillMixedPairs(ev1Leg2.fTracks[i], ev1Leg2.fFlags[i], ev2Leg2.fTracks.data(), ev2Leg2.fFlags.data(),
+                       mass.data(), pt.data(), rap.data(), ev2Leg2.Size(), 2, type, values, histHandles);
+      }
+    }  // end second event loop
+  }  // end first event loop
+}
+
+
+//_________________________________________________________________________
+void AliMixingHandler::FillMixedPairs(AliReducedBaseTrack* leg, ULong_t legFlags, AliReducedBaseTrack* const* partners, const ULong_t* partnerFlags,
+                                      const Float_t* mass, const Float_t* pt, const Float_t* rap, Int_t n,
+                                      Int_t pairType, Int_t type, Float_t* values, const std::vector<Int_t>& histHandles) {
+  //
+  // Fill the histograms for the pairs of leg with its partners passing the kinematic window
+  // pairType: 0 (leg1-leg1), 1 (leg1-leg2), 2 (leg2-leg2)
+  //
+  for(Int_t j=0; j<n; ++j) {
+    ULong_t testFlags = legFlags & partnerFlags[j];
+    if(!testFlags) continue;
+    if(mass[j]<fMixedPairCut[0] || mass[j]>fMixedPairCut[1]) continue;
+    if(pt[j]<fMixedPairCut[2] || pt[j]>fMixedPairCut[3]) continue;
+    if(rap[j]<fMixedPairCut[4] || rap[j]>fMixedPairCut[5]) continue;
+    
+    AliReducedVarManager::FillPairInfoME(leg, partners[j], type, values);
+    ULong_t pairCutMask = IsPairSelected(values, pairType);
+    if(!pairCutMask) continue;   // fill histograms only if pair cuts are fulfilled
+    for(Int_t ibit=0; ibit<fNParallelCuts; ++ibit) {
+      if(!(testFlags&(ULong_t(1)<<ibit))) continue;
+      if(fNParallelPairCuts>1) {
+        for(Int_t jbit=0; jbit<fNParallelPairCuts; jbit++) {
+          if(!(pairCutMask&(ULong_t(1)<<jbit))) continue;
+          fHistos->FillHistClass(histHandles[ibit*3+jbit*3*fNParallelCuts+pairType], values);
+        }
+      }
+      else
+        fHistos->FillHistClass(histHandles[ibit*3+pairType], values);
+    }
+  }
+}
+
+
+//_________________________________________________________________________
+void AliMixingHandler::ReleasePoolTracks(TClonesArray* leg1Pool, TClonesArray* leg2Pool, ULong_t mixingMask) {
+  //
+  // Unset the mixing flags of the mixed cuts and remove the tracks and events not needed anymore
+  //
   // unset the mixing flags --------------------------------------
-  iterEv1Leg1Pool.Reset(); 
-  iterEv1Leg2Pool.Reset();
+  Int_t entries = leg1Pool->GetEntries();
+  ULong_t testFlags1 = 0;
+  TIter iterEv1Leg1Pool(leg1Pool);
+  TIter iterEv1Leg2Pool(leg2Pool);
   for(Int_t ie1=0; ie1<entries; ++ie1) {
     TList* leg1List = (TList*)iterEv1Leg1Pool();        
     TIter iterLeg1(leg1List);
@@ -14,6 +14,8 @@
 #include <TList.h>
 #include <TString.h>
 
+#include <vector>
+
 #include "AliHistogramManager.h"
 #include "AliReducedVarManager.h"
 #include "AliReducedInfoCut.h"
@@ -45,6 +47,10 @@ public:
   void SetNParallelPairCuts(Int_t n) {fNParallelPairCuts = n;}
   void SetHistogramManager(AliHistogramManager* histos) {fHistos = histos;}
   void SetHistClassNames(const Char_t* names) {fHistClassNames = names;}
+  void SetUseVectorizedMixing(Bool_t flag=kTRUE) {fUseVectorizedMixing = flag;}
+  void SetMixedPairKinematicCut(Float_t mMin, Float_t mMax, Float_t ptMin=0.0, Float_t ptMax=1.0e+30, Float_t yMin=-1.0e+30, Float_t yMax=1.0e+30) {
+    fMixedPairCut[0]=mMin; fMixedPairCut[1]=mMax; fMixedPairCut[2]=ptMin; fMixedPairCut[3]=ptMax; fMixedPairCut[4]=yMin; fMixedPairCut[5]=yMax;
+  }
   void AddCrossPairsCut(AliReducedInfoCut* cut) {fCrossPairsCuts.Add(cut);}
   void AddOppositeSignPairsCut(AliReducedInfoCut* cut) {fCrossPairsCuts.Add(cut);}    // synonim function to AddCrossPairsCut() used for charged legs
   void AddLikePairsLeg1Cut(AliReducedInfoCut* cut) {fLikePairsLeg1Cuts.Add(cut);}
@@ -100,6 +106,8 @@ private:
   TArrayI fPoolSize;               // counters for the pool sizes
   Bool_t fIsInitialized;           // check if the mixing handler is initialized
   Bool_t fMixLikeSign;             // mix or not like-sign tracks (default is true)
+  Bool_t fUseVectorizedMixing;     // resonance legs: compute the mixed pair kinematics in arrays, see RunEventMixingVectorized()
+  Float_t fMixedPairCut[6];        // mass, pt and rapidity window applied on the mixed pair kinematics before FillPairInfoME()
   
   TArrayF fVariableLimits[kNMaxVariables];
   Int_t fVariables[kNMaxVariables];
@@ -112,10 +120,15 @@ private:
   TList fLikePairsLeg2Cuts;    // cut object for LEG2 like pairs
   
   void RunEventMixing(TClonesArray* leg1Pool, TClonesArray* leg2Pool, ULong_t mixingMask, Int_t type, Float_t* values);
+  void RunEventMixingVectorized(TClonesArray* leg1Pool, TClonesArray* leg2Pool, ULong_t mixingMask, Int_t type, Float_t* values);
+  void FillMixedPairs(AliReducedBaseTrack* leg, ULong_t legFlags, AliReducedBaseTrack* const* partners, const ULong_t* partnerFlags,
+                      const Float_t* mass, const Float_t* pt, const Float_t* rap, Int_t n,
+                      Int_t pairType, Int_t type, Float_t* values, const std::vector<Int_t>& histHandles);
+  void ReleasePoolTracks(TClonesArray* leg1Pool, TClonesArray* leg2Pool, ULong_t mixingMask);
   ULong_t IncrementPoolSizes(TList* list1, TList* list2, Int_t eventCategory);
   void ResetPoolSizes(ULong_t mixingMask, Int_t category);  
   
-  ClassDef(AliMixingHandler,4);
+  ClassDef(AliMixingHandler,5);
 };
 
 #endif
@@ -5,6 +5,11 @@
 
 #include <TTree.h>
 #include <TFile.h>
+#include <TBranch.h>
+#include <TObjArray.h>
+#include <TObjString.h>
+#include <TROOT.h>
+#include <RVersion.h>
 #include "AliReducedEventInputHandler.h"
 #include "AliReducedBaseEvent.h"
 #include "AliReducedEventInfo.h"
@@ -15,7 +20,17 @@ ClassImp(AliReducedEventInputHandler)
 AliReducedEventInputHandler::AliReducedEventInputHandler() :
     AliInputEventHandler(),
     fEventInputOption(kReducedBaseEvent),
-    fReducedEvent(0)
+    fReducedEvent(0),
+    fNThreads(0),
+    fCacheSize(0),
+    fCacheEntries(1000),
+    fLearnEntries(0),
+    fUsedBranches(""),
+    fReadBytes(0),
+    fBytesAtStart(-1),
+    fReadTime(0.),
+    fNReadEntries(0),
+    fReadTimer()
 {
   // Default constructor
 }
@@ -24,7 +39,17 @@ AliReducedEventInputHandler::AliReducedEventInputHandler() :
 AliReducedEventInputHandler::AliReducedEventInputHandler(const char* name, const char* title):
   AliInputEventHandler(name, title),
   fEventInputOption(kReducedBaseEvent),
-  fReducedEvent(0)
+  fReducedEvent(0),
+  fNThreads(0),
+  fCacheSize(0),
+  fCacheEntries(1000),
+  fLearnEntries(0),
+  fUsedBranches(""),
+  fReadBytes(0),
+  fBytesAtStart(-1),
+  fReadTime(0.),
+  fNReadEntries(0),
+  fReadTimer()
  {
     // Constructor
 }
@@ -45,6 +70,14 @@ Bool_t AliReducedEventInputHandler::Init(TTree* tree, Option_t* opt)
 
     SwitchOffBranches();
     SwitchOnBranches();
+    if (!fUsedBranches.IsNull()) {
+       fTree->SetBranchStatus("*", 0);
+       TObjArray* patterns = fUsedBranches.Tokenize(":");
+       for (Int_t i=0; i<patterns->GetEntries(); ++i)
+          fTree->SetBranchStatus(patterns->At(i)->GetName(), 1);
+       delete patterns;
+    }
+    SetupIO();
     
     // Get pointer to the event
     if (!fReducedEvent) {
@@ -71,7 +104,12 @@ Bool_t AliReducedEventInputHandler::BeginEvent(Long64_t entry)
     if (prevRunNumber != fReducedEvent->RunNo() ) {
       prevRunNumber = fReducedEvent->RunNo();
     } 
+    fReadTimer.Start(kFALSE);
     fTree->GetEvent(entry);
+    fReadTimer.Stop();
+    ++fNReadEntries;
+    fReadTime = fReadTimer.RealTime();
+    fReadBytes = TFile::GetFileBytesRead() - fBytesAtStart;
     
     // set transient pointer to event inside tracks
     // fEvent->ConnectTracks();
@@ -101,3 +139,63 @@ Bool_t AliReducedEventInputHandler::FinishEvent()
   if (fReducedEvent) fReducedEvent->ClearEvent();
   return kTRUE;
 }
+
+//______________________________________________________________________________
+Bool_t AliReducedEventInputHandler::Terminate()
+{
+  // Report the I/O statistics of the job
+  Info("Terminate", "%lld entries, %.1f MB read, %.1f s spent in reading and decompression (%.1f MB/s)",
+       fNReadEntries, fReadBytes/1048576., fReadTime, (fReadTime>0. ? fReadBytes/1048576./fReadTime : 0.));
+  return kTRUE;
+}
+
+//______________________________________________________________________________
+void AliReducedEventInputHandler::SetupIO()
+{
+  // Implicit MT decompression and TTreeCache for the active branches
+  if (fBytesAtStart<0) fBytesAtStart = TFile::GetFileBytesRead();
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,8,0)
+  if (fNThreads>0 && !ROOT::IsImplicitMTEnabled()) {
+    ROOT::EnableImplicitMT(fNThreads);
+    Info("SetupIO", "Implicit MT decompression with %d threads", fNThreads);
+  }
+#else
+  if (fNThreads>0) Warning("SetupIO", "Implicit MT needs ROOT 6.08, reading single threaded");
+#endif
+
+  Long64_t cacheSize = (fCacheSize<0 ? EstimateCacheSize() : fCacheSize);
+  if (cacheSize<=0) return;
+  fTree->SetCacheSize(cacheSize);
+  if (fLearnEntries>0) fTree->SetCacheLearnEntries(fLearnEntries);
+  else fTree->AddBranchToCache("*", kTRUE);   // only active branches are added
+  Info("SetupIO", "TTreeCache of %.1f MB", cacheSize/1048576.);
+}
+
+//______________________________________________________________________________
+Long64_t AliReducedEventInputHandler::EstimateCacheSize() const
+{
+  // Cache size holding fCacheEntries entries of the active branches, within [1 MB, 256 MB]
+  TTree* tree = fTree->GetTree();
+  if (!tree || tree->GetEntries()<=0) return 0;
+  Long64_t zipBytes = 0;
+  TObjArray* branches = tree->GetListOfBranches();
+  for (Int_t i=0; i<branches->GetEntriesFast(); ++i)
+    zipBytes += ActiveZipBytes((TBranch*)branches->UncheckedAt(i));
+  Long64_t size = Long64_t(Double_t(zipBytes)/tree->GetEntries()*fCacheEntries);
+  if (size<(1<<20)) size = 1<<20;
+  if (size>(256<<20)) size = 256<<20;
+  return size;
+}
+
+//______________________________________________________________________________
+Long64_t AliReducedEventInputHandler::ActiveZipBytes(TBranch* branch)
+{
+  // Compressed size of the active (sub-)branches
+  if (!branch) return 0;
+  TObjArray* sub = branch->GetListOfBranches();
+  if (!sub || sub->GetEntriesFast()==0) return (branch->TestBit(kDoNotProcess) ? 0 : branch->GetZipBytes());
+  Long64_t bytes = 0;
+  for (Int_t i=0; i<sub->GetEntriesFast(); ++i) bytes += ActiveZipBytes((TBranch*)sub->UncheckedAt(i));
+  return bytes;
+}
@@ -6,10 +6,13 @@
 //     Author: Ionut-Cristian Arsene, iarsene@cern.ch, i.c.arsene@fys.uio.no
 //
 
+#include <TString.h>
+#include <TStopwatch.h>
 #include "AliInputEventHandler.h"
 #include "AliReducedBaseEvent.h"
 //#include "AliReducedEventInfo.h"
 class TTree;
+class TBranch;
 
 class AliReducedEventInputHandler : public AliInputEventHandler {
   public:
@@ -30,19 +33,45 @@ class AliReducedEventInputHandler : public AliInputEventHandler {
     virtual Bool_t                             Notify() { return AliVEventHandler::Notify();};
     virtual Bool_t                             Notify(const char* path);
     virtual Bool_t                             FinishEvent();
+    virtual Bool_t                             Terminate();
              
                  void                                SetInputEventType(Int_t type) {fEventInputOption = type;} ;
                  Int_t                               GetInputEventType() const {return fEventInputOption;};
+
+                 // I/O tuning
+                 void                                SetNThreads(Int_t n) {fNThreads = n;}                     // implicit MT basket decompression, 0: off
+                 void                                SetCacheSize(Long64_t size) {fCacheSize = size;}          // TTreeCache size in bytes, -1: from the active branches, 0: off
+                 void                                SetCacheEntries(Int_t n) {fCacheEntries = n;}             // entries held by the cache if its size is estimated
+                 void                                SetLearnEntries(Int_t n) {fLearnEntries = n;}             // TTreeCache learning phase
+                 void                                SetUsedBranches(const Char_t* branches) {fUsedBranches = branches;}  // ":" separated list of branch name patterns to be read, all others are switched off
+                 Long64_t                            GetReadBytes() const {return fReadBytes;}
+                 Double_t                            GetReadTime() const {return fReadTime;}
+                 Long64_t                            GetNReadEntries() const {return fNReadEntries;}
                  
  private:
     AliReducedEventInputHandler(const AliReducedEventInputHandler& handler);             
     AliReducedEventInputHandler& operator=(const AliReducedEventInputHandler& handler);      
     
+    void     SetupIO();
+    Long64_t EstimateCacheSize() const;
+    static Long64_t ActiveZipBytes(TBranch* branch);
+
     Int_t  fEventInputOption;                          // one of the options listed in EReducedEventInputType
     AliReducedBaseEvent* fReducedEvent;   //! Pointer to the event
     //AliReducedEventInfo* fReducedEvent;   //! Pointer to the event
+
+    Int_t    fNThreads;                   // number of threads for the implicit MT decompression, 0: off
+    Long64_t fCacheSize;                  // TTreeCache size, -1: estimated from the active branches, 0: off
+    Int_t    fCacheEntries;               // number of entries in the cache if the size is estimated
+    Int_t    fLearnEntries;               // number of entries of the TTreeCache learning phase, 0: ROOT default
+    TString  fUsedBranches;               // branches to be read, all if empty
+    Long64_t fReadBytes;                  //! bytes read from file
+    Long64_t fBytesAtStart;               //! file read counter at the first Init
+    Double_t fReadTime;                   //! real time spent in reading and decompressing the entries
+    Long64_t fNReadEntries;               //! number of entries read
+    TStopwatch fReadTimer;                //! timer for fReadTime
     
-    ClassDef(AliReducedEventInputHandler, 2);
+    ClassDef(AliReducedEventInputHandler, 3);
 };
 
 #endif
@@ -196,6 +196,26 @@ Bool_t                          AliReducedVarManager::fgOptionEventRes = kFALSE;
 TH1F*                           AliReducedVarManager::fgReweightMCpt=0x0;
 TH3F*                           AliReducedVarManager::fgLegEfficiency=0x0;
 Bool_t                          AliReducedVarManager::fgUsePinForLegEffPropagation = kFALSE;
+std::vector<Int_t>              AliReducedVarManager::fgUsedTrackVars;
+Int_t                           AliReducedVarManager::fgTrackColumn[AliReducedVarManager::kNVars] = {0};
+std::vector<AliReducedVarManager::TrackKernel> AliReducedVarManager::fgTrackKernels;
+
+namespace {
+  // kernels for the base track variables of FillTrackInfo, used if no other track variable is needed
+  Float_t KernelPt(BASETRACK* p)           {return p->Pt();}
+  Float_t KernelPtSquared(BASETRACK* p)    {return p->Pt()*p->Pt();}
+  Float_t KernelOneOverSqrtPt(BASETRACK* p){return p->Pt() > 0. ? 1./TMath::Sqrt(p->Pt()) : 999.;}
+  Float_t KernelP(BASETRACK* p)            {return p->P();}
+  Float_t KernelPx(BASETRACK* p)           {return p->Px();}
+  Float_t KernelPy(BASETRACK* p)           {return p->Py();}
+  Float_t KernelPz(BASETRACK* p)           {return p->Pz();}
+  Float_t KernelTheta(BASETRACK* p)        {return p->Theta();}
+  Float_t KernelPhi(BASETRACK* p)          {return p->Phi();}
+  Float_t KernelEta(BASETRACK* p)          {return p->Eta();}
+  Float_t KernelCharge(BASETRACK* p)       {return p->Charge();}
+  template<Int_t n> Float_t KernelCosNPhi(BASETRACK* p) {return TMath::Cos(p->Phi()*n);}
+  template<Int_t n> Float_t KernelSinNPhi(BASETRACK* p) {return TMath::Sin(p->Phi()*n);}
+}
 //__________________________________________________________________
 AliReducedVarManager::AliReducedVarManager() :
   TObject()
@@ -1573,6 +1593,89 @@ void AliReducedVarManager::FillMCTruthInfo(TRACK* leg1, TRACK* leg2, Float_t* va
 }
 
 
+//_________________________________________________________________
+void AliReducedVarManager::CompileTrackKernels() {
+  //
+  // build the list of used track variables and their column index for FillTrackColumns()
+  // If all of them are base kinematic variables, each column gets its own kernel,
+  // otherwise the full FillTrackInfo() is run per track
+  //
+  fgUsedTrackVars.clear();
+  fgTrackKernels.clear();
+  for(Int_t i=0; i<kNVars; ++i) fgTrackColumn[i] = -1;
+  for(Int_t i=kNEventVars; i<kNTrackVars; ++i) {
+    if(!fgUsedVars[i]) continue;
+    fgTrackColumn[i] = fgUsedTrackVars.size();
+    fgUsedTrackVars.push_back(i);
+  }
+
+  static const TrackKernel cosKernels[6] = {KernelCosNPhi<1>, KernelCosNPhi<2>, KernelCosNPhi<3>,
+                                            KernelCosNPhi<4>, KernelCosNPhi<5>, KernelCosNPhi<6>};
+  static const TrackKernel sinKernels[6] = {KernelSinNPhi<1>, KernelSinNPhi<2>, KernelSinNPhi<3>,
+                                            KernelSinNPhi<4>, KernelSinNPhi<5>, KernelSinNPhi<6>};
+  for(UInt_t i=0; i<fgUsedTrackVars.size(); ++i) {
+    Int_t var = fgUsedTrackVars[i];
+    TrackKernel kernel = 0x0;
+    switch(var) {
+      case kPt:            kernel = KernelPt;            break;
+      case kPtSquared:     kernel = KernelPtSquared;     break;
+      case kOneOverSqrtPt: kernel = KernelOneOverSqrtPt; break;
+      case kP:             kernel = KernelP;             break;
+      case kPx:            kernel = KernelPx;            break;
+      case kPy:            kernel = KernelPy;            break;
+      case kPz:            kernel = KernelPz;            break;
+      case kTheta:         kernel = KernelTheta;         break;
+      case kPhi:           kernel = KernelPhi;           break;
+      case kEta:           kernel = KernelEta;           break;
+      case kCharge:        kernel = KernelCharge;        break;
+      default:
+        if(var>=kCosNPhi && var<kCosNPhi+6) kernel = cosKernels[var-kCosNPhi];
+        if(var>=kSinNPhi && var<kSinNPhi+6) kernel = sinKernels[var-kSinNPhi];
+        break;
+    }
+    if(!kernel) {
+      fgTrackKernels.clear();
+      return;
+    }
+    fgTrackKernels.push_back(kernel);
+  }
+}
+
+//_________________________________________________________________
+Int_t AliReducedVarManager::FillTrackColumns(BASEEVENT* event, std::vector<Float_t>& columns, const Float_t* eventValues /*=0x0*/) {
+  //
+  // fill the used track variables of all tracks in the event into a column-oriented buffer:
+  //   columns[GetTrackColumn(var)*nTracks + itrack]
+  // eventValues are needed for track variables which depend on event quantities (e.g. flow),
+  // without them these are computed with zero event values.
+  // Returns the number of tracks
+  //
+  CompileTrackKernels();
+  Int_t nTracks = (event ? event->NTracks1() : 0);
+  const Int_t nCols = fgUsedTrackVars.size();
+  columns.resize(nCols*nTracks);
+  if(!nTracks || !nCols) return nTracks;
+
+  TClonesArray* tracks = event->GetTracks();
+  if(!fgTrackKernels.empty()) {
+    for(Int_t ic=0; ic<nCols; ++ic) {
+      TrackKernel kernel = fgTrackKernels[ic];
+      Float_t* col = &columns[ic*nTracks];
+      for(Int_t it=0; it<nTracks; ++it) col[it] = kernel((BASETRACK*)tracks->UncheckedAt(it));
+    }
+    return nTracks;
+  }
+
+  static std::vector<Float_t> values;
+  if(eventValues) values.assign(eventValues, eventValues+kNVars);
+  else values.assign(kNVars, 0.0);
+  for(Int_t it=0; it<nTracks; ++it) {
+    FillTrackInfo((BASETRACK*)tracks->UncheckedAt(it), &values[0]);
+    for(Int_t ic=0; ic<nCols; ++ic) columns[ic*nTracks+it] = values[fgUsedTrackVars[ic]];
+  }
+  return nTracks;
+}
+
 //_________________________________________________________________
 void AliReducedVarManager::FillTrackInfo(BASETRACK* p, Float_t* values) {
   //
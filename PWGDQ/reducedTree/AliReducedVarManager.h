@@ -17,6 +17,8 @@
 #include <TGraphErrors.h>
 #include <THn.h>
 
+#include <vector>
+
 #include <AliReducedPairInfo.h>
 
 class AliReducedBaseEvent;
@@ -806,6 +808,9 @@ class AliReducedVarManager : public TObject {
   static void FillTrackMCFlag(AliReducedBaseTrack* track, UShort_t flag, Float_t* values, UShort_t flag2=999);
   static void FillPairQualityFlag(AliReducedPairInfo* p, UShort_t flag, Float_t* values, UShort_t flag2=999);
   static void FillTrackInfo(AliReducedBaseTrack* p, Float_t* values);
+  static Int_t FillTrackColumns(AliReducedBaseEvent* event, std::vector<Float_t>& columns, const Float_t* eventValues=0x0);
+  static Int_t GetTrackColumn(Int_t var) {return fgTrackColumn[var];}
+  static const std::vector<Int_t>& GetUsedTrackVars() {return fgUsedTrackVars;}
   static void FillClusterMatchedTrackInfo(AliReducedBaseTrack* p, Float_t* values, TList* clusterList=0x0, AliReducedCaloClusterTrackMatcher* matcher=0x0);
   static void FillITSlayerFlag(AliReducedTrackInfo* track, Int_t layer, Float_t* values);
   static void FillITSsharedLayerFlag(AliReducedTrackInfo* track, Int_t layer, Float_t* values);
@@ -814,6 +819,7 @@ class AliReducedVarManager : public TObject {
   static void FillPairInfo(AliReducedBaseTrack* t1, AliReducedBaseTrack* t2, Int_t type, Float_t* values);
   static void FillPairInfo(AliReducedPairInfo* leg1, AliReducedBaseTrack* leg2, Int_t type, Float_t* values);
   static void FillPairInfoME(AliReducedBaseTrack* t1, AliReducedBaseTrack* t2, Int_t type, Float_t* values);
+  static void GetLegMassAssumption(Int_t id, Float_t& m1, Float_t& m2);
   static void FillPairMEflow(AliReducedBaseTrack* t1, AliReducedBaseTrack* t2, Float_t* values/*, Int_t idx=0*/);
   static void FillCorrelationInfo(AliReducedBaseTrack* p, AliReducedBaseTrack* t, Float_t* values);
   static void FillCaloClusterInfo(AliReducedCaloClusterInfo* cl, Float_t* values);
@@ -866,6 +872,12 @@ class AliReducedVarManager : public TObject {
   static Bool_t fgUsedVars[kNVars];              // array of flags toggled when the corresponding variable is required (e.g., in the histogram manager, in cuts, mixing handler, etc.) 
                                                  //   when a variable is used
   static void SetVariableDependencies();       // toggle those variables on which other used variables might depend 
+
+  typedef Float_t (*TrackKernel)(AliReducedBaseTrack*);
+  static std::vector<Int_t> fgUsedTrackVars;          // used track variables, one column each in FillTrackColumns()
+  static Int_t fgTrackColumn[kNVars];                 // column of a variable in FillTrackColumns(), -1 if not filled
+  static std::vector<TrackKernel> fgTrackKernels;     // filler of each column, empty if FillTrackInfo() is needed
+  static void CompileTrackKernels();
   
 
   static Double_t DeltaPhi(Double_t phi1, Double_t phi2);  
@@ -873,7 +885,6 @@ class AliReducedVarManager : public TObject {
                             Float_t &thetaHE, Float_t &phiHE, 
 			    Float_t &thetaCS, Float_t &phiCS,
 			    Float_t leg1Mass=fgkParticleMass[kElectron], Float_t leg2Mass=fgkParticleMass[kElectron]);
-  static void GetLegMassAssumption(Int_t id, Float_t& m1, Float_t& m2);
   static AliKFParticle BuildKFcandidate(AliReducedTrackInfo* track1, Float_t mh1, AliReducedTrackInfo* track2, Float_t mh2);
   static AliKFParticle BuildKFvertex( AliReducedEventInfo * event );
   
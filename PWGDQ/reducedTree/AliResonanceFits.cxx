@@ -93,7 +93,10 @@ AliResonanceFits::AliResonanceFits() :
   fMatchingIsDone(kFALSE),
   fMinuitFitter(0x0),
   fResidualFitFunc(0x0),
-  fBkgFitOption("MEI0")
+  fBkgFitOption("MEI0"),
+  fRandom(0),
+  fResetVarNames(kTRUE),
+  fOwnsHistograms(kFALSE)
 {
   //
   // Default constructor
@@ -121,6 +124,90 @@ AliResonanceFits::~AliResonanceFits()
   if(fSEOS_MCtruth) delete fSEOS_MCtruth;*/
   if(fMinuitFitter) delete fMinuitFitter;
   if(fResidualFitFunc) delete fResidualFitFunc;
+  if(fOwnsHistograms) {
+     delete fSEOS; delete fMEOS;
+     delete fSELSleg1; delete fSELSleg2;
+     delete fMELSleg1; delete fMELSleg2;
+     delete fSEOS_MCtruth;
+  }
+}
+
+//_______________________________________________________________________________
+void AliResonanceFits::CopySetup(const AliResonanceFits& other)
+{
+  //
+  // Copy the input histogram pointers, the variables with their ranges and all the user options.
+  // The output of a previous Process() is kept until the next Process() call
+  //
+  if(fOwnsHistograms) {
+     delete fSEOS; delete fMEOS;
+     delete fSELSleg1; delete fSELSleg2;
+     delete fMELSleg1; delete fMELSleg2;
+     delete fSEOS_MCtruth;
+     fOwnsHistograms = kFALSE;
+  }
+  fSEOS = other.fSEOS; fMEOS = other.fMEOS;
+  fSELSleg1 = other.fSELSleg1; fSELSleg2 = other.fSELSleg2;
+  fMELSleg1 = other.fMELSleg1; fMELSleg2 = other.fMELSleg2;
+  fSEOS_MCtruth = other.fSEOS_MCtruth;
+  
+  fNVariables = other.fNVariables;
+  for(Int_t i=0; i<kNMaxVariables; ++i) {
+     fVariables[i] = other.fVariables[i]; fVarIndices[i] = other.fVarIndices[i];
+     fVarLimits[i][0] = other.fVarLimits[i][0]; fVarLimits[i][1] = other.fVarLimits[i][1];
+  }
+  fMassVariable = other.fMassVariable;
+  fPtVariable = other.fPtVariable;
+  
+  fOptionBkgMethod = other.fOptionBkgMethod;
+  fOptionUseRfactorCorrection = other.fOptionUseRfactorCorrection;
+  fOptionScale = other.fOptionScale;
+  fOptionLSmethod = other.fOptionLSmethod;
+  fWeightedAveragePower = other.fWeightedAveragePower;
+  fOptionMinuit = other.fOptionMinuit;
+  fOptionScaleSummedBkg = other.fOptionScaleSummedBkg;
+  fOptionDebug = other.fOptionDebug;
+  fUserEnabledMassFitRange = other.fUserEnabledMassFitRange;
+  fUserEnabledPtFitRange = other.fUserEnabledPtFitRange;
+  if(fResidualFitFunc) {delete fResidualFitFunc; fResidualFitFunc = 0x0;}
+  if(other.fResidualFitFunc) fResidualFitFunc = (TF1*)other.fResidualFitFunc->Clone("ResidualFitFunction");
+  fBkgFitOption = other.fBkgFitOption;
+  fMatchingIsDone = kFALSE;
+}
+
+//_______________________________________________________________________________
+void AliResonanceFits::CloneHistograms()
+{
+  //
+  // Replace the input histograms by private clones, needed when several instances process
+  // the same inputs concurrently (Process() changes the axis ranges of the inputs)
+  //
+  if(fOwnsHistograms) return;
+  if(fSEOS) fSEOS = (THnF*)fSEOS->Clone();
+  if(fMEOS) fMEOS = (THnF*)fMEOS->Clone();
+  if(fSELSleg1) fSELSleg1 = (THnF*)fSELSleg1->Clone();
+  if(fSELSleg2) fSELSleg2 = (THnF*)fSELSleg2->Clone();
+  if(fMELSleg1) fMELSleg1 = (THnF*)fMELSleg1->Clone();
+  if(fMELSleg2) fMELSleg2 = (THnF*)fMELSleg2->Clone();
+  if(fSEOS_MCtruth) fSEOS_MCtruth = (THnF*)fSEOS_MCtruth->Clone();
+  fOwnsHistograms = kTRUE;
+}
+
+//_______________________________________________________________________________
+Bool_t AliResonanceFits::IsThreadCompatible() const
+{
+  //
+  // The fit ranges, the Minuit scale fit, the fit functions and the MC signal shape are class-wide (static).
+  // Process() writes them unless the fit ranges are set by the user and none of the fits is used
+  //
+  if(fOptionScale==kScaleFit) return kFALSE;
+  if(fOptionBkgMethod==kBkgMixedEventAndResidualFit || fOptionBkgMethod==kBkgFitFunction) return kFALSE;
+  if(fSEOS_MCtruth) return kFALSE;
+  if(!fUserEnabledMassFitRange) return kFALSE;
+  if(fUserEnabledPtFitRange) return kTRUE;
+  for(Int_t i=0; i<fNVariables; ++i)
+     if(fVariables[i]==fPtVariable) return kFALSE;
+  return kTRUE;
 }
 
 //_______________________________________________________________________________
@@ -257,7 +344,7 @@ Bool_t AliResonanceFits::Initialize() {
    //
    // make sure all prerequisites for signal extraction are met
    //   
-   AliReducedVarManager::SetDefaultVarNames();
+   if(fResetVarNames) AliReducedVarManager::SetDefaultVarNames();
    
    // clean up the output histograms
    if(fSplusB) {delete fSplusB; fSplusB = 0;}
@@ -473,17 +560,17 @@ void AliResonanceFits::AddSlice() {
    if(fgOptionUse2DMatching || fUserEnabledPtFitRange) {
       // SE-OS slices
       projSEOS = (TH2D*)fSEOS->Projection(fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
-      projSEOS->SetName(Form("projSEOS_%.6f", gRandom->Rndm()));
+      projSEOS->SetName(Form("projSEOS_%.6f", fRandom.Rndm()));
       if(!fgOptionUse2DMatching) 
-         projSEOS_ptRange = ((TH2D*)projSEOS)->ProjectionX(Form("projSEOS_ptRange_%.6f", gRandom->Rndm()), 
+         projSEOS_ptRange = ((TH2D*)projSEOS)->ProjectionX(Form("projSEOS_ptRange_%.6f", fRandom.Rndm()), 
                                                                                 projSEOS->GetYaxis()->FindBin(fgPtFitRange[0]), 
                                                                                 projSEOS->GetYaxis()->FindBin(fgPtFitRange[1]), "eo");
       // ME-OS slices
       if(fMEOS) {
          projMEOS = (TH2D*)fMEOS->Projection(fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
-         projMEOS->SetName(Form("projMEOS_%.6f", gRandom->Rndm()));
+         projMEOS->SetName(Form("projMEOS_%.6f", fRandom.Rndm()));
          if(!fgOptionUse2DMatching)
-            projMEOS_ptRange = ((TH2D*)projMEOS)->ProjectionX(Form("projMEOS_ptRange_%.6f", gRandom->Rndm()), 
+            projMEOS_ptRange = ((TH2D*)projMEOS)->ProjectionX(Form("projMEOS_ptRange_%.6f", fRandom.Rndm()), 
                                                                                     projMEOS->GetYaxis()->FindBin(fgPtFitRange[0]), 
                                                                                     projMEOS->GetYaxis()->FindBin(fgPtFitRange[1]), "eo");
       }
@@ -491,18 +578,18 @@ void AliResonanceFits::AddSlice() {
       // SE-LS slices
       if(fSELSleg1) {
          projSELSleg1 = (TH2D*)fSELSleg1->Projection(fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
-         projSELSleg1->SetName(Form("projSELSleg1_%.6f", gRandom->Rndm()));
+         projSELSleg1->SetName(Form("projSELSleg1_%.6f", fRandom.Rndm()));
          
          if(!fgOptionUse2DMatching)
-            projSELSleg1_ptRange = ((TH2D*)projSELSleg1)->ProjectionX(Form("projSELSleg1_ptRange_%.6f", gRandom->Rndm()), 
+            projSELSleg1_ptRange = ((TH2D*)projSELSleg1)->ProjectionX(Form("projSELSleg1_ptRange_%.6f", fRandom.Rndm()), 
                                                                                                 projSELSleg1->GetYaxis()->FindBin(fgPtFitRange[0]), 
                                                                                                 projSELSleg1->GetYaxis()->FindBin(fgPtFitRange[1]), "eo");
       }
       if(fSELSleg2) {
          projSELSleg2 = (TH2D*)fSELSleg2->Projection(fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
-         projSELSleg2->SetName(Form("projSELSleg2_%.6f", gRandom->Rndm()));
+         projSELSleg2->SetName(Form("projSELSleg2_%.6f", fRandom.Rndm()));
          if(!fgOptionUse2DMatching)
-            projSELSleg2_ptRange = ((TH2D*)projSELSleg2)->ProjectionX(Form("projSELSleg2_ptRange_%.6f", gRandom->Rndm()), 
+            projSELSleg2_ptRange = ((TH2D*)projSELSleg2)->ProjectionX(Form("projSELSleg2_ptRange_%.6f", fRandom.Rndm()), 
                                                                       projSELSleg2->GetYaxis()->FindBin(fgPtFitRange[0]), 
                                                                       projSELSleg2->GetYaxis()->FindBin(fgPtFitRange[1]), "eo");
       }
@@ -510,55 +597,55 @@ void AliResonanceFits::AddSlice() {
       // ME-LS slices
       if(fMELSleg1) {
          projMELSleg1 = (TH2D*)fMELSleg1->Projection(fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
-         projMELSleg1->SetName(Form("projMELSleg1_%.6f", gRandom->Rndm()));
+         projMELSleg1->SetName(Form("projMELSleg1_%.6f", fRandom.Rndm()));
          if(!fgOptionUse2DMatching) {
-            projMELSleg1_ptRange = ((TH2D*)projMELSleg1)->ProjectionX(Form("projMELSleg1_ptRange_%.6f", gRandom->Rndm()), 
+            projMELSleg1_ptRange = ((TH2D*)projMELSleg1)->ProjectionX(Form("projMELSleg1_ptRange_%.6f", fRandom.Rndm()), 
                                                                                                 projMELSleg1->GetYaxis()->FindBin(fgPtFitRange[0]), 
                                                                                                 projMELSleg1->GetYaxis()->FindBin(fgPtFitRange[1]), "eo");
          }
       }
       if(fMELSleg2) {
          projMELSleg2 = (TH2D*)fMELSleg2->Projection(fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
-         projMELSleg2->SetName(Form("projMELSleg2_%.6f", gRandom->Rndm()));
+         projMELSleg2->SetName(Form("projMELSleg2_%.6f", fRandom.Rndm()));
          if(!fgOptionUse2DMatching)
-            projMELSleg2_ptRange = ((TH2D*)projMELSleg2)->ProjectionX(Form("projMELSleg2_ptRange_%.6f", gRandom->Rndm()), 
+            projMELSleg2_ptRange = ((TH2D*)projMELSleg2)->ProjectionX(Form("projMELSleg2_ptRange_%.6f", fRandom.Rndm()), 
                                                                       projMELSleg2->GetYaxis()->FindBin(fgPtFitRange[0]), 
                                                                       projMELSleg2->GetYaxis()->FindBin(fgPtFitRange[1]), "eo");
       }
    }        // end if fgOptionUse2DMatching || fUserEnabledPtFitRange
    else {        // use just 1D matching
       projSEOS = (TH1D*)fSEOS->Projection(fVarIndices[fNVariables-1]);
-      projSEOS->SetName(Form("projSEOS_%.6f", gRandom->Rndm()));
+      projSEOS->SetName(Form("projSEOS_%.6f", fRandom.Rndm()));
       
       if(fMEOS) {
          projMEOS = (TH1D*)fMEOS->Projection(fVarIndices[fNVariables-1]);
-         projMEOS->SetName(Form("projMEOS_%.6f", gRandom->Rndm()));
+         projMEOS->SetName(Form("projMEOS_%.6f", fRandom.Rndm()));
       }
       if(fSELSleg1) {
          projSELSleg1 = (TH1D*)fSELSleg1->Projection(fVarIndices[fNVariables-1]);
-         projSELSleg1->SetName(Form("projSELSleg1_%.6f", gRandom->Rndm()));
+         projSELSleg1->SetName(Form("projSELSleg1_%.6f", fRandom.Rndm()));
       }
       if(fSELSleg2) {
          projSELSleg2 = (TH1D*)fSELSleg2->Projection(fVarIndices[fNVariables-1]);
-         projSELSleg2->SetName(Form("projSELSleg2_%.6f", gRandom->Rndm()));
+         projSELSleg2->SetName(Form("projSELSleg2_%.6f", fRandom.Rndm()));
       }
       if(fMELSleg1) {
          projMELSleg1 = (TH1D*)fMELSleg1->Projection(fVarIndices[fNVariables-1]);
-         projMELSleg1->SetName(Form("projMELSleg1_%.6f", gRandom->Rndm()));
+         projMELSleg1->SetName(Form("projMELSleg1_%.6f", fRandom.Rndm()));
       }
       if(fMELSleg2) {
          projMELSleg2 = (TH1D*)fMELSleg2->Projection(fVarIndices[fNVariables-1]);
-         projMELSleg2->SetName(Form("projMELSleg2_%.6f", gRandom->Rndm()));
+         projMELSleg2->SetName(Form("projMELSleg2_%.6f", fRandom.Rndm()));
       }
    }          // end else
    
    // Add the temporary SEOS slice to the S+B histogram(s)
    if(!fSplusB) {
       if(fgOptionUse2DMatching) 
-         fSplusB = (TH2D*)projSEOS->Clone(Form("fSplusB_%.6f", gRandom->Rndm()));
+         fSplusB = (TH2D*)projSEOS->Clone(Form("fSplusB_%.6f", fRandom.Rndm()));
       else {
-         if(!fUserEnabledPtFitRange) fSplusB = (TH1D*)projSEOS->Clone(Form("fSplusB_%.6f", gRandom->Rndm()));
-         else fSplusB = ((TH2D*)projSEOS)->ProjectionX(Form("fSplusB_%.6f", gRandom->Rndm()), 0, -1, "eo");
+         if(!fUserEnabledPtFitRange) fSplusB = (TH1D*)projSEOS->Clone(Form("fSplusB_%.6f", fRandom.Rndm()));
+         else fSplusB = ((TH2D*)projSEOS)->ProjectionX(Form("fSplusB_%.6f", fRandom.Rndm()), 0, -1, "eo");
       }
       fSplusB->SetDirectory(0x0);
    }
@@ -566,7 +653,7 @@ void AliResonanceFits::AddSlice() {
       if(fgOptionUse2DMatching || (!fgOptionUse2DMatching && !fUserEnabledPtFitRange))
          fSplusB->Add(projSEOS);
       else {
-         TH1D* tempHist = ((TH2D*)projSEOS)->ProjectionX(Form("fSplusB_%.6f", gRandom->Rndm()), 0, -1, "eo");
+         TH1D* tempHist = ((TH2D*)projSEOS)->ProjectionX(Form("fSplusB_%.6f", fRandom.Rndm()), 0, -1, "eo");
          fSplusB->Add(tempHist);
          delete tempHist;
       }
@@ -630,9 +717,9 @@ void AliResonanceFits::AddSlice() {
    if(bkgSlice) {
       if(!fBkg) {
          if(fgOptionUse2DMatching) 
-            fBkg = (TH2D*)bkgSlice->Clone(Form("fBkg_%.6f", gRandom->Rndm()));
+            fBkg = (TH2D*)bkgSlice->Clone(Form("fBkg_%.6f", fRandom.Rndm()));
          else 
-            fBkg = (TH1D*)bkgSlice->Clone(Form("fBkg_%.6f", gRandom->Rndm()));
+            fBkg = (TH1D*)bkgSlice->Clone(Form("fBkg_%.6f", fRandom.Rndm()));
       }
       else
          fBkg->Add(bkgSlice);
@@ -658,12 +745,12 @@ TH1* AliResonanceFits::BuildLSbkg(TH1* selsLeg1, TH1* selsLeg2, TH1* meos /*=0x0
    // Compute the SE-LS projection with R-factor correction if its the case 
    //
    TH1* mels = 0x0; TH1* sels = 0x0;
-   if(fgOptionUse2DMatching) sels = (TH2D*)selsLeg1->Clone(Form("sels%.6f", gRandom->Rndm()));
-   else                      sels = (TH1D*)selsLeg1->Clone(Form("sels%.6f", gRandom->Rndm()));
+   if(fgOptionUse2DMatching) sels = (TH2D*)selsLeg1->Clone(Form("sels%.6f", fRandom.Rndm()));
+   else                      sels = (TH1D*)selsLeg1->Clone(Form("sels%.6f", fRandom.Rndm()));
    
    if(fOptionUseRfactorCorrection) {
-      if(fgOptionUse2DMatching)  mels = (TH2D*)melsLeg1->Clone(Form("mels%.6f", gRandom->Rndm()));
-      else                       mels = (TH1D*)melsLeg1->Clone(Form("mels%.6f", gRandom->Rndm()));
+      if(fgOptionUse2DMatching)  mels = (TH2D*)melsLeg1->Clone(Form("mels%.6f", fRandom.Rndm()));
+      else                       mels = (TH1D*)melsLeg1->Clone(Form("mels%.6f", fRandom.Rndm()));
    }
    
    sels->Sumw2();
@@ -683,8 +770,8 @@ TH1* AliResonanceFits::BuildLSbkg(TH1* selsLeg1, TH1* selsLeg2, TH1* meos /*=0x0
       mels->Scale(0.5);
             
       TH1* rFactor = 0x0;
-      if(fgOptionUse2DMatching) rFactor = (TH2D*)meos->Clone(Form("rFactor%.6f", gRandom->Rndm()));
-      else                      rFactor = (TH1D*)meos->Clone(Form("rFactor%.6f", gRandom->Rndm())); 
+      if(fgOptionUse2DMatching) rFactor = (TH2D*)meos->Clone(Form("rFactor%.6f", fRandom.Rndm()));
+      else                      rFactor = (TH1D*)meos->Clone(Form("rFactor%.6f", fRandom.Rndm())); 
       rFactor->Sumw2();
       rFactor->Divide(mels);
       sels->Multiply(rFactor);
@@ -705,8 +792,8 @@ TH1* AliResonanceFits::BuildLSbkg(TH1* selsLeg1, TH1* selsLeg2, TH1* meos /*=0x0
       mels->Multiply(melsLeg2);
       SqrtTH1(mels);    
       TH1* rFactor = 0x0;
-      if(fgOptionUse2DMatching) rFactor = (TH2D*)meos->Clone(Form("rFactor%.6f", gRandom->Rndm()));
-      else                      rFactor = (TH1D*)meos->Clone(Form("rFactor%.6f", gRandom->Rndm())); 
+      if(fgOptionUse2DMatching) rFactor = (TH2D*)meos->Clone(Form("rFactor%.6f", fRandom.Rndm()));
+      else                      rFactor = (TH1D*)meos->Clone(Form("rFactor%.6f", fRandom.Rndm())); 
       rFactor->Sumw2();
       rFactor->Divide(mels);
       sels->Multiply(rFactor);
@@ -825,9 +912,9 @@ void AliResonanceFits::ComputeWeightedScale(TH1* sig, TH1* bkg) {
    // obtain the S/B histogram
    TH1* soverb = 0x0;
    if(fgOptionUse2DMatching) 
-      soverb = (TH2D*)sig->Clone(Form("soverb_%.6f", gRandom->Rndm()));
+      soverb = (TH2D*)sig->Clone(Form("soverb_%.6f", fRandom.Rndm()));
    else
-      soverb = (TH1D*)sig->Clone(Form("soverb_%.6f", gRandom->Rndm()));
+      soverb = (TH1D*)sig->Clone(Form("soverb_%.6f", fRandom.Rndm()));
    soverb->Divide(bkg);   
    
    // loop to compute the weighted average
@@ -1003,7 +1090,7 @@ void AliResonanceFits::FitInvMass() {
    //
    if(!fSignalMCshape && fSEOS_MCtruth) {
       fSignalMCshape = (TH1D*)fSEOS_MCtruth->Projection(fVarIndices[fNVariables-1]);
-      fSignalMCshape->SetName(Form("fSignalMCshape_%.6f", gRandom->Rndm()));
+      fSignalMCshape->SetName(Form("fSignalMCshape_%.6f", fRandom.Rndm()));
    }
    
    if(fGlobalFitFunction) delete fGlobalFitFunction;
@@ -1040,9 +1127,9 @@ void AliResonanceFits::FitInvMass() {
    
    if(fOptionBkgMethod==kBkgMixedEventAndResidualFit) {
       // fit the residual bkg + signal distribution
-      fSplusResidualBkg = (TH1*)fSplusB->Clone(Form("ResidualBkg_%.6f", gRandom->Rndm()));
+      fSplusResidualBkg = (TH1*)fSplusB->Clone(Form("ResidualBkg_%.6f", fRandom.Rndm()));
       fSplusResidualBkg->Add(fBkg, -1.0);
-      fSplusBblind = (TH1*)fSplusB->Clone(Form("SplusBblind_%.6f", gRandom->Rndm()));
+      fSplusBblind = (TH1*)fSplusB->Clone(Form("SplusBblind_%.6f", fRandom.Rndm()));
       fSplusBblind->Add(fBkg, -1.0);
       // protect against bins where there are no entries in the SE, but the ME bkg is very small and with small errors
       //  set the uncertainty in those bins to 1
@@ -1123,30 +1210,30 @@ Bool_t AliResonanceFits::Process() {
    if(!(fOptionBkgMethod==kBkgFitFunction || fOptionBkgMethod==kBkgMixedEventAndResidualFit)) {
       // build the signal projection
       if(fgOptionUse2DMatching)
-         fSig = (TH2D*)fSplusB->Clone(Form("fSig_%.6f", gRandom->Rndm()));
+         fSig = (TH2D*)fSplusB->Clone(Form("fSig_%.6f", fRandom.Rndm()));
       else
-         fSig = (TH1D*)fSplusB->Clone(Form("fSig_%.6f", gRandom->Rndm()));
+         fSig = (TH1D*)fSplusB->Clone(Form("fSig_%.6f", fRandom.Rndm()));
       fSig->Add(fBkg, -1.0);
    
       // build the S/B projection
       if(fgOptionUse2DMatching) {
-         fSoverB = (TH2D*)fSig->Clone(Form("fSoverB_%.6f", gRandom->Rndm()));
+         fSoverB = (TH2D*)fSig->Clone(Form("fSoverB_%.6f", fRandom.Rndm()));
       }
       else {
-         fSoverB = (TH1D*)fSig->Clone(Form("fSoverB_%.6f", gRandom->Rndm()));
+         fSoverB = (TH1D*)fSig->Clone(Form("fSoverB_%.6f", fRandom.Rndm()));
       }
       fSoverB->Divide(fBkg);    // TODO:  the fBkg should also contain the residual bkg
    }
    if(!fgOptionUse2DMatching && fOptionBkgMethod==kBkgFitFunction) {
-      fSig = (TH1D*)fSplusB->Clone(Form("fSig_%.6f", gRandom->Rndm()));
+      fSig = (TH1D*)fSplusB->Clone(Form("fSig_%.6f", fRandom.Rndm()));
       fSig->Reset();
       for(Int_t ib=1; ib<=fSig->GetXaxis()->GetNbins(); ++ib) {
          fSig->SetBinContent(ib, fSplusB->GetBinContent(ib)-fBkgFitFunction->Eval(fSig->GetXaxis()->GetBinCenter(ib)));
          fSig->SetBinError(ib, fSplusB->GetBinError(ib));
       }
-      fSoverB = (TH1D*)fSig->Clone(Form("fSoverB_%.6f", gRandom->Rndm()));
+      fSoverB = (TH1D*)fSig->Clone(Form("fSoverB_%.6f", fRandom.Rndm()));
       if(fSignalMCshape)
-         fSoverBfromMCshape = (TH1D*)fSig->Clone(Form("fSoverBfromMCshape_%.6f", gRandom->Rndm()));
+         fSoverBfromMCshape = (TH1D*)fSig->Clone(Form("fSoverBfromMCshape_%.6f", fRandom.Rndm()));
       for(Int_t ib=1; ib<=fSoverB->GetXaxis()->GetNbins(); ++ib) {
          Double_t m=fSoverB->GetXaxis()->GetBinCenter(ib);
          if(TMath::Abs(fBkgFitFunction->Eval(fSoverB->GetXaxis()->GetBinCenter(ib)))>1.0e-8) {
@@ -1171,13 +1258,13 @@ Bool_t AliResonanceFits::Process() {
       //fSoverB->Draw();
    }
    if(!fgOptionUse2DMatching && fOptionBkgMethod==kBkgMixedEventAndResidualFit) {
-      fSig = (TH1D*)fSplusResidualBkg->Clone(Form("fSig_%.6f", gRandom->Rndm()));
+      fSig = (TH1D*)fSplusResidualBkg->Clone(Form("fSig_%.6f", fRandom.Rndm()));
       for(Int_t ib=1; ib<=fSig->GetXaxis()->GetNbins(); ++ib) {
          fSig->SetBinContent(ib, fSig->GetBinContent(ib)-fBkgFitFunction->Eval(fSig->GetXaxis()->GetBinCenter(ib)));
       }
-      fSoverB = (TH1D*)fSig->Clone(Form("fSoverB_%.6f", gRandom->Rndm()));
+      fSoverB = (TH1D*)fSig->Clone(Form("fSoverB_%.6f", fRandom.Rndm()));
       if(fSignalMCshape)
-         fSoverBfromMCshape = (TH1D*)fSig->Clone(Form("fSoverBfromMCshape_%.6f", gRandom->Rndm()));
+         fSoverBfromMCshape = (TH1D*)fSig->Clone(Form("fSoverBfromMCshape_%.6f", fRandom.Rndm()));
       for(Int_t ib=1; ib<=fSoverB->GetXaxis()->GetNbins(); ++ib) {
          Double_t m=fSoverB->GetXaxis()->GetBinCenter(ib);
          if(TMath::Abs(fBkg->GetBinContent(ib) + fBkgFitFunction->Eval(m))>1.0e-8) {
@@ -1237,7 +1324,7 @@ Double_t* AliResonanceFits::ComputeOutputValues(Double_t minMass, Double_t maxMa
       // make the projection of the signal MC
       if(!fSignalMCshape && fSEOS_MCtruth) {
          fSignalMCshape = (TH2D*)fSEOS_MCtruth->Projection(fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
-         fSignalMCshape->SetName(Form("fSignalMCshape_%.6f", gRandom->Rndm()));
+         fSignalMCshape->SetName(Form("fSignalMCshape_%.6f", fRandom.Rndm()));
       }
    }
    else {
@@ -1312,7 +1399,7 @@ Double_t* AliResonanceFits::ComputeOutputValues(Double_t minMass, Double_t maxMa
       // make the projection of the signal MC
       if(!fSignalMCshape && fSEOS_MCtruth) {
          fSignalMCshape = (TH1D*)fSEOS_MCtruth->Projection(fVarIndices[fNVariables-1]);
-         fSignalMCshape->SetName(Form("fSignalMCshape_%.6f", gRandom->Rndm()));
+         fSignalMCshape->SetName(Form("fSignalMCshape_%.6f", fRandom.Rndm()));
       }
    }
 
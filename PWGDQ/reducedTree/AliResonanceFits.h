@@ -87,6 +87,7 @@
 #include <THn.h>
 #include <TF1.h>
 #include <TFitResult.h>
+#include <TRandom3.h>
 
 class TMinuit;
 class TH1;
@@ -198,6 +199,12 @@ class AliResonanceFits : public TObject {
   }
     void SetBkgFitOption(TString option){fBkgFitOption = option;}
   
+  // independent copies, used e.g. by AliResonanceFitsBatch
+  void CopySetup(const AliResonanceFits& other);   // input histograms (not cloned), variables, ranges and options
+  void CloneHistograms();                          // replace the input histograms by private clones owned by this object
+  Bool_t IsThreadCompatible() const;               // true if Process() does not modify the class-wide (static) state
+  void SetResetVarNames(Bool_t flag) {fResetVarNames = flag;}
+  
   Bool_t Process();
   Double_t* ComputeOutputValues(Double_t minMass, Double_t maxMass, Double_t minPt=-1., Double_t maxPt=-1.);
   void Print();        // print a summary of all user options
@@ -314,6 +321,10 @@ class AliResonanceFits : public TObject {
    ///////////////////////////////////////////////////
    TF1*      fResidualFitFunc;            // fit function used to fit the combinatorial bkg subtracted minv distribution
     TString fBkgFitOption;              //String used to define fit options for the background function
+   
+   TRandom3 fRandom;                   //! used for unique names of the output histograms
+   Bool_t fResetVarNames;              //! call AliReducedVarManager::SetDefaultVarNames() in Initialize()
+   Bool_t fOwnsHistograms;             //! input histograms are clones owned by this object, see CloneHistograms()
     
    ////////////////////////////////////////////////////
    
@@ -334,7 +345,7 @@ class AliResonanceFits : public TObject {
    void FitResidualBkg();
    static Double_t GlobalFitFunction(Double_t *x, Double_t* par);
 
-   ClassDef(AliResonanceFits, 6);
+   ClassDef(AliResonanceFits, 7);
 };
 
 #endif
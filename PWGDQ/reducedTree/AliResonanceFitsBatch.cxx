@@ -0,0 +1,222 @@
+/*
+***********************************************************
+  Implementation of the AliResonanceFitsBatch
+  Contact: i.c.arsene@cern.ch
+  *********************************************************
+*/
+
+#ifndef ALIRESONANCEFITSBATCH_H
+#include "AliResonanceFitsBatch.h"
+#endif
+
+#include <iostream>
+#include <iomanip>
+#include <thread>
+using std::cout;
+using std::endl;
+using std::setw;
+
+#include <TH1.h>
+#include <TMath.h>
+#include <TROOT.h>
+#include <TStopwatch.h>
+
+#include "AliReducedVarManager.h"
+
+ClassImp(AliResonanceFitsBatch)
+
+//_______________________________________________________________________________
+AliResonanceFitsBatch::AliResonanceFitsBatch() :
+  fSetup(0x0),
+  fNThreads(1),
+  fSignalWindow(),
+  fBins(),
+  fResults()
+{
+  //
+  // Default constructor
+  //
+  fSignalWindow[0] = 0.0; fSignalWindow[1] = 0.0; fSignalWindow[2] = -1.0; fSignalWindow[3] = -1.0;
+}
+
+//_______________________________________________________________________________
+AliResonanceFitsBatch::AliResonanceFitsBatch(AliResonanceFits* setup) :
+  fSetup(setup),
+  fNThreads(1),
+  fSignalWindow(),
+  fBins(),
+  fResults()
+{
+  //
+  // Constructor with the fitter used as template for all the bins
+  //
+  fSignalWindow[0] = 0.0; fSignalWindow[1] = 0.0; fSignalWindow[2] = -1.0; fSignalWindow[3] = -1.0;
+}
+
+//_______________________________________________________________________________
+Int_t AliResonanceFitsBatch::AddBin(Int_t nVars, const Int_t* vars, const Double_t* mins, const Double_t* maxs)
+{
+  //
+  // Add a bin defined by the ranges of nVars variables; the other variables keep the ranges of the setup
+  //
+  BinRange bin;
+  for(Int_t i=0; i<nVars; ++i) {
+     bin.fVars.push_back(vars[i]);
+     bin.fMin.push_back(mins[i]);
+     bin.fMax.push_back(maxs[i]);
+  }
+  fBins.push_back(bin);
+  return fBins.size()-1;
+}
+
+//_______________________________________________________________________________
+void AliResonanceFitsBatch::AddGrid(Int_t var1, Int_t nBins1, const Double_t* lims1,
+                                    Int_t var2 /*=-1*/, Int_t nBins2 /*=0*/, const Double_t* lims2 /*=0x0*/)
+{
+  //
+  // Add all the bins of a 1D (var1) or 2D (var1 x var2) grid, lims1 and lims2 have nBins+1 entries
+  //
+  Int_t vars[2] = {var1, var2};
+  Double_t mins[2] = {0.0, 0.0};
+  Double_t maxs[2] = {0.0, 0.0};
+  Bool_t is2D = (var2>=0 && nBins2>0 && lims2);
+  for(Int_t i1=0; i1<nBins1; ++i1) {
+     mins[0] = lims1[i1]; maxs[0] = lims1[i1+1];
+     if(!is2D) {
+        AddBin(1, vars, mins, maxs);
+        continue;
+     }
+     for(Int_t i2=0; i2<nBins2; ++i2) {
+        mins[1] = lims2[i2]; maxs[1] = lims2[i2+1];
+        AddBin(2, vars, mins, maxs);
+     }
+  }
+}
+
+//_______________________________________________________________________________
+Double_t AliResonanceFitsBatch::GetBinMin(Int_t bin, Int_t var) const
+{
+  //
+  // lower limit of variable var in a given bin (-1 if the bin does not restrict var)
+  //
+  if(bin<0 || bin>=(Int_t)fBins.size()) return -1.;
+  for(UInt_t i=0; i<fBins[bin].fVars.size(); ++i)
+     if(fBins[bin].fVars[i]==var) return fBins[bin].fMin[i];
+  return -1.;
+}
+
+//_______________________________________________________________________________
+Double_t AliResonanceFitsBatch::GetBinMax(Int_t bin, Int_t var) const
+{
+  //
+  // upper limit of variable var in a given bin (-1 if the bin does not restrict var)
+  //
+  if(bin<0 || bin>=(Int_t)fBins.size()) return -1.;
+  for(UInt_t i=0; i<fBins[bin].fVars.size(); ++i)
+     if(fBins[bin].fVars[i]==var) return fBins[bin].fMax[i];
+  return -1.;
+}
+
+//_______________________________________________________________________________
+Bool_t AliResonanceFitsBatch::Run()
+{
+  //
+  // Process all the bins
+  //
+  if(!fSetup) {
+     cout << "AliResonanceFitsBatch::Run() Fatal: No AliResonanceFits setup provided!" << endl;
+     return kFALSE;
+  }
+  if(fSignalWindow[1]<=fSignalWindow[0]) {
+     cout << "AliResonanceFitsBatch::Run() Fatal: No signal window set. Use SetSignalWindow()" << endl;
+     return kFALSE;
+  }
+  fResults.assign(fBins.size(), std::vector<Double_t>(kNResultValues, 0.0));
+  if(fBins.empty()) return kTRUE;
+
+  Int_t nThreads = TMath::Min(fNThreads, (Int_t)fBins.size());
+  if(nThreads>1 && !fSetup->IsThreadCompatible()) {
+     cout << "AliResonanceFitsBatch::Run() Warning: the current options use the static state of AliResonanceFits" << endl;
+     cout << "       (Minuit or function fits, MC signal shape or fit ranges not set via SetMassFitRange()/SetPtFitRange())." << endl;
+     cout << "       The bins are processed in one thread." << endl;
+     nThreads = 1;
+  }
+
+  // the variable names are set once here instead of in every AliResonanceFits::Initialize()
+  AliReducedVarManager::SetDefaultVarNames();
+  Bool_t addDirectory = TH1::AddDirectoryStatus();
+  TH1::AddDirectory(kFALSE);
+
+  TStopwatch timer;
+  timer.Start();
+  std::atomic<Int_t> nextBin(0);
+  if(nThreads==1) ProcessBins(0, kFALSE, &nextBin);
+  else {
+     ROOT::EnableThreadSafety();
+     std::vector<std::thread> workers;
+     for(Int_t it=0; it<nThreads; ++it)
+        workers.push_back(std::thread(&AliResonanceFitsBatch::ProcessBins, this, it, kTRUE, &nextBin));
+     for(UInt_t it=0; it<workers.size(); ++it) workers[it].join();
+  }
+  timer.Stop();
+  TH1::AddDirectory(addDirectory);
+
+  Int_t nFailed = 0;
+  for(UInt_t ib=0; ib<fResults.size(); ++ib) if(fResults[ib][kStatus]<0.5) nFailed++;
+  cout << "AliResonanceFitsBatch::Run() Info: " << fBins.size() << " bins processed in " << timer.RealTime()
+       << " s with " << nThreads << " thread(s), " << nFailed << " failed" << endl;
+  return (nFailed==0);
+}
+
+//_______________________________________________________________________________
+void AliResonanceFitsBatch::ProcessBins(Int_t thread, Bool_t cloneInputs, std::atomic<Int_t>* nextBin)
+{
+  //
+  // Worker loop: take the next unprocessed bin until all the bins are done
+  //
+  AliResonanceFits inputs;
+  inputs.CopySetup(*fSetup);
+  if(cloneInputs) inputs.CloneHistograms();
+
+  AliResonanceFits fitter;
+  fitter.SetResetVarNames(kFALSE);
+  TStopwatch timer;
+  for(Int_t ib=(*nextBin)++; ib<(Int_t)fBins.size(); ib=(*nextBin)++) {
+     timer.Start();
+     std::vector<Double_t>& result = fResults[ib];
+     result[kThread] = thread;
+
+     fitter.CopySetup(inputs);
+     const BinRange& bin = fBins[ib];
+     for(UInt_t iv=0; iv<bin.fVars.size(); ++iv) fitter.SetVarRange(bin.fVars[iv], bin.fMin[iv], bin.fMax[iv]);
+
+     Double_t* values = 0x0;
+     if(fitter.Process()) values = fitter.ComputeOutputValues(fSignalWindow[0], fSignalWindow[1], fSignalWindow[2], fSignalWindow[3]);
+     if(values) {
+        for(Int_t i=0; i<AliResonanceFits::kNFitValues; ++i) result[i] = values[i];
+        result[kStatus] = 1.0;
+     }
+     timer.Stop();
+     result[kRealTime] = timer.RealTime();
+  }
+}
+
+//_______________________________________________________________________________
+void AliResonanceFitsBatch::Print(Option_t*) const
+{
+  //
+  // Print the results of all the bins
+  //
+  cout << "AliResonanceFitsBatch: " << fBins.size() << " bins, " << fNThreads << " thread(s)" << endl;
+  for(UInt_t ib=0; ib<fResults.size(); ++ib) {
+     const std::vector<Double_t>& r = fResults[ib];
+     cout << "bin " << setw(4) << ib << " ::";
+     for(UInt_t iv=0; iv<fBins[ib].fVars.size(); ++iv)
+        cout << " " << AliReducedVarManager::fgVariableNames[fBins[ib].fVars[iv]] << " [" << fBins[ib].fMin[iv] << ", " << fBins[ib].fMax[iv] << "]";
+     cout << endl;
+     cout << "          status " << r[kStatus] << ", time " << r[kRealTime] << " s, S " << r[AliResonanceFits::kSig]
+          << " +/- " << r[AliResonanceFits::kSigErr] << ", S/B " << r[AliResonanceFits::kSoverB]
+          << ", signif " << r[AliResonanceFits::kSignif] << ", chi2 (side bands) " << r[AliResonanceFits::kChisqSideBands]
+          << ", fit prob. " << r[AliResonanceFits::kFitProbability] << endl;
+  }
+}
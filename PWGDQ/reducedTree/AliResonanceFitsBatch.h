@@ -0,0 +1,89 @@
+// Class used for extracting resonance yields in a grid of (pt, centrality, ...) bins
+// Author: Ionut-Cristian Arsene (iarsene@cern.ch)
+//
+/*
+   Brief usage guide
+
+   Configure an AliResonanceFits object as for a single signal extraction (histograms, variables, options),
+   then define the bins and run:
+
+      AliResonanceFitsBatch batch(&fits);
+      batch.SetSignalWindow(2.92, 3.16);
+      batch.AddGrid(AliReducedVarManager::kPt, nPtBins, ptLims, AliReducedVarManager::kCentVZERO, nCentBins, centLims);
+      batch.SetNThreads(8);
+      batch.Run();
+      for(Int_t ib=0; ib<batch.GetNBins(); ++ib) batch.GetResult(ib)[AliResonanceFits::kSig];
+
+   Each thread works with its own AliResonanceFits copy of the setup and its own clones of the input
+   histograms. AliResonanceFits keeps part of its state in static members, so the configurations for which
+   AliResonanceFits::IsThreadCompatible() is false are processed in one thread.
+   The result of a bin is the AliResonanceFits::FitValues array followed by the ResultValues entries.
+ */
+
+#ifndef ALIRESONANCEFITSBATCH_H
+#define ALIRESONANCEFITSBATCH_H
+
+#include <TObject.h>
+
+#include <atomic>
+#include <vector>
+
+#include "AliResonanceFits.h"
+
+//_____________________________________________________________________
+class AliResonanceFitsBatch : public TObject {
+
+ public:
+
+  enum ResultValues {
+    kStatus = AliResonanceFits::kNFitValues,    // 1 if Process() was successful, 0 otherwise
+    kRealTime,                                    // wall time spent on the bin (s)
+    kThread,                                      // thread which processed the bin
+    kNResultValues
+  };
+
+  AliResonanceFitsBatch();
+  AliResonanceFitsBatch(AliResonanceFits* setup);
+  virtual ~AliResonanceFitsBatch() {}
+
+  void SetSetup(AliResonanceFits* setup) {fSetup = setup;}
+  void SetNThreads(Int_t n) {fNThreads = (n<1 ? 1 : n);}
+  void SetSignalWindow(Double_t minMass, Double_t maxMass, Double_t minPt=-1., Double_t maxPt=-1.) {
+     fSignalWindow[0] = minMass; fSignalWindow[1] = maxMass; fSignalWindow[2] = minPt; fSignalWindow[3] = maxPt;
+  }
+  Int_t AddBin(Int_t nVars, const Int_t* vars, const Double_t* mins, const Double_t* maxs);
+  void AddGrid(Int_t var1, Int_t nBins1, const Double_t* lims1, Int_t var2=-1, Int_t nBins2=0, const Double_t* lims2=0x0);
+  void ClearBins() {fBins.clear(); fResults.clear();}
+
+  Bool_t Run();
+
+  Int_t GetNThreads() const {return fNThreads;}
+  Int_t GetNBins() const {return fBins.size();}
+  const Double_t* GetResult(Int_t bin) const {return (bin>=0 && bin<(Int_t)fResults.size() ? &fResults[bin][0] : 0x0);}
+  Double_t GetBinMin(Int_t bin, Int_t var) const;
+  Double_t GetBinMax(Int_t bin, Int_t var) const;
+  void Print(Option_t* option="") const;
+
+ private:
+
+  struct BinRange {
+    std::vector<Int_t> fVars;
+    std::vector<Double_t> fMin;
+    std::vector<Double_t> fMax;
+  };
+
+  AliResonanceFits* fSetup;                        // configured fitter, used as template
+  Int_t fNThreads;                                 // number of worker threads
+  Double_t fSignalWindow[4];                       // mass and pt range used in AliResonanceFits::ComputeOutputValues()
+  std::vector<BinRange> fBins;                     //! bins to be processed
+  std::vector<std::vector<Double_t> > fResults;    //! result of each bin
+
+  void ProcessBins(Int_t thread, Bool_t cloneInputs, std::atomic<Int_t>* nextBin);
+
+  AliResonanceFitsBatch(const AliResonanceFitsBatch& c);
+  AliResonanceFitsBatch& operator= (const AliResonanceFitsBatch& c);
+
+  ClassDef(AliResonanceFitsBatch, 1);
+};
+
+#endif
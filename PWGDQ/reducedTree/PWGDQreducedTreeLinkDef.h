@@ -37,6 +37,7 @@
 #pragma link C++ class AliReducedVarCut+;
 #pragma link C++ class AliReducedVarManager+;
 #pragma link C++ class AliResonanceFits+;
+#pragma link C++ class AliResonanceFitsBatch+;
 #pragma link C++ class AliSignalMC+;
 
 #endif
@@ -490,7 +490,14 @@ AliAnalysisTaskGammaCalo::AliAnalysisTaskGammaCalo(): AliAnalysisTaskSE(),
   fAllowOverlapHeaders(kTRUE),
   fNCurrentClusterBasic(0),
   fTrackMatcherRunningMode(0),
-  fDoPi0Only(kFALSE)
+  fDoPi0Only(kFALSE),
+  fUseCompactBGPool(kFALSE),
+  fCompactBGPoolBudget(50.),
+  fUseMesonPairPrefilter(kFALSE),
+  fPairCurrentPhotons(),
+  fPairPhotons1(),
+  fPairPhotons2(),
+  fPairCandidates()
 {
 
 }
@@ -923,7 +930,14 @@ AliAnalysisTaskGammaCalo::AliAnalysisTaskGammaCalo(const char *name):
   fAllowOverlapHeaders(kTRUE),
   fNCurrentClusterBasic(0),
   fTrackMatcherRunningMode(0),
-  fDoPi0Only(kFALSE)
+  fDoPi0Only(kFALSE),
+  fUseCompactBGPool(kFALSE),
+  fCompactBGPoolBudget(50.),
+  fUseMesonPairPrefilter(kFALSE),
+  fPairCurrentPhotons(),
+  fPairPhotons1(),
+  fPairPhotons2(),
+  fPairCandidates()
 {
   // Define output slots here
   DefineOutput(1, TList::Class());
@@ -1023,6 +1037,7 @@ void AliAnalysisTaskGammaCalo::InitBack(){
                                     ((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->UseTrackMultiplicity(),
                                     4,8,7);
         }
+        if(fUseCompactBGPool) fBGHandler[iCut]->SetUseCompactPool(kTRUE,fCompactBGPoolBudget);
       }
     }
   }
@@ -7651,52 +7666,51 @@ void AliAnalysisTaskGammaCalo::CalculateBackground(){
       }
     }
   } else {
+    SetPairCurrentPhotons(fClusterCandidates);
     for(Int_t nEventsInBG=0;nEventsInBG <fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
       AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
       if(previousEventV0s){
-        for(Int_t iCurrent=0;iCurrent<fClusterCandidates->GetEntries();iCurrent++){
-          AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fClusterCandidates->At(iCurrent));
-          for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-
-            AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
-            std::unique_ptr<AliAODConversionMother> backgroundCandidate (new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0));
-            backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+        FillPairCandidates(previousEventV0s,kFALSE);
+        for(UInt_t iPair=0;iPair<fPairCandidates.size();iPair+=2){
+          AliAODConversionPhoton &currentEventGoodV0 = *(fPairCurrentPhotons[fPairCandidates[iPair]]);
+          AliAODConversionPhoton &previousGoodV0 = *(previousEventV0s->at(fPairCandidates[iPair+1]));
+          std::unique_ptr<AliAODConversionMother> backgroundCandidate (new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0));
+          backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
 
-            if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->MesonIsSelected(backgroundCandidate.get(),kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift(),currentEventGoodV0.GetLeadingCellID(),previousGoodV0.GetLeadingCellID(),currentEventGoodV0.GetIsCaloPhoton(),  previousGoodV0.GetIsCaloPhoton() ))){
-              // Set the BG candidate jetjet weight to 1 in case both photons orignated from the minimum bias header
-              if (fIsMC>0 && ((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetSignalRejection() == 4){
-                if( ((AliConvEventCuts*)fEventCutArray->At(fiCut))->IsParticleFromBGEvent(previousGoodV0.GetCaloPhotonMCLabel(0), fMCEvent, fInputEvent) == 2 &&
-                    ((AliConvEventCuts*)fEventCutArray->At(fiCut))->IsParticleFromBGEvent(currentEventGoodV0.GetCaloPhotonMCLabel(0), fMCEvent, fInputEvent) == 2)
-                  tempBGCandidateWeight = 1;
-              }
-              if(!fDoJetAnalysis || (fDoJetAnalysis && !fDoLightOutput)) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), tempBGCandidateWeight);
-              if(fDoJetAnalysis){
-                if(fConvJetReader->GetNJets() > 0){
-                  if(!fDoLightOutput) fHistoMotherBackJetInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), tempBGCandidateWeight);
-                  else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), tempBGCandidateWeight);
-                }
-              }
-              if(fDoTHnSparse){
-                Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
-                fSparseMotherBackInvMassPtZM[fiCut]->Fill(sparesFill,1);
-              }
-              if((!fDoLightOutput || fDoPi0Only || fDoECalibOutput) && TMath::Abs(backgroundCandidate->GetAlpha())<0.1){
-                fHistoMotherBackInvMassECalib[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->E(),tempBGCandidateWeight);
+          if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->MesonIsSelected(backgroundCandidate.get(),kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift(),currentEventGoodV0.GetLeadingCellID(),previousGoodV0.GetLeadingCellID(),currentEventGoodV0.GetIsCaloPhoton(),  previousGoodV0.GetIsCaloPhoton() ))){
+            // Set the BG candidate jetjet weight to 1 in case both photons orignated from the minimum bias header
+            if (fIsMC>0 && ((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetSignalRejection() == 4){
+              if( ((AliConvEventCuts*)fEventCutArray->At(fiCut))->IsParticleFromBGEvent(previousGoodV0.GetCaloPhotonMCLabel(0), fMCEvent, fInputEvent) == 2 &&
+                  ((AliConvEventCuts*)fEventCutArray->At(fiCut))->IsParticleFromBGEvent(currentEventGoodV0.GetCaloPhotonMCLabel(0), fMCEvent, fInputEvent) == 2)
+                tempBGCandidateWeight = 1;
+            }
+            if(!fDoJetAnalysis || (fDoJetAnalysis && !fDoLightOutput)) fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), tempBGCandidateWeight);
+            if(fDoJetAnalysis){
+              if(fConvJetReader->GetNJets() > 0){
+                if(!fDoLightOutput) fHistoMotherBackJetInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), tempBGCandidateWeight);
+                else fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), tempBGCandidateWeight);
               }
+            }
+            if(fDoTHnSparse){
+              Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
+              fSparseMotherBackInvMassPtZM[fiCut]->Fill(sparesFill,1);
+            }
+            if((!fDoLightOutput || fDoPi0Only || fDoECalibOutput) && TMath::Abs(backgroundCandidate->GetAlpha())<0.1){
+              fHistoMotherBackInvMassECalib[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->E(),tempBGCandidateWeight);
+            }
 
-              if (fDoMesonQA == 2){
-                  fHistoMotherPtOpenAngleBck[fiCut]->Fill(backgroundCandidate->Pt(),backgroundCandidate->GetOpeningAngle(), tempBGCandidateWeight);
-              }
-              if(fDoMesonQA == 4 && fIsMC == 0 && (backgroundCandidate->Pt() > 13.) ){
-                fInvMassTreeInvMass = backgroundCandidate->M();
-                fInvMassTreePt = backgroundCandidate->Pt();
-                fInvMassTreeAlpha = TMath::Abs(backgroundCandidate->GetAlpha());
-                fInvMassTreeTheta = backgroundCandidate->GetOpeningAngle();
-                fInvMassTreeMixPool = zbin*100 + mbin;
-                fInvMassTreeZVertex = fInputEvent->GetPrimaryVertex()->GetZ();
-                fInvMassTreeEta = backgroundCandidate->Eta();
-                tBckInvMassPtAlphaTheta[fiCut]->Fill();
-              }
+            if (fDoMesonQA == 2){
+                fHistoMotherPtOpenAngleBck[fiCut]->Fill(backgroundCandidate->Pt(),backgroundCandidate->GetOpeningAngle(), tempBGCandidateWeight);
+            }
+            if(fDoMesonQA == 4 && fIsMC == 0 && (backgroundCandidate->Pt() > 13.) ){
+              fInvMassTreeInvMass = backgroundCandidate->M();
+              fInvMassTreePt = backgroundCandidate->Pt();
+              fInvMassTreeAlpha = TMath::Abs(backgroundCandidate->GetAlpha());
+              fInvMassTreeTheta = backgroundCandidate->GetOpeningAngle();
+              fInvMassTreeMixPool = zbin*100 + mbin;
+              fInvMassTreeZVertex = fInputEvent->GetPrimaryVertex()->GetZ();
+              fInvMassTreeEta = backgroundCandidate->Eta();
+              tBckInvMassPtAlphaTheta[fiCut]->Fill();
             }
           }
         }
@@ -7705,6 +7719,40 @@ void AliAnalysisTaskGammaCalo::CalculateBackground(){
   }
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskGammaCalo::SetPairCurrentPhotons(TList *currentPhotons){
+  // current event photons of the background pair loop
+  fPairCurrentPhotons.clear();
+  fPairPhotons1.Clear();
+  TIter next(currentPhotons);
+  while(AliAODConversionPhoton *gamma = (AliAODConversionPhoton*)next()){
+    fPairCurrentPhotons.push_back(gamma);
+    fPairPhotons1.Add(gamma->Px(),gamma->Py(),gamma->Pz(),gamma->E());
+  }
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskGammaCalo::FillPairCandidates(AliGammaConversionAODVector *previousPhotons, Bool_t isSignal){
+  // pairs of current and previous photons to be built, all of them or those passing the pair kernel
+  fPairCandidates.clear();
+  if(!fUseMesonPairPrefilter){
+    for(UInt_t iCurrent=0;iCurrent<fPairCurrentPhotons.size();iCurrent++){
+      for(UInt_t iPrevious=0;iPrevious<previousPhotons->size();iPrevious++){
+        fPairCandidates.push_back(iCurrent);
+        fPairCandidates.push_back(iPrevious);
+      }
+    }
+    return;
+  }
+  fPairPhotons2.Clear();
+  for(UInt_t iPrevious=0;iPrevious<previousPhotons->size();iPrevious++){
+    AliAODConversionPhoton *gamma = previousPhotons->at(iPrevious);
+    fPairPhotons2.Add(gamma->Px(),gamma->Py(),gamma->Pz(),gamma->E());
+  }
+  ((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->PrefilterPhotonPairs(fPairPhotons1,fPairPhotons2,isSignal,
+                                                                            ((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift(),fPairCandidates);
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskGammaCalo::CalculateBackgroundSwapp(){
 
@@ -77,6 +77,8 @@ class AliAnalysisTaskGammaCalo : public AliAnalysisTaskSE {
     void SetPlotHistsExtQA(Bool_t flag){fSetPlotHistsExtQA = flag;}
     void SetAllowOverlapHeaders( Bool_t allowOverlapHeader ) {fAllowOverlapHeaders = allowOverlapHeader;}
     void SetDoPi0Only(Bool_t flag){fDoPi0Only = flag;}
+    void SetUseCompactBGPool(Bool_t flag, Double_t memoryBudgetMB = 50.){fUseCompactBGPool = flag; fCompactBGPoolBudget = memoryBudgetMB;}
+    void SetUseMesonPairPrefilter(Bool_t flag){fUseMesonPairPrefilter = flag;}
 
     void SetInOutTimingCluster(Double_t min, Double_t max){
       fDoInOutTimingCluster = kTRUE; fMinTimingCluster = min; fMaxTimingCluster = max;
@@ -105,6 +107,8 @@ class AliAnalysisTaskGammaCalo : public AliAnalysisTaskSE {
     void CalculateBackground();
     void CalculateBackgroundSwapp();
     void CalculateBackgroundRP();
+    void SetPairCurrentPhotons(TList *currentPhotons);
+    void FillPairCandidates(AliGammaConversionAODVector *previousPhotons, Bool_t isSignal);
     void RotateParticle(AliAODConversionPhoton *gamma);
     void RotateParticleAccordingToEP(AliAODConversionPhoton *gamma, Double_t previousEventEP, Double_t thisEventEP);
     void FillPhotonBackgroundHist(AliAODConversionPhoton *TruePhotonCandidate, Int_t pdgCode);
@@ -601,11 +605,18 @@ class AliAnalysisTaskGammaCalo : public AliAnalysisTaskSE {
     Int_t                 fNCurrentClusterBasic;                                // current number of cluster without minE
     Int_t                 fTrackMatcherRunningMode;                             // CaloTrackMatcher running mode
     Bool_t                fDoPi0Only;                                           // switches ranges of histograms and binnings to pi0 specific analysis
+    Bool_t                fUseCompactBGPool;                                    // store only the fields needed for mixing in the BG handler
+    Double_t              fCompactBGPoolBudget;                                 // memory budget of the compact BG pool per handler (MB)
+    Bool_t                fUseMesonPairPrefilter;                               // reject BG pairs with AliConversionMesonCuts::PrefilterPhotonPairs() before building the mother
+    std::vector<AliAODConversionPhoton*> fPairCurrentPhotons;                   //! current photons of the pair loop
+    AliConversionMesonCuts::PhotonArrays fPairPhotons1;                         //! current photon momenta for the pair kernel
+    AliConversionMesonCuts::PhotonArrays fPairPhotons2;                         //! previous photon momenta for the pair kernel
+    std::vector<Int_t>    fPairCandidates;                                      //! index pairs (current, previous) to be processed
   private:
     AliAnalysisTaskGammaCalo(const AliAnalysisTaskGammaCalo&);                  // Prevent copy-construction
     AliAnalysisTaskGammaCalo &operator=(const AliAnalysisTaskGammaCalo&);       // Prevent assignment
 
-    ClassDef(AliAnalysisTaskGammaCalo, 87);
+    ClassDef(AliAnalysisTaskGammaCalo, 89);
 };
 
 #endif
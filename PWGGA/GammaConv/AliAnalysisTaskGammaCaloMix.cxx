@@ -63,14 +63,14 @@
 ClassImp(AliAnalysisTaskGammaCaloMix)
 
 //________________________________________________________________________
-AliAnalysisTaskGammaCaloMix::AliAnalysisTaskGammaCaloMix(): AliAnalysisTaskSE(), fV0Reader(NULL), fV0ReaderName("V0ReaderV1"), fCorrTaskSetting(""), fBGHandler(NULL), fInputEvent(NULL), fMCEvent(NULL), fCutFolder(NULL), fESDList(NULL), fBackList(NULL), fMotherList(NULL), fTrueList(NULL), fMCList(NULL), fTreeList(NULL), fClusterTreeList(NULL), fOutputContainer(NULL), fReaderGammas(NULL), fGammaCandidates(NULL), fClusterCandidates(NULL), fClusterCandidates2(NULL), fEventCutArray(NULL), fEventCuts(NULL), fClusterCutArray(NULL), fClusterCutArray2(NULL), fCaloPhotonCuts(NULL), fMesonCutArray(NULL), fMesonCuts(NULL), fConvJetReader(NULL), fConversionCuts(NULL), fOutlierJetReader(NULL), fDoJetAnalysis(kFALSE), fDoJetQA(kFALSE), fDoTrueSphericity(kFALSE), fJetHistograms(NULL), fTrueJetHistograms(NULL), fJetSector(0), fMaxPtNearEMCalPlace(0), fJetNearEMCal(kFALSE), fHistoMotherInvMassPt(NULL), fSparseMotherInvMassPtZM(NULL), fHistoMotherBackInvMassPt(NULL), fSparseMotherBackInvMassPtZM(NULL), fHistoMotherPi0PtY(NULL), fHistoMotherEtaPtY(NULL), fHistoMotherPi0PtAlpha(NULL), fHistoMotherEtaPtAlpha(NULL), fHistoMotherPi0PtOpenAngle(NULL), fHistoMotherEtaPtOpenAngle(NULL), fHistoMotherPtOpenAngle(NULL), fHistoMotherPtOpenAngleBck(NULL), fHistoMotherPi0NGoodESDTracksPt(NULL), fHistoMotherEtaNGoodESDTracksPt(NULL), fHistoMotherInvMassECalib(NULL), fHistoMotherBackInvMassECalib(NULL), fHistoClusGammaPt(NULL), fHistoClusGammaE(NULL), fHistoClusOverlapHeadersGammaPt(NULL), fHistoClusAllHeadersGammaPt(NULL), fHistoClusRejectedHeadersGammaPt(NULL), fHistoClusGammaPtM02(NULL), fHistoMCHeaders(NULL), fHistoMCAllGammaPt(NULL), fHistoMCAllSecondaryGammaPt(NULL), fHistoMCDecayGammaPi0Pt(NULL), fHistoMCDecayGammaRhoPt(NULL), fHistoMCDecayGammaEtaPt(NULL), fHistoMCDecayGammaOmegaPt(NULL), fHistoMCDecayGammaEtapPt(NULL), fHistoMCDecayGammaPhiPt(NULL), fHistoMCDecayGammaSigmaPt(NULL), fHistoMCPi0Pt(NULL), fHistoMCPi0WOWeightPt(NULL), fHistoMCPi0WOEvtWeightPt(NULL), fHistoMCEtaPt(NULL), fHistoMCEtaWOWeightPt(NULL), fHistoMCEtaWOEvtWeightPt(NULL), fHistoMCPi0InAccPt(NULL), fHistoMCEtaInAccPt(NULL), fHistoMCPi0WOEvtWeightInAccPt(NULL), fHistoMCEtaWOEvtWeightInAccPt(NULL), fHistoMCPi0PtY(NULL), fHistoMCEtaPtY(NULL), fHistoMCPi0PtAlpha(NULL), fHistoMCEtaPtAlpha(NULL), fHistoMCPrimaryPtvsSource(NULL), fHistoMCSecPi0PtvsSource(NULL), fHistoMCSecPi0Source(NULL), fHistoMCSecPi0InAccPtvsSource(NULL), fHistoMCSecEtaPt(NULL), fHistoMCSecEtaSource(NULL), fHistoMCPi0PtJetPt(NULL), fHistoMCEtaPtJetPt(NULL), fHistoTruePi0InvMassPt(NULL), fHistoTrueEtaInvMassPt(NULL), fHistoTruePi0CaloPhotonInvMassPt(NULL), fHistoTrueEtaCaloPhotonInvMassPt(NULL), fHistoTruePi0CaloConvertedPhotonInvMassPt(NULL), fHistoTrueEtaCaloConvertedPhotonInvMassPt(NULL), fHistoTruePi0CaloMixedPhotonConvPhotonInvMassPt(NULL), fHistoTrueEtaCaloMixedPhotonConvPhotonInvMassPt(NULL), fHistoTruePi0CaloElectronInvMassPt(NULL), fHistoTrueEtaCaloElectronInvMassPt(NULL), fHistoTruePi0CaloMergedClusterInvMassPt(NULL), fHistoTrueEtaCaloMergedClusterInvMassPt(NULL), fHistoTruePi0CaloMergedClusterPartConvInvMassPt(NULL), fHistoTrueEtaCaloMergedClusterPartConvInvMassPt(NULL), fHistoTruePi0NonMergedElectronPhotonInvMassPt(NULL), fHistoTruePi0NonMergedElectronMergedPhotonInvMassPt(NULL), fHistoTruePi0Category1(NULL), fHistoTrueEtaCategory1(NULL), fHistoTruePi0Category2(NULL), fHistoTrueEtaCategory2(NULL), fHistoTruePi0Category3(NULL), fHistoTrueEtaCategory3(NULL), fHistoTruePi0Category4_6(NULL), fHistoTrueEtaCategory4_6(NULL), fHistoTruePi0Category5(NULL), fHistoTrueEtaCategory5(NULL), fHistoTruePi0Category7(NULL), fHistoTrueEtaCategory7(NULL), fHistoTruePi0Category8(NULL), fHistoTrueEtaCategory8(NULL), fHistoTruePrimaryPi0InvMassPt(NULL), fHistoTruePrimaryEtaInvMassPt(NULL), fHistoTruePrimaryPi0W0WeightingInvMassPt(NULL), fHistoTruePrimaryEtaW0WeightingInvMassPt(NULL), fProfileTruePrimaryPi0WeightsInvMassPt(NULL), fProfileTruePrimaryEtaWeightsInvMassPt(NULL), fHistoTruePrimaryPi0MCPtResolPt(NULL), fHistoTruePrimaryEtaMCPtResolPt(NULL), fHistoTrueSecondaryPi0InvMassPt(NULL), fHistoTrueSecondaryPi0FromK0sInvMassPt(NULL), fHistoTrueK0sWithPi0DaughterMCPt(NULL), fHistoTrueSecondaryPi0FromK0lInvMassPt(NULL), fHistoTrueK0lWithPi0DaughterMCPt(NULL), fHistoTrueSecondaryPi0FromEtaInvMassPt(NULL), fHistoTrueEtaWithPi0DaughterMCPt(NULL), fHistoTrueSecondaryPi0FromLambdaInvMassPt(NULL), fHistoTrueLambdaWithPi0DaughterMCPt(NULL), fHistoTrueBckGGInvMassPt(NULL), fHistoTrueBckFullMesonContainedInOneClusterInvMassPt(NULL), fHistoTrueBckAsymEClustersInvMassPt(NULL), fHistoTrueBckContInvMassPt(NULL), fHistoTruePi0PtY(NULL), fHistoTrueEtaPtY(NULL), fHistoTruePi0PtAlpha(NULL), fHistoTrueEtaPtAlpha(NULL), fHistoTruePi0PtOpenAngle(NULL), fHistoTrueEtaPtOpenAngle(NULL), fHistoClusPhotonBGPt(NULL), fHistoClusPhotonPlusConvBGPt(NULL), fHistoClustPhotonElectronBGPtM02(NULL), fHistoClustPhotonPionBGPtM02(NULL), fHistoClustPhotonKaonBGPtM02(NULL), fHistoClustPhotonK0lBGPtM02(NULL), fHistoClustPhotonNeutronBGPtM02(NULL), fHistoClustPhotonRestBGPtM02(NULL), fHistoClustPhotonPlusConvElectronBGPtM02(NULL), fHistoClustPhotonPlusConvPionBGPtM02(NULL), fHistoClustPhotonPlusConvKaonBGPtM02(NULL), fHistoClustPhotonPlusConvK0lBGPtM02(NULL), fHistoClustPhotonPlusConvNeutronBGPtM02(NULL), fHistoClustPhotonPlusConvRestBGPtM02(NULL), fHistoTrueClusGammaPt(NULL), fHistoTrueClusUnConvGammaPt(NULL), fHistoTrueClusUnConvGammaMCPt(NULL), fHistoTrueClusGammaPtM02(NULL), fHistoTrueClusUnConvGammaPtM02(NULL), fHistoTrueClusElectronPt(NULL), fHistoTrueClusConvGammaPt(NULL), fHistoTrueClusConvGammaMCPt(NULL), fHistoTrueClusConvGammaFullyPt(NULL), fHistoTrueClusMergedGammaPt(NULL), fHistoTrueClusMergedPartConvGammaPt(NULL), fHistoTrueClusDalitzPt(NULL), fHistoTrueClusDalitzMergedPt(NULL), fHistoTrueClusPhotonFromElecMotherPt(NULL), fHistoTrueClusShowerPt(NULL), fHistoTrueClusSubLeadingPt(NULL), fHistoTrueClusNParticles(NULL), fHistoTrueClusEMNonLeadingPt(NULL), fHistoTrueNLabelsInClus(NULL), fHistoTruePrimaryClusGammaPt(NULL), fHistoTruePrimaryClusGammaESDPtMCPt(NULL), fHistoTruePrimaryClusConvGammaPt(NULL), fHistoTruePrimaryClusConvGammaESDPtMCPt(NULL), fHistoTrueSecondaryClusGammaPt(NULL), fHistoTrueSecondaryClusConvGammaPt(NULL), fHistoTrueSecondaryClusGammaMCPt(NULL), fHistoTrueSecondaryClusConvGammaMCPt(NULL), fHistoTrueSecondaryClusGammaFromXFromK0sMCPtESDPt(NULL), fHistoTrueSecondaryClusConvGammaFromXFromK0sMCPtESDPt(NULL), fHistoTrueSecondaryClusGammaFromXFromK0lMCPtESDPt(NULL), fHistoTrueSecondaryClusConvGammaFromXFromK0lMCPtESDPt(NULL), fHistoTrueSecondaryClusGammaFromXFromLambdaMCPtESDPt(NULL), fHistoTrueSecondaryClusConvGammaFromXFromLambdaMCPtESDPt(NULL), fHistoDoubleCountTruePi0InvMassPt(NULL), fHistoDoubleCountTrueEtaInvMassPt(NULL), fHistoDoubleCountTrueClusterGammaPt(NULL), fVectorDoubleCountTruePi0s(0), fVectorDoubleCountTrueEtas(0), fVectorDoubleCountTrueClusterGammas(0), fHistoMultipleCountTrueClusterGamma(NULL), fMapMultipleCountTrueClusterGammas(), fHistoTruePi0InvMassPtAlpha(NULL), fHistoTruePi0PureGammaInvMassPtAlpha(NULL), fHistCellIDvsClusterEnergy(NULL), fHistCellIDvsClusterEnergy2(NULL), fHistCellIDvsClusterEnergyMax(NULL), fHistCellIDvsClusterEnergyMax2(NULL), fHistoNEvents(NULL), fHistoNEventsWOWeight(NULL), fHistoNGoodESDTracks(NULL), fHistoVertexZ(NULL), fHistoNGammaCandidates(NULL), fHistoNGammaCandidates2(NULL), fHistoNGammaCandidatesBasic(NULL), fHistoNGoodESDTracksVsNGammaCandidates(NULL), fHistoSPDClusterTrackletBackground(NULL), fHistoNV0Tracks(NULL), fProfileEtaShift(NULL), fProfileJetJetXSection(NULL), fHistoJetJetNTrials(NULL), fHistoEventSphericity(NULL), fHistoEventSphericityAxis(NULL), fHistoEventSphericityvsNtracks(NULL), fHistoEventSphericityvsNJets(NULL), fHistoEventMultiplicityvsNJets(NULL), fHistoTrueSphericityvsRecSphericity(NULL), fHistoTrueMultiplicityvsRecMultiplicity(NULL), fHistoEventSphericityvsHighpt(NULL), fHistoEventSphericityvsTotalpt(NULL), fHistoEventSphericityvsMeanpt(NULL), fHistoPionSpectrum(NULL), fHistoProtonSpectrum(NULL), fHistoKaonSpectrum(NULL), fHistoNPionSpectrum(NULL), fHistoEtaSpectrum(NULL), fHistoDMesonSpectrum(NULL), tTreeSphericity(NULL), fRecSph(0), fTrueSph(0), fPi0Pt(0), fPi0InvMass(0), fHistoPtJet(NULL), fHistoJetEta(NULL), fHistoJetPhi(NULL), fHistoJetArea(NULL), fHistoNJets(NULL), fHistoEventwJets(NULL), fHistoJetPi0PtRatio(NULL), fHistoDoubleCounting(NULL), fHistoJetMotherInvMassPt(NULL), fHistoPi0InJetMotherInvMassPt(NULL), fHistoMotherBackJetInvMassPt(NULL), fHistoRJetPi0Cand(NULL), fHistoEtaPhiJetPi0Cand(NULL), fHistoEtaPhiJetWithPi0Cand(NULL), fHistoJetFragmFunc(NULL), fHistoJetFragmFuncZInvMass(NULL), fHistoTruevsRecJetPt(NULL), fHistoTruePi0JetMotherInvMassPt(NULL), fHistoTruePi0InJetMotherInvMassPt(NULL), fHistoTruePrimaryPi0JetInvMassPt(NULL), fHistoTruePrimaryPi0inJetInvMassPt(NULL), fHistoTruePrimaryPi0InJetInvMassTruePt(NULL), fHistoTrueDoubleCountingPi0Jet(NULL), fHistoTrueEtaJetMotherInvMassPt(NULL), fHistoTrueEtaInJetMotherInvMassPt(NULL), fHistoTruePrimaryEtaJetInvMassPt(NULL), fHistoTruePrimaryEtainJetInvMassPt(NULL), fHistoTrueDoubleCountingEtaJet(NULL), fHistoTruePi0JetFragmFunc(NULL), fHistoTruePi0JetFragmFuncZInvMass(NULL), fHistoTrueEtaJetFragmFunc(NULL), fHistoTrueEtaJetFragmFuncZInvMass(NULL), fHistoMCPi0JetInAccPt(NULL), fHistoMCPi0inJetInAccPt(NULL), fHistoMCEtaJetInAccPt(NULL), fHistoMCEtainJetInAccPt(NULL), fHistoMCPi0JetEventGenerated(NULL), fHistoMCPi0inJetGenerated(NULL), fHistoMCEtaJetEventGenerated(NULL), fHistoMCEtainJetGenerated(NULL), fHistoTrueSecondaryPi0FromK0sJetInvMassPt(NULL), fHistoTrueSecondaryPi0FromK0sinJetInvMassPt(NULL), fHistoTrueSecondaryPi0FromLambdaJetInvMassPt(NULL), fHistoTrueSecondaryPi0FromLambdainJetInvMassPt(NULL), fHistoTrueSecondaryPi0FromK0lJetInvMassPt(NULL), fHistoTrueSecondaryPi0FromK0linJetInvMassPt(NULL), fHistoTrueSecondaryPi0InvJetMassPt(NULL), fHistoTrueSecondaryPi0InvinJetMassPt(NULL), fHistoMotherPi0inJetPtY(NULL), fHistoMotherEtainJetPtY(NULL), fHistoMotherPi0inJetPtPhi(NULL), fHistoMotherEtainJetPtPhi(NULL), fNumberOfClusters(NULL), fNumberOfClustersinJets(NULL), fEnergyRatio(NULL), fEnergyRatioinJets(NULL), fEnergyRatioGamma1(NULL), fEnergyRatioGamma1inJets(NULL), fEnergyRatioGammaAnywhere(NULL), fEnergyRatioGammaAnywhereinJets(NULL), fEnergyDeposit(NULL), fEnergyDepositinJets(NULL), fEnergyDepGamma1(NULL), fEnergyDepGamma1inJets(NULL), fEnergyDepGammaAnywhere(NULL), fEnergyDepGammaAnywhereinJets(NULL), fEnergyRatioGamma1Helped(NULL), fEnergyRatioGamma1HelpedinJets(NULL), fClusterEtaPhiJets(NULL), fHistoUnfoldingAsData(NULL), fHistoUnfoldingMissed(NULL), fHistoUnfoldingReject(NULL), fHistoUnfoldingAsDataInvMassZ(NULL), fHistoUnfoldingMissedInvMassZ(NULL), fHistoUnfoldingRejectInvMassZ(NULL), fVectorJetPt(0), fVectorJetPx(0), fVectorJetPy(0), fVectorJetPz(0), fVectorJetEta(0), fVectorJetPhi(0), fVectorJetArea(0), fTrueVectorJetPt(0), fTrueVectorJetPx(0), fTrueVectorJetPy(0), fTrueVectorJetPz(0), fTrueVectorJetEta(0), fTrueVectorJetPhi(0), tTrueInvMassROpenABPtFlag(NULL), fInvMass(-1), fRconv(-1), fOpenRPrim(-1), fInvMassRTOF(-1), fPt(-1), iFlag(3), tSigInvMassPtAlphaTheta(NULL), tBckInvMassPtAlphaTheta(NULL), fInvMassTreeInvMass(0), fInvMassTreePt(0), fInvMassTreeAlpha(0), fInvMassTreeTheta(0), fInvMassTreeMixPool(0), fInvMassTreeZVertex(0), fInvMassTreeEta(0), tClusterEOverP(NULL), fClusterE(0), fClusterM02(0), fClusterM20(0), fClusterEP(0), fClusterLeadCellID(0), fClusterClassification(0), fDeltaEta(0), fDeltaPhi(0), fTrackPt(0), fTrackPID_e(0), fTrackPID_Pi(0), fTrackPID_K(0), fTrackPID_P(0), fClusterIsoSumClusterEt(0), fClusterIsoSumTrackEt(0), tClusterTimingEff(NULL), fClusterTimeTag(0), fClusterTimeProbe(0), fClusterETag(0), fClusterEProbe(0), fEventPlaneAngle(-100), fRandom(0), fnCuts(0), fiCut(0), fIsHeavyIon(0), fDoLightOutput(kFALSE), fDoMesonAnalysis(kTRUE), fDoMesonQA(0), fDoClusterQA(0), fIsFromDesiredHeader(kTRUE), fIsOverlappingWithOtherHeader(kFALSE), fIsMC(0), fDoTHnSparse(kTRUE), fSetPlotHistsExtQA(kFALSE), fDoSoftAnalysis(kFALSE), fWeightJetJetMC(1), fDoInOutTimingCluster(kFALSE), fMinTimingCluster(0), fMaxTimingCluster(0), fEnableSortForClusMC(kFALSE), fProduceCellIDPlots(kFALSE), fProduceTreeEOverP(kFALSE), tBrokenFiles(NULL), fFileNameBroken(NULL), tClusterQATree(NULL), fCloseHighPtClusters(NULL), fLocalDebugFlag(0), fAllowOverlapHeaders(kTRUE), fNCurrentClusterBasic(0), fTrackMatcherRunningMode(0), fDoPi0Only(kFALSE)
+AliAnalysisTaskGammaCaloMix::AliAnalysisTaskGammaCaloMix(): AliAnalysisTaskSE(), fV0Reader(NULL), fV0ReaderName("V0ReaderV1"), fCorrTaskSetting(""), fBGHandler(NULL), fInputEvent(NULL), fMCEvent(NULL), fCutFolder(NULL), fESDList(NULL), fBackList(NULL), fMotherList(NULL), fTrueList(NULL), fMCList(NULL), fTreeList(NULL), fClusterTreeList(NULL), fOutputContainer(NULL), fReaderGammas(NULL), fGammaCandidates(NULL), fClusterCandidates(NULL), fClusterCandidates2(NULL), fEventCutArray(NULL), fEventCuts(NULL), fClusterCutArray(NULL), fClusterCutArray2(NULL), fCaloPhotonCuts(NULL), fMesonCutArray(NULL), fMesonCuts(NULL), fConvJetReader(NULL), fConversionCuts(NULL), fOutlierJetReader(NULL), fDoJetAnalysis(kFALSE), fDoJetQA(kFALSE), fDoTrueSphericity(kFALSE), fJetHistograms(NULL), fTrueJetHistograms(NULL), fJetSector(0), fMaxPtNearEMCalPlace(0), fJetNearEMCal(kFALSE), fHistoMotherInvMassPt(NULL), fSparseMotherInvMassPtZM(NULL), fHistoMotherBackInvMassPt(NULL), fSparseMotherBackInvMassPtZM(NULL), fHistoMotherPi0PtY(NULL), fHistoMotherEtaPtY(NULL), fHistoMotherPi0PtAlpha(NULL), fHistoMotherEtaPtAlpha(NULL), fHistoMotherPi0PtOpenAngle(NULL), fHistoMotherEtaPtOpenAngle(NULL), fHistoMotherPtOpenAngle(NULL), fHistoMotherPtOpenAngleBck(NULL), fHistoMotherPi0NGoodESDTracksPt(NULL), fHistoMotherEtaNGoodESDTracksPt(NULL), fHistoMotherInvMassECalib(NULL), fHistoMotherBackInvMassECalib(NULL), fHistoClusGammaPt(NULL), fHistoClusGammaE(NULL), fHistoClusOverlapHeadersGammaPt(NULL), fHistoClusAllHeadersGammaPt(NULL), fHistoClusRejectedHeadersGammaPt(NULL), fHistoClusGammaPtM02(NULL), fHistoMCHeaders(NULL), fHistoMCAllGammaPt(NULL), fHistoMCAllSecondaryGammaPt(NULL), fHistoMCDecayGammaPi0Pt(NULL), fHistoMCDecayGammaRhoPt(NULL), fHistoMCDecayGammaEtaPt(NULL), fHistoMCDecayGammaOmegaPt(NULL), fHistoMCDecayGammaEtapPt(NULL), fHistoMCDecayGammaPhiPt(NULL), fHistoMCDecayGammaSigmaPt(NULL), fHistoMCPi0Pt(NULL), fHistoMCPi0WOWeightPt(NULL), fHistoMCPi0WOEvtWeightPt(NULL), fHistoMCEtaPt(NULL), fHistoMCEtaWOWeightPt(NULL), fHistoMCEtaWOEvtWeightPt(NULL), fHistoMCPi0InAccPt(NULL), fHistoMCEtaInAccPt(NULL), fHistoMCPi0WOEvtWeightInAccPt(NULL), fHistoMCEtaWOEvtWeightInAccPt(NULL), fHistoMCPi0PtY(NULL), fHistoMCEtaPtY(NULL), fHistoMCPi0PtAlpha(NULL), fHistoMCEtaPtAlpha(NULL), fHistoMCPrimaryPtvsSource(NULL), fHistoMCSecPi0PtvsSource(NULL), fHistoMCSecPi0Source(NULL), fHistoMCSecPi0InAccPtvsSource(NULL), fHistoMCSecEtaPt(NULL), fHistoMCSecEtaSource(NULL), fHistoMCPi0PtJetPt(NULL), fHistoMCEtaPtJetPt(NULL), fHistoTruePi0InvMassPt(NULL), fHistoTrueEtaInvMassPt(NULL), fHistoTruePi0CaloPhotonInvMassPt(NULL), fHistoTrueEtaCaloPhotonInvMassPt(NULL), fHistoTruePi0CaloConvertedPhotonInvMassPt(NULL), fHistoTrueEtaCaloConvertedPhotonInvMassPt(NULL), fHistoTruePi0CaloMixedPhotonConvPhotonInvMassPt(NULL), fHistoTrueEtaCaloMixedPhotonConvPhotonInvMassPt(NULL), fHistoTruePi0CaloElectronInvMassPt(NULL), fHistoTrueEtaCaloElectronInvMassPt(NULL), fHistoTruePi0CaloMergedClusterInvMassPt(NULL), fHistoTrueEtaCaloMergedClusterInvMassPt(NULL), fHistoTruePi0CaloMergedClusterPartConvInvMassPt(NULL), fHistoTrueEtaCaloMergedClusterPartConvInvMassPt(NULL), fHistoTruePi0NonMergedElectronPhotonInvMassPt(NULL), fHistoTruePi0NonMergedElectronMergedPhotonInvMassPt(NULL), fHistoTruePi0Category1(NULL), fHistoTrueEtaCategory1(NULL), fHistoTruePi0Category2(NULL), fHistoTrueEtaCategory2(NULL), fHistoTruePi0Category3(NULL), fHistoTrueEtaCategory3(NULL), fHistoTruePi0Category4_6(NULL), fHistoTrueEtaCategory4_6(NULL), fHistoTruePi0Category5(NULL), fHistoTrueEtaCategory5(NULL), fHistoTruePi0Category7(NULL), fHistoTrueEtaCategory7(NULL), fHistoTruePi0Category8(NULL), fHistoTrueEtaCategory8(NULL), fHistoTruePrimaryPi0InvMassPt(NULL), fHistoTruePrimaryEtaInvMassPt(NULL), fHistoTruePrimaryPi0W0WeightingInvMassPt(NULL), fHistoTruePrimaryEtaW0WeightingInvMassPt(NULL), fProfileTruePrimaryPi0WeightsInvMassPt(NULL), fProfileTruePrimaryEtaWeightsInvMassPt(NULL), fHistoTruePrimaryPi0MCPtResolPt(NULL), fHistoTruePrimaryEtaMCPtResolPt(NULL), fHistoTrueSecondaryPi0InvMassPt(NULL), fHistoTrueSecondaryPi0FromK0sInvMassPt(NULL), fHistoTrueK0sWithPi0DaughterMCPt(NULL), fHistoTrueSecondaryPi0FromK0lInvMassPt(NULL), fHistoTrueK0lWithPi0DaughterMCPt(NULL), fHistoTrueSecondaryPi0FromEtaInvMassPt(NULL), fHistoTrueEtaWithPi0DaughterMCPt(NULL), fHistoTrueSecondaryPi0FromLambdaInvMassPt(NULL), fHistoTrueLambdaWithPi0DaughterMCPt(NULL), fHistoTrueBckGGInvMassPt(NULL), fHistoTrueBckFullMesonContainedInOneClusterInvMassPt(NULL), fHistoTrueBckAsymEClustersInvMassPt(NULL), fHistoTrueBckContInvMassPt(NULL), fHistoTruePi0PtY(NULL), fHistoTrueEtaPtY(NULL), fHistoTruePi0PtAlpha(NULL), fHistoTrueEtaPtAlpha(NULL), fHistoTruePi0PtOpenAngle(NULL), fHistoTrueEtaPtOpenAngle(NULL), fHistoClusPhotonBGPt(NULL), fHistoClusPhotonPlusConvBGPt(NULL), fHistoClustPhotonElectronBGPtM02(NULL), fHistoClustPhotonPionBGPtM02(NULL), fHistoClustPhotonKaonBGPtM02(NULL), fHistoClustPhotonK0lBGPtM02(NULL), fHistoClustPhotonNeutronBGPtM02(NULL), fHistoClustPhotonRestBGPtM02(NULL), fHistoClustPhotonPlusConvElectronBGPtM02(NULL), fHistoClustPhotonPlusConvPionBGPtM02(NULL), fHistoClustPhotonPlusConvKaonBGPtM02(NULL), fHistoClustPhotonPlusConvK0lBGPtM02(NULL), fHistoClustPhotonPlusConvNeutronBGPtM02(NULL), fHistoClustPhotonPlusConvRestBGPtM02(NULL), fHistoTrueClusGammaPt(NULL), fHistoTrueClusUnConvGammaPt(NULL), fHistoTrueClusUnConvGammaMCPt(NULL), fHistoTrueClusGammaPtM02(NULL), fHistoTrueClusUnConvGammaPtM02(NULL), fHistoTrueClusElectronPt(NULL), fHistoTrueClusConvGammaPt(NULL), fHistoTrueClusConvGammaMCPt(NULL), fHistoTrueClusConvGammaFullyPt(NULL), fHistoTrueClusMergedGammaPt(NULL), fHistoTrueClusMergedPartConvGammaPt(NULL), fHistoTrueClusDalitzPt(NULL), fHistoTrueClusDalitzMergedPt(NULL), fHistoTrueClusPhotonFromElecMotherPt(NULL), fHistoTrueClusShowerPt(NULL), fHistoTrueClusSubLeadingPt(NULL), fHistoTrueClusNParticles(NULL), fHistoTrueClusEMNonLeadingPt(NULL), fHistoTrueNLabelsInClus(NULL), fHistoTruePrimaryClusGammaPt(NULL), fHistoTruePrimaryClusGammaESDPtMCPt(NULL), fHistoTruePrimaryClusConvGammaPt(NULL), fHistoTruePrimaryClusConvGammaESDPtMCPt(NULL), fHistoTrueSecondaryClusGammaPt(NULL), fHistoTrueSecondaryClusConvGammaPt(NULL), fHistoTrueSecondaryClusGammaMCPt(NULL), fHistoTrueSecondaryClusConvGammaMCPt(NULL), fHistoTrueSecondaryClusGammaFromXFromK0sMCPtESDPt(NULL), fHistoTrueSecondaryClusConvGammaFromXFromK0sMCPtESDPt(NULL), fHistoTrueSecondaryClusGammaFromXFromK0lMCPtESDPt(NULL), fHistoTrueSecondaryClusConvGammaFromXFromK0lMCPtESDPt(NULL), fHistoTrueSecondaryClusGammaFromXFromLambdaMCPtESDPt(NULL), fHistoTrueSecondaryClusConvGammaFromXFromLambdaMCPtESDPt(NULL), fHistoDoubleCountTruePi0InvMassPt(NULL), fHistoDoubleCountTrueEtaInvMassPt(NULL), fHistoDoubleCountTrueClusterGammaPt(NULL), fVectorDoubleCountTruePi0s(0), fVectorDoubleCountTrueEtas(0), fVectorDoubleCountTrueClusterGammas(0), fHistoMultipleCountTrueClusterGamma(NULL), fMapMultipleCountTrueClusterGammas(), fHistoTruePi0InvMassPtAlpha(NULL), fHistoTruePi0PureGammaInvMassPtAlpha(NULL), fHistCellIDvsClusterEnergy(NULL), fHistCellIDvsClusterEnergy2(NULL), fHistCellIDvsClusterEnergyMax(NULL), fHistCellIDvsClusterEnergyMax2(NULL), fHistoNEvents(NULL), fHistoNEventsWOWeight(NULL), fHistoNGoodESDTracks(NULL), fHistoVertexZ(NULL), fHistoNGammaCandidates(NULL), fHistoNGammaCandidates2(NULL), fHistoNGammaCandidatesBasic(NULL), fHistoNGoodESDTracksVsNGammaCandidates(NULL), fHistoSPDClusterTrackletBackground(NULL), fHistoNV0Tracks(NULL), fProfileEtaShift(NULL), fProfileJetJetXSection(NULL), fHistoJetJetNTrials(NULL), fHistoEventSphericity(NULL), fHistoEventSphericityAxis(NULL), fHistoEventSphericityvsNtracks(NULL), fHistoEventSphericityvsNJets(NULL), fHistoEventMultiplicityvsNJets(NULL), fHistoTrueSphericityvsRecSphericity(NULL), fHistoTrueMultiplicityvsRecMultiplicity(NULL), fHistoEventSphericityvsHighpt(NULL), fHistoEventSphericityvsTotalpt(NULL), fHistoEventSphericityvsMeanpt(NULL), fHistoPionSpectrum(NULL), fHistoProtonSpectrum(NULL), fHistoKaonSpectrum(NULL), fHistoNPionSpectrum(NULL), fHistoEtaSpectrum(NULL), fHistoDMesonSpectrum(NULL), tTreeSphericity(NULL), fRecSph(0), fTrueSph(0), fPi0Pt(0), fPi0InvMass(0), fHistoPtJet(NULL), fHistoJetEta(NULL), fHistoJetPhi(NULL), fHistoJetArea(NULL), fHistoNJets(NULL), fHistoEventwJets(NULL), fHistoJetPi0PtRatio(NULL), fHistoDoubleCounting(NULL), fHistoJetMotherInvMassPt(NULL), fHistoPi0InJetMotherInvMassPt(NULL), fHistoMotherBackJetInvMassPt(NULL), fHistoRJetPi0Cand(NULL), fHistoEtaPhiJetPi0Cand(NULL), fHistoEtaPhiJetWithPi0Cand(NULL), fHistoJetFragmFunc(NULL), fHistoJetFragmFuncZInvMass(NULL), fHistoTruevsRecJetPt(NULL), fHistoTruePi0JetMotherInvMassPt(NULL), fHistoTruePi0InJetMotherInvMassPt(NULL), fHistoTruePrimaryPi0JetInvMassPt(NULL), fHistoTruePrimaryPi0inJetInvMassPt(NULL), fHistoTruePrimaryPi0InJetInvMassTruePt(NULL), fHistoTrueDoubleCountingPi0Jet(NULL), fHistoTrueEtaJetMotherInvMassPt(NULL), fHistoTrueEtaInJetMotherInvMassPt(NULL), fHistoTruePrimaryEtaJetInvMassPt(NULL), fHistoTruePrimaryEtainJetInvMassPt(NULL), fHistoTrueDoubleCountingEtaJet(NULL), fHistoTruePi0JetFragmFunc(NULL), fHistoTruePi0JetFragmFuncZInvMass(NULL), fHistoTrueEtaJetFragmFunc(NULL), fHistoTrueEtaJetFragmFuncZInvMass(NULL), fHistoMCPi0JetInAccPt(NULL), fHistoMCPi0inJetInAccPt(NULL), fHistoMCEtaJetInAccPt(NULL), fHistoMCEtainJetInAccPt(NULL), fHistoMCPi0JetEventGenerated(NULL), fHistoMCPi0inJetGenerated(NULL), fHistoMCEtaJetEventGenerated(NULL), fHistoMCEtainJetGenerated(NULL), fHistoTrueSecondaryPi0FromK0sJetInvMassPt(NULL), fHistoTrueSecondaryPi0FromK0sinJetInvMassPt(NULL), fHistoTrueSecondaryPi0FromLambdaJetInvMassPt(NULL), fHistoTrueSecondaryPi0FromLambdainJetInvMassPt(NULL), fHistoTrueSecondaryPi0FromK0lJetInvMassPt(NULL), fHistoTrueSecondaryPi0FromK0linJetInvMassPt(NULL), fHistoTrueSecondaryPi0InvJetMassPt(NULL), fHistoTrueSecondaryPi0InvinJetMassPt(NULL), fHistoMotherPi0inJetPtY(NULL), fHistoMotherEtainJetPtY(NULL), fHistoMotherPi0inJetPtPhi(NULL), fHistoMotherEtainJetPtPhi(NULL), fNumberOfClusters(NULL), fNumberOfClustersinJets(NULL), fEnergyRatio(NULL), fEnergyRatioinJets(NULL), fEnergyRatioGamma1(NULL), fEnergyRatioGamma1inJets(NULL), fEnergyRatioGammaAnywhere(NULL), fEnergyRatioGammaAnywhereinJets(NULL), fEnergyDeposit(NULL), fEnergyDepositinJets(NULL), fEnergyDepGamma1(NULL), fEnergyDepGamma1inJets(NULL), fEnergyDepGammaAnywhere(NULL), fEnergyDepGammaAnywhereinJets(NULL), fEnergyRatioGamma1Helped(NULL), fEnergyRatioGamma1HelpedinJets(NULL), fClusterEtaPhiJets(NULL), fHistoUnfoldingAsData(NULL), fHistoUnfoldingMissed(NULL), fHistoUnfoldingReject(NULL), fHistoUnfoldingAsDataInvMassZ(NULL), fHistoUnfoldingMissedInvMassZ(NULL), fHistoUnfoldingRejectInvMassZ(NULL), fVectorJetPt(0), fVectorJetPx(0), fVectorJetPy(0), fVectorJetPz(0), fVectorJetEta(0), fVectorJetPhi(0), fVectorJetArea(0), fTrueVectorJetPt(0), fTrueVectorJetPx(0), fTrueVectorJetPy(0), fTrueVectorJetPz(0), fTrueVectorJetEta(0), fTrueVectorJetPhi(0), tTrueInvMassROpenABPtFlag(NULL), fInvMass(-1), fRconv(-1), fOpenRPrim(-1), fInvMassRTOF(-1), fPt(-1), iFlag(3), tSigInvMassPtAlphaTheta(NULL), tBckInvMassPtAlphaTheta(NULL), fInvMassTreeInvMass(0), fInvMassTreePt(0), fInvMassTreeAlpha(0), fInvMassTreeTheta(0), fInvMassTreeMixPool(0), fInvMassTreeZVertex(0), fInvMassTreeEta(0), tClusterEOverP(NULL), fClusterE(0), fClusterM02(0), fClusterM20(0), fClusterEP(0), fClusterLeadCellID(0), fClusterClassification(0), fDeltaEta(0), fDeltaPhi(0), fTrackPt(0), fTrackPID_e(0), fTrackPID_Pi(0), fTrackPID_K(0), fTrackPID_P(0), fClusterIsoSumClusterEt(0), fClusterIsoSumTrackEt(0), tClusterTimingEff(NULL), fClusterTimeTag(0), fClusterTimeProbe(0), fClusterETag(0), fClusterEProbe(0), fEventPlaneAngle(-100), fRandom(0), fnCuts(0), fiCut(0), fIsHeavyIon(0), fDoLightOutput(kFALSE), fDoMesonAnalysis(kTRUE), fDoMesonQA(0), fDoClusterQA(0), fIsFromDesiredHeader(kTRUE), fIsOverlappingWithOtherHeader(kFALSE), fIsMC(0), fDoTHnSparse(kTRUE), fSetPlotHistsExtQA(kFALSE), fDoSoftAnalysis(kFALSE), fWeightJetJetMC(1), fDoInOutTimingCluster(kFALSE), fMinTimingCluster(0), fMaxTimingCluster(0), fEnableSortForClusMC(kFALSE), fProduceCellIDPlots(kFALSE), fProduceTreeEOverP(kFALSE), tBrokenFiles(NULL), fFileNameBroken(NULL), tClusterQATree(NULL), fCloseHighPtClusters(NULL), fLocalDebugFlag(0), fAllowOverlapHeaders(kTRUE), fNCurrentClusterBasic(0), fTrackMatcherRunningMode(0), fDoPi0Only(kFALSE), fUseSharedMixingPool(kFALSE), fSharedBGPool(NULL), fSharedCurrent(), fSharedCurrent2(), fSharedMixingEvents(), fSharedMixBin(), fSharedStoreBin(), fSharedZBin(), fSharedMBin(), fSharedWeight(), fSharedRotationMask(0), fSharedRotationDegrees(), fSharedRotationN(), fSharedRotationCuts()
 {
 
 }
 
 //________________________________________________________________________
 AliAnalysisTaskGammaCaloMix::AliAnalysisTaskGammaCaloMix(const char *name):
-AliAnalysisTaskSE(name), fV0Reader(NULL), fV0ReaderName("V0ReaderV1"), fCorrTaskSetting(""), fBGHandler(NULL), fInputEvent(NULL), fMCEvent(NULL), fCutFolder(NULL), fESDList(NULL), fBackList(NULL), fMotherList(NULL), fTrueList(NULL), fMCList(NULL), fTreeList(NULL), fClusterTreeList(NULL), fOutputContainer(NULL), fReaderGammas(NULL), fGammaCandidates(NULL), fClusterCandidates(NULL), fClusterCandidates2(NULL), fEventCutArray(NULL), fEventCuts(NULL), fClusterCutArray(NULL), fClusterCutArray2(NULL), fCaloPhotonCuts(NULL), fMesonCutArray(NULL), fMesonCuts(NULL), fConvJetReader(NULL), fConversionCuts(NULL), fOutlierJetReader(NULL), fDoJetAnalysis(kFALSE), fDoJetQA(kFALSE), fDoTrueSphericity(kFALSE), fJetHistograms(NULL), fTrueJetHistograms(NULL), fJetSector(0), fMaxPtNearEMCalPlace(0), fJetNearEMCal(kFALSE), fHistoMotherInvMassPt(NULL), fSparseMotherInvMassPtZM(NULL), fHistoMotherBackInvMassPt(NULL), fSparseMotherBackInvMassPtZM(NULL), fHistoMotherPi0PtY(NULL), fHistoMotherEtaPtY(NULL), fHistoMotherPi0PtAlpha(NULL), fHistoMotherEtaPtAlpha(NULL), fHistoMotherPi0PtOpenAngle(NULL), fHistoMotherEtaPtOpenAngle(NULL), fHistoMotherPtOpenAngle(NULL), fHistoMotherPtOpenAngleBck(NULL), fHistoMotherPi0NGoodESDTracksPt(NULL), fHistoMotherEtaNGoodESDTracksPt(NULL), fHistoMotherInvMassECalib(NULL), fHistoMotherBackInvMassECalib(NULL), fHistoClusGammaPt(NULL), fHistoClusGammaE(NULL), fHistoClusOverlapHeadersGammaPt(NULL), fHistoClusAllHeadersGammaPt(NULL), fHistoClusRejectedHeadersGammaPt(NULL), fHistoClusGammaPtM02(NULL), fHistoMCHeaders(NULL), fHistoMCAllGammaPt(NULL), fHistoMCAllSecondaryGammaPt(NULL), fHistoMCDecayGammaPi0Pt(NULL), fHistoMCDecayGammaRhoPt(NULL), fHistoMCDecayGammaEtaPt(NULL), fHistoMCDecayGammaOmegaPt(NULL), fHistoMCDecayGammaEtapPt(NULL), fHistoMCDecayGammaPhiPt(NULL), fHistoMCDecayGammaSigmaPt(NULL), fHistoMCPi0Pt(NULL), fHistoMCPi0WOWeightPt(NULL), fHistoMCPi0WOEvtWeightPt(NULL), fHistoMCEtaPt(NULL), fHistoMCEtaWOWeightPt(NULL), fHistoMCEtaWOEvtWeightPt(NULL), fHistoMCPi0InAccPt(NULL), fHistoMCEtaInAccPt(NULL), fHistoMCPi0WOEvtWeightInAccPt(NULL), fHistoMCEtaWOEvtWeightInAccPt(NULL), fHistoMCPi0PtY(NULL), fHistoMCEtaPtY(NULL), fHistoMCPi0PtAlpha(NULL), fHistoMCEtaPtAlpha(NULL), fHistoMCPrimaryPtvsSource(NULL), fHistoMCSecPi0PtvsSource(NULL), fHistoMCSecPi0Source(NULL), fHistoMCSecPi0InAccPtvsSource(NULL), fHistoMCSecEtaPt(NULL), fHistoMCSecEtaSource(NULL), fHistoMCPi0PtJetPt(NULL), fHistoMCEtaPtJetPt(NULL), fHistoTruePi0InvMassPt(NULL), fHistoTrueEtaInvMassPt(NULL), fHistoTruePi0CaloPhotonInvMassPt(NULL), fHistoTrueEtaCaloPhotonInvMassPt(NULL), fHistoTruePi0CaloConvertedPhotonInvMassPt(NULL), fHistoTrueEtaCaloConvertedPhotonInvMassPt(NULL), fHistoTruePi0CaloMixedPhotonConvPhotonInvMassPt(NULL), fHistoTrueEtaCaloMixedPhotonConvPhotonInvMassPt(NULL), fHistoTruePi0CaloElectronInvMassPt(NULL), fHistoTrueEtaCaloElectronInvMassPt(NULL), fHistoTruePi0CaloMergedClusterInvMassPt(NULL), fHistoTrueEtaCaloMergedClusterInvMassPt(NULL), fHistoTruePi0CaloMergedClusterPartConvInvMassPt(NULL), fHistoTrueEtaCaloMergedClusterPartConvInvMassPt(NULL), fHistoTruePi0NonMergedElectronPhotonInvMassPt(NULL), fHistoTruePi0NonMergedElectronMergedPhotonInvMassPt(NULL), fHistoTruePi0Category1(NULL), fHistoTrueEtaCategory1(NULL), fHistoTruePi0Category2(NULL), fHistoTrueEtaCategory2(NULL), fHistoTruePi0Category3(NULL), fHistoTrueEtaCategory3(NULL), fHistoTruePi0Category4_6(NULL), fHistoTrueEtaCategory4_6(NULL), fHistoTruePi0Category5(NULL), fHistoTrueEtaCategory5(NULL), fHistoTruePi0Category7(NULL), fHistoTrueEtaCategory7(NULL), fHistoTruePi0Category8(NULL), fHistoTrueEtaCategory8(NULL), fHistoTruePrimaryPi0InvMassPt(NULL), fHistoTruePrimaryEtaInvMassPt(NULL), fHistoTruePrimaryPi0W0WeightingInvMassPt(NULL), fHistoTruePrimaryEtaW0WeightingInvMassPt(NULL), fProfileTruePrimaryPi0WeightsInvMassPt(NULL), fProfileTruePrimaryEtaWeightsInvMassPt(NULL), fHistoTruePrimaryPi0MCPtResolPt(NULL), fHistoTruePrimaryEtaMCPtResolPt(NULL), fHistoTrueSecondaryPi0InvMassPt(NULL), fHistoTrueSecondaryPi0FromK0sInvMassPt(NULL), fHistoTrueK0sWithPi0DaughterMCPt(NULL), fHistoTrueSecondaryPi0FromK0lInvMassPt(NULL), fHistoTrueK0lWithPi0DaughterMCPt(NULL), fHistoTrueSecondaryPi0FromEtaInvMassPt(NULL), fHistoTrueEtaWithPi0DaughterMCPt(NULL), fHistoTrueSecondaryPi0FromLambdaInvMassPt(NULL), fHistoTrueLambdaWithPi0DaughterMCPt(NULL), fHistoTrueBckGGInvMassPt(NULL), fHistoTrueBckFullMesonContainedInOneClusterInvMassPt(NULL), fHistoTrueBckAsymEClustersInvMassPt(NULL), fHistoTrueBckContInvMassPt(NULL), fHistoTruePi0PtY(NULL), fHistoTrueEtaPtY(NULL), fHistoTruePi0PtAlpha(NULL), fHistoTrueEtaPtAlpha(NULL), fHistoTruePi0PtOpenAngle(NULL), fHistoTrueEtaPtOpenAngle(NULL), fHistoClusPhotonBGPt(NULL), fHistoClusPhotonPlusConvBGPt(NULL), fHistoClustPhotonElectronBGPtM02(NULL), fHistoClustPhotonPionBGPtM02(NULL), fHistoClustPhotonKaonBGPtM02(NULL), fHistoClustPhotonK0lBGPtM02(NULL), fHistoClustPhotonNeutronBGPtM02(NULL), fHistoClustPhotonRestBGPtM02(NULL), fHistoClustPhotonPlusConvElectronBGPtM02(NULL), fHistoClustPhotonPlusConvPionBGPtM02(NULL), fHistoClustPhotonPlusConvKaonBGPtM02(NULL), fHistoClustPhotonPlusConvK0lBGPtM02(NULL), fHistoClustPhotonPlusConvNeutronBGPtM02(NULL), fHistoClustPhotonPlusConvRestBGPtM02(NULL), fHistoTrueClusGammaPt(NULL), fHistoTrueClusUnConvGammaPt(NULL), fHistoTrueClusUnConvGammaMCPt(NULL), fHistoTrueClusGammaPtM02(NULL), fHistoTrueClusUnConvGammaPtM02(NULL), fHistoTrueClusElectronPt(NULL), fHistoTrueClusConvGammaPt(NULL), fHistoTrueClusConvGammaMCPt(NULL), fHistoTrueClusConvGammaFullyPt(NULL), fHistoTrueClusMergedGammaPt(NULL), fHistoTrueClusMergedPartConvGammaPt(NULL), fHistoTrueClusDalitzPt(NULL), fHistoTrueClusDalitzMergedPt(NULL), fHistoTrueClusPhotonFromElecMotherPt(NULL), fHistoTrueClusShowerPt(NULL), fHistoTrueClusSubLeadingPt(NULL), fHistoTrueClusNParticles(NULL), fHistoTrueClusEMNonLeadingPt(NULL), fHistoTrueNLabelsInClus(NULL), fHistoTruePrimaryClusGammaPt(NULL), fHistoTruePrimaryClusGammaESDPtMCPt(NULL), fHistoTruePrimaryClusConvGammaPt(NULL), fHistoTruePrimaryClusConvGammaESDPtMCPt(NULL), fHistoTrueSecondaryClusGammaPt(NULL), fHistoTrueSecondaryClusConvGammaPt(NULL), fHistoTrueSecondaryClusGammaMCPt(NULL), fHistoTrueSecondaryClusConvGammaMCPt(NULL), fHistoTrueSecondaryClusGammaFromXFromK0sMCPtESDPt(NULL), fHistoTrueSecondaryClusConvGammaFromXFromK0sMCPtESDPt(NULL), fHistoTrueSecondaryClusGammaFromXFromK0lMCPtESDPt(NULL), fHistoTrueSecondaryClusConvGammaFromXFromK0lMCPtESDPt(NULL), fHistoTrueSecondaryClusGammaFromXFromLambdaMCPtESDPt(NULL), fHistoTrueSecondaryClusConvGammaFromXFromLambdaMCPtESDPt(NULL), fHistoDoubleCountTruePi0InvMassPt(NULL), fHistoDoubleCountTrueEtaInvMassPt(NULL), fHistoDoubleCountTrueClusterGammaPt(NULL), fVectorDoubleCountTruePi0s(0), fVectorDoubleCountTrueEtas(0), fVectorDoubleCountTrueClusterGammas(0), fHistoMultipleCountTrueClusterGamma(NULL), fMapMultipleCountTrueClusterGammas(), fHistoTruePi0InvMassPtAlpha(NULL), fHistoTruePi0PureGammaInvMassPtAlpha(NULL), fHistCellIDvsClusterEnergy(NULL), fHistCellIDvsClusterEnergy2(NULL), fHistCellIDvsClusterEnergyMax(NULL), fHistCellIDvsClusterEnergyMax2(NULL), fHistoNEvents(NULL), fHistoNEventsWOWeight(NULL), fHistoNGoodESDTracks(NULL), fHistoVertexZ(NULL), fHistoNGammaCandidates(NULL), fHistoNGammaCandidates2(NULL), fHistoNGammaCandidatesBasic(NULL), fHistoNGoodESDTracksVsNGammaCandidates(NULL), fHistoSPDClusterTrackletBackground(NULL), fHistoNV0Tracks(NULL), fProfileEtaShift(NULL), fProfileJetJetXSection(NULL), fHistoJetJetNTrials(NULL), fHistoEventSphericity(NULL), fHistoEventSphericityAxis(NULL), fHistoEventSphericityvsNtracks(NULL), fHistoEventSphericityvsNJets(NULL), fHistoEventMultiplicityvsNJets(NULL), fHistoTrueSphericityvsRecSphericity(NULL), fHistoTrueMultiplicityvsRecMultiplicity(NULL), fHistoEventSphericityvsHighpt(NULL), fHistoEventSphericityvsTotalpt(NULL), fHistoEventSphericityvsMeanpt(NULL), fHistoPionSpectrum(NULL), fHistoProtonSpectrum(NULL), fHistoKaonSpectrum(NULL), fHistoNPionSpectrum(NULL), fHistoEtaSpectrum(NULL), fHistoDMesonSpectrum(NULL), tTreeSphericity(NULL), fRecSph(0), fTrueSph(0), fPi0Pt(0), fPi0InvMass(0), fHistoPtJet(NULL), fHistoJetEta(NULL), fHistoJetPhi(NULL), fHistoJetArea(NULL), fHistoNJets(NULL), fHistoEventwJets(NULL), fHistoJetPi0PtRatio(NULL), fHistoDoubleCounting(NULL), fHistoJetMotherInvMassPt(NULL), fHistoPi0InJetMotherInvMassPt(NULL), fHistoMotherBackJetInvMassPt(NULL), fHistoRJetPi0Cand(NULL), fHistoEtaPhiJetPi0Cand(NULL), fHistoEtaPhiJetWithPi0Cand(NULL), fHistoJetFragmFunc(NULL), fHistoJetFragmFuncZInvMass(NULL), fHistoTruevsRecJetPt(NULL), fHistoTruePi0JetMotherInvMassPt(NULL), fHistoTruePi0InJetMotherInvMassPt(NULL), fHistoTruePrimaryPi0JetInvMassPt(NULL), fHistoTruePrimaryPi0inJetInvMassPt(NULL), fHistoTruePrimaryPi0InJetInvMassTruePt(NULL), fHistoTrueDoubleCountingPi0Jet(NULL), fHistoTrueEtaJetMotherInvMassPt(NULL), fHistoTrueEtaInJetMotherInvMassPt(NULL), fHistoTruePrimaryEtaJetInvMassPt(NULL), fHistoTruePrimaryEtainJetInvMassPt(NULL), fHistoTrueDoubleCountingEtaJet(NULL), fHistoTruePi0JetFragmFunc(NULL), fHistoTruePi0JetFragmFuncZInvMass(NULL), fHistoTrueEtaJetFragmFunc(NULL), fHistoTrueEtaJetFragmFuncZInvMass(NULL), fHistoMCPi0JetInAccPt(NULL), fHistoMCPi0inJetInAccPt(NULL), fHistoMCEtaJetInAccPt(NULL), fHistoMCEtainJetInAccPt(NULL), fHistoMCPi0JetEventGenerated(NULL), fHistoMCPi0inJetGenerated(NULL), fHistoMCEtaJetEventGenerated(NULL), fHistoMCEtainJetGenerated(NULL), fHistoTrueSecondaryPi0FromK0sJetInvMassPt(NULL), fHistoTrueSecondaryPi0FromK0sinJetInvMassPt(NULL), fHistoTrueSecondaryPi0FromLambdaJetInvMassPt(NULL), fHistoTrueSecondaryPi0FromLambdainJetInvMassPt(NULL), fHistoTrueSecondaryPi0FromK0lJetInvMassPt(NULL), fHistoTrueSecondaryPi0FromK0linJetInvMassPt(NULL), fHistoTrueSecondaryPi0InvJetMassPt(NULL), fHistoTrueSecondaryPi0InvinJetMassPt(NULL), fHistoMotherPi0inJetPtY(NULL), fHistoMotherEtainJetPtY(NULL), fHistoMotherPi0inJetPtPhi(NULL), fHistoMotherEtainJetPtPhi(NULL), fNumberOfClusters(NULL), fNumberOfClustersinJets(NULL), fEnergyRatio(NULL), fEnergyRatioinJets(NULL), fEnergyRatioGamma1(NULL), fEnergyRatioGamma1inJets(NULL), fEnergyRatioGammaAnywhere(NULL), fEnergyRatioGammaAnywhereinJets(NULL), fEnergyDeposit(NULL), fEnergyDepositinJets(NULL), fEnergyDepGamma1(NULL), fEnergyDepGamma1inJets(NULL), fEnergyDepGammaAnywhere(NULL), fEnergyDepGammaAnywhereinJets(NULL), fEnergyRatioGamma1Helped(NULL), fEnergyRatioGamma1HelpedinJets(NULL), fClusterEtaPhiJets(NULL), fHistoUnfoldingAsData(NULL), fHistoUnfoldingMissed(NULL), fHistoUnfoldingReject(NULL), fHistoUnfoldingAsDataInvMassZ(NULL), fHistoUnfoldingMissedInvMassZ(NULL), fHistoUnfoldingRejectInvMassZ(NULL), fVectorJetPt(0), fVectorJetPx(0), fVectorJetPy(0), fVectorJetPz(0), fVectorJetEta(0), fVectorJetPhi(0), fVectorJetArea(0), fTrueVectorJetPt(0), fTrueVectorJetPx(0), fTrueVectorJetPy(0), fTrueVectorJetPz(0), fTrueVectorJetEta(0), fTrueVectorJetPhi(0), tTrueInvMassROpenABPtFlag(NULL), fInvMass(-1), fRconv(-1), fOpenRPrim(-1), fInvMassRTOF(-1), fPt(-1), iFlag(3), tSigInvMassPtAlphaTheta(NULL), tBckInvMassPtAlphaTheta(NULL), fInvMassTreeInvMass(0), fInvMassTreePt(0), fInvMassTreeAlpha(0), fInvMassTreeTheta(0), fInvMassTreeMixPool(0), fInvMassTreeZVertex(0), fInvMassTreeEta(0), tClusterEOverP(NULL), fClusterE(0), fClusterM02(0), fClusterM20(0), fClusterEP(0), fClusterLeadCellID(0), fClusterClassification(0), fDeltaEta(0), fDeltaPhi(0), fTrackPt(0), fTrackPID_e(0), fTrackPID_Pi(0), fTrackPID_K(0), fTrackPID_P(0), fClusterIsoSumClusterEt(0), fClusterIsoSumTrackEt(0), tClusterTimingEff(NULL), fClusterTimeTag(0), fClusterTimeProbe(0), fClusterETag(0), fClusterEProbe(0), fEventPlaneAngle(-100), fRandom(0), fnCuts(0), fiCut(0), fIsHeavyIon(0), fDoLightOutput(kFALSE), fDoMesonAnalysis(kTRUE), fDoMesonQA(0), fDoClusterQA(0), fIsFromDesiredHeader(kTRUE), fIsOverlappingWithOtherHeader(kFALSE), fIsMC(0), fDoTHnSparse(kTRUE), fSetPlotHistsExtQA(kFALSE), fDoSoftAnalysis(kFALSE), fWeightJetJetMC(1), fDoInOutTimingCluster(kFALSE), fMinTimingCluster(0), fMaxTimingCluster(0), fEnableSortForClusMC(kFALSE), fProduceCellIDPlots(kFALSE), fProduceTreeEOverP(kFALSE), tBrokenFiles(NULL), fFileNameBroken(NULL), tClusterQATree(NULL), fCloseHighPtClusters(NULL), fLocalDebugFlag(0), fAllowOverlapHeaders(kTRUE), fNCurrentClusterBasic(0), fTrackMatcherRunningMode(0), fDoPi0Only(kFALSE)
+AliAnalysisTaskSE(name), fV0Reader(NULL), fV0ReaderName("V0ReaderV1"), fCorrTaskSetting(""), fBGHandler(NULL), fInputEvent(NULL), fMCEvent(NULL), fCutFolder(NULL), fESDList(NULL), fBackList(NULL), fMotherList(NULL), fTrueList(NULL), fMCList(NULL), fTreeList(NULL), fClusterTreeList(NULL), fOutputContainer(NULL), fReaderGammas(NULL), fGammaCandidates(NULL), fClusterCandidates(NULL), fClusterCandidates2(NULL), fEventCutArray(NULL), fEventCuts(NULL), fClusterCutArray(NULL), fClusterCutArray2(NULL), fCaloPhotonCuts(NULL), fMesonCutArray(NULL), fMesonCuts(NULL), fConvJetReader(NULL), fConversionCuts(NULL), fOutlierJetReader(NULL), fDoJetAnalysis(kFALSE), fDoJetQA(kFALSE), fDoTrueSphericity(kFALSE), fJetHistograms(NULL), fTrueJetHistograms(NULL), fJetSector(0), fMaxPtNearEMCalPlace(0), fJetNearEMCal(kFALSE), fHistoMotherInvMassPt(NULL), fSparseMotherInvMassPtZM(NULL), fHistoMotherBackInvMassPt(NULL), fSparseMotherBackInvMassPtZM(NULL), fHistoMotherPi0PtY(NULL), fHistoMotherEtaPtY(NULL), fHistoMotherPi0PtAlpha(NULL), fHistoMotherEtaPtAlpha(NULL), fHistoMotherPi0PtOpenAngle(NULL), fHistoMotherEtaPtOpenAngle(NULL), fHistoMotherPtOpenAngle(NULL), fHistoMotherPtOpenAngleBck(NULL), fHistoMotherPi0NGoodESDTracksPt(NULL), fHistoMotherEtaNGoodESDTracksPt(NULL), fHistoMotherInvMassECalib(NULL), fHistoMotherBackInvMassECalib(NULL), fHistoClusGammaPt(NULL), fHistoClusGammaE(NULL), fHistoClusOverlapHeadersGammaPt(NULL), fHistoClusAllHeadersGammaPt(NULL), fHistoClusRejectedHeadersGammaPt(NULL), fHistoClusGammaPtM02(NULL), fHistoMCHeaders(NULL), fHistoMCAllGammaPt(NULL), fHistoMCAllSecondaryGammaPt(NULL), fHistoMCDecayGammaPi0Pt(NULL), fHistoMCDecayGammaRhoPt(NULL), fHistoMCDecayGammaEtaPt(NULL), fHistoMCDecayGammaOmegaPt(NULL), fHistoMCDecayGammaEtapPt(NULL), fHistoMCDecayGammaPhiPt(NULL), fHistoMCDecayGammaSigmaPt(NULL), fHistoMCPi0Pt(NULL), fHistoMCPi0WOWeightPt(NULL), fHistoMCPi0WOEvtWeightPt(NULL), fHistoMCEtaPt(NULL), fHistoMCEtaWOWeightPt(NULL), fHistoMCEtaWOEvtWeightPt(NULL), fHistoMCPi0InAccPt(NULL), fHistoMCEtaInAccPt(NULL), fHistoMCPi0WOEvtWeightInAccPt(NULL), fHistoMCEtaWOEvtWeightInAccPt(NULL), fHistoMCPi0PtY(NULL), fHistoMCEtaPtY(NULL), fHistoMCPi0PtAlpha(NULL), fHistoMCEtaPtAlpha(NULL), fHistoMCPrimaryPtvsSource(NULL), fHistoMCSecPi0PtvsSource(NULL), fHistoMCSecPi0Source(NULL), fHistoMCSecPi0InAccPtvsSource(NULL), fHistoMCSecEtaPt(NULL), fHistoMCSecEtaSource(NULL), fHistoMCPi0PtJetPt(NULL), fHistoMCEtaPtJetPt(NULL), fHistoTruePi0InvMassPt(NULL), fHistoTrueEtaInvMassPt(NULL), fHistoTruePi0CaloPhotonInvMassPt(NULL), fHistoTrueEtaCaloPhotonInvMassPt(NULL), fHistoTruePi0CaloConvertedPhotonInvMassPt(NULL), fHistoTrueEtaCaloConvertedPhotonInvMassPt(NULL), fHistoTruePi0CaloMixedPhotonConvPhotonInvMassPt(NULL), fHistoTrueEtaCaloMixedPhotonConvPhotonInvMassPt(NULL), fHistoTruePi0CaloElectronInvMassPt(NULL), fHistoTrueEtaCaloElectronInvMassPt(NULL), fHistoTruePi0CaloMergedClusterInvMassPt(NULL), fHistoTrueEtaCaloMergedClusterInvMassPt(NULL), fHistoTruePi0CaloMergedClusterPartConvInvMassPt(NULL), fHistoTrueEtaCaloMergedClusterPartConvInvMassPt(NULL), fHistoTruePi0NonMergedElectronPhotonInvMassPt(NULL), fHistoTruePi0NonMergedElectronMergedPhotonInvMassPt(NULL), fHistoTruePi0Category1(NULL), fHistoTrueEtaCategory1(NULL), fHistoTruePi0Category2(NULL), fHistoTrueEtaCategory2(NULL), fHistoTruePi0Category3(NULL), fHistoTrueEtaCategory3(NULL), fHistoTruePi0Category4_6(NULL), fHistoTrueEtaCategory4_6(NULL), fHistoTruePi0Category5(NULL), fHistoTrueEtaCategory5(NULL), fHistoTruePi0Category7(NULL), fHistoTrueEtaCategory7(NULL), fHistoTruePi0Category8(NULL), fHistoTrueEtaCategory8(NULL), fHistoTruePrimaryPi0InvMassPt(NULL), fHistoTruePrimaryEtaInvMassPt(NULL), fHistoTruePrimaryPi0W0WeightingInvMassPt(NULL), fHistoTruePrimaryEtaW0WeightingInvMassPt(NULL), fProfileTruePrimaryPi0WeightsInvMassPt(NULL), fProfileTruePrimaryEtaWeightsInvMassPt(NULL), fHistoTruePrimaryPi0MCPtResolPt(NULL), fHistoTruePrimaryEtaMCPtResolPt(NULL), fHistoTrueSecondaryPi0InvMassPt(NULL), fHistoTrueSecondaryPi0FromK0sInvMassPt(NULL), fHistoTrueK0sWithPi0DaughterMCPt(NULL), fHistoTrueSecondaryPi0FromK0lInvMassPt(NULL), fHistoTrueK0lWithPi0DaughterMCPt(NULL), fHistoTrueSecondaryPi0FromEtaInvMassPt(NULL), fHistoTrueEtaWithPi0DaughterMCPt(NULL), fHistoTrueSecondaryPi0FromLambdaInvMassPt(NULL), fHistoTrueLambdaWithPi0DaughterMCPt(NULL), fHistoTrueBckGGInvMassPt(NULL), fHistoTrueBckFullMesonContainedInOneClusterInvMassPt(NULL), fHistoTrueBckAsymEClustersInvMassPt(NULL), fHistoTrueBckContInvMassPt(NULL), fHistoTruePi0PtY(NULL), fHistoTrueEtaPtY(NULL), fHistoTruePi0PtAlpha(NULL), fHistoTrueEtaPtAlpha(NULL), fHistoTruePi0PtOpenAngle(NULL), fHistoTrueEtaPtOpenAngle(NULL), fHistoClusPhotonBGPt(NULL), fHistoClusPhotonPlusConvBGPt(NULL), fHistoClustPhotonElectronBGPtM02(NULL), fHistoClustPhotonPionBGPtM02(NULL), fHistoClustPhotonKaonBGPtM02(NULL), fHistoClustPhotonK0lBGPtM02(NULL), fHistoClustPhotonNeutronBGPtM02(NULL), fHistoClustPhotonRestBGPtM02(NULL), fHistoClustPhotonPlusConvElectronBGPtM02(NULL), fHistoClustPhotonPlusConvPionBGPtM02(NULL), fHistoClustPhotonPlusConvKaonBGPtM02(NULL), fHistoClustPhotonPlusConvK0lBGPtM02(NULL), fHistoClustPhotonPlusConvNeutronBGPtM02(NULL), fHistoClustPhotonPlusConvRestBGPtM02(NULL), fHistoTrueClusGammaPt(NULL), fHistoTrueClusUnConvGammaPt(NULL), fHistoTrueClusUnConvGammaMCPt(NULL), fHistoTrueClusGammaPtM02(NULL), fHistoTrueClusUnConvGammaPtM02(NULL), fHistoTrueClusElectronPt(NULL), fHistoTrueClusConvGammaPt(NULL), fHistoTrueClusConvGammaMCPt(NULL), fHistoTrueClusConvGammaFullyPt(NULL), fHistoTrueClusMergedGammaPt(NULL), fHistoTrueClusMergedPartConvGammaPt(NULL), fHistoTrueClusDalitzPt(NULL), fHistoTrueClusDalitzMergedPt(NULL), fHistoTrueClusPhotonFromElecMotherPt(NULL), fHistoTrueClusShowerPt(NULL), fHistoTrueClusSubLeadingPt(NULL), fHistoTrueClusNParticles(NULL), fHistoTrueClusEMNonLeadingPt(NULL), fHistoTrueNLabelsInClus(NULL), fHistoTruePrimaryClusGammaPt(NULL), fHistoTruePrimaryClusGammaESDPtMCPt(NULL), fHistoTruePrimaryClusConvGammaPt(NULL), fHistoTruePrimaryClusConvGammaESDPtMCPt(NULL), fHistoTrueSecondaryClusGammaPt(NULL), fHistoTrueSecondaryClusConvGammaPt(NULL), fHistoTrueSecondaryClusGammaMCPt(NULL), fHistoTrueSecondaryClusConvGammaMCPt(NULL), fHistoTrueSecondaryClusGammaFromXFromK0sMCPtESDPt(NULL), fHistoTrueSecondaryClusConvGammaFromXFromK0sMCPtESDPt(NULL), fHistoTrueSecondaryClusGammaFromXFromK0lMCPtESDPt(NULL), fHistoTrueSecondaryClusConvGammaFromXFromK0lMCPtESDPt(NULL), fHistoTrueSecondaryClusGammaFromXFromLambdaMCPtESDPt(NULL), fHistoTrueSecondaryClusConvGammaFromXFromLambdaMCPtESDPt(NULL), fHistoDoubleCountTruePi0InvMassPt(NULL), fHistoDoubleCountTrueEtaInvMassPt(NULL), fHistoDoubleCountTrueClusterGammaPt(NULL), fVectorDoubleCountTruePi0s(0), fVectorDoubleCountTrueEtas(0), fVectorDoubleCountTrueClusterGammas(0), fHistoMultipleCountTrueClusterGamma(NULL), fMapMultipleCountTrueClusterGammas(), fHistoTruePi0InvMassPtAlpha(NULL), fHistoTruePi0PureGammaInvMassPtAlpha(NULL), fHistCellIDvsClusterEnergy(NULL), fHistCellIDvsClusterEnergy2(NULL), fHistCellIDvsClusterEnergyMax(NULL), fHistCellIDvsClusterEnergyMax2(NULL), fHistoNEvents(NULL), fHistoNEventsWOWeight(NULL), fHistoNGoodESDTracks(NULL), fHistoVertexZ(NULL), fHistoNGammaCandidates(NULL), fHistoNGammaCandidates2(NULL), fHistoNGammaCandidatesBasic(NULL), fHistoNGoodESDTracksVsNGammaCandidates(NULL), fHistoSPDClusterTrackletBackground(NULL), fHistoNV0Tracks(NULL), fProfileEtaShift(NULL), fProfileJetJetXSection(NULL), fHistoJetJetNTrials(NULL), fHistoEventSphericity(NULL), fHistoEventSphericityAxis(NULL), fHistoEventSphericityvsNtracks(NULL), fHistoEventSphericityvsNJets(NULL), fHistoEventMultiplicityvsNJets(NULL), fHistoTrueSphericityvsRecSphericity(NULL), fHistoTrueMultiplicityvsRecMultiplicity(NULL), fHistoEventSphericityvsHighpt(NULL), fHistoEventSphericityvsTotalpt(NULL), fHistoEventSphericityvsMeanpt(NULL), fHistoPionSpectrum(NULL), fHistoProtonSpectrum(NULL), fHistoKaonSpectrum(NULL), fHistoNPionSpectrum(NULL), fHistoEtaSpectrum(NULL), fHistoDMesonSpectrum(NULL), tTreeSphericity(NULL), fRecSph(0), fTrueSph(0), fPi0Pt(0), fPi0InvMass(0), fHistoPtJet(NULL), fHistoJetEta(NULL), fHistoJetPhi(NULL), fHistoJetArea(NULL), fHistoNJets(NULL), fHistoEventwJets(NULL), fHistoJetPi0PtRatio(NULL), fHistoDoubleCounting(NULL), fHistoJetMotherInvMassPt(NULL), fHistoPi0InJetMotherInvMassPt(NULL), fHistoMotherBackJetInvMassPt(NULL), fHistoRJetPi0Cand(NULL), fHistoEtaPhiJetPi0Cand(NULL), fHistoEtaPhiJetWithPi0Cand(NULL), fHistoJetFragmFunc(NULL), fHistoJetFragmFuncZInvMass(NULL), fHistoTruevsRecJetPt(NULL), fHistoTruePi0JetMotherInvMassPt(NULL), fHistoTruePi0InJetMotherInvMassPt(NULL), fHistoTruePrimaryPi0JetInvMassPt(NULL), fHistoTruePrimaryPi0inJetInvMassPt(NULL), fHistoTruePrimaryPi0InJetInvMassTruePt(NULL), fHistoTrueDoubleCountingPi0Jet(NULL), fHistoTrueEtaJetMotherInvMassPt(NULL), fHistoTrueEtaInJetMotherInvMassPt(NULL), fHistoTruePrimaryEtaJetInvMassPt(NULL), fHistoTruePrimaryEtainJetInvMassPt(NULL), fHistoTrueDoubleCountingEtaJet(NULL), fHistoTruePi0JetFragmFunc(NULL), fHistoTruePi0JetFragmFuncZInvMass(NULL), fHistoTrueEtaJetFragmFunc(NULL), fHistoTrueEtaJetFragmFuncZInvMass(NULL), fHistoMCPi0JetInAccPt(NULL), fHistoMCPi0inJetInAccPt(NULL), fHistoMCEtaJetInAccPt(NULL), fHistoMCEtainJetInAccPt(NULL), fHistoMCPi0JetEventGenerated(NULL), fHistoMCPi0inJetGenerated(NULL), fHistoMCEtaJetEventGenerated(NULL), fHistoMCEtainJetGenerated(NULL), fHistoTrueSecondaryPi0FromK0sJetInvMassPt(NULL), fHistoTrueSecondaryPi0FromK0sinJetInvMassPt(NULL), fHistoTrueSecondaryPi0FromLambdaJetInvMassPt(NULL), fHistoTrueSecondaryPi0FromLambdainJetInvMassPt(NULL), fHistoTrueSecondaryPi0FromK0lJetInvMassPt(NULL), fHistoTrueSecondaryPi0FromK0linJetInvMassPt(NULL), fHistoTrueSecondaryPi0InvJetMassPt(NULL), fHistoTrueSecondaryPi0InvinJetMassPt(NULL), fHistoMotherPi0inJetPtY(NULL), fHistoMotherEtainJetPtY(NULL), fHistoMotherPi0inJetPtPhi(NULL), fHistoMotherEtainJetPtPhi(NULL), fNumberOfClusters(NULL), fNumberOfClustersinJets(NULL), fEnergyRatio(NULL), fEnergyRatioinJets(NULL), fEnergyRatioGamma1(NULL), fEnergyRatioGamma1inJets(NULL), fEnergyRatioGammaAnywhere(NULL), fEnergyRatioGammaAnywhereinJets(NULL), fEnergyDeposit(NULL), fEnergyDepositinJets(NULL), fEnergyDepGamma1(NULL), fEnergyDepGamma1inJets(NULL), fEnergyDepGammaAnywhere(NULL), fEnergyDepGammaAnywhereinJets(NULL), fEnergyRatioGamma1Helped(NULL), fEnergyRatioGamma1HelpedinJets(NULL), fClusterEtaPhiJets(NULL), fHistoUnfoldingAsData(NULL), fHistoUnfoldingMissed(NULL), fHistoUnfoldingReject(NULL), fHistoUnfoldingAsDataInvMassZ(NULL), fHistoUnfoldingMissedInvMassZ(NULL), fHistoUnfoldingRejectInvMassZ(NULL), fVectorJetPt(0), fVectorJetPx(0), fVectorJetPy(0), fVectorJetPz(0), fVectorJetEta(0), fVectorJetPhi(0), fVectorJetArea(0), fTrueVectorJetPt(0), fTrueVectorJetPx(0), fTrueVectorJetPy(0), fTrueVectorJetPz(0), fTrueVectorJetEta(0), fTrueVectorJetPhi(0), tTrueInvMassROpenABPtFlag(NULL), fInvMass(-1), fRconv(-1), fOpenRPrim(-1), fInvMassRTOF(-1), fPt(-1), iFlag(3), tSigInvMassPtAlphaTheta(NULL), tBckInvMassPtAlphaTheta(NULL), fInvMassTreeInvMass(0), fInvMassTreePt(0), fInvMassTreeAlpha(0), fInvMassTreeTheta(0), fInvMassTreeMixPool(0), fInvMassTreeZVertex(0), fInvMassTreeEta(0), tClusterEOverP(NULL), fClusterE(0), fClusterM02(0), fClusterM20(0), fClusterEP(0), fClusterLeadCellID(0), fClusterClassification(0), fDeltaEta(0), fDeltaPhi(0), fTrackPt(0), fTrackPID_e(0), fTrackPID_Pi(0), fTrackPID_K(0), fTrackPID_P(0), fClusterIsoSumClusterEt(0), fClusterIsoSumTrackEt(0), tClusterTimingEff(NULL), fClusterTimeTag(0), fClusterTimeProbe(0), fClusterETag(0), fClusterEProbe(0), fEventPlaneAngle(-100), fRandom(0), fnCuts(0), fiCut(0), fIsHeavyIon(0), fDoLightOutput(kFALSE), fDoMesonAnalysis(kTRUE), fDoMesonQA(0), fDoClusterQA(0), fIsFromDesiredHeader(kTRUE), fIsOverlappingWithOtherHeader(kFALSE), fIsMC(0), fDoTHnSparse(kTRUE), fSetPlotHistsExtQA(kFALSE), fDoSoftAnalysis(kFALSE), fWeightJetJetMC(1), fDoInOutTimingCluster(kFALSE), fMinTimingCluster(0), fMaxTimingCluster(0), fEnableSortForClusMC(kFALSE), fProduceCellIDPlots(kFALSE), fProduceTreeEOverP(kFALSE), tBrokenFiles(NULL), fFileNameBroken(NULL), tClusterQATree(NULL), fCloseHighPtClusters(NULL), fLocalDebugFlag(0), fAllowOverlapHeaders(kTRUE), fNCurrentClusterBasic(0), fTrackMatcherRunningMode(0), fDoPi0Only(kFALSE), fUseSharedMixingPool(kFALSE), fSharedBGPool(NULL), fSharedCurrent(), fSharedCurrent2(), fSharedMixingEvents(), fSharedMixBin(), fSharedStoreBin(), fSharedZBin(), fSharedMBin(), fSharedWeight(), fSharedRotationMask(0), fSharedRotationDegrees(), fSharedRotationN(), fSharedRotationCuts()
 {
   // Define output slots here
   DefineOutput(1, TList::Class());
@@ -103,6 +103,10 @@ AliAnalysisTaskGammaCaloMix::~AliAnalysisTaskGammaCaloMix()
     delete[] fBGHandler;
     fBGHandler = 0x0;
   }
+  if(fSharedBGPool){
+    delete fSharedBGPool;
+    fSharedBGPool = 0x0;
+  }
 }
 //___________________________________________________________
 void AliAnalysisTaskGammaCaloMix::InitBack(){
@@ -169,6 +173,30 @@ void AliAnalysisTaskGammaCaloMix::InitBack(){
       }
     }
   }
+
+  if(fUseSharedMixingPool){
+    fSharedBGPool = new AliConversionSharedBGPool(fnCuts);
+    for(Int_t iCut = 0; iCut<fSharedBGPool->GetNCuts();iCut++){
+      AliConversionMesonCuts *mesonCuts = (AliConversionMesonCuts*)fMesonCutArray->At(iCut);
+      if(!mesonCuts->DoBGCalculation() || mesonCuts->BackgroundHandlerType() != 0 || mesonCuts->DoJetMixing()) continue;
+      fSharedBGPool->SetCut(iCut,fBGHandler[iCut]->GetNBinsZ()*fBGHandler[iCut]->GetNBinsMultiplicity(),fBGHandler[iCut]->GetNBGEvents());
+      if(!mesonCuts->UseRotationMethod()) continue;
+      // cuts with the same rotation settings share the rotated photons
+      UInt_t iGroup = 0;
+      while(iGroup < fSharedRotationCuts.size() && (fSharedRotationDegrees[iGroup] != mesonCuts->NDegreesRotation() || fSharedRotationN[iGroup] != mesonCuts->GetNumberOfBGEvents())) iGroup++;
+      if(iGroup == fSharedRotationCuts.size()){
+        fSharedRotationDegrees.push_back(mesonCuts->NDegreesRotation());
+        fSharedRotationN.push_back(mesonCuts->GetNumberOfBGEvents());
+        fSharedRotationCuts.push_back(0);
+      }
+      fSharedRotationCuts[iGroup] |= ((ULong64_t)1) << iCut;
+    }
+    fSharedMixBin.assign(fnCuts,-1);
+    fSharedStoreBin.assign(fnCuts,-1);
+    fSharedZBin.assign(fnCuts,0);
+    fSharedMBin.assign(fnCuts,0);
+    fSharedWeight.assign(fnCuts,1.);
+  }
 }
 //________________________________________________________________________
 void AliAnalysisTaskGammaCaloMix::UserCreateOutputObjects(){
@@ -2501,6 +2529,13 @@ void AliAnalysisTaskGammaCaloMix::UserExec(Option_t *)
   AliEventplane *EventPlane = fInputEvent->GetEventplane();
   if(fIsHeavyIon ==1)fEventPlaneAngle = EventPlane->GetEventplane("V0",fInputEvent,2);
   else fEventPlaneAngle=0.0;
+  if(fSharedBGPool){
+    fSharedCurrent.clear();
+    fSharedCurrent2.clear();
+    fSharedMixBin.assign(fnCuts,-1);
+    fSharedStoreBin.assign(fnCuts,-1);
+    fSharedRotationMask = 0;
+  }
   for(Int_t iCut = 0; iCut<fnCuts; iCut++){
 
     fiCut = iCut;
@@ -2685,8 +2720,12 @@ void AliAnalysisTaskGammaCaloMix::UserExec(Option_t *)
       CalculatePi0Candidates(); // Combine Gammas from conversion and from calo
       if(((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->DoBGCalculation()){
         if(((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->BackgroundHandlerType() == 0){
-          CalculateBackground(); // Combinatorial Background
-          UpdateEventByEventData(); // Store Event for mixed Events
+          if(fSharedBGPool && fSharedBGPool->HasCut(iCut)){
+            AddToSharedMixing(); // background of all cuts is calculated after the loop
+          } else {
+            CalculateBackground(); // Combinatorial Background
+            UpdateEventByEventData(); // Store Event for mixed Events
+          }
         }
 
       }
@@ -2701,6 +2740,7 @@ void AliAnalysisTaskGammaCaloMix::UserExec(Option_t *)
     fClusterCandidates->Clear(); // delete cluster candidates
     fClusterCandidates2->Clear(); // delete cluster candidates
   }
+  if(fSharedBGPool) CalculateSharedBackground();
   if (fCloseHighPtClusters) delete fCloseHighPtClusters;
   PostData(1, fOutputContainer);
 }
@@ -6013,6 +6053,137 @@ void AliAnalysisTaskGammaCaloMix::UpdateEventByEventData(){
   }
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskGammaCaloMix::AddToSharedMixing(){
+  // register the candidates of the current cut, same binning and storing conditions as
+  // CalculateBackground() and UpdateEventByEventData()
+
+  AliConversionSharedBGPool::AddPhotons(fSharedCurrent,fClusterCandidates,fiCut);
+  AliConversionSharedBGPool::AddPhotons(fSharedCurrent2,fClusterCandidates2,fiCut);
+
+  Int_t mult = fClusterCandidates->GetEntries()+fClusterCandidates2->GetEntries();
+  if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseTrackMultiplicity()) mult = fV0Reader->GetNumberOfPrimaryTracks();
+  fSharedZBin[fiCut]    = fBGHandler[fiCut]->GetZBinIndex(fInputEvent->GetPrimaryVertex()->GetZ());
+  fSharedMBin[fiCut]    = fBGHandler[fiCut]->GetMultiplicityBinIndex(mult);
+  fSharedWeight[fiCut]  = fWeightJetJetMC;
+  Int_t bin             = fSharedZBin[fiCut]*fBGHandler[fiCut]->GetNBinsMultiplicity()+fSharedMBin[fiCut];
+
+  if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseRotationMethod()){
+    fSharedRotationMask |= ((ULong64_t)1) << fiCut;
+    return;
+  }
+  fSharedMixBin[fiCut] = bin;
+  if(fDoJetAnalysis && fConvJetReader->GetNJets() == 0) return;
+  if(fClusterCandidates2->GetEntries() > 0) fSharedStoreBin[fiCut] = bin;
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskGammaCaloMix::CalculateSharedBackground(){
+  // mixed and rotational background of all cuts registered with AddToSharedMixing(), every
+  // pair is built once and then selected with the meson cuts of the cuts sharing both photons
+
+  AliAODConversionPhoton gamma0;
+  AliAODConversionPhoton gamma1;
+
+  fSharedBGPool->GetMixingEvents(fSharedMixBin,fSharedMixingEvents);
+  for(UInt_t iEvent = 0; iEvent < fSharedMixingEvents.size(); iEvent++){
+    ULong64_t eventMask = fSharedMixingEvents[iEvent].fCutMask;
+    const std::vector<AliConversionSharedBGPool::Photon> &previousEventGammas = fSharedBGPool->GetPhotons(fSharedMixingEvents[iEvent].fEvent);
+    for(UInt_t iCurrent = 0; iCurrent < fSharedCurrent.size(); iCurrent++){
+      ULong64_t currentMask = fSharedCurrent[iCurrent].fCutMask & eventMask;
+      if(!currentMask) continue;
+      AliConversionSharedBGPool::FillPhoton(fSharedCurrent[iCurrent],&gamma0);
+      for(UInt_t iPrevious = 0; iPrevious < previousEventGammas.size(); iPrevious++){
+        ULong64_t pairMask = currentMask & previousEventGammas[iPrevious].fCutMask;
+        if(!pairMask) continue;
+        AliConversionSharedBGPool::FillPhoton(previousEventGammas[iPrevious],&gamma1);
+        AliAODConversionMother backgroundCandidate(&gamma0,&gamma1);
+        backgroundCandidate.CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+        for(Int_t iCut = 0; pairMask; iCut++, pairMask >>= 1){
+          if(pairMask & 1) FillSharedBackground(iCut,&backgroundCandidate,&gamma0,&gamma1);
+        }
+      }
+    }
+  }
+
+  if(fSharedRotationMask){
+    for(UInt_t iCurrent = 0; iCurrent < fSharedCurrent.size(); iCurrent++){
+      ULong64_t currentMask = fSharedCurrent[iCurrent].fCutMask & fSharedRotationMask;
+      if(!currentMask) continue;
+      AliConversionSharedBGPool::FillPhoton(fSharedCurrent[iCurrent],&gamma0);
+      for(UInt_t iCurrent2 = 0; iCurrent2 < fSharedCurrent2.size(); iCurrent2++){
+        ULong64_t pairMask = currentMask & fSharedCurrent2[iCurrent2].fCutMask;
+        if(!pairMask) continue;
+        for(UInt_t iGroup = 0; iGroup < fSharedRotationCuts.size(); iGroup++){
+          ULong64_t groupMask = pairMask & fSharedRotationCuts[iGroup];
+          if(!groupMask) continue;
+          Double_t nRadiansPM = fSharedRotationDegrees[iGroup]*TMath::Pi()/180;
+          for(Int_t nRandom = 0; nRandom < fSharedRotationN[iGroup]; nRandom++){
+            AliConversionSharedBGPool::FillPhoton(fSharedCurrent2[iCurrent2],&gamma1);
+            gamma1.RotateZ(fRandom.Rndm()*2*nRadiansPM + TMath::Pi()-nRadiansPM);
+            AliAODConversionMother backgroundCandidate(&gamma0,&gamma1);
+            backgroundCandidate.CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+            ULong64_t mask = groupMask;
+            for(Int_t iCut = 0; mask; iCut++, mask >>= 1){
+              if(mask & 1) FillSharedBackground(iCut,&backgroundCandidate,&gamma0,&gamma1);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  fSharedBGPool->AddEvent(fSharedCurrent2,fSharedStoreBin);
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskGammaCaloMix::FillSharedBackground(Int_t iCut, AliAODConversionMother *backgroundCandidate, AliAODConversionPhoton *gamma0, AliAODConversionPhoton *gamma1){
+  // background histograms of one cut, as filled by CalculateBackground()
+
+  AliConvEventCuts *eventCuts       = (AliConvEventCuts*)fEventCutArray->At(iCut);
+  AliConversionMesonCuts *mesonCuts = (AliConversionMesonCuts*)fMesonCutArray->At(iCut);
+  if(!mesonCuts->MesonIsSelected(backgroundCandidate,kFALSE,eventCuts->GetEtaShift(), gamma0->GetLeadingCellID(), gamma1->GetLeadingCellID(), gamma0->GetIsCaloPhoton(), gamma1->GetIsCaloPhoton())) return;
+
+  // Set the BG candidate jetjet weight to 1 in case both photons orignated from the minimum bias header
+  Double_t tempBGCandidateWeight = fSharedWeight[iCut];
+  if (fIsMC>0 && eventCuts->GetSignalRejection() == 4){
+    if( eventCuts->IsParticleFromBGEvent(gamma1->GetCaloPhotonMCLabel(0), fMCEvent, fInputEvent) == 2 &&
+        eventCuts->IsParticleFromBGEvent(gamma0->GetCaloPhotonMCLabel(0), fMCEvent, fInputEvent) == 2)
+      tempBGCandidateWeight = 1;
+  }
+
+  Bool_t useTrackMult = mesonCuts->UseTrackMultiplicity();
+  Int_t zbin          = fSharedZBin[iCut];
+  Int_t mbin          = fSharedMBin[iCut];
+  if(useTrackMult || !fDoJetAnalysis || (fDoJetAnalysis && !fDoLightOutput)) fHistoMotherBackInvMassPt[iCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), tempBGCandidateWeight);
+  if(!useTrackMult && fDoJetAnalysis){
+    if(fConvJetReader->GetNJets() > 0){
+      if(!fDoLightOutput) fHistoMotherBackJetInvMassPt[iCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), tempBGCandidateWeight);
+      else fHistoMotherBackInvMassPt[iCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(), tempBGCandidateWeight);
+    }
+  }
+  if(fDoTHnSparse){
+    Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
+    fSparseMotherBackInvMassPtZM[iCut]->Fill(sparesFill,1);
+  }
+  if((!fDoLightOutput || fDoPi0Only) && TMath::Abs(backgroundCandidate->GetAlpha())<0.1){
+    fHistoMotherBackInvMassECalib[iCut]->Fill(backgroundCandidate->M(),backgroundCandidate->E(),tempBGCandidateWeight);
+  }
+  if (!useTrackMult && fDoMesonQA == 2){
+    fHistoMotherPtOpenAngleBck[iCut]->Fill(backgroundCandidate->Pt(),backgroundCandidate->GetOpeningAngle(), tempBGCandidateWeight);
+  }
+  if(fDoMesonQA == 4 && fIsMC == 0 && (backgroundCandidate->Pt() > 13.) ){
+    fInvMassTreeInvMass = backgroundCandidate->M();
+    fInvMassTreePt = backgroundCandidate->Pt();
+    fInvMassTreeAlpha = TMath::Abs(backgroundCandidate->GetAlpha());
+    fInvMassTreeTheta = backgroundCandidate->GetOpeningAngle();
+    fInvMassTreeMixPool = zbin*100 + mbin;
+    fInvMassTreeZVertex = fInputEvent->GetPrimaryVertex()->GetZ();
+    fInvMassTreeEta = backgroundCandidate->Eta();
+    tBckInvMassPtAlphaTheta[iCut]->Fill();
+  }
+}
+
 
 //________________________________________________________________________
 void AliAnalysisTaskGammaCaloMix::FillPhotonBackgroundHist(AliAODConversionPhoton *TruePhotonCandidate, Int_t pdgCode)
@@ -7,6 +7,7 @@
 #include "AliKFConversionPhoton.h"
 #include "AliGammaConversionAODBGHandler.h"
 #include "AliConversionAODBGHandlerRP.h"
+#include "AliConversionSharedBGPool.h"
 #include "AliCaloPhotonCuts.h"
 #include "AliConvEventCuts.h"
 #include "AliConversionPhotonCuts.h"
@@ -64,6 +65,9 @@ class AliAnalysisTaskGammaCaloMix : public AliAnalysisTaskSE {
     void SetPlotHistsExtQA(Bool_t flag){fSetPlotHistsExtQA = flag;}
     void SetAllowOverlapHeaders( Bool_t allowOverlapHeader ) {fAllowOverlapHeaders = allowOverlapHeader;}
     void SetDoPi0Only(Bool_t flag){fDoPi0Only = flag;}
+    // one mixing pool for all cuts (index < 64) with the standard handler and no jet mixing,
+    // cuts with the rotation method get the rotational background instead of the mixed one
+    void SetUseSharedMixingPool(Bool_t flag){fUseSharedMixingPool = flag;}
 
     void SetInOutTimingCluster(Double_t min, Double_t max){
       fDoInOutTimingCluster = kTRUE; fMinTimingCluster = min; fMaxTimingCluster = max;
@@ -105,6 +109,9 @@ class AliAnalysisTaskGammaCaloMix : public AliAnalysisTaskSE {
     void FillPhotonBackgroundM02Hist(AliAODConversionPhoton *TruePhotonCandidate, AliVCluster* clus, Int_t pdgCode);
     void FillPhotonPlusConversionBackgroundM02Hist(AliAODConversionPhoton *TruePhotonCandidate, AliVCluster* clus, Int_t pdgCode);
     void UpdateEventByEventData();
+    void AddToSharedMixing();
+    void CalculateSharedBackground();
+    void FillSharedBackground(Int_t iCut, AliAODConversionMother *backgroundCandidate, AliAODConversionPhoton *gamma0, AliAODConversionPhoton *gamma1);
 
     // Additional functions for convenience
     void SetLogBinningXTH2(TH2* histoRebin);
@@ -557,11 +564,25 @@ class AliAnalysisTaskGammaCaloMix : public AliAnalysisTaskSE {
     Int_t                 fNCurrentClusterBasic;                                // current number of cluster without minE
     Int_t                 fTrackMatcherRunningMode;                             // CaloTrackMatcher running mode
     Bool_t                fDoPi0Only;                                           // switches ranges of histograms and binnings to pi0 specific analysis
+    Bool_t                fUseSharedMixingPool;                                 // flag for the mixing pool shared by the cuts
+    AliConversionSharedBGPool* fSharedBGPool;                                   //! mixing pool shared by the cuts
+    std::vector<AliConversionSharedBGPool::Photon> fSharedCurrent;              //! photons of the first cluster collection of all cuts in the current event
+    std::vector<AliConversionSharedBGPool::Photon> fSharedCurrent2;             //! photons of the second cluster collection of all cuts in the current event
+    std::vector<AliConversionSharedBGPool::MixingEvent> fSharedMixingEvents;    //! pooled events to be mixed with the current one
+    std::vector<Int_t>    fSharedMixBin;                                        //! pool bin of the current event per cut, -1 if the cut does not mix it
+    std::vector<Int_t>    fSharedStoreBin;                                      //! pool bin in which the current event is stored per cut, -1 if not stored
+    std::vector<Int_t>    fSharedZBin;                                          //! z bin of the current event per cut
+    std::vector<Int_t>    fSharedMBin;                                          //! multiplicity bin of the current event per cut
+    std::vector<Double_t> fSharedWeight;                                        //! event weight of the current event per cut
+    ULong64_t             fSharedRotationMask;                                  //! cuts of the current event with the rotation method
+    std::vector<Int_t>    fSharedRotationDegrees;                               //! rotation range of each group of rotation cuts
+    std::vector<Int_t>    fSharedRotationN;                                     //! number of rotations of each group of rotation cuts
+    std::vector<ULong64_t> fSharedRotationCuts;                                 //! cuts of each group of rotation cuts
   private:
     AliAnalysisTaskGammaCaloMix(const AliAnalysisTaskGammaCaloMix&);                  // Prevent copy-construction
     AliAnalysisTaskGammaCaloMix &operator=(const AliAnalysisTaskGammaCaloMix&);       // Prevent assignment
 
-    ClassDef(AliAnalysisTaskGammaCaloMix, 5);
+    ClassDef(AliAnalysisTaskGammaCaloMix, 6);
 };
 
 #endif
@@ -472,7 +472,14 @@ AliAnalysisTaskGammaConvCalo::AliAnalysisTaskGammaConvCalo(): AliAnalysisTaskSE(
   fFileNameBroken(NULL),
   fAllowOverlapHeaders(kTRUE),
   fTrackMatcherRunningMode(0),
-  fDoHBTHistoOutput(kFALSE)
+  fDoHBTHistoOutput(kFALSE),
+  fUseCompactBGPool(kFALSE),
+  fCompactBGPoolBudget(50.),
+  fUseMesonPairPrefilter(kFALSE),
+  fPairCurrentPhotons(),
+  fPairPhotons1(),
+  fPairPhotons2(),
+  fPairCandidates()
 {
 
 }
@@ -887,7 +894,14 @@ AliAnalysisTaskGammaConvCalo::AliAnalysisTaskGammaConvCalo(const char *name):
   fFileNameBroken(NULL),
   fAllowOverlapHeaders(kTRUE),
   fTrackMatcherRunningMode(0),
-  fDoHBTHistoOutput(kFALSE)
+  fDoHBTHistoOutput(kFALSE),
+  fUseCompactBGPool(kFALSE),
+  fCompactBGPoolBudget(50.),
+  fUseMesonPairPrefilter(kFALSE),
+  fPairCurrentPhotons(),
+  fPairPhotons1(),
+  fPairPhotons2(),
+  fPairCandidates()
 {
   // Define output slots here
   DefineOutput(1, TList::Class());
@@ -1026,6 +1040,10 @@ void AliAnalysisTaskGammaConvCalo::InitBack(){
                                   ((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->GetNumberOfBGEvents(),
                                   ((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->UseTrackMultiplicity(),
                                   2,8,5);
+        if(fUseCompactBGPool){
+          fBGHandler[iCut]->SetUseCompactPool(kTRUE,fCompactBGPoolBudget);
+          fBGClusHandler[iCut]->SetUseCompactPool(kTRUE,fCompactBGPoolBudget);
+        }
         fBGHandlerRP[iCut] = NULL;
         if(fIsMC>0 && fDoHBTHistoOutput){
           fBGHBTTrueGammaHandler[iCut] = new AliGammaConversionAODBGHandler(
@@ -1048,6 +1066,10 @@ void AliAnalysisTaskGammaConvCalo::InitBack(){
                                   ((AliConvEventCuts*)fEventCutArray->At(fiCut))->IsHeavyIon(),
                                   ((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseTrackMultiplicity(),
                                   ((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->GetNumberOfBGEvents());
+        if(fUseCompactBGPool){
+          fBGHandlerRP[iCut]->SetUseCompactPool(kTRUE,fCompactBGPoolBudget);
+          fBGClusHandlerRP[iCut]->SetUseCompactPool(kTRUE,fCompactBGPoolBudget);
+        }
         fBGHandler[iCut] = NULL;
       }
     }
@@ -7075,17 +7097,65 @@ void AliAnalysisTaskGammaConvCalo::CalculateBackground(){
     }
   } else {
     // mixing current conversion photons with previous clusters
+    SetPairCurrentPhotons(fGammaCandidates);
     for(Int_t nEventsInBG=0;nEventsInBG <fBGClusHandler[fiCut]->GetNBGEvents();nEventsInBG++){
       AliGammaConversionAODVector *previousEventV0s = fBGClusHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
       if(previousEventV0s){
         if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0 ){
           bgEventVertex = fBGClusHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
         }
-        for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
-          AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
-          for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
+        FillPairCandidates(previousEventV0s,kFALSE);
+        for(UInt_t iPair=0;iPair<fPairCandidates.size();iPair+=2){
+          AliAODConversionPhoton &currentEventGoodV0 = *(fPairCurrentPhotons[fPairCandidates[iPair]]);
 
-            AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
+          AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(fPairCandidates[iPair+1])));
+
+          if(fMoveParticleAccordingToVertex == kTRUE){
+            if (bgEventVertex){
+              MoveParticleAccordingToVertex(&previousGoodV0,bgEventVertex);
+            }
+          }
+          if(((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
+            if (bgEventVertex){
+              RotateParticleAccordingToEP(&previousGoodV0,bgEventVertex->fEP,fEventPlaneAngle);
+            }
+          }
+
+          AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
+          backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
+          if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
+            fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(),fWeightJetJetMC);
+            if(!fDoLightOutput) fHistoPhotonPairMixedEventPtconv[fiCut]->Fill(backgroundCandidate->M(),currentEventGoodV0.Pt());
+            if(fDoTHnSparse){
+              Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
+              fSparseMotherBackInvMassPtZM[fiCut]->Fill(sparesFill,1);
+            }
+            if(!fDoLightOutput || fDoECalibOutput > 0) fHistoMotherBackInvMassECalib[fiCut]->Fill(backgroundCandidate->M(),currentEventGoodV0.E(),fWeightJetJetMC);
+            if(fDoECalibOutput == 2) fHistoMotherBackInvMassECalibPCM[fiCut]->Fill(backgroundCandidate->M(),previousGoodV0.E(),fWeightJetJetMC);
+            if(fDoHBTHistoOutput){
+                fHistoBckHBTOpeningAnglePt[fiCut]->Fill(backgroundCandidate->GetOpeningAngle(),backgroundCandidate->Pt());
+                fHistoBckHBTDeltaEPt[fiCut]->Fill(abs(currentEventGoodV0.E()-previousGoodV0.E()),backgroundCandidate->Pt());
+            }
+          }
+          delete backgroundCandidate;
+          backgroundCandidate = 0x0;
+        }
+      }
+    }
+    if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->DoConvCaloMixing())){
+      // mixing current clusters with previous conversion photons
+      SetPairCurrentPhotons(fClusterCandidates);
+      for(Int_t nEventsInBG=0;nEventsInBG <fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
+        AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
+        if(previousEventV0s){
+          if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0 ){
+            bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
+          }
+          FillPairCandidates(previousEventV0s,kFALSE);
+          for(UInt_t iPair=0;iPair<fPairCandidates.size();iPair+=2){
+            AliAODConversionPhoton &currentEventGoodV0 = *(fPairCurrentPhotons[fPairCandidates[iPair]]);
+
+            AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(fPairCandidates[iPair+1])));
 
             if(fMoveParticleAccordingToVertex == kTRUE){
               if (bgEventVertex){
@@ -7110,8 +7180,8 @@ void AliAnalysisTaskGammaConvCalo::CalculateBackground(){
               if(!fDoLightOutput || fDoECalibOutput > 0) fHistoMotherBackInvMassECalib[fiCut]->Fill(backgroundCandidate->M(),currentEventGoodV0.E(),fWeightJetJetMC);
               if(fDoECalibOutput == 2) fHistoMotherBackInvMassECalibPCM[fiCut]->Fill(backgroundCandidate->M(),previousGoodV0.E(),fWeightJetJetMC);
               if(fDoHBTHistoOutput){
-                  fHistoBckHBTOpeningAnglePt[fiCut]->Fill(backgroundCandidate->GetOpeningAngle(),backgroundCandidate->Pt());
-                  fHistoBckHBTDeltaEPt[fiCut]->Fill(abs(currentEventGoodV0.E()-previousGoodV0.E()),backgroundCandidate->Pt());
+                fHistoBckHBTOpeningAnglePt[fiCut]->Fill(backgroundCandidate->GetOpeningAngle(),backgroundCandidate->Pt());
+                fHistoBckHBTDeltaEPt[fiCut]->Fill(abs(currentEventGoodV0.E()-previousGoodV0.E()),backgroundCandidate->Pt());
               }
             }
             delete backgroundCandidate;
@@ -7120,55 +7190,42 @@ void AliAnalysisTaskGammaConvCalo::CalculateBackground(){
         }
       }
     }
-    if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->DoConvCaloMixing())){
-      // mixing current clusters with previous conversion photons
-      for(Int_t nEventsInBG=0;nEventsInBG <fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-        AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
-        if(previousEventV0s){
-          if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0 ){
-            bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
-          }
-          for(Int_t iCurrent=0;iCurrent<fClusterCandidates->GetEntries();iCurrent++){
-            AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fClusterCandidates->At(iCurrent));
-            for(UInt_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-
-              AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
+  }
+}
 
-              if(fMoveParticleAccordingToVertex == kTRUE){
-                if (bgEventVertex){
-                  MoveParticleAccordingToVertex(&previousGoodV0,bgEventVertex);
-                }
-              }
-              if(((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
-                if (bgEventVertex){
-                  RotateParticleAccordingToEP(&previousGoodV0,bgEventVertex->fEP,fEventPlaneAngle);
-                }
-              }
+//________________________________________________________________________
+void AliAnalysisTaskGammaConvCalo::SetPairCurrentPhotons(TList *currentPhotons){
+  // current event photons of the background pair loop
+  fPairCurrentPhotons.clear();
+  fPairPhotons1.Clear();
+  TIter next(currentPhotons);
+  while(AliAODConversionPhoton *gamma = (AliAODConversionPhoton*)next()){
+    fPairCurrentPhotons.push_back(gamma);
+    fPairPhotons1.Add(gamma->Px(),gamma->Py(),gamma->Pz(),gamma->E());
+  }
+}
 
-              AliAODConversionMother *backgroundCandidate = new AliAODConversionMother(&currentEventGoodV0,&previousGoodV0);
-              backgroundCandidate->CalculateDistanceOfClossetApproachToPrimVtx(fInputEvent->GetPrimaryVertex());
-              if((((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->MesonIsSelected(backgroundCandidate,kFALSE,((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift()))){
-                fHistoMotherBackInvMassPt[fiCut]->Fill(backgroundCandidate->M(),backgroundCandidate->Pt(),fWeightJetJetMC);
-                if(!fDoLightOutput) fHistoPhotonPairMixedEventPtconv[fiCut]->Fill(backgroundCandidate->M(),currentEventGoodV0.Pt());
-                if(fDoTHnSparse){
-                  Double_t sparesFill[4] = {backgroundCandidate->M(),backgroundCandidate->Pt(),(Double_t)zbin,(Double_t)mbin};
-                  fSparseMotherBackInvMassPtZM[fiCut]->Fill(sparesFill,1);
-                }
-                if(!fDoLightOutput || fDoECalibOutput > 0) fHistoMotherBackInvMassECalib[fiCut]->Fill(backgroundCandidate->M(),currentEventGoodV0.E(),fWeightJetJetMC);
-                if(fDoECalibOutput == 2) fHistoMotherBackInvMassECalibPCM[fiCut]->Fill(backgroundCandidate->M(),previousGoodV0.E(),fWeightJetJetMC);
-                if(fDoHBTHistoOutput){
-                  fHistoBckHBTOpeningAnglePt[fiCut]->Fill(backgroundCandidate->GetOpeningAngle(),backgroundCandidate->Pt());
-                  fHistoBckHBTDeltaEPt[fiCut]->Fill(abs(currentEventGoodV0.E()-previousGoodV0.E()),backgroundCandidate->Pt());
-                }
-              }
-              delete backgroundCandidate;
-              backgroundCandidate = 0x0;
-            }
-          }
-        }
+//________________________________________________________________________
+void AliAnalysisTaskGammaConvCalo::FillPairCandidates(AliGammaConversionAODVector *previousPhotons, Bool_t isSignal){
+  // pairs of current and previous photons to be built, all of them or those passing the pair kernel.
+  // The kernel is not used if the previous photons are moved or rotated before the pairing
+  fPairCandidates.clear();
+  if(!fUseMesonPairPrefilter || fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
+    for(UInt_t iCurrent=0;iCurrent<fPairCurrentPhotons.size();iCurrent++){
+      for(UInt_t iPrevious=0;iPrevious<previousPhotons->size();iPrevious++){
+        fPairCandidates.push_back(iCurrent);
+        fPairCandidates.push_back(iPrevious);
       }
     }
+    return;
+  }
+  fPairPhotons2.Clear();
+  for(UInt_t iPrevious=0;iPrevious<previousPhotons->size();iPrevious++){
+    AliAODConversionPhoton *gamma = previousPhotons->at(iPrevious);
+    fPairPhotons2.Add(gamma->Px(),gamma->Py(),gamma->Pz(),gamma->E());
   }
+  ((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->PrefilterPhotonPairs(fPairPhotons1,fPairPhotons2,isSignal,
+                                                                            ((AliConvEventCuts*)fEventCutArray->At(fiCut))->GetEtaShift(),fPairCandidates);
 }
 
 //________________________________________________________________________
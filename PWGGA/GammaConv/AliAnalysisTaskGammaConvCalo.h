@@ -86,6 +86,10 @@ class AliAnalysisTaskGammaConvCalo : public AliAnalysisTaskSE {
     void SetAllowOverlapHeaders         ( Bool_t allowOverlapHeader )                       { fAllowOverlapHeaders = allowOverlapHeader   ;}
     void SetDoMaterialBudgetWeightingOfGammasForTrueMesons(Bool_t flag)                     { fDoMaterialBudgetWeightingOfGammasForTrueMesons = flag;}
     void SetDoHBTHistoOutput            ( Bool_t flag )                                     { fDoHBTHistoOutput = flag                    ;}
+    void SetUseCompactBGPool            ( Bool_t flag,
+                                          Double_t memoryBudgetMB = 50. )                   { fUseCompactBGPool = flag;
+                                                                                              fCompactBGPoolBudget = memoryBudgetMB       ;}
+    void SetUseMesonPairPrefilter       ( Bool_t flag )                                     { fUseMesonPairPrefilter = flag               ;}
 
     // Setting the cut lists for the conversion photons
     void SetEventCutList                ( Int_t nCuts,
@@ -119,6 +123,9 @@ class AliAnalysisTaskGammaConvCalo : public AliAnalysisTaskSE {
     void CalculateBackground            ();
     void CalculateBackgroundSwapp       ();
     void CalculateBackgroundRP          ();
+    void SetPairCurrentPhotons          ( TList *currentPhotons );
+    void FillPairCandidates             ( AliGammaConversionAODVector *previousPhotons,
+                                          Bool_t isSignal );
     void RotateParticle                 ( AliAODConversionPhoton *gamma );
     void RotateParticleAccordingToEP    ( AliAODConversionPhoton *gamma,
                                           Double_t previousEventEP,
@@ -600,12 +607,19 @@ class AliAnalysisTaskGammaConvCalo : public AliAnalysisTaskSE {
     Bool_t                  fAllowOverlapHeaders;                               // enable overlapping headers for cluster selection
     Int_t                   fTrackMatcherRunningMode;                           // CaloTrackMatcher running mode
     Bool_t                  fDoHBTHistoOutput;                                  // switch for additional HBT output
+    Bool_t                  fUseCompactBGPool;                                  // store only the fields needed for mixing in the BG handlers
+    Double_t                fCompactBGPoolBudget;                               // memory budget of each compact BG pool (MB)
+    Bool_t                  fUseMesonPairPrefilter;                             // reject BG pairs with AliConversionMesonCuts::PrefilterPhotonPairs() before building the mother
+    std::vector<AliAODConversionPhoton*> fPairCurrentPhotons;                   //! current photons of the pair loop
+    AliConversionMesonCuts::PhotonArrays fPairPhotons1;                         //! current photon momenta for the pair kernel
+    AliConversionMesonCuts::PhotonArrays fPairPhotons2;                         //! previous photon momenta for the pair kernel
+    std::vector<Int_t>      fPairCandidates;                                    //! index pairs (current, previous) to be processed
 
   private:
     AliAnalysisTaskGammaConvCalo(const AliAnalysisTaskGammaConvCalo&); // Prevent copy-construction
     AliAnalysisTaskGammaConvCalo &operator=(const AliAnalysisTaskGammaConvCalo&); // Prevent assignment
 
-    ClassDef(AliAnalysisTaskGammaConvCalo, 68);
+    ClassDef(AliAnalysisTaskGammaConvCalo, 70);
 };
 
 #endif
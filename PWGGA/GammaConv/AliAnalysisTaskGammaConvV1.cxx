@@ -2237,6 +2237,7 @@ void AliAnalysisTaskGammaConvV1::UserCreateOutputObjects(){
       fOutputContainer->Add(fV0Reader->GetV0FindingEfficiencyHistograms());
 
   if(fV0Reader && fV0Reader->GetProduceImpactParamHistograms())fOutputContainer->Add(fV0Reader->GetImpactParamHistograms());
+  if(fV0Reader && fV0Reader->GetTimingHistograms())fOutputContainer->Add(fV0Reader->GetTimingHistograms());
 
   for(Int_t iCut = 0; iCut<fnCuts;iCut++){
     if(!((AliConvEventCuts*)fEventCutArray->At(iCut))) continue;
@@ -47,7 +47,8 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler() :
 	fBGEvents(),
 	fBGEventsENeg(),
 	fBGEventsMeson(),
-	fBGEventsMCParticle()
+	fBGEventsMCParticle(),
+	fCompactPool(NULL)
 {
 	// constructor
 }
@@ -70,7 +71,8 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(Int_t binsZ,Int_t
 	fBGEvents(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsENeg(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents))),
-	fBGEventsMCParticle(binsZ,AliGammaMCParticleMultipicityVector(binsMultiplicity,AliGammaMCParticleBGEventVector(nEvents)))
+	fBGEventsMCParticle(binsZ,AliGammaMCParticleMultipicityVector(binsMultiplicity,AliGammaMCParticleBGEventVector(nEvents))),
+	fCompactPool(NULL)
 {
 	// constructor
 }
@@ -95,7 +97,8 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(Int_t collisionSy
 	fBGEvents(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsENeg(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents))),
-	fBGEventsMCParticle(binsZ,AliGammaMCParticleMultipicityVector(binsMultiplicity,AliGammaMCParticleBGEventVector(nEvents)))
+	fBGEventsMCParticle(binsZ,AliGammaMCParticleMultipicityVector(binsMultiplicity,AliGammaMCParticleBGEventVector(nEvents))),
+	fCompactPool(NULL)
 {
 	// constructor
     if(fNBinsMultiplicity>5) fNBinsMultiplicity = 5;
@@ -400,7 +403,8 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(const AliGammaCon
 	fBGEvents(original.fBGEvents),
 	fBGEventsENeg(original.fBGEventsENeg),
 	fBGEventsMeson(original.fBGEventsMeson),
-	fBGEventsMCParticle(original.fBGEventsMCParticle)
+	fBGEventsMCParticle(original.fBGEventsMCParticle),
+	fCompactPool(NULL)
 {
 	//copy constructor	
 }
@@ -472,6 +476,29 @@ AliGammaConversionAODBGHandler::~AliGammaConversionAODBGHandler(){
 	if(fBinLimitsArrayMultiplicity){
 		delete[] fBinLimitsArrayMultiplicity;
 	}
+
+	if(fCompactPool){
+		delete fCompactPool;
+		fCompactPool = NULL;
+	}
+}
+
+//_____________________________________________________________________________________________________________________________
+void AliGammaConversionAODBGHandler::SetUseCompactPool(Bool_t useCompact, Double_t memoryBudgetMB){
+	// store only the fields needed for the background mesons in per bin ring buffers
+	// within memoryBudgetMB, instead of full AliAODConversionPhoton copies
+	if(fCompactPool){
+		delete fCompactPool;
+		fCompactPool = NULL;
+	}
+	if(useCompact) fCompactPool = new AliConversionCompactBGPool(fNBinsZ*fNBinsMultiplicity,fNEvents,memoryBudgetMB);
+}
+
+//_____________________________________________________________________________________________________________________________
+Double_t AliGammaConversionAODBGHandler::GetPoolOccupancy(Int_t zbin, Int_t mbin) const{
+	// fraction of the compact ring buffer of the bin in use
+	if(!fCompactPool) return 0.;
+	return fCompactPool->GetOccupancy(zbin*fNBinsMultiplicity+mbin);
 }
 
 //_____________________________________________________________________________________________________________________________
@@ -650,6 +677,12 @@ void AliGammaConversionAODBGHandler::AddEvent(TList* const eventGammas,Double_t
 	fBGEventVertex[z][m][eventCounter].fZ = zvalue;
 	fBGEventVertex[z][m][eventCounter].fEP = epvalue;
 
+	if(fCompactPool){
+		fCompactPool->AddEvent(z*fNBinsMultiplicity+m,eventCounter,eventGammas);
+		fBGEventCounter[z][m]++;
+		return;
+	}
+
 	//first clear the vector
 	// cout<<"Size of vector: "<<fBGEvents[z][m][eventCounter].size()<<endl;
 	//  cout<<"Checking the entries: Z="<<z<<", M="<<m<<", eventCounter="<<eventCounter<<endl;
@@ -792,6 +825,7 @@ void AliGammaConversionAODBGHandler::AddMCParticleEvent(TList* const eventGammas
 //_____________________________________________________________________________________________________________________________
 AliGammaConversionAODVector* AliGammaConversionAODBGHandler::GetBGGoodV0s(Int_t zbin, Int_t mbin, Int_t event){
 	//see headerfile for documentation
+	if(fCompactPool) return fCompactPool->GetEvent(zbin*fNBinsMultiplicity+mbin,event);
 	return &(fBGEvents[zbin][mbin][event]);
 }
 //_____________________________________________________________________________________________________________________________
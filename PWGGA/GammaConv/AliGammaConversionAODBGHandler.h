@@ -21,6 +21,7 @@
 #include "TClonesArray.h"
 #include "AliESDVertex.h"
 #include "AliAODMCParticle.h"
+#include "AliConversionCompactBGPool.h"
 
 typedef std::vector<AliAODConversionPhoton*> AliGammaConversionAODVector;
 typedef std::vector<AliAODConversionMother*> AliGammaConversionMotherAODVector;
@@ -73,6 +74,8 @@ class AliGammaConversionAODBGHandler : public TObject {
         void AddMCParticleEvent(TList* const eventGammas, Double_t xvalue,Double_t yvalue,Double_t zvalue, Int_t multiplicity, Double_t epvalue = -100);
 
 	Int_t GetNBGEvents()const {return fNEvents;}
+	Int_t GetNBinsZ()const {return fNBinsZ;}
+	Int_t GetNBinsMultiplicity()const {return fNBinsMultiplicity;}
 
 	// Get BG photons
 	AliGammaConversionAODVector* GetBGGoodV0s(Int_t zbin, Int_t mbin, Int_t event);
@@ -90,6 +93,12 @@ class AliGammaConversionAODBGHandler : public TObject {
 
 	Double_t GetBGProb(Int_t z, Int_t m){return fBGProbability[z][m];}
 
+	// compact photon pool, to be enabled after the construction of the handler
+	void SetUseCompactPool(Bool_t useCompact, Double_t memoryBudgetMB = 50.);
+	Bool_t GetUseCompactPool() const {return fCompactPool != NULL;}
+	AliConversionCompactBGPool* GetCompactPool() const {return fCompactPool;}
+	Double_t GetPoolOccupancy(Int_t zbin, Int_t mbin) const;
+
 	private:
 
 		Int_t 								fNEvents; 						// number of events
@@ -108,7 +117,8 @@ class AliGammaConversionAODBGHandler : public TObject {
 		AliGammaConversionBGVector 			fBGEventsENeg; 					// electron background electron events
 		AliGammaConversionMotherBGVector                fBGEventsMeson; 				// neutral meson background events
 		AliAODMCParticleBGVector 	                fBGEventsMCParticle; 				// MC Particle background events
+		AliConversionCompactBGPool*			fCompactPool;					//! compact photon background events, replaces fBGEvents if set
 		
-	ClassDef(AliGammaConversionAODBGHandler,8)
+	ClassDef(AliGammaConversionAODBGHandler,9)
 };
 #endif
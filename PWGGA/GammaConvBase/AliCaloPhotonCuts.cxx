@@ -59,7 +59,9 @@
 #include "AliCaloTrackMatcher.h"
 #include "AliCaloTriggerMimicHelper.h"
 #include "AliPhotonIsolation.h"
+#include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 class iostream;
@@ -68,6 +70,55 @@ using namespace std;
 
 ClassImp(AliCaloPhotonCuts)
 
+namespace {
+  // Per event cache of the cluster selection stages, shared by all the AliCaloPhotonCuts
+  // instances of a train which use SetUseSharedSelectionCache(). The results are stored
+  // under a key built from the sub-cuts they depend on (see AliCaloPhotonCuts::GetSubCutKey)
+  struct ClusterStageValue {
+    Float_t fE;         // cluster energy when the value was computed
+    Int_t   fNCells;    // number of cells of the cluster
+    Float_t fValue;
+    Int_t   fResult;
+  };
+
+  struct SharedSelectionCache {
+    const AliVEvent* fEvent;
+    Long64_t  fEntry;
+    Int_t     fRun;
+    Int_t     fNClusters;
+    Int_t     fNTracks;
+    std::map<std::string, std::vector<Int_t> > fMatchedClusterIDs;
+    std::map<std::string, std::map<Int_t, ClusterStageValue> > fClusterValues;
+    ULong64_t fNLookups;
+    ULong64_t fNHits;
+
+    SharedSelectionCache() : fEvent(0x0), fEntry(-1), fRun(-1), fNClusters(-1), fNTracks(-1),
+                             fMatchedClusterIDs(), fClusterValues(), fNLookups(0), fNHits(0) {}
+
+    // clear the cache when a new event is processed, kFALSE if the event cannot be identified
+    Bool_t CheckEvent(const AliVEvent* event) {
+      AliAnalysisManager* mgr = AliAnalysisManager::GetAnalysisManager();
+      if (!event || !mgr) return kFALSE;
+      Long64_t entry = mgr->GetCurrentEntry();
+      if (event == fEvent && entry == fEntry && event->GetRunNumber() == fRun &&
+          event->GetNumberOfCaloClusters() == fNClusters && event->GetNumberOfTracks() == fNTracks) return kTRUE;
+      fEvent     = event;
+      fEntry     = entry;
+      fRun       = event->GetRunNumber();
+      fNClusters = event->GetNumberOfCaloClusters();
+      fNTracks   = event->GetNumberOfTracks();
+      fMatchedClusterIDs.clear();
+      fClusterValues.clear();
+      return kTRUE;
+    }
+  };
+
+  SharedSelectionCache& GetSharedSelectionCache() {
+    static SharedSelectionCache cache;
+    return cache;
+  }
+}
+
 
 const char* AliCaloPhotonCuts::fgkCutNames[AliCaloPhotonCuts::kNCuts] = {
   "ClusterType",          //0    0: all,    1: EMCAL,   2: PHOS
@@ -121,6 +172,7 @@ AliCaloPhotonCuts::AliCaloPhotonCuts(Int_t isMC, const char *name,const char *ti
   fV0ReaderName("V0ReaderV1"),
   fCorrTaskSetting(""),
   fCaloTrackMatcherName("CaloTrackMatcher_1_0"),
+  fUseSharedSelectionCache(kFALSE),
   fCaloTriggerMimicHelperName("none"),
   fCaloIsolationName("PhotonIsolation"),
   fPeriodName(""),
@@ -358,6 +410,7 @@ AliCaloPhotonCuts::AliCaloPhotonCuts(const AliCaloPhotonCuts &ref) :
   fV0ReaderName(ref.fV0ReaderName),
   fCorrTaskSetting(ref.fCorrTaskSetting),
   fCaloTrackMatcherName(ref.fCaloTrackMatcherName),
+  fUseSharedSelectionCache(ref.fUseSharedSelectionCache),
   fCaloTriggerMimicHelperName(ref.fCaloTriggerMimicHelperName),
   fCaloIsolationName("PhotonIsolation"),
   fPeriodName(ref.fPeriodName),
@@ -2284,7 +2337,7 @@ Bool_t AliCaloPhotonCuts::ClusterQualityCuts(AliVCluster* cluster, AliVEvent *ev
   if (phiCluster < 0) phiCluster += 2*TMath::Pi();
 
 
-  Int_t nLM = GetNumberOfLocalMaxima(cluster, event);
+  Int_t nLM = GetNumberOfLocalMaximaCached(cluster, event);
 //   Int_t nLMGustavo = fEMCALCaloUtils->GetNumberOfLocalMaxima(cluster, event->GetEMCALCells()) ;
 //   cout << "mine: " << nLM << "\t Gustavo: " << nLMGustavo << endl;
 
@@ -2357,7 +2410,7 @@ Bool_t AliCaloPhotonCuts::ClusterQualityCuts(AliVCluster* cluster, AliVEvent *ev
 
   // exotic cluster cut
   Float_t energyStar      = 0;
-  if(fUseExoticCluster && IsExoticCluster(cluster, event, energyStar)){
+  if(fUseExoticCluster && IsExoticClusterCached(cluster, event, energyStar)){
     if(fHistClusterIdentificationCuts)fHistClusterIdentificationCuts->Fill(cutIndex, cluster->E());//3
     if (fDoExoticsQA){
       // replay cuts
@@ -4282,6 +4335,21 @@ void AliCaloPhotonCuts::MatchElectronTracksToClusters(AliVEvent* event, AliMCEve
     //nModules = fGeomPHOS->GetNModules();
   }
 
+  // take the matched clusters from an instance with the same track matching sub-cuts, if already done in this event
+  std::string sharedKey;
+  if(fUseSharedSelectionCache && !fUseTMMIPsubtraction && GetSharedSelectionCache().CheckEvent(event)){
+    const Int_t tmIds[2] = {kClusterType, kTrackMatching};
+    sharedKey = Form("%s_%d_%s_%s", GetSubCutKey("TM", 2, tmIds).Data(), (Int_t)isEMCalOnly, fCorrTaskSetting.Data(), fCaloTrackMatcherName.Data());
+    SharedSelectionCache& cache = GetSharedSelectionCache();
+    cache.fNLookups++;
+    std::map<std::string, std::vector<Int_t> >::const_iterator it = cache.fMatchedClusterIDs.find(sharedKey);
+    if(it != cache.fMatchedClusterIDs.end() && CanShareTrackMatching(isEMCalOnly)){
+      cache.fNHits++;
+      fVectorMatchedClusterIDs = it->second;
+      return;
+    }
+  }
+
   AliESDEvent *esdev = dynamic_cast<AliESDEvent*>(event);
   AliAODEvent *aodev = 0;
   if (!esdev) {
@@ -4606,6 +4674,86 @@ void AliCaloPhotonCuts::MatchTracksToClusters(AliVEvent* event, Double_t weight,
       }
     }
   }
+  if(!sharedKey.empty()) GetSharedSelectionCache().fMatchedClusterIDs[sharedKey] = fVectorMatchedClusterIDs;
+}
+
+//________________________________________________________________________
+Bool_t AliCaloPhotonCuts::CanShareTrackMatching(Bool_t isEMCalOnly) const {
+  // the matched clusters can be taken from the cache only if no histogram is filled in MatchTracksToClusters
+  if(fHistMatchedTrackPClusE || fHistMatchedTrackPClusEAfterEOverPVeto || fHistMatchedTrackPClusETruePi0Clus) return kFALSE;
+  if(!isEMCalOnly) return kTRUE;
+  if(!fDoLightOutput && (fExtendedMatchAndQA == 1 || fExtendedMatchAndQA == 3 || fExtendedMatchAndQA == 5)) return kFALSE;
+  if(fHistDistanceTrackToClusterBeforeQA || fHistClusterdEtadPhiBeforeQA || fHistClusterRBeforeQA) return kFALSE;
+  if(fHistClusterdEtadPtAfterQA || fHistClusterdPhidPtAfterQA) return kFALSE;
+  if(fHistDistanceTrackToClusterAfterQA || fHistClusterdEtadPhiAfterQA || fHistClusterRAfterQA) return kFALSE;
+  return kTRUE;
+}
+
+//________________________________________________________________________
+TString AliCaloPhotonCuts::GetSubCutKey(const char* stage, Int_t nIds, const Int_t* ids) const {
+  // key of a selection stage in the shared cache: the stage name followed by the digits of the sub-cuts it depends on
+  TString key(stage);
+  key += "_";
+  for(Int_t i=0; i<nIds; i++) key += Form("%c", fCuts[ids[i]]<10 ? '0'+fCuts[ids[i]] : 'a'+fCuts[ids[i]]-10);
+  return key;
+}
+
+//________________________________________________________________________
+Bool_t AliCaloPhotonCuts::IsExoticClusterCached(AliVCluster *cluster, AliVEvent *event, Float_t &energyStar){
+  // IsExoticCluster(), evaluated once per cluster and exotics sub-cut in the event
+  if(!fUseSharedSelectionCache || !cluster || fUseExoticCluster == 3 || !GetSharedSelectionCache().CheckEvent(event))
+    return IsExoticCluster(cluster, event, energyStar);
+
+  const Int_t exoIds[2] = {kClusterType, kExoticCluster};
+  TString key = Form("%s_%g_%g_%g_%s", GetSubCutKey("Exotic", 2, exoIds).Data(), fExoticEnergyFracCluster, fExoticMinEnergyTCard, fExoticMinEnergyCell, fCorrTaskSetting.Data());
+  SharedSelectionCache& cache = GetSharedSelectionCache();
+  std::map<Int_t, ClusterStageValue>& values = cache.fClusterValues[key.Data()];
+  cache.fNLookups++;
+  std::map<Int_t, ClusterStageValue>::const_iterator it = values.find(cluster->GetID());
+  if(it != values.end() && it->second.fE == cluster->E() && it->second.fNCells == cluster->GetNCells()){
+    cache.fNHits++;
+    energyStar = it->second.fValue;
+    return it->second.fResult;
+  }
+  Bool_t isExotic = IsExoticCluster(cluster, event, energyStar);
+  ClusterStageValue& value = values[cluster->GetID()];
+  value.fE      = cluster->E();
+  value.fNCells = cluster->GetNCells();
+  value.fValue  = energyStar;
+  value.fResult = isExotic;
+  return isExotic;
+}
+
+//________________________________________________________________________
+Int_t AliCaloPhotonCuts::GetNumberOfLocalMaximaCached(AliVCluster* cluster, AliVEvent * event){
+  // GetNumberOfLocalMaxima(), evaluated once per cluster and cluster type in the event
+  if(!fUseSharedSelectionCache || !GetSharedSelectionCache().CheckEvent(event))
+    return GetNumberOfLocalMaxima(cluster, event);
+
+  const Int_t nlmIds[1] = {kClusterType};
+  TString key = Form("%s_%g_%s", GetSubCutKey("NLM", 1, nlmIds).Data(), fLocMaxCutEDiff, fCorrTaskSetting.Data());
+  SharedSelectionCache& cache = GetSharedSelectionCache();
+  std::map<Int_t, ClusterStageValue>& values = cache.fClusterValues[key.Data()];
+  cache.fNLookups++;
+  std::map<Int_t, ClusterStageValue>::const_iterator it = values.find(cluster->GetID());
+  if(it != values.end() && it->second.fNCells == cluster->GetNCells()){ // the NLM does not depend on the cluster energy
+    cache.fNHits++;
+    return it->second.fResult;
+  }
+  Int_t nLM = GetNumberOfLocalMaxima(cluster, event);
+  ClusterStageValue& value = values[cluster->GetID()];
+  value.fE      = cluster->E();
+  value.fNCells = cluster->GetNCells();
+  value.fValue  = 0.;
+  value.fResult = nLM;
+  return nLM;
+}
+
+//________________________________________________________________________
+void AliCaloPhotonCuts::GetSharedSelectionCacheStatistics(ULong64_t &nLookups, ULong64_t &nHits){
+  // number of look ups and hits of the shared selection cache since the start of the job
+  nLookups = GetSharedSelectionCache().fNLookups;
+  nHits    = GetSharedSelectionCache().fNHits;
 }
 
 //________________________________________________________________________
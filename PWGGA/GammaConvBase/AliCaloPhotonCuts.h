@@ -302,6 +302,9 @@ class AliCaloPhotonCuts : public AliAnalysisCuts {
     void        SetCaloTrackMatcherName(TString name)          {fCaloTrackMatcherName = name; return;}
     void        SetCaloTriggerMimicHelperName(TString name)    {fCaloTriggerMimicHelperName = name; return;}
     void        SetCaloIsolationName(TString name)             {fCaloIsolationName = name; return;}
+    // share the track matching, exotics and NLM results with the other instances that have the same sub-cuts
+    void        SetUseSharedSelectionCache(Bool_t flag)        {fUseSharedSelectionCache = flag; return;}
+    static void GetSharedSelectionCacheStatistics(ULong64_t &nLookups, ULong64_t &nHits);
     MCSet       FindEnumForMCSet(TString namePeriod);
 
     void        ApplyNonLinearity(AliVCluster* cluster, Int_t isMC, AliVEvent *event = 0x0);
@@ -377,6 +380,10 @@ class AliCaloPhotonCuts : public AliAnalysisCuts {
     Bool_t      CheckClusterForTrackMatch(AliVCluster* cluster);
     Int_t       GetNumberOfLocalMaxima(AliVCluster* cluster, AliVEvent * event);
     Int_t       GetNumberOfLocalMaxima(AliVCluster* cluster, AliVEvent * event,  Int_t *absCellIdList, Float_t* maxEList);
+    Int_t       GetNumberOfLocalMaximaCached(AliVCluster* cluster, AliVEvent * event);
+    Bool_t      IsExoticClusterCached(AliVCluster *cluster, AliVEvent *event, Float_t &energyStar);
+    Bool_t      CanShareTrackMatching(Bool_t isEMCalOnly) const;
+    TString     GetSubCutKey(const char* stage, Int_t nIds, const Int_t* ids) const;
     Bool_t      AreNeighbours(Int_t absCellId1, Int_t absCellId2);
     Int_t       GetModuleNumberAndCellPosition(Int_t absCellId, Int_t & icol, Int_t & irow);
     void        SplitEnergy(Int_t absCellId1, Int_t absCellId2, AliVCluster* cluster, AliVEvent* event,
@@ -506,6 +513,7 @@ class AliCaloPhotonCuts : public AliAnalysisCuts {
     TString   fV0ReaderName;                            // Name of V0Reader
     TString   fCorrTaskSetting;                         // Name of Correction Task Setting
     TString   fCaloTrackMatcherName;                    // Name of global TrackMatching instance
+    Bool_t    fUseSharedSelectionCache;                 // use the per event selection cache shared by the instances with the same sub-cuts
     TString   fCaloTriggerMimicHelperName;              // Name of global TriggerMimicHelper instance
     TString   fCaloIsolationName;                       // Name of global Isolation instance
     TString   fPeriodName;                              // PeriodName of MC
@@ -734,7 +742,7 @@ class AliCaloPhotonCuts : public AliAnalysisCuts {
 
   private:
 
-    ClassDef(AliCaloPhotonCuts,121)
+    ClassDef(AliCaloPhotonCuts,122)
 };
 
 #endif
@@ -213,7 +213,8 @@ AliConvEventCuts::AliConvEventCuts(const char *name,const char *title) :
   hReweightMultData(NULL),
   hReweightMultMC(NULL),
   fPHOSTrigger(kPHOSAny),
-  fDebugLevel(0)
+  fDebugLevel(0),
+  fRunState()
 {
   for(Int_t jj=0;jj<kNCuts;jj++){fCuts[jj]=0;}
   fCutString=new TObjString((GetCutNumber()).Data());
@@ -357,7 +358,8 @@ AliConvEventCuts::AliConvEventCuts(const AliConvEventCuts &ref) :
   hReweightMultData(ref.hReweightMultData),
   hReweightMultMC(ref.hReweightMultMC),
   fPHOSTrigger(kPHOSAny),
-  fDebugLevel(ref.fDebugLevel)
+  fDebugLevel(ref.fDebugLevel),
+  fRunState()
 {
   // Copy Constructor
   for(Int_t jj=0;jj<kNCuts;jj++){fCuts[jj]=ref.fCuts[jj];}
@@ -5635,6 +5637,380 @@ Bool_t AliConvEventCuts::MimicTrigger(AliVEvent *event, Bool_t isMC ){
   return kFALSE;
 }
 
+///________________________________________________________________________
+// resolve the trigger settings which do not change within a run:
+// the trigger overlap rejection becomes a mask of offline trigger bits and
+// lists of fired trigger classes, the special sub trigger name is split
+// in its classes, so that IsTriggerSelected() does not parse them per event
+void AliConvEventCuts::InitializeRunState(Int_t runNumber){
+
+  fRunState = RunState();
+  fRunState.fRunNumber = runNumber;
+
+  fRunState.fSubTriggerNameShort           = fSpecialSubTriggerName(0,4);
+  fRunState.fSubTriggerNameAdditionalShort = fSpecialSubTriggerNameAdditional(0,4);
+
+  // classes for the centrality dependent trigger selection, fSpecialSubTrigger == 1
+  fRunState.fSubTriggerCentOr = fSpecialSubTriggerName.Contains("|");
+  const char separators[3] = {'%','@','&'};
+  for (Int_t i = 0; i < 3 && !fRunState.fSubTriggerSeparator; i++){
+    if (fSpecialSubTriggerName.First(separators[i]) != kNPOS) fRunState.fSubTriggerSeparator = separators[i];
+  }
+  if (fRunState.fSubTriggerCentOr){
+    TObjArray *ClassesList = fSpecialSubTriggerName.Tokenize("|");
+    for (Int_t i=0; i<ClassesList->GetEntriesFast();++i)
+      fRunState.fSubTriggerCentClasses.push_back(((TObjString*)ClassesList->At(i))->GetString());
+    delete ClassesList;
+  }
+  if (fRunState.fSubTriggerSeparator){
+    TObjArray *ClassesList = fSpecialSubTriggerName.Tokenize(TString(fRunState.fSubTriggerSeparator));
+    for (Int_t i=0; i<ClassesList->GetEntriesFast();++i)
+      fRunState.fSubTriggerClasses.push_back(((TObjString*)ClassesList->At(i))->GetString());
+    delete ClassesList;
+  }
+
+  if (!fRejectTriggerOverlap) return;
+
+    // trigger rejection EMC1,7,8
+    if (fSpecialTrigger == 5){
+      if(fNSpecialSubTriggerOptions==2){
+        // trigger rejection for EMC and DMC triggers together
+        if (fSpecialSubTriggerName.CompareTo("CEMC7") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("CDMC7") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT7;
+        } else if (fSpecialSubTriggerName.CompareTo("CEMC8") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("CDMC8") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT8;
+        }
+      } else {
+        // separate rejection for EMC and DMC triggers
+        if( fSpecialSubTriggerName.CompareTo("CEMC7") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT7;
+        } else if (fSpecialSubTriggerName.CompareTo("CEMC1") == 0){
+          fRunState.fRejectMask |= AliVEvent::kMB;
+        } else if (fSpecialSubTriggerName.CompareTo("CEMC8") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT8;
+        } else if (fSpecialSubTriggerName.CompareTo("CDMC7") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT7;
+        } else if (fSpecialSubTriggerName.CompareTo("CDMC1") == 0){
+          fRunState.fRejectMask |= AliVEvent::kMB;
+        } else if (fSpecialSubTriggerName.CompareTo("CDMC8") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT8;
+        }
+      }
+    }
+    // gamma triggers -> no overlap with L0 and MB trigger required
+    if (fSpecialTrigger == 6){
+         if( fSpecialSubTriggerName.CompareTo("CPHI7") == 0){
+             fRunState.fRejectMask |= AliVEvent::kINT7;
+         } else if( fSpecialSubTriggerName.CompareTo("CPHI8") == 0){
+             fRunState.fRejectMask |= AliVEvent::kINT8;
+         }
+    }
+    if (fSpecialTrigger == 8){
+      // trigger rejection EGA
+      if( fSpecialSubTriggerName.CompareTo("7EGA") == 0){
+        fRunState.fRejectMask |= AliVEvent::kINT7;
+        fRunState.fRejectMask |= AliVEvent::kEMC7;
+      } else if (fSpecialSubTriggerName.CompareTo("8EGA") == 0){
+        fRunState.fRejectMask |= AliVEvent::kINT8;
+        fRunState.fRejectMask |= AliVEvent::kEMC7;
+      } else if (fSpecialSubTriggerName.CompareTo("7DGA") == 0){
+        fRunState.fRejectMask |= AliVEvent::kINT7;
+        fRunState.fRejectMask |= AliVEvent::kEMC7;
+      } else if (fSpecialSubTriggerName.CompareTo("8DGA") == 0){
+        fRunState.fRejectMask |= AliVEvent::kINT8;
+        fRunState.fRejectMask |= AliVEvent::kEMC7;
+      }
+      // trigger rejection EG1 & EG2
+      // EG1 is the trigger with the highest threshold
+      if(fNSpecialSubTriggerOptions==2){
+        // trigger rejection for EMC and DMC triggers together
+        if ((fSpecialSubTriggerName.CompareTo("7EG1") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DG1") == 0)
+            || (fSpecialSubTriggerName.CompareTo("7EG1_EGA_sw") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DG1_EGA_sw") == 0)
+          ){
+          fRunState.fRejectMask |= AliVEvent::kINT7;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          fRunState.fRejectClasses.push_back("7EG2");
+          fRunState.fRejectClasses.push_back("7DG2");
+          if(fMimicTrigger == 2){
+            fRunState.fMimicDecisions.push_back("EG1");
+            fRunState.fMimicDecisions.push_back("DG1");
+          }
+        } else if ((fSpecialSubTriggerName.CompareTo("8EG1") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("8DG1") == 0)
+            || (fSpecialSubTriggerName.CompareTo("7EG1_EGA_sw") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DG1_EGA_sw") == 0)
+          ){
+          fRunState.fRejectMask |= AliVEvent::kINT8;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          fRunState.fRejectClasses.push_back("8EG2");
+          fRunState.fRejectClasses.push_back("8DG2");
+          if(fMimicTrigger == 2){
+            fRunState.fMimicDecisions.push_back("EG1");
+            fRunState.fMimicDecisions.push_back("DG1");
+          }
+        } else if ((fSpecialSubTriggerName.CompareTo("7EG2") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DG2") == 0)
+            || (fSpecialSubTriggerName.CompareTo("7EG2_EGA_sw") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DG2_EGA_sw") == 0)
+          ){
+          fRunState.fRejectMask |= AliVEvent::kINT7;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          if(fMimicTrigger == 2){
+            fRunState.fMimicDecisions.push_back("EG2");
+            fRunState.fMimicDecisions.push_back("DG2");
+          }
+        } else if ((fSpecialSubTriggerName.CompareTo("8EG2") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("8DG2") == 0)
+            || (fSpecialSubTriggerName.CompareTo("7EG2_EGA_sw") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DG2_EGA_sw") == 0)
+          ){
+          fRunState.fRejectMask |= AliVEvent::kINT7;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          if(fMimicTrigger == 2){
+            fRunState.fMimicDecisions.push_back("EG2");
+            fRunState.fMimicDecisions.push_back("DG2");
+          }
+        }
+      } else {
+        // separate rejection for EMC and DMC triggers
+        if (fSpecialSubTriggerName.CompareTo("7EG1") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT7;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          fRunState.fRejectClasses.push_back("7EG2");
+          if(fMimicTrigger == 2){
+            fRunState.fMimicDecisions.push_back("EG1");
+          }
+        } else if (fSpecialSubTriggerName.CompareTo("8EG1") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT8;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          fRunState.fRejectClasses.push_back("8EG2");
+          if(fMimicTrigger == 2){
+            fRunState.fMimicDecisions.push_back("EG1");
+          }
+        } else if (fSpecialSubTriggerName.CompareTo("7EG2") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT7;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          if(fMimicTrigger == 2){
+            fRunState.fMimicDecisions.push_back("EG2");
+          }
+        } else if (fSpecialSubTriggerName.CompareTo("8EG2") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT7;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          if(fMimicTrigger == 2){
+            fRunState.fMimicDecisions.push_back("EG2");
+          }
+        } else if (fSpecialSubTriggerName.CompareTo("7DG1") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT7;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          fRunState.fRejectClasses.push_back("7DG2");
+          if(fMimicTrigger == 2){
+            fRunState.fMimicDecisions.push_back("DG1");
+          }
+        } else if (fSpecialSubTriggerName.CompareTo("8DG1") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT8;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          fRunState.fRejectClasses.push_back("8DG2");
+          if(fMimicTrigger == 2){
+            fRunState.fMimicDecisions.push_back("DG1");
+          }
+        } else if (fSpecialSubTriggerName.CompareTo("7DG2") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT7;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          if(fMimicTrigger == 2){
+            fRunState.fMimicDecisions.push_back("DG2");
+          }
+        } else if (fSpecialSubTriggerName.CompareTo("8DG2") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT8;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          if(fMimicTrigger == 2){
+            fRunState.fMimicDecisions.push_back("DG2");
+          }
+        }
+      }
+    }
+    // jet triggers -> no overlap with gamma trigger and lower triggers required
+    if (fSpecialTrigger == 9){
+      if(fNSpecialSubTriggerOptions==2){
+        // trigger rejection for EMC and DMC triggers together
+        if (fSpecialSubTriggerName.CompareTo("7EJ1") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DJ1") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT7;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          fRunState.fRejectClasses.push_back("7EG2");
+          fRunState.fRejectClasses.push_back("7EG1");
+          fRunState.fRejectClasses.push_back("7EJ2");
+          fRunState.fRejectClasses.push_back("7DG2");
+          fRunState.fRejectClasses.push_back("7DG1");
+          fRunState.fRejectClasses.push_back("7DJ2");
+        } else if (fSpecialSubTriggerName.CompareTo("7EJ2") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DJ2") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT7;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          fRunState.fRejectClasses.push_back("7EG2");
+          fRunState.fRejectClasses.push_back("7EG1");
+          fRunState.fRejectClasses.push_back("7DG2");
+          fRunState.fRejectClasses.push_back("7DG1");
+        }
+      } else {
+        // separate rejection for EMC and DMC triggers
+        if( fSpecialSubTriggerName.CompareTo("7EJE") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT7;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          fRunState.fRejectClasses.push_back("7EGA");
+        } else if (fSpecialSubTriggerName.CompareTo("8EJE") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT8;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          fRunState.fRejectClasses.push_back("8EGA");
+        } else if (fSpecialSubTriggerName.CompareTo("7EJ1") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT7;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          fRunState.fRejectClasses.push_back("7EG2");
+          fRunState.fRejectClasses.push_back("7EG1");
+          fRunState.fRejectClasses.push_back("7EJ2");
+        } else if (fSpecialSubTriggerName.CompareTo("8EJ1") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT8;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          fRunState.fRejectClasses.push_back("8EG2");
+          fRunState.fRejectClasses.push_back("8EG1");
+          fRunState.fRejectClasses.push_back("8EJ2");
+        } else   if (fSpecialSubTriggerName.CompareTo("7EJ2") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT7;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          fRunState.fRejectClasses.push_back("7EG2");
+          fRunState.fRejectClasses.push_back("7EG1");
+        } else   if (fSpecialSubTriggerName.CompareTo("8EJ2") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT8;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          fRunState.fRejectClasses.push_back("8EG2");
+          fRunState.fRejectClasses.push_back("8EG1");
+        } else if (fSpecialSubTriggerName.CompareTo("7DJ1") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT7;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          fRunState.fRejectClasses.push_back("7DG1");
+          fRunState.fRejectClasses.push_back("7DG2");
+          fRunState.fRejectClasses.push_back("7DJ2");
+        } else if (fSpecialSubTriggerName.CompareTo("8DJ1") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT8;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          fRunState.fRejectClasses.push_back("8DG1");
+          fRunState.fRejectClasses.push_back("8DG2");
+          fRunState.fRejectClasses.push_back("8DJ2");
+        } else if (fSpecialSubTriggerName.CompareTo("7DJ2") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT7;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          fRunState.fRejectClasses.push_back("7DG2");
+          fRunState.fRejectClasses.push_back("7DG1");
+        } else if (fSpecialSubTriggerName.CompareTo("8DG2") == 0){
+          fRunState.fRejectMask |= AliVEvent::kINT7;
+          fRunState.fRejectMask |= AliVEvent::kEMC7;
+          fRunState.fRejectClasses.push_back("8DG2");
+          fRunState.fRejectClasses.push_back("8DG1");
+        }
+      }
+    }
+    if (fSpecialTrigger == 10){
+      if(fNSpecialSubTriggerOptions==2){
+        // trigger rejection for EMC and DMC triggers together
+        if (fSpecialSubTriggerName.CompareTo("7EJ1") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DJ1") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT7-");
+          fRunState.fRejectClassesCaloOnly.push_back("EMC7-");
+          fRunState.fRejectClassesCaloOnly.push_back("DMC7-");
+          fRunState.fRejectClassesCaloOnly.push_back("7EG2");
+          fRunState.fRejectClassesCaloOnly.push_back("7EG1");
+          fRunState.fRejectClassesCaloOnly.push_back("7EJ2");
+          fRunState.fRejectClassesCaloOnly.push_back("7DG2");
+          fRunState.fRejectClassesCaloOnly.push_back("7DG1");
+          fRunState.fRejectClassesCaloOnly.push_back("7DJ2");
+        } else if (fSpecialSubTriggerName.CompareTo("7EJ2") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DJ2") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT7-");
+          fRunState.fRejectClassesCaloOnly.push_back("EMC7-");
+          fRunState.fRejectClassesCaloOnly.push_back("DMC7-");
+          fRunState.fRejectClassesCaloOnly.push_back("7EG2");
+          fRunState.fRejectClassesCaloOnly.push_back("7EG1");
+          fRunState.fRejectClassesCaloOnly.push_back("7DG2");
+          fRunState.fRejectClassesCaloOnly.push_back("7DG1");
+        }
+        // trigger rejection for EMC and DMC triggers together
+        if (fSpecialSubTriggerName.CompareTo("7EG1") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DG1") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT7-");
+          fRunState.fRejectClassesCaloOnly.push_back("EMC7-");
+          fRunState.fRejectClassesCaloOnly.push_back("DMC7-");
+          fRunState.fRejectClassesCaloOnly.push_back("7EG2");
+          fRunState.fRejectClassesCaloOnly.push_back("7DG2");
+        } else if (fSpecialSubTriggerName.CompareTo("8EG1") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("8DG1") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT8-");
+          fRunState.fRejectClassesCaloOnly.push_back("EMC8-");
+          fRunState.fRejectClassesCaloOnly.push_back("DMC8-");
+          fRunState.fRejectClassesCaloOnly.push_back("8EG2");
+          fRunState.fRejectClassesCaloOnly.push_back("8DG2");
+        } else if (fSpecialSubTriggerName.CompareTo("7EG2") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DG2") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT7-");
+          fRunState.fRejectClassesCaloOnly.push_back("EMC7-");
+          fRunState.fRejectClassesCaloOnly.push_back("DMC7-");
+        } else if (fSpecialSubTriggerName.CompareTo("8EG2") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("8DG2") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT8-");
+          fRunState.fRejectClassesCaloOnly.push_back("EMC8-");
+          fRunState.fRejectClassesCaloOnly.push_back("DMC8-");
+        }
+      } else {
+        // trigger rejection L0 triggers
+        if (fSpecialSubTriggerName.CompareTo("CEMC7-") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT7-");
+        } else if (fSpecialSubTriggerName.CompareTo("CEMC1-") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT1-");
+        } else if (fSpecialSubTriggerName.CompareTo("CEMC8-") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT8-");
+        } else if (fSpecialSubTriggerName.CompareTo("CDMC7-") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT7-");
+        } else if (fSpecialSubTriggerName.CompareTo("CDMC1-") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT1-");
+        } else if (fSpecialSubTriggerName.CompareTo("CDMC8-") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT8-");
+        }
+        // trigger rejection EGA
+        if (fSpecialSubTriggerName.CompareTo("7EGA") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT7-");
+          fRunState.fRejectClassesCaloOnly.push_back("EMC7-");
+        } else if (fSpecialSubTriggerName.CompareTo("8EGA") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT8-");
+          fRunState.fRejectClassesCaloOnly.push_back("EMC8-");
+        } else if (fSpecialSubTriggerName.CompareTo("7DGA") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT7-");
+          fRunState.fRejectClassesCaloOnly.push_back("EMC7-");
+        } else if (fSpecialSubTriggerName.CompareTo("8DGA") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT8-");
+          fRunState.fRejectClassesCaloOnly.push_back("EMC8-");
+        }
+        // trigger rejection L1 triggers
+        if(fSpecialSubTriggerName.CompareTo("7EG1") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT7-");
+          fRunState.fRejectClassesCaloOnly.push_back("EMC7-");
+          fRunState.fRejectClassesCaloOnly.push_back("7EG2");
+        } else if (fSpecialSubTriggerName.CompareTo("8EG1") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT8-");
+          fRunState.fRejectClassesCaloOnly.push_back("EMC8-");
+          fRunState.fRejectClassesCaloOnly.push_back("8EG2");
+        } else if (fSpecialSubTriggerName.CompareTo("7EG2") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT7-");
+          fRunState.fRejectClassesCaloOnly.push_back("EMC7-");
+        } else if (fSpecialSubTriggerName.CompareTo("8EG2") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT8-");
+          fRunState.fRejectClassesCaloOnly.push_back("EMC8-");
+        } else if (fSpecialSubTriggerName.CompareTo("7DG1") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT7-");
+          fRunState.fRejectClassesCaloOnly.push_back("DMC7-");
+          fRunState.fRejectClassesCaloOnly.push_back("7DG2");
+        } else if (fSpecialSubTriggerName.CompareTo("8DG1") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT8-");
+          fRunState.fRejectClassesCaloOnly.push_back("DMC8-");
+          fRunState.fRejectClassesCaloOnly.push_back("8DG2");
+        } else if (fSpecialSubTriggerName.CompareTo("7DG2") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT7-");
+          fRunState.fRejectClassesCaloOnly.push_back("DMC7-");
+        } else if (fSpecialSubTriggerName.CompareTo("8DG2") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT7-");
+          fRunState.fRejectClassesCaloOnly.push_back("DMC8-");
+        }
+        // trigger rejection PHOS triggers
+        if (fSpecialSubTriggerName.CompareTo("CPHI7-") == 0){
+          fRunState.fRejectClassesCaloOnly.push_back("INT7-");
+        }
+      }
+    }
+}
+
 //________________________________________________________________________
 Bool_t AliConvEventCuts::IsTriggerSelected(AliVEvent *event, Bool_t isMC)
 {
@@ -5645,6 +6021,7 @@ Bool_t AliConvEventCuts::IsTriggerSelected(AliVEvent *event, Bool_t isMC)
   UInt_t isSelected = AliVEvent::kAny;
 
   if (fInputHandler==NULL) return kFALSE;
+  if (fRunState.fRunNumber != event->GetRunNumber()) InitializeRunState(event->GetRunNumber());
   if( fInputHandler->GetEventSelection() || event->IsA()==AliAODEvent::Class()) {
 
     TString firedTrigClass = event->GetFiredTriggerClasses();
@@ -5700,7 +6077,7 @@ Bool_t AliConvEventCuts::IsTriggerSelected(AliVEvent *event, Bool_t isMC)
         if (fSpecialSubTrigger>0 && !isMC){
           if(fNSpecialSubTriggerOptions==2){ // in case two special triggers are available
             if (fSpecialTrigger == 13 || fSpecialTrigger == 14) {
-              if(!firedTrigClass.Contains(((TString)fSpecialSubTriggerName(0,4)).Data()) && !firedTrigClass.Contains(((TString)fSpecialSubTriggerNameAdditional(0,4)).Data())){
+              if(!firedTrigClass.Contains(fRunState.fSubTriggerNameShort) && !firedTrigClass.Contains(fRunState.fSubTriggerNameAdditionalShort)){
                 isSelected = 0;
               }
             } else {
@@ -5710,351 +6087,23 @@ Bool_t AliConvEventCuts::IsTriggerSelected(AliVEvent *event, Bool_t isMC)
             if (!firedTrigClass.Contains(fSpecialSubTriggerName.Data())) isSelected = 0;
           }
           if (fRejectTriggerOverlap){
-            // trigger rejection EMC1,7,8
-            if (fSpecialTrigger == 5){
-              if(fNSpecialSubTriggerOptions==2){
-                // trigger rejection for EMC and DMC triggers together
-                if (fSpecialSubTriggerName.CompareTo("CEMC7") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("CDMC7") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("CEMC8") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("CDMC8") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT8) isSelected = 0;
-                }
-              } else {
-                // separate rejection for EMC and DMC triggers
-                if( fSpecialSubTriggerName.CompareTo("CEMC7") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("CEMC1") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kMB) isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("CEMC8") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT8) isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("CDMC7") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("CDMC1") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kMB) isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("CDMC8") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT8) isSelected = 0;
-                }
-              }
-            }
-            // gamma triggers -> no overlap with L0 and MB trigger required
-            if (fSpecialTrigger == 6){
-                 if( fSpecialSubTriggerName.CompareTo("CPHI7") == 0){
-                     if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                 } else if( fSpecialSubTriggerName.CompareTo("CPHI8") == 0){
-                     if (fInputHandler->IsEventSelected() & AliVEvent::kINT8) isSelected = 0;
-                 }
-            }
-            if (fSpecialTrigger == 8){
-              // trigger rejection EGA
-              if( fSpecialSubTriggerName.CompareTo("7EGA") == 0){
-                if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-              } else if (fSpecialSubTriggerName.CompareTo("8EGA") == 0){
-                if (fInputHandler->IsEventSelected() & AliVEvent::kINT8) isSelected = 0;
-                if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-              } else if (fSpecialSubTriggerName.CompareTo("7DGA") == 0){
-                if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-              } else if (fSpecialSubTriggerName.CompareTo("8DGA") == 0){
-                if (fInputHandler->IsEventSelected() & AliVEvent::kINT8) isSelected = 0;
-                if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-              }
-              // trigger rejection EG1 & EG2
-              // EG1 is the trigger with the highest threshold
-              if(fNSpecialSubTriggerOptions==2){
-                // trigger rejection for EMC and DMC triggers together
-                if ((fSpecialSubTriggerName.CompareTo("7EG1") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DG1") == 0)
-                    || (fSpecialSubTriggerName.CompareTo("7EG1_EGA_sw") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DG1_EGA_sw") == 0)
-                  ){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if (firedTrigClass.Contains("7EG2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7DG2"))  isSelected = 0;
-                  if(isSelected != 0 && fMimicTrigger == 2){
-                    auto triggercont = static_cast<PWG::EMCAL::AliEmcalTriggerDecisionContainer *>(event->FindListObject("EmcalTriggerDecision"));
-                    if(!(triggercont->IsEventSelected("EG1") || triggercont->IsEventSelected("DG1"))) isSelected = 0;
-                  }
-                } else if ((fSpecialSubTriggerName.CompareTo("8EG1") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("8DG1") == 0)
-                    || (fSpecialSubTriggerName.CompareTo("7EG1_EGA_sw") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DG1_EGA_sw") == 0)
-                  ){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT8) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if (firedTrigClass.Contains("8EG2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("8DG2"))  isSelected = 0;
-                  if(isSelected != 0 && fMimicTrigger == 2){
-                    auto triggercont = static_cast<PWG::EMCAL::AliEmcalTriggerDecisionContainer *>(event->FindListObject("EmcalTriggerDecision"));
-                    if(!(triggercont->IsEventSelected("EG1") || triggercont->IsEventSelected("DG1"))) isSelected = 0;
-                  }
-                } else if ((fSpecialSubTriggerName.CompareTo("7EG2") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DG2") == 0)
-                    || (fSpecialSubTriggerName.CompareTo("7EG2_EGA_sw") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DG2_EGA_sw") == 0)
-                  ){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if(isSelected != 0 && fMimicTrigger == 2){
-                    auto triggercont = static_cast<PWG::EMCAL::AliEmcalTriggerDecisionContainer *>(event->FindListObject("EmcalTriggerDecision"));
-                    if(!(triggercont->IsEventSelected("EG2") || triggercont->IsEventSelected("DG2"))) isSelected = 0;
-                  }
-                } else if ((fSpecialSubTriggerName.CompareTo("8EG2") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("8DG2") == 0)
-                    || (fSpecialSubTriggerName.CompareTo("7EG2_EGA_sw") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DG2_EGA_sw") == 0)
-                  ){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if(isSelected != 0 && fMimicTrigger == 2){
-                    auto triggercont = static_cast<PWG::EMCAL::AliEmcalTriggerDecisionContainer *>(event->FindListObject("EmcalTriggerDecision"));
-                    if(!(triggercont->IsEventSelected("EG2") || triggercont->IsEventSelected("DG2"))) isSelected = 0;
-                  }
-                }
-              } else {
-                // separate rejection for EMC and DMC triggers
-                if (fSpecialSubTriggerName.CompareTo("7EG1") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if (firedTrigClass.Contains("7EG2"))  isSelected = 0;
-                  if(isSelected != 0 && fMimicTrigger == 2){
-                    auto triggercont = static_cast<PWG::EMCAL::AliEmcalTriggerDecisionContainer *>(event->FindListObject("EmcalTriggerDecision"));
-                    if(!triggercont->IsEventSelected("EG1")) isSelected = 0;
-                  }
-                } else if (fSpecialSubTriggerName.CompareTo("8EG1") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT8) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if (firedTrigClass.Contains("8EG2"))  isSelected = 0;
-                  if(isSelected != 0 && fMimicTrigger == 2){
-                    auto triggercont = static_cast<PWG::EMCAL::AliEmcalTriggerDecisionContainer *>(event->FindListObject("EmcalTriggerDecision"));
-                    if(!triggercont->IsEventSelected("EG1")) isSelected = 0;
-                  }
-                } else if (fSpecialSubTriggerName.CompareTo("7EG2") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if(isSelected != 0 && fMimicTrigger == 2){
-                    auto triggercont = static_cast<PWG::EMCAL::AliEmcalTriggerDecisionContainer *>(event->FindListObject("EmcalTriggerDecision"));
-                    if(!triggercont->IsEventSelected("EG2")) isSelected = 0;
-                  }
-                } else if (fSpecialSubTriggerName.CompareTo("8EG2") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if(isSelected != 0 && fMimicTrigger == 2){
-                    auto triggercont = static_cast<PWG::EMCAL::AliEmcalTriggerDecisionContainer *>(event->FindListObject("EmcalTriggerDecision"));
-                    if(!triggercont->IsEventSelected("EG2")) isSelected = 0;
-                  }
-                } else if (fSpecialSubTriggerName.CompareTo("7DG1") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if (firedTrigClass.Contains("7DG2"))  isSelected = 0;
-                  if(isSelected != 0 && fMimicTrigger == 2){
-                    auto triggercont = static_cast<PWG::EMCAL::AliEmcalTriggerDecisionContainer *>(event->FindListObject("EmcalTriggerDecision"));
-                    if(!triggercont->IsEventSelected("DG1")) isSelected = 0;
-                  }
-                } else if (fSpecialSubTriggerName.CompareTo("8DG1") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT8) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if (firedTrigClass.Contains("8DG2"))  isSelected = 0;
-                  if(isSelected != 0 && fMimicTrigger == 2){
-                    auto triggercont = static_cast<PWG::EMCAL::AliEmcalTriggerDecisionContainer *>(event->FindListObject("EmcalTriggerDecision"));
-                    if(!triggercont->IsEventSelected("DG1")) isSelected = 0;
-                  }
-                } else if (fSpecialSubTriggerName.CompareTo("7DG2") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if(isSelected != 0 && fMimicTrigger == 2){
-                    auto triggercont = static_cast<PWG::EMCAL::AliEmcalTriggerDecisionContainer *>(event->FindListObject("EmcalTriggerDecision"));
-                    if(!triggercont->IsEventSelected("DG2")) isSelected = 0;
-                  }
-                } else if (fSpecialSubTriggerName.CompareTo("8DG2") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT8) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if(isSelected != 0 && fMimicTrigger == 2){
-                    auto triggercont = static_cast<PWG::EMCAL::AliEmcalTriggerDecisionContainer *>(event->FindListObject("EmcalTriggerDecision"));
-                    if(!triggercont->IsEventSelected("DG2")) isSelected = 0;
-                  }
-                }
-              }
+            // rejection rules resolved once per run in InitializeRunState()
+            if (fInputHandler->IsEventSelected() & fRunState.fRejectMask) isSelected = 0;
+            for (UInt_t i = 0; i < fRunState.fRejectClasses.size() && isSelected; i++){
+              if (firedTrigClass.Contains(fRunState.fRejectClasses[i])) isSelected = 0;
             }
-            // jet triggers -> no overlap with gamma trigger and lower triggers required
-            if (fSpecialTrigger == 9){
-              if(fNSpecialSubTriggerOptions==2){
-                // trigger rejection for EMC and DMC triggers together
-                if (fSpecialSubTriggerName.CompareTo("7EJ1") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DJ1") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if (firedTrigClass.Contains("7EG2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7EG1"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7EJ2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7DG2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7DG1"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7DJ2"))  isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("7EJ2") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DJ2") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if (firedTrigClass.Contains("7EG2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7EG1"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7DG2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7DG1"))  isSelected = 0;
-                }
-              } else {
-                // separate rejection for EMC and DMC triggers
-                if( fSpecialSubTriggerName.CompareTo("7EJE") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if (firedTrigClass.Contains("7EGA"))  isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("8EJE") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT8) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if (firedTrigClass.Contains("8EGA"))  isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("7EJ1") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if (firedTrigClass.Contains("7EG2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7EG1"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7EJ2"))  isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("8EJ1") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT8) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if (firedTrigClass.Contains("8EG2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("8EG1"))  isSelected = 0;
-                  if (firedTrigClass.Contains("8EJ2"))  isSelected = 0;
-                } else   if (fSpecialSubTriggerName.CompareTo("7EJ2") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if (firedTrigClass.Contains("7EG2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7EG1"))  isSelected = 0;
-                } else   if (fSpecialSubTriggerName.CompareTo("8EJ2") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT8) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if (firedTrigClass.Contains("8EG2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("8EG1"))  isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("7DJ1") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if (firedTrigClass.Contains("7DG1"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7DG2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7DJ2"))  isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("8DJ1") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT8) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if (firedTrigClass.Contains("8DG1"))  isSelected = 0;
-                  if (firedTrigClass.Contains("8DG2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("8DJ2"))  isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("7DJ2") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if (firedTrigClass.Contains("7DG2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7DG1"))  isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("8DG2") == 0){
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kINT7) isSelected = 0;
-                  if (fInputHandler->IsEventSelected() & AliVEvent::kEMC7) isSelected = 0;
-                  if (firedTrigClass.Contains("8DG2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("8DG1"))  isSelected = 0;
-                }
+            if (fInputHandler->IsEventSelected() & AliVEvent::kCaloOnly){
+              for (UInt_t i = 0; i < fRunState.fRejectClassesCaloOnly.size() && isSelected; i++){
+                if (firedTrigClass.Contains(fRunState.fRejectClassesCaloOnly[i])) isSelected = 0;
               }
             }
-            if (fSpecialTrigger == 10 && (fInputHandler->IsEventSelected() & AliVEvent::kCaloOnly) ){
-              if(fNSpecialSubTriggerOptions==2){
-                // trigger rejection for EMC and DMC triggers together
-                if (fSpecialSubTriggerName.CompareTo("7EJ1") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DJ1") == 0){
-                  if (firedTrigClass.Contains("INT7-")) isSelected = 0;
-                  if (firedTrigClass.Contains("EMC7-")) isSelected = 0;
-                  if (firedTrigClass.Contains("DMC7-")) isSelected = 0;
-                  if (firedTrigClass.Contains("7EG2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7EG1"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7EJ2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7DG2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7DG1"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7DJ2"))  isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("7EJ2") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DJ2") == 0){
-                  if (firedTrigClass.Contains("INT7-")) isSelected = 0;
-                  if (firedTrigClass.Contains("EMC7-")) isSelected = 0;
-                  if (firedTrigClass.Contains("DMC7-")) isSelected = 0;
-                  if (firedTrigClass.Contains("7EG2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7EG1"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7DG2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7DG1"))  isSelected = 0;
-                }
-                // trigger rejection for EMC and DMC triggers together
-                if (fSpecialSubTriggerName.CompareTo("7EG1") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DG1") == 0){
-                  if (firedTrigClass.Contains("INT7-")) isSelected = 0;
-                  if (firedTrigClass.Contains("EMC7-")) isSelected = 0;
-                  if (firedTrigClass.Contains("DMC7-")) isSelected = 0;
-                  if (firedTrigClass.Contains("7EG2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("7DG2"))  isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("8EG1") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("8DG1") == 0){
-                  if (firedTrigClass.Contains("INT8-")) isSelected = 0;
-                  if (firedTrigClass.Contains("EMC8-")) isSelected = 0;
-                  if (firedTrigClass.Contains("DMC8-")) isSelected = 0;
-                  if (firedTrigClass.Contains("8EG2"))  isSelected = 0;
-                  if (firedTrigClass.Contains("8DG2"))  isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("7EG2") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("7DG2") == 0){
-                  if (firedTrigClass.Contains("INT7-")) isSelected = 0;
-                  if (firedTrigClass.Contains("EMC7-")) isSelected = 0;
-                  if (firedTrigClass.Contains("DMC7-")) isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("8EG2") == 0 && fSpecialSubTriggerNameAdditional.CompareTo("8DG2") == 0){
-                  if (firedTrigClass.Contains("INT8-")) isSelected = 0;
-                  if (firedTrigClass.Contains("EMC8-")) isSelected = 0;
-                  if (firedTrigClass.Contains("DMC8-")) isSelected = 0;
-                }
-              } else {
-                // trigger rejection L0 triggers
-                if (fSpecialSubTriggerName.CompareTo("CEMC7-") == 0){
-                  if (firedTrigClass.Contains("INT7-")) isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("CEMC1-") == 0){
-                  if (firedTrigClass.Contains("INT1-")) isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("CEMC8-") == 0){
-                  if (firedTrigClass.Contains("INT8-")) isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("CDMC7-") == 0){
-                  if (firedTrigClass.Contains("INT7-")) isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("CDMC1-") == 0){
-                  if (firedTrigClass.Contains("INT1-")) isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("CDMC8-") == 0){
-                  if (firedTrigClass.Contains("INT8-")) isSelected = 0;
-                }
-                // trigger rejection EGA
-                if (fSpecialSubTriggerName.CompareTo("7EGA") == 0){
-                  if (firedTrigClass.Contains("INT7-")) isSelected = 0;
-                  if (firedTrigClass.Contains("EMC7-")) isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("8EGA") == 0){
-                  if (firedTrigClass.Contains("INT8-")) isSelected = 0;
-                  if (firedTrigClass.Contains("EMC8-")) isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("7DGA") == 0){
-                  if (firedTrigClass.Contains("INT7-")) isSelected = 0;
-                  if (firedTrigClass.Contains("EMC7-")) isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("8DGA") == 0){
-                  if (firedTrigClass.Contains("INT8-")) isSelected = 0;
-                  if (firedTrigClass.Contains("EMC8-")) isSelected = 0;
-                }
-                // trigger rejection L1 triggers
-                if(fSpecialSubTriggerName.CompareTo("7EG1") == 0){
-                  if (firedTrigClass.Contains("INT7-")) isSelected = 0;
-                  if (firedTrigClass.Contains("EMC7-")) isSelected = 0;
-                  if (firedTrigClass.Contains("7EG2"))  isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("8EG1") == 0){
-                  if (firedTrigClass.Contains("INT8-")) isSelected = 0;
-                  if (firedTrigClass.Contains("EMC8-")) isSelected = 0;
-                  if (firedTrigClass.Contains("8EG2"))  isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("7EG2") == 0){
-                  if (firedTrigClass.Contains("INT7-")) isSelected = 0;
-                  if (firedTrigClass.Contains("EMC7-")) isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("8EG2") == 0){
-                  if (firedTrigClass.Contains("INT8-")) isSelected = 0;
-                  if (firedTrigClass.Contains("EMC8-")) isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("7DG1") == 0){
-                  if (firedTrigClass.Contains("INT7-")) isSelected = 0;
-                  if (firedTrigClass.Contains("DMC7-")) isSelected = 0;
-                  if (firedTrigClass.Contains("7DG2"))  isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("8DG1") == 0){
-                  if (firedTrigClass.Contains("INT8-")) isSelected = 0;
-                  if (firedTrigClass.Contains("DMC8-")) isSelected = 0;
-                  if (firedTrigClass.Contains("8DG2"))  isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("7DG2") == 0){
-                  if (firedTrigClass.Contains("INT7-")) isSelected = 0;
-                  if (firedTrigClass.Contains("DMC7-")) isSelected = 0;
-                } else if (fSpecialSubTriggerName.CompareTo("8DG2") == 0){
-                  if (firedTrigClass.Contains("INT7-")) isSelected = 0;
-                  if (firedTrigClass.Contains("DMC8-")) isSelected = 0;
-                }
-                // trigger rejection PHOS triggers
-                if (fSpecialSubTriggerName.CompareTo("CPHI7-") == 0){
-                  if (firedTrigClass.Contains("INT7-")) isSelected = 0;
-                }
+            if (isSelected != 0 && fRunState.fMimicDecisions.size() > 0){
+              auto triggercont = static_cast<PWG::EMCAL::AliEmcalTriggerDecisionContainer *>(event->FindListObject("EmcalTriggerDecision"));
+              Bool_t decision = kFALSE;
+              for (UInt_t i = 0; i < fRunState.fMimicDecisions.size() && !decision; i++){
+                if (triggercont->IsEventSelected(fRunState.fMimicDecisions[i].Data())) decision = kTRUE;
               }
+              if (!decision) isSelected = 0;
             }
           }
           if (isSelected != 0 ){
@@ -6138,33 +6187,19 @@ Bool_t AliConvEventCuts::IsTriggerSelected(AliVEvent *event, Bool_t isMC)
 
         //if for specific centrality trigger selection
         if(fSpecialSubTrigger == 1){
-          if(fSpecialSubTriggerName.Contains("|")  && GetCentrality(event) <= 10.){
-            TObjArray *ClassesList = fSpecialSubTriggerName.Tokenize("|");
-            for (Int_t i=0; i<ClassesList->GetEntriesFast();++i){
-              TObjString *NameClass = (TObjString*)ClassesList->At(i);
-              if (firedTrigClass.Contains(NameClass->GetString())) isSelected = 1;
-            }
-          } else if(fSpecialSubTriggerName.Contains("%")){
-            TObjArray *ClassesList = fSpecialSubTriggerName.Tokenize("%");
-            for (Int_t i=0; i<ClassesList->GetEntriesFast();++i){
-              TObjString *NameClass = (TObjString*)ClassesList->At(i);
-              if (firedTrigClass.Contains(NameClass->GetString())) isSelected = 1;
+          // classes split in InitializeRunState()
+          if(fRunState.fSubTriggerCentOr  && GetCentrality(event) <= 10.){
+            for (UInt_t i=0; i<fRunState.fSubTriggerCentClasses.size();++i){
+              if (firedTrigClass.Contains(fRunState.fSubTriggerCentClasses[i])) isSelected = 1;
             }
-          } else if(fSpecialSubTriggerName.Contains("@")){
-            TObjArray *ClassesList = fSpecialSubTriggerName.Tokenize("@");
-            for (Int_t i=0; i<ClassesList->GetEntriesFast();++i){
-              TObjString *NameClass = (TObjString*)ClassesList->At(i);
-              if (firedTrigClass.Contains(NameClass->GetString())) isSelected = 1;
+          } else if(fRunState.fSubTriggerSeparator == '&'){ //logic AND of two classes
+            for (UInt_t i=0; i<fRunState.fSubTriggerClasses.size(); i++){
+              if (!firedTrigClass.Contains(fRunState.fSubTriggerClasses[i])) isSelected = 0;
             }
-          } else if(fSpecialSubTriggerName.Contains("&")){ //logic AND of two classes
-            TObjArray *ClassesList = fSpecialSubTriggerName.Tokenize("&");
-            TString CheckClass = "";
-            for (Int_t i=0; i<ClassesList->GetEntriesFast(); i++){
-              TObjString *NameClass = (TObjString*)ClassesList->At(i);
-              if (firedTrigClass.Contains(NameClass->GetString())) CheckClass+="1";
-              else CheckClass+="0";
+          } else if(fRunState.fSubTriggerSeparator){
+            for (UInt_t i=0; i<fRunState.fSubTriggerClasses.size();++i){
+              if (firedTrigClass.Contains(fRunState.fSubTriggerClasses[i])) isSelected = 1;
             }
-            if(CheckClass.Contains("0")) isSelected = 0;
           }
           else if(firedTrigClass.Contains(fSpecialSubTriggerName.Data())) isSelected = 1;
         }
@@ -21,6 +21,7 @@
 #include "AliVCaloTrigger.h"
 #include "AliTimeRangeCut.h"
 #include "AliEventCuts.h"
+#include <vector>
 
 class AliESDEvent;
 class AliAODEvent;
@@ -379,6 +380,24 @@ class AliConvEventCuts : public AliAnalysisCuts {
 
       enum phosTriggerType{kPHOSAny,kPHOSL0,kPHOSL1low,kPHOSL1med,kPHOSL1high} ;
 
+      // trigger settings resolved at the first event of each run, see InitializeRunState()
+      struct RunState {
+        RunState() : fRunNumber(-1), fRejectMask(0), fRejectClasses(), fRejectClassesCaloOnly(), fMimicDecisions(),
+                     fSubTriggerNameShort(""), fSubTriggerNameAdditionalShort(""), fSubTriggerCentOr(kFALSE),
+                     fSubTriggerCentClasses(), fSubTriggerSeparator(0), fSubTriggerClasses() {}
+        Int_t                 fRunNumber;                     // run the state was built for, -1 if none
+        UInt_t                fRejectMask;                    // offline trigger bits rejecting the event, trigger overlap rejection
+        std::vector<TString>  fRejectClasses;                 // fired trigger classes rejecting the event
+        std::vector<TString>  fRejectClassesCaloOnly;         // fired trigger classes rejecting kCaloOnly events
+        std::vector<TString>  fMimicDecisions;                // EMCal trigger decisions of which one is required, fMimicTrigger == 2
+        TString               fSubTriggerNameShort;           // first 4 characters of fSpecialSubTriggerName
+        TString               fSubTriggerNameAdditionalShort; // first 4 characters of fSpecialSubTriggerNameAdditional
+        Bool_t                fSubTriggerCentOr;              // fSpecialSubTriggerName contains "|"
+        std::vector<TString>  fSubTriggerCentClasses;         // classes separated by "|"
+        Char_t                fSubTriggerSeparator;           // first of "%@&" found in fSpecialSubTriggerName, 0 if none
+        std::vector<TString>  fSubTriggerClasses;             // classes separated by fSubTriggerSeparator
+      };
+
 
       AliConvEventCuts(const char *name="EventCuts", const char * title="Event Cuts");
       AliConvEventCuts(const AliConvEventCuts&);
@@ -634,6 +653,7 @@ class AliConvEventCuts : public AliAnalysisCuts {
                               Bool_t isMC );
       Bool_t    IsTriggerSelected(  AliVEvent *event,
                                     Bool_t isMC);
+      void      InitializeRunState( Int_t runNumber);
       Bool_t    HasV0AND()                                                          { return fHasV0AND                                          ; }
       Bool_t    IsSDDFired()                                                        { return fIsSDDFired                                        ; }
       Int_t     IsSpecialTrigger()                                                  { return fSpecialTrigger                                    ; }
@@ -802,10 +822,11 @@ class AliConvEventCuts : public AliAnalysisCuts {
       TH1D*                       hReweightMultMC;                        ///< histogram input for reweighting Pi0
       phosTriggerType             fPHOSTrigger;                           // Kind of PHOS trigger: L0,L1
       Int_t                       fDebugLevel;                            ///< debug level for interactive debugging
+      RunState                    fRunState;                              //!<! trigger settings resolved per run
   private:
 
       /// \cond CLASSIMP
-      ClassDef(AliConvEventCuts,86)
+      ClassDef(AliConvEventCuts,87)
       /// \endcond
 };
 
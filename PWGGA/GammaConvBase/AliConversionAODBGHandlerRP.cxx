@@ -39,7 +39,8 @@ AliConversionAODBGHandlerRP::AliConversionAODBGHandlerRP(Bool_t IsHeavyIon,Bool_
   fBinLimitsArrayRP(NULL),
   fBinLimitsArrayZ(NULL),
   fBinLimitsArrayMultiplicity(NULL),
-  fBGEvents(fNBinsRP,AliGammaConversionVertexPositionVector(fNBinsZ,AliGammaConversionBGEventVector(fNEvents)))
+  fBGEvents(fNBinsRP,AliGammaConversionVertexPositionVector(fNBinsZ,AliGammaConversionBGEventVector(fNEvents))),
+  fCompactPool(NULL)
 //   fBGPool(fNBinsZ,AliGammaConversionMultiplicityVector(fNBinsMultiplicity,AliGammaConversionBGEventVector(fNEvents)))
 {
   
@@ -148,6 +149,26 @@ AliConversionAODBGHandlerRP::~AliConversionAODBGHandlerRP()
     fNBGEvents = NULL;
   }
 
+  if(fCompactPool){
+    delete fCompactPool;
+    fCompactPool = NULL;
+  }
+}
+
+//________________________________________________________________________
+void AliConversionAODBGHandlerRP::SetUseCompactPool(Bool_t useCompact, Double_t memoryBudgetMB){
+  // keep only the fields needed for the background mesons in per bin ring buffers within memoryBudgetMB
+  if(fCompactPool){
+    delete fCompactPool;
+    fCompactPool = NULL;
+  }
+  if(useCompact) fCompactPool = new AliConversionCompactBGPool(fNBinsRP*fNBinsZ,fNEvents,memoryBudgetMB);
+}
+
+//________________________________________________________________________
+Double_t AliConversionAODBGHandlerRP::GetPoolOccupancy(Int_t psibin, Int_t zbin) const{
+  if(!fCompactPool) return 0.;
+  return fCompactPool->GetOccupancy(psibin*fNBinsZ+zbin);
 }
 
 //________________________________________________________________________
@@ -298,6 +319,12 @@ void AliConversionAODBGHandlerRP::AddEvent(TObjArray * const eventGammas,AliVEve
 
     Int_t eventCounter = fBGEventCounter[psi][z];
 
+    if(fCompactPool){
+      fCompactPool->AddEvent(psi*fNBinsZ+z,eventCounter,eventGammas);
+      fBGEventCounter[psi][z]++;
+      return;
+    }
+
     //clear the vector for old gammas
     for(UInt_t d = 0; d < fBGEvents[psi][z][eventCounter].size(); d++){
       delete (AliAODConversionPhoton*)(fBGEvents[psi][z][eventCounter][d]);
@@ -333,6 +360,12 @@ void AliConversionAODBGHandlerRP::AddEvent(TList * const eventGammas,AliVEvent *
 
     Int_t eventCounter = fBGEventCounter[psi][z];
 
+    if(fCompactPool){
+      fCompactPool->AddEvent(psi*fNBinsZ+z,eventCounter,eventGammas);
+      fBGEventCounter[psi][z]++;
+      return;
+    }
+
     //clear the vector for old gammas
     for(UInt_t d = 0; d < fBGEvents[psi][z][eventCounter].size(); d++){
       delete (AliAODConversionPhoton*)(fBGEvents[psi][z][eventCounter][d]);
@@ -355,6 +388,7 @@ AliGammaConversionPhotonVector* AliConversionAODBGHandlerRP::GetBGGoodGammas(TOb
   Int_t zbin;
 
   if(FindBins(eventGammas,fInputEvent,psibin,zbin)){
+    if(fCompactPool) return fCompactPool->GetEvent(psibin*fNBinsZ+zbin,event);
     return &(fBGEvents[psibin][zbin][event]);
   }
   return NULL;
@@ -365,6 +399,7 @@ AliGammaConversionPhotonVector* AliConversionAODBGHandlerRP::GetBGGoodGammas(TLi
   Int_t zbin;
 
   if(FindBins(eventGammas,fInputEvent,psibin,zbin)){
+    if(fCompactPool) return fCompactPool->GetEvent(psibin*fNBinsZ+zbin,event);
     return &(fBGEvents[psibin][zbin][event]);
   }
   return NULL;
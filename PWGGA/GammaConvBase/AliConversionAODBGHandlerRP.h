@@ -6,6 +6,7 @@
 #include "AliAODConversionPhoton.h"
 #include "TObjArray.h"
 #include "TList.h"
+#include "AliConversionCompactBGPool.h"
 #include <vector>
 
 using namespace std;
@@ -64,6 +65,13 @@ class AliConversionAODBGHandlerRP: public TObject{
     Int_t GetNZBins                                 ()const                                         { return fNBinsZ                              ;}
     Int_t GetNMultiplicityBins                      ()const                                         { return fNBinsMultiplicity                   ;}
 
+    // compact photon pool, replaces the AliAODConversionPhoton copies
+    void SetUseCompactPool                          ( Bool_t useCompact,
+                                                      Double_t memoryBudgetMB = 50. );
+    Bool_t GetUseCompactPool                        ()const                                         { return fCompactPool != NULL                 ;}
+    AliConversionCompactBGPool* GetCompactPool      ()const                                         { return fCompactPool                         ;}
+    Double_t GetPoolOccupancy                       ( Int_t psibin, Int_t zbin ) const;
+
   private:
     Bool_t                      fIsHeavyIon;                      // flag for heavy ion
     Bool_t                      fUseChargedTrackMult;             // flag for multiplicity switch
@@ -77,12 +85,13 @@ class AliConversionAODBGHandlerRP: public TObject{
     Double_t*                   fBinLimitsArrayZ;                 //! bin limits z array
     Double_t*                   fBinLimitsArrayMultiplicity;      //! bin limit multiplicity array
     AliGammaConversionBGVector  fBGEvents;                        //background events
+    AliConversionCompactBGPool* fCompactPool;                     //! compact background events, replaces fBGEvents if set
 //     AliGammaConversionBGVector  fBGPool;                          //background events
 
     AliConversionAODBGHandlerRP(AliConversionAODBGHandlerRP &original);
     AliConversionAODBGHandlerRP &operator=(const AliConversionAODBGHandlerRP &ref);
 
-  ClassDef(AliConversionAODBGHandlerRP,1);
+  ClassDef(AliConversionAODBGHandlerRP,2);
 
 };
 #endif
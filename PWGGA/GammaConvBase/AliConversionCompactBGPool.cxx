@@ -0,0 +1,203 @@
+/**************************************************************************
+ * Copyright(c) 1998-2021, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+////////////////////////////////////////////////
+//---------------------------------------------
+// Compact photon store for the mixed event background handlers
+//---------------------------------------------
+////////////////////////////////////////////////
+
+#include <iostream>
+#include "TCollection.h"
+#include "TMath.h"
+#include "AliAODConversionPhoton.h"
+#include "AliConversionCompactBGPool.h"
+
+using namespace std;
+
+//________________________________________________________________________
+AliConversionCompactBGPool::AliConversionCompactBGPool() :
+  fNBins(0),
+  fNSlots(0),
+  fCapacity(0),
+  fPhotons(),
+  fHead(),
+  fStart(),
+  fNPhotons(),
+  fScratch(),
+  fEvent(),
+  fNEventsAdded(0),
+  fNEventsEvicted(0),
+  fNPhotonsTruncated(0)
+{
+  // default constructor
+}
+
+//________________________________________________________________________
+AliConversionCompactBGPool::AliConversionCompactBGPool(Int_t nBins, Int_t nSlots, Double_t memoryBudgetMB) :
+  fNBins(TMath::Max(nBins,1)),
+  fNSlots(TMath::Max(nSlots,1)),
+  fCapacity(0),
+  fPhotons(fNBins),
+  fHead(fNBins,0),
+  fStart(fNBins*fNSlots,0),
+  fNPhotons(fNBins*fNSlots,0),
+  fScratch(),
+  fEvent(),
+  fNEventsAdded(0),
+  fNEventsEvicted(0),
+  fNPhotonsTruncated(0)
+{
+  // the memory budget is shared equally between the bins
+  Double_t photonsPerBin = memoryBudgetMB*1024.*1024./(sizeof(CompactPhoton)*fNBins);
+  fCapacity = (Int_t)TMath::Min(TMath::Max(photonsPerBin,1.),1.e9);
+}
+
+//________________________________________________________________________
+AliConversionCompactBGPool::~AliConversionCompactBGPool()
+{
+  for(UInt_t i = 0; i < fScratch.size(); i++){
+    delete fScratch[i];
+  }
+  fScratch.clear();
+}
+
+//________________________________________________________________________
+Bool_t AliConversionCompactBGPool::Overlaps(Int_t start1, Int_t n1, Int_t start2, Int_t n2) const
+{
+  return (start1 < start2+n2 && start2 < start1+n1);
+}
+
+//________________________________________________________________________
+void AliConversionCompactBGPool::AddEvent(Int_t bin, Int_t slot, const TCollection *eventGammas)
+{
+  // store the photons of the event in the given slot, replacing its previous content
+
+  if(bin < 0 || bin >= fNBins || slot < 0 || slot >= fNSlots) return;
+  Int_t index = bin*fNSlots+slot;
+  fNPhotons[index] = 0;
+  fNEventsAdded++;
+
+  Int_t nGammas = eventGammas ? eventGammas->GetEntries() : 0;
+  if(nGammas == 0) return;
+  if(nGammas > fCapacity){
+    fNPhotonsTruncated += nGammas-fCapacity;
+    nGammas = fCapacity;
+  }
+
+  vector<CompactPhoton> &ring = fPhotons[bin];
+  if(ring.empty()) ring.resize(fCapacity);
+
+  // events are kept contiguous, the write position wraps if the event does not fit at the end
+  Int_t head = fHead[bin];
+  if(head+nGammas > fCapacity) head = 0;
+
+  // empty the slots whose photons get overwritten
+  for(Int_t s = 0; s < fNSlots; s++){
+    Int_t other = bin*fNSlots+s;
+    if(s == slot || fNPhotons[other] == 0) continue;
+    if(Overlaps(fStart[other],fNPhotons[other],head,nGammas)){
+      fNPhotons[other] = 0;
+      fNEventsEvicted++;
+    }
+  }
+
+  TIter next(eventGammas);
+  Int_t nStored = 0;
+  while(nStored < nGammas){
+    AliAODConversionPhoton *gamma = (AliAODConversionPhoton*)next();
+    if(!gamma) break;
+    CompactPhoton &photon   = ring[head+nStored];
+    photon.fPx              = gamma->Px();
+    photon.fPy              = gamma->Py();
+    photon.fPz              = gamma->Pz();
+    photon.fE               = gamma->E();
+    photon.fConvPoint[0]    = gamma->GetConversionX();
+    photon.fConvPoint[1]    = gamma->GetConversionY();
+    photon.fConvPoint[2]    = gamma->GetConversionZ();
+    photon.fLeadingCellID   = gamma->GetLeadingCellID();
+    photon.fMCLabel         = gamma->GetNCaloPhotonMCLabels() > 0 ? gamma->GetCaloPhotonMCLabel(0) : -1;
+    photon.fCaloPhoton      = gamma->GetIsCaloPhoton();
+    photon.fQuality         = gamma->GetPhotonQuality();
+    nStored++;
+  }
+  fStart[index]    = head;
+  fNPhotons[index] = nStored;
+  fHead[bin]       = head+nStored;
+}
+
+//________________________________________________________________________
+vector<AliAODConversionPhoton*>* AliConversionCompactBGPool::GetEvent(Int_t bin, Int_t slot)
+{
+  // photons of the slot, valid until the next call
+
+  fEvent.clear();
+  if(bin < 0 || bin >= fNBins || slot < 0 || slot >= fNSlots) return &fEvent;
+  Int_t index   = bin*fNSlots+slot;
+  Int_t nGammas = fNPhotons[index];
+  while((Int_t)fScratch.size() < nGammas) fScratch.push_back(new AliAODConversionPhoton());
+
+  const vector<CompactPhoton> &ring = fPhotons[bin];
+  for(Int_t i = 0; i < nGammas; i++){
+    const CompactPhoton &photon = ring[fStart[index]+i];
+    AliAODConversionPhoton *gamma = fScratch[i];
+    gamma->SetPxPyPzE(photon.fPx,photon.fPy,photon.fPz,photon.fE);
+    Double_t convPoint[3] = {photon.fConvPoint[0],photon.fConvPoint[1],photon.fConvPoint[2]};
+    gamma->SetConversionPoint(convPoint);
+    gamma->SetLeadingCellID(photon.fLeadingCellID);
+    gamma->SetCaloPhotonMCLabel(0,photon.fMCLabel);
+    gamma->SetNCaloPhotonMCLabels(photon.fMCLabel >= 0 ? 1 : 0);
+    gamma->SetPhotonQuality(photon.fQuality);
+    gamma->fCaloPhoton = photon.fCaloPhoton;
+    fEvent.push_back(gamma);
+  }
+  return &fEvent;
+}
+
+//________________________________________________________________________
+Int_t AliConversionCompactBGPool::GetNPhotons(Int_t bin, Int_t slot) const
+{
+  if(bin < 0 || bin >= fNBins || slot < 0 || slot >= fNSlots) return 0;
+  return fNPhotons[bin*fNSlots+slot];
+}
+
+//________________________________________________________________________
+Double_t AliConversionCompactBGPool::GetOccupancy(Int_t bin) const
+{
+  // fraction of the ring buffer of the bin held by stored events
+
+  if(bin < 0 || bin >= fNBins || fCapacity == 0) return 0.;
+  Long64_t nStored = 0;
+  for(Int_t s = 0; s < fNSlots; s++) nStored += fNPhotons[bin*fNSlots+s];
+  return Double_t(nStored)/fCapacity;
+}
+
+//________________________________________________________________________
+Double_t AliConversionCompactBGPool::GetMemoryUsageMB() const
+{
+  // memory of the allocated ring buffers
+  Double_t bytes = 0;
+  for(Int_t b = 0; b < fNBins; b++) bytes += fPhotons[b].capacity()*sizeof(CompactPhoton);
+  return bytes/(1024.*1024.);
+}
+
+//________________________________________________________________________
+void AliConversionCompactBGPool::Print() const
+{
+  cout << "AliConversionCompactBGPool: " << fNBins << " bins x " << fNSlots << " events, capacity " << fCapacity
+       << " photons per bin, " << GetMemoryUsageMB() << " MB allocated" << endl;
+  cout << "  events added " << fNEventsAdded << ", evicted " << fNEventsEvicted << ", photons truncated " << fNPhotonsTruncated << endl;
+  for(Int_t b = 0; b < fNBins; b++){
+    if(fPhotons[b].empty()) continue;
+    cout << "  bin " << b << " occupancy " << GetOccupancy(b) << endl;
+  }
+}
@@ -0,0 +1,76 @@
+#ifndef ALICONVERSIONCOMPACTBGPOOL_H
+#define ALICONVERSIONCOMPACTBGPOOL_H
+
+////////////////////////////////////////////////
+//---------------------------------------------
+// Compact photon store for the mixed event background handlers.
+// Per pool bin the photons are kept in a ring buffer of fixed capacity,
+// derived from the memory budget. An event slot which is overwritten by
+// newer photons before the handler reuses it is emptied (evicted).
+// Only the 4-momentum, conversion point, leading cell ID, calo photon flag,
+// photon quality and the first MC label are stored, i.e. what is needed to
+// build and select the background mesons.
+//---------------------------------------------
+////////////////////////////////////////////////
+
+#include "Rtypes.h"
+#include <vector>
+
+class TCollection;
+class AliAODConversionPhoton;
+
+class AliConversionCompactBGPool {
+
+  public:
+
+    struct CompactPhoton{
+      Float_t fPx;
+      Float_t fPy;
+      Float_t fPz;
+      Float_t fE;
+      Float_t fConvPoint[3];
+      Int_t   fLeadingCellID;
+      Int_t   fMCLabel;
+      Char_t  fCaloPhoton;
+      UChar_t fQuality;
+    };
+
+    AliConversionCompactBGPool();
+    AliConversionCompactBGPool(Int_t nBins, Int_t nSlots, Double_t memoryBudgetMB);
+    ~AliConversionCompactBGPool();
+
+    void     AddEvent(Int_t bin, Int_t slot, const TCollection *eventGammas);
+    std::vector<AliAODConversionPhoton*>* GetEvent(Int_t bin, Int_t slot);
+    Int_t    GetNPhotons(Int_t bin, Int_t slot) const;
+
+    Int_t    GetNBins()               const {return fNBins;}
+    Int_t    GetCapacityPerBin()      const {return fCapacity;}
+    Double_t GetOccupancy(Int_t bin)  const;
+    Double_t GetMemoryUsageMB()       const;
+    Long64_t GetNEventsAdded()        const {return fNEventsAdded;}
+    Long64_t GetNEventsEvicted()      const {return fNEventsEvicted;}
+    Long64_t GetNPhotonsTruncated()   const {return fNPhotonsTruncated;}
+    void     Print() const;
+
+  private:
+
+    Bool_t   Overlaps(Int_t start1, Int_t n1, Int_t start2, Int_t n2) const;
+
+    Int_t                        fNBins;              // number of pool bins
+    Int_t                        fNSlots;             // event slots per bin
+    Int_t                        fCapacity;           // photons per bin ring buffer
+    std::vector<std::vector<CompactPhoton> > fPhotons; // ring buffer per bin, allocated on first use
+    std::vector<Int_t>           fHead;               // next write position per bin
+    std::vector<Int_t>           fStart;              // first photon of each slot, nBins*nSlots
+    std::vector<Int_t>           fNPhotons;           // photons of each slot, nBins*nSlots
+    std::vector<AliAODConversionPhoton*> fScratch;    // owned photons returned by GetEvent()
+    std::vector<AliAODConversionPhoton*> fEvent;      // view on fScratch for the requested event
+    Long64_t                     fNEventsAdded;       // events added
+    Long64_t                     fNEventsEvicted;     // events lost to the ring buffer capacity
+    Long64_t                     fNPhotonsTruncated;  // photons dropped for events larger than the capacity
+
+    AliConversionCompactBGPool(const AliConversionCompactBGPool&);
+    AliConversionCompactBGPool& operator=(const AliConversionCompactBGPool&);
+};
+
+#endif
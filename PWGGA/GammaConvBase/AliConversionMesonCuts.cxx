@@ -184,7 +184,12 @@ AliConversionMesonCuts::AliConversionMesonCuts(const char *name,const char *titl
   fEnableOmegaAPlikeCut(kFALSE),
   fDoGammaMinEnergyCut(kFALSE),
   fNDaughterEnergyCut(0),
-  fSingleDaughterMinE(0.)
+  fSingleDaughterMinE(0.),
+  fPairPt2(),
+  fPairPz(),
+  fPairE(),
+  fPairDot(),
+  fPairMag2()
 {
   for(Int_t jj=0;jj<kNCuts;jj++){fCuts[jj]=0;}
   fCutString=new TObjString((GetCutNumber()).Data());
@@ -307,7 +312,12 @@ AliConversionMesonCuts::AliConversionMesonCuts(const AliConversionMesonCuts &ref
   fEnableOmegaAPlikeCut(ref.fEnableOmegaAPlikeCut),
   fDoGammaMinEnergyCut(kFALSE),
   fNDaughterEnergyCut(0),
-  fSingleDaughterMinE(0.)
+  fSingleDaughterMinE(0.),
+  fPairPt2(),
+  fPairPz(),
+  fPairE(),
+  fPairDot(),
+  fPairMag2()
 
 {
   // Copy Constructor
@@ -1695,6 +1705,114 @@ Bool_t AliConversionMesonCuts::MesonIsSelected(AliAODConversionMother *pi0,Bool_
   return kTRUE;
 }
 
+//________________________________________________________________________
+Int_t AliConversionMesonCuts::PrefilterPhotonPairs(const PhotonArrays &photons1, const PhotonArrays &photons2, Bool_t IsSignal, Double_t fRapidityShift, vector<Int_t> &candidates)
+{
+  // Pair kernel for the combinatorics of photons1 x photons2: computes the pair kinematics
+  // without building AliAODConversionMother objects and rejects the pairs failing the rapidity cut
+  // and, for the standard cuts with fixed values, the opening angle and alpha cuts.
+  // The rejected pairs are booked in the cut histograms exactly as in MesonIsSelected(), the
+  // candidates (index pairs i,j in candidates) still have to pass MesonIsSelected().
+  // Returns the number of candidates.
+
+  candidates.clear();
+  Int_t nPhotons1 = photons1.GetN();
+  Int_t nPhotons2 = photons2.GetN();
+  if(nPhotons1 == 0 || nPhotons2 == 0) return 0;
+
+  TH2 *hist = IsSignal ? fHistoMesonCuts : fHistoMesonBGCuts;
+  Bool_t applyKinematicCuts = (fIsMergedClusterCut == 0 && !fAllowCombOnlyInSameRecMethod &&
+                               !fMinOpanPtDepCut && !fMaxOpanPtDepCut && !fAlphaPtDepCut);
+
+  fPairPt2.resize(nPhotons2);
+  fPairPz.resize(nPhotons2);
+  fPairE.resize(nPhotons2);
+  fPairDot.resize(nPhotons2);
+  fPairMag2.resize(nPhotons2);
+  const Double_t *px2 = &photons2.fPx[0];
+  const Double_t *py2 = &photons2.fPy[0];
+  const Double_t *pz2 = &photons2.fPz[0];
+  const Double_t *e2  = &photons2.fE[0];
+  Double_t *pairPt2  = &fPairPt2[0];
+  Double_t *pairPz   = &fPairPz[0];
+  Double_t *pairE    = &fPairE[0];
+  Double_t *pairDot  = &fPairDot[0];
+  Double_t *pairMag2 = &fPairMag2[0];
+
+  for(Int_t i = 0; i < nPhotons1; i++){
+    const Double_t px1 = photons1.fPx[i];
+    const Double_t py1 = photons1.fPy[i];
+    const Double_t pz1 = photons1.fPz[i];
+    const Double_t e1  = photons1.fE[i];
+    const Double_t mag21 = px1*px1 + py1*py1 + pz1*pz1;
+
+    // branch free part, same operation order as TLorentzVector/TVector3 to get identical values
+    for(Int_t j = 0; j < nPhotons2; j++){
+      const Double_t px = px1+px2[j];
+      const Double_t py = py1+py2[j];
+      pairPt2[j]  = px*px + py*py;
+      pairPz[j]   = pz1+pz2[j];
+      pairE[j]    = e1+e2[j];
+      pairDot[j]  = px1*px2[j] + py1*py2[j] + pz1*pz2[j];
+      pairMag2[j] = mag21*(px2[j]*px2[j] + py2[j]*py2[j] + pz2[j]*pz2[j]);
+    }
+
+    for(Int_t j = 0; j < nPhotons2; j++){
+      const Double_t e  = pairE[j];
+      const Double_t pz = pairPz[j];
+      // undefined rapidity is left to MesonIsSelected()
+      if(e == pz || (e+pz)/(e-pz) <= 0){
+        candidates.push_back(i);
+        candidates.push_back(j);
+        continue;
+      }
+      const Double_t pt = TMath::Sqrt(pairPt2[j]);
+      const Double_t rapidity = 0.5*TMath::Log((e+pz)/(e-pz)) - fRapidityShift;
+      if(rapidity < fRapidityCutMesonMin || rapidity > fRapidityCutMesonMax){
+        if(hist){
+          hist->Fill(0., pt);
+          hist->Fill(2., pt);
+        }
+        continue;
+      }
+      if(!applyKinematicCuts){
+        candidates.push_back(i);
+        candidates.push_back(j);
+        continue;
+      }
+
+      Double_t openingAngle = 0.;
+      if(pairMag2[j] > 0){
+        Double_t arg = pairDot[j]/TMath::Sqrt(pairMag2[j]);
+        if(arg >  1.0) arg =  1.0;
+        if(arg < -1.0) arg = -1.0;
+        openingAngle = TMath::ACos(arg);
+      }
+      const Double_t alpha = (e != 0) ? (e1-e2[j])/e : -1.;
+      Int_t rejectedAt = -1;
+      if((fEnableMinOpeningAngleCut && openingAngle < fOpeningAngle) || openingAngle < fMinOpanCutMeson || openingAngle > fMaxOpanCutMeson){
+        rejectedAt = 3;
+      } else if(TMath::Abs(alpha) > fAlphaCutMeson){
+        rejectedAt = 4;
+      } else if(TMath::Abs(alpha) < fAlphaMinCutMeson){
+        rejectedAt = 5;
+      }
+      if(rejectedAt < 0){
+        candidates.push_back(i);
+        candidates.push_back(j);
+        continue;
+      }
+      if(hist) hist->Fill(0., pt);
+      if(fHistoInvMassBefore){
+        const Double_t mass2 = e*e - (pairPt2[j] + pz*pz);
+        fHistoInvMassBefore->Fill(mass2 < 0. ? -TMath::Sqrt(-mass2) : TMath::Sqrt(mass2));
+      }
+      if(hist) hist->Fill(rejectedAt, pt);
+    }
+  }
+  return candidates.size()/2;
+}
+
 
 
 //________________________________________________________________________
@@ -15,6 +15,7 @@
 #include "AliCaloPhotonCuts.h"
 #include "AliDalitzAODESDMC.h"
 #include "AliDalitzEventMC.h"
+#include <vector>
 
 class AliESDEvent;
 class AliAODEvent;
@@ -102,6 +103,17 @@ class AliConversionMesonCuts : public AliAnalysisCuts {
 
     virtual ~AliConversionMesonCuts();                            //virtual destructor
 
+    // photon momenta as struct of arrays, input of PrefilterPhotonPairs()
+    struct PhotonArrays {
+      std::vector<Double_t> fPx;
+      std::vector<Double_t> fPy;
+      std::vector<Double_t> fPz;
+      std::vector<Double_t> fE;
+      void  Clear()                                     { fPx.clear(); fPy.clear(); fPz.clear(); fE.clear(); }
+      void  Add(Double_t px, Double_t py, Double_t pz, Double_t e) { fPx.push_back(px); fPy.push_back(py); fPz.push_back(pz); fE.push_back(e); }
+      Int_t GetN() const                                { return fE.size(); }
+    };
+
     virtual Bool_t IsSelected(TObject* /*obj*/){return kTRUE;}
     virtual Bool_t IsSelected(TList* /*list*/) {return kTRUE;}
     Bool_t MesonIsSelectedByMassCut (AliAODConversionMother *meson, Int_t nominalRange);
@@ -111,6 +123,7 @@ class AliConversionMesonCuts : public AliAnalysisCuts {
 
     // Cut Selection
     Bool_t MesonIsSelected(AliAODConversionMother *pi0,Bool_t IsSignal=kTRUE, Double_t fRapidityShift=0., Int_t leadingCellID1 = 0, Int_t leadingCellID2 = 0, Char_t recoMeth1 = 0, Char_t  recoMeth2 = 0);
+    Int_t  PrefilterPhotonPairs(const PhotonArrays &photons1, const PhotonArrays &photons2, Bool_t IsSignal, Double_t fRapidityShift, std::vector<Int_t> &candidates);
     Bool_t MesonIsSelectedMC(TParticle *fMCMother,AliMCEvent *mcEvent, Double_t fRapidityShift=0.);
     Bool_t MesonIsSelectedAODMC(AliAODMCParticle *MCMother,TClonesArray *AODMCArray, Double_t fRapidityShift=0.);
     Bool_t MesonIsSelectedMCAODESD(AliDalitzAODESDMC *fMCMother,AliDalitzEventMC *mcEvent, Double_t fRapidityShift=0.) const;
@@ -349,10 +362,16 @@ class AliConversionMesonCuts : public AliAnalysisCuts {
     Int_t       fNDaughterEnergyCut;            ///< if above is enabled, at least fNDaughterEnergyCut daughter contributing to neutral meson needs to fulfill fMinSingleDaughterE
     Float_t     fSingleDaughterMinE;            ///< if above is enabled, at least fNDaughterEnergyCut daughter contributing to neutral meson needs to fulfill fMinSingleDaughterE
 
+    std::vector<Double_t> fPairPt2;             //!<! pair kernel buffers, one entry per photon of the second array
+    std::vector<Double_t> fPairPz;              //!<!
+    std::vector<Double_t> fPairE;               //!<!
+    std::vector<Double_t> fPairDot;             //!<!
+    std::vector<Double_t> fPairMag2;            //!<!
+
   private:
 
     /// \cond CLASSIMP
-    ClassDef(AliConversionMesonCuts,49)
+    ClassDef(AliConversionMesonCuts,50)
     /// \endcond
 };
 
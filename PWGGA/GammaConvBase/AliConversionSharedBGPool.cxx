@@ -0,0 +1,203 @@
+/**************************************************************************
+ * Copyright(c) 1998-2021, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+////////////////////////////////////////////////
+//---------------------------------------------
+// Mixed event pool shared by the cut variations of a task
+//---------------------------------------------
+////////////////////////////////////////////////
+
+#include <iostream>
+#include "TCollection.h"
+#include "TMath.h"
+#include "AliAODConversionPhoton.h"
+#include "AliConversionSharedBGPool.h"
+
+using namespace std;
+
+//________________________________________________________________________
+AliConversionSharedBGPool::AliConversionSharedBGPool() :
+  fNCuts(0),
+  fNBins(),
+  fNSlots(),
+  fRings(),
+  fCounters(),
+  fEvents(),
+  fRefCount(),
+  fFreeEvents(),
+  fNEventsAdded(0),
+  fMaskScratch()
+{
+  // default constructor
+}
+
+//________________________________________________________________________
+AliConversionSharedBGPool::AliConversionSharedBGPool(Int_t nCuts) :
+  fNCuts(TMath::Min(TMath::Max(nCuts,0),64)),
+  fNBins(fNCuts,0),
+  fNSlots(fNCuts,0),
+  fRings(fNCuts),
+  fCounters(fNCuts),
+  fEvents(),
+  fRefCount(),
+  fFreeEvents(),
+  fNEventsAdded(0),
+  fMaskScratch()
+{
+  // the cuts have to be enabled with SetCut()
+}
+
+//________________________________________________________________________
+void AliConversionSharedBGPool::SetCut(Int_t iCut, Int_t nBins, Int_t nEvents)
+{
+  if(iCut < 0 || iCut >= fNCuts || nBins < 1 || nEvents < 1) return;
+  fNBins[iCut]  = nBins;
+  fNSlots[iCut] = nEvents;
+  fRings[iCut].assign(nBins*nEvents,-1);
+  fCounters[iCut].assign(nBins,0);
+}
+
+//________________________________________________________________________
+Bool_t AliConversionSharedBGPool::HasCut(Int_t iCut) const
+{
+  return (iCut >= 0 && iCut < fNCuts && fNSlots[iCut] > 0);
+}
+
+//________________________________________________________________________
+void AliConversionSharedBGPool::AddPhotons(vector<Photon> &photons, const TCollection *gammas, Int_t iCut)
+{
+  // photons already selected by another cut only get the bit of this cut
+
+  if(!gammas || iCut < 0 || iCut >= 64) return;
+  ULong64_t bit = ((ULong64_t)1) << iCut;
+  TIter next(gammas);
+  while(AliAODConversionPhoton *gamma = (AliAODConversionPhoton*)next()){
+    Photon photon;
+    photon.fPx            = gamma->Px();
+    photon.fPy            = gamma->Py();
+    photon.fPz            = gamma->Pz();
+    photon.fE             = gamma->E();
+    photon.fConvPoint[0]  = gamma->GetConversionX();
+    photon.fConvPoint[1]  = gamma->GetConversionY();
+    photon.fConvPoint[2]  = gamma->GetConversionZ();
+    photon.fLeadingCellID = gamma->GetLeadingCellID();
+    photon.fMCLabel       = gamma->GetNCaloPhotonMCLabels() > 0 ? gamma->GetCaloPhotonMCLabel(0) : -1;
+    photon.fCaloPhoton    = gamma->GetIsCaloPhoton();
+    photon.fCutMask       = bit;
+
+    Bool_t merged = kFALSE;
+    for(UInt_t i = 0; i < photons.size(); i++){
+      Photon &other = photons[i];
+      if(other.fLeadingCellID != photon.fLeadingCellID || (other.fCutMask & bit)) continue;
+      if(other.fE != photon.fE || other.fPx != photon.fPx || other.fPy != photon.fPy || other.fPz != photon.fPz) continue;
+      if(other.fCaloPhoton != photon.fCaloPhoton || other.fMCLabel != photon.fMCLabel) continue;
+      other.fCutMask |= bit;
+      merged = kTRUE;
+      break;
+    }
+    if(!merged) photons.push_back(photon);
+  }
+}
+
+//________________________________________________________________________
+void AliConversionSharedBGPool::FillPhoton(const Photon &photon, AliAODConversionPhoton *gamma)
+{
+  gamma->SetPxPyPzE(photon.fPx,photon.fPy,photon.fPz,photon.fE);
+  Double_t convPoint[3] = {photon.fConvPoint[0],photon.fConvPoint[1],photon.fConvPoint[2]};
+  gamma->SetConversionPoint(convPoint);
+  gamma->SetLeadingCellID(photon.fLeadingCellID);
+  gamma->SetCaloPhotonMCLabel(0,photon.fMCLabel);
+  gamma->SetNCaloPhotonMCLabels(photon.fMCLabel >= 0 ? 1 : 0);
+  gamma->fCaloPhoton = photon.fCaloPhoton;
+}
+
+//________________________________________________________________________
+void AliConversionSharedBGPool::AddEvent(const vector<Photon> &photons, const vector<Int_t> &cutBins)
+{
+  // store the event once and let the ring of every listed cut point to it
+
+  Int_t nCuts = TMath::Min((Int_t)cutBins.size(),fNCuts);
+  Int_t nRefs = 0;
+  for(Int_t iCut = 0; iCut < nCuts; iCut++){
+    if(HasCut(iCut) && cutBins[iCut] >= 0 && cutBins[iCut] < fNBins[iCut]) nRefs++;
+  }
+  if(nRefs == 0) return;
+
+  Int_t event = -1;
+  if(!fFreeEvents.empty()){
+    event = fFreeEvents.back();
+    fFreeEvents.pop_back();
+  } else {
+    event = fEvents.size();
+    fEvents.push_back(vector<Photon>());
+    fRefCount.push_back(0);
+  }
+  fEvents[event].assign(photons.begin(),photons.end());
+  fRefCount[event] = nRefs;
+  fNEventsAdded++;
+
+  for(Int_t iCut = 0; iCut < nCuts; iCut++){
+    Int_t bin = cutBins[iCut];
+    if(!HasCut(iCut) || bin < 0 || bin >= fNBins[iCut]) continue;
+    Int_t &counter = fCounters[iCut][bin];
+    if(counter >= fNSlots[iCut]) counter = 0;
+    Int_t &slot = fRings[iCut][bin*fNSlots[iCut]+counter];
+    if(slot >= 0 && --fRefCount[slot] == 0){
+      fEvents[slot].clear();
+      fFreeEvents.push_back(slot);
+    }
+    slot = event;
+    counter++;
+  }
+}
+
+//________________________________________________________________________
+void AliConversionSharedBGPool::GetMixingEvents(const vector<Int_t> &cutBins, vector<MixingEvent> &events) const
+{
+  // stored events to be mixed with the current one, each with the cuts for which it is in the current bin
+
+  events.clear();
+  fMaskScratch.assign(fEvents.size(),0);
+  Int_t nCuts = TMath::Min((Int_t)cutBins.size(),fNCuts);
+  for(Int_t iCut = 0; iCut < nCuts; iCut++){
+    Int_t bin = cutBins[iCut];
+    if(!HasCut(iCut) || bin < 0 || bin >= fNBins[iCut]) continue;
+    ULong64_t bit = ((ULong64_t)1) << iCut;
+    for(Int_t s = 0; s < fNSlots[iCut]; s++){
+      Int_t event = fRings[iCut][bin*fNSlots[iCut]+s];
+      if(event < 0) continue;
+      if(fMaskScratch[event] == 0){
+        MixingEvent mixingEvent = {event,0};
+        events.push_back(mixingEvent);
+      }
+      fMaskScratch[event] |= bit;
+    }
+  }
+  for(UInt_t i = 0; i < events.size(); i++) events[i].fCutMask = fMaskScratch[events[i].fEvent];
+}
+
+//________________________________________________________________________
+Long64_t AliConversionSharedBGPool::GetNStoredPhotons() const
+{
+  Long64_t nPhotons = 0;
+  for(UInt_t i = 0; i < fEvents.size(); i++) nPhotons += fEvents[i].size();
+  return nPhotons;
+}
+
+//________________________________________________________________________
+void AliConversionSharedBGPool::Print() const
+{
+  Int_t nActive = 0;
+  for(Int_t iCut = 0; iCut < fNCuts; iCut++) if(HasCut(iCut)) nActive++;
+  cout << "AliConversionSharedBGPool: " << nActive << " cuts, " << GetNStoredEvents() << " stored events with "
+       << GetNStoredPhotons() << " photons, " << fNEventsAdded << " events added" << endl;
+}
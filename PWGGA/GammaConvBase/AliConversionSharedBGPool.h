@@ -0,0 +1,84 @@
+#ifndef ALICONVERSIONSHAREDBGPOOL_H
+#define ALICONVERSIONSHAREDBGPOOL_H
+
+////////////////////////////////////////////////
+//---------------------------------------------
+// Mixed event pool shared by the cut variations of a task.
+// The photons of an event are stored once, each with the bitmask of the
+// cuts (index < 64) which selected it. Photons selected by several cuts
+// are merged if their leading cell, calo flag, MC label and 4-momentum
+// are identical. Every cut keeps its own ring of event references per
+// pool bin, so the events seen by a cut are the same as with a separate
+// background handler per cut; an event is released once no ring refers
+// to it anymore.
+//---------------------------------------------
+////////////////////////////////////////////////
+
+#include "Rtypes.h"
+#include <vector>
+
+class TCollection;
+class AliAODConversionPhoton;
+
+class AliConversionSharedBGPool {
+
+  public:
+
+    struct Photon{
+      Float_t   fPx;
+      Float_t   fPy;
+      Float_t   fPz;
+      Float_t   fE;
+      Float_t   fConvPoint[3];
+      Int_t     fLeadingCellID;
+      Int_t     fMCLabel;
+      Char_t    fCaloPhoton;
+      ULong64_t fCutMask;
+    };
+
+    // stored event with the cuts of the current event whose ring holds it
+    struct MixingEvent{
+      Int_t     fEvent;
+      ULong64_t fCutMask;
+    };
+
+    AliConversionSharedBGPool();
+    AliConversionSharedBGPool(Int_t nCuts);
+    ~AliConversionSharedBGPool() {}
+
+    void     SetCut(Int_t iCut, Int_t nBins, Int_t nEvents);
+    Bool_t   HasCut(Int_t iCut) const;
+    Int_t    GetNCuts()              const {return fNCuts;}
+
+    // merge the photons selected by a cut into the photons of the current event
+    static void AddPhotons(std::vector<Photon> &photons, const TCollection *gammas, Int_t iCut);
+    static void FillPhoton(const Photon &photon, AliAODConversionPhoton *gamma);
+
+    // cutBins[iCut] is the pool bin of the event for the cut, -1 if the cut does not store the event
+    void     AddEvent(const std::vector<Photon> &photons, const std::vector<Int_t> &cutBins);
+    void     GetMixingEvents(const std::vector<Int_t> &cutBins, std::vector<MixingEvent> &events) const;
+    const std::vector<Photon>& GetPhotons(Int_t event) const {return fEvents[event];}
+
+    Int_t    GetNStoredEvents()      const {return (Int_t)(fEvents.size()-fFreeEvents.size());}
+    Long64_t GetNStoredPhotons()     const;
+    Long64_t GetNEventsAdded()       const {return fNEventsAdded;}
+    void     Print() const;
+
+  private:
+
+    Int_t                              fNCuts;         // number of cuts, at most 64
+    std::vector<Int_t>                 fNBins;         // pool bins per cut
+    std::vector<Int_t>                 fNSlots;        // events per bin per cut
+    std::vector<std::vector<Int_t> >   fRings;         // stored event of each slot per cut, nBins*nSlots, -1 if empty
+    std::vector<std::vector<Int_t> >   fCounters;      // next slot per bin per cut
+    std::vector<std::vector<Photon> >  fEvents;        // photons of the stored events
+    std::vector<Int_t>                 fRefCount;      // ring slots referring to each stored event
+    std::vector<Int_t>                 fFreeEvents;    // released entries of fEvents
+    Long64_t                           fNEventsAdded;  // events added
+    mutable std::vector<ULong64_t>     fMaskScratch;   // cut mask per stored event used by GetMixingEvents()
+
+    AliConversionSharedBGPool(const AliConversionSharedBGPool&);
+    AliConversionSharedBGPool& operator=(const AliConversionSharedBGPool&);
+};
+
+#endif
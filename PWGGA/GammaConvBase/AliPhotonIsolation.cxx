@@ -57,6 +57,8 @@ AliPhotonIsolation::AliPhotonIsolation(const char *name, Int_t photonType) : Ali
   fMapClustertoPtR2(),
   fMapClustertoPtR3(),
   fMapClustertoPtR4(),
+  fUseConeGrid(kFALSE),
+  fTrackGrid(-1.,1.,20,63),
   fListHistos(NULL),
   fHistTest(NULL),
   fHistClusterEnergy(NULL),
@@ -170,6 +172,17 @@ void AliPhotonIsolation::ProcessEvent(AliVEvent *event){
 
   fHistTest->Fill(nClus);
 
+  // the tracks do not depend on the cluster, fill the grid once per event
+  if(fUseConeGrid){
+    fTrackGrid.Reset();
+    for (Int_t itr=0;itr<event->GetNumberOfTracks();itr++){
+      AliVTrack *inTrack = esdev ? (AliVTrack*)esdev->GetTrack(itr) : dynamic_cast<AliVTrack*>(aodev->GetTrack(itr));
+      if(!inTrack) continue;
+      fTrackGrid.Add(inTrack->Eta(),inTrack->Phi(),inTrack->Pt());
+    }
+    fTrackGrid.Build();
+  }
+
   //#########################################################################LOOP OVER CLUSTERS
   for(Int_t iclus=0;iclus < nClus;iclus++){ 
 
@@ -214,7 +227,13 @@ void AliPhotonIsolation::ProcessEvent(AliVEvent *event){
     }
 
     fHistClusterEnergy->Fill(ET_clus);
-      
+
+    if(fUseConeGrid){
+      const Float_t radii[4] = {0.1,0.2,0.3,0.4};
+      Float_t sums[4] = {0.,0.,0.,0.};
+      fTrackGrid.GetConeSums(eta_clus,phi_clus,4,radii,sums);
+      ptsum1 = sums[0]; ptsum2 = sums[1]; ptsum3 = sums[2]; ptsum4 = sums[3];
+    } else {
       //#########################################################################LOOP OVER TRACKS
       for (Int_t itr=0;itr<event->GetNumberOfTracks();itr++){ 
         if(debug){
@@ -277,6 +296,7 @@ void AliPhotonIsolation::ProcessEvent(AliVEvent *event){
       ptsum2+=ptsum1; //add pT of innerst cone to second cone
       ptsum3+=ptsum2; //add complete second to third
       ptsum4+=ptsum3; //add complete third to fourth
+    }
       
       if(debug){
         cout << "ptsum1:  " << ptsum1 << endl;
@@ -3,6 +3,7 @@
 #define ALIPHOTONISOLATION_H
 
 #include "AliAnalysisTaskSE.h"
+#include "AliIsolationConeGrid.h"
 #include <vector>
 #include <map>
 #include <utility>
@@ -26,6 +27,9 @@ class AliPhotonIsolation : public AliAnalysisTaskSE {
 
   Bool_t GetIsolation(Int_t clusterID, Float_t R, Float_t isoPt);
 
+  // cone sums from an eta-phi grid of the tracks instead of looping over all tracks per cluster
+  void SetUseConeGrid(Bool_t use = kTRUE) {fUseConeGrid = use;}
+
  private:
 
   AliPhotonIsolation (const AliPhotonIsolation&); // not implemented
@@ -49,6 +53,8 @@ class AliPhotonIsolation : public AliAnalysisTaskSE {
   map<Int_t,Float_t> fMapClustertoPtR2;    //! Map cluster ID to pTsum in cone R=0.2
   map<Int_t,Float_t> fMapClustertoPtR3;    //! Map cluster ID to pTsum in cone R=0.3
   map<Int_t,Float_t> fMapClustertoPtR4;    //! Map cluster ID to pTsum in cone R=0.4
+  Bool_t                fUseConeGrid;      // cone sums from fTrackGrid
+  AliIsolationConeGrid  fTrackGrid;        //! eta-phi grid of the tracks of the event
 
   //histos
   TList*                fListHistos;             //! list with histogram(s)
@@ -56,7 +62,7 @@ class AliPhotonIsolation : public AliAnalysisTaskSE {
   TH1F*                 fHistClusterEnergy;      //!
   TH1F*                 fHistIso;                //!
 
-  ClassDef(AliPhotonIsolation,1)
+  ClassDef(AliPhotonIsolation,2)
     };
 
 #endif
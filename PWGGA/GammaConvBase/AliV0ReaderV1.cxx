@@ -68,6 +68,9 @@
 #include "AliAODMCParticle.h"
 #include "AliPIDResponse.h"
 #include "TChain.h"
+#include "TStopwatch.h"
+#include "TH1D.h"
+#include <thread>
 #include "TFile.h"
 #include "TString.h"
 #include "TMatrixD.h"
@@ -167,7 +170,13 @@ AliV0ReaderV1::AliV0ReaderV1(const char *name) : AliAnalysisTaskSE(name),
   fImpactParamTree(NULL),
   fVectorFoundGammas(0),
   fCurrentFileName(""),
-  fMCFileChecked(kFALSE)
+  fMCFileChecked(kFALSE),
+  fNThreadsV0Finding(1),
+  fProduceTimingHistograms(kFALSE),
+  fTimingHistograms(NULL),
+  fHistoStageTiming(NULL),
+  fHistoTimeVsNV0s(NULL),
+  fV0Geometry()
 {
   // Default constructor
 
@@ -424,6 +433,28 @@ void AliV0ReaderV1::UserCreateOutputObjects()
     fImpactParamHistograms->Add(fImpactParamTree);
   }
 
+  if (fProduceTimingHistograms){
+    if(fTimingHistograms != NULL){
+      delete fTimingHistograms;
+      fTimingHistograms = NULL;
+    }
+    fTimingHistograms = new TList();
+    fTimingHistograms->SetOwner(kTRUE);
+    fTimingHistograms->SetName(Form("V0ReaderTiming_%s_%s",fEventCuts->GetCutNumber().Data(),fConversionCuts->GetCutNumber().Data()));
+
+    fHistoStageTiming = new TH1D("V0ReaderStageTiming","real time per processing stage",3,-0.5,2.5);
+    fHistoStageTiming->GetXaxis()->SetBinLabel(1,"conv. point + psi pair");
+    fHistoStageTiming->GetXaxis()->SetBinLabel(2,"selection");
+    fHistoStageTiming->GetXaxis()->SetBinLabel(3,"total");
+    fHistoStageTiming->SetYTitle("summed real time (#mus)");
+    fTimingHistograms->Add(fHistoStageTiming);
+
+    fHistoTimeVsNV0s = new TH2F("V0ReaderTimeVsNV0s","real time of the V0 processing vs number of V0s",100,0,2000,200,0,20000);
+    fHistoTimeVsNV0s->SetXTitle("number of V0s");
+    fHistoTimeVsNV0s->SetYTitle("real time (#mus)");
+    fTimingHistograms->Add(fHistoTimeVsNV0s);
+  }
+
   if (fProduceV0findingEffi){
     TH1::AddDirectory(kFALSE);
     if(fHistograms != NULL){
@@ -782,6 +813,21 @@ Bool_t AliV0ReaderV1::ProcessESDV0s()
   AliKFConversionPhoton *fCurrentMotherKFCandidate=NULL;
 
   if(fESDEvent){
+    TStopwatch stageWatch;
+    TStopwatch totalWatch;
+    if(fHistoStageTiming){
+      totalWatch.Start(kTRUE);
+      stageWatch.Start(kTRUE);
+    }
+    fV0Geometry.clear();
+    if(fNThreadsV0Finding > 1){
+      PrepareV0Geometry(fESDEvent);
+      if(fHistoStageTiming){
+        fHistoStageTiming->Fill(0.,1.e6*stageWatch.RealTime());
+        stageWatch.Start(kTRUE);
+      }
+    }
+
     for(Int_t currentV0Index=0;currentV0Index<fESDEvent->GetNumberOfV0s();currentV0Index++){
       AliESDv0 *fCurrentV0=(AliESDv0*)(fESDEvent->GetV0(currentV0Index));
       if(!fCurrentV0){
@@ -809,11 +855,88 @@ Bool_t AliV0ReaderV1::ProcessESDV0s()
         fCurrentMotherKFCandidate=NULL;
       }
     }
+    fV0Geometry.clear();
     if(kAddv0sInESDFilter){fPCMv0BitField->Compact();}
+    if(fHistoStageTiming){
+      fHistoStageTiming->Fill(1.,1.e6*stageWatch.RealTime());
+      Double_t totalTime = 1.e6*totalWatch.RealTime();
+      fHistoStageTiming->Fill(2.,totalTime);
+      if(fHistoTimeVsNV0s) fHistoTimeVsNV0s->Fill(fESDEvent->GetNumberOfV0s(),totalTime);
+    }
   }
   return kTRUE;
 }
 
+///________________________________________________________________________
+void AliV0ReaderV1::PrepareV0Geometry(AliESDEvent *esdEvent)
+{
+  // Compute the conversion point and the psi pair of the V0 candidates in fNThreadsV0Finding threads.
+  // The selection runs afterwards in ReconstructV0() in the V0 order, so that the photons, the cut
+  // histograms and their order do not depend on the number of threads
+
+  Int_t nV0s = esdEvent->GetNumberOfV0s();
+  fV0Geometry.assign(nV0s*kNGeoValues,0.);
+
+  // the event and the cuts are accessed only here, in the main thread
+  vector<Int_t> v0Indices;
+  vector<const AliESDv0*> v0s;
+  vector<const AliExternalTrackParam*> params;
+  v0Indices.reserve(nV0s);
+  v0s.reserve(nV0s);
+  params.reserve(2*nV0s);
+  for(Int_t iV0=0;iV0<nV0s;iV0++){
+    AliESDv0 *v0 = esdEvent->GetV0(iV0);
+    if(!v0 || !fConversionCuts->SelectV0Finder(v0->GetOnFlyStatus())) continue;
+    Int_t trackLabels[2] = {-1,-1};
+    const AliExternalTrackParam *pparam = GetExternalTrackParamP(v0,trackLabels[0]);
+    const AliExternalTrackParam *nparam = GetExternalTrackParamN(v0,trackLabels[1]);
+    if(!pparam || !nparam) continue;
+    v0Indices.push_back(iV0);
+    v0s.push_back(v0);
+    params.push_back(pparam);
+    params.push_back(nparam);
+  }
+
+  Int_t nCandidates = v0Indices.size();
+  Int_t nThreads    = TMath::Min(fNThreadsV0Finding, nCandidates/kMinV0sPerThread);
+  if(nThreads <= 1){
+    ComputeV0Geometry(&v0Indices,&v0s,&params,0,nCandidates);
+    return;
+  }
+  vector<std::thread> workers;
+  for(Int_t iThread=0;iThread<nThreads;iThread++){
+    Int_t first = iThread*nCandidates/nThreads;
+    Int_t last  = (iThread+1)*nCandidates/nThreads;
+    workers.push_back(std::thread(&AliV0ReaderV1::ComputeV0Geometry,this,&v0Indices,&v0s,&params,first,last));
+  }
+  for(UInt_t iThread=0;iThread<workers.size();iThread++) workers[iThread].join();
+}
+
+///________________________________________________________________________
+void AliV0ReaderV1::ComputeV0Geometry(const vector<Int_t> *v0Indices, const vector<const AliESDv0*> *v0s,
+                                      const vector<const AliExternalTrackParam*> *params, Int_t first, Int_t last)
+{
+  // Conversion point, DCA and psi pair of the candidates [first,last), as computed in ReconstructV0()
+
+  for(Int_t i=first;i<last;i++){
+    const AliExternalTrackParam *pparam = (*params)[2*i];
+    const AliExternalTrackParam *nparam = (*params)[2*i+1];
+    Double_t *geometry = &fV0Geometry[(*v0Indices)[i]*kNGeoValues];
+
+    Double_t convpos[3] = {0,0,0};
+    Double_t dca[2]     = {0,0};
+    Bool_t   ok         = kTRUE;
+    if(fImprovedPsiPair == 0) geometry[kGeoPsiPair] = GetPsiPair((*v0s)[i],pparam,nparam,convpos);
+    if(fUseOwnXYZCalculation) ok = GetConversionPoint(pparam,nparam,convpos,dca);
+    if(ok && fImprovedPsiPair >= 1) geometry[kGeoPsiPair] = GetPsiPair((*v0s)[i],pparam,nparam,convpos);
+
+    for(Int_t k=0;k<3;k++) geometry[kGeoConvX+k] = convpos[k];
+    geometry[kGeoDCAXY]  = dca[0];
+    geometry[kGeoDCAZ]   = dca[1];
+    geometry[kGeoStatus] = ok ? 1. : -1.;
+  }
+}
+
 ///________________________________________________________________________
 AliKFConversionPhoton *AliV0ReaderV1::ReconstructV0(AliESDv0 *fCurrentV0,Int_t currentV0Index)
 {
@@ -924,10 +1047,14 @@ AliKFConversionPhoton *AliV0ReaderV1::ReconstructV0(AliESDv0 *fCurrentV0,Int_t c
     primaryVertexImproved+=*fCurrentMotherKF;
     fCurrentMotherKF->SetProductionVertex(primaryVertexImproved);
   }
+  // geometry computed in PrepareV0Geometry(), if any
+  const Double_t *geometry = 0x0;
+  if(!fV0Geometry.empty() && fV0Geometry[currentV0Index*kNGeoValues+kGeoStatus] != 0.) geometry = &fV0Geometry[currentV0Index*kNGeoValues];
+
   // SetPsiPair
   Double_t convpos[3]={0,0,0};
   if (fImprovedPsiPair == 0){
-    Double_t PsiPair=GetPsiPair(fCurrentV0,fCurrentExternalTrackParamPositive,fCurrentExternalTrackParamNegative, convpos);
+    Double_t PsiPair=geometry ? geometry[kGeoPsiPair] : GetPsiPair(fCurrentV0,fCurrentExternalTrackParamPositive,fCurrentExternalTrackParamNegative, convpos);
     fCurrentMotherKF->SetPsiPair(PsiPair);
   }
 
@@ -935,7 +1062,16 @@ AliKFConversionPhoton *AliV0ReaderV1::ReconstructV0(AliESDv0 *fCurrentV0,Int_t c
   Double_t dca[2]={0,0};
   if(fUseOwnXYZCalculation){
     //    Double_t convpos[3]={0,0,0};
-    if(!GetConversionPoint(fCurrentExternalTrackParamPositive,fCurrentExternalTrackParamNegative,convpos,dca)){
+    Bool_t convPointOK = kFALSE;
+    if(geometry){
+      convPointOK = (geometry[kGeoStatus] > 0.);
+      for(Int_t k=0;k<3;k++) convpos[k] = geometry[kGeoConvX+k];
+      dca[0] = geometry[kGeoDCAXY];
+      dca[1] = geometry[kGeoDCAZ];
+    } else {
+      convPointOK = GetConversionPoint(fCurrentExternalTrackParamPositive,fCurrentExternalTrackParamNegative,convpos,dca);
+    }
+    if(!convPointOK){
       fConversionCuts->FillPhotonCutIndex(AliConversionPhotonCuts::kConvPointFail);
       delete fCurrentMotherKF;
       fCurrentMotherKF=NULL;
@@ -949,7 +1085,7 @@ AliKFConversionPhoton *AliV0ReaderV1::ReconstructV0(AliESDv0 *fCurrentV0,Int_t c
   // SetPsiPair
    if (fImprovedPsiPair >= 1){
      // the propagation can be more precise after the precise conversion point calculation
-     Double_t PsiPair=GetPsiPair(fCurrentV0,fCurrentExternalTrackParamPositive,fCurrentExternalTrackParamNegative,convpos);
+     Double_t PsiPair=geometry ? geometry[kGeoPsiPair] : GetPsiPair(fCurrentV0,fCurrentExternalTrackParamPositive,fCurrentExternalTrackParamNegative,convpos);
      fCurrentMotherKF->SetPsiPair(PsiPair);
      //cout<<" GetPsiPair::"<<fCurrentMotherKF->GetPsiPair() <<endl;
    }
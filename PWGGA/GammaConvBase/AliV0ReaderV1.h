@@ -25,6 +25,7 @@ class TList;
 class AliKFConversionPhoton;
 class TString;
 class TClonesArray;
+class TH1D;
 class TH1F;
 class TH2F;
 class AliAODConversionPhoton;
@@ -163,6 +164,10 @@ class AliV0ReaderV1 : public AliAnalysisTaskSE {
 
     Bool_t             GetProduceImpactParamHistograms()                {return fProduceImpactParamHistograms;}
     TList*             GetImpactParamHistograms()                       {return fImpactParamHistograms;}
+    void               SetNThreadsV0Finding(Int_t n)                    {fNThreadsV0Finding = (n<1 ? 1 : n); return;}
+    Int_t              GetNThreadsV0Finding()                           {return fNThreadsV0Finding;}
+    void               SetProduceTimingHistograms(Bool_t b)             {fProduceTimingHistograms = b; return;}
+    TList*             GetTimingHistograms()                            {return fTimingHistograms;}
 
     Bool_t             ParticleIsConvertedPhoton(AliMCEvent *mcEvent, TParticle *particle, Double_t etaMax, Double_t rMax, Double_t zMax);
     void               CreatePureMCHistosForV0FinderEffiESD();
@@ -200,6 +205,13 @@ class AliV0ReaderV1 : public AliAnalysisTaskSE {
     Bool_t               GetHelixCenter(const AliExternalTrackParam *track, Double_t center[2]);
     Double_t             GetPsiPair(const AliESDv0* v0, const AliExternalTrackParam *positiveparam, const AliExternalTrackParam *negativeparam, const Double_t convpos[3]) const;
 
+    // conversion point and psi pair of the ESD V0s computed in parallel before the selection
+    enum V0Geometry { kGeoStatus=0, kGeoConvX, kGeoConvY, kGeoConvZ, kGeoDCAXY, kGeoDCAZ, kGeoPsiPair, kNGeoValues };
+    enum { kMinV0sPerThread=32 };
+    void                 PrepareV0Geometry(AliESDEvent *esdEvent);
+    void                 ComputeV0Geometry(const std::vector<Int_t> *v0Indices, const std::vector<const AliESDv0*> *v0s,
+                                           const std::vector<const AliExternalTrackParam*> *params, Int_t first, Int_t last);
+
 
     Bool_t         kAddv0sInESDFilter;            // Add PCM v0s to AOD created in ESD filter
     TBits		   *fPCMv0BitField;               //! Pointer to bitfield of PCM v0s
@@ -288,13 +300,19 @@ class AliV0ReaderV1 : public AliAnalysisTaskSE {
     vector<Int_t>  fVectorFoundGammas;            //! vector with found MC labels of gammas
     TString       fCurrentFileName;               //! current file name
     Bool_t        fMCFileChecked;                 //!
+    Int_t         fNThreadsV0Finding;             // number of threads for the conversion point and psi pair of the ESD V0s
+    Bool_t        fProduceTimingHistograms;       // enable the timing histograms of the V0 processing stages
+    TList        *fTimingHistograms;              //! list of timing histograms
+    TH1D         *fHistoStageTiming;              //! summed real time of each processing stage (us)
+    TH2F         *fHistoTimeVsNV0s;               //! real time of ProcessESDV0s vs number of V0s
+    vector<Double_t> fV0Geometry;                 //! precomputed geometry of the V0s, kNGeoValues per V0 (status 0: not computed)
 
   private:
     AliV0ReaderV1(AliV0ReaderV1 &original);
     AliV0ReaderV1 &operator=(const AliV0ReaderV1 &ref);
 
 
-    ClassDef(AliV0ReaderV1, 25)
+    ClassDef(AliV0ReaderV1, 26)
 
 };
 
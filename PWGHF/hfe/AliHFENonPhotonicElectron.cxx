@@ -34,6 +34,9 @@
 #include "TList.h"
 #include "TDatabasePDG.h"
 
+#include <algorithm>
+#include <map>
+
 #include "AliVEvent.h"
 #include "AliMCEvent.h"
 #include "AliESDEvent.h"
@@ -59,6 +62,7 @@
 #include "AliHFEmcQA.h"
 
 #include "AliHFENonPhotonicElectron.h"
+#include "AliAnalysisManager.h"
 
 ClassImp(AliHFENonPhotonicElectron)
     //________________________________________________________________________
@@ -92,7 +96,11 @@ ClassImp(AliHFENonPhotonicElectron)
     ,fITSnSigmaLow(-3.)
     ,fminPt(0.1)
     ,fEtaDalitzWeightFactor(1.0)
-    ,fArraytrack		(NULL)
+    ,fSharedPoolName()
+    ,fPrefilterMass(-1.)
+    ,fPrefilterDeltaEta(-1.)
+    ,fPartners()
+    ,fPoolFilled(kFALSE)
     ,fCounterPoolBackground	(0)
     ,fnumberfound			(0)
     ,fListOutput		(NULL)
@@ -150,7 +158,11 @@ ClassImp(AliHFENonPhotonicElectron)
     ,fITSnSigmaLow(-3.)
     ,fminPt(0.1)
     ,fEtaDalitzWeightFactor(1.0)
-    ,fArraytrack		(NULL)
+    ,fSharedPoolName()
+    ,fPrefilterMass(-1.)
+    ,fPrefilterDeltaEta(-1.)
+    ,fPartners()
+    ,fPoolFilled(kFALSE)
     ,fCounterPoolBackground	(0)
     ,fnumberfound			(0)
     ,fListOutput		(NULL)
@@ -208,7 +220,11 @@ ClassImp(AliHFENonPhotonicElectron)
     ,fITSnSigmaLow(ref.fITSnSigmaLow)
     ,fminPt(ref.fminPt)
     ,fEtaDalitzWeightFactor(ref.fEtaDalitzWeightFactor)
-    ,fArraytrack		(NULL)
+    ,fSharedPoolName(ref.fSharedPoolName)
+    ,fPrefilterMass(ref.fPrefilterMass)
+    ,fPrefilterDeltaEta(ref.fPrefilterDeltaEta)
+    ,fPartners()
+    ,fPoolFilled(kFALSE)
     ,fCounterPoolBackground	(0)
     ,fnumberfound			(0)
     ,fListOutput		(ref.fListOutput)
@@ -249,7 +265,6 @@ AliHFENonPhotonicElectron::~AliHFENonPhotonicElectron()
     //
     // Destructor
     //
-    if(fArraytrack)		delete fArraytrack;
     //if(fHFEBackgroundCuts)	delete fHFEBackgroundCuts;
     if(fPIDBackground)		delete fPIDBackground;
     if(fPIDBackgroundQA)		delete fPIDBackgroundQA;
@@ -567,15 +582,23 @@ Int_t AliHFENonPhotonicElectron::FillPoolAssociatedTracks(AliVEvent *inputEvent,
     fHFEBackgroundCuts->SetRecEvent(inputEvent);
     Int_t nbtracks = inputEvent->GetNumberOfTracks();
 
-    if( fArraytrack ){
-        fArraytrack->~TArrayI();
-        new(fArraytrack) TArrayI(nbtracks);
-    } else {
-        fArraytrack = new TArrayI(nbtracks);
-    }
-
+    fPartners.clear();
+    fPoolFilled = kTRUE;
     fCounterPoolBackground = 0;
 
+    // pool already selected in this event by an instance with the same partner cuts
+    std::vector<Partner> *shared = NULL;
+    if(!fSharedPoolName.IsNull()){
+        Bool_t filled(kFALSE);
+        shared = GetSharedPool(fSharedPoolName, inputEvent, binct, filled);
+        if(filled){
+            fPartners = *shared;
+            fCounterPoolBackground = fPartners.size();
+            return fCounterPoolBackground;
+        }
+    }
+
+    static const Double_t eMass = TDatabasePDG::Instance()->GetParticle(11)->Mass();
     Bool_t isSelected(kFALSE);
     Bool_t isAOD = (dynamic_cast<AliAODEvent *>(inputEvent) != NULL);
     AliDebug(2, Form("isAOD: %s", isAOD ? "yes" : "no"));
@@ -590,10 +613,18 @@ Int_t AliHFENonPhotonicElectron::FillPoolAssociatedTracks(AliVEvent *inputEvent,
 
         if(isSelected){
             AliDebug(2,Form("fCounterPoolBackground %d, track %d",fCounterPoolBackground,k));
-            fArraytrack->AddAt(k,fCounterPoolBackground);
+            Partner partner;
+            partner.fIndex = k;
+            partner.fCharge = track->Charge();
+            partner.fEta = track->Eta();
+            track->PxPyPz(partner.fP);
+            partner.fE = TMath::Sqrt(partner.fP[0]*partner.fP[0] + partner.fP[1]*partner.fP[1] + partner.fP[2]*partner.fP[2] + eMass*eMass);
+            fPartners.push_back(partner);
             fCounterPoolBackground++;
         }
     } // loop tracks
+    std::sort(fPartners.begin(), fPartners.end());
+    if(shared) *shared = fPartners;
 
     //printf(Form("Associated Pool: Tracks %d, fCounterPoolBackground %d \n", nbtracks, fCounterPoolBackground));
 
@@ -601,6 +632,34 @@ Int_t AliHFENonPhotonicElectron::FillPoolAssociatedTracks(AliVEvent *inputEvent,
 
 }
 
+//_____________________________________________________________________________________________
+std::vector<AliHFENonPhotonicElectron::Partner> *AliHFENonPhotonicElectron::GetSharedPool(const TString &name, const AliVEvent *inputEvent, Int_t binct, Bool_t &filled)
+{
+    //
+    // Pool of associated tracks shared by the instances with the same pool name
+    // filled is kTRUE if the pool was already selected for this event
+    //
+    struct SharedPool {
+        const AliVEvent     *fEvent;            // event of the pool
+        Long64_t            fEntry;             // entry of the analysis manager
+        Int_t               fBinct;             // centrality bin used by the PID
+        std::vector<Partner> fPartners;         // selected associated tracks
+    };
+    static std::map<TString, SharedPool> pools;
+
+    AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+    const Long64_t entry = mgr ? mgr->GetCurrentEntry() : -1;
+    SharedPool &pool = pools[name];
+    filled = (entry >= 0 && pool.fEvent == inputEvent && pool.fEntry == entry && pool.fBinct == binct);
+    if(!filled){
+        pool.fEvent = inputEvent;
+        pool.fEntry = entry;
+        pool.fBinct = binct;
+        pool.fPartners.clear();
+    }
+    return &pool.fPartners;
+}
+
 //_____________________________________________________________________________________________
 Int_t AliHFENonPhotonicElectron::CountPoolAssociated(AliVEvent *inputEvent, Int_t binct)
 {
@@ -617,7 +676,7 @@ Int_t AliHFENonPhotonicElectron::CountPoolAssociated(AliVEvent *inputEvent, Int_
         AliVTrack *track2 = 0x0;
 
         for(Int_t ii = 0; ii < fCounterPoolBackground; ii++){
-            iTrack2 = fArraytrack->At(ii);
+            iTrack2 = fPartners[ii].fIndex;
             AliDebug(2,Form("track %d",iTrack2));
             track2 = (AliVTrack *)inputEvent->GetTrack(iTrack2);
 
@@ -674,7 +733,7 @@ Int_t AliHFENonPhotonicElectron::LookAtNonHFE(Int_t iTrack1, AliVTrack *track1,
     Int_t taggedphotonic = -1;
 
     AliDebug(2,Form("fCounterPoolBackground %d in LookAtNonHFE!!!",fCounterPoolBackground));
-    if(!fArraytrack) return taggedphotonic;
+    if(!fPoolFilled) return taggedphotonic;
     AliDebug(2,Form("process track %d",iTrack1));
     AliDebug(1,Form("Inclusive source is %d\n", source));
 
@@ -733,137 +792,167 @@ Int_t AliHFENonPhotonicElectron::LookAtNonHFE(Int_t iTrack1, AliVTrack *track1,
 
     //printf(Form("Inclusive Pool: TrackNr. %d, fnumberfound %d \n", iTrack1, fnumberfound));
 
-    for(Int_t idex = 0; idex < fCounterPoolBackground; idex++){
-        iTrack2 = fArraytrack->At(idex);
-        AliDebug(2,Form("track %d",iTrack2));
-        track2 = (AliVTrack *)vEvent->GetTrack(iTrack2);
-
-        if(!track2){
-            //printf("ERROR: Could not receive track %d", iTrack2);
-            continue;
+    // partners of each charge, in the eta window of the prefilter
+    static const Double_t eMass = TDatabasePDG::Instance()->GetParticle(11)->Mass();
+    Double_t p1[3];
+    track1->PxPyPz(p1);
+    const Double_t e1 = TMath::Sqrt(p1[0]*p1[0] + p1[1]*p1[1] + p1[2]*p1[2] + eMass*eMass);
+    const Double_t eta1 = track1->Eta();
+    for(UInt_t groupBegin = 0; groupBegin < fPartners.size(); ){
+        Partner key = fPartners[groupBegin];
+        key.fEta = 1.e30;
+        const UInt_t groupEnd = std::upper_bound(fPartners.begin() + groupBegin, fPartners.end(), key) - fPartners.begin();
+        UInt_t first = groupBegin, last = groupEnd;
+        if(fPrefilterDeltaEta >= 0.){
+            key.fEta = eta1 - fPrefilterDeltaEta;
+            first = std::lower_bound(fPartners.begin() + groupBegin, fPartners.begin() + groupEnd, key) - fPartners.begin();
+            key.fEta = eta1 + fPrefilterDeltaEta;
+            last = std::upper_bound(fPartners.begin() + first, fPartners.begin() + groupEnd, key) - fPartners.begin();
         }
+        groupBegin = groupEnd;
 
-        fCharge2 = track2->Charge();		//Charge from track2
-
-        // Reset the MC info
-        //valueAngle[2] = source;
-        valueradius[3] = source;
-        valueSign[4] = source;
-        valueSign[6] = track2->Pt();
-        valueSign[8] = track2->Eta();
-
-        // track cuts and PID already done
-
-        // Checking if it is the same Track!
-        if(iTrack2==iTrack1) continue;
-        AliDebug(2,"Different");
-
-        // if MC look
-        if(fMCEvent || fAODArrayMCInfo){
-            AliDebug(2, "Checking for source");
-            source2	 = FindMother(TMath::Abs(track2->GetLabel()), indexmother2);
-            AliDebug(2, Form("source is %d", source2));
-            AliDebug(2, Form("sourceindex is %i", indexmother2));
-            AliDebug(2, Form("getlabel: %i", track2->GetLabel()));
-            pdg2	 = CheckPdg(TMath::Abs(track2->GetLabel()));
-
-            if(source == kElectronfromconversion){
-                AliDebug(2, Form("Electron from conversion (source %d), paired with source %d", source, source2));
-                AliDebug(2, Form("Index of the mothers: incl %d, associated %d", indexmother, indexmother2));
-                AliDebug(2, Form("PDGs: incl %d, associated %d", pdg1, pdg2));
+        for(UInt_t idex = first; idex < last; idex++){
+            const Partner &partner = fPartners[idex];
+            iTrack2 = partner.fIndex;
+
+            // Checking if it is the same Track!
+            if(iTrack2==iTrack1) continue;
+            AliDebug(2,"Different");
+
+            // mass of the momenta at the primary vertex before the pair fit
+            if(fPrefilterMass >= 0.){
+                const Double_t e = e1 + partner.fE;
+                const Double_t px = p1[0] + partner.fP[0], py = p1[1] + partner.fP[1], pz = p1[2] + partner.fP[2];
+                if(e*e - px*px - py*py - pz*pz > fPrefilterMass*fPrefilterMass) continue;
             }
 
-            if(source2 >=0 ){
-                AliDebug(1,"------------------------------------ \n");
-                if((indexmother2 == indexmother) && (source == source2) && ((pdg1*pdg2)<0.0)){
-                    AliDebug(1, "Real pair");
-                    switch(source){
-                        case kElectronfromconversion: 
-                            valueSign[4] = kElectronfromconversionboth; 
-                            valueradius[3] = kElectronfromconversionboth;
-                            break;
-                        case kElectronfrompi0: 
-                            valueSign[4] = kElectronfrompi0both; 
-                            valueradius[3] = kElectronfrompi0both;
-                            break;
-                        case kElectronfrometa:
-                            valueSign[4] = kElectronfrometaboth;
-                            valueradius[3] = kElectronfrometaboth;
-                            break;
-                        case kElectronfromomega:
-                            valueSign[4] = kElectronfromomegaboth;
-                            valueradius[3] = kElectronfromomegaboth;
-                            break;
-                    };
-                }
+            AliDebug(2,Form("track %d",iTrack2));
+            track2 = (AliVTrack *)vEvent->GetTrack(iTrack2);
+
+            if(!track2){
+                //printf("ERROR: Could not receive track %d", iTrack2);
+                continue;
+            }
 
-                if(fAnaPairGen){
+            fCharge2 = track2->Charge();		//Charge from track2
 
-                    Int_t MotherArray1[fNumberofGenerations];
-                    Int_t MotherArray2[fNumberofGenerations];
-                    for(Int_t i = 0; i < fNumberofGenerations;++i){
-                        MotherArray1[i]=-1;
-                        MotherArray2[i]=-1;
+            // Reset the MC info
+            //valueAngle[2] = source;
+            valueradius[3] = source;
+            valueSign[4] = source;
+            valueSign[6] = track2->Pt();
+            valueSign[8] = track2->Eta();
+            valueSign[5] = -1;
+
+            // track cuts and PID already done
+
+            // if MC look
+            if(fMCEvent || fAODArrayMCInfo){
+                AliDebug(2, "Checking for source");
+                source2	 = FindMother(TMath::Abs(track2->GetLabel()), indexmother2);
+                AliDebug(2, Form("source is %d", source2));
+                AliDebug(2, Form("sourceindex is %i", indexmother2));
+                AliDebug(2, Form("getlabel: %i", track2->GetLabel()));
+                pdg2	 = CheckPdg(TMath::Abs(track2->GetLabel()));
+
+                if(source == kElectronfromconversion){
+                    AliDebug(2, Form("Electron from conversion (source %d), paired with source %d", source, source2));
+                    AliDebug(2, Form("Index of the mothers: incl %d, associated %d", indexmother, indexmother2));
+                    AliDebug(2, Form("PDGs: incl %d, associated %d", pdg1, pdg2));
+                }
+
+                if(source2 >=0 ){
+                    AliDebug(1,"------------------------------------ \n");
+                    if((indexmother2 == indexmother) && (source == source2) && ((pdg1*pdg2)<0.0)){
+                        AliDebug(1, "Real pair");
+                        switch(source){
+                            case kElectronfromconversion: 
+                                valueSign[4] = kElectronfromconversionboth; 
+                                valueradius[3] = kElectronfromconversionboth;
+                                break;
+                            case kElectronfrompi0: 
+                                valueSign[4] = kElectronfrompi0both; 
+                                valueradius[3] = kElectronfrompi0both;
+                                break;
+                            case kElectronfrometa:
+                                valueSign[4] = kElectronfrometaboth;
+                                valueradius[3] = kElectronfrometaboth;
+                                break;
+                            case kElectronfromomega:
+                                valueSign[4] = kElectronfromomegaboth;
+                                valueradius[3] = kElectronfromomegaboth;
+                                break;
+                        };
                     }
-                    FillMotherArray(TMath::Abs(track1->GetLabel()),0,MotherArray1,fNumberofGenerations);
-                    FillMotherArray(TMath::Abs(track2->GetLabel()),0,MotherArray2,fNumberofGenerations);
-                    AliDebug(2,Form(" indextrack inclusive: %i pdg: %i || indextrack assoc: %i pdg: %i \n",track1->GetLabel(),pdg1 , track2->GetLabel(),pdg2));
-                    AliDebug(2,Form(" Mother Gen 1: %i || Mother Gen 1: %i	 \n", MotherArray1[0],MotherArray2[0]));
-                    AliDebug(2,Form(" Mother Gen 2: %i || Mother Gen 2: %i	 \n", MotherArray1[1],MotherArray2[1]));
-                    AliDebug(2,Form(" Mother Gen 3: %i || Mother Gen 3: %i	 \n", MotherArray1[2],MotherArray2[2]));
-                    AliDebug(2,Form(" Mother Gen 4: %i || Mother Gen 4: %i	 \n", MotherArray1[3],MotherArray2[3]));
-                    valueSign[5] = FindGeneration(MotherArray1,MotherArray2,fNumberofGenerations);
-                } 
+
+                    if(fAnaPairGen){
+
+                        Int_t MotherArray1[fNumberofGenerations];
+                        Int_t MotherArray2[fNumberofGenerations];
+                        for(Int_t i = 0; i < fNumberofGenerations;++i){
+                            MotherArray1[i]=-1;
+                            MotherArray2[i]=-1;
+                        }
+                        FillMotherArray(TMath::Abs(track1->GetLabel()),0,MotherArray1,fNumberofGenerations);
+                        FillMotherArray(TMath::Abs(track2->GetLabel()),0,MotherArray2,fNumberofGenerations);
+                        AliDebug(2,Form(" indextrack inclusive: %i pdg: %i || indextrack assoc: %i pdg: %i \n",track1->GetLabel(),pdg1 , track2->GetLabel(),pdg2));
+                        AliDebug(2,Form(" Mother Gen 1: %i || Mother Gen 1: %i	 \n", MotherArray1[0],MotherArray2[0]));
+                        AliDebug(2,Form(" Mother Gen 2: %i || Mother Gen 2: %i	 \n", MotherArray1[1],MotherArray2[1]));
+                        AliDebug(2,Form(" Mother Gen 3: %i || Mother Gen 3: %i	 \n", MotherArray1[2],MotherArray2[2]));
+                        AliDebug(2,Form(" Mother Gen 4: %i || Mother Gen 4: %i	 \n", MotherArray1[3],MotherArray2[3]));
+                        valueSign[5] = FindGeneration(MotherArray1,MotherArray2,fNumberofGenerations);
+                    } 
+                }
             }
-        }
 
-        if(fAlgorithmMA){
-            // Use TLorentzVector
-            if(!MakePairDCA(track1, track2, vEvent, (aodeventu != NULL), invmass, angle)) continue;
-        } else {
-            // Use AliKF package
-            if(!MakePairKF(track1, track2, primV, invmass, angle)) continue;
-        }
+            if(fAlgorithmMA){
+                // Use TLorentzVector
+                if(!MakePairDCA(track1, track2, vEvent, (aodeventu != NULL), invmass, angle)) continue;
+            } else {
+                // Use AliKF package
+                if(!MakePairKF(track1, track2, primV, invmass, angle)) continue;
+            }
+
+            valueSign[3] = invmass;
+            //  valueSign[5] = angle;
 
-        valueSign[3] = invmass;
-        //  valueSign[5] = angle;
+            //if((fCharge1*fCharge2)>0.0)	fLSignAngle->Fill(&valueAngle[0],weight);
+            //else				fUSignAngle->Fill(&valueAngle[0],weight);
 
-        //if((fCharge1*fCharge2)>0.0)	fLSignAngle->Fill(&valueAngle[0],weight);
-        //else				fUSignAngle->Fill(&valueAngle[0],weight);
+            if(angle > fMaxOpening3D) continue;				 //! Cut on Opening Angle
+            if(invmass > fMaxInvMass) continue;				//! Cut on Invariant Mass
 
-        if(angle > fMaxOpening3D) continue;				 //! Cut on Opening Angle
-        if(invmass > fMaxInvMass) continue;				//! Cut on Invariant Mass
+            if((fCharge1*fCharge2)>0.0){	
+                if(invmass < 1.0){ 
+                    fLSign->Fill( valueSign, weight);
+                    //if switched on produces mcstackdump for likesign with commonmother in gen 1
+                    if(fDisplayMCStack && fMCEvent && valueSign[5] == 1) {
+                        AliStack* stack = fMCEvent->Stack();
+                        if(!stack) AliError("No Stack");
+                        else stack->DumpPStack();
+                    }
 
-        if((fCharge1*fCharge2)>0.0){	
-            if(invmass < 1.0){ 
-                fLSign->Fill( valueSign, weight);
-                //if switched on produces mcstackdump for likesign with commonmother in gen 1
-                if(fDisplayMCStack && fMCEvent && valueSign[5] == 1) {
-                    AliStack* stack = fMCEvent->Stack();
-                    if(!stack) AliError("No Stack");
-                    else stack->DumpPStack();
                 }
+                // count like-sign background matched pairs per inclusive based on mass cut
+                if(invmass < 0.14) countsMatchLikesign++;
+                AliDebug(1, "-> Selected Like sign");
+            } else {
+                if(invmass < 1.0){
+                    fUSign->Fill( valueSign, weight);
+                }
+                // count unlike-sign matched pairs per inclusive based on mass cut
+                if(invmass < 0.14) {
+                    countsMatchUnlikesign++;
+                    if(fStudyRadius) fRecElectronRadius->Fill(valueradius,weight);
+                }
+                AliDebug(1, "-> Selected Unlike sign");
 
             }
-            // count like-sign background matched pairs per inclusive based on mass cut
-            if(invmass < 0.14) countsMatchLikesign++;
-            AliDebug(1, "-> Selected Like sign");
-        } else {
-            if(invmass < 1.0){
-                fUSign->Fill( valueSign, weight);
-            }
-            // count unlike-sign matched pairs per inclusive based on mass cut
-            if(invmass < 0.14) {
-                countsMatchUnlikesign++;
-                if(fStudyRadius) fRecElectronRadius->Fill(valueradius,weight);
-            }
-            AliDebug(1, "-> Selected Unlike sign");
 
-        }
 
-
-        if((fCharge1*fCharge2)>0.0)	kLSignPhotonic=kTRUE;
-        else				kUSignPhotonic=kTRUE;
+            if((fCharge1*fCharge2)>0.0)	kLSignPhotonic=kTRUE;
+            else				kUSignPhotonic=kTRUE;
+        }
     }
 
     // Fill counted
@@ -22,6 +22,8 @@
 #include <TArrayD.h>
 #endif
 
+#include <vector>
+
 class AliESDtrackCuts;
 class AliHFEpid;
 class AliHFEpidQAmanager;
@@ -91,6 +93,11 @@ class AliHFENonPhotonicElectron : public TNamed {
   void SetAnaPairGen(Bool_t setAna = kTRUE, Int_t nGen = 2)     { fAnaPairGen = setAna; fNumberofGenerations = nGen;};
   void SetNPairGenerations(Int_t nGen)                          { fNumberofGenerations = nGen;};
   void SetDisplayMCStack(Bool_t setDisplay = kTRUE)             { fDisplayMCStack = setDisplay;};
+  // instances with the same pool name and the same partner cuts select the partner tracks once per event
+  void SetSharedPartnerPool(const char *name)                   { fSharedPoolName = name; };
+  // pairs with a mass of the momenta at the primary vertex above maxMass, or an eta difference above
+  // maxDeltaEta, are not fitted and count as outside of the mass window (<0: switched off)
+  void SetPairPrefilter(Double_t maxMass, Double_t maxDeltaEta = -1.) { fPrefilterMass = maxMass; fPrefilterDeltaEta = maxDeltaEta; };
 
   TList      *GetListOutput()		const	{ return fListOutput; };
   THnSparseF *GetAssElectronHisto()	const	{ return fAssElectron; };
@@ -119,6 +126,17 @@ class AliHFENonPhotonicElectron : public TNamed {
 
 
  private:
+  // partner track of the pool with the kinematics at the primary vertex
+  struct Partner {
+    Int_t    fIndex;                                        // index in the event
+    Int_t    fCharge;                                       // charge
+    Double_t fEta;                                          // pseudorapidity
+    Double_t fP[3];                                         // momentum
+    Double_t fE;                                            // energy with the electron mass
+    Bool_t operator<(const Partner &other) const { return fCharge != other.fCharge ? fCharge < other.fCharge : fEta < other.fEta; }
+  };
+  static std::vector<Partner> *GetSharedPool(const TString &name, const AliVEvent *inputEvent, Int_t binct, Bool_t &filled);
+
   void	   FillMotherArray(Int_t tr, int index, Int_t a[], int NumberofGenerations);
   Int_t    FindGeneration(Int_t a[], Int_t b[], int NumberofGenerations); 
   Int_t    GetMotherPDG(Int_t tr, Int_t &motherIndex) const;
@@ -163,7 +181,11 @@ class AliHFENonPhotonicElectron : public TNamed {
   Double_t                  fITSnSigmaLow;                  // ITS n Sigma electron cut low (<0)
   Double_t                  fminPt;                         // min pT cut for the associated leg
   Double_t                  fEtaDalitzWeightFactor;         // Relative modification for the weighting factor for electrons from Eta Dalitz decays (default = 1);
-  TArrayI                   *fArraytrack;                   //! list of associated tracks
+  TString                   fSharedPoolName;                // name of the partner pool shared with other instances, empty: own pool
+  Double_t                  fPrefilterMass;                 // max. pair mass from the momenta at the primary vertex, <0: off
+  Double_t                  fPrefilterDeltaEta;             // max. eta difference of the pair, <0: off
+  std::vector<Partner>      fPartners;                      //! associated tracks, sorted by charge and eta
+  Bool_t                    fPoolFilled;                    //! pool of associated tracks filled
   Int_t                     fCounterPoolBackground;         // number of associated electrons
   Int_t                     fnumberfound;                   // number of inclusive  electrons
   TList                     *fListOutput;                   // List of histos
@@ -187,7 +209,7 @@ class AliHFENonPhotonicElectron : public TNamed {
 
   AliHFENonPhotonicElectron(const AliHFENonPhotonicElectron &ref); 
 
-  ClassDef(AliHFENonPhotonicElectron, 5); //!example of analysis
+  ClassDef(AliHFENonPhotonicElectron, 6); //!example of analysis
 };
 
 #endif
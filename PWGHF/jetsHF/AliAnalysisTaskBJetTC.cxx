@@ -480,6 +480,8 @@ AliAnalysisTaskBJetTC::AliAnalysisTaskBJetTC() : AliAnalysisTaskEmcalJet("AliAna
                                                  fLogJetProb(-1.),
                                                  fCalcDCATruth(kFALSE),
                                                  fDecayVertex(0x0),
+                                                 fShareIPCache(kTRUE),
+                                                 fIPCache(),
                                                  fh3JetpTLxySVIPsSecond(0x0),
                                                  fHistSV2Prong(0x0),
                                                  fHistSV2ProngUnidentified(0x0),
@@ -951,6 +953,8 @@ AliAnalysisTaskBJetTC::AliAnalysisTaskBJetTC(const char *name) : AliAnalysisTask
                                                                  fLogJetProb(-1.),
                                                                  fCalcDCATruth(kFALSE),
                                                                  fDecayVertex(0x0),
+                                                                 fShareIPCache(kTRUE),
+                                                                 fIPCache(),
                                                                  fh3JetpTLxySVIPsSecond(0x0),
                                                                  fHistSV2Prong(0x0),
                                                                  fHistSV2ProngUnidentified(0x0),
@@ -1062,6 +1066,12 @@ Bool_t AliAnalysisTaskBJetTC::Run()
         fMCArray = dynamic_cast<TClonesArray *>(fAODIn->FindListObject(AliAODMCParticle::StdBranchName()));
     }
 
+    // impact parameters of the previous event
+    fIPCache.fEvent = 0x0;
+
+    delete fVertexer;
+    delete fDiamond;
+    fDiamond = 0x0;
     fVertexer = new AliVertexerTracks(fAODIn->GetMagneticField());
     fVertexer->SetITSMode();
     fVertexer->SetMinClusters(3);
@@ -2393,10 +2403,11 @@ Bool_t AliAnalysisTaskBJetTC::Run()
         if (fDoTrackCountingAnalysis)
         {
 
-            std::sort(sImpParXY.begin(), sImpParXY.end(), std::greater<double>());
-            std::sort(sImpParXYZ.begin(), sImpParXYZ.end(), std::greater<double>());
-            std::sort(sImpParXYSig.begin(), sImpParXYSig.end(), std::greater<double>());
-            std::sort(sImpParXYZSig.begin(), sImpParXYZSig.end(), std::greater<double>());
+            // only the four largest values are used
+            SortHighest(sImpParXY, 4);
+            SortHighest(sImpParXYZ, 4);
+            SortHighest(sImpParXYSig, 4);
+            SortHighest(sImpParXYZSig, 4);
 
             std::vector<double> DefaultDiscriminator;
 
@@ -5347,53 +5358,96 @@ Bool_t AliAnalysisTaskBJetTC::CalculateTrackImpactParameterTruth(AliAODTrack *tr
 
 // ######################################################################################## Calculate signed  impact parameters
 
-Bool_t AliAnalysisTaskBJetTC::CalculateJetSignedTrackImpactParameter(AliAODTrack *track, AliEmcalJet *jet, double *impar, double *cov, double &sign, double &dcajetrack, double &lineardecaylength)
+AliAnalysisTaskBJetTC::IPCache *AliAnalysisTaskBJetTC::GetIPCache()
 {
+    // cache of the current event, shared by the instances with the same vertexing
+    static std::unordered_map<Int_t, IPCache> shared;
 
-    Double_t vtxPos[3];
-    AliESDVertex *vtxESDNew = 0x0;
+    AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+    const Long64_t entry = mgr ? mgr->GetCurrentEntry() : -1;
+    const Int_t mode = (fUseNewIPsCalculation ? 1 : 0) + (fVertexConstraint ? 2 : 0);
+    // without the entry of the manager the event can not be identified across instances
+    const Bool_t share = fShareIPCache && entry >= 0;
 
-    AliExternalTrackParam etp;
-    etp.CopyFromVTrack(track);
+    IPCache *cache = share ? &shared[mode] : &fIPCache;
+    if (cache->fEvent != fAODIn || cache->fEntry != entry || cache->fMode != mode)
+    {
+        cache->fEvent = fAODIn;
+        cache->fEntry = entry;
+        cache->fMode = mode;
+        cache->fTracks.clear();
+    }
+    return cache;
+}
+
+const AliAnalysisTaskBJetTC::TrackIP &AliAnalysisTaskBJetTC::GetTrackIP(AliAODTrack *track)
+{
+    // propagation to the primary vertex, done once per track and event
+    std::pair<std::unordered_map<const AliAODTrack *, TrackIP>::iterator, bool> inserted = GetIPCache()->fTracks.insert(std::make_pair(track, TrackIP()));
+    TrackIP &ip = inserted.first->second;
+    if (!inserted.second)
+        return ip;
+
+    ip.fValid = kFALSE;
+    ip.fParam.CopyFromVTrack(track);
 
     if (fUseNewIPsCalculation)
     {
         AliAODVertex *vtxAOD = fAODIn->GetPrimaryVertex();
-        if (!etp.PropagateToDCA(vtxAOD, fAODIn->GetMagneticField(), 100., impar, cov))
-            return kFALSE;
+        if (!ip.fParam.PropagateToDCA(vtxAOD, fAODIn->GetMagneticField(), 100., ip.fImpar, ip.fCov))
+            return ip;
 
-        vtxAOD->GetXYZ(vtxPos);
+        vtxAOD->GetXYZ(ip.fVtxPos);
     }
     else
     {
         Int_t skipped[1] = {-1};
         Int_t id = (Int_t)track->GetID();
         if (id < 0)
-            return kFALSE;
+            return ip;
         skipped[0] = id;
         fVertexer->SetSkipTracks(1, skipped);
-        vtxESDNew = fVertexer->FindPrimaryVertex(fAODIn);
+        AliESDVertex *vtxESDNew = fVertexer->FindPrimaryVertex(fAODIn);
         if (!vtxESDNew)
-            return kFALSE;
+            return ip;
         if (vtxESDNew->GetNContributors() <= 0)
         {
-            vtxESDNew = NULL;
             delete vtxESDNew;
-            return kFALSE;
+            return ip;
         }
-        // convert to AliAODVertex
-        Double_t cova[6], chi2perNDF;
-        vtxESDNew->GetXYZ(vtxPos);     // position
-        vtxESDNew->GetCovMatrix(cova); //covariance matrix
-        chi2perNDF = vtxESDNew->GetChi2toNDF();
+        vtxESDNew->GetXYZ(ip.fVtxPos);
 
         // Calculate Impact Parameters
-        if (!etp.PropagateToDCA(vtxESDNew, fAODIn->GetMagneticField(), 3., impar, cov))
-            return kFALSE;
-
+        Bool_t propagated = ip.fParam.PropagateToDCA(vtxESDNew, fAODIn->GetMagneticField(), 3., ip.fImpar, ip.fCov);
         delete vtxESDNew;
+        if (!propagated)
+            return ip;
     }
 
+    ip.fValid = kTRUE;
+    return ip;
+}
+
+void AliAnalysisTaskBJetTC::SortHighest(std::vector<double> &values, UInt_t n)
+{
+    std::partial_sort(values.begin(), values.begin() + TMath::Min<size_t>(n, values.size()), values.end(), std::greater<double>());
+}
+
+Bool_t AliAnalysisTaskBJetTC::CalculateJetSignedTrackImpactParameter(AliAODTrack *track, AliEmcalJet *jet, double *impar, double *cov, double &sign, double &dcajetrack, double &lineardecaylength)
+{
+    const TrackIP &ip = GetTrackIP(track);
+    if (!ip.fValid)
+        return kFALSE;
+
+    Double_t vtxPos[3] = {ip.fVtxPos[0], ip.fVtxPos[1], ip.fVtxPos[2]};
+    for (Int_t i = 0; i < 2; i++)
+        impar[i] = ip.fImpar[i];
+    for (Int_t i = 0; i < 3; i++)
+        cov[i] = ip.fCov[i];
+
+    // the jet dependent part works on a copy of the propagated track
+    AliExternalTrackParam etp(ip.fParam);
+
     if (fCorrectRes)
     {
         Double_t psc = track->P() * TMath::Power(TMath::Sin(track->Theta()), 1.5);
@@ -4,6 +4,9 @@
 #include "AliV0ReaderV1.h"
 #include "AliConvEventCuts.h"
 #include "AliAnalysisTaskWeakDecayVertexer.h"
+#include "AliExternalTrackParam.h"
+#include <unordered_map>
+#include <vector>
 class AliEmcalJet;
 class AliAODVertex;
 class AliAODTrack;
@@ -89,6 +92,8 @@ public:
     void SetUseImpactParameterSignificance(bool val = true) { fUseIPs = val; }
     void SetUseNormalIPCalculation(bool val = true) { fUseNewIPsCalculation = val; }
     void SetCorrectResolution(bool val = true) { fCorrectRes = val; }
+    // share the track impact parameters of an event with the instances using the same vertexing
+    void SetShareIPCache(Bool_t value = kTRUE) { fShareIPCache = value; }
 
     void SetCorrectionFunctionPscat(TF1 *corrFunc, Int_t nITS) { fCorrectionFactorsPscat[nITS] = corrFunc; }
     void SetCorrectionFunctionNvtxContrib(TF1 *corrFunc, Int_t nITS) { fCorrectionFactorsNvtxContrib[nITS] = corrFunc; }
@@ -217,6 +222,7 @@ private:
     Bool_t CalculateTrackImpactParameter(AliAODTrack *track, double *impar, double *cov);            // Removes track from Vertex calculation first
     Bool_t CalculateTrackImpactParameterTruth(AliAODTrack *track, double *impar, double *cov);       // calculates DCA on MC particle/event information
     Bool_t CalculateJetSignedTrackImpactParameter(AliAODTrack *track, AliEmcalJet *jet, double *impar, double *cov, double &sign, double &dcajetrack, double &lineardecaylength);
+    static void SortHighest(std::vector<double> &values, UInt_t n); // moves the n largest values to the front, in decreasing order
     Double_t GetValImpactParameter(TTypeImpPar type, double *impar, double *cov);
     Bool_t IsV0PhotonFromBeamPipeDaughter(const AliAODTrack *track);
     Bool_t IsV0Daughter(const AliAODTrack *track);
@@ -814,13 +820,35 @@ private:
 
     AliAnalysisTaskWeakDecayVertexer *fDecayVertex; //!
 
+    // track propagated to the primary vertex, independent of the jet axis
+    struct TrackIP
+    {
+        Bool_t fValid;                // propagation succeeded
+        Double_t fImpar[2];           // impact parameters, without resolution correction
+        Double_t fCov[3];             // their covariance
+        Double_t fVtxPos[3];          // vertex the track was propagated to
+        AliExternalTrackParam fParam; // track at the DCA to the vertex
+    };
+    struct IPCache
+    {
+        const AliVEvent *fEvent; // event of the cached tracks
+        Long64_t fEntry;         // entry of the analysis manager
+        Int_t fMode;             // vertexing the tracks were propagated with
+        std::unordered_map<const AliAODTrack *, TrackIP> fTracks;
+    };
+    IPCache *GetIPCache();
+    const TrackIP &GetTrackIP(AliAODTrack *track);
+
+    Bool_t fShareIPCache; // use the impact parameters of the other instances in the same event
+    IPCache fIPCache;     //! impact parameters of the event if not shared
+
     static const Double_t fgkMassPion;    //
     static const Double_t fgkMassKshort;  //
     static const Double_t fgkMassLambda;  //
     static const Double_t fgkMassProton;  //
     static const Int_t fgkiNCategV0 = 18; // number of V0 selection steps
 
-    ClassDef(AliAnalysisTaskBJetTC, 66)
+    ClassDef(AliAnalysisTaskBJetTC, 67)
 };
 #endif
 //
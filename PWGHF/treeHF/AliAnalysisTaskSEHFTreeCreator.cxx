@@ -283,6 +283,10 @@ fImpParProdOnFlyCut(9999.),
 fCosPOnFlyCut(-9999.),
 fCosPXYOnFlyCut(-9999.),
 fTreeSingleTrackVarsOpt(AliHFTreeHandler::kRedSingleTrackVars),
+fTreeOutputBackend(AliHFTreeHandler::kStandardTreeOutput),
+fTreeOutputBasketSize(512000),
+fTreeOutputAutoFlushBytes(64000000),
+fTreeOutputCompression(-1),
 fJetRadius(0.4),
 fSubJetRadius(0.0),
 fJetAlgorithm(JetAlgorithm::antikt),
@@ -291,6 +295,8 @@ fMinJetPt(0.0),
 fSoftDropZCut(0.1),
 fSoftDropBeta(0.0),
 fTrackingEfficiency(1.0),
+fIncrementalJets(false),
+fJetValidateEvery(0),
 fGoodTrackFilterBit(-1),
 fGoodTrackEtaRange(999.),
 fGoodTrackMinPt(0.),
@@ -699,6 +705,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     fTreeHandlerD0->SetFillJets(fFillJets);
     fTreeHandlerD0->SetDoJetSubstructure(fDoJetSubstructure);
     fTreeHandlerD0->SetTrackingEfficiency(fTrackingEfficiency);
+    fTreeHandlerD0->SetIncrementalJetFinding(fIncrementalJets,fJetValidateEvery);
     fTreeHandlerD0->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
     fTreeHandlerD0->SetSubJetProperties(fSubJetRadius,fSubJetAlgorithm,fSoftDropZCut,fSoftDropBeta);
     fVariablesTreeD0 = (TTree*)fTreeHandlerD0->BuildTree(nameoutput,nameoutput);
@@ -729,6 +736,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     fTreeHandlerDs->SetFillJets(fFillJets);
     fTreeHandlerDs->SetDoJetSubstructure(fDoJetSubstructure);
     fTreeHandlerDs->SetTrackingEfficiency(fTrackingEfficiency);
+    fTreeHandlerDs->SetIncrementalJetFinding(fIncrementalJets,fJetValidateEvery);
     fTreeHandlerDs->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
     fTreeHandlerDs->SetSubJetProperties(fSubJetRadius,fSubJetAlgorithm,fSoftDropZCut,fSoftDropBeta);
     fVariablesTreeDs = (TTree*)fTreeHandlerDs->BuildTree(nameoutput,nameoutput);
@@ -758,6 +766,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     fTreeHandlerDplus->SetFillJets(fFillJets);
     fTreeHandlerDplus->SetDoJetSubstructure(fDoJetSubstructure);
     fTreeHandlerDplus->SetTrackingEfficiency(fTrackingEfficiency);
+    fTreeHandlerDplus->SetIncrementalJetFinding(fIncrementalJets,fJetValidateEvery);
     fTreeHandlerDplus->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
     fTreeHandlerDplus->SetSubJetProperties(fSubJetRadius,fSubJetAlgorithm,fSoftDropZCut,fSoftDropBeta);
     fVariablesTreeDplus = (TTree*)fTreeHandlerDplus->BuildTree(nameoutput,nameoutput);
@@ -786,6 +795,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     fTreeHandlerLctopKpi->SetFillJets(fFillJets);
     fTreeHandlerLctopKpi->SetDoJetSubstructure(fDoJetSubstructure);
     fTreeHandlerLctopKpi->SetTrackingEfficiency(fTrackingEfficiency);
+    fTreeHandlerLctopKpi->SetIncrementalJetFinding(fIncrementalJets,fJetValidateEvery);
     fTreeHandlerLctopKpi->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
     fTreeHandlerLctopKpi->SetSubJetProperties(fSubJetRadius,fSubJetAlgorithm,fSoftDropZCut,fSoftDropBeta);
     fVariablesTreeLctopKpi = (TTree*)fTreeHandlerLctopKpi->BuildTree(nameoutput,nameoutput);
@@ -815,6 +825,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     fTreeHandlerBplus->SetFillJets(fFillJets);
     fTreeHandlerBplus->SetDoJetSubstructure(fDoJetSubstructure);
     fTreeHandlerBplus->SetTrackingEfficiency(fTrackingEfficiency);
+    fTreeHandlerBplus->SetIncrementalJetFinding(fIncrementalJets,fJetValidateEvery);
     fTreeHandlerBplus->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
     fTreeHandlerBplus->SetSubJetProperties(fSubJetRadius,fSubJetAlgorithm,fSoftDropZCut,fSoftDropBeta);
     fVariablesTreeBplus = (TTree*)fTreeHandlerBplus->BuildTree(nameoutput,nameoutput);
@@ -843,6 +854,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     fTreeHandlerDstar->SetFillJets(fFillJets);
     fTreeHandlerDstar->SetDoJetSubstructure(fDoJetSubstructure);
     fTreeHandlerDstar->SetTrackingEfficiency(fTrackingEfficiency);
+    fTreeHandlerDstar->SetIncrementalJetFinding(fIncrementalJets,fJetValidateEvery);
     fTreeHandlerDstar->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
     fTreeHandlerDstar->SetSubJetProperties(fSubJetRadius,fSubJetAlgorithm,fSoftDropZCut,fSoftDropBeta);
     fVariablesTreeDstar = (TTree*)fTreeHandlerDstar->BuildTree(nameoutput,nameoutput);
@@ -872,6 +884,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     fTreeHandlerLc2V0bachelor->SetFillJets(fFillJets);
     fTreeHandlerLc2V0bachelor->SetDoJetSubstructure(fDoJetSubstructure);
     fTreeHandlerLc2V0bachelor->SetTrackingEfficiency(fTrackingEfficiency);
+    fTreeHandlerLc2V0bachelor->SetIncrementalJetFinding(fIncrementalJets,fJetValidateEvery);
     fTreeHandlerLc2V0bachelor->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
     fTreeHandlerLc2V0bachelor->SetSubJetProperties(fSubJetRadius,fSubJetAlgorithm,fSoftDropZCut,fSoftDropBeta);
     fVariablesTreeLc2V0bachelor = (TTree*)fTreeHandlerLc2V0bachelor->BuildTree(nameoutput,nameoutput);
@@ -901,6 +914,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     fTreeHandlerBs->SetFillJets(fFillJets);
     fTreeHandlerBs->SetDoJetSubstructure(fDoJetSubstructure);
     fTreeHandlerBs->SetTrackingEfficiency(fTrackingEfficiency);
+    fTreeHandlerBs->SetIncrementalJetFinding(fIncrementalJets,fJetValidateEvery);
     fTreeHandlerBs->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
     fTreeHandlerBs->SetSubJetProperties(fSubJetRadius,fSubJetAlgorithm,fSoftDropZCut,fSoftDropBeta);
     fVariablesTreeBs = (TTree*)fTreeHandlerBs->BuildTree(nameoutput,nameoutput);
@@ -930,6 +944,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     fTreeHandlerLb->SetFillJets(fFillJets);
     fTreeHandlerLb->SetDoJetSubstructure(fDoJetSubstructure);
     fTreeHandlerLb->SetTrackingEfficiency(fTrackingEfficiency);
+    fTreeHandlerLb->SetIncrementalJetFinding(fIncrementalJets,fJetValidateEvery);
     fTreeHandlerLb->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
     fTreeHandlerLb->SetSubJetProperties(fSubJetRadius,fSubJetAlgorithm,fSoftDropZCut,fSoftDropBeta);
     fVariablesTreeLb = (TTree*)fTreeHandlerLb->BuildTree(nameoutput,nameoutput);
@@ -957,6 +972,7 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     fTreeHandlerInclusiveJet->SetFillJets(fFillJets);
     fTreeHandlerInclusiveJet->SetDoJetSubstructure(fDoJetSubstructure);
     fTreeHandlerInclusiveJet->SetTrackingEfficiency(fTrackingEfficiency);
+    fTreeHandlerInclusiveJet->SetIncrementalJetFinding(fIncrementalJets,fJetValidateEvery);
     fTreeHandlerInclusiveJet->SetJetProperties(fJetRadius,fJetAlgorithm,fMinJetPt);
     fTreeHandlerInclusiveJet->SetSubJetProperties(fSubJetRadius,fSubJetAlgorithm,fSoftDropZCut,fSoftDropBeta);
     fVariablesTreeInclusiveJet = (TTree*)fTreeHandlerInclusiveJet->BuildTree(nameoutput,nameoutput);
@@ -1042,6 +1058,17 @@ void AliAnalysisTaskSEHFTreeCreator::UserCreateOutputObjects()
     }
   }
   
+  //output backend of the candidate trees (applied at the first fill)
+  if(fTreeOutputBackend!=AliHFTreeHandler::kStandardTreeOutput) {
+    AliHFTreeHandler* handlers[] = {fTreeHandlerD0, fTreeHandlerDs, fTreeHandlerDplus, fTreeHandlerLctopKpi, fTreeHandlerBplus,
+                                    fTreeHandlerBs, fTreeHandlerDstar, fTreeHandlerLc2V0bachelor, fTreeHandlerLb, fTreeHandlerInclusiveJet,
+                                    fTreeHandlerGenD0, fTreeHandlerGenDs, fTreeHandlerGenDplus, fTreeHandlerGenLctopKpi, fTreeHandlerGenBplus,
+                                    fTreeHandlerGenBs, fTreeHandlerGenDstar, fTreeHandlerGenLc2V0bachelor, fTreeHandlerGenLb, fTreeHandlerGenInclusiveJet};
+    for(AliHFTreeHandler* th : handlers) {
+      if(th) th->SetOutputBackend(fTreeOutputBackend,fTreeOutputBasketSize,fTreeOutputAutoFlushBytes,fTreeOutputCompression);
+    }
+  }
+
   //Set seed of gRandom
   if(fEnableEventDownsampling) gRandom->SetSeed(fSeedEventDownsampling);
 
@@ -158,6 +158,7 @@ public:
     void SetSoftDropZCut(Double_t d) {fSoftDropZCut = d; }
     void SetSoftDropBeta(Double_t d) {fSoftDropBeta = d; }
     void SetTrackingEfficiency(Double_t d) {fTrackingEfficiency = d;}
+    void SetIncrementalJetFinding(bool b, Int_t validateEvery=0) {fIncrementalJets = b; fJetValidateEvery = validateEvery;}
     void SetDoPtHard(bool b) {fDoPtHard = b;}
   
     void SetGoodTrackFilterBit(Int_t i) { fGoodTrackFilterBit = i; }
@@ -181,6 +182,12 @@ public:
     }
 
     void SetTreeSingleTrackVarsOpt(Int_t opt) {fTreeSingleTrackVarsOpt=opt;}
+    void SetTreeOutputBackend(Int_t backend, Int_t basketsize=512000, Long64_t autoflushbytes=64000000, Int_t compression=-1){
+      fTreeOutputBackend=backend;
+      fTreeOutputBasketSize=basketsize;
+      fTreeOutputAutoFlushBytes=autoflushbytes;
+      fTreeOutputCompression=compression;
+    }
   
     Int_t  GetSystem() const {return fSys;}
     Bool_t GetWriteOnlySignalTree() const {return fWriteOnlySignal;}
@@ -435,6 +442,10 @@ private:
     Float_t                 fCosPXYOnFlyCut;                       ///Cut on cos pointing angle xy for on fly hadron selection
   
     Int_t                   fTreeSingleTrackVarsOpt;               /// option for single-track variables to be filled in the trees
+    Int_t                   fTreeOutputBackend;                    /// output backend of the candidate trees (AliHFTreeHandler::outputbackend)
+    Int_t                   fTreeOutputBasketSize;                 /// basket size per branch for the buffered output backend
+    Long64_t                fTreeOutputAutoFlushBytes;             /// bytes between flushes for the buffered output backend
+    Int_t                   fTreeOutputCompression;                /// compression settings of the candidate trees (-1: output file default)
 
     Double_t                fJetRadius;                            /// Setting the radius for jet finding
     Double_t                fSubJetRadius;                         /// Setting the radius for subjet finding
@@ -444,6 +455,8 @@ private:
     Double_t                fSoftDropZCut;                         /// setting the soft drop z parameter
     Double_t                fSoftDropBeta;                         /// setting the soft drop beta parameter
     Double_t                fTrackingEfficiency;                   /// Setting the jet finding tracking efficiency
+    bool                    fIncrementalJets;                      /// Recluster only the jets around each candidate
+    Int_t                   fJetValidateEvery;                     /// Compare every n-th candidate jet to the full reclustering
   
     Int_t                   fGoodTrackFilterBit;                   /// Setting filter bit for bachelor on-the-fly reconstruction candidate
     Double_t                fGoodTrackEtaRange;                    /// Setting eta-range for bachelor on-the-fly reconstruction candidate
@@ -529,7 +542,7 @@ private:
     AliCDBEntry *fCdbEntry;
 
     /// \cond CLASSIMP
-    ClassDef(AliAnalysisTaskSEHFTreeCreator,30);
+    ClassDef(AliAnalysisTaskSEHFTreeCreator,32);
     /// \endcond
 };
 
@@ -12,7 +12,10 @@
 
 #include <cmath>
 #include <limits>
+#include <algorithm>
 #include "AliHFJetFinder.h"
+#include "AliAnalysisManager.h"
+#include "AliLog.h"
 #include "TMath.h"
 #include "TRandom3.h"
 
@@ -48,7 +51,20 @@ AliHFJetFinder::AliHFJetFinder():
   fTrackingEfficiency(1.0),
   fDoJetSubstructure(false),
   fFastJetWrapper(0x0),
-  fConstituentCharge(0x0)
+  fConstituentCharge(0x0),
+  fIncremental(kFALSE),
+  fValidateEvery(0),
+  fNIncremental(0),
+  fNValidated(0),
+  fNMismatched(0),
+  fEventArray(0x0),
+  fEventEntry(-1),
+  fEventInputs(),
+  fEventTrackIDs(),
+  fEventInputIndex(),
+  fEventCharge(),
+  fEventJets(),
+  fEventJetInputs()
 {
   //
   // Default constructor
@@ -82,7 +98,20 @@ AliHFJetFinder::AliHFJetFinder(char *name):
   fTrackingEfficiency(1.0),
   fDoJetSubstructure(false),
   fFastJetWrapper(0x0),
-  fConstituentCharge(0x0)
+  fConstituentCharge(0x0),
+  fIncremental(kFALSE),
+  fValidateEvery(0),
+  fNIncremental(0),
+  fNValidated(0),
+  fNMismatched(0),
+  fEventArray(0x0),
+  fEventEntry(-1),
+  fEventInputs(),
+  fEventTrackIDs(),
+  fEventInputIndex(),
+  fEventCharge(),
+  fEventJets(),
+  fEventJetInputs()
 {
 }
 
@@ -93,6 +122,7 @@ AliHFJetFinder::~AliHFJetFinder()
   //
   // Destructor
   //
+  if (fNValidated>0) AliInfo(Form("%d of %d validated candidates differ from the full reclustering",fNMismatched,fNValidated));
   delete fFastJetWrapper;
 }
 
@@ -102,6 +132,7 @@ void AliHFJetFinder::SetFJWrapper()
 {
 
   
+  delete fFastJetWrapper;
   fFastJetWrapper = new AliFJWrapper("fFastJetWrapper","fFastJetWrapper");
 
   fFastJetWrapper->Clear();
@@ -118,6 +149,8 @@ void AliHFJetFinder::SetFJWrapper()
 //returns jet clustered with heavy flavour candidate
 AliHFJet AliHFJetFinder::GetHFJet(TClonesArray *array, AliAODRecoDecayHF *cand, Double_t invmass){ 
 
+  //the random tracking efficiency changes the inputs of every candidate
+  if (fIncremental && cand && fJetAlgorithm==JetAlgorithm::antikt && fTrackingEfficiency>=1.0) return GetHFJetIncremental(array,cand,invmass);
   SetFJWrapper();
   AliHFJet hfjet;
   if (!cand) return hfjet;
@@ -136,6 +169,174 @@ AliHFJet AliHFJetFinder::GetHFJet(TClonesArray *array, AliAODRecoDecayHF *cand,
 }
 
 
+//________________________________________________________________
+//returns jet clustered with heavy flavour candidate, reclustering only the event jets around the candidate
+AliHFJet AliHFJetFinder::GetHFJetIncremental(TClonesArray *array, AliAODRecoDecayHF *cand, Double_t invmass){
+
+  AliHFJet hfjet;
+  PrepareEventInputs(array);
+  fastjet::PseudoJet jet;
+  std::vector<fastjet::PseudoJet> constituents;
+  Bool_t found=FindCandidateJetIncremental(cand,invmass,jet,constituents);
+  fNIncremental++;
+
+  if (fValidateEvery>0 && fNIncremental%fValidateEvery==0){
+    fNValidated++;
+    SetFJWrapper();
+    FindJets(array,cand,invmass);
+    Int_t jet_index=Find_Candidate_Jet();
+    Bool_t same=(jet_index!=-1)==found;
+    std::vector<fastjet::PseudoJet> full_constituents;
+    if (jet_index!=-1) full_constituents=fFastJetWrapper->GetJetConstituents(jet_index);
+    if (same && found) same=SameConstituents(constituents,full_constituents);
+    if (!same){
+      fNMismatched++;
+      AliDebug(1,Form("Candidate jet differs from the full reclustering (%d of %d)",fNMismatched,fNValidated));
+      found=(jet_index!=-1);
+      if (found){
+	jet=fFastJetWrapper->GetInclusiveJets()[jet_index];
+	constituents=full_constituents;
+      }
+    }
+  }
+
+  if (!found) return hfjet;
+  if (jet.perp() < fMinJetPt) return hfjet;
+  SetJetVariables(hfjet, constituents, jet, 0, cand);
+
+  return hfjet;
+}
+
+
+//________________________________________________________________
+//Cluster the accepted tracks of the event once, for all the candidates of the event
+void AliHFJetFinder::PrepareEventInputs(TClonesArray *array) {
+
+  AliAnalysisManager *mgr=AliAnalysisManager::GetAnalysisManager();
+  Long64_t entry=mgr ? mgr->GetCurrentEntry() : -1;
+  if (array==fEventArray && entry==fEventEntry && entry>=0) return;
+  fEventArray=array;
+  fEventEntry=entry;
+
+  fEventInputs.clear();
+  fEventTrackIDs.clear();
+  fEventCharge.clear();
+  fEventJets.clear();
+  fEventJetInputs.clear();
+  fEventInputIndex.assign(array->GetEntriesFast(),-1);
+
+  AliAODTrack *track=NULL;
+  for (Int_t i=0; i<array->GetEntriesFast(); i++) {
+    track= dynamic_cast<AliAODTrack*>(array->At(i));
+    if(!CheckTrack(track)) continue;
+    fastjet::PseudoJet input(track->Px(), track->Py(), track->Pz(), track->E());
+    input.set_user_index(i+100);
+    fEventInputIndex[i]=fEventInputs.size();
+    fEventInputs.push_back(input);
+    fEventTrackIDs.push_back(track->GetID());
+    fEventCharge.push_back(std::make_pair(i+100,(Double_t)track->Charge()));
+  }
+  if (fEventInputs.empty()) return;
+
+  fastjet::JetDefinition jet_definition(JetAlgorithm(fJetAlgorithm), fJetRadius, RecombinationScheme(fJetRecombScheme), fastjet::Best);
+  fastjet::ClusterSequence cluster_sequence(fEventInputs, jet_definition);
+  fEventJets=cluster_sequence.inclusive_jets(0.0);
+  for (UInt_t j=0; j<fEventJets.size(); j++){
+    std::vector<fastjet::PseudoJet> constituents(cluster_sequence.constituents(fEventJets[j]));
+    std::vector<Int_t> inputs;
+    for (UInt_t k=0; k<constituents.size(); k++) inputs.push_back(fEventInputIndex[constituents[k].user_index()-100]);
+    fEventJetInputs.push_back(inputs);
+  }
+}
+
+
+//________________________________________________________________
+//Recluster the event jets around the candidate, with its daughters replaced by the candidate itself
+Bool_t AliHFJetFinder::FindCandidateJetIncremental(AliAODRecoDecayHF *cand, Double_t invmass, fastjet::PseudoJet& jet, std::vector<fastjet::PseudoJet>& constituents) {
+
+  AliTLorentzVector cand_lvec(0,0,0,0);
+  cand_lvec.SetPtEtaPhiM(cand->Pt(), cand->Eta(), cand->Phi(), invmass);
+  fastjet::PseudoJet cand_input(cand_lvec.Px(), cand_lvec.Py(), cand_lvec.Pz(), cand_lvec.E());
+  cand_input.set_user_index(0);
+
+  fConstituentCharge.assign(1,std::make_pair(0,(Double_t)cand->Charge()));
+  fConstituentCharge.insert(fConstituentCharge.end(),fEventCharge.begin(),fEventCharge.end());
+
+  std::vector<Bool_t> removed(fEventInputs.size(),kFALSE);
+  AliVTrack *daughter;
+  for (Int_t i = 0; i < cand->GetNDaughters(); i++) {
+    daughter = dynamic_cast<AliVTrack *>(cand->GetDaughter(i));
+    if (!daughter) continue;
+    for (UInt_t k=0; k<fEventTrackIDs.size(); k++){
+      if (fEventTrackIDs[k]==daughter->GetID()) removed[k]=kTRUE;
+    }
+  }
+
+  //the anti-kt jets further than 2R from the modified jets keep their constituents
+  const Double_t guard=2*fJetRadius;
+  std::vector<Bool_t> affected(fEventJets.size(),kFALSE);
+  for (UInt_t j=0; j<fEventJets.size(); j++){
+    if (fEventJets[j].delta_R(cand_input) < guard) affected[j]=kTRUE;
+    for (UInt_t k=0; k<fEventJetInputs[j].size() && !affected[j]; k++){
+      if (removed[fEventJetInputs[j][k]]) affected[j]=kTRUE;
+    }
+  }
+
+  fastjet::JetDefinition jet_definition(JetAlgorithm(fJetAlgorithm), fJetRadius, RecombinationScheme(fJetRecombScheme), fastjet::Best);
+  Bool_t grown=kTRUE;
+  while (grown){
+    std::vector<fastjet::PseudoJet> inputs(1,cand_input);
+    for (UInt_t j=0; j<fEventJets.size(); j++){
+      if (!affected[j]) continue;
+      for (UInt_t k=0; k<fEventJetInputs[j].size(); k++){
+	if (!removed[fEventJetInputs[j][k]]) inputs.push_back(fEventInputs[fEventJetInputs[j][k]]);
+      }
+    }
+    fastjet::ClusterSequence cluster_sequence(inputs, jet_definition);
+    std::vector<fastjet::PseudoJet> local_jets(cluster_sequence.inclusive_jets(0.0));
+
+    //event jets close to the reclustered ones are added to the reclustering
+    grown=kFALSE;
+    for (UInt_t j=0; j<fEventJets.size(); j++){
+      if (affected[j]) continue;
+      for (UInt_t l=0; l<local_jets.size(); l++){
+	if (fEventJets[j].delta_R(local_jets[l]) < guard){
+	  affected[j]=kTRUE;
+	  grown=kTRUE;
+	  break;
+	}
+      }
+    }
+    if (grown) continue;
+
+    for (UInt_t l=0; l<local_jets.size(); l++){
+      std::vector<fastjet::PseudoJet> local_constituents(cluster_sequence.constituents(local_jets[l]));
+      for (UInt_t k=0; k<local_constituents.size(); k++){
+	if (local_constituents[k].user_index()==0){
+	  jet=local_jets[l];
+	  constituents=local_constituents;
+	  return kTRUE;
+	}
+      }
+    }
+  }
+  return kFALSE;
+}
+
+
+//________________________________________________________________
+//Compare the constituents of two jets
+Bool_t AliHFJetFinder::SameConstituents(const std::vector<fastjet::PseudoJet>& constituents1, const std::vector<fastjet::PseudoJet>& constituents2) {
+
+  std::vector<Int_t> index1, index2;
+  for (UInt_t k=0; k<constituents1.size(); k++) index1.push_back(constituents1[k].user_index());
+  for (UInt_t k=0; k<constituents2.size(); k++) index2.push_back(constituents2[k].user_index());
+  std::sort(index1.begin(),index1.end());
+  std::sort(index2.begin(),index2.end());
+  return index1==index2;
+}
+
+
 //________________________________________________________________
 //returns jet clustered with heavy flavour particle (MC)
 AliHFJet AliHFJetFinder::GetHFMCJet(TClonesArray *array, AliAODMCParticle *mcpart){
@@ -62,7 +62,11 @@ class AliHFJetFinder : public TObject
   std::vector<AliHFJet> GetMCJets(TClonesArray *array);
   void FindJets(TClonesArray *array, AliAODRecoDecayHF *cand=nullptr, Double_t invmass=0);
   void FindMCJets(TClonesArray *array, AliAODMCParticle *mcpart=nullptr);
+  AliHFJet GetHFJetIncremental(TClonesArray *array, AliAODRecoDecayHF *cand, Double_t invmass);
+  void PrepareEventInputs(TClonesArray *array);
   #if !defined(__CINT__) && !defined(__MAKECINT__)
+  Bool_t FindCandidateJetIncremental(AliAODRecoDecayHF *cand, Double_t invmass, fastjet::PseudoJet& jet, std::vector<fastjet::PseudoJet>& constituents);
+  Bool_t SameConstituents(const std::vector<fastjet::PseudoJet>& constituents1, const std::vector<fastjet::PseudoJet>& constituents2);
   void SetJetVariables(AliHFJet& hfjet, const std::vector<fastjet::PseudoJet>& constituents, const fastjet::PseudoJet& jet, Int_t jetID, AliAODRecoDecayHF *cand=nullptr);
   void SetMCJetVariables(AliHFJet& hfjet, const std::vector<fastjet::PseudoJet>& constituents, const fastjet::PseudoJet& jet, Int_t jetID, AliAODMCParticle *mcpart=nullptr);
   void SetJetSubstructureVariables(AliHFJet& hfjet, const fastjet::PseudoJet& jet, const std::vector<fastjet::PseudoJet>& constituents);
@@ -97,6 +101,12 @@ class AliHFJetFinder : public TObject
   void SetMaxParticleEta(Float_t f)        {fMaxParticleEta = f;}
   void SetCharged(Int_t i)                 {fCharged = i;}
   void SetTrackingEfficiency(Double_t d)   {fTrackingEfficiency = d;}
+  //the event tracks are clustered once, each candidate only reclusters the jets around it (anti-kt only)
+  //every validateEvery-th candidate is compared to the full reclustering, which is used if they differ
+  void SetIncrementalMode(Bool_t b, Int_t validateEvery=0) {fIncremental=b; fValidateEvery=validateEvery;}
+  Int_t GetNIncrementalCandidates() const  {return fNIncremental;}
+  Int_t GetNValidatedCandidates() const    {return fNValidated;}
+  Int_t GetNMismatchedCandidates() const   {return fNMismatched;}
   
 
   Float_t                  fMinJetPt;
@@ -131,11 +141,25 @@ class AliHFJetFinder : public TObject
   AliFJWrapper            *fFastJetWrapper;
   std::vector<std::pair<Int_t,Double_t>>   fConstituentCharge;
 
+  Bool_t                   fIncremental;
+  Int_t                    fValidateEvery;
+  Int_t                    fNIncremental;
+  Int_t                    fNValidated;
+  Int_t                    fNMismatched;
+  TClonesArray            *fEventArray;      //! tracks of the event inputs
+  Long64_t                 fEventEntry;      //! entry of the event inputs
+  std::vector<fastjet::PseudoJet>          fEventInputs;      //! accepted tracks of the event
+  std::vector<Int_t>                       fEventTrackIDs;    //! their track IDs
+  std::vector<Int_t>                       fEventInputIndex;  //! input index of each track of the array, -1 if rejected
+  std::vector<std::pair<Int_t,Double_t>>   fEventCharge;      //! charges of the event inputs
+  std::vector<fastjet::PseudoJet>          fEventJets;        //! jets of the event inputs
+  std::vector<std::vector<Int_t>>          fEventJetInputs;   //! input indices of the constituents of each event jet
+
 
 
 
   /// \cond CLASSIMP
-  ClassDef(AliHFJetFinder,1); ///
+  ClassDef(AliHFJetFinder,2); ///
   /// \endcond
 };
 #endif
@@ -24,6 +24,7 @@
 
 #include "TMath.h"
 #include "TFile.h"
+#include "TBranch.h"
 
 #include "AliHFTreeHandler.h"
 #include "AliPID.h"
@@ -148,7 +149,15 @@ AliHFTreeHandler::AliHFTreeHandler():
   fMinJetPt(0.0),
   fSoftDropZCut(0.1),
   fSoftDropBeta(0.0),
-  fTrackingEfficiency(1.0)
+  fTrackingEfficiency(1.0),
+  fIncrementalJets(false),
+  fJetValidateEvery(0),
+  fJetFinder(nullptr),
+  fOutputBackend(kStandardTreeOutput),
+  fOutputBasketSize(kBufferedBasketSize),
+  fOutputAutoFlushBytes(kBufferedAutoFlushBytes),
+  fOutputCompression(-1),
+  fConfiguredTree(nullptr)
 {
   //
   // Default constructor
@@ -300,7 +309,15 @@ AliHFTreeHandler::AliHFTreeHandler(int PIDopt):
   fMinJetPt(0.0),
   fSoftDropZCut(0.1),
   fSoftDropBeta(0.0),
-  fTrackingEfficiency(1.0)
+  fTrackingEfficiency(1.0),
+  fIncrementalJets(false),
+  fJetValidateEvery(0),
+  fJetFinder(nullptr),
+  fOutputBackend(kStandardTreeOutput),
+  fOutputBasketSize(kBufferedBasketSize),
+  fOutputAutoFlushBytes(kBufferedAutoFlushBytes),
+  fOutputCompression(-1),
+  fConfiguredTree(nullptr)
 {
   //
   // Standard constructor
@@ -351,6 +368,7 @@ AliHFTreeHandler::~AliHFTreeHandler()
 
   if(fTreeVar) delete fTreeVar;
   if(fPidCombined) delete fPidCombined;
+  delete fJetFinder;
 }
 
 //________________________________________________________________
@@ -379,6 +397,40 @@ TTree* AliHFTreeHandler::BuildTreeMCGen(TString name, TString title) {
   return fTreeVar;
 }
 
+//________________________________________________________________
+void AliHFTreeHandler::SetOutputBackend(int backend, int basketsize, Long64_t autoflushbytes, int compression) {
+  //
+  // Select how the candidate tree is written. kBufferedTreeOutput keeps the
+  // candidates column-wise in large per-branch baskets and flushes them in big
+  // compressed clusters instead of the default small baskets
+  //
+
+  fOutputBackend = backend;
+  fOutputBasketSize = basketsize;
+  fOutputAutoFlushBytes = autoflushbytes;
+  fOutputCompression = compression;
+  fConfiguredTree = nullptr;
+}
+
+//________________________________________________________________
+void AliHFTreeHandler::ConfigureOutputTree() {
+  //
+  // Apply the output settings to the tree, called once before the first fill
+  // (the branches are booked by the BuildTree methods of the derived classes)
+  //
+
+  fConfiguredTree = fTreeVar;
+  if(!fTreeVar || fOutputBackend!=kBufferedTreeOutput) return;
+
+  if(fOutputBasketSize>0) fTreeVar->SetBasketSize("*",fOutputBasketSize);
+  if(fOutputAutoFlushBytes>0) fTreeVar->SetAutoFlush(-fOutputAutoFlushBytes); //negative value: flush every N bytes
+  if(fOutputCompression>=0) {
+    TIter next(fTreeVar->GetListOfBranches());
+    TBranch *br = nullptr;
+    while((br = (TBranch*)next())) br->SetCompressionSettings(fOutputCompression);
+  }
+}
+
 //________________________________________________________________
 bool AliHFTreeHandler::SetMCGenVariables(int runnumber, int eventID, int eventID_Ext, Long64_t eventID_Long, AliAODMCParticle* mcpart) {
 
@@ -707,9 +759,21 @@ bool AliHFTreeHandler::SetSingleTrackVars(AliAODTrack* prongtracks[]) {
 //________________________________________________________________
 void AliHFTreeHandler::SetJetVars(TClonesArray *array, AliAODRecoDecayHF* cand, Double_t invmass, TClonesArray *mcarray, AliAODMCParticle* mcPart) {
 #ifdef HAVE_FASTJET
-  AliHFJetFinder hfjetfinder;
-  SetJetParameters(hfjetfinder); 
-  AliHFJet hfjet(hfjetfinder.GetHFJet(array,cand,invmass));
+  AliHFJet hfjet;
+  if (fIncrementalJets){
+    //the finder keeps the clustered tracks of the event for the following candidates
+    if (!fJetFinder){
+      fJetFinder = new AliHFJetFinder();
+      SetJetParameters(*fJetFinder);
+      fJetFinder->SetIncrementalMode(kTRUE,fJetValidateEvery);
+    }
+    hfjet=fJetFinder->GetHFJet(array,cand,invmass);
+  }
+  else{
+    AliHFJetFinder hfjetfinder;
+    SetJetParameters(hfjetfinder); 
+    hfjet=hfjetfinder.GetHFJet(array,cand,invmass);
+  }
   SetJetTreeVars(hfjet);
   
   AliHFJet hfgenjet;
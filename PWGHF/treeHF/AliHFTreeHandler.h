@@ -71,6 +71,11 @@ class AliHFTreeHandler : public TObject
       kCombTPCTOF // must be the last element in the enum
     };
 
+    enum outputbackend {
+      kStandardTreeOutput, // default TTree settings
+      kBufferedTreeOutput  // large per-branch baskets flushed in big compressed clusters
+    };
+
     enum optsingletrack {
       kNoSingleTrackVars, // single-track vars off
       kRedSingleTrackVars, // only pT, p, eta, phi
@@ -106,6 +111,7 @@ class AliHFTreeHandler : public TObject
         fCandType=0;
       }
       else {      
+        if(fConfiguredTree!=fTreeVar) ConfigureOutputTree();
         fTreeVar->Fill(); 
         fCandType=0;
         fRunNumberPrevCand = fRunNumber;
@@ -116,12 +122,14 @@ class AliHFTreeHandler : public TObject
     void SetFillJets(bool FillJets) {fFillJets=FillJets;}
     void SetDoJetSubstructure(bool DoJetSubstructure) {fDoJetSubstructure=DoJetSubstructure;}
     void SetTrackingEfficiency(Double_t TrackingEfficiency) {fTrackingEfficiency=TrackingEfficiency;}
+    void SetIncrementalJetFinding(bool b, int validateEvery=0) {fIncrementalJets=b; fJetValidateEvery=validateEvery;}
     void SetJetProperties(Double_t JetRadius,Int_t JetAlgorithm,Double_t MinJetPt) {fJetRadius=JetRadius;fJetAlgorithm=JetAlgorithm;fMinJetPt=MinJetPt;}
     void SetSubJetProperties(Double_t SubJetRadius,Int_t SubJetAlgorithm,Double_t SoftDropZCut,Double_t SoftDropBeta) {fSubJetRadius=SubJetRadius;fSubJetAlgorithm=SubJetAlgorithm;fSoftDropZCut=SoftDropZCut;fSoftDropBeta=SoftDropBeta;}
     void SetOptPID(int PIDopt) {fPidOpt=PIDopt;}
     void SetOptSingleTrackVars(int opt) {fSingleTrackOpt=opt;}
     void SetFillOnlySignal(bool fillopt=true) {fFillOnlySignal=fillopt;}
     void SetUpCombinedPid(); 
+    void SetOutputBackend(int backend, int basketsize=kBufferedBasketSize, Long64_t autoflushbytes=kBufferedAutoFlushBytes, int compression=-1);
 
     void SetCandidateType(bool issignal, bool isbkg, bool isprompt, bool isFD, bool isreflected);
     void SetIsSelectedStd(bool isselected, bool isselectedTopo, bool isselectedPID, bool isselectedTracks) {
@@ -187,8 +195,12 @@ class AliHFTreeHandler : public TObject
 
     const float kCSPEED = 2.99792457999999984e-02; // cm / ps
 
+    static const int kBufferedBasketSize = 512000; // bytes per branch basket for kBufferedTreeOutput
+    static const Long64_t kBufferedAutoFlushBytes = 64000000; // bytes between clusters for kBufferedTreeOutput
+
     //helper methods for derived clases (to be used in BuildTree and SetVariables functions)
     void AddCommonDmesonVarBranches(Bool_t HasSecVtx = kTRUE);
+    void ConfigureOutputTree();
     void AddSingleTrackBranches();
     void AddJetBranches();
     void AddGenJetBranches();
@@ -334,9 +346,17 @@ class AliHFTreeHandler : public TObject
     Double_t fSoftDropZCut; //soft drop z parameter
     Double_t fSoftDropBeta; //soft drop beta  parameter
     Double_t fTrackingEfficiency;
+    bool fIncrementalJets; //recluster only the jets around each candidate (see AliHFJetFinder::SetIncrementalMode)
+    int fJetValidateEvery; //compare every n-th candidate jet to the full reclustering
+    AliHFJetFinder* fJetFinder; //! jet finder kept over the candidates of the event
+    int fOutputBackend; /// output backend (see enum outputbackend)
+    int fOutputBasketSize; /// basket size per branch for the buffered backend
+    Long64_t fOutputAutoFlushBytes; /// bytes between flushes for the buffered backend
+    int fOutputCompression; /// compression settings of the branches (-1: keep those of the output file)
+    TTree* fConfiguredTree; //! tree to which the output settings were applied
 
   /// \cond CLASSIMP
-  ClassDef(AliHFTreeHandler,9); ///
+  ClassDef(AliHFTreeHandler,11); ///
   /// \endcond
 };
 #endif
@@ -48,7 +48,10 @@ AliAODRecoDecayHF::AliAODRecoDecayHF() :
   fd0err(0x0), 
   fProngID(0x0),
   fSelectionMap(0),
-  fIsFilled(1) 
+  fIsFilled(1),
+  fCacheMask(0),
+  fCachePrimVtx(0x0),
+  fCacheSecVtx(0x0)
 {
   //
   // Default Constructor
@@ -66,7 +69,10 @@ AliAODRecoDecayHF::AliAODRecoDecayHF(AliAODVertex *vtx2,Int_t nprongs,Short_t ch
   fd0err(0x0),
   fProngID(0x0),
   fSelectionMap(0),
-  fIsFilled(1)
+  fIsFilled(1),
+  fCacheMask(0),
+  fCachePrimVtx(0x0),
+  fCacheSecVtx(0x0)
 {
   //
   // Constructor with AliAODVertex for decay vertex
@@ -85,7 +91,10 @@ AliAODRecoDecayHF::AliAODRecoDecayHF(AliAODVertex *vtx2,Int_t nprongs,Short_t ch
   fd0err(0x0),
   fProngID(0x0),
   fSelectionMap(0),
-  fIsFilled(1)
+  fIsFilled(1),
+  fCacheMask(0),
+  fCachePrimVtx(0x0),
+  fCacheSecVtx(0x0)
 {
   //
   // Constructor with AliAODVertex for decay vertex and without prongs momenta
@@ -106,7 +115,10 @@ AliAODRecoDecayHF::AliAODRecoDecayHF(Double_t vtx1[3],Double_t vtx2[3],
   fd0err(0x0),
   fProngID(0x0), 
   fSelectionMap(0),
-  fIsFilled(1)
+  fIsFilled(1),
+  fCacheMask(0),
+  fCachePrimVtx(0x0),
+  fCacheSecVtx(0x0)
 {
   //
   // Constructor that can used for a "MC" object
@@ -128,7 +140,10 @@ AliAODRecoDecayHF::AliAODRecoDecayHF(const AliAODRecoDecayHF &source) :
   fd0err(0x0),
   fProngID(0x0),
   fSelectionMap(source.fSelectionMap),
-  fIsFilled(source.fIsFilled)
+  fIsFilled(source.fIsFilled),
+  fCacheMask(0),
+  fCachePrimVtx(0x0),
+  fCacheSecVtx(0x0)
 {
   //
   // Copy constructor
@@ -160,6 +175,7 @@ AliAODRecoDecayHF &AliAODRecoDecayHF::operator=(const AliAODRecoDecayHF &source)
   fListOfCuts = source.fListOfCuts;
   fSelectionMap = source.fSelectionMap;
   fIsFilled=source.fIsFilled;
+  fCacheMask=0;
 
   if(source.GetOwnPrimaryVtx()) {
     delete fOwnPrimaryVtx;
@@ -346,6 +362,7 @@ void AliAODRecoDecayHF::RecalculateImpPars(AliAODVertex *vtxAODNew,AliAODEvent*
       fd0err[i] = TMath::Sqrt(covdz[0]);
     }
   }
+  InvalidateCache();
 
   return;
 }
@@ -450,6 +467,7 @@ void AliAODRecoDecayHF::Misalign(TString misal) {
   secVtx->SetX(secVtxPos[0]);
   secVtx->SetY(secVtxPos[1]);
   secVtx->SetZ(secVtxPos[2]);
+  InvalidateCache();
 
   return;
 }
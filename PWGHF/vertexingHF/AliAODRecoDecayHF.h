@@ -23,6 +23,13 @@ class AliAODRecoDecayHF : public AliAODRecoDecay {
 
  public:
 
+  /// slots of the transient cache of derived quantities
+  enum ECachedValue { kCacheDecayLength=0, kCacheDecayLengthError, kCacheNormDecayLength,
+                      kCacheDecayLengthXY, kCacheDecayLengthXYError, kCacheNormDecayLengthXY,
+                      kCacheCosPointingAngle, kCacheCosPointingAngleXY, kCacheImpParXY,
+                      kCacheInvMass0, kCacheInvMass1, kCacheInvMass2, kCacheInvMass3, kCacheInvMass4,
+                      kNCachedValues };
+
   AliAODRecoDecayHF();
   AliAODRecoDecayHF(AliAODVertex *vtx2,Int_t nprongs,Short_t charge,
 		    Double_t *px,Double_t *py,Double_t *pz,
@@ -57,31 +64,31 @@ class AliAODRecoDecayHF : public AliAODRecoDecay {
   Int_t    GetIsFilled() const {return fIsFilled;}  
   virtual void DeleteRecoD();
 
-  /// kinematics & topology
+  /// kinematics & topology (values cached per candidate, see CheckCache)
   Double_t DecayLength2() const 
     { return AliAODRecoDecay::DecayLength2(GetPrimaryVtx());}
   Double_t DecayLength() const 
-    { return AliAODRecoDecay::DecayLength(GetPrimaryVtx());}
+    { return CachedValue(kCacheDecayLength) ? fCache[kCacheDecayLength] : SetCachedValue(kCacheDecayLength,AliAODRecoDecay::DecayLength(GetPrimaryVtx()));}
   Double_t DecayLengthError() const 
-    { return AliAODRecoDecay::DecayLengthError(GetPrimaryVtx());}
+    { return CachedValue(kCacheDecayLengthError) ? fCache[kCacheDecayLengthError] : SetCachedValue(kCacheDecayLengthError,AliAODRecoDecay::DecayLengthError(GetPrimaryVtx()));}
   Double_t NormalizedDecayLength() const 
-    { return AliAODRecoDecay::NormalizedDecayLength(GetPrimaryVtx());}
+    { return CachedValue(kCacheNormDecayLength) ? fCache[kCacheNormDecayLength] : SetCachedValue(kCacheNormDecayLength,AliAODRecoDecay::NormalizedDecayLength(GetPrimaryVtx()));}
   Double_t NormalizedDecayLength2() const 
     { return AliAODRecoDecay::NormalizedDecayLength2(GetPrimaryVtx());}
   Double_t DecayLengthXY() const 
-    { return AliAODRecoDecay::DecayLengthXY(GetPrimaryVtx());}
+    { return CachedValue(kCacheDecayLengthXY) ? fCache[kCacheDecayLengthXY] : SetCachedValue(kCacheDecayLengthXY,AliAODRecoDecay::DecayLengthXY(GetPrimaryVtx()));}
   Double_t DecayLengthXYError() const 
-    { return AliAODRecoDecay::DecayLengthXYError(GetPrimaryVtx());}
+    { return CachedValue(kCacheDecayLengthXYError) ? fCache[kCacheDecayLengthXYError] : SetCachedValue(kCacheDecayLengthXYError,AliAODRecoDecay::DecayLengthXYError(GetPrimaryVtx()));}
   Double_t NormalizedDecayLengthXY() const 
-    { return AliAODRecoDecay::NormalizedDecayLengthXY(GetPrimaryVtx());}
+    { return CachedValue(kCacheNormDecayLengthXY) ? fCache[kCacheNormDecayLengthXY] : SetCachedValue(kCacheNormDecayLengthXY,AliAODRecoDecay::NormalizedDecayLengthXY(GetPrimaryVtx()));}
   Double_t Ct(UInt_t pdg) const 
     { return AliAODRecoDecay::Ct(pdg,GetPrimaryVtx());}
   Double_t CosPointingAngle() const 
-    { return AliAODRecoDecay::CosPointingAngle(GetPrimaryVtx());}
+    { return CachedValue(kCacheCosPointingAngle) ? fCache[kCacheCosPointingAngle] : SetCachedValue(kCacheCosPointingAngle,AliAODRecoDecay::CosPointingAngle(GetPrimaryVtx()));}
   Double_t CosPointingAngleXY() const 
-    { return AliAODRecoDecay::CosPointingAngleXY(GetPrimaryVtx());}
+    { return CachedValue(kCacheCosPointingAngleXY) ? fCache[kCacheCosPointingAngleXY] : SetCachedValue(kCacheCosPointingAngleXY,AliAODRecoDecay::CosPointingAngleXY(GetPrimaryVtx()));}
   Double_t ImpParXY() const 
-    { return AliAODRecoDecay::ImpParXY(GetPrimaryVtx());}
+    { return CachedValue(kCacheImpParXY) ? fCache[kCacheImpParXY] : SetCachedValue(kCacheImpParXY,AliAODRecoDecay::ImpParXY(GetPrimaryVtx()));}
   Double_t QtProngFlightLine(Int_t ip) const 
     { return AliAODRecoDecay::QtProngFlightLine(ip,GetPrimaryVtx());}
   Double_t QlProngFlightLine(Int_t ip) const 
@@ -127,10 +134,17 @@ class AliAODRecoDecayHF : public AliAODRecoDecay {
   Int_t   NumberOfFakeDaughters() const;
 
   Bool_t  HasBadDaughters() const; /// TPC+ITS tracks not passing the StandardCuts2010 with loose DCA
+
+  /// drop the cached derived quantities (e.g. after changing the prong momenta in place)
+  void InvalidateCache() const { fCacheMask=0; }
   
 
  protected:
 
+  void     CheckCache() const;
+  Bool_t   CachedValue(Int_t i) const { CheckCache(); return TESTBIT(fCacheMask,i); }
+  Double_t SetCachedValue(Int_t i,Double_t val) const { fCache[i]=val; SETBIT(fCacheMask,i); return val; }
+
   AliAODVertex *fOwnPrimaryVtx; /// primary vertex for this candidate
   TRef          fEventPrimaryVtx; /// ref to primary vertex of the event
   TRef          fListOfCuts;  /// ref to the list of analysis cuts
@@ -142,12 +156,36 @@ class AliAODRecoDecayHF : public AliAODRecoDecay {
   ULong_t       fSelectionMap; /// used to store outcome of selection in AliAnalysisVertexingHF
   Int_t         fIsFilled;  // 0 if standard refiltering; 1 if data members of candidates are empty, 2 if data members are refilled in analysis task 
 
+  mutable UInt_t fCacheMask;                     //! bits of the valid cached values
+  mutable Double_t fCache[kNCachedValues];       //! cached derived quantities
+  mutable const TObject *fCachePrimVtx;          //! primary vertex the cache refers to
+  mutable const TObject *fCacheSecVtx;           //! secondary vertex the cache refers to
+  mutable Double_t fCacheKey[3];                 //! prong momenta and vertex position the cache refers to
+
   /// \cond CLASSIMP
   ClassDef(AliAODRecoDecayHF,7)  // base class for AOD reconstructed heavy-flavour decays
   /// \endcond
 };
 
 
+inline void AliAODRecoDecayHF::CheckCache() const
+{
+  /// The cached values are dropped when the primary or secondary vertex object, the secondary vertex
+  /// position or the prong momenta change (this also covers objects reused when reading a TClonesArray)
+
+  const TObject *prim=GetPrimaryVtx();
+  const AliAODVertex *sec=GetSecondaryVtx();
+  Int_t np=GetNProngs();
+  Double_t key[3]={(np>0 && fPx) ? fPx[0] : 0., (np>0 && fPz) ? fPz[np-1] : 0., sec ? sec->GetX() : 0.};
+  if(fCacheMask && prim==fCachePrimVtx && sec==fCacheSecVtx &&
+     key[0]==fCacheKey[0] && key[1]==fCacheKey[1] && key[2]==fCacheKey[2]) return;
+  fCacheMask=0;
+  fCachePrimVtx=prim;
+  fCacheSecVtx=sec;
+  for(Int_t i=0; i<3; i++) fCacheKey[i]=key[i];
+  return;
+}
+
 inline void AliAODRecoDecayHF::SetNProngs(){
 if(!GetNProngs())fNProngs=fNProngsHF;
 }
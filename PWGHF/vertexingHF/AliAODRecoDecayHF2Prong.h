@@ -45,8 +45,12 @@ class AliAODRecoDecayHF2Prong : public AliAODRecoDecayHF {
   void CosThetaStarD0(Double_t &ctsD0,Double_t &ctsD0bar) const 
     {ctsD0=CosThetaStarD0();ctsD0bar=CosThetaStarD0bar();return;}
 
-  Double_t InvMassD0() const {UInt_t pdg[2]={211,321};return InvMass(2,pdg);}
-  Double_t InvMassD0bar() const {UInt_t pdg[2]={321,211};return InvMass(2,pdg);}
+  Double_t InvMassD0() const {
+    if(CachedValue(kCacheInvMass0)) return fCache[kCacheInvMass0];
+    UInt_t pdg[2]={211,321};return SetCachedValue(kCacheInvMass0,InvMass(2,pdg));}
+  Double_t InvMassD0bar() const {
+    if(CachedValue(kCacheInvMass1)) return fCache[kCacheInvMass1];
+    UInt_t pdg[2]={321,211};return SetCachedValue(kCacheInvMass1,InvMass(2,pdg));}
   void InvMassD0(Double_t &mD0,Double_t &mD0bar) const 
     {mD0=InvMassD0();mD0bar=InvMassD0bar();return;}
 
@@ -62,7 +66,9 @@ class AliAODRecoDecayHF2Prong : public AliAODRecoDecayHF {
 
   Double_t CosThetaStarJPSI() const {return CosThetaStar(1,443,11,11);} /// angle of e-
 
-  Double_t InvMassJPSIee() const {UInt_t pdg[2]={11,11};return InvMass(2,pdg);}
+  Double_t InvMassJPSIee() const {
+    if(CachedValue(kCacheInvMass2)) return fCache[kCacheInvMass2];
+    UInt_t pdg[2]={11,11};return SetCachedValue(kCacheInvMass2,InvMass(2,pdg));}
 
   Bool_t   SelectBtoJPSI(const Double_t* cuts,Int_t &okB) const;
   
@@ -53,7 +53,9 @@ class AliAODRecoDecayHF3Prong : public AliAODRecoDecayHF {
   Double_t CtDplus() const {return Ct(411);} 
   Double_t CtDplus(Double_t point[3]) const {return AliAODRecoDecay::Ct(411,point);}
   Double_t CtDplus(AliAODVertex *vtx1) const {return AliAODRecoDecay::Ct(411,vtx1);}
-  Double_t InvMassDplus() const {UInt_t pdg[3]={211,321,211};return InvMass(3,pdg);}
+  Double_t InvMassDplus() const {
+    if(CachedValue(kCacheInvMass0)) return fCache[kCacheInvMass0];
+    UInt_t pdg[3]={211,321,211};return SetCachedValue(kCacheInvMass0,InvMass(3,pdg));}
   Bool_t   SelectDplus(const Double_t* cuts) const;
 
   /// Ds+->KKpi
@@ -62,8 +64,12 @@ class AliAODRecoDecayHF3Prong : public AliAODRecoDecayHF {
   Double_t CtDs() const {return Ct(431);} 
   Double_t CtDs(Double_t point[3]) const {return AliAODRecoDecay::Ct(431,point);}
   Double_t CtDs(AliAODVertex *vtx1) const {return AliAODRecoDecay::Ct(431,vtx1);}
-  Double_t InvMassDsKKpi() const {UInt_t pdg[3]={321,321,211};return InvMass(3,pdg);}
-  Double_t InvMassDspiKK() const {UInt_t pdg[3]={211,321,321};return InvMass(3,pdg);}
+  Double_t InvMassDsKKpi() const {
+    if(CachedValue(kCacheInvMass1)) return fCache[kCacheInvMass1];
+    UInt_t pdg[3]={321,321,211};return SetCachedValue(kCacheInvMass1,InvMass(3,pdg));}
+  Double_t InvMassDspiKK() const {
+    if(CachedValue(kCacheInvMass2)) return fCache[kCacheInvMass2];
+    UInt_t pdg[3]={211,321,321};return SetCachedValue(kCacheInvMass2,InvMass(3,pdg));}
   
   Double_t CosPiKPhiRFrameKKpi() const {return CosPiKPhiRFrame(0);}
   Double_t CosPiKPhiRFramepiKK() const {return CosPiKPhiRFrame(1);}
@@ -84,8 +90,12 @@ class AliAODRecoDecayHF3Prong : public AliAODRecoDecayHF {
   Double_t CtLc() const {return Ct(4122);} 
   Double_t CtLc(Double_t point[3]) const {return AliAODRecoDecay::Ct(4122,point);}
   Double_t CtLc(AliAODVertex *vtx1) const {return AliAODRecoDecay::Ct(4122,vtx1);}
-  Double_t InvMassLcpKpi() const {UInt_t pdg[3]={2212,321,211};return InvMass(3,pdg);}
-  Double_t InvMassLcpiKp() const {UInt_t pdg[3]={211,321,2212};return InvMass(3,pdg);}
+  Double_t InvMassLcpKpi() const {
+    if(CachedValue(kCacheInvMass3)) return fCache[kCacheInvMass3];
+    UInt_t pdg[3]={2212,321,211};return SetCachedValue(kCacheInvMass3,InvMass(3,pdg));}
+  Double_t InvMassLcpiKp() const {
+    if(CachedValue(kCacheInvMass4)) return fCache[kCacheInvMass4];
+    UInt_t pdg[3]={211,321,2212};return SetCachedValue(kCacheInvMass4,InvMass(3,pdg));}
   Double_t InvMassCdeuterondKpi() const {UInt_t pdg[3]={1000010020,321,211};return InvMass(3,pdg);}
   Double_t InvMassCdeuteronpiKd() const {UInt_t pdg[3]={211,321,1000010020};return InvMass(3,pdg);}
   Bool_t   SelectLc(const Double_t* cuts,Int_t &okLcpKpi,Int_t &okLcpiKp) 
@@ -22,6 +22,7 @@
 // Authors: F. Prino, A. Rossi
 /////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <TList.h>
 #include <TH1F.h>
 #include <TDatabasePDG.h>
@@ -212,17 +213,21 @@ AliAnalysisTaskCombinHF::AliAnalysisTaskCombinHF():
   fNMultPoolsLimSize(2),
   fMultPoolLims(0x0),
   fNOfPools(1),
-  fEventBuffer(0x0),
-  fEventInfo(new TObjString("")),
+  fEventPools(),
+  fCurrentEvent(),
+  fSelTracks(),
+  fCosRot(),
+  fSinRot(),
+  fCosRot3(),
+  fSinRot3(),
+  fRotMass2(),
   fVtxZ(0),
   fMultiplicityEM(0),
   fMultiplicityMC(0),
   fMultEstimMC(0),
   fNumOfMultBins(200),
   fMinMultiplicity(-0.5),
-  fMaxMultiplicity(199.5),
-  fKaonTracks(0x0),
-  fPionTracks(0x0)
+  fMaxMultiplicity(199.5)
 {
   /// default constructor
 }
@@ -388,17 +393,21 @@ AliAnalysisTaskCombinHF::AliAnalysisTaskCombinHF(Int_t meson, AliRDHFCuts* analy
   fNMultPoolsLimSize(2),
   fMultPoolLims(0x0),
   fNOfPools(1),
-  fEventBuffer(0x0),
-  fEventInfo(new TObjString("")),
+  fEventPools(),
+  fCurrentEvent(),
+  fSelTracks(),
+  fCosRot(),
+  fSinRot(),
+  fCosRot3(),
+  fSinRot3(),
+  fRotMass2(),
   fVtxZ(0),
   fMultiplicityEM(0),
   fMultiplicityMC(0),
   fMultEstimMC(0),
   fNumOfMultBins(200),
   fMinMultiplicity(-0.5),
-  fMaxMultiplicity(199.5),
-  fKaonTracks(0x0),
-  fPionTracks(0x0)
+  fMaxMultiplicity(199.5)
 {
   /// standard constructor
   DefineOutput(1,TList::Class());  //My private output
@@ -519,16 +528,6 @@ AliAnalysisTaskCombinHF::~AliAnalysisTaskCombinHF()
   delete fTrackCutsPion;
   delete fTrackCutsKaon;
   delete fAnalysisCuts;
-  if(fKaonTracks) fKaonTracks->Delete();
-  if(fPionTracks) fPionTracks->Delete();
-  delete fKaonTracks;
-  delete fPionTracks;
-
-  if(fEventBuffer){
-    for(Int_t i=0; i<fNOfPools; i++) delete fEventBuffer[i];
-    delete fEventBuffer;
-  }
-  delete fEventInfo;
   delete [] fzVertPoolLims;
   delete [] fMultPoolLims;
 }
@@ -952,20 +951,7 @@ void AliAnalysisTaskCombinHF::UserCreateOutputObjects()
   PostData(3, fListCuts);
 
   
-  fKaonTracks = new TObjArray();
-  fPionTracks=new TObjArray();
-  fKaonTracks->SetOwner();
-  fPionTracks->SetOwner();
-
-  fEventBuffer = new TTree*[fNOfPools];
-  for(Int_t i=0; i<fNOfPools; i++){
-    fEventBuffer[i]=new TTree(Form("EventBuffer_%d",i), "Temporary buffer for event mixing");
-    fEventBuffer[i]->Branch("zVertex", &fVtxZ);
-    fEventBuffer[i]->Branch("multiplicity", &fMultiplicityEM);
-    fEventBuffer[i]->Branch("eventInfo", "TObjString",&fEventInfo);
-    fEventBuffer[i]->Branch("karray", "TObjArray", &fKaonTracks);
-    fEventBuffer[i]->Branch("parray", "TObjArray", &fPionTracks);
-  }
+  fEventPools.assign(fNOfPools,std::vector<MixEvent>());
 
   PostData(1,fOutput);
   PostData(2,fCounter);
@@ -1334,55 +1320,60 @@ void AliAnalysisTaskCombinHF::UserExec(Option_t */*option*/){
   Double_t d03[3]={0.,0.,0.};
   AliAODRecoDecay* tmpRD2 = new AliAODRecoDecay(0x0,2,0,d02);
   AliAODRecoDecay* tmpRD3 = new AliAODRecoDecay(0x0,3,1,d03);
-  Double_t tmpp[3];
   Double_t px[3],py[3],pz[3];
   Int_t dgLabels[3];
-  fKaonTracks->Delete();
-  fPionTracks->Delete();
   AliAnalysisVertexingHF* vHF=new AliAnalysisVertexingHF();
 
-  for(Int_t iTr1=0; iTr1<ntracks; iTr1++){
-    AliAODTrack* trK=dynamic_cast<AliAODTrack*>(aod->GetTrack(iTr1));
-    if(!trK){
-      AliWarning("Error in casting track to AOD track. Not a standard AOD?");
-      continue;
-    }
-    if((status[iTr1] & 1)==0) continue;
+  // selected tracks with momenta and PID bits, tracks compatible with each prong and tracks for event mixing
+  fSelTracks.Clear();
+  for(Int_t iProng=0; iProng<3; iProng++) fTracksForProng[iProng].clear();
+  fCurrentEvent.fKaons.clear();
+  fCurrentEvent.fPions.clear();
+  for(Int_t iTr=0; iTr<ntracks; iTr++){
+    if((status[iTr] & 1)==0) continue;
+    AliAODTrack* track=dynamic_cast<AliAODTrack*>(aod->GetTrack(iTr));
+    if(!track) continue;
+    Int_t iSel=fSelTracks.fTrack.size();
+    fSelTracks.Add(track,status[iTr]);
+    if(status[iTr] & pidBitToTestTr1) fTracksForProng[0].push_back(iSel);
+    if(status[iTr] & pidBitToTestTr2) fTracksForProng[1].push_back(iSel);
+    if(nProngs==3 && (status[iTr] & pidBitToTestTr3)) fTracksForProng[2].push_back(iSel);
     if(fDoEventMixing>0){
+      MixTrack mixTr={track->Px(),track->Py(),track->Pz(),(Char_t)track->Charge()};
       if(fMeson==kJpsi || fMeson==kEtac){
-        if(status[iTr1] & 8) {
-          fKaonTracks->AddLast(new TLorentzVector(trK->Px(),trK->Py(),trK->Pz(),trK->Charge()));
-          fPionTracks->AddLast(new TLorentzVector(trK->Px(),trK->Py(),trK->Pz(),trK->Charge()));
+        if(status[iTr] & 8) {
+          fCurrentEvent.fKaons.push_back(mixTr);
+          fCurrentEvent.fPions.push_back(mixTr);
         }
       }else{
-        if(status[iTr1] & 2) fKaonTracks->AddLast(new TLorentzVector(trK->Px(),trK->Py(),trK->Pz(),trK->Charge()));
-        if(status[iTr1] & 4) fPionTracks->AddLast(new TLorentzVector(trK->Px(),trK->Py(),trK->Pz(),trK->Charge()));
+        if(status[iTr] & 2) fCurrentEvent.fKaons.push_back(mixTr);
+        if(status[iTr] & 4) fCurrentEvent.fPions.push_back(mixTr);
       }
     }
-    if((status[iTr1] & pidBitToTestTr1)==0) continue;
-    Int_t chargeK=trK->Charge();
-    trK->GetPxPyPz(tmpp);
-    px[0] = tmpp[0];
-    py[0] = tmpp[1];
-    pz[0] = tmpp[2];
-    dgLabels[0]=trK->GetLabel();
-    Int_t firstTr2=0;
-    if(pidBitToTestTr2==pidBitToTestTr1) firstTr2=iTr1+1; //avoid double counting for etac and J/psi
-    for(Int_t iTr2=firstTr2; iTr2<ntracks; iTr2++){
-      if((status[iTr2] & 1)==0) continue;
-      if((status[iTr2] & pidBitToTestTr2)==0) continue;
-      if(iTr1==iTr2) continue;
-      AliAODTrack* trPi1=dynamic_cast<AliAODTrack*>(aod->GetTrack(iTr2));
-      if(!trPi1){
-        AliWarning("Error in casting track to AOD track. Not a standard AOD?");
-        continue;
-      }
-      Int_t chargePi1=trPi1->Charge();
-      trPi1->GetPxPyPz(tmpp);
-      px[1] = tmpp[0];
-      py[1] = tmpp[1];
-      pz[1] = tmpp[2];
-      dgLabels[1]=trPi1->GetLabel();
+  }
+  const std::vector<Int_t>& tracksTr1=fTracksForProng[0];
+  const std::vector<Int_t>& tracksTr2=fTracksForProng[1];
+  const std::vector<Int_t>& tracksTr3=fTracksForProng[2];
+
+  for(UInt_t i1=0; i1<tracksTr1.size(); i1++){
+    Int_t iSel1=tracksTr1[i1];
+    AliAODTrack* trK=fSelTracks.fTrack[iSel1];
+    Int_t chargeK=fSelTracks.fCharge[iSel1];
+    px[0] = fSelTracks.fPx[iSel1];
+    py[0] = fSelTracks.fPy[iSel1];
+    pz[0] = fSelTracks.fPz[iSel1];
+    dgLabels[0]=fSelTracks.fLabel[iSel1];
+    UInt_t firstTr2=0;
+    if(pidBitToTestTr2==pidBitToTestTr1) firstTr2=i1+1; //avoid double counting for etac and J/psi
+    for(UInt_t i2=firstTr2; i2<tracksTr2.size(); i2++){
+      Int_t iSel2=tracksTr2[i2];
+      if(iSel1==iSel2) continue;
+      AliAODTrack* trPi1=fSelTracks.fTrack[iSel2];
+      Int_t chargePi1=fSelTracks.fCharge[iSel2];
+      px[1] = fSelTracks.fPx[iSel2];
+      py[1] = fSelTracks.fPy[iSel2];
+      pz[1] = fSelTracks.fPz[iSel2];
+      dgLabels[1]=fSelTracks.fLabel[iSel2];
       if(nProngs==2){
         if(chargePi1==chargeK){
           // LS candidate
@@ -1425,21 +1416,17 @@ void AliAnalysisTaskCombinHF::UserExec(Option_t */*option*/){
           }
         }
       }else{
-        for(Int_t iTr3=iTr2+1; iTr3<ntracks; iTr3++){
-          if((status[iTr3] & 1)==0) continue;
-          if((status[iTr3] & pidBitToTestTr3)==0) continue;
-          if(iTr1==iTr3) continue;
-          AliAODTrack* trPi2=dynamic_cast<AliAODTrack*>(aod->GetTrack(iTr3));
-          if(!trPi2){
-            AliWarning("Error in casting track to AOD track. Not a standard AOD?");
-            continue;
-          }
-          Int_t chargePi2=trPi2->Charge();
-          trPi2->GetPxPyPz(tmpp);
-          px[2] = tmpp[0];
-          py[2] = tmpp[1];
-          pz[2] = tmpp[2];
-          dgLabels[2]=trPi2->GetLabel();
+        // third prong after the second one in the order of the event
+        UInt_t firstTr3=std::upper_bound(tracksTr3.begin(),tracksTr3.end(),iSel2)-tracksTr3.begin();
+        for(UInt_t i3=firstTr3; i3<tracksTr3.size(); i3++){
+          Int_t iSel3=tracksTr3[i3];
+          if(iSel1==iSel3) continue;
+          AliAODTrack* trPi2=fSelTracks.fTrack[iSel3];
+          Int_t chargePi2=fSelTracks.fCharge[iSel3];
+          px[2] = fSelTracks.fPx[iSel3];
+          py[2] = fSelTracks.fPy[iSel3];
+          pz[2] = fSelTracks.fPz[iSel3];
+          dgLabels[2]=fSelTracks.fLabel[iSel3];
           if(fMeson==kDs){
             Double_t massKK=ComputeInvMassKK(trK,trPi2);
             Double_t deltaMass=massKK-TDatabasePDG::Instance()->GetParticle(333)->Mass();
@@ -1488,20 +1475,23 @@ void AliAnalysisTaskCombinHF::UserExec(Option_t */*option*/){
   
   fCounter->StoreCandidates(aod,nFiltered,kTRUE);
   fCounter->StoreCandidates(aod,nSelected,kFALSE);
-  fEventInfo->SetString(Form("Ev%d_esd%d_Pi%d_K%d",mgr->GetNcalls(),((AliAODHeader*)aod->GetHeader())->GetEventNumberESDFile(),fPionTracks->GetEntries(),fKaonTracks->GetEntries()));
+  fCurrentEvent.fzVertex=fVtxZ;
+  fCurrentEvent.fMultiplicity=fMultiplicityEM;
+  fCurrentEvent.fEventId=(Int_t)mgr->GetNcalls();
+  fCurrentEvent.fESDEventId=((AliAODHeader*)aod->GetHeader())->GetEventNumberESDFile();
   if(fDoEventMixing==1){
     Int_t ind=GetPoolIndex(fVtxZ,fMultiplicityEM);
     if(ind>=0 && ind<fNOfPools){
       fEventsPerPool->Fill(fVtxZ,fMultiplicityEM);
-      fEventBuffer[ind]->Fill();
-      if(fEventBuffer[ind]->GetEntries() >= fNumberOfEventsForMixing){
+      fEventPools[ind].push_back(fCurrentEvent);
+      if((Int_t)fEventPools[ind].size() >= fNumberOfEventsForMixing){
         fMixingsPerPool->Fill(fVtxZ,fMultiplicityEM);
           DoMixingWithPools(ind);
           ResetPool(ind);
       }
     }
   }else if(fDoEventMixing==2){ // mix with cuts, no pools
-      fEventBuffer[0]->Fill();
+      fEventPools[0].push_back(fCurrentEvent);
   }
   PostData(1,fOutput);
   PostData(2,fCounter);
@@ -1736,14 +1726,19 @@ Bool_t AliAnalysisTaskCombinHF::FillHistos(Int_t pdgD,Int_t nProngs, AliAODRecoD
   Double_t ptOrig=pt;
   
   
-  Double_t rotStep=0.;
-  if(fNRotations>1) rotStep=(fMaxAngleForRot-fMinAngleForRot)/(fNRotations-1); // -1 is to ensure that the last rotation is done with angle=fMaxAngleForRot
   if(TMath::Abs(pdgD)==421 || TMath::Abs(pdgD)==431) fNRotations3=1;
-  Double_t rotStep3=0.;
-  if(fNRotations3>1) rotStep3=(fMaxAngleForRot3-fMinAngleForRot3)/(fNRotations3-1); // -1 is to ensure that the last rotation is done with angle=fMaxAngleForRot
+
+  // invariant mass of all the rotated candidates in one pass, the rotated candidate
+  // is built only if it can be in the mass range (margin for the rounding differences)
+  ComputeRotatedMass2(pdgD,nProngs,px,py,pz,pdgdau);
+  const Double_t margin2=1.e-6;
+  const Double_t minMass2Rot=fMinMass*fMinMass-margin2;
+  const Double_t maxMass2Rot=fMaxMass*fMaxMass+margin2;
 
   for(Int_t irot=0; irot<fNRotations; irot++){
-    Double_t phirot=fMinAngleForRot+rotStep*irot;
+    if(fRotMass2[irot]<=minMass2Rot || fRotMass2[irot]>=maxMass2Rot) continue;
+    Double_t cosrot=fCosRot[irot];
+    Double_t sinrot=fSinRot[irot];
     Double_t tmpx=px[0];
     Double_t tmpy=py[0];
     Double_t tmpx2=px[2];
@@ -1752,18 +1747,17 @@ Bool_t AliAnalysisTaskCombinHF::FillHistos(Int_t pdgD,Int_t nProngs, AliAODRecoD
       //rotate pion w.r.t. phi meson
       tmpx=px[1];
       tmpy=py[1];
-      px[1]=tmpx*TMath::Cos(phirot)-tmpy*TMath::Sin(phirot);
-      py[1]=tmpx*TMath::Sin(phirot)+tmpy*TMath::Cos(phirot);
+      px[1]=tmpx*cosrot-tmpy*sinrot;
+      py[1]=tmpx*sinrot+tmpy*cosrot;
     }
     else {
-      px[0]=tmpx*TMath::Cos(phirot)-tmpy*TMath::Sin(phirot);
-      py[0]=tmpx*TMath::Sin(phirot)+tmpy*TMath::Cos(phirot);
+      px[0]=tmpx*cosrot-tmpy*sinrot;
+      py[0]=tmpx*sinrot+tmpy*cosrot;
     }
     for(Int_t irot3=0; irot3<fNRotations3; irot3++){
       if(pdgD==411){
-        Double_t phirot2=fMaxAngleForRot3-rotStep3*irot;
-        px[2]=tmpx*TMath::Cos(phirot2)-tmpy*TMath::Sin(phirot2);
-        py[2]=tmpx*TMath::Sin(phirot2)+tmpy*TMath::Cos(phirot2);
+        px[2]=tmpx*fCosRot3[irot]-tmpy*fSinRot3[irot];
+        py[2]=tmpx*fSinRot3[irot]+tmpy*fCosRot3[irot];
       }
       tmpRD->SetPxPyPzProngs(nProngs,px,py,pz);
       pt = tmpRD->Pt();
@@ -1812,6 +1806,71 @@ Bool_t AliAnalysisTaskCombinHF::FillHistos(Int_t pdgD,Int_t nProngs, AliAODRecoD
   
 }
 //________________________________________________________________________
+void AliAnalysisTaskCombinHF::ComputeRotatedMass2(Int_t pdgD, Int_t nProngs, const Double_t* px, const Double_t* py, const Double_t* pz, const UInt_t *pdgdau){
+  /// invariant mass squared of the candidate for all the track rotations done in FillHistos
+  /// (pion for the Ds, first prong otherwise, for the D+ also the third prong from the first one)
+
+  if((Int_t)fCosRot.size()!=fNRotations){
+    Double_t rotStep=0.;
+    if(fNRotations>1) rotStep=(fMaxAngleForRot-fMinAngleForRot)/(fNRotations-1); // -1 is to ensure that the last rotation is done with angle=fMaxAngleForRot
+    Double_t rotStep3=0.;
+    if(fNRotations3>1) rotStep3=(fMaxAngleForRot3-fMinAngleForRot3)/(fNRotations3-1); // -1 is to ensure that the last rotation is done with angle=fMaxAngleForRot
+    fCosRot.resize(fNRotations);
+    fSinRot.resize(fNRotations);
+    fCosRot3.resize(fNRotations);
+    fSinRot3.resize(fNRotations);
+    fRotMass2.resize(fNRotations);
+    for(Int_t irot=0; irot<fNRotations; irot++){
+      Double_t phirot=fMinAngleForRot+rotStep*irot;
+      fCosRot[irot]=TMath::Cos(phirot);
+      fSinRot[irot]=TMath::Sin(phirot);
+      Double_t phirot2=fMaxAngleForRot3-rotStep3*irot;
+      fCosRot3[irot]=TMath::Cos(phirot2);
+      fSinRot3[irot]=TMath::Sin(phirot2);
+    }
+  }
+  if(fNRotations<=0) return;
+
+  // the rotations change only px and py of the rotated prongs, not their energy
+  Int_t iRot=0;
+  if(pdgD==431) iRot=1;
+  Double_t pxFix=0.,pyFix=0.,pzTot=0.,eTot=0.;
+  for(Int_t i=0; i<nProngs; i++){
+    Double_t massDau=TDatabasePDG::Instance()->GetParticle(pdgdau[i])->Mass();
+    pzTot+=pz[i];
+    if(pdgD==411 && i==2){
+      eTot+=TMath::Sqrt(massDau*massDau+px[0]*px[0]+py[0]*py[0]+pz[2]*pz[2]);
+      continue;
+    }
+    eTot+=TMath::Sqrt(massDau*massDau+px[i]*px[i]+py[i]*py[i]+pz[i]*pz[i]);
+    if(i==iRot) continue;
+    pxFix+=px[i];
+    pyFix+=py[i];
+  }
+  Double_t e2pz2=eTot*eTot-pzTot*pzTot;
+  Double_t xr=px[iRot];
+  Double_t yr=py[iRot];
+  const Double_t* cosRot=&fCosRot[0];
+  const Double_t* sinRot=&fSinRot[0];
+  Double_t* mass2=&fRotMass2[0];
+  if(pdgD==411){
+    const Double_t* cosRot3=&fCosRot3[0];
+    const Double_t* sinRot3=&fSinRot3[0];
+    for(Int_t irot=0; irot<fNRotations; irot++){
+      Double_t pxTot=pxFix+xr*(cosRot[irot]+cosRot3[irot])-yr*(sinRot[irot]+sinRot3[irot]);
+      Double_t pyTot=pyFix+xr*(sinRot[irot]+sinRot3[irot])+yr*(cosRot[irot]+cosRot3[irot]);
+      mass2[irot]=e2pz2-pxTot*pxTot-pyTot*pyTot;
+    }
+  }else{
+    for(Int_t irot=0; irot<fNRotations; irot++){
+      Double_t pxTot=pxFix+xr*cosRot[irot]-yr*sinRot[irot];
+      Double_t pyTot=pyFix+xr*sinRot[irot]+yr*cosRot[irot];
+      mass2[irot]=e2pz2-pxTot*pxTot-pyTot*pyTot;
+    }
+  }
+  return;
+}
+//________________________________________________________________________
 void AliAnalysisTaskCombinHF::FillMEHistos(Int_t pdgD,Int_t nProngs, AliAODRecoDecay* tmpRD, Double_t* px, Double_t* py, Double_t* pz, UInt_t *pdgdau){
   /// Fill histos for candidates in MixedEvents
     
@@ -2068,14 +2127,8 @@ Int_t AliAnalysisTaskCombinHF::GetPoolIndex(Double_t zvert, Double_t mult){
 //_________________________________________________________________
 void AliAnalysisTaskCombinHF::ResetPool(Int_t poolIndex){
   /// delete the contets of the pool
-  if(poolIndex<0 || poolIndex>=fNOfPools) return;
-  delete fEventBuffer[poolIndex];
-  fEventBuffer[poolIndex]=new TTree(Form("EventBuffer_%d",poolIndex), "Temporary buffer for event mixing");
-  fEventBuffer[poolIndex]->Branch("zVertex", &fVtxZ);
-  fEventBuffer[poolIndex]->Branch("multiplicity", &fMultiplicityEM);
-  fEventBuffer[poolIndex]->Branch("eventInfo", "TObjString",&fEventInfo);
-  fEventBuffer[poolIndex]->Branch("karray", "TObjArray", &fKaonTracks);
-  fEventBuffer[poolIndex]->Branch("parray", "TObjArray", &fPionTracks);
+  if(poolIndex<0 || poolIndex>=(Int_t)fEventPools.size()) return;
+  fEventPools[poolIndex].clear();
   return;
 }
 //_________________________________________________________________
@@ -2090,81 +2143,49 @@ void AliAnalysisTaskCombinHF::DoMixingWithCuts(){
   /// perform mixed event analysis
 
   if(fDoEventMixing==0) return;
-  Int_t nEvents=fEventBuffer[0]->GetEntries();
+  if(fEventPools.empty()) return;
+  const std::vector<MixEvent>& pool=fEventPools[0];
+  Int_t nEvents=pool.size();
   if(fDebug > 1) printf("AnalysisTaskCombinHF::DoMixingWithCuts Start Event Mixing of %d events\n",nEvents);
 
-  TObjArray* karray=0x0;
-  TObjArray* parray=0x0;
-  Double_t zVertex,mult;
-  TObjString* eventInfo=0x0;
-  fEventBuffer[0]->SetBranchAddress("karray", &karray);
-  fEventBuffer[0]->SetBranchAddress("parray", &parray);
-  fEventBuffer[0]->SetBranchAddress("eventInfo",&eventInfo);
-  fEventBuffer[0]->SetBranchAddress("zVertex", &zVertex);
-  fEventBuffer[0]->SetBranchAddress("multiplicity", &mult);
   Double_t d02[2]={0.,0.};
-  Double_t d03[3]={0.,0.,0.};
   AliAODRecoDecay* tmpRD2 = new AliAODRecoDecay(0x0,2,0,d02);
-  AliAODRecoDecay* tmpRD3 = new AliAODRecoDecay(0x0,3,1,d03);
   UInt_t pdg0[2]={321,211};
-  //  UInt_t pdgp[3]={321,211,211};
   Double_t px[3],py[3],pz[3];
-  Int_t evId1,esdId1,nk1,np1;
-  Int_t evId2,esdId2,nk2,np2;
 
   for(Int_t iEv1=0; iEv1<nEvents; iEv1++){
-    fEventBuffer[0]->GetEvent(iEv1);
-    TObjArray* karray1=(TObjArray*)karray->Clone();
-    Double_t zVertex1=zVertex;
-    Double_t mult1=mult;
-    Int_t nKaons=karray1->GetEntries();
-    Int_t nPionsForCheck=parray->GetEntries();
-    sscanf((eventInfo->String()).Data(),"Ev%d_esd%d_Pi%d_K%d",&evId1,&esdId1,&np1,&nk1);
-    if(nk1!=nKaons || np1!=nPionsForCheck){ 
-      printf("AnalysisTaskCombinHF::DoMixingWithCuts ERROR: read event does not match to the stored one\n");
-      delete karray1;
-      continue;
-    }
+    const MixEvent& ev1=pool[iEv1];
+    Int_t nKaons=ev1.fKaons.size();
     for(Int_t iEv2=0; iEv2<fNumberOfEventsForMixing; iEv2++){
       Int_t iToMix=iEv1+iEv2+1;
       if(iEv1>=(nEvents-fNumberOfEventsForMixing)) iToMix=iEv1-iEv2-1;
       if(iToMix<0) continue;
       if(iToMix==iEv1) continue;
       if(iToMix<iEv1) continue;
-      fEventBuffer[0]->GetEvent(iToMix);
-      Double_t zVertex2=zVertex;
-      Double_t mult2=mult;
-      if(TMath::Abs(zVertex2-zVertex1)<0.0001 && TMath::Abs(mult2-mult1)<0.001){
-        printf("AnalysisTaskCombinHF::DoMixingWithCuts ERROR: same event in mixing??? %d %d   %f %f  %f %f\n",iEv1,iEv2,zVertex1,zVertex2,mult1,mult2);
-        continue;
-      }
-      TObjArray* parray2=(TObjArray*)parray->Clone();
-      Int_t nPions=parray2->GetEntries();
-      Int_t nKaonsForCheck=karray->GetEntries();
-      sscanf((eventInfo->String()).Data(),"Ev%d_esd%d_Pi%d_K%d",&evId2,&esdId2,&np2,&nk2);
-      if(nk2!=nKaonsForCheck || np2!=nPions){ 
-        printf("AnalysisTaskCombinHF::DoMixingWithCuts ERROR: read event does not match to the stored one\n");
-        delete parray2;
+      if(iToMix>=nEvents) continue;
+      const MixEvent& ev2=pool[iToMix];
+      if(TMath::Abs(ev2.fzVertex-ev1.fzVertex)<0.0001 && TMath::Abs(ev2.fMultiplicity-ev1.fMultiplicity)<0.001){
+        printf("AnalysisTaskCombinHF::DoMixingWithCuts ERROR: same event in mixing??? %d %d   %f %f  %f %f\n",iEv1,iEv2,ev1.fzVertex,ev2.fzVertex,ev1.fMultiplicity,ev2.fMultiplicity);
         continue;
       }
-      if(evId2==evId1 && esdId2==esdId1){
-        printf("AnalysisTaskCombinHF::DoMixingWithCuts ERROR: same event in mixing??? %d %d   nK=%d %d  nPi=%d %d\n",evId1,evId2,nKaons,nKaonsForCheck,nPionsForCheck,nPions);
-        delete parray2;
+      Int_t nPions=ev2.fPions.size();
+      if(ev2.fEventId==ev1.fEventId && ev2.fESDEventId==ev1.fESDEventId){
+        printf("AnalysisTaskCombinHF::DoMixingWithCuts ERROR: same event in mixing??? %d %d   nK=%d %d  nPi=%d %d\n",iEv1,iEv2,nKaons,(Int_t)ev2.fKaons.size(),(Int_t)ev1.fPions.size(),nPions);
         continue;
       }
-      if(CanBeMixed(zVertex1,zVertex2,mult1,mult2)){
+      if(CanBeMixed(ev1.fzVertex,ev2.fzVertex,ev1.fMultiplicity,ev2.fMultiplicity)){
         for(Int_t iTr1=0; iTr1<nKaons; iTr1++){
-          TLorentzVector* trK=(TLorentzVector*)karray1->At(iTr1);
-          Double_t chargeK=trK->T();
-          px[0] = trK->Px();
-          py[0] = trK->Py();
-          pz[0] = trK->Pz();
+          const MixTrack& trK=ev1.fKaons[iTr1];
+          Double_t chargeK=trK.fCharge;
+          px[0] = trK.fPx;
+          py[0] = trK.fPy;
+          pz[0] = trK.fPz;
           for(Int_t iTr2=0; iTr2<nPions; iTr2++){
-            TLorentzVector* trPi1=(TLorentzVector*)parray2->At(iTr2);
-            Double_t chargePi1=trPi1->T();
-            px[1] = trPi1->Px();
-            py[1] = trPi1->Py();
-            pz[1] = trPi1->Pz();
+            const MixTrack& trPi1=ev2.fPions[iTr2];
+            Double_t chargePi1=trPi1.fCharge;
+            px[1] = trPi1.fPx;
+            py[1] = trPi1.fPy;
+            pz[1] = trPi1.fPz;
             if(fMeson==kDzero && chargePi1*chargeK<0){
               FillMEHistos(421,2,tmpRD2,px,py,pz,pdg0);
             }
@@ -2174,31 +2195,20 @@ void AliAnalysisTaskCombinHF::DoMixingWithCuts(){
           }
         }
       }
-      delete parray2;
     }
-    delete karray1;
   }
   delete tmpRD2;
-  delete tmpRD3;
 }
 //_________________________________________________________________
 void AliAnalysisTaskCombinHF::DoMixingWithPools(Int_t poolIndex){
   /// perform mixed event analysis
 
   if(fDoEventMixing==0) return;
-  if(poolIndex<0 || poolIndex>fNzVertPools*fNMultPools) return;
+  if(poolIndex<0 || poolIndex>=(Int_t)fEventPools.size()) return;
 
-  Int_t nEvents=fEventBuffer[poolIndex]->GetEntries();
+  const std::vector<MixEvent>& pool=fEventPools[poolIndex];
+  Int_t nEvents=pool.size();
   if(fDebug > 1) printf("AliAnalysisTaskCombinHF::DoMixingWithPools Start Event Mixing of %d events\n",nEvents);
-  TObjArray* karray=0x0;
-  TObjArray* parray=0x0;
-  Double_t zVertex,mult;
-  TObjString* eventInfo=0x0;
-  fEventBuffer[poolIndex]->SetBranchAddress("karray", &karray);
-  fEventBuffer[poolIndex]->SetBranchAddress("parray", &parray);
-  fEventBuffer[poolIndex]->SetBranchAddress("eventInfo",&eventInfo);
-  fEventBuffer[poolIndex]->SetBranchAddress("zVertex", &zVertex);
-  fEventBuffer[poolIndex]->SetBranchAddress("multiplicity", &mult);
 
   // dummy values of track impact parameter, needed to build an AliAODRecoDecay object
   Double_t d02[2]={0.,0.};
@@ -2206,8 +2216,6 @@ void AliAnalysisTaskCombinHF::DoMixingWithPools(Int_t poolIndex){
   AliAODRecoDecay* tmpRD2 = new AliAODRecoDecay(0x0,2,0,d02);
   AliAODRecoDecay* tmpRD3 = new AliAODRecoDecay(0x0,3,1,d03);
   Double_t px[3],py[3],pz[3];
-  Int_t evId1,esdId1,nk1,np1;
-  Int_t evId2,esdId2,nk2,np2;
   UInt_t pdg2pr[2]={321,211};
   UInt_t pdg3pr[3]={321,211,211};
   Int_t pdgOfD=421;
@@ -2233,42 +2241,21 @@ void AliAnalysisTaskCombinHF::DoMixingWithPools(Int_t poolIndex){
   }
 
   for(Int_t iEv1=0; iEv1<nEvents; iEv1++){
-    fEventBuffer[poolIndex]->GetEvent(iEv1);
-    TObjArray* karray1=(TObjArray*)karray->Clone();
-    Double_t zVertex1=zVertex;
-    Double_t mult1=mult;
-    Int_t nKaons=karray1->GetEntries();
-    Int_t nPionsForCheck=parray->GetEntries();
-    sscanf((eventInfo->String()).Data(),"Ev%d_esd%d_Pi%d_K%d",&evId1,&esdId1,&np1,&nk1);
-    if(nk1!=nKaons || np1!=nPionsForCheck){ 
-      printf("AliAnalysisTaskCombinHF::DoMixingWithPools ERROR: read event does not match to the stored one\n");
-      delete karray1;
-      continue;
-    }
+    const MixEvent& ev1=pool[iEv1];
+    Int_t nKaons=ev1.fKaons.size();
     for(Int_t iEv2=0; iEv2<nEvents; iEv2++){
       if(iEv2==iEv1) continue;
-      fEventBuffer[poolIndex]->GetEvent(iEv2);
-      Double_t zVertex2=zVertex;
-      Double_t mult2=mult;
-      if(TMath::Abs(zVertex2-zVertex1)<0.0001 && TMath::Abs(mult2-mult1)<0.001){
-        printf("AliAnalysisTaskCombinHF::DoMixingWithPools ERROR: same event in mixing??? %d %d   %f %f  %f %f\n",iEv1,iEv2,zVertex1,zVertex2,mult1,mult2);
+      const MixEvent& ev2=pool[iEv2];
+      if(TMath::Abs(ev2.fzVertex-ev1.fzVertex)<0.0001 && TMath::Abs(ev2.fMultiplicity-ev1.fMultiplicity)<0.001){
+        printf("AliAnalysisTaskCombinHF::DoMixingWithPools ERROR: same event in mixing??? %d %d   %f %f  %f %f\n",iEv1,iEv2,ev1.fzVertex,ev2.fzVertex,ev1.fMultiplicity,ev2.fMultiplicity);
         continue;
       }
-      TObjArray* parray2=(TObjArray*)parray->Clone();
-      Int_t nPions=parray2->GetEntries();
-      Int_t nKaonsForCheck=karray->GetEntries();
-      sscanf((eventInfo->String()).Data(),"Ev%d_esd%d_Pi%d_K%d",&evId2,&esdId2,&np2,&nk2);
-      if(nk2!=nKaonsForCheck || np2!=nPions){ 
-        printf("AliAnalysisTaskCombinHF::DoMixingWithPools ERROR: read event does not match to the stored one\n");
-        delete parray2;
+      Int_t nPions=ev2.fPions.size();
+      if(ev2.fEventId==ev1.fEventId && ev2.fESDEventId==ev1.fESDEventId){
+        printf("AliAnalysisTaskCombinHF::DoMixingWithPools ERROR: same event in mixing??? %d %d   nK=%d %d  nPi=%d %d\n",iEv1,iEv2,nKaons,(Int_t)ev2.fKaons.size(),(Int_t)ev1.fPions.size(),nPions);
         continue;
       }
-      if(evId2==evId1 && esdId2==esdId1){
-        printf("AliAnalysisTaskCombinHF::DoMixingWithPools ERROR: same event in mixing??? %d %d   nK=%d %d  nPi=%d %d\n",evId1,evId2,nKaons,nKaonsForCheck,nPionsForCheck,nPions);
-        delete parray2;
-        continue;
-      }     
-      TObjArray* parray3=0x0;
+      const std::vector<MixTrack>* pions3=0x0;
       Int_t nPions3=0;
       if(fMeson==kDplus){
         Int_t iEv3=iEv2+1;
@@ -2276,49 +2263,52 @@ void AliAnalysisTaskCombinHF::DoMixingWithPools(Int_t poolIndex){
         if(iEv3>=nEvents) iEv3=iEv2-3;
         if(nEvents==2) iEv3=iEv1;
         if(iEv3<0) iEv3=iEv2-1;
-        fEventBuffer[poolIndex]->GetEvent(iEv3);
-        parray3=(TObjArray*)parray->Clone();
-        nPions3=parray3->GetEntries();
+        if(iEv3<0 || iEv3>=nEvents) iEv3=iEv2; // the pions of the second event, as for an invalid entry of the former tree buffer
+        pions3=&(pool[iEv3].fPions);
+        nPions3=pions3->size();
       }
       for(Int_t iTr1=0; iTr1<nKaons; iTr1++){
-        TLorentzVector* trK=(TLorentzVector*)karray1->At(iTr1);
-        Double_t chargeK=trK->T();
-        px[0] = trK->Px();
-        py[0] = trK->Py();
-        pz[0] = trK->Pz();
+        const MixTrack& trK=ev1.fKaons[iTr1];
+        Double_t chargeK=trK.fCharge;
+        px[0] = trK.fPx;
+        py[0] = trK.fPy;
+        pz[0] = trK.fPz;
         for(Int_t iTr2=0; iTr2<nPions; iTr2++){
-          TLorentzVector* trPi1=(TLorentzVector*)parray2->At(iTr2);
-          Double_t chargePi1=trPi1->T();
-          px[1] = trPi1->Px();
-          py[1] = trPi1->Py();
-          pz[1] = trPi1->Pz();
+          const MixTrack& trPi1=ev2.fPions[iTr2];
+          Double_t chargePi1=trPi1.fCharge;
+          px[1] = trPi1.fPx;
+          py[1] = trPi1.fPy;
+          pz[1] = trPi1.fPz;
           if(chargePi1*chargeK<0){
             if(nProngs==2){
               FillMEHistos(pdgOfD,nProngs,tmpRD2,px,py,pz,pdg2pr);
             }else if(fMeson==kDs) {
+              TLorentzVector vecK(trK.fPx,trK.fPy,trK.fPz,chargeK);
+              TLorentzVector vecPi(trPi1.fPx,trPi1.fPy,trPi1.fPz,chargePi1);
               for(Int_t iTr3=iTr1+1; iTr3<nKaons; iTr3++){
-                TLorentzVector* trK2=(TLorentzVector*)karray1->At(iTr3);
-                Double_t chargeK2=trK2->T();
-                px[2] = trK2->Px();
-                py[2] = trK2->Py();
-                pz[2] = trK2->Pz();
-                Double_t massKK=ComputeInvMassKK(trK,trK2);
+                const MixTrack& trK2=ev1.fKaons[iTr3];
+                Double_t chargeK2=trK2.fCharge;
+                px[2] = trK2.fPx;
+                py[2] = trK2.fPy;
+                pz[2] = trK2.fPz;
+                TLorentzVector vecK2(trK2.fPx,trK2.fPy,trK2.fPz,chargeK2);
+                Double_t massKK=ComputeInvMassKK(&vecK,&vecK2);
                 Double_t deltaMass=massKK-TDatabasePDG::Instance()->GetParticle(333)->Mass();
-                Double_t cos1=CosPiKPhiRFrame(trK,trK2,trPi1);
+                Double_t cos1=CosPiKPhiRFrame(&vecK,&vecK2,&vecPi);
                 Double_t kincutPiKPhi=TMath::Abs(cos1*cos1*cos1);
-                Double_t cosPiDsLabFrame=CosPiDsLabFrame(trK,trK2,trPi1);
+                Double_t cosPiDsLabFrame=CosPiDsLabFrame(&vecK,&vecK2,&vecPi);
                 if(chargeK2*chargeK<0 && TMath::Abs(deltaMass)<fPhiMassCut && kincutPiKPhi>fCutCos3PiKPhiRFrame && cosPiDsLabFrame<fCutCosPiDsLabFrame){
                   FillMEHistos(pdgOfD,nProngs,tmpRD3,px,py,pz,pdg3pr);
                 }
               }
             }else if(fMeson==kDplus){
-              if(parray3){
+              if(pions3){
                 for(Int_t iTr3=iTr2+1; iTr3<nPions3; iTr3++){
-                  TLorentzVector* trPi2=(TLorentzVector*)parray3->At(iTr3);
-                  Double_t chargePi2=trPi2->T();
-                  px[2] = trPi2->Px();
-                  py[2] = trPi2->Py();
-                  pz[2] = trPi2->Pz();
+                  const MixTrack& trPi2=(*pions3)[iTr3];
+                  Double_t chargePi2=trPi2.fCharge;
+                  px[2] = trPi2.fPx;
+                  py[2] = trPi2.fPy;
+                  pz[2] = trPi2.fPz;
                   if(chargePi2*chargeK<0){
                     FillMEHistos(pdgOfD,nProngs,tmpRD3,px,py,pz,pdg3pr);
                   }
@@ -2330,10 +2320,7 @@ void AliAnalysisTaskCombinHF::DoMixingWithPools(Int_t poolIndex){
           }
         }
       }
-      delete parray3;
-      delete parray2;
     }
-    delete karray1;
   }
   delete tmpRD2;
   delete tmpRD3;
@@ -2346,8 +2333,8 @@ void AliAnalysisTaskCombinHF::FinishTaskOutput()
   printf("AliAnalysisTaskCombinHF: FinishTaskOutput\n");
 
   if(fDoEventMixing==1){
-    for(Int_t i=0; i<fNOfPools; i++){
-      Int_t nEvents=fEventBuffer[i]->GetEntries();
+    for(Int_t i=0; i<(Int_t)fEventPools.size(); i++){
+      Int_t nEvents=fEventPools[i].size();
       if(nEvents>1) DoMixingWithPools(i);
     }
   }else if(fDoEventMixing==2){
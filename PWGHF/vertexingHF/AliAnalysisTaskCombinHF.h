@@ -13,6 +13,7 @@
 /// \author Authors: F. Prino, A. Rossi
 //////////////////////////////////////////////////////////////
 
+#include <vector>
 #include <TH1F.h>
 #include <TH3F.h>
 #include <TObjString.h>
@@ -165,6 +166,42 @@ private:
   Double_t ComputeInvMassKK(TLorentzVector* tr1, TLorentzVector* tr2) const;
   Double_t CosPiKPhiRFrame(TLorentzVector* dauK1, TLorentzVector* dauK2, TLorentzVector* daupi) const;
   Double_t CosPiDsLabFrame(TLorentzVector* dauK1, TLorentzVector* dauK2, TLorentzVector* daupi) const;
+  void ComputeRotatedMass2(Int_t pdgD, Int_t nProngs, const Double_t* px, const Double_t* py, const Double_t* pz, const UInt_t *pdgdau);
+
+  /// tracks of the event passing the track selection, in the order of the event (structure of arrays)
+  struct SelectedTracks {
+    void Clear() { fTrack.clear(); fStatus.clear(); fPx.clear(); fPy.clear(); fPz.clear(); fCharge.clear(); fLabel.clear(); }
+    void Add(AliAODTrack* track, UChar_t status){
+      Double_t p[3];
+      track->GetPxPyPz(p);
+      fTrack.push_back(track); fStatus.push_back(status);
+      fPx.push_back(p[0]); fPy.push_back(p[1]); fPz.push_back(p[2]);
+      fCharge.push_back(track->Charge()); fLabel.push_back(track->GetLabel());
+    }
+    std::vector<AliAODTrack*> fTrack; ///< track
+    std::vector<UChar_t> fStatus;     ///< selection and PID bits (1=sel, 2=K, 4=pi, 8=p)
+    std::vector<Double_t> fPx;        ///< momentum x
+    std::vector<Double_t> fPy;        ///< momentum y
+    std::vector<Double_t> fPz;        ///< momentum z
+    std::vector<Int_t> fCharge;       ///< charge
+    std::vector<Int_t> fLabel;        ///< MC label
+  };
+  /// track stored for the event mixing
+  struct MixTrack {
+    Double_t fPx;   ///< momentum x
+    Double_t fPy;   ///< momentum y
+    Double_t fPz;   ///< momentum z
+    Char_t fCharge; ///< charge
+  };
+  /// event stored for the event mixing
+  struct MixEvent {
+    Double_t fzVertex;              ///< z vertex
+    Double_t fMultiplicity;         ///< multiplicity for the pools
+    Int_t fEventId;                 ///< event number in the analysis, for event mixing checks
+    Int_t fESDEventId;              ///< event number in the ESD file, for event mixing checks
+    std::vector<MixTrack> fKaons;   ///< kaon-compatible tracks
+    std::vector<MixTrack> fPions;   ///< pion-compatible tracks
+  };
 
   TList *fOutput;                       //!<! list with output histograms
   TList *fListCuts;                     //!<! list with cut values 
@@ -331,8 +368,15 @@ private:
   Int_t fNMultPoolsLimSize;        /// number of pools in multiplicity for event mixing +1
   Double_t* fMultPoolLims;         //[fNMultPoolsLimSize] limits of the pools in multiplicity
   Int_t  fNOfPools;                /// number of pools
-  TTree** fEventBuffer;            //!<! structure for event mixing
-  TObjString* fEventInfo;          /// unique event Id for event mixing checks
+  std::vector<std::vector<MixEvent> > fEventPools; //!<! events stored for event mixing, per pool
+  MixEvent fCurrentEvent;          //!<! current event, to be stored for event mixing
+  SelectedTracks fSelTracks;       //!<! selected tracks of the current event
+  std::vector<Int_t> fTracksForProng[3]; //!<! indices in fSelTracks of the tracks compatible with each prong
+  std::vector<Double_t> fCosRot;   //!<! cos of the rotation angles
+  std::vector<Double_t> fSinRot;   //!<! sin of the rotation angles
+  std::vector<Double_t> fCosRot3;  //!<! cos of the rotation angles of the 3rd prong
+  std::vector<Double_t> fSinRot3;  //!<! sin of the rotation angles of the 3rd prong
+  std::vector<Double_t> fRotMass2; //!<! inv. mass squared of the rotated candidates
   Double_t fVtxZ;                  /// zVertex
   Double_t fMultiplicityEM;        /// multiplicity for ev mix pools
   Double_t fMultiplicityMC;        /// multiplicity for MC efficiencies
@@ -340,11 +384,9 @@ private:
   Int_t fNumOfMultBins;            /// number of bins for multiplcities in MC histos
   Double_t fMinMultiplicity;       /// lower limit for multiplcities in MC histos
   Double_t fMaxMultiplicity;       /// upper limit for multiplcities in MC histos
-  TObjArray* fKaonTracks;          /// array of kaon-compatible tracks (TLorentzVectors)
-  TObjArray* fPionTracks;          /// array of pion-compatible tracks (TLorentzVectors)
     
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskCombinHF,42); /// D0D+ task from AOD tracks
+  ClassDef(AliAnalysisTaskCombinHF,43); /// D0D+ task from AOD tracks
   /// \endcond
 };
 
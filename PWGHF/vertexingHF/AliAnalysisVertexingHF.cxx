@@ -70,6 +70,9 @@
 #include "AliCodeTimer.h"
 #include "AliMultSelection.h"
 #include <cstring>
+#include <algorithm>
+#include <thread>
+#include <TROOT.h>
 
 /// \cond CLASSIMP
 ClassImp(AliAnalysisVertexingHF);
@@ -139,6 +142,20 @@ fFindVertexForDstar(kTRUE),
 fFindVertexForCascades(kTRUE),
 fV0TypeForCascadeVertex(0),
 fMassCutBeforeVertexing(kFALSE),
+fUsePairPreselection(kFALSE),
+fPreselMaxDeltaEta(1.),
+fPreselMaxDeltaPhi(1.),
+fPreselDCATolerance(0.02),
+fPreselEta(),
+fPreselPhi(),
+fPreselPosMom(),
+fPreselCells(),
+fPreselCellOfTrk(),
+fPreselPartners(),
+fPreselNEtaCells(0),
+fPreselNPhiCells(0),
+fNThreads(1),
+fThreadVertexers(),
 fMassCalc2(0),
 fMassCalc3(0),
 fMassCalc4(0),
@@ -238,6 +255,20 @@ fFindVertexForDstar(source.fFindVertexForDstar),
 fFindVertexForCascades(source.fFindVertexForCascades),
 fV0TypeForCascadeVertex(source.fV0TypeForCascadeVertex),
 fMassCutBeforeVertexing(source.fMassCutBeforeVertexing),
+fUsePairPreselection(source.fUsePairPreselection),
+fPreselMaxDeltaEta(source.fPreselMaxDeltaEta),
+fPreselMaxDeltaPhi(source.fPreselMaxDeltaPhi),
+fPreselDCATolerance(source.fPreselDCATolerance),
+fPreselEta(),
+fPreselPhi(),
+fPreselPosMom(),
+fPreselCells(),
+fPreselCellOfTrk(),
+fPreselPartners(),
+fPreselNEtaCells(0),
+fPreselNPhiCells(0),
+fNThreads(source.fNThreads),
+fThreadVertexers(),
 fMassCalc2(source.fMassCalc2),
 fMassCalc3(source.fMassCalc3),
 fMassCalc4(source.fMassCalc4),
@@ -336,6 +367,11 @@ AliAnalysisVertexingHF &AliAnalysisVertexingHF::operator=(const AliAnalysisVerte
   fFindVertexForCascades = source.fFindVertexForCascades;
   fV0TypeForCascadeVertex = source.fV0TypeForCascadeVertex;
   fMassCutBeforeVertexing = source.fMassCutBeforeVertexing;
+  fUsePairPreselection = source.fUsePairPreselection;
+  fPreselMaxDeltaEta = source.fPreselMaxDeltaEta;
+  fPreselMaxDeltaPhi = source.fPreselMaxDeltaPhi;
+  fPreselDCATolerance = source.fPreselDCATolerance;
+  fNThreads = source.fNThreads;
   fMassCalc2 = source.fMassCalc2;
   fMassCalc3 = source.fMassCalc3;
   fMassCalc4 = source.fMassCalc4;
@@ -365,6 +401,7 @@ AliAnalysisVertexingHF::~AliAnalysisVertexingHF() {
   if(fV1) { delete fV1; fV1=0; }
   if(fV1AOD) { delete fV1AOD; fV1AOD=0; }
   delete fVertexerTracks;
+  for(UInt_t iThr=0; iThr<fThreadVertexers.size(); iThr++) delete fThreadVertexers[iThr];
   if(fTrackFilter) { delete fTrackFilter; fTrackFilter=0; }
   if(fTrackFilter2prongCentral) { delete fTrackFilter2prongCentral; fTrackFilter2prongCentral=0; }
   if(fTrackFilter3prongCentral) { delete fTrackFilter3prongCentral; fTrackFilter3prongCentral=0; }
@@ -444,6 +481,169 @@ TList *AliAnalysisVertexingHF::FillListOfCuts() {
   return list;
 }
 //----------------------------------------------------------------------------
+void AliAnalysisVertexingHF::PreparePairPreselection(Int_t nSeleTrks,const TObjArray &tracksAtVertex)
+{
+  /// Store eta, phi, position and momentum of the selected tracks at the primary vertex
+  /// and bin them in an eta-phi grid with cells of the size of the preselection window
+
+  fPreselEta.resize(nSeleTrks);
+  fPreselPhi.resize(nSeleTrks);
+  fPreselPosMom.resize(6*nSeleTrks);
+  fPreselCellOfTrk.resize(nSeleTrks);
+  if(nSeleTrks==0) return;
+
+  Float_t etaMin=999.,etaMax=-999.;
+  for(Int_t iTrk=0; iTrk<nSeleTrks; iTrk++) {
+    AliExternalTrackParam *par=(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrk);
+    par->GetXYZ(&fPreselPosMom[6*iTrk]);
+    par->GetPxPyPz(&fPreselPosMom[6*iTrk+3]);
+    fPreselEta[iTrk]=par->Eta();
+    fPreselPhi[iTrk]=par->Phi();
+    if(fPreselPhi[iTrk]<0.) fPreselPhi[iTrk]+=TMath::TwoPi();
+    if(fPreselEta[iTrk]<etaMin) etaMin=fPreselEta[iTrk];
+    if(fPreselEta[iTrk]>etaMax) etaMax=fPreselEta[iTrk];
+  }
+
+  Double_t dEta=TMath::Max(fPreselMaxDeltaEta,1.e-3);
+  Double_t dPhi=TMath::Max(fPreselMaxDeltaPhi,1.e-3);
+  fPreselNEtaCells=TMath::Min((Int_t)((etaMax-etaMin)/dEta)+1,1000);
+  fPreselNPhiCells=TMath::Max(TMath::Min((Int_t)(TMath::TwoPi()/dPhi),1000),1);
+
+  fPreselCells.resize(fPreselNEtaCells*fPreselNPhiCells);
+  for(UInt_t iCell=0; iCell<fPreselCells.size(); iCell++) fPreselCells[iCell].clear();
+  for(Int_t iTrk=0; iTrk<nSeleTrks; iTrk++) {
+    Int_t iEta=TMath::Min((Int_t)((fPreselEta[iTrk]-etaMin)/dEta),fPreselNEtaCells-1);
+    Int_t iPhi=TMath::Min((Int_t)(fPreselPhi[iTrk]/TMath::TwoPi()*fPreselNPhiCells),fPreselNPhiCells-1);
+    fPreselCellOfTrk[iTrk]=iEta*fPreselNPhiCells+iPhi;
+    fPreselCells[fPreselCellOfTrk[iTrk]].push_back(iTrk);
+  }
+  return;
+}
+//----------------------------------------------------------------------------
+Int_t AliAnalysisVertexingHF::FillPreselectedPartners(Int_t iTrk,std::vector<Int_t> &partners) const
+{
+  /// Fill partners with the tracks in the eta-phi cells adjacent to the one of iTrk,
+  /// in increasing index order as in the plain loop over the selected tracks
+
+  partners.clear();
+  Int_t iEta=fPreselCellOfTrk[iTrk]/fPreselNPhiCells;
+  Int_t iPhi=fPreselCellOfTrk[iTrk]%fPreselNPhiCells;
+  // with less than 3 phi cells the neighbours cover the full azimuth
+  Int_t nPhiSteps=TMath::Min(fPreselNPhiCells,3);
+  for(Int_t jEta=TMath::Max(iEta-1,0); jEta<=TMath::Min(iEta+1,fPreselNEtaCells-1); jEta++) {
+    for(Int_t jStep=0; jStep<nPhiSteps; jStep++) {
+      Int_t jPhi=(nPhiSteps<3) ? jStep : (iPhi+jStep-1+fPreselNPhiCells)%fPreselNPhiCells;
+      const std::vector<Int_t> &cell=fPreselCells[jEta*fPreselNPhiCells+jPhi];
+      partners.insert(partners.end(),cell.begin(),cell.end());
+    }
+  }
+  std::sort(partners.begin(),partners.end());
+  return (Int_t)partners.size();
+}
+//----------------------------------------------------------------------------
+Bool_t AliAnalysisVertexingHF::PassPairPreselection(Int_t iTrk1,Int_t iTrk2,Double_t dcaMax) const
+{
+  /// Cheap pair checks before the helix DCA and the vertexing: eta-phi window and
+  /// DCA of the two straight lines tangent to the tracks at the primary vertex
+
+  if(TMath::Abs(fPreselEta[iTrk1]-fPreselEta[iTrk2])>fPreselMaxDeltaEta) return kFALSE;
+  Double_t dphi=TMath::Abs(fPreselPhi[iTrk1]-fPreselPhi[iTrk2]);
+  if(dphi>TMath::Pi()) dphi=TMath::TwoPi()-dphi;
+  if(dphi>fPreselMaxDeltaPhi) return kFALSE;
+
+  const Double_t *pm1=&fPreselPosMom[6*iTrk1];
+  const Double_t *pm2=&fPreselPosMom[6*iTrk2];
+  Double_t w[3]={pm1[0]-pm2[0],pm1[1]-pm2[1],pm1[2]-pm2[2]};
+  Double_t n[3]={pm1[4]*pm2[5]-pm1[5]*pm2[4],pm1[5]*pm2[3]-pm1[3]*pm2[5],pm1[3]*pm2[4]-pm1[4]*pm2[3]};
+  Double_t n2=n[0]*n[0]+n[1]*n[1]+n[2]*n[2];
+  Double_t dca=0.;
+  if(n2>1.e-12) {
+    dca=TMath::Abs(w[0]*n[0]+w[1]*n[1]+w[2]*n[2])/TMath::Sqrt(n2);
+  } else { // parallel: distance of the second point from the first line
+    Double_t p2=pm1[3]*pm1[3]+pm1[4]*pm1[4]+pm1[5]*pm1[5];
+    Double_t wp=(w[0]*pm1[3]+w[1]*pm1[4]+w[2]*pm1[5])/p2;
+    dca=TMath::Sqrt(TMath::Max(w[0]*w[0]+w[1]*w[1]+w[2]*w[2]-wp*wp*p2,0.));
+  }
+  return dca<=dcaMax+fPreselDCATolerance;
+}
+//----------------------------------------------------------------------------
+void AliAnalysisVertexingHF::SetNumberOfThreads(Int_t nThreads)
+{
+  /// Set the number of threads used for the first-level pair vertexing
+
+  fNThreads=TMath::Max(nThreads,1);
+  if(fNThreads>1) ROOT::EnableThreadSafety();
+}
+//----------------------------------------------------------------------------
+void AliAnalysisVertexingHF::PrecomputePairVertices(Int_t firstTrkP,Int_t lastTrkP,const TObjArray &seleTrksArray,
+                                                    const UChar_t *seleFlags,const Int_t *evtNumber,Double_t dcaMax,
+                                                    std::vector<std::vector<PairVertex> > &pairs)
+{
+  /// Compute, in fNThreads threads, the DCA and the secondary vertex of the pairs made of the positive tracks
+  /// [firstTrkP,lastTrkP) and the second tracks that the candidate loop in FindCandidates would consider.
+  /// seleTrksArray holds copies of the selected tracks with their parameters at the primary vertex and is only read.
+  /// Each thread fills the rows of its own positive tracks, in increasing index of the second track.
+
+  // release the vertices of the previous block which were not used
+  for(Int_t iTrk=0; iTrk<firstTrkP; iTrk++) {
+    for(UInt_t iPair=0; iPair<pairs[iTrk].size(); iPair++) delete pairs[iTrk][iPair].fVertex;
+    pairs[iTrk].clear();
+  }
+
+  Int_t nSeleTrks=seleTrksArray.GetEntriesFast();
+  Int_t nThreads=TMath::Min(fNThreads,lastTrkP-firstTrkP);
+  while((Int_t)fThreadVertexers.size()<nThreads) fThreadVertexers.push_back(new AliVertexerTracks(fBzkG));
+  for(Int_t iThr=0; iThr<nThreads; iThr++) {
+    if(fThreadVertexers[iThr]->GetFieldkG()!=fBzkG) fThreadVertexers[iThr]->SetFieldkG(fBzkG);
+  }
+  if(fSecVtxWithKF) AliKFParticle::SetField(fBzkG);
+
+  auto work = [&](Int_t iThr) {
+    TObjArray twoTrackArray(2);
+    std::vector<Int_t> partners;
+    Double_t xdummy,ydummy;
+    for(Int_t iTrkP=firstTrkP+iThr; iTrkP<lastTrkP; iTrkP+=nThreads) {
+      std::vector<PairVertex> &row=pairs[iTrkP];
+      row.clear();
+      AliESDtrack *postrack=(AliESDtrack*)seleTrksArray.UncheckedAt(iTrkP);
+      if(!TESTBIT(seleFlags[iTrkP],kBitDispl)) continue;
+      if(postrack->Charge()<0 && !fLikeSign) continue;
+      Int_t nTrkN = fUsePairPreselection ? FillPreselectedPartners(iTrkP,partners) : nSeleTrks;
+      for(Int_t jTrkN=0; jTrkN<nTrkN; jTrkN++) {
+        Int_t iTrkN = fUsePairPreselection ? partners[jTrkN] : jTrkN;
+        if(iTrkN==iTrkP) continue;
+        AliESDtrack *negtrack=(AliESDtrack*)seleTrksArray.UncheckedAt(iTrkN);
+        if(negtrack->Charge()>0 && !fLikeSign) continue;
+        if(!TESTBIT(seleFlags[iTrkN],kBitDispl)) continue;
+        if(fMixEvent && evtNumber[iTrkP]==evtNumber[iTrkN]) continue;
+        if(postrack->Charge()==negtrack->Charge()) {
+          if(iTrkN<iTrkP) continue;
+        } else if(postrack->Charge()<0 || negtrack->Charge()>0) continue;
+        if(fUsePairPreselection && !PassPairPreselection(iTrkP,iTrkN,dcaMax)) continue;
+
+        PairVertex pv;
+        pv.fTrkN=iTrkN;
+        pv.fDCA=postrack->GetDCA(negtrack,fBzkG,xdummy,ydummy);
+        pv.fDispersion=0.;
+        pv.fVertex=0x0;
+        if(pv.fDCA<=dcaMax) {
+          twoTrackArray.AddAt(postrack,0);
+          twoTrackArray.AddAt(negtrack,1);
+          pv.fVertex=ReconstructSecondaryVertex(&twoTrackArray,pv.fDispersion,kTRUE,fThreadVertexers[iThr]);
+          twoTrackArray.Clear();
+        }
+        row.push_back(pv);
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for(Int_t iThr=1; iThr<nThreads; iThr++) workers.push_back(std::thread(work,iThr));
+  work(0);
+  for(UInt_t iThr=0; iThr<workers.size(); iThr++) workers[iThr].join();
+  return;
+}
+//----------------------------------------------------------------------------
 void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 					    TClonesArray *aodVerticesHFTClArr,
 					    TClonesArray *aodD0toKpiTClArr,
@@ -628,6 +828,9 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 
   AliDebug(1,Form(" Selected tracks: %d",nSeleTrks));
   fnSeleTrksTotal += nSeleTrks;
+  if(fUsePairPreselection) PreparePairPreselection(nSeleTrks,tracksAtVertex);
+  // the pair mass can be checked before vertexing only if the pair is not used to seed 3/4 prongs
+  Bool_t preselPairMass = fUsePairPreselection && !f3Prong && !f4Prong;
 
 
   TObjArray *twoTrackArray1    = new TObjArray(2);
@@ -662,9 +865,36 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
     if(minPtV0fromDp<minPtV0) minPtV0=minPtV0fromDp;
   }
    
+  // With more threads, the DCA and secondary vertex of the first-level pairs are computed in parallel
+  // for blocks of positive tracks (on copies of the tracks at the primary vertex) and then taken by
+  // the loop below in the same order as in serial mode, so that the output does not change
+  Bool_t usePairCache = (fNThreads>1 && nSeleTrks>1);
+  std::vector<std::vector<PairVertex> > pairVertices;
+  TObjArray pairTrksArray;
+  Int_t pairBlockEnd=0;
+  UInt_t pairCursor=0;
+  if(usePairCache) {
+    pairVertices.resize(nSeleTrks);
+    pairTrksArray.Expand(nSeleTrks);
+    pairTrksArray.SetOwner(kTRUE);
+    for(Int_t iTrk=0; iTrk<nSeleTrks; iTrk++) {
+      AliESDtrack *trkCopy = new AliESDtrack(*(AliESDtrack*)seleTrksArray.UncheckedAt(iTrk));
+      SetParametersAtVertex(trkCopy,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrk));
+      pairTrksArray.AddAt(trkCopy,iTrk);
+    }
+  }
+
   // LOOP ON  POSITIVE  TRACKS
   for(iTrkP1=0; iTrkP1<nSeleTrks; iTrkP1++) {
 
+    if(usePairCache) {
+      if(iTrkP1>=pairBlockEnd) {
+        pairBlockEnd=TMath::Min(iTrkP1+8*fNThreads,nSeleTrks);
+        PrecomputePairVertices(iTrkP1,pairBlockEnd,pairTrksArray,seleFlags,evtNumber,dcaMax,pairVertices);
+      }
+      pairCursor=0;
+    }
+
     //if(iTrkP1%1==0) AliDebug(1,Form("  1st loop on pos: track number %d of %d",iTrkP1,nSeleTrks));
     //if(iTrkP1%1==0) printf("  1st loop on pos: track number %d of %d\n",iTrkP1,nSeleTrks);
 
@@ -837,7 +1067,10 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
     if(postrack1->Charge()<0 && !fLikeSign) continue;
 
     // LOOP ON  NEGATIVE  TRACKS
-    for(iTrkN1=0; iTrkN1<nSeleTrks; iTrkN1++) {
+    // (with the pair preselection only on the tracks in the eta-phi neighbourhood, still in increasing index order)
+    Int_t nTrkN1 = fUsePairPreselection ? FillPreselectedPartners(iTrkP1,fPreselPartners) : nSeleTrks;
+    for(Int_t jTrkN1=0; jTrkN1<nTrkN1; jTrkN1++) {
+      iTrkN1 = fUsePairPreselection ? fPreselPartners[jTrkN1] : jTrkN1;
 
       //if(iTrkN1%1==0) AliDebug(1,Form("    1st loop on neg: track number %d of %d",iTrkN1,nSeleTrks));
       //if(iTrkN1%1==0) printf("    1st loop on neg: track number %d of %d\n",iTrkN1,nSeleTrks);
@@ -868,6 +1101,22 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 
       }
 
+      if(fUsePairPreselection) {
+        if(!PassPairPreselection(iTrkP1,iTrkN1,dcaMax)) { negtrack1=0; continue; }
+        if(preselPairMass) {
+          const Double_t *pm1=&fPreselPosMom[6*iTrkP1];
+          const Double_t *pm2=&fPreselPosMom[6*iTrkN1];
+          Double_t pxDau[2]={pm1[3],pm2[3]};
+          Double_t pyDau[2]={pm1[4],pm2[4]};
+          Double_t pzDau[2]={pm1[5],pm2[5]};
+          Bool_t okPairMass=kFALSE;
+          if(!okPairMass && fD0toKpi)   okPairMass=SelectInvMassAndPtD0Kpi(pxDau,pyDau,pzDau);
+          if(!okPairMass && fJPSItoEle) okPairMass=SelectInvMassAndPtJpsiee(pxDau,pyDau,pzDau);
+          if(!okPairMass && fDstar)     okPairMass=SelectInvMassAndPtDstarD0pi(pxDau,pyDau,pzDau);
+          if(!okPairMass) { negtrack1=0; continue; }
+        }
+      }
+
       // back to primary vertex
       //      postrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
       //      negtrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
@@ -876,13 +1125,26 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
       negtrack1->GetPxPyPz(momneg1);
 
       // DCA between the two tracks
-      dcap1n1 = postrack1->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
+      PairVertex *pairVtx=0x0;
+      if(usePairCache) {
+        std::vector<PairVertex> &row=pairVertices[iTrkP1];
+        while(pairCursor<row.size() && row[pairCursor].fTrkN<iTrkN1) pairCursor++;
+        if(pairCursor<row.size() && row[pairCursor].fTrkN==iTrkN1) pairVtx=&row[pairCursor];
+      }
+      dcap1n1 = pairVtx ? pairVtx->fDCA : postrack1->GetDCA(negtrack1,fBzkG,xdummy,ydummy);
       if(dcap1n1>dcaMax) { negtrack1=0; continue; }
 
       // Vertexing
       twoTrackArray1->AddAt(postrack1,0);
       twoTrackArray1->AddAt(negtrack1,1);
-      AliAODVertex *vertexp1n1 = ReconstructSecondaryVertex(twoTrackArray1,dispersion);
+      AliAODVertex *vertexp1n1 = 0x0;
+      if(pairVtx) {
+        vertexp1n1=pairVtx->fVertex;
+        pairVtx->fVertex=0x0;
+        dispersion=pairVtx->fDispersion;
+      } else {
+        vertexp1n1 = ReconstructSecondaryVertex(twoTrackArray1,dispersion);
+      }
       if(!vertexp1n1) {
 	twoTrackArray1->Clear();
 	negtrack1=0;
@@ -1101,6 +1363,9 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	if(fUseKaonPIDfor3Prong){
 	  if(!TESTBIT(seleFlags[iTrkN1],kBitKaonCompat)) continue;
 	}
+	if(fUsePairPreselection){
+	  if(!PassPairPreselection(iTrkP2,iTrkN1,dcaMax) || !PassPairPreselection(iTrkP2,iTrkP1,dcaMax)) continue;
+	}
 	Bool_t okForLcTopKpi=kTRUE;
 	Int_t pidLcStatus=3; // 3= OK as pKpi and Kpipi
 	if(fUsePIDforLc>0){
@@ -1258,6 +1523,10 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    if(negtrack2->Charge()>0) continue;
 
 	    if(!TESTBIT(seleFlags[iTrkN2],kBitDispl)) continue;
+
+	    if(fUsePairPreselection){
+	      if(!PassPairPreselection(iTrkN2,iTrkP1,dcaMax) || !PassPairPreselection(iTrkN2,iTrkP2,dcaMax)) continue;
+	    }
 	    if(fMixEvent){
 	      if(evtNumber[iTrkP1]==evtNumber[iTrkN2] ||
 		 evtNumber[iTrkN1]==evtNumber[iTrkN2] ||
@@ -1352,6 +1621,10 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	if(!TESTBIT(seleFlags[iTrkP1],kBit3Prong)) continue;
 	if(!TESTBIT(seleFlags[iTrkN1],kBit3Prong)) continue;
 
+	if(fUsePairPreselection){
+	  if(!PassPairPreselection(iTrkN2,iTrkP1,dcaMax) || !PassPairPreselection(iTrkN2,iTrkN1,dcaMax)) continue;
+	}
+
 	if(fMixEvent) {
 	  if(evtNumber[iTrkP1]==evtNumber[iTrkN2] ||
 	     evtNumber[iTrkN1]==evtNumber[iTrkN2] ||
@@ -1493,6 +1766,11 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
     postrack1 = 0;
  }  // end 1st loop on positive tracks
 
+  // vertices of pairs not used by the candidate loop
+  for(UInt_t iRow=0; iRow<pairVertices.size(); iRow++) {
+    for(UInt_t iPair=0; iPair<pairVertices[iRow].size(); iPair++) delete pairVertices[iRow][iPair].fVertex;
+  }
+
 
   //  AliDebug(1,Form(" Total HF vertices in event = %d;",
   //		  (Int_t)aodVerticesHFTClArr->GetEntriesFast()));
@@ -2932,6 +3210,8 @@ void AliAnalysisVertexingHF::PrintStatus() const {
   }
   if(fRecoPrimVtxSkippingTrks) printf("RecoPrimVtxSkippingTrks\n");
   if(fRmTrksFromPrimVtx) printf("RmTrksFromPrimVtx\n");
+  if(fNThreads>1) printf("Pair vertexing with %d threads\n",fNThreads);
+  if(fUsePairPreselection) printf("Pair preselection: |deta|<%f |dphi|<%f, straight-line DCA tolerance %f cm\n",fPreselMaxDeltaEta,fPreselMaxDeltaPhi,fPreselDCATolerance);
   if(fD0toKpi) {
     printf("Reconstruct D0->Kpi candidates with cuts:\n");
     if(fCutsD0toKpi) fCutsD0toKpi->PrintAll();
@@ -2977,9 +3257,11 @@ void AliAnalysisVertexingHF::PrintStatus() const {
 }
 //-----------------------------------------------------------------------------
 AliAODVertex* AliAnalysisVertexingHF::ReconstructSecondaryVertex(TObjArray *trkArray,
-								 Double_t &dispersion,Bool_t useTRefArray) const
+								 Double_t &dispersion,Bool_t useTRefArray,
+								 AliVertexerTracks *vertexer) const
 {
   /// Secondary vertex reconstruction with AliVertexerTracks or AliKFParticle
+  /// (vertexer: thread-local vertexer, the KF field is then set by the caller)
   //AliCodeTimerAuto("",0);
 
   AliESDVertex *vertexESD = 0;
@@ -2987,8 +3269,9 @@ AliAODVertex* AliAnalysisVertexingHF::ReconstructSecondaryVertex(TObjArray *trkA
 
   if(!fSecVtxWithKF) { // AliVertexerTracks
 
-    fVertexerTracks->SetVtxStart(fV1);
-    vertexESD = (AliESDVertex*)fVertexerTracks->VertexForSelectedESDTracks(trkArray);
+    AliVertexerTracks *vt = vertexer ? vertexer : fVertexerTracks;
+    vt->SetVtxStart(fV1);
+    vertexESD = (AliESDVertex*)vt->VertexForSelectedESDTracks(trkArray);
 
     if(!vertexESD) return vertexAOD;
 
@@ -3007,7 +3290,7 @@ AliAODVertex* AliAnalysisVertexingHF::ReconstructSecondaryVertex(TObjArray *trkA
 
   } else { // Kalman Filter vertexer (AliKFParticle)
 
-    AliKFParticle::SetField(fBzkG);
+    if(!vertexer) AliKFParticle::SetField(fBzkG);
 
     AliKFVertex vertexKF;
 
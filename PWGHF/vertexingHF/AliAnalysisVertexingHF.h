@@ -15,6 +15,7 @@
 
 #include <TNamed.h>
 #include <TList.h>
+#include <vector>
 
 #include "AliAnalysisFilter.h"
 #include "AliESDtrackCuts.h"
@@ -179,6 +180,15 @@ class AliAnalysisVertexingHF : public TNamed {
   void SetCutsDStartoKpipi(AliRDHFCutsDStartoKpipi* cuts) { fCutsDStartoKpipi = cuts; }
   AliRDHFCutsDStartoKpipi* GetCutsDStartoKpipi() const { return fCutsDStartoKpipi; }
   void SetMassCutBeforeVertexing(Bool_t flag) { fMassCutBeforeVertexing=flag; }
+  /// opt-in preselection of track pairs before DCA calculation and vertexing: daughters are looked up
+  /// in an eta-phi grid around the first track, pairs outside the |deta|,|dphi| window or with a
+  /// straight-line DCA at the primary vertex above the DCA cut + tolerance (cm) are skipped
+  void SetPairPreselection(Bool_t flag=kTRUE, Double_t maxDeltaEta=1.0, Double_t maxDeltaPhi=1.0, Double_t dcaTolerance=0.02){
+    fUsePairPreselection=flag; fPreselMaxDeltaEta=maxDeltaEta; fPreselMaxDeltaPhi=maxDeltaPhi; fPreselDCATolerance=dcaTolerance;}
+  /// number of threads used to compute the pair DCAs and 2-prong secondary vertices ahead of the
+  /// (serial) candidate loop; the output is identical to the one with 1 thread
+  void SetNumberOfThreads(Int_t nThreads);
+  Int_t GetNumberOfThreads() const { return fNThreads; }
 
   void SetMasses();
   Bool_t CheckCutsConsistency();
@@ -328,6 +338,20 @@ class AliAnalysisVertexingHF : public TNamed {
   Bool_t fFindVertexForCascades;  /// reconstruct a secondary vertex or assume it's from the primary vertex
   Int_t  fV0TypeForCascadeVertex;  /// Select which V0 type we want to use for the cascas
   Bool_t fMassCutBeforeVertexing; /// to go faster in PbPb
+  Bool_t fUsePairPreselection; /// eta-phi and straight-line DCA preselection of pairs (to go faster in PbPb)
+  Double_t fPreselMaxDeltaEta; /// max eta difference of preselected pairs
+  Double_t fPreselMaxDeltaPhi; /// max phi difference of preselected pairs
+  Double_t fPreselDCATolerance; /// tolerance on top of the DCA cut for the straight-line DCA estimate
+  std::vector<Float_t> fPreselEta; //! eta of the selected tracks at the primary vertex
+  std::vector<Float_t> fPreselPhi; //! phi of the selected tracks at the primary vertex
+  std::vector<Double_t> fPreselPosMom; //! x,y,z,px,py,pz of the selected tracks at the primary vertex
+  std::vector<std::vector<Int_t> > fPreselCells; //! selected tracks in each eta-phi cell
+  std::vector<Int_t> fPreselCellOfTrk; //! eta-phi cell of each selected track
+  std::vector<Int_t> fPreselPartners; //! candidate partners of the current track
+  Int_t fPreselNEtaCells; //! number of eta cells of the grid
+  Int_t fPreselNPhiCells; //! number of phi cells of the grid
+  Int_t fNThreads; /// threads for the pair vertexing
+  std::vector<AliVertexerTracks*> fThreadVertexers; //! vertexers of the worker threads
   // dummies for invariant mass calculation
   AliAODRecoDecay *fMassCalc2; /// for 2 prong
   AliAODRecoDecay *fMassCalc3; /// for 3 prong
@@ -400,7 +424,19 @@ class AliAnalysisVertexingHF : public TNamed {
 
   void MapAODtracks(AliVEvent *aod);
   AliAODVertex* PrimaryVertex(const TObjArray *trkArray=0x0,AliVEvent *event=0x0) const;
-  AliAODVertex* ReconstructSecondaryVertex(TObjArray *trkArray,Double_t &dispersion,Bool_t useTRefArray=kTRUE) const;
+  AliAODVertex* ReconstructSecondaryVertex(TObjArray *trkArray,Double_t &dispersion,Bool_t useTRefArray=kTRUE,
+                                          AliVertexerTracks *vertexer=0x0) const;
+
+  /// DCA and secondary vertex of a first-level pair, computed ahead of the candidate loop
+  struct PairVertex {
+    Int_t fTrkN;            // index of the second track
+    Double_t fDCA;          // DCA between the two tracks
+    Double_t fDispersion;   // vertex dispersion
+    AliAODVertex *fVertex;  // secondary vertex (owned until taken by the candidate loop)
+  };
+  void PrecomputePairVertices(Int_t firstTrkP,Int_t lastTrkP,const TObjArray &seleTrksArray,
+                              const UChar_t *seleFlags,const Int_t *evtNumber,Double_t dcaMax,
+                              std::vector<std::vector<PairVertex> > &pairs);
 
   Bool_t SelectInvMassAndPt3prong(Double_t *px,Double_t *py,Double_t *pz, Int_t pidLcStatus=3);
   Bool_t SelectInvMassAndPt4prong(Double_t *px,Double_t *py,Double_t *pz);
@@ -421,6 +457,10 @@ class AliAnalysisVertexingHF : public TNamed {
 				   UChar_t *seleFlags,Int_t *evtNumber);
   void SetParametersAtVertex(AliESDtrack* esdt, const AliExternalTrackParam* extpar) const;
 
+  void PreparePairPreselection(Int_t nSeleTrks,const TObjArray &tracksAtVertex);
+  Int_t FillPreselectedPartners(Int_t iTrk,std::vector<Int_t> &partners) const;
+  Bool_t PassPairPreselection(Int_t iTrk1,Int_t iTrk2,Double_t dcaMax) const;
+
   Bool_t SingleTrkCuts(AliESDtrack *trk,Float_t centralityperc, Bool_t &okDisplaced,Bool_t &okSoftPi, Bool_t &ok3prong, Bool_t &okBachelor) const;
 
   void   SetSelectionBitForPID(AliRDHFCuts *cuts,AliAODRecoDecayHF *rd,Int_t bit);
@@ -429,7 +469,7 @@ class AliAnalysisVertexingHF : public TNamed {
 				  TObjArray *twoTrackArrayV0);
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisVertexingHF,30);  // Reconstruction of HF decay candidates
+  ClassDef(AliAnalysisVertexingHF,32);  // Reconstruction of HF decay candidates
   /// \endcond
 };
 
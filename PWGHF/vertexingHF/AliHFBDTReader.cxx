@@ -0,0 +1,441 @@
+/**************************************************************************
+ * Copyright(c) 1998-2021, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//*************************************************************************
+// \class AliHFBDTReader
+// Runtime evaluator of TMVA BDTs (AdaBoost and Grad) read from the
+// .weights.xml or from the generated .class.cxx file
+/////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include <TError.h>
+#include <TString.h>
+#include <TXMLEngine.h>
+
+#include "AliHFBDTReader.h"
+
+//________________________________________________________________
+AliHFBDTReader::AliHFBDTReader():
+  IClassifierReader(),
+  fNodes(),
+  fTreeRoots(),
+  fBoostWeights(),
+  fNorm(0.),
+  fResponse(kNodeType),
+  fCutInclusive(false),
+  fVarNames(),
+  fInputVars()
+{
+  //
+  // Default constructor
+  //
+  fStatusIsClean=false;
+}
+
+//________________________________________________________________
+AliHFBDTReader::AliHFBDTReader(const std::vector<std::string>& inputVars):
+  IClassifierReader(),
+  fNodes(),
+  fTreeRoots(),
+  fBoostWeights(),
+  fNorm(0.),
+  fResponse(kNodeType),
+  fCutInclusive(false),
+  fVarNames(),
+  fInputVars(inputVars)
+{
+  //
+  // Constructor with the names of the input variables, checked against
+  // the ones of the file when the forest is loaded
+  //
+  fStatusIsClean=false;
+}
+
+//________________________________________________________________
+AliHFBDTReader* AliHFBDTReader::Create(const std::string& fileName, const std::vector<std::string>& inputVars)
+{
+  //
+  // Create a reader loading the forest from fileName
+  //
+  AliHFBDTReader* reader = new AliHFBDTReader(inputVars);
+  reader->Load(fileName);
+  return reader;
+}
+
+//________________________________________________________________
+void AliHFBDTReader::Clear()
+{
+  fNodes.clear();
+  fTreeRoots.clear();
+  fBoostWeights.clear();
+  fVarNames.clear();
+  fNorm=0.;
+  fStatusIsClean=false;
+}
+
+//________________________________________________________________
+bool AliHFBDTReader::Load(const std::string& fileName)
+{
+  //
+  // Load the forest, the format is given by the extension of the file
+  //
+  TString name(fileName.data());
+  if(name.EndsWith(".xml")) return LoadWeightsXML(fileName);
+  if(name.EndsWith(".C") || name.EndsWith(".cxx")) return LoadClassFile(fileName);
+  ::Error("AliHFBDTReader::Load","Unknown format of file %s",fileName.data());
+  Clear();
+  return false;
+}
+
+//________________________________________________________________
+bool AliHFBDTReader::LoadWeightsXML(const std::string& fileName)
+{
+  //
+  // Load the forest from the TMVA weight file
+  //
+  Clear();
+  fCutInclusive=true;
+
+  TXMLEngine xml;
+  XMLDocPointer_t doc = xml.ParseFile(fileName.data());
+  if(!doc) {
+    ::Error("AliHFBDTReader::LoadWeightsXML","Cannot parse file %s",fileName.data());
+    return false;
+  }
+  XMLNodePointer_t setup = xml.DocGetRootElement(doc);
+
+  std::string boostType="AdaBoost";
+  bool useYesNoLeaf=true;
+  bool ok=true;
+  for(XMLNodePointer_t sec = xml.GetChild(setup); sec && ok; sec = xml.GetNext(sec)) {
+    std::string secName = xml.GetNodeName(sec);
+    if(secName=="Options") {
+      for(XMLNodePointer_t opt = xml.GetChild(sec); opt; opt = xml.GetNext(opt)) {
+        const char* optName = xml.GetAttr(opt,"name");
+        const char* optVal = xml.GetNodeContent(opt);
+        if(!optName || !optVal) continue;
+        if(!strcmp(optName,"BoostType")) boostType=optVal;
+        else if(!strcmp(optName,"UseYesNoLeaf")) useYesNoLeaf=TString(optVal).Contains("True",TString::kIgnoreCase);
+      }
+    }
+    else if(secName=="Variables") {
+      for(XMLNodePointer_t var = xml.GetChild(sec); var; var = xml.GetNext(var)) {
+        const char* expr = xml.GetAttr(var,"Expression");
+        fVarNames.push_back(expr ? expr : "");
+      }
+    }
+    else if(secName=="Transformations") {
+      if(xml.GetIntAttr(sec,"NTransformations")>0) {
+        ::Error("AliHFBDTReader::LoadWeightsXML","Variable transformations are not supported");
+        ok=false;
+      }
+    }
+    else if(secName=="Weights") {
+      // the options precede the weights in the file
+      if(boostType=="Grad") fResponse=kGradBoost;
+      else if(boostType.find("AdaBoost")==0 || boostType=="AdaCost" || boostType=="Bagging") fResponse = useYesNoLeaf ? kNodeType : kPurity;
+      else {
+        ::Error("AliHFBDTReader::LoadWeightsXML","Boost type %s not supported",boostType.data());
+        ok=false;
+      }
+      for(XMLNodePointer_t bt = xml.GetChild(sec); bt && ok; bt = xml.GetNext(bt)) {
+        const char* bw = xml.GetAttr(bt,"boostWeight");
+        XMLNodePointer_t root = xml.GetChild(bt);
+        if(!root) continue;
+        // depth-first read of the nested <Node> elements
+        std::vector<InputNode> tree;
+        std::vector<std::pair<XMLNodePointer_t,int> > stack(1,std::make_pair(root,-1));
+        std::vector<char> isLeft(1,0);
+        while(!stack.empty()) {
+          XMLNodePointer_t xn = stack.back().first;
+          int parent = stack.back().second;
+          char left = isLeft.back();
+          stack.pop_back();
+          isLeft.pop_back();
+          InputNode n;
+          n.fLeft=-1;
+          n.fRight=-1;
+          n.fVar=xml.GetIntAttr(xn,"IVar");
+          const char* a = xml.GetAttr(xn,"Cut");
+          n.fCut = a ? strtod(a,0x0) : 0.;
+          n.fCutType = xml.GetIntAttr(xn,"cType")!=0;
+          n.fNodeType = xml.GetIntAttr(xn,"nType");
+          a = xml.GetAttr(xn,"purity");
+          n.fPurity = a ? strtod(a,0x0) : 0.;
+          a = xml.GetAttr(xn,"res");
+          n.fResponse = a ? strtod(a,0x0) : 0.;
+          int idx = (int)tree.size();
+          tree.push_back(n);
+          if(parent>=0) {
+            if(left) tree[parent].fLeft=idx;
+            else tree[parent].fRight=idx;
+          }
+          for(XMLNodePointer_t ch = xml.GetChild(xn); ch; ch = xml.GetNext(ch)) {
+            const char* pos = xml.GetAttr(ch,"pos");
+            stack.push_back(std::make_pair(ch,idx));
+            isLeft.push_back(pos && pos[0]=='l');
+          }
+        }
+        for(const InputNode& n : tree) {
+          if(n.fNodeType==0 && (n.fLeft<0 || n.fRight<0)) ok=false;
+        }
+        if(!ok) ::Error("AliHFBDTReader::LoadWeightsXML","Incomplete tree in file %s",fileName.data());
+        else AddTree(tree,0,(boostType=="Grad" || !bw) ? 1. : strtod(bw,0x0));
+      }
+    }
+  }
+  xml.FreeDoc(doc);
+
+  if(!ok || fTreeRoots.empty()) {
+    Clear();
+    return false;
+  }
+  fStatusIsClean=CheckVariables();
+  return fStatusIsClean;
+}
+
+//________________________________________________________________
+bool AliHFBDTReader::LoadClassFile(const std::string& fileName)
+{
+  //
+  // Load the forest from the standalone class written by MethodBase::MakeClass,
+  // the cut values are parsed from the same literals compiled in the class
+  //
+  Clear();
+  fCutInclusive=false;
+
+  std::ifstream in(fileName.data());
+  if(!in.good()) {
+    ::Error("AliHFBDTReader::LoadClassFile","Cannot open file %s",fileName.data());
+    return false;
+  }
+  std::stringstream ss;
+  ss << in.rdbuf();
+  const std::string text = ss.str();
+
+  if(text.find("fIsNormalised( true )")!=std::string::npos || text.find("fIsNormalised(true)")!=std::string::npos) {
+    ::Error("AliHFBDTReader::LoadClassFile","Normalised input variables are not supported");
+    return false;
+  }
+
+  size_t pos = text.find("myMVA +=");
+  if(pos==std::string::npos) {
+    ::Error("AliHFBDTReader::LoadClassFile","No BDT response found in file %s",fileName.data());
+    return false;
+  }
+  const std::string respLine = text.substr(pos,text.find('\n',pos)-pos);
+  if(respLine.find("GetResponse")!=std::string::npos) fResponse=kGradBoost;
+  else if(respLine.find("GetPurity")!=std::string::npos) fResponse=kPurity;
+  else fResponse=kNodeType;
+
+  // input variables: in the same file or in the header of a split class
+  std::string header = text;
+  if(text.find("inputVars[] = {")==std::string::npos && fileName.size()>4 && fileName.compare(fileName.size()-4,4,".cxx")==0) {
+    std::ifstream inh((fileName.substr(0,fileName.size()-4)+".h").data());
+    std::stringstream ssh;
+    ssh << inh.rdbuf();
+    header = ssh.str();
+  }
+  pos = header.find("inputVars[] = {");
+  if(pos!=std::string::npos) {
+    size_t end = header.find('}',pos);
+    size_t q1 = header.find('"',pos);
+    while(q1!=std::string::npos && q1<end) {
+      size_t q2 = header.find('"',q1+1);
+      fVarNames.push_back(header.substr(q1+1,q2-q1-1));
+      q1 = header.find('"',q2+1);
+    }
+  }
+
+  bool ok=true;
+  const char* const start = text.c_str();
+  const char* p = start;
+  auto skip = [&p]() { while(*p==' ' || *p=='\n' || *p=='\r' || *p=='\t' || *p==',') p++; };
+  while(ok) {
+    const char* bw = strstr(p,"fBoostWeights.push_back(");
+    if(!bw) break;
+    double boostWeight = strtod(bw+strlen("fBoostWeights.push_back("),0x0);
+    const char* fp = strstr(bw,"fForest.push_back(");
+    if(!fp) break;
+    p = fp+strlen("fForest.push_back(");
+
+    // NN(left, right, selector, cutValue, cutType, nodeType, purity, response):
+    // the children precede the parameters of the node
+    std::vector<InputNode> tree;
+    std::vector<int> open;
+    std::vector<int> nChildren;
+    int root=-1;
+    do {
+      skip();
+      if(!strncmp(p,"NN(",3)) {
+        p+=3;
+        open.push_back((int)tree.size());
+        nChildren.push_back(0);
+        InputNode n;
+        n.fLeft=-1;
+        n.fRight=-1;
+        tree.push_back(n);
+        continue;
+      }
+      if(open.empty()) {ok=false; break;}
+      int cur = open.back();
+      if(nChildren.back()<2) {
+        // null child
+        if(*p!='0') {ok=false; break;}
+        p++;
+        nChildren.back()++;
+        continue;
+      }
+      char* endp=0x0;
+      InputNode& n = tree[cur];
+      n.fVar = (int)strtol(p,&endp,10); p=endp; skip();
+      n.fCut = strtod(p,&endp); p=endp; skip();
+      n.fCutType = strtol(p,&endp,10)!=0; p=endp; skip();
+      n.fNodeType = (int)strtol(p,&endp,10); p=endp; skip();
+      n.fPurity = strtod(p,&endp); p=endp; skip();
+      n.fResponse = strtod(p,&endp); p=endp; skip();
+      if(*p!=')') {ok=false; break;}
+      p++;
+      open.pop_back();
+      nChildren.pop_back();
+      if(open.empty()) root=cur;
+      else {
+        int parent = open.back();
+        if(nChildren.back()==0) tree[parent].fLeft=cur;
+        else tree[parent].fRight=cur;
+        nChildren.back()++;
+      }
+    } while(!open.empty());
+
+    if(!ok || root<0) {
+      ::Error("AliHFBDTReader::LoadClassFile","Cannot parse tree %d in file %s",(int)fTreeRoots.size(),fileName.data());
+      ok=false;
+      break;
+    }
+    AddTree(tree,root,boostWeight);
+  }
+
+  if(!ok || fTreeRoots.empty()) {
+    Clear();
+    return false;
+  }
+  fStatusIsClean=CheckVariables();
+  return fStatusIsClean;
+}
+
+//________________________________________________________________
+bool AliHFBDTReader::CheckVariables()
+{
+  //
+  // Compare the input variables of the file with the ones expected by the user
+  //
+  if(fInputVars.empty() || fVarNames.empty()) return true;
+  if(fInputVars.size()!=fVarNames.size()) {
+    ::Error("AliHFBDTReader::CheckVariables","Mismatch in number of input values: %d != %d",(int)fInputVars.size(),(int)fVarNames.size());
+    return false;
+  }
+  for(size_t iVar=0; iVar<fInputVars.size(); iVar++) {
+    if(fInputVars[iVar]!=fVarNames[iVar]) {
+      ::Error("AliHFBDTReader::CheckVariables","Mismatch in input variable names for variable [%d]: %s != %s",(int)iVar,fInputVars[iVar].data(),fVarNames[iVar].data());
+      return false;
+    }
+  }
+  return true;
+}
+
+//________________________________________________________________
+void AliHFBDTReader::AddTree(const std::vector<InputNode>& tree, int root, double boostWeight)
+{
+  fTreeRoots.push_back(FlattenNode(tree,root));
+  fBoostWeights.push_back(boostWeight);
+  fNorm += boostWeight;
+}
+
+//________________________________________________________________
+int AliHFBDTReader::FlattenNode(const std::vector<InputNode>& tree, int iNode)
+{
+  //
+  // Store the node in pre-order, the child taken when the cut is not
+  // passed (x<=cut) right after its parent
+  //
+  const InputNode& in = tree[iNode];
+  int idx = (int)fNodes.size();
+  Node n;
+  n.fHigh=-1;
+  if(in.fNodeType!=0) {
+    n.fVar=-1;
+    n.fCut = fResponse==kNodeType ? (double)in.fNodeType : (fResponse==kPurity ? in.fPurity : in.fResponse);
+    fNodes.push_back(n);
+    return idx;
+  }
+  n.fVar=in.fVar;
+  n.fCut=in.fCut;
+  fNodes.push_back(n);
+  // cType=1: x>cut goes right, cType=0: x>cut goes left
+  int low = in.fCutType ? in.fLeft : in.fRight;
+  int high = in.fCutType ? in.fRight : in.fLeft;
+  FlattenNode(tree,low);
+  int iHigh = FlattenNode(tree,high);
+  fNodes[idx].fHigh=iHigh;
+  return idx;
+}
+
+//________________________________________________________________
+template<bool inclusive> double AliHFBDTReader::Evaluate(const double* inputValues) const
+{
+  const Node* nodes = fNodes.data();
+  double mva=0.;
+  for(size_t iTree=0; iTree<fTreeRoots.size(); iTree++) {
+    const Node* n = nodes+fTreeRoots[iTree];
+    while(n->fVar>=0) {
+      const double x = inputValues[n->fVar];
+      bool high = inclusive ? (x>=n->fCut) : (x>n->fCut);
+      n = high ? nodes+n->fHigh : n+1;
+    }
+    if(fResponse==kGradBoost) mva += n->fCut;
+    else mva += fBoostWeights[iTree]*n->fCut;
+  }
+  if(fResponse==kGradBoost) return 2.0/(1.0+std::exp(-2.0*mva))-1.0;
+  return mva/fNorm;
+}
+
+//________________________________________________________________
+double AliHFBDTReader::GetMvaValue(const double* inputValues) const
+{
+  if(!IsStatusClean()) return 0.;
+  return fCutInclusive ? Evaluate<true>(inputValues) : Evaluate<false>(inputValues);
+}
+
+//________________________________________________________________
+double AliHFBDTReader::GetMvaValue(const std::vector<double>& inputValues) const
+{
+  //
+  // Classifier response, same convention as the generated classes
+  //
+  if(!IsStatusClean()) {
+    ::Error("AliHFBDTReader::GetMvaValue","Cannot return classifier response because status is dirty");
+    return 0.;
+  }
+  if(!fVarNames.empty() && inputValues.size()<fVarNames.size()) {
+    ::Error("AliHFBDTReader::GetMvaValue","Too few input values: %d < %d",(int)inputValues.size(),(int)fVarNames.size());
+    return 0.;
+  }
+  return GetMvaValue(inputValues.data());
+}
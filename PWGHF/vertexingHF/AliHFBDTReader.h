@@ -0,0 +1,84 @@
+#ifndef ALIHFBDTREADER_H
+#define ALIHFBDTREADER_H
+/* Copyright(c) 1998-2021, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//***********************************************************
+/// \class AliHFBDTReader
+/// \brief Runtime evaluator of TMVA BDTs stored in a flat node array
+///
+/// The forest is read at runtime either from the TMVA weight file
+/// (.weights.xml) or from the standalone class generated by
+/// MethodBase::MakeClass (.class.cxx), so that the generated code does not
+/// need to be compiled into a library. Reading a .class.cxx file gives
+/// the same scores as the compiled class, reading the .weights.xml gives
+/// the same scores as TMVA::Reader.
+//***********************************************************
+
+#include <string>
+#include <vector>
+#include "IClassifierReader.h"
+
+class AliHFBDTReader : public IClassifierReader {
+
+ public:
+
+  enum EResponse {kNodeType, kPurity, kGradBoost};
+
+  AliHFBDTReader();
+  AliHFBDTReader(const std::vector<std::string>& inputVars);
+  virtual ~AliHFBDTReader() {}
+
+  bool Load(const std::string& fileName);
+  bool LoadWeightsXML(const std::string& fileName);
+  bool LoadClassFile(const std::string& fileName);
+  static AliHFBDTReader* Create(const std::string& fileName, const std::vector<std::string>& inputVars);
+
+  virtual double GetMvaValue(const std::vector<double>& inputValues) const;
+  double GetMvaValue(const double* inputValues) const;
+
+  size_t GetNTrees() const {return fTreeRoots.size();}
+  size_t GetNNodes() const {return fNodes.size();}
+  const std::vector<std::string>& GetVariableNames() const {return fVarNames;}
+  int GetResponseType() const {return fResponse;}
+
+ private:
+
+  /// node of the flat array: the child taken for x<=cut (x<cut if fCutInclusive)
+  /// is stored right after the node, the other one at fHigh. Leaves have fVar<0
+  /// and their response in fCut
+  struct Node {
+    double fCut;
+    int fVar;
+    int fHigh;
+  };
+
+  /// node of the tree as read from the file, before flattening
+  struct InputNode {
+    int fLeft;
+    int fRight;
+    int fVar;
+    double fCut;
+    bool fCutType;
+    int fNodeType;
+    double fPurity;
+    double fResponse;
+  };
+
+  void Clear();
+  bool CheckVariables();
+  void AddTree(const std::vector<InputNode>& tree, int root, double boostWeight);
+  int FlattenNode(const std::vector<InputNode>& tree, int iNode);
+  template<bool inclusive> double Evaluate(const double* inputValues) const;
+
+  std::vector<Node> fNodes;              //! nodes of all the trees
+  std::vector<int> fTreeRoots;           //! index of the root node of each tree
+  std::vector<double> fBoostWeights;     //! boost weight of each tree
+  double fNorm;                          //! sum of the boost weights
+  int fResponse;                         //! leaf response (see EResponse)
+  bool fCutInclusive;                    //! x>=cut (TMVA::Reader) instead of x>cut (generated class)
+  std::vector<std::string> fVarNames;    //! input variables read from the file
+  std::vector<std::string> fInputVars;   //! input variables expected by the user
+};
+
+#endif
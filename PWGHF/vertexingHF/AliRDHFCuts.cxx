@@ -22,6 +22,7 @@
 // Author: A.Dainese, andrea.dainese@pd.infn.it
 /////////////////////////////////////////////////////////////
 #include <Riostream.h>
+#include <algorithm>
 
 #include "AliVEvent.h"
 #include "AliVTrack.h"
@@ -148,7 +149,15 @@ fUseTimeRangeCutForPbPb2018(kTRUE),
 fTimeRangeCut(),
 fCurrentRun(-1),
 fEnableNsigmaTPCDataCorr(kFALSE),
-fSystemForNsigmaTPCDataCorr(AliAODPidHF::kNone)
+fSystemForNsigmaTPCDataCorr(AliAODPidHF::kNone),
+fUseAdaptiveCutOrder(kFALSE),
+fNCandForCutOrder(1000),
+fCutVariations(),
+fCutOrder(),
+fCutRejections(),
+fNCandCutOrderSeen(0),
+fCutSign(),
+fCutTableValues()
 {
   //
   // Default Constructor
@@ -243,7 +252,15 @@ AliRDHFCuts::AliRDHFCuts(const AliRDHFCuts &source) :
   fTimeRangeCut(),
   fCurrentRun(source.fCurrentRun),
   fEnableNsigmaTPCDataCorr(source.fEnableNsigmaTPCDataCorr),
-  fSystemForNsigmaTPCDataCorr(source.fSystemForNsigmaTPCDataCorr)
+  fSystemForNsigmaTPCDataCorr(source.fSystemForNsigmaTPCDataCorr),
+  fUseAdaptiveCutOrder(source.fUseAdaptiveCutOrder),
+  fNCandForCutOrder(source.fNCandForCutOrder),
+  fCutVariations(source.fCutVariations),
+  fCutOrder(),
+  fCutRejections(),
+  fNCandCutOrderSeen(0),
+  fCutSign(),
+  fCutTableValues()
 {
   //
   // Copy constructor
@@ -360,6 +377,11 @@ AliRDHFCuts &AliRDHFCuts::operator=(const AliRDHFCuts &source)
   fCurrentRun=source.fCurrentRun;
   fEnableNsigmaTPCDataCorr=source.fEnableNsigmaTPCDataCorr;
   fSystemForNsigmaTPCDataCorr=source.fSystemForNsigmaTPCDataCorr;
+  fUseAdaptiveCutOrder=source.fUseAdaptiveCutOrder;
+  fNCandForCutOrder=source.fNCandForCutOrder;
+  fCutVariations=source.fCutVariations;
+  fCutSign.clear();
+  ResetCutOrder();
 
   PrintAll();
 
@@ -1544,6 +1566,102 @@ void AliRDHFCuts::SetCuts(Int_t glIndex,Float_t* cutsRDGlob){
   return;
 }
 //---------------------------------------------------------------------------
+Int_t AliRDHFCuts::AddCutVariation(Int_t nVars,Int_t nPtBins,Float_t **cutsRD) {
+  //
+  // store a variation of the cuts, evaluated together with the other
+  // variations by IsSelectedCutVariations. Returns its bit in the mask
+  //
+  if(nVars!=fnVars || nPtBins!=fnPtBins) {
+    AliError(Form("Wrong size of the cut variation: it has to be %d vars x %d pt bins",fnVars,fnPtBins));
+    return -1;
+  }
+  Int_t iVariation=GetNCutVariations();
+  if(iVariation>=64) {
+    AliError("Too many cut variations, at most 64 can be stored");
+    return -1;
+  }
+  fCutVariations.resize((iVariation+1)*fGlobalIndex);
+  Float_t *cuts=&fCutVariations[iVariation*fGlobalIndex];
+  for(Int_t iv=0; iv<fnVars; iv++) {
+    for(Int_t ib=0; ib<fnPtBins; ib++) cuts[GetGlobalIndex(iv,ib)] = cutsRD[iv][ib];
+  }
+  return iVariation;
+}
+//---------------------------------------------------------------------------
+ULong64_t AliRDHFCuts::EvaluateCutVariations(const Float_t *vals,Int_t ptbin) const {
+  //
+  // evaluate all the stored cut variations in one pass over the values
+  // of the cut variables, bit i of the output is set if variation i is passed
+  //
+  Int_t nVariations=GetNCutVariations();
+  if(!nVariations || ptbin<0 || ptbin>=fnPtBins) return 0;
+  if((Int_t)fCutSign.size()!=fnVars) {
+    fCutSign.resize(fnVars);
+    for(Int_t iv=0; iv<fnVars; iv++) fCutSign[iv] = fIsUpperCut[iv] ? 1. : -1.;
+  }
+
+  ULong64_t mask=0;
+  const Float_t *sign=fCutSign.data();
+  for(Int_t iVariation=0; iVariation<nVariations; iVariation++) {
+    const Float_t *cuts=&fCutVariations[iVariation*fGlobalIndex+GetGlobalIndex(0,ptbin)];
+    ULong64_t pass=1;
+    for(Int_t iv=0; iv<fnVars; iv++) pass &= (sign[iv]*(cuts[iv]-vals[iv])>=0.);
+    mask |= pass<<iVariation;
+  }
+  return mask;
+}
+//---------------------------------------------------------------------------
+ULong64_t AliRDHFCuts::IsSelectedCutVariations(AliAODRecoDecayHF *d,AliAODEvent *aod) {
+  //
+  // bit mask of the cut variations passed by the candidate
+  // (only the cuts of the fCutsRD table, with the primary vertex of the candidate)
+  //
+  if(!d) return 0;
+  Int_t ptbin=PtBin(d->Pt());
+  if(ptbin<0) return 0;
+  fCutTableValues.resize(fnVars);
+  if(!GetCutTableValues(d,fCutTableValues.data(),aod)) return 0;
+  return EvaluateCutVariations(fCutTableValues.data(),ptbin);
+}
+//---------------------------------------------------------------------------
+Bool_t AliRDHFCuts::ApplyCutsInAdaptiveOrder(AliAODRecoDecayHF *d,Int_t ptbin,AliAODEvent *aod) {
+  //
+  // apply the cuts of the fCutsRD table via IsCutPassed. The first
+  // fNCandForCutOrder candidates are used to count the rejections of each cut,
+  // afterwards the cuts are evaluated in order of decreasing rejection rate
+  // and the evaluation stops at the first failing cut
+  //
+  if((Int_t)fCutOrder.size()!=fnVars) {
+    fCutOrder.resize(fnVars);
+    for(Int_t iCut=0; iCut<fnVars; iCut++) fCutOrder[iCut]=iCut;
+    fCutRejections.assign(fnVars,0);
+    fNCandCutOrderSeen=0;
+  }
+
+  if(fNCandCutOrderSeen<fNCandForCutOrder) {
+    Bool_t isSel=kTRUE;
+    for(Int_t iCut=0; iCut<fnVars; iCut++) {
+      if(!IsCutPassed(d,iCut,ptbin,aod)) {
+        fCutRejections[iCut]++;
+        isSel=kFALSE;
+      }
+    }
+    if(++fNCandCutOrderSeen==fNCandForCutOrder) {
+      const std::vector<Long64_t> &rej=fCutRejections;
+      std::stable_sort(fCutOrder.begin(),fCutOrder.end(),[&rej](Int_t a,Int_t b){return rej[a]>rej[b];});
+      TString order;
+      for(Int_t iCut : fCutOrder) order += Form(" %d",iCut);
+      AliInfo(Form("Cut evaluation order after %d candidates:%s",fNCandForCutOrder,order.Data()));
+    }
+    return isSel;
+  }
+
+  for(Int_t iCut : fCutOrder) {
+    if(!IsCutPassed(d,iCut,ptbin,aod)) return kFALSE;
+  }
+  return kTRUE;
+}
+//---------------------------------------------------------------------------
 void AliRDHFCuts::PrintAll() const {
   //
   // print all cuts values
@@ -1641,6 +1759,8 @@ void AliRDHFCuts::PrintAll() const {
   printf("Use PID %d  OldPid=%d\n",(Int_t)fUsePID,fPidHF ? fPidHF->GetOldPid() : -1);
   if(fPidHF) fPidHF->PrintAll();
   Printf("EnableNSigmaTPCDataCorr = %d, %d", fEnableNsigmaTPCDataCorr, fSystemForNsigmaTPCDataCorr);
+  if(fUseAdaptiveCutOrder) Printf("Adaptive cut order: learning on %d candidates",fNCandForCutOrder);
+  if(GetNCutVariations()) Printf("Number of cut variations: %d",GetNCutVariations());
 
   return;
 }
@@ -11,6 +11,7 @@
 /// \author Author: A.Dainese, andrea.dainese@pd.infn.it
 //***********************************************************
 
+#include <vector>
 #include <TString.h>
 
 #include "AliAnalysisCuts.h"
@@ -217,6 +218,15 @@ class AliRDHFCuts : public AliAnalysisCuts
   void SetPtBins(Int_t nPtBinLimits,Float_t *ptBinLimits);
   void SetCuts(Int_t nVars,Int_t nPtBins,Float_t** cutsRD);
   void SetCuts(Int_t glIndex, Float_t* cutsRDGlob);
+  Int_t AddCutVariation(Int_t nVars,Int_t nPtBins,Float_t** cutsRD);
+  void ResetCutVariations() {fCutVariations.clear();}
+  Int_t GetNCutVariations() const {return fGlobalIndex>0 ? (Int_t)fCutVariations.size()/fGlobalIndex : 0;}
+  void SetUseAdaptiveCutOrder(Bool_t flag=kTRUE, Int_t nCandForLearning=1000) {
+    fUseAdaptiveCutOrder=flag; fNCandForCutOrder=nCandForLearning; ResetCutOrder();
+  }
+  Bool_t GetUseAdaptiveCutOrder() const {return fUseAdaptiveCutOrder;}
+  void ResetCutOrder() {fCutOrder.clear(); fCutRejections.clear(); fNCandCutOrderSeen=0;}
+  const std::vector<Int_t>& GetCutOrder() const {return fCutOrder;}
   void AddTrackCuts(const AliESDtrackCuts *cuts)
           {delete fTrackCuts; fTrackCuts=new AliESDtrackCuts(*cuts); return;}
   void SetUsePID(Bool_t flag=kTRUE) {fUsePID=flag; return;}
@@ -336,6 +346,13 @@ class AliRDHFCuts : public AliAnalysisCuts
   virtual void PrintAll()const;
   void PrintTrigger() const;
 
+  /// single cut iCut of the fCutsRD table, to be implemented by the derived classes supporting the adaptive cut order
+  virtual Bool_t IsCutPassed(AliAODRecoDecayHF* /*d*/,Int_t /*iCut*/,Int_t /*ptbin*/,AliAODEvent* /*aod*/) {return kTRUE;}
+  /// values of the fnVars cut variables in the units of fCutsRD, to be implemented by the derived classes supporting cut variations
+  virtual Bool_t GetCutTableValues(AliAODRecoDecayHF* /*d*/,Float_t* /*vals*/,AliAODEvent* /*aod*/) {return kFALSE;}
+  ULong64_t IsSelectedCutVariations(AliAODRecoDecayHF *d,AliAODEvent *aod=0x0);
+  ULong64_t EvaluateCutVariations(const Float_t *vals,Int_t ptbin) const;
+
   virtual Bool_t IsInFiducialAcceptance(Double_t /*pt*/,Double_t /*y*/) const {return kTRUE;}
 
   void SetWhyRejection(Int_t why) {fWhyRejection=why; return;}
@@ -447,6 +464,7 @@ class AliRDHFCuts : public AliAnalysisCuts
 
   Bool_t IsSignalMC(AliAODRecoDecay *d,AliAODEvent *aod,Int_t pdg) const;
   Bool_t RecomputePrimaryVertex(AliAODEvent* event) const;
+  Bool_t ApplyCutsInAdaptiveOrder(AliAODRecoDecayHF *d,Int_t ptbin,AliAODEvent *aod);
 
   /// cuts on the event
   Int_t fMinVtxType; /// 0: not cut; 1: SPDZ; 2: SPD3D; 3: Tracks
@@ -542,8 +560,17 @@ class AliRDHFCuts : public AliAnalysisCuts
   Bool_t fEnableNsigmaTPCDataCorr; /// flag to enable data-driven NsigmaTPC correction
   Int_t fSystemForNsigmaTPCDataCorr; /// system for data-driven NsigmaTPC correction
 
+  Bool_t fUseAdaptiveCutOrder; /// flag to evaluate the fCutsRD cuts ordered by rejection rate
+  Int_t fNCandForCutOrder; /// number of candidates used to measure the rejection rates
+  std::vector<Float_t> fCutVariations; /// cut variations, same layout as fCutsRD, one block of fGlobalIndex per variation
+  std::vector<Int_t> fCutOrder; //! evaluation order of the cuts
+  std::vector<Long64_t> fCutRejections; //! number of rejections per cut in the learning phase
+  Long64_t fNCandCutOrderSeen; //! candidates seen in the learning phase
+  mutable std::vector<Float_t> fCutSign; //! +1 for upper cuts, -1 for lower cuts
+  std::vector<Float_t> fCutTableValues; //! scratch buffer for the cut variables
+
   /// \cond CLASSIMP
-  ClassDef(AliRDHFCuts,53);  /// base class for cuts on AOD reconstructed heavy-flavour decays
+  ClassDef(AliRDHFCuts,54);  /// base class for cuts on AOD reconstructed heavy-flavour decays
   /// \endcond
 };
 
@@ -483,6 +483,66 @@ Int_t AliRDHFCutsDplustoKpipi::IsSelectedPID(Double_t Pt, TObjArray aodtracks) {
   return 3;
 }
 
+//---------------------------------------------------------------------------
+Bool_t AliRDHFCutsDplustoKpipi::IsCutPassed(AliAODRecoDecayHF *rd,Int_t iCut,Int_t ptbin,AliAODEvent *aod) {
+  //
+  // single cut of the fCutsRD table, same conditions as in IsSelected
+  //
+  AliAODRecoDecayHF3Prong* d=(AliAODRecoDecayHF3Prong*)rd;
+  const Float_t cut=fCutsRD[GetGlobalIndex(iCut,ptbin)];
+  switch(iCut) {
+  case 0: {
+    static const Double_t mDplusPDG = TDatabasePDG::Instance()->GetParticle(411)->Mass();
+    return TMath::Abs(d->InvMassDplus()-mDplusPDG)<=cut;
+  }
+  case 1: return d->Pt2Prong(1)>=cut*cut;
+  case 2: return d->Pt2Prong(0)>=cut*cut && d->Pt2Prong(2)>=cut*cut;
+  case 3: return TMath::Abs(d->Getd0Prong(1))>=cut;
+  case 4: return TMath::Abs(d->Getd0Prong(0))>=cut && TMath::Abs(d->Getd0Prong(2))>=cut;
+  case 5: return d->GetDist12toPrim()>=cut && d->GetDist23toPrim()>=cut;
+  case 6: return d->GetSigmaVert(aod)<=cut;
+  case 7: return d->DecayLength2()>=cut*cut;
+  case 8: return d->Pt2Prong(0)>=cut*cut || d->Pt2Prong(1)>=cut*cut || d->Pt2Prong(2)>=cut*cut;
+  case 9: return d->CosPointingAngle()>=cut;
+  case 10: return d->Getd0Prong(0)*d->Getd0Prong(0)+d->Getd0Prong(1)*d->Getd0Prong(1)+d->Getd0Prong(2)*d->Getd0Prong(2)>=cut;
+  case 11: return d->GetDCA(0)<=cut && d->GetDCA(1)<=cut && d->GetDCA(2)<=cut;
+  case 12: {
+    Double_t ndlxy=d->NormalizedDecayLengthXY();
+    if(fScaleNormDLxyBypOverPt) ndlxy*=d->P()/d->Pt();
+    return ndlxy>=cut;
+  }
+  case 13: return d->CosPointingAngleXY()>=cut;
+  default: return kTRUE;
+  }
+}
+
+//---------------------------------------------------------------------------
+Bool_t AliRDHFCutsDplustoKpipi::GetCutTableValues(AliAODRecoDecayHF *rd,Float_t *vals,AliAODEvent *aod) {
+  //
+  // values of the variables of the fCutsRD table (min/max over the prongs
+  // where the cut is applied to several of them), to evaluate cut variations
+  //
+  AliAODRecoDecayHF3Prong* d=(AliAODRecoDecayHF3Prong*)rd;
+  if(!d) return kFALSE;
+  static const Double_t mDplusPDG = TDatabasePDG::Instance()->GetParticle(411)->Mass();
+  vals[0]=TMath::Abs(d->InvMassDplus()-mDplusPDG);
+  vals[1]=d->PtProng(1);
+  vals[2]=TMath::Min(d->PtProng(0),d->PtProng(2));
+  vals[3]=TMath::Abs(d->Getd0Prong(1));
+  vals[4]=TMath::Min(TMath::Abs(d->Getd0Prong(0)),TMath::Abs(d->Getd0Prong(2)));
+  vals[5]=TMath::Min(d->GetDist12toPrim(),d->GetDist23toPrim());
+  vals[6]=d->GetSigmaVert(aod);
+  vals[7]=d->DecayLength();
+  vals[8]=TMath::Max(d->PtProng(0),TMath::Max(d->PtProng(1),d->PtProng(2)));
+  vals[9]=d->CosPointingAngle();
+  vals[10]=d->Getd0Prong(0)*d->Getd0Prong(0)+d->Getd0Prong(1)*d->Getd0Prong(1)+d->Getd0Prong(2)*d->Getd0Prong(2);
+  vals[11]=TMath::Max(d->GetDCA(0),TMath::Max(d->GetDCA(1),d->GetDCA(2)));
+  vals[12]=d->NormalizedDecayLengthXY();
+  if(fScaleNormDLxyBypOverPt) vals[12]*=d->P()/d->Pt();
+  vals[13]=d->CosPointingAngleXY();
+  return kTRUE;
+}
+
 //---------------------------------------------------------------------------
 Int_t AliRDHFCutsDplustoKpipi::IsSelected(TObject* obj,Int_t selectionLevel, AliAODEvent* aod) {
   //
@@ -546,43 +606,54 @@ Int_t AliRDHFCutsDplustoKpipi::IsSelected(TObject* obj,Int_t selectionLevel, Ali
       return 0;
     }
 
-    //sec vert
-    Double_t sigmavert=d->GetSigmaVert(aod);
-    if(sigmavert>fCutsRD[GetGlobalIndex(6,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
-
-    // Decay length and pointing angle
-    if(d->DecayLength2()<fCutsRD[GetGlobalIndex(7,ptbin)]*fCutsRD[GetGlobalIndex(7,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
-    if(d->CosPointingAngle()< fCutsRD[GetGlobalIndex(9,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
-    if(fScaleNormDLxyBypOverPt){
-      if(d->NormalizedDecayLengthXY()*d->P()/pt<fCutsRD[GetGlobalIndex(12,ptbin)]){CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
-    }else{
-      if(d->NormalizedDecayLengthXY()<fCutsRD[GetGlobalIndex(12,ptbin)]){CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
+    if(fUseAdaptiveCutOrder) {
+      // cuts of the fCutsRD table, ordered by rejection rate
+      if(!ApplyCutsInAdaptiveOrder(d,ptbin,aod)) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
+      if(fUseImpParProdCorrCut){
+        if(d->Getd0Prong(0)*d->Getd0Prong(1)<0. && d->Getd0Prong(2)*d->Getd0Prong(1)<0.) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
+      }
     }
-    if(d->CosPointingAngleXY()<fCutsRD[GetGlobalIndex(13,ptbin)]){CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
+    else {
+      //sec vert
+      Double_t sigmavert=d->GetSigmaVert(aod);
+      if(sigmavert>fCutsRD[GetGlobalIndex(6,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
+
+      // Decay length and pointing angle
+      if(d->DecayLength2()<fCutsRD[GetGlobalIndex(7,ptbin)]*fCutsRD[GetGlobalIndex(7,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
+      if(d->CosPointingAngle()< fCutsRD[GetGlobalIndex(9,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
+      if(fScaleNormDLxyBypOverPt){
+        if(d->NormalizedDecayLengthXY()*d->P()/pt<fCutsRD[GetGlobalIndex(12,ptbin)]){CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
+      }else{
+        if(d->NormalizedDecayLengthXY()<fCutsRD[GetGlobalIndex(12,ptbin)]){CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
+      }
+      if(d->CosPointingAngleXY()<fCutsRD[GetGlobalIndex(13,ptbin)]){CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
 
-    //2track cuts
-    if(d->GetDist12toPrim()<fCutsRD[GetGlobalIndex(5,ptbin)]|| d->GetDist23toPrim()<fCutsRD[GetGlobalIndex(5,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
+      //2track cuts
+      if(d->GetDist12toPrim()<fCutsRD[GetGlobalIndex(5,ptbin)]|| d->GetDist23toPrim()<fCutsRD[GetGlobalIndex(5,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
 
-    Double_t sum2=d->Getd0Prong(0)*d->Getd0Prong(0)+d->Getd0Prong(1)*d->Getd0Prong(1)+d->Getd0Prong(2)*d->Getd0Prong(2);
-    if(sum2<fCutsRD[GetGlobalIndex(10,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
+      Double_t sum2=d->Getd0Prong(0)*d->Getd0Prong(0)+d->Getd0Prong(1)*d->Getd0Prong(1)+d->Getd0Prong(2)*d->Getd0Prong(2);
+      if(sum2<fCutsRD[GetGlobalIndex(10,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
 
-    if(fUseImpParProdCorrCut){
-      if(d->Getd0Prong(0)*d->Getd0Prong(1)<0. && d->Getd0Prong(2)*d->Getd0Prong(1)<0.) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
-    }
+      if(fUseImpParProdCorrCut){
+        if(d->Getd0Prong(0)*d->Getd0Prong(1)<0. && d->Getd0Prong(2)*d->Getd0Prong(1)<0.) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
+      }
 
 
-    //DCA
-    for(Int_t i=0;i<3;i++) if(d->GetDCA(i)>fCutsRD[GetGlobalIndex(11,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
+      //DCA
+      for(Int_t i=0;i<3;i++) if(d->GetDCA(i)>fCutsRD[GetGlobalIndex(11,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
 
-    if(d->Pt2Prong(1) < fCutsRD[GetGlobalIndex(1,ptbin)]*fCutsRD[GetGlobalIndex(1,ptbin)] || TMath::Abs(d->Getd0Prong(1))<fCutsRD[GetGlobalIndex(3,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}//Kaon
+      if(d->Pt2Prong(1) < fCutsRD[GetGlobalIndex(1,ptbin)]*fCutsRD[GetGlobalIndex(1,ptbin)] || TMath::Abs(d->Getd0Prong(1))<fCutsRD[GetGlobalIndex(3,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}//Kaon
 
-    if(d->Pt2Prong(0) < fCutsRD[GetGlobalIndex(2,ptbin)]*fCutsRD[GetGlobalIndex(2,ptbin)] || TMath::Abs(d->Getd0Prong(0))<fCutsRD[GetGlobalIndex(4,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}//Pion1
+      if(d->Pt2Prong(0) < fCutsRD[GetGlobalIndex(2,ptbin)]*fCutsRD[GetGlobalIndex(2,ptbin)] || TMath::Abs(d->Getd0Prong(0))<fCutsRD[GetGlobalIndex(4,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}//Pion1
 
-    if(d->Pt2Prong(2) < fCutsRD[GetGlobalIndex(2,ptbin)]*fCutsRD[GetGlobalIndex(2,ptbin)] || TMath::Abs(d->Getd0Prong(2))<fCutsRD[GetGlobalIndex(4,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}//Pion2
+      if(d->Pt2Prong(2) < fCutsRD[GetGlobalIndex(2,ptbin)]*fCutsRD[GetGlobalIndex(2,ptbin)] || TMath::Abs(d->Getd0Prong(2))<fCutsRD[GetGlobalIndex(4,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}//Pion2
     
-    if(d->Pt2Prong(0)<fCutsRD[GetGlobalIndex(8,ptbin)]*fCutsRD[GetGlobalIndex(8,ptbin)] && d->Pt2Prong(1)<fCutsRD[GetGlobalIndex(8,ptbin)]*fCutsRD[GetGlobalIndex(8,ptbin)] && d->Pt2Prong(2)<fCutsRD[GetGlobalIndex(8,ptbin)]*fCutsRD[GetGlobalIndex(8,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
-
+      if(d->Pt2Prong(0)<fCutsRD[GetGlobalIndex(8,ptbin)]*fCutsRD[GetGlobalIndex(8,ptbin)] && d->Pt2Prong(1)<fCutsRD[GetGlobalIndex(8,ptbin)]*fCutsRD[GetGlobalIndex(8,ptbin)] && d->Pt2Prong(2)<fCutsRD[GetGlobalIndex(8,ptbin)]*fCutsRD[GetGlobalIndex(8,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
 
+      Double_t mDplusPDG = TDatabasePDG::Instance()->GetParticle(411)->Mass();
+      Double_t mDplus=d->InvMassDplus();
+      if(TMath::Abs(mDplus-mDplusPDG)>fCutsRD[GetGlobalIndex(0,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
+    }
 
     // d0meas-exp
     if(fUsed0MeasMinusExpCut){
@@ -604,10 +675,6 @@ Int_t AliRDHFCutsDplustoKpipi::IsSelected(TObject* obj,Int_t selectionLevel, Ali
       if(TMath::Abs(d0)>fMaxd0[ptbin]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
     }
 
-    Double_t mDplusPDG = TDatabasePDG::Instance()->GetParticle(411)->Mass();
-    Double_t mDplus=d->InvMassDplus();
-    if(TMath::Abs(mDplus-mDplusPDG)>fCutsRD[GetGlobalIndex(0,ptbin)]) {CleanOwnPrimaryVtx(d,aod,origownvtx); return 0;}
-
     // unset recalculated primary vertex when not needed any more
     CleanOwnPrimaryVtx(d,aod,origownvtx);
     
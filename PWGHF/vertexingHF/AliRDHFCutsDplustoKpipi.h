@@ -42,6 +42,8 @@ class AliRDHFCutsDplustoKpipi : public AliRDHFCuts
   virtual Int_t IsSelected(TObject* obj,Int_t selectionLevel,AliAODEvent* aod);
   virtual Int_t IsSelectedPID(AliAODRecoDecayHF *rd);
   Int_t IsSelectedPID(Double_t Pt, TObjArray aodtracks);
+  virtual Bool_t IsCutPassed(AliAODRecoDecayHF *rd,Int_t iCut,Int_t ptbin,AliAODEvent *aod);
+  virtual Bool_t GetCutTableValues(AliAODRecoDecayHF *rd,Float_t *vals,AliAODEvent *aod);
 
   virtual Bool_t IsInFiducialAcceptance(Double_t pt,Double_t y) const;
   virtual void SetStandardCutsPP2010();
@@ -31,6 +31,7 @@
 #include "AliGenEventHeader.h"
 #include "AliAODMCParticle.h"
 #include "AliAODRecoDecayHF.h"
+#include "AliMCAncestryIndex.h"
 #include "AliVertexingHFUtils.h"
 
 #ifndef HomogeneousField
@@ -551,6 +552,14 @@ void AliVertexingHFUtils::GetTrackPrimaryGenerator(Int_t label, AliAODMCHeader *
   /// method to check if a track comes from a given generator
 
   Int_t lab=TMath::Abs(label);
+
+  // generator of the particle or of its closest generated ancestor, from the per event index
+  AliMCAncestryIndex *idx=AliMCAncestryIndex::Instance();
+  if(header && idx->Update(arrayMC,header) && idx->IsValid(lab)){
+    nameGen=idx->GetHeaderName(lab);
+    return;
+  }
+
   nameGen=GetGenerator(lab,header);
 
   //  Int_t countControl=0;
@@ -744,6 +753,12 @@ Int_t AliVertexingHFUtils::PreSelectITSUpgrade(TClonesArray* arrayMC, AliAODMCHe
 //____________________________________________________________________________
 Int_t AliVertexingHFUtils::CheckOrigin(AliMCEvent* mcEvent, AliMCParticle *mcPart, Bool_t searchUpToQuark){
   /// checking whether the mother of the particles come from a charm or a bottom quark
+  /// answered from the per event AliMCAncestryIndex if the particle is one of the event
+
+  Int_t label = mcPart->GetLabel();
+  AliMCAncestryIndex *idx = AliMCAncestryIndex::Instance();
+  if(idx->Update(mcEvent) && idx->IsValid(label) && mcEvent->GetTrack(label)==mcPart)
+    return idx->CheckHFOrigin(label,searchUpToQuark);
 
   Int_t pdgGranma = 0;
   Int_t mother = 0;
@@ -777,6 +792,12 @@ Int_t AliVertexingHFUtils::CheckOrigin(AliMCEvent* mcEvent, AliMCParticle *mcPar
 //____________________________________________________________________________
 Int_t AliVertexingHFUtils::CheckOrigin(TClonesArray* arrayMC, AliAODMCParticle *mcPart, Bool_t searchUpToQuark){
   /// checking whether the mother of the particles come from a charm or a bottom quark
+  /// answered from the per event AliMCAncestryIndex if the particle is one of the array
+
+  Int_t label = mcPart->GetLabel();
+  AliMCAncestryIndex *idx = AliMCAncestryIndex::Instance();
+  if(idx->Update(arrayMC) && idx->IsValid(label) && arrayMC->UncheckedAt(label)==mcPart)
+    return idx->CheckHFOrigin(label,searchUpToQuark);
 
   Int_t pdgGranma = 0;
   Int_t mother = 0;
@@ -810,6 +831,9 @@ Int_t AliVertexingHFUtils::CheckOrigin(TClonesArray* arrayMC, AliAODMCParticle *
 Bool_t AliVertexingHFUtils::IsTrackFromCharm(AliAODTrack* tr, TClonesArray* arrayMC){
   /// check if an AOD track originated from a charm hadron decay
   Int_t absLabel=TMath::Abs(tr->GetLabel());
+  AliMCAncestryIndex *idx = AliMCAncestryIndex::Instance();
+  if(idx->Update(arrayMC) && idx->IsValid(absLabel))
+    return idx->HasAncestor(absLabel,AliMCAncestryIndex::kCharmQuark|AliMCAncestryIndex::kCharmHadron);
   AliAODMCParticle* mcPart=dynamic_cast<AliAODMCParticle*>(arrayMC->At(absLabel));
   Int_t mother = mcPart->GetMother();
   Int_t istep = 0;
@@ -831,6 +855,9 @@ Bool_t AliVertexingHFUtils::IsTrackFromCharm(AliAODTrack* tr, TClonesArray* arra
 Bool_t AliVertexingHFUtils::IsTrackFromBeauty(AliAODTrack* tr, TClonesArray* arrayMC){
   /// check if an AOD track originated from a charm hadron decay
   Int_t absLabel=TMath::Abs(tr->GetLabel());
+  AliMCAncestryIndex *idx = AliMCAncestryIndex::Instance();
+  if(idx->Update(arrayMC) && idx->IsValid(absLabel))
+    return idx->HasAncestor(absLabel,AliMCAncestryIndex::kBeautyQuark|AliMCAncestryIndex::kBeautyHadron);
   AliAODMCParticle* mcPart=dynamic_cast<AliAODMCParticle*>(arrayMC->At(absLabel));
   Int_t mother = mcPart->GetMother();
   Int_t istep = 0;
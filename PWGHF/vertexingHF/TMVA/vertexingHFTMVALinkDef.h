@@ -6,15 +6,5 @@
 
 
 #pragma link C++ class BDTNode+;
-#pragma link C++ class ReadBDT_LHC19c2b_2_4_noP+;
-#pragma link C++ class ReadBDT_LHC19c2b_4_6_noP+;
-#pragma link C++ class ReadBDT_LHC19c2b_6_8_noP+;
-#pragma link C++ class ReadBDT_LHC19c2b_8_12_noP+;
-#pragma link C++ class ReadBDT_LHC19c2b_12_25_noP+;
-#pragma link C++ class ReadBDT_LHC19c2a_2_4_noP+;
-#pragma link C++ class ReadBDT_LHC19c2a_4_6_noP+;
-#pragma link C++ class ReadBDT_LHC19c2a_6_8_noP+;
-#pragma link C++ class ReadBDT_LHC19c2a_8_12_noP+;
-#pragma link C++ class ReadBDT_LHC19c2a_12_25_noP+;
 
 #endif
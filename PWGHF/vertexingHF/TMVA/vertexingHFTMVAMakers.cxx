@@ -0,0 +1,40 @@
+//*************************************************************************
+// Makers of the BDT readers of vertexingHFTMVA, looked up with dlsym by
+// the analysis tasks. The forests are read at runtime by AliHFBDTReader
+// from the installed classes generated by TMVA, with identical scores
+// and without compiling the generated code into the library
+/////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include <TSystem.h>
+#include <TString.h>
+
+#include "AliHFBDTReader.h"
+
+namespace {
+IClassifierReader* MakeReader(const char* className, std::vector<std::string>& inputVars)
+{
+  TString fileName = gSystem->ExpandPathName(Form("$ALICE_PHYSICS/PWGHF/vertexingHF/TMVA/%s.class.cxx",className));
+  return AliHFBDTReader::Create(fileName.Data(),inputVars);
+}
+}
+
+#define HF_BDT_MAKER(prod,bins) \
+  IClassifierReader* ReadBDT_maker_##prod##_##bins(std::vector<std::string> theInpVar) \
+  { return MakeReader(#prod "_TMVAClassification_BDT_" #bins,theInpVar); }
+
+extern "C"
+{
+  HF_BDT_MAKER(LHC19c2b,2_4_noP)
+  HF_BDT_MAKER(LHC19c2b,4_6_noP)
+  HF_BDT_MAKER(LHC19c2b,6_8_noP)
+  HF_BDT_MAKER(LHC19c2b,8_12_noP)
+  HF_BDT_MAKER(LHC19c2b,12_25_noP)
+  HF_BDT_MAKER(LHC19c2a,2_4_noP)
+  HF_BDT_MAKER(LHC19c2a,4_6_noP)
+  HF_BDT_MAKER(LHC19c2a,6_8_noP)
+  HF_BDT_MAKER(LHC19c2a,8_12_noP)
+  HF_BDT_MAKER(LHC19c2a,12_25_noP)
+}
@@ -24,7 +24,13 @@ ClassImp(AliHFMLResponse);
 
 //________________________________________________________________
 AliHFMLResponse::AliHFMLResponse() : AliMLResponse(),
-                                     fVars{}
+                                     fVars{},
+                                     fFeatureSource{nullptr},
+                                     fCacheCand{nullptr},
+                                     fCachePID{nullptr},
+                                     fCacheBField{0.},
+                                     fCacheMom{0., 0., 0.},
+                                     fCacheMassHypo{-1}
 {
     //
     // Default constructor
@@ -34,7 +40,13 @@ AliHFMLResponse::AliHFMLResponse() : AliMLResponse(),
 //________________________________________________________________
 AliHFMLResponse::AliHFMLResponse(const Char_t *name, const Char_t *title, 
                                  const std::string configfilepath) : AliMLResponse(name, title),
-                                                                     fVars{}
+                                                                     fVars{},
+                                                                     fFeatureSource{nullptr},
+                                                                     fCacheCand{nullptr},
+                                                                     fCachePID{nullptr},
+                                                                     fCacheBField{0.},
+                                                                     fCacheMom{0., 0., 0.},
+                                                                     fCacheMassHypo{-1}
 {
     //
     // Standard constructor
@@ -53,7 +65,13 @@ AliHFMLResponse::~AliHFMLResponse()
 
 //--------------------------------------------------------------------------
 AliHFMLResponse::AliHFMLResponse(const AliHFMLResponse &source) : AliMLResponse(source),
-                                                                  fVars(source.fVars)
+                                                                  fVars(source.fVars),
+                                                                  fFeatureSource{nullptr},
+                                                                  fCacheCand{nullptr},
+                                                                  fCachePID{nullptr},
+                                                                  fCacheBField{0.},
+                                                                  fCacheMom{0., 0., 0.},
+                                                                  fCacheMassHypo{-1}
 {
     //
     // Copy constructor
@@ -70,58 +88,82 @@ AliHFMLResponse &AliHFMLResponse::operator=(const AliHFMLResponse &source)
 
     AliMLResponse::operator=(source);
     fVars = source.fVars;
+    fFeatureSource = nullptr;
+    fCacheCand = nullptr;
 
     return *this;
 }
 
 //________________________________________________________________
-double AliHFMLResponse::Predict(AliAODRecoDecayHF *cand, double bfield, AliAODPidHF *pidHF, int masshypo)
+const std::map<std::string, double> &AliHFMLResponse::GetFeatures(AliAODRecoDecayHF *cand, double bfield, AliAODPidHF *pidHF, int masshypo)
 {
+    if (fFeatureSource)
+        return fFeatureSource->GetFeatures(cand, bfield, pidHF, masshypo);
+
+    if (cand == fCacheCand && pidHF == fCachePID && bfield == fCacheBField && masshypo == fCacheMassHypo &&
+        cand->Px() == fCacheMom[0] && cand->Py() == fCacheMom[1] && cand->Pz() == fCacheMom[2])
+        return fVars;
+
     SetMapOfVariables(cand, bfield, pidHF, masshypo);
-    if (fVars.empty())
+    fCacheCand = cand;
+    fCachePID = pidHF;
+    fCacheBField = bfield;
+    fCacheMassHypo = masshypo;
+    fCacheMom[0] = cand->Px();
+    fCacheMom[1] = cand->Py();
+    fCacheMom[2] = cand->Pz();
+
+    return fVars;
+}
+
+//________________________________________________________________
+double AliHFMLResponse::Predict(AliAODRecoDecayHF *cand, double bfield, AliAODPidHF *pidHF, int masshypo)
+{
+    const std::map<std::string, double> &vars = GetFeatures(cand, bfield, pidHF, masshypo);
+    if (vars.empty())
     {
         AliWarning("Map of features empty!");
         return -999.;
     }
 
-    return Predict(cand->Pt(), fVars);
+    return Predict(cand->Pt(), vars);
 }
 
 //________________________________________________________________
 bool AliHFMLResponse::IsSelected(double &prob, AliAODRecoDecayHF *cand, double bfield, AliAODPidHF *pidHF, int masshypo)
 {   
-    SetMapOfVariables(cand, bfield, pidHF, masshypo);
-    if (fVars.empty())
+    const std::map<std::string, double> &vars = GetFeatures(cand, bfield, pidHF, masshypo);
+    if (vars.empty())
     {
         AliWarning("Map of features empty!");
         return false;
     }
 
-    return IsSelected(cand->Pt(), fVars, prob);
+    return IsSelected(cand->Pt(), vars, prob);
 }
 
 //________________________________________________________________
 bool AliHFMLResponse::PredictMultiClass(std::vector<double> &outScores, AliAODRecoDecayHF *cand, double bfield, AliAODPidHF *pidHF, int masshypo)
 {
-    SetMapOfVariables(cand, bfield, pidHF, masshypo);
-    if (fVars.empty())
+    const std::map<std::string, double> &vars = GetFeatures(cand, bfield, pidHF, masshypo);
+    if (vars.empty())
     {
         AliWarning("Map of features empty!");
         return false;
     }
 
-    return PredictMultiClass(cand->Pt(), fVars, outScores);
+    return PredictMultiClass(cand->Pt(), vars, outScores);
 }
 
 //________________________________________________________________
 bool AliHFMLResponse::IsSelectedMultiClass(std::vector<double> &outScores, AliAODRecoDecayHF *cand, double bfield, AliAODPidHF *pidHF, int masshypo)
 {   
-    SetMapOfVariables(cand, bfield, pidHF, masshypo);
-    if (fVars.empty())
+    const std::map<std::string, double> &vars = GetFeatures(cand, bfield, pidHF, masshypo);
+    if (vars.empty())
     {
         AliWarning("Map of features empty!");
         return false;
     }
 
-    return IsSelectedMultiClass(cand->Pt(), fVars, outScores);
+    return IsSelectedMultiClass(cand->Pt(), vars, outScores);
 }
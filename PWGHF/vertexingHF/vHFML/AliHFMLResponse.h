@@ -47,14 +47,30 @@ public:
     bool PredictMultiClass(std::vector<double> &outScores, AliAODRecoDecayHF *cand, double bfield, AliAODPidHF *pidHF = nullptr, int masshypo = 0);
 
     /// method to get variable (feature) from map
-    double GetVariable(std::string name = "") {return fVars[name];}
+    double GetVariable(std::string name = "") {return (fFeatureSource ? fFeatureSource->fVars : fVars)[name];}
+
+    /// use the feature cache of another response of the same type, so that e.g. prompt, non-prompt and
+    /// background models applied to the same candidate compute its features only once
+    void SetFeatureCacheSource(AliHFMLResponse *source) { fFeatureSource = (source == this) ? nullptr : source; }
+    /// force the features to be recomputed at the next call (e.g. if the candidate object is modified in place)
+    void ResetFeatureCache() { fCacheCand = nullptr; }
 
 protected:
+    /// return the map of features of the candidate, computed only if the candidate differs from the cached one
+    const std::map<std::string, double> &GetFeatures(AliAODRecoDecayHF *cand, double bfield, AliAODPidHF *pidHF, int masshypo);
+
     /// method used to define map of name <-> variables (features) --> to be implemented for each derived class
     virtual void SetMapOfVariables(AliAODRecoDecayHF * /*cand*/, double /*bfield*/, AliAODPidHF * /*pidHF*/, int /*masshypo*/) { return; }
 
     std::map<std::string, double> fVars;       /// map of variables (features) that can be used for the ML model application
 
+    AliHFMLResponse *fFeatureSource;           //!<! response whose feature cache is used (null: own cache)
+    AliAODRecoDecayHF *fCacheCand;             //!<! candidate of the cached features
+    AliAODPidHF *fCachePID;                    //!<! PID object used for the cached features
+    double fCacheBField;                       //!<! magnetic field used for the cached features
+    double fCacheMom[3];                       //!<! momentum of the cached candidate, to detect reused objects
+    int fCacheMassHypo;                        //!<! mass hypothesis of the cached features
+
     /// \cond CLASSIMP
     ClassDef(AliHFMLResponse, 2); ///
     /// \endcond
@@ -8,6 +8,7 @@
 #include "AliLog.h"
 #include "AliRhoParameter.h"
 #include "AliJetContainer.h"
+#include "AliJetBackgroundEngine.h"
 #include "AliParticleContainer.h"
 #include "AliClusterContainer.h"
 #include "AliVEventHandler.h"
@@ -41,68 +42,17 @@ Bool_t AliAnalysisTaskRho::Run()
   if (fOutRhoScaled)
     fOutRhoScaled->SetVal(0);
 
-  if (!fJets)
+  AliJetContainer *jetCont = GetJetContainer(0);
+  if (!fJets || !jetCont)
     return kFALSE;
 
-  const Int_t Njets   = fJets->GetEntries();
-
-  Int_t maxJetIds[]   = {-1, -1};
-  Float_t maxJetPts[] = { 0,  0};
-
-  if (fNExclLeadJets > 0) {
-    for (Int_t ij = 0; ij < Njets; ++ij) {
-      AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(ij));
-      if (!jet) {
-	AliError(Form("%s: Could not receive jet %d", GetName(), ij));
-	continue;
-      } 
-
-      if (!AcceptJet(jet))
-        continue;
-
-      if (jet->Pt() > maxJetPts[0]) {
-	maxJetPts[1] = maxJetPts[0];
-	maxJetIds[1] = maxJetIds[0];
-	maxJetPts[0] = jet->Pt();
-	maxJetIds[0] = ij;
-      } else if (jet->Pt() > maxJetPts[1]) {
-	maxJetPts[1] = jet->Pt();
-	maxJetIds[1] = ij;
-      }
-    }
-    if (fNExclLeadJets < 2) {
-      maxJetIds[1] = -1;
-      maxJetPts[1] = 0;
-    }
-  }
-
-  static Double_t rhovec[999];
-  Int_t NjetAcc = 0;
-
-  // push all jets within selected acceptance into stack
-  for (Int_t iJets = 0; iJets < Njets; ++iJets) {
-
-    // exlcuding lead jets
-    if (iJets == maxJetIds[0] || iJets == maxJetIds[1])
-      continue;
-
-    AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(iJets));
-    if (!jet) {
-      AliError(Form("%s: Could not receive jet %d", GetName(), iJets));
-      continue;
-    } 
-
-    if (!AcceptJet(jet))
-      continue;
-
-    rhovec[NjetAcc] = jet->Pt() / jet->Area();
-    ++NjetAcc;
-  }
-
+  // the selection of the kt jets and the median are shared with
+  // the other rho tasks using the same jets
+  const AliJetBackgroundEngine *engine = AliJetBackgroundEngine::Get(jetCont);
 
-  if (NjetAcc > 0) {
+  if (engine->GetNAcceptedJets(fNExclLeadJets) > 0) {
     //find median value
-    Double_t rho = TMath::Median(NjetAcc, rhovec);
+    Double_t rho = engine->GetRho(fNExclLeadJets);
     fOutRho->SetVal(rho);
 
     if (fOutRhoScaled) {
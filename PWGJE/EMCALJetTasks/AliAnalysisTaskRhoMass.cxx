@@ -33,6 +33,8 @@
 #include "AliEmcalJet.h"
 #include "AliLog.h"
 #include "AliRhoParameter.h"
+#include "AliJetContainer.h"
+#include "AliJetBackgroundEngine.h"
 
 ClassImp(AliAnalysisTaskRhoMass)
 
@@ -74,40 +76,14 @@ Bool_t AliAnalysisTaskRhoMass::Run()
   if (fOutRhoMassScaled)
     fOutRhoMassScaled->SetVal(0);
 
-  if (!fJets)
+  AliJetContainer *jetCont = GetJetContainer(0);
+  if (!fJets || !jetCont)
     return kFALSE;
 
   const Int_t Njets   = fJets->GetEntries();
 
-  Int_t maxJetIds[]   = {-1, -1};
-  Float_t maxJetPts[] = { 0,  0};
-
-  if (fNExclLeadJets > 0) {
-    for (Int_t ij = 0; ij < Njets; ++ij) {
-      AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(ij));
-      if (!jet) {
-	AliError(Form("%s: Could not receive jet %d", GetName(), ij));
-	continue;
-      } 
-
-      if (!AcceptJet(jet))
-        continue;
-
-      if (jet->Pt() > maxJetPts[0]) {
-	maxJetPts[1] = maxJetPts[0];
-	maxJetIds[1] = maxJetIds[0];
-	maxJetPts[0] = jet->Pt();
-	maxJetIds[0] = ij;
-      } else if (jet->Pt() > maxJetPts[1]) {
-	maxJetPts[1] = jet->Pt();
-	maxJetIds[1] = ij;
-      }
-    }
-    if (fNExclLeadJets < 2) {
-      maxJetIds[1] = -1;
-      maxJetPts[1] = 0;
-    }
-  }
+  // jet selection and leading jets shared with the other rho tasks
+  const AliJetBackgroundEngine *engine = AliJetBackgroundEngine::Get(jetCont);
 
   static Double_t rhomvec[999];
   static Double_t Evec[999];
@@ -118,17 +94,13 @@ Bool_t AliAnalysisTaskRhoMass::Run()
   for (Int_t iJets = 0; iJets < Njets; ++iJets) {
 
     // exlcuding lead jets
-    if (iJets == maxJetIds[0] || iJets == maxJetIds[1])
+    if (engine->IsExcludedLeadingJet(iJets, fNExclLeadJets))
       continue;
 
-    AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(iJets));
-    if (!jet) {
-      AliError(Form("%s: Could not receive jet %d", GetName(), iJets));
+    if (!engine->IsAccepted(iJets))
       continue;
-    } 
 
-    if (!AcceptJet(jet))
-      continue;
+    AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(iJets));
 
     // Double_t sumM = GetSumMConstituents(jet);
     // Double_t sumPt = GetSumPtConstituents(jet);
@@ -17,6 +17,7 @@
 #include "AliLog.h"
 #include "AliRhoParameter.h"
 #include "AliJetContainer.h"
+#include "AliJetBackgroundEngine.h"
 
 ClassImp(AliAnalysisTaskRhoSparse)
 
@@ -83,7 +84,8 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
   if (fOutRhoScaled)
     fOutRhoScaled->SetVal(0);
 
-  if (!fJets)
+  AliJetContainer *bkgjets = GetJetContainer(0);
+  if (!fJets || !bkgjets)
     return kFALSE;
   const Int_t Njets = fJets->GetEntries();
 
@@ -91,36 +93,8 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
   Int_t NjetsSig = 0;
   if (sigjets) NjetsSig = sigjets->GetNJets();
 
-  Int_t maxJetIds[]   = {-1, -1};
-  Float_t maxJetPts[] = { 0,  0};
-
-  if (fNExclLeadJets > 0) {
-    for (Int_t ij = 0; ij < Njets; ++ij) {
-      AliEmcalJet *jet = static_cast<AliEmcalJet*>(fJets->At(ij));
-      if (!jet) {
-        AliError(Form("%s: Could not receive jet %d", GetName(), ij));
-        continue;
-      } 
-
-      if (!AcceptJet(jet))
-        continue;
-
-      //Search the two leading KT jets
-      if (jet->Pt() > maxJetPts[0]) {
-        maxJetPts[1] = maxJetPts[0];
-        maxJetIds[1] = maxJetIds[0];
-        maxJetPts[0] = jet->Pt();
-        maxJetIds[0] = ij;
-      } else if (jet->Pt() > maxJetPts[1]) {
-        maxJetPts[1] = jet->Pt();
-        maxJetIds[1] = ij;
-      }
-    }
-    if (fNExclLeadJets < 2) {
-      maxJetIds[1] = -1;
-      maxJetPts[1] = 0;
-    }
-  }
+  //Selection and the two leading KT jets, shared with the other rho tasks
+  const AliJetBackgroundEngine *engine = AliJetBackgroundEngine::Get(bkgjets);
 
   static Double_t rhovec[999];
   Int_t NjetAcc = 0;
@@ -153,10 +127,10 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
       TotalAreaCovered+=jet->Area();
     }
     // Exclude leading background jets (could be signal)
-    if (iJets == maxJetIds[0] || iJets == maxJetIds[1])
+    if (engine->IsExcludedLeadingJet(iJets, fNExclLeadJets))
       continue;
     // Exclude background jets that do not fullfill basic cuts defined in AliJetContainer
-    if (!AcceptJet(jet))
+    if (!engine->IsAccepted(iJets))
       continue;
 
     // Search for overlap with signal jets
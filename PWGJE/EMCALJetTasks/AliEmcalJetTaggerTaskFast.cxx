@@ -24,9 +24,13 @@
  * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
  ************************************************************************************/
+#include <algorithm>
 #include <iostream>
+#include <utility>
 #include <vector>
 
+#include <TArrayD.h>
+#include <TArrayI.h>
 #include <TH1.h>
 #include <TH2.h>
 #include <TH3.h>
@@ -53,6 +57,7 @@ namespace PWGJE {
       AliAnalysisTaskEmcalJet("AliEmcalJetTaggerTaskFast", kTRUE),
       fJetTaggingType(kTag),
       fJetTaggingMethod(kGeo),
+      fJetMatchingMode(kMutualClosest),
       fContainerBase(0),
       fContainerTag(1),
       fSpecPartContTag(-1),
@@ -61,6 +66,7 @@ namespace PWGJE {
       fMatchingDone(0),
       fTypeAcc(kLimitBaseTagEtaPhi),
       fMaxDist(0.3),
+      fChainedContainers(),
       fInit(kFALSE),
       fh3PtJet1VsDeltaEtaDeltaPhi(nullptr),
       fh2PtJet1VsDeltaR(nullptr),
@@ -86,6 +92,7 @@ namespace PWGJE {
       AliAnalysisTaskEmcalJet(name, kTRUE),
       fJetTaggingType(kTag),
       fJetTaggingMethod(kGeo),
+      fJetMatchingMode(kMutualClosest),
       fContainerBase(0),
       fContainerTag(1),
       fSpecPartContTag(-1),
@@ -94,6 +101,7 @@ namespace PWGJE {
       fMatchingDone(0),
       fTypeAcc(kLimitBaseTagEtaPhi),
       fMaxDist(0.3),
+      fChainedContainers(),
       fInit(kFALSE),
       fh3PtJet1VsDeltaEtaDeltaPhi(nullptr),
       fh2PtJet1VsDeltaR(nullptr),
@@ -245,6 +253,12 @@ namespace PWGJE {
     AliJetContainer *cont1 = GetJetContainer(fContainerBase);
     AliJetContainer *cont2 = GetJetContainer(fContainerTag);
     if(!cont1 || !cont2) AliError("Missing jet container");
+    std::vector<AliJetContainer *> chained;
+    for(auto icont : fChainedContainers) {
+      AliJetContainer *cont = GetJetContainer(icont);
+      if(cont) chained.push_back(cont);
+      else AliErrorStream() << "Missing chained jet container " << icont << std::endl;
+    }
 
     // when full azimuth, don't do anything
     Double_t phiMin1 = cont1->GetJetPhiMin(), phiMin2 = cont2->GetJetPhiMin();
@@ -269,6 +283,15 @@ namespace PWGJE {
       cont2->SetJetEtaLimits(cont2->GetJetEtaMin()-0.1,cont2->GetJetEtaMax()+0.1);
       if(!isZeroTwoPi2) cont2->SetJetPhiLimits(cont2->GetJetPhiMin()-0.1,cont2->GetJetPhiMax()+0.1);
     };
+    // chained containers are treated like the tag container
+    if(fTypeAcc != kNoLimit) {
+      for(auto cont : chained) {
+        Double_t phiMin = cont->GetJetPhiMin();
+        Bool_t isZeroTwoPi = (phiMin > -1.e-6 && phiMin < 1.e-6);
+        cont->SetJetEtaLimits(cont->GetJetEtaMin()-0.1,cont->GetJetEtaMax()+0.1);
+        if(fTypeAcc != kLimitTagEta && !isZeroTwoPi) cont->SetJetPhiLimits(cont->GetJetPhiMin()-0.1,cont->GetJetPhiMax()+0.1);
+      }
+    }
     fInit = kTRUE;
     return;
   }
@@ -281,8 +304,19 @@ namespace PWGJE {
 
     ResetTagging(*contBase);
     ResetTagging(*contTag);
+    std::vector<AliJetContainer *> chain = {contTag};
+    for(auto icont : fChainedContainers) {
+      AliJetContainer *cont = GetJetContainer(icont);
+      if(!cont) continue;
+      ResetTagging(*cont);
+      chain.push_back(cont);
+    }
 
-    fMatchingDone = MatchJetsGeo(*contBase, *contTag, fMaxDist);
+    fMatchingDone = MatchJetsGeo(*contBase, *contTag, fMaxDist, chain.size() > 1);
+    // each level of the chain is matched to the next one
+    for(UInt_t ilevel = 1; ilevel < chain.size(); ilevel++) {
+      MatchJetsGeo(*chain[ilevel-1], *chain[ilevel], fMaxDist, ilevel < chain.size() - 1);
+    }
 
     return kTRUE;
   }
@@ -364,29 +398,23 @@ namespace PWGJE {
     }
   }
 
-  bool AliEmcalJetTaggerTaskFast::MatchJetsGeo(AliJetContainer &contBase, AliJetContainer &contTag, Float_t maxDist) const {
+  bool AliEmcalJetTaggerTaskFast::MatchJetsGeo(AliJetContainer &contBase, AliJetContainer &contTag, Float_t maxDist, Bool_t chained) const {
     const Int_t kNacceptedBase = contBase.GetNAcceptedJets(),
                 kNacceptedTag = contTag.GetNAcceptedJets();
     if(!(kNacceptedBase && kNacceptedTag)) return false;
 
     // Build kd-trees
-    TArrayD etaBase(kNacceptedBase), phiBase(kNacceptedBase),
-            etaTag(kNacceptedTag), phiTag(kNacceptedTag);
+    // The first entries of the data blocks are the accepted jets. The jets within maxDist of the
+    // 0/2pi boundary are added again with phi shifted by 2pi, so that the euclidean distance in the
+    // tree respects the azimuthal periodicity. The index maps give the jet for each tree entry.
     std::vector<AliEmcalJet *> jetsBase(kNacceptedBase), jetsTag(kNacceptedTag); // the storages are needed later for applying the tagging, in order to avoid multiple occurrence of jet selection
-
+    std::vector<Int_t> indexMapBase, indexMapTag;
     int countBase(0), countTag(0);
-    for(auto jb : contBase.accepted()) {
-      etaBase[countBase] = jb->Eta();
-      phiBase[countBase] = jb->Phi();
-      jetsBase[countBase] = jb;
-      countBase++;
-    }
-    for(auto jt : contTag.accepted()) {
-      etaTag[countTag] = jt->Eta();
-      phiTag[countTag] = jt->Phi();
-      jetsTag[countTag] = jt;
-      countTag++;
-    }
+    for(auto jb : contBase.accepted()) jetsBase[countBase++] = jb;
+    for(auto jt : contTag.accepted()) jetsTag[countTag++] = jt;
+    TArrayD etaBase, phiBase, etaTag, phiTag;
+    FillJetIndexData(jetsBase, maxDist, etaBase, phiBase, indexMapBase);
+    FillJetIndexData(jetsTag, maxDist, etaTag, phiTag, indexMapTag);
     TKDTreeID treeBase(etaBase.GetSize(), 2, 1), treeTag(etaTag.GetSize(), 2, 1);
     treeBase.SetData(0, etaBase.GetArray());
     treeBase.SetData(1, phiBase.GetArray());
@@ -399,59 +427,76 @@ namespace PWGJE {
     faMatchIndexBase.Reset(-1);
     faMatchIndexTag.Reset(-1);
 
-    // find the closest distance to the full jet
-    countBase = 0;
-    for(auto j : contBase.accepted()) {
-      Double_t point[2] = {j->Eta(), j->Phi()};
-      Int_t index(-1); Double_t distance(-1);
-      treeTag.FindNearestNeighbors(point, 1, &index, &distance);
-      // test whether indices are matching:
-      if(index >= 0 && distance < maxDist){
-        AliDebugStream(1) << "Found closest tag jet for " << countBase << " with match index " << index << " and distance " << distance << std::endl;
-        faMatchIndexTag[countBase]=index;
-      } else {
-        AliDebugStream(1) << "Not found closest tag jet for " << countBase << ", distance to closest " << distance << std::endl;
+    if(fJetMatchingMode == kBipartiteClosest) {
+      // one-to-one assignment: all pairs within maxDist, accepted in order of increasing distance
+      std::vector<std::pair<Double_t, std::pair<Int_t, Int_t>>> candidates;
+      std::vector<Int_t> inRange;
+      for(int ibase = 0; ibase < kNacceptedBase; ibase++) {
+        Double_t point[2] = {etaBase[ibase], phiBase[ibase]};
+        inRange.clear();
+        treeTag.FindInRange(point, maxDist, inRange);
+        for(auto itree : inRange) {
+          Double_t distance = TMath::Sqrt(TMath::Power(etaTag[itree] - point[0], 2) + TMath::Power(phiTag[itree] - point[1], 2));
+          if(distance < maxDist) candidates.push_back(std::make_pair(distance, std::make_pair(ibase, indexMapTag[itree])));
+        }
+      }
+      std::sort(candidates.begin(), candidates.end());
+      for(const auto &cand : candidates) {
+        Int_t ibase = cand.second.first, itag = cand.second.second;
+        if(faMatchIndexTag[ibase] > -1 || faMatchIndexBase[itag] > -1) continue;
+        AliDebugStream(2) << "Bipartite match base jet " << ibase << " - tag jet " << itag << ", distance " << cand.first << std::endl;
+        faMatchIndexTag[ibase] = itag;
+        faMatchIndexBase[itag] = ibase;
       }
+    } else {
+      // find the closest distance to the full jet
+      for(int ibase = 0; ibase < kNacceptedBase; ibase++) {
+        Double_t point[2] = {etaBase[ibase], phiBase[ibase]};
+        Int_t index(-1); Double_t distance(-1);
+        treeTag.FindNearestNeighbors(point, 1, &index, &distance);
+        // test whether indices are matching:
+        if(index >= 0 && distance < maxDist){
+          AliDebugStream(1) << "Found closest tag jet for " << ibase << " with match index " << indexMapTag[index] << " and distance " << distance << std::endl;
+          faMatchIndexTag[ibase]=indexMapTag[index];
+        } else {
+          AliDebugStream(1) << "Not found closest tag jet for " << ibase << ", distance to closest " << distance << std::endl;
+        }
 
 #ifdef JETTAGGERFAST_TEST
-      if(index>-1){
-        Double_t distanceTest(-1);
-        distanceTest = TMath::Sqrt(TMath::Power(etaTag[index] - j->Eta(), 2) +  TMath::Power(phiTag[index] - j->Phi(), 2));
-        if(TMath::Abs(distanceTest - distance) > DBL_EPSILON){
-          AliDebugStream(1) << "Mismatch in distance from tag jet with index from tree: " << distanceTest << ", distance from tree " << distance << std::endl;
-          fIndexErrorRateBase->Fill(1);
+        if(index>-1){
+          Double_t distanceTest(-1);
+          distanceTest = TMath::Sqrt(TMath::Power(etaTag[index] - point[0], 2) +  TMath::Power(phiTag[index] - point[1], 2));
+          if(TMath::Abs(distanceTest - distance) > DBL_EPSILON){
+            AliDebugStream(1) << "Mismatch in distance from tag jet with index from tree: " << distanceTest << ", distance from tree " << distance << std::endl;
+            fIndexErrorRateBase->Fill(1);
+          }
         }
-      }
 #endif
-
-      countBase++;
-    }
-
-    // other way around
-    countTag = 0;
-    for(auto j : contTag.accepted()){
-      Double_t point[2] = {j->Eta(), j->Phi()};
-      Int_t index(-1); Double_t distance(-1);
-      treeBase.FindNearestNeighbors(point, 1, &index, &distance);
-      if(index >= 0 && distance < maxDist){
-        AliDebugStream(1) << "Found closest base jet for " << countBase << " with match index " << index << " and distance " << distance << std::endl;
-        faMatchIndexBase[countTag]=index;
-      } else {
-        AliDebugStream(1) << "Not found closest tag jet for " << countBase << ", distance to closest " << distance << std::endl;
       }
 
+      // other way around
+      for(int itag = 0; itag < kNacceptedTag; itag++){
+        Double_t point[2] = {etaTag[itag], phiTag[itag]};
+        Int_t index(-1); Double_t distance(-1);
+        treeBase.FindNearestNeighbors(point, 1, &index, &distance);
+        if(index >= 0 && distance < maxDist){
+          AliDebugStream(1) << "Found closest base jet for " << itag << " with match index " << indexMapBase[index] << " and distance " << distance << std::endl;
+          faMatchIndexBase[itag]=indexMapBase[index];
+        } else {
+          AliDebugStream(1) << "Not found closest base jet for " << itag << ", distance to closest " << distance << std::endl;
+        }
+
 #ifdef JETTAGGERFAST_TEST
-      if(index>-1){
-        Double_t distanceTest(-1);
-        distanceTest = TMath::Sqrt(TMath::Power(etaBase[index] - j->Eta(), 2) +  TMath::Power(phiBase[index] - j->Phi(), 2));
-        if(TMath::Abs(distanceTest - distance) > DBL_EPSILON){
-          AliDebugStream(1) << "Mismatch in distance from base jet with index from tree: " << distanceTest << ", distance from tree " << distance << std::endl;
-          fIndexErrorRateTag->Fill(1);
+        if(index>-1){
+          Double_t distanceTest(-1);
+          distanceTest = TMath::Sqrt(TMath::Power(etaBase[index] - point[0], 2) +  TMath::Power(phiBase[index] - point[1], 2));
+          if(TMath::Abs(distanceTest - distance) > DBL_EPSILON){
+            AliDebugStream(1) << "Mismatch in distance from base jet with index from tree: " << distanceTest << ", distance from tree " << distance << std::endl;
+            fIndexErrorRateTag->Fill(1);
+          }
         }
-      }
 #endif
-
-      countTag++;
+      }
     }
 
     // check for "true" correlations
@@ -487,12 +532,16 @@ namespace PWGJE {
             jetBase->SetTaggedJet(jetTag);
             jetBase->SetTagStatus(1);
 
-            jetTag->SetTaggedJet(jetBase);
-            jetTag->SetTagStatus(1);
+            // in the chain the tag slot of the lower level is kept for its own match to the next level
+            if(!chained) {
+              jetTag->SetTaggedJet(jetBase);
+              jetTag->SetTagStatus(1);
+            }
             break;
           case kClosest:
             jetBase->SetClosestJet(jetTag,dR);
-            jetTag->SetClosestJet(jetBase,dR);
+            if(chained) jetTag->SetSecondClosestJet(jetBase,dR);
+            else        jetTag->SetClosestJet(jetBase,dR);
             break;
           };
         }
@@ -501,6 +550,22 @@ namespace PWGJE {
     return kTRUE;
   }
 
+  void AliEmcalJetTaggerTaskFast::FillJetIndexData(const std::vector<AliEmcalJet *> &jets, Double_t maxDist, TArrayD &eta, TArrayD &phi, std::vector<Int_t> &indexMap) const {
+    indexMap.clear();
+    for(UInt_t ijet = 0; ijet < jets.size(); ijet++) indexMap.push_back(ijet);
+    for(UInt_t ijet = 0; ijet < jets.size(); ijet++) {
+      if(jets[ijet]->Phi() < maxDist || jets[ijet]->Phi() > TMath::TwoPi() - maxDist) indexMap.push_back(ijet);
+    }
+    eta.Set(indexMap.size());
+    phi.Set(indexMap.size());
+    for(UInt_t ientry = 0; ientry < indexMap.size(); ientry++) {
+      const AliEmcalJet *jet = jets[indexMap[ientry]];
+      eta[ientry] = jet->Eta();
+      phi[ientry] = jet->Phi();
+      if(ientry >= jets.size()) phi[ientry] += (jet->Phi() < TMath::Pi()) ? TMath::TwoPi() : -TMath::TwoPi();
+    }
+  }
+
   Double_t AliEmcalJetTaggerTaskFast::GetDeltaPhi(const AliEmcalJet* jet1, const AliEmcalJet* jet2) {
     return GetDeltaPhi(jet1->Phi(),jet2->Phi());
   }
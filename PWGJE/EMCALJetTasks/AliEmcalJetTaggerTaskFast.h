@@ -29,11 +29,13 @@
 
 //#define JETTAGGERFAST_TEST
 
+class TArrayD;
 class TH1;
 class TH2;
 class TH3;
 class AliJetContainer;
 
+#include <vector>
 #include "AliAnalysisTaskEmcalJet.h"
 
 namespace PWGJE {
@@ -50,6 +52,11 @@ namespace EMCALJetTasks {
  * Class based on AliAnalysisTaskEmcalJetTagger. Navigation finding closest neighbor
  * however is based on a kd-tree.
  *
+ * Besides the matching of mutual closest jets a one-to-one assignment in order of
+ * increasing distance (\ref kBipartiteClosest) is available. Additional jet containers
+ * can be added to a chain (e.g. hybrid - detector - particle level), in which each level
+ * is matched to the next one in the same event loop.
+ *
  */
 class AliEmcalJetTaggerTaskFast : public AliAnalysisTaskEmcalJet {
  public:
@@ -62,6 +69,15 @@ class AliEmcalJetTaggerTaskFast : public AliAnalysisTaskEmcalJet {
     kTag      = 0,
     kClosest  = 1
   };
+
+  /**
+   * @enum JetMatchingMode
+   * @brief Assignment of the jet pairs within the max. distance
+   */
+  enum JetMatchingMode {
+    kMutualClosest = 0,       ///< Base and tag jet must be the closest neighbor of each other
+    kBipartiteClosest = 1     ///< One-to-one assignment of all pairs in order of increasing distance
+  };
   /**
    * @enum AcceptanceType
    * @brief Accpetance type used for the two jet containers
@@ -103,6 +119,19 @@ class AliEmcalJetTaggerTaskFast : public AliAnalysisTaskEmcalJet {
   
   void SetTypeAcceptance(AcceptanceType type)                   { fTypeAcc = type; }
   void SetMaxDistance(Double_t dist)                            { fMaxDist = dist; }
+  void SetJetMatchingMode(JetMatchingMode m)                    { fJetMatchingMode = m; }
+
+  /**
+   * @brief Add jet container to the matching chain
+   *
+   * The tag container is matched to the first chained container, which is matched
+   * to the next one and so on. For the levels in the middle of the chain the link
+   * to the next level is stored in the tagged / closest jet, with kClosest the link
+   * to the previous level is stored as second closest jet.
+   *
+   * @param[in] c Index of the jet container
+   */
+  void AddChainedJetContainer(Int_t c)                          { fChainedContainers.push_back(c); }
   void SetSpecialParticleContainer(Int_t contnumb)              { fSpecPartContTag = contnumb; }
 
 
@@ -188,11 +217,25 @@ class AliEmcalJetTaggerTaskFast : public AliAnalysisTaskEmcalJet {
    * if the base jet is the closest neighbor to the tag jet and vice versa
    * at the same time.
    *
+   * Jets close to the azimuthal boundary are added to the kd-trees a second time
+   * with \f$\phi\f$ shifted by \f$2\pi\f$.
+   *
    * @param[in] contBase Container with base jets
    * @param[in] contTag Container with jets to be tagged
    * @param[in] maxDistance Maximum distance allowed in order to accept a pair tag
+   * @param[in] chained If true the tag jets keep their tag slot for the next level of the chain
+   */
+  Bool_t     MatchJetsGeo(AliJetContainer &contBase, AliJetContainer &contTag, Float_t maxDist = 0.3, Bool_t chained = kFALSE) const;
+
+  /**
+   * @brief Fill the kd-tree data of the jets including the periodic copies at the azimuthal boundary
+   * @param[in] jets Accepted jets
+   * @param[in] maxDist Maximum matching distance
+   * @param[out] eta \f$\eta\f$ of the tree entries
+   * @param[out] phi \f$\phi\f$ of the tree entries
+   * @param[out] indexMap Index of the jet for each tree entry
    */
-  Bool_t     MatchJetsGeo(AliJetContainer &contBase, AliJetContainer &contTag, Float_t maxDist = 0.3) const;
+  void       FillJetIndexData(const std::vector<AliEmcalJet *> &jets, Double_t maxDist, TArrayD &eta, TArrayD &phi, std::vector<Int_t> &indexMap) const;
 
   /**
    * @brief Reset tagging for all jets in jet container
@@ -204,6 +247,7 @@ class AliEmcalJetTaggerTaskFast : public AliAnalysisTaskEmcalJet {
  private:
   JetTaggingType                      fJetTaggingType;             ///< jet matching type
   JetTaggingMethod                    fJetTaggingMethod;           ///< jet matching method
+  JetMatchingMode                     fJetMatchingMode;            ///< assignment of the jet pairs
   Int_t                               fContainerBase;              ///< jets to be tagged
   Int_t                               fContainerTag;               ///< jets used for tagging
   Int_t                               fSpecPartContTag;            ///< particle container optionally used in AliJetContainer::GetFractionSharedPt(). Set only if needed.
@@ -212,6 +256,7 @@ class AliEmcalJetTaggerTaskFast : public AliAnalysisTaskEmcalJet {
   Bool_t                              fMatchingDone;               ///< flag to indicate if matching is done or not
   AcceptanceType                      fTypeAcc;                    ///< acceptance cut for the jet containers, see method MatchJetsGeo in .cxx for possibilities
   Double_t                            fMaxDist;                    ///< distance allowed for two jets to match
+  std::vector<Int_t>                  fChainedContainers;          ///< further jet containers matched in a chain after the tag container
   Bool_t                              fInit;                       ///< true when the containers are initialized
   TH3            **fh3PtJet1VsDeltaEtaDeltaPhi;  //!<! \f$ p_{t}\f$ jet 1 vs deta vs dphi
   TH2            **fh2PtJet1VsDeltaR;            //!<! \f$ p_{t}\f$ jet 1 vs dR
@@ -235,7 +280,7 @@ class AliEmcalJetTaggerTaskFast : public AliAnalysisTaskEmcalJet {
   AliEmcalJetTaggerTaskFast &operator=(const AliEmcalJetTaggerTaskFast&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalJetTaggerTaskFast, 2);
+  ClassDef(AliEmcalJetTaggerTaskFast, 3);
   /// \endcond
 };
 }
@@ -25,12 +25,14 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                       *
  **************************************************************************************/
 #include <vector>
+#include <thread>
 
 #include <TClonesArray.h>
 #include <TMath.h>
 #include <TRandom3.h>
 #include <TGrid.h>
 #include <TFile.h>
+#include <TH1F.h>
 
 #include <AliVCluster.h>
 #include <AliVEvent.h>
@@ -98,8 +100,22 @@ AliEmcalJetTask::AliEmcalJetTask() :
   fEnableAliBasicParticleCompatibility(kFALSE),
   fLegacyMode(kFALSE),
   fFillGhost(kFALSE),
+  fInputReserve(0),
+  fGroupJetAlgo(),
+  fGroupRadius(),
+  fGroupRecombScheme(),
+  fGroupJetsTag(),
+  fGroupNThreads(1),
+  fFillConstituentTable(kFALSE),
   fJets(0),
   fFastJetWrapper("AliEmcalJetTask","AliEmcalJetTask"),
+  fConstituents(),
+  fNAllocations(0),
+  fHistAllocations(0),
+  fGroupWrappers(),
+  fGroupJets(),
+  fConstituentTable(0),
+  fCurrentConstituentTable(0),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap()
 {
@@ -140,8 +156,22 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
   fEnableAliBasicParticleCompatibility(kFALSE),
   fLegacyMode(kFALSE),
   fFillGhost(kFALSE),
+  fInputReserve(0),
+  fGroupJetAlgo(),
+  fGroupRadius(),
+  fGroupRecombScheme(),
+  fGroupJetsTag(),
+  fGroupNThreads(1),
+  fFillConstituentTable(kFALSE),
   fJets(0),
   fFastJetWrapper(name,name),
+  fConstituents(),
+  fNAllocations(0),
+  fHistAllocations(0),
+  fGroupWrappers(),
+  fGroupJets(),
+  fConstituentTable(0),
+  fCurrentConstituentTable(0),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap()
 {
@@ -152,6 +182,32 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
  */
 AliEmcalJetTask::~AliEmcalJetTask()
 {
+  for (auto fjw : fGroupWrappers) delete fjw;
+}
+
+/**
+ * Add a jet definition to the jet finder group of this task. The jets
+ * of the additional definition are found from the same input
+ * (same constituents, cuts and artificial inefficiency) as the main
+ * definition and are published in their own jet branch, named as the
+ * branch of a separate jet task with these settings. The jet selection
+ * (pt, area, eta and phi range) is the one of the main definition, the
+ * jet utilities are only run for the main definition.
+ * @param jetAlgo Jet algorithm
+ * @param radius Jet radius
+ * @param reco Recombination scheme
+ * @param tag Tag of the jet branch (empty: same as the main definition)
+ */
+void AliEmcalJetTask::AddJetDefinition(EJetAlgo_t jetAlgo, Double_t radius, ERecoScheme_t reco, const char *tag)
+{
+  if (fJets) {
+    AliError(Form("%s: jet definitions must be added before the first event", GetName()));
+    return;
+  }
+  fGroupJetAlgo.push_back(jetAlgo);
+  fGroupRadius.push_back(radius);
+  fGroupRecombScheme.push_back(reco);
+  fGroupJetsTag.push_back(tag);
 }
 
 /**
@@ -171,6 +227,24 @@ AliEmcalJetUtility* AliEmcalJetTask::AddUtility(AliEmcalJetUtility* utility)
   return utility;
 }
 
+/**
+ * Create the output objects. In addition to the general histograms of
+ * AliAnalysisTaskEmcal, the number of heap allocations done per event by the
+ * jet finder (FastJet wrapper definitions, cluster sequence and reallocations of
+ * the reused buffers) is monitored. Allocations inside FastJet are not counted.
+ */
+void AliEmcalJetTask::UserCreateOutputObjects()
+{
+  AliAnalysisTaskEmcal::UserCreateOutputObjects();
+
+  if (!fOutput) return;
+
+  fHistAllocations = new TH1F("fHistAllocations", "Heap allocations of the jet finder per event;allocations;events", 50, 0., 50.);
+  fOutput->Add(fHistAllocations);
+
+  PostData(1, fOutput);
+}
+
 /**
  * This method is called once before analyzing the first event. It executes
  * the Init() method of all utilities (if any).
@@ -232,16 +306,68 @@ void AliEmcalJetTask::TerminateUtilities()
  */
 Bool_t AliEmcalJetTask::Run()
 {
+  fFastJetWrapper.ResetNAllocations();
+  fNAllocations = 0;
+
   InitEvent();
   // clear the jet array (normally a null operation)
   fJets->Delete();
+  for (auto jets : fGroupJets) jets->Delete();
+  if (fConstituentTable) fConstituentTable->Clear();
   Int_t n = FindJets();
 
-  if (n == 0) return kFALSE;
+  if (n > 0) {
+    FillJetBranch();
+    RunJetFinderGroup();
+  }
 
-  FillJetBranch();
+  if (fHistAllocations) {
+    UInt_t nalloc = fFastJetWrapper.GetNAllocations() + fNAllocations;
+    for (auto fjw : fGroupWrappers) nalloc += fjw->GetNAllocations();
+    fHistAllocations->Fill(nalloc);
+  }
 
-  return kTRUE;
+  return n > 0;
+}
+
+/**
+ * Run the additional jet definitions of the jet finder group on the
+ * input vectors of the main definition and fill their jet branches.
+ * The jet finding runs in parallel threads if more than one thread
+ * was requested, the jet branches are filled sequentially.
+ */
+void AliEmcalJetTask::RunJetFinderGroup()
+{
+  const UInt_t ndef = fGroupWrappers.size();
+  if (!ndef) return;
+
+  const std::vector<fastjet::PseudoJet> &inputs = fFastJetWrapper.GetInputVectors();
+  auto findjets = [this, &inputs, ndef](UInt_t first, UInt_t stride) {
+    for (UInt_t idef = first; idef < ndef; idef += stride) {
+      AliFJWrapper *fjw = fGroupWrappers[idef];
+      fjw->ResetNAllocations();
+      fjw->Clear();
+      fjw->ReserveInputVectors(inputs.size());
+      fjw->AddInputVectors(inputs);
+      fjw->Run();
+    }
+  };
+
+  const UInt_t nthreads = fGroupNThreads > 1 ? TMath::Min(static_cast<UInt_t>(fGroupNThreads), ndef) : 1;
+  if (nthreads > 1) {
+    std::vector<std::thread> workers;
+    for (UInt_t ithread = 1; ithread < nthreads; ithread++) workers.emplace_back(findjets, ithread, nthreads);
+    findjets(0, nthreads);
+    for (auto &worker : workers) worker.join();
+  }
+  else {
+    findjets(0, 1);
+  }
+
+  for (UInt_t idef = 0; idef < ndef; idef++) {
+    if (!fGroupWrappers[idef]->GetClusterSequence()) continue;
+    FillJetBranch(*fGroupWrappers[idef], fGroupJets[idef], fGroupRadius[idef], kFALSE);
+  }
 }
 
 /**
@@ -335,10 +461,24 @@ Int_t AliEmcalJetTask::FindJets()
  */
 void AliEmcalJetTask::FillJetBranch()
 {
-  PrepareUtilities();
+  fCurrentConstituentTable = fConstituentTable;
+  FillJetBranch(fFastJetWrapper, fJets, fRadius, kTRUE);
+  fCurrentConstituentTable = 0;
+}
+
+/**
+ * Fill a jet output branch with the jets found by a FastJet wrapper.
+ * @param fjw FastJet wrapper after the jet finding
+ * @param jets Output jet branch
+ * @param radius Jet radius used for the jet acceptance type
+ * @param doUtilities If true the jet utilities are executed
+ */
+void AliEmcalJetTask::FillJetBranch(AliFJWrapper &fjw, TClonesArray *jets, Double_t radius, Bool_t doUtilities)
+{
+  if (doUtilities) PrepareUtilities();
 
   // loop over fastjet jets
-  std::vector<fastjet::PseudoJet> jets_incl = fFastJetWrapper.GetInclusiveJets();
+  const std::vector<fastjet::PseudoJet> &jets_incl = fjw.GetInclusiveJets();
   // sort jets according to jet pt
   static Int_t indexes[9999] = {-1};
   GetSortedArray(indexes, jets_incl);
@@ -346,28 +486,30 @@ void AliEmcalJetTask::FillJetBranch()
   AliDebug(1,Form("%d jets found", (Int_t)jets_incl.size()));
   for (UInt_t ijet = 0, jetCount = 0; ijet < jets_incl.size(); ++ijet) {
     Int_t ij = indexes[ijet];
-    AliDebug(3,Form("Jet pt = %f, area = %f", jets_incl[ij].perp(), fFastJetWrapper.GetJetArea(ij)));
+    AliDebug(3,Form("Jet pt = %f, area = %f", jets_incl[ij].perp(), fjw.GetJetArea(ij)));
 
     if (jets_incl[ij].perp() < fMinJetPt) continue;
-    if (fFastJetWrapper.GetJetArea(ij) < fMinJetArea) continue;
+    if (fjw.GetJetArea(ij) < fMinJetArea) continue;
     if ((jets_incl[ij].eta() < fJetEtaMin) || (jets_incl[ij].eta() > fJetEtaMax) ||
         (jets_incl[ij].phi() < fJetPhiMin) || (jets_incl[ij].phi() > fJetPhiMax))
       continue;
 
-    AliEmcalJet *jet = new ((*fJets)[jetCount])
+    AliEmcalJet *jet = new ((*jets)[jetCount])
     		          AliEmcalJet(jets_incl[ij].perp(), jets_incl[ij].eta(), jets_incl[ij].phi(), jets_incl[ij].m());
     jet->SetLabel(ij);
 
-    fastjet::PseudoJet area(fFastJetWrapper.GetJetAreaVector(ij));
+    fastjet::PseudoJet area(fjw.GetJetAreaVector(ij));
     jet->SetArea(area.perp());
     jet->SetAreaEta(area.eta());
     jet->SetAreaPhi(area.phi());
     jet->SetAreaE(area.E());
-    jet->SetJetAcceptanceType(FindJetAcceptanceType(jet->Eta(), jet->Phi_0_2pi(), fRadius));
+    jet->SetJetAcceptanceType(FindJetAcceptanceType(jet->Eta(), jet->Phi_0_2pi(), radius));
 
-    // Fill constituent info
-    std::vector<fastjet::PseudoJet> constituents(fFastJetWrapper.GetJetConstituents(ij));
-    FillJetConstituents(jet, constituents, constituents);
+    // Fill constituent info, the buffer is reused for all jets
+    std::size_t capacity = fConstituents.capacity();
+    fjw.GetJetConstituents(ij, fConstituents);
+    if (fConstituents.capacity() != capacity) fNAllocations++;
+    FillJetConstituents(jet, fConstituents, fConstituents);
 
     if (fGeom) {
       if ((jet->Phi() > fGeom->GetArm1PhiMin() * TMath::DegToRad()) &&
@@ -377,13 +519,13 @@ void AliEmcalJetTask::FillJetBranch()
         jet->SetAxisInEmcal(kTRUE);
     }
 
-    ExecuteUtilities(jet, ij);
+    if (doUtilities) ExecuteUtilities(jet, ij);
 
     AliDebug(2,Form("Added jet n. %d, pt = %f, area = %f, constituents = %d", jetCount, jet->Pt(), jet->Area(), jet->GetNumberOfConstituents()));
     jetCount++;
   }
 
-  TerminateUtilities();
+  if (doUtilities) TerminateUtilities();
 }
 
 /**
@@ -392,7 +534,7 @@ void AliEmcalJetTask::FillJetBranch()
  * @param[in] array Vector containing the list of jets obtained by the FastJet wrapper
  * @return kTRUE if at least one jet was found in array; kFALSE otherwise
  */
-Bool_t AliEmcalJetTask::GetSortedArray(Int_t indexes[], std::vector<fastjet::PseudoJet> array) const
+Bool_t AliEmcalJetTask::GetSortedArray(Int_t indexes[], const std::vector<fastjet::PseudoJet>& array) const
 {
   static Float_t pt[9999] = {0};
 
@@ -460,6 +602,20 @@ void AliEmcalJetTask::ExecOnce()
     return;
   }
 
+  // add the constituent table of the jet branch to the event
+  if (fFillConstituentTable) {
+    TString tableName = fJetsName + "_ConstituentTable";
+    if (!(InputEvent()->FindListObject(tableName))) {
+      fConstituentTable = new PWG::JETFW::AliEmcalJetConstituentTable(tableName);
+      if (fInputReserve > 0) fConstituentTable->Reserve(fInputReserve);
+      InputEvent()->AddObject(fConstituentTable);
+      ::Info("AliEmcalJetTask::ExecOnce", "Constituent table with name '%s' has been added to the event.", tableName.Data());
+    }
+    else {
+      AliError(Form("%s: Object with name %s already in event! The constituent table will not be filled", GetName(), tableName.Data()));
+    }
+  }
+
   // setup fj wrapper
   fFastJetWrapper.SetAreaType(fastjet::active_area_explicit_ghosts);
   fFastJetWrapper.SetGhostArea(fGhostArea);
@@ -467,13 +623,40 @@ void AliEmcalJetTask::ExecOnce()
   fFastJetWrapper.SetAlgorithm(ConvertToFJAlgo(fJetAlgo));
   fFastJetWrapper.SetRecombScheme(ConvertToFJRecoScheme(fRecombScheme));
   fFastJetWrapper.SetMaxRap(1);
- 
+  // the definitions do not change from event to event
+  fFastJetWrapper.SetReuseDefinitions(kTRUE);
+  if (fInputReserve > 0) fFastJetWrapper.ReserveInputVectors(fInputReserve);
 
   // setting legacy mode
   if (fLegacyMode) {
     fFastJetWrapper.SetLegacyMode(kTRUE);
   }
 
+  // setup the additional jet definitions of the jet finder group
+  for (UInt_t idef = 0; idef < fGroupJetAlgo.size(); idef++) {
+    EJetAlgo_t algo = static_cast<EJetAlgo_t>(fGroupJetAlgo[idef]);
+    ERecoScheme_t reco = static_cast<ERecoScheme_t>(fGroupRecombScheme[idef]);
+    TString tag = fGroupJetsTag[idef].IsNull() ? fJetsTag : fGroupJetsTag[idef];
+    TString jetsName = AliJetContainer::GenerateJetName(fJetType, algo, reco, fGroupRadius[idef], GetParticleContainer(0), GetClusterContainer(0), tag);
+    if (InputEvent()->FindListObject(jetsName)) {
+      AliError(Form("%s: Object with name %s already in event! Skipping this jet definition", GetName(), jetsName.Data()));
+      continue;
+    }
+    TClonesArray *jets = new TClonesArray("AliEmcalJet");
+    jets->SetName(jetsName);
+    InputEvent()->AddObject(jets);
+    ::Info("AliEmcalJetTask::ExecOnce", "Jet collection with name '%s' has been added to the event.", jetsName.Data());
+
+    AliFJWrapper *fjw = new AliFJWrapper(jetsName, jetsName);
+    fjw->CopySettingsFrom(fFastJetWrapper);
+    fjw->SetR(fGroupRadius[idef]);
+    fjw->SetAlgorithm(ConvertToFJAlgo(algo));
+    fjw->SetRecombScheme(ConvertToFJRecoScheme(reco));
+    fjw->SetReuseDefinitions(kTRUE);
+    fGroupWrappers.push_back(fjw);
+    fGroupJets.push_back(jets);
+  }
+
   InitUtilities();
 
   AliAnalysisTaskEmcal::ExecOnce();
@@ -509,6 +692,8 @@ void AliEmcalJetTask::FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet:
   Double_t mcpt       = 0.;
   Double_t emcpt      = 0.;
   TClonesArray * particles_sub = 0;
+  PWG::JETFW::AliEmcalJetConstituentTable *table = (flag == 0) ? fCurrentConstituentTable : 0;
+  const Int_t tableOffset = table ? table->GetNRows() : 0;
 
   Int_t uid   = -1;
 
@@ -598,6 +783,7 @@ void AliEmcalJetTask::FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet:
 
       if (flag == 0 || particlesSubName == "") {
         jet->AddTrackAt(fParticleContainerIndexMap.GlobalIndexFromLocalIndex(partCont, tid), nt);
+        if (table) table->AddParticle(t, fParticleContainerIndexMap.GlobalIndexFromLocalIndex(partCont, tid));
         if(fFillConstituents){
           jet->AddParticleConstituent(t, partCont->GetIsEmbedding(), fParticleContainerIndexMap.GlobalIndexFromLocalIndex(partCont, tid));
         }
@@ -654,6 +840,7 @@ void AliEmcalJetTask::FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet:
 
       if (flag == 0 || particlesSubName == "") {
         jet->AddClusterAt(fClusterContainerIndexMap.GlobalIndexFromLocalIndex(clusCont, cid), nc);
+        if (table) table->AddCluster(nP, fClusterContainerIndexMap.GlobalIndexFromLocalIndex(clusCont, cid));
 
         if(fFillConstituents) {
           Double_t pvec[3] = {nP.Px(), nP.Py(), nP.Pz()};
@@ -702,6 +889,7 @@ void AliEmcalJetTask::FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet:
   jet->SetNumberOfNeutrals(nneutral);
   jet->SetMCPt(mcpt);
   jet->SetPtEmc(emcpt);
+  if (table) jet->SetConstituentTableRange(table, tableOffset, table->GetNRows() - tableOffset);
   jet->SortConstituents();
 }
 
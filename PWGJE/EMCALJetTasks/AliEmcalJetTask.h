@@ -29,6 +29,7 @@
 
 class TClonesArray;
 class TObjArray;
+class TH1;
 class AliVEvent;
 class AliEmcalJetUtility;
 
@@ -71,6 +72,11 @@ namespace fastjet {
  * and its derived classes. Utilities can be added via the AddUtility(AliEmcalJetUtility*) method.
  * All the utilities added in the list will be executed. Users can implement new utilities
  * deriving a new class from AliEmcalJetUtility to interface functionalities of the FastJet contribs.
+ *
+ * Additional jet definitions (algorithm, radius, recombination scheme) can be added via
+ * AddJetDefinition(...). They form a jet finder group: the input is built once per event
+ * and the jet finding for all definitions runs on it, in parallel threads if requested
+ * via SetNumberOfThreads(Int_t). Each definition publishes its own jet branch.
  */
 class AliEmcalJetTask : public AliAnalysisTaskEmcal {
  public:
@@ -88,6 +94,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   AliEmcalJetTask(const char *name);
   virtual ~AliEmcalJetTask();
 
+  void   UserCreateOutputObjects();
   Bool_t Run();
 
   void                   SetGhostArea(Double_t gharea)              { if (IsLocked()) return; fGhostArea        = gharea; }
@@ -108,6 +115,11 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   void                   SetLegacyMode(Bool_t mode)                 { if (IsLocked()) return; fLegacyMode       = mode  ; }
   void                   SetFillGhost(Bool_t b=kTRUE)               { if (IsLocked()) return; fFillGhost        = b     ; }
   void                   SetRadius(Double_t r)                      { if (IsLocked()) return; fRadius           = r     ; }
+  void                   SetInputReserve(UInt_t n)                  { if (IsLocked()) return; fInputReserve     = n     ; }
+  void                   SetNumberOfThreads(Int_t n)                { fGroupNThreads = n; }
+
+  void                   AddJetDefinition(EJetAlgo_t jetAlgo, Double_t radius, ERecoScheme_t reco = AliJetContainer::pt_scheme, const char *tag = "");
+  Int_t                  GetNJetDefinitions() const       { return fGroupJetAlgo.size() + 1; }
 
   void                   SetEtaRange(Double_t emi, Double_t ema);
   void                   SetMinJetClusPt(Double_t min);
@@ -158,6 +170,18 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
    */
   void                   SetFillJetConsituents(Bool_t doFill) { fFillConstituents = doFill; }
 
+  /**
+   * @brief Switch for filling the per-event constituent table of the jet branch
+   *
+   * The kinematics of the constituents of all jets are stored in one table which is
+   * added to the event as "<jet branch name>_ConstituentTable". Each jet refers to
+   * its range of rows, see AliEmcalJet::GetConstituentPts() and the other batch
+   * accessors. Only filled for the main jet definition of the task.
+   *
+   * @param doFill Switch for filling the constituent table
+   */
+  void                   SetFillConstituentTable(Bool_t doFill) { fFillConstituentTable = doFill; }
+
   static AliEmcalJetTask* AddTaskEmcalJet(
       const TString nTracks                      = "usedefault",
       const TString nClusters                    = "usedefault",
@@ -184,13 +208,15 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
 
   Int_t                  FindJets();
   void                   FillJetBranch();
+  void                   FillJetBranch(AliFJWrapper &fjw, TClonesArray *jets, Double_t radius, Bool_t doUtilities);
+  void                   RunJetFinderGroup();
   void                   ExecOnce();
   void                   InitEvent();
   void                   InitUtilities();
   void                   PrepareUtilities();
   void                   ExecuteUtilities(AliEmcalJet* jet, Int_t ij);
   void                   TerminateUtilities();
-  Bool_t                 GetSortedArray(Int_t indexes[], std::vector<fastjet::PseudoJet> array) const;
+  Bool_t                 GetSortedArray(Int_t indexes[], const std::vector<fastjet::PseudoJet>& array) const;
   Bool_t                 IsJetInEmcal(Double_t eta, Double_t phi, Double_t r);
   Bool_t                 IsJetInDcal(Double_t eta, Double_t phi, Double_t r);
   Bool_t                 IsJetInDcalOnly(Double_t eta, Double_t phi, Double_t r);
@@ -227,9 +253,23 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   Bool_t                 fEnableAliBasicParticleCompatibility; ///< Flag to allow compatibility with AliBasicParticle constituents
   Bool_t                 fLegacyMode;             //!<!=true to enable FJ 2.x behavior
   Bool_t                 fFillGhost;              ///< =true ghost particles will be filled in AliEmcalJet obj
+  UInt_t                 fInputReserve;           ///< number of input vectors reserved in the fastjet wrapper
+  std::vector<Int_t>     fGroupJetAlgo;           ///< jet algorithm of the additional jet definitions
+  std::vector<Double_t>  fGroupRadius;            ///< jet radius of the additional jet definitions
+  std::vector<Int_t>     fGroupRecombScheme;      ///< recombination scheme of the additional jet definitions
+  std::vector<TString>   fGroupJetsTag;           ///< jet branch tag of the additional jet definitions
+  Int_t                  fGroupNThreads;          ///< number of threads for the additional jet definitions
+  Bool_t                 fFillConstituentTable;   ///< if true the per-event constituent table is filled
 
   TClonesArray          *fJets;                   //!<!jet collection
   AliFJWrapper           fFastJetWrapper;         //!<!fastjet wrapper
+  std::vector<fastjet::PseudoJet> fConstituents;  //!<!constituents of the current jet, reused for all jets
+  UInt_t                 fNAllocations;           //!<!heap allocations of the task in the current event
+  TH1                   *fHistAllocations;        //!<!heap allocations of the jet finder per event
+  std::vector<AliFJWrapper*> fGroupWrappers;      //!<!fastjet wrappers of the additional jet definitions
+  std::vector<TClonesArray*> fGroupJets;          //!<!jet collections of the additional jet definitions
+  PWG::JETFW::AliEmcalJetConstituentTable *fConstituentTable; //!<!constituent table of the jet branch
+  PWG::JETFW::AliEmcalJetConstituentTable *fCurrentConstituentTable; //!<!constituent table of the jet branch being filled
 
   static const Int_t     fgkConstIndexShift;      //!<!contituent index shift
 
@@ -244,7 +284,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   AliEmcalJetTask &operator=(const AliEmcalJetTask&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalJetTask, 30);
+  ClassDef(AliEmcalJetTask, 33);
   /// \endcond
 };
 #endif
@@ -23,6 +23,7 @@ class AliFJWrapper
   virtual const char *ClassName()                            const { return "AliFJWrapper";              }
   virtual void  Clear(const Option_t* /*opt*/ = "");
   virtual void  ClearMemory();
+  virtual void  ClearEventMemory();
   virtual void  CopySettingsFrom (const AliFJWrapper& wrapper);
   virtual void  GetMedianAndSigma(Double_t& median, Double_t& sigma, Int_t remove = 0) const;
   fastjet::ClusterSequenceArea*           GetClusterSequence() const   { return fClustSeq;                 }
@@ -35,6 +36,7 @@ class AliFJWrapper
   const std::vector<fastjet::PseudoJet>&  GetEventSubJets()   const { return fEventSubJets;              }
   const std::vector<fastjet::PseudoJet>&  GetFilteredJets()    const { return fFilteredJets;               }
   std::vector<fastjet::PseudoJet>         GetJetConstituents(UInt_t idx) const;
+  void                                    GetJetConstituents(UInt_t idx, std::vector<fastjet::PseudoJet>& constituents) const;
   std::vector<fastjet::PseudoJet>         GetEventSubJetConstituents(UInt_t idx) const;
   std::vector<fastjet::PseudoJet>         GetFilteredJetConstituents(UInt_t idx) const;
   Double_t                                GetMedianUsedForBgSubtraction() const { return fMedUsedForBgSub; }
@@ -50,6 +52,9 @@ class AliFJWrapper
   virtual std::vector<double>             GetSubtractedJetsPts(Double_t median_pt = -1, Bool_t sorted = kFALSE);
   Bool_t                                  GetLegacyMode()            { return fLegacyMode; }
   Bool_t                                  GetDoFilterArea()          { return fDoFilterArea; }
+  Bool_t                                  GetReuseDefinitions() const { return fReuseDefinitions; }
+  UInt_t                                  GetNAllocations()    const { return fNAllocations;               }
+  void                                    ResetNAllocations()        { fNAllocations = 0; }
   Double_t                                NSubjettiness(Int_t N, Int_t Algorithm, Double_t Radius, Double_t Beta, Int_t Option=0, Int_t Measure=0, Double_t Beta_SD=0.0, Double_t ZCut=0.1, Int_t SoftDropOn=0);
   Double32_t                              NSubjettinessDerivativeSub(Int_t N, Int_t Algorithm, Double_t Radius, Double_t Beta, Double_t JetR, fastjet::PseudoJet jet, Int_t Option=0, Int_t Measure=0, Double_t Beta_SD=0.0, Double_t ZCut=0.1, Int_t SoftDropOn=0);
 #ifdef FASTJET_VERSION
@@ -130,6 +135,8 @@ class AliFJWrapper
   void SetMeanGhostKt(Double_t meankt)  { fMeanGhostKt    = meankt;  }
   void SetPluginAlgor(Int_t plugin)     { fPluginAlgor    = plugin;  }
   void SetUseArea4Vector(Bool_t useA4v) { fUseArea4Vector = useA4v;  }
+  void SetReuseDefinitions(Bool_t b)    { fReuseDefinitions = b;     }
+  void ReserveInputVectors(UInt_t n);
   void SetupAlgorithmfromOpt(const char *option);
   void SetupAreaTypefromOpt(const char *option);
   void SetupSchemefromOpt(const char *option);
@@ -236,8 +243,13 @@ class AliFJWrapper
   std::vector<double>                      fGRDenominator;    //!
   std::vector<double>                      fGRNumeratorSub;   //!
   std::vector<double>                      fGRDenominatorSub; //!
+  Bool_t                                   fReuseDefinitions; //! keep jet/area definitions across events
+  Double_t                                 fDefinitionParams[12]; //! settings the definitions were created with
+  std::vector<int>                         fGhostRandomStatus; //! initial random status of the ghosted area spec
+  UInt_t                                   fNAllocations;     //! number of heap allocations done by the wrapper since the last reset
 
   virtual void   SubtractBackground(const Double_t median_pt = -1);
+  void           FillDefinitionParams(Double_t params[12]) const;
 
  private:
   AliFJWrapper();
@@ -342,8 +354,12 @@ AliFJWrapper::AliFJWrapper(const char *name, const char *title)
   , fGRDenominator()
   , fGRNumeratorSub()
   , fGRDenominatorSub()
+  , fReuseDefinitions(kFALSE)
+  , fGhostRandomStatus()
+  , fNAllocations(0)
 {
   // Constructor.
+  for (Int_t i = 0; i < 12; i++) fDefinitionParams[i] = 0;
 }
 
 //_________________________________________________________________________________________________
@@ -363,6 +379,14 @@ void AliFJWrapper::ClearMemory()
   if (fJetDef)            { delete fJetDef;            fJetDef          = NULL; }
   if (fPlugin)            { delete fPlugin;            fPlugin          = NULL; }
   if (fRange)             { delete fRange;             fRange           = NULL; }
+  ClearEventMemory();
+}
+
+//_________________________________________________________________________________________________
+void AliFJWrapper::ClearEventMemory()
+{
+  // Delete the objects built from the input of the event,
+  // the jet and area definitions are kept.
   if (fClustSeq)          { delete fClustSeq;          fClustSeq        = NULL; }
   if (fClustSeqES)          { delete fClustSeqES;        fClustSeqES        = NULL; }
   if (fClustSeqSA)        { delete fClustSeqSA;        fClustSeqSA        = NULL; }
@@ -415,8 +439,53 @@ void AliFJWrapper::Clear(const Option_t */*opt*/)
   fInputGhosts.clear();
   fMedUsedForBgSub = 0;
 
-  // for the moment brute force delete everything
-  ClearMemory();
+  // the definitions only need to be rebuilt if the settings changed
+  if (fReuseDefinitions) {
+    Double_t params[12];
+    FillDefinitionParams(params);
+    Bool_t changed = kFALSE;
+    for (Int_t i = 0; i < 12; i++) if (params[i] != fDefinitionParams[i]) changed = kTRUE;
+    if (changed) ClearMemory();
+    else ClearEventMemory();
+  }
+  else {
+    // for the moment brute force delete everything
+    ClearMemory();
+  }
+}
+
+//_________________________________________________________________________________________________
+void AliFJWrapper::FillDefinitionParams(Double_t params[12]) const
+{
+  // Settings entering the jet and area definitions.
+
+  params[0]  = fStrategy;
+  params[1]  = fAlgor;
+  params[2]  = fScheme;
+  params[3]  = fAreaType;
+  params[4]  = fNGhostRepeats;
+  params[5]  = fGhostArea;
+  params[6]  = fMaxRap;
+  params[7]  = fR;
+  params[8]  = fGridScatter;
+  params[9]  = fKtScatter;
+  params[10] = fMeanGhostKt;
+  params[11] = fPluginAlgor;
+}
+
+//_________________________________________________________________________________________________
+void AliFJWrapper::ReserveInputVectors(UInt_t n)
+{
+  // Reserve the input vectors, so that no reallocation happens while filling.
+
+  if (fInputVectors.capacity() < n) {
+    fInputVectors.reserve(n);
+    fNAllocations++;
+  }
+  if (fEventSub && fEventSubInputVectors.capacity() < n) {
+    fEventSubInputVectors.reserve(n);
+    fNAllocations++;
+  }
 }
 
 //_________________________________________________________________________________________________
@@ -443,6 +512,7 @@ void AliFJWrapper::AddInputVector(Double_t px, Double_t py, Double_t pz, Double_
   //}
 
   // add to the fj container of input vectors
+  if (fInputVectors.size() == fInputVectors.capacity()) fNAllocations++;
   fInputVectors.push_back(inVec);
   if(fEventSub)   fEventSubInputVectors.push_back(inVec);
   
@@ -631,6 +701,21 @@ AliFJWrapper::GetJetConstituents(UInt_t idx) const
   return retval;
 }
 
+//_________________________________________________________________________________________________
+void AliFJWrapper::GetJetConstituents(UInt_t idx, std::vector<fastjet::PseudoJet>& constituents) const
+{
+  // Get jets constituents into a vector provided by the caller,
+  // its capacity is reused.
+
+  constituents.clear();
+
+  if ( idx < fInclusiveJets.size() ) {
+    fClustSeq->add_constituents(fInclusiveJets[idx], constituents);
+  } else {
+    AliError(Form("[e] ::GetJetConstituents wrong index: %d",idx));
+  }
+}
+
 //_________________________________________________________________________________________________
 std::vector<fastjet::PseudoJet>
 AliFJWrapper::GetEventSubJetConstituents(UInt_t idx) const
@@ -699,11 +784,17 @@ Int_t AliFJWrapper::Run()
 {
   // Run the actual jet finder.
 
-  if (fAreaType == fj::voronoi_area) {
+  // The definitions are kept from the previous event only when reusing them
+  // (see Clear), in that case the ghosts are placed with the same random
+  // sequence as for a newly created area spec.
+  if (fAreaDef) {
+    if (fGhostedAreaSpec) fGhostedAreaSpec->set_random_status(fGhostRandomStatus);
+  } else if (fAreaType == fj::voronoi_area) {
     // Rfact - check dependence - default is 1.
     // NOTE: hardcoded variable!
     fVorAreaSpec = new fj::VoronoiAreaSpec(1.);
     fAreaDef     = new fj::AreaDefinition(*fVorAreaSpec);
+    fNAllocations += 2;
   } else {
     fGhostedAreaSpec = new fj::GhostedAreaSpec(fMaxRap,
                                                fNGhostRepeats,
@@ -711,18 +802,25 @@ Int_t AliFJWrapper::Run()
                                                fGridScatter,
                                                fKtScatter,
                                                fMeanGhostKt);
+    fGhostedAreaSpec->get_random_status(fGhostRandomStatus);
 
     fAreaDef = new fj::AreaDefinition(*fGhostedAreaSpec, fAreaType);
+    fNAllocations += 2;
   }
 
   // this is acceptable by fastjet:
+  if (!fRange) {
 #ifndef FASTJET_VERSION
-  fRange = new fj::RangeDefinition(fMaxRap - 0.95 * fR);
+    fRange = new fj::RangeDefinition(fMaxRap - 0.95 * fR);
 #else
-  fRange = new fj::Selector(fj::SelectorAbsRapMax(fMaxRap - 0.95 * fR));
+    fRange = new fj::Selector(fj::SelectorAbsRapMax(fMaxRap - 0.95 * fR));
 #endif
+    fNAllocations++;
+  }
 
-  if (fAlgor == fj::plugin_algorithm) {
+  if (fJetDef) {
+    // definitions kept from the previous event
+  } else if (fAlgor == fj::plugin_algorithm) {
     if (fPluginAlgor == 0) {
       // SIS CONE ALGOR
       // NOTE: hardcoded split parameter
@@ -732,6 +830,7 @@ Int_t AliFJWrapper::Run()
                                       0,    //search of stable cones - zero = until no more
                                       1.0); // this should be seed effectively for proto jets
       fJetDef = new fastjet::JetDefinition(fPlugin);
+      fNAllocations += 2;
     } else if (fPluginAlgor == 1) {
       // CDF cone
       // NOTE: hardcoded split parameter
@@ -741,14 +840,18 @@ Int_t AliFJWrapper::Run()
                                       1.0,    //search of stable cones - zero = until no more
                                       1.0); // this should be seed effectively for proto jets
       fJetDef = new fastjet::JetDefinition(fPlugin);
+      fNAllocations += 2;
     } else {
       AliError("[e] Unrecognized plugin number!");
     }
   } else {
     fJetDef = new fj::JetDefinition(fAlgor, fR, fScheme, fStrategy);
+    fNAllocations++;
   }
+  FillDefinitionParams(fDefinitionParams);
 
   try {
+    fNAllocations++;
     fClustSeq = new fj::ClusterSequenceArea(fInputVectors, *fJetDef, *fAreaDef);
     if(fEventSub){
       DoEventConstituentSubtraction();
@@ -762,6 +865,7 @@ Int_t AliFJWrapper::Run()
   // FJ3 :: Define an JetMedianBackgroundEstimator just in case it will be used
 #ifdef FASTJET_VERSION
   fBkrdEstimator     = new fj::JetMedianBackgroundEstimator(fj::SelectorAbsRapMax(fMaxRap));
+  fNAllocations++;
 #endif
 
   if (fLegacyMode) { SetLegacyFJ(); } // for FJ 2.x even if fLegacyMode is set, SetLegacyFJ is dummy
@@ -782,7 +886,7 @@ Int_t AliFJWrapper::Filter()
 //  AliFJWrapper::Filter
 //
 
-  fJetDef = new fj::JetDefinition(fAlgor, fR, fScheme, fStrategy);
+  if (!fJetDef) fJetDef = new fj::JetDefinition(fAlgor, fR, fScheme, fStrategy);
 
   if (fDoFilterArea) {
     if (fInputGhosts.size()>0) {
@@ -0,0 +1,166 @@
+/************************************************************************************
+ * Copyright (C) 2021, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#include <map>
+#include <tuple>
+
+#include <TClonesArray.h>
+#include <TMath.h>
+
+#include "AliAnalysisManager.h"
+#include "AliEmcalJet.h"
+#include "AliJetContainer.h"
+
+#include "AliJetBackgroundEngine.h"
+
+namespace {
+/// Engines of the current event, keyed by jet array, number of jets and cut configuration
+typedef std::map<std::tuple<const TClonesArray *, Int_t, ULong64_t>, AliJetBackgroundEngine> AliJetBackgroundEngineRegistry;
+AliJetBackgroundEngineRegistry gBackgroundEngines;
+Long64_t gBackgroundEnginesEntry = -1;
+}
+
+AliJetBackgroundEngine::AliJetBackgroundEngine() :
+  fAccepted(),
+  fJetRho(),
+  fBuffer()
+{
+  fLeadingIds[0] = fLeadingIds[1] = -1;
+  for (Int_t i = 0; i < 3; i++) {
+    fRho[i] = 0;
+    fRhoDone[i] = kFALSE;
+  }
+}
+
+/**
+ * Get the background engine of a jet container for the current event. The
+ * engine is filled at the first request in the event and shared by all
+ * containers connected to the same jet array with the same cuts.
+ * Without analysis manager the engine is refilled at each call.
+ * @param jets Container of the background (kt) jets
+ * @return Engine with the background quantities of the current event
+ */
+const AliJetBackgroundEngine *AliJetBackgroundEngine::Get(AliJetContainer *jets)
+{
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  if (!mgr) {
+    static AliJetBackgroundEngine engine;
+    engine.Fill(jets);
+    return &engine;
+  }
+
+  Long64_t entry = mgr->GetCurrentEntry();
+  if (entry != gBackgroundEnginesEntry) {
+    gBackgroundEngines.clear();
+    gBackgroundEnginesEntry = entry;
+  }
+
+  auto key = std::make_tuple(static_cast<const TClonesArray *>(jets->GetArray()), jets->GetNEntries(), jets->GetCutConfigHash());
+  auto found = gBackgroundEngines.find(key);
+  if (found != gBackgroundEngines.end()) return &(found->second);
+
+  AliJetBackgroundEngine &engine = gBackgroundEngines[key];
+  engine.Fill(jets);
+  return &engine;
+}
+
+/**
+ * Evaluate the jet selection, the leading jets and the per-jet densities.
+ * @param jets Container of the background jets
+ */
+void AliJetBackgroundEngine::Fill(AliJetContainer *jets)
+{
+  const Int_t njets = jets->GetNEntries();
+  fAccepted.assign(njets, kFALSE);
+  fJetRho.assign(njets, 0.);
+  fLeadingIds[0] = fLeadingIds[1] = -1;
+  for (Int_t i = 0; i < 3; i++) fRhoDone[i] = kFALSE;
+
+  Float_t maxJetPts[] = {0, 0};
+  for (Int_t ij = 0; ij < njets; ++ij) {
+    AliEmcalJet *jet = jets->GetJet(ij);
+    if (!jet) continue;
+    UInt_t rejectionReason = 0;
+    if (!jets->AcceptJet(jet, rejectionReason)) continue;
+    fAccepted[ij] = kTRUE;
+    if (jet->Area() > 0) fJetRho[ij] = jet->Pt() / jet->Area();
+
+    if (jet->Pt() > maxJetPts[0]) {
+      maxJetPts[1] = maxJetPts[0];
+      fLeadingIds[1] = fLeadingIds[0];
+      maxJetPts[0] = jet->Pt();
+      fLeadingIds[0] = ij;
+    } else if (jet->Pt() > maxJetPts[1]) {
+      maxJetPts[1] = jet->Pt();
+      fLeadingIds[1] = ij;
+    }
+  }
+}
+
+/**
+ * Check whether a jet is one of the leading jets excluded from the background.
+ * @param i Index of the jet
+ * @param nExclLeadJets Number of excluded leading jets (at most 2)
+ * @return True if the jet is excluded
+ */
+Bool_t AliJetBackgroundEngine::IsExcludedLeadingJet(Int_t i, UInt_t nExclLeadJets) const
+{
+  if (nExclLeadJets > 0 && i == fLeadingIds[0]) return kTRUE;
+  if (nExclLeadJets > 1 && i == fLeadingIds[1]) return kTRUE;
+  return kFALSE;
+}
+
+/**
+ * @param nExclLeadJets Number of excluded leading jets (at most 2)
+ * @return Number of accepted jets used for the median
+ */
+Int_t AliJetBackgroundEngine::GetNAcceptedJets(UInt_t nExclLeadJets) const
+{
+  Int_t nacc = 0;
+  for (Int_t ij = 0; ij < GetNJets(); ij++) {
+    if (fAccepted[ij] && !IsExcludedLeadingJet(ij, nExclLeadJets)) nacc++;
+  }
+  return nacc;
+}
+
+/**
+ * Median of pt/area of the accepted jets, excluding the leading jets.
+ * @param nExclLeadJets Number of excluded leading jets (at most 2)
+ * @return Background density (0 if no jet is accepted)
+ */
+Double_t AliJetBackgroundEngine::GetRho(UInt_t nExclLeadJets) const
+{
+  const UInt_t iexcl = TMath::Min(nExclLeadJets, 2u);
+  if (fRhoDone[iexcl]) return fRho[iexcl];
+
+  fBuffer.clear();
+  for (Int_t ij = 0; ij < GetNJets(); ij++) {
+    if (fAccepted[ij] && !IsExcludedLeadingJet(ij, iexcl)) fBuffer.push_back(fJetRho[ij]);
+  }
+  fRho[iexcl] = fBuffer.empty() ? 0. : TMath::Median(fBuffer.size(), fBuffer.data());
+  fRhoDone[iexcl] = kTRUE;
+  return fRho[iexcl];
+}
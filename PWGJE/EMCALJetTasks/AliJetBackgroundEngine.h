@@ -0,0 +1,79 @@
+/************************************************************************************
+ * Copyright (C) 2021, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#ifndef ALIJETBACKGROUNDENGINE_H
+#define ALIJETBACKGROUNDENGINE_H
+
+#include <vector>
+#include <Rtypes.h>
+
+class AliJetContainer;
+
+/**
+ * @class AliJetBackgroundEngine
+ * @brief Per-event background quantities of a collection of kt jets, shared between consumers
+ * @ingroup PWGJEBASE
+ * @since Oct 2021
+ *
+ * The jet selection of the background jet container, the two leading accepted
+ * jets and the per-jet densities pt/area are computed once per event and jet
+ * configuration (jet array and cut configuration of the container). All rho
+ * tasks connected to the same kt jets with the same selection then use the
+ * same result instead of looping over the jets again:
+ *
+ * ~~~{.cxx}
+ * const AliJetBackgroundEngine *engine = AliJetBackgroundEngine::Get(GetJetContainer(0));
+ * if (engine->GetNAcceptedJets(fNExclLeadJets) > 0) fOutRho->SetVal(engine->GetRho(fNExclLeadJets));
+ * ~~~
+ *
+ * The engine is valid until the next call of Get for a different event.
+ */
+class AliJetBackgroundEngine {
+ public:
+  AliJetBackgroundEngine();
+  virtual ~AliJetBackgroundEngine() {}
+
+  static const AliJetBackgroundEngine *Get(AliJetContainer *jets);
+
+  Int_t                 GetNJets()                            const { return fAccepted.size(); }
+  Bool_t                IsAccepted(Int_t i)                   const { return i >= 0 && i < GetNJets() && fAccepted[i]; }
+  Int_t                 GetLeadingJetIndex(Int_t i)           const { return i >= 0 && i < 2 ? fLeadingIds[i] : -1; }
+  Bool_t                IsExcludedLeadingJet(Int_t i, UInt_t nExclLeadJets) const;
+  Double_t              GetJetRho(Int_t i)                    const { return fJetRho[i]; }
+  Int_t                 GetNAcceptedJets(UInt_t nExclLeadJets) const;
+  Double_t              GetRho(UInt_t nExclLeadJets)          const;
+
+ protected:
+  void                  Fill(AliJetContainer *jets);
+
+  std::vector<Bool_t>   fAccepted;        ///< jet accepted by the container cuts
+  std::vector<Double_t> fJetRho;          ///< pt/area of each jet (0 for jets without area)
+  Int_t                 fLeadingIds[2];   ///< indices of the two leading accepted jets
+  mutable Double_t      fRho[3];          ///< median for 0, 1 and 2 excluded leading jets
+  mutable Bool_t        fRhoDone[3];      ///< median already computed
+  mutable std::vector<Double_t> fBuffer;  ///< work buffer for the median
+};
+#endif
@@ -86,7 +86,7 @@ void AliAnalysisTaskEmcalEG1Correlation::UserCreateOutputObjects(){
 
 
 void AliAnalysisTaskEmcalEG1Correlation::UserExec(Option_t *){
-  auto triggers = PWG::EMCAL::Triggerinfo::DecodeTriggerString(fInputEvent->GetFiredTriggerClasses().Data());
+  const auto &triggers = PWG::EMCAL::Triggerinfo::FiredTriggerClasses(fInputEvent);
   auto supported = GetSupportedTriggers();
   std::bitset<8> firedTS(0), firedPS(0);
   for(decltype(supported.size()) itrg = 0; itrg < supported.size(); itrg++){
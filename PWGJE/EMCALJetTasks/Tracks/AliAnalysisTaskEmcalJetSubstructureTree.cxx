@@ -63,6 +63,7 @@
 #include "AliJetContainer.h"
 #include "AliEmcalAnalysisFactory.h"
 #include "AliEmcalDownscaleFactorsOCDB.h"
+#include "AliEmcalFiredTriggerClasses.h"
 #include "AliEmcalJet.h"
 #include "AliEmcalList.h"
 #include "AliEmcalTriggerDecisionContainer.h"
@@ -295,8 +296,8 @@ bool AliAnalysisTaskEmcalJetSubstructureTree::Run(){
   if(datajets && !mcjets){
     // decode trigger string in order to determine the trigger clusters
     std::vector<std::string> clusternames;
-    auto triggerinfos = PWG::EMCAL::Triggerinfo::DecodeTriggerString(fInputEvent->GetFiredTriggerClasses().Data());
-    for(auto t : triggerinfos) {
+    const auto &triggerinfos = PWG::EMCAL::Triggerinfo::FiredTriggerClasses(fInputEvent);
+    for(const auto &t : triggerinfos) {
       if(std::find(clusternames.begin(), clusternames.end(), t.Triggercluster()) == clusternames.end()) clusternames.emplace_back(t.Triggercluster());
     }
     bool isCENT = (std::find(clusternames.begin(), clusternames.end(), "CENT") != clusternames.end()),
@@ -496,16 +497,18 @@ void AliAnalysisTaskEmcalJetSubstructureTree::UserExecOnce() {
 
 void AliAnalysisTaskEmcalJetSubstructureTree::FillLuminosity() {
   if(fLumiMonitor && fUseDownscaleWeight){
-    auto downscalefactors = PWG::EMCAL::AliEmcalDownscaleFactorsOCDB::Instance();
+    auto firedclasses = PWG::EMCAL::AliEmcalFiredTriggerClasses::Instance();
     if(fInputEvent->GetFiredTriggerClasses().Contains("INT7")) {
-      for(auto trigger : PWG::EMCAL::Triggerinfo::DecodeTriggerString(fInputEvent->GetFiredTriggerClasses().Data())){
+      const auto &triggers = PWG::EMCAL::Triggerinfo::FiredTriggerClasses(fInputEvent);
+      for(std::size_t itrg = 0; itrg < triggers.size(); itrg++){
+        const auto &trigger = triggers[itrg];
         auto int7trigger = trigger.IsTriggerClass("INT7");
         auto bunchcrossing = trigger.BunchCrossing() == "B";
         auto nopf = trigger.PastFutureProtection() == "NOPF";
         bool centcalo = (trigger.Triggercluster().find("CENT") != std::string::npos) || (trigger.Triggercluster().find("CALO") != std::string::npos);
         AliDebugStream(4) << "Full name: " << trigger.ExpandClassName() << ", INT7 trigger:  " << (int7trigger ? "Yes" : "No") << ", bunch crossing: " << (bunchcrossing ? "Yes" : "No") << ", no past-future protection: " << (nopf ? "Yes" : "No")  << ", Cluster: " << trigger.Triggercluster() << std::endl;
         if(int7trigger && bunchcrossing && nopf && centcalo) {
-          double downscale = downscalefactors->GetDownscaleFactorForTriggerClass(trigger.ExpandClassName());
+          double downscale = firedclasses->GetDownscaleFactor(itrg);
           AliDebugStream(5) << "Using downscale " << downscale << std::endl;
           fLumiMonitor->Fill(trigger.Triggercluster().data(), 1./downscale);
         }
@@ -60,6 +60,9 @@ AliAnalysisTaskEmcalQoverPtShift::AliAnalysisTaskEmcalQoverPtShift(const char *n
   fTriggerBits(0),
   fTriggerString()
 {
+  // Only the track container is used, the event-level quantities are
+  // those needed by the event selection and general histograms
+  SetRequiredEventObjects(0);
 }
 
 AliAnalysisTaskEmcalQoverPtShift::~AliAnalysisTaskEmcalQoverPtShift()
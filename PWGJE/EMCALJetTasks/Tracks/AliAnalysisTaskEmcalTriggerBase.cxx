@@ -223,8 +223,8 @@ void AliAnalysisTaskEmcalTriggerBase::TriggerSelection(){
   // temp hack to overcome missing support for 2018 by the physics selection 
   if(fEnableCentralityTriggers) {
     if(fSelectCentralityTriggers2018) {
-      auto triggers = PWG::EMCAL::Triggerinfo::DecodeTriggerString(fInputEvent->GetFiredTriggerClasses().Data());
-      for(auto t : triggers) {
+      const auto &triggers = PWG::EMCAL::Triggerinfo::FiredTriggerClasses(fInputEvent);
+      for(const auto &t : triggers) {
         if(t.Triggercluster() != "CENT") continue;
         if(t.Triggerclass() == "CV0H7") isCENT = true;
         else if(t.Triggerclass() == "CMID7") isSemiCENT = true;
@@ -291,9 +291,9 @@ void AliAnalysisTaskEmcalTriggerBase::TriggerSelection(){
        triggerstring.Contains("INT7E") || triggerstring.Contains("INT7D")){   // special conditions for 2015 PbPb
       // Apply cut on the trigger string - this basically discriminates high- and low-threshold
       // triggers
-      auto triggers = PWG::EMCAL::Triggerinfo::DecodeTriggerString(fInputEvent->GetFiredTriggerClasses().Data());
+      const auto &triggers = PWG::EMCAL::Triggerinfo::FiredTriggerClasses(fInputEvent);
       std::map<int, std::array<bool, 3>> matchedTriggers;
-      for(auto t : triggers) {  
+      for(const auto &t : triggers) {  
         const auto &triggerclass = t.Triggerclass();
         if((triggerclass.find("EMC") != std::string::npos) || (triggerclass.find("DMC") != std::string::npos) || 
            (triggerclass.find("INT7E") != std::string::npos) || (triggerclass.find("INT7D") != std::string::npos)) 
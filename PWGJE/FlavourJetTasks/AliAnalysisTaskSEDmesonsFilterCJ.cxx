@@ -33,6 +33,10 @@
 #include <TH3F.h>
 #include <TRandom3.h>
 
+#include <algorithm>
+#include <vector>
+
+
 #include "AliLog.h"
 #include "AliRDHFCutsDStartoKpipi.h"
 #include "AliRDHFCutsD0toKpi.h"
@@ -53,6 +57,8 @@
 #include "AliAnalysisVertexingHF.h"
 #include "AliVertexingHFUtils.h"
 #include "AliNormalizationCounter.h"
+#include "AliPicoBase.h"
+#include "AliPicoJetInputs.h"
 #include "AliAnalysisTaskSEDmesonsFilterCJ.h"
 
 ClassImp(AliAnalysisTaskSEDmesonsFilterCJ)
@@ -81,6 +87,7 @@ AliAnalysisTaskSEDmesonsFilterCJ::AliAnalysisTaskSEDmesonsFilterCJ() :
   fRejectQuarkNotFound(kTRUE),
   fRejectDfromB(kTRUE),
   fKeepOnlyDfromB(kFALSE),
+  fFillJetInputs(kFALSE),
   fAodEvent(0),
   fMCHeader(0),
   fCounter(0),
@@ -158,6 +165,7 @@ AliAnalysisTaskSEDmesonsFilterCJ::AliAnalysisTaskSEDmesonsFilterCJ(const char *n
   fRejectQuarkNotFound(kTRUE),
   fRejectDfromB(kTRUE),
   fKeepOnlyDfromB(kFALSE),
+  fFillJetInputs(kFALSE),
   fAodEvent(0),
   fMCHeader(0),
   fCounter(0),
@@ -718,19 +726,18 @@ else {
   AliDebug(2, "Loop done");
 
   if (fCombineDmesons) {
-    if (fCombinedDmesons->GetEntriesFast() > 0) {
-      AddEventTracks(fCombinedDmesons, GetParticleContainer(0));
-    }
+    // one pass over the tracks for the signal and the background collections
+    AddEventTracks(fCombinedDmesons->GetEntriesFast() > 0 ? fCombinedDmesons : 0,
+                   fCombinedDmesonsBkg->GetEntriesFast() > 0 ? fCombinedDmesonsBkg : 0,
+                   GetParticleContainer(0));
 
     if (fMCCombinedDmesons->GetEntriesFast() > 0) {
         AddMCEventTracks(fMCCombinedDmesons, GetParticleContainer(1));
     }
-
-    if (fCombinedDmesonsBkg->GetEntriesFast() > 0) {
-      AddEventTracks(fCombinedDmesonsBkg, GetParticleContainer(0));
-    }
   }
 
+  if (fFillJetInputs) FillJetInputs();
+
   fHistNCandEv->Fill(fCandidateArray->GetEntriesFast());
   if (fCandidateType == kDstartoKpipi || fUseMCInfo) {
     Int_t nsbcand = fSideBandArray->GetEntriesFast();
@@ -1394,51 +1401,97 @@ Float_t AliAnalysisTaskSEDmesonsFilterCJ::DeltaR(AliVParticle *p1, AliVParticle
 }
 
 //_______________________________________________________________________________
-void AliAnalysisTaskSEDmesonsFilterCJ::AddEventTracks(TClonesArray* coll, AliParticleContainer* tracks)
+void AliAnalysisTaskSEDmesonsFilterCJ::AddEventTracks(TClonesArray* coll, TClonesArray* collBkg, AliParticleContainer* tracks)
 {
   //
-  // Add event tracks to a collection that already contains the D candidates, excluding the daughters of the D candidates
+  // Add event tracks to the collections that already contain the D candidates (signal and background),
+  // excluding the daughters of the D candidates of each collection, in one loop over the tracks
   //
 
-  if (!tracks) return;
+  if (!tracks || (!coll && !collBkg)) return;
 
-  TObjArray allDaughters(10);
-  allDaughters.SetOwner(kFALSE);
+  // daughters of the candidates of each collection, sorted for the lookup
+  std::vector<const TObject*> allDaughters[2];
+  TClonesArray* colls[2] = {coll, collBkg};
+  Int_t n[2] = {0, 0};
+  TObjArray daughters(10);
+  daughters.SetOwner(kFALSE);
 
-  TIter next(coll);
-  AliEmcalParticle* emcpart = 0;
-  while ((emcpart = static_cast<AliEmcalParticle*>(next()))) {
-    AliAODRecoDecay* reco = dynamic_cast<AliAODRecoDecay*>(emcpart->GetTrack());
-    AliDebug(2, Form("Found a D meson candidtate with pT = %.3f, eta = %.3f, phi = %.3f", reco->Pt(), reco->Eta(), reco->Phi()));
-    if (reco) AddDaughters(reco, allDaughters);
+  for (Int_t ic = 0; ic < 2; ic++) {
+    if (!colls[ic]) continue;
+    TIter next(colls[ic]);
+    AliEmcalParticle* emcpart = 0;
+    while ((emcpart = static_cast<AliEmcalParticle*>(next()))) {
+      AliAODRecoDecay* reco = dynamic_cast<AliAODRecoDecay*>(emcpart->GetTrack());
+      if (!reco) continue;
+      AliDebug(2, Form("Found a D meson candidtate with pT = %.3f, eta = %.3f, phi = %.3f", reco->Pt(), reco->Eta(), reco->Phi()));
+      daughters.Clear();
+      AddDaughters(reco, daughters);
+      for (Int_t i = 0; i < daughters.GetEntriesFast(); i++) allDaughters[ic].push_back(daughters.At(i));
+    }
+    std::sort(allDaughters[ic].begin(), allDaughters[ic].end());
+    n[ic] = colls[ic]->GetEntriesFast();
   }
 
   tracks->ResetCurrentID();
   AliVTrack* track = 0;
-  Int_t n = coll->GetEntriesFast();
- 
+
   while ((track = static_cast<AliVTrack*>(tracks->GetNextAcceptParticle()))) {
     if(fUseMCInfo && fUsePythia){
           AliAODTrack* aodtrack = dynamic_cast<AliAODTrack*>(track);
           bool isInj = IsTrackInjected(aodtrack, fMCHeader, fMCarray);
           if(!isInj) continue;
     }
-   
-    if (allDaughters.Remove(track) == 0) {
-	if(fUseRejTracks){
-      	   if(fRan->Rndm() < fTrackIneff) continue;
+
+    for (Int_t ic = 0; ic < 2; ic++) {
+      if (!colls[ic]) continue;
+
+      if (!std::binary_search(allDaughters[ic].begin(), allDaughters[ic].end(), static_cast<const TObject*>(track))) {
+        if(fUseRejTracks){
+          if(fRan->Rndm() < fTrackIneff) continue;
         }
 
-      	new ((*coll)[n]) AliEmcalParticle(track);
-      	n++;
-      	AliDebug(2, Form("Track %d (pT = %.3f, eta = %.3f, phi = %.3f) is included", tracks->GetCurrentID(), track->Pt(), track->Eta(), track->Phi()));
-    }
-    else {
-      	AliDebug(2, Form("Track %d (pT = %.3f, eta = %.3f, phi = %.3f) is excluded", tracks->GetCurrentID(), track->Pt(), track->Eta(), track->Phi()));
+        new ((*colls[ic])[n[ic]]) AliEmcalParticle(track);
+        n[ic]++;
+        AliDebug(2, Form("Track %d (pT = %.3f, eta = %.3f, phi = %.3f) is included", tracks->GetCurrentID(), track->Pt(), track->Eta(), track->Phi()));
+      }
+      else {
+        AliDebug(2, Form("Track %d (pT = %.3f, eta = %.3f, phi = %.3f) is excluded", tracks->GetCurrentID(), track->Pt(), track->Eta(), track->Phi()));
+      }
     }
   }
 }
 
+//_______________________________________________________________________________
+void AliAnalysisTaskSEDmesonsFilterCJ::FillJetInputs()
+{
+  //
+  // Publish the selected D candidates with the IDs of their daughter tracks in the
+  // jet constituent replacements of the event, shared with the other filter tasks
+  //
+
+  AliPicoJetInputs* inputs = AliPicoJetInputs::GetInstance(InputEvent());
+  if (!inputs) return;
+
+  const UInt_t type = (fCandidateType == kDstartoKpipi) ? AliPicoBase::kDstar : AliPicoBase::kDzero;
+
+  TObjArray daughters(10);
+  daughters.SetOwner(kFALSE);
+  std::vector<Int_t> ids;
+
+  for (Int_t i = 0; i < fCandidateArray->GetEntriesFast(); i++) {
+    AliAODRecoDecay* reco = dynamic_cast<AliAODRecoDecay*>(fCandidateArray->At(i));
+    if (!reco) continue;
+
+    daughters.Clear();
+    AddDaughters(reco, daughters);
+    ids.clear();
+    for (Int_t j = 0; j < daughters.GetEntriesFast(); j++) ids.push_back(static_cast<AliVTrack*>(daughters.At(j))->GetID());
+
+    inputs->AddCandidate(type, i, reco->Px(), reco->Py(), reco->Pz(), reco->E(fPDGmother), ids.data(), ids.size());
+  }
+}
+
 //_______________________________________________________________________________
 Double_t AliAnalysisTaskSEDmesonsFilterCJ::AddDaughters(AliAODRecoDecay* cand, TObjArray& daughters)
 {
@@ -97,6 +97,9 @@ class AliAnalysisTaskSEDmesonsFilterCJ : public AliAnalysisTaskEmcal
 
   void   SetKeepOnlyDfromB(Bool_t c)       { fKeepOnlyDfromB = c          ; }
   Bool_t GetKeepOnlyDfromB() const         { return fKeepOnlyDfromB       ; }
+
+  void   SetFillJetInputs(Bool_t c=kTRUE)  { fFillJetInputs = c           ; }
+  Bool_t GetFillJetInputs() const          { return fFillJetInputs        ; }
  
   void SetMassLimits(Double_t range, Int_t pdg);
   void SetMassLimits(Double_t lowlimit, Double_t uplimit);
@@ -130,7 +133,8 @@ class AliAnalysisTaskSEDmesonsFilterCJ : public AliAnalysisTaskEmcal
   void FillD0MCTruthKinHistos(AliAODRecoDecayHF2Prong* charmCand, Int_t isSelected, Int_t isD0);
   void FillDStarMCTruthKinHistos(AliAODRecoCascadeHF* dstar, Int_t isSelected, Int_t isDstar);
   void FillDstarSideBands(AliAODRecoCascadeHF* dstar);
-  void AddEventTracks(TClonesArray* coll, AliParticleContainer* tracks);
+  void AddEventTracks(TClonesArray* coll, TClonesArray* collBkg, AliParticleContainer* tracks);
+  void FillJetInputs();
   void AddMCEventTracks(TClonesArray* coll, AliParticleContainer* mctracks);
   
 
@@ -157,6 +161,7 @@ class AliAnalysisTaskSEDmesonsFilterCJ : public AliAnalysisTaskEmcal
   Bool_t          fRejectQuarkNotFound;    //  reject D mesons for which the original charm or bottom quark could not be found (MC)
   Bool_t          fRejectDfromB;           //  reject D mesons coming from a B meson decay (MC)
   Bool_t          fKeepOnlyDfromB;         //  only accept D mesons coming from a B meson decay (MC)
+  Bool_t          fFillJetInputs;          //  publish the selected candidates as jet constituent replacements (AliPicoJetInputs)
   AliAODEvent    *fAodEvent;               //!
   AliAODMCHeader *fMCHeader;		   //!
   AliNormalizationCounter *fCounter;       //! AliNormalizationCounter
@@ -206,7 +211,7 @@ class AliAnalysisTaskSEDmesonsFilterCJ : public AliAnalysisTaskEmcal
   AliAnalysisTaskSEDmesonsFilterCJ(const AliAnalysisTaskSEDmesonsFilterCJ &source);
   AliAnalysisTaskSEDmesonsFilterCJ& operator=(const AliAnalysisTaskSEDmesonsFilterCJ& source); 
 
-  ClassDef(AliAnalysisTaskSEDmesonsFilterCJ, 7); // task for selecting D mesons to be used as an input for D-Jet correlations
+  ClassDef(AliAnalysisTaskSEDmesonsFilterCJ, 8); // task for selecting D mesons to be used as an input for D-Jet correlations
 };
 
 #endif
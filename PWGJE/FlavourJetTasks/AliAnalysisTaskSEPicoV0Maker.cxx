@@ -35,6 +35,8 @@
 #include "AliInputEventHandler.h"
 #include "AliGenDPMjetEventHeader.h"
 
+#include "AliPicoJetInputs.h"
+
 #include "AliAODv0.h"
 #include "AliESDv0.h"
 #include "AliV0vertexer.h"
@@ -69,6 +71,7 @@ fUseMultOld(kFALSE),
 fUseAnaUtils(kFALSE),
 fIsSkipFastOnly(kFALSE),
 fIsRefitV0sESD(kFALSE),
+fIsFillJetInputs(kFALSE),
 fRapidityShift(0.),
 fMultEstDef(""),
 fCutMinMult(0.),
@@ -124,6 +127,7 @@ fUseMultOld(kFALSE),
 fUseAnaUtils(kFALSE),
 fIsSkipFastOnly(kTRUE),
 fIsRefitV0sESD(kFALSE),
+fIsFillJetInputs(kFALSE),
 fRapidityShift(0.),
 fMultEstDef(""),
 fCutMinMult(-99999.),
@@ -309,19 +313,22 @@ void AliAnalysisTaskSEPicoV0Maker::FillPicoV0s()
   if (nV0s<=0) return;
 //=============================================================================
 
-  auto nAt(fPicoV0sClArr->GetEntriesFast());
   auto hKshortPtInvM(static_cast<TH2D*>(fOutputListEH->FindObject("hKshortPtInvM")));
   auto hLambdaPtInvM(static_cast<TH2D*>(fOutputListEH->FindObject("hLambdaPtInvM")));
   auto hAntiLaPtInvM(static_cast<TH2D*>(fOutputListEH->FindObject("hAntiLaPtInvM")));
 //=============================================================================
 
+  // the selected candidates are constructed in place in fPicoV0sClArr
   for (auto iV0=0; iV0<nV0s; ++iV0) {
     AliPicoV0RD *pV0RD(nullptr);
     AliPicoV0MC *pV0MC(nullptr);
+    Int_t idPos(-1), idNeg(-1);
 
     if (fEventAOD) {
       auto pV0(fEventAOD->GetV0(iV0));
       if (!pV0) continue;
+      idPos = pV0->GetPosID();
+      idNeg = pV0->GetNegID();
 
       if (fIsAnaUseMC) {
         pV0MC = SelectV0CandidateMC(pV0);
@@ -333,6 +340,8 @@ void AliAnalysisTaskSEPicoV0Maker::FillPicoV0s()
     if (fEventESD) {
       auto pV0(fEventESD->GetV0(iV0));
       if (!pV0) continue;
+      idPos = pV0->GetPindex();
+      idNeg = pV0->GetNindex();
 
       if (fIsAnaUseMC) {
         pV0MC = SelectV0CandidateMC(pV0);
@@ -346,16 +355,14 @@ void AliAnalysisTaskSEPicoV0Maker::FillPicoV0s()
       pV0RD->FillKshortPtInvM(hKshortPtInvM);
       pV0RD->FillLambdaPtInvM(hLambdaPtInvM);
       pV0RD->FillAntiLaPtInvM(hAntiLaPtInvM);
-      new ((*fPicoV0sClArr)[nAt++]) AliPicoV0RD(*pV0RD);
-      delete pV0RD; pV0RD=nullptr;
+      if (fIsFillJetInputs) FillJetInputs(pV0RD, iV0, idPos, idNeg);
     }
 
     if (pV0MC) {
       pV0MC->FillKshortPtInvM(hKshortPtInvM);
       pV0MC->FillLambdaPtInvM(hLambdaPtInvM);
       pV0MC->FillAntiLaPtInvM(hAntiLaPtInvM);
-      new ((*fPicoV0sClArr)[nAt++]) AliPicoV0MC(*pV0MC);
-      delete pV0MC; pV0MC=nullptr;
+      if (fIsFillJetInputs) FillJetInputs(pV0MC, iV0, idPos, idNeg);
     }
   }
 //=============================================================================
@@ -363,6 +370,38 @@ void AliAnalysisTaskSEPicoV0Maker::FillPicoV0s()
   return;
 }
 
+//_____________________________________________________________________________
+void AliAnalysisTaskSEPicoV0Maker::FillJetInputs(AliPicoV0 const *pV0,
+                                                 Int_t iV0, Int_t idPos, Int_t idNeg)
+{
+//
+//  AliAnalysisTaskSEPicoV0Maker::FillJetInputs
+//
+//  one replacement per accepted hypothesis, shared with the other filter tasks
+//
+
+  auto pInputs(AliPicoJetInputs::GetInstance(InputEvent()));
+  if (!pInputs) return;
+
+  const Int_t ids[2] = { idPos, idNeg };
+  if (pV0->AliPicoV0::IsKshort()) {
+    const auto v(pV0->KineKshort());
+    pInputs->AddCandidate(AliPicoBase::kKshort, iV0, v.Px(), v.Py(), v.Pz(), v.E(), ids, 2);
+  }
+
+  if (pV0->AliPicoV0::IsLambda()) {
+    const auto v(pV0->KineLambda());
+    pInputs->AddCandidate(AliPicoBase::kLambda, iV0, v.Px(), v.Py(), v.Pz(), v.E(), ids, 2);
+  }
+
+  if (pV0->AliPicoV0::IsAntiLa()) {
+    const auto v(pV0->KineAntiLa());
+    pInputs->AddCandidate(AliPicoBase::kAntiLambda, iV0, v.Px(), v.Py(), v.Pz(), v.E(), ids, 2);
+  }
+
+  return;
+}
+
 //_____________________________________________________________________________
 AliPicoV0RD *AliAnalysisTaskSEPicoV0Maker::SelectV0CandidateRD(AliAODv0 const *pV0)
 {
@@ -550,20 +589,21 @@ AliPicoV0RD *AliAnalysisTaskSEPicoV0Maker::SelectV0CandidateRD(AliAODv0 const *p
 
   auto bPosInJC(kFALSE);
   auto bNegInJC(kFALSE);
-  return (new AliPicoV0RD(wMask,
-                          dV0Radius,
-                          dV0CosPA,
-                          dV0DistToPVoverP,
-                          dDausDCA,
-                          dPosDCAtoPV,
-                          dNegDCAtoPV,
-                          dDauXrowsTPC,
-                          dDauXrowsOverFindableClusTPC,
-                          v3Pos.Px(), v3Pos.Py(), v3Pos.Pz(),
-                          v3Neg.Px(), v3Neg.Py(), v3Neg.Pz(),
-                          bPosInJC, bNegInJC,
-                          dPosPionSigmaTPC, dPosProtonSigmaTPC,
-                          dNegPionSigmaTPC, dNegProtonSigmaTPC));
+  const auto nAt(fPicoV0sClArr->GetEntriesFast());
+  return (new ((*fPicoV0sClArr)[nAt]) AliPicoV0RD(wMask,
+                                                  dV0Radius,
+                                                  dV0CosPA,
+                                                  dV0DistToPVoverP,
+                                                  dDausDCA,
+                                                  dPosDCAtoPV,
+                                                  dNegDCAtoPV,
+                                                  dDauXrowsTPC,
+                                                  dDauXrowsOverFindableClusTPC,
+                                                  v3Pos.Px(), v3Pos.Py(), v3Pos.Pz(),
+                                                  v3Neg.Px(), v3Neg.Py(), v3Neg.Pz(),
+                                                  bPosInJC, bNegInJC,
+                                                  dPosPionSigmaTPC, dPosProtonSigmaTPC,
+                                                  dNegPionSigmaTPC, dNegProtonSigmaTPC));
 }
 
 //_____________________________________________________________________________
@@ -776,20 +816,21 @@ AliPicoV0RD *AliAnalysisTaskSEPicoV0Maker::SelectV0CandidateRD(AliESDv0 const *p
   }*/
 //=============================================================================
 
-  return (new AliPicoV0RD(wMask,
-                          dV0Radius,
-                          dV0CosPA,
-                          dV0DistToPVoverP,
-                          dDausDCA,
-                          dPosDCAtoPV,
-                          dNegDCAtoPV,
-                          dDauXrowsTPC,
-                          dDauXrowsOverFindableClusTPC,
-                          v3Pos.Px(), v3Pos.Py(), v3Pos.Pz(),
-                          v3Neg.Px(), v3Neg.Py(), v3Neg.Pz(),
-                          bPosInJC, bNegInJC,
-                          dPosPionSigmaTPC, dPosProtonSigmaTPC,
-                          dNegPionSigmaTPC, dNegProtonSigmaTPC));
+  const auto nAt(fPicoV0sClArr->GetEntriesFast());
+  return (new ((*fPicoV0sClArr)[nAt]) AliPicoV0RD(wMask,
+                                                  dV0Radius,
+                                                  dV0CosPA,
+                                                  dV0DistToPVoverP,
+                                                  dDausDCA,
+                                                  dPosDCAtoPV,
+                                                  dNegDCAtoPV,
+                                                  dDauXrowsTPC,
+                                                  dDauXrowsOverFindableClusTPC,
+                                                  v3Pos.Px(), v3Pos.Py(), v3Pos.Pz(),
+                                                  v3Neg.Px(), v3Neg.Py(), v3Neg.Pz(),
+                                                  bPosInJC, bNegInJC,
+                                                  dPosPionSigmaTPC, dPosProtonSigmaTPC,
+                                                  dNegPionSigmaTPC, dNegProtonSigmaTPC));
 }
 
 //_____________________________________________________________________________
@@ -1017,20 +1058,21 @@ AliPicoV0MC *AliAnalysisTaskSEPicoV0Maker::SelectV0CandidateMC(AliAODv0 const *p
 
   auto bPosInJC(kFALSE);
   auto bNegInJC(kFALSE);
-  return (new AliPicoV0MC(wMask,
-                          dV0Radius,
-                          dV0CosPA,
-                          dV0DistToPVoverP,
-                          dDausDCA,
-                          dPosDCAtoPV,
-                          dNegDCAtoPV,
-                          dDauXrowsTPC,
-                          dDauXrowsOverFindableClusTPC,
-                          v3Pos.Px(), v3Pos.Py(), v3Pos.Pz(),
-                          v3Neg.Px(), v3Neg.Py(), v3Neg.Pz(),
-                          bPosInJC, bNegInJC,
-                          idvMC, wsvMC, pV0MC->Px(), pV0MC->Py(), pV0MC->Pz(), pV0MC->E(),
-                          idmMC, wsmMC, dMotherPt, dMotherEta, dMotherRap));
+  const auto nAt(fPicoV0sClArr->GetEntriesFast());
+  return (new ((*fPicoV0sClArr)[nAt]) AliPicoV0MC(wMask,
+                                                  dV0Radius,
+                                                  dV0CosPA,
+                                                  dV0DistToPVoverP,
+                                                  dDausDCA,
+                                                  dPosDCAtoPV,
+                                                  dNegDCAtoPV,
+                                                  dDauXrowsTPC,
+                                                  dDauXrowsOverFindableClusTPC,
+                                                  v3Pos.Px(), v3Pos.Py(), v3Pos.Pz(),
+                                                  v3Neg.Px(), v3Neg.Py(), v3Neg.Pz(),
+                                                  bPosInJC, bNegInJC,
+                                                  idvMC, wsvMC, pV0MC->Px(), pV0MC->Py(), pV0MC->Pz(), pV0MC->E(),
+                                                  idmMC, wsmMC, dMotherPt, dMotherEta, dMotherRap));
 }
 
 //_____________________________________________________________________________
@@ -1276,20 +1318,21 @@ AliPicoV0MC *AliAnalysisTaskSEPicoV0Maker::SelectV0CandidateMC(AliESDv0 const *p
 
   auto bPosInJC(kFALSE);
   auto bNegInJC(kFALSE);
-  return (new AliPicoV0MC(wMask,
-                          dV0Radius,
-                          dV0CosPA,
-                          dV0DistToPVoverP,
-                          dDausDCA,
-                          dPosDCAtoPV,
-                          dNegDCAtoPV,
-                          dDauXrowsTPC,
-                          dDauXrowsOverFindableClusTPC,
-                          v3Pos.Px(), v3Pos.Py(), v3Pos.Pz(),
-                          v3Neg.Px(), v3Neg.Py(), v3Neg.Pz(),
-                          bPosInJC, bNegInJC,
-                          idvMC, wsvMC, pV0MC->Px(), pV0MC->Py(), pV0MC->Pz(), pV0MC->Energy(),
-                          idmMC, wsmMC, dMotherPt, dMotherEta, dMotherRap));
+  const auto nAt(fPicoV0sClArr->GetEntriesFast());
+  return (new ((*fPicoV0sClArr)[nAt]) AliPicoV0MC(wMask,
+                                                  dV0Radius,
+                                                  dV0CosPA,
+                                                  dV0DistToPVoverP,
+                                                  dDausDCA,
+                                                  dPosDCAtoPV,
+                                                  dNegDCAtoPV,
+                                                  dDauXrowsTPC,
+                                                  dDauXrowsOverFindableClusTPC,
+                                                  v3Pos.Px(), v3Pos.Py(), v3Pos.Pz(),
+                                                  v3Neg.Px(), v3Neg.Py(), v3Neg.Pz(),
+                                                  bPosInJC, bNegInJC,
+                                                  idvMC, wsvMC, pV0MC->Px(), pV0MC->Py(), pV0MC->Pz(), pV0MC->Energy(),
+                                                  idmMC, wsmMC, dMotherPt, dMotherEta, dMotherRap));
 }
 
 //_____________________________________________________________________________
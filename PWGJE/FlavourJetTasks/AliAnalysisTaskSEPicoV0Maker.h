@@ -20,6 +20,7 @@ class AliESDv0;
 class AliAODEvent;
 class AliESDEvent;
 class AliPIDResponse;
+class AliPicoV0;
 class AliPicoV0RD;
 class AliPicoV0MC;
 
@@ -62,6 +63,7 @@ class AliAnalysisTaskSEPicoV0Maker : public AliAnalysisTaskSE {
 
   void SetSkipFastOnly() { fIsSkipFastOnly = kTRUE; }
   void SetRefitV0ESD()   { fIsRefitV0sESD  = kTRUE; }
+  void SetFillJetInputs() { fIsFillJetInputs = kTRUE; }
   void SetDMPjetMC()     { fIsDPMjetMC     = kTRUE; }
 //=============================================================================
 
@@ -79,6 +81,7 @@ class AliAnalysisTaskSEPicoV0Maker : public AliAnalysisTaskSE {
 //=============================================================================
 
   void FillPicoV0s();
+  void FillJetInputs(AliPicoV0 const *pV0, Int_t iV0, Int_t idPos, Int_t idNeg);
 
   AliPicoV0RD *SelectV0CandidateRD(AliAODv0 const *pV0);
   AliPicoV0RD *SelectV0CandidateRD(AliESDv0 const *pV0);
@@ -114,6 +117,7 @@ class AliAnalysisTaskSEPicoV0Maker : public AliAnalysisTaskSE {
 
   Bool_t fIsSkipFastOnly; //
   Bool_t fIsRefitV0sESD;  //
+  Bool_t fIsFillJetInputs;  // publish the V0s as jet constituent replacements (AliPicoJetInputs)
 //=============================================================================
 
   Double_t fRapidityShift;  //
@@ -169,7 +173,7 @@ class AliAnalysisTaskSEPicoV0Maker : public AliAnalysisTaskSE {
   TList *fOutputListMC;  //!
 //=============================================================================
 
-  ClassDef(AliAnalysisTaskSEPicoV0Maker, 6)
+  ClassDef(AliAnalysisTaskSEPicoV0Maker, 7)
 };
 
 #endif
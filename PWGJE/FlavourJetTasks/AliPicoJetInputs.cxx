@@ -0,0 +1,143 @@
+#include <algorithm>
+
+#include "AliVEvent.h"
+#include "AliAnalysisManager.h"
+
+#include "AliPicoJetInputs.h"
+
+ClassImp(AliPicoJetInputs)
+
+//_____________________________________________________________________________
+AliPicoJetInputs::AliPicoJetInputs(const char *s) :
+TNamed(s, ""),
+fType(),
+fSource(),
+fPx(),
+fPy(),
+fPz(),
+fE(),
+fDauBegin(1, 0),
+fDauIDs(),
+fSorted(),
+fIsSorted(kTRUE),
+fEntry(-1)
+{
+//
+// AliPicoJetInputs::AliPicoJetInputs
+//
+}
+
+//_____________________________________________________________________________
+AliPicoJetInputs *AliPicoJetInputs::GetInstance(AliVEvent *pEvent, const char *s)
+{
+//
+// AliPicoJetInputs::GetInstance
+//
+// Buffer shared by the producers of the train, owned by the input event
+// and cleared at the first access in every event
+//
+
+  if (!pEvent) return nullptr;
+
+  AliPicoJetInputs *pInputs = dynamic_cast<AliPicoJetInputs*>(pEvent->FindListObject(s));
+
+  if (!pInputs) {
+    pInputs = new AliPicoJetInputs(s);
+    pEvent->AddObject(pInputs);
+  }
+
+  AliAnalysisManager *pMgr(AliAnalysisManager::GetAnalysisManager());
+  const Long64_t kEntry(pMgr ? pMgr->GetCurrentEntry() : -1);
+  if ((kEntry<0) || (kEntry!=pInputs->fEntry)) {
+    pInputs->Clear();
+    pInputs->fEntry = kEntry;
+  }
+
+  return pInputs;
+}
+
+//_____________________________________________________________________________
+void AliPicoJetInputs::Clear(Option_t *opt)
+{
+//
+// AliPicoJetInputs::Clear
+//
+// The capacity of the arrays is kept for the next event
+//
+
+  fType.clear();
+  fSource.clear();
+  fPx.clear();
+  fPy.clear();
+  fPz.clear();
+  fE.clear();
+  fDauBegin.resize(1);
+  fDauIDs.clear();
+
+  fSorted.clear();
+  fIsSorted = kTRUE;
+
+  TNamed::Clear(opt);
+  return;
+}
+
+//_____________________________________________________________________________
+Int_t AliPicoJetInputs::AddCandidate(UInt_t wType, Int_t iSource,
+                                     Double_t dPx, Double_t dPy, Double_t dPz, Double_t dE,
+                                     const Int_t *pIDs, Int_t nIDs)
+{
+//
+// AliPicoJetInputs::AddCandidate
+//
+
+  fType.push_back(wType);
+  fSource.push_back(iSource);
+  fPx.push_back(dPx);
+  fPy.push_back(dPy);
+  fPz.push_back(dPz);
+  fE.push_back(dE);
+
+  for (Int_t i=0; i<nIDs; ++i) fDauIDs.push_back(pIDs[i]);
+  fDauBegin.push_back(fDauIDs.size());
+
+  fIsSorted = kFALSE;
+  return (fType.size() - 1);
+}
+
+//_____________________________________________________________________________
+UInt_t AliPicoJetInputs::IsDaughter(Int_t id, UInt_t wMask) const
+{
+//
+// AliPicoJetInputs::IsDaughter
+//
+// Types of the candidates, restricted to wMask, the track is a daughter of
+//
+
+  if (!fIsSorted) SortDaughters();
+
+  UInt_t wType(0);
+  auto p = std::lower_bound(fSorted.begin(), fSorted.end(), std::make_pair(id,0U));
+  for (; (p!=fSorted.end()) && (p->first==id); ++p) wType |= p->second;
+
+  return (wType & wMask);
+}
+
+//_____________________________________________________________________________
+void AliPicoJetInputs::SortDaughters() const
+{
+//
+// AliPicoJetInputs::SortDaughters
+//
+
+  fSorted.clear();
+  fSorted.reserve(fDauIDs.size());
+
+  for (UInt_t i=0; i<fType.size(); ++i) {
+    for (Int_t j=fDauBegin[i]; j<fDauBegin[i+1]; ++j) fSorted.emplace_back(fDauIDs[j], fType[i]);
+  }
+
+  std::sort(fSorted.begin(), fSorted.end());
+
+  fIsSorted = kTRUE;
+  return;
+}
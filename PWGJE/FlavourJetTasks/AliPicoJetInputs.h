@@ -0,0 +1,79 @@
+#ifndef ALIPICOJETINPUTS_H
+#define ALIPICOJETINPUTS_H
+
+//
+// Jet constituent replacements of the event: D-meson and V0 candidates
+// which replace their daughter tracks in the jet finding.
+//
+// The candidates are filled by AliAnalysisTaskSEDmesonsFilterCJ and
+// AliAnalysisTaskSEPicoV0Maker into one buffer published in the input
+// event (see GetInstance), stored as flat arrays: the kinematics of the
+// candidates, the candidate type (AliPicoBase particle bits) and the IDs
+// of the daughter tracks, together with a sorted daughter-ID lookup for
+// the removal of the daughters from the track input.
+//
+
+#include <vector>
+
+#include <TNamed.h>
+
+class AliVEvent;
+
+class AliPicoJetInputs : public TNamed {
+
+ public :
+
+  AliPicoJetInputs(const char *s="PicoJetInputs");
+  virtual ~AliPicoJetInputs() {}
+//=============================================================================
+
+  static AliPicoJetInputs *GetInstance(AliVEvent *pEvent,
+                                       const char *s="PicoJetInputs");
+
+  virtual void Clear(Option_t *opt="");
+  Int_t AddCandidate(UInt_t wType, Int_t iSource,
+                     Double_t dPx, Double_t dPy, Double_t dPz, Double_t dE,
+                     const Int_t *pIDs, Int_t nIDs);
+//=============================================================================
+
+  Int_t GetEntriesFast() const { return fType.size(); }
+
+  UInt_t   Type(Int_t i)   const { return fType[i];   }
+  Int_t    Source(Int_t i) const { return fSource[i]; }
+  Double_t Px(Int_t i)     const { return fPx[i];     }
+  Double_t Py(Int_t i)     const { return fPy[i];     }
+  Double_t Pz(Int_t i)     const { return fPz[i];     }
+  Double_t E(Int_t i)      const { return fE[i];      }
+
+  Int_t GetNDaughters(Int_t i) const { return fDauBegin[i+1] - fDauBegin[i]; }
+  const Int_t *GetDaughterIDs(Int_t i) const { return fDauIDs.data() + fDauBegin[i]; }
+
+  UInt_t IsDaughter(Int_t id, UInt_t wMask=~0U) const;
+//=============================================================================
+
+ private :
+
+  AliPicoJetInputs(const AliPicoJetInputs &src);
+  AliPicoJetInputs& operator=(const AliPicoJetInputs &src);
+
+  void SortDaughters() const;
+
+  std::vector<UInt_t>   fType;      //! candidate type, AliPicoBase particle bits
+  std::vector<Int_t>    fSource;    //! index of the candidate in its producer array
+  std::vector<Double_t> fPx;        //! candidate momentum
+  std::vector<Double_t> fPy;        //!
+  std::vector<Double_t> fPz;        //!
+  std::vector<Double_t> fE;         //! candidate energy
+  std::vector<Int_t>    fDauBegin;  //! offsets of the daughters in fDauIDs
+  std::vector<Int_t>    fDauIDs;    //! daughter track IDs of all the candidates
+
+  mutable std::vector<std::pair<Int_t,UInt_t> > fSorted;  //! daughter IDs with the types of their candidates, sorted
+  mutable Bool_t fIsSorted;  //!
+
+  Long64_t fEntry;  //! event the buffer was filled for
+//=============================================================================
+
+  ClassDef(AliPicoJetInputs, 1);
+};
+
+#endif
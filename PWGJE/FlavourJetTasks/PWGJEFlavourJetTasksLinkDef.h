@@ -10,6 +10,7 @@
 #pragma link C++ class AliPicoJet+;
 #pragma link C++ class AliPicoHeaderJet+;
 #pragma link C++ class AliPicoHeaderV0+;
+#pragma link C++ class AliPicoJetInputs+;
 #pragma link C++ class AliPicoBase+;
 #pragma link C++ class AliPicoV0+;
 #pragma link C++ class AliPicoV0MC+;
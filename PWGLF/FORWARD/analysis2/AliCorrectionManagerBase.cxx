@@ -26,7 +26,8 @@ AliCorrectionManagerBase::AliCorrectionManagerBase()
     fSatellite(false), 
     fDB(0),
     fDebug(false),
-    fFallBack(false)
+    fFallBack(false),
+    fLazy(false)
 {
 }
 
@@ -42,7 +43,8 @@ AliCorrectionManagerBase::AliCorrectionManagerBase(Bool_t)
     fSatellite(false), 
     fDB(0),
     fDebug(false),
-    fFallBack(false)
+    fFallBack(false),
+    fLazy(false)
 {
   fCorrections.SetOwner(false);
   fCorrections.SetName("corrections");
@@ -61,7 +63,8 @@ AliCorrectionManagerBase::AliCorrectionManagerBase(const
     fSatellite(o.fSatellite), 
     fDB(o.fDB),
     fDebug(o.fDebug),
-    fFallBack(o.fFallBack)
+    fFallBack(o.fFallBack),
+    fLazy(o.fLazy)
 {
   fCorrections.SetOwner(false);
   Int_t n = o.fCorrections.GetEntriesFast();
@@ -85,6 +88,7 @@ AliCorrectionManagerBase::operator=(const AliCorrectionManagerBase& o)
   fDB		= o.fDB;
   fDebug        = o.fDebug;
   fFallBack     = o.fFallBack;
+  fLazy         = o.fLazy;
 
   fCorrections.Clear();
   Int_t n = o.fCorrections.GetEntriesFast();
@@ -119,6 +123,7 @@ AliCorrectionManagerBase::Print(Option_t* option) const
   AliForwardUtil::PrintTask(*this);
   gROOT->IncreaseDirLevel();
   PFB("Initialized", fIsInit);
+  PFB("Lazy loading", fLazy);
   if (fIsInit) {
     PFV("Run number", fRun);
     PFV("Collision system", AliForwardUtil::CollisionSystemString(fSys));
@@ -264,6 +269,7 @@ AliCorrectionManagerBase::CheckCorrections(UInt_t what, Bool_t verbose) const
 	AliWarningF("No correction registered for bit %d", i);
       continue;
     }
+    ReadPending(i);
     const TObject* o = c->Get();
     if (!o) { 
       ret = false;
@@ -378,6 +384,7 @@ AliCorrectionManagerBase::Get(Int_t id)
     AliWarningF("Cannot find correction with id %d", id);
     return 0;
   }
+  ReadPending(id);
   return c->Get();
 }
 //____________________________________________________________________
@@ -389,9 +396,44 @@ AliCorrectionManagerBase::Get(Int_t id) const
     AliWarningF("Cannot find correction with id %d", id);
     return 0;
   }
+  ReadPending(id);
   return c->Get();
 }
 
+//____________________________________________________________________
+Bool_t
+AliCorrectionManagerBase::ReadPending(Int_t id) const
+{
+  Correction* c = const_cast<Correction*>(GetCorrection(id));
+  if (!c || !c->fPending) return true;
+
+  c->fPending = false;
+  if (!fDB) fDB = new AliOADBForward;
+  Bool_t ret = c->ReadIt(fDB, fRun, fSys, fSNN, fField, fMC, fSatellite, 
+			 fDebug, fFallBack);
+  if (!ret) 
+    AliWarningF("Failed to read deferred correction %s", c->GetName());
+
+  // Close the database once nothing more is to be read 
+  if (!HasPending()) { 
+    delete fDB;
+    fDB = 0;
+  }
+  return ret;
+}
+
+//____________________________________________________________________
+Bool_t
+AliCorrectionManagerBase::HasPending() const
+{
+  Int_t n = fCorrections.GetEntriesFast();
+  for (Int_t id = 0; id < n; id++) { 
+    const Correction* c = GetCorrection(id);
+    if (c && c->fPending) return true;
+  }
+  return false;
+}
+
 //____________________________________________________________________
 Bool_t
 AliCorrectionManagerBase::InitCorrections(ULong_t    run, 
@@ -407,7 +449,8 @@ AliCorrectionManagerBase::InitCorrections(ULong_t    run,
   if (!ReadCorrections(run, sys, sNN, fld, mc, sat)) return false;
   fIsInit = true;
 
-  if (fDB) {
+  // Deferred corrections still need the database 
+  if (fDB && !HasPending()) {
     delete fDB;
     fDB = 0;
   }
@@ -493,7 +536,15 @@ AliCorrectionManagerBase::ReadCorrection(Int_t      id,
   }
 
   Correction* c = GetCorrection(id);
+  c->fPending = false;
   if (!c->fEnabled) return true;
+  if (fLazy) { 
+    // Read on first access, with the conditions cached by
+    // ReadCorrections
+    c->fObject  = 0;
+    c->fPending = true;
+    return true;
+  }
   return c->ReadIt(fDB, run, sys, sNN, fld, mc, sat, fDebug, fFallBack);
 }
 
@@ -544,7 +595,8 @@ AliCorrectionManagerBase::Correction::Correction()
     fQueryFields(0), 
     fEnabled(false), 
     fLastEntry(),
-    fObject(0)
+    fObject(0),
+    fPending(false)
 {}
 
 //____________________________________________________________________
@@ -559,7 +611,8 @@ AliCorrectionManagerBase::Correction::Correction(const TString& tableName,
     fQueryFields(fields), 
     fEnabled(enabled), 
     fLastEntry(""),
-    fObject(0)
+    fObject(0),
+    fPending(false)
 {}
 
 //____________________________________________________________________
@@ -570,7 +623,8 @@ AliCorrectionManagerBase::Correction::Correction(const Correction& o)
     fQueryFields(o.fQueryFields),
     fEnabled(o.fEnabled), 
     fLastEntry(o.fLastEntry),
-    fObject(o.fObject)
+    fObject(o.fObject),
+    fPending(o.fPending)
 {}
 
 //____________________________________________________________________
@@ -586,6 +640,7 @@ AliCorrectionManagerBase::Correction::operator=(const Correction& o)
   fEnabled   	   = o.fEnabled;
   fLastEntry 	   = o.fLastEntry;
   fObject    	   = o.fObject;
+  fPending   	   = o.fPending;
   return *this;
 }
 
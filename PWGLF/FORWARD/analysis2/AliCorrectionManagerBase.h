@@ -110,6 +110,16 @@ public:
    * @param use If true, enable fall-back queries 
    */
   virtual void SetEnableFallBack(Bool_t use=true) { fFallBack = use; }
+  /** 
+   * Set whether to read the corrections on first access.  If
+   * enabled, InitCorrections only records the conditions, and each
+   * enabled correction is read from the database the first time it
+   * is retrieved (or checked).  Corrections that are enabled but
+   * never used are then never read.
+   * 
+   * @param lazy If true, defer reading to first access 
+   */
+  virtual void SetLazyLoading(Bool_t lazy=true) { fLazy = lazy; }
 
   /** 
    * @{ 
@@ -474,7 +484,8 @@ public:
     Bool_t   fEnabled;   // Whether we're in use 
     TString  fLastEntry; // Text representation of last entry
     TObject* fObject;    // The data 
-    ClassDef(Correction,1) // Correction meta object
+    Bool_t   fPending;   //! Read deferred to first access
+    ClassDef(Correction,2) // Correction meta object
   };
   const char* GetObjectName(Int_t what) const;
 
@@ -584,6 +595,21 @@ protected:
    * @return Object of correction, or null if correction not found or in-active
    */
   const TObject* Get(Int_t id) const;
+  /** 
+   * If the read of correction @a id was deferred, read it now with
+   * the conditions given to InitCorrections
+   * 
+   * @param id Correction identifier 
+   * 
+   * @return true on success, or if nothing was pending
+   */
+  Bool_t ReadPending(Int_t id) const;
+  /** 
+   * Check if the read of any correction is still deferred 
+   * 
+   * @return true if at least one correction is pending
+   */
+  Bool_t HasPending() const;
   /** 
    * Read in all corrections 
    * 
@@ -656,10 +682,11 @@ protected:
   Short_t         fField;       // Cached L3 magnetic field [kG]
   Bool_t          fMC;          // Cached Simulation flag
   Bool_t          fSatellite;   // Cached satellite interaction flat
-  AliOADBForward* fDB;          //! do not store 
+  mutable AliOADBForward* fDB;  //! do not store 
   Bool_t          fDebug;       // If true, do verbose queries 
   Bool_t          fFallBack;    // If true, enable fall-back queries 
-  ClassDef(AliCorrectionManagerBase,2);
+  Bool_t          fLazy;        // If true, read corrections on first access
+  ClassDef(AliCorrectionManagerBase,3);
 };
 
 #endif
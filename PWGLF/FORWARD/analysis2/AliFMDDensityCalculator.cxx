@@ -60,7 +60,10 @@ AliFMDDensityCalculator::AliFMDDensityCalculator()
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fBinCuts(0),
+    fBinMaxWeights(0),
+    fBinFits()
 {
   // 
   // Constructor 
@@ -98,7 +101,10 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const char* title)
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fBinCuts(0),
+    fBinMaxWeights(0),
+    fBinFits()
 {
   // 
   // Constructor 
@@ -167,7 +173,10 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const
     fDoTiming(o.fDoTiming),
     fHTiming(o.fHTiming), 
   fMaxOutliers(o.fMaxOutliers),
-  fOutlierCut(o.fOutlierCut)
+  fOutlierCut(o.fOutlierCut),
+  fBinCuts(o.fBinCuts),
+  fBinMaxWeights(o.fBinMaxWeights),
+  fBinFits(o.fBinFits)
 {
   // 
   // Copy constructor 
@@ -232,6 +241,9 @@ AliFMDDensityCalculator::operator=(const AliFMDDensityCalculator& o)
   fHTiming            = o.fHTiming;
   fMaxOutliers        = o.fMaxOutliers;
   fOutlierCut         = o.fOutlierCut;
+  fBinCuts            = o.fBinCuts;
+  fBinMaxWeights      = o.fBinMaxWeights;
+  fBinFits            = o.fBinFits;
 
   fRingHistos.Delete();
   TIter    next(&o.fRingHistos);
@@ -488,15 +500,19 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 	    mult *= AcceptanceCorrection(r,t);
 
 	  // --- Get the low multiplicity cut ------------------------
+	  // The eta bin is looked up once, and used for both the cut
+	  // and the energy loss fit
+	  Int_t    iEta = fLowCuts->GetXaxis()->FindBin(eta);
 	  Double_t cut  = 1024;
-	  if (eta != AliESDFMD::kInvalidEta) cut = GetMultCut(d, r, eta,false);
+	  if (eta != AliESDFMD::kInvalidEta) cut = GetBinCut(d, r, iEta);
 	  else AliWarningF("Eta for FMD%d%c[%02d,%03d] is invalid: %f", 
 			   d, r, s, t, eta);
 
 	  // --- Now caluculate Nch for this strip using fits --------
 	  START_TIMER(timer);
 	  Double_t n   = 0;
-	  if (cut > 0 && mult > cut) n = NParticles(mult,d,r,eta,lowFlux);
+	  if (cut > 0 && mult > cut) 
+	    n = NParticlesInBin(mult,d,r,eta,iEta,lowFlux);
 	  rh->fELoss->Fill(mult);
 	  // rh->fEvsN->Fill(mult,n);
 	  // rh->fEtaVsN->Fill(eta, n);
@@ -771,6 +787,52 @@ AliFMDDensityCalculator::CacheMaxWeights(const TAxis& axis)
 
   // Cache cuts in histogram
   fCuts.FillHistogram(fLowCuts);
+
+  // Expand the cuts, fits, and max weights to flat per ring and eta
+  // bin arrays, so that the strip loop only does one eta bin look-up
+  // per strip.  The bins include the under- and overflow bins of
+  // fLowCuts, which have no fits.
+  Int_t nBins = nEta + 2;
+  fBinCuts.Set(5 * nBins);
+  fBinMaxWeights.Set(5 * nBins);
+  fBinFits.Clear();
+  fBinFits.Expand(5 * nBins);
+  for (UShort_t d = 1; d <= 3; d++) { 
+    UShort_t nr = (d == 1 ? 1 : 2);
+    for (UShort_t q = 0; q < nr; q++) { 
+      Char_t r = (q == 0 ? 'I' : 'O');
+      for (Int_t b = 0; b < nBins; b++) { 
+	Int_t    idx = BinIndex(d, r, b);
+	Bool_t   in  = (b >= 1 && b <= nEta);
+	fBinCuts[idx]       = Rng2Cut(d, r, b, fLowCuts);
+	fBinMaxWeights[idx] = (in ? GetMaxWeight(d, r, b-1) : -1);
+	fBinFits.AddAt(in ? cor->FindFit(d, r, b, -1) : 0, idx);
+      }
+    }
+  }
+}
+
+//_____________________________________________________________________
+Int_t
+AliFMDDensityCalculator::BinIndex(UShort_t d, Char_t r, Int_t iEta) const
+{
+  // 
+  // Index into the flat per ring and eta bin arrays 
+  // 
+  Int_t ring = (d == 1 ? 0 : 2 * d - (r == 'I' || r == 'i' ? 3 : 2));
+  return ring * (fBinCuts.fN / 5) + iEta;
+}
+
+//_____________________________________________________________________
+Double_t
+AliFMDDensityCalculator::GetBinCut(UShort_t d, Char_t r, Int_t iEta) const
+{
+  // 
+  // Get the (cached) low cut for FMD<i>dr</i> in bin @a iEta of the
+  // low cut histogram
+  // 
+  if (fBinCuts.fN <= 0) return GetMultCut(d, r, iEta, false);
+  return fBinCuts.fArray[BinIndex(d, r, iEta)];
 }
 
 //_____________________________________________________________________
@@ -865,13 +927,63 @@ AliFMDDensityCalculator::NParticles(Float_t  mult,
   
   AliForwardCorrectionManager&  fcm = AliForwardCorrectionManager::Instance();
   AliFMDCorrELossFit::ELossFit* fit = fcm.GetELossFit()->FindFit(d,r,eta, -1);
+  Int_t                         m   = (fit ? GetMaxWeight(d,r,eta) : -1);
+
+  return WeightedNParticles(mult, d, r, eta, fit, m);
+}
+
+//_____________________________________________________________________
+Float_t 
+AliFMDDensityCalculator::NParticlesInBin(Float_t  mult, 
+					 UShort_t d, 
+					 Char_t   r, 
+					 Float_t  eta,
+					 Int_t    iEta,
+					 Bool_t   lowFlux) const
+{
+  // 
+  // As NParticles, but with the fit and max weight taken from the
+  // per eta bin cache filled by CacheMaxWeights. 
+  // 
+  // Parameters:
+  //    mult     Signal
+  //    d        Detector
+  //    r        Ring 
+  //    eta      Pseudo-rapidity 
+  //    iEta     Bin of eta in the low cut histogram 
+  //    lowFlux  Low-flux flag 
+  // 
+  // Return:
+  //    The number of particles 
+  //
+  if (fBinCuts.fN <= 0) return NParticles(mult, d, r, eta, lowFlux);
+  DGUARD(fDebug, 3, "Calculate Nch in FMD density calculator");
+  if (lowFlux) return 1;
+
+  Int_t                         idx = BinIndex(d, r, iEta);
+  AliFMDCorrELossFit::ELossFit* fit = 
+    static_cast<AliFMDCorrELossFit::ELossFit*>(fBinFits.UncheckedAt(idx));
+  return WeightedNParticles(mult, d, r, eta, fit, fBinMaxWeights.fArray[idx]);
+}
+
+//_____________________________________________________________________
+Float_t 
+AliFMDDensityCalculator::WeightedNParticles(Float_t  mult, 
+					    UShort_t d, 
+					    Char_t   r, 
+					    Float_t  eta,
+					    AliFMDCorrELossFit::ELossFit* fit,
+					    Int_t    m) const
+{
+  // 
+  // Evaluate the weighted number of particles from the fit 
+  // 
   if (!fit) { 
     AliWarning(Form("No energy loss fit for FMD%d%c at eta=%f qual=%d", 
 		    d, r, eta, fMinQuality));
     return 0;
   }
   
-  Int_t    m   = GetMaxWeight(d,r,eta); // fit->FindMaxWeight();
   if (m < 1) { 
     AliWarning(Form("No good fits for FMD%d%c at eta=%f", d, r, eta));
     return 0;
@@ -16,15 +16,17 @@
 #include <TNamed.h>
 #include <TList.h>
 #include <TArrayI.h>
+#include <TArrayD.h>
+#include <TObjArray.h>
 #include <TVector3.h>
 #include "AliForwardUtil.h"
 #include "AliFMDMultCuts.h"
 #include "AliPoissonCalculator.h"
+#include "AliFMDCorrELossFit.h"
 class AliESDFMD;
 class TH2D;
 class TH1D;
 class TProfile;
-class AliFMDCorrELossFit;
 
 /** 
  * This class calculates the inclusive charged particle density
@@ -319,6 +321,28 @@ protected:
    * @return max weight or <= 0 in case of problems 
    */
   Int_t GetMaxWeight(UShort_t d, Char_t r, Float_t eta) const;
+  /** 
+   * Index of FMD<i>dr</i> and bin @a iEta of the low cut histogram
+   * in the arrays cached by CacheMaxWeights
+   * 
+   * @param d     Detector
+   * @param r     Ring
+   * @param iEta  Eta bin, including under- and overflow 
+   * 
+   * @return Index 
+   */
+  Int_t BinIndex(UShort_t d, Char_t r, Int_t iEta) const;
+  /** 
+   * Get the (cached) low cut for FMD<i>dr</i> in bin @a iEta of the
+   * low cut histogram
+   * 
+   * @param d     Detector
+   * @param r     Ring
+   * @param iEta  Eta bin, including under- and overflow 
+   * 
+   * @return Low cut 
+   */
+  Double_t GetBinCut(UShort_t d, Char_t r, Int_t iEta) const;
 
   /** 
    * Get the number of particles corresponding to the signal mult
@@ -336,6 +360,44 @@ protected:
 			     Char_t   r, 
 			     Float_t  eta, 
 			     Bool_t   lowFlux) const;
+  /** 
+   * Get the number of particles corresponding to the signal mult,
+   * using the fit and maximum weight cached by CacheMaxWeights for
+   * the bin @a iEta of the low cut histogram. 
+   * 
+   * @param mult     Signal
+   * @param d        Detector
+   * @param r        Ring 
+   * @param eta      Pseudo-rapidity 
+   * @param iEta     Bin of @a eta in the low cut histogram
+   * @param lowFlux  Low-flux flag 
+   * 
+   * @return The number of particles 
+   */
+  Float_t NParticlesInBin(Float_t  mult, 
+			  UShort_t d, 
+			  Char_t   r, 
+			  Float_t  eta, 
+			  Int_t    iEta,
+			  Bool_t   lowFlux) const;
+  /** 
+   * Evaluate the weighted number of particles for a signal 
+   * 
+   * @param mult  Signal
+   * @param d     Detector
+   * @param r     Ring 
+   * @param eta   Pseudo-rapidity 
+   * @param fit   Energy loss fit, or null 
+   * @param m     Maximum weight 
+   * 
+   * @return The number of particles 
+   */
+  Float_t WeightedNParticles(Float_t  mult, 
+			     UShort_t d, 
+			     Char_t   r, 
+			     Float_t  eta, 
+			     AliFMDCorrELossFit::ELossFit* fit,
+			     Int_t    m) const;
   /** 
    * Get the inverse correction factor.  This consist of
    * 
@@ -504,8 +566,11 @@ protected:
   TProfile*              fHTiming;
   Double_t               fMaxOutliers; // Maximum ratio of outlier bins 
   Double_t               fOutlierCut;  // Maximum relative diviation 
+  TArrayD                fBinCuts;     //! Low cut per ring and eta bin
+  TArrayI                fBinMaxWeights; //! Max weight per ring and eta bin
+  TObjArray              fBinFits;     //! Fit per ring and eta bin
 
-  ClassDef(AliFMDDensityCalculator,16); // Calculate Nch density 
+  ClassDef(AliFMDDensityCalculator,17); // Calculate Nch density 
 };
 
 #endif
@@ -215,6 +215,15 @@ AliFMDSharingFilter::Filter(const AliESDFMD& input,
   Int_t nDouble    = 0;
   Int_t nTriple    = 0;
 
+  // Per strip buffers, filled once per ring (eta and cuts - the ESD
+  // eta does not depend on the sector) or per sector (signals) so
+  // that each strip is read and corrected only once, rather than for
+  // itself and as the neighbour of the previous two strips.
+  Double_t etaCache[512];
+  Double_t lowCache[512];
+  Double_t highCache[512];
+  Float_t  multCache[512];
+
   for(UShort_t d = 1; d <= 3; d++) {
     Int_t nRings = (d == 1 ? 1 : 2);
     for (UShort_t q = 0; q < nRings; q++) {
@@ -222,8 +231,17 @@ AliFMDSharingFilter::Filter(const AliESDFMD& input,
       UShort_t    nsec   = (q == 0 ?  20 :  40);
       UShort_t    nstr   = (q == 0 ? 512 : 256);
       RingHistos* histos = GetRingHistos(d, r);
+
+      for (UShort_t t = 0; t < nstr; t++) { 
+	etaCache[t]  = input.Eta(d,r,0,t);
+	lowCache[t]  = GetLowCut(d, r, etaCache[t]);
+	highCache[t] = GetHighCut(d, r, etaCache[t], false);
+      }
       
       for(UShort_t s = 0; s < nsec;  s++) {	
+	for (UShort_t t = 0; t < nstr; t++) 
+	  multCache[t] = SignalInStrip(input,d,r,s,t);
+
 	// `used' flags if the _current_ strip was used by _previous_ 
 	// iteration. 
 	Bool_t   used            = kFALSE;
@@ -241,15 +259,15 @@ AliFMDSharingFilter::Filter(const AliESDFMD& input,
 	  // nDistanceAfter++;
 
 	  output.SetMultiplicity(d,r,s,t,0.);
-	  Float_t mult         = SignalInStrip(input,d,r,s,t);
-	  Float_t multNext     = (t<nstr-1) ? SignalInStrip(input,d,r,s,t+1) :0;
-	  Float_t multNextNext = (t<nstr-2) ? SignalInStrip(input,d,r,s,t+2) :0;
+	  Float_t mult         = multCache[t];
+	  Float_t multNext     = (t<nstr-1) ? multCache[t+1] :0;
+	  Float_t multNextNext = (t<nstr-2) ? multCache[t+2] :0;
 	  if (multNext     ==  AliESDFMD::kInvalidMult) multNext     = 0;
 	  if (multNextNext ==  AliESDFMD::kInvalidMult) multNextNext = 0;
 	  if(!fThreeStripSharing) multNextNext = 0;
 
 	  // Get the pseudo-rapidity 
-	  Double_t eta = input.Eta(d,r,s,t);
+	  Double_t eta = etaCache[t];
 	  Double_t phi = input.Phi(d,r,s,t) * TMath::Pi() / 180.;
 	  if (s == 0) output.SetEta(d,r,s,t,eta);
 	  
@@ -262,8 +280,8 @@ AliFMDSharingFilter::Filter(const AliESDFMD& input,
 	    mult = AliESDFMD::kInvalidMult;
 	  }
 	  
-	  Double_t lowCut  = GetLowCut(d, r, eta);
-	  Double_t highCut = GetHighCut(d, r, eta, false);
+	  Double_t lowCut  = lowCache[t];
+	  Double_t highCut = highCache[t];
 	  if (mult != AliESDFMD::kInvalidMult && mult > lowCut) {
 	    // Always fill the ESD sum histogram 
 	    histos->fSumESD->Fill(eta, phi, mult);
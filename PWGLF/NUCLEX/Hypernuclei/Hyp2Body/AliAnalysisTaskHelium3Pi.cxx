@@ -30,6 +30,7 @@
 #include <TString.h>
 #include <TRandom3.h>
 #include <TLorentzVector.h>
+#include <vector>
 
 #include "AliAnalysisManager.h"
 #include "AliMCEventHandler.h"
@@ -50,6 +51,7 @@
 #include "AliAODv0.h"
 #include "AliMultSelection.h"
 //#include <AliVTrack.h"
+#include "AliNuclexPairPrefilter.h"
 #include "AliAnalysisTaskHelium3Pi.h"
 
 using std::cout;
@@ -160,7 +162,10 @@ AliAnalysisTaskHelium3Pi::AliAnalysisTaskHelium3Pi()
   tHelBetaTOF(0),
   tHelIsITSrefit(0),
   fESDtrackCuts(0),
-  fPIDResponse(0)
+  fPIDResponse(0),
+  fPairMaxDeltaEta(-1),
+  fPairMaxDeltaPhi(-1),
+  fPairPrefilter(0)
   
 {
   printf("Dummy Constructor");
@@ -278,7 +283,10 @@ AliAnalysisTaskHelium3Pi::AliAnalysisTaskHelium3Pi(TString name)
     tHelBetaTOF(0),
     tHelIsITSrefit(0),
     fESDtrackCuts(0),
-    fPIDResponse(0)
+    fPIDResponse(0),
+    fPairMaxDeltaEta(-1),
+    fPairMaxDeltaPhi(-1),
+    fPairPrefilter(0)
 {					  
   
   // Define input and output slots here
@@ -319,6 +327,7 @@ AliAnalysisTaskHelium3Pi::~AliAnalysisTaskHelium3Pi()
   if (fESDtrackCuts) delete fESDtrackCuts;
   if(fNtuple1) delete fNtuple1;
   if(fNtuple4) delete fNtuple4;
+  delete fPairPrefilter;
 }
 //=================DEFINITION BETHE BLOCH==============================
 
@@ -895,6 +904,11 @@ void AliAnalysisTaskHelium3Pi::UserExec(Option_t *)
 
     // AliESDtrack *track;
 
+    // n-sigma cache and pion index for the pair building
+    if (!fPairPrefilter) fPairPrefilter = new AliNuclexPairPrefilter();
+    fPairPrefilter->SetWindow(fPairMaxDeltaEta, fPairMaxDeltaPhi);
+    fPairPrefilter->Reset(TrackNumber);
+
     //*************************************************************
 
     for (Int_t j=0; j<TrackNumber; j++) { //loop on tracks
@@ -975,7 +989,7 @@ void AliAnalysisTaskHelium3Pi::UserExec(Option_t *)
       }
       
       
-      nSigmaNegPion=TMath::Abs(fPIDResponse->NumberOfSigmasTPC(track,(AliPID::EParticleType) 2));
+      nSigmaNegPion=TMath::Abs(fPairPrefilter->GetNSigmaTPC(fPIDResponse,track,j,(AliPID::EParticleType) 2));
       
       //2 is pion
       
@@ -992,7 +1006,7 @@ void AliAnalysisTaskHelium3Pi::UserExec(Option_t *)
     
       Bool_t isHeITSrefit=((status) & (AliESDtrack::kITSrefit));
       
-      nSigma3He  = TMath::Abs((fPIDResponse->NumberOfSigmasTPC(track,(AliPID::EParticleType) 7)));
+      nSigma3He  = TMath::Abs((fPairPrefilter->GetNSigmaTPC(fPIDResponse,track,j,(AliPID::EParticleType) 7)));
       
       if(nSigma3He  < 3.) {
 	
@@ -1077,51 +1091,59 @@ void AliAnalysisTaskHelium3Pi::UserExec(Option_t *)
     AliESDtrack  *PionTrack = 0x0;
     AliESDtrack  *HeTrack = 0x0;
     //---------------   LOOP PAIRS   ----------------
-    
-    for (Int_t k=0; k < nPionsTPC; k++) {                           //! Pions Loop
-      
-      DcaPionToPrimVertex=0.;
-      DcaHeToPrimVertex=0;
-      
+
+    // The pions passing the DCA cut are indexed by the prefilter, and
+    // each helium candidate is paired with the compatible pions only
+    // (all of them by default).  The pion parameters are kept per
+    // pion over the helium candidates, as they were in the former
+    // pion-helium loop order.
+    std::vector<Int_t>                 pionIdx;
+    std::vector<Double_t>              pionDca;
+    std::vector<AliExternalTrackParam> pionParam;
+    pionIdx.reserve(nPionsTPC);
+    pionDca.reserve(nPionsTPC);
+    pionParam.reserve(nPionsTPC);
+    for (Int_t k=0; k < nPionsTPC; k++) {
       Int_t PionIdx=PionsTPC[k];
-      
       PionTrack =fESDevent->GetTrack(PionIdx);
+      Double_t dcaPion = TMath::Abs(PionTrack->GetD(lBestPrimaryVtxPos[0], lBestPrimaryVtxPos[1],lMagneticField));
+      if(dcaPion<0.2)continue; 
+      pionIdx.push_back(PionIdx);
+      pionDca.push_back(dcaPion);
+      pionParam.push_back(AliExternalTrackParam(*PionTrack));
+      fPairPrefilter->AddSecondary(PionTrack->GetSign(), PionTrack->Eta(), PionTrack->Phi());
+    }
+    fPairPrefilter->Build();
+    std::vector<Int_t> compatiblePions;
 
-      //      AliVTrack* PionTrack = (AliVTrack*) fevent->GetTrack(PionIdx);
-      //AliESDtrack *PionTrack = static_cast<AliESDtrack *>(aPionTrack);
-      //  PionTrack = static_cast<AliESDtrack *>(aPionTrack);
-      //PionTrack = new AliESDtrack((AliVTrack*)aPionTrack);--
-          
-      statusPi = (ULong_t)PionTrack->GetStatus();
-
-      IsPiITSRefit = ((statusPi) & (AliESDtrack::kITSrefit)); 
-     
- 
-      if (PionTrack) {
-	DcaPionToPrimVertex = TMath::Abs(PionTrack->GetD(lBestPrimaryVtxPos[0], lBestPrimaryVtxPos[1],lMagneticField)); //OK
-	}
+    for (Int_t i=0; i<nHeTPC; i++){                               //! Helium Loop
       
-      if(DcaPionToPrimVertex<0.2)continue; 
+      Int_t HeIdx=HeTPC[i];
       
+      HeTrack	= fESDevent->GetTrack(HeIdx);
       
-      AliExternalTrackParam trackInPion(*PionTrack);  
-
-      // AliExternalTrackParam trackInPion;
-      // trackInPion.CopyFromVTrack(aPionTrack);
+      IsHeITSRefit = (status & AliESDtrack::kITSrefit); 
+      
+      DcaHeToPrimVertex=0;
+      if(fAnalysisType == "ESD"){  
+	DcaHeToPrimVertex = TMath::Abs(HeTrack->GetD(lBestPrimaryVtxPos[0], lBestPrimaryVtxPos[1],lMagneticField)); //OK
+      }
+      
+      fPairPrefilter->GetCompatible(0, HeTrack->Eta(), HeTrack->Phi(), compatiblePions);
 
-      for (Int_t i=0; i<nHeTPC; i++){                               //! Helium Loop
+      for (UInt_t k=0; k < compatiblePions.size(); k++) {          //! Pions Loop
 	
-	Int_t HeIdx=HeTPC[i];
+	Int_t PionIdx=pionIdx[compatiblePions[k]];
 	
-	HeTrack	= fESDevent->GetTrack(HeIdx);
-
-	IsHeITSRefit = (status & AliESDtrack::kITSrefit); 
+	PionTrack =fESDevent->GetTrack(PionIdx);
 	
-	if (HeTrack){
-	  if(fAnalysisType == "ESD"){  
-	    DcaHeToPrimVertex = TMath::Abs(HeTrack->GetD(lBestPrimaryVtxPos[0], lBestPrimaryVtxPos[1],lMagneticField)); //OK
-	  }
-	}
+	statusPi = (ULong_t)PionTrack->GetStatus();
+	
+	IsPiITSRefit = ((statusPi) & (AliESDtrack::kITSrefit)); 
+	
+	DcaPionToPrimVertex = pionDca[compatiblePions[k]];
+	
+	AliExternalTrackParam &trackInPion = pionParam[compatiblePions[k]];
 	AliExternalTrackParam trackInHe(*HeTrack); 
 
 	// AliExternalTrackParam trackInHe;
@@ -1266,9 +1288,9 @@ void AliAnalysisTaskHelium3Pi::UserExec(Option_t *)
 	
 	fNtuple1->Fill();  
 	vertex.Delete();
-      }// positive TPC
+      }// pions
       
-    } //negative tpc
+    } //helium
     
   }
   
@@ -17,6 +17,7 @@ class TH2F;
 class TH3F;
 class TTree;
 class AliESDtrackCuts;
+class AliNuclexPairPrefilter;
 
 class AliAnalysisTaskHelium3Pi : public AliAnalysisTaskSE {
  public:
@@ -40,6 +41,8 @@ class AliAnalysisTaskHelium3Pi : public AliAnalysisTaskSE {
   void SetApplyFlatten(Bool_t  applyFlatten = kFALSE){fApplyFlatten= applyFlatten;};
   void SetFill3Htree(Bool_t  fill3hetree = kFALSE){fFill3Hetree= fill3hetree;};
   void ComputeFlow(Bool_t  doFlow = kFALSE){fDoFlow= doFlow;};
+  // Pair only pions within |deta| and |dphi| of the helium, < 0 for no cut
+  void SetPairWindow(Float_t maxDEta = -1, Float_t maxDPhi = -1){fPairMaxDeltaEta = maxDEta; fPairMaxDeltaPhi = maxDPhi;};
  
  private:
 
@@ -159,13 +162,16 @@ class AliAnalysisTaskHelium3Pi : public AliAnalysisTaskSE {
   //---------------------------------------------------------------------------
   AliESDtrackCuts *fESDtrackCuts; 
   AliPIDResponse  *fPIDResponse;      // pointer to PID response
+  Float_t fPairMaxDeltaEta;           //  eta window for the pairs, < 0 for no cut
+  Float_t fPairMaxDeltaPhi;           //  phi window for the pairs, < 0 for no cut
+  AliNuclexPairPrefilter *fPairPrefilter; //! n-sigma cache and pion index
   //_______________________________________________________________________
 
 
   AliAnalysisTaskHelium3Pi(const AliAnalysisTaskHelium3Pi&); // not implemented
   AliAnalysisTaskHelium3Pi& operator=(const AliAnalysisTaskHelium3Pi&); // not implemented
 
-  ClassDef(AliAnalysisTaskHelium3Pi, 2);
+  ClassDef(AliAnalysisTaskHelium3Pi, 3);
 };
 
 #endif
@@ -0,0 +1,134 @@
+#include "AliNuclexPairPrefilter.h"
+
+#include <AliPIDResponse.h>
+#include <AliVTrack.h>
+
+#include <TMath.h>
+#include <TVector2.h>
+
+#include <algorithm>
+
+AliNuclexPairPrefilter::AliNuclexPairPrefilter(int nEtaBins, float etaMin, float etaMax, int nPhiBins)
+    : fNEtaBins{1}, fEtaMin{etaMin}, fEtaMax{etaMax}, fNPhiBins{1}, fMaxDeltaEta{-1.f}, fMaxDeltaPhi{-1.f},
+      fNTracks{0}, fNSigma{}, fNSigmaDone{}, fEta{}, fPhi{}, fNeg{}, fCellFirst{}, fSorted{} {
+  SetBinning(nEtaBins, etaMin, etaMax, nPhiBins);
+}
+
+void AliNuclexPairPrefilter::SetBinning(int nEtaBins, float etaMin, float etaMax, int nPhiBins) {
+  fNEtaBins = std::max(nEtaBins, 1);
+  fEtaMin = etaMin;
+  fEtaMax = etaMax > etaMin ? etaMax : etaMin + 1.f;
+  fNPhiBins = std::max(nPhiBins, 1);
+}
+
+void AliNuclexPairPrefilter::Reset(int nTracks) {
+  fNTracks = std::max(nTracks, 0);
+  fNSigma.assign(fNTracks * AliPID::kSPECIESC, 0.f);
+  fNSigmaDone.assign(fNTracks * AliPID::kSPECIESC, 0);
+  fEta.clear();
+  fPhi.clear();
+  fNeg.clear();
+  fCellFirst.clear();
+  fSorted.clear();
+}
+
+float AliNuclexPairPrefilter::GetNSigmaTPC(AliPIDResponse *pid, AliVTrack *track, int iTrack,
+                                           AliPID::EParticleType species) {
+  if (iTrack < 0 || iTrack >= fNTracks || species < 0 || species >= AliPID::kSPECIESC)
+    return pid->NumberOfSigmasTPC(track, species);
+  const int index = species * fNTracks + iTrack;
+  if (!fNSigmaDone[index]) {
+    fNSigma[index] = pid->NumberOfSigmasTPC(track, species);
+    fNSigmaDone[index] = 1;
+  }
+  return fNSigma[index];
+}
+
+int AliNuclexPairPrefilter::GetEtaBin(float eta) const {
+  int bin = TMath::FloorNint((eta - fEtaMin) / (fEtaMax - fEtaMin) * fNEtaBins);
+  return std::min(std::max(bin, 0), fNEtaBins - 1);
+}
+
+int AliNuclexPairPrefilter::GetPhiBin(float phi) const {
+  int bin = TMath::FloorNint(phi / TMath::TwoPi() * fNPhiBins);
+  return std::min(std::max(bin, 0), fNPhiBins - 1);
+}
+
+void AliNuclexPairPrefilter::AddSecondary(int sign, float eta, float phi) {
+  phi = TVector2::Phi_0_2pi(phi);
+  fEta.push_back(eta);
+  fPhi.push_back(phi);
+  fNeg.push_back(sign < 0);
+}
+
+void AliNuclexPairPrefilter::Build() {
+  // counting sort of the secondaries by (sign, eta, phi) cell
+  const int nCells = 2 * fNEtaBins * fNPhiBins;
+  const int n = fEta.size();
+  std::vector<int> cell(n);
+  fCellFirst.assign(nCells + 1, 0);
+  for (int i = 0; i < n; ++i) {
+    cell[i] = (fNeg[i] ? 0 : fNEtaBins * fNPhiBins) + GetEtaBin(fEta[i]) * fNPhiBins + GetPhiBin(fPhi[i]);
+    fCellFirst[cell[i] + 1]++;
+  }
+  for (int c = 0; c < nCells; ++c)
+    fCellFirst[c + 1] += fCellFirst[c];
+  std::vector<int> next(fCellFirst.begin(), fCellFirst.end() - 1);
+  fSorted.resize(n);
+  for (int i = 0; i < n; ++i)
+    fSorted[next[cell[i]]++] = i;
+}
+
+void AliNuclexPairPrefilter::AddCells(int sign, int etaLow, int etaHigh, int phiLow, int phiHigh, float eta,
+                                      float phi, std::vector<int> &positions) const {
+  const int offset = sign < 0 ? 0 : fNEtaBins * fNPhiBins;
+  const bool allPhi = fMaxDeltaPhi < 0 || phiHigh - phiLow + 1 >= fNPhiBins;
+  if (allPhi) {
+    phiLow = 0;
+    phiHigh = fNPhiBins - 1;
+  }
+  for (int iEta = etaLow; iEta <= etaHigh; ++iEta) {
+    for (int iPhi = phiLow; iPhi <= phiHigh; ++iPhi) {
+      const int c = offset + iEta * fNPhiBins + ((iPhi % fNPhiBins) + fNPhiBins) % fNPhiBins;
+      for (int j = fCellFirst[c]; j < fCellFirst[c + 1]; ++j) {
+        const int pos = fSorted[j];
+        if (fMaxDeltaEta >= 0 && TMath::Abs(fEta[pos] - eta) > fMaxDeltaEta)
+          continue;
+        if (!allPhi) {
+          float dPhi = TMath::Abs(fPhi[pos] - phi);
+          if (dPhi > TMath::Pi())
+            dPhi = TMath::TwoPi() - dPhi;
+          if (dPhi > fMaxDeltaPhi)
+            continue;
+        }
+        positions.push_back(pos);
+      }
+    }
+  }
+}
+
+void AliNuclexPairPrefilter::GetCompatible(int sign, float eta, float phi, std::vector<int> &positions) const {
+  positions.clear();
+  if (fSorted.empty())
+    return;
+  phi = TVector2::Phi_0_2pi(phi);
+
+  int etaLow = 0, etaHigh = fNEtaBins - 1;
+  if (fMaxDeltaEta >= 0) {
+    etaLow = GetEtaBin(eta - fMaxDeltaEta);
+    etaHigh = GetEtaBin(eta + fMaxDeltaEta);
+  }
+  int phiLow = 0, phiHigh = fNPhiBins - 1;
+  if (fMaxDeltaPhi >= 0) {
+    const double step = TMath::TwoPi() / fNPhiBins;
+    // one cell more on each side against rounding at the cell borders
+    phiLow = TMath::FloorNint((phi - fMaxDeltaPhi) / step) - 1;
+    phiHigh = TMath::FloorNint((phi + fMaxDeltaPhi) / step) + 1;
+  }
+
+  if (sign <= 0)
+    AddCells(-1, etaLow, etaHigh, phiLow, phiHigh, eta, phi, positions);
+  if (sign >= 0)
+    AddCells(1, etaLow, etaHigh, phiLow, phiHigh, eta, phi, positions);
+  std::sort(positions.begin(), positions.end());
+}
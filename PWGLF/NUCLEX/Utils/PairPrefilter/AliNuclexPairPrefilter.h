@@ -0,0 +1,65 @@
+#ifndef ALINUCLEXPAIRPREFILTER_H
+#define ALINUCLEXPAIRPREFILTER_H
+
+//-----------------------------------------------------------------
+// Pre-filter for the pair building of 2-body decays of (hyper)nuclei.
+// The TPC n-sigma of a track is evaluated once per event and species
+// and cached. The tracks of the abundant (secondary) side are indexed
+// by sign and eta-phi cell, so that a primary-side candidate is only
+// paired with the secondary tracks of the requested sign inside an
+// eta-phi window. A negative window size disables the cut in that
+// direction, i.e. all the tracks of the requested sign are returned.
+//-----------------------------------------------------------------
+
+#include <Rtypes.h>
+#include <AliPID.h>
+
+#include <vector>
+
+class AliPIDResponse;
+class AliVTrack;
+
+class AliNuclexPairPrefilter {
+public:
+  AliNuclexPairPrefilter(int nEtaBins = 18, float etaMin = -0.9, float etaMax = 0.9, int nPhiBins = 36);
+
+  void SetBinning(int nEtaBins, float etaMin, float etaMax, int nPhiBins);
+  void SetWindow(float maxDeltaEta, float maxDeltaPhi) { fMaxDeltaEta = maxDeltaEta; fMaxDeltaPhi = maxDeltaPhi; }
+
+  void Reset(int nTracks);
+
+  /// TPC n-sigma of the track with index iTrack, evaluated on the first call of the event
+  float GetNSigmaTPC(AliPIDResponse *pid, AliVTrack *track, int iTrack, AliPID::EParticleType species);
+
+  /// Add a secondary-side track, the position in the add order is returned by GetCompatible()
+  void AddSecondary(int sign, float eta, float phi);
+  void Build();
+  int GetNSecondaries() const { return fEta.size(); }
+
+  /// Positions (in the add order, ascending) of the secondaries with sign (0: any) compatible with eta and phi
+  void GetCompatible(int sign, float eta, float phi, std::vector<int> &positions) const;
+
+private:
+  int GetEtaBin(float eta) const;
+  int GetPhiBin(float phi) const;
+  void AddCells(int sign, int etaLow, int etaHigh, int phiLow, int phiHigh, float eta, float phi,
+                std::vector<int> &positions) const;
+
+  int fNEtaBins;     ///< number of eta cells
+  float fEtaMin;     ///< lower eta limit, tracks below are kept in the first cell
+  float fEtaMax;     ///< upper eta limit, tracks above are kept in the last cell
+  int fNPhiBins;     ///< number of phi cells in [0,2pi[
+  float fMaxDeltaEta; ///< eta window, < 0 for no cut
+  float fMaxDeltaPhi; ///< phi window, < 0 for no cut
+
+  int fNTracks;                          ///< tracks of the event for the n-sigma cache
+  std::vector<float> fNSigma;            ///< cached n-sigma, fNTracks per species
+  std::vector<char> fNSigmaDone;         ///< whether the n-sigma was evaluated
+  std::vector<float> fEta;               ///< eta of the secondaries
+  std::vector<float> fPhi;               ///< phi of the secondaries, in [0,2pi[
+  std::vector<char> fNeg;                ///< sign of the secondaries
+  std::vector<int> fCellFirst;           ///< first sorted secondary of each (sign, eta, phi) cell
+  std::vector<int> fSorted;              ///< positions of the secondaries sorted by cell
+};
+
+#endif
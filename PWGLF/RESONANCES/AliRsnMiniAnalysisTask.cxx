@@ -46,6 +46,7 @@
 #include "AliRsnMiniPair.h"
 #include "AliRsnMiniEvent.h"
 #include "AliRsnMiniParticle.h"
+#include "AliRsnMiniMixingStore.h"
 
 #include "AliRsnMiniAnalysisTask.h"
 #include "AliRsnMiniResonanceFinder.h"
@@ -115,7 +116,14 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask() :
    fComputeSpherocity(kFALSE),
    fTrackFilter(0x0),
    fSpherocity(-10),
-   fResonanceFinders(0)
+   fResonanceFinders(0),
+   fInMemoryMix(kFALSE),
+   fMixMemoryBudget(500.),
+   fMixingStore(0x0),
+   fMixMatches(),
+   fNMiniEvents(0),
+   fSharePairLoops(kTRUE),
+   fDenseHistograms(kFALSE)
 {
 //
 // Dummy constructor ALWAYS needed for I/O.
@@ -187,7 +195,14 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const char *name, Bool_t useMC,Bo
    fComputeSpherocity(kFALSE),
    fTrackFilter(0x0),
    fSpherocity(-10),
-   fResonanceFinders(0)
+   fResonanceFinders(0),
+   fInMemoryMix(kFALSE),
+   fMixMemoryBudget(500.),
+   fMixingStore(0x0),
+   fMixMatches(),
+   fNMiniEvents(0),
+   fSharePairLoops(kTRUE),
+   fDenseHistograms(kFALSE)
 {
 //
 // Default constructor.
@@ -258,7 +273,14 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const AliRsnMiniAnalysisTask &cop
    fComputeSpherocity(copy.fComputeSpherocity),
    fTrackFilter(copy.fTrackFilter),
    fSpherocity(copy.fSpherocity),
-   fResonanceFinders(copy.fResonanceFinders)
+   fResonanceFinders(copy.fResonanceFinders),
+   fInMemoryMix(copy.fInMemoryMix),
+   fMixMemoryBudget(copy.fMixMemoryBudget),
+   fMixingStore(0x0),
+   fMixMatches(),
+   fNMiniEvents(0),
+   fSharePairLoops(copy.fSharePairLoops),
+   fDenseHistograms(copy.fDenseHistograms)
 {
 //
 // Copy constructor.
@@ -331,6 +353,10 @@ AliRsnMiniAnalysisTask &AliRsnMiniAnalysisTask::operator=(const AliRsnMiniAnalys
    fTrackFilter = copy.fTrackFilter;
    fSpherocity = copy.fSpherocity;
    fResonanceFinders = copy.fResonanceFinders;
+   fInMemoryMix = copy.fInMemoryMix;
+   fMixMemoryBudget = copy.fMixMemoryBudget;
+   fSharePairLoops = copy.fSharePairLoops;
+   fDenseHistograms = copy.fDenseHistograms;
 
    return (*this);
 }
@@ -348,6 +374,7 @@ AliRsnMiniAnalysisTask::~AliRsnMiniAnalysisTask()
       delete fOutput;
       delete fEvBuffer;
    }
+   delete fMixingStore;
 }
 
 //__________________________________________________________________________________________________
@@ -490,6 +517,11 @@ void AliRsnMiniAnalysisTask::UserCreateOutputObjects()
    fEvBuffer = new TTree("EventBuffer", "Temporary buffer for mini events");
    fMiniEvent = new AliRsnMiniEvent();
    fEvBuffer->Branch("events", "AliRsnMiniEvent", &fMiniEvent);
+   fNMiniEvents = 0;
+   if (fInMemoryMix) {
+      if (fMixingStore) delete fMixingStore;
+      fMixingStore = new AliRsnMiniMixingStore(fContinuousMix, fNMix, fMaxDiffVz, fMaxDiffMult, fMaxDiffAngle, fMixMemoryBudget);
+   }
    
    // create one histogram per each stored definition (event histograms)
    Int_t i, ndef = fHistograms.GetEntries();
@@ -497,12 +529,28 @@ void AliRsnMiniAnalysisTask::UserCreateOutputObjects()
    for (i = 0; i < ndef; i++) {
       def = (AliRsnMiniOutput *)fHistograms[i];
       if (!def) continue;
+      if (fDenseHistograms && def->GetOutputType() == AliRsnMiniOutput::kHistogramSparse && def->GetNAxes() <= 3)
+         def->SetOutputType(AliRsnMiniOutput::kHistogram);
       if (!def->Init(GetName(), fOutput)) {
          AliError(Form("Def '%s': failed initialization", def->GetName()));
          continue;
       }
    }
 
+   // outputs differing only by their pair cuts and axes are filled in the pair loop of the first one
+   for (i = 0; i < ndef; i++) {
+      def = (AliRsnMiniOutput *)fHistograms[i];
+      if (def) def->ClearPairFollowers();
+   }
+   for (i = 0; fSharePairLoops && i < ndef; i++) {
+      def = (AliRsnMiniOutput *)fHistograms[i];
+      if (!def || !def->IsPairComputation() || def->IsPairFollower()) continue;
+      for (Int_t j = i + 1; j < ndef; j++) {
+         AliRsnMiniOutput *other = (AliRsnMiniOutput *)fHistograms[j];
+         if (other && !other->IsPairFollower() && def->HasSamePairDefinition(other)) def->AddPairFollower(other);
+      }
+   }
+
    // post data for ALL output slots >0 here, to get at least an empty histogram
    PostData(1, fOutput);
    if (fRsnTreeInFile) PostData(2, fEvBuffer);
@@ -513,7 +561,8 @@ void AliRsnMiniAnalysisTask::UserCreateOutputObjects()
 ///
 /// It checks if the event is acceptable, and eventually
 /// creates the corresponding mini-event and stores it in the buffer.
-/// The real histogram filling is done at the end, in "FinishTaskOutput".
+/// The real histogram filling is done at the end, in "FinishTaskOutput",
+/// or directly here when the in-memory mixing is used.
 ///
 /// Note: "true" mother-related histograms are filled in UserExec,
 /// since they require direct access to MC event
@@ -556,6 +605,10 @@ void AliRsnMiniAnalysisTask::UserExec(Option_t *)
    // if the event is not empty, store it
    if (fMiniEvent->IsEmpty()) {
       AliDebugClass(2, Form("Rejecting empty event #%d", fEvNum));
+   } else if (fMixingStore) {
+      fMiniEvent->ID() = fNMiniEvents++;
+      FillEventOutputs(fMiniEvent);
+      MixEventInMemory(fMiniEvent);
    } else {
       Int_t id = fEvBuffer->GetEntries();
       AliDebugClass(2, Form("Adding event #%d with ID = %d", fEvNum, id));
@@ -581,6 +634,14 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
 // FInish task: loop on each of the selected events, and compute both single-event and mixing 
 //
 
+   // with the in-memory mixing everything has been computed in UserExec
+   if (fMixingStore) {
+      fMixingStore->Print();
+      fMixingStore->Reset();
+      PostData(1, fOutput);
+      return;
+   }
+
    // security code: reassign the buffer to the mini-event cursor
    fEvBuffer->SetBranchAddress("events", &fMiniEvent);
    TStopwatch timer;
@@ -589,7 +650,6 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    Int_t idef, nDefs   = fHistograms.GetEntries();
    Int_t imix, iloop, ifill;
    AliRsnMiniOutput *def = 0x0;
-   AliRsnMiniOutput::EComputation compType;
 
    Int_t printNum = fMixPrintRefresh;
    if (printNum < 0) {
@@ -611,45 +671,7 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
          timer.Stop(); timer.Print(); fflush(stdout); timer.Start(kFALSE);
       }
       // fill
-      for (idef = 0; idef < nDefs; idef++) {
-         def = (AliRsnMiniOutput *)fHistograms[idef];
-         if (!def) continue;
-         compType = def->GetComputation();
-         // execute computation in the appropriate way
-         switch (compType) {
-            case AliRsnMiniOutput::kEventOnly:
-               //AliDebugClass(1, Form("Event %d, def '%s': event-value histogram filling", ievt, def->GetName()));
-               ifill = 1;
-               def->FillEvent(fMiniEvent, &fValues);
-               break;
-            case AliRsnMiniOutput::kTruePair:
-               //AliDebugClass(1, Form("Event %d, def '%s': true-pair histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
-               break;
-            case AliRsnMiniOutput::kTrackPair:
-               //AliDebugClass(1, Form("Event %d, def '%s': pair-value histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
-               break;
-            case AliRsnMiniOutput::kTrackPairRotated1:
-               //AliDebugClass(1, Form("Event %d, def '%s': rotated (1) background histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
-               break;
-            case AliRsnMiniOutput::kTrackPairRotated2:
-               //AliDebugClass(1, Form("Event %d, def '%s': rotated (2) background histogram filling", ievt, def->GetName()));
-               ifill = def->FillPair(fMiniEvent, fMiniEvent, &fValues);
-               break;
-            case AliRsnMiniOutput::kSingleRec:
-               //AliDebugClass(1, Form("Event %d, def '%s': single reconstructed track histogram filling", ievt, def->GetName()));
-               ifill = def->FillSingleRec(fMiniEvent, &fValues);
-               break;
-            default:
-               // other kinds are processed elsewhere
-               ifill = 0;
-               AliDebugClass(2, Form("Computation = %d", (Int_t)compType));
-         }
-         // message
-         AliDebugClass(1, Form("Event %6d: def = '%15s' -- fills = %5d", ievt, def->GetName(), ifill));
-      }
+      FillEventOutputs(fMiniEvent);
    }
 
    // if no mixing is required, stop here and post the output
@@ -722,7 +744,7 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
          fEvBuffer->GetEntry(imix);
          for (idef = 0; idef < nDefs; idef++) {
             def = (AliRsnMiniOutput *)fHistograms[idef];
-            if (!def) continue;
+            if (!def || def->IsPairFollower()) continue;
             if (!def->IsTrackPairMix()) continue;
             ifill += def->FillPair(&evMain, fMiniEvent, &fValues, kTRUE);
             if (!def->IsSymmetric()) {
@@ -1668,6 +1690,92 @@ void AliRsnMiniAnalysisTask::SetDselection(UShort_t originDselection)
 	
 	return;
 }
+//__________________________________________________________________________________________________
+/// Fill all outputs which are computed on a single mini-event,
+/// using the appropriate procedure depending on their type.
+///
+/// \param event Mini-event
+///
+void AliRsnMiniAnalysisTask::FillEventOutputs(AliRsnMiniEvent *event)
+{
+   Int_t idef, nDefs = fHistograms.GetEntries();
+   Int_t ifill;
+   AliRsnMiniOutput *def = 0x0;
+   AliRsnMiniOutput::EComputation compType;
+
+   for (idef = 0; idef < nDefs; idef++) {
+      def = (AliRsnMiniOutput *)fHistograms[idef];
+      if (!def || def->IsPairFollower()) continue;
+      compType = def->GetComputation();
+      // execute computation in the appropriate way
+      switch (compType) {
+         case AliRsnMiniOutput::kEventOnly:
+            //AliDebugClass(1, Form("Event %d, def '%s': event-value histogram filling", event->ID(), def->GetName()));
+            ifill = 1;
+            def->FillEvent(event, &fValues);
+            break;
+         case AliRsnMiniOutput::kTruePair:
+            //AliDebugClass(1, Form("Event %d, def '%s': true-pair histogram filling", event->ID(), def->GetName()));
+            ifill = def->FillPair(event, event, &fValues);
+            break;
+         case AliRsnMiniOutput::kTrackPair:
+            //AliDebugClass(1, Form("Event %d, def '%s': pair-value histogram filling", event->ID(), def->GetName()));
+            ifill = def->FillPair(event, event, &fValues);
+            break;
+         case AliRsnMiniOutput::kTrackPairRotated1:
+            //AliDebugClass(1, Form("Event %d, def '%s': rotated (1) background histogram filling", event->ID(), def->GetName()));
+            ifill = def->FillPair(event, event, &fValues);
+            break;
+         case AliRsnMiniOutput::kTrackPairRotated2:
+            //AliDebugClass(1, Form("Event %d, def '%s': rotated (2) background histogram filling", event->ID(), def->GetName()));
+            ifill = def->FillPair(event, event, &fValues);
+            break;
+         case AliRsnMiniOutput::kSingleRec:
+            //AliDebugClass(1, Form("Event %d, def '%s': single reconstructed track histogram filling", event->ID(), def->GetName()));
+            ifill = def->FillSingleRec(event, &fValues);
+            break;
+         default:
+            // other kinds are processed elsewhere
+            ifill = 0;
+            AliDebugClass(2, Form("Computation = %d", (Int_t)compType));
+      }
+      // message
+      AliDebugClass(1, Form("Event %6d: def = '%15s' -- fills = %5d", event->ID(), def->GetName(), ifill));
+   }
+}
+
+//__________________________________________________________________________________________________
+/// Mix the current mini-event with the compatible events of the in-memory store,
+/// and keep a copy of it for the following events if it has not enough partners yet.
+/// As in the mixing of FinishTaskOutput, each match counts for both events.
+///
+/// \param event Current mini-event
+///
+void AliRsnMiniAnalysisTask::MixEventInMemory(AliRsnMiniEvent *event)
+{
+   if (fNMix < 1) return;
+
+   Int_t idef, nDefs = fHistograms.GetEntries();
+   Int_t ifill = 0;
+   AliRsnMiniOutput *def = 0x0;
+
+   fMixingStore->GetMatches(event, fMixMatches);
+   for (UInt_t imix = 0; imix < fMixMatches.size(); imix++) {
+      for (idef = 0; idef < nDefs; idef++) {
+         def = (AliRsnMiniOutput *)fHistograms[idef];
+         if (!def || def->IsPairFollower()) continue;
+         if (!def->IsTrackPairMix()) continue;
+         ifill += def->FillPair(event, fMixMatches[imix], &fValues, kTRUE);
+         if (!def->IsSymmetric()) {
+            AliDebugClass(2, "Reflecting non symmetric pair");
+            ifill += def->FillPair(fMixMatches[imix], event, &fValues, kFALSE);
+         }
+      }
+   }
+   AliDebugClass(1, Form("Event %6d: %d mixing partners -- fills = %5d", event->ID(), (Int_t)fMixMatches.size(), ifill));
+   fMixingStore->AddEvent(event, fMixMatches.size());
+}
+
 //__________________________________________________________________________________________________
 /// Check if two events are compatible.
 ///
@@ -15,6 +15,8 @@
 #ifndef ALIRSNMINIANALYSISTASK_H
 #define ALIRSNMINIANALYSISTASK_H
 
+#include <vector>
+
 #include <TString.h>
 #include <TClonesArray.h>
 
@@ -35,6 +37,7 @@ class TList;
 
 class AliTriggerAnalysis;
 class AliRsnMiniEvent;
+class AliRsnMiniMixingStore;
 class AliRsnCutSet;
 class AliQnCorrectionsManager;
 class AliQnCorrectionsQnVector;
@@ -70,6 +73,13 @@ public:
    void                SetUseTimeRangeCut(Bool_t use = kTRUE)   {fUseTimeRangeCut    = use;}
    void                SetEventCuts(AliRsnCutSet *cuts)   {fEventCuts    = cuts;}
    void                SetMixPrintRefresh(Int_t n)        {fMixPrintRefresh = n;}
+   /// online mixing with an in-memory store of the events still to be mixed, instead of the TTree
+   /// buffer processed in FinishTaskOutput; keep the TTree buffer for very deep mixing
+   void                UseInMemoryMixing(Bool_t yn = kTRUE, Double_t memoryBudgetMB = 500.) {fInMemoryMix = yn; fMixMemoryBudget = memoryBudgetMB;}
+   /// fill the pair outputs differing only by their pair cuts and axes in one pair loop, computing each value once
+   void                SetSharePairLoops(Bool_t yn = kTRUE) {fSharePairLoops = yn;}
+   /// create the THnSparse outputs with up to 3 axes as TH1F/TH2F/TH3F, out of range values go to the under/overflow bins
+   void                UseDenseHistograms(Bool_t yn = kTRUE) {fDenseHistograms = yn;}
    void                SetCheckDecay(Bool_t checkDecay = kTRUE) {fCheckDecay = checkDecay;}
    void                SetMaxNDaughters(Short_t n)        {fMaxNDaughters = n;}
    void                SetCheckMomentumConservation(Bool_t checkP) {fCheckP = checkP;}
@@ -108,6 +118,8 @@ public:
 private:
    Char_t   CheckCurrentEvent();
    void     FillMiniEvent(Char_t evType);
+   void     FillEventOutputs(AliRsnMiniEvent *event);
+   void     MixEventInMemory(AliRsnMiniEvent *event);
    Double_t ComputeAngle();
    Double_t ComputeCentrality(Bool_t isESD);
    Double_t ComputeMultiplicity(Bool_t isESD,TString type);
@@ -181,9 +193,16 @@ private:
    AliAnalysisFilter   *fTrackFilter;       //!<! track filter for spherocity estimator 
    Double_t             fSpherocity;        ///< stores value of spherocity
    TObjArray            fResonanceFinders;  ///< list of AliRsnMiniResonanceFinder objects
+   Bool_t               fInMemoryMix;       ///< mixing --> online with the in-memory store instead of the TTree buffer
+   Double_t             fMixMemoryBudget;   ///< mixing --> memory budget of the in-memory store in MB
+   AliRsnMiniMixingStore *fMixingStore;     //!<! in-memory store of the events to be mixed
+   std::vector<AliRsnMiniEvent*> fMixMatches; //!<! mixing partners of the current event
+   Int_t                fNMiniEvents;       //!<! ID of the next mini-event with the in-memory mixing
+   Bool_t               fSharePairLoops;    ///< pair outputs with the same pair definition share the pair loop
+   Bool_t               fDenseHistograms;   ///< THnSparse outputs with up to 3 axes created as TH1F/TH2F/TH3F
 
 /// \cond CLASSIMP
-   ClassDef(AliRsnMiniAnalysisTask, 22);     
+   ClassDef(AliRsnMiniAnalysisTask, 24);     
 /// \endcond
 };
 
@@ -0,0 +1,253 @@
+//
+// In-memory store of mini-events for online event mixing.
+// The matching follows AliRsnMiniAnalysisTask::EventsMatch(): in binned mixing
+// events are compatible if they are in the same bin, in continuous mixing the
+// bin widths are the maximum differences, so that only the neighbouring bins
+// are searched for compatible events.
+// Each match counts for both events, and an event is released as soon as it
+// has been mixed the requested number of times, as in the mixing done with the
+// TTree buffer of the task.
+//
+
+#include <algorithm>
+#include <functional>
+
+#include <TMath.h>
+
+#include "AliLog.h"
+#include "AliRsnMiniParticle.h"
+#include "AliRsnMiniEvent.h"
+#include "AliRsnMiniMixingStore.h"
+
+ClassImp(AliRsnMiniMixingStore)
+
+namespace {
+   const Int_t kBinOffset = 1 << 19;
+
+   struct SerialLess {
+      template <class T> Bool_t operator()(const T &entry, Long64_t serial) const {return entry.fSerial < serial;}
+   };
+}
+
+//__________________________________________________________________________________________________
+AliRsnMiniMixingStore::AliRsnMiniMixingStore() :
+   TObject(),
+   fContinuous(kFALSE),
+   fNMix(0),
+   fMaxDiffVz(1.0),
+   fMaxDiffMult(10.0),
+   fMaxDiffAngle(1E20),
+   fBudget(0.0),
+   fBins(),
+   fOrder(),
+   fTouched(),
+   fCandidates(),
+   fSerial(0),
+   fNStored(0),
+   fBytes(0.0),
+   fNAdded(0),
+   fNEvicted(0)
+{
+//
+// Default constructor
+//
+}
+
+//__________________________________________________________________________________________________
+AliRsnMiniMixingStore::AliRsnMiniMixingStore(Bool_t continuous, Int_t nMix, Double_t maxDiffVz, Double_t maxDiffMult, Double_t maxDiffAngle, Double_t memoryBudgetMB) :
+   TObject(),
+   fContinuous(continuous),
+   fNMix(nMix),
+   fMaxDiffVz(maxDiffVz),
+   fMaxDiffMult(maxDiffMult),
+   fMaxDiffAngle(maxDiffAngle),
+   fBudget(memoryBudgetMB * 1024. * 1024.),
+   fBins(),
+   fOrder(),
+   fTouched(),
+   fCandidates(),
+   fSerial(0),
+   fNStored(0),
+   fBytes(0.0),
+   fNAdded(0),
+   fNEvicted(0)
+{
+//
+// Main constructor
+//
+}
+
+//__________________________________________________________________________________________________
+AliRsnMiniMixingStore::~AliRsnMiniMixingStore()
+{
+//
+// Destructor, deletes the stored events
+//
+   Reset();
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniMixingStore::Reset()
+{
+//
+// Deletes all stored events
+//
+   std::map<Long64_t, EntryList>::iterator it;
+   for (it = fBins.begin(); it != fBins.end(); ++it) {
+      for (UInt_t i = 0; i < it->second.size(); i++) delete it->second[i].fEvent;
+   }
+   fBins.clear();
+   fOrder.clear();
+   fTouched.clear();
+   fCandidates.clear();
+   fNStored = 0;
+   fBytes = 0.0;
+}
+
+//__________________________________________________________________________________________________
+Int_t AliRsnMiniMixingStore::BinIndex(Double_t value, Double_t width) const
+{
+   if (width <= 0.0) return 0;
+   Double_t index = value / width;
+   if (index < -kBinOffset) return -kBinOffset;
+   if (index > kBinOffset - 1) return kBinOffset - 1;
+   return (Int_t)index;
+}
+
+//__________________________________________________________________________________________________
+Long64_t AliRsnMiniMixingStore::BinKey(Int_t ivz, Int_t imult, Int_t iangle) const
+{
+   ivz    = TMath::Min(TMath::Max(ivz, -kBinOffset), kBinOffset - 1);
+   imult  = TMath::Min(TMath::Max(imult, -kBinOffset), kBinOffset - 1);
+   iangle = TMath::Min(TMath::Max(iangle, -kBinOffset), kBinOffset - 1);
+   return (((Long64_t)(ivz + kBinOffset)) << 40) | (((Long64_t)(imult + kBinOffset)) << 20) | ((Long64_t)(iangle + kBinOffset));
+}
+
+//__________________________________________________________________________________________________
+Bool_t AliRsnMiniMixingStore::Match(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2) const
+{
+//
+// Continuous mixing condition, binned mixing is given by the bin
+//
+   if (TMath::Abs(event1->Vz()    - event2->Vz()   ) > fMaxDiffVz   ) return kFALSE;
+   if (TMath::Abs(event1->Mult()  - event2->Mult() ) > fMaxDiffMult ) return kFALSE;
+   if (TMath::Abs(event1->Angle() - event2->Angle()) > fMaxDiffAngle) return kFALSE;
+   return kTRUE;
+}
+
+//__________________________________________________________________________________________________
+Int_t AliRsnMiniMixingStore::FindEntry(const EntryList &list, Long64_t serial) const
+{
+//
+// Position of the event in the list, which is ordered by serial number
+//
+   EntryList::const_iterator it = std::lower_bound(list.begin(), list.end(), serial, SerialLess());
+   if (it == list.end() || it->fSerial != serial) return -1;
+   return (Int_t)(it - list.begin());
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniMixingStore::RemoveEntry(EntryList &list, Int_t i, Bool_t evicted)
+{
+   fBytes -= list[i].fBytes;
+   fNStored--;
+   if (evicted) fNEvicted++;
+   delete list[i].fEvent;
+   list.erase(list.begin() + i);
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniMixingStore::GetMatches(AliRsnMiniEvent *event, std::vector<AliRsnMiniEvent*> &matches)
+{
+//
+// Stored events to be mixed with the passed one, the most recent first.
+// The returned events remain valid until the next call to AddEvent().
+//
+   matches.clear();
+   fTouched.clear();
+   fCandidates.clear();
+   if (!event || fNMix < 1) return;
+
+   Int_t ivz    = BinIndex(event->Vz(),    fMaxDiffVz);
+   Int_t imult  = BinIndex(event->Mult(),  fMaxDiffMult);
+   Int_t iangle = BinIndex(event->Angle(), fMaxDiffAngle);
+   Int_t range  = (fContinuous ? 1 : 0);
+   for (Int_t dvz = -range; dvz <= range; dvz++) {
+      for (Int_t dmult = -range; dmult <= range; dmult++) {
+         for (Int_t dangle = -range; dangle <= range; dangle++) {
+            Long64_t key = BinKey(ivz + dvz, imult + dmult, iangle + dangle);
+            std::map<Long64_t, EntryList>::iterator it = fBins.find(key);
+            if (it == fBins.end()) continue;
+            fTouched.push_back(key);
+            EntryList &list = it->second;
+            for (UInt_t i = 0; i < list.size(); i++) {
+               if (list[i].fNMatched >= fNMix) continue;
+               if (fContinuous && !Match(event, list[i].fEvent)) continue;
+               fCandidates.push_back(std::make_pair(list[i].fSerial, key));
+            }
+         }
+      }
+   }
+
+   std::sort(fCandidates.begin(), fCandidates.end(), std::greater<std::pair<Long64_t, Long64_t> >());
+   for (UInt_t i = 0; i < fCandidates.size() && (Int_t)matches.size() < fNMix; i++) {
+      EntryList &list = fBins[fCandidates[i].second];
+      Entry &entry = list[FindEntry(list, fCandidates[i].first)];
+      entry.fNMatched++;
+      matches.push_back(entry.fEvent);
+   }
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniMixingStore::AddEvent(AliRsnMiniEvent *event, Int_t nMatched)
+{
+//
+// Releases the events which have been fully mixed by the last GetMatches()
+// and stores a copy of the passed event if it needs more mixing partners.
+// The oldest events are dropped while the memory budget is exceeded.
+//
+   for (UInt_t i = 0; i < fTouched.size(); i++) {
+      std::map<Long64_t, EntryList>::iterator it = fBins.find(fTouched[i]);
+      if (it == fBins.end()) continue;
+      for (Int_t j = (Int_t)it->second.size() - 1; j >= 0; j--) {
+         if (it->second[j].fNMatched >= fNMix) RemoveEntry(it->second, j, kFALSE);
+      }
+      if (it->second.empty()) fBins.erase(it);
+   }
+   fTouched.clear();
+
+   if (event && nMatched < fNMix) {
+      Entry entry;
+      entry.fEvent = new AliRsnMiniEvent(*event);
+      entry.fEvent->SetRef(0x0);
+      entry.fEvent->SetRefMC(0x0);
+      entry.fEvent->SetQnVector(0x0);
+      entry.fNMatched = nMatched;
+      entry.fSerial = fSerial++;
+      entry.fBytes = sizeof(AliRsnMiniEvent) + event->Particles().GetEntriesFast() * sizeof(AliRsnMiniParticle);
+      Long64_t key = BinKey(BinIndex(event->Vz(), fMaxDiffVz), BinIndex(event->Mult(), fMaxDiffMult), BinIndex(event->Angle(), fMaxDiffAngle));
+      fBins[key].push_back(entry);
+      fOrder.push_back(std::make_pair(key, entry.fSerial));
+      fNStored++;
+      fBytes += entry.fBytes;
+      fNAdded++;
+   }
+
+   while (!fOrder.empty()) {
+      std::map<Long64_t, EntryList>::iterator it = fBins.find(fOrder.front().first);
+      Int_t i = (it == fBins.end() ? -1 : FindEntry(it->second, fOrder.front().second));
+      if (i >= 0) {
+         if (fBytes <= fBudget) break;
+         RemoveEntry(it->second, i, kTRUE);
+         if (it->second.empty()) fBins.erase(it);
+      }
+      fOrder.pop_front();
+   }
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniMixingStore::Print(Option_t *) const
+{
+   AliInfo(Form("%d events stored in %d bins (%.1f MB), %lld events added, %lld dropped for the memory budget",
+                fNStored, (Int_t)fBins.size(), GetMemoryUsageMB(), fNAdded, fNEvicted));
+}
@@ -0,0 +1,75 @@
+#ifndef ALIRSNMINIMIXINGSTORE_H
+#define ALIRSNMINIMIXINGSTORE_H
+
+//
+// In-memory store of mini-events for online event mixing.
+// Events are kept per (vz, multiplicity, angle) bin, in order of arrival,
+// until they have been mixed the requested number of times; the oldest
+// events are dropped when the memory budget is exceeded.
+//
+
+#include <deque>
+#include <map>
+#include <vector>
+
+#include <TObject.h>
+
+class AliRsnMiniEvent;
+
+class AliRsnMiniMixingStore : public TObject {
+public:
+
+   AliRsnMiniMixingStore();
+   AliRsnMiniMixingStore(Bool_t continuous, Int_t nMix, Double_t maxDiffVz, Double_t maxDiffMult, Double_t maxDiffAngle, Double_t memoryBudgetMB);
+   virtual ~AliRsnMiniMixingStore();
+
+   void     GetMatches(AliRsnMiniEvent *event, std::vector<AliRsnMiniEvent*> &matches);
+   void     AddEvent(AliRsnMiniEvent *event, Int_t nMatched);
+   void     Reset();
+
+   Int_t    GetNStoredEvents()   const {return fNStored;}
+   Double_t GetMemoryUsageMB()   const {return fBytes / (1024. * 1024.);}
+   Long64_t GetNEventsAdded()    const {return fNAdded;}
+   Long64_t GetNEventsEvicted()  const {return fNEvicted;}
+   virtual void Print(Option_t *option = "") const;
+
+private:
+
+   AliRsnMiniMixingStore(const AliRsnMiniMixingStore &copy);
+   AliRsnMiniMixingStore &operator=(const AliRsnMiniMixingStore &copy);
+
+   struct Entry {
+      AliRsnMiniEvent *fEvent;
+      Int_t            fNMatched;
+      Long64_t         fSerial;
+      Double_t         fBytes;
+   };
+   typedef std::deque<Entry> EntryList;
+
+   Int_t     BinIndex(Double_t value, Double_t width) const;
+   Long64_t  BinKey(Int_t ivz, Int_t imult, Int_t iangle) const;
+   Bool_t    Match(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2) const;
+   Int_t     FindEntry(const EntryList &list, Long64_t serial) const;
+   void      RemoveEntry(EntryList &list, Int_t i, Bool_t evicted);
+
+   Bool_t    fContinuous;    ///< continuous (kTRUE) or binned mixing
+   Int_t     fNMix;          ///< required number of mixes per event
+   Double_t  fMaxDiffVz;     ///< max difference (bin width) in vz
+   Double_t  fMaxDiffMult;   ///< max difference (bin width) in multiplicity
+   Double_t  fMaxDiffAngle;  ///< max difference (bin width) in angle
+   Double_t  fBudget;        ///< memory budget in bytes
+
+   std::map<Long64_t, EntryList>                fBins;      //!<! stored events per bin
+   std::deque<std::pair<Long64_t, Long64_t> >   fOrder;     //!<! (bin, serial) of the stored events in order of arrival
+   std::vector<Long64_t>                        fTouched;   //!<! bins of the last matches
+   std::vector<std::pair<Long64_t, Long64_t> >  fCandidates;//!<! (serial, bin) of the candidates for continuous mixing
+   Long64_t  fSerial;        //!<! serial number of the next event
+   Int_t     fNStored;       //!<! number of stored events
+   Double_t  fBytes;         //!<! approximate memory of the stored events
+   Long64_t  fNAdded;        //!<! events added
+   Long64_t  fNEvicted;      //!<! events dropped for the memory budget before being fully mixed
+
+   ClassDef(AliRsnMiniMixingStore, 1)
+};
+
+#endif
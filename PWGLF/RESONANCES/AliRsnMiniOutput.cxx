@@ -54,7 +54,14 @@ AliRsnMiniOutput::AliRsnMiniOutput() :
    fKeepDfromBOnly(kFALSE),
    fRejectIfNoQuark(kFALSE),
    fCheckHistRange(kTRUE),
-   fCheckSameCutID(kFALSE)
+   fCheckSameCutID(kFALSE),
+   fOutputObj(0x0),
+   fOutputDim(-1),
+   fPairFollowers(0),
+   fIsPairFollower(kFALSE),
+   fCacheValues(0),
+   fCacheStamps(0),
+   fCachePair(0)
 {
 //
 // Constructor
@@ -89,7 +96,14 @@ AliRsnMiniOutput::AliRsnMiniOutput(const char *name, EOutputType type, EComputat
    fKeepDfromBOnly(kFALSE),
    fRejectIfNoQuark(kFALSE),
    fCheckHistRange(kTRUE),
-   fCheckSameCutID(kFALSE)
+   fCheckSameCutID(kFALSE),
+   fOutputObj(0x0),
+   fOutputDim(-1),
+   fPairFollowers(0),
+   fIsPairFollower(kFALSE),
+   fCacheValues(0),
+   fCacheStamps(0),
+   fCachePair(0)
 {
 //
 // Constructor
@@ -124,7 +138,14 @@ AliRsnMiniOutput::AliRsnMiniOutput(const char *name, const char *outType, const
    fKeepDfromBOnly(kFALSE),
    fRejectIfNoQuark(kFALSE),
    fCheckHistRange(kTRUE),
-   fCheckSameCutID(kFALSE)
+   fCheckSameCutID(kFALSE),
+   fOutputObj(0x0),
+   fOutputDim(-1),
+   fPairFollowers(0),
+   fIsPairFollower(kFALSE),
+   fCacheValues(0),
+   fCacheStamps(0),
+   fCachePair(0)
 {
 //
 // Constructor, with a more user friendly implementation, where
@@ -217,7 +238,14 @@ AliRsnMiniOutput::AliRsnMiniOutput(const AliRsnMiniOutput &copy) :
    fKeepDfromBOnly(kFALSE),
    fRejectIfNoQuark(kFALSE),
    fCheckHistRange(copy.fCheckHistRange),
-   fCheckSameCutID(copy.fCheckSameCutID)
+   fCheckSameCutID(copy.fCheckSameCutID),
+   fOutputObj(0x0),
+   fOutputDim(-1),
+   fPairFollowers(0),
+   fIsPairFollower(kFALSE),
+   fCacheValues(0),
+   fCacheStamps(0),
+   fCachePair(0)
 {
 //
 // Copy constructor
@@ -271,6 +299,10 @@ AliRsnMiniOutput &AliRsnMiniOutput::operator=(const AliRsnMiniOutput &copy)
    fRejectIfNoQuark = copy.fRejectIfNoQuark;
    fCheckHistRange = copy.fCheckHistRange;
    fCheckSameCutID = copy.fCheckSameCutID;
+   fOutputObj = 0x0;
+   fOutputDim = -1;
+   ClearPairFollowers();
+   fIsPairFollower = kFALSE;
 
    return (*this);
 }
@@ -347,6 +379,8 @@ Bool_t AliRsnMiniOutput::Init(const char *prefix, TList *list)
    }
 
    fList = list;
+   fOutputObj = 0x0;
+   fOutputDim = -1;
    Int_t size = fAxes.GetEntries();
    if (size < 1) {
       AliWarning(Form("[%s] Cannot initialize histogram with less than 1 axis", GetName()));
@@ -772,14 +806,28 @@ Int_t AliRsnMiniOutput::FillPair(AliRsnMiniEvent *event1, AliRsnMiniEvent *event
 	  		}
 		    }
          }
-         // check pair against cuts
-         if (fPairCuts) {
-            if (!fPairCuts->IsSelected(&fPair)) continue;
+         // no followers: check pair against cuts, get computed values & fill histogram
+         if (fPairFollowers.IsEmpty()) {
+            if (fPairCuts) {
+               if (!fPairCuts->IsSelected(&fPair)) continue;
+            }
+            nadded++;
+            if (refFirst) ComputeValues(event1, valueList); else ComputeValues(event2, valueList);
+            FillHistogram();
+            continue;
+         }
+         // same for this output and all outputs with the same pair definition,
+         // each value being computed only once for the pair
+         fCachePair++;
+         for (Int_t iout = -1; iout < fPairFollowers.GetEntriesFast(); iout++) {
+            AliRsnMiniOutput *out = (iout < 0 ? this : (AliRsnMiniOutput *)fPairFollowers.UncheckedAt(iout));
+            if (out->fPairCuts) {
+               if (!out->fPairCuts->IsSelected(&fPair)) continue;
+            }
+            nadded++;
+            out->ComputeValues((refFirst ? event1 : event2), valueList, &fPair, this);
+            out->FillHistogram();
          }
-         // get computed values & fill histogram
-         nadded++;
-         if (refFirst) ComputeValues(event1, valueList); else ComputeValues(event2, valueList);
-         FillHistogram();
       } // end internal loop
    } // end external loop
 
@@ -813,12 +861,76 @@ void AliRsnMiniOutput::SetDselection(UShort_t originDselection)
 	
 	return;
 }
+//________________________________________________________________________________________
+Bool_t AliRsnMiniOutput::HasSamePairDefinition(const AliRsnMiniOutput *other) const
+{
+//
+// True if the other output builds and selects exactly the same pairs
+// as this one before the pair cuts, i.e. the two can share the pair loop
+//
+
+   if (!other || !IsPairComputation()) return kFALSE;
+   if (fComputation != other->fComputation) return kFALSE;
+   for (Int_t i = 0; i < 2; i++) {
+      if (fCutID[i] != other->fCutID[i]) return kFALSE;
+      if (fDaughter[i] != other->fDaughter[i]) return kFALSE;
+      if (fDaughterTrue[i] != other->fDaughterTrue[i]) return kFALSE;
+      if (fCharge[i] != other->fCharge[i]) return kFALSE;
+      if (fUseStoredMass[i] != other->fUseStoredMass[i]) return kFALSE;
+   }
+   if (fMotherPDG != other->fMotherPDG || fMotherMass != other->fMotherMass) return kFALSE;
+   if (fCheckSameCutID != other->fCheckSameCutID) return kFALSE;
+   if (fComputation == kTruePair) {
+      if (fMaxNSisters != other->fMaxNSisters || fCheckP != other->fCheckP || fCheckFeedDown != other->fCheckFeedDown) return kFALSE;
+      if (fKeepDfromB != other->fKeepDfromB || fKeepDfromBOnly != other->fKeepDfromBOnly || fRejectIfNoQuark != other->fRejectIfNoQuark) return kFALSE;
+   }
+   return kTRUE;
+}
+
+//________________________________________________________________________________________
+void AliRsnMiniOutput::AddPairFollower(AliRsnMiniOutput *out)
+{
+//
+// Fill the passed output in the pair loop of this one
+//
+
+   if (!out || out == this || out->fIsPairFollower || !HasSamePairDefinition(out)) return;
+   fPairFollowers.Add(out);
+   out->fIsPairFollower = kTRUE;
+}
+
+//________________________________________________________________________________________
+void AliRsnMiniOutput::ClearPairFollowers()
+{
+//
+// Remove all outputs filled in the pair loop of this one
+//
+
+   for (Int_t i = 0; i < fPairFollowers.GetEntriesFast(); i++) {
+      AliRsnMiniOutput *out = (AliRsnMiniOutput *)fPairFollowers.UncheckedAt(i);
+      if (out) out->fIsPairFollower = kFALSE;
+   }
+   fPairFollowers.Clear();
+}
+
 //________________________________________________________________________________________
 void AliRsnMiniOutput::ComputeValues(AliRsnMiniEvent *event, TClonesArray *valueList)
 {
 //
 // Using the arguments and the internal 'fPair' data member,
 // compute all values to be stored in the histogram
+//
+
+   ComputeValues(event, valueList, &fPair, 0x0);
+}
+
+//________________________________________________________________________________________
+void AliRsnMiniOutput::ComputeValues(AliRsnMiniEvent *event, TClonesArray *valueList, AliRsnMiniPair *pair, AliRsnMiniOutput *cache)
+{
+//
+// Compute all values to be stored in the histogram for the given pair.
+// If a cache output is passed, the values already computed for its
+// current pair are taken from there.
 //
 
    // check size of computed array
@@ -845,10 +957,41 @@ void AliRsnMiniOutput::ComputeValues(AliRsnMiniEvent *event, TClonesArray *value
          continue;
       }
       // if none of the above exit points is taken, compute value
-      fComputed[i] = val->Eval(&fPair, event);
+      if (!cache) {
+         fComputed[i] = val->Eval(pair, event);
+         continue;
+      }
+      if (cache->fCacheValues.GetSize() < nval) {
+         cache->fCacheValues.Set(nval);
+         cache->fCacheStamps.Set(nval);
+         cache->fCacheStamps.Reset(-1);
+      }
+      if (cache->fCacheStamps[ival] != cache->fCachePair) {
+         cache->fCacheValues[ival] = val->Eval(pair, event);
+         cache->fCacheStamps[ival] = cache->fCachePair;
+      }
+      fComputed[i] = cache->fCacheValues[ival];
    }
 }
 
+//________________________________________________________________________________________
+void AliRsnMiniOutput::ResolveOutput()
+{
+//
+// Find the output object in the list and its type, once
+//
+
+   fOutputObj = 0x0;
+   fOutputDim = -1;
+   if (!fList) return;
+   fOutputObj = fList->At(fOutputID);
+   if (!fOutputObj) return;
+   if (fOutputObj->InheritsFrom(TH3F::Class())) fOutputDim = 3;
+   else if (fOutputObj->InheritsFrom(TH2F::Class())) fOutputDim = 2;
+   else if (fOutputObj->InheritsFrom(TH1F::Class())) fOutputDim = 1;
+   else if (fOutputObj->InheritsFrom(THnSparseF::Class())) fOutputDim = 0;
+}
+
 //________________________________________________________________________________________
 void AliRsnMiniOutput::FillHistogram()
 {
@@ -863,15 +1006,16 @@ void AliRsnMiniOutput::FillHistogram()
       AliError("List pointer is NULL");
       return;
    }
-   TObject *obj = fList->At(fOutputID);
+   if (fOutputDim < 0 || !fOutputObj) ResolveOutput();
+   TObject *obj = fOutputObj;
 
-   if (obj->InheritsFrom(TH1F::Class())) {
+   if (fOutputDim == 1) {
       ((TH1F *)obj)->Fill(fComputed[0]);
-   } else if (obj->InheritsFrom(TH2F::Class())) {
+   } else if (fOutputDim == 2) {
       ((TH2F *)obj)->Fill(fComputed[0], fComputed[1]);
-   } else if (obj->InheritsFrom(TH3F::Class())) {
+   } else if (fOutputDim == 3) {
       ((TH3F *)obj)->Fill(fComputed[0], fComputed[1], fComputed[2]);
-   } else if (obj->InheritsFrom(THnSparseF::Class())) {
+   } else if (fOutputDim == 0) {
       THnSparseF *h = (THnSparseF *)obj;
       if (fCheckHistRange) {
          for (Int_t iAxis = 0; iAxis<h->GetNdimensions(); iAxis++) {
@@ -10,6 +10,8 @@
 // -- definition of output histogram
 //
 
+#include "TObjArray.h"
+
 #include "AliRsnEvent.h"
 #include "AliRsnDaughter.h"
 #include "AliRsnMiniParticle.h"
@@ -86,6 +88,10 @@ public:
    Bool_t          GetFillHistogramOnlyInRange() { return fCheckHistRange; }
    Short_t         GetMaxNSisters()           {return fMaxNSisters;}
    Bool_t          GetCheckSameCutID()  const {return fCheckSameCutID;}
+   Int_t           GetNAxes()           const {return fAxes.GetEntries();}
+   Bool_t          IsPairComputation()  const {return (fComputation == kTrackPair || fComputation == kTrackPairMix || fComputation == kTrackPairRotated1 || fComputation == kTrackPairRotated2 || fComputation == kTruePair);}
+   Bool_t          HasSamePairDefinition(const AliRsnMiniOutput *other) const;
+   Bool_t          IsPairFollower()     const {return fIsPairFollower;}
 
    void            SetOutputType(EOutputType type)    {fOutputType = type;}
    void            SetComputation(EComputation src)   {fComputation = src;}
@@ -104,6 +110,8 @@ public:
    void            SetDselection(UShort_t originDselection);
    void            SetRejectCandidateIfNotFromQuark(Bool_t opt){fRejectIfNoQuark=opt;}
    void            SetCheckSameCutID(Bool_t opt=true) {fCheckSameCutID=opt;}
+   void            AddPairFollower(AliRsnMiniOutput *out);
+   void            ClearPairFollowers();
 
    void            AddAxis(Int_t id, Int_t nbins, Double_t min, Double_t max);
    void            AddAxis(Int_t id, Double_t min, Double_t max, Double_t step);
@@ -126,6 +134,8 @@ private:
    void   CreateHistogram(const char *name);
    void   CreateHistogramSparse(const char *name);
    void   ComputeValues(AliRsnMiniEvent *event, TClonesArray *valueList);
+   void   ComputeValues(AliRsnMiniEvent *event, TClonesArray *valueList, AliRsnMiniPair *pair, AliRsnMiniOutput *cache);
+   void   ResolveOutput();
    void   FillHistogram();
 
    EOutputType      fOutputType;       //  type of output
@@ -156,7 +166,15 @@ private:
    Bool_t           fCheckHistRange;   //  check if values is in histogram range
    Bool_t           fCheckSameCutID; // alternate check for whether the two daughters are of the same type, using fCutID instead of fDaughter
 
-   ClassDef(AliRsnMiniOutput, 7)  // AliRsnMiniOutput class
+   TObject         *fOutputObj;        //! output object, resolved at the first filling
+   Int_t            fOutputDim;        //! dimension of the TH1/2/3 output, 0 for THnSparse, -1 if not resolved
+   TObjArray        fPairFollowers;    //! outputs with the same pair definition filled in the pair loop of this one
+   Bool_t           fIsPairFollower;   //! filled in the pair loop of another output
+   TArrayD          fCacheValues;      //! values computed for the current pair, shared with the followers
+   TArrayI          fCacheStamps;      //! pair count at which each value of the cache was computed
+   Int_t            fCachePair;        //! pair count of the current pair
+
+   ClassDef(AliRsnMiniOutput, 8)  // AliRsnMiniOutput class
 };
 
 #endif
@@ -71,6 +71,7 @@
 #pragma link C++ class AliRsnMiniOutput+;
 #pragma link C++ class AliRsnMiniValue+;
 #pragma link C++ class AliRsnMiniMonitor+;
+#pragma link C++ class AliRsnMiniMixingStore+;
 #pragma link C++ class AliRsnMiniAnalysisTask+;
 #pragma link C++ class AliRsnMiniMonitorTask+;
 #pragma link C++ class AliRsnMiniResonanceFinder+;
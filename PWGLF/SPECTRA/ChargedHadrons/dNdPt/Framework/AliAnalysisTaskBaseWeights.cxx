@@ -325,9 +325,9 @@ void AliAnalysisTaskBaseWeights::AnaTrackMC(Int_t flag) {
 
     // get the scaling factor
     fMCweight = fMCSpectraWeights->GetMCSpectraWeightNominal(
-                                                             fMCParticle->Particle());
+                                                             fMCParticle->Particle(), fMCLabel);
     fMCweightSys = fMCSpectraWeights->GetMCSpectraWeightSystematics(
-                                                                    fMCParticle->Particle());
+                                                                    fMCParticle->Particle(), fMCLabel);
     fMCweightRandom = GetRandomRoundDouble(fMCweight);
     fMCweightSysRandom = GetRandomRoundDouble(fMCweightSys);
 
@@ -390,9 +390,9 @@ void AliAnalysisTaskBaseWeights::AnaParticleMC(Int_t flag) {
 
     // get the scaling factor
     fMCweight = fMCSpectraWeights->GetMCSpectraWeightNominal(
-                                                             fMCParticle->Particle());
+                                                             fMCParticle->Particle(), fMCLabel);
     fMCweightSys = fMCSpectraWeights->GetMCSpectraWeightSystematics(
-                                                                    fMCParticle->Particle());
+                                                                    fMCParticle->Particle(), fMCLabel);
     fMCweightRandom = GetRandomRoundDouble(fMCweight);
     fMCweightSysRandom = GetRandomRoundDouble(fMCweightSys);
 
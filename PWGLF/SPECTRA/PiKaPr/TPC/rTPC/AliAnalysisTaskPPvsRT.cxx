@@ -14,6 +14,7 @@
  *************************************************************************/
 
 #include "AliAnalysisTaskPPvsRT.h"
+#include "AliMultRTService.h"
 
 // ROOT includes
 #include <TList.h>
@@ -150,7 +151,8 @@ fEtaCalibration(0x0),
 fEtaCalibrationEl(0x0),
 fcutDCAxy(0x0),
 fcutLow(0x0),
-fcutHigh(0x0)
+fcutHigh(0x0),
+fMultRT(0x0)
 
 {
     
@@ -279,7 +281,8 @@ fEtaCalibration(0x0),
 fEtaCalibrationEl(0x0),
 fcutDCAxy(0x0),
 fcutLow(0x0),
-fcutHigh(0x0)
+fcutHigh(0x0),
+fMultRT(0x0)
 
 {
     
@@ -519,6 +522,16 @@ void AliAnalysisTaskPPvsRT::UserCreateOutputObjects()
     fcutDCAxy->SetParameter(0,0.0105);
     fcutDCAxy->SetParameter(1,0.0350);
     fcutDCAxy->SetParameter(2,1.1);
+
+    // leading track (golden cuts and DCAxy) and regions (fTrackFilter) in one pass over the tracks
+    fMultRT = new AliMultRTService();
+    fMultRT->SetTrackFilter(fTrackFilter);
+    fMultRT->SetLeadingFilter(fTrackFilterGolden);
+    fMultRT->SetLeadingMaxDCAxy(fcutDCAxy);
+    fMultRT->SetEtaCut(fEtaCut);
+    fMultRT->SetPtMin(0.15);
+    fMultRT->SetLeadingPtMin(fLeadingCut);
+    fMultRT->SetMeanNchTransverse(fMeanChT);
     
     fcutLow = new TF1("StandardPhiCutLow",  "0.1/x/x+TMath::Pi()/18.0-0.025", 0, 50);
     fcutHigh = new TF1("StandardPhiCutHigh", "0.12/x+TMath::Pi()/18.0+0.035", 0, 50);
@@ -814,6 +827,8 @@ void AliAnalysisTaskPPvsRT::UserExec(Option_t *)
     
     if (fAnalysisType == "ESD"){
         
+        fMultRT->Process(fESD);
+        fMultRT->Publish(fESD);
         
         AliESDtrack* LeadingTrack = GetLeadingTrack();
         if(!LeadingTrack)
@@ -873,77 +888,12 @@ void AliAnalysisTaskPPvsRT::UserExec(Option_t *)
 //_____________________________________________________________________________
 AliESDtrack* AliAnalysisTaskPPvsRT::GetLeadingTrack(){
     
-    TObjArray* fTrks = new TObjArray();
-    
-    for(Int_t it = 0; it < fESD->GetNumberOfTracks(); ++it){
-        
-        AliESDtrack* esdTrack = fESD->GetTrack(it);
-        if(!esdTrack)
-            continue;
-        
-        if(TMath::Abs(esdTrack->Eta()) > fEtaCut)
-            continue;
-        
-        if(esdTrack->Pt() < 0.15)
-            continue;
-        
-        UInt_t selectDebug = 0;
-        if(fTrackFilterGolden){
-            selectDebug = fTrackFilterGolden->IsSelected(esdTrack);
-            if (!selectDebug)
-                continue;
-        }
-        
-        Float_t dcaxy = 0.;
-        Float_t dcaz = 0.;
-        esdTrack->GetImpactParameters(dcaxy,dcaz);
-        
-        if( TMath::Abs(dcaxy) > GetMaxDCApTDep(fcutDCAxy,esdTrack->Pt()) )
-            continue;
-        
-        fTrks->Add(esdTrack);
-        
-    }
-    
-    Int_t nAccTrks = fTrks->GetEntriesFast();
-    if(!nAccTrks)
-        return 0x0;
-    
-    double *PtTrks = new double[nAccTrks];
-    for(Int_t it=0; it<nAccTrks; it++){
-        
-        AliESDtrack* trk = (AliESDtrack*)(fTrks->At(it));
-        if(!trk)
-            continue;
-        
-        PtTrks[it] = trk->Pt();
-    }
-    
-    Double_t LeadingPt = TMath::MaxElement(nAccTrks, PtTrks);
-    AliESDtrack *LeadingTrk=0x0;
-    
-    for(Int_t it = 0; it < nAccTrks; ++it){
-        
-        AliESDtrack* trk = (AliESDtrack*)(fTrks->At(it));
-        if(!trk)
-            continue;
-        
-        if(trk->Pt() == LeadingPt){
-            LeadingTrk = (AliESDtrack*)(fTrks->At(it));
-            break;
-        }
-    }
-     
-    delete[] PtTrks;
-    delete fTrks;
-    PtTrks = 0x0;
-    fTrks = 0x0;
-    
-    if(LeadingTrk->Pt() < fLeadingCut)
+    // found by the service, above fLeadingCut
+    Int_t index = fMultRT->GetLeadingIndex();
+    if(index < 0)
         return 0x0;
     
-    else
-        return LeadingTrk;
+    return fESD->GetTrack(index);
     
 }
 //_____________________________________________________________________________
@@ -1002,62 +952,51 @@ TObjArray* AliAnalysisTaskPPvsRT::SortRegions(AliESDtrack* Ltrk)
     ArrayRegions->AddLast(away);
     ArrayRegions->AddLast(transverse);
     
-    for(Int_t it = 0; it < fESD->GetNumberOfTracks(); ++it){
-        
-        AliESDtrack* esdTrack = fESD->GetTrack(it);
-        if(!esdTrack)
-            continue;
-        
-        if(TMath::Abs(esdTrack->Eta()) > fEtaCut)
-            continue;
-        
-        if(esdTrack->Pt() < 0.15)
-            continue;
-        
-        if(Ltrk == esdTrack)
-            continue;
+    // tracks of the regions from the service
+    for(Int_t r = 0; r < AliMultRTService::kNRegions; ++r){
         
-        UInt_t selectDebug = 0;
-        if(fTrackFilter){
-            selectDebug = fTrackFilter->IsSelected(esdTrack);
-            if (!selectDebug)
+        const std::vector<Int_t>& indices = fMultRT->GetTrackIndices(r);
+        for(UInt_t it = 0; it < indices.size(); ++it){
+            
+            AliESDtrack* esdTrack = fESD->GetTrack(indices[it]);
+            if(!esdTrack)
                 continue;
+            
+            Double_t dphi = DeltaPhi(esdTrack->Phi(),Ltrk->Phi());
+            fDphi->Fill(dphi);
+            
+            if( r == AliMultRTService::kToward ){
+                near  ->Add(esdTrack);
+                fPtN  ->Fill(esdTrack->Pt());
+                fDphiN->Fill(dphi);
+            }
+            
+            else if( r == AliMultRTService::kAway ){
+                away  ->Add(esdTrack);
+                fPtA  ->Fill(esdTrack->Pt());
+                fDphiA->Fill(dphi);
+            }
+            else{
+                transverse->Add(esdTrack);
+                fPtT  ->Fill(esdTrack->Pt());
+                fDphiT->Fill(dphi);
+            }
+            
+            Int_t nh = -1;
+            if(TMath::Abs(esdTrack->Eta())<0.2)
+                nh = 0;
+            else if(TMath::Abs(esdTrack->Eta())>=0.2 && TMath::Abs(esdTrack->Eta())<0.4)
+                nh = 1;
+            else if(TMath::Abs(esdTrack->Eta())>=0.4 && TMath::Abs(esdTrack->Eta())<0.6)
+                nh = 2;
+            else if(TMath::Abs(esdTrack->Eta())>=0.6 && TMath::Abs(esdTrack->Eta())<0.8)
+                nh = 3;
+            
+            if(nh<0)
+                continue;
+            
+            hPtVsP[nh]->Fill(esdTrack->P(),esdTrack->Pt());
         }
-        
-        Double_t dphi = DeltaPhi(esdTrack->Phi(),Ltrk->Phi());
-        fDphi->Fill(dphi);
-        
-        if( TMath::Abs(dphi) < TMath::Pi()/3 ){
-            near  ->Add(esdTrack);
-            fPtN  ->Fill(esdTrack->Pt());
-            fDphiN->Fill(dphi);
-        }
-        
-        else if( TMath::Abs(dphi-TMath::Pi()) < TMath::Pi()/3 ){
-            away  ->Add(esdTrack);
-            fPtA  ->Fill(esdTrack->Pt());
-            fDphiA->Fill(dphi);
-        }
-        else{
-            transverse->Add(esdTrack);
-            fPtT  ->Fill(esdTrack->Pt());
-            fDphiT->Fill(dphi);
-        }
-        
-        Int_t nh = -1;
-        if(TMath::Abs(esdTrack->Eta())<0.2)
-            nh = 0;
-        else if(TMath::Abs(esdTrack->Eta())>=0.2 && TMath::Abs(esdTrack->Eta())<0.4)
-            nh = 1;
-        else if(TMath::Abs(esdTrack->Eta())>=0.4 && TMath::Abs(esdTrack->Eta())<0.6)
-            nh = 2;
-        else if(TMath::Abs(esdTrack->Eta())>=0.6 && TMath::Abs(esdTrack->Eta())<0.8)
-            nh = 3;
-        
-        if(nh<0)
-            continue;
-        
-        hPtVsP[nh]->Fill(esdTrack->P(),esdTrack->Pt());
     }
     
     fMultN->Fill(near->GetEntries());
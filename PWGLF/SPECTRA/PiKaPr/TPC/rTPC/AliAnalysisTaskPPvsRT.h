@@ -32,6 +32,8 @@
 
 
 
+class AliMultRTService;
+
 class AliAnalysisTaskPPvsRT : public AliAnalysisTaskSE
 {
 public:
@@ -217,6 +219,7 @@ private:
     TF1* fcutDCAxy;
     TF1* fcutLow;
     TF1* fcutHigh;
+    AliMultRTService* fMultRT;          //! leading track and regions, shared through the event list
     
     
     AliAnalysisTaskPPvsRT(const AliAnalysisTaskPPvsRT&);            // not implemented
@@ -224,7 +227,7 @@ private:
     
     //TTree*        fTree;              //! Debug tree
     
-    ClassDef(AliAnalysisTaskPPvsRT, 1);    //Analysis task for high pt analysis
+    ClassDef(AliAnalysisTaskPPvsRT, 2);    //Analysis task for high pt analysis
 };
 
 #endif
@@ -32,6 +32,8 @@
 
 
 
+class AliMultRTService;
+
 class AliAnalysisTaskPPvsRT_TPCTOF : public AliAnalysisTaskSE
 {
 public:
@@ -186,6 +188,7 @@ private:
     TF1* fcutDCAxy;
     TF1* fcutLow;
     TF1* fcutHigh;
+    AliMultRTService* fMultRT;          //! leading track and regions, shared through the event list
     
     
     AliAnalysisTaskPPvsRT_TPCTOF(const AliAnalysisTaskPPvsRT_TPCTOF&);            // not implemented
@@ -193,7 +196,7 @@ private:
     
     //TTree*        fTree;              //! Debug tree
     
-    ClassDef(AliAnalysisTaskPPvsRT_TPCTOF, 1);    //Analysis task for high pt analysis
+    ClassDef(AliAnalysisTaskPPvsRT_TPCTOF, 2);    //Analysis task for high pt analysis
 };
 
 #endif
@@ -0,0 +1,199 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// Multiplicity estimators and RT of an event, see header
+
+#include "AliMultRTService.h"
+
+// ROOT includes
+#include <TMath.h>
+#include <TF1.h>
+
+// AliRoot includes
+#include <AliVEvent.h>
+#include <AliVHeader.h>
+#include <AliVTrack.h>
+#include <AliVMultiplicity.h>
+#include <AliESDtrack.h>
+#include <AliAnalysisFilter.h>
+#include <AliMultSelection.h>
+
+ClassImp(AliMultRTService)
+
+//_____________________________________________________________________________
+AliMultRTService::AliMultRTService(const char* name):
+TNamed(name,name),
+fTrackFilter(0x0),
+fLeadingFilter(0x0),
+fLeadingMaxDCAxy(0x0),
+fEtaCut(0.8),
+fPtMin(0.15),
+fLeadingPtMin(5.0),
+fTrackletEtaCut(1.0),
+fMeanNchT(7.11),
+fEventKey(0),
+fHasEvent(kFALSE),
+fLeadingIndex(-1),
+fLeadingPt(0),
+fLeadingPhi(0),
+fRT(-1),
+fRegion(),
+fAccepted(),
+fPhi()
+{
+    for(Int_t i = 0; i < kNEstimators; ++i) fEstimators[i] = -1;
+    for(Int_t r = 0; r < kNRegions; ++r) fNchRegion[r] = 0;
+}
+//_____________________________________________________________________________
+AliMultRTService::~AliMultRTService()
+{
+}
+//_____________________________________________________________________________
+AliMultRTService* AliMultRTService::Find(AliVEvent* ev, const char* name)
+{
+    if(!ev)
+        return 0x0;
+    return dynamic_cast<AliMultRTService*>(ev->FindListObject(name));
+}
+//_____________________________________________________________________________
+void AliMultRTService::Publish(AliVEvent* ev)
+{
+    if(ev && !ev->FindListObject(GetName()))
+        ev->AddObject(this);
+}
+//_____________________________________________________________________________
+Int_t AliMultRTService::RegionOf(Double_t dPhi)
+{
+    // dPhi in [-pi/2, 3pi/2)
+    if( TMath::Abs(dPhi) < TMath::Pi()/3 )
+        return kToward;
+    if( TMath::Abs(dPhi-TMath::Pi()) < TMath::Pi()/3 )
+        return kAway;
+    return kTransverse;
+}
+//_____________________________________________________________________________
+Bool_t AliMultRTService::AcceptLeading(AliVTrack* track) const
+{
+    if(fLeadingFilter && !fLeadingFilter->IsSelected(track))
+        return kFALSE;
+
+    if(fLeadingMaxDCAxy){
+        AliESDtrack* esdTrack = dynamic_cast<AliESDtrack*>(track);
+        if(esdTrack){
+            Float_t dcaxy = 0.;
+            Float_t dcaz = 0.;
+            esdTrack->GetImpactParameters(dcaxy,dcaz);
+            if( TMath::Abs(dcaxy) > fLeadingMaxDCAxy->Eval(esdTrack->Pt()) )
+                return kFALSE;
+        }
+    }
+
+    return kTRUE;
+}
+//_____________________________________________________________________________
+Bool_t AliMultRTService::Process(AliVEvent* ev)
+{
+    if(!ev)
+        return kFALSE;
+
+    // same event as before: run, event id and number of tracks
+    ULong64_t key = ev->GetHeader() ? ev->GetHeader()->GetEventIdAsLong() : 0;
+    key ^= ((ULong64_t)ev->GetRunNumber()<<40) ^ ((ULong64_t)ev->GetNumberOfTracks()<<20);
+    if(fHasEvent && key == fEventKey)
+        return kTRUE;
+    fEventKey = key;
+    fHasEvent = kTRUE;
+
+    AliMultSelection* multSelection = (AliMultSelection*)ev->FindListObject("MultSelection");
+    fEstimators[kV0M]          = multSelection ? multSelection->GetMultiplicityPercentile("V0M") : -1;
+    fEstimators[kSPDTracklets] = multSelection ? multSelection->GetMultiplicityPercentile("SPDTracklets") : -1;
+
+    Int_t nTracklets = 0;
+    AliVMultiplicity* mult = ev->GetMultiplicity();
+    if(mult){
+        for(Int_t i = 0; i < mult->GetNumberOfTracklets(); ++i){
+            Double_t eta = -TMath::Log(TMath::Tan(mult->GetTheta(i)/2.));
+            if(TMath::Abs(eta) < fTrackletEtaCut)
+                nTracklets++;
+        }
+    }
+    fEstimators[kNTracklets] = nTracklets;
+
+    // one pass: accepted tracks and leading track
+    const Int_t nTracks = ev->GetNumberOfTracks();
+    fRegion.assign(nTracks,-1);
+    fAccepted.clear();
+    fPhi.clear();
+    fLeadingIndex = -1;
+    fLeadingPt = 0;
+    fLeadingPhi = 0;
+
+    for(Int_t i = 0; i < nTracks; ++i){
+
+        AliVTrack* track = static_cast<AliVTrack*>(ev->GetTrack(i));
+        if(!track)
+            continue;
+
+        if(TMath::Abs(track->Eta()) > fEtaCut)
+            continue;
+
+        if(track->Pt() < fPtMin)
+            continue;
+
+        if(track->Pt() > fLeadingPt && AcceptLeading(track)){
+            fLeadingPt  = track->Pt();
+            fLeadingPhi = track->Phi();
+            fLeadingIndex = i;
+        }
+
+        if(fTrackFilter && !fTrackFilter->IsSelected(track))
+            continue;
+
+        fAccepted.push_back(i);
+        fPhi.push_back(track->Phi());
+    }
+
+    fEstimators[kNch] = fAccepted.size();
+
+    if(fLeadingIndex >= 0 && fLeadingPt < fLeadingPtMin)
+        fLeadingIndex = -1;
+
+    for(Int_t r = 0; r < kNRegions; ++r){
+        fNchRegion[r] = 0;
+        fTrackIndices[r].clear();
+    }
+    fRT = -1;
+
+    if(fLeadingIndex < 0)
+        return kTRUE;
+
+    // regions with respect to the leading track, dphi in [-pi/2, 3pi/2)
+    const Double_t twoPi = 2*TMath::Pi();
+    for(UInt_t j = 0; j < fAccepted.size(); ++j){
+        if(fAccepted[j] == fLeadingIndex)
+            continue;
+        Double_t dPhi = fLeadingPhi - fPhi[j];
+        if(dPhi < -TMath::PiOver2())        dPhi += twoPi;
+        else if(dPhi >= 3*TMath::PiOver2()) dPhi -= twoPi;
+        Int_t r = RegionOf(dPhi);
+        fRegion[fAccepted[j]] = r;
+        fTrackIndices[r].push_back(fAccepted[j]);
+        fNchRegion[r]++;
+    }
+
+    fRT = (fMeanNchT > 0) ? fNchRegion[kTransverse]/fMeanNchT : -1;
+
+    return kTRUE;
+}
@@ -0,0 +1,94 @@
+#ifndef AliMultRTService_H
+#define AliMultRTService_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice */
+/* $Id$ */
+
+// Multiplicity estimators and RT of an event, computed in one pass over the tracks
+// (leading-track search included) and shared by the tasks of a train through the
+// event list: the first task publishes the service, the others find it.
+
+#include <TNamed.h>
+#include <vector>
+
+class AliVEvent;
+class AliVTrack;
+class AliAnalysisFilter;
+class TF1;
+
+class AliMultRTService : public TNamed
+{
+public:
+    enum ERegion { kToward = 0, kAway, kTransverse, kNRegions };
+    enum EEstimator { kV0M = 0,          // percentile from AliMultSelection
+                      kSPDTracklets,     // percentile from AliMultSelection
+                      kNTracklets,       // SPD tracklets in |eta| < fTrackletEtaCut
+                      kNch,              // accepted tracks
+                      kNEstimators };
+
+    AliMultRTService(const char* name = "MultRTService");
+    virtual ~AliMultRTService();
+
+    static AliMultRTService* Find(AliVEvent* ev, const char* name = "MultRTService");
+    void Publish(AliVEvent* ev);
+
+    // tracks of the regions; the leading track is searched among the tracks accepted by the
+    // leading filter (region filter if not set) passing the pT dependent DCAxy cut (ESD, if set)
+    void SetTrackFilter(AliAnalysisFilter* filter) { fTrackFilter = filter; fHasEvent = kFALSE; }
+    void SetLeadingFilter(AliAnalysisFilter* filter) { fLeadingFilter = filter; fHasEvent = kFALSE; }
+    void SetLeadingMaxDCAxy(TF1* maxDCAxy) { fLeadingMaxDCAxy = maxDCAxy; fHasEvent = kFALSE; }
+    void SetEtaCut(Double_t etaCut) { fEtaCut = etaCut; fHasEvent = kFALSE; }
+    void SetPtMin(Double_t ptMin) { fPtMin = ptMin; fHasEvent = kFALSE; }
+    void SetLeadingPtMin(Double_t ptMin) { fLeadingPtMin = ptMin; fHasEvent = kFALSE; }
+    void SetTrackletEtaCut(Double_t etaCut) { fTrackletEtaCut = etaCut; fHasEvent = kFALSE; }
+    void SetMeanNchTransverse(Double_t meanNch) { fMeanNchT = meanNch; fHasEvent = kFALSE; }
+
+    // per event; repeated calls for the same event return the cached result
+    Bool_t Process(AliVEvent* ev);
+    void Reset() { fEventKey = 0; fHasEvent = kFALSE; }
+
+    Double_t GetEstimator(Int_t est) const { return fEstimators[est]; }
+    // leading track, index -1 if none above the leading pT threshold
+    Int_t GetLeadingIndex() const { return fLeadingIndex; }
+    Double_t GetLeadingPt() const { return fLeadingPt; }
+    Double_t GetLeadingPhi() const { return fLeadingPhi; }
+    Int_t GetNchRegion(Int_t region) const { return fNchRegion[region]; }
+    // Nch transverse / <Nch transverse>, -1 without leading track
+    Double_t GetRT() const { return fRT; }
+    // ERegion of track i of the event, -1 if not accepted, the leading track or no leading track
+    Int_t GetRegion(Int_t i) const { return (i >= 0 && i < (Int_t)fRegion.size()) ? fRegion[i] : -1; }
+    const std::vector<Int_t>& GetTrackIndices(Int_t region) const { return fTrackIndices[region]; }
+
+    static Int_t RegionOf(Double_t dPhi);
+
+private:
+    AliMultRTService(const AliMultRTService&);
+    AliMultRTService& operator=(const AliMultRTService&);
+
+    Bool_t AcceptLeading(AliVTrack* track) const;
+
+    AliAnalysisFilter* fTrackFilter;     //! not owned
+    AliAnalysisFilter* fLeadingFilter;   //! not owned
+    TF1*     fLeadingMaxDCAxy;           //! not owned
+    Double_t fEtaCut;                    //!
+    Double_t fPtMin;                     //!
+    Double_t fLeadingPtMin;              //!
+    Double_t fTrackletEtaCut;            //!
+    Double_t fMeanNchT;                  //!
+    ULong64_t fEventKey;                 //!
+    Bool_t   fHasEvent;                  //!
+    Double_t fEstimators[kNEstimators];  //!
+    Int_t    fLeadingIndex;              //!
+    Double_t fLeadingPt;                 //!
+    Double_t fLeadingPhi;                //!
+    Int_t    fNchRegion[kNRegions];      //!
+    Double_t fRT;                        //!
+    std::vector<Char_t> fRegion;         //! per track of the event
+    std::vector<Int_t> fAccepted;        //! accepted tracks of the event
+    std::vector<Double_t> fPhi;          //! phi of the accepted tracks
+    std::vector<Int_t> fTrackIndices[kNRegions]; //!
+
+    ClassDef(AliMultRTService, 1);
+};
+
+#endif
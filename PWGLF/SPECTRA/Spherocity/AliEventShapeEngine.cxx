@@ -0,0 +1,187 @@
+/**************************************************************************
+ * Copyright(c) 1998-2008, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/*
+   Class AliEventShapeEngine
+   Transverse event shapes shared by the spherocity helpers and the UE tasks
+ */
+
+#include "TMath.h"
+#include "TVector2.h"
+
+#include <vector>
+#include <algorithm>
+
+#include "AliEventShapeEngine.h"
+
+using namespace std;
+
+namespace {
+	struct PhiOrder {
+		const vector<Double_t> &fPhi;
+		PhiOrder(const vector<Double_t> &phi) : fPhi(phi) {}
+		bool operator()(Int_t a, Int_t b) const { return fPhi[a] < fPhi[b]; }
+	};
+}
+
+//_____________________________________________________________________
+Double_t AliEventShapeEngine::GetSpherocity(Int_t n, const Float_t *pt, const Float_t *phi, Bool_t isPtWeighted)
+{
+	// For an axis at angle theta the sum of |p x n| is
+	//   f(theta) = (2 Uy - Ty) cos(theta) - (2 Ux - Tx) sin(theta)
+	// with T the total momentum and U the one of the particles with phi in
+	// [theta, theta+pi[. Between two particle directions f is a positive
+	// arc of sinusoid, so its minimum is at one of the directions.
+
+	if( n <= 0 )
+		return -1.;
+
+	vector<Double_t> ang(n), px(n), py(n), cs(n), sn(n);
+	vector<Int_t> order(n);
+	Double_t sumw = 0, tx = 0, ty = 0;
+	for(Int_t i = 0; i < n; ++i){
+		ang[i] = TVector2::Phi_0_2pi(phi[i]);
+		cs[i] = TMath::Cos(ang[i]);
+		sn[i] = TMath::Sin(ang[i]);
+		Double_t w = isPtWeighted ? pt[i] : 1.0;
+		px[i] = w*cs[i];
+		py[i] = w*sn[i];
+		sumw += w;
+		tx += px[i];
+		ty += py[i];
+		order[i] = i;
+	}
+	if( sumw <= 0 )
+		return -1.;
+	sort(order.begin(), order.end(), PhiOrder(ang));
+
+	Double_t ux = 0, uy = 0;
+	Double_t fmin = sumw;
+	Int_t end = 0; // window [j, end[ in the sequence repeated twice
+	for(Int_t j = 0; j < n; ++j){
+		const Int_t ij = order[j];
+		while( end < j + n ){
+			const Int_t ie = order[end % n];
+			const Double_t a = ang[ie] + (end >= n ? TMath::TwoPi() : 0.);
+			if( a >= ang[ij] + TMath::Pi() )
+				break;
+			ux += px[ie];
+			uy += py[ie];
+			++end;
+		}
+		Double_t f = TMath::Abs( (2*uy - ty)*cs[ij] - (2*ux - tx)*sn[ij] );
+		if( f < fmin )
+			fmin = f;
+		ux -= px[ij];
+		uy -= py[ij];
+	}
+
+	return TMath::Power( fmin/sumw, 2 )*TMath::Pi()*TMath::Pi()/4.0;
+}
+
+//_____________________________________________________________________
+Double_t AliEventShapeEngine::GetSpherocityScan(Int_t n, const Float_t *pt, const Float_t *phi, Float_t stepDeg,
+		Bool_t isPtWeighted)
+{
+	if( n <= 0 || stepDeg <= 0 )
+		return -1.;
+
+	vector<Float_t> pxA(n), pyA(n);
+	Float_t sumapt = 0;
+	for(Int_t i1 = 0; i1 < n; ++i1){
+		Float_t w = isPtWeighted ? pt[i1] : 1.0;
+		pxA[i1] = w * TMath::Cos( phi[i1] );
+		pyA[i1] = w * TMath::Sin( phi[i1] );
+		sumapt += w;
+	}
+	if( sumapt <= 0 )
+		return -1.;
+
+	Float_t Spherocity = 2;
+	for(Int_t i = 0; i < 360/(stepDeg); ++i){
+		Float_t phiparam = ( (TMath::Pi()) * i * stepDeg ) / 180; // parametrization of the angle
+		Float_t nx = TMath::Cos(phiparam);
+		Float_t ny = TMath::Sin(phiparam);
+		Float_t numerador = 0;
+		for(Int_t i1 = 0; i1 < n; ++i1)
+			numerador += TMath::Abs( ny * pxA[i1] - nx * pyA[i1] );
+		Float_t pFull = TMath::Power( (numerador / sumapt),2 );
+		if(pFull < Spherocity)
+			Spherocity = pFull;
+	}
+
+	return ((Spherocity)*TMath::Pi()*TMath::Pi())/4.0;
+}
+
+//_____________________________________________________________________
+Double_t AliEventShapeEngine::GetSphericity(Int_t n, const Float_t *pt, const Float_t *phi)
+{
+	Double_t s00 = 0, s01 = 0, s11 = 0, totalpt = 0;
+	for(Int_t i1 = 0; i1 < n; ++i1){
+		if( pt[i1] <= 0 )
+			continue;
+		Double_t px = pt[i1] * TMath::Cos( phi[i1] );
+		Double_t py = pt[i1] * TMath::Sin( phi[i1] );
+		s00 += (px * px)/pt[i1];
+		s01 += (py * px)/pt[i1];
+		s11 += (py * py)/pt[i1];
+		totalpt += pt[i1];
+	}
+	if( totalpt <= 0 )
+		return 0.;
+
+	Double_t S00 = s00/totalpt;
+	Double_t S01 = s01/totalpt;
+	Double_t S11 = s11/totalpt;
+	Double_t root = TMath::Sqrt( TMath::Max( (S00-S11)*(S00-S11) + 4*S01*S01, 0. ) );
+	Double_t lambda1 = ( (S00+S11) + root )/2;
+	Double_t lambda2 = ( (S00+S11) - root )/2;
+	if( lambda1 + lambda2 == 0 )
+		return 0.;
+	return 2*TMath::Min( lambda1, lambda2 )/( lambda1 + lambda2 );
+}
+
+//_____________________________________________________________________
+Int_t AliEventShapeEngine::GetNTransverse(Int_t n, const Float_t *pt, const Float_t *phi, Float_t minLeadingPt,
+		Int_t *leading)
+{
+	Int_t lead = -1;
+	for(Int_t i = 0; i < n; ++i)
+		if( lead < 0 || pt[i] > pt[lead] )
+			lead = i;
+	if( leading )
+		*leading = lead;
+	if( lead < 0 || pt[lead] < minLeadingPt )
+		return -1;
+
+	Int_t nt = 0;
+	for(Int_t i = 0; i < n; ++i){
+		if( i == lead )
+			continue;
+		Double_t dphi = TMath::Abs( TVector2::Phi_mpi_pi( phi[i] - phi[lead] ) );
+		if( dphi > TMath::Pi()/3.0 && dphi < 2.0*TMath::Pi()/3.0 )
+			++nt;
+	}
+	return nt;
+}
+
+//_____________________________________________________________________
+Double_t AliEventShapeEngine::GetRT(Int_t n, const Float_t *pt, const Float_t *phi, Double_t meanNT, Float_t minLeadingPt)
+{
+	Int_t nt = GetNTransverse( n, pt, phi, minLeadingPt );
+	if( nt < 0 || meanNT <= 0 )
+		return -1.;
+	return nt/meanNT;
+}
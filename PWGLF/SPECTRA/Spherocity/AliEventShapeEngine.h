@@ -0,0 +1,38 @@
+#ifndef AliEventShapeEngine_H
+#define AliEventShapeEngine_H
+/* Copyright(c) 1998-2008, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//*****************************************************
+//   Class AliEventShapeEngine
+//   Transverse event shapes (spherocity, sphericity, RT)
+//   computed on plain arrays of the particle pT and phi
+//*****************************************************
+
+#include <Rtypes.h>
+
+class AliEventShapeEngine {
+
+	public:
+
+		// Exact transverse spherocity: the minimum over the axis lies at the
+		// direction of one of the particles (modulo pi), found sorting in phi
+		// and sweeping the half plane, O(N log N). Returns -1 for no particles.
+		static Double_t GetSpherocity(Int_t n, const Float_t *pt, const Float_t *phi, Bool_t isPtWeighted = kTRUE);
+
+		// Spherocity minimised over the axes in steps of stepDeg degrees, as
+		// done so far in the tasks; the particle directions are computed once
+		static Double_t GetSpherocityScan(Int_t n, const Float_t *pt, const Float_t *phi, Float_t stepDeg,
+				Bool_t isPtWeighted = kTRUE);
+
+		// Transverse sphericity from the linearised (1/pT weighted) momentum tensor
+		static Double_t GetSphericity(Int_t n, const Float_t *pt, const Float_t *phi);
+
+		// Number of particles in the transverse region, pi/3 < |dphi| < 2pi/3 with
+		// respect to the leading particle; -1 if its pT is below minLeadingPt
+		static Int_t    GetNTransverse(Int_t n, const Float_t *pt, const Float_t *phi, Float_t minLeadingPt = 0.,
+				Int_t *leading = 0x0);
+		// RT = NT/<NT>, -1 for an event without leading particle
+		static Double_t GetRT(Int_t n, const Float_t *pt, const Float_t *phi, Double_t meanNT, Float_t minLeadingPt = 0.);
+};
+#endif
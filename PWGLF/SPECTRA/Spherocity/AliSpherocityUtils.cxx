@@ -30,6 +30,7 @@
 
 
 #include "AliStack.h"
+#include "AliEventShapeEngine.h"
 
 #include "AliVEvent.h"
 #include "AliESDEvent.h"
@@ -66,6 +67,7 @@ AliSpherocityUtils::AliSpherocityUtils():TObject(),
 	fAODFilterGlobal(0),
 	fMinMult(3),
 	fSizeStep(0.1),
+	fUseExact(kFALSE),
 	fIsAbsEta(kTRUE),
 	fEtaMaxCut(0.8),
 	fEtaMinCut(0.0),
@@ -90,6 +92,7 @@ AliSpherocityUtils::AliSpherocityUtils(const AliSpherocityUtils &c) :
 	fAODFilterGlobal(0),
 	fMinMult(3),
 	fSizeStep(0.1),
+	fUseExact(kFALSE),
 	fIsAbsEta(kTRUE),
 	fEtaMaxCut(0.8),
 	fEtaMinCut(0.0),
@@ -143,7 +146,10 @@ void AliSpherocityUtils::Init(){
 		cout<<"Kinematic cuts:   "<<fPtMinCut<<"<pT<"<<fPtMaxCut<<" GeV/c,   "<<fEtaMinCut<<"<|eta|<"<<fEtaMaxCut<<endl;
 	else
 		cout<<"Kinematic cuts:   "<<fPtMinCut<<"<pT<"<<fPtMaxCut<<" GeV/c,   "<<fEtaMinCut<<"<eta<"<<fEtaMinCut<<endl;
-	cout<<"Step size for spherocity calculation:"<<fSizeStep*2*TMath::Pi()/360.0<<"  radians"<<endl;
+	if(fUseExact)
+		cout<<"Exact spherocity calculation (minimum over the particle directions)"<<endl;
+	else
+		cout<<"Step size for spherocity calculation:"<<fSizeStep*2*TMath::Pi()/360.0<<"  radians"<<endl;
 	cout<<"-----------------------------------------------------------------------------------"<<endl;
 	cout<<"-----------------------------------------------------------------------------------"<<endl;
 
@@ -364,45 +370,9 @@ Int_t AliSpherocityUtils::ReadESDEvent( vector<Float_t> &ptArray,  vector<Float_
 //_____________________________________________________________________
 Float_t AliSpherocityUtils::AnalyseGetSpherocity( const vector<Float_t> &pt, const vector<Float_t> &eta, const vector<Float_t> &phi ){
 
-
-	Float_t spherocity = -10.0;
-	Float_t pFull = 0;
-	Float_t Spherocity = 2;
-
-	//computing total pt
-	Float_t sumapt = 0;
-	for(Int_t i1 = 0; i1 < fNrec; ++i1){
-		sumapt += pt[i1];
-
-	}
-
-	//Getting thrust
-	for(Int_t i = 0; i < 360/(fSizeStep); ++i){
-		Float_t numerador = 0;
-		Float_t phiparam  = 0;
-		Float_t nx = 0;
-		Float_t ny = 0;
-		phiparam=( (TMath::Pi()) * i * fSizeStep ) / 180; // parametrization of the angle
-		nx = TMath::Cos(phiparam);            // x component of an unitary vector n
-		ny = TMath::Sin(phiparam);            // y component of an unitary vector n
-		for(Int_t i1 = 0; i1 < fNrec; ++i1){
-
-			Float_t pxA = pt[i1] * TMath::Cos( phi[i1] );
-			Float_t pyA = pt[i1] * TMath::Sin( phi[i1] );
-
-			numerador += TMath::Abs( ny * pxA - nx * pyA );//product between p  proyection in XY plane and the unitary vector
-		}
-		pFull=TMath::Power( (numerador / sumapt),2 );
-		if(pFull < Spherocity)//maximization of pFull
-		{
-			Spherocity = pFull;
-		}
-	}
-
-	spherocity=((Spherocity)*TMath::Pi()*TMath::Pi())/4.0;
-
-
-	return spherocity;
+	if(fUseExact)
+		return AliEventShapeEngine::GetSpherocity( fNrec, pt.data(), phi.data() );
+	return AliEventShapeEngine::GetSpherocityScan( fNrec, pt.data(), phi.data(), fSizeStep );
 
 }
 //_____________________________________________________________________
@@ -39,6 +39,7 @@ class AliSpherocityUtils : public TObject {
 
   void  SetMinMult(Int_t minnch)        {fMinMult    = minnch;}
   void  SetStepSize(Float_t sizestep)   {fSizeStep   = sizestep;}
+  void  SetUseExact(Bool_t useexact)    {fUseExact   = useexact;} // exact minimum instead of the step scan
   void  SetIsEtaAbs(Bool_t isabseta)    {fIsAbsEta   = isabseta;}
   void  SetTrackEtaMin(Float_t etaminF) {fEtaMinCut  = etaminF;}
   void  SetTrackEtaMax(Float_t etamaxF) {fEtaMaxCut  = etamaxF;}
@@ -79,6 +80,7 @@ class AliSpherocityUtils : public TObject {
 
   Int_t   fMinMult;
   Float_t fSizeStep;
+  Bool_t  fUseExact;   // exact spherocity (AliEventShapeEngine) instead of the scan in fSizeStep
   Bool_t  fIsAbsEta;
   Float_t fEtaMaxCut;
   Float_t fEtaMinCut;
@@ -86,7 +88,7 @@ class AliSpherocityUtils : public TObject {
   Float_t fPtMinCut;
   Int_t   fRunNumber; // for control of run changes
 
-  ClassDef(AliSpherocityUtils,2) // base helper class
+  ClassDef(AliSpherocityUtils,3) // base helper class
 };
 #endif
 
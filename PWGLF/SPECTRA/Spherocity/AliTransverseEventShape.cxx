@@ -49,6 +49,7 @@
 #include "AliESDUtils.h"
 #include "AliESDtrackCuts.h"
 #include "AliTransverseEventShape.h"
+#include "AliEventShapeEngine.h"
 #include <TFile.h>
 #include "AliAODHeader.h"
 // STL includes
@@ -74,6 +75,7 @@ AliTransverseEventShape::AliTransverseEventShape():TObject(),
         fAODFilterGlobal(0),
 	fMinMultESA(0),
 	fSizeStepESA(0),
+	fUseExactESA(kFALSE),
 	fIsAbsEtaESA(0),
 	fEtaMaxCutESA(0),
 	fEtaMinCutESA(0),
@@ -115,6 +117,7 @@ AliTransverseEventShape::AliTransverseEventShape(const AliTransverseEventShape &
         fAODFilterGlobal(0),
 	fMinMultESA(0),
 	fSizeStepESA(0),
+	fUseExactESA(kFALSE),
 	fIsAbsEtaESA(0),
 	fEtaMaxCutESA(0),
 	fEtaMinCutESA(0),
@@ -394,44 +397,16 @@ Int_t AliTransverseEventShape::ReadESDEvent( vector<Float_t> &ptArray,  vector<F
 //_____________________________________________________________________
 Float_t AliTransverseEventShape::AnalyseGetSphericity( Bool_t fillHist, const vector<Float_t> &pt, const vector<Float_t> &eta, const vector<Float_t> &phi ){
 
-
-	Float_t sphericity = -10;
-	Float_t s00=0;
-	Float_t s01=0;
-	Float_t s11=0;
-	Float_t totalpt=0;
-
-	for(Int_t i1 = 0; i1 < fNrec; ++i1){
-
-
-		//Fill QA histos
-		if(fillHist){
+	//Fill QA histos
+	if(fillHist){
+		for(Int_t i1 = 0; i1 < fNrec; ++i1){
 			fhetaSt->Fill(eta[i1]);
 			fhphiSt->Fill(phi[i1]);
 			fhptSt->Fill(pt[i1]);
 		}
-		Float_t px = pt[i1] * TMath::Cos( phi[i1] );
-		Float_t py = pt[i1] * TMath::Sin( phi[i1] );
-
-		s00 += (px * px)/pt[i1];
-		s01 += (py * px)/pt[i1];
-		s11 += (py * py)/pt[i1];
-		totalpt += pt[i1];
 	}
 
-
-	Double_t S00=s00/totalpt;
-	Double_t S01=s01/totalpt;
-	Double_t S11=s11/totalpt;
-
-	Float_t lambda1=((S00+S11)+TMath::Sqrt((S00+S11)*(S00+S11)-4*(S00*S11-S01*S01)))/2;
-	Float_t lambda2=((S00+S11)-TMath::Sqrt((S00+S11)*(S00+S11)-4*(S00*S11-S01*S01)))/2;
-	if((lambda2==0)&&(lambda1==0))
-		sphericity=0;
-	if(lambda1+lambda2!=0)
-		sphericity=2*TMath::Min( lambda1,lambda2 )/( lambda1+lambda2 );
-
-	return sphericity;
+	return AliEventShapeEngine::GetSphericity( fNrec, pt.data(), phi.data() );
 
 }
 
@@ -439,52 +414,18 @@ Float_t AliTransverseEventShape::AnalyseGetSphericity( Bool_t fillHist, const ve
 //_____________________________________________________________________
 Float_t AliTransverseEventShape::AnalyseGetSpherocity( Bool_t fillHist, const vector<Float_t> &pt, const vector<Float_t> &eta, const vector<Float_t> &phi ){
 
-
-	Float_t spherocity = -10.0;
-	Float_t pFull = 0;
-	Float_t Spherocity = 2;
-
-	//computing total pt
-	Float_t sumapt = 0;
-	for(Int_t i1 = 0; i1 < fNrec; ++i1){
-		sumapt += pt[i1];
-
-		//Fill QA histos
-		if(fillHist){
+	//Fill QA histos
+	if(fillHist){
+		for(Int_t i1 = 0; i1 < fNrec; ++i1){
 			fhetaSo->Fill(eta[i1]);
 			fhphiSo->Fill(phi[i1]);
 			fhptSo->Fill(pt[i1]);
 		}
-
-	}
-
-	//Getting thrust
-	for(Int_t i = 0; i < 360/(fSizeStepESA); ++i){
-		Float_t numerador = 0;
-		Float_t phiparam  = 0;
-		Float_t nx = 0;
-		Float_t ny = 0;
-		phiparam=( (TMath::Pi()) * i * fSizeStepESA ) / 180; // parametrization of the angle
-		nx = TMath::Cos(phiparam);            // x component of an unitary vector n
-		ny = TMath::Sin(phiparam);            // y component of an unitary vector n
-		for(Int_t i1 = 0; i1 < fNrec; ++i1){
-
-			Float_t pxA = pt[i1] * TMath::Cos( phi[i1] );
-			Float_t pyA = pt[i1] * TMath::Sin( phi[i1] );
-
-			numerador += TMath::Abs( ny * pxA - nx * pyA );//product between p  proyection in XY plane and the unitary vector
-		}
-		pFull=TMath::Power( (numerador / sumapt),2 );
-		if(pFull < Spherocity)//maximization of pFull
-		{
-			Spherocity = pFull;
-		}
 	}
 
-	spherocity=((Spherocity)*TMath::Pi()*TMath::Pi())/4.0;
-
-
-	return spherocity;
+	if(fUseExactESA)
+		return AliEventShapeEngine::GetSpherocity( fNrec, pt.data(), phi.data() );
+	return AliEventShapeEngine::GetSpherocityScan( fNrec, pt.data(), phi.data(), fSizeStepESA );
 
 }
 //_____________________________________________________________________
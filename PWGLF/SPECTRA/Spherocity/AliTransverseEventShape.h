@@ -45,6 +45,7 @@ class AliTransverseEventShape : public TObject {
 
   void  SetMinMultForESA(Int_t minnch)     {fMinMultESA = minnch;}
   void  SetStepSizeESA(Float_t sizestep)   {fSizeStepESA = sizestep;}
+  void  SetUseExactESA(Bool_t useexact)    {fUseExactESA = useexact;} // exact spherocity instead of the step scan
   void  SetIsEtaAbsESA(Bool_t isabseta)    {fIsAbsEtaESA = isabseta;}
   void  SetTrackEtaMinESA(Float_t etaminF) {fEtaMinCutESA = etaminF;}
   void  SetTrackEtaMaxESA(Float_t etamaxF) {fEtaMaxCutESA = etamaxF;}
@@ -98,6 +99,7 @@ class AliTransverseEventShape : public TObject {
 
   Int_t   fMinMultESA;
   Float_t fSizeStepESA;
+  Bool_t  fUseExactESA; // exact spherocity (AliEventShapeEngine) instead of the scan in fSizeStepESA
   Bool_t  fIsAbsEtaESA;
   Float_t fEtaMaxCutESA;
   Float_t fEtaMinCutESA;
@@ -118,7 +120,7 @@ class AliTransverseEventShape : public TObject {
   TH1D    *fhptStMC;
 
 
-  ClassDef(AliTransverseEventShape,2) // base helper class
+  ClassDef(AliTransverseEventShape,3) // base helper class
 };
 #endif
 
@@ -120,6 +120,7 @@ class AliAODv0;
 #include "AliEventCuts.h"
 #include "AliV0Result.h"
 #include "AliCascadeResult.h"
+#include "AliCandidateTreeWriter.h"
 #include "AliPPVsMultUtils.h"
 #include "AliAnalysisTaskStrangenessVsMultiplicityEEMCRun2.h"
 
@@ -164,6 +165,10 @@ fkDownScaleCascade      ( kTRUE  ),
 fDownScaleFactorCascade ( 0.001  ),
 fMinPtToSave( 0.00   ) ,
 fMaxPtToSave( 100.00 ) ,
+fTreeFloatBits( 0 ),
+fTreeFullPrecisionBranches( "" ),
+fTreeBasketSize( 0 ),
+fTreeAutoFlush( 0 ),
 
 //---> Flags controlling sandbox mode (cascade)
 fkSandboxMode( kFALSE ),
@@ -781,6 +786,10 @@ fkDownScaleCascade      ( kTRUE  ),
 fDownScaleFactorCascade ( 0.001  ),
 fMinPtToSave( 0.00   ) ,
 fMaxPtToSave( 100.00 ) ,
+fTreeFloatBits( 0 ),
+fTreeFullPrecisionBranches( "" ),
+fTreeBasketSize( 0 ),
+fTreeAutoFlush( 0 ),
 
 //---> Flags controlling sandbox mode (cascade)
 fkSandboxMode( kFALSE ),
@@ -1536,6 +1545,8 @@ void AliAnalysisTaskStrangenessVsMultiplicityEEMCRun2::UserCreateOutputObjects()
             fTreeEvent->Branch("fAmplitudeV0C",&fAmplitudeV0C,"fAmplitudeV0C/F");
         }
     }
+    //Candidate trees: optional float packing of the branches
+    AliCandidateTreeWriter lTreeWriter(fTreeFloatBits, fTreeFullPrecisionBranches.Data());
     
     //------------------------------------------------
     // fTreeV0: V0 Candidate Information
@@ -1544,157 +1555,157 @@ void AliAnalysisTaskStrangenessVsMultiplicityEEMCRun2::UserCreateOutputObjects()
         //Create Basic V0 Output Tree
         fTreeV0 = new TTree( "fTreeV0", "V0 Candidates");
         //-----------BASIC-INFO---------------------------
-        fTreeV0->Branch("fTreeVariableRun",&fTreeVariableRun,"fTreeVariableRun/I");
-        fTreeV0->Branch("fTreeVariableEvSel_AllSelections", &fTreeVariableEvSel_AllSelections, "fTreeVariableEvSel_AllSelections/O");
-        fTreeV0->Branch("fTreeVariableChi2V0",&fTreeVariableChi2V0,"fTreeVariableChi2V0/F");
-        fTreeV0->Branch("fTreeVariableDcaV0Daughters",&fTreeVariableDcaV0Daughters,"fTreeVariableDcaV0Daughters/F");
-        fTreeV0->Branch("fTreeVariableDcaV0ToPrimVertex",&fTreeVariableDcaV0ToPrimVertex,"fTreeVariableDcaV0ToPrimVertex/F");
-        fTreeV0->Branch("fTreeVariableDcaPosToPrimVertex",&fTreeVariableDcaPosToPrimVertex,"fTreeVariableDcaPosToPrimVertex/F");
-        fTreeV0->Branch("fTreeVariableDcaNegToPrimVertex",&fTreeVariableDcaNegToPrimVertex,"fTreeVariableDcaNegToPrimVertex/F");
-        fTreeV0->Branch("fTreeVariableV0Radius",&fTreeVariableV0Radius,"fTreeVariableV0Radius/F");
-        fTreeV0->Branch("fTreeVariablePt",&fTreeVariablePt,"fTreeVariablePt/F");
-        fTreeV0->Branch("fTreeVariablePtMC",&fTreeVariablePtMC,"fTreeVariablePtMC/F");
-        fTreeV0->Branch("fTreeVariableRapK0Short",&fTreeVariableRapK0Short,"fTreeVariableRapK0Short/F");
-        fTreeV0->Branch("fTreeVariableRapLambda",&fTreeVariableRapLambda,"fTreeVariableRapLambda/F");
-        fTreeV0->Branch("fTreeVariableRapMC",&fTreeVariableRapMC,"fTreeVariableRapMC/F");
-        fTreeV0->Branch("fTreeVariableInvMassK0s",&fTreeVariableInvMassK0s,"fTreeVariableInvMassK0s/F");
-        fTreeV0->Branch("fTreeVariableInvMassLambda",&fTreeVariableInvMassLambda,"fTreeVariableInvMassLambda/F");
-        fTreeV0->Branch("fTreeVariableInvMassAntiLambda",&fTreeVariableInvMassAntiLambda,"fTreeVariableInvMassAntiLambda/F");
-        fTreeV0->Branch("fTreeVariableV0CosineOfPointingAngle",&fTreeVariableV0CosineOfPointingAngle,"fTreeVariableV0CosineOfPointingAngle/F");
-        fTreeV0->Branch("fTreeVariableAlphaV0",&fTreeVariableAlphaV0,"fTreeVariableAlphaV0/F");
-        fTreeV0->Branch("fTreeVariablePtArmV0",&fTreeVariablePtArmV0,"fTreeVariablePtArmV0/F");
-        fTreeV0->Branch("fTreeVariableLeastNbrCrossedRows",&fTreeVariableLeastNbrCrossedRows,"fTreeVariableLeastNbrCrossedRows/I");
-        fTreeV0->Branch("fTreeVariableLeastRatioCrossedRowsOverFindable",&fTreeVariableLeastRatioCrossedRowsOverFindable,"fTreeVariableLeastRatioCrossedRowsOverFindable/F");
-        fTreeV0->Branch("fTreeVariableMaxChi2PerCluster",&fTreeVariableMaxChi2PerCluster,"fTreeVariableMaxChi2PerCluster/F");
-        fTreeV0->Branch("fTreeVariableMinTrackLength",&fTreeVariableMinTrackLength,"fTreeVariableMinTrackLength/F");
-        fTreeV0->Branch("fTreeVariableDistOverTotMom",&fTreeVariableDistOverTotMom,"fTreeVariableDistOverTotMom/F");
-        fTreeV0->Branch("fTreeVariableNSigmasPosProton",&fTreeVariableNSigmasPosProton,"fTreeVariableNSigmasPosProton/F");
-        fTreeV0->Branch("fTreeVariableNSigmasPosPion",&fTreeVariableNSigmasPosPion,"fTreeVariableNSigmasPosPion/F");
-        fTreeV0->Branch("fTreeVariableNSigmasNegProton",&fTreeVariableNSigmasNegProton,"fTreeVariableNSigmasNegProton/F");
-        fTreeV0->Branch("fTreeVariableNSigmasNegPion",&fTreeVariableNSigmasNegPion,"fTreeVariableNSigmasNegPion/F");
-        fTreeV0->Branch("fTreeVariableNegEta",&fTreeVariableNegEta,"fTreeVariableNegEta/F");
-        fTreeV0->Branch("fTreeVariablePosEta",&fTreeVariablePosEta,"fTreeVariablePosEta/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableRun",&fTreeVariableRun,"fTreeVariableRun/I");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableEvSel_AllSelections",&fTreeVariableEvSel_AllSelections,"fTreeVariableEvSel_AllSelections/O");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableChi2V0",&fTreeVariableChi2V0,"fTreeVariableChi2V0/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableDcaV0Daughters",&fTreeVariableDcaV0Daughters,"fTreeVariableDcaV0Daughters/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableDcaV0ToPrimVertex",&fTreeVariableDcaV0ToPrimVertex,"fTreeVariableDcaV0ToPrimVertex/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableDcaPosToPrimVertex",&fTreeVariableDcaPosToPrimVertex,"fTreeVariableDcaPosToPrimVertex/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableDcaNegToPrimVertex",&fTreeVariableDcaNegToPrimVertex,"fTreeVariableDcaNegToPrimVertex/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableV0Radius",&fTreeVariableV0Radius,"fTreeVariableV0Radius/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariablePt",&fTreeVariablePt,"fTreeVariablePt/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariablePtMC",&fTreeVariablePtMC,"fTreeVariablePtMC/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableRapK0Short",&fTreeVariableRapK0Short,"fTreeVariableRapK0Short/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableRapLambda",&fTreeVariableRapLambda,"fTreeVariableRapLambda/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableRapMC",&fTreeVariableRapMC,"fTreeVariableRapMC/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableInvMassK0s",&fTreeVariableInvMassK0s,"fTreeVariableInvMassK0s/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableInvMassLambda",&fTreeVariableInvMassLambda,"fTreeVariableInvMassLambda/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableInvMassAntiLambda",&fTreeVariableInvMassAntiLambda,"fTreeVariableInvMassAntiLambda/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableV0CosineOfPointingAngle",&fTreeVariableV0CosineOfPointingAngle,"fTreeVariableV0CosineOfPointingAngle/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableAlphaV0",&fTreeVariableAlphaV0,"fTreeVariableAlphaV0/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariablePtArmV0",&fTreeVariablePtArmV0,"fTreeVariablePtArmV0/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableLeastNbrCrossedRows",&fTreeVariableLeastNbrCrossedRows,"fTreeVariableLeastNbrCrossedRows/I");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableLeastRatioCrossedRowsOverFindable",&fTreeVariableLeastRatioCrossedRowsOverFindable,"fTreeVariableLeastRatioCrossedRowsOverFindable/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableMaxChi2PerCluster",&fTreeVariableMaxChi2PerCluster,"fTreeVariableMaxChi2PerCluster/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableMinTrackLength",&fTreeVariableMinTrackLength,"fTreeVariableMinTrackLength/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableDistOverTotMom",&fTreeVariableDistOverTotMom,"fTreeVariableDistOverTotMom/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableNSigmasPosProton",&fTreeVariableNSigmasPosProton,"fTreeVariableNSigmasPosProton/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableNSigmasPosPion",&fTreeVariableNSigmasPosPion,"fTreeVariableNSigmasPosPion/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableNSigmasNegProton",&fTreeVariableNSigmasNegProton,"fTreeVariableNSigmasNegProton/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableNSigmasNegPion",&fTreeVariableNSigmasNegPion,"fTreeVariableNSigmasNegPion/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableNegEta",&fTreeVariableNegEta,"fTreeVariableNegEta/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariablePosEta",&fTreeVariablePosEta,"fTreeVariablePosEta/F");
         //-----------MULTIPLICITY-INFO--------------------
-        fTreeV0->Branch("fTreeVariableCentrality",&fTreeVariableCentrality,"fTreeVariableCentrality/F");
-        fTreeV0->Branch("fTreeVariableMVPileupFlag",&fTreeVariableMVPileupFlag,"fTreeVariableMVPileupFlag/O");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableCentrality",&fTreeVariableCentrality,"fTreeVariableCentrality/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableMVPileupFlag",&fTreeVariableMVPileupFlag,"fTreeVariableMVPileupFlag/O");
         if (fkDebugZDCInfo){
-        	fTreeV0->Branch("fTreeVariableZNApp", &fTreeVariableZNApp,"fTreeVariableZNApp/F");
-			fTreeV0->Branch("fTreeVariableZNCpp", &fTreeVariableZNCpp,"fTreeVariableZNCpp/F");
-			fTreeV0->Branch("fTreeVariableZPApp", &fTreeVariableZPApp,"fTreeVariableZPApp/F");
-			fTreeV0->Branch("fTreeVariableZPCpp", &fTreeVariableZPCpp,"fTreeVariableZPCpp/F");		}
+        	lTreeWriter.Branch(fTreeV0,"fTreeVariableZNApp",&fTreeVariableZNApp,"fTreeVariableZNApp/F");
+			lTreeWriter.Branch(fTreeV0,"fTreeVariableZNCpp",&fTreeVariableZNCpp,"fTreeVariableZNCpp/F");
+			lTreeWriter.Branch(fTreeV0,"fTreeVariableZPApp",&fTreeVariableZPApp,"fTreeVariableZPApp/F");
+			lTreeWriter.Branch(fTreeV0,"fTreeVariableZPCpp",&fTreeVariableZPCpp,"fTreeVariableZPCpp/F");		}
         //------------------------------------------------
-        fTreeV0->Branch("fTreeVariableIsCowboy",&fTreeVariableIsCowboy,"fTreeVariableIsCowboy/O");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableIsCowboy",&fTreeVariableIsCowboy,"fTreeVariableIsCowboy/O");
         if ( fkDebugWrongPIDForTracking ){
-            fTreeV0->Branch("fTreeVariablePosPIDForTracking",&fTreeVariablePosPIDForTracking,"fTreeVariablePosPIDForTracking/I");
-            fTreeV0->Branch("fTreeVariableNegPIDForTracking",&fTreeVariableNegPIDForTracking,"fTreeVariableNegPIDForTracking/I");
-            fTreeV0->Branch("fTreeVariablePosdEdx",&fTreeVariablePosdEdx,"fTreeVariablePosdEdx/F");
-            fTreeV0->Branch("fTreeVariableNegdEdx",&fTreeVariableNegdEdx,"fTreeVariableNegdEdx/F");
-            fTreeV0->Branch("fTreeVariablePosInnerP",&fTreeVariablePosInnerP,"fTreeVariablePosInnerP/F");
-            fTreeV0->Branch("fTreeVariableNegInnerP",&fTreeVariableNegInnerP,"fTreeVariableNegInnerP/F");
-            fTreeV0->Branch("fTreeVariableNegTrackStatus",&fTreeVariableNegTrackStatus,"fTreeVariableNegTrackStatus/l");
-            fTreeV0->Branch("fTreeVariablePosTrackStatus",&fTreeVariablePosTrackStatus,"fTreeVariablePosTrackStatus/l");
-            fTreeV0->Branch("fTreeVariableNegDCAz",&fTreeVariableNegDCAz,"fTreeVariableNegDCAz/F");
-            fTreeV0->Branch("fTreeVariablePosDCAz",&fTreeVariablePosDCAz,"fTreeVariablePosDCAz/F");
-            fTreeV0->Branch("fTreeVariableNegTOFExpTDiff",&fTreeVariableNegTOFExpTDiff,"fTreeVariableNegTOFExpTDiff/F");
-            fTreeV0->Branch("fTreeVariablePosTOFExpTDiff",&fTreeVariablePosTOFExpTDiff,"fTreeVariablePosTOFExpTDiff/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosPIDForTracking",&fTreeVariablePosPIDForTracking,"fTreeVariablePosPIDForTracking/I");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegPIDForTracking",&fTreeVariableNegPIDForTracking,"fTreeVariableNegPIDForTracking/I");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosdEdx",&fTreeVariablePosdEdx,"fTreeVariablePosdEdx/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegdEdx",&fTreeVariableNegdEdx,"fTreeVariableNegdEdx/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosInnerP",&fTreeVariablePosInnerP,"fTreeVariablePosInnerP/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegInnerP",&fTreeVariableNegInnerP,"fTreeVariableNegInnerP/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegTrackStatus",&fTreeVariableNegTrackStatus,"fTreeVariableNegTrackStatus/l");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosTrackStatus",&fTreeVariablePosTrackStatus,"fTreeVariablePosTrackStatus/l");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegDCAz",&fTreeVariableNegDCAz,"fTreeVariableNegDCAz/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosDCAz",&fTreeVariablePosDCAz,"fTreeVariablePosDCAz/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegTOFExpTDiff",&fTreeVariableNegTOFExpTDiff,"fTreeVariableNegTOFExpTDiff/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosTOFExpTDiff",&fTreeVariablePosTOFExpTDiff,"fTreeVariablePosTOFExpTDiff/F");
         }
         if ( fkDebugOOBPileup ) {
-            fTreeV0->Branch("fTreeVariablePosITSClusters0",&fTreeVariablePosITSClusters0,"fTreeVariablePosITSClusters0/O");
-            fTreeV0->Branch("fTreeVariablePosITSClusters1",&fTreeVariablePosITSClusters1,"fTreeVariablePosITSClusters1/O");
-            fTreeV0->Branch("fTreeVariablePosITSClusters2",&fTreeVariablePosITSClusters2,"fTreeVariablePosITSClusters2/O");
-            fTreeV0->Branch("fTreeVariablePosITSClusters3",&fTreeVariablePosITSClusters3,"fTreeVariablePosITSClusters3/O");
-            fTreeV0->Branch("fTreeVariablePosITSClusters4",&fTreeVariablePosITSClusters4,"fTreeVariablePosITSClusters4/O");
-            fTreeV0->Branch("fTreeVariablePosITSClusters5",&fTreeVariablePosITSClusters5,"fTreeVariablePosITSClusters5/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosITSClusters0",&fTreeVariablePosITSClusters0,"fTreeVariablePosITSClusters0/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosITSClusters1",&fTreeVariablePosITSClusters1,"fTreeVariablePosITSClusters1/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosITSClusters2",&fTreeVariablePosITSClusters2,"fTreeVariablePosITSClusters2/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosITSClusters3",&fTreeVariablePosITSClusters3,"fTreeVariablePosITSClusters3/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosITSClusters4",&fTreeVariablePosITSClusters4,"fTreeVariablePosITSClusters4/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosITSClusters5",&fTreeVariablePosITSClusters5,"fTreeVariablePosITSClusters5/O");
             
-            fTreeV0->Branch("fTreeVariableNegITSClusters0",&fTreeVariableNegITSClusters0,"fTreeVariableNegITSClusters0/O");
-            fTreeV0->Branch("fTreeVariableNegITSClusters1",&fTreeVariableNegITSClusters1,"fTreeVariableNegITSClusters1/O");
-            fTreeV0->Branch("fTreeVariableNegITSClusters2",&fTreeVariableNegITSClusters2,"fTreeVariableNegITSClusters2/O");
-            fTreeV0->Branch("fTreeVariableNegITSClusters3",&fTreeVariableNegITSClusters3,"fTreeVariableNegITSClusters3/O");
-            fTreeV0->Branch("fTreeVariableNegITSClusters4",&fTreeVariableNegITSClusters4,"fTreeVariableNegITSClusters4/O");
-            fTreeV0->Branch("fTreeVariableNegITSClusters5",&fTreeVariableNegITSClusters5,"fTreeVariableNegITSClusters5/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegITSClusters0",&fTreeVariableNegITSClusters0,"fTreeVariableNegITSClusters0/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegITSClusters1",&fTreeVariableNegITSClusters1,"fTreeVariableNegITSClusters1/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegITSClusters2",&fTreeVariableNegITSClusters2,"fTreeVariableNegITSClusters2/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegITSClusters3",&fTreeVariableNegITSClusters3,"fTreeVariableNegITSClusters3/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegITSClusters4",&fTreeVariableNegITSClusters4,"fTreeVariableNegITSClusters4/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegITSClusters5",&fTreeVariableNegITSClusters5,"fTreeVariableNegITSClusters5/O");
             
-            fTreeV0->Branch("fTreeVariablePosITSSharedClusters0",&fTreeVariablePosITSSharedClusters0,"fTreeVariablePosITSSharedClusters0/O");
-            fTreeV0->Branch("fTreeVariablePosITSSharedClusters1",&fTreeVariablePosITSSharedClusters1,"fTreeVariablePosITSSharedClusters1/O");
-            fTreeV0->Branch("fTreeVariablePosITSSharedClusters2",&fTreeVariablePosITSSharedClusters2,"fTreeVariablePosITSSharedClusters2/O");
-            fTreeV0->Branch("fTreeVariablePosITSSharedClusters3",&fTreeVariablePosITSSharedClusters3,"fTreeVariablePosITSSharedClusters3/O");
-            fTreeV0->Branch("fTreeVariablePosITSSharedClusters4",&fTreeVariablePosITSSharedClusters4,"fTreeVariablePosITSSharedClusters4/O");
-            fTreeV0->Branch("fTreeVariablePosITSSharedClusters5",&fTreeVariablePosITSSharedClusters5,"fTreeVariablePosITSSharedClusters5/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosITSSharedClusters0",&fTreeVariablePosITSSharedClusters0,"fTreeVariablePosITSSharedClusters0/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosITSSharedClusters1",&fTreeVariablePosITSSharedClusters1,"fTreeVariablePosITSSharedClusters1/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosITSSharedClusters2",&fTreeVariablePosITSSharedClusters2,"fTreeVariablePosITSSharedClusters2/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosITSSharedClusters3",&fTreeVariablePosITSSharedClusters3,"fTreeVariablePosITSSharedClusters3/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosITSSharedClusters4",&fTreeVariablePosITSSharedClusters4,"fTreeVariablePosITSSharedClusters4/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosITSSharedClusters5",&fTreeVariablePosITSSharedClusters5,"fTreeVariablePosITSSharedClusters5/O");
             
-            fTreeV0->Branch("fTreeVariableNegITSSharedClusters0",&fTreeVariableNegITSSharedClusters0,"fTreeVariableNegITSSharedClusters0/O");
-            fTreeV0->Branch("fTreeVariableNegITSSharedClusters1",&fTreeVariableNegITSSharedClusters1,"fTreeVariableNegITSSharedClusters1/O");
-            fTreeV0->Branch("fTreeVariableNegITSSharedClusters2",&fTreeVariableNegITSSharedClusters2,"fTreeVariableNegITSSharedClusters2/O");
-            fTreeV0->Branch("fTreeVariableNegITSSharedClusters3",&fTreeVariableNegITSSharedClusters3,"fTreeVariableNegITSSharedClusters3/O");
-            fTreeV0->Branch("fTreeVariableNegITSSharedClusters4",&fTreeVariableNegITSSharedClusters4,"fTreeVariableNegITSSharedClusters4/O");
-            fTreeV0->Branch("fTreeVariableNegITSSharedClusters5",&fTreeVariableNegITSSharedClusters5,"fTreeVariableNegITSSharedClusters5/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegITSSharedClusters0",&fTreeVariableNegITSSharedClusters0,"fTreeVariableNegITSSharedClusters0/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegITSSharedClusters1",&fTreeVariableNegITSSharedClusters1,"fTreeVariableNegITSSharedClusters1/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegITSSharedClusters2",&fTreeVariableNegITSSharedClusters2,"fTreeVariableNegITSSharedClusters2/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegITSSharedClusters3",&fTreeVariableNegITSSharedClusters3,"fTreeVariableNegITSSharedClusters3/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegITSSharedClusters4",&fTreeVariableNegITSSharedClusters4,"fTreeVariableNegITSSharedClusters4/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegITSSharedClusters5",&fTreeVariableNegITSSharedClusters5,"fTreeVariableNegITSSharedClusters5/O");
             
-            fTreeV0->Branch("fTreeVariableNegTOFSignal",&fTreeVariableNegTOFSignal,"fTreeVariableNegTOFSignal/F");
-            fTreeV0->Branch("fTreeVariablePosTOFSignal",&fTreeVariablePosTOFSignal,"fTreeVariablePosTOFSignal/F");
-            fTreeV0->Branch("fTreeVariableNegTOFBCid",&fTreeVariableNegTOFBCid,"fTreeVariableNegTOFBCid/I");
-            fTreeV0->Branch("fTreeVariablePosTOFBCid",&fTreeVariablePosTOFBCid,"fTreeVariablePosTOFBCid/I");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegTOFSignal",&fTreeVariableNegTOFSignal,"fTreeVariableNegTOFSignal/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosTOFSignal",&fTreeVariablePosTOFSignal,"fTreeVariablePosTOFSignal/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegTOFBCid",&fTreeVariableNegTOFBCid,"fTreeVariableNegTOFBCid/I");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosTOFBCid",&fTreeVariablePosTOFBCid,"fTreeVariablePosTOFBCid/I");
             // Event info
-            fTreeV0->Branch("fTreeVariableOOBPileupFlag",&fTreeVariableOOBPileupFlag,"fTreeVariableOOBPileupFlag/O");
-            fTreeV0->Branch("fTreeVariableAmplitudeV0A",&fTreeVariableAmplitudeV0A,"fTreeVariableAmplitudeV0A/F");
-            fTreeV0->Branch("fTreeVariableAmplitudeV0C",&fTreeVariableAmplitudeV0C,"fTreeVariableAmplitudeV0C/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableOOBPileupFlag",&fTreeVariableOOBPileupFlag,"fTreeVariableOOBPileupFlag/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableAmplitudeV0A",&fTreeVariableAmplitudeV0A,"fTreeVariableAmplitudeV0A/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableAmplitudeV0C",&fTreeVariableAmplitudeV0C,"fTreeVariableAmplitudeV0C/F");
         }
         //-----------MC Exclusive info--------------------
-        fTreeV0->Branch("fTreeVariablePtMother",&fTreeVariablePtMother,"fTreeVariablePtMother/F");
-        fTreeV0->Branch("fTreeVariableRapMother",&fTreeVariableRapMother,"fTreeVariableRapMother/F");
-        fTreeV0->Branch("fTreeVariablePID",&fTreeVariablePID,"fTreeVariablePID/I");
-        fTreeV0->Branch("fTreeVariablePIDPositive",&fTreeVariablePIDPositive,"fTreeVariablePIDPositive/I");
-        fTreeV0->Branch("fTreeVariablePIDNegative",&fTreeVariablePIDNegative,"fTreeVariablePIDNegative/I");
-        fTreeV0->Branch("fTreeVariablePIDMother",&fTreeVariablePIDMother,"fTreeVariablePIDMother/I");
-        fTreeV0->Branch("fTreeVariablePrimaryStatus",&fTreeVariablePrimaryStatus,"fTreeVariablePrimaryStatus/I");
-        fTreeV0->Branch("fTreeVariablePrimaryStatusMother",&fTreeVariablePrimaryStatusMother,"fTreeVariablePrimaryStatusMother/I");
-
-        fTreeV0->Branch("fTreeVariablePosPx",&fTreeVariablePosPx,"fTreeVariablePosPx/F");
-       	fTreeV0->Branch("fTreeVariablePosPy",&fTreeVariablePosPy,"fTreeVariablePosPy/F");
-        fTreeV0->Branch("fTreeVariablePosPz",&fTreeVariablePosPz,"fTreeVariablePosPz/F");
-        fTreeV0->Branch("fTreeVariableNegPx",&fTreeVariableNegPx,"fTreeVariableNegPx/F");
-        fTreeV0->Branch("fTreeVariableNegPy",&fTreeVariableNegPy,"fTreeVariableNegPy/F");
-        fTreeV0->Branch("fTreeVariableNegPz",&fTreeVariableNegPz,"fTreeVariableNegPz/F");
-
-        fTreeV0->Branch("fTreeVariableNegPxMC",&fTreeVariableNegPxMC,"fTreeVariableNegPxMC/F");
-        fTreeV0->Branch("fTreeVariableNegPyMC",&fTreeVariableNegPyMC,"fTreeVariableNegPyMC/F");
-        fTreeV0->Branch("fTreeVariableNegPzMC",&fTreeVariableNegPzMC,"fTreeVariableNegPzMC/F");
-        fTreeV0->Branch("fTreeVariablePosPxMC",&fTreeVariablePosPxMC,"fTreeVariablePosPxMC/F");
-        fTreeV0->Branch("fTreeVariablePosPyMC",&fTreeVariablePosPyMC,"fTreeVariablePosPyMC/F");
-        fTreeV0->Branch("fTreeVariablePosPzMC",&fTreeVariablePosPzMC,"fTreeVariablePosPzMC/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariablePtMother",&fTreeVariablePtMother,"fTreeVariablePtMother/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableRapMother",&fTreeVariableRapMother,"fTreeVariableRapMother/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariablePID",&fTreeVariablePID,"fTreeVariablePID/I");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariablePIDPositive",&fTreeVariablePIDPositive,"fTreeVariablePIDPositive/I");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariablePIDNegative",&fTreeVariablePIDNegative,"fTreeVariablePIDNegative/I");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariablePIDMother",&fTreeVariablePIDMother,"fTreeVariablePIDMother/I");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariablePrimaryStatus",&fTreeVariablePrimaryStatus,"fTreeVariablePrimaryStatus/I");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariablePrimaryStatusMother",&fTreeVariablePrimaryStatusMother,"fTreeVariablePrimaryStatusMother/I");
+
+        lTreeWriter.Branch(fTreeV0,"fTreeVariablePosPx",&fTreeVariablePosPx,"fTreeVariablePosPx/F");
+       	lTreeWriter.Branch(fTreeV0,"fTreeVariablePosPy",&fTreeVariablePosPy,"fTreeVariablePosPy/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariablePosPz",&fTreeVariablePosPz,"fTreeVariablePosPz/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableNegPx",&fTreeVariableNegPx,"fTreeVariableNegPx/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableNegPy",&fTreeVariableNegPy,"fTreeVariableNegPy/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableNegPz",&fTreeVariableNegPz,"fTreeVariableNegPz/F");
+
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableNegPxMC",&fTreeVariableNegPxMC,"fTreeVariableNegPxMC/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableNegPyMC",&fTreeVariableNegPyMC,"fTreeVariableNegPyMC/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariableNegPzMC",&fTreeVariableNegPzMC,"fTreeVariableNegPzMC/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariablePosPxMC",&fTreeVariablePosPxMC,"fTreeVariablePosPxMC/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariablePosPyMC",&fTreeVariablePosPyMC,"fTreeVariablePosPyMC/F");
+        lTreeWriter.Branch(fTreeV0,"fTreeVariablePosPzMC",&fTreeVariablePosPzMC,"fTreeVariablePosPzMC/F");
         //------------------------------------------------
         if( fkSandboxMode ){
             //Full track info 
-            fTreeV0->Branch("fTreeVariablePrimVertexX",&fTreeVariablePrimVertexX,"fTreeVariablePrimVertexX/F");
-            fTreeV0->Branch("fTreeVariablePrimVertexY",&fTreeVariablePrimVertexY,"fTreeVariablePrimVertexY/F");
-            fTreeV0->Branch("fTreeVariablePrimVertexZ",&fTreeVariablePrimVertexZ,"fTreeVariablePrimVertexZ/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePrimVertexX",&fTreeVariablePrimVertexX,"fTreeVariablePrimVertexX/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePrimVertexY",&fTreeVariablePrimVertexY,"fTreeVariablePrimVertexY/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePrimVertexZ",&fTreeVariablePrimVertexZ,"fTreeVariablePrimVertexZ/F");
             fTreeV0->Branch("fTreeVariableNegTrack", &fTreeVariableNegTrack,16000,99);
             fTreeV0->Branch("fTreeVariablePosTrack", &fTreeVariablePosTrack,16000,99);
-            fTreeV0->Branch("fTreeVariableMagneticField",&fTreeVariableMagneticField,"fTreeVariableMagneticField/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableMagneticField",&fTreeVariableMagneticField,"fTreeVariableMagneticField/F");
             
             //Extra information for debugging vertexer functionality
-            fTreeV0->Branch("fTreeVariableNegCreationX",&fTreeVariableNegCreationX,"fTreeVariableNegCreationX/F");
-            fTreeV0->Branch("fTreeVariableNegCreationY",&fTreeVariableNegCreationY,"fTreeVariableNegCreationY/F");
-            fTreeV0->Branch("fTreeVariableNegCreationZ",&fTreeVariableNegCreationZ,"fTreeVariableNegCreationZ/F");
-            fTreeV0->Branch("fTreeVariablePosCreationX",&fTreeVariablePosCreationX,"fTreeVariablePosCreationX/F");
-            fTreeV0->Branch("fTreeVariablePosCreationY",&fTreeVariablePosCreationY,"fTreeVariablePosCreationY/F");
-            fTreeV0->Branch("fTreeVariablePosCreationZ",&fTreeVariablePosCreationZ,"fTreeVariablePosCreationZ/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegCreationX",&fTreeVariableNegCreationX,"fTreeVariableNegCreationX/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegCreationY",&fTreeVariableNegCreationY,"fTreeVariableNegCreationY/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegCreationZ",&fTreeVariableNegCreationZ,"fTreeVariableNegCreationZ/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosCreationX",&fTreeVariablePosCreationX,"fTreeVariablePosCreationX/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosCreationY",&fTreeVariablePosCreationY,"fTreeVariablePosCreationY/F");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosCreationZ",&fTreeVariablePosCreationZ,"fTreeVariablePosCreationZ/F");
                        
-            fTreeV0->Branch("fTreeVariablePIDNegativeMother",&fTreeVariablePIDNegativeMother,"fTreeVariablePIDNegativeMother/I");
-            fTreeV0->Branch("fTreeVariablePIDPositiveMother",&fTreeVariablePIDPositiveMother,"fTreeVariablePIDPositiveMother/I");
-            fTreeV0->Branch("fTreeVariablePIDNegativeGrandMother",&fTreeVariablePIDNegativeGrandMother,"fTreeVariablePIDNegativeGrandMother/I");
-            fTreeV0->Branch("fTreeVariablePIDPositiveGrandMother",&fTreeVariablePIDPositiveGrandMother,"fTreeVariablePIDPositiveGrandMother/I");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePIDNegativeMother",&fTreeVariablePIDNegativeMother,"fTreeVariablePIDNegativeMother/I");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePIDPositiveMother",&fTreeVariablePIDPositiveMother,"fTreeVariablePIDPositiveMother/I");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePIDNegativeGrandMother",&fTreeVariablePIDNegativeGrandMother,"fTreeVariablePIDNegativeGrandMother/I");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePIDPositiveGrandMother",&fTreeVariablePIDPositiveGrandMother,"fTreeVariablePIDPositiveGrandMother/I");
             
-            fTreeV0->Branch("fTreeVariableNegLabel",&fTreeVariableNegLabel,"fTreeVariableNegLabel/I");
-            fTreeV0->Branch("fTreeVariablePosLabel",&fTreeVariablePosLabel,"fTreeVariablePosLabel/I");
-            fTreeV0->Branch("fTreeVariableNegLabelMother",&fTreeVariableNegLabelMother,"fTreeVariableNegLabelMother/I");
-            fTreeV0->Branch("fTreeVariablePosLabelMother",&fTreeVariablePosLabelMother,"fTreeVariablePosLabelMother/I");
-            fTreeV0->Branch("fTreeVariableNegLabelGrandMother",&fTreeVariableNegLabelGrandMother,"fTreeVariableNegLabelGrandMother/I");
-            fTreeV0->Branch("fTreeVariablePosLabelGrandMother",&fTreeVariablePosLabelGrandMother,"fTreeVariablePosLabelGrandMother/I");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegLabel",&fTreeVariableNegLabel,"fTreeVariableNegLabel/I");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosLabel",&fTreeVariablePosLabel,"fTreeVariablePosLabel/I");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegLabelMother",&fTreeVariableNegLabelMother,"fTreeVariableNegLabelMother/I");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosLabelMother",&fTreeVariablePosLabelMother,"fTreeVariablePosLabelMother/I");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableNegLabelGrandMother",&fTreeVariableNegLabelGrandMother,"fTreeVariableNegLabelGrandMother/I");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariablePosLabelGrandMother",&fTreeVariablePosLabelGrandMother,"fTreeVariablePosLabelGrandMother/I");
             
-            fTreeV0->Branch("fTreeVariableIsPhysicalPrimaryNegative",&fTreeVariableIsPhysicalPrimaryNegative,"fTreeVariableIsPhysicalPrimaryNegative/O");
-            fTreeV0->Branch("fTreeVariableIsPhysicalPrimaryPositive",&fTreeVariableIsPhysicalPrimaryPositive,"fTreeVariableIsPhysicalPrimaryPositive/O");
-            fTreeV0->Branch("fTreeVariableIsPhysicalPrimaryNegativeMother",&fTreeVariableIsPhysicalPrimaryNegativeMother,"fTreeVariableIsPhysicalPrimaryNegativeMother/O");
-            fTreeV0->Branch("fTreeVariableIsPhysicalPrimaryPositiveMother",&fTreeVariableIsPhysicalPrimaryPositiveMother,"fTreeVariableIsPhysicalPrimaryPositiveMother/O");
-            fTreeV0->Branch("fTreeVariableIsPhysicalPrimaryNegativeGrandMother",&fTreeVariableIsPhysicalPrimaryNegativeGrandMother,"fTreeVariableIsPhysicalPrimaryNegativeGrandMother/O");
-            fTreeV0->Branch("fTreeVariableIsPhysicalPrimaryPositiveGrandMother",&fTreeVariableIsPhysicalPrimaryPositiveGrandMother,"fTreeVariableIsPhysicalPrimaryPositiveGrandMother/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableIsPhysicalPrimaryNegative",&fTreeVariableIsPhysicalPrimaryNegative,"fTreeVariableIsPhysicalPrimaryNegative/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableIsPhysicalPrimaryPositive",&fTreeVariableIsPhysicalPrimaryPositive,"fTreeVariableIsPhysicalPrimaryPositive/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableIsPhysicalPrimaryNegativeMother",&fTreeVariableIsPhysicalPrimaryNegativeMother,"fTreeVariableIsPhysicalPrimaryNegativeMother/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableIsPhysicalPrimaryPositiveMother",&fTreeVariableIsPhysicalPrimaryPositiveMother,"fTreeVariableIsPhysicalPrimaryPositiveMother/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableIsPhysicalPrimaryNegativeGrandMother",&fTreeVariableIsPhysicalPrimaryNegativeGrandMother,"fTreeVariableIsPhysicalPrimaryNegativeGrandMother/O");
+            lTreeWriter.Branch(fTreeV0,"fTreeVariableIsPhysicalPrimaryPositiveGrandMother",&fTreeVariableIsPhysicalPrimaryPositiveGrandMother,"fTreeVariableIsPhysicalPrimaryPositiveGrandMother/O");
         }
         //------------------------------------------------
     }
@@ -1706,295 +1717,295 @@ void AliAnalysisTaskStrangenessVsMultiplicityEEMCRun2::UserCreateOutputObjects()
         //Create Cascade output tree
         fTreeCascade = new TTree("fTreeCascade","CascadeCandidates");
         //-----------BASIC-INFO---------------------------
-        fTreeCascade->Branch("fTreeCascVarRun",&fTreeCascVarRun,"fTreeCascVarRun/I");
-        fTreeCascade->Branch("fTreeCascVarRunEvSel_AllSelections", &fTreeVariableEvSel_AllSelections, "fTreeVariableEvSel_AllSelections/O");
-        fTreeCascade->Branch("fTreeCascVarCharge",&fTreeCascVarCharge,"fTreeCascVarCharge/I");
-        fTreeCascade->Branch("fTreeCascVarMassAsXi",&fTreeCascVarMassAsXi,"fTreeCascVarMassAsXi/F");
-        fTreeCascade->Branch("fTreeCascVarMassAsOmega",&fTreeCascVarMassAsOmega,"fTreeCascVarMassAsOmega/F");
-        fTreeCascade->Branch("fTreeCascVarPt",&fTreeCascVarPt,"fTreeCascVarPt/F");
-        fTreeCascade->Branch("fTreeCascVarPtMC",&fTreeCascVarPtMC,"fTreeCascVarPtMC/F");
-        fTreeCascade->Branch("fTreeCascVarRapXi",&fTreeCascVarRapXi,"fTreeCascVarRapXi/F");
-        fTreeCascade->Branch("fTreeCascVarRapOmega",&fTreeCascVarRapOmega,"fTreeCascVarRapOmega/F");
-        fTreeCascade->Branch("fTreeCascVarRapMC",&fTreeCascVarRapMC,"fTreeCascVarRapMC/F");
-        fTreeCascade->Branch("fTreeCascVarNegEta",&fTreeCascVarNegEta,"fTreeCascVarNegEta/F");
-        fTreeCascade->Branch("fTreeCascVarPosEta",&fTreeCascVarPosEta,"fTreeCascVarPosEta/F");
-        fTreeCascade->Branch("fTreeCascVarBachEta",&fTreeCascVarBachEta,"fTreeCascVarBachEta/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarRun",&fTreeCascVarRun,"fTreeCascVarRun/I");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarRunEvSel_AllSelections",&fTreeVariableEvSel_AllSelections,"fTreeVariableEvSel_AllSelections/O");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarCharge",&fTreeCascVarCharge,"fTreeCascVarCharge/I");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarMassAsXi",&fTreeCascVarMassAsXi,"fTreeCascVarMassAsXi/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarMassAsOmega",&fTreeCascVarMassAsOmega,"fTreeCascVarMassAsOmega/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPt",&fTreeCascVarPt,"fTreeCascVarPt/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPtMC",&fTreeCascVarPtMC,"fTreeCascVarPtMC/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarRapXi",&fTreeCascVarRapXi,"fTreeCascVarRapXi/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarRapOmega",&fTreeCascVarRapOmega,"fTreeCascVarRapOmega/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarRapMC",&fTreeCascVarRapMC,"fTreeCascVarRapMC/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegEta",&fTreeCascVarNegEta,"fTreeCascVarNegEta/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosEta",&fTreeCascVarPosEta,"fTreeCascVarPosEta/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachEta",&fTreeCascVarBachEta,"fTreeCascVarBachEta/F");
         //-----------INFO-FOR-CUTS------------------------
-        fTreeCascade->Branch("fTreeCascVarDCACascDaughters",&fTreeCascVarDCACascDaughters,"fTreeCascVarDCACascDaughters/F");
-        fTreeCascade->Branch("fTreeCascVarDCABachToPrimVtx",&fTreeCascVarDCABachToPrimVtx,"fTreeCascVarDCABachToPrimVtx/F");
-        fTreeCascade->Branch("fTreeCascVarDCAV0Daughters",&fTreeCascVarDCAV0Daughters,"fTreeCascVarDCAV0Daughters/F");
-        fTreeCascade->Branch("fTreeCascVarDCAV0ToPrimVtx",&fTreeCascVarDCAV0ToPrimVtx,"fTreeCascVarDCAV0ToPrimVtx/F");
-        fTreeCascade->Branch("fTreeCascVarDCAPosToPrimVtx",&fTreeCascVarDCAPosToPrimVtx,"fTreeCascVarDCAPosToPrimVtx/F");
-        fTreeCascade->Branch("fTreeCascVarDCANegToPrimVtx",&fTreeCascVarDCANegToPrimVtx,"fTreeCascVarDCANegToPrimVtx/F");
-        fTreeCascade->Branch("fTreeCascVarCascCosPointingAngle",&fTreeCascVarCascCosPointingAngle,"fTreeCascVarCascCosPointingAngle/F");
-        fTreeCascade->Branch("fTreeCascVarCascDCAtoPVxy",&fTreeCascVarCascDCAtoPVxy,"fTreeCascVarCascDCAtoPVxy/F");
-        fTreeCascade->Branch("fTreeCascVarCascDCAtoPVz",&fTreeCascVarCascDCAtoPVz,"fTreeCascVarCascDCAtoPVz/F");
-        
-        fTreeCascade->Branch("fTreeCascVarCascRadius",&fTreeCascVarCascRadius,"fTreeCascVarCascRadius/F");
-        fTreeCascade->Branch("fTreeCascVarV0Mass",&fTreeCascVarV0Mass,"fTreeCascVarV0Mass/F");
-        fTreeCascade->Branch("fTreeCascVarV0CosPointingAngle",&fTreeCascVarV0CosPointingAngle,"fTreeCascVarV0CosPointingAngle/F");
-        fTreeCascade->Branch("fTreeCascVarV0CosPointingAngleSpecial",&fTreeCascVarV0CosPointingAngleSpecial,"fTreeCascVarV0CosPointingAngleSpecial/F");
-        fTreeCascade->Branch("fTreeCascVarV0Radius",&fTreeCascVarV0Radius,"fTreeCascVarV0Radius/F");
-        fTreeCascade->Branch("fTreeCascVarDCABachToBaryon",&fTreeCascVarDCABachToBaryon,"fTreeCascVarDCABachToBaryon/F");
-        fTreeCascade->Branch("fTreeCascVarWrongCosPA",&fTreeCascVarWrongCosPA,"fTreeCascVarWrongCosPA/F");
-        fTreeCascade->Branch("fTreeCascVarLeastNbrClusters",&fTreeCascVarLeastNbrClusters,"fTreeCascVarLeastNbrClusters/I");
-        fTreeCascade->Branch("fTreeCascVarLeastNbrCrossedRows",&fTreeCascVarLeastNbrCrossedRows,"fTreeCascVarLeastNbrCrossedRows/I");
-        fTreeCascade->Branch("fTreeCascVarNbrCrossedRowsOverLength",&fTreeCascVarNbrCrossedRowsOverLength,"fTreeCascVarNbrCrossedRowsOverLength/F");
-        fTreeCascade->Branch("fTreeCascVarMaxChi2PerCluster",&fTreeCascVarMaxChi2PerCluster,"fTreeCascVarMaxChi2PerCluster/F");
-        fTreeCascade->Branch("fTreeCascVarMinTrackLength",&fTreeCascVarMinTrackLength,"fTreeCascVarMinTrackLength/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarDCACascDaughters",&fTreeCascVarDCACascDaughters,"fTreeCascVarDCACascDaughters/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarDCABachToPrimVtx",&fTreeCascVarDCABachToPrimVtx,"fTreeCascVarDCABachToPrimVtx/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarDCAV0Daughters",&fTreeCascVarDCAV0Daughters,"fTreeCascVarDCAV0Daughters/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarDCAV0ToPrimVtx",&fTreeCascVarDCAV0ToPrimVtx,"fTreeCascVarDCAV0ToPrimVtx/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarDCAPosToPrimVtx",&fTreeCascVarDCAPosToPrimVtx,"fTreeCascVarDCAPosToPrimVtx/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarDCANegToPrimVtx",&fTreeCascVarDCANegToPrimVtx,"fTreeCascVarDCANegToPrimVtx/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarCascCosPointingAngle",&fTreeCascVarCascCosPointingAngle,"fTreeCascVarCascCosPointingAngle/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarCascDCAtoPVxy",&fTreeCascVarCascDCAtoPVxy,"fTreeCascVarCascDCAtoPVxy/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarCascDCAtoPVz",&fTreeCascVarCascDCAtoPVz,"fTreeCascVarCascDCAtoPVz/F");
+        
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarCascRadius",&fTreeCascVarCascRadius,"fTreeCascVarCascRadius/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0Mass",&fTreeCascVarV0Mass,"fTreeCascVarV0Mass/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0CosPointingAngle",&fTreeCascVarV0CosPointingAngle,"fTreeCascVarV0CosPointingAngle/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0CosPointingAngleSpecial",&fTreeCascVarV0CosPointingAngleSpecial,"fTreeCascVarV0CosPointingAngleSpecial/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0Radius",&fTreeCascVarV0Radius,"fTreeCascVarV0Radius/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarDCABachToBaryon",&fTreeCascVarDCABachToBaryon,"fTreeCascVarDCABachToBaryon/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarWrongCosPA",&fTreeCascVarWrongCosPA,"fTreeCascVarWrongCosPA/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarLeastNbrClusters",&fTreeCascVarLeastNbrClusters,"fTreeCascVarLeastNbrClusters/I");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarLeastNbrCrossedRows",&fTreeCascVarLeastNbrCrossedRows,"fTreeCascVarLeastNbrCrossedRows/I");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNbrCrossedRowsOverLength",&fTreeCascVarNbrCrossedRowsOverLength,"fTreeCascVarNbrCrossedRowsOverLength/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarMaxChi2PerCluster",&fTreeCascVarMaxChi2PerCluster,"fTreeCascVarMaxChi2PerCluster/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarMinTrackLength",&fTreeCascVarMinTrackLength,"fTreeCascVarMinTrackLength/F");
         //-----------MULTIPLICITY-INFO--------------------
-        fTreeCascade->Branch("fTreeCascVarCentrality",&fTreeCascVarCentrality,"fTreeCascVarCentrality/F");
-        fTreeCascade->Branch("fTreeCascVarMVPileupFlag",&fTreeCascVarMVPileupFlag,"fTreeCascVarMVPileupFlag/O");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarCentrality",&fTreeCascVarCentrality,"fTreeCascVarCentrality/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarMVPileupFlag",&fTreeCascVarMVPileupFlag,"fTreeCascVarMVPileupFlag/O");
         if (fkDebugZDCInfo){
-   			fTreeCascade->Branch("fTreeCascVarZNApp", &fTreeCascVarZNApp,"fTreeCascVarZNApp/F");
-			fTreeCascade->Branch("fTreeCascVarZNCpp", &fTreeCascVarZNCpp,"fTreeCascVarZNCpp/F");
-			fTreeCascade->Branch("fTreeCascVarZPApp", &fTreeCascVarZPApp,"fTreeCascVarZPApp/F");
-			fTreeCascade->Branch("fTreeCascVarZPCpp", &fTreeCascVarZPCpp,"fTreeCascVarZPCpp/F");
+   			lTreeWriter.Branch(fTreeCascade,"fTreeCascVarZNApp",&fTreeCascVarZNApp,"fTreeCascVarZNApp/F");
+			lTreeWriter.Branch(fTreeCascade,"fTreeCascVarZNCpp",&fTreeCascVarZNCpp,"fTreeCascVarZNCpp/F");
+			lTreeWriter.Branch(fTreeCascade,"fTreeCascVarZPApp",&fTreeCascVarZPApp,"fTreeCascVarZPApp/F");
+			lTreeWriter.Branch(fTreeCascade,"fTreeCascVarZPCpp",&fTreeCascVarZPCpp,"fTreeCascVarZPCpp/F");
 	    }
         //-----------DECAY-LENGTH-INFO--------------------
-        fTreeCascade->Branch("fTreeCascVarDistOverTotMom",&fTreeCascVarDistOverTotMom,"fTreeCascVarDistOverTotMom/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarDistOverTotMom",&fTreeCascVarDistOverTotMom,"fTreeCascVarDistOverTotMom/F");
         //------------------------------------------------
-        fTreeCascade->Branch("fTreeCascVarNegNSigmaPion",&fTreeCascVarNegNSigmaPion,"fTreeCascVarNegNSigmaPion/F");
-        fTreeCascade->Branch("fTreeCascVarNegNSigmaProton",&fTreeCascVarNegNSigmaProton,"fTreeCascVarNegNSigmaProton/F");
-        fTreeCascade->Branch("fTreeCascVarPosNSigmaPion",&fTreeCascVarPosNSigmaPion,"fTreeCascVarPosNSigmaPion/F");
-        fTreeCascade->Branch("fTreeCascVarPosNSigmaProton",&fTreeCascVarPosNSigmaProton,"fTreeCascVarPosNSigmaProton/F");
-        fTreeCascade->Branch("fTreeCascVarBachNSigmaPion",&fTreeCascVarBachNSigmaPion,"fTreeCascVarBachNSigmaPion/F");
-        fTreeCascade->Branch("fTreeCascVarBachNSigmaKaon",&fTreeCascVarBachNSigmaKaon,"fTreeCascVarBachNSigmaKaon/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegNSigmaPion",&fTreeCascVarNegNSigmaPion,"fTreeCascVarNegNSigmaPion/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegNSigmaProton",&fTreeCascVarNegNSigmaProton,"fTreeCascVarNegNSigmaProton/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosNSigmaPion",&fTreeCascVarPosNSigmaPion,"fTreeCascVarPosNSigmaPion/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosNSigmaProton",&fTreeCascVarPosNSigmaProton,"fTreeCascVarPosNSigmaProton/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachNSigmaPion",&fTreeCascVarBachNSigmaPion,"fTreeCascVarBachNSigmaPion/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachNSigmaKaon",&fTreeCascVarBachNSigmaKaon,"fTreeCascVarBachNSigmaKaon/F");
         //------------------------------------------------
-        fTreeCascade->Branch("fTreeCascVarChiSquareV0",&fTreeCascVarChiSquareV0,"fTreeCascVarChiSquareV0/F");
-        fTreeCascade->Branch("fTreeCascVarChiSquareCascade",&fTreeCascVarChiSquareCascade,"fTreeCascVarChiSquareCascade/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarChiSquareV0",&fTreeCascVarChiSquareV0,"fTreeCascVarChiSquareV0/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarChiSquareCascade",&fTreeCascVarChiSquareCascade,"fTreeCascVarChiSquareCascade/F");
         //------------------------------------------------
         //Variables for test with bachelor sibling V0
         //Bach
         /*
-        fTreeCascade->Branch("fTreeCascVarBachSibPt",&fTreeCascVarBachSibPt," fTreeCascVarBachSibPt/F");
-        fTreeCascade->Branch("fTreeCascVarBachSibDcaV0ToPrimVertex",&fTreeCascVarBachSibDcaV0ToPrimVertex," fTreeCascVarBachSibDcaV0ToPrimVertex/F");
-        fTreeCascade->Branch("fTreeCascVarBachSibDcaV0Daughters",&fTreeCascVarBachSibDcaV0Daughters," fTreeCascVarBachSibDcaV0Daughters/F");
-        fTreeCascade->Branch("fTreeCascVarBachSibV0CosineOfPointingAngle",&fTreeCascVarBachSibV0CosineOfPointingAngle," fTreeCascVarBachSibV0CosineOfPointingAngle /F");
-        fTreeCascade->Branch("fTreeCascVarBachSibV0V0Radius",&fTreeCascVarBachSibV0V0Radius," fTreeCascVarBachSibV0V0Radius/F");
-        fTreeCascade->Branch("fTreeCascVarBachSibV0DcaPosToPrimVertex",&fTreeCascVarBachSibV0DcaPosToPrimVertex," fTreeCascVarBachSibV0DcaPosToPrimVertex/F");
-        fTreeCascade->Branch("fTreeCascVarBachSibV0DcaNegToPrimVertex",&fTreeCascVarBachSibV0DcaNegToPrimVertex," fTreeCascVarBachSibV0DcaNegToPrimVertex/F");
-        fTreeCascade->Branch("fTreeCascVarBachSibV0InvMassK0s",&fTreeCascVarBachSibV0InvMassK0s," fTreeCascVarBachSibV0InvMassK0s            /F");
-        fTreeCascade->Branch("fTreeCascVarBachSibV0InvMassLambda",&fTreeCascVarBachSibV0InvMassLambda," fTreeCascVarBachSibV0InvMassLambda/F");
-        fTreeCascade->Branch("fTreeCascVarBachSibV0InvMassAntiLambda",&fTreeCascVarBachSibV0InvMassAntiLambda," fTreeCascVarBachSibV0InvMassAntiLambda/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachSibPt",&fTreeCascVarBachSibPt," fTreeCascVarBachSibPt/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachSibDcaV0ToPrimVertex",&fTreeCascVarBachSibDcaV0ToPrimVertex," fTreeCascVarBachSibDcaV0ToPrimVertex/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachSibDcaV0Daughters",&fTreeCascVarBachSibDcaV0Daughters," fTreeCascVarBachSibDcaV0Daughters/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachSibV0CosineOfPointingAngle",&fTreeCascVarBachSibV0CosineOfPointingAngle," fTreeCascVarBachSibV0CosineOfPointingAngle /F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachSibV0V0Radius",&fTreeCascVarBachSibV0V0Radius," fTreeCascVarBachSibV0V0Radius/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachSibV0DcaPosToPrimVertex",&fTreeCascVarBachSibV0DcaPosToPrimVertex," fTreeCascVarBachSibV0DcaPosToPrimVertex/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachSibV0DcaNegToPrimVertex",&fTreeCascVarBachSibV0DcaNegToPrimVertex," fTreeCascVarBachSibV0DcaNegToPrimVertex/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachSibV0InvMassK0s",&fTreeCascVarBachSibV0InvMassK0s," fTreeCascVarBachSibV0InvMassK0s            /F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachSibV0InvMassLambda",&fTreeCascVarBachSibV0InvMassLambda," fTreeCascVarBachSibV0InvMassLambda/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachSibV0InvMassAntiLambda",&fTreeCascVarBachSibV0InvMassAntiLambda," fTreeCascVarBachSibV0InvMassAntiLambda/F");
         //Neg
-        fTreeCascade->Branch("fTreeCascVarNegSibPt",&fTreeCascVarNegSibPt," fTreeCascVarNegSibPt/F");
-        fTreeCascade->Branch("fTreeCascVarNegSibDcaV0ToPrimVertex",&fTreeCascVarNegSibDcaV0ToPrimVertex," fTreeCascVarNegSibDcaV0ToPrimVertex/F");
-        fTreeCascade->Branch("fTreeCascVarNegSibDcaV0Daughters",&fTreeCascVarNegSibDcaV0Daughters," fTreeCascVarNegSibDcaV0Daughters/F");
-        fTreeCascade->Branch("fTreeCascVarNegSibV0CosineOfPointingAngle",&fTreeCascVarNegSibV0CosineOfPointingAngle," fTreeCascVarNegSibV0CosineOfPointingAngle /F");
-        fTreeCascade->Branch("fTreeCascVarNegSibV0V0Radius",&fTreeCascVarNegSibV0V0Radius," fTreeCascVarNegSibV0V0Radius/F");
-        fTreeCascade->Branch("fTreeCascVarNegSibV0DcaPosToPrimVertex",&fTreeCascVarNegSibV0DcaPosToPrimVertex," fTreeCascVarNegSibV0DcaPosToPrimVertex/F");
-        fTreeCascade->Branch("fTreeCascVarNegSibV0DcaNegToPrimVertex",&fTreeCascVarNegSibV0DcaNegToPrimVertex," fTreeCascVarNegSibV0DcaNegToPrimVertex/F");
-        fTreeCascade->Branch("fTreeCascVarNegSibV0InvMassK0s",&fTreeCascVarNegSibV0InvMassK0s," fTreeCascVarNegSibV0InvMassK0s            /F");
-        fTreeCascade->Branch("fTreeCascVarNegSibV0InvMassLambda",&fTreeCascVarNegSibV0InvMassLambda," fTreeCascVarNegSibV0InvMassLambda/F");
-        fTreeCascade->Branch("fTreeCascVarNegSibV0InvMassAntiLambda",&fTreeCascVarNegSibV0InvMassAntiLambda," fTreeCascVarNegSibV0InvMassAntiLambda/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegSibPt",&fTreeCascVarNegSibPt," fTreeCascVarNegSibPt/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegSibDcaV0ToPrimVertex",&fTreeCascVarNegSibDcaV0ToPrimVertex," fTreeCascVarNegSibDcaV0ToPrimVertex/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegSibDcaV0Daughters",&fTreeCascVarNegSibDcaV0Daughters," fTreeCascVarNegSibDcaV0Daughters/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegSibV0CosineOfPointingAngle",&fTreeCascVarNegSibV0CosineOfPointingAngle," fTreeCascVarNegSibV0CosineOfPointingAngle /F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegSibV0V0Radius",&fTreeCascVarNegSibV0V0Radius," fTreeCascVarNegSibV0V0Radius/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegSibV0DcaPosToPrimVertex",&fTreeCascVarNegSibV0DcaPosToPrimVertex," fTreeCascVarNegSibV0DcaPosToPrimVertex/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegSibV0DcaNegToPrimVertex",&fTreeCascVarNegSibV0DcaNegToPrimVertex," fTreeCascVarNegSibV0DcaNegToPrimVertex/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegSibV0InvMassK0s",&fTreeCascVarNegSibV0InvMassK0s," fTreeCascVarNegSibV0InvMassK0s            /F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegSibV0InvMassLambda",&fTreeCascVarNegSibV0InvMassLambda," fTreeCascVarNegSibV0InvMassLambda/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegSibV0InvMassAntiLambda",&fTreeCascVarNegSibV0InvMassAntiLambda," fTreeCascVarNegSibV0InvMassAntiLambda/F");
         //Pos
-        fTreeCascade->Branch("fTreeCascVarPosSibPt",&fTreeCascVarPosSibPt," fTreeCascVarPosSibPt/F");
-        fTreeCascade->Branch("fTreeCascVarPosSibDcaV0ToPrimVertex",&fTreeCascVarPosSibDcaV0ToPrimVertex," fTreeCascVarPosSibDcaV0ToPrimVertex/F");
-        fTreeCascade->Branch("fTreeCascVarPosSibDcaV0Daughters",&fTreeCascVarPosSibDcaV0Daughters," fTreeCascVarPosSibDcaV0Daughters/F");
-        fTreeCascade->Branch("fTreeCascVarPosSibV0CosineOfPointingAngle",&fTreeCascVarPosSibV0CosineOfPointingAngle," fTreeCascVarPosSibV0CosineOfPointingAngle /F");
-        fTreeCascade->Branch("fTreeCascVarPosSibV0V0Radius",&fTreeCascVarPosSibV0V0Radius," fTreeCascVarPosSibV0V0Radius/F");
-        fTreeCascade->Branch("fTreeCascVarPosSibV0DcaPosToPrimVertex",&fTreeCascVarPosSibV0DcaPosToPrimVertex," fTreeCascVarPosSibV0DcaPosToPrimVertex/F");
-        fTreeCascade->Branch("fTreeCascVarPosSibV0DcaNegToPrimVertex",&fTreeCascVarPosSibV0DcaNegToPrimVertex," fTreeCascVarPosSibV0DcaNegToPrimVertex/F");
-        fTreeCascade->Branch("fTreeCascVarPosSibV0InvMassK0s",&fTreeCascVarPosSibV0InvMassK0s," fTreeCascVarPosSibV0InvMassK0s            /F");
-        fTreeCascade->Branch("fTreeCascVarPosSibV0InvMassLambda",&fTreeCascVarPosSibV0InvMassLambda," fTreeCascVarPosSibV0InvMassLambda/F");
-        fTreeCascade->Branch("fTreeCascVarPosSibV0InvMassAntiLambda",&fTreeCascVarPosSibV0InvMassAntiLambda," fTreeCascVarPosSibV0InvMassAntiLambda/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosSibPt",&fTreeCascVarPosSibPt," fTreeCascVarPosSibPt/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosSibDcaV0ToPrimVertex",&fTreeCascVarPosSibDcaV0ToPrimVertex," fTreeCascVarPosSibDcaV0ToPrimVertex/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosSibDcaV0Daughters",&fTreeCascVarPosSibDcaV0Daughters," fTreeCascVarPosSibDcaV0Daughters/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosSibV0CosineOfPointingAngle",&fTreeCascVarPosSibV0CosineOfPointingAngle," fTreeCascVarPosSibV0CosineOfPointingAngle /F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosSibV0V0Radius",&fTreeCascVarPosSibV0V0Radius," fTreeCascVarPosSibV0V0Radius/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosSibV0DcaPosToPrimVertex",&fTreeCascVarPosSibV0DcaPosToPrimVertex," fTreeCascVarPosSibV0DcaPosToPrimVertex/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosSibV0DcaNegToPrimVertex",&fTreeCascVarPosSibV0DcaNegToPrimVertex," fTreeCascVarPosSibV0DcaNegToPrimVertex/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosSibV0InvMassK0s",&fTreeCascVarPosSibV0InvMassK0s," fTreeCascVarPosSibV0InvMassK0s            /F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosSibV0InvMassLambda",&fTreeCascVarPosSibV0InvMassLambda," fTreeCascVarPosSibV0InvMassLambda/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosSibV0InvMassAntiLambda",&fTreeCascVarPosSibV0InvMassAntiLambda," fTreeCascVarPosSibV0InvMassAntiLambda/F");
          */
 
         if ( fkDebugWrongPIDForTracking ){
-            fTreeCascade->Branch("fTreeCascVarPosPIDForTracking",&fTreeCascVarPosPIDForTracking,"fTreeCascVarPosPIDForTracking/I");
-            fTreeCascade->Branch("fTreeCascVarNegPIDForTracking",&fTreeCascVarNegPIDForTracking,"fTreeCascVarNegPIDForTracking/I");
-            fTreeCascade->Branch("fTreeCascVarBachPIDForTracking",&fTreeCascVarBachPIDForTracking,"fTreeCascVarBachPIDForTracking/I");
-            fTreeCascade->Branch("fTreeCascVarPosdEdx",&fTreeCascVarPosdEdx,"fTreeCascVarPosdEdx/F");
-            fTreeCascade->Branch("fTreeCascVarNegdEdx",&fTreeCascVarNegdEdx,"fTreeCascVarNegdEdx/F");
-            fTreeCascade->Branch("fTreeCascVarBachdEdx",&fTreeCascVarBachdEdx,"fTreeCascVarBachdEdx/F");
-            fTreeCascade->Branch("fTreeCascVarPosInnerP",&fTreeCascVarPosInnerP,"fTreeCascVarPosInnerP/F");
-            fTreeCascade->Branch("fTreeCascVarNegInnerP",&fTreeCascVarNegInnerP,"fTreeCascVarNegInnerP/F");
-            fTreeCascade->Branch("fTreeCascVarBachInnerP",&fTreeCascVarBachInnerP,"fTreeCascVarBachInnerP/F");
-            fTreeCascade->Branch("fTreeCascVarNegTrackStatus",&fTreeCascVarNegTrackStatus,"fTreeCascVarNegTrackStatus/l");
-            fTreeCascade->Branch("fTreeCascVarPosTrackStatus",&fTreeCascVarPosTrackStatus,"fTreeCascVarPosTrackStatus/l");
-            fTreeCascade->Branch("fTreeCascVarBachTrackStatus",&fTreeCascVarBachTrackStatus,"fTreeCascVarBachTrackStatus/l");
-            fTreeCascade->Branch("fTreeCascVarNegDCAz",&fTreeCascVarNegDCAz,"fTreeCascVarNegDCAz/F");
-            fTreeCascade->Branch("fTreeCascVarPosDCAz",&fTreeCascVarPosDCAz,"fTreeCascVarPosDCAz/F");
-            fTreeCascade->Branch("fTreeCascVarBachDCAz",&fTreeCascVarBachDCAz,"fTreeCascVarBachDCAz/F");
-            fTreeCascade->Branch("fTreeCascVarNegTOFExpTDiff",&fTreeCascVarNegTOFExpTDiff,"fTreeCascVarNegTOFExpTDiff/F");
-            fTreeCascade->Branch("fTreeCascVarPosTOFExpTDiff",&fTreeCascVarPosTOFExpTDiff,"fTreeCascVarPosTOFExpTDiff/F");
-            fTreeCascade->Branch("fTreeCascVarBachTOFExpTDiff",&fTreeCascVarBachTOFExpTDiff,"fTreeCascVarBachTOFExpTDiff/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosPIDForTracking",&fTreeCascVarPosPIDForTracking,"fTreeCascVarPosPIDForTracking/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegPIDForTracking",&fTreeCascVarNegPIDForTracking,"fTreeCascVarNegPIDForTracking/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachPIDForTracking",&fTreeCascVarBachPIDForTracking,"fTreeCascVarBachPIDForTracking/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosdEdx",&fTreeCascVarPosdEdx,"fTreeCascVarPosdEdx/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegdEdx",&fTreeCascVarNegdEdx,"fTreeCascVarNegdEdx/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachdEdx",&fTreeCascVarBachdEdx,"fTreeCascVarBachdEdx/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosInnerP",&fTreeCascVarPosInnerP,"fTreeCascVarPosInnerP/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegInnerP",&fTreeCascVarNegInnerP,"fTreeCascVarNegInnerP/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachInnerP",&fTreeCascVarBachInnerP,"fTreeCascVarBachInnerP/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegTrackStatus",&fTreeCascVarNegTrackStatus,"fTreeCascVarNegTrackStatus/l");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosTrackStatus",&fTreeCascVarPosTrackStatus,"fTreeCascVarPosTrackStatus/l");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachTrackStatus",&fTreeCascVarBachTrackStatus,"fTreeCascVarBachTrackStatus/l");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegDCAz",&fTreeCascVarNegDCAz,"fTreeCascVarNegDCAz/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosDCAz",&fTreeCascVarPosDCAz,"fTreeCascVarPosDCAz/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachDCAz",&fTreeCascVarBachDCAz,"fTreeCascVarBachDCAz/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegTOFExpTDiff",&fTreeCascVarNegTOFExpTDiff,"fTreeCascVarNegTOFExpTDiff/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosTOFExpTDiff",&fTreeCascVarPosTOFExpTDiff,"fTreeCascVarPosTOFExpTDiff/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachTOFExpTDiff",&fTreeCascVarBachTOFExpTDiff,"fTreeCascVarBachTOFExpTDiff/F");
            
         }
         //------------------------------------------------
         if ( fkDebugBump ){
             //Variables for debugging the invariant mass bump
-            fTreeCascade->Branch("fTreeCascVarPosPx",&fTreeCascVarPosPx,"fTreeCascVarPosPx/F");
-            fTreeCascade->Branch("fTreeCascVarPosPy",&fTreeCascVarPosPy,"fTreeCascVarPosPy/F");
-            fTreeCascade->Branch("fTreeCascVarPosPz",&fTreeCascVarPosPz,"fTreeCascVarPosPz/F");
-            fTreeCascade->Branch("fTreeCascVarNegPx",&fTreeCascVarNegPx,"fTreeCascVarNegPx/F");
-            fTreeCascade->Branch("fTreeCascVarNegPy",&fTreeCascVarNegPy,"fTreeCascVarNegPy/F");
-            fTreeCascade->Branch("fTreeCascVarNegPz",&fTreeCascVarNegPz,"fTreeCascVarNegPz/F");
-            fTreeCascade->Branch("fTreeCascVarBachPx",&fTreeCascVarBachPx,"fTreeCascVarBachPx/F");
-            fTreeCascade->Branch("fTreeCascVarBachPy",&fTreeCascVarBachPy,"fTreeCascVarBachPy/F");
-            fTreeCascade->Branch("fTreeCascVarBachPz",&fTreeCascVarBachPz,"fTreeCascVarBachPz/F");
-            fTreeCascade->Branch("fTreeCascVarPosPxMC",&fTreeCascVarPosPxMC,"fTreeCascVarPosPxMC/F");
-            fTreeCascade->Branch("fTreeCascVarPosPyMC",&fTreeCascVarPosPyMC,"fTreeCascVarPosPyMC/F");
-            fTreeCascade->Branch("fTreeCascVarPosPzMC",&fTreeCascVarPosPzMC,"fTreeCascVarPosPzMC/F");
-            fTreeCascade->Branch("fTreeCascVarNegPxMC",&fTreeCascVarNegPxMC,"fTreeCascVarNegPxMC/F");
-            fTreeCascade->Branch("fTreeCascVarNegPyMC",&fTreeCascVarNegPyMC,"fTreeCascVarNegPyMC/F");
-            fTreeCascade->Branch("fTreeCascVarNegPzMC",&fTreeCascVarNegPzMC,"fTreeCascVarNegPzMC/F");
-            fTreeCascade->Branch("fTreeCascVarBachPxMC",&fTreeCascVarBachPxMC,"fTreeCascVarBachPxMC/F");
-            fTreeCascade->Branch("fTreeCascVarBachPyMC",&fTreeCascVarBachPyMC,"fTreeCascVarBachPyMC/F");
-            fTreeCascade->Branch("fTreeCascVarBachPzMC",&fTreeCascVarBachPzMC,"fTreeCascVarBachPzMC/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosPx",&fTreeCascVarPosPx,"fTreeCascVarPosPx/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosPy",&fTreeCascVarPosPy,"fTreeCascVarPosPy/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosPz",&fTreeCascVarPosPz,"fTreeCascVarPosPz/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegPx",&fTreeCascVarNegPx,"fTreeCascVarNegPx/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegPy",&fTreeCascVarNegPy,"fTreeCascVarNegPy/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegPz",&fTreeCascVarNegPz,"fTreeCascVarNegPz/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachPx",&fTreeCascVarBachPx,"fTreeCascVarBachPx/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachPy",&fTreeCascVarBachPy,"fTreeCascVarBachPy/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachPz",&fTreeCascVarBachPz,"fTreeCascVarBachPz/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosPxMC",&fTreeCascVarPosPxMC,"fTreeCascVarPosPxMC/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosPyMC",&fTreeCascVarPosPyMC,"fTreeCascVarPosPyMC/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosPzMC",&fTreeCascVarPosPzMC,"fTreeCascVarPosPzMC/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegPxMC",&fTreeCascVarNegPxMC,"fTreeCascVarNegPxMC/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegPyMC",&fTreeCascVarNegPyMC,"fTreeCascVarNegPyMC/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegPzMC",&fTreeCascVarNegPzMC,"fTreeCascVarNegPzMC/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachPxMC",&fTreeCascVarBachPxMC,"fTreeCascVarBachPxMC/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachPyMC",&fTreeCascVarBachPyMC,"fTreeCascVarBachPyMC/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachPzMC",&fTreeCascVarBachPzMC,"fTreeCascVarBachPzMC/F");
             
             // Decay positions
-            /*fTreeCascade->Branch("fTreeCascVarV0DecayX",&fTreeCascVarV0DecayX,"fTreeCascVarV0DecayX/F");
-            fTreeCascade->Branch("fTreeCascVarV0DecayY",&fTreeCascVarV0DecayY,"fTreeCascVarV0DecayY/F");
-            fTreeCascade->Branch("fTreeCascVarV0DecayZ",&fTreeCascVarV0DecayZ,"fTreeCascVarV0DecayZ/F");
-            fTreeCascade->Branch("fTreeCascVarCascadeDecayX",&fTreeCascVarCascadeDecayX,"fTreeCascVarCascadeDecayX/F");
-            fTreeCascade->Branch("fTreeCascVarCascadeDecayY",&fTreeCascVarCascadeDecayY,"fTreeCascVarCascadeDecayY/F");
-            fTreeCascade->Branch("fTreeCascVarCascadeDecayZ",&fTreeCascVarCascadeDecayZ,"fTreeCascVarCascadeDecayZ/F");
+            /*lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DecayX",&fTreeCascVarV0DecayX,"fTreeCascVarV0DecayX/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DecayY",&fTreeCascVarV0DecayY,"fTreeCascVarV0DecayY/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DecayZ",&fTreeCascVarV0DecayZ,"fTreeCascVarV0DecayZ/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarCascadeDecayX",&fTreeCascVarCascadeDecayX,"fTreeCascVarCascadeDecayX/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarCascadeDecayY",&fTreeCascVarCascadeDecayY,"fTreeCascVarCascadeDecayY/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarCascadeDecayZ",&fTreeCascVarCascadeDecayZ,"fTreeCascVarCascadeDecayZ/F");
             // MC record decay positions
-            fTreeCascade->Branch("fTreeCascVarV0DecayXMC",&fTreeCascVarV0DecayXMC,"fTreeCascVarV0DecayXMC/F");
-            fTreeCascade->Branch("fTreeCascVarV0DecayYMC",&fTreeCascVarV0DecayYMC,"fTreeCascVarV0DecayYMC/F");
-            fTreeCascade->Branch("fTreeCascVarV0DecayZMC",&fTreeCascVarV0DecayZMC,"fTreeCascVarV0DecayZMC/F");
-            fTreeCascade->Branch("fTreeCascVarCascadeDecayXMC",&fTreeCascVarCascadeDecayXMC,"fTreeCascVarCascadeDecayXMC/F");
-            fTreeCascade->Branch("fTreeCascVarCascadeDecayYMC",&fTreeCascVarCascadeDecayYMC,"fTreeCascVarCascadeDecayYMC/F");
-            fTreeCascade->Branch("fTreeCascVarCascadeDecayZMC",&fTreeCascVarCascadeDecayZMC,"fTreeCascVarCascadeDecayZMC/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DecayXMC",&fTreeCascVarV0DecayXMC,"fTreeCascVarV0DecayXMC/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DecayYMC",&fTreeCascVarV0DecayYMC,"fTreeCascVarV0DecayYMC/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DecayZMC",&fTreeCascVarV0DecayZMC,"fTreeCascVarV0DecayZMC/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarCascadeDecayXMC",&fTreeCascVarCascadeDecayXMC,"fTreeCascVarCascadeDecayXMC/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarCascadeDecayYMC",&fTreeCascVarCascadeDecayYMC,"fTreeCascVarCascadeDecayYMC/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarCascadeDecayZMC",&fTreeCascVarCascadeDecayZMC,"fTreeCascVarCascadeDecayZMC/F");
             
-            fTreeCascade->Branch("fTreeCascVarV0Lifetime",&fTreeCascVarV0Lifetime,"fTreeCascVarV0Lifetime/F");
-            fTreeCascade->Branch("fTreeCascVarV0ChiSquare",&fTreeCascVarV0ChiSquare,"fTreeCascVarV0ChiSquare/F");
-            fTreeCascade->Branch("fTreeCascVarMagField",&fTreeCascVarMagField,"fTreeCascVarMagField/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0Lifetime",&fTreeCascVarV0Lifetime,"fTreeCascVarV0Lifetime/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0ChiSquare",&fTreeCascVarV0ChiSquare,"fTreeCascVarV0ChiSquare/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarMagField",&fTreeCascVarMagField,"fTreeCascVarMagField/F");
             //Track Labels (check for duplicates, etc)
             
-            fTreeCascade->Branch("fTreeCascVarBachelorDCAptX",&fTreeCascVarBachelorDCAptX,"fTreeCascVarBachelorDCAptX/F");
-            fTreeCascade->Branch("fTreeCascVarBachelorDCAptY",&fTreeCascVarBachelorDCAptY,"fTreeCascVarBachelorDCAptY/F");
-            fTreeCascade->Branch("fTreeCascVarBachelorDCAptZ",&fTreeCascVarBachelorDCAptZ,"fTreeCascVarBachelorDCAptZ/F");
-            fTreeCascade->Branch("fTreeCascVarV0DCAptX",&fTreeCascVarV0DCAptX,"fTreeCascVarV0DCAptX/F");
-            fTreeCascade->Branch("fTreeCascVarV0DCAptY",&fTreeCascVarV0DCAptY,"fTreeCascVarV0DCAptY/F");
-            fTreeCascade->Branch("fTreeCascVarV0DCAptZ",&fTreeCascVarV0DCAptZ,"fTreeCascVarV0DCAptZ/F");
-            fTreeCascade->Branch("fTreeCascVarDCADaughters_Test",&fTreeCascVarDCADaughters_Test,"fTreeCascVarDCADaughters_Test/F");
-            fTreeCascade->Branch("fTreeCascVarBachelorDCAptSigmaX2",&fTreeCascVarBachelorDCAptSigmaX2,"fTreeCascVarBachelorDCAptSigmaX2/F");
-            fTreeCascade->Branch("fTreeCascVarBachelorDCAptSigmaY2",&fTreeCascVarBachelorDCAptSigmaY2,"fTreeCascVarBachelorDCAptSigmaY2/F");
-            fTreeCascade->Branch("fTreeCascVarBachelorDCAptSigmaZ2",&fTreeCascVarBachelorDCAptSigmaZ2,"fTreeCascVarBachelorDCAptSigmaZ2/F");
-            fTreeCascade->Branch("fTreeCascVarV0DCAptUncertainty_V0Pos",&fTreeCascVarV0DCAptUncertainty_V0Pos,"fTreeCascVarV0DCAptUncertainty_V0Pos/F");
-            fTreeCascade->Branch("fTreeCascVarV0DCAptUncertainty_V0Ang",&fTreeCascVarV0DCAptUncertainty_V0Ang,"fTreeCascVarV0DCAptUncertainty_V0Ang/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachelorDCAptX",&fTreeCascVarBachelorDCAptX,"fTreeCascVarBachelorDCAptX/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachelorDCAptY",&fTreeCascVarBachelorDCAptY,"fTreeCascVarBachelorDCAptY/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachelorDCAptZ",&fTreeCascVarBachelorDCAptZ,"fTreeCascVarBachelorDCAptZ/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DCAptX",&fTreeCascVarV0DCAptX,"fTreeCascVarV0DCAptX/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DCAptY",&fTreeCascVarV0DCAptY,"fTreeCascVarV0DCAptY/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DCAptZ",&fTreeCascVarV0DCAptZ,"fTreeCascVarV0DCAptZ/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarDCADaughters_Test",&fTreeCascVarDCADaughters_Test,"fTreeCascVarDCADaughters_Test/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachelorDCAptSigmaX2",&fTreeCascVarBachelorDCAptSigmaX2,"fTreeCascVarBachelorDCAptSigmaX2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachelorDCAptSigmaY2",&fTreeCascVarBachelorDCAptSigmaY2,"fTreeCascVarBachelorDCAptSigmaY2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachelorDCAptSigmaZ2",&fTreeCascVarBachelorDCAptSigmaZ2,"fTreeCascVarBachelorDCAptSigmaZ2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DCAptUncertainty_V0Pos",&fTreeCascVarV0DCAptUncertainty_V0Pos,"fTreeCascVarV0DCAptUncertainty_V0Pos/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DCAptUncertainty_V0Ang",&fTreeCascVarV0DCAptUncertainty_V0Ang,"fTreeCascVarV0DCAptUncertainty_V0Ang/F");
             
-            fTreeCascade->Branch("fTreeCascVarV0DCAptPosSigmaX2",&fTreeCascVarV0DCAptPosSigmaX2,"fTreeCascVarV0DCAptPosSigmaX2/F");
-            fTreeCascade->Branch("fTreeCascVarV0DCAptPosSigmaY2",&fTreeCascVarV0DCAptPosSigmaY2,"fTreeCascVarV0DCAptPosSigmaY2/F");
-            fTreeCascade->Branch("fTreeCascVarV0DCAptPosSigmaZ2",&fTreeCascVarV0DCAptPosSigmaZ2,"fTreeCascVarV0DCAptPosSigmaZ2/F");
-            fTreeCascade->Branch("fTreeCascVarV0DCAptPosSigmaSnp2",&fTreeCascVarV0DCAptPosSigmaSnp2,"fTreeCascVarV0DCAptPosSigmaSnp2/F");
-            fTreeCascade->Branch("fTreeCascVarV0DCAptPosSigmaTgl2",&fTreeCascVarV0DCAptPosSigmaTgl2,"fTreeCascVarV0DCAptPosSigmaTgl2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DCAptPosSigmaX2",&fTreeCascVarV0DCAptPosSigmaX2,"fTreeCascVarV0DCAptPosSigmaX2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DCAptPosSigmaY2",&fTreeCascVarV0DCAptPosSigmaY2,"fTreeCascVarV0DCAptPosSigmaY2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DCAptPosSigmaZ2",&fTreeCascVarV0DCAptPosSigmaZ2,"fTreeCascVarV0DCAptPosSigmaZ2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DCAptPosSigmaSnp2",&fTreeCascVarV0DCAptPosSigmaSnp2,"fTreeCascVarV0DCAptPosSigmaSnp2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DCAptPosSigmaTgl2",&fTreeCascVarV0DCAptPosSigmaTgl2,"fTreeCascVarV0DCAptPosSigmaTgl2/F");
             
-            fTreeCascade->Branch("fTreeCascVarV0DCAptNegSigmaX2",&fTreeCascVarV0DCAptNegSigmaX2,"fTreeCascVarV0DCAptNegSigmaX2/F");
-            fTreeCascade->Branch("fTreeCascVarV0DCAptNegSigmaY2",&fTreeCascVarV0DCAptNegSigmaY2,"fTreeCascVarV0DCAptNegSigmaY2/F");
-            fTreeCascade->Branch("fTreeCascVarV0DCAptNegSigmaZ2",&fTreeCascVarV0DCAptNegSigmaZ2,"fTreeCascVarV0DCAptNegSigmaZ2/F");
-            fTreeCascade->Branch("fTreeCascVarV0DCAptNegSigmaSnp2",&fTreeCascVarV0DCAptNegSigmaSnp2,"fTreeCascVarV0DCAptNegSigmaSnp2/F");
-            fTreeCascade->Branch("fTreeCascVarV0DCAptNegSigmaTgl2",&fTreeCascVarV0DCAptNegSigmaTgl2,"fTreeCascVarV0DCAptNegSigmaTgl2/F");
-            fTreeCascade->Branch("fTreeCascVarNegDCAPVSigmaX2",&fTreeCascVarNegDCAPVSigmaX2,"fTreeCascVarNegDCAPVSigmaX2/F");
-            fTreeCascade->Branch("fTreeCascVarNegDCAPVSigmaY2",&fTreeCascVarNegDCAPVSigmaY2,"fTreeCascVarNegDCAPVSigmaY2/F");
-            fTreeCascade->Branch("fTreeCascVarNegDCAPVSigmaZ2",&fTreeCascVarNegDCAPVSigmaZ2,"fTreeCascVarNegDCAPVSigmaZ2/F");
-            fTreeCascade->Branch("fTreeCascVarPosDCAPVSigmaX2",&fTreeCascVarPosDCAPVSigmaX2,"fTreeCascVarPosDCAPVSigmaX2/F");
-            fTreeCascade->Branch("fTreeCascVarPosDCAPVSigmaY2",&fTreeCascVarPosDCAPVSigmaY2,"fTreeCascVarPosDCAPVSigmaY2/F");
-            fTreeCascade->Branch("fTreeCascVarPosDCAPVSigmaZ2",&fTreeCascVarPosDCAPVSigmaZ2,"fTreeCascVarPosDCAPVSigmaZ2/F");
-            fTreeCascade->Branch("fTreeCascVarBachDCAPVSigmaX2",&fTreeCascVarBachDCAPVSigmaX2,"fTreeCascVarBachDCAPVSigmaX2/F");
-            fTreeCascade->Branch("fTreeCascVarBachDCAPVSigmaY2",&fTreeCascVarBachDCAPVSigmaY2,"fTreeCascVarBachDCAPVSigmaY2/F");
-            fTreeCascade->Branch("fTreeCascVarBachDCAPVSigmaZ2",&fTreeCascVarBachDCAPVSigmaZ2,"fTreeCascVarBachDCAPVSigmaZ2/F");*/
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DCAptNegSigmaX2",&fTreeCascVarV0DCAptNegSigmaX2,"fTreeCascVarV0DCAptNegSigmaX2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DCAptNegSigmaY2",&fTreeCascVarV0DCAptNegSigmaY2,"fTreeCascVarV0DCAptNegSigmaY2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DCAptNegSigmaZ2",&fTreeCascVarV0DCAptNegSigmaZ2,"fTreeCascVarV0DCAptNegSigmaZ2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DCAptNegSigmaSnp2",&fTreeCascVarV0DCAptNegSigmaSnp2,"fTreeCascVarV0DCAptNegSigmaSnp2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0DCAptNegSigmaTgl2",&fTreeCascVarV0DCAptNegSigmaTgl2,"fTreeCascVarV0DCAptNegSigmaTgl2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegDCAPVSigmaX2",&fTreeCascVarNegDCAPVSigmaX2,"fTreeCascVarNegDCAPVSigmaX2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegDCAPVSigmaY2",&fTreeCascVarNegDCAPVSigmaY2,"fTreeCascVarNegDCAPVSigmaY2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegDCAPVSigmaZ2",&fTreeCascVarNegDCAPVSigmaZ2,"fTreeCascVarNegDCAPVSigmaZ2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosDCAPVSigmaX2",&fTreeCascVarPosDCAPVSigmaX2,"fTreeCascVarPosDCAPVSigmaX2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosDCAPVSigmaY2",&fTreeCascVarPosDCAPVSigmaY2,"fTreeCascVarPosDCAPVSigmaY2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosDCAPVSigmaZ2",&fTreeCascVarPosDCAPVSigmaZ2,"fTreeCascVarPosDCAPVSigmaZ2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachDCAPVSigmaX2",&fTreeCascVarBachDCAPVSigmaX2,"fTreeCascVarBachDCAPVSigmaX2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachDCAPVSigmaY2",&fTreeCascVarBachDCAPVSigmaY2,"fTreeCascVarBachDCAPVSigmaY2/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachDCAPVSigmaZ2",&fTreeCascVarBachDCAPVSigmaZ2,"fTreeCascVarBachDCAPVSigmaZ2/F");*/
         }
         if ( fkDebugParenthood ){
-            fTreeCascade->Branch("fTreeCascVarNegIndex",&fTreeCascVarNegIndex,"fTreeCascVarNegIndex/I");
-            fTreeCascade->Branch("fTreeCascVarPosIndex",&fTreeCascVarPosIndex,"fTreeCascVarPosIndex/I");
-            fTreeCascade->Branch("fTreeCascVarBachIndex",&fTreeCascVarBachIndex,"fTreeCascVarBachIndex/I");
-            fTreeCascade->Branch("fTreeCascVarNegLabel",&fTreeCascVarNegLabel,"fTreeCascVarNegLabel/I");
-            fTreeCascade->Branch("fTreeCascVarPosLabel",&fTreeCascVarPosLabel,"fTreeCascVarPosLabel/I");
-            fTreeCascade->Branch("fTreeCascVarBachLabel",&fTreeCascVarBachLabel,"fTreeCascVarBachLabel/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegIndex",&fTreeCascVarNegIndex,"fTreeCascVarNegIndex/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosIndex",&fTreeCascVarPosIndex,"fTreeCascVarPosIndex/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachIndex",&fTreeCascVarBachIndex,"fTreeCascVarBachIndex/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegLabel",&fTreeCascVarNegLabel,"fTreeCascVarNegLabel/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosLabel",&fTreeCascVarPosLabel,"fTreeCascVarPosLabel/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachLabel",&fTreeCascVarBachLabel,"fTreeCascVarBachLabel/I");
             //Even more parenthood information
-            fTreeCascade->Branch("fTreeCascVarNegLabelMother",&fTreeCascVarNegLabelMother,"fTreeCascVarNegLabelMother/I");
-            fTreeCascade->Branch("fTreeCascVarPosLabelMother",&fTreeCascVarPosLabelMother,"fTreeCascVarPosLabelMother/I");
-            fTreeCascade->Branch("fTreeCascVarBachLabelMother",&fTreeCascVarBachLabelMother,"fTreeCascVarBachLabelMother/I");
-            fTreeCascade->Branch("fTreeCascVarNegLabelGrandMother",&fTreeCascVarNegLabelGrandMother,"fTreeCascVarNegLabelGrandMother/I");
-            fTreeCascade->Branch("fTreeCascVarPosLabelGrandMother",&fTreeCascVarPosLabelGrandMother,"fTreeCascVarPosLabelGrandMother/I");
-            fTreeCascade->Branch("fTreeCascVarBachLabelGrandMother",&fTreeCascVarBachLabelGrandMother,"fTreeCascVarBachLabelGrandMother/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegLabelMother",&fTreeCascVarNegLabelMother,"fTreeCascVarNegLabelMother/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosLabelMother",&fTreeCascVarPosLabelMother,"fTreeCascVarPosLabelMother/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachLabelMother",&fTreeCascVarBachLabelMother,"fTreeCascVarBachLabelMother/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegLabelGrandMother",&fTreeCascVarNegLabelGrandMother,"fTreeCascVarNegLabelGrandMother/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosLabelGrandMother",&fTreeCascVarPosLabelGrandMother,"fTreeCascVarPosLabelGrandMother/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachLabelGrandMother",&fTreeCascVarBachLabelGrandMother,"fTreeCascVarBachLabelGrandMother/I");
             //Event Number (check same-event index mixups)
-            fTreeCascade->Branch("fTreeCascVarEventNumber",&fTreeCascVarEventNumber,"fTreeCascVarEventNumber/l");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarEventNumber",&fTreeCascVarEventNumber,"fTreeCascVarEventNumber/l");
             
-            fTreeCascade->Branch("fTreeCascVarIsPhysicalPrimaryNegative",&fTreeCascVarIsPhysicalPrimaryNegative,"fTreeCascVarIsPhysicalPrimaryNegative/O");
-            fTreeCascade->Branch("fTreeCascVarIsPhysicalPrimaryPositive",&fTreeCascVarIsPhysicalPrimaryPositive,"fTreeCascVarIsPhysicalPrimaryPositive/O");
-            fTreeCascade->Branch("fTreeCascVarIsPhysicalPrimaryBachelor",&fTreeCascVarIsPhysicalPrimaryBachelor,"fTreeCascVarIsPhysicalPrimaryBachelor/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarIsPhysicalPrimaryNegative",&fTreeCascVarIsPhysicalPrimaryNegative,"fTreeCascVarIsPhysicalPrimaryNegative/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarIsPhysicalPrimaryPositive",&fTreeCascVarIsPhysicalPrimaryPositive,"fTreeCascVarIsPhysicalPrimaryPositive/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarIsPhysicalPrimaryBachelor",&fTreeCascVarIsPhysicalPrimaryBachelor,"fTreeCascVarIsPhysicalPrimaryBachelor/O");
             
-            fTreeCascade->Branch("fTreeCascVarIsPhysicalPrimaryNegativeMother",&fTreeCascVarIsPhysicalPrimaryNegativeMother,"fTreeCascVarIsPhysicalPrimaryNegativeMother/O");
-            fTreeCascade->Branch("fTreeCascVarIsPhysicalPrimaryPositiveMother",&fTreeCascVarIsPhysicalPrimaryPositiveMother,"fTreeCascVarIsPhysicalPrimaryPositiveMother/O");
-            fTreeCascade->Branch("fTreeCascVarIsPhysicalPrimaryBachelorMother",&fTreeCascVarIsPhysicalPrimaryBachelorMother,"fTreeCascVarIsPhysicalPrimaryBachelorMother/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarIsPhysicalPrimaryNegativeMother",&fTreeCascVarIsPhysicalPrimaryNegativeMother,"fTreeCascVarIsPhysicalPrimaryNegativeMother/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarIsPhysicalPrimaryPositiveMother",&fTreeCascVarIsPhysicalPrimaryPositiveMother,"fTreeCascVarIsPhysicalPrimaryPositiveMother/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarIsPhysicalPrimaryBachelorMother",&fTreeCascVarIsPhysicalPrimaryBachelorMother,"fTreeCascVarIsPhysicalPrimaryBachelorMother/O");
             
-            fTreeCascade->Branch("fTreeCascVarIsPhysicalPrimaryNegativeGrandMother",&fTreeCascVarIsPhysicalPrimaryNegativeGrandMother,"fTreeCascVarIsPhysicalPrimaryNegativeGrandMother/O");
-            fTreeCascade->Branch("fTreeCascVarIsPhysicalPrimaryPositiveGrandMother",&fTreeCascVarIsPhysicalPrimaryPositiveGrandMother,"fTreeCascVarIsPhysicalPrimaryPositiveGrandMother/O");
-            fTreeCascade->Branch("fTreeCascVarIsPhysicalPrimaryBachelorGrandMother",&fTreeCascVarIsPhysicalPrimaryBachelorGrandMother,"fTreeCascVarIsPhysicalPrimaryBachelorGrandMother/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarIsPhysicalPrimaryNegativeGrandMother",&fTreeCascVarIsPhysicalPrimaryNegativeGrandMother,"fTreeCascVarIsPhysicalPrimaryNegativeGrandMother/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarIsPhysicalPrimaryPositiveGrandMother",&fTreeCascVarIsPhysicalPrimaryPositiveGrandMother,"fTreeCascVarIsPhysicalPrimaryPositiveGrandMother/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarIsPhysicalPrimaryBachelorGrandMother",&fTreeCascVarIsPhysicalPrimaryBachelorGrandMother,"fTreeCascVarIsPhysicalPrimaryBachelorGrandMother/O");
         }
         if ( fkDebugParenthood || fkDebugOOBPileup ){
-            fTreeCascade->Branch("fTreeCascVarPosITSClusters0",&fTreeCascVarPosITSClusters0,"fTreeCascVarPosITSClusters0/O");
-            fTreeCascade->Branch("fTreeCascVarPosITSClusters1",&fTreeCascVarPosITSClusters1,"fTreeCascVarPosITSClusters1/O");
-            fTreeCascade->Branch("fTreeCascVarPosITSClusters2",&fTreeCascVarPosITSClusters2,"fTreeCascVarPosITSClusters2/O");
-            fTreeCascade->Branch("fTreeCascVarPosITSClusters3",&fTreeCascVarPosITSClusters3,"fTreeCascVarPosITSClusters3/O");
-            fTreeCascade->Branch("fTreeCascVarPosITSClusters4",&fTreeCascVarPosITSClusters4,"fTreeCascVarPosITSClusters4/O");
-            fTreeCascade->Branch("fTreeCascVarPosITSClusters5",&fTreeCascVarPosITSClusters5,"fTreeCascVarPosITSClusters5/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosITSClusters0",&fTreeCascVarPosITSClusters0,"fTreeCascVarPosITSClusters0/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosITSClusters1",&fTreeCascVarPosITSClusters1,"fTreeCascVarPosITSClusters1/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosITSClusters2",&fTreeCascVarPosITSClusters2,"fTreeCascVarPosITSClusters2/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosITSClusters3",&fTreeCascVarPosITSClusters3,"fTreeCascVarPosITSClusters3/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosITSClusters4",&fTreeCascVarPosITSClusters4,"fTreeCascVarPosITSClusters4/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosITSClusters5",&fTreeCascVarPosITSClusters5,"fTreeCascVarPosITSClusters5/O");
             
-            fTreeCascade->Branch("fTreeCascVarNegITSClusters0",&fTreeCascVarNegITSClusters0,"fTreeCascVarNegITSClusters0/O");
-            fTreeCascade->Branch("fTreeCascVarNegITSClusters1",&fTreeCascVarNegITSClusters1,"fTreeCascVarNegITSClusters1/O");
-            fTreeCascade->Branch("fTreeCascVarNegITSClusters2",&fTreeCascVarNegITSClusters2,"fTreeCascVarNegITSClusters2/O");
-            fTreeCascade->Branch("fTreeCascVarNegITSClusters3",&fTreeCascVarNegITSClusters3,"fTreeCascVarNegITSClusters3/O");
-            fTreeCascade->Branch("fTreeCascVarNegITSClusters4",&fTreeCascVarNegITSClusters4,"fTreeCascVarNegITSClusters4/O");
-            fTreeCascade->Branch("fTreeCascVarNegITSClusters5",&fTreeCascVarNegITSClusters5,"fTreeCascVarNegITSClusters5/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegITSClusters0",&fTreeCascVarNegITSClusters0,"fTreeCascVarNegITSClusters0/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegITSClusters1",&fTreeCascVarNegITSClusters1,"fTreeCascVarNegITSClusters1/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegITSClusters2",&fTreeCascVarNegITSClusters2,"fTreeCascVarNegITSClusters2/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegITSClusters3",&fTreeCascVarNegITSClusters3,"fTreeCascVarNegITSClusters3/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegITSClusters4",&fTreeCascVarNegITSClusters4,"fTreeCascVarNegITSClusters4/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegITSClusters5",&fTreeCascVarNegITSClusters5,"fTreeCascVarNegITSClusters5/O");
             
-            fTreeCascade->Branch("fTreeCascVarBachITSClusters0",&fTreeCascVarBachITSClusters0,"fTreeCascVarBachITSClusters0/O");
-            fTreeCascade->Branch("fTreeCascVarBachITSClusters1",&fTreeCascVarBachITSClusters1,"fTreeCascVarBachITSClusters1/O");
-            fTreeCascade->Branch("fTreeCascVarBachITSClusters2",&fTreeCascVarBachITSClusters2,"fTreeCascVarBachITSClusters2/O");
-            fTreeCascade->Branch("fTreeCascVarBachITSClusters3",&fTreeCascVarBachITSClusters3,"fTreeCascVarBachITSClusters3/O");
-            fTreeCascade->Branch("fTreeCascVarBachITSClusters4",&fTreeCascVarBachITSClusters4,"fTreeCascVarBachITSClusters4/O");
-            fTreeCascade->Branch("fTreeCascVarBachITSClusters5",&fTreeCascVarBachITSClusters5,"fTreeCascVarBachITSClusters5/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachITSClusters0",&fTreeCascVarBachITSClusters0,"fTreeCascVarBachITSClusters0/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachITSClusters1",&fTreeCascVarBachITSClusters1,"fTreeCascVarBachITSClusters1/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachITSClusters2",&fTreeCascVarBachITSClusters2,"fTreeCascVarBachITSClusters2/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachITSClusters3",&fTreeCascVarBachITSClusters3,"fTreeCascVarBachITSClusters3/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachITSClusters4",&fTreeCascVarBachITSClusters4,"fTreeCascVarBachITSClusters4/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachITSClusters5",&fTreeCascVarBachITSClusters5,"fTreeCascVarBachITSClusters5/O");
             
-            fTreeCascade->Branch("fTreeCascVarPosITSSharedClusters0",&fTreeCascVarPosITSSharedClusters0,"fTreeCascVarPosITSSharedClusters0/O");
-            fTreeCascade->Branch("fTreeCascVarPosITSSharedClusters1",&fTreeCascVarPosITSSharedClusters1,"fTreeCascVarPosITSSharedClusters1/O");
-            fTreeCascade->Branch("fTreeCascVarPosITSSharedClusters2",&fTreeCascVarPosITSSharedClusters2,"fTreeCascVarPosITSSharedClusters2/O");
-            fTreeCascade->Branch("fTreeCascVarPosITSSharedClusters3",&fTreeCascVarPosITSSharedClusters3,"fTreeCascVarPosITSSharedClusters3/O");
-            fTreeCascade->Branch("fTreeCascVarPosITSSharedClusters4",&fTreeCascVarPosITSSharedClusters4,"fTreeCascVarPosITSSharedClusters4/O");
-            fTreeCascade->Branch("fTreeCascVarPosITSSharedClusters5",&fTreeCascVarPosITSSharedClusters5,"fTreeCascVarPosITSSharedClusters5/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosITSSharedClusters0",&fTreeCascVarPosITSSharedClusters0,"fTreeCascVarPosITSSharedClusters0/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosITSSharedClusters1",&fTreeCascVarPosITSSharedClusters1,"fTreeCascVarPosITSSharedClusters1/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosITSSharedClusters2",&fTreeCascVarPosITSSharedClusters2,"fTreeCascVarPosITSSharedClusters2/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosITSSharedClusters3",&fTreeCascVarPosITSSharedClusters3,"fTreeCascVarPosITSSharedClusters3/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosITSSharedClusters4",&fTreeCascVarPosITSSharedClusters4,"fTreeCascVarPosITSSharedClusters4/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosITSSharedClusters5",&fTreeCascVarPosITSSharedClusters5,"fTreeCascVarPosITSSharedClusters5/O");
             
-            fTreeCascade->Branch("fTreeCascVarNegITSSharedClusters0",&fTreeCascVarNegITSSharedClusters0,"fTreeCascVarNegITSSharedClusters0/O");
-            fTreeCascade->Branch("fTreeCascVarNegITSSharedClusters1",&fTreeCascVarNegITSSharedClusters1,"fTreeCascVarNegITSSharedClusters1/O");
-            fTreeCascade->Branch("fTreeCascVarNegITSSharedClusters2",&fTreeCascVarNegITSSharedClusters2,"fTreeCascVarNegITSSharedClusters2/O");
-            fTreeCascade->Branch("fTreeCascVarNegITSSharedClusters3",&fTreeCascVarNegITSSharedClusters3,"fTreeCascVarNegITSSharedClusters3/O");
-            fTreeCascade->Branch("fTreeCascVarNegITSSharedClusters4",&fTreeCascVarNegITSSharedClusters4,"fTreeCascVarNegITSSharedClusters4/O");
-            fTreeCascade->Branch("fTreeCascVarNegITSSharedClusters5",&fTreeCascVarNegITSSharedClusters5,"fTreeCascVarNegITSSharedClusters5/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegITSSharedClusters0",&fTreeCascVarNegITSSharedClusters0,"fTreeCascVarNegITSSharedClusters0/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegITSSharedClusters1",&fTreeCascVarNegITSSharedClusters1,"fTreeCascVarNegITSSharedClusters1/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegITSSharedClusters2",&fTreeCascVarNegITSSharedClusters2,"fTreeCascVarNegITSSharedClusters2/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegITSSharedClusters3",&fTreeCascVarNegITSSharedClusters3,"fTreeCascVarNegITSSharedClusters3/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegITSSharedClusters4",&fTreeCascVarNegITSSharedClusters4,"fTreeCascVarNegITSSharedClusters4/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegITSSharedClusters5",&fTreeCascVarNegITSSharedClusters5,"fTreeCascVarNegITSSharedClusters5/O");
             
-            fTreeCascade->Branch("fTreeCascVarBachITSSharedClusters0",&fTreeCascVarBachITSSharedClusters0,"fTreeCascVarBachITSSharedClusters0/O");
-            fTreeCascade->Branch("fTreeCascVarBachITSSharedClusters1",&fTreeCascVarBachITSSharedClusters1,"fTreeCascVarBachITSSharedClusters1/O");
-            fTreeCascade->Branch("fTreeCascVarBachITSSharedClusters2",&fTreeCascVarBachITSSharedClusters2,"fTreeCascVarBachITSSharedClusters2/O");
-            fTreeCascade->Branch("fTreeCascVarBachITSSharedClusters3",&fTreeCascVarBachITSSharedClusters3,"fTreeCascVarBachITSSharedClusters3/O");
-            fTreeCascade->Branch("fTreeCascVarBachITSSharedClusters4",&fTreeCascVarBachITSSharedClusters4,"fTreeCascVarBachITSSharedClusters4/O");
-            fTreeCascade->Branch("fTreeCascVarBachITSSharedClusters5",&fTreeCascVarBachITSSharedClusters5,"fTreeCascVarBachITSSharedClusters5/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachITSSharedClusters0",&fTreeCascVarBachITSSharedClusters0,"fTreeCascVarBachITSSharedClusters0/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachITSSharedClusters1",&fTreeCascVarBachITSSharedClusters1,"fTreeCascVarBachITSSharedClusters1/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachITSSharedClusters2",&fTreeCascVarBachITSSharedClusters2,"fTreeCascVarBachITSSharedClusters2/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachITSSharedClusters3",&fTreeCascVarBachITSSharedClusters3,"fTreeCascVarBachITSSharedClusters3/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachITSSharedClusters4",&fTreeCascVarBachITSSharedClusters4,"fTreeCascVarBachITSSharedClusters4/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachITSSharedClusters5",&fTreeCascVarBachITSSharedClusters5,"fTreeCascVarBachITSSharedClusters5/O");
             
             //Uncertainty information on mass (from KF) for testing purposes
-            fTreeCascade->Branch("fTreeCascVarV0LambdaMassError",&fTreeCascVarV0LambdaMassError,"fTreeCascVarV0LambdaMassError/F");
-            fTreeCascade->Branch("fTreeCascVarV0AntiLambdaMassError",&fTreeCascVarV0AntiLambdaMassError,"fTreeCascVarV0AntiLambdaMassError/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0LambdaMassError",&fTreeCascVarV0LambdaMassError,"fTreeCascVarV0LambdaMassError/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0AntiLambdaMassError",&fTreeCascVarV0AntiLambdaMassError,"fTreeCascVarV0AntiLambdaMassError/F");
             
-            fTreeCascade->Branch("fTreeCascVarBachIsKink",&fTreeCascVarBachIsKink,"fTreeCascVarBachIsKink/O");
-            fTreeCascade->Branch("fTreeCascVarPosIsKink",&fTreeCascVarPosIsKink,"fTreeCascVarPosIsKink/O");
-            fTreeCascade->Branch("fTreeCascVarNegIsKink",&fTreeCascVarNegIsKink,"fTreeCascVarNegIsKink/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachIsKink",&fTreeCascVarBachIsKink,"fTreeCascVarBachIsKink/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosIsKink",&fTreeCascVarPosIsKink,"fTreeCascVarPosIsKink/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegIsKink",&fTreeCascVarNegIsKink,"fTreeCascVarNegIsKink/O");
         }
         
-        fTreeCascade->Branch("fTreeCascVarIsCowboy",&fTreeCascVarIsCowboy,"fTreeCascVarIsCowboy/O");
-        fTreeCascade->Branch("fTreeCascVarIsCascadeCowboy",&fTreeCascVarIsCascadeCowboy,"fTreeCascVarIsCascadeCowboy/O");
-        fTreeCascade->Branch("fTreeCascVarCowboyness",&fTreeCascVarCowboyness,"fTreeCascVarCowboyness/F");
-        fTreeCascade->Branch("fTreeCascVarCascadeCowboyness",&fTreeCascVarCascadeCowboyness,"fTreeCascVarCascadeCowboyness/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarIsCowboy",&fTreeCascVarIsCowboy,"fTreeCascVarIsCowboy/O");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarIsCascadeCowboy",&fTreeCascVarIsCascadeCowboy,"fTreeCascVarIsCascadeCowboy/O");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarCowboyness",&fTreeCascVarCowboyness,"fTreeCascVarCowboyness/F");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarCascadeCowboyness",&fTreeCascVarCascadeCowboyness,"fTreeCascVarCascadeCowboyness/F");
         
         if ( fkDebugOOBPileup ) {
-            fTreeCascade->Branch("fTreeCascVarNegTOFSignal",&fTreeCascVarNegTOFSignal,"fTreeCascVarNegTOFSignal/F");
-            fTreeCascade->Branch("fTreeCascVarPosTOFSignal",&fTreeCascVarPosTOFSignal,"fTreeCascVarPosTOFSignal/F");
-            fTreeCascade->Branch("fTreeCascVarBachTOFSignal",&fTreeCascVarBachTOFSignal,"fTreeCascVarBachTOFSignal/F");
-            fTreeCascade->Branch("fTreeCascVarNegTOFBCid",&fTreeCascVarNegTOFBCid,"fTreeCascVarNegTOFBCid/I");
-            fTreeCascade->Branch("fTreeCascVarPosTOFBCid",&fTreeCascVarPosTOFBCid,"fTreeCascVarPosTOFBCid/I");
-            fTreeCascade->Branch("fTreeCascVarBachTOFBCid",&fTreeCascVarBachTOFBCid,"fTreeCascVarBachTOFBCid/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegTOFSignal",&fTreeCascVarNegTOFSignal,"fTreeCascVarNegTOFSignal/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosTOFSignal",&fTreeCascVarPosTOFSignal,"fTreeCascVarPosTOFSignal/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachTOFSignal",&fTreeCascVarBachTOFSignal,"fTreeCascVarBachTOFSignal/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegTOFBCid",&fTreeCascVarNegTOFBCid,"fTreeCascVarNegTOFBCid/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosTOFBCid",&fTreeCascVarPosTOFBCid,"fTreeCascVarPosTOFBCid/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachTOFBCid",&fTreeCascVarBachTOFBCid,"fTreeCascVarBachTOFBCid/I");
             // Event info
-            fTreeCascade->Branch("fTreeCascVarOOBPileupFlag",&fTreeCascVarOOBPileupFlag,"fTreeCascVarOOBPileupFlag/O");
-            fTreeCascade->Branch("fTreeCascVarAmplitudeV0A",&fTreeCascVarAmplitudeV0A,"fTreeCascVarAmplitudeV0A/F");
-            fTreeCascade->Branch("fTreeCascVarAmplitudeV0C",&fTreeCascVarAmplitudeV0C,"fTreeCascVarAmplitudeV0C/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarOOBPileupFlag",&fTreeCascVarOOBPileupFlag,"fTreeCascVarOOBPileupFlag/O");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarAmplitudeV0A",&fTreeCascVarAmplitudeV0A,"fTreeCascVarAmplitudeV0A/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarAmplitudeV0C",&fTreeCascVarAmplitudeV0C,"fTreeCascVarAmplitudeV0C/F");
         }
         
         if( fkSandboxMode ){
@@ -2004,36 +2015,36 @@ void AliAnalysisTaskStrangenessVsMultiplicityEEMCRun2::UserCreateOutputObjects()
             fTreeCascade->Branch("fTreeCascVarNegTrack", &fTreeCascVarNegTrack,16000,99);
             
             //for sandbox mode
-            fTreeCascade->Branch("fTreeCascVarMagneticField",&fTreeCascVarMagneticField,"fTreeCascVarMagneticField/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarMagneticField",&fTreeCascVarMagneticField,"fTreeCascVarMagneticField/F");
             
             //Cascade decay position calculation metrics
-            fTreeCascade->Branch("fTreeCascVarPrimVertexX",&fTreeCascVarPrimVertexX,"fTreeCascVarPrimVertexX/F");
-            fTreeCascade->Branch("fTreeCascVarPrimVertexY",&fTreeCascVarPrimVertexY,"fTreeCascVarPrimVertexY/F");
-            fTreeCascade->Branch("fTreeCascVarPrimVertexZ",&fTreeCascVarPrimVertexZ,"fTreeCascVarPrimVertexZ/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPrimVertexX",&fTreeCascVarPrimVertexX,"fTreeCascVarPrimVertexX/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPrimVertexY",&fTreeCascVarPrimVertexY,"fTreeCascVarPrimVertexY/F");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPrimVertexZ",&fTreeCascVarPrimVertexZ,"fTreeCascVarPrimVertexZ/F");
         }
         
         //-----------MC Exclusive info--------------------
-        fTreeCascade->Branch("fTreeCascVarIsPhysicalPrimary",&fTreeCascVarIsPhysicalPrimary,"fTreeCascVarIsPhysicalPrimary/I");
-        fTreeCascade->Branch("fTreeCascVarPID",&fTreeCascVarPID,"fTreeCascVarPID/I");
-        fTreeCascade->Branch("fTreeCascVarSwappedPID",&fTreeCascVarSwappedPID,"fTreeCascVarSwappedPID/I");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarIsPhysicalPrimary",&fTreeCascVarIsPhysicalPrimary,"fTreeCascVarIsPhysicalPrimary/I");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPID",&fTreeCascVarPID,"fTreeCascVarPID/I");
+        lTreeWriter.Branch(fTreeCascade,"fTreeCascVarSwappedPID",&fTreeCascVarSwappedPID,"fTreeCascVarSwappedPID/I");
         if ( fkDebugBump ){
-            fTreeCascade->Branch("fTreeCascVarPIDNegative",&fTreeCascVarPIDNegative,"fTreeCascVarPIDNegative/I");
-            fTreeCascade->Branch("fTreeCascVarPIDPositive",&fTreeCascVarPIDPositive,"fTreeCascVarPIDPositive/I");
-            fTreeCascade->Branch("fTreeCascVarPIDBachelor",&fTreeCascVarPIDBachelor,"fTreeCascVarPIDBachelor/I");
-            fTreeCascade->Branch("fTreeCascVarPIDNegativeMother",&fTreeCascVarPIDNegativeMother,"fTreeCascVarPIDNegativeMother/I");
-            fTreeCascade->Branch("fTreeCascVarPIDPositiveMother",&fTreeCascVarPIDPositiveMother,"fTreeCascVarPIDPositiveMother/I");
-            fTreeCascade->Branch("fTreeCascVarPIDBachelorMother",&fTreeCascVarPIDBachelorMother,"fTreeCascVarPIDBachelorMother/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPIDNegative",&fTreeCascVarPIDNegative,"fTreeCascVarPIDNegative/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPIDPositive",&fTreeCascVarPIDPositive,"fTreeCascVarPIDPositive/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPIDBachelor",&fTreeCascVarPIDBachelor,"fTreeCascVarPIDBachelor/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPIDNegativeMother",&fTreeCascVarPIDNegativeMother,"fTreeCascVarPIDNegativeMother/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPIDPositiveMother",&fTreeCascVarPIDPositiveMother,"fTreeCascVarPIDPositiveMother/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPIDBachelorMother",&fTreeCascVarPIDBachelorMother,"fTreeCascVarPIDBachelorMother/I");
             //All information possibly needed on parenthood
-            fTreeCascade->Branch("fTreeCascVarPIDNegativeGrandMother",&fTreeCascVarPIDNegativeGrandMother,"fTreeCascVarPIDNegativeGrandMother/I");
-            fTreeCascade->Branch("fTreeCascVarPIDPositiveGrandMother",&fTreeCascVarPIDPositiveGrandMother,"fTreeCascVarPIDPositiveGrandMother/I");
-            fTreeCascade->Branch("fTreeCascVarPIDBachelorGrandMother",&fTreeCascVarPIDBachelorGrandMother,"fTreeCascVarPIDBachelorGrandMother/I");
-            fTreeCascade->Branch("fTreeCascVarBachCousinStatus",&fTreeCascVarBachCousinStatus,"fTreeCascVarBachCousinStatus/I");
-            fTreeCascade->Branch("fTreeCascVarV0BachSibIsValid",&fTreeCascVarV0BachSibIsValid,"fTreeCascVarV0BachSibIsValid/I");
-            fTreeCascade->Branch("fTreeCascVarBachV0Tagging",&fTreeCascVarBachV0Tagging,"fTreeCascVarBachV0Tagging/I");
-            fTreeCascade->Branch("fTreeCascVarV0NegSibIsValid",&fTreeCascVarV0NegSibIsValid,"fTreeCascVarV0NegSibIsValid/I");
-            fTreeCascade->Branch("fTreeCascVarNegV0Tagging",&fTreeCascVarNegV0Tagging,"fTreeCascVarNegV0Tagging/I");
-            fTreeCascade->Branch("fTreeCascVarV0PosSibIsValid",&fTreeCascVarV0PosSibIsValid,"fTreeCascVarV0PosSibIsValid/I");
-            fTreeCascade->Branch("fTreeCascVarPosV0Tagging",&fTreeCascVarPosV0Tagging,"fTreeCascVarPosV0Tagging/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPIDNegativeGrandMother",&fTreeCascVarPIDNegativeGrandMother,"fTreeCascVarPIDNegativeGrandMother/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPIDPositiveGrandMother",&fTreeCascVarPIDPositiveGrandMother,"fTreeCascVarPIDPositiveGrandMother/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPIDBachelorGrandMother",&fTreeCascVarPIDBachelorGrandMother,"fTreeCascVarPIDBachelorGrandMother/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachCousinStatus",&fTreeCascVarBachCousinStatus,"fTreeCascVarBachCousinStatus/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0BachSibIsValid",&fTreeCascVarV0BachSibIsValid,"fTreeCascVarV0BachSibIsValid/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarBachV0Tagging",&fTreeCascVarBachV0Tagging,"fTreeCascVarBachV0Tagging/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0NegSibIsValid",&fTreeCascVarV0NegSibIsValid,"fTreeCascVarV0NegSibIsValid/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarNegV0Tagging",&fTreeCascVarNegV0Tagging,"fTreeCascVarNegV0Tagging/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarV0PosSibIsValid",&fTreeCascVarV0PosSibIsValid,"fTreeCascVarV0PosSibIsValid/I");
+            lTreeWriter.Branch(fTreeCascade,"fTreeCascVarPosV0Tagging",&fTreeCascVarPosV0Tagging,"fTreeCascVarPosV0Tagging/I");
         }
         //------------------------------------------------
     }
@@ -2474,6 +2485,10 @@ void AliAnalysisTaskStrangenessVsMultiplicityEEMCRun2::UserCreateOutputObjects()
     PostData(7, fListOmegaMinus );
     PostData(8, fListOmegaPlus  );
     
+    //Basket size and flushing of the candidate trees
+    if(fkSaveV0Tree)       AliCandidateTreeWriter::Configure(fTreeV0, fTreeBasketSize, fTreeAutoFlush);
+    if(fkSaveCascadeTree)  AliCandidateTreeWriter::Configure(fTreeCascade, fTreeBasketSize, fTreeAutoFlush);
+    
     //TTree Objects: Slots 9-11
     if(fkSaveEventTree)    PostData(9, fTreeEvent   );
     if(fkSaveV0Tree)       PostData(10, fTreeV0      );
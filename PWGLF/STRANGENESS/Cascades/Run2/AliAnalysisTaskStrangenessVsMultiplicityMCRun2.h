@@ -228,6 +228,17 @@ public:
   void SetMaxPt     ( Float_t lMaxPt ) {
     fMaxPtToSave = lMaxPt;
   }
+  //Candidate trees: float branches packed to lNBits mantissa bits (0: full precision),
+  //lFullPrecision lists the branches to keep as Float_t (comma separated, wildcards allowed)
+  void SetTreeFloatPrecision ( Int_t lNBits, TString lFullPrecision = "" ) {
+    fTreeFloatBits = lNBits;
+    fTreeFullPrecisionBranches = lFullPrecision;
+  }
+  //Candidate trees: basket size per branch (bytes) and auto-flush (TTree::SetAutoFlush), 0: ROOT default
+  void SetTreeBuffering ( Int_t lBasketSize, Long64_t lAutoFlush = 0 ) {
+    fTreeBasketSize = lBasketSize;
+    fTreeAutoFlush = lAutoFlush;
+  }
   void SetLambdaWindowParameters     ( Double_t *fMeanPars, Double_t *fSigmaPars ) {
     for(Int_t ipar=0; ipar<5; ipar++) fLambdaMassMean[ipar]  = fMeanPars[ipar];
     for(Int_t ipar=0; ipar<4; ipar++) fLambdaMassSigma[ipar] = fSigmaPars[ipar];
@@ -364,6 +375,10 @@ private:
   
   Float_t fMinPtToSave; //minimum pt above which we keep candidates in TTree output
   Float_t fMaxPtToSave; //maximum pt below which we keep candidates in TTree output
+  Int_t fTreeFloatBits; //mantissa bits of the packed float branches of the candidate trees, 0: no packing
+  TString fTreeFullPrecisionBranches; //candidate tree branches kept at full precision
+  Int_t fTreeBasketSize; //basket size of the candidate tree branches, 0: default
+  Long64_t fTreeAutoFlush; //auto-flush setting of the candidate trees, 0: default
   
   //if true, save sandbox mode info (beware large files!)
   Bool_t fkSandboxMode;
@@ -941,7 +956,7 @@ private:
   AliAnalysisTaskStrangenessVsMultiplicityMCRun2(const AliAnalysisTaskStrangenessVsMultiplicityMCRun2&);            // not implemented
   AliAnalysisTaskStrangenessVsMultiplicityMCRun2& operator=(const AliAnalysisTaskStrangenessVsMultiplicityMCRun2&); // not implemented
   
-  ClassDef(AliAnalysisTaskStrangenessVsMultiplicityMCRun2, 1);
+  ClassDef(AliAnalysisTaskStrangenessVsMultiplicityMCRun2, 2);
   //1: first implementation
 };
 
@@ -116,6 +116,7 @@ class AliAODv0;
 #include "AliEventCuts.h"
 #include "AliV0Result.h"
 #include "AliCascadeResult.h"
+#include "AliWeakResultSelector.h"
 #include "AliAnalysisTaskStrangenessVsMultiplicityRun2.h"
 #include "AliAnalysisTaskWeakDecayVertexer.h"
 
@@ -189,6 +190,13 @@ fkSandboxMode ( kFALSE ),
 fkSaveSpecificConfig(kFALSE),
 fkConfigToSave(""),
 
+//---> Single-pass selection of the configurations
+fkUseSinglePassSelection(kFALSE),
+fV0Selector(0x0),
+fCascadeSelector(0x0),
+fV0Configs(),
+fCascadeConfigs(),
+
 //---> Variables for fTreeEvent
 fCentrality(0),
 fMVPileupFlag(kFALSE),
@@ -552,6 +560,13 @@ fkSandboxMode ( kFALSE ),
 fkSaveSpecificConfig(kFALSE),
 fkConfigToSave(""),
 
+//---> Single-pass selection of the configurations
+fkUseSinglePassSelection(kFALSE),
+fV0Selector(0x0),
+fCascadeSelector(0x0),
+fV0Configs(),
+fCascadeConfigs(),
+
 //---> Variables for fTreeEvent
 fCentrality(0),
 fEvSel_TriggerMask(0), 
@@ -931,6 +946,14 @@ AliAnalysisTaskStrangenessVsMultiplicityRun2::~AliAnalysisTaskStrangenessVsMulti
     //------------------------------------------------
     
     //Destroy output objects if present
+    if (fV0Selector) {
+        delete fV0Selector;
+        fV0Selector = 0x0;
+    }
+    if (fCascadeSelector) {
+        delete fCascadeSelector;
+        fCascadeSelector = 0x0;
+    }
     if (fListHist) {
         delete fListHist;
         fListHist = 0x0;
@@ -2264,157 +2287,35 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
             lValidConfigurations++;
         }
         
-        for(Int_t lcfg=0; lcfg<lValidConfigurations; lcfg++){
-            lV0Result = lPointers[lcfg];
-            histoout  = lV0Result->GetHistogram();
-            
-            Float_t lMass = 0;
-            Float_t lRap  = 0;
-            Float_t lPDGMass = -1;
-            Float_t lNegdEdx = 100;
-            Float_t lPosdEdx = 100;
-            Float_t lBaryonMomentum = -0.5;
-            Float_t lBaryonPt = -0.5;
-            Float_t lBaryondEdxFromProton = 0;
-            
-            //========================================================================
-            //Setting up: Variable V0 CosPA
-            Float_t lV0CosPACut = lV0Result -> GetCutV0CosPA();
-            Float_t lVarV0CosPApar[5];
-            lVarV0CosPApar[0] = lV0Result->GetCutVarV0CosPAExp0Const();
-            lVarV0CosPApar[1] = lV0Result->GetCutVarV0CosPAExp0Slope();
-            lVarV0CosPApar[2] = lV0Result->GetCutVarV0CosPAExp1Const();
-            lVarV0CosPApar[3] = lV0Result->GetCutVarV0CosPAExp1Slope();
-            lVarV0CosPApar[4] = lV0Result->GetCutVarV0CosPAConst();
-            Float_t lVarV0CosPA = TMath::Cos(
-                                             lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeVariablePt) +
-                                             lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeVariablePt) +
-                                             lVarV0CosPApar[4]);
-            if( lV0Result->GetCutUseVarV0CosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
-            }
-            //========================================================================
-            
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short     ){
-                lMass    = fTreeVariableInvMassK0s;
-                lRap     = fTreeVariableRapK0Short;
-                lPDGMass = 0.497;
-                lNegdEdx = fTreeVariableNSigmasNegPion;
-                lPosdEdx = fTreeVariableNSigmasPosPion;
-            }
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kLambda      ){
-                lMass = fTreeVariableInvMassLambda;
-                lRap = fTreeVariableRapLambda;
-                lPDGMass = 1.115683;
-                lNegdEdx = fTreeVariableNSigmasNegPion;
-                lPosdEdx = fTreeVariableNSigmasPosProton;
-                lBaryonMomentum = fTreeVariablePosInnerP;
-                lBaryonPt = lThisPosInnerPt;
-                lBaryondEdxFromProton = fTreeVariableNSigmasPosProton;
+        if( fkUseSinglePassSelection ){
+            //Each distinct set of cut values is checked once for this V0
+            if( !fV0Selector || fV0Selector->GetNConfigs() != lValidConfigurations ) BuildV0Selector();
+            fV0Selector->StartCandidate();
+            for(Int_t icheck=0; icheck<kNV0Checks && !fV0Selector->IsEmpty(); icheck++){
+                for(Int_t igroup=0; igroup<fV0Selector->GetNGroups(icheck); igroup++){
+                    Int_t lRep = fV0Selector->GetRepresentative(icheck,igroup);
+                    if( lRep < 0 ) continue;
+                    fV0Selector->CountEvaluation();
+                    if( !PassesV0Check(icheck, fV0Configs[lRep], lOnFlyStatus, lThisPosInnerPt, lThisNegInnerPt, lLeastNcrOverLength, lITSorTOFsatisfied) )
+                        fV0Selector->RejectGroup(icheck,igroup);
+                }
             }
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kAntiLambda  ){
-                lMass = fTreeVariableInvMassAntiLambda;
-                lRap = fTreeVariableRapLambda;
-                lPDGMass = 1.115683;
-                lNegdEdx = fTreeVariableNSigmasNegProton;
-                lPosdEdx = fTreeVariableNSigmasPosPion;
-                lBaryonMomentum = fTreeVariableNegInnerP;
-                lBaryonPt = lThisNegInnerPt;
-                lBaryondEdxFromProton = fTreeVariableNSigmasNegProton;
+            for(Int_t lcfg=fV0Selector->NextSelected(0); lcfg>=0; lcfg=fV0Selector->NextSelected(lcfg+1)){
+                lV0Result = fV0Configs[lcfg];
+                histoout  = lV0Result->GetHistogram();
+                histoout -> Fill ( fCentrality, fTreeVariablePt, GetV0ResultMass(lV0Result) );
             }
-            
-            if (
-                //Check 1: Offline Vertexer
-                lOnFlyStatus == lV0Result->GetUseOnTheFly() &&
-                
-                //Check 2: Basic Acceptance cuts
-                lV0Result->GetCutMinEtaTracks() < fTreeVariableNegEta && fTreeVariableNegEta < lV0Result->GetCutMaxEtaTracks() &&
-                lV0Result->GetCutMinEtaTracks() < fTreeVariablePosEta && fTreeVariablePosEta < lV0Result->GetCutMaxEtaTracks() &&
-                lRap > lV0Result->GetCutMinRapidity() &&
-                lRap < lV0Result->GetCutMaxRapidity() &&
-                
-                //Check 3: Topological Variables
-                fTreeVariableV0Radius > lV0Result->GetCutV0Radius() &&
-                fTreeVariableV0Radius < lV0Result->GetCutMaxV0Radius() &&
-                fTreeVariableDcaNegToPrimVertex > lV0Result->GetCutDCANegToPV() &&
-                fTreeVariableDcaPosToPrimVertex > lV0Result->GetCutDCAPosToPV() &&
-                fTreeVariableDcaV0Daughters < lV0Result->GetCutDCAV0Daughters() &&
-                fTreeVariableV0CosineOfPointingAngle > lV0CosPACut &&
-                fTreeVariableDistOverTotMom*lPDGMass < lV0Result->GetCutProperLifetime() &&
-                fTreeVariableLeastNbrCrossedRows > lV0Result->GetCutLeastNumberOfCrossedRows() &&
-                fTreeVariableLeastRatioCrossedRowsOverFindable > lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable() &&
-                
-                //Check 4: Minimum momentum of baryon daughter
-                ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short || lBaryonMomentum > lV0Result->GetCutMinBaryonMomentum() ) &&
-                
-                //Check 5: TPC dEdx selections
-                TMath::Abs(lNegdEdx)<lV0Result->GetCutTPCdEdx() &&
-                TMath::Abs(lPosdEdx)<lV0Result->GetCutTPCdEdx() &&
-                
-                //Check 6: Armenteros-Podolanski space cut (for K0Short analysis)
-                ( ( lV0Result->GetCutArmenteros() == kFALSE || lV0Result->GetMassHypothesis() != AliV0Result::kK0Short ) || ( fTreeVariablePtArmV0>lV0Result->GetCutArmenterosParameter()*TMath::Abs(fTreeVariableAlphaV0) ) ) &&
-                
-                //Check 7: kITSrefit track selection if requested
-                (
-                 ( (fTreeVariableNegTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeVariablePosTrackStatus & AliESDtrack::kITSrefit) )
-                 ||
-                 !lV0Result->GetCutUseITSRefitTracks()
-                 )&&
-                
-                //Check 8: Max Chi2/Clusters if not absurd
-                ( lV0Result->GetCutMaxChi2PerCluster()>1e+3 ||
-                 (fTreeVariableMaxChi2PerCluster < lV0Result->GetCutMaxChi2PerCluster())
-                 ) &&
-                
-                //Check 9: Min Track Length if positive
-                ( lV0Result->GetCutMinTrackLength()<0 || //this is a bit paranoid...
-                 (fTreeVariableMinTrackLength > lV0Result->GetCutMinTrackLength()&& !lV0Result->GetCutUseParametricLength()) ||
-                 (fTreeVariableMinTrackLength > lV0Result->GetCutMinTrackLength()
-                  - (TMath::Power(1/(fTreeVariablePt+1e-6),1.5)) //rough parametrization, tune me!
-                  - TMath::Max(fTreeVariableV0Radius-85., 0.) //rough parametrization, tune me!
-                  && lV0Result->GetCutUseParametricLength())
-                 )&&
-                
-                //Check 10: Special 2.76TeV-like dedx
-                // Logic: either not requested, or K0Short, or high-pT baryon daughter, or passes cut!
-                ( !lV0Result->GetCut276TeVLikedEdx() ||
-                 ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short ||
-                  ( lBaryonPt > 1.0 || TMath::Abs(lBaryondEdxFromProton)<3.0 )
-                  )
-                 )&&
-                
-                //Check 14: has at least one track with some TOF info, please (reject pileup)
-                //          warning: this is still to be studied in more detail!
-                (
-                 lV0Result->GetCutAtLeastOneTOF() == kFALSE ||
-                 (
-                  TMath::Abs(fTreeVariableNegTOFSignal) < 100 ||
-                  TMath::Abs(fTreeVariablePosTOFSignal) < 100
-                  )
-                 )&&
+        } else {
+            for(Int_t lcfg=0; lcfg<lValidConfigurations; lcfg++){
+                lV0Result = lPointers[lcfg];
+                histoout  = lV0Result->GetHistogram();
                 
-                //Check 15: cowboy/sailor for V0
-                (
-                 lV0Result->GetCutIsCowboy()==0 ||
-                 (lV0Result->GetCutIsCowboy()== 1 && fTreeVariableIsCowboy==kTRUE ) ||
-                 (lV0Result->GetCutIsCowboy()==-1 && fTreeVariableIsCowboy==kFALSE)
-                 )&&//end cowboy/sailor
+                Bool_t lPasses = kTRUE;
+                for(Int_t icheck=0; icheck<kNV0Checks && lPasses; icheck++)
+                    lPasses = PassesV0Check(icheck, lV0Result, lOnFlyStatus, lThisPosInnerPt, lThisNegInnerPt, lLeastNcrOverLength, lITSorTOFsatisfied);
                 
-                //Check 16: modern track quality selections
-                (
-                 lV0Result->GetCutMinCrossedRowsOverLength()<0 ||
-                 (lLeastNcrOverLength>lV0Result->GetCutMinCrossedRowsOverLength())
-                 )&&
-                //Check 17: ITS or TOF required 
-                (
-                 lV0Result->GetCutITSorTOF()==kFALSE || lITSorTOFsatisfied==kTRUE
-                 )
-                )//end major if
-            {
                 //This satisfies all my conditionals! Fill histogram
-                histoout -> Fill ( fCentrality, fTreeVariablePt, lMass );
+                if( lPasses ) histoout -> Fill ( fCentrality, fTreeVariablePt, GetV0ResultMass(lV0Result) );
             }
         }
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
@@ -3409,352 +3310,49 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
                 lValidConfigurations++;
             }
         
-        for(Int_t lcfg=0; lcfg<lValidConfigurations; lcfg++){
-            lCascadeResult = lPointers[lcfg];
-            Bool_t lTheOne = fkConfigToSave.EqualTo( lCascadeResult->GetName() );
-            histoout  = lCascadeResult->GetHistogram();
-            
-            Float_t lMass = 0;
-            Float_t lV0Mass = 0;
-            Float_t lRap  = 0;
-            Float_t lPDGMass = -1;
-            Float_t lNegdEdx = 100;
-            Float_t lPosdEdx = 100;
-            Float_t lBachdEdx = 100;
-            Float_t lNegTOFsigma = 100;
-            Float_t lPosTOFsigma = 100;
-            Float_t lBachTOFsigma = 100;
-            Short_t  lCharge = -2;
-            Int_t lChargePos =  1;
-            Int_t lChargeNeg = -1;
-            Float_t lprpx, lprpy, lprpz, lpipx, lpipy, lpipz;
-            lpipx = fTreeCascVarBachPx;
-            lpipy = fTreeCascVarBachPy;
-            lpipz = fTreeCascVarBachPz;
-            
-            //For parametric V0 Mass selection
-            Float_t lExpV0Mass =
-            fLambdaMassMean[0]+
-            fLambdaMassMean[1]*TMath::Exp(fLambdaMassMean[2]*lV0Pt)+
-            fLambdaMassMean[3]*TMath::Exp(fLambdaMassMean[4]*lV0Pt);
-            
-            Float_t lExpV0Sigma =
-            fLambdaMassSigma[0]+fLambdaMassSigma[1]*lV0Pt+
-            fLambdaMassSigma[2]*TMath::Exp(fLambdaMassSigma[3]*lV0Pt);
-            
-            //========================================================================
-            //For 2.76TeV-like parametric V0 CosPA
-            Float_t l276TeVV0CosPA = 0.998;
-            Float_t pThr=1.5;
-            if (lV0TotMomentum<pThr) {
-                //Below the threshold "pThr", try a momentum dependent cos(PA) cut
-                const Double_t bend=0.03; // approximate Xi bending angle
-                const Double_t qt=0.211;  // max Lambda pT in Omega decay
-                const Double_t cpaThr=TMath::Cos(TMath::ATan(qt/pThr) + bend);
-                Double_t
-                cpaCut=(0.998/cpaThr)*TMath::Cos(TMath::ATan(qt/lV0TotMomentum) + bend);
-                l276TeVV0CosPA = cpaCut;
+        if( fkUseSinglePassSelection ){
+            //Each distinct set of cut values is checked once for this cascade
+            Int_t lNCascadeConfigs = fListXiMinus->GetEntries() + fListXiPlus->GetEntries() + fListOmegaMinus->GetEntries() + fListOmegaPlus->GetEntries();
+            if( !fCascadeSelector || fCascadeSelector->GetNConfigs() != lNCascadeConfigs ) BuildCascadeSelector();
+            fCascadeSelector->StartCandidate();
+            //configurations of the species not valid for this candidate
+            Int_t lFirst = 0;
+            TList *lLists[4] = {fListXiMinus, fListXiPlus, fListOmegaMinus, fListOmegaPlus};
+            Bool_t lValid[4] = {lValidXiMinus, lValidXiPlus, lValidOmegaMinus, lValidOmegaPlus};
+            for(Int_t ilist=0; ilist<4; ilist++){
+                if( !lValid[ilist] ) fCascadeSelector->RejectRange(lFirst, lFirst+lLists[ilist]->GetEntries());
+                lFirst += lLists[ilist]->GetEntries();
             }
-            //========================================================================
-            
-            //========================================================================
-            //Setting up: Variable Cascade CosPA
-            Float_t lCascCosPACut = lCascadeResult -> GetCutCascCosPA();
-            Float_t lVarCascCosPApar[5];
-            lVarCascCosPApar[0] = lCascadeResult->GetCutVarCascCosPAExp0Const();
-            lVarCascCosPApar[1] = lCascadeResult->GetCutVarCascCosPAExp0Slope();
-            lVarCascCosPApar[2] = lCascadeResult->GetCutVarCascCosPAExp1Const();
-            lVarCascCosPApar[3] = lCascadeResult->GetCutVarCascCosPAExp1Slope();
-            lVarCascCosPApar[4] = lCascadeResult->GetCutVarCascCosPAConst();
-            Float_t lVarCascCosPA = TMath::Cos(
-                                               lVarCascCosPApar[0]*TMath::Exp(lVarCascCosPApar[1]*fTreeCascVarPt) +
-                                               lVarCascCosPApar[2]*TMath::Exp(lVarCascCosPApar[3]*fTreeCascVarPt) +
-                                               lVarCascCosPApar[4]);
-            if( lCascadeResult->GetCutUseVarCascCosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarCascCosPA > lCascCosPACut ) lCascCosPACut = lVarCascCosPA;
-            }
-            //========================================================================
-            
-            //========================================================================
-            //Setting up: Variable V0 CosPA
-            Float_t lV0CosPACut = lCascadeResult -> GetCutV0CosPA();
-            Float_t lVarV0CosPApar[5];
-            lVarV0CosPApar[0] = lCascadeResult->GetCutVarV0CosPAExp0Const();
-            lVarV0CosPApar[1] = lCascadeResult->GetCutVarV0CosPAExp0Slope();
-            lVarV0CosPApar[2] = lCascadeResult->GetCutVarV0CosPAExp1Const();
-            lVarV0CosPApar[3] = lCascadeResult->GetCutVarV0CosPAExp1Slope();
-            lVarV0CosPApar[4] = lCascadeResult->GetCutVarV0CosPAConst();
-            Float_t lVarV0CosPA = TMath::Cos(
-                                             lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeCascVarPt) +
-                                             lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeCascVarPt) +
-                                             lVarV0CosPApar[4]);
-            if( lCascadeResult->GetCutUseVarV0CosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
-            }
-            //========================================================================
-            
-            //========================================================================
-            //Setting up: Variable BB CosPA
-            Float_t lBBCosPACut = lCascadeResult -> GetCutBachBaryonCosPA();
-            Float_t lVarBBCosPApar[5];
-            lVarBBCosPApar[0] = lCascadeResult->GetCutVarBBCosPAExp0Const();
-            lVarBBCosPApar[1] = lCascadeResult->GetCutVarBBCosPAExp0Slope();
-            lVarBBCosPApar[2] = lCascadeResult->GetCutVarBBCosPAExp1Const();
-            lVarBBCosPApar[3] = lCascadeResult->GetCutVarBBCosPAExp1Slope();
-            lVarBBCosPApar[4] = lCascadeResult->GetCutVarBBCosPAConst();
-            Float_t lVarBBCosPA = TMath::Cos(
-                                             lVarBBCosPApar[0]*TMath::Exp(lVarBBCosPApar[1]*fTreeCascVarPt) +
-                                             lVarBBCosPApar[2]*TMath::Exp(lVarBBCosPApar[3]*fTreeCascVarPt) +
-                                             lVarBBCosPApar[4]);
-            if( lCascadeResult->GetCutUseVarBBCosPA() ){
-                //Only use if looser than the non-variable cut (WARNING: BEWARE INVERSE LOGIC)
-                if( lVarBBCosPA > lBBCosPACut ) lBBCosPACut = lVarBBCosPA;
-            }
-            //========================================================================
-            
-            //========================================================================
-            //Setting up: Variable DCA Casc Dau
-            Float_t lDCACascDauCut = lCascadeResult -> GetCutDCACascDaughters();
-            Float_t lVarDCACascDaupar[5];
-            lVarDCACascDaupar[0] = lCascadeResult->GetCutVarDCACascDauExp0Const();
-            lVarDCACascDaupar[1] = lCascadeResult->GetCutVarDCACascDauExp0Slope();
-            lVarDCACascDaupar[2] = lCascadeResult->GetCutVarDCACascDauExp1Const();
-            lVarDCACascDaupar[3] = lCascadeResult->GetCutVarDCACascDauExp1Slope();
-            lVarDCACascDaupar[4] = lCascadeResult->GetCutVarDCACascDauConst();
-            Float_t lVarDCACascDau = lVarDCACascDaupar[0]*TMath::Exp(lVarDCACascDaupar[1]*fTreeCascVarPt) +
-            lVarDCACascDaupar[2]*TMath::Exp(lVarDCACascDaupar[3]*fTreeCascVarPt) +
-            lVarDCACascDaupar[4];
-            if( lCascadeResult->GetCutUseVarDCACascDau() ){
-                //Loosest: default cut, parametric can go tighter
-                if( lVarDCACascDau < lDCACascDauCut ) lDCACascDauCut = lVarDCACascDau;
-            }
-            //========================================================================
-            
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiMinus     ){
-                lCharge  = -1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsXi;
-                lV0Mass  = fTreeCascVarV0MassLambda;
-                lRap     = fTreeCascVarRapXi;
-                lPDGMass = 1.32171;
-                lNegdEdx = fTreeCascVarNegNSigmaPion;
-                lPosdEdx = fTreeCascVarPosNSigmaProton;
-                lBachdEdx= fTreeCascVarBachNSigmaPion;
-                lNegTOFsigma = fTreeCascVarNegTOFNSigmaPion;
-                lPosTOFsigma = fTreeCascVarPosTOFNSigmaProton;
-                lBachTOFsigma = fTreeCascVarBachTOFNSigmaPion;
-                lprpx = fTreeCascVarPosPx;
-                lprpy = fTreeCascVarPosPy;
-                lprpz = fTreeCascVarPosPz;
-            }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiPlus      ){
-                lCharge  = +1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsXi;
-                lV0Mass  = fTreeCascVarV0MassAntiLambda;
-                lRap     = fTreeCascVarRapXi;
-                lPDGMass = 1.32171;
-                lNegdEdx = fTreeCascVarNegNSigmaProton;
-                lPosdEdx = fTreeCascVarPosNSigmaPion;
-                lBachdEdx= fTreeCascVarBachNSigmaPion;
-                lNegTOFsigma = fTreeCascVarNegTOFNSigmaProton;
-                lPosTOFsigma = fTreeCascVarPosTOFNSigmaPion;
-                lBachTOFsigma = fTreeCascVarBachTOFNSigmaPion;
-                lprpx = fTreeCascVarNegPx;
-                lprpy = fTreeCascVarNegPy;
-                lprpz = fTreeCascVarNegPz;
-            }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaMinus     ){
-                lCharge  = -1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsOmega;
-                lV0Mass  = fTreeCascVarV0MassLambda;
-                lRap     = fTreeCascVarRapOmega;
-                lPDGMass = 1.67245;
-                lNegdEdx = fTreeCascVarNegNSigmaPion;
-                lPosdEdx = fTreeCascVarPosNSigmaProton;
-                lBachdEdx= fTreeCascVarBachNSigmaKaon;
-                lNegTOFsigma = fTreeCascVarNegTOFNSigmaPion;
-                lPosTOFsigma = fTreeCascVarPosTOFNSigmaProton;
-                lBachTOFsigma = fTreeCascVarBachTOFNSigmaKaon;
-                lprpx = fTreeCascVarPosPx;
-                lprpy = fTreeCascVarPosPy;
-                lprpz = fTreeCascVarPosPz;
+            for(Int_t icheck=0; icheck<kNCascChecks && !fCascadeSelector->IsEmpty(); icheck++){
+                for(Int_t igroup=0; igroup<fCascadeSelector->GetNGroups(icheck); igroup++){
+                    Int_t lRep = fCascadeSelector->GetRepresentative(icheck,igroup);
+                    if( lRep < 0 ) continue;
+                    fCascadeSelector->CountEvaluation();
+                    if( !PassesCascadeCheck(icheck, fCascadeConfigs[lRep], lV0Pt, lV0TotMomentum, lLeastNcrOverLength, lLeastNbrCrossedRows, lITSorTOFsatisfied) )
+                        fCascadeSelector->RejectGroup(icheck,igroup);
+                }
             }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaPlus      ){
-                lCharge  = +1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsOmega;
-                lV0Mass  = fTreeCascVarV0MassAntiLambda;
-                lRap     = fTreeCascVarRapOmega;
-                lPDGMass = 1.67245;
-                lNegdEdx = fTreeCascVarNegNSigmaProton;
-                lPosdEdx = fTreeCascVarPosNSigmaPion;
-                lBachdEdx= fTreeCascVarBachNSigmaKaon;
-                lNegTOFsigma = fTreeCascVarNegTOFNSigmaProton;
-                lPosTOFsigma = fTreeCascVarPosTOFNSigmaPion;
-                lBachTOFsigma = fTreeCascVarBachTOFNSigmaKaon;
-                lprpx = fTreeCascVarNegPx;
-                lprpy = fTreeCascVarNegPy;
-                lprpz = fTreeCascVarNegPz;
+            for(Int_t lcfg=fCascadeSelector->NextSelected(0); lcfg>=0; lcfg=fCascadeSelector->NextSelected(lcfg+1)){
+                lCascadeResult = fCascadeConfigs[lcfg];
+                histoout  = lCascadeResult->GetHistogram();
+                if( fkSaveSpecificConfig && fkConfigToSave.EqualTo( lCascadeResult->GetName() ) ) fTreeCascade->Fill();
+                histoout -> Fill ( fCentrality, fTreeCascVarPt, GetCascadeResultMass(lCascadeResult) );
             }
-            
-            if (lCascadeResult->GetCutUseTOFUnchecked() == kFALSE ){
-                //Always-pass values
-                lNegTOFsigma = 0;
-                lPosTOFsigma = 0;
-                lBachTOFsigma = 0;
-            }
-            
-            if (
-                //Check 1: Charge consistent with expectations
-                fTreeCascVarCharge == lCharge &&
-                
-                //Check 2: Basic Acceptance cuts
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarPosEta && fTreeCascVarPosEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarNegEta && fTreeCascVarNegEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarBachEta && fTreeCascVarBachEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lRap > lCascadeResult->GetCutMinRapidity() &&
-                lRap < lCascadeResult->GetCutMaxRapidity() &&
-                
-                //Check 3: Topological Variables
-                // - V0 Selections
-                fTreeCascVarDCANegToPrimVtx > lCascadeResult->GetCutDCANegToPV() &&
-                fTreeCascVarDCAPosToPrimVtx > lCascadeResult->GetCutDCAPosToPV() &&
-                fTreeCascVarDCAV0Daughters < lCascadeResult->GetCutDCAV0Daughters() &&
-                fTreeCascVarV0CosPointingAngle > lV0CosPACut &&
-                fTreeCascVarV0Radius > lCascadeResult->GetCutV0Radius() &&
-                // - Cascade Selections
-                fTreeCascVarDCAV0ToPrimVtx > lCascadeResult->GetCutDCAV0ToPV() &&
-                TMath::Abs(lV0Mass-1.116) < lCascadeResult->GetCutV0Mass() &&
-                fTreeCascVarDCABachToPrimVtx > lCascadeResult->GetCutDCABachToPV() &&
-                fTreeCascVarDCACascDaughters < lDCACascDauCut &&
-                fTreeCascVarCascCosPointingAngle > lCascCosPACut &&
-                fTreeCascVarCascRadius > lCascadeResult->GetCutCascRadius() &&
-                
-                // - Implementation of a parametric V0 Mass cut if requested
-                (
-                 ( lCascadeResult->GetCutV0MassSigma() > 50 ) || //anything goes
-                 (TMath::Abs( (lV0Mass-lExpV0Mass) / lExpV0Sigma ) < lCascadeResult->GetCutV0MassSigma() )
-                 ) &&
-                
-                // - Miscellaneous
-                fTreeCascVarDistOverTotMom*lPDGMass < lCascadeResult->GetCutProperLifetime() &&
-                fTreeCascVarLeastNbrClusters > lCascadeResult->GetCutLeastNumberOfClusters() &&
-                
-                //Check 4: TPC dEdx selections
-                TMath::Abs(lNegdEdx )<lCascadeResult->GetCutTPCdEdx() &&
-                TMath::Abs(lPosdEdx )<lCascadeResult->GetCutTPCdEdx() &&
-                TMath::Abs(lBachdEdx)<lCascadeResult->GetCutTPCdEdx() &&
-                
-                //Check 4bis: TOF selections (experimental)
-                //WARNING: if lCascadeResult->GetCutUseTOFUnchecked is false, the TOFsigmas will be zero: will always pass
-                TMath::Abs(lNegTOFsigma )< 4 &&
-                TMath::Abs(lPosTOFsigma )< 4 &&
-                TMath::Abs(lBachTOFsigma)< 4 &&
-                
-                //Check 5: Xi rejection for Omega analysis
-                ( ( lCascadeResult->GetMassHypothesis() != AliCascadeResult::kOmegaMinus && lCascadeResult->GetMassHypothesis() != AliCascadeResult::kOmegaPlus  ) || ( TMath::Abs( fTreeCascVarMassAsXi - 1.32171 ) > lCascadeResult->GetCutXiRejection() ) ) &&
-                
-                //Check 6: Experimental DCA Bachelor to Baryon cut
-                ( fTreeCascVarDCABachToBaryon > lCascadeResult->GetCutDCABachToBaryon() ) &&
-                
-                //Check 7: Experimental Bach Baryon CosPA
-                ( fTreeCascVarWrongCosPA < lBBCosPACut  ) &&
-                
-                //Check 8: Min/Max V0 Lifetime cut
-                ( ( fTreeCascVarV0Lifetime > lCascadeResult->GetCutMinV0Lifetime() ) &&
-                 ( fTreeCascVarV0Lifetime < lCascadeResult->GetCutMaxV0Lifetime() ||
-                  lCascadeResult->GetCutMaxV0Lifetime() > 1e+3 ) ) &&
-                
-                //Check 9: kITSrefit track selection if requested
-                (
-                 ( (fTreeCascVarPosTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeCascVarNegTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit)
-                  )
-                 ||
-                 !lCascadeResult->GetCutUseITSRefitTracks()
-                 ) &&
-                
-                //Check 10: Max Chi2/Clusters if not absurd
-                ( lCascadeResult->GetCutMaxChi2PerCluster()>1e+3 ||
-                 (fTreeCascVarMaxChi2PerCluster < lCascadeResult->GetCutMaxChi2PerCluster())
-                 )&&
-                
-                //Check 11: Min Track Length if positive, [min - (1/pt)^1.5] if parametric requested
-                ( lCascadeResult->GetCutMinTrackLength()<0 || //this is a bit paranoid...
-                 (fTreeCascVarMinTrackLength > lCascadeResult->GetCutMinTrackLength() && !lCascadeResult->GetCutUseParametricLength())||
-                 (fTreeCascVarMinTrackLength > lCascadeResult->GetCutMinTrackLength()
-                  - (TMath::Power(1/(fTreeCascVarPt+1e-6),1.5)) //rough parametrization, tune me!
-                  - TMath::Max(fTreeCascVarV0Radius-85., 0.) //rough parametrization, tune me!
-                  && lCascadeResult->GetCutUseParametricLength())
-                 )&&
-                
-                //Check 12: Check if special V0 CosPA cut used
-                //either don't use the cut at all, or make sure it's above threshold
-                ( lCascadeResult->GetCutUse276TeVV0CosPA()==kFALSE ||
-                 fTreeCascVarV0CosPointingAngle>l276TeVV0CosPA
-                 )&&
-                
-                //Check 13: 3D Cascade DCA to PV
-                ( lCascadeResult->GetCutDCACascadeToPV() > 999 ||
-                 (TMath::Sqrt(fTreeCascVarCascDCAtoPVz*fTreeCascVarCascDCAtoPVz + fTreeCascVarCascDCAtoPVxy*fTreeCascVarCascDCAtoPVxy)<lCascadeResult->GetCutDCACascadeToPV() )
-                 )&&
-                
-                //Check 14: has at least one track with some TOF info, please (reject pileup)
-                //          warning: this is still to be studied in more detail!
-                (
-                 lCascadeResult->GetCutAtLeastOneTOF() == kFALSE ||
-                 (
-                  TMath::Abs(fTreeCascVarNegTOFSignal) < 100 ||
-                  TMath::Abs(fTreeCascVarPosTOFSignal) < 100 ||
-                  TMath::Abs(fTreeCascVarBachTOFSignal) < 100
-                  )
-                 )&&
-                
-                //Check 15: check each prong for ITS refit
-                (
-                 ( lCascadeResult->GetCutUseITSRefitNegative()==kFALSE || fTreeCascVarNegTrackStatus & AliESDtrack::kITSrefit ) &&
-                 ( lCascadeResult->GetCutUseITSRefitPositive()==kFALSE || fTreeCascVarPosTrackStatus & AliESDtrack::kITSrefit ) &&
-                 ( lCascadeResult->GetCutUseITSRefitBachelor()==kFALSE || fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit )
-                 )&&
-                
-                //Check 16: cowboy/sailor for V0
-                (
-                    lCascadeResult->GetCutIsCowboy()==0 ||
-                 (lCascadeResult->GetCutIsCowboy()== 1 && fTreeCascVarIsCowboy==kTRUE ) ||
-                 (lCascadeResult->GetCutIsCowboy()==-1 && fTreeCascVarIsCowboy==kFALSE)
-                )&&//end cowboy/sailor
+        } else {
+            for(Int_t lcfg=0; lcfg<lValidConfigurations; lcfg++){
+                lCascadeResult = lPointers[lcfg];
+                Bool_t lTheOne = fkConfigToSave.EqualTo( lCascadeResult->GetName() );
+                histoout  = lCascadeResult->GetHistogram();
                 
-                //Check 17: cowboy/sailor for cascade
-                (
-                 lCascadeResult->GetCutIsCascadeCowboy()==0 ||
-                 (lCascadeResult->GetCutIsCascadeCowboy()== 1 && fTreeCascVarIsCascadeCowboy==kTRUE ) ||
-                 (lCascadeResult->GetCutIsCascadeCowboy()==-1 && fTreeCascVarIsCascadeCowboy==kFALSE)
-                 )&&//end cowboy/sailor
+                Bool_t lPasses = kTRUE;
+                for(Int_t icheck=0; icheck<kNCascChecks && lPasses; icheck++)
+                    lPasses = PassesCascadeCheck(icheck, lCascadeResult, lV0Pt, lV0TotMomentum, lLeastNcrOverLength, lLeastNbrCrossedRows, lITSorTOFsatisfied);
                 
-                //Check 18: modern track quality selections
-                (
-                 lCascadeResult->GetCutMinCrossedRowsOverLength()<0 ||
-                 (lLeastNcrOverLength>lCascadeResult->GetCutMinCrossedRowsOverLength())
-                 )&&
-                //Check 19: modern track quality selections
-                (
-                 lCascadeResult->GetCutLeastNumberOfCrossedRows()<0 ||
-                 (lLeastNbrCrossedRows>lCascadeResult->GetCutLeastNumberOfCrossedRows())
-                 )&&
-                //Check 20: ITS or TOF required 
-                (
-                 lCascadeResult->GetCutITSorTOF()==kFALSE || lITSorTOFsatisfied==kTRUE
-                 )
-                )//end major if
-            {
-                //This satisfies all my conditionals! Fill histogram
-                if( lTheOne && fkSaveSpecificConfig ) fTreeCascade->Fill();
-                histoout -> Fill ( fCentrality, fTreeCascVarPt, lMass );
+                if( lPasses ){
+                    //This satisfies all my conditionals! Fill histogram
+                    if( lTheOne && fkSaveSpecificConfig ) fTreeCascade->Fill();
+                    histoout -> Fill ( fCentrality, fTreeCascVarPt, GetCascadeResultMass(lCascadeResult) );
+                }
             }
         }
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
@@ -3806,6 +3404,734 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::Terminate(Option_t *)
     fHistEventCounter->DrawCopy("E");
 }
 
+//________________________________________________________________________
+Float_t AliAnalysisTaskStrangenessVsMultiplicityRun2::GetV0ResultMass(const AliV0Result *lV0Result) const
+{
+    //Invariant mass of the current V0 for the hypothesis of the configuration
+    if ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short     ) return fTreeVariableInvMassK0s;
+    if ( lV0Result->GetMassHypothesis() == AliV0Result::kLambda      ) return fTreeVariableInvMassLambda;
+    if ( lV0Result->GetMassHypothesis() == AliV0Result::kAntiLambda  ) return fTreeVariableInvMassAntiLambda;
+    return 0;
+}
+
+//________________________________________________________________________
+Bool_t AliAnalysisTaskStrangenessVsMultiplicityRun2::PassesV0Check(Int_t lCheck, const AliV0Result *lV0Result,
+                                                                   Int_t lOnFlyStatus, Float_t lThisPosInnerPt, Float_t lThisNegInnerPt,
+                                                                   Float_t lLeastNcrOverLength, Bool_t lITSorTOFsatisfied) const
+{
+    //One of the checks of the V0 selection of a configuration, for the current V0.
+    //The cut values used by each check are the key set in BuildV0Selector.
+    Float_t lRap  = 0;
+    Float_t lPDGMass = -1;
+    Float_t lNegdEdx = 100;
+    Float_t lPosdEdx = 100;
+    Float_t lBaryonMomentum = -0.5;
+    Float_t lBaryonPt = -0.5;
+    Float_t lBaryondEdxFromProton = 0;
+    
+    if ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short     ){
+        lRap     = fTreeVariableRapK0Short;
+        lPDGMass = 0.497;
+        lNegdEdx = fTreeVariableNSigmasNegPion;
+        lPosdEdx = fTreeVariableNSigmasPosPion;
+    }
+    if ( lV0Result->GetMassHypothesis() == AliV0Result::kLambda      ){
+        lRap = fTreeVariableRapLambda;
+        lPDGMass = 1.115683;
+        lNegdEdx = fTreeVariableNSigmasNegPion;
+        lPosdEdx = fTreeVariableNSigmasPosProton;
+        lBaryonMomentum = fTreeVariablePosInnerP;
+        lBaryonPt = lThisPosInnerPt;
+        lBaryondEdxFromProton = fTreeVariableNSigmasPosProton;
+    }
+    if ( lV0Result->GetMassHypothesis() == AliV0Result::kAntiLambda  ){
+        lRap = fTreeVariableRapLambda;
+        lPDGMass = 1.115683;
+        lNegdEdx = fTreeVariableNSigmasNegProton;
+        lPosdEdx = fTreeVariableNSigmasPosPion;
+        lBaryonMomentum = fTreeVariableNegInnerP;
+        lBaryonPt = lThisNegInnerPt;
+        lBaryondEdxFromProton = fTreeVariableNSigmasNegProton;
+    }
+    
+    switch( lCheck ){
+        case kV0OnFly:
+            //Check 1: Offline Vertexer
+            return lOnFlyStatus == lV0Result->GetUseOnTheFly();
+        case kV0Acceptance:
+            //Check 2: Basic Acceptance cuts
+            return lV0Result->GetCutMinEtaTracks() < fTreeVariableNegEta && fTreeVariableNegEta < lV0Result->GetCutMaxEtaTracks() &&
+            lV0Result->GetCutMinEtaTracks() < fTreeVariablePosEta && fTreeVariablePosEta < lV0Result->GetCutMaxEtaTracks() &&
+            lRap > lV0Result->GetCutMinRapidity() &&
+            lRap < lV0Result->GetCutMaxRapidity();
+        case kV0Radius:
+            //Check 3: Topological Variables
+            return fTreeVariableV0Radius > lV0Result->GetCutV0Radius() &&
+            fTreeVariableV0Radius < lV0Result->GetCutMaxV0Radius();
+        case kV0DCANegToPV:
+            return fTreeVariableDcaNegToPrimVertex > lV0Result->GetCutDCANegToPV();
+        case kV0DCAPosToPV:
+            return fTreeVariableDcaPosToPrimVertex > lV0Result->GetCutDCAPosToPV();
+        case kV0DCAV0Daughters:
+            return fTreeVariableDcaV0Daughters < lV0Result->GetCutDCAV0Daughters();
+        case kV0CosPA: {
+            //Setting up: Variable V0 CosPA
+            Float_t lV0CosPACut = lV0Result -> GetCutV0CosPA();
+            Float_t lVarV0CosPApar[5];
+            lVarV0CosPApar[0] = lV0Result->GetCutVarV0CosPAExp0Const();
+            lVarV0CosPApar[1] = lV0Result->GetCutVarV0CosPAExp0Slope();
+            lVarV0CosPApar[2] = lV0Result->GetCutVarV0CosPAExp1Const();
+            lVarV0CosPApar[3] = lV0Result->GetCutVarV0CosPAExp1Slope();
+            lVarV0CosPApar[4] = lV0Result->GetCutVarV0CosPAConst();
+            Float_t lVarV0CosPA = TMath::Cos(
+                                             lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeVariablePt) +
+                                             lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeVariablePt) +
+                                             lVarV0CosPApar[4]);
+            if( lV0Result->GetCutUseVarV0CosPA() ){
+                //Only use if tighter than the non-variable cut
+                if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
+            }
+            return fTreeVariableV0CosineOfPointingAngle > lV0CosPACut;
+        }
+        case kV0Lifetime:
+            return fTreeVariableDistOverTotMom*lPDGMass < lV0Result->GetCutProperLifetime();
+        case kV0CrossedRows:
+            return fTreeVariableLeastNbrCrossedRows > lV0Result->GetCutLeastNumberOfCrossedRows() &&
+            fTreeVariableLeastRatioCrossedRowsOverFindable > lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable() &&
+            //Check 16: modern track quality selections
+            (
+             lV0Result->GetCutMinCrossedRowsOverLength()<0 ||
+             (lLeastNcrOverLength>lV0Result->GetCutMinCrossedRowsOverLength())
+             );
+        case kV0BaryonMomentum:
+            //Check 4: Minimum momentum of baryon daughter
+            return ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short || lBaryonMomentum > lV0Result->GetCutMinBaryonMomentum() );
+        case kV0dEdx:
+            //Check 5: TPC dEdx selections
+            return TMath::Abs(lNegdEdx)<lV0Result->GetCutTPCdEdx() &&
+            TMath::Abs(lPosdEdx)<lV0Result->GetCutTPCdEdx() &&
+            //Check 10: Special 2.76TeV-like dedx
+            // Logic: either not requested, or K0Short, or high-pT baryon daughter, or passes cut!
+            ( !lV0Result->GetCut276TeVLikedEdx() ||
+             ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short ||
+              ( lBaryonPt > 1.0 || TMath::Abs(lBaryondEdxFromProton)<3.0 )
+              )
+             );
+        case kV0Armenteros:
+            //Check 6: Armenteros-Podolanski space cut (for K0Short analysis)
+            return ( ( lV0Result->GetCutArmenteros() == kFALSE || lV0Result->GetMassHypothesis() != AliV0Result::kK0Short ) || ( fTreeVariablePtArmV0>lV0Result->GetCutArmenterosParameter()*TMath::Abs(fTreeVariableAlphaV0) ) );
+        case kV0TrackQuality:
+            //Check 7: kITSrefit track selection if requested
+            return (
+                    ( (fTreeVariableNegTrackStatus & AliESDtrack::kITSrefit) &&
+                     (fTreeVariablePosTrackStatus & AliESDtrack::kITSrefit) )
+                    ||
+                    !lV0Result->GetCutUseITSRefitTracks()
+                    )&&
+            //Check 8: Max Chi2/Clusters if not absurd
+            ( lV0Result->GetCutMaxChi2PerCluster()>1e+3 ||
+             (fTreeVariableMaxChi2PerCluster < lV0Result->GetCutMaxChi2PerCluster())
+             ) &&
+            //Check 9: Min Track Length if positive
+            ( lV0Result->GetCutMinTrackLength()<0 || //this is a bit paranoid...
+             (fTreeVariableMinTrackLength > lV0Result->GetCutMinTrackLength()&& !lV0Result->GetCutUseParametricLength()) ||
+             (fTreeVariableMinTrackLength > lV0Result->GetCutMinTrackLength()
+              - (TMath::Power(1/(fTreeVariablePt+1e-6),1.5)) //rough parametrization, tune me!
+              - TMath::Max(fTreeVariableV0Radius-85., 0.) //rough parametrization, tune me!
+              && lV0Result->GetCutUseParametricLength())
+             )&&
+            //Check 14: has at least one track with some TOF info, please (reject pileup)
+            (
+             lV0Result->GetCutAtLeastOneTOF() == kFALSE ||
+             (
+              TMath::Abs(fTreeVariableNegTOFSignal) < 100 ||
+              TMath::Abs(fTreeVariablePosTOFSignal) < 100
+              )
+             )&&
+            //Check 17: ITS or TOF required
+            (
+             lV0Result->GetCutITSorTOF()==kFALSE || lITSorTOFsatisfied==kTRUE
+             );
+        case kV0Cowboy:
+            //Check 15: cowboy/sailor for V0
+            return (
+                    lV0Result->GetCutIsCowboy()==0 ||
+                    (lV0Result->GetCutIsCowboy()== 1 && fTreeVariableIsCowboy==kTRUE ) ||
+                    (lV0Result->GetCutIsCowboy()==-1 && fTreeVariableIsCowboy==kFALSE)
+                    );
+        default:
+            return kTRUE;
+    }
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::BuildV0Selector()
+{
+    //Group the V0 configurations by their cut values, check by check
+    fV0Configs.clear();
+    TList *lLists[3] = {fListK0Short, fListLambda, fListAntiLambda};
+    for(Int_t ilist=0; ilist<3; ilist++)
+        for( Int_t icfg=0; icfg<lLists[ilist]->GetEntries(); icfg++ )
+            fV0Configs.push_back( (AliV0Result*) lLists[ilist]->At(icfg) );
+    
+    if( !fV0Selector ) fV0Selector = new AliWeakResultSelector();
+    fV0Selector->Reset(fV0Configs.size(), kNV0Checks);
+    for(UInt_t icfg=0; icfg<fV0Configs.size(); icfg++){
+        const AliV0Result *lV0Result = fV0Configs[icfg];
+        Double_t lHypo = lV0Result->GetMassHypothesis();
+        for(Int_t icheck=0; icheck<kNV0Checks; icheck++){
+            std::vector<Double_t> lKey;
+            switch( icheck ){
+                case kV0OnFly:
+                    lKey.push_back(lV0Result->GetUseOnTheFly());
+                    break;
+                case kV0Acceptance:
+                    lKey.push_back(lHypo);
+                    lKey.push_back(lV0Result->GetCutMinEtaTracks());
+                    lKey.push_back(lV0Result->GetCutMaxEtaTracks());
+                    lKey.push_back(lV0Result->GetCutMinRapidity());
+                    lKey.push_back(lV0Result->GetCutMaxRapidity());
+                    break;
+                case kV0Radius:
+                    lKey.push_back(lV0Result->GetCutV0Radius());
+                    lKey.push_back(lV0Result->GetCutMaxV0Radius());
+                    break;
+                case kV0DCANegToPV:
+                    lKey.push_back(lV0Result->GetCutDCANegToPV());
+                    break;
+                case kV0DCAPosToPV:
+                    lKey.push_back(lV0Result->GetCutDCAPosToPV());
+                    break;
+                case kV0DCAV0Daughters:
+                    lKey.push_back(lV0Result->GetCutDCAV0Daughters());
+                    break;
+                case kV0CosPA:
+                    lKey.push_back(lV0Result->GetCutV0CosPA());
+                    lKey.push_back(lV0Result->GetCutUseVarV0CosPA());
+                    lKey.push_back(lV0Result->GetCutVarV0CosPAExp0Const());
+                    lKey.push_back(lV0Result->GetCutVarV0CosPAExp0Slope());
+                    lKey.push_back(lV0Result->GetCutVarV0CosPAExp1Const());
+                    lKey.push_back(lV0Result->GetCutVarV0CosPAExp1Slope());
+                    lKey.push_back(lV0Result->GetCutVarV0CosPAConst());
+                    break;
+                case kV0Lifetime:
+                    lKey.push_back(lHypo);
+                    lKey.push_back(lV0Result->GetCutProperLifetime());
+                    break;
+                case kV0CrossedRows:
+                    lKey.push_back(lV0Result->GetCutLeastNumberOfCrossedRows());
+                    lKey.push_back(lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable());
+                    lKey.push_back(lV0Result->GetCutMinCrossedRowsOverLength());
+                    break;
+                case kV0BaryonMomentum:
+                    lKey.push_back(lHypo);
+                    lKey.push_back(lV0Result->GetCutMinBaryonMomentum());
+                    break;
+                case kV0dEdx:
+                    lKey.push_back(lHypo);
+                    lKey.push_back(lV0Result->GetCutTPCdEdx());
+                    lKey.push_back(lV0Result->GetCut276TeVLikedEdx());
+                    break;
+                case kV0Armenteros:
+                    lKey.push_back(lHypo);
+                    lKey.push_back(lV0Result->GetCutArmenteros());
+                    lKey.push_back(lV0Result->GetCutArmenterosParameter());
+                    break;
+                case kV0TrackQuality:
+                    lKey.push_back(lV0Result->GetCutUseITSRefitTracks());
+                    lKey.push_back(lV0Result->GetCutMaxChi2PerCluster());
+                    lKey.push_back(lV0Result->GetCutMinTrackLength());
+                    lKey.push_back(lV0Result->GetCutUseParametricLength());
+                    lKey.push_back(lV0Result->GetCutAtLeastOneTOF());
+                    lKey.push_back(lV0Result->GetCutITSorTOF());
+                    break;
+                case kV0Cowboy:
+                    lKey.push_back(lV0Result->GetCutIsCowboy());
+                    break;
+            }
+            fV0Selector->SetKey(icheck, icfg, lKey);
+        }
+    }
+    fV0Selector->Build();
+    
+    Int_t lNGroups = 0;
+    for(Int_t icheck=0; icheck<kNV0Checks; icheck++) lNGroups += fV0Selector->GetNGroups(icheck);
+    AliInfo(Form("Single-pass selection: %i V0 configurations, %i distinct checks",(Int_t)fV0Configs.size(),lNGroups));
+}
+
+//________________________________________________________________________
+Float_t AliAnalysisTaskStrangenessVsMultiplicityRun2::GetCascadeResultMass(const AliCascadeResult *lCascadeResult) const
+{
+    //Invariant mass of the current cascade for the hypothesis of the configuration
+    if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiMinus    ||
+         lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiPlus     ) return fTreeCascVarMassAsXi;
+    if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaMinus ||
+         lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaPlus  ) return fTreeCascVarMassAsOmega;
+    return 0;
+}
+
+//________________________________________________________________________
+Bool_t AliAnalysisTaskStrangenessVsMultiplicityRun2::PassesCascadeCheck(Int_t lCheck, const AliCascadeResult *lCascadeResult,
+                                                                        Float_t lV0Pt, Float_t lV0TotMomentum, Float_t lLeastNcrOverLength,
+                                                                        Int_t lLeastNbrCrossedRows, Bool_t lITSorTOFsatisfied) const
+{
+    //One of the checks of the cascade selection of a configuration, for the current cascade.
+    //The cut values used by each check are the key set in BuildCascadeSelector.
+    Float_t lV0Mass = 0;
+    Float_t lRap  = 0;
+    Float_t lPDGMass = -1;
+    Float_t lNegdEdx = 100;
+    Float_t lPosdEdx = 100;
+    Float_t lBachdEdx = 100;
+    Float_t lNegTOFsigma = 100;
+    Float_t lPosTOFsigma = 100;
+    Float_t lBachTOFsigma = 100;
+    Short_t  lCharge = -2;
+    
+    if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiMinus     ){
+        lCharge  = -1;
+        if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
+        lV0Mass  = fTreeCascVarV0MassLambda;
+        lRap     = fTreeCascVarRapXi;
+        lPDGMass = 1.32171;
+        lNegdEdx = fTreeCascVarNegNSigmaPion;
+        lPosdEdx = fTreeCascVarPosNSigmaProton;
+        lBachdEdx= fTreeCascVarBachNSigmaPion;
+        lNegTOFsigma = fTreeCascVarNegTOFNSigmaPion;
+        lPosTOFsigma = fTreeCascVarPosTOFNSigmaProton;
+        lBachTOFsigma = fTreeCascVarBachTOFNSigmaPion;
+    }
+    if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiPlus      ){
+        lCharge  = +1;
+        if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
+        lV0Mass  = fTreeCascVarV0MassAntiLambda;
+        lRap     = fTreeCascVarRapXi;
+        lPDGMass = 1.32171;
+        lNegdEdx = fTreeCascVarNegNSigmaProton;
+        lPosdEdx = fTreeCascVarPosNSigmaPion;
+        lBachdEdx= fTreeCascVarBachNSigmaPion;
+        lNegTOFsigma = fTreeCascVarNegTOFNSigmaProton;
+        lPosTOFsigma = fTreeCascVarPosTOFNSigmaPion;
+        lBachTOFsigma = fTreeCascVarBachTOFNSigmaPion;
+    }
+    if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaMinus     ){
+        lCharge  = -1;
+        if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
+        lV0Mass  = fTreeCascVarV0MassLambda;
+        lRap     = fTreeCascVarRapOmega;
+        lPDGMass = 1.67245;
+        lNegdEdx = fTreeCascVarNegNSigmaPion;
+        lPosdEdx = fTreeCascVarPosNSigmaProton;
+        lBachdEdx= fTreeCascVarBachNSigmaKaon;
+        lNegTOFsigma = fTreeCascVarNegTOFNSigmaPion;
+        lPosTOFsigma = fTreeCascVarPosTOFNSigmaProton;
+        lBachTOFsigma = fTreeCascVarBachTOFNSigmaKaon;
+    }
+    if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaPlus      ){
+        lCharge  = +1;
+        if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
+        lV0Mass  = fTreeCascVarV0MassAntiLambda;
+        lRap     = fTreeCascVarRapOmega;
+        lPDGMass = 1.67245;
+        lNegdEdx = fTreeCascVarNegNSigmaProton;
+        lPosdEdx = fTreeCascVarPosNSigmaPion;
+        lBachdEdx= fTreeCascVarBachNSigmaKaon;
+        lNegTOFsigma = fTreeCascVarNegTOFNSigmaProton;
+        lPosTOFsigma = fTreeCascVarPosTOFNSigmaPion;
+        lBachTOFsigma = fTreeCascVarBachTOFNSigmaKaon;
+    }
+    
+    if (lCascadeResult->GetCutUseTOFUnchecked() == kFALSE ){
+        //Always-pass values
+        lNegTOFsigma = 0;
+        lPosTOFsigma = 0;
+        lBachTOFsigma = 0;
+    }
+    
+    switch( lCheck ){
+        case kCascCharge:
+            //Check 1: Charge consistent with expectations
+            return fTreeCascVarCharge == lCharge;
+        case kCascAcceptance:
+            //Check 2: Basic Acceptance cuts
+            return lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarPosEta && fTreeCascVarPosEta < lCascadeResult->GetCutMaxEtaTracks() &&
+            lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarNegEta && fTreeCascVarNegEta < lCascadeResult->GetCutMaxEtaTracks() &&
+            lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarBachEta && fTreeCascVarBachEta < lCascadeResult->GetCutMaxEtaTracks() &&
+            lRap > lCascadeResult->GetCutMinRapidity() &&
+            lRap < lCascadeResult->GetCutMaxRapidity();
+        case kCascDCANegToPV:
+            //Check 3: Topological Variables
+            return fTreeCascVarDCANegToPrimVtx > lCascadeResult->GetCutDCANegToPV();
+        case kCascDCAPosToPV:
+            return fTreeCascVarDCAPosToPrimVtx > lCascadeResult->GetCutDCAPosToPV();
+        case kCascDCAV0Daughters:
+            return fTreeCascVarDCAV0Daughters < lCascadeResult->GetCutDCAV0Daughters();
+        case kCascV0CosPA: {
+            //Setting up: Variable V0 CosPA
+            Float_t lV0CosPACut = lCascadeResult -> GetCutV0CosPA();
+            Float_t lVarV0CosPApar[5];
+            lVarV0CosPApar[0] = lCascadeResult->GetCutVarV0CosPAExp0Const();
+            lVarV0CosPApar[1] = lCascadeResult->GetCutVarV0CosPAExp0Slope();
+            lVarV0CosPApar[2] = lCascadeResult->GetCutVarV0CosPAExp1Const();
+            lVarV0CosPApar[3] = lCascadeResult->GetCutVarV0CosPAExp1Slope();
+            lVarV0CosPApar[4] = lCascadeResult->GetCutVarV0CosPAConst();
+            Float_t lVarV0CosPA = TMath::Cos(
+                                             lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeCascVarPt) +
+                                             lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeCascVarPt) +
+                                             lVarV0CosPApar[4]);
+            if( lCascadeResult->GetCutUseVarV0CosPA() ){
+                //Only use if tighter than the non-variable cut
+                if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
+            }
+            return fTreeCascVarV0CosPointingAngle > lV0CosPACut;
+        }
+        case kCascV0Radius:
+            return fTreeCascVarV0Radius > lCascadeResult->GetCutV0Radius();
+        case kCascDCAV0ToPV:
+            return fTreeCascVarDCAV0ToPrimVtx > lCascadeResult->GetCutDCAV0ToPV();
+        case kCascV0Mass: {
+            //For parametric V0 Mass selection
+            Float_t lExpV0Mass =
+            fLambdaMassMean[0]+
+            fLambdaMassMean[1]*TMath::Exp(fLambdaMassMean[2]*lV0Pt)+
+            fLambdaMassMean[3]*TMath::Exp(fLambdaMassMean[4]*lV0Pt);
+            
+            Float_t lExpV0Sigma =
+            fLambdaMassSigma[0]+fLambdaMassSigma[1]*lV0Pt+
+            fLambdaMassSigma[2]*TMath::Exp(fLambdaMassSigma[3]*lV0Pt);
+            
+            return TMath::Abs(lV0Mass-1.116) < lCascadeResult->GetCutV0Mass() &&
+            // - Implementation of a parametric V0 Mass cut if requested
+            (
+             ( lCascadeResult->GetCutV0MassSigma() > 50 ) || //anything goes
+             (TMath::Abs( (lV0Mass-lExpV0Mass) / lExpV0Sigma ) < lCascadeResult->GetCutV0MassSigma() )
+             );
+        }
+        case kCascDCABachToPV:
+            return fTreeCascVarDCABachToPrimVtx > lCascadeResult->GetCutDCABachToPV();
+        case kCascDCACascDaughters: {
+            //Setting up: Variable DCA Casc Dau
+            Float_t lDCACascDauCut = lCascadeResult -> GetCutDCACascDaughters();
+            Float_t lVarDCACascDaupar[5];
+            lVarDCACascDaupar[0] = lCascadeResult->GetCutVarDCACascDauExp0Const();
+            lVarDCACascDaupar[1] = lCascadeResult->GetCutVarDCACascDauExp0Slope();
+            lVarDCACascDaupar[2] = lCascadeResult->GetCutVarDCACascDauExp1Const();
+            lVarDCACascDaupar[3] = lCascadeResult->GetCutVarDCACascDauExp1Slope();
+            lVarDCACascDaupar[4] = lCascadeResult->GetCutVarDCACascDauConst();
+            Float_t lVarDCACascDau = lVarDCACascDaupar[0]*TMath::Exp(lVarDCACascDaupar[1]*fTreeCascVarPt) +
+            lVarDCACascDaupar[2]*TMath::Exp(lVarDCACascDaupar[3]*fTreeCascVarPt) +
+            lVarDCACascDaupar[4];
+            if( lCascadeResult->GetCutUseVarDCACascDau() ){
+                //Loosest: default cut, parametric can go tighter
+                if( lVarDCACascDau < lDCACascDauCut ) lDCACascDauCut = lVarDCACascDau;
+            }
+            return fTreeCascVarDCACascDaughters < lDCACascDauCut;
+        }
+        case kCascCosPA: {
+            //Setting up: Variable Cascade CosPA
+            Float_t lCascCosPACut = lCascadeResult -> GetCutCascCosPA();
+            Float_t lVarCascCosPApar[5];
+            lVarCascCosPApar[0] = lCascadeResult->GetCutVarCascCosPAExp0Const();
+            lVarCascCosPApar[1] = lCascadeResult->GetCutVarCascCosPAExp0Slope();
+            lVarCascCosPApar[2] = lCascadeResult->GetCutVarCascCosPAExp1Const();
+            lVarCascCosPApar[3] = lCascadeResult->GetCutVarCascCosPAExp1Slope();
+            lVarCascCosPApar[4] = lCascadeResult->GetCutVarCascCosPAConst();
+            Float_t lVarCascCosPA = TMath::Cos(
+                                               lVarCascCosPApar[0]*TMath::Exp(lVarCascCosPApar[1]*fTreeCascVarPt) +
+                                               lVarCascCosPApar[2]*TMath::Exp(lVarCascCosPApar[3]*fTreeCascVarPt) +
+                                               lVarCascCosPApar[4]);
+            if( lCascadeResult->GetCutUseVarCascCosPA() ){
+                //Only use if tighter than the non-variable cut
+                if( lVarCascCosPA > lCascCosPACut ) lCascCosPACut = lVarCascCosPA;
+            }
+            return fTreeCascVarCascCosPointingAngle > lCascCosPACut;
+        }
+        case kCascRadius:
+            return fTreeCascVarCascRadius > lCascadeResult->GetCutCascRadius();
+        case kCascLifetime:
+            // - Miscellaneous
+            return fTreeCascVarDistOverTotMom*lPDGMass < lCascadeResult->GetCutProperLifetime();
+        case kCascdEdx:
+            //Check 4: TPC dEdx selections
+            return TMath::Abs(lNegdEdx )<lCascadeResult->GetCutTPCdEdx() &&
+            TMath::Abs(lPosdEdx )<lCascadeResult->GetCutTPCdEdx() &&
+            TMath::Abs(lBachdEdx)<lCascadeResult->GetCutTPCdEdx() &&
+            //Check 4bis: TOF selections (experimental)
+            //WARNING: if lCascadeResult->GetCutUseTOFUnchecked is false, the TOFsigmas will be zero: will always pass
+            TMath::Abs(lNegTOFsigma )< 4 &&
+            TMath::Abs(lPosTOFsigma )< 4 &&
+            TMath::Abs(lBachTOFsigma)< 4;
+        case kCascXiRejection:
+            //Check 5: Xi rejection for Omega analysis
+            return ( ( lCascadeResult->GetMassHypothesis() != AliCascadeResult::kOmegaMinus && lCascadeResult->GetMassHypothesis() != AliCascadeResult::kOmegaPlus  ) || ( TMath::Abs( fTreeCascVarMassAsXi - 1.32171 ) > lCascadeResult->GetCutXiRejection() ) );
+        case kCascDCABachToBaryon:
+            //Check 6: Experimental DCA Bachelor to Baryon cut
+            return ( fTreeCascVarDCABachToBaryon > lCascadeResult->GetCutDCABachToBaryon() );
+        case kCascBBCosPA: {
+            //Setting up: Variable BB CosPA
+            Float_t lBBCosPACut = lCascadeResult -> GetCutBachBaryonCosPA();
+            Float_t lVarBBCosPApar[5];
+            lVarBBCosPApar[0] = lCascadeResult->GetCutVarBBCosPAExp0Const();
+            lVarBBCosPApar[1] = lCascadeResult->GetCutVarBBCosPAExp0Slope();
+            lVarBBCosPApar[2] = lCascadeResult->GetCutVarBBCosPAExp1Const();
+            lVarBBCosPApar[3] = lCascadeResult->GetCutVarBBCosPAExp1Slope();
+            lVarBBCosPApar[4] = lCascadeResult->GetCutVarBBCosPAConst();
+            Float_t lVarBBCosPA = TMath::Cos(
+                                             lVarBBCosPApar[0]*TMath::Exp(lVarBBCosPApar[1]*fTreeCascVarPt) +
+                                             lVarBBCosPApar[2]*TMath::Exp(lVarBBCosPApar[3]*fTreeCascVarPt) +
+                                             lVarBBCosPApar[4]);
+            if( lCascadeResult->GetCutUseVarBBCosPA() ){
+                //Only use if looser than the non-variable cut (WARNING: BEWARE INVERSE LOGIC)
+                if( lVarBBCosPA > lBBCosPACut ) lBBCosPACut = lVarBBCosPA;
+            }
+            //Check 7: Experimental Bach Baryon CosPA
+            return ( fTreeCascVarWrongCosPA < lBBCosPACut  );
+        }
+        case kCascV0Lifetime:
+            //Check 8: Min/Max V0 Lifetime cut
+            return ( ( fTreeCascVarV0Lifetime > lCascadeResult->GetCutMinV0Lifetime() ) &&
+                    ( fTreeCascVarV0Lifetime < lCascadeResult->GetCutMaxV0Lifetime() ||
+                     lCascadeResult->GetCutMaxV0Lifetime() > 1e+3 ) );
+        case kCascV0CosPA276TeV: {
+            //For 2.76TeV-like parametric V0 CosPA
+            Float_t l276TeVV0CosPA = 0.998;
+            Float_t pThr=1.5;
+            if (lV0TotMomentum<pThr) {
+                //Below the threshold "pThr", try a momentum dependent cos(PA) cut
+                const Double_t bend=0.03; // approximate Xi bending angle
+                const Double_t qt=0.211;  // max Lambda pT in Omega decay
+                const Double_t cpaThr=TMath::Cos(TMath::ATan(qt/pThr) + bend);
+                Double_t
+                cpaCut=(0.998/cpaThr)*TMath::Cos(TMath::ATan(qt/lV0TotMomentum) + bend);
+                l276TeVV0CosPA = cpaCut;
+            }
+            //Check 12: Check if special V0 CosPA cut used
+            //either don't use the cut at all, or make sure it's above threshold
+            return ( lCascadeResult->GetCutUse276TeVV0CosPA()==kFALSE ||
+                    fTreeCascVarV0CosPointingAngle>l276TeVV0CosPA
+                    );
+        }
+        case kCascDCACascadeToPV:
+            //Check 13: 3D Cascade DCA to PV
+            return ( lCascadeResult->GetCutDCACascadeToPV() > 999 ||
+                    (TMath::Sqrt(fTreeCascVarCascDCAtoPVz*fTreeCascVarCascDCAtoPVz + fTreeCascVarCascDCAtoPVxy*fTreeCascVarCascDCAtoPVxy)<lCascadeResult->GetCutDCACascadeToPV() )
+                    );
+        case kCascTrackQuality:
+            return fTreeCascVarLeastNbrClusters > lCascadeResult->GetCutLeastNumberOfClusters() &&
+            //Check 9: kITSrefit track selection if requested
+            (
+             ( (fTreeCascVarPosTrackStatus & AliESDtrack::kITSrefit) &&
+              (fTreeCascVarNegTrackStatus & AliESDtrack::kITSrefit) &&
+              (fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit)
+              )
+             ||
+             !lCascadeResult->GetCutUseITSRefitTracks()
+             ) &&
+            //Check 10: Max Chi2/Clusters if not absurd
+            ( lCascadeResult->GetCutMaxChi2PerCluster()>1e+3 ||
+             (fTreeCascVarMaxChi2PerCluster < lCascadeResult->GetCutMaxChi2PerCluster())
+             )&&
+            //Check 11: Min Track Length if positive, [min - (1/pt)^1.5] if parametric requested
+            ( lCascadeResult->GetCutMinTrackLength()<0 || //this is a bit paranoid...
+             (fTreeCascVarMinTrackLength > lCascadeResult->GetCutMinTrackLength() && !lCascadeResult->GetCutUseParametricLength())||
+             (fTreeCascVarMinTrackLength > lCascadeResult->GetCutMinTrackLength()
+              - (TMath::Power(1/(fTreeCascVarPt+1e-6),1.5)) //rough parametrization, tune me!
+              - TMath::Max(fTreeCascVarV0Radius-85., 0.) //rough parametrization, tune me!
+              && lCascadeResult->GetCutUseParametricLength())
+             )&&
+            //Check 14: has at least one track with some TOF info, please (reject pileup)
+            (
+             lCascadeResult->GetCutAtLeastOneTOF() == kFALSE ||
+             (
+              TMath::Abs(fTreeCascVarNegTOFSignal) < 100 ||
+              TMath::Abs(fTreeCascVarPosTOFSignal) < 100 ||
+              TMath::Abs(fTreeCascVarBachTOFSignal) < 100
+              )
+             )&&
+            //Check 15: check each prong for ITS refit
+            (
+             ( lCascadeResult->GetCutUseITSRefitNegative()==kFALSE || fTreeCascVarNegTrackStatus & AliESDtrack::kITSrefit ) &&
+             ( lCascadeResult->GetCutUseITSRefitPositive()==kFALSE || fTreeCascVarPosTrackStatus & AliESDtrack::kITSrefit ) &&
+             ( lCascadeResult->GetCutUseITSRefitBachelor()==kFALSE || fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit )
+             )&&
+            //Check 18: modern track quality selections
+            (
+             lCascadeResult->GetCutMinCrossedRowsOverLength()<0 ||
+             (lLeastNcrOverLength>lCascadeResult->GetCutMinCrossedRowsOverLength())
+             )&&
+            //Check 19: modern track quality selections
+            (
+             lCascadeResult->GetCutLeastNumberOfCrossedRows()<0 ||
+             (lLeastNbrCrossedRows>lCascadeResult->GetCutLeastNumberOfCrossedRows())
+             )&&
+            //Check 20: ITS or TOF required
+            (
+             lCascadeResult->GetCutITSorTOF()==kFALSE || lITSorTOFsatisfied==kTRUE
+             );
+        case kCascCowboy:
+            //Check 16: cowboy/sailor for V0
+            return (
+                    lCascadeResult->GetCutIsCowboy()==0 ||
+                    (lCascadeResult->GetCutIsCowboy()== 1 && fTreeCascVarIsCowboy==kTRUE ) ||
+                    (lCascadeResult->GetCutIsCowboy()==-1 && fTreeCascVarIsCowboy==kFALSE)
+                    )&&
+            //Check 17: cowboy/sailor for cascade
+            (
+             lCascadeResult->GetCutIsCascadeCowboy()==0 ||
+             (lCascadeResult->GetCutIsCascadeCowboy()== 1 && fTreeCascVarIsCascadeCowboy==kTRUE ) ||
+             (lCascadeResult->GetCutIsCascadeCowboy()==-1 && fTreeCascVarIsCascadeCowboy==kFALSE)
+             );
+        default:
+            return kTRUE;
+    }
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::BuildCascadeSelector()
+{
+    //Group the cascade configurations by their cut values, check by check
+    fCascadeConfigs.clear();
+    TList *lLists[4] = {fListXiMinus, fListXiPlus, fListOmegaMinus, fListOmegaPlus};
+    for(Int_t ilist=0; ilist<4; ilist++)
+        for( Int_t icfg=0; icfg<lLists[ilist]->GetEntries(); icfg++ )
+            fCascadeConfigs.push_back( (AliCascadeResult*) lLists[ilist]->At(icfg) );
+    
+    if( !fCascadeSelector ) fCascadeSelector = new AliWeakResultSelector();
+    fCascadeSelector->Reset(fCascadeConfigs.size(), kNCascChecks);
+    for(UInt_t icfg=0; icfg<fCascadeConfigs.size(); icfg++){
+        const AliCascadeResult *lCascadeResult = fCascadeConfigs[icfg];
+        Double_t lHypo = lCascadeResult->GetMassHypothesis();
+        for(Int_t icheck=0; icheck<kNCascChecks; icheck++){
+            std::vector<Double_t> lKey;
+            switch( icheck ){
+                case kCascCharge:
+                    lKey.push_back(lHypo);
+                    lKey.push_back(lCascadeResult->GetSwapBachelorCharge());
+                    break;
+                case kCascAcceptance:
+                    lKey.push_back(lHypo);
+                    lKey.push_back(lCascadeResult->GetCutMinEtaTracks());
+                    lKey.push_back(lCascadeResult->GetCutMaxEtaTracks());
+                    lKey.push_back(lCascadeResult->GetCutMinRapidity());
+                    lKey.push_back(lCascadeResult->GetCutMaxRapidity());
+                    break;
+                case kCascDCANegToPV:
+                    lKey.push_back(lCascadeResult->GetCutDCANegToPV());
+                    break;
+                case kCascDCAPosToPV:
+                    lKey.push_back(lCascadeResult->GetCutDCAPosToPV());
+                    break;
+                case kCascDCAV0Daughters:
+                    lKey.push_back(lCascadeResult->GetCutDCAV0Daughters());
+                    break;
+                case kCascV0CosPA:
+                    lKey.push_back(lCascadeResult->GetCutV0CosPA());
+                    lKey.push_back(lCascadeResult->GetCutUseVarV0CosPA());
+                    lKey.push_back(lCascadeResult->GetCutVarV0CosPAExp0Const());
+                    lKey.push_back(lCascadeResult->GetCutVarV0CosPAExp0Slope());
+                    lKey.push_back(lCascadeResult->GetCutVarV0CosPAExp1Const());
+                    lKey.push_back(lCascadeResult->GetCutVarV0CosPAExp1Slope());
+                    lKey.push_back(lCascadeResult->GetCutVarV0CosPAConst());
+                    break;
+                case kCascV0Radius:
+                    lKey.push_back(lCascadeResult->GetCutV0Radius());
+                    break;
+                case kCascDCAV0ToPV:
+                    lKey.push_back(lCascadeResult->GetCutDCAV0ToPV());
+                    break;
+                case kCascV0Mass:
+                    lKey.push_back(lHypo);
+                    lKey.push_back(lCascadeResult->GetCutV0Mass());
+                    lKey.push_back(lCascadeResult->GetCutV0MassSigma());
+                    break;
+                case kCascDCABachToPV:
+                    lKey.push_back(lCascadeResult->GetCutDCABachToPV());
+                    break;
+                case kCascDCACascDaughters:
+                    lKey.push_back(lCascadeResult->GetCutDCACascDaughters());
+                    lKey.push_back(lCascadeResult->GetCutUseVarDCACascDau());
+                    lKey.push_back(lCascadeResult->GetCutVarDCACascDauExp0Const());
+                    lKey.push_back(lCascadeResult->GetCutVarDCACascDauExp0Slope());
+                    lKey.push_back(lCascadeResult->GetCutVarDCACascDauExp1Const());
+                    lKey.push_back(lCascadeResult->GetCutVarDCACascDauExp1Slope());
+                    lKey.push_back(lCascadeResult->GetCutVarDCACascDauConst());
+                    break;
+                case kCascCosPA:
+                    lKey.push_back(lCascadeResult->GetCutCascCosPA());
+                    lKey.push_back(lCascadeResult->GetCutUseVarCascCosPA());
+                    lKey.push_back(lCascadeResult->GetCutVarCascCosPAExp0Const());
+                    lKey.push_back(lCascadeResult->GetCutVarCascCosPAExp0Slope());
+                    lKey.push_back(lCascadeResult->GetCutVarCascCosPAExp1Const());
+                    lKey.push_back(lCascadeResult->GetCutVarCascCosPAExp1Slope());
+                    lKey.push_back(lCascadeResult->GetCutVarCascCosPAConst());
+                    break;
+                case kCascRadius:
+                    lKey.push_back(lCascadeResult->GetCutCascRadius());
+                    break;
+                case kCascLifetime:
+                    lKey.push_back(lHypo);
+                    lKey.push_back(lCascadeResult->GetCutProperLifetime());
+                    break;
+                case kCascdEdx:
+                    lKey.push_back(lHypo);
+                    lKey.push_back(lCascadeResult->GetCutTPCdEdx());
+                    lKey.push_back(lCascadeResult->GetCutUseTOFUnchecked());
+                    break;
+                case kCascXiRejection:
+                    lKey.push_back(lHypo);
+                    lKey.push_back(lCascadeResult->GetCutXiRejection());
+                    break;
+                case kCascDCABachToBaryon:
+                    lKey.push_back(lCascadeResult->GetCutDCABachToBaryon());
+                    break;
+                case kCascBBCosPA:
+                    lKey.push_back(lCascadeResult->GetCutBachBaryonCosPA());
+                    lKey.push_back(lCascadeResult->GetCutUseVarBBCosPA());
+                    lKey.push_back(lCascadeResult->GetCutVarBBCosPAExp0Const());
+                    lKey.push_back(lCascadeResult->GetCutVarBBCosPAExp0Slope());
+                    lKey.push_back(lCascadeResult->GetCutVarBBCosPAExp1Const());
+                    lKey.push_back(lCascadeResult->GetCutVarBBCosPAExp1Slope());
+                    lKey.push_back(lCascadeResult->GetCutVarBBCosPAConst());
+                    break;
+                case kCascV0Lifetime:
+                    lKey.push_back(lCascadeResult->GetCutMinV0Lifetime());
+                    lKey.push_back(lCascadeResult->GetCutMaxV0Lifetime());
+                    break;
+                case kCascV0CosPA276TeV:
+                    lKey.push_back(lCascadeResult->GetCutUse276TeVV0CosPA());
+                    break;
+                case kCascDCACascadeToPV:
+                    lKey.push_back(lCascadeResult->GetCutDCACascadeToPV());
+                    break;
+                case kCascTrackQuality:
+                    lKey.push_back(lCascadeResult->GetCutLeastNumberOfClusters());
+                    lKey.push_back(lCascadeResult->GetCutUseITSRefitTracks());
+                    lKey.push_back(lCascadeResult->GetCutMaxChi2PerCluster());
+                    lKey.push_back(lCascadeResult->GetCutMinTrackLength());
+                    lKey.push_back(lCascadeResult->GetCutUseParametricLength());
+                    lKey.push_back(lCascadeResult->GetCutAtLeastOneTOF());
+                    lKey.push_back(lCascadeResult->GetCutUseITSRefitNegative());
+                    lKey.push_back(lCascadeResult->GetCutUseITSRefitPositive());
+                    lKey.push_back(lCascadeResult->GetCutUseITSRefitBachelor());
+                    lKey.push_back(lCascadeResult->GetCutMinCrossedRowsOverLength());
+                    lKey.push_back(lCascadeResult->GetCutLeastNumberOfCrossedRows());
+                    lKey.push_back(lCascadeResult->GetCutITSorTOF());
+                    break;
+                case kCascCowboy:
+                    lKey.push_back(lCascadeResult->GetCutIsCowboy());
+                    lKey.push_back(lCascadeResult->GetCutIsCascadeCowboy());
+                    break;
+            }
+            fCascadeSelector->SetKey(icheck, icfg, lKey);
+        }
+    }
+    fCascadeSelector->Build();
+    
+    Int_t lNGroups = 0;
+    for(Int_t icheck=0; icheck<kNCascChecks; icheck++) lNGroups += fCascadeSelector->GetNGroups(icheck);
+    AliInfo(Form("Single-pass selection: %i cascade configurations, %i distinct checks",(Int_t)fCascadeConfigs.size(),lNGroups));
+}
+
 //________________________________________________________________________
 Double_t AliAnalysisTaskStrangenessVsMultiplicityRun2::MyRapidity(Double_t rE, Double_t rPz) const
 {
@@ -45,6 +45,9 @@ class AliCFContainer;
 class AliV0Result;
 class AliCascadeResult;
 class AliExternalTrackParam;
+class AliWeakResultSelector;
+
+#include <vector>
 
 //#include "TString.h"
 //#include "AliESDtrackCuts.h"
@@ -238,8 +241,33 @@ public:
         fkSaveSpecificConfig = kTRUE; 
     }
 //---------------------------------------------------------------------------------------
+    //Evaluate each distinct set of cut values once per candidate instead of
+    //checking every configuration in turn (same output, faster with many configurations)
+    void SetUseSinglePassSelection(Bool_t lOption = kTRUE){
+        fkUseSinglePassSelection = lOption;
+    }
+//---------------------------------------------------------------------------------------
     
 private:
+    //Checks of the configuration selections, see PassesV0Check and PassesCascadeCheck
+    enum EV0Check { kV0OnFly, kV0Acceptance, kV0Radius, kV0DCANegToPV, kV0DCAPosToPV, kV0DCAV0Daughters,
+        kV0CosPA, kV0Lifetime, kV0CrossedRows, kV0BaryonMomentum, kV0dEdx, kV0Armenteros,
+        kV0TrackQuality, kV0Cowboy, kNV0Checks };
+    enum ECascadeCheck { kCascCharge, kCascAcceptance, kCascDCANegToPV, kCascDCAPosToPV, kCascDCAV0Daughters,
+        kCascV0CosPA, kCascV0Radius, kCascDCAV0ToPV, kCascV0Mass, kCascDCABachToPV, kCascDCACascDaughters,
+        kCascCosPA, kCascRadius, kCascLifetime, kCascdEdx, kCascXiRejection, kCascDCABachToBaryon,
+        kCascBBCosPA, kCascV0Lifetime, kCascV0CosPA276TeV, kCascDCACascadeToPV, kCascTrackQuality,
+        kCascCowboy, kNCascChecks };
+    
+    Bool_t PassesV0Check(Int_t lCheck, const AliV0Result *lV0Result, Int_t lOnFlyStatus, Float_t lThisPosInnerPt,
+                         Float_t lThisNegInnerPt, Float_t lLeastNcrOverLength, Bool_t lITSorTOFsatisfied) const;
+    Bool_t PassesCascadeCheck(Int_t lCheck, const AliCascadeResult *lCascadeResult, Float_t lV0Pt, Float_t lV0TotMomentum,
+                              Float_t lLeastNcrOverLength, Int_t lLeastNbrCrossedRows, Bool_t lITSorTOFsatisfied) const;
+    Float_t GetV0ResultMass(const AliV0Result *lV0Result) const;
+    Float_t GetCascadeResultMass(const AliCascadeResult *lCascadeResult) const;
+    void BuildV0Selector();
+    void BuildCascadeSelector();
+    
     // Note : In ROOT, "//!" means "do not stream the data from Master node to Worker node" ...
     // your data member object is created on the worker nodes and streaming is not needed.
     // http://root.cern.ch/download/doc/11InputOutput.pdf, page 14
@@ -317,6 +345,13 @@ private:
     Bool_t fkSaveSpecificConfig;
     TString fkConfigToSave; 
     
+    //if true, single-pass selection of the configurations
+    Bool_t fkUseSinglePassSelection;
+    AliWeakResultSelector *fV0Selector;      //! configurations grouped per check, V0s
+    AliWeakResultSelector *fCascadeSelector; //! configurations grouped per check, cascades
+    std::vector<AliV0Result*> fV0Configs;           //! V0 configurations in selector order
+    std::vector<AliCascadeResult*> fCascadeConfigs; //! cascade configurations in selector order
+    
 //===========================================================================================
 //   Variables for Event Tree
 //===========================================================================================
@@ -678,7 +713,7 @@ private:
     AliAnalysisTaskStrangenessVsMultiplicityRun2(const AliAnalysisTaskStrangenessVsMultiplicityRun2&);            // not implemented
     AliAnalysisTaskStrangenessVsMultiplicityRun2& operator=(const AliAnalysisTaskStrangenessVsMultiplicityRun2&); // not implemented
 
-    ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 4);
+    ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 5);
     //1: first implementation
 };
 
@@ -0,0 +1,56 @@
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Branch creation and output settings of the candidate trees
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+#include <TTree.h>
+#include <TBranch.h>
+#include <TObjArray.h>
+#include <TObjString.h>
+#include <TRegexp.h>
+#include <TMath.h>
+#include "AliCandidateTreeWriter.h"
+
+//________________________________________________________________
+AliCandidateTreeWriter::AliCandidateTreeWriter(Int_t lFloatBits, const char *lFullPrecision) :
+fFloatBits(lFloatBits > 0 ? TMath::Min(TMath::Max(lFloatBits,2),14) : 0),
+fFullPrecision(lFullPrecision)
+{
+    
+}
+
+//________________________________________________________________
+Bool_t AliCandidateTreeWriter::IsFullPrecision(const char *lName) const
+{
+    if( fFullPrecision.IsNull() ) return kFALSE;
+    TString lBranch(lName);
+    TObjArray *lPatterns = fFullPrecision.Tokenize(",");
+    Bool_t lMatch = kFALSE;
+    for(Int_t i=0; i<lPatterns->GetEntriesFast() && !lMatch; i++){
+        TString lPattern = ((TObjString*)lPatterns->At(i))->GetString().Strip(TString::kBoth);
+        if( lPattern.IsNull() ) continue;
+        TRegexp lRegexp(lPattern, kTRUE);
+        Ssiz_t lLength = 0;
+        if( lRegexp.Index(lBranch, &lLength) == 0 && lLength == lBranch.Length() ) lMatch = kTRUE;
+    }
+    delete lPatterns;
+    return lMatch;
+}
+
+//________________________________________________________________
+TBranch *AliCandidateTreeWriter::Branch(TTree *lTree, const char *lName, void *lAddress, const char *lLeafList) const
+{
+    TString lLeaves(lLeafList);
+    //Only single float leaves are packed
+    if( fFloatBits > 0 && lLeaves.EndsWith("/F") && !lLeaves.Contains("[") && !lLeaves.Contains(":") && !IsFullPrecision(lName) ){
+        lLeaves.Replace(lLeaves.Length()-2, 2, Form("/f[0,0,%i]",fFloatBits));
+    }
+    return lTree->Branch(lName, lAddress, lLeaves.Data());
+}
+
+//________________________________________________________________
+void AliCandidateTreeWriter::Configure(TTree *lTree, Int_t lBasketSize, Long64_t lAutoFlush)
+{
+    if( !lTree ) return;
+    if( lBasketSize > 0 ) lTree->SetBasketSize("*", lBasketSize);
+    if( lAutoFlush != 0 ) lTree->SetAutoFlush(lAutoFlush);
+}
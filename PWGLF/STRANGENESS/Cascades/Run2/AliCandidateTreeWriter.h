@@ -0,0 +1,37 @@
+#ifndef AliCandidateTreeWriter_H
+#define AliCandidateTreeWriter_H
+#include <Rtypes.h>
+#include <TString.h>
+
+class TTree;
+class TBranch;
+
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Branch creation and output settings shared by the candidate trees
+// (fTreeV0, fTreeCascade) of the strangeness vs multiplicity tasks.
+// With a float precision set, the single float branches are stored as
+// Float16_t with a truncated mantissa of that many bits (2..14), except
+// the ones listed as full precision (comma separated, wildcards allowed).
+// In memory they stay Float_t, the tasks do not change.
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+class AliCandidateTreeWriter {
+    
+public:
+    AliCandidateTreeWriter(Int_t lFloatBits = 0, const char *lFullPrecision = "");
+    
+    TBranch *Branch(TTree *lTree, const char *lName, void *lAddress, const char *lLeafList) const;
+    
+    //Basket size per branch and auto-flush (TTree convention: > 0 entries,
+    //< 0 bytes); 0 keeps the ROOT defaults
+    static void Configure(TTree *lTree, Int_t lBasketSize, Long64_t lAutoFlush);
+    
+    Int_t GetFloatBits() const { return fFloatBits; }
+    Bool_t IsFullPrecision(const char *lName) const;
+    
+private:
+    Int_t   fFloatBits;     //mantissa bits of the packed floats, 0: no packing
+    TString fFullPrecision; //branches kept as Float_t
+};
+
+#endif
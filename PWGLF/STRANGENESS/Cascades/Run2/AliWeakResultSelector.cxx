@@ -0,0 +1,112 @@
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Single-pass selection of AliV0Result / AliCascadeResult configurations
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+#include <map>
+#include "AliWeakResultSelector.h"
+using namespace std;
+
+//________________________________________________________________
+AliWeakResultSelector::AliWeakResultSelector() :
+fNConfigs(0),
+fNChecks(0),
+fKeys(),
+fGroups(),
+fSelected(),
+fNEvaluations(0)
+{
+    // Empty selector, to be set up with Reset(), SetKey() and Build()
+}
+
+//________________________________________________________________
+void AliWeakResultSelector::Reset(Int_t lNConfigs, Int_t lNChecks)
+{
+    fNConfigs = lNConfigs;
+    fNChecks  = lNChecks;
+    fKeys.assign(lNChecks, vector< vector<Double_t> >(lNConfigs));
+    fGroups.assign(lNChecks, vector< vector<Int_t> >());
+    fSelected.assign((lNConfigs+63)/64, 0);
+    fNEvaluations = 0;
+}
+
+//________________________________________________________________
+void AliWeakResultSelector::SetKey(Int_t lCheck, Int_t lConfig, const vector<Double_t> &lKey)
+{
+    fKeys[lCheck][lConfig] = lKey;
+}
+
+//________________________________________________________________
+void AliWeakResultSelector::Build()
+{
+    //Group, per check, the configurations with the same key
+    for(Int_t icheck=0; icheck<fNChecks; icheck++){
+        map< vector<Double_t>, Int_t > lGroupOfKey;
+        vector< vector<Int_t> > &lGroups = fGroups[icheck];
+        lGroups.clear();
+        for(Int_t icfg=0; icfg<fNConfigs; icfg++){
+            map< vector<Double_t>, Int_t >::iterator it = lGroupOfKey.find(fKeys[icheck][icfg]);
+            if( it == lGroupOfKey.end() ){
+                lGroupOfKey[fKeys[icheck][icfg]] = lGroups.size();
+                lGroups.push_back(vector<Int_t>(1,icfg));
+            } else {
+                lGroups[it->second].push_back(icfg);
+            }
+        }
+    }
+    fKeys.clear();
+}
+
+//________________________________________________________________
+void AliWeakResultSelector::StartCandidate()
+{
+    //All configurations selected
+    if( fSelected.empty() ) return;
+    fSelected.assign(fSelected.size(), ~0ULL);
+    if( fNConfigs%64 ) fSelected.back() = (1ULL<<(fNConfigs%64))-1;
+}
+
+//________________________________________________________________
+void AliWeakResultSelector::RejectRange(Int_t lFirst, Int_t lLast)
+{
+    //Remove the configurations [lFirst,lLast[
+    for(Int_t icfg=lFirst; icfg<lLast; icfg++) fSelected[icfg>>6] &= ~(1ULL<<(icfg&63));
+}
+
+//________________________________________________________________
+Int_t AliWeakResultSelector::GetRepresentative(Int_t lCheck, Int_t lGroup) const
+{
+    const vector<Int_t> &lConfigs = fGroups[lCheck][lGroup];
+    for(UInt_t i=0; i<lConfigs.size(); i++)
+        if( IsSelected(lConfigs[i]) ) return lConfigs[i];
+    return -1;
+}
+
+//________________________________________________________________
+void AliWeakResultSelector::RejectGroup(Int_t lCheck, Int_t lGroup)
+{
+    const vector<Int_t> &lConfigs = fGroups[lCheck][lGroup];
+    for(UInt_t i=0; i<lConfigs.size(); i++) fSelected[lConfigs[i]>>6] &= ~(1ULL<<(lConfigs[i]&63));
+}
+
+//________________________________________________________________
+Bool_t AliWeakResultSelector::IsEmpty() const
+{
+    for(UInt_t i=0; i<fSelected.size(); i++) if( fSelected[i] ) return kFALSE;
+    return kTRUE;
+}
+
+//________________________________________________________________
+Int_t AliWeakResultSelector::NextSelected(Int_t lConfig) const
+{
+    if( lConfig < 0 ) lConfig = 0;
+    if( lConfig >= fNConfigs ) return -1;
+    UInt_t iword = lConfig>>6;
+    ULong64_t lWord = fSelected[iword] & (~0ULL<<(lConfig&63));
+    while( !lWord ){
+        if( ++iword >= fSelected.size() ) return -1;
+        lWord = fSelected[iword];
+    }
+    Int_t lBit = 0;
+    while( !((lWord>>lBit)&1) ) lBit++;
+    return (iword<<6) + lBit;
+}
@@ -0,0 +1,52 @@
+#ifndef AliWeakResultSelector_H
+#define AliWeakResultSelector_H
+#include <Rtypes.h>
+#include <vector>
+
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Single-pass selection of many AliV0Result / AliCascadeResult
+// configurations. The selection is split in checks; for each check the
+// configurations with identical cut values (the key) form one group,
+// evaluated once per candidate. A failed group removes all of its
+// configurations from the selected bit mask.
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+class AliWeakResultSelector {
+    
+public:
+    AliWeakResultSelector();
+    
+    //Setup: one key per check and configuration, then Build()
+    void   Reset(Int_t lNConfigs, Int_t lNChecks);
+    void   SetKey(Int_t lCheck, Int_t lConfig, const std::vector<Double_t> &lKey);
+    void   Build();
+    
+    Int_t  GetNConfigs() const { return fNConfigs; }
+    Int_t  GetNChecks () const { return fNChecks;  }
+    Int_t  GetNGroups (Int_t lCheck) const { return fGroups[lCheck].size(); }
+    Long_t GetNEvaluations() const { return fNEvaluations; }
+    
+    //Per candidate
+    void   StartCandidate();
+    void   RejectRange(Int_t lFirst, Int_t lLast);
+    //First still selected configuration of the group, -1 if none: the
+    //group is evaluated with it, any configuration of the group gives the same
+    Int_t  GetRepresentative(Int_t lCheck, Int_t lGroup) const;
+    void   RejectGroup(Int_t lCheck, Int_t lGroup);
+    Bool_t IsSelected(Int_t lConfig) const { return (fSelected[lConfig>>6]>>(lConfig&63))&1; }
+    Bool_t IsEmpty() const;
+    //Next selected configuration from lConfig on, -1 if none
+    Int_t  NextSelected(Int_t lConfig) const;
+    
+    void   CountEvaluation() { fNEvaluations++; }
+    
+private:
+    Int_t fNConfigs; //number of configurations
+    Int_t fNChecks;  //number of checks
+    std::vector< std::vector< std::vector<Double_t> > > fKeys;   //key of each check and configuration
+    std::vector< std::vector< std::vector<Int_t> > >    fGroups; //configurations of each group, per check
+    std::vector<ULong64_t> fSelected;   //configurations still selected for the current candidate
+    Long_t fNEvaluations;               //number of group evaluations
+};
+
+#endif
@@ -24,6 +24,10 @@
 //modified by R. Vernet  3/7/2006 : causality
 //modified by I. Belikov 24/11/2006 : static setter for the default cuts
 
+#include <atomic>
+#include <thread>
+
+#include "TROOT.h"
 #include "TRandom3.h"
 #include "AliESDEvent.h"
 #include "AliESDcascade.h"
@@ -54,6 +58,14 @@ Int_t AliCascadeVertexerUncheckedCharges::fgMinClusters=70;   //min clusters (>=
 Bool_t AliCascadeVertexerUncheckedCharges::fgSwitchCharges=kFALSE;   //
 Bool_t AliCascadeVertexerUncheckedCharges::fgUseOnTheFlyV0=kFALSE;   //HIGHLY EXPERIMENTAL
 
+void AliCascadeVertexerUncheckedCharges::SetNThreads(Int_t n) {
+    //--------------------------------------------------------------------
+    // Number of threads for the V0-bachelor combinations, 1 by default
+    //--------------------------------------------------------------------
+    fNThreads = TMath::Max(n,1);
+    if (fNThreads > 1) ROOT::EnableThreadSafety();
+}
+
 Int_t AliCascadeVertexerUncheckedCharges::V0sTracks2CascadeVertices(AliESDEvent *event) {
     //--------------------------------------------------------------------
     // This function reconstructs cascade vertices
@@ -72,7 +84,8 @@ Int_t AliCascadeVertexerUncheckedCharges::V0sTracks2CascadeVertices(AliESDEvent
     lPRNG.SetSeed(0);
     
     //stores relevant V0s in an array
-    TObjArray vtcs(nV0);
+    std::vector<AliESDv0*> vtcs;
+    vtcs.reserve(nV0);
     Int_t i;
     Long_t lNumberOfLikeSignV0s = 0;
     for (i=0; i<nV0; i++) {
@@ -90,14 +103,15 @@ Int_t AliCascadeVertexerUncheckedCharges::V0sTracks2CascadeVertices(AliESDEvent
         }
         
         if (v->GetD(xPrimaryVertex,yPrimaryVertex,zPrimaryVertex)<fDV0min) continue;
-        vtcs.AddLast(v);
+        vtcs.push_back(v);
     }
     Info("V0sTracks2CascadeVertices","Number of like-sign V0s used: %d",lNumberOfLikeSignV0s);
-    nV0=vtcs.GetEntriesFast();
+    nV0=vtcs.size();
     
     // stores relevant tracks in another array
     Int_t nentr=(Int_t)event->GetNumberOfTracks();
-    TArrayI trk(nentr); Int_t ntr=0;
+    std::vector<Int_t> trk;
+    trk.reserve(nentr);
     for (i=0; i<nentr; i++) {
         AliESDtrack *esdtr=event->GetTrack(i);
         
@@ -111,17 +125,70 @@ Int_t AliCascadeVertexerUncheckedCharges::V0sTracks2CascadeVertices(AliESDEvent
         
         if (TMath::Abs(esdtr->GetD(xPrimaryVertex,yPrimaryVertex,b))<fDBachMin) continue;
         
-        trk[ntr++]=i;
+        //eta cut: the dip angle does not change in the propagation to the DCA,
+        //so it can be applied here once per track
+        if (TMath::Abs(esdtr->Eta())>fMaxEta) continue;
+        
+        trk.push_back(i);
     }
     
-    Double_t massLambda=1.11568;
     Int_t ncasc=0;
+    Int_t nthr=TMath::Min(fNThreads,nV0);
+    
+    if (nthr <= 1) {
+        std::vector<AliESDcascade> cascades;
+        FindCascades(event,vtcs,trk,0,nV0,cascades);
+        for (UInt_t icasc=0; icasc<cascades.size(); icasc++) event->AddCascade(&cascades[icasc]);
+        ncasc=cascades.size();
+    } else {
+        //chunks of V0s taken by the threads as they get free, each thread with
+        //its own copy of the vertexer; the cascades are added in the chunk order
+        const Int_t chunkSize=4;
+        Int_t nchunks=(nV0 + chunkSize - 1)/chunkSize;
+        std::vector< std::vector<AliESDcascade> > cascades(nchunks);
+        std::atomic<Int_t> nextChunk(0);
+        auto work = [&]() {
+            AliCascadeVertexerUncheckedCharges vertexer(*this);
+            Int_t ichunk;
+            while ((ichunk = nextChunk++) < nchunks)
+                vertexer.FindCascades(event,vtcs,trk,ichunk*chunkSize,TMath::Min((ichunk+1)*chunkSize,nV0),cascades[ichunk]);
+        };
+        std::vector<std::thread> threads;
+        for (Int_t ithr=1; ithr<nthr; ithr++) threads.push_back(std::thread(work));
+        work();
+        for (UInt_t ithr=0; ithr<threads.size(); ithr++) threads[ithr].join();
+        for (Int_t ichunk=0; ichunk<nchunks; ichunk++) {
+            for (UInt_t icasc=0; icasc<cascades[ichunk].size(); icasc++) event->AddCascade(&cascades[ichunk][icasc]);
+            ncasc+=cascades[ichunk].size();
+        }
+    }
+    
+    Info("V0sTracks2CascadeVertices","Number of reconstructed cascades: %d",ncasc);
+    
+    return 0;
+}
+
+void AliCascadeVertexerUncheckedCharges::FindCascades(AliESDEvent *event, const std::vector<AliESDv0*> &v0s, const std::vector<Int_t> &bach,
+                                                      Int_t first, Int_t last, std::vector<AliESDcascade> &cascades) {
+    //--------------------------------------------------------------------
+    // Cascades of the V0s [first,last[ with all the bachelor candidates
+    //--------------------------------------------------------------------
+    const AliESDVertex *vtxT3D=event->GetPrimaryVertex();
+    
+    Double_t xPrimaryVertex=vtxT3D->GetX();
+    Double_t yPrimaryVertex=vtxT3D->GetY();
+    Double_t zPrimaryVertex=vtxT3D->GetZ();
+    
+    Double_t b=event->GetMagneticField();
+    Int_t ntr=bach.size();
+    
+    Double_t massLambda=1.11568;
     
     // Looking for both cascades and anti-cascades simultaneously
     
-    for (i=0; i<nV0; i++) { //loop on V0s
+    for (Int_t i=first; i<last; i++) { //loop on V0s
         
-        AliESDv0 *v=(AliESDv0*)vtcs.UncheckedAt(i);
+        AliESDv0 *v=v0s[i];
         AliESDv0 v0(*v);
         
         Float_t lMassAsLambda     = 0;
@@ -138,7 +205,7 @@ Int_t AliCascadeVertexerUncheckedCharges::V0sTracks2CascadeVertices(AliESDEvent
             TMath::Abs(lMassAsAntiLambda-massLambda)>fMassWin) continue;
         
         for (Int_t j=0; j<ntr; j++) {//loop on tracks
-            Int_t bidx=trk[j];
+            Int_t bidx=bach[j];
             //Check if different tracks are used all times
             if (bidx==v0.GetIndex(0)) continue; //Bo:  consistency 0 for neg
             if (bidx==v0.GetIndex(1)) continue; //Bo:  consistency 0 for neg
@@ -153,8 +220,7 @@ Int_t AliCascadeVertexerUncheckedCharges::V0sTracks2CascadeVertices(AliESDEvent
             Double_t dca=PropagateToDCA(pv0,pbt,b);
             if (dca > fDCAmax) continue;
             
-            //eta cut - test
-            if (TMath::Abs(pbt->Eta())>fMaxEta) continue;
+            //eta cut - test: done in the bachelor pre-selection
             
             AliESDcascade cascade(*pv0,*pbt,bidx);//constucts a cascade candidate
             
@@ -173,14 +239,9 @@ Int_t AliCascadeVertexerUncheckedCharges::V0sTracks2CascadeVertices(AliESDEvent
             if (cascade.GetCascadeCosineOfPointingAngle(xPrimaryVertex,yPrimaryVertex,zPrimaryVertex) <fCPAmin) continue; //condition on the cascade pointing angle
             
             cascade.SetDcaXiDaughters(dca);
-            event->AddCascade(&cascade);
-            ncasc++;
+            cascades.push_back(cascade);
         } // end loop tracks
     } // end loop V0s
-    
-    Info("V0sTracks2CascadeVertices","Number of reconstructed cascades: %d",ncasc);
-    
-    return 0;
 }
 
 
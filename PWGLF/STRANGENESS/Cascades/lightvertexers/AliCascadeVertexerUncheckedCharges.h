@@ -9,7 +9,10 @@
 //    Origin: Christian Kuhn, IReS, Strasbourg, christian.kuhn@ires.in2p3.fr
 //------------------------------------------------------------------
 
+#include <vector>
+
 #include "TObject.h"
+#include "AliESDcascade.h"
 
 class AliESDEvent;
 class AliESDv0;
@@ -41,7 +44,12 @@ public:
     void SetSwitchCharges(Bool_t lOption);
     void SetUseOnTheFlyV0 (Bool_t lOption);
     void SetRotateBachelor (Bool_t lOption);
+    //Process the V0s in chunks with n threads (same cascade list and order)
+    void SetNThreads (Int_t n);
 private:
+  void FindCascades(AliESDEvent *event, const std::vector<AliESDv0*> &v0s, const std::vector<Int_t> &bach,
+                    Int_t first, Int_t last, std::vector<AliESDcascade> &cascades);
+
   static
   Double_t fgChi2max;   // maximal allowed chi2 
   static
@@ -73,8 +81,9 @@ private:
     Bool_t fSwitchCharges; //switch to change bachelor charge
     Bool_t fUseOnTheFlyV0; //switch to use on-the-fly V0s (HIGHLY EXPERIMENTAL)
     Bool_t fRotateBachelor; //Rotate bachelor track randomly
+    Int_t fNThreads; //number of threads for the V0-bachelor combinations
   
-  ClassDef(AliCascadeVertexerUncheckedCharges,3)  // cascade verterxer 
+  ClassDef(AliCascadeVertexerUncheckedCharges,4)  // cascade verterxer 
 };
 
 inline AliCascadeVertexerUncheckedCharges::AliCascadeVertexerUncheckedCharges() :
@@ -91,7 +100,8 @@ fMaxEta(fgMaxEta),
 fMinClusters(fgMinClusters),
 fSwitchCharges(fgSwitchCharges),
 fUseOnTheFlyV0(fgUseOnTheFlyV0),
-fRotateBachelor(kFALSE)
+fRotateBachelor(kFALSE),
+fNThreads(1)
 {
 }
 
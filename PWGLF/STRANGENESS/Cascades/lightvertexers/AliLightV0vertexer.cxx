@@ -25,6 +25,10 @@
 //          This is still being tested! Use at your own risk!
 //-------------------------------------------------------------------------
 
+#include <atomic>
+#include <thread>
+
+#include "TROOT.h"
 #include "AliESDEvent.h"
 #include "AliESDv0.h"
 #include "AliLightV0vertexer.h"
@@ -44,6 +48,40 @@ Double_t AliLightV0vertexer::fgRmax=200.;   //max radius of the fiducial volume
 Double_t AliLightV0vertexer::fgMaxEta=0.8;        //max |eta|
 Double_t AliLightV0vertexer::fgMinClusters=70;   //min clusters (>=)
 
+void AliLightV0vertexer::SetNThreads(Int_t n) {
+    //--------------------------------------------------------------------
+    //Number of threads for the pair search, 1 by default
+    //--------------------------------------------------------------------
+    fNThreads = TMath::Max(n,1);
+    if (fNThreads > 1) ROOT::EnableThreadSafety();
+}
+
+void AliLightV0vertexer::AddTrack(TrackArrays &arr, const AliESDtrack *trk, Int_t idx, Double_t d, Double_t b) const {
+    //--------------------------------------------------------------------
+    //Store the track parameters used by the pair pre-selection
+    //--------------------------------------------------------------------
+    Double_t xyz[3];
+    trk->GetXYZ(xyz);
+    Double_t phi=TMath::ASin(trk->GetSnp()) + trk->GetAlpha();
+    Double_t c=trk->GetC(b);
+    
+    //circle described by the track in the transverse plane, the center
+    //is on the left of the direction of flight for a positive curvature
+    Double_t r=-1., xc=0., yc=0.;
+    if (TMath::Abs(c) > 1e-5) {
+        r=1./TMath::Abs(c);
+        xc=xyz[0] - TMath::Sin(phi)/c;
+        yc=xyz[1] + TMath::Cos(phi)/c;
+    }
+    arr.fIndex.push_back(idx);
+    arr.fD.push_back(TMath::Abs(d));
+    arr.fXc.push_back(xc);
+    arr.fYc.push_back(yc);
+    arr.fR.push_back(r);
+    arr.fSigmaY2.push_back(trk->GetSigmaY2());
+    arr.fSigmaZ2.push_back(trk->GetSigmaZ2());
+}
+
 Int_t AliLightV0vertexer::Tracks2V0vertices(AliESDEvent *event) {
     //--------------------------------------------------------------------
     //This function reconstructs V0 vertices
@@ -53,17 +91,15 @@ Int_t AliLightV0vertexer::Tracks2V0vertices(AliESDEvent *event) {
     
     Double_t xPrimaryVertex=vtxT3D->GetX();
     Double_t yPrimaryVertex=vtxT3D->GetY();
-    Double_t zPrimaryVertex=vtxT3D->GetZ();
     
     Int_t nentr=event->GetNumberOfTracks();
     Double_t b=event->GetMagneticField();
     
     if (nentr<2) return 0;
     
-    TArrayI neg(nentr);
-    TArrayI pos(nentr);
+    TrackArrays neg, pos;
     
-    Int_t nneg=0, npos=0, nvtx=0;
+    Int_t nvtx=0;
     
     Int_t i;
     for (i=0; i<nentr; i++) {
@@ -80,24 +116,100 @@ Int_t AliLightV0vertexer::Tracks2V0vertices(AliESDEvent *event) {
         if (TMath::Abs(d)<fDPmin) continue;
         if (TMath::Abs(d)>fRmax) continue;
         
-        if (esdTrack->GetSign() < 0.) neg[nneg++]=i;
-        else pos[npos++]=i;
+        if (esdTrack->GetSign() < 0.) AddTrack(neg,esdTrack,i,d,b);
+        else AddTrack(pos,esdTrack,i,d,b);
+    }
+    
+    Int_t nneg=neg.fIndex.size();
+    Int_t nthr=TMath::Min(fNThreads,nneg);
+    
+    if (nthr <= 1) {
+        std::vector<AliESDv0> v0s;
+        FindV0s(event,neg,pos,0,nneg,v0s);
+        for (UInt_t iv0=0; iv0<v0s.size(); iv0++) event->AddV0(&v0s[iv0]);
+        nvtx=v0s.size();
+    } else {
+        //chunks of negative tracks taken by the threads as they get free,
+        //the V0s are added to the event in the chunk order as without threads
+        const Int_t chunkSize=16;
+        Int_t nchunks=(nneg + chunkSize - 1)/chunkSize;
+        std::vector< std::vector<AliESDv0> > v0s(nchunks);
+        std::atomic<Int_t> nextChunk(0);
+        auto work = [&]() {
+            Int_t ichunk;
+            while ((ichunk = nextChunk++) < nchunks)
+                FindV0s(event,neg,pos,ichunk*chunkSize,TMath::Min((ichunk+1)*chunkSize,nneg),v0s[ichunk]);
+        };
+        std::vector<std::thread> threads;
+        for (Int_t ithr=1; ithr<nthr; ithr++) threads.push_back(std::thread(work));
+        work();
+        for (UInt_t ithr=0; ithr<threads.size(); ithr++) threads[ithr].join();
+        for (Int_t ichunk=0; ichunk<nchunks; ichunk++) {
+            for (UInt_t iv0=0; iv0<v0s[ichunk].size(); iv0++) event->AddV0(&v0s[ichunk][iv0]);
+            nvtx+=v0s[ichunk].size();
+        }
     }
     
+    Info("Tracks2V0vertices","Number of reconstructed V0 vertices: %d",nvtx);
+    
+    return nvtx;
+}
+
+void AliLightV0vertexer::FindV0s(AliESDEvent *event, const TrackArrays &neg, const TrackArrays &pos,
+                                 Int_t first, Int_t last, std::vector<AliESDv0> &v0s) const {
+    //--------------------------------------------------------------------
+    //V0s of the negative tracks [first,last[ with all the positive tracks
+    //--------------------------------------------------------------------
+    
+    const AliESDVertex *vtxT3D=event->GetPrimaryVertex();
+    
+    Double_t xPrimaryVertex=vtxT3D->GetX();
+    Double_t yPrimaryVertex=vtxT3D->GetY();
+    Double_t zPrimaryVertex=vtxT3D->GetZ();
+    
+    Double_t b=event->GetMagneticField();
+    
+    Int_t npos=pos.fIndex.size();
+    if (npos==0) return;
+    std::vector<Double_t> dcaMin(npos,0.);
     
-    for (i=0; i<nneg; i++) {
-        Int_t nidx=neg[i];
+    //small margin, to be safe against rounding in the lower bound
+    const Double_t dcaCut=fDCAmax*(1.+1e-6) + 1e-4;
+    
+    for (Int_t i=first; i<last; i++) {
+        Int_t nidx=neg.fIndex[i];
         AliESDtrack *ntrk=event->GetTrack(nidx);
         
+        //Lower bound of the DCA as returned by AliExternalTrackParam::GetDCA():
+        //the transverse distance between the points of closest approach is
+        //at least the distance between the helix circles, which GetDCA() scales
+        //by (sigmaZ2/sigmaY2)^(1/4)
+        if (fkUseDCAPreselection) {
+            const Double_t xc=neg.fXc[i], yc=neg.fYc[i], r=neg.fR[i];
+            const Double_t sy2=neg.fSigmaY2[i], sz2=neg.fSigmaZ2[i];
+            const Double_t *pxc=&pos.fXc[0], *pyc=&pos.fYc[0], *pr=&pos.fR[0];
+            const Double_t *psy2=&pos.fSigmaY2[0], *psz2=&pos.fSigmaZ2[0];
+            Double_t *dmin=&dcaMin[0];
+            for (Int_t k=0; k<npos; k++) {
+                Double_t dx=pxc[k] - xc, dy=pyc[k] - yc;
+                Double_t dist=TMath::Sqrt(dx*dx + dy*dy);
+                Double_t gap=TMath::Max(dist - r - pr[k], TMath::Abs(r - pr[k]) - dist);
+                Double_t w=TMath::Sqrt(TMath::Sqrt((sz2 + psz2[k])/(sy2 + psy2[k])));
+                dmin[k]=(r < 0. || pr[k] < 0. || gap < 0.) ? 0. : gap*TMath::Min(w,1.);
+            }
+        }
+        
         for (Int_t k=0; k<npos; k++) {
-            Int_t pidx=pos[k];
+            if (dcaMin[k] > dcaCut) continue;
+            
+            Int_t pidx=pos.fIndex[k];
             AliESDtrack *ptrk=event->GetTrack(pidx);
             
             //Track pre-selection: clusters
             if (ptrk->GetTPCNcls() < fMinClusters ) continue;
             
-            if (TMath::Abs(ntrk->GetD(xPrimaryVertex,yPrimaryVertex,b))<fDNmin)
-                if (TMath::Abs(ptrk->GetD(xPrimaryVertex,yPrimaryVertex,b))<fDNmin) continue;
+            if (neg.fD[i]<fDNmin)
+                if (pos.fD[k]<fDNmin) continue;
             
             Double_t xn, xp, dca=ntrk->GetDCA(ptrk,b,xn,xp);
             if (dca > fDCAmax) continue;
@@ -149,27 +261,7 @@ Int_t AliLightV0vertexer::Tracks2V0vertices(AliESDEvent *event) {
             vertex.SetV0CosineOfPointingAngle(cpa);
             vertex.ChangeMassHypothesis(kK0Short);
             
-            event->AddV0(&vertex);
-            
-            nvtx++;
+            v0s.push_back(vertex);
         }
     }
-    
-    Info("Tracks2V0vertices","Number of reconstructed V0 vertices: %d",nvtx);
-    
-    return nvtx;
 }
-
-
-
-
-
-
-
-
-
-
-
-
-
-
@@ -9,10 +9,14 @@
 //   Origin: Iouri Belikov, IReS, Strasbourg, Jouri.Belikov@cern.ch
 //------------------------------------------------------------------
 
+#include <vector>
+
 #include "TObject.h"
+#include "AliESDv0.h"
 
 class TTree;
 class AliESDEvent;
+class AliESDtrack;
 
 //_____________________________________________________________________________
 class AliLightV0vertexer : public TObject {
@@ -34,7 +38,28 @@ public:
     //Experimental implementation of V0 refit functionality 
     void SetDoRefit( Bool_t lDoRefit ) { fkDoRefit = lDoRefit; }
     
+    //Reject pairs with a lower bound of the DCA from the helix circles before
+    //the full DCA calculation (the V0 list is unchanged)
+    void SetUseDCAPreselection( Bool_t lUse ) { fkUseDCAPreselection = lUse; }
+    //Process the negative tracks in chunks with n threads (same V0 list and order)
+    void SetNThreads( Int_t n );
+    
 private:
+    //Track parameters of one charge, as arrays, for the pair pre-selection
+    struct TrackArrays {
+        std::vector<Int_t>    fIndex;   // ESD track index
+        std::vector<Double_t> fD;       // |impact parameter| in the transverse plane
+        std::vector<Double_t> fXc;      // x of the helix circle center
+        std::vector<Double_t> fYc;      // y of the helix circle center
+        std::vector<Double_t> fR;       // helix circle radius, <0 for (almost) straight tracks
+        std::vector<Double_t> fSigmaY2; // y error^2
+        std::vector<Double_t> fSigmaZ2; // z error^2
+    };
+    
+    void AddTrack(TrackArrays &arr, const AliESDtrack *trk, Int_t idx, Double_t d, Double_t b) const;
+    void FindV0s(AliESDEvent *event, const TrackArrays &neg, const TrackArrays &pos,
+                 Int_t first, Int_t last, std::vector<AliESDv0> &v0s) const;
+    
     static
     Double_t fgChi2max;      // maximal allowed chi2
     static
@@ -62,8 +87,10 @@ private:
     Double_t fMinClusters;  // minimum single-track clusters value (>=)
     
     Bool_t fkDoRefit; //improve precision with a V0 refit (+ calculate chi2)
+    Bool_t fkUseDCAPreselection; //DCA lower bound from the helix circles before the full DCA
+    Int_t  fNThreads; //number of threads for the pair search
     
-    ClassDef(AliLightV0vertexer,3)  // V0 verterxer
+    ClassDef(AliLightV0vertexer,4)  // V0 verterxer
 };
 
 inline AliLightV0vertexer::AliLightV0vertexer() :
@@ -77,7 +104,9 @@ fRmin(fgRmin),
 fRmax(fgRmax),
 fMaxEta(fgMaxEta),
 fMinClusters(fgMinClusters),
-fkDoRefit(kTRUE)
+fkDoRefit(kTRUE),
+fkUseDCAPreselection(kTRUE),
+fNThreads(1)
 {
 }
 
@@ -65,6 +65,7 @@
 //_____ AnalysisTask headers
 #include "AliAnalysisTaskSE.h"
 #include "AliAnalysisTaskGenUeSpherocity.h"
+#include "AliEventShapeEngine.h"
 
 //_____ STL includes
 #include <iostream>
@@ -164,6 +165,7 @@ ClassImp( AliAnalysisTaskGenUeSpherocity )
 		fIndexLeadingRec(-1),
 		fMinPtLeading(5.0),
 		fSizeStep(0.1),
+		fUseExactSpherocity(kFALSE),
 		//fNso_gen(3),
 		//fNso_rec(3),
 		fspherocity_gen_ptWeighted(-1),
@@ -273,6 +275,7 @@ AliAnalysisTaskGenUeSpherocity::AliAnalysisTaskGenUeSpherocity(const char *name)
 	fIndexLeadingRec(-1),
 	fMinPtLeading(5.0),
 	fSizeStep(0.1),
+	fUseExactSpherocity(kFALSE),
 	//fNso_gen(3),
 	//fNso_rec(3),
 	fspherocity_gen_ptWeighted(-1),
@@ -1392,56 +1395,9 @@ void AliAnalysisTaskGenUeSpherocity::ParticleSel(Bool_t fIsPseudoRec, const vect
 
 Float_t AliAnalysisTaskGenUeSpherocity::GetSpherocity(Int_t nch_so, const vector<Float_t> &pt, const vector<Float_t> &eta, const vector<Float_t> &phi, const Bool_t isPtWeighted ){
 
-
-	Float_t spherocity = -10.0;
-	Float_t pFull = 0;
-	Float_t Spherocity = 2;
-
-	//computing total pt
-	Float_t sumapt = 0;
-	if(isPtWeighted)
-		for(Int_t i1 = 0; i1 < nch_so; ++i1){
-			sumapt += pt[i1];
-		}
-	else
-		sumapt = 1.0*nch_so;
-	//Getting thrust
-	for(Int_t i = 0; i < 360/(fSizeStep); ++i){
-		Float_t numerador = 0;
-		Float_t phiparam  = 0;
-		Float_t nx = 0;
-		Float_t ny = 0;
-		phiparam=( (TMath::Pi()) * i * fSizeStep ) / 180; // parametrization of the angle
-		nx = TMath::Cos(phiparam);            // x component of an unitary vector n
-		ny = TMath::Sin(phiparam);            // y component of an unitary vector n
-		for(Int_t i1 = 0; i1 < nch_so; ++i1){
-
-			Float_t pxA = 0;
-			Float_t pyA = 0;
-			if(isPtWeighted){
-				pxA = pt[i1] * TMath::Cos( phi[i1] );
-				pyA = pt[i1] * TMath::Sin( phi[i1] );
-			}
-			else{
-				pxA = 1.0 * TMath::Cos( phi[i1] );
-				pyA = 1.0 * TMath::Sin( phi[i1] );
-			}
-
-
-
-			numerador += TMath::Abs( ny * pxA - nx * pyA );//product between p  proyection in XY plane and the unitary vector
-		}
-		pFull=TMath::Power( (numerador / sumapt),2 );
-		if(pFull < Spherocity)//maximization of pFull
-		{
-			Spherocity = pFull;
-		}
-	}
-
-	spherocity=((Spherocity)*TMath::Pi()*TMath::Pi())/4.0;
-
-
-	return spherocity;
+	if(fUseExactSpherocity)
+		return AliEventShapeEngine::GetSpherocity(nch_so, pt.data(), phi.data(), isPtWeighted);
+	return AliEventShapeEngine::GetSpherocityScan(nch_so, pt.data(), phi.data(), fSizeStep, isPtWeighted);
 
 }
 
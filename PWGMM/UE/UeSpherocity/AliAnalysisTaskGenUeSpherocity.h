@@ -57,6 +57,7 @@ class AliAnalysisTaskGenUeSpherocity : public AliAnalysisTaskSE { //
 		virtual void SetYRange(Float_t y){ fY=y; }
 		virtual void SetGenerator(TString generator){fGenerator=generator;}
 		virtual void SetMinPtLeading(Double_t minptl){fMinPtLeading=minptl;}
+		virtual void SetUseExactSpherocity(Bool_t useexact){fUseExactSpherocity=useexact;}
 
 	private:
 
@@ -94,6 +95,7 @@ class AliAnalysisTaskGenUeSpherocity : public AliAnalysisTaskSE { //
 		Int_t       fIndexLeadingRec;
 		Double_t    fMinPtLeading;
 		Float_t     fSizeStep;
+		Bool_t      fUseExactSpherocity; // exact minimum instead of the scan in fSizeStep
 		//Int_t       fNso_gen;
 		//Int_t       fNso_rec;
 		Float_t     fspherocity_gen_ptWeighted;
@@ -176,7 +178,7 @@ class AliAnalysisTaskGenUeSpherocity : public AliAnalysisTaskSE { //
 		AliAnalysisTaskGenUeSpherocity(const AliAnalysisTaskGenUeSpherocity&);            // not implemented
 		AliAnalysisTaskGenUeSpherocity& operator=(const AliAnalysisTaskGenUeSpherocity&); // not implemented
 
-		ClassDef(AliAnalysisTaskGenUeSpherocity, 1);	// Analysis task for LF spectra analysis  
+		ClassDef(AliAnalysisTaskGenUeSpherocity, 2);	// Analysis task for LF spectra analysis  
 };
 
 #endif
@@ -77,6 +77,7 @@ ClassImp(AliAnalysisTaskUeRSpherocity)
 		fEventCuts(0x0),
 		fTrackFilter(0x0),
 		fSpheroUtils(0x0),
+		fUseExactSpherocity(kFALSE),
 		fAnalysisType("ESD"),
 		fListOfObjects(0x0),
 		fHistEventCounter(0x0),
@@ -108,6 +109,7 @@ AliAnalysisTaskUeRSpherocity::AliAnalysisTaskUeRSpherocity(const char *name):
 	fEventCuts(0x0),
 	fTrackFilter(0x0),
 	fSpheroUtils(0x0),
+	fUseExactSpherocity(kFALSE),
 	fAnalysisType("ESD"),
 	fListOfObjects(0x0),
 	fHistEventCounter(0x0),
@@ -159,6 +161,7 @@ void AliAnalysisTaskUeRSpherocity::UserCreateOutputObjects()
 	// Here we define the output: histograms and debug tree if requested 
 	if(!fSpheroUtils){
 		fSpheroUtils = new AliSpherocityUtils();
+		fSpheroUtils->SetUseExact(fUseExactSpherocity);
 		fSpheroUtils->Init();
 	}
 
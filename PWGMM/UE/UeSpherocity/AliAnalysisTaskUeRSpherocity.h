@@ -34,6 +34,7 @@ class AliAnalysisTaskUeRSpherocity : public AliAnalysisTaskSE {
 		virtual bool     MakeAnalysis( Int_t index_sample, Int_t index_leading, Double_t etaCut );
 		virtual void     SetAnalysisType(const char* analysisType) {fAnalysisType = analysisType;}
 		virtual void     SetPeriod(const TString period) {fdata_set = period;}
+		virtual void     SetUseExactSpherocity(Bool_t useexact) {fUseExactSpherocity = useexact;}
 
 		virtual void     SetTrackCuts(AliAnalysisFilter* fTrackFilter);
 		virtual Double_t DeltaPhi(Double_t phia, Double_t phib,
@@ -51,6 +52,7 @@ class AliAnalysisTaskUeRSpherocity : public AliAnalysisTaskSE {
 		AliEventCuts        fEventCuts;
 		AliAnalysisFilter*  fTrackFilter;
 		AliSpherocityUtils* fSpheroUtils;
+		Bool_t              fUseExactSpherocity; // exact spherocity instead of the step scan
 
 
 		TString       fAnalysisType;
@@ -70,7 +72,7 @@ class AliAnalysisTaskUeRSpherocity : public AliAnalysisTaskSE {
 
 		AliAnalysisTaskUeRSpherocity(const AliAnalysisTaskUeRSpherocity&);            // not implemented
 		AliAnalysisTaskUeRSpherocity& operator=(const AliAnalysisTaskUeRSpherocity&); // not implemented
-		ClassDef(AliAnalysisTaskUeRSpherocity, 11);    //Analysis task for high pt analysis 
+		ClassDef(AliAnalysisTaskUeRSpherocity, 12);    //Analysis task for high pt analysis 
 
 };
 
@@ -63,6 +63,7 @@ ClassImp(AliAnalysisTaskUeSpherocity)
 		fMC(0x0),
 		fMCStack(0x0),
 		fSpheroUtils(0x0),
+		fUseExactSpherocity(kFALSE),
 		fTrackFilter(0x0),
 		fAnalysisType("ESD"),
 		fAnalysisMC(kFALSE),
@@ -97,6 +98,7 @@ AliAnalysisTaskUeSpherocity::AliAnalysisTaskUeSpherocity(const char *name):
 	fMC(0x0),
 	fMCStack(0x0),
 	fSpheroUtils(0x0),
+	fUseExactSpherocity(kFALSE),
 	fTrackFilter(0x0),
 	fAnalysisType("ESD"),
 	fAnalysisMC(kFALSE),
@@ -155,6 +157,7 @@ void AliAnalysisTaskUeSpherocity::UserCreateOutputObjects()
 
 	if(!fSpheroUtils){
 		fSpheroUtils = new AliSpherocityUtils();
+		fSpheroUtils->SetUseExact(fUseExactSpherocity);
 		fSpheroUtils->Init();
 	}
 
@@ -36,6 +36,7 @@ class AliAnalysisTaskUeSpherocity : public AliAnalysisTaskSE {
 		virtual void     SetAnalysisType(const char* analysisType) {fAnalysisType = analysisType;}
 		virtual void     SetHisto(TH1D *hBining) {fSoBining = hBining;}
 		virtual void     SetAnalysisMC(Bool_t isMC) {fAnalysisMC = isMC;}
+		virtual void     SetUseExactSpherocity(Bool_t useexact) {fUseExactSpherocity = useexact;}
 
 		virtual Int_t    GetMultiplicityParticles(Double_t etaCut);
 		virtual Double_t GetSpheroPercentile( Double_t valES, Int_t valMult );
@@ -53,6 +54,7 @@ class AliAnalysisTaskUeSpherocity : public AliAnalysisTaskSE {
 		AliMCEvent*         fMC;
 		AliStack*           fMCStack;
 		AliSpherocityUtils* fSpheroUtils;
+		Bool_t              fUseExactSpherocity; // exact spherocity instead of the step scan
 		AliAnalysisFilter*  fTrackFilter;
 
 		TString       fAnalysisType;
@@ -80,7 +82,7 @@ class AliAnalysisTaskUeSpherocity : public AliAnalysisTaskSE {
 		TH1D   * hetaso;
 		TH1F   * fn1;
 
-		ClassDef(AliAnalysisTaskUeSpherocity, 11);    //Analysis task for high pt analysis 
+		ClassDef(AliAnalysisTaskUeSpherocity, 12);    //Analysis task for high pt analysis 
 
 };
 
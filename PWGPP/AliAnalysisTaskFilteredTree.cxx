@@ -43,6 +43,7 @@
 #include "TTreeStream.h"
 #include "TTree.h"
 #include "TH1F.h"
+#include "TH2F.h"
 #include "TH3.h"
 #include "TCanvas.h"
 #include "TList.h"
@@ -50,6 +51,7 @@
 #include "TFile.h"
 #include "TMatrixD.h"
 #include "TRandom3.h"
+#include "TROOT.h"
 
 #include "AliHeader.h"  
 #include "AliGenEventHeader.h"  
@@ -133,6 +135,11 @@ ClassImp(AliAnalysisTaskFilteredTree)
   , fSelectedTracksMask(0)   //! histogram of the selected tracks
   , fSelectedPIDMask(0)   //! histogram of the selected tracks
   , fSelectedV0Mask(0)       //! histogram of the selected V0s
+  , fStreamCounts(0)
+  , fNIMTThreads(0)
+  , fStreamBasketSize()
+  , fStreamAutoFlush()
+  , fStreamBufferApplied()
   , fPtResPhiPtTPC(0)
   , fPtResPhiPtTPCc(0)
   , fPtResPhiPtTPCITS(0)
@@ -209,6 +216,10 @@ void AliAnalysisTaskFilteredTree::UserCreateOutputObjects()
   //
   //get the output file to make sure the trees will be associated to it
   OpenFile(1);
+  if (fNIMTThreads>0) {
+    // baskets are compressed and written by the thread pool when the trees are flushed
+    ROOT::EnableImplicitMT(fNIMTThreads);
+  }
   fTreeSRedirector = new TTreeSRedirector();
 
   //
@@ -219,6 +230,8 @@ void AliAnalysisTaskFilteredTree::UserCreateOutputObjects()
   fLaserTree = ((*fTreeSRedirector)<<"Laser").GetTree();
   fMCEffTree = ((*fTreeSRedirector)<<"MCEffTree").GetTree();
   fCosmicPairsTree = ((*fTreeSRedirector)<<"CosmicPairs").GetTree();
+  fStreamBufferApplied.clear();
+  ApplyStreamBuffers();
 
   if (!fDummyTrack)  {
     fDummyTrack=new AliESDtrack();
@@ -278,6 +291,11 @@ void AliAnalysisTaskFilteredTree::UserCreateOutputObjects()
   fSelectedTracksMask=new TH1F("selectedTracksMask","selectedTracksMask",32,0,32);
   fSelectedPIDMask=new TH1F("selectedPIDMask","selectedPIDMask",32,0,32);
   fSelectedV0Mask=new TH1F("selectedV0Mask","selectedV0Mask",64,0,64);
+  fStreamCounts=new TH2F("streamCounts","downsampled and written entries per stream",kNStreams,0,kNStreams,2,0,2);
+  const char *streamNames[kNStreams]={"highPt","V0s","dEdx","Laser","MCEffTree","CosmicPairs"};
+  for (Int_t i=0; i<kNStreams; i++) fStreamCounts->GetXaxis()->SetBinLabel(i+1,streamNames[i]);
+  fStreamCounts->GetYaxis()->SetBinLabel(1,"downsampled");
+  fStreamCounts->GetYaxis()->SetBinLabel(2,"written");
 
   fPtResPhiPtTPC = new TH3D("fPtResPhiPtTPC","pt rel. resolution from cov. matrix TPC tracks",nbinsPt,binsPt,nbinsPhi,binsPhi,nbins1PtRes,bins1PtRes);
   fPtResPhiPtTPCc = new TH3D("fPtResPhiPtTPCc","pt rel. resolution from cov. matrix TPC constrained tracks",nbinsPt,binsPt,nbinsPhi,binsPhi,nbins1PtRes,bins1PtRes);
@@ -298,6 +316,7 @@ void AliAnalysisTaskFilteredTree::UserCreateOutputObjects()
   fOutput->Add(fSelectedTracksMask);
   fOutput->Add(fSelectedPIDMask);
   fOutput->Add(fSelectedV0Mask);
+  fOutput->Add(fStreamCounts);
 
 
   fOutput->Add(fPtResPhiPtTPC);
@@ -410,9 +429,53 @@ void AliAnalysisTaskFilteredTree::UserExec(Option_t *)
     //ProcessMC();  //TODO - enable MC detailed view switch after holidays
   }
   if (fProcessITSTPCmatchOut) ProcessITSTPCmatchOut(fESD, fESDfriend);
+  // branches of the streams are created with the first entry
+  if (fStreamBufferApplied.size()<fStreamBasketSize.size()+fStreamAutoFlush.size()) ApplyStreamBuffers();
   printf("processed event %d\n", Int_t(Entry()));
 }
 
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::SetStreamBuffer(const char *stream, Int_t basketSize, Long64_t autoFlushBytes)
+{
+  //
+  // basket size (<=0 - default) and auto flush in bytes (<=0 - default) of the stream
+  // bigger buffers keep more entries in memory, compressed in parallel at the flush if SetImplicitMT is used
+  //
+  if (basketSize>0) fStreamBasketSize[stream]=basketSize;
+  if (autoFlushBytes>0) fStreamAutoFlush[stream]=autoFlushBytes;
+}
+
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::ApplyStreamBuffers()
+{
+  //
+  // apply the buffer settings to the streams, the basket size only once the branches exist
+  //
+  if (!fTreeSRedirector) return;
+  for (std::map<std::string,Long64_t>::const_iterator it=fStreamAutoFlush.begin(); it!=fStreamAutoFlush.end(); ++it) {
+    std::string key="flush:"+it->first;
+    if (fStreamBufferApplied.count(key)) continue;
+    TTree *tree=((*fTreeSRedirector)<<it->first.c_str()).GetTree();
+    if (!tree) continue;
+    tree->SetAutoFlush(-it->second);
+    fStreamBufferApplied.insert(key);
+  }
+  for (std::map<std::string,Int_t>::const_iterator it=fStreamBasketSize.begin(); it!=fStreamBasketSize.end(); ++it) {
+    std::string key="basket:"+it->first;
+    if (fStreamBufferApplied.count(key)) continue;
+    TTree *tree=((*fTreeSRedirector)<<it->first.c_str()).GetTree();
+    if (!tree || tree->GetListOfBranches()->GetEntries()==0) continue;
+    tree->SetBasketSize("*",it->second);
+    fStreamBufferApplied.insert(key);
+  }
+}
+
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::CountStream(EStream stream, Bool_t written)
+{
+  if (fStreamCounts) fStreamCounts->Fill(stream, written);
+}
+
 //_____________________________________________________________________________
 void AliAnalysisTaskFilteredTree::ProcessCosmics(AliESDEvent *const event, AliESDfriend* esdFriend)
 {
@@ -543,6 +606,7 @@ void AliAnalysisTaskFilteredTree::ProcessCosmics(AliESDEvent *const event, AliES
       }
       if(!fFillTree) return;
       if(!fTreeSRedirector) return;
+      CountStream(kStreamCosmicPairs,kTRUE);
       (*fTreeSRedirector)<<"CosmicPairs"<<
         "gid="<<gid<<                         // global id of track
         "fileName.="<<&fCurrentFileName<<     // file name
@@ -734,7 +798,7 @@ void AliAnalysisTaskFilteredTree::Process(AliESDEvent *const esdEvent, AliMCEven
       Double_t weight=0;
       Int_t selectionPtMask=DownsampleTsalisCharged(track->Pt(), 1./fLowPtTrackDownscaligF, 1/fLowPtTrackDownscaligF, fSqrtS, fChargedEffectiveMass,&weight);
       fSelectedTracksMask->Fill(selectionPtMask);
-      if( downscaleCounter>0 && selectionPtMask==0) continue;
+      if( downscaleCounter>0 && selectionPtMask==0) { CountStream(kStreamHighPt,kFALSE); continue; }
 
       //printf("TMath::Exp(2*scalempt) %e, downscaleF %e \n",TMath::Exp(2*scalempt), downscaleF);
 
@@ -754,6 +818,7 @@ void AliAnalysisTaskFilteredTree::Process(AliESDEvent *const esdEvent, AliMCEven
       if(!fFillTree) return;
       if(!fTreeSRedirector) return;
       downscaleCounter++;
+      CountStream(kStreamHighPt,kTRUE);
       (*fTreeSRedirector)<<"highPt"<<
         "gid="<<gid<<
         "selectionPtMask="<<selectionPtMask<<
@@ -811,7 +876,8 @@ void AliAnalysisTaskFilteredTree::ProcessLaser(AliESDEvent *const esdEvent, AliM
       // suppress beam background and CE random reacks
       if (track->GetInnerParam()->Pt()<kMinPt) continue;
       Bool_t skipTrack=gRandom->Rndm()>1/(1+TMath::Abs(fFriendDownscaling));
-      if (skipTrack) continue;
+      if (skipTrack) { CountStream(kStreamLaser,kFALSE); continue; }
+      CountStream(kStreamLaser,kTRUE);
       if (esdFriend) {if (!esdFriend->TestSkipBit()) friendTrack = (AliESDfriendTrack*)track->GetFriendTrack();} //this guy can be NULL      
       (*fTreeSRedirector)<<"Laser"<<
         "gid="<<gid<<                          // global identifier of event
@@ -1055,7 +1121,7 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
       Int_t selectionPIDMask=PIDSelection(track, particle);
       fSelectedTracksMask->Fill(selectionPtMask);
       fSelectedPIDMask->Fill(selectionPIDMask);
-      if( downscaleCounter>0 && selectionPtMask==0 && selectionPIDMask==0) continue;
+      if( downscaleCounter>0 && selectionPtMask==0 && selectionPIDMask==0) { CountStream(kStreamHighPt,kFALSE); continue; }
 
       //printf("TMath::Exp(2*scalempt) %e, downscaleF %e \n",TMath::Exp(2*scalempt), downscaleF);
 
@@ -1632,7 +1698,8 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
               "isFromMaterialITS="<<isFromMaterialITS;
           }
           //finish writing the entry
-          AliInfo("writing tree highPt");
+          AliDebug(1,"writing tree highPt");
+          CountStream(kStreamHighPt,kTRUE);
           (*fTreeSRedirector)<<"highPt"<<"\n";
         }
         //AliSysInfo::AddStamp("filteringTask",iTrack,numberOfTracks,numberOfFriendTracks,(friendTrackStore)?0:1);
@@ -1819,7 +1886,7 @@ void AliAnalysisTaskFilteredTree::ProcessMCEff(AliESDEvent *const esdEvent, AliM
       // downscale low-pT particles
       Double_t weight=0;
       Int_t selectionPtMaskMC=DownsampleTsalisCharged(particle->Pt(), 2./fLowPtTrackDownscaligF, 2./fLowPtTrackDownscaligF, fSqrtS, particle->GetMass(),&weight);
-      if (selectionPtMaskMC==0) continue;
+      if (selectionPtMaskMC==0) { CountStream(kStreamMCEff,kFALSE); continue; }
       // is particle in acceptance
       if(!accCuts->AcceptTrack(particle)) continue;
 
@@ -1889,6 +1956,7 @@ void AliAnalysisTaskFilteredTree::ProcessMCEff(AliESDEvent *const esdEvent, AliM
       //
       if(fTreeSRedirector && fFillTree) {
 	downscaleCounter++;
+        CountStream(kStreamMCEff,kTRUE);
         (*fTreeSRedirector)<<"MCEffTree"<<
           "fileName.="<<&fCurrentFileName<<
           "gid="<<gid<<                             // global iD to correlate with event properties
@@ -2128,7 +2196,7 @@ void AliAnalysisTaskFilteredTree::ProcessV0(AliESDEvent *const esdEvent, AliMCEv
       Double_t weight=0;
       Int_t selectionPtMask=V0DownscaledMask(v0,&weight);
       fSelectedV0Mask->Fill(selectionPtMask);
-      if( downscaleCounter>0 && selectionPtMask==0) continue;
+      if( downscaleCounter>0 && selectionPtMask==0) { CountStream(kStreamV0s,kFALSE); continue; }
 
       AliKFParticle kfparticle; //
       Int_t type=GetKFParticle(v0,esdEvent,kfparticle);
@@ -2177,6 +2245,7 @@ void AliAnalysisTaskFilteredTree::ProcessV0(AliESDEvent *const esdEvent, AliMCEv
         if (fESDtool->IsPileup(track0->GetLabel())) isPileUpMC+=1;
         if (fESDtool->IsPileup(track1->GetLabel())) isPileUpMC+=2;
       }
+      CountStream(kStreamV0s,kTRUE);
       (*fTreeSRedirector)<<"V0s"<<
                          "gid="<<gid<<                         //  global id of event
                          "fLowPtV0DownscaligF="<<fLowPtV0DownscaligF<<
@@ -2336,6 +2405,7 @@ void AliAnalysisTaskFilteredTree::ProcessdEdx(AliESDEvent *const esdEvent, AliMC
       }
 	
       downscaleCounter++;
+      CountStream(kStreamdEdx,kTRUE);
       (*fTreeSRedirector)<<"dEdx"<<           // high dEdx tree
         "gid="<<gid<<                         // global id
         "fileName.="<<&fCurrentFileName<<     // file name
@@ -2782,6 +2852,12 @@ void AliAnalysisTaskFilteredTree::FinishTaskOutput()
         AliAnalysisManager::kProofAnalysis)
       deleteTrees=kFALSE;
   }
+  if (fStreamCounts) {
+    for (Int_t i=1; i<=kNStreams; i++) {
+      AliInfo(Form("stream %s: %.0f entries written, %.0f downsampled",fStreamCounts->GetXaxis()->GetBinLabel(i),
+                   fStreamCounts->GetBinContent(i,2),fStreamCounts->GetBinContent(i,1)));
+    }
+  }
   if (deleteTrees) delete fTreeSRedirector;
   fTreeSRedirector=NULL;
 }
@@ -22,6 +22,11 @@
    3.) "Laser"      - dump laser tracks with space points if exists
    4.) "CosmicTree" - cosmic track candidate (random or triggered) + esdTracks(up/down)+ optional points
    5.) "dEdx"       - tree with high dEdx tpc tracks
+
+   Output tuning:
+     SetImplicitMT(n)           - baskets of the trees are compressed and written by a pool of n threads
+     SetStreamBuffer(name,...)  - basket size and auto flush (in memory buffering) per stream
+   The number of downsampled and written entries per stream are stored in the "streamCounts" histogram
 */
 class AliESDEvent;
 class AliMCEvent;
@@ -43,9 +48,12 @@ class TObjArray;
 class TTree;
 class TTreeSRedirector;
 class TParticle;
+class TH2F;
 class TH3D;
 class AliESDtools;
 #include <string>
+#include <map>
+#include <set>
 
 #include "AliTriggerAnalysis.h"
 #include "AliAnalysisTaskSE.h"
@@ -57,6 +65,7 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   enum EAnalysisMode { kInvalidAnalysisMode=-1,
                       kTPCITSAnalysisMode=0,
                       kTPCAnalysisMode=1 };
+  enum EStream { kStreamHighPt=0, kStreamV0s, kStreamdEdx, kStreamLaser, kStreamMCEff, kStreamCosmicPairs, kNStreams };
 
   AliAnalysisTaskFilteredTree(const char *name = "AliAnalysisTaskFilteredTree");
   virtual ~AliAnalysisTaskFilteredTree();
@@ -131,6 +140,8 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
 
   void SetFillTrees(Bool_t filltree) { fFillTree = filltree ;}
   Bool_t GetFillTrees() { return fFillTree ;}
+  void SetImplicitMT(Int_t nThreads) { fNIMTThreads = nThreads; }
+  void SetStreamBuffer(const char *stream, Int_t basketSize, Long64_t autoFlushBytes=0);
 
   void FillHistograms(AliESDtrack* const ptrack, AliExternalTrackParam* const ptpcInnerC, Double_t centralityF, Double_t chi2TPCInnerC);
   Int_t   GetNearestTrack(const AliExternalTrackParam * trackMatch, Int_t indexSkip, AliESDEvent*event, Int_t trackType, Int_t paramType,  AliExternalTrackParam & paramNearest);
@@ -146,6 +157,9 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   static Int_t    DownsampleTsalisCharged(Double_t pt, Double_t factorPt, Double_t factor1Pt,  Double_t sqrts, Double_t mass, Double_t *weight);
   Int_t  PIDSelection(AliESDtrack *track, TParticle *particle = nullptr);
  private:
+  void CountStream(EStream stream, Bool_t written);
+  void ApplyStreamBuffers();
+
   AliESDEvent *fESD;    //! ESD event
   AliMCEvent *fMC;      //! MC event
   AliESDfriend *fESDfriend; //! ESDfriend event
@@ -188,6 +202,11 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   TH1F * fSelectedTracksMask;   //! histogram of the selected tracks
   TH1F * fSelectedPIDMask;   //! histogram of the selected tracks
   TH1F * fSelectedV0Mask;   //! histogram of the selected tracks
+  TH2F * fStreamCounts;     //! downsampled and written entries per stream
+  Int_t fNIMTThreads;       // number of threads for the basket compression, 0 - synchronous writing
+  std::map<std::string,Int_t> fStreamBasketSize;    // basket size per stream
+  std::map<std::string,Long64_t> fStreamAutoFlush;  // auto flush bytes per stream
+  std::set<std::string> fStreamBufferApplied;       //! streams with the buffer settings applied
 
   TH3D* fPtResPhiPtTPC;    //! sigma(pt)/pt vs Phi vs Pt for prim. TPC tracks
   TH3D* fPtResPhiPtTPCc;   //! sigma(pt)/pt vs Phi vs Pt for prim. TPC contrained to vertex tracks
@@ -205,7 +224,7 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
 
   AliAnalysisTaskFilteredTree(const AliAnalysisTaskFilteredTree&); // not implemented
   AliAnalysisTaskFilteredTree& operator=(const AliAnalysisTaskFilteredTree&); // not implemented
-  ClassDef(AliAnalysisTaskFilteredTree, 1); // example of analysis
+  ClassDef(AliAnalysisTaskFilteredTree, 2); // example of analysis
 };
 
 #endif
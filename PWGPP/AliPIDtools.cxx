@@ -7,6 +7,9 @@
 #include "AliPIDtools.h"
 #include "TLeaf.h"
 #include "TSystem.h"
+#include "TMath.h"
+#include "TRandom.h"
+#include <vector>
 
 std::map<Int_t, AliTPCPIDResponse *> AliPIDtools::pidTPC;     /// we should use better hash map
 std::map<Int_t, AliPIDResponse *> AliPIDtools::pidAll;        /// we should use better hash map
@@ -26,16 +29,135 @@ Int_t AliPIDtools::GetHash(Int_t run, Int_t passNumber, TString recoPass,Bool_t
   return recoPass.Hash();
 }
 
+namespace {
+  /// Bethe-Bloch of one PID hash tabulated in log(bg), cubic (Catmull-Rom) interpolation
+  struct BetheTable {
+    AliTPCPIDResponse *fTPCPID;   // response the table was made from
+    Double_t fLogMin;             // log(bg) of the first node
+    Double_t fLogMax;             // log(bg) of the last node
+    Double_t fInvStep;            // 1/node distance
+    std::vector<Double_t> fNodes; // Bethe at the nodes
+    Double_t Eval(Double_t bg) const;
+  };
+
+  Double_t BetheTable::Eval(Double_t bg) const {
+    Double_t t = (TMath::Log(bg)-fLogMin)*fInvStep;
+    const Int_t nNodes = fNodes.size();
+    Int_t i = Int_t(t);
+    if (i>nNodes-2) i=nNodes-2;
+    t -= i;
+    const Double_t *y = &fNodes[i];
+    const Double_t y0 = (i>0) ? y[-1] : 2*y[0]-y[1];
+    const Double_t y3 = (i<nNodes-2) ? y[2] : 2*y[1]-y[0];
+    return y[0]+0.5*t*(y[1]-y0+t*(2*y0-5*y[0]+4*y[1]-y3+t*(3*(y[0]-y[1])+y3-y0)));
+  }
+
+  std::map<Int_t, BetheTable> gBetheTables;              // tables per hash
+  thread_local Int_t gLastHash = 0;                      // last hash used in the thread
+  thread_local const BetheTable *gLastTable = nullptr;   // its table
+
+  const BetheTable *GetBetheTable(Int_t hash) {
+    if (gLastTable && gLastHash==hash) return gLastTable;
+    if (gBetheTables.empty()) return nullptr;
+    std::map<Int_t, BetheTable>::const_iterator it = gBetheTables.find(hash);
+    gLastHash = hash;
+    gLastTable = (it==gBetheTables.end()) ? nullptr : &it->second;
+    return gLastTable;
+  }
+}
+
+/// Bethe-Bloch of the TPC for given beta*gamma, tabulated if MakeBetheTable was called for the hash
 Double_t AliPIDtools::BetheBlochAleph(Int_t hash, Double_t bg){
+  const BetheTable *table=GetBetheTable(hash);
+  if (table) {
+    const Double_t logBg=(bg>0) ? TMath::Log(bg) : table->fLogMin-1;
+    if (logBg>=table->fLogMin && logBg<=table->fLogMax) return table->Eval(bg);
+    return table->fTPCPID->Bethe(bg);
+  }
   AliTPCPIDResponse *tpcPID=pidTPC[hash];
   if (tpcPID) return tpcPID->Bethe(bg);
   return 0;
 }
 Double_t AliPIDtools::BetheBlochAleph(Int_t hash, Double_t p,Int_t type){
-  AliTPCPIDResponse *tpcPID=pidTPC[hash];
   Float_t bg = p/AliPID::ParticleMass(type);
-  if (tpcPID) return tpcPID->Bethe(bg);
-  return 0;
+  return BetheBlochAleph(hash,bg);
+}
+
+/// Batch evaluation of BetheBlochAleph(hash, bg[i]) for n values
+/// \param hash   - hash value
+/// \param n      - number of values
+/// \param bg     - beta*gamma
+/// \param dEdx   - output, n values
+void AliPIDtools::BetheBlochAleph(Int_t hash, Int_t n, const Double_t *bg, Double_t *dEdx){
+  const BetheTable *table=GetBetheTable(hash);
+  AliTPCPIDResponse *tpcPID=table ? table->fTPCPID : pidTPC[hash];
+  if (!tpcPID) {
+    for (Int_t i=0; i<n; i++) dEdx[i]=0;
+    return;
+  }
+  if (!table) {
+    for (Int_t i=0; i<n; i++) dEdx[i]=tpcPID->Bethe(bg[i]);
+    return;
+  }
+  const Double_t bgMin=TMath::Exp(table->fLogMin), bgMax=TMath::Exp(table->fLogMax);
+  for (Int_t i=0; i<n; i++) {
+    dEdx[i]=(bg[i]>=bgMin && bg[i]<=bgMax) ? table->Eval(bg[i]) : tpcPID->Bethe(bg[i]);
+  }
+}
+
+/// Tabulate the TPC Bethe-Bloch of the hash in log(bg) - the number of nodes is doubled
+/// until the interpolation between the nodes deviates less than tolerance (relative) from the exact function
+/// \param hash        - hash value
+/// \param tolerance   - maximal relative deviation
+/// \param bgMin       - table range, outside the exact function is used
+/// \param bgMax
+/// \return            - number of nodes, 0 if the PID of the hash is not loaded
+Int_t AliPIDtools::MakeBetheTable(Int_t hash, Double_t tolerance, Double_t bgMin, Double_t bgMax){
+  AliTPCPIDResponse *tpcPID=pidTPC[hash];
+  if (tpcPID==nullptr || bgMin<=0 || bgMax<=bgMin) return 0;
+  const Int_t kMaxNodes=1<<20;
+  BetheTable table;
+  table.fTPCPID=tpcPID;
+  table.fLogMin=TMath::Log(bgMin);
+  table.fLogMax=TMath::Log(bgMax);
+  Double_t maxDelta=0;
+  for (Int_t nNodes=64; nNodes<=kMaxNodes; nNodes*=2) {
+    const Double_t step=(table.fLogMax-table.fLogMin)/(nNodes-1);
+    table.fInvStep=1./step;
+    table.fNodes.resize(nNodes);
+    for (Int_t i=0; i<nNodes; i++) table.fNodes[i]=tpcPID->Bethe(TMath::Exp(table.fLogMin+i*step));
+    // check at the middle and at quarter of the intervals
+    maxDelta=0;
+    for (Int_t i=0; i<(nNodes-1)*4; i++) {
+      if (i%4==0) continue;
+      const Double_t bg=TMath::Exp(table.fLogMin+0.25*i*step);
+      const Double_t exact=tpcPID->Bethe(bg);
+      if (exact!=0) maxDelta=TMath::Max(maxDelta,TMath::Abs(table.Eval(bg)/exact-1));
+    }
+    if (maxDelta<tolerance) break;
+  }
+  if (maxDelta>=tolerance) ::Warning("AliPIDtools::MakeBetheTable","hash %d: relative deviation %g above tolerance %g",hash,maxDelta,tolerance);
+  gBetheTables[hash]=table;
+  gLastTable=nullptr;
+  return table.fNodes.size();
+}
+
+/// Maximal relative deviation of the tabulated from the exact Bethe-Bloch at nPoints random points of the table range
+Double_t AliPIDtools::ValidateBetheTable(Int_t hash, Int_t nPoints){
+  const BetheTable *table=GetBetheTable(hash);
+  if (!table) return -1;
+  Double_t maxDelta=0;
+  for (Int_t i=0; i<nPoints; i++) {
+    const Double_t bg=TMath::Exp(table->fLogMin+gRandom->Rndm()*(table->fLogMax-table->fLogMin));
+    const Double_t exact=table->fTPCPID->Bethe(bg);
+    if (exact!=0) maxDelta=TMath::Max(maxDelta,TMath::Abs(table->Eval(bg)/exact-1));
+  }
+  return maxDelta;
+}
+
+void AliPIDtools::RemoveBetheTable(Int_t hash){
+  gBetheTables.erase(hash);
+  gLastTable=nullptr;
 }
 
 ///  AliPIDtools::BetheBlochITS
@@ -18,6 +18,12 @@
 ///  fPionToKaon->SetLineColor(4);
 ///  fPionToProton1P->Draw(); fPionToKaon1P->Draw("same");
 /// \endcode
+/// #### Example 2b: tabulated Bethe-Bloch for large trees, relative accuracy 1e-5 in 0.1<bg<1e4
+/// \code
+///  AliPIDtools::MakeBetheTable(hash,1e-5);
+///  AliPIDtools::ValidateBetheTable(hash);  // maximal relative deviation from the exact function
+///  tree->Draw(Form("AliPIDtools::BetheBlochAleph(%d,p/0.13957)",hash));
+/// \endcode
 /// #### Example 3: Draw Expected dEdx
 /// AliPIDtools::SetFilteredTreeV0(treeV0)
 /// treeV0->Draw("log(track0.fTPCsignal/(AliPIDtools::GetExpectedTPCSignalV0(pidHash,0,0x1,0)))","type==1&&abs(log(track1.fTPCsignal/(AliPIDtools::GetExpectedTPCSignalV0(pidHash,0,0x1,1))))<0.1","colz",20000)
@@ -43,7 +49,11 @@ public:
   //
   static Double_t BetheBlochAleph(Int_t hash, Double_t bg);
   static Double_t BetheBlochAleph(Int_t hash, Double_t p, Int_t type);
+  static void     BetheBlochAleph(Int_t hash, Int_t n, const Double_t *bg, Double_t *dEdx);
   static Double_t BetheBlochITS(Int_t hash, Double_t p, Double_t mass);
+  static Int_t    MakeBetheTable(Int_t hash, Double_t tolerance=1e-5, Double_t bgMin=0.1, Double_t bgMax=1e4);
+  static Double_t ValidateBetheTable(Int_t hash, Int_t nPoints=100000);
+  static void     RemoveBetheTable(Int_t hash);
   static Double_t GetExpectedTPCSignal(Int_t hash, Double_t p, Int_t  particle);
   static Double_t GetExpectedITSSignal(Int_t hash, Double_t p, Int_t  particle);
   static Double_t GetExpectedTOFSigma(Int_t hash, Float_t mom, Int_t type);
@@ -69,6 +69,7 @@ fSelectedPdg(-1),
 fUseDiamond(kFALSE),
 fUseRecoVertex(kFALSE),
 fSkipTrack(kTRUE),
+fBatchedVertexRefit(kFALSE),
 fMinMult(0),
 fMaxMult(1000000),
 fCheckSDDIsIn(0),
@@ -140,6 +141,7 @@ fSelectedPdg(-1),
 fUseDiamond(kFALSE),
 fUseRecoVertex(kFALSE),
 fSkipTrack(kTRUE),
+fBatchedVertexRefit(kFALSE),
 fMinMult(0),
 fMaxMult(1000000),
 fCheckSDDIsIn(0),
@@ -927,24 +929,29 @@ void AliAnalysisTaskSEImpParResSparse::UserExec(Option_t */*option*/)
 	}
 
 
-        //Get specific primary vertex--Reconstructed primary vertex do not include the track considering.
-        AliVertexerTracks vertexer(event->GetMagneticField());
-        vertexer.SetITSMode();
-        //if (fTrackType==1) vertexer.SetITSpureSA(kTRUE);
-        vertexer.SetMinClusters(3);
-        if(fUseDiamond){
-            Float_t diamondcovxy[3];
-            event->GetDiamondCovXY(diamondcovxy);
-            Double_t pos[3]={event->GetDiamondX(),event->GetDiamondY(),0.};
-            Double_t cov[6]={diamondcovxy[0],diamondcovxy[1],diamondcovxy[2],0.,0.,10.};
-            AliESDVertex diamond(pos,cov,1.,1);
-            vertexer.SetVtxStart(&diamond);
-        }
-        skipped[0] = (Int_t)vtrack->GetID();
-        vertexer.SetSkipTracks(1,skipped);
         // create vertex with new!
         if(!highMult && fSkipTrack) {
-            vtxVSkip = (AliVVertex*)vertexer.FindPrimaryVertex(event);
+            delete vtxVSkip; vtxVSkip=NULL;
+            if(fBatchedVertexRefit) {
+                vtxVSkip = (AliVVertex*)RemoveTrackFromVertex(vertexer0,(AliESDVertex*)vtxVRec,vtrack,event);
+            } else {
+                //Get specific primary vertex--Reconstructed primary vertex do not include the track considering.
+                AliVertexerTracks vertexer(event->GetMagneticField());
+                vertexer.SetITSMode();
+                //if (fTrackType==1) vertexer.SetITSpureSA(kTRUE);
+                vertexer.SetMinClusters(3);
+                if(fUseDiamond){
+                    Float_t diamondcovxy[3];
+                    event->GetDiamondCovXY(diamondcovxy);
+                    Double_t pos[3]={event->GetDiamondX(),event->GetDiamondY(),0.};
+                    Double_t cov[6]={diamondcovxy[0],diamondcovxy[1],diamondcovxy[2],0.,0.,10.};
+                    AliESDVertex diamond(pos,cov,1.,1);
+                    vertexer.SetVtxStart(&diamond);
+                }
+                skipped[0] = (Int_t)vtrack->GetID();
+                vertexer.SetSkipTracks(1,skipped);
+                vtxVSkip = (AliVVertex*)vertexer.FindPrimaryVertex(event);
+            }
             if(!vtxVSkip) {/*Printf("VERTEX SKIP NOT FOUND");*/ continue;}
             if(vtxVSkip->GetNContributors()<1) {
                 delete vtxVSkip; vtxVSkip=NULL;
@@ -1351,6 +1358,26 @@ Bool_t AliAnalysisTaskSEImpParResSparse::IsTrackSelected(AliVTrack *track, AliVV
     return retval;
 }
 //----------------------------------------------------------------------------------
+AliESDVertex* AliAnalysisTaskSEImpParResSparse::RemoveTrackFromVertex(AliVertexerTracks &vertexer, AliESDVertex *vtx, AliVTrack *track, const AliVEvent *event) const {
+    //
+    // Primary vertex without the track, obtained by removing its contribution
+    // from the position and covariance of the event vertex fit
+    // (the vertex is unchanged for tracks which are not contributors)
+    //
+    Int_t id=(Int_t)track->GetID();
+    if(id<0 || !vtx->UsesTrack(id)) return new AliESDVertex(*vtx);
+
+    TObjArray rmArray(1);
+    AliESDtrack *esdTrack = fIsAOD ? new AliESDtrack(track) : 0;
+    rmArray.AddLast(esdTrack ? esdTrack : track);
+    UShort_t rmId[1]={(UShort_t)id};
+    Float_t diamondxy[2]={static_cast<Float_t>(event->GetDiamondX()),static_cast<Float_t>(event->GetDiamondY())};
+    AliESDVertex *vtxSkip = vertexer.RemoveTracksFromVertex(vtx,&rmArray,rmId,diamondxy);
+    delete esdTrack;
+
+    return vtxSkip;
+}
+//----------------------------------------------------------------------------------
 void AliAnalysisTaskSEImpParResSparse::ConfigurePtWeights(){
     
     if(fUseptWeights==0){ // no weights
@@ -18,7 +18,9 @@ class TH1D;
 class AliTriggerConfiguration;
 class AliVTrack;
 class AliVVertex;
+class AliESDVertex;
 class AliESDtrackCuts;
+class AliVertexerTracks;
 
 
 #include "AliAnalysisTaskSE.h"
@@ -46,6 +48,9 @@ class AliAnalysisTaskSEImpParResSparse : public AliAnalysisTaskSE {
   void SetUseDiamond(Bool_t use=kFALSE) { fUseDiamond=use; return; }
   void SetUseRecoVertex(Bool_t use=kFALSE) { fUseRecoVertex=use; return; }
   void SetSkipTrack(Bool_t skip=kFALSE) { fSkipTrack=skip; return; }
+  // with fSkipTrack, remove the track from the event vertex using its covariance
+  // instead of running the vertexer again for each track
+  void SetBatchedVertexRefit(Bool_t batched=kTRUE) { fBatchedVertexRefit=batched; return; }
   void SetMultiplicityRange(Int_t min,Int_t max) { fMinMult=min; fMaxMult=max; }
   void SetCheckSDDIsIn(Int_t check=0) { fCheckSDDIsIn=check; }
   void SetTriggerClass(TString tclass="") { fTriggerClass=tclass; }
@@ -111,12 +116,14 @@ class AliAnalysisTaskSEImpParResSparse : public AliAnalysisTaskSE {
   Int_t PhiBin(Double_t phi, Bool_t usefinebinsphi=kFALSE) const; // mfaggin (added a new argument)
   Int_t ClusterTypeOnITSLayer(AliESDtrack *t,Int_t layer) const;
   Bool_t IsTrackSelected(AliVTrack *t,AliVVertex *v, AliESDtrackCuts *cuts, const AliVEvent* aod) const;
+  AliESDVertex* RemoveTrackFromVertex(AliVertexerTracks &vertexer, AliESDVertex *vtx, AliVTrack *t, const AliVEvent *event) const;
   Bool_t fIsAOD;  // flag to read AOD or ESD (default is ESD)
   Bool_t fReadMC;       // flag used to switch on/off MC reading
   Int_t  fSelectedPdg;  // only for a given particle species (-1 takes all tracks)
   Bool_t fUseDiamond;   // use diamond constraint in primary vertex
   Bool_t fUseRecoVertex;   // use reco vertex also when reading MC
   Bool_t fSkipTrack;    // redo primary vertex for each track
+  Bool_t fBatchedVertexRefit; // primary vertex without the track from the event vertex fit
   Int_t  fMinMult; // minimum multiplicity
   Int_t  fMaxMult; // maximum multiplicity
   Int_t  fCheckSDDIsIn; // check for ITSSDD in the trigger cluster: 0 no check; !=0 check from OCDB
@@ -184,7 +191,7 @@ class AliAnalysisTaskSEImpParResSparse : public AliAnalysisTaskSE {
   Bool_t fUseOnlyPrimPartMC;  ///
 
                                              // mfaggin (number 9 inserted)
-  ClassDef(AliAnalysisTaskSEImpParResSparse,10); // AliAnalysisTaskSE for the study of the impact parameter resolution
+  ClassDef(AliAnalysisTaskSEImpParResSparse,11); // AliAnalysisTaskSE for the study of the impact parameter resolution
 };
 
 #endif
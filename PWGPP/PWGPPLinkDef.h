@@ -147,6 +147,7 @@
 //TPC PID calibration and QA
 #pragma link C++ class  AliTPCPIDBase+;
 #pragma link C++ class  AliTPCPIDEtaTree+;
+#pragma link C++ class  AliTPCdEdxCorrectionGrid+;
 #pragma link C++ class  AliTPCPIDEtaQA+;
 #pragma link C++ class  AliTPCcalibResidualPID+;
 #pragma link C++ class  AliTPCcalibResidualPID_Modified+;
@@ -167,7 +167,7 @@ void AliPerformanceDCA::ProcessTPC(AliMCEvent* const mcev, AliVTrack *const vTra
   if (vTrack->GetTPCNcls()<fCutsRC.GetMinNClustersTPC()) return; // min. nb. TPC clusters  
  
 Double_t vDCAHisto[5]={dca[0],dca[1],etpTrack->Eta(),etpTrack->Pt(),etpTrack->Phi()};
-  fDCAHisto->Fill(vDCAHisto);
+  FillSparse(fDCAHisto,vDCAHisto);
 
   //
   // Fill rec vs MC information
@@ -209,7 +209,7 @@ void AliPerformanceDCA::ProcessTPCITS(AliMCEvent* const mcev, AliVTrack *const v
   if(vTrack->GetITSclusters(0)<fCutsRC.GetMinNClustersITS()) return;  // min. nb. ITS clusters
 
   Double_t vDCAHisto[5]={dca[0],dca[1],vTrack->Eta(),vTrack->Pt(),vTrack->Phi()};
-  fDCAHisto->Fill(vDCAHisto);
+  FillSparse(fDCAHisto,vDCAHisto);
 
   //
   // Fill rec vs MC information
@@ -236,6 +236,8 @@ Long64_t AliPerformanceDCA::Merge(TCollection* const list)
   if (list->IsEmpty())
   return 1;
 
+  FlushSparse();
+
   TIterator* iter = list->MakeIterator();
   TObject* obj = 0;
 
@@ -245,6 +247,7 @@ Long64_t AliPerformanceDCA::Merge(TCollection* const list)
   {
     AliPerformanceDCA* entry = dynamic_cast<AliPerformanceDCA*>(obj);
     if (entry == 0) continue; 
+    entry->FlushSparse();
 
     fDCAHisto->Add(entry->fDCAHisto);
     count++;
@@ -332,6 +335,9 @@ void AliPerformanceDCA::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent,
 //_____________________________________________________________________________
 void AliPerformanceDCA::Analyse()
 {
+  // the staged fills go into the THnSparse before projecting
+  FlushSparse();
+
   //
   // Analyse comparison information and store output histograms
   // in the analysis folder "folderDCA" 
@@ -304,7 +304,7 @@ void AliPerformanceDEdx::ProcessInnerTPC(AliMCEvent* const mcev, AliVTrack *cons
     
     //Double_t vDeDxHisto[10] = {dedx,phi,y,z,snp,tgl,ncls,p,TPCSignalN,nCrossedRows};
     Double_t vDeDxHisto[10] = {dedx,phi,y,z,snp,tgl,Double_t(ncls),p,Double_t(TPCSignalN),nClsF};
-    if(fUseSparse) fDeDxHisto->Fill(vDeDxHisto);
+    if(fUseSparse) FillSparse(fDeDxHisto,vDeDxHisto);
     else  FilldEdxHisotgram(vDeDxHisto);
     
     if(!mcev) return;
@@ -336,6 +336,8 @@ Long64_t AliPerformanceDEdx::Merge(TCollection* const list)
 
   if (list->IsEmpty())
   return 1;
+
+  FlushSparse();
   
   Bool_t merge = ((fgUseMergeTHnSparse && fgMergeTHnSparse) || (!fgUseMergeTHnSparse && fMergeTHnSparseObj));
 
@@ -350,6 +352,7 @@ Long64_t AliPerformanceDEdx::Merge(TCollection* const list)
   {
     AliPerformanceDEdx* entry = dynamic_cast<AliPerformanceDEdx*>(obj);
     if (entry == 0) continue; 
+    entry->FlushSparse();
     if (merge) {
         if ((fDeDxHisto) && (entry->fDeDxHisto)) { fDeDxHisto->Add(entry->fDeDxHisto); }        
     }
@@ -459,6 +462,9 @@ void AliPerformanceDEdx::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent
 //_____________________________________________________________________________
 void AliPerformanceDEdx::Analyse()
 {
+  // the staged fills go into the THnSparse before projecting
+  FlushSparse();
+
   
   // Analyze comparison information and store output histograms
   // in the folder "folderDEdx"
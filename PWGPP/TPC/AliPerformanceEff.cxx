@@ -326,7 +326,7 @@ void AliPerformanceEff::ProcessTPC(AliMCEvent* const mcEvent, AliVEvent *const v
 
     // Fill histograms
     Double_t vEffHisto[9] = {mceta, mcphi, mcpt, static_cast<Double_t>(pid), static_cast<Double_t>(recStatus), static_cast<Double_t>(findable), static_cast<Double_t>(charge), static_cast<Double_t>(nClones), static_cast<Double_t>(nFakes)}; 
-    fEffHisto->Fill(vEffHisto);
+    FillSparse(fEffHisto,vEffHisto);
   }
   if(labelsRec) delete [] labelsRec; labelsRec = 0;
   if(labelsAllRec) delete [] labelsAllRec; labelsAllRec = 0;
@@ -488,7 +488,7 @@ void AliPerformanceEff::ProcessTPCSec(AliMCEvent* const mcEvent, AliVEvent *cons
 	
 	// Fill histograms
 	Double_t vEffSecHisto[12] = { mceta, mcphi, mcpt, static_cast<Double_t>(pid), static_cast<Double_t>(recStatus), static_cast<Double_t>(findable), mcR, mother_phi, mother_eta, static_cast<Double_t>(charge), static_cast<Double_t>(nClones), static_cast<Double_t>(nFakes) }; 
-	fEffSecHisto->Fill(vEffSecHisto);
+	FillSparse(fEffSecHisto,vEffSecHisto);
       }
   }
   
@@ -595,7 +595,7 @@ void AliPerformanceEff::ProcessTPCITS(AliMCEvent* const mcEvent, AliVEvent *cons
     
     // Fill histograms
     Double_t vEffHisto[9] = { mceta, mcphi, mcpt, static_cast<Double_t>(pid), static_cast<Double_t>(recStatus), static_cast<Double_t>(findable), static_cast<Double_t>(charge), static_cast<Double_t>(nClones), static_cast<Double_t>(nFakes)}; 
-    fEffHisto->Fill(vEffHisto);
+    FillSparse(fEffHisto,vEffHisto);
   }
 
   if(labelsRecTPCITS) delete [] labelsRecTPCITS; labelsRecTPCITS = 0;
@@ -697,7 +697,7 @@ void AliPerformanceEff::ProcessConstrained(AliMCEvent* const mcEvent, AliVEvent
 
     // Fill histograms
     Double_t vEffHisto[9] = { mceta, mcphi, mcpt, static_cast<Double_t>(pid), static_cast<Double_t>(recStatus), static_cast<Double_t>(findable), static_cast<Double_t>(charge), static_cast<Double_t>(nClones), static_cast<Double_t>(nFakes) }; 
-    fEffHisto->Fill(vEffHisto);
+    FillSparse(fEffHisto,vEffHisto);
   }
 
   if(labelsRecConstrained) delete [] labelsRecConstrained; labelsRecConstrained = 0;
@@ -888,6 +888,8 @@ Long64_t AliPerformanceEff::Merge(TCollection* const list)
   if (list->IsEmpty())
   return 1;
 
+  FlushSparse();
+
   TIterator* iter = list->MakeIterator();
   TObject* obj = 0;
 
@@ -898,6 +900,7 @@ Long64_t AliPerformanceEff::Merge(TCollection* const list)
   {
     AliPerformanceEff* entry = dynamic_cast<AliPerformanceEff*>(obj);
     if (entry == 0) continue; 
+    entry->FlushSparse();
   
     fEffHisto->Add(entry->fEffHisto);
     fEffSecHisto->Add(entry->fEffSecHisto);
@@ -912,6 +915,9 @@ return count;
 //_____________________________________________________________________________
 void AliPerformanceEff::Analyse() 
 {
+  // the staged fills go into the THnSparse before projecting
+  FlushSparse();
+
   // Analyse comparison information and store output histograms
   // in the folder "folderEff" 
   //
@@ -23,6 +23,7 @@
 //------------------------------------------------------------------------------
 
 #include <iostream>
+#include <algorithm>
 
 #include "TCanvas.h"
 #include "TH1.h"
@@ -55,8 +56,12 @@ AliPerformanceObject::AliPerformanceObject(TRootIOCtor*):
   fUseCentralityBin(0),
   fUseTOFBunchCrossing(kFALSE),
   fUseSparse(1),
+  fSparseDisabledDims(),
+  fSparseStageEvents(1),
   fCutsRC(),
-  fCutsMC()
+  fCutsMC(),
+  fSparseStages(),
+  fSparseStagedEvents(0)
 {
   // io constructor
 }
@@ -76,8 +81,12 @@ AliPerformanceObject::AliPerformanceObject(const char* name, const char* title,
   fUseCentralityBin(0),
   fUseTOFBunchCrossing(kFALSE),
   fUseSparse(1),
+  fSparseDisabledDims(),
+  fSparseStageEvents(1),
   fCutsRC(),
-  fCutsMC()
+  fCutsMC(),
+  fSparseStages(),
+  fSparseStagedEvents(0)
 {
 
     // constructor
@@ -252,3 +261,123 @@ void AliPerformanceObject::AddProjection(TObjArray* aFolderObj, TString nameSpar
   h3->SetTitle(title.Data());  
   aFolderObj->Add(h3);
 }
+
+//_____________________________________________________________________________
+void AliPerformanceObject::DisableSparseDim(const char* histoName, Int_t dim)
+{
+  // fill dimension dim of the THnSparse histoName in its first bin only:
+  // saves the bins of the dimensions which are not projected in Analyse()
+  FlushSparse();
+  fSparseDisabledDims += Form("%s:%d;",histoName,dim);
+  fSparseStages.clear();
+}
+
+//_____________________________________________________________________________
+AliPerformanceObject::SparseStage& AliPerformanceObject::GetSparseStage(THnSparse* hSparse)
+{
+  for (UInt_t i=0; i<fSparseStages.size(); i++) {
+    if (fSparseStages[i].fHisto == hSparse) return fSparseStages[i];
+  }
+
+  SparseStage stage;
+  const Int_t ndim = hSparse->GetNdimensions();
+  stage.fHisto = hSparse;
+  stage.fPacked = kTRUE;
+  stage.fDisabled.assign(ndim,kFALSE);
+  stage.fStride.assign(ndim,0);
+  stage.fCoord.assign(ndim,0);
+  stage.fX.assign(ndim,0.);
+  ULong64_t stride = 1;
+  for (Int_t i=0; i<ndim; i++) {
+    stage.fDisabled[i] = fSparseDisabledDims.Contains(Form("%s:%d;",hSparse->GetName(),i));
+    // bins including under- and overflow
+    const ULong64_t nbins = hSparse->GetAxis(i)->GetNbins()+2;
+    stage.fStride[i] = stride;
+    if (stride > (ULong64_t)-1/nbins) stage.fPacked = kFALSE;
+    else stride *= nbins;
+  }
+  fSparseStages.push_back(stage);
+  return fSparseStages.back();
+}
+
+//_____________________________________________________________________________
+void AliPerformanceObject::FillSparse(THnSparse* hSparse, const Double_t* x, Double_t w)
+{
+  // fill hSparse at x: the bins are looked up in the hash of the THnSparse
+  // only once per bin and event when the fills are staged
+  if (!hSparse) return;
+  if (fSparseStageEvents <= 0 && fSparseDisabledDims.IsNull()) {
+    hSparse->Fill(x,w);
+    return;
+  }
+
+  SparseStage& stage = GetSparseStage(hSparse);
+  const Int_t ndim = hSparse->GetNdimensions();
+  if (fSparseStageEvents <= 0 || !stage.fPacked) {
+    Double_t* xs = &stage.fX[0];
+    for (Int_t i=0; i<ndim; i++) {
+      xs[i] = stage.fDisabled[i] ? hSparse->GetAxis(i)->GetBinCenter(1) : x[i];
+    }
+    hSparse->Fill(xs,w);
+    return;
+  }
+
+  ULong64_t index = 0;
+  for (Int_t i=0; i<ndim; i++) {
+    const Int_t bin = stage.fDisabled[i] ? 1 : hSparse->GetAxis(i)->FindBin(x[i]);
+    index += bin*stage.fStride[i];
+  }
+  stage.fFills.push_back(std::make_pair(index,w));
+}
+
+//_____________________________________________________________________________
+void AliPerformanceObject::FinishEvent()
+{
+  // called by AliPerformanceTask after Exec()
+  if (++fSparseStagedEvents >= fSparseStageEvents) FlushSparse();
+}
+
+//_____________________________________________________________________________
+void AliPerformanceObject::FlushSparse()
+{
+  // fill the staged entries, the fills of the same bin are summed up
+  fSparseStagedEvents = 0;
+  for (UInt_t is=0; is<fSparseStages.size(); is++) {
+    SparseStage& stage = fSparseStages[is];
+    std::vector<std::pair<ULong64_t,Double_t> >& fills = stage.fFills;
+    if (fills.empty()) continue;
+    std::sort(fills.begin(),fills.end());
+
+    THnSparse* hSparse = stage.fHisto;
+    const Int_t ndim = hSparse->GetNdimensions();
+    const Bool_t errors = hSparse->GetCalculateErrors();
+    Int_t* coord = &stage.fCoord[0];
+    const UInt_t nfills = fills.size();
+    for (UInt_t i=0; i<nfills; ) {
+      const ULong64_t index = fills[i].first;
+      Double_t sumw = 0., sumw2 = 0.;
+      for (; i<nfills && fills[i].first == index; i++) {
+        sumw += fills[i].second;
+        sumw2 += fills[i].second*fills[i].second;
+      }
+      ULong64_t rest = index;
+      for (Int_t j=ndim-1; j>=0; j--) {
+        coord[j] = rest/stage.fStride[j];
+        rest -= coord[j]*stage.fStride[j];
+      }
+      const Long64_t bin = hSparse->GetBin(coord,kTRUE);
+      hSparse->AddBinContent(bin,sumw);
+      if (errors) hSparse->AddBinError2(bin,sumw2);
+    }
+    hSparse->SetEntries(hSparse->GetEntries()+nfills);
+    fills.clear();
+  }
+}
+
+//_____________________________________________________________________________
+void AliPerformanceObject::ClearSparse()
+{
+  // drop the staged entries
+  fSparseStagedEvents = 0;
+  for (UInt_t is=0; is<fSparseStages.size(); is++) fSparseStages[is].fFills.clear();
+}
@@ -10,6 +10,9 @@
 // Changes by J.Salzwedel 29/9/2014
 //------------------------------------------------------------------------------
 
+#include <vector>
+#include <utility>
+
 #include "TNamed.h"
 #include "TFolder.h"
 #include "THnSparse.h"
@@ -117,9 +120,23 @@ public :
   Bool_t IsUseTOFBunchCrossing() { return fUseTOFBunchCrossing; }
 
   virtual void ResetOutputData() { ; }
+
+  // staged filling of the THnSparse, see FillSparse()
+  // the fills of nEvents events are collected before the THnSparse are filled, 0 fills directly
+  void SetSparseStageEvents(Int_t nEvents) { fSparseStageEvents = nEvents; }
+  Int_t GetSparseStageEvents() const { return fSparseStageEvents; }
+  // dimension not projected in Analyse(): always filled in its first bin
+  void DisableSparseDim(const char* histoName, Int_t dim);
+  // called after Exec() for each event
+  void FinishEvent();
+  // fill the staged entries into the THnSparse, or drop them
+  void FlushSparse();
+  void ClearSparse();
     
 protected: 
 
+  void FillSparse(THnSparse* hSparse, const Double_t* x, Double_t w = 1.);
+
   void AddProjection(TObjArray* aFolderObj, TString nameSparse, THnSparse *hSparse, Int_t xDim, TString* selString = 0);
   void AddProjection(TObjArray* aFolderObj, TString nameSparse, THnSparse *hSparse, Int_t xDim, Int_t yDim, TString* selString = 0);
   void AddProjection(TObjArray* aFolderObj, TString nameSparse, THnSparse *hSparse, Int_t xDim, Int_t yDim, Int_t zDim, TString* selString = 0);
@@ -151,11 +168,31 @@ protected:
   Bool_t fUseTOFBunchCrossing; // use TOFBunchCrossing, default is yes
   Bool_t fUseSparse;
 
+  TString fSparseDisabledDims; // "name:dim;" of the THnSparse dimensions filled in the first bin only
+  Int_t fSparseStageEvents;    // number of events staged before filling the THnSparse
+
   // Global cuts objects
   AliRecInfoCuts fCutsRC;  // selection cuts for reconstructed tracks
   AliMCInfoCuts  fCutsMC;  // selection cuts for MC tracks
 
-  ClassDef(AliPerformanceObject,11);
+private:
+
+  // fills of one THnSparse, the bin coordinates are packed into one linear index
+  struct SparseStage {
+    THnSparse* fHisto;                                  // staged histogram
+    Bool_t fPacked;                                     // linear index fits in 64 bits
+    std::vector<Bool_t> fDisabled;                      // dimensions filled in the first bin
+    std::vector<ULong64_t> fStride;                     // stride of the linear index per dimension
+    std::vector<Int_t> fCoord;                          // bin coordinates buffer
+    std::vector<Double_t> fX;                           // values buffer
+    std::vector<std::pair<ULong64_t,Double_t> > fFills; // linear index and weight of the staged fills
+  };
+  SparseStage& GetSparseStage(THnSparse* hSparse);
+
+  std::vector<SparseStage> fSparseStages; //! staged fills per THnSparse
+  Int_t fSparseStagedEvents;              //! events in the staged fills
+
+  ClassDef(AliPerformanceObject,12);
 };
 
 #endif
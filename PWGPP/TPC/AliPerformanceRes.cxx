@@ -314,10 +314,10 @@ void AliPerformanceRes::ProcessTPC(AliMCEvent* const mcev, AliVTrack *const vTra
     else pull1PtTPC = 0.; 
 
     Double_t vResolHisto[10] = {deltaYTPC,deltaZTPC,deltaPhiTPC,deltaLambdaTPC,deltaPtTPC,particle->Vy(),particle->Vz(),mcphi,mceta,mcpt};
-    fResolHisto->Fill(vResolHisto);
+    FillSparse(fResolHisto,vResolHisto);
 
     Double_t vPullHisto[10] = {pullYTPC,pullZTPC,pullPhiTPC,pullLambdaTPC,pull1PtTPC,particle->Vy(),particle->Vz(),mcsnp,mctgl,1./mcpt};
-    fPullHisto->Fill(vPullHisto);
+    FillSparse(fPullHisto,vPullHisto);
   }
 }
 
@@ -410,10 +410,10 @@ void AliPerformanceRes::ProcessTPCITS(AliMCEvent* const mcev, AliVTrack *const v
     else pull1PtTPC = 0.;
 
     Double_t vResolHisto[10] = {deltaYTPC,deltaZTPC,deltaPhiTPC,deltaLambdaTPC,deltaPtTPC,particle->Vy(),particle->Vz(),mcphi,mceta,mcpt};
-    fResolHisto->Fill(vResolHisto);
+    FillSparse(fResolHisto,vResolHisto);
 
     Double_t vPullHisto[10] = {pullYTPC,pullZTPC,pullPhiTPC,pullLambdaTPC,pull1PtTPC,particle->Vy(),particle->Vz(),mcsnp,mctgl,1./mcpt};
-    fPullHisto->Fill(vPullHisto);
+    FillSparse(fPullHisto,vPullHisto);
 
    
     /*
@@ -536,10 +536,10 @@ void AliPerformanceRes::ProcessConstrained(AliMCEvent* const mcev, AliVTrack *co
     else pull1PtTPC = 0.;
 
     Double_t vResolHisto[10] = {deltaYTPC,deltaZTPC,deltaPhiTPC,deltaLambdaTPC,deltaPtTPC,particle->Vy(),particle->Vz(),mcphi,mceta,mcpt};
-    fResolHisto->Fill(vResolHisto);
+    FillSparse(fResolHisto,vResolHisto);
 
     Double_t vPullHisto[10] = {pullYTPC,pullZTPC,pullPhiTPC,pullLambdaTPC,pull1PtTPC,particle->Vy(),particle->Vz(),mcsnp,mctgl,1./mcpt};
-    fPullHisto->Fill(vPullHisto);
+    FillSparse(fPullHisto,vPullHisto);
 
     /*
 
@@ -738,10 +738,10 @@ void AliPerformanceRes::ProcessInnerTPC(AliMCEvent *const mcEvent, AliVTrack *co
     }
 
     Double_t vResolHisto[10] = {deltaYTPC,deltaZTPC,deltaPhiTPC,deltaLambdaTPC,deltaPtTPC,ref0->Y(),ref0->Z(),mcphi,mceta,mcpt};
-    fResolHisto->Fill(vResolHisto);
+    FillSparse(fResolHisto,vResolHisto);
 
     Double_t vPullHisto[10] = {pullYTPC,pullZTPC,pullPhiTPC,pullLambdaTPC,pull1PtTPC,ref0->Y(),ref0->Z(),mcsnp,mctgl,1./mcpt};
-    fPullHisto->Fill(vPullHisto);
+    FillSparse(fPullHisto,vPullHisto);
   }
 
   if(track) delete track;
@@ -860,10 +860,10 @@ void AliPerformanceRes::ProcessOuterTPC(AliMCEvent *const mcEvent, AliVTrack *co
     else pull1PtTPC = 0.;
 
     Double_t vResolHisto[10] = {deltaYTPC,deltaZTPC,deltaPhiTPC,deltaLambdaTPC,deltaPtTPC,ref0->Y(),ref0->Z(),mcphi,mceta,mcpt};
-    fResolHisto->Fill(vResolHisto);
+    FillSparse(fResolHisto,vResolHisto);
 
     Double_t vPullHisto[10] = {pullYTPC,pullZTPC,pullPhiTPC,pullLambdaTPC,pull1PtTPC,ref0->Y(),ref0->Z(),mcsnp,mctgl,1./mcpt};
-    fPullHisto->Fill(vPullHisto);
+    FillSparse(fPullHisto,vPullHisto);
   }
 
   if(track) delete track;
@@ -1100,6 +1100,9 @@ TH1F* AliPerformanceRes::MakeResol(TH2F * his, Int_t integ, Bool_t type, Int_t c
 
 //_____________________________________________________________________________
 void AliPerformanceRes::Analyse() {
+  // the staged fills go into the THnSparse before projecting
+  FlushSparse();
+
   // Analyse comparison information and store output histograms
   // in the folder "folderRes"
   //
@@ -1260,6 +1263,8 @@ Long64_t AliPerformanceRes::Merge(TCollection* const list)
   if (list->IsEmpty())
   return 1;
 
+  FlushSparse();
+
   TIterator* iter = list->MakeIterator();
   TObject* obj = 0;
 
@@ -1269,6 +1274,7 @@ Long64_t AliPerformanceRes::Merge(TCollection* const list)
   {
   AliPerformanceRes* entry = dynamic_cast<AliPerformanceRes*>(obj);
   if (entry == 0) continue; 
+  entry->FlushSparse();
   if (fResolHisto->GetEntries()<fgkMergeEntriesCut){
     fResolHisto->Add(entry->fResolHisto);  
     fPullHisto->Add(entry->fPullHisto);
@@ -629,7 +629,7 @@ void AliPerformanceTPC::ProcessTPC(AliMCEvent* const mcev, AliVTrack *const vTra
     else if(q < 0.000001) fMultN++;
     
     if(fUseSparse) {
-      fTPCTrackHisto->Fill(vTPCTrackHisto);
+      FillSparse(fTPCTrackHisto,vTPCTrackHisto);
     } else {
         if(h_tpc_track_all_recvertex_5_8) h_tpc_track_all_recvertex_5_8->Fill(vTPCTrackHisto[5],vTPCTrackHisto[8]);
         if(h_tpc_track_all_recvertex_1_5_7) h_tpc_track_all_recvertex_1_5_7->Fill(vTPCTrackHisto[1],vTPCTrackHisto[5],vTPCTrackHisto[7]);
@@ -729,7 +729,7 @@ void AliPerformanceTPC::ProcessTPCITS(AliMCEvent* const mcev, AliVTrack *const v
     else if(q < 0.000001) fMultN++;
     
     if(fUseSparse) {
-      fTPCTrackHisto->Fill(vTPCTrackHisto);
+      FillSparse(fTPCTrackHisto,vTPCTrackHisto);
     } else {
         if(h_tpc_track_all_recvertex_5_8) h_tpc_track_all_recvertex_5_8->Fill(vTPCTrackHisto[5],vTPCTrackHisto[8]);
         if(h_tpc_track_all_recvertex_1_5_7) h_tpc_track_all_recvertex_1_5_7->Fill(vTPCTrackHisto[1],vTPCTrackHisto[5],vTPCTrackHisto[7]);
@@ -902,7 +902,7 @@ void AliPerformanceTPC::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent,
 	    //Int_t detector = cluster->GetDetector();
 	    //Double_t vTPCClust[6] = { irow, phi, TPCside, pad, detector, gclf[2] };
 	    Double_t vTPCClust[3] = { static_cast<Double_t>(irow), phi, static_cast<Double_t>(TPCside) };
-	    if(fUseSparse) fTPCClustHisto->Fill(vTPCClust);
+	    if(fUseSparse) FillSparse(fTPCClustHisto,vTPCClust);
 	    else{
 	      h_tpc_clust_0_1_2->Fill(vTPCClust[0],vTPCClust[1],vTPCClust[2]);
 	    }
@@ -923,7 +923,7 @@ void AliPerformanceTPC::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent,
     vertex.GetXYZ(vtxPosition);
     Double_t vTPCEvent[7] = {vtxPosition[0],vtxPosition[1],vtxPosition[2],static_cast<Double_t>(fMult),static_cast<Double_t>(fMultP),static_cast<Double_t>(fMultN),static_cast<Double_t>(vertStatus)};
     
-    if(fUseSparse) fTPCEventHisto->Fill(vTPCEvent);
+    if(fUseSparse) FillSparse(fTPCEventHisto,vTPCEvent);
     else {
         if(h_tpc_event_6) h_tpc_event_6->Fill(vTPCEvent[6]);
         if(vTPCEvent[6]>0.001){
@@ -942,6 +942,9 @@ void AliPerformanceTPC::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent,
 //_____________________________________________________________________________
 void AliPerformanceTPC::Analyse()
 {
+  // the staged fills go into the THnSparse before projecting
+  FlushSparse();
+
     //
     // Analyse comparison information and store output histograms
     // in the folder "folderTPC"
@@ -1106,6 +1109,8 @@ Long64_t AliPerformanceTPC::Merge(TCollection* list)
 
   if (list->IsEmpty())
   return 1;
+
+  FlushSparse();
   
   Bool_t merge = ((fgUseMergeTHnSparse && fgMergeTHnSparse) || (!fgUseMergeTHnSparse && fMergeTHnSparseObj));
 
@@ -1120,6 +1125,7 @@ Long64_t AliPerformanceTPC::Merge(TCollection* list)
   {
     AliPerformanceTPC* entry = dynamic_cast<AliPerformanceTPC*>(obj);
     if (entry == 0) continue; 
+    entry->FlushSparse();
     if (merge) {
         if ((fTPCClustHisto) && (entry->fTPCClustHisto)) { fTPCClustHisto->Add(entry->fTPCClustHisto); }
         if ((fTPCEventHisto) && (entry->fTPCEventHisto)) { fTPCEventHisto->Add(entry->fTPCEventHisto); }
@@ -254,6 +254,7 @@ void AliPerformanceTask::UserExec(Option_t *)
       //AliInfo(pObj->GetName());
       if (showInfo) AliInfo(Form("...executing job %s",pObj->GetName()));
       pObj->Exec(fMC,fVEvent,fVfriendEvent,fUseMCInfo,fUseVfriend);
+      pObj->FinishEvent();
     }
   }
 
@@ -343,6 +344,7 @@ void AliPerformanceTask::FinishTaskOutput()
       itOut->Reset();
       while(( pObj = dynamic_cast<AliPerformanceObject*>(itOut->Next())) != NULL) {
           //pObj->SetRunNumber(fCurrentRunNumber);
+          pObj->FlushSparse();
           pObj->Analyse();
       }
     
@@ -418,6 +420,7 @@ Bool_t AliPerformanceTask::ResetOutputData(){
     itOut->Reset();
 
     while(( pObj = dynamic_cast<AliPerformanceObject*>(itOut->Next())) != NULL) {
+      pObj->ClearSparse();
       pObj->ResetOutputData();
     }
 
@@ -3,6 +3,9 @@
 #include "TF1.h"
 #include "TAxis.h"
 #include "TH2I.h"
+#include "TH3.h"
+#include "TFile.h"
+#include "TROOT.h"
 
 #include "THnSparse.h"
 
@@ -25,6 +28,11 @@
 //#include "AliTPCParamSR.h"
 
 #include "AliTPCPIDEtaTree.h"
+#include "AliTPCdEdxCorrectionGrid.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
 
 /*
 This task determines the eta dependence of the TPC signal.
@@ -39,6 +47,81 @@ Contact: bhess@cern.ch
 
 ClassImp(AliTPCPIDEtaTree)
 
+namespace {
+  //________________________________________________________________________
+  Bool_t ProcessTreeRange(const char* fileName, const char* treeName, Long64_t first, Long64_t last, TH3* hist,
+                          const AliTPCdEdxCorrectionGrid* grid, UShort_t minTPCsignalN, Double_t mass)
+  {
+    // Fill the entries [first, last) of the tree into hist, see AliTPCPIDEtaTree::ProcessTree.
+    // The file is opened here, so that each thread reads its own tree.
+    
+    TFile* f = TFile::Open(fileName, "READ");
+    if (!f || f->IsZombie()) {
+      Printf("Error - AliTPCPIDEtaTree::ProcessTree: Cannot open file \"%s\"!", fileName);
+      delete f;
+      return kFALSE;
+    }
+    TTree* tree = dynamic_cast<TTree*>(f->Get(treeName));
+    if (!tree) {
+      Printf("Error - AliTPCPIDEtaTree::ProcessTree: No tree \"%s\" in file \"%s\"!", treeName, fileName);
+      delete f;
+      return kFALSE;
+    }
+    
+    Double_t pTPC = 0., dEdx = 0., dEdxExpected = 0., tanTheta = 0.;
+    UShort_t tpcSignalN = 0;
+    tree->SetBranchStatus("*", 0);
+    tree->SetBranchStatus("pTPC", 1);
+    tree->SetBranchStatus("dEdx", 1);
+    tree->SetBranchStatus("dEdxExpected", 1);
+    tree->SetBranchStatus("tanTheta", 1);
+    tree->SetBranchStatus("tpcSignalN", 1);
+    tree->SetBranchAddress("pTPC", &pTPC);
+    tree->SetBranchAddress("dEdx", &dEdx);
+    tree->SetBranchAddress("dEdxExpected", &dEdxExpected);
+    tree->SetBranchAddress("tanTheta", &tanTheta);
+    tree->SetBranchAddress("tpcSignalN", &tpcSignalN);
+    
+    const Bool_t useSpline = grid && grid->HasSpline();
+    const Int_t chunkSize = 4096;
+    std::vector<Double_t> bg(chunkSize), tgl(chunkSize), signal(chunkSize), expected(chunkSize), invExpected(chunkSize), corr(chunkSize);
+    
+    for (Long64_t start = first; start < last; start += chunkSize) {
+      // Read a chunk of entries
+      const Long64_t stop = TMath::Min(start + chunkSize, last);
+      Int_t n = 0;
+      for (Long64_t i = start; i < stop; i++) {
+        if (tree->GetEntry(i) <= 0 || tpcSignalN < minTPCsignalN)
+          continue;
+        bg[n] = pTPC / mass;
+        tgl[n] = tanTheta;
+        signal[n] = dEdx;
+        expected[n] = dEdxExpected;
+        n++;
+      }
+      
+      // Splines and eta correction for the whole chunk
+      if (useSpline)
+        grid->EvalSpline(n, bg.data(), expected.data());
+      for (Int_t i = 0; i < n; i++)
+        invExpected[i] = expected[i] > 0 ? 1. / expected[i] : 0.;
+      if (grid)
+        grid->EvalEtaCorrection(n, tgl.data(), invExpected.data(), corr.data());
+      else
+        std::fill(corr.begin(), corr.begin() + n, 1.);
+      
+      for (Int_t i = 0; i < n; i++) {
+        if (expected[i] <= 0 || corr[i] <= 0)
+          continue;
+        hist->Fill(tgl[i], invExpected[i], signal[i] / (expected[i] * corr[i]));
+      }
+    }
+    
+    delete f;
+    return kTRUE;
+  }
+}
+
 //________________________________________________________________________
 AliTPCPIDEtaTree::AliTPCPIDEtaTree()
   : AliTPCPIDBase()
@@ -581,6 +664,91 @@ void AliTPCPIDEtaTree::UserExec(Option_t *)
   ClearV0PIDlist();
 }      
 
+//________________________________________________________________________
+TH3* AliTPCPIDEtaTree::ProcessTree(const char* fileName, const char* treeName, const TH3* histTemplate,
+                                   const AliTPCdEdxCorrectionGrid* grid, Int_t nThreads, UShort_t minTPCsignalN, Double_t mass)
+{
+  // Fill the tree entries (fTree or fTreePions) with tpcSignalN >= minTPCsignalN into a copy of
+  // histTemplate: x = tanTheta, y = 1/dEdx_splines and z = dEdx/dEdxExpected (after correction),
+  // i.e. the input for the eta correction map, or its check if a map is given.
+  // With a grid, the splines (if set, at pTPC/mass) and the eta correction map are evaluated
+  // from it for chunks of entries; otherwise the stored dEdxExpected is used.
+  // mass < 0: pion mass for "fTreePions", proton mass otherwise.
+  // With nThreads > 1 the entries are split into consecutive ranges read in parallel, each
+  // thread filling its own copy of the histogram; the copies are merged in order.
+  // The returned histogram is owned by the caller, 0x0 on failure.
+  
+  if (!histTemplate) {
+    Printf("Error - AliTPCPIDEtaTree::ProcessTree: No histogram template!");
+    return 0x0;
+  }
+  
+  if (mass < 0)
+    mass = AliPID::ParticleMass(TString(treeName).CompareTo("fTreePions") == 0 ? AliPID::kPion : AliPID::kProton);
+  
+  Long64_t nEntries = 0;
+  {
+    TFile* f = TFile::Open(fileName, "READ");
+    TTree* tree = (f && !f->IsZombie()) ? dynamic_cast<TTree*>(f->Get(treeName)) : 0x0;
+    if (tree)
+      nEntries = tree->GetEntries();
+    delete f;
+    if (!tree) {
+      Printf("Error - AliTPCPIDEtaTree::ProcessTree: No tree \"%s\" in file \"%s\"!", treeName, fileName);
+      return 0x0;
+    }
+  }
+  
+  TH3* hist = static_cast<TH3*>(histTemplate->Clone(Form("%s_%s", histTemplate->GetName(), treeName)));
+  hist->SetDirectory(0x0);
+  hist->Reset();
+  
+  if (nThreads > nEntries)
+    nThreads = nEntries;
+  if (nThreads <= 1) {
+    if (!ProcessTreeRange(fileName, treeName, 0, nEntries, hist, grid, minTPCsignalN, mass)) {
+      delete hist;
+      return 0x0;
+    }
+    return hist;
+  }
+  
+  ROOT::EnableThreadSafety();
+  
+  std::vector<TH3*> hists(nThreads, 0x0);
+  std::vector<Int_t> ok(nThreads, 0); // not vector<bool>: written from the threads
+  hists[0] = hist;
+  for (Int_t t = 1; t < nThreads; t++) {
+    hists[t] = static_cast<TH3*>(hist->Clone(Form("%s_%d", hist->GetName(), t)));
+    hists[t]->SetDirectory(0x0);
+  }
+  
+  auto work = [&](Int_t t) {
+    const Long64_t first = nEntries * t / nThreads;
+    const Long64_t last = nEntries * (t + 1) / nThreads;
+    ok[t] = ProcessTreeRange(fileName, treeName, first, last, hists[t], grid, minTPCsignalN, mass);
+  };
+  std::vector<std::thread> workers;
+  for (Int_t t = 1; t < nThreads; t++)
+    workers.push_back(std::thread(work, t));
+  work(0);
+  for (auto& w : workers)
+    w.join();
+  
+  Bool_t allOk = kTRUE;
+  for (Int_t t = 1; t < nThreads; t++) {
+    hist->Add(hists[t]);
+    delete hists[t];
+    allOk = allOk && ok[t];
+  }
+  if (!allOk || !ok[0]) {
+    delete hist;
+    return 0x0;
+  }
+  
+  return hist;
+}
+
 //________________________________________________________________________
 void AliTPCPIDEtaTree::Terminate(const Option_t *)
 {
@@ -16,6 +16,8 @@ class TTree;
 class TObjArray;
 class THnSparse;
 class TH2I;
+class TH3;
+class AliTPCdEdxCorrectionGrid;
 
 #include "AliTPCPIDBase.h"
 
@@ -54,6 +56,11 @@ class AliTPCPIDEtaTree : public AliTPCPIDBase {
   Double_t GetPtpcPionCut() const { return fPtpcPionCut; };
   void SetPtpcPionCut(Double_t pTPCpionCut) { fPtpcPionCut = pTPCpionCut; };
   
+  // Offline processing of the output trees, see the cxx
+  static TH3* ProcessTree(const char* fileName, const char* treeName, const TH3* histTemplate,
+                          const AliTPCdEdxCorrectionGrid* grid = 0x0, Int_t nThreads = 1,
+                          UShort_t minTPCsignalN = 0, Double_t mass = -1.);
+  
  private:
   Short_t fNumEtaCorrReqErrorsIssued;  // Number of times the error about eta correction issues have been displayed
   Short_t fNumMultCorrReqErrorsIssued; // Number of times the error about multiplicity correction issues have been displayed
@@ -15,6 +15,11 @@
 //------------------------------------------------------------------------------
 
 #include <fstream>
+#include <iostream>
+#include <map>
+#include <vector>
+#include <unistd.h>
+#include <sys/wait.h>
 
 #include <TObjString.h>
 #include "TSystem.h"
@@ -70,6 +75,9 @@ ClassImp(AliTPCPerformanceSummary)
 
 Bool_t AliTPCPerformanceSummary::fgForceTHnSparse = kFALSE;
 
+// THnSparse projections of the run being analysed, see ProjectSparse()
+static std::map<TString,TH1*> gProjectionCache;
+
 Bool_t  AliTPCPerformanceSummary::GetStatInfo(TH1 * histo, TVectorF &statInfo, Int_t axis){
   //
   // fill basic statistical information
@@ -173,6 +181,7 @@ void AliTPCPerformanceSummary::WriteToTTreeSRedirector(const AliPerformanceTPC*
   Int_t year=0;
   if (gSystem->Getenv("eyear")) year=atoi(gSystem->Getenv("eyear"));
   if (!pcstream) return;
+  ClearProjectionCache();
   (*pcstream)<<"tpcQA"<<
   "run="<<run<<
   "time="<<time<<
@@ -214,6 +223,7 @@ void AliTPCPerformanceSummary::WriteToTTreeSRedirector(const AliPerformanceTPC*
   AnalyzeMatch(pTPCMatch, pcstream);
   AnalyzePull(pTPCPull, pcstream);
   AnalyzeConstrain(pConstrain, pcstream);
+  ClearProjectionCache();
 
   (*pcstream)<<"tpcQA"<<"\n";
   TTree * tree = ((*pcstream)<<"tpcQA").GetTree();
@@ -586,6 +596,131 @@ Int_t AliTPCPerformanceSummary::ProduceTrends(const Char_t* infilelist, const Ch
     return 0;
 }
 
+//_____________________________________________________________________________
+Int_t AliTPCPerformanceSummary::MakeReports(const Char_t* infilelist, const Char_t* outfile, Int_t nParallel)
+{
+    //
+    // Runs MakeReport for all the runs in infilelist, a textfile with
+    // the run number and the QA rootfile of the run per line, and merges
+    // the reports into the trending tree in outfile (see ProduceTrends).
+    // The report of a run is written next to outfile as
+    // TPCPerformanceSummary_<run>.root.
+    //
+    // nParallel runs are analysed at the same time in forked processes:
+    // the Analyze functions keep their results in static variables bound
+    // to the tree branches and the OCDB is set up per run, so the runs
+    // can not share one process.
+    //
+    
+    if (!infilelist) return -1;
+    if (!outfile) return -1;
+
+    std::vector<Int_t> runs;
+    std::vector<TString> inputs;
+    ifstream in;
+    in.open(infilelist);
+    Int_t run = 0;
+    TString currentFile;
+    while (in >> run >> currentFile) {
+        if (!currentFile.Contains("root")) continue; // protection
+        runs.push_back(run);
+        inputs.push_back(currentFile);
+    }
+    in.close();
+    if (runs.empty()) return -1;
+
+    TString outdir = gSystem->DirName(outfile);
+    std::vector<TString> reports;
+    for (UInt_t i=0; i<runs.size(); i++) reports.push_back(Form("%s/TPCPerformanceSummary_%d.root",outdir.Data(),runs[i]));
+
+    Int_t nFailed = 0;
+    if (nParallel <= 1) {
+        for (UInt_t i=0; i<runs.size(); i++) {
+            if (AliCDBManager::Instance()->IsDefaultStorageSet()) AliCDBManager::Instance()->SetRun(runs[i]);
+            if (MakeReport(inputs[i].Data(),reports[i].Data(),runs[i]) != 0) nFailed++;
+        }
+    } else {
+        Int_t nRunning = 0;
+        Int_t status = 0;
+        for (UInt_t i=0; i<runs.size(); i++) {
+            if (nRunning >= nParallel && wait(&status) > 0) {
+                nRunning--;
+                if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) nFailed++;
+            }
+            std::cout << std::flush;
+            pid_t pid = fork();
+            if (pid < 0) {
+                ::Error("AliTPCPerformanceSummary::MakeReports","fork failed for run %d",runs[i]);
+                nFailed++;
+                continue;
+            }
+            if (pid == 0) {
+                // the report is written and closed by MakeReport,
+                // the files of the parent are not touched at exit
+                if (AliCDBManager::Instance()->IsDefaultStorageSet()) AliCDBManager::Instance()->SetRun(runs[i]);
+                Int_t ret = MakeReport(inputs[i].Data(),reports[i].Data(),runs[i]);
+                std::cout << std::flush;
+                _exit(ret == 0 ? 0 : 1);
+            }
+            nRunning++;
+        }
+        while (nRunning > 0 && wait(&status) > 0) {
+            nRunning--;
+            if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) nFailed++;
+        }
+    }
+    if (nFailed) ::Warning("AliTPCPerformanceSummary::MakeReports","%d of %d runs failed",nFailed,(Int_t)runs.size());
+
+    TString reportlist = Form("%s/TPCPerformanceSummary_reports.list",outdir.Data());
+    std::ofstream list(reportlist.Data());
+    for (UInt_t i=0; i<reports.size(); i++) {
+        if (!gSystem->AccessPathName(reports[i].Data())) list << reports[i].Data() << std::endl;
+    }
+    list.close();
+    Int_t returncode = ProduceTrends(reportlist.Data(),outfile);
+    gSystem->Unlink(reportlist.Data());
+    return returncode;
+}
+
+//_____________________________________________________________________________
+TH1* AliTPCPerformanceSummary::ProjectSparse(THnSparse* hSparse, Int_t dim0, Int_t dim1, Int_t dim2)
+{
+    //
+    // hSparse->Projection(dim0[,dim1[,dim2]]) in the current axis ranges.
+    // Several summary variables use the same projections, they are kept
+    // until ClearProjectionCache(). The caller owns the returned histogram.
+    //
+    
+    if (!hSparse) return 0;
+    TString key = Form("%p:%d:%d:%d",(void*)hSparse,dim0,dim1,dim2);
+    for (Int_t i=0; i<hSparse->GetNdimensions(); i++) {
+        const TAxis* axis = hSparse->GetAxis(i);
+        if (axis->TestBit(TAxis::kAxisRange)) key += Form(":%d-%d",axis->GetFirst(),axis->GetLast());
+        else key += ":";
+    }
+    
+    TH1* proj = 0;
+    std::map<TString,TH1*>::iterator cached = gProjectionCache.find(key);
+    if (cached != gProjectionCache.end()) {
+        proj = cached->second;
+    } else {
+        if (dim2 >= 0) proj = hSparse->Projection(dim0,dim1,dim2);
+        else if (dim1 >= 0) proj = hSparse->Projection(dim0,dim1);
+        else proj = hSparse->Projection(dim0);
+        if (!proj) return 0;
+        proj->SetDirectory(0);
+        gProjectionCache[key] = proj;
+    }
+    return dynamic_cast<TH1*>(proj->Clone());
+}
+
+//_____________________________________________________________________________
+void AliTPCPerformanceSummary::ClearProjectionCache()
+{
+    for (std::map<TString,TH1*>::iterator it=gProjectionCache.begin(); it!=gProjectionCache.end(); ++it) delete it->second;
+    gProjectionCache.clear();
+}
+
 //_____________________________________________________________________________
 Int_t AliTPCPerformanceSummary::SaveGraph(TTree* tree, const Char_t* y, const Char_t* x, const Char_t* condition)
 {    
@@ -663,7 +798,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeDCARPhi(const AliPerformanceTPC* pTPC, TT
     if (his3D && !fgForceTHnSparse) { 
         his2D = dynamic_cast<TH2*>(his3D->Project3D("xy")); 
     } else {    
-        his2D = pTPC->GetTPCTrackHisto()->Projection(3,5);
+        his2D = dynamic_cast<TH2*>(ProjectSparse(pTPC->GetTPCTrackHisto(),3,5));
     }            
     if(!his2D) return 8;
 
@@ -843,7 +978,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeDCARPhiPos(const AliPerformanceTPC* pTPC,
         his2D = dynamic_cast<TH2*>(his3D->Project3D("xy")); 
     } else {    
         pTPC->GetTPCTrackHisto()->GetAxis(8)->SetRangeUser(0,1.5);        
-        his2D = pTPC->GetTPCTrackHisto()->Projection(3,5);
+        his2D = dynamic_cast<TH2*>(ProjectSparse(pTPC->GetTPCTrackHisto(),3,5));
         pTPC->GetTPCTrackHisto()->GetAxis(8)->SetRangeUser(-1.5,1.5);
     }            
     if(!his2D) return 16;
@@ -933,7 +1068,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeDCARPhiNeg(const AliPerformanceTPC* pTPC,
         his2D = dynamic_cast<TH2*>(his3D->Project3D("xy")); 
     } else {    
         pTPC->GetTPCTrackHisto()->GetAxis(8)->SetRangeUser(-1.5,0);        
-        his2D = pTPC->GetTPCTrackHisto()->Projection(3,5);
+        his2D = dynamic_cast<TH2*>(ProjectSparse(pTPC->GetTPCTrackHisto(),3,5));
         pTPC->GetTPCTrackHisto()->GetAxis(8)->SetRangeUser(-1.5,1.5);
     }            
     if(!his2D) return 32;
@@ -1054,7 +1189,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeNCL(const AliPerformanceTPC* pTPC, TTreeS
     if (his3D0 && !fgForceTHnSparse) { 
          his1D = his3D0->Project3D("x"); 
     } else {
-         his1D = pTPC->GetTPCTrackHisto()->Projection(0);
+         his1D = ProjectSparse(pTPC->GetTPCTrackHisto(),0);
     }
  
     meanTPCncl= his1D->GetMean();
@@ -1065,7 +1200,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeNCL(const AliPerformanceTPC* pTPC, TTreeS
     if (his3D1 && !fgForceTHnSparse) {
       his1D = his3D1->Project3D("x"); 
     } else {
-      his1D = pTPC->GetTPCTrackHisto()->Projection(1);
+      his1D = ProjectSparse(pTPC->GetTPCTrackHisto(),1);
     }
           
     meanTPCChi2= his1D->GetMean();
@@ -1076,7 +1211,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeNCL(const AliPerformanceTPC* pTPC, TTreeS
    if (his3D0 && !fgForceTHnSparse) {
         hprof = (dynamic_cast<TH2*>(his3D0->Project3D("xy")))->ProfileX(); 
     } else {
-        hprof = pTPC->GetTPCTrackHisto()->Projection(0,5)->ProfileX();
+        hprof = dynamic_cast<TH2*>(ProjectSparse(pTPC->GetTPCTrackHisto(),0,5))->ProfileX();
     }
     if(!hprof) return 1;
     
@@ -1096,7 +1231,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeNCL(const AliPerformanceTPC* pTPC, TTreeS
         his1D = his3D2->Project3D("x"); 
     } else {    
         pTPC->GetTPCTrackHisto()->GetAxis(2)->SetRangeUser(0.4,1.1);
-        his1D = pTPC->GetTPCTrackHisto()->Projection(2);
+        his1D = ProjectSparse(pTPC->GetTPCTrackHisto(),2);
     }    
         
     meanTPCnclF= his1D->GetMean();
@@ -1108,7 +1243,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeNCL(const AliPerformanceTPC* pTPC, TTreeS
          his1D = (dynamic_cast<TH2*>(his3D2->Project3D("xy")))->ProfileX(); 
     } else {    
         pTPC->GetTPCTrackHisto()->GetAxis(2)->SetRangeUser(0.4,1.1);
-        his1D = pTPC->GetTPCTrackHisto()->Projection(2,5)->ProfileX();
+        his1D = dynamic_cast<TH2*>(ProjectSparse(pTPC->GetTPCTrackHisto(),2,5))->ProfileX();
     }      
     if(!his1D) return 1;
     
@@ -1296,7 +1431,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeDrift(const AliPerformanceTPC* pTPC, TTre
    if (his3D && !fgForceTHnSparse) { 
         his2D = dynamic_cast<TH2*>(his3D->Project3D("xy")); 
     } else {    
-        his2D = pTPC->GetTPCTrackHisto()->Projection(4,5);
+        his2D = dynamic_cast<TH2*>(ProjectSparse(pTPC->GetTPCTrackHisto(),4,5));
     }        
     if(!his2D) return 2;
     
@@ -1385,7 +1520,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeDriftPos(const AliPerformanceTPC* pTPC, T
     if (his3D && !fgForceTHnSparse) { 
         his2D = dynamic_cast<TH2*>(his3D->Project3D("xy")); 
     } else {    
-        his2D = pTPC->GetTPCTrackHisto()->Projection(4,5);
+        his2D = dynamic_cast<TH2*>(ProjectSparse(pTPC->GetTPCTrackHisto(),4,5));
     }            
     if(!his2D) return 64;
     
@@ -1475,7 +1610,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeDriftNeg(const AliPerformanceTPC* pTPC, T
     if (his3D && !fgForceTHnSparse) { 
         his2D = dynamic_cast<TH2*>(his3D->Project3D("xy")); 
     } else {    
-        his2D = pTPC->GetTPCTrackHisto()->Projection(4,5);
+        his2D = dynamic_cast<TH2*>(ProjectSparse(pTPC->GetTPCTrackHisto(),4,5));
     }                
     if(!his2D) return 128;
     
@@ -1574,7 +1709,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeGain(const AliPerformanceDEdx* pTPCgain,
     if (pTPCgain->GetHistos()->FindObject("h_tpc_dedx_mips_0") && !fgForceTHnSparse) {    
         his1D = dynamic_cast<TH1*>(pTPCgain->GetHistos()->FindObject("h_tpc_dedx_mips_0")->Clone());
     } else {
-       his1D =  pTPCgain->GetDeDxHisto()->Projection(0);
+       his1D = ProjectSparse(pTPCgain->GetDeDxHisto(),0);
     }
     if(!his1D) return 4;
     meanMIP = his1D->GetXaxis()->GetBinCenter(his1D->GetMaximumBin());
@@ -1593,7 +1728,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeGain(const AliPerformanceDEdx* pTPCgain,
     if (pTPCgain->GetHistos()->FindObject("h_tpc_dedx_mips_c_0_5") && !fgForceTHnSparse) {    
         his2D = dynamic_cast<TH2*>(pTPCgain->GetHistos()->FindObject("h_tpc_dedx_mips_c_0_5")->Clone());
     } else {
-        his2D =  pTPCgain->GetDeDxHisto()->Projection(0,5);
+        his2D = dynamic_cast<TH2*>(ProjectSparse(pTPCgain->GetDeDxHisto(),0,5));
     }        
     if(!his2D) return 4;
 
@@ -1610,7 +1745,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeGain(const AliPerformanceDEdx* pTPCgain,
     if (pTPCgain->GetHistos()->FindObject("h_tpc_dedx_mips_a_0_5") && !fgForceTHnSparse) {    
         his2D = dynamic_cast<TH2*>(pTPCgain->GetHistos()->FindObject("h_tpc_dedx_mips_a_0_5")->Clone());
     } else {
-        his2D =  pTPCgain->GetDeDxHisto()->Projection(0,5);
+        his2D = dynamic_cast<TH2*>(ProjectSparse(pTPCgain->GetDeDxHisto(),0,5));
     }         
     if(!his2D) return 4;
 
@@ -1630,7 +1765,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeGain(const AliPerformanceDEdx* pTPCgain,
     if (pTPCgain->GetHistos()->FindObject("h_tpc_dedx_mips_c_0_1") && !fgForceTHnSparse) {    
         his2D = dynamic_cast<TH2*>(pTPCgain->GetHistos()->FindObject("h_tpc_dedx_mips_c_0_1")->Clone());
     } else {
-        his2D =  pTPCgain->GetDeDxHisto()->Projection(0,1);
+        his2D = dynamic_cast<TH2*>(ProjectSparse(pTPCgain->GetDeDxHisto(),0,1));
     }
     if(!his2D) return 4;
 
@@ -1659,7 +1794,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeGain(const AliPerformanceDEdx* pTPCgain,
     if (pTPCgain->GetHistos()->FindObject("h_tpc_dedx_mips_a_0_1") && !fgForceTHnSparse) {    
         his2D = dynamic_cast<TH2*>(pTPCgain->GetHistos()->FindObject("h_tpc_dedx_mips_a_0_1")->Clone());
     } else {
-        his2D =  pTPCgain->GetDeDxHisto()->Projection(0,1);
+        his2D = dynamic_cast<TH2*>(ProjectSparse(pTPCgain->GetDeDxHisto(),0,1));
     }    
     if(!his2D) return 4; 
 
@@ -1698,7 +1833,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeGain(const AliPerformanceDEdx* pTPCgain,
     if (pTPCgain->GetHistos()->FindObject("h_tpc_dedx_mipsele_0") && !fgForceTHnSparse) {
       his1D = dynamic_cast<TH1*>(pTPCgain->GetHistos()->FindObject("h_tpc_dedx_mipsele_0")->Clone());
     } else {
-      his1D =  pTPCgain->GetDeDxHisto()->Projection(0);
+      his1D = ProjectSparse(pTPCgain->GetDeDxHisto(),0);
     }
     if(!his1D) return 4;
     meanMIPele = his1D->GetXaxis()->GetBinCenter(his1D->GetMaximumBin());
@@ -1794,7 +1929,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeEvent(const AliPerformanceTPC* pTPC, TTre
     if (pTPC->GetHistos()->FindObject("h_tpc_event_6") && !fgForceTHnSparse) {    
         his1D = dynamic_cast<TH1*>(pTPC->GetHistos()->FindObject("h_tpc_event_6")->Clone());
     } else {
-       his1D = pTPC->GetTPCEventHisto()->Projection(6);
+       his1D = ProjectSparse(pTPC->GetTPCEventHisto(),6);
     }
     if(!his1D) return 1;
 
@@ -1811,7 +1946,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeEvent(const AliPerformanceTPC* pTPC, TTre
     if (pTPC->GetHistos()->FindObject("h_tpc_event_recvertex_0") && !fgForceTHnSparse) {    
         his1D = dynamic_cast<TH1*>(pTPC->GetHistos()->FindObject("h_tpc_event_recvertex_0")->Clone());
     } else {
-       his1D = pTPC->GetTPCEventHisto()->Projection(0);
+       his1D = ProjectSparse(pTPC->GetTPCEventHisto(),0);
     }
     if(!his1D) return 1;
     entriesVertX = his1D->GetEntries(); 
@@ -1826,7 +1961,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeEvent(const AliPerformanceTPC* pTPC, TTre
     if (pTPC->GetHistos()->FindObject("h_tpc_event_recvertex_1") && !fgForceTHnSparse) {    
         his1D = dynamic_cast<TH1*>(pTPC->GetHistos()->FindObject("h_tpc_event_recvertex_1")->Clone());
     } else {
-       his1D = pTPC->GetTPCEventHisto()->Projection(1);
+       his1D = ProjectSparse(pTPC->GetTPCEventHisto(),1);
     }
     if(!his1D) return 1;
 
@@ -1843,7 +1978,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeEvent(const AliPerformanceTPC* pTPC, TTre
         //his1D = dynamic_cast<TH1*>(pTPC->GetHistos()->FindObject("h_tpc_event_recvertex_2")->Clone());
         his1D = (TH1*)hc->Clone();
     } else {
-       his1D = pTPC->GetTPCEventHisto()->Projection(2);
+       his1D = ProjectSparse(pTPC->GetTPCEventHisto(),2);
     }    
     if(!his1D) return 1;
 
@@ -1860,7 +1995,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeEvent(const AliPerformanceTPC* pTPC, TTre
         //his1D = dynamic_cast<TH1*>(pTPC->GetHistos()->FindObject("h_tpc_event_recvertex_3")->Clone());
         his1D = (TH1*)hc->Clone();
     } else {
-       his1D = pTPC->GetTPCEventHisto()->Projection(3);
+       his1D = ProjectSparse(pTPC->GetTPCEventHisto(),3);
     }
     if(!his1D) return 1;
 
@@ -1874,7 +2009,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeEvent(const AliPerformanceTPC* pTPC, TTre
     if (pTPC->GetHistos()->FindObject("h_tpc_event_recvertex_4") && !fgForceTHnSparse) {    
         his1D = dynamic_cast<TH1*>(pTPC->GetHistos()->FindObject("h_tpc_event_recvertex_4")->Clone());
     } else {
-       his1D = pTPC->GetTPCEventHisto()->Projection(4);
+       his1D = ProjectSparse(pTPC->GetTPCEventHisto(),4);
     }
     if(!his1D) return 1;
 
@@ -1887,7 +2022,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeEvent(const AliPerformanceTPC* pTPC, TTre
     if (pTPC->GetHistos()->FindObject("h_tpc_event_recvertex_5") && !fgForceTHnSparse) {    
         his1D = dynamic_cast<TH1*>(pTPC->GetHistos()->FindObject("h_tpc_event_recvertex_5")->Clone());
     } else {
-       his1D = pTPC->GetTPCEventHisto()->Projection(5);
+       his1D = ProjectSparse(pTPC->GetTPCEventHisto(),5);
     }
     if(!his1D) return 1;
 
@@ -2926,7 +3061,7 @@ Int_t AliTPCPerformanceSummary::AnalyzeOcc(const AliPerformanceTPC* pTPC, TTreeS
  if (pTPC->GetHistos()->FindObject("h_tpc_clust_0_1_2")) {  
     h3D_1 = dynamic_cast<TH3*>(pTPC->GetHistos()->FindObject("h_tpc_clust_0_1_2"));
   } else { 
-    h3D_1 = pTPC->GetTPCClustHisto()->Projection(0,1,2);
+    h3D_1 = dynamic_cast<TH3*>(ProjectSparse(pTPC->GetTPCClustHisto(),0,1,2));
   }
   if(!h3D_1) {
     printf("E-AliTPCPerformanceSummary::AnalyzeOcc: h_tpc_clust_0_1_2 not found");
@@ -10,6 +10,8 @@
 //------------------------------------------------------------------------------
 
 class TTree;
+class TH1;
+class THnSparse;
 
 class TTreeSRedirector;
 class AliPerformanceTPC;
@@ -33,6 +35,9 @@ class AliTPCPerformanceSummary
     // the two key functions
     static Int_t MakeReport(const Char_t* infile, const Char_t* outfile, Int_t run);
     static Int_t ProduceTrends(const Char_t* infilelist, const Char_t* outfile);
+    // MakeReport for the runs of infilelist ("run file" per line) in nParallel processes,
+    // then ProduceTrends of the reports into outfile
+    static Int_t MakeReports(const Char_t* infilelist, const Char_t* outfile, Int_t nParallel = 4);
     
     static Bool_t GetForceTHnSparse() { return fgForceTHnSparse; }
     static void SetForceTHnSparse(Bool_t forceSparse = kTRUE) { fgForceTHnSparse = forceSparse; }      
@@ -45,6 +50,10 @@ class AliTPCPerformanceSummary
     // save graphs to current directory
     
     static Int_t SaveGraph(TTree* tree, const Char_t* y, const Char_t* x, const Char_t* condition);
+
+    // THnSparse projection in the current axis ranges, cached while one run is analysed
+    static TH1* ProjectSparse(THnSparse* hSparse, Int_t dim0, Int_t dim1 = -1, Int_t dim2 = -1);
+    static void ClearProjectionCache();
     
     // helper functions to extract parameter and write to TTreeSRedirector
     static Int_t AnalyzeDCARPhi(const AliPerformanceTPC* pTPC, TTreeSRedirector* const pcstream);
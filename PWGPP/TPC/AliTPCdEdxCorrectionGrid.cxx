@@ -0,0 +1,155 @@
+#include "TAxis.h"
+#include "TH2.h"
+#include "TSpline.h"
+
+#include "AliTPCdEdxCorrectionGrid.h"
+
+/*
+Precomputed interpolation grids of a TPC dE/dx response spline and of an
+eta correction map, see the header for the interpolation.
+*/
+
+ClassImp(AliTPCdEdxCorrectionGrid)
+
+namespace {
+  // Regular points between the first and the last bin centre of an axis;
+  // a single bin gives two identical points. Returns the number of points.
+  Int_t GetGridPoints(const TAxis *axis, Int_t nPoints, Double_t &min, Double_t &invStep)
+  {
+    const Int_t nBins = axis->GetNbins();
+    min = axis->GetBinCenter(1);
+    if (nBins < 2) {
+      invStep = 0.;
+      return 2;
+    }
+    if (nPoints < 2)
+      nPoints = nBins;
+    invStep = (nPoints - 1) / (axis->GetBinCenter(nBins) - min);
+    return nPoints;
+  }
+}
+
+//________________________________________________________________________
+AliTPCdEdxCorrectionGrid::AliTPCdEdxCorrectionGrid()
+  : TObject()
+  , fLogBgMin(0)
+  , fLogBgInvStep(0)
+  , fSpline()
+  , fTanThetaMin(0)
+  , fTanThetaInvStep(0)
+  , fInvdEdxMin(0)
+  , fInvdEdxInvStep(0)
+  , fNTanTheta(0)
+  , fNInvdEdx(0)
+  , fEtaCorr()
+{
+  // default Constructor
+}
+
+//________________________________________________________________________
+AliTPCdEdxCorrectionGrid::~AliTPCdEdxCorrectionGrid()
+{
+  // dtor
+}
+
+//________________________________________________________________________
+Bool_t AliTPCdEdxCorrectionGrid::SetSpline(const TSpline *spline, Double_t bgMin, Double_t bgMax, Int_t nPoints)
+{
+  // Tabulate the spline at nPoints equidistant points in log(beta*gamma) within [bgMin, bgMax].
+  // A null spline removes the table.
+
+  fSpline.clear();
+  if (!spline)
+    return kTRUE;
+
+  if (bgMin <= 0 || bgMax <= bgMin || nPoints < 2) {
+    Printf("Error - AliTPCdEdxCorrectionGrid::SetSpline: Invalid range (%g, %g) or number of points %d!", bgMin, bgMax, nPoints);
+    return kFALSE;
+  }
+
+  fLogBgMin = TMath::Log(bgMin);
+  const Double_t step = (TMath::Log(bgMax) - fLogBgMin) / (nPoints - 1);
+  fLogBgInvStep = 1. / step;
+  fSpline.resize(nPoints);
+  for (Int_t i = 0; i < nPoints; i++)
+    fSpline[i] = spline->Eval(TMath::Exp(fLogBgMin + i * step));
+
+  return kTRUE;
+}
+
+//________________________________________________________________________
+Bool_t AliTPCdEdxCorrectionGrid::SetEtaCorrectionMap(const TH2 *map, Int_t nPointsX, Int_t nPointsY)
+{
+  // Sample the eta correction map (x: tanTheta, y: 1/dEdx_splines) on a regular grid
+  // of nPointsX x nPointsY points, by default one point per bin. The bin contents are
+  // used directly for an axis with uniform bins sampled once per bin, TH2::Interpolate
+  // otherwise. A null map removes the grid.
+
+  fEtaCorr.clear();
+  fNTanTheta = fNInvdEdx = 0;
+  if (!map)
+    return kTRUE;
+
+  const TAxis *xAxis = map->GetXaxis();
+  const TAxis *yAxis = map->GetYaxis();
+  fNTanTheta = GetGridPoints(xAxis, nPointsX, fTanThetaMin, fTanThetaInvStep);
+  fNInvdEdx = GetGridPoints(yAxis, nPointsY, fInvdEdxMin, fInvdEdxInvStep);
+
+  const Bool_t useBins = (xAxis->GetNbins() < 2 || (!xAxis->IsVariableBinSize() && fNTanTheta == xAxis->GetNbins())) &&
+                         (yAxis->GetNbins() < 2 || (!yAxis->IsVariableBinSize() && fNInvdEdx == yAxis->GetNbins()));
+
+  fEtaCorr.resize(fNTanTheta * fNInvdEdx);
+  for (Int_t i = 0; i < fNTanTheta; i++) {
+    const Double_t x = fTanThetaInvStep > 0 ? fTanThetaMin + i / fTanThetaInvStep : fTanThetaMin;
+    const Int_t binX = TMath::Min(i + 1, xAxis->GetNbins());
+    for (Int_t j = 0; j < fNInvdEdx; j++) {
+      const Double_t y = fInvdEdxInvStep > 0 ? fInvdEdxMin + j / fInvdEdxInvStep : fInvdEdxMin;
+      const Int_t binY = TMath::Min(j + 1, yAxis->GetNbins());
+      if (useBins)
+        fEtaCorr[i * fNInvdEdx + j] = map->GetBinContent(binX, binY);
+      else
+        fEtaCorr[i * fNInvdEdx + j] = map->Interpolate(x, y);
+    }
+  }
+
+  return kTRUE;
+}
+
+//________________________________________________________________________
+void AliTPCdEdxCorrectionGrid::EvalSpline(Int_t n, const Double_t *bg, Double_t *dEdx) const
+{
+  // Spline for n tracks
+
+  for (Int_t i = 0; i < n; i++)
+    dEdx[i] = EvalSpline(bg[i]);
+}
+
+//________________________________________________________________________
+void AliTPCdEdxCorrectionGrid::EvalEtaCorrection(Int_t n, const Double_t *tanTheta, const Double_t *invdEdx, Double_t *corr) const
+{
+  // Eta correction factors for n tracks
+
+  if (fEtaCorr.empty()) {
+    for (Int_t i = 0; i < n; i++)
+      corr[i] = 1.;
+    return;
+  }
+
+  for (Int_t i = 0; i < n; i++)
+    corr[i] = EvalEtaCorrection(tanTheta[i], invdEdx[i]);
+}
+
+//________________________________________________________________________
+void AliTPCdEdxCorrectionGrid::EvalExpected(Int_t n, const Double_t *bg, const Double_t *tanTheta, Double_t *dEdx) const
+{
+  // Expected dEdx for n tracks: spline times eta correction at 1/spline
+
+  EvalSpline(n, bg, dEdx);
+  if (fEtaCorr.empty())
+    return;
+
+  for (Int_t i = 0; i < n; i++) {
+    const Double_t invdEdx = dEdx[i] > 0 ? 1. / dEdx[i] : 0.;
+    dEdx[i] *= EvalEtaCorrection(tanTheta[i], invdEdx);
+  }
+}
@@ -0,0 +1,96 @@
+#ifndef ALITPCDEDXCORRECTIONGRID_H
+#define ALITPCDEDXCORRECTIONGRID_H
+
+/*
+Precomputed interpolation grids of a TPC dE/dx response spline and of an
+eta correction map, to evaluate them for whole arrays of tracks.
+
+The spline (dEdx vs beta*gamma) is tabulated at equidistant points in
+log(beta*gamma) and interpolated linearly. The eta correction map
+(tanTheta vs 1/dEdx_splines, as used by AliTPCPIDResponse) is sampled on a
+regular grid between the first and the last bin centres and interpolated
+bilinearly, the coordinates being clamped to that range. For a map with
+uniform bins and the default number of points the grid holds the bin
+contents, and the result is the one of TH2::Interpolate inside the map.
+*/
+
+#include <vector>
+#include <TMath.h>
+#include <TObject.h>
+
+class TH2;
+class TSpline;
+
+class AliTPCdEdxCorrectionGrid : public TObject {
+ public:
+  AliTPCdEdxCorrectionGrid();
+  virtual ~AliTPCdEdxCorrectionGrid();
+
+  Bool_t SetSpline(const TSpline *spline, Double_t bgMin = 0.1, Double_t bgMax = 1e4, Int_t nPoints = 20000);
+  Bool_t SetEtaCorrectionMap(const TH2 *map, Int_t nPointsX = 0, Int_t nPointsY = 0);
+
+  Bool_t HasSpline() const { return !fSpline.empty(); };
+  Bool_t HasEtaCorrectionMap() const { return !fEtaCorr.empty(); };
+
+  inline Double_t EvalSpline(Double_t bg) const;
+  inline Double_t EvalEtaCorrection(Double_t tanTheta, Double_t invdEdx) const;
+
+  // Batch evaluation for n tracks
+  void EvalSpline(Int_t n, const Double_t *bg, Double_t *dEdx) const;
+  void EvalEtaCorrection(Int_t n, const Double_t *tanTheta, const Double_t *invdEdx, Double_t *corr) const;
+  void EvalExpected(Int_t n, const Double_t *bg, const Double_t *tanTheta, Double_t *dEdx) const;
+
+ private:
+  Double_t fLogBgMin;         // log(beta*gamma) of the first spline point
+  Double_t fLogBgInvStep;     // 1 / distance of the spline points in log(beta*gamma)
+  std::vector<Double_t> fSpline; // Spline values
+
+  Double_t fTanThetaMin;      // tanTheta of the first map point
+  Double_t fTanThetaInvStep;  // 1 / distance of the map points in tanTheta (0 for a single bin)
+  Double_t fInvdEdxMin;       // 1/dEdx of the first map point
+  Double_t fInvdEdxInvStep;   // 1 / distance of the map points in 1/dEdx (0 for a single bin)
+  Int_t fNTanTheta;           // Number of map points in tanTheta
+  Int_t fNInvdEdx;            // Number of map points in 1/dEdx
+  std::vector<Double_t> fEtaCorr; // Map values, [iTanTheta * fNInvdEdx + iInvdEdx]
+
+  ClassDef(AliTPCdEdxCorrectionGrid, 1);
+};
+
+//________________________________________________________________________
+inline Double_t AliTPCdEdxCorrectionGrid::EvalSpline(Double_t bg) const
+{
+  // Spline at beta*gamma, constant outside the tabulated range
+
+  const Int_t n = fSpline.size();
+  if (n == 0 || bg <= 0)
+    return 0.;
+
+  Double_t u = (TMath::Log(bg) - fLogBgMin) * fLogBgInvStep;
+  u = TMath::Min(TMath::Max(u, 0.), (Double_t)(n - 1));
+  const Int_t i = TMath::Min((Int_t)u, n - 2);
+  const Double_t f = u - i;
+  return fSpline[i] * (1. - f) + fSpline[i + 1] * f;
+}
+
+//________________________________________________________________________
+inline Double_t AliTPCdEdxCorrectionGrid::EvalEtaCorrection(Double_t tanTheta, Double_t invdEdx) const
+{
+  // Eta correction factor at (tanTheta, 1/dEdx_splines), 1 without map
+
+  if (fEtaCorr.empty())
+    return 1.;
+
+  Double_t u = (tanTheta - fTanThetaMin) * fTanThetaInvStep;
+  Double_t v = (invdEdx - fInvdEdxMin) * fInvdEdxInvStep;
+  u = TMath::Min(TMath::Max(u, 0.), (Double_t)(fNTanTheta - 1));
+  v = TMath::Min(TMath::Max(v, 0.), (Double_t)(fNInvdEdx - 1));
+  const Int_t i = TMath::Min((Int_t)u, fNTanTheta - 2);
+  const Int_t j = TMath::Min((Int_t)v, fNInvdEdx - 2);
+  const Double_t fu = u - i;
+  const Double_t fv = v - j;
+  const Double_t *row0 = &fEtaCorr[i * fNInvdEdx + j];
+  const Double_t *row1 = row0 + fNInvdEdx;
+  return (row0[0] * (1. - fv) + row0[1] * fv) * (1. - fu) + (row1[0] * (1. - fv) + row1[1] * fv) * fu;
+}
+
+#endif
@@ -25,6 +25,7 @@ marian.ivanov@cern.ch
 #if !defined(__CINT__) || defined(__MAKECINT__)
 #include <stdio.h>
 #include <string.h>
+#include <algorithm>
 //ROOT includes
 #include "TROOT.h"
 #include "Rtypes.h"
@@ -41,6 +42,9 @@ marian.ivanov@cern.ch
 #include "TVector3.h"
 #include "TH1F.h"
 #include "TH2F.h"
+#include "TH3.h"
+#include "TTreeFormula.h"
+#include "TTreeFormulaManager.h"
 #include "TCanvas.h"
 #include "TPad.h"
 #include "TF1.h"
@@ -65,6 +69,29 @@ marian.ivanov@cern.ch
 
 ClassImp(AliTreeDraw)
 
+namespace {
+  std::vector<TString> SplitDrawExpression(const char * expression){
+    //
+    // split "z:y:x" at the colons outside brackets, "::" is kept
+    //
+    std::vector<TString> vars;
+    TString expr(expression);
+    Int_t depth=0, start=0;
+    for (Int_t i=0; i<expr.Length(); i++){
+      const char c = expr[i];
+      if (c=='(' || c=='[') depth++;
+      else if (c==')' || c==']') depth--;
+      else if (c==':' && depth==0){
+        if (i+1<expr.Length() && expr[i+1]==':') { i++; continue; }
+        vars.push_back(TString(expr(start,i-start)));
+        start=i+1;
+      }
+    }
+    vars.push_back(TString(expr(start,expr.Length()-start)));
+    return vars;
+  }
+}
+
 
 AliTreeDraw::AliTreeDraw():
   fTree(0),
@@ -96,8 +123,11 @@ TH1F * AliTreeDraw::DrawXY(const char * chx, const char *chy, const char* select
   char cut[1000];
   snprintf(cut,1000,"%s&&%s",selection,quality);
   char expression[1000];
-  snprintf(expression,1000,"%s:%s>>hRes2",chy,chx);
-  fTree->Draw(expression, cut, "groff");
+  snprintf(expression,1000,"%s:%s",chy,chx);
+  AliTreeDraw draw;
+  draw.SetTree(fTree);
+  draw.AddProjection(hRes2, expression, cut);
+  draw.FillProjections();
   TH1F* hMean=0;
   TH1F* hRes = CreateResHisto(hRes2, &hMean);
   AliLabelAxes(hRes, chx, chy);
@@ -123,8 +153,11 @@ TH1F * AliTreeDraw::DrawLogXY(const char * chx, const char *chy, const char* sel
   char cut[1000];
   snprintf(cut,1000,"%s&&%s",selection,quality);
   char expression[1000];
-  snprintf(expression,1000,"%s:%s>>hRes2",chy,chx);
-  fTree->Draw(expression, cut, "groff");
+  snprintf(expression,1000,"%s:%s",chy,chx);
+  AliTreeDraw draw;
+  draw.SetTree(fTree);
+  draw.AddProjection(hRes2, expression, cut);
+  draw.FillProjections();
   TH1F* hMean=0;  
   TH1F* hRes = CreateResHisto(hRes2, &hMean);
   AliLabelAxes(hRes, chx, chy);
@@ -146,14 +179,14 @@ TH1F * AliTreeDraw::Eff(const char *variable, const char* selection, const char
   //
   TH1F* hGen = new TH1F("hGen", "gen. tracks", nbins, min, max);
   TH1F* hRec = new TH1F("hRec", "rec. tracks", nbins, min, max);
-  char inputGen[1000];  
-  snprintf(inputGen,1000,"%s>>hGen", variable);
-  fTree->Draw(inputGen, selection, "groff");
   char selectionRec[256];
   snprintf(selectionRec,256, "%s && %s", selection, quality);
-  char inputRec[1000];  
-  snprintf(inputRec,1000,"%s>>hRec", variable);
-  fTree->Draw(inputRec, selectionRec, "groff");
+  // generated and reconstructed tracks in one pass
+  AliTreeDraw draw;
+  draw.SetTree(fTree);
+  draw.AddProjection(hGen, variable, selection);
+  draw.AddProjection(hRec, variable, selectionRec);
+  draw.FillProjections();
   //
   TH1F* hEff = CreateEffHisto(hGen, hRec);
   AliLabelAxes(hEff, variable, "#epsilon [%]");
@@ -175,14 +208,14 @@ TH1F * AliTreeDraw::EffLog(const char *variable, const char* selection, const ch
   Double_t* bins = CreateLogBins(nbins, min, max);
   TH1F* hGen = new TH1F("hGen", "gen. tracks", nbins, bins);
   TH1F* hRec = new TH1F("hRec", "rec. tracks", nbins, bins);
-  char inputGen[1000];  
-  snprintf(inputGen,1000,"%s>>hGen", variable);
-  fTree->Draw(inputGen, selection, "groff");
   char selectionRec[256];
   snprintf(selectionRec,256, "%s && %s", selection, quality);
-  char inputRec[1000];  
-  snprintf(inputRec,1000,"%s>>hRec", variable);
-  fTree->Draw(inputRec, selectionRec, "groff");
+  // generated and reconstructed tracks in one pass
+  AliTreeDraw draw;
+  draw.SetTree(fTree);
+  draw.AddProjection(hGen, variable, selection);
+  draw.AddProjection(hRec, variable, selectionRec);
+  draw.FillProjections();
   //
   TH1F* hEff = CreateEffHisto(hGen, hRec);
   AliLabelAxes(hEff, variable, "#epsilon [%]");
@@ -623,38 +656,18 @@ TString* AliTreeDraw::FitPlane(const char* drawCommand, const char* formula, con
    fitter->StoreData(kTRUE);   
    fitter->ClearPoints();
    
-   Int_t entries = fTree->Draw(drawStr.Data(), cutStr.Data(), "goff",  stop-start, start);
-   if (entries == -1) return new TString("An ERROR has occured during fitting!");
-   Double_t **values = new Double_t*[dim+1] ; 
-
-   for (Int_t i = 0; i < dim + 1; i++) {
-      values[i] = 0;
-   }
-
-   for (Int_t i = 0; i < dim + 1; i++) {
-      Int_t centries = 0;
-      if (i < dim) centries = fTree->Draw(((TObjString*)formulaTokens->At(i))->GetName(), cutStr.Data(), "goff", stop-start,start);
-      else  centries = fTree->Draw(drawStr.Data(), cutStr.Data(), "goff", stop-start,start);
-
-      if (entries != centries) { 
-	for (Int_t j = 0; j < dim + 1; j++) {
-          if(values[j]) delete values[j];
-	} 
-        delete[] values;
-        return new TString("An ERROR has occured during fitting!");
-      }
-      else {
-        values[i] = new Double_t[entries];
-        memcpy(values[i],  fTree->GetV1(), entries*sizeof(Double_t)); 
-      }
-   }
-   
-   // add points to the fitter
-   for (Int_t i = 0; i < entries; i++) {
-      Double_t x[1000];
-      for (Int_t j=0; j<dim;j++) x[j]=values[j][i];
-      fitter->AddPoint(x, values[dim][i], 1);
+   // the fit variables and the fitted value are evaluated in one pass
+   std::vector<TString> vars;
+   for (Int_t i = 0; i < dim; i++) vars.push_back(((TObjString*)formulaTokens->At(i))->GetName());
+   vars.push_back(drawStr);
+   AliTreeDraw draw;
+   draw.SetTree(fTree);
+   if (draw.AddProjection(0, fitter, vars, cutStr.Data()) < 0) {
+      delete formulaTokens;
+      delete fitter;
+      return new TString("An ERROR has occured during fitting!");
    }
+   draw.FillProjections(stop-start, start);
 
    fitter->Eval();
    fitter->GetParameters(fitParam);
@@ -670,10 +683,128 @@ TString* AliTreeDraw::FitPlane(const char* drawCommand, const char* formula, con
    returnFormula.Append(" )");
    delete formulaTokens;
    delete fitter;
-
-   for (Int_t i = 0; i < dim + 1; i++) {
-     delete[] values[i];
-   }
-   delete[] values;
    return preturnFormula;
 }
+
+
+
+Int_t AliTreeDraw::AddProjection(TH1 * histo, const char * expression, const char * selection){
+  //
+  // register the projection of expression for the entries passing selection
+  // into histo, the dimension of histo has to match the expression
+  // the histogram is filled by FillProjections together with the other ones
+  // returns the index of the projection, -1 for an invalid expression
+  //
+  if (!histo || !expression) return -1;
+  std::vector<TString> vars = SplitDrawExpression(expression);
+  if ((Int_t)vars.size() != histo->GetDimension()) {
+    Error("AddProjection","%s: %d variables for the %d dimensional histogram %s",expression,(Int_t)vars.size(),histo->GetDimension(),histo->GetName());
+    return -1;
+  }
+  // TTree::Draw order: the last variable is x
+  std::reverse(vars.begin(), vars.end());
+  return AddProjection(histo, 0, vars, selection);
+}
+
+
+
+Int_t AliTreeDraw::AddProjection(TH1 * histo, TLinearFitter * fitter, const std::vector<TString> & vars, const char * selection){
+  //
+  // create the formulas of one projection
+  //
+  if (!fTree || vars.empty()) return -1;
+  if (fTree->GetTree()==0) fTree->LoadTree(0);
+  const Int_t index = fProjections.size();
+  Projection proj;
+  proj.fHisto = histo;
+  proj.fFitter = fitter;
+  proj.fSelection = 0;
+  proj.fManager = new TTreeFormulaManager;
+  Bool_t ok = kTRUE;
+  for (UInt_t i=0; i<vars.size(); i++){
+    TTreeFormula * var = new TTreeFormula(Form("proj%d_var%d",index,i), vars[i].Data(), fTree);
+    proj.fVars.push_back(var);
+    proj.fManager->Add(var);
+    if (var->GetNdim()==0) ok = kFALSE;
+  }
+  if (selection && selection[0]){
+    proj.fSelection = new TTreeFormula(Form("proj%d_sel",index), selection, fTree);
+    proj.fManager->Add(proj.fSelection);
+    if (proj.fSelection->GetNdim()==0) ok = kFALSE;
+  }
+  if (!ok){
+    // the manager is deleted with the last formula
+    for (UInt_t i=0; i<proj.fVars.size(); i++) delete proj.fVars[i];
+    delete proj.fSelection;
+    return -1;
+  }
+  proj.fManager->Sync();
+  fProjections.push_back(proj);
+  return index;
+}
+
+
+
+Long64_t AliTreeDraw::FillProjections(Long64_t nentries, Long64_t firstentry, Int_t nIMTThreads){
+  //
+  // fill all the registered projections in one loop over the tree
+  // the branches used by the formulas are read through the TTreeCache,
+  // with nIMTThreads>0 the baskets are decompressed by the ROOT thread pool
+  // returns the number of entries processed
+  //
+  if (!fTree || fProjections.empty()) return 0;
+  if (nIMTThreads>0 && !ROOT::IsImplicitMTEnabled()) ROOT::EnableImplicitMT(nIMTThreads);
+  if (fTree->GetCacheSize()<=0) fTree->SetCacheSize(30000000);
+
+  Double_t x[1000];
+  Int_t treeNumber = -1;
+  Long64_t nprocessed = 0;
+  for (Long64_t ientry=firstentry; ientry<firstentry+nentries; ientry++){
+    const Long64_t entry = fTree->GetEntryNumber(ientry);
+    if (entry<0) break;
+    if (fTree->LoadTree(entry)<0) break;
+    if (fTree->GetTreeNumber()!=treeNumber){
+      // new tree of a chain
+      treeNumber = fTree->GetTreeNumber();
+      for (UInt_t ip=0; ip<fProjections.size(); ip++){
+        Projection & proj = fProjections[ip];
+        for (UInt_t i=0; i<proj.fVars.size(); i++) proj.fVars[i]->UpdateFormulaLeaves();
+        if (proj.fSelection) proj.fSelection->UpdateFormulaLeaves();
+        proj.fManager->Sync();
+      }
+    }
+    nprocessed++;
+    for (UInt_t ip=0; ip<fProjections.size(); ip++){
+      Projection & proj = fProjections[ip];
+      const Int_t nvars = TMath::Min((Int_t)proj.fVars.size(), 1000);
+      const Int_t ndata = proj.fManager->GetNdata();
+      for (Int_t i=0; i<ndata; i++){
+        Double_t w = 1.;
+        if (proj.fSelection){
+          w = proj.fSelection->EvalInstance(i);
+          if (w==0.) continue;
+        }
+        for (Int_t j=0; j<nvars; j++) x[j] = proj.fVars[j]->EvalInstance(i);
+        if (proj.fFitter) proj.fFitter->AddPoint(x, x[nvars-1], 1);
+        else if (nvars==1) proj.fHisto->Fill(x[0], w);
+        else if (nvars==2) ((TH2*)proj.fHisto)->Fill(x[0], x[1], w);
+        else ((TH3*)proj.fHisto)->Fill(x[0], x[1], x[2], w);
+      }
+    }
+  }
+  return nprocessed;
+}
+
+
+
+void AliTreeDraw::ClearProjections(){
+  //
+  // delete the formulas of the registered projections, the outputs are kept
+  //
+  for (UInt_t ip=0; ip<fProjections.size(); ip++){
+    Projection & proj = fProjections[ip];
+    for (UInt_t i=0; i<proj.fVars.size(); i++) delete proj.fVars[i];
+    delete proj.fSelection;
+  }
+  fProjections.clear();
+}
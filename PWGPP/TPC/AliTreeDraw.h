@@ -13,6 +13,8 @@
 
 
 
+#include <vector>
+
 #include <TObject.h>
 #include <TObjArray.h>
 #include "TLinearFitter.h"
@@ -22,11 +24,13 @@ class TH1F;
 class TH2F;
 class TTree;
 class TString;
+class TTreeFormula;
+class TTreeFormulaManager;
 
 class AliTreeDraw: public TObject{
 public:
   AliTreeDraw();
-  ~AliTreeDraw(){;}
+  ~AliTreeDraw(){ClearProjections();}
   TTree * T() { return fTree;}
   void SetTree(TTree *tree){fTree=tree;}
   const TH1 * GetRes() const{ return (TH1*)fRes;}
@@ -36,6 +40,14 @@ public:
   void  ClearPoints(){if (fPoints) fPoints->Clear();}
   TString* FitPlane(const char* drawCommand, const char* formula, const char* cuts, Double_t & chi2, TVectorD &fitParam, TMatrixD &covMatrix, Int_t start=0, Int_t stop=10000000);
 
+  //
+  // single pass projections: the expressions ("x", "y:x", "z:y:x" as in TTree::Draw)
+  // registered with AddProjection are all filled in one loop over the tree
+  Int_t AddProjection(TH1 * histo, const char * expression, const char * selection="");
+  Long64_t FillProjections(Long64_t nentries=1000000000, Long64_t firstentry=0, Int_t nIMTThreads=0);
+  void  ClearProjections();
+  Int_t GetNProjections() const { return fProjections.size(); }
+
 
   //
   TH1F * DrawXY(const char * chx, const char *chy, const char* selection, 
@@ -65,13 +77,24 @@ public:
 
 
 private:
-  AliTreeDraw(const AliTreeDraw& /*t*/):TObject(),fTree(0),fRes(0),fMean(0),fPoints(0){;}
+  // formulas of one registered projection, filled into a histogram or a linear fitter
+  struct Projection {
+    TH1 * fHisto;                        // output histogram - NOT OWNER
+    TLinearFitter * fFitter;             // output fitter, the last variable is the fitted value - NOT OWNER
+    std::vector<TTreeFormula*> fVars;    // variables in the order x, y, z - OWNER
+    TTreeFormula * fSelection;           // selection, the value is the weight - OWNER
+    TTreeFormulaManager * fManager;      // synchronizes the instances of the formulas
+  };
+  Int_t AddProjection(TH1 * histo, TLinearFitter * fitter, const std::vector<TString> & vars, const char * selection);
+
+  AliTreeDraw(const AliTreeDraw& /*t*/):TObject(),fTree(0),fRes(0),fMean(0),fPoints(0),fProjections(){;}
     AliTreeDraw & operator=(const AliTreeDraw & /*t*/){return *this;}
 
   TTree * fTree;    //the tree for visualization - NOT OWNER
   TH1F  * fRes;     //temporary histogram        - OWNER  
   TH1F  * fMean;    //temporary histogram        - OWNER
   TObjArray *fPoints;//                          - OWNER
+  std::vector<Projection> fProjections; //registered single pass projections
   ClassDef(AliTreeDraw,0)
 };
 
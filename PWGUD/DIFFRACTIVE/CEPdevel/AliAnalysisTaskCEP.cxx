@@ -68,6 +68,7 @@ AliAnalysisTaskCEP::AliAnalysisTaskCEP(const char* name,
   , fETpatternNDG(ETpatternNDG)
   , fTTmask(TTmask)
   , fTTpattern(TTpattern)
+  , fPackedTracks(kFALSE)
   , fisSTGTriggerFired(0)
   , fnTOFmaxipads(0)
   , fRun(-1)
@@ -129,6 +130,7 @@ AliAnalysisTaskCEP::AliAnalysisTaskCEP():
   , fETpatternNDG(AliCEPBase::kETBaseLine)
   , fTTmask(AliCEPBase::kTTBaseLine)
   , fTTpattern(AliCEPBase::kTTBaseLine)
+  , fPackedTracks(kFALSE)
   , fisSTGTriggerFired(0)
   , fnTOFmaxipads(0)
   , fRun(-1)
@@ -303,6 +305,7 @@ void AliAnalysisTaskCEP::UserCreateOutputObjects()
   // initialisize some variables
   // fCEPEvent
   fCEPEvent = new CEPEventBuffer();
+  fCEPEvent->SetUsePackedTracks(fPackedTracks);
   // fTracks
   fTracks = new TObjArray();
   // fTrl2Tr
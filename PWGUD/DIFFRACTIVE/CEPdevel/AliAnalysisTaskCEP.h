@@ -73,6 +73,8 @@ public:
   void setETpatternNDG(UInt_t pattern) { fETpatternNDG = pattern; }
   void setTTmask(UInt_t mask) { fTTmask = mask; }
   void setTTpattern(UInt_t pattern) { fTTpattern = pattern; }
+  // store the tracks of the CEPEvents as packed records
+  void setPackedTracks(Bool_t packed) { fPackedTracks = packed; }
   
 private:
 
@@ -95,6 +97,7 @@ private:
   UInt_t fETmaskDG,  fETpatternDG;
   UInt_t fETmaskNDG, fETpatternNDG;
   UInt_t fTTmask, fTTpattern;
+  Bool_t fPackedTracks;
   
   // some hit information
   UInt_t fisSTGTriggerFired;
@@ -147,7 +150,7 @@ private:
 	TList *fHist;         //! output list (contains all histograms)
 	TTree *fCEPtree;      //! Tree containing the detailed information
 
-	ClassDef(AliAnalysisTaskCEP, 1);
+	ClassDef(AliAnalysisTaskCEP, 2);
   
 };
 
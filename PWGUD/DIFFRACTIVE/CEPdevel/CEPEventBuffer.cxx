@@ -51,6 +51,9 @@ CEPEventBuffer::CEPEventBuffer()
   , fMCProcessType(AliCEPBase::kdumval)
   , fMCVtxPos(TVector3(CEPTrackBuffer::kdumval,CEPTrackBuffer::kdumval,CEPTrackBuffer::kdumval))
   , fCEPTracks(new TObjArray())
+  , fUsePackedTracks(kFALSE)
+  , fPackedTracks()
+  , fUnpackedTracks(0x0)
 {
 
   for (Int_t ii=0; ii<6; ii++) fnITSCluster[ii] = 0;
@@ -69,6 +72,11 @@ CEPEventBuffer::~CEPEventBuffer()
 		delete fCEPTracks;
 		fCEPTracks = 0x0;
 	}
+  if (fUnpackedTracks) {
+		fUnpackedTracks->SetOwner(kTRUE);
+		delete fUnpackedTracks;
+		fUnpackedTracks = 0x0;
+	}
 
 	// delete fTrl2Tr and all the associations it contains
   if (fTrl2Tr) {
@@ -125,12 +133,19 @@ void CEPEventBuffer::Reset()
   // clear the track list
   fCEPTracks->SetOwner(kTRUE);
   fCEPTracks->Clear();
+  fPackedTracks.clear();
  }
 
 // ----------------------------------------------------------------------------
 void CEPEventBuffer::AddTrack(CEPTrackBuffer* trk)
 {
   
+  if (fUsePackedTracks) {
+    AddPackedTrack(*trk);
+    delete trk;
+    return;
+  }
+
   // add track to next element
   fCEPTracks->Add(trk);
   fnTracks++;
@@ -144,6 +159,39 @@ void CEPEventBuffer::AddTrack(CEPTrackBuffer* trk)
   
 }
 
+// ----------------------------------------------------------------------------
+void CEPEventBuffer::AddPackedTrack(const CEPTrackBuffer& trk)
+{
+
+  // append the record of trk
+  size_t pos = fPackedTracks.size();
+  fPackedTracks.resize(pos+CEPTrackBuffer::kPackedSize);
+  trk.Pack(&fPackedTracks[pos]);
+  fnTracks++;
+
+  // update track counters
+  if (trk.GetTrackStatus() & AliCEPBase::kTTITSpure) {
+    fnTracksITSpure++;
+  } else {
+    fnTracksCombined++;
+  }
+
+}
+
+// ----------------------------------------------------------------------------
+UInt_t CEPEventBuffer::GetTrackStatus(Int_t ind)
+{
+
+  // the status is the second word of the packed record,
+  // no need to unpack the full track
+  if (fUsePackedTracks) {
+    const UChar_t *rec = &fPackedTracks[ind*CEPTrackBuffer::kPackedSize+4];
+    return rec[0] | (rec[1]<<8) | (rec[2]<<16) | ((UInt_t)rec[3]<<24);
+  }
+  return GetTrack(ind)->GetTrackStatus();
+
+}
+
 // ----------------------------------------------------------------------------
 CEPTrackBuffer* CEPEventBuffer::GetTrack(Int_t ind)
 {
@@ -151,6 +199,27 @@ CEPTrackBuffer* CEPEventBuffer::GetTrack(Int_t ind)
   // initialize the result track
   CEPTrackBuffer *trk = NULL;
 
+  if (fUsePackedTracks) {
+    if (ind < 0 ||
+      (size_t)ind >= fPackedTracks.size()/CEPTrackBuffer::kPackedSize)
+      return trk;
+
+    // the unpacked tracks are reused from event to event
+    if (!fUnpackedTracks) {
+      fUnpackedTracks = new TObjArray();
+      fUnpackedTracks->SetOwner(kTRUE);
+    }
+    if (fUnpackedTracks->GetSize() <= ind) fUnpackedTracks->Expand(ind+1);
+    trk = (CEPTrackBuffer*) fUnpackedTracks->At(ind);
+    if (!trk) {
+      trk = new CEPTrackBuffer();
+      fUnpackedTracks->AddAt(trk,ind);
+    }
+    trk->Unpack(&fPackedTracks[ind*CEPTrackBuffer::kPackedSize]);
+    
+    return trk;
+  }
+
   if (fCEPTracks->GetEntries() > ind) {
     trk = (CEPTrackBuffer*) fCEPTracks->At(ind);
   }
@@ -168,6 +237,24 @@ Bool_t CEPEventBuffer::RemoveTrack(Int_t ind)
   Bool_t done = kFALSE;
   CEPTrackBuffer *trk = NULL;
 
+  if (fUsePackedTracks) {
+    if (ind < 0 || ind >= fnTracks) return done;
+    
+    // update track counters
+    fnTracks--;
+    if (GetTrackStatus(ind) & AliCEPBase::kTTITSpure) {
+      fnTracksITSpure--;
+    } else {
+      fnTracksCombined--;
+    }
+    
+    std::vector<UChar_t>::iterator rec =
+      fPackedTracks.begin() + ind*CEPTrackBuffer::kPackedSize;
+    fPackedTracks.erase(rec,rec+CEPTrackBuffer::kPackedSize);
+    
+    return kTRUE;
+  }
+
   if (fCEPTracks->GetEntries() > ind) {
     trk = (CEPTrackBuffer*) fCEPTracks->RemoveAt(ind);
     fCEPTracks->Compress();
@@ -200,7 +287,7 @@ Int_t CEPEventBuffer::GetnTracks(UInt_t mask, UInt_t pattern)
   Int_t ngood = 0;
   
   for (Int_t ii=0; ii<GetnTracks(); ii++) {
-    if ((GetTrack(ii)->GetTrackStatus() & mask) == pattern) ngood++;
+    if ((GetTrackStatus(ii) & mask) == pattern) ngood++;
   }
   
   return ngood;
@@ -217,7 +304,7 @@ Int_t CEPEventBuffer::GetnTracks(UInt_t mask, UInt_t pattern, TArrayI *indices)
   indices->Set(GetnTracks());
   
   for (Int_t ii=0; ii<GetnTracks(); ii++) {
-    if ((GetTrack(ii)->GetTrackStatus() & mask) == pattern) {
+    if ((GetTrackStatus(ii) & mask) == pattern) {
     
       // increment the counter
       ngood++;
@@ -253,7 +340,7 @@ Int_t CEPEventBuffer::GetnTracks(TArrayI *masks, TArrayI *patterns)
     ktmp = kFALSE;
     for (Int_t jj=0; jj<ntests;jj++) {
       
-      if ((GetTrack(ii)->GetTrackStatus() & masks->At(jj)) ==
+      if ((GetTrackStatus(ii) & masks->At(jj)) ==
         patterns->At(jj)) {
         ktmp = kTRUE;
         break;
@@ -291,7 +378,7 @@ Int_t CEPEventBuffer::GetnTracks(TArrayI *masks, TArrayI *patterns,
     ktmp = kFALSE;
     for (Int_t jj=0; jj<ntests;jj++) {
       
-      if ((GetTrack(ii)->GetTrackStatus() & masks->At(jj)) ==
+      if ((GetTrackStatus(ii) & masks->At(jj)) ==
         patterns->At(jj)) {
         ktmp = kTRUE;
         break;
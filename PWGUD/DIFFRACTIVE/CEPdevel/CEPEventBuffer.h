@@ -1,6 +1,7 @@
 #ifndef CEPEVENTBUFFER
 #define CEPEVENTBUFFER
 
+#include <vector>
 #include "TObject.h"
 #include "TObjArray.h"
 #include "TArrayI.h"
@@ -78,9 +79,14 @@ class CEPEventBuffer : public TObject {
     
     // list of tracks
     TObjArray *fCEPTracks;
+    // tracks as fixed size records, see SetUsePackedTracks
+    Bool_t fUsePackedTracks;
+    std::vector<UChar_t> fPackedTracks;
+    TObjArray *fUnpackedTracks; //! tracks returned by GetTrack in packed mode
     // tracklet - track associations
     TObjArray *fTrl2Tr;
     
+    UInt_t GetTrackStatus(Int_t ind);
     
   public:
     CEPEventBuffer();
@@ -117,6 +123,17 @@ class CEPEventBuffer : public TObject {
     // fnTracks, fnTracksCombined, and fnTracksITSpure are incremented
     // automatically when tracks are added with the method AddTrack
     void AddTrack(CEPTrackBuffer* trk);
+
+    // with packed tracks each track is stored as a CEPTrackBuffer::Pack
+    // record instead of a CEPTrackBuffer object, which saves the
+    // per object streaming when the tree is filled and read
+    // AddTrack then packs and deletes trk, AddPackedTrack packs a track
+    // which stays with the caller
+    // the tracks returned by GetTrack are per event copies, changes to
+    // them are not stored
+    void SetUsePackedTracks(Bool_t usepacked) { fUsePackedTracks = usepacked; }
+    Bool_t GetUsePackedTracks() const   { return fUsePackedTracks; }
+    void AddPackedTrack(const CEPTrackBuffer& trk);
     
     // the number of tracklets and residuals, as well as the enumber
     // of tracks passing Martin's selection have to be set separately
@@ -245,7 +262,7 @@ class CEPEventBuffer : public TObject {
     CEPTrackBuffer* GetTrack(Int_t ind);
     Bool_t RemoveTrack(Int_t ind);
 
-    ClassDef(CEPEventBuffer, 5)     // CEP event buffer
+    ClassDef(CEPEventBuffer, 6)     // CEP event buffer
 
 };
 
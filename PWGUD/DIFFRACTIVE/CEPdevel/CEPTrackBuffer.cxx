@@ -9,6 +9,8 @@
 //
 //
 // ----------------------------------------------------------------------------
+#include <cstring>
+#include "TMath.h"
 #include "AliCEPBase.h"
 #include "CEPTrackBuffer.h"
 
@@ -319,3 +321,180 @@ Float_t CEPTrackBuffer::GetPIDBayesProbability(Int_t part)
 }
 
 // ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// packed track record
+// all values are written little endian, nSigmas with a resolution of 0.01
+// (|nSigma| < 327) and probabilities of 1/65534, the dummy value
+// kdumval is kept as a reserved code
+namespace {
+
+  const Short_t  kPackedNoNSigma = -32768;
+  const UShort_t kPackedNoProb   = 65535;
+
+  void PutU8(UChar_t *&buf, UChar_t val)  { *buf++ = val; }
+  void PutU16(UChar_t *&buf, UShort_t val)
+  {
+    *buf++ = val & 0xFF;
+    *buf++ = val >> 8;
+  }
+  void PutU32(UChar_t *&buf, UInt_t val)
+  {
+    for (Int_t ii=0; ii<4; ii++) *buf++ = (val >> (8*ii)) & 0xFF;
+  }
+  void PutF32(UChar_t *&buf, Float_t val)
+  {
+    UInt_t ival;
+    memcpy(&ival,&val,sizeof(ival));
+    PutU32(buf,ival);
+  }
+  void PutShort(UChar_t *&buf, Int_t val)
+  {
+    // integer values which fit in 16 bits, like module indices and cluster numbers
+    PutU16(buf,(UShort_t)(Short_t)TMath::Max(-32768,TMath::Min(32767,val)));
+  }
+  void PutNSigma(UChar_t *&buf, Float_t nsig)
+  {
+    Short_t code = kPackedNoNSigma;
+    if (nsig != CEPTrackBuffer::kdumval)
+      code = (Short_t)TMath::Nint(TMath::Max(-327.67,TMath::Min(327.67,(Double_t)nsig))*100.);
+    PutU16(buf,(UShort_t)code);
+  }
+  void PutProb(UChar_t *&buf, Float_t prob)
+  {
+    UShort_t code = kPackedNoProb;
+    if (prob != CEPTrackBuffer::kdumval)
+      code = (UShort_t)TMath::Nint(TMath::Max(0.,TMath::Min(1.,(Double_t)prob))*65534.);
+    PutU16(buf,code);
+  }
+
+  UChar_t GetU8(const UChar_t *&buf) { return *buf++; }
+  UShort_t GetU16(const UChar_t *&buf)
+  {
+    UShort_t val = buf[0] | (buf[1] << 8);
+    buf += 2;
+    return val;
+  }
+  UInt_t GetU32(const UChar_t *&buf)
+  {
+    UInt_t val = 0;
+    for (Int_t ii=0; ii<4; ii++) val |= ((UInt_t)buf[ii]) << (8*ii);
+    buf += 4;
+    return val;
+  }
+  Float_t GetF32(const UChar_t *&buf)
+  {
+    UInt_t ival = GetU32(buf);
+    Float_t val;
+    memcpy(&val,&ival,sizeof(val));
+    return val;
+  }
+  Int_t GetShort(const UChar_t *&buf) { return (Short_t)GetU16(buf); }
+  Float_t GetNSigma(const UChar_t *&buf)
+  {
+    Short_t code = (Short_t)GetU16(buf);
+    return (code == kPackedNoNSigma) ? (Float_t)CEPTrackBuffer::kdumval : code/100.;
+  }
+  Float_t GetProb(const UChar_t *&buf)
+  {
+    UShort_t code = GetU16(buf);
+    return (code == kPackedNoProb) ? (Float_t)CEPTrackBuffer::kdumval : code/65534.;
+  }
+
+}
+
+// ----------------------------------------------------------------------------
+void CEPTrackBuffer::Pack(UChar_t *buf) const
+{
+  // write the track into the kPackedSize bytes of buf
+
+  // general information
+  PutU32(buf,fTrackIndex);
+  PutU32(buf,fTrackStatus);
+  PutShort(buf,TMath::Nint(fTOFBunchCrossing));
+  PutU8(buf,(UChar_t)(Char_t)fChargeSign);
+  PutF32(buf,fGoldenChi2);
+  for (Int_t ii=0; ii<12; ii++) PutShort(buf,fITSModule[ii]);
+  PutU8(buf,fITSncls);
+  PutShort(buf,fTPCncls);
+  PutShort(buf,fTRDncls);
+  PutShort(buf,fTPCnclsS);
+  PutU8(buf,finVertex);
+  PutF32(buf,fXYv);
+  PutF32(buf,fZv);
+  PutF32(buf,fMomentum.X());
+  PutF32(buf,fMomentum.Y());
+  PutF32(buf,fMomentum.Z());
+
+  // PID information
+  PutF32(buf,fPID);
+  const Float_t *stat[3]   = { &fPIDITSStatus, &fPIDTPCStatus, &fPIDTOFStatus };
+  const Float_t *signal[3] = { &fPIDITSSignal, &fPIDTPCSignal, &fPIDTOFSignal };
+  const Float_t *nsig[3]   = { fPIDITSnSigma, fPIDTPCnSigma, fPIDTOFnSigma };
+  const Float_t *prob[3]   = { fPIDITSnSigmaProb, fPIDTPCnSigmaProb, fPIDTOFnSigmaProb };
+  for (Int_t idet=0; idet<3; idet++) {
+    PutU8(buf,(UChar_t)(Char_t)TMath::Nint(*stat[idet]));
+    PutF32(buf,*signal[idet]);
+    for (Int_t ii=0; ii<AliPID::kSPECIES; ii++) PutNSigma(buf,nsig[idet][ii]);
+    for (Int_t ii=0; ii<AliPID::kSPECIES; ii++) PutProb(buf,prob[idet][ii]);
+  }
+  PutU8(buf,(UChar_t)(Char_t)TMath::Nint(fPIDBayesStatus));
+  for (Int_t ii=0; ii<AliPID::kSPECIES; ii++) PutProb(buf,fPIDBayesProb[ii]);
+
+  // MC truth
+  PutU32(buf,(UInt_t)fMCPID);
+  PutF32(buf,fMCMass);
+  PutF32(buf,fMCMomentum.X());
+  PutF32(buf,fMCMomentum.Y());
+  PutF32(buf,fMCMomentum.Z());
+}
+
+// ----------------------------------------------------------------------------
+void CEPTrackBuffer::Unpack(const UChar_t *buf)
+{
+  // read the track from a record written by Pack
+
+  // general information
+  fTrackIndex       = GetU32(buf);
+  fTrackStatus      = GetU32(buf);
+  fTOFBunchCrossing = GetShort(buf);
+  fChargeSign       = (Char_t)GetU8(buf);
+  fGoldenChi2       = GetF32(buf);
+  for (Int_t ii=0; ii<12; ii++) fITSModule[ii] = GetShort(buf);
+  fITSncls          = GetU8(buf);
+  fTPCncls          = GetShort(buf);
+  fTRDncls          = GetShort(buf);
+  fTPCnclsS         = GetShort(buf);
+  finVertex         = GetU8(buf);
+  fXYv              = GetF32(buf);
+  fZv               = GetF32(buf);
+  Float_t px = GetF32(buf);
+  Float_t py = GetF32(buf);
+  Float_t pz = GetF32(buf);
+  fMomentum.SetXYZ(px,py,pz);
+
+  // PID information
+  fPID = GetF32(buf);
+  Float_t *stat[3]   = { &fPIDITSStatus, &fPIDTPCStatus, &fPIDTOFStatus };
+  Float_t *signal[3] = { &fPIDITSSignal, &fPIDTPCSignal, &fPIDTOFSignal };
+  Float_t *nsig[3]   = { fPIDITSnSigma, fPIDTPCnSigma, fPIDTOFnSigma };
+  Float_t *prob[3]   = { fPIDITSnSigmaProb, fPIDTPCnSigmaProb, fPIDTOFnSigmaProb };
+  for (Int_t idet=0; idet<3; idet++) {
+    *stat[idet]   = (Char_t)GetU8(buf);
+    *signal[idet] = GetF32(buf);
+    for (Int_t ii=0; ii<AliPID::kSPECIES; ii++) nsig[idet][ii] = GetNSigma(buf);
+    for (Int_t ii=0; ii<AliPID::kSPECIES; ii++) prob[idet][ii] = GetProb(buf);
+  }
+  fPIDBayesStatus = (Char_t)GetU8(buf);
+  for (Int_t ii=0; ii<AliPID::kSPECIES; ii++) fPIDBayesProb[ii] = GetProb(buf);
+
+  // MC truth
+  fMCPID  = (Int_t)GetU32(buf);
+  fMCMass = GetF32(buf);
+  px = GetF32(buf);
+  py = GetF32(buf);
+  pz = GetF32(buf);
+  fMCMomentum.SetXYZ(px,py,pz);
+}
+
+// ----------------------------------------------------------------------------
@@ -59,11 +59,20 @@ class CEPTrackBuffer : public TObject {
   public:
     static const Int_t kdumval = -999;
     
+    // size in bytes of a track packed with Pack
+    static const Int_t kPackedSize = 71 + 3*(5+4*AliPID::kSPECIES) + 1+2*AliPID::kSPECIES + 20;
+
     CEPTrackBuffer();
     ~CEPTrackBuffer();
     
     // Modifiers
     void Reset();
+
+    // fixed layout binary record of the track (see CEPEventBuffer::SetUsePackedTracks)
+    // the PID nSigmas and probabilities are quantized, the other floating
+    // point values are stored in single precision
+    void Pack(UChar_t *buf) const;
+    void Unpack(const UChar_t *buf);
     
     void SetTrackIndex(UInt_t trkind) { fTrackIndex = trkind; }
     void SetTrackStatus(UInt_t TTest) { fTrackStatus = TTest; }
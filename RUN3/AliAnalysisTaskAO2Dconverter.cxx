@@ -22,11 +22,14 @@
 #include <TDirectory.h>
 #include <TChain.h>
 #include <TTree.h>
+#include <TBranch.h>
 #include <TMath.h>
 #include <Math/SMatrix.h>
 #include <TTimeStamp.h>
 #include <TClonesArray.h>
 #include <TSystem.h>
+#include <TMemFile.h>
+#include <TROOT.h>
 #include "AliAnalysisTask.h"
 #include "AliAnalysisManager.h"
 #include "AliVEvent.h"
@@ -75,9 +78,16 @@
 #include "AliGenToyEventHeader.h"
 #include "AliTriggerAnalysis.h"
 #include "AliOADBContainer.h"
-#include "AliMathBase.h"
 #include "AliLog.h"
 
+#include <chrono>
+#include <cstring>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 ClassImp(AliAnalysisTaskAO2Dconverter);
 
 const TString AliAnalysisTaskAO2Dconverter::TreeName[kTrees] = {
@@ -150,6 +160,19 @@ namespace
             (ULong64_t)header->GetPeriodNumber() * 16777216 * 3564);
   }
 
+  // Truncate the mantissa of x by masking its bit pattern. Same as AliMathBase::TruncateFloatFraction,
+  // but inlined and skipped for the default (full precision) mask, it is called for every stored float
+  inline Float_t TruncateFloat(Float_t x, UInt_t mask)
+  {
+    if (mask == 0xFFFFFFFF)
+      return x;
+    UInt_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    bits &= mask;
+    memcpy(&x, &bits, sizeof(bits));
+    return x;
+  }
+
   // Initialize the precision masks used to truncate the corresponding float data members
   // By default no truncation
 
@@ -197,6 +220,135 @@ namespace
 
 } // namespace
 
+/// Background writer of the completed TFs, see SetAsyncWriting().
+/// The trees of a TF are filled in a TMemFile of their own. A writer thread writes
+/// (compresses) them there and copies the compressed baskets to the output file, which
+/// is only accessed by the writers, one at a time.
+class AliAO2DAsyncWriter
+{
+public:
+  struct Job {
+    TFile* fFile;                                           // in memory file of the TF
+    TString fDirName;                                       // name of the TF directory
+    TTree* fTrees[AliAnalysisTaskAO2Dconverter::kTrees];   // trees of the TF, owned by fFile
+  };
+
+  AliAO2DAsyncWriter(TFile* output, Int_t nThreads, Int_t maxPending) : fOutput(output), fMaxPending(TMath::Max(maxPending, 1))
+  {
+    for (Int_t i = 0; i < TMath::Max(nThreads, 1); i++)
+      fThreads.emplace_back(&AliAO2DAsyncWriter::Run, this);
+  }
+  ~AliAO2DAsyncWriter() { Finish(); }
+
+  void Push(const Job& job)
+  {
+    // back-pressure: wait until there is room for one more TF in memory
+    std::unique_lock<std::mutex> lock(fQueueMutex);
+    fRoom.wait(lock, [this] { return fPending < fMaxPending; });
+    fPending++;
+    fQueue.push_back(job);
+    fWork.notify_one();
+  }
+
+  void Finish()
+  {
+    {
+      std::lock_guard<std::mutex> lock(fQueueMutex);
+      fDone = true;
+    }
+    fWork.notify_all();
+    for (auto& thread : fThreads)
+      thread.join();
+    fThreads.clear();
+  }
+
+  void Print() const
+  {
+    printf("AO2D background writing, per tree: TFs, input MB, output MB, ratio, MB/s\n");
+    for (Int_t i = 0; i < AliAnalysisTaskAO2Dconverter::kTrees; i++) {
+      const Stats& s = fStats[i];
+      if (s.fNTF == 0)
+        continue;
+      printf("  %-20s %6d %10.1f %10.1f %6.2f %8.1f\n", AliAnalysisTaskAO2Dconverter::TreeName[i].Data(), s.fNTF,
+             s.fTotBytes / 1.e6, s.fZipBytes / 1.e6, s.fZipBytes > 0 ? s.fTotBytes / s.fZipBytes : 0.,
+             s.fTime > 0 ? s.fTotBytes / 1.e6 / s.fTime : 0.);
+    }
+  }
+
+private:
+  struct Stats {
+    Int_t fNTF = 0;          // number of TFs written
+    Double_t fTotBytes = 0;  // uncompressed size
+    Double_t fZipBytes = 0;  // compressed size
+    Double_t fTime = 0;      // seconds spent in compression and copy
+  };
+
+  void Run()
+  {
+    while (true) {
+      Job job;
+      {
+        std::unique_lock<std::mutex> lock(fQueueMutex);
+        fWork.wait(lock, [this] { return fDone || !fQueue.empty(); });
+        if (fQueue.empty())
+          return;
+        job = fQueue.front();
+        fQueue.pop_front();
+      }
+      Write(job);
+      {
+        std::lock_guard<std::mutex> lock(fQueueMutex);
+        fPending--;
+      }
+      fRoom.notify_one();
+    }
+  }
+
+  void Write(Job& job)
+  {
+    for (Int_t i = 0; i < AliAnalysisTaskAO2Dconverter::kTrees; i++) {
+      TTree* tree = job.fTrees[i];
+      if (!tree)
+        continue;
+      auto start = std::chrono::steady_clock::now();
+      {
+        TDirectory::TContext context(tree->GetDirectory());
+        tree->Write();
+      }
+      {
+        // the compressed baskets are copied as they are
+        std::lock_guard<std::mutex> lock(fOutputMutex);
+        TDirectory* dir = fOutput->GetDirectory(job.fDirName);
+        if (!dir)
+          dir = fOutput->mkdir(job.fDirName);
+        TDirectory::TContext context(dir);
+        TTree* copy = tree->CloneTree(-1, "fast");
+        copy->Write();
+        delete copy;
+        Stats& s = fStats[i];
+        s.fNTF++;
+        s.fTotBytes += tree->GetTotBytes();
+        s.fZipBytes += tree->GetZipBytes();
+        s.fTime += std::chrono::duration<Double_t>(std::chrono::steady_clock::now() - start).count();
+      }
+      delete tree;
+    }
+    delete job.fFile;
+  }
+
+  TFile* fOutput;                 // output file
+  Int_t fMaxPending;              // maximum number of TFs in memory
+  Int_t fPending = 0;             // TFs pushed and not yet written
+  Bool_t fDone = false;           // no more TFs will come
+  std::deque<Job> fQueue;         // TFs waiting for a writer
+  std::vector<std::thread> fThreads;
+  std::mutex fQueueMutex;
+  std::mutex fOutputMutex;        // serialises the access to the output file
+  std::condition_variable fWork;  // a TF was pushed or the writing is finished
+  std::condition_variable fRoom;  // a TF was written
+  Stats fStats[AliAnalysisTaskAO2Dconverter::kTrees];
+};
+
 AliAnalysisTaskAO2Dconverter::AliAnalysisTaskAO2Dconverter(const char* name)
   : AliAnalysisTaskSE(name),
     fTrackFilter(Form("AO2Dconverter%s", name), Form("fTrackFilter%s", name)),
@@ -243,6 +395,7 @@ AliAnalysisTaskAO2Dconverter::~AliAnalysisTaskAO2Dconverter()
 {
   fOutputList->Delete();
   delete fOutputList;
+  delete fAsyncWriter;
 } // AliAnalysisTaskAO2Dconverter::~AliAnalysisTaskAO2Dconverter()
 
 void AliAnalysisTaskAO2Dconverter::NotifyRun(){
@@ -337,6 +490,15 @@ void AliAnalysisTaskAO2Dconverter::UserCreateOutputObjects()
   fOutputFile = TFile::Open("AO2D.root", "RECREATE", "O2 AOD", fCompress); // File to store the trees of time frames
   fOutputFile->Print();
 
+  if (fNWriters > 0)
+  {
+    ROOT::EnableThreadSafety();
+    if (fNIMTThreads > 0)
+      ROOT::EnableImplicitMT(fNIMTThreads);
+    fAsyncWriter = new AliAO2DAsyncWriter(fOutputFile, fNWriters, fMaxPendingTF);
+    AliInfo(Form("Writing the TFs with %d threads, at most %d TFs in memory", fNWriters, fMaxPendingTF));
+  }
+
   // create the list of output histograms
   fOutputList = new TList();
   fOutputList->SetOwner();
@@ -471,9 +633,11 @@ void AliAnalysisTaskAO2Dconverter::UserExec(Option_t *)
   FillEventInTF();
 
   // Finish the current TF and initialize a new one, if the size is above the limit
-  if (fBytes > fMaxBytes)
+  // or if the data buffered in memory are above the budget
+  ULong_t buffered = (fMemoryBudget > 0) ? GetBufferedBytes() : 0;
+  if (fBytes > fMaxBytes || buffered > fMemoryBudget)
   {
-    AliInfo(Form("Total size of output trees: %lu bytes\n", fBytes));
+    AliInfo(Form("Total size of output trees: %lu bytes, %lu bytes in memory\n", fBytes, buffered));
     fBytes = 0; // Reset the byte counter
     fTfInitialized = false;
     FinishTF();
@@ -488,6 +652,13 @@ void AliAnalysisTaskAO2Dconverter::FinishTaskOutput()
 {
   // called at the end of the event loop on the worker
   FinishTF();
+  if (fAsyncWriter)
+  {
+    fAsyncWriter->Finish();
+    fAsyncWriter->Print();
+    delete fAsyncWriter;
+    fAsyncWriter = 0x0;
+  }
   fOutputFile->Write(); // Do not close the file since this is then re-opened and overwritten by the framework
   AliInfo(Form("Total size of output trees: %lu bytes\n", fBytes));
 }
@@ -581,9 +752,29 @@ void AliAnalysisTaskAO2Dconverter::FillTree(TreeIndex t)
     return;
   Int_t nbytes = fTree[t]->Fill();
   if (nbytes > 0)
+  {
     fBytes += nbytes;
+    fTreeBytes[t] += nbytes;
+  }
 } // void AliAnalysisTaskAO2Dconverter::FillTree(TreeIndex t)
 
+ULong_t AliAnalysisTaskAO2Dconverter::GetBufferedBytes() const
+{
+  // Estimate of the uncompressed bytes held in memory by the trees of the current TF.
+  // A tree attached to the output file keeps at most one basket per branch, the
+  // full baskets are written out during Fill. With background writing the whole
+  // TF stays in memory.
+  ULong_t bytes = 0;
+  for (Int_t i = 0; i < kTrees; i++)
+  {
+    if (fAsyncWriter || fTreeBasketBytes[i] == 0)
+      bytes += fTreeBytes[i];
+    else
+      bytes += TMath::Min(fTreeBytes[i], fTreeBasketBytes[i]);
+  }
+  return bytes;
+} // ULong_t AliAnalysisTaskAO2Dconverter::GetBufferedBytes() const
+
 void AliAnalysisTaskAO2Dconverter::WriteTree(TreeIndex t)
 {
   if (!fTreeStatus[t])
@@ -615,10 +806,19 @@ void AliAnalysisTaskAO2Dconverter::InitTF(ULong64_t tfId)
   {
     eventextra.fStart[i] = 0;
     eventextra.fNentries[i] = 0;
+    fTreeBytes[i] = 0;
+    fTreeBasketBytes[i] = 0;
   }
 
   // Create the output directory for the current time frame
-  fOutputDir = fOutputFile->mkdir(Form("DF_%llu", tfId));
+  if (fAsyncWriter)
+  {
+    // the TF is filled in memory and handed to the writer threads in FinishTF
+    fTFFile = new TMemFile(Form("DF_%llu.root", tfId), "RECREATE", "", fCompress);
+    fOutputDir = fTFFile->mkdir(Form("DF_%llu", tfId));
+  }
+  else
+    fOutputDir = fOutputFile->mkdir(Form("DF_%llu", tfId));
 
   // Associate branches for Run 2 BC info
   TTree* tOrigin = CreateTree(kOrigin);
@@ -1027,6 +1227,16 @@ void AliAnalysisTaskAO2Dconverter::InitTF(ULong64_t tfId)
   }
 
   Prune(); //Removing all unwanted branches (if any)
+
+  // Memory kept by each tree attached to the file: one basket per branch
+  for (Int_t i = 0; i < kTrees; i++)
+  {
+    if (!fTree[i])
+      continue;
+    TIter next(fTree[i]->GetListOfBranches());
+    while (TBranch *branch = (TBranch *)next())
+      fTreeBasketBytes[i] += branch->GetBasketSize();
+  }
 } // void AliAnalysisTaskAO2Dconverter::InitTF(Int_t tfId)
 
 void AliAnalysisTaskAO2Dconverter::FillEventInTF()
@@ -1109,22 +1319,22 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
   {
     eventextra.fNentries[kEvents] = 1; // one entry per vertex
     collision.fIndexBCs = fBCCount;
-    collision.fPosX = AliMathBase::TruncateFloatFraction(pvtx->GetX(), mCollisionPosition);
-    collision.fPosY = AliMathBase::TruncateFloatFraction(pvtx->GetY(), mCollisionPosition);
-    collision.fPosZ = AliMathBase::TruncateFloatFraction(pvtx->GetZ(), mCollisionPosition);
+    collision.fPosX = TruncateFloat(pvtx->GetX(), mCollisionPosition);
+    collision.fPosY = TruncateFloat(pvtx->GetY(), mCollisionPosition);
+    collision.fPosZ = TruncateFloat(pvtx->GetZ(), mCollisionPosition);
 
     Double_t covmatrix[6];
     pvtx->GetCovarianceMatrix(covmatrix);
 
-    collision.fCovXX = AliMathBase::TruncateFloatFraction(covmatrix[0], mCollisionPositionCov);
-    collision.fCovXY = AliMathBase::TruncateFloatFraction(covmatrix[1], mCollisionPositionCov);
-    collision.fCovXZ = AliMathBase::TruncateFloatFraction(covmatrix[2], mCollisionPositionCov);
-    collision.fCovYY = AliMathBase::TruncateFloatFraction(covmatrix[3], mCollisionPositionCov);
-    collision.fCovYZ = AliMathBase::TruncateFloatFraction(covmatrix[4], mCollisionPositionCov);
-    collision.fCovZZ = AliMathBase::TruncateFloatFraction(covmatrix[5], mCollisionPositionCov);
+    collision.fCovXX = TruncateFloat(covmatrix[0], mCollisionPositionCov);
+    collision.fCovXY = TruncateFloat(covmatrix[1], mCollisionPositionCov);
+    collision.fCovXZ = TruncateFloat(covmatrix[2], mCollisionPositionCov);
+    collision.fCovYY = TruncateFloat(covmatrix[3], mCollisionPositionCov);
+    collision.fCovYZ = TruncateFloat(covmatrix[4], mCollisionPositionCov);
+    collision.fCovZZ = TruncateFloat(covmatrix[5], mCollisionPositionCov);
 
     collision.fFlags = vertexType;
-    collision.fChi2 = AliMathBase::TruncateFloatFraction(pvtx->GetChi2(), mCollisionPositionCov);
+    collision.fChi2 = TruncateFloat(pvtx->GetChi2(), mCollisionPositionCov);
     collision.fN = (pvtx->GetNContributors() > USHRT_MAX) ? USHRT_MAX : pvtx->GetNContributors();
 
     Float_t eventTime[10];
@@ -1158,8 +1368,8 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
     }
 
     // Recalculate unique event time and its resolution
-    collision.fCollisionTime = AliMathBase::TruncateFloatFraction(TMath::Mean(10, eventTime, eventTimeWeight), mCollisionPosition);                 // Weighted mean of times per momentum interval
-    collision.fCollisionTimeRes = AliMathBase::TruncateFloatFraction(TMath::Sqrt(9. / 10.) * TMath::Mean(10, eventTimeRes), mCollisionPositionCov); // PH bad approximation
+    collision.fCollisionTime = TruncateFloat(TMath::Mean(10, eventTime, eventTimeWeight), mCollisionPosition);                 // Weighted mean of times per momentum interval
+    collision.fCollisionTimeRes = TruncateFloat(TMath::Sqrt(9. / 10.) * TMath::Mean(10, eventTimeRes), mCollisionPositionCov); // PH bad approximation
 
     FillTree(kEvents);
   }
@@ -1469,17 +1679,17 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
       mcparticle.fDaughter1 = particle ? particle->GetLastDaughter() : aodmcpt->GetDaughterLast();
       if (mcparticle.fDaughter1 > -1)
         mcparticle.fDaughter1 = kineIndex[mcparticle.fDaughter1] > -1 ? kineIndex[mcparticle.fDaughter1] + fOffsetLabel : -1;
-      mcparticle.fWeight = AliMathBase::TruncateFloatFraction(particle ? particle->GetWeight() : 1., mMcParticleW);
+      mcparticle.fWeight = TruncateFloat(particle ? particle->GetWeight() : 1., mMcParticleW);
 
-      mcparticle.fPx = AliMathBase::TruncateFloatFraction(particle ? particle->Px() : aodmcpt->Px(), mMcParticleMom);
-      mcparticle.fPy = AliMathBase::TruncateFloatFraction(particle ? particle->Py() : aodmcpt->Py(), mMcParticleMom);
-      mcparticle.fPz = AliMathBase::TruncateFloatFraction(particle ? particle->Pz() : aodmcpt->Pz(), mMcParticleMom);
-      mcparticle.fE = AliMathBase::TruncateFloatFraction(particle ? particle->Energy() : aodmcpt->E(), mMcParticleMom);
+      mcparticle.fPx = TruncateFloat(particle ? particle->Px() : aodmcpt->Px(), mMcParticleMom);
+      mcparticle.fPy = TruncateFloat(particle ? particle->Py() : aodmcpt->Py(), mMcParticleMom);
+      mcparticle.fPz = TruncateFloat(particle ? particle->Pz() : aodmcpt->Pz(), mMcParticleMom);
+      mcparticle.fE = TruncateFloat(particle ? particle->Energy() : aodmcpt->E(), mMcParticleMom);
 
-      mcparticle.fVx = AliMathBase::TruncateFloatFraction(particle ? particle->Vx() : aodmcpt->Xv(), mMcParticlePos);
-      mcparticle.fVy = AliMathBase::TruncateFloatFraction(particle ? particle->Vy() : aodmcpt->Yv(), mMcParticlePos);
-      mcparticle.fVz = AliMathBase::TruncateFloatFraction(particle ? particle->Vz() : aodmcpt->Zv(), mMcParticlePos);
-      mcparticle.fVt = AliMathBase::TruncateFloatFraction(particle ? particle->T() : aodmcpt->T(), mMcParticlePos);
+      mcparticle.fVx = TruncateFloat(particle ? particle->Vx() : aodmcpt->Xv(), mMcParticlePos);
+      mcparticle.fVy = TruncateFloat(particle ? particle->Vy() : aodmcpt->Yv(), mMcParticlePos);
+      mcparticle.fVz = TruncateFloat(particle ? particle->Vz() : aodmcpt->Zv(), mMcParticlePos);
+      mcparticle.fVt = TruncateFloat(particle ? particle->T() : aodmcpt->T(), mMcParticlePos);
 
       if (toWrite[i] > 0)
       {
@@ -1526,22 +1736,22 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
       tracks.fIndexCollisions = fCollisionCount;
       tracks.fTrackType = TrackTypeEnum::Run2Track;
 
-      tracks.fX = AliMathBase::TruncateFloatFraction(track->GetX(), mTrackX);
-      tracks.fAlpha = AliMathBase::TruncateFloatFraction(track->GetAlpha(), mTrackAlpha);
+      tracks.fX = TruncateFloat(track->GetX(), mTrackX);
+      tracks.fAlpha = TruncateFloat(track->GetAlpha(), mTrackAlpha);
 
       tracks.fY = track->GetY(); // no lossy compression
       tracks.fZ = track->GetZ();
-      tracks.fSnp = AliMathBase::TruncateFloatFraction(track->GetSnp(), mtrackSnp);
-      tracks.fTgl = AliMathBase::TruncateFloatFraction(track->GetTgl(), mTrackTgl);
-      tracks.fSigned1Pt = AliMathBase::TruncateFloatFraction(track->GetSigned1Pt(), mTrack1Pt);
+      tracks.fSnp = TruncateFloat(track->GetSnp(), mtrackSnp);
+      tracks.fTgl = TruncateFloat(track->GetTgl(), mTrackTgl);
+      tracks.fSigned1Pt = TruncateFloat(track->GetSigned1Pt(), mTrack1Pt);
 
       // Modified covariance matrix
       // First sigmas on the diagonal
-      tracks.fSigmaY = AliMathBase::TruncateFloatFraction(TMath::Sqrt(track->GetSigmaY2()), mTrackCovDiag);
-      tracks.fSigmaZ = AliMathBase::TruncateFloatFraction(TMath::Sqrt(track->GetSigmaZ2()), mTrackCovDiag);
-      tracks.fSigmaSnp = AliMathBase::TruncateFloatFraction(TMath::Sqrt(track->GetSigmaSnp2()), mTrackCovDiag);
-      tracks.fSigmaTgl = AliMathBase::TruncateFloatFraction(TMath::Sqrt(track->GetSigmaTgl2()), mTrackCovDiag);
-      tracks.fSigma1Pt = AliMathBase::TruncateFloatFraction(TMath::Sqrt(track->GetSigma1Pt2()), mTrackCovDiag);
+      tracks.fSigmaY = TruncateFloat(TMath::Sqrt(track->GetSigmaY2()), mTrackCovDiag);
+      tracks.fSigmaZ = TruncateFloat(TMath::Sqrt(track->GetSigmaZ2()), mTrackCovDiag);
+      tracks.fSigmaSnp = TruncateFloat(TMath::Sqrt(track->GetSigmaSnp2()), mTrackCovDiag);
+      tracks.fSigmaTgl = TruncateFloat(TMath::Sqrt(track->GetSigmaTgl2()), mTrackCovDiag);
+      tracks.fSigma1Pt = TruncateFloat(TMath::Sqrt(track->GetSigma1Pt2()), mTrackCovDiag);
       //
       tracks.fRhoZY = (Char_t)(128. * track->GetSigmaZY() / tracks.fSigmaZ / tracks.fSigmaY);
       tracks.fRhoSnpY = (Char_t)(128. * track->GetSigmaSnpY() / tracks.fSigmaSnp / tracks.fSigmaY);
@@ -1555,7 +1765,7 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
       tracks.fRho1PtTgl = (Char_t)(128. * track->GetSigma1PtTgl() / tracks.fSigma1Pt / tracks.fSigmaTgl);
 
       const AliExternalTrackParam *intp = track->GetInnerParam();
-      tracks.fTPCinnerP = AliMathBase::TruncateFloatFraction((intp ? intp->GetP() : 0), mTrack1Pt); // Set the momentum to 0 if the track did not reach TPC
+      tracks.fTPCinnerP = TruncateFloat((intp ? intp->GetP() : 0), mTrack1Pt); // Set the momentum to 0 if the track did not reach TPC
 
       // Compressing and reassigned flags. Keeping only the ones we need.
       tracks.fFlags = 0x0;
@@ -1603,15 +1813,15 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
       // Checking that the track has a TOF measurement matched
       const bool hasTOF = (track->GetStatus() & AliESDtrack::kTOFout) && (track->GetStatus() & AliESDtrack::kTIME);
 
-      tracks.fITSChi2NCl = AliMathBase::TruncateFloatFraction((track->GetITSNcls() ? track->GetITSchi2() / track->GetITSNcls() : 0), mTrackCovOffDiag);
-      tracks.fTPCChi2NCl = AliMathBase::TruncateFloatFraction((track->GetTPCNcls() ? track->GetTPCchi2() / track->GetTPCNcls() : 0), mTrackCovOffDiag);
-      tracks.fTRDChi2 = AliMathBase::TruncateFloatFraction(track->GetTRDchi2(), mTrackCovOffDiag);
-      tracks.fTOFChi2 = AliMathBase::TruncateFloatFraction(hasTOF ? sqrt(track->GetTOFsignalDx() * track->GetTOFsignalDx() + track->GetTOFsignalDz() * track->GetTOFsignalDz()) : 0.f, mTrackCovOffDiag);
+      tracks.fITSChi2NCl = TruncateFloat((track->GetITSNcls() ? track->GetITSchi2() / track->GetITSNcls() : 0), mTrackCovOffDiag);
+      tracks.fTPCChi2NCl = TruncateFloat((track->GetTPCNcls() ? track->GetTPCchi2() / track->GetTPCNcls() : 0), mTrackCovOffDiag);
+      tracks.fTRDChi2 = TruncateFloat(track->GetTRDchi2(), mTrackCovOffDiag);
+      tracks.fTOFChi2 = TruncateFloat(hasTOF ? sqrt(track->GetTOFsignalDx() * track->GetTOFsignalDx() + track->GetTOFsignalDz() * track->GetTOFsignalDz()) : 0.f, mTrackCovOffDiag);
 
-      tracks.fTPCSignal = AliMathBase::TruncateFloatFraction(track->GetTPCsignal(), mTrackSignal);
-      tracks.fTRDSignal = AliMathBase::TruncateFloatFraction(track->GetTRDsignal(), mTrackSignal);
-      tracks.fTOFSignal = AliMathBase::TruncateFloatFraction(hasTOF ? track->GetTOFsignal() : 0.f, mTrackSignal);
-      tracks.fLength = AliMathBase::TruncateFloatFraction(track->GetIntegratedLength(), mTrackSignal);
+      tracks.fTPCSignal = TruncateFloat(track->GetTPCsignal(), mTrackSignal);
+      tracks.fTRDSignal = TruncateFloat(track->GetTRDsignal(), mTrackSignal);
+      tracks.fTOFSignal = TruncateFloat(hasTOF ? track->GetTOFsignal() : 0.f, mTrackSignal);
+      tracks.fLength = TruncateFloat(track->GetIntegratedLength(), mTrackSignal);
 
       // Speed of ligth in TOF units
       const Float_t cspeed = 0.029979246f;
@@ -1622,13 +1832,13 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
           (track->GetIntegratedLength() /
           TOFResponse.GetExpectedSignal(track, tof_pid) / cspeed);
 
-      tracks.fTOFExpMom = AliMathBase::TruncateFloatFraction(
+      tracks.fTOFExpMom = TruncateFloat(
           AliPID::ParticleMass(tof_pid) * exp_beta * cspeed /
               TMath::Sqrt(1. - (exp_beta * exp_beta)),
           mTrack1Pt);
 
-      tracks.fTrackEtaEMCAL = AliMathBase::TruncateFloatFraction(track->GetTrackEtaOnEMCal(), mTrackPosEMCAL);
-      tracks.fTrackPhiEMCAL = AliMathBase::TruncateFloatFraction(track->GetTrackPhiOnEMCal(), mTrackPosEMCAL);
+      tracks.fTrackEtaEMCAL = TruncateFloat(track->GetTrackEtaOnEMCal(), mTrackPosEMCAL);
+      tracks.fTrackPhiEMCAL = TruncateFloat(track->GetTrackPhiOnEMCal(), mTrackPosEMCAL);
 
       if (fTaskMode == kMC)
       {
@@ -1712,8 +1922,8 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
           track->GetHMPIDtrk(xPc, yPc, thetaTrk, phiTrk);
           track->GetHMPIDmip(xMip, yMip, qMip, nPhot);
 
-          hmpids.fHMPIDSignal = AliMathBase::TruncateFloatFraction(track->GetHMPIDsignal(), mTrackSignal);
-          hmpids.fHMPIDDistance = AliMathBase::TruncateFloatFraction(TMath::Sqrt((xPc - xMip) * (xPc - xMip) + (yPc - yMip) * (yPc - yMip)), mTrackSignal);
+          hmpids.fHMPIDSignal = TruncateFloat(track->GetHMPIDsignal(), mTrackSignal);
+          hmpids.fHMPIDDistance = TruncateFloat(TMath::Sqrt((xPc - xMip) * (xPc - xMip) + (yPc - yMip) * (yPc - yMip)), mTrackSignal);
           hmpids.fHMPIDNPhotons = static_cast<Short_t>(nPhot);
           hmpids.fHMPIDQMip = static_cast<Short_t>(qMip);
           FillTree(kHMPID);
@@ -1760,7 +1970,7 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
         // inversion formulas for snp and alpha
         tracks.fSnp = 0.;
         alpha = phi;
-        tracks.fAlpha = AliMathBase::TruncateFloatFraction(alpha, mTracklets);
+        tracks.fAlpha = TruncateFloat(alpha, mTracklets);
 
         // inversion formulas for tgl
         x = (TMath::Tan(theta / 2.) - 1.) / (TMath::Tan(theta / 2.) + 1.);
@@ -1768,7 +1978,7 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
           tgl = TMath::Sqrt((TMath::Power((1. + TMath::Power(x, 2)) / (1. - TMath::Power(x, 2)), 2)) - 1.);
         else
           tgl = -TMath::Sqrt((TMath::Power((1. + TMath::Power(x, 2)) / (1. - TMath::Power(x, 2)), 2)) - 1.);
-        tracks.fTgl = AliMathBase::TruncateFloatFraction(tgl, mTracklets);
+        tracks.fTgl = TruncateFloat(tgl, mTracklets);
 
         // set global track parameters to NAN
         tracks.fX = NAN;
@@ -1858,8 +2068,8 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
     // Mimic run3 compression: Store only cells with energy larger than the threshold
     if (amplitude < fEMCALAmplitudeThreshold)
       continue;
-    calo.fAmplitude = AliMathBase::TruncateFloatFraction(amplitude, mCaloAmp);
-    calo.fTime = AliMathBase::TruncateFloatFraction(time * kSecToNanoSec, mCaloAmp);
+    calo.fAmplitude = TruncateFloat(amplitude, mCaloAmp);
+    calo.fTime = TruncateFloat(time * kSecToNanoSec, mCaloAmp);
     calo.fCaloType = cells->GetType(); // common for all cells
     calo.fCellType = cells->GetHighGain(ice) ? 1. : 0.;
     FillTree(kCalo);
@@ -1899,10 +2109,10 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
     geo->GetTriggerMapping()->GetAbsFastORIndexFromPositionInEMCAL(col, row, fastorID);
     calotrigger.fFastOrAbsID = fastorID;
     calotriggers->GetAmplitude(calotrigger.fL0Amplitude);
-    calotrigger.fL0Amplitude = AliMathBase::TruncateFloatFraction(calotrigger.fL0Amplitude, mCaloAmp);
-    calotrigger.fL1TimeSum = AliMathBase::TruncateFloatFraction(l1timesum, mCaloAmp);
+    calotrigger.fL0Amplitude = TruncateFloat(calotrigger.fL0Amplitude, mCaloAmp);
+    calotrigger.fL1TimeSum = TruncateFloat(l1timesum, mCaloAmp);
     calotriggers->GetTime(calotrigger.fL0Time);
-    calotrigger.fL0Time = AliMathBase::TruncateFloatFraction(calotrigger.fL0Time, mCaloTime);
+    calotrigger.fL0Time = TruncateFloat(calotrigger.fL0Time, mCaloTime);
     calotriggers->GetTriggerBits(calotrigger.fTriggerBits);
     Int_t nL0times;
     calotriggers->GetNL0Times(nL0times);
@@ -1954,7 +2164,7 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
     calo.fCellNumber = truId ;
 
     phostriggers->GetAmplitude(amplitude);
-    calo.fAmplitude = AliMathBase::TruncateFloatFraction(amplitude/mPHOSCalib, 0xFFF); //12 bit
+    calo.fAmplitude = TruncateFloat(amplitude/mPHOSCalib, 0xFFF); //12 bit
     if(triggerbits==0){ //L0 trigger
       calo.fCellType =0 ; //0:L0, 1:L1
     }
@@ -1986,8 +2196,8 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
     calo.fCellNumber = (4-mod)*3584 + cellNumber%3584 ;
     //Run3: uncalibrated amplitude in ADC counts
     // here we assume fixed calibration 
-    calo.fAmplitude = AliMathBase::TruncateFloatFraction(amplitude/mPHOSCalib, 0xFFF); //12 bit
-    calo.fTime = AliMathBase::TruncateFloatFraction(time, 0x1FFF);  //13 bit
+    calo.fAmplitude = TruncateFloat(amplitude/mPHOSCalib, 0xFFF); //12 bit
+    calo.fTime = TruncateFloat(time, 0x1FFF);  //13 bit
     calo.fCellType = cells->GetHighGain(icp) ? 0. : 1.; 
 
     FillTree(kCalo);
@@ -2037,13 +2247,13 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
       {
         AliESDMuonCluster *muCluster = fESD->FindMuonCluster(mutrk->GetClusterId(imucl));
         mucls.fIndexMuons = muTrackID;
-        mucls.fX = AliMathBase::TruncateFloatFraction(muCluster->GetX(), mMuonCl);
-        mucls.fY = AliMathBase::TruncateFloatFraction(muCluster->GetY(), mMuonCl);
-        mucls.fZ = AliMathBase::TruncateFloatFraction(muCluster->GetZ(), mMuonCl);
-        mucls.fErrX = AliMathBase::TruncateFloatFraction(muCluster->GetErrX(), mMuonClErr);
-        mucls.fErrY = AliMathBase::TruncateFloatFraction(muCluster->GetErrY(), mMuonClErr);
-        mucls.fCharge = AliMathBase::TruncateFloatFraction(muCluster->GetCharge(), mMuonCl);
-        mucls.fChi2 = AliMathBase::TruncateFloatFraction(muCluster->GetChi2(), mMuonClErr);
+        mucls.fX = TruncateFloat(muCluster->GetX(), mMuonCl);
+        mucls.fY = TruncateFloat(muCluster->GetY(), mMuonCl);
+        mucls.fZ = TruncateFloat(muCluster->GetZ(), mMuonCl);
+        mucls.fErrX = TruncateFloat(muCluster->GetErrX(), mMuonClErr);
+        mucls.fErrY = TruncateFloat(muCluster->GetErrY(), mMuonClErr);
+        mucls.fCharge = TruncateFloat(muCluster->GetCharge(), mMuonCl);
+        mucls.fChi2 = TruncateFloat(muCluster->GetChi2(), mMuonClErr);
         FillTree(kMuonCls);
         if (fTreeStatus[kMuonCls])
           nmucl_filled++;
@@ -2177,11 +2387,11 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
   fv0a.fIndexBCs = fBCCount;
   fv0c.fIndexBCs = fBCCount;
   for (Int_t ich = 0; ich < 32; ++ich)
-    fv0a.fAmplitude[ich] = AliMathBase::TruncateFloatFraction(vz->GetMultiplicityV0A(ich), mV0Amplitude);
+    fv0a.fAmplitude[ich] = TruncateFloat(vz->GetMultiplicityV0A(ich), mV0Amplitude);
   for (Int_t ich = 0; ich < 32; ++ich)
-    fv0c.fAmplitude[ich] = AliMathBase::TruncateFloatFraction(vz->GetMultiplicityV0C(ich), mV0Amplitude);
-  fv0a.fTime = AliMathBase::TruncateFloatFraction(vz->GetV0ATime(), mV0Time);
-  fv0c.fTime = AliMathBase::TruncateFloatFraction(vz->GetV0CTime(), mV0Time);
+    fv0c.fAmplitude[ich] = TruncateFloat(vz->GetMultiplicityV0C(ich), mV0Amplitude);
+  fv0a.fTime = TruncateFloat(vz->GetV0ATime(), mV0Time);
+  fv0c.fTime = TruncateFloat(vz->GetV0CTime(), mV0Time);
   fv0a.fTriggerMask = 0; // not filled for the moment
   FillTree(kFV0A);
   FillTree(kFV0C);
@@ -2195,21 +2405,21 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
   ft0.fIndexBCs = fBCCount;
   if (fESD) {
     for (Int_t ich = 0; ich < 12; ++ich)
-      ft0.fAmplitudeA[ich] = AliMathBase::TruncateFloatFraction(fESD->GetT0amplitude()[ich + 12], mT0Amplitude);
+      ft0.fAmplitudeA[ich] = TruncateFloat(fESD->GetT0amplitude()[ich + 12], mT0Amplitude);
     for (Int_t ich = 0; ich < 12; ++ich)
-      ft0.fAmplitudeC[ich] = AliMathBase::TruncateFloatFraction(fESD->GetT0amplitude()[ich], mT0Amplitude);
-    ft0.fTimeA = AliMathBase::TruncateFloatFraction(fESD->GetT0TOF(1) * 1e-3, mT0Time); // ps to ns
-    ft0.fTimeC = AliMathBase::TruncateFloatFraction(fESD->GetT0TOF(2) * 1e-3, mT0Time); // ps to ns
+      ft0.fAmplitudeC[ich] = TruncateFloat(fESD->GetT0amplitude()[ich], mT0Amplitude);
+    ft0.fTimeA = TruncateFloat(fESD->GetT0TOF(1) * 1e-3, mT0Time); // ps to ns
+    ft0.fTimeC = TruncateFloat(fESD->GetT0TOF(2) * 1e-3, mT0Time); // ps to ns
     ft0.fTriggerMask = fESD->GetT0Trig();
   }
   else {
     AliAODTZERO * aodtzero = fAOD->GetTZEROData();
     for (Int_t ich = 0; ich < 12; ++ich)
-      ft0.fAmplitudeA[ich] = AliMathBase::TruncateFloatFraction(aodtzero->GetAmp(ich + 12), mT0Amplitude);
+      ft0.fAmplitudeA[ich] = TruncateFloat(aodtzero->GetAmp(ich + 12), mT0Amplitude);
     for (Int_t ich = 0; ich < 12; ++ich)
-      ft0.fAmplitudeC[ich] = AliMathBase::TruncateFloatFraction(aodtzero->GetAmp(ich), mT0Amplitude);
-    ft0.fTimeA = AliMathBase::TruncateFloatFraction(aodtzero->GetT0TOF(1) * 1e-3, mT0Time); // ps to ns
-    ft0.fTimeC = AliMathBase::TruncateFloatFraction(aodtzero->GetT0TOF(2) * 1e-3, mT0Time); // ps to ns
+      ft0.fAmplitudeC[ich] = TruncateFloat(aodtzero->GetAmp(ich), mT0Amplitude);
+    ft0.fTimeA = TruncateFloat(aodtzero->GetT0TOF(1) * 1e-3, mT0Time); // ps to ns
+    ft0.fTimeC = TruncateFloat(aodtzero->GetT0TOF(2) * 1e-3, mT0Time); // ps to ns
     ft0.fTriggerMask = 0; // Not available in AOD
   }
   
@@ -2226,8 +2436,8 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
       fdd.fAmplitudeA[ich] = 0; // not filled for the moment
     for (Int_t ich = 0; ich < 4; ++ich)
       fdd.fAmplitudeC[ich] = 0; // not filled for the moment
-    fdd.fTimeA = AliMathBase::TruncateFloatFraction(esdad->GetADATime(), mADTime);
-    fdd.fTimeC = AliMathBase::TruncateFloatFraction(esdad->GetADCTime(), mADTime);
+    fdd.fTimeA = TruncateFloat(esdad->GetADATime(), mADTime);
+    fdd.fTimeC = TruncateFloat(esdad->GetADCTime(), mADTime);
     fdd.fTriggerMask = 0; // not filled for the moment
   }
   else {
@@ -2236,8 +2446,8 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
       fdd.fAmplitudeA[ich] = 0; // not filled for the moment
     for (Int_t ich = 0; ich < 4; ++ich)
       fdd.fAmplitudeC[ich] = 0; // not filled for the moment
-    fdd.fTimeA = AliMathBase::TruncateFloatFraction(aodad->GetADATime(), mADTime);
-    fdd.fTimeC = AliMathBase::TruncateFloatFraction(aodad->GetADCTime(), mADTime);
+    fdd.fTimeA = TruncateFloat(aodad->GetADATime(), mADTime);
+    fdd.fTimeC = TruncateFloat(aodad->GetADCTime(), mADTime);
     fdd.fTriggerMask = 0; // not filled for the moment
   }
   FillTree(kFDD);
@@ -2372,13 +2582,13 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
 
     mccollision.fIndexBCs = fBCCount;
 
-    mccollision.fPosX = AliMathBase::TruncateFloatFraction(MCvtx ? MCvtx->GetX() : MCHeader->GetVtxX(), mCollisionPosition);
-    mccollision.fPosY = AliMathBase::TruncateFloatFraction(MCvtx ? MCvtx->GetY() : MCHeader->GetVtxY(), mCollisionPosition);
-    mccollision.fPosZ = AliMathBase::TruncateFloatFraction(MCvtx ? MCvtx->GetZ() : MCHeader->GetVtxZ(), mCollisionPosition);
+    mccollision.fPosX = TruncateFloat(MCvtx ? MCvtx->GetX() : MCHeader->GetVtxX(), mCollisionPosition);
+    mccollision.fPosY = TruncateFloat(MCvtx ? MCvtx->GetY() : MCHeader->GetVtxY(), mCollisionPosition);
+    mccollision.fPosZ = TruncateFloat(MCvtx ? MCvtx->GetZ() : MCHeader->GetVtxZ(), mCollisionPosition);
 
     AliGenEventHeader *mcGenH = MCEvt ? MCEvt->GenEventHeader()  : MCHeader->GetCocktailHeader(0); //PH Probably not OK
-    mccollision.fT = AliMathBase::TruncateFloatFraction(mcGenH ? mcGenH->InteractionTime() : -999., mCollisionPosition);
-    mccollision.fWeight = AliMathBase::TruncateFloatFraction(mcGenH ? mcGenH->EventWeight() : 1., mCollisionPosition);
+    mccollision.fT = TruncateFloat(mcGenH ? mcGenH->InteractionTime() : -999., mCollisionPosition);
+    mccollision.fWeight = TruncateFloat(mcGenH ? mcGenH->EventWeight() : 1., mCollisionPosition);
 
     // Impact parameter
     AliCollisionGeometry *cGeo = dynamic_cast<AliCollisionGeometry *>(mcGenH);
@@ -2413,7 +2623,7 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
         }
       }
     }
-    mccollision.fImpactParameter = AliMathBase::TruncateFloatFraction(mccollision.fImpactParameter, mCollisionPosition);
+    mccollision.fImpactParameter = TruncateFloat(mccollision.fImpactParameter, mCollisionPosition);
     eventextra.fNentries[kMcCollision] = 1;
   }
   else
@@ -2445,6 +2655,25 @@ void AliAnalysisTaskAO2Dconverter::FillEventInTF()
 
 void AliAnalysisTaskAO2Dconverter::FinishTF()
 {
+  if (fAsyncWriter)
+  {
+    if (!fTFFile)
+      return;
+    AliAO2DAsyncWriter::Job job;
+    job.fFile = fTFFile;
+    job.fDirName = fOutputDir->GetName();
+    for (Int_t i = 0; i < kTrees; i++)
+    {
+      job.fTrees[i] = fTree[i];
+      if (fTree[i])
+        fTree[i]->ResetBranchAddresses(); // the data structures are reused for the next TF
+      fTree[i] = 0x0;
+    }
+    fTFFile = 0x0;
+    fOutputDir = 0x0;
+    fAsyncWriter->Push(job); // waits if too many TFs are pending
+    return;
+  }
   // Write all trees
   for (Int_t i = 0; i < kTrees; i++)
     WriteTree((TreeIndex)i);
@@ -2514,16 +2743,16 @@ AliAnalysisTaskAO2Dconverter::FwdTrackPars AliAnalysisTaskAO2Dconverter::MUONtoF
   x4 = alpha4 * -x3 * TMath::Sqrt(1 + alpha3 * alpha3);
 
   // Set output parameters
-  convertedTrack.fX = AliMathBase::TruncateFloatFraction(MUONTrack.GetNonBendingCoor(), mMuonTrNonBend);
-  convertedTrack.fY = AliMathBase::TruncateFloatFraction(MUONTrack.GetBendingCoor(), mMuonTrBend);
-  convertedTrack.fZ = AliMathBase::TruncateFloatFraction(MUONTrack.GetZ(), mMuonTrZmu);
-  convertedTrack.fPhi = AliMathBase::TruncateFloatFraction(x2, mMuonTrThetaX);
-  convertedTrack.fTgl = AliMathBase::TruncateFloatFraction(x3, mMuonTrThetaX);
-  convertedTrack.fSigned1Pt = AliMathBase::TruncateFloatFraction(x4, mMuonTr1P);
-  convertedTrack.fChi2 = AliMathBase::TruncateFloatFraction(MUONTrack.GetChi2(), mMuonTrCov);
-  convertedTrack.fChi2MatchMCHMID = AliMathBase::TruncateFloatFraction(MUONTrack.GetChi2MatchTrigger(), mMuonTrCov);
-  convertedTrack.fRAtAbsorberEnd = AliMathBase::TruncateFloatFraction(MUONTrack.GetRAtAbsorberEnd(), mMuonTrCov);
-  convertedTrack.fPDca = AliMathBase::TruncateFloatFraction(pdca, mMuonTrCov);
+  convertedTrack.fX = TruncateFloat(MUONTrack.GetNonBendingCoor(), mMuonTrNonBend);
+  convertedTrack.fY = TruncateFloat(MUONTrack.GetBendingCoor(), mMuonTrBend);
+  convertedTrack.fZ = TruncateFloat(MUONTrack.GetZ(), mMuonTrZmu);
+  convertedTrack.fPhi = TruncateFloat(x2, mMuonTrThetaX);
+  convertedTrack.fTgl = TruncateFloat(x3, mMuonTrThetaX);
+  convertedTrack.fSigned1Pt = TruncateFloat(x4, mMuonTr1P);
+  convertedTrack.fChi2 = TruncateFloat(MUONTrack.GetChi2(), mMuonTrCov);
+  convertedTrack.fChi2MatchMCHMID = TruncateFloat(MUONTrack.GetChi2MatchTrigger(), mMuonTrCov);
+  convertedTrack.fRAtAbsorberEnd = TruncateFloat(MUONTrack.GetRAtAbsorberEnd(), mMuonTrCov);
+  convertedTrack.fPDca = TruncateFloat(pdca, mMuonTrCov);
 
   // Covariances matrix conversion
   using SMatrix55Std = ROOT::Math::SMatrix<double, 5>;
@@ -2589,11 +2818,11 @@ AliAnalysisTaskAO2Dconverter::FwdTrackPars AliAnalysisTaskAO2Dconverter::MUONtoF
   convertedCovariances = ROOT::Math::Similarity(jacobian, convertedCovariances);
 
   // Set output covariances
-  convertedTrack.fSigmaX   = AliMathBase::TruncateFloatFraction(TMath::Sqrt(convertedCovariances(0,0)), mTrackCovDiag);
-  convertedTrack.fSigmaY   = AliMathBase::TruncateFloatFraction(TMath::Sqrt(convertedCovariances(1,1)), mTrackCovDiag);
-  convertedTrack.fSigmaPhi = AliMathBase::TruncateFloatFraction(TMath::Sqrt(convertedCovariances(2,2)), mTrackCovDiag);
-  convertedTrack.fSigmaTgl = AliMathBase::TruncateFloatFraction(TMath::Sqrt(convertedCovariances(3,3)), mTrackCovDiag);
-  convertedTrack.fSigma1Pt = AliMathBase::TruncateFloatFraction(TMath::Sqrt(convertedCovariances(4,4)), mTrackCovDiag);
+  convertedTrack.fSigmaX   = TruncateFloat(TMath::Sqrt(convertedCovariances(0,0)), mTrackCovDiag);
+  convertedTrack.fSigmaY   = TruncateFloat(TMath::Sqrt(convertedCovariances(1,1)), mTrackCovDiag);
+  convertedTrack.fSigmaPhi = TruncateFloat(TMath::Sqrt(convertedCovariances(2,2)), mTrackCovDiag);
+  convertedTrack.fSigmaTgl = TruncateFloat(TMath::Sqrt(convertedCovariances(3,3)), mTrackCovDiag);
+  convertedTrack.fSigma1Pt = TruncateFloat(TMath::Sqrt(convertedCovariances(4,4)), mTrackCovDiag);
 
   if(fwdtracks.fSigmaX != 0 && fwdtracks.fSigmaY != 0)
       convertedTrack.fRhoXY = (Char_t)(128. * convertedCovariances(0,1) / fwdtracks.fSigmaX / fwdtracks.fSigmaY);
@@ -2673,16 +2902,16 @@ AliAnalysisTaskAO2Dconverter::FwdTrackPars AliAnalysisTaskAO2Dconverter::MUONtoF
   x4 = alpha4 * -x3 * TMath::Sqrt(1 + alpha3 * alpha3);
 
   // Set output parameters
-  convertedTrack.fX = AliMathBase::TruncateFloatFraction(MUONTrack.Xv(), mMuonTrNonBend);
-  convertedTrack.fY = AliMathBase::TruncateFloatFraction(MUONTrack.Yv(), mMuonTrBend);
-  convertedTrack.fZ = AliMathBase::TruncateFloatFraction(MUONTrack.Zv(), mMuonTrZmu);
-  convertedTrack.fPhi = AliMathBase::TruncateFloatFraction(x2, mMuonTrThetaX);
-  convertedTrack.fTgl = AliMathBase::TruncateFloatFraction(x3, mMuonTrThetaX);
-  convertedTrack.fSigned1Pt = AliMathBase::TruncateFloatFraction(x4, mMuonTr1P);
-  convertedTrack.fChi2 = AliMathBase::TruncateFloatFraction(MUONTrack.Chi2perNDF(), mMuonTrCov);
-  convertedTrack.fChi2MatchMCHMID = AliMathBase::TruncateFloatFraction(MUONTrack.GetChi2MatchTrigger(), mMuonTrCov);
-  convertedTrack.fRAtAbsorberEnd = AliMathBase::TruncateFloatFraction(MUONTrack.GetRAtAbsorberEnd(), mMuonTrCov);
-  convertedTrack.fPDca = AliMathBase::TruncateFloatFraction(pdca, mMuonTrCov);
+  convertedTrack.fX = TruncateFloat(MUONTrack.Xv(), mMuonTrNonBend);
+  convertedTrack.fY = TruncateFloat(MUONTrack.Yv(), mMuonTrBend);
+  convertedTrack.fZ = TruncateFloat(MUONTrack.Zv(), mMuonTrZmu);
+  convertedTrack.fPhi = TruncateFloat(x2, mMuonTrThetaX);
+  convertedTrack.fTgl = TruncateFloat(x3, mMuonTrThetaX);
+  convertedTrack.fSigned1Pt = TruncateFloat(x4, mMuonTr1P);
+  convertedTrack.fChi2 = TruncateFloat(MUONTrack.Chi2perNDF(), mMuonTrCov);
+  convertedTrack.fChi2MatchMCHMID = TruncateFloat(MUONTrack.GetChi2MatchTrigger(), mMuonTrCov);
+  convertedTrack.fRAtAbsorberEnd = TruncateFloat(MUONTrack.GetRAtAbsorberEnd(), mMuonTrCov);
+  convertedTrack.fPDca = TruncateFloat(pdca, mMuonTrCov);
 
   // Covariances matrix conversion
   using SMatrix55Std = ROOT::Math::SMatrix<double, 5>;
@@ -2748,11 +2977,11 @@ AliAnalysisTaskAO2Dconverter::FwdTrackPars AliAnalysisTaskAO2Dconverter::MUONtoF
   convertedCovariances = ROOT::Math::Similarity(jacobian, convertedCovariances);
 
   // Set output covariances
-  convertedTrack.fSigmaX   = AliMathBase::TruncateFloatFraction(TMath::Sqrt(convertedCovariances(0,0)), mTrackCovDiag);
-  convertedTrack.fSigmaY   = AliMathBase::TruncateFloatFraction(TMath::Sqrt(convertedCovariances(1,1)), mTrackCovDiag);
-  convertedTrack.fSigmaPhi = AliMathBase::TruncateFloatFraction(TMath::Sqrt(convertedCovariances(2,2)), mTrackCovDiag);
-  convertedTrack.fSigmaTgl = AliMathBase::TruncateFloatFraction(TMath::Sqrt(convertedCovariances(3,3)), mTrackCovDiag);
-  convertedTrack.fSigma1Pt = AliMathBase::TruncateFloatFraction(TMath::Sqrt(convertedCovariances(4,4)), mTrackCovDiag);
+  convertedTrack.fSigmaX   = TruncateFloat(TMath::Sqrt(convertedCovariances(0,0)), mTrackCovDiag);
+  convertedTrack.fSigmaY   = TruncateFloat(TMath::Sqrt(convertedCovariances(1,1)), mTrackCovDiag);
+  convertedTrack.fSigmaPhi = TruncateFloat(TMath::Sqrt(convertedCovariances(2,2)), mTrackCovDiag);
+  convertedTrack.fSigmaTgl = TruncateFloat(TMath::Sqrt(convertedCovariances(3,3)), mTrackCovDiag);
+  convertedTrack.fSigma1Pt = TruncateFloat(TMath::Sqrt(convertedCovariances(4,4)), mTrackCovDiag);
 
   if(fwdtracks.fSigmaX != 0 && fwdtracks.fSigmaY != 0)
       convertedTrack.fRhoXY = (Char_t)(128. * convertedCovariances(0,1) / fwdtracks.fSigmaX / fwdtracks.fSigmaY);
@@ -22,6 +22,7 @@ class AliAODEvent;
 class TFile;
 class TDirectory;
 class TParticle;
+class AliAO2DAsyncWriter;
 
 class AliAnalysisTaskAO2Dconverter : public AliAnalysisTaskSE
 {
@@ -48,6 +49,14 @@ public:
   virtual void SetTruncation(Bool_t trunc=kTRUE) {fTruncate = trunc;}
   virtual void SetCompression(UInt_t compress=101) {fCompress = compress; }
   virtual void SetMaxBytes(ULong_t nbytes = 100000000) {fMaxBytes = nbytes;}
+  /// Close the TF also when the estimated uncompressed data held in memory by its trees exceed nbytes (0: no limit).
+  /// With background writing up to maxPendingTF more TFs are kept in memory.
+  void SetMemoryBudget(ULong_t nbytes) { fMemoryBudget = nbytes; }
+  /// Write the completed TFs in the background: nWriters threads compress the trees of a TF
+  /// (in memory, in parallel over the branches with ROOT implicit MT if nIMTThreads > 0) and copy
+  /// them to AO2D.root. At most maxPendingTF TFs are kept in memory, FinishTF() waits beyond that.
+  /// nWriters = 0 (default) writes synchronously.
+  void SetAsyncWriting(Int_t nWriters = 2, Int_t maxPendingTF = 4, Int_t nIMTThreads = 0) { fNWriters = nWriters; fMaxPendingTF = maxPendingTF; fNIMTThreads = nIMTThreads; }
   void SetEMCALAmplitudeThreshold(Double_t threshold) { fEMCALAmplitudeThreshold = threshold; }
 
   static AliAnalysisTaskAO2Dconverter* AddTask(TString suffix = "");
@@ -182,6 +191,7 @@ private:
   TTree* fTree[kTrees] = { nullptr }; //! Array with all the output trees
   void Prune();                       // Function to perform tree pruning
   void FillTree(TreeIndex t);         // Function to fill the trees (only the active ones)
+  ULong_t GetBufferedBytes() const;   // Estimate of the bytes held in memory by the trees of the TF
   void WriteTree(TreeIndex t);        // Function to write the trees (only the active ones)
   void InitTF(ULong64_t tfId);           // Initialize output subdir and trees for TF tfId
   void FillEventInTF();
@@ -589,15 +599,25 @@ private:
   /// Byte counter
   ULong_t fBytes = 0; ///! Number of bytes stored in all trees
   ULong_t fMaxBytes = 100000000; ///| Approximative size limit on the total TF output trees
+  ULong_t fMemoryBudget = 0; /// Limit on the bytes buffered in memory by the TF trees, 0 for no limit
+  ULong_t fTreeBytes[kTrees] = {0}; ///! Bytes filled per tree in the current TF
+  ULong_t fTreeBasketBytes[kTrees] = {0}; ///! Sum of the basket sizes per tree, i.e. the most kept in memory
 
   /// Pointer to the output file
   TFile * fOutputFile = 0x0; ///! Pointer to the output file
   TDirectory * fOutputDir = 0x0; ///! Pointer to the output Root subdirectory
 
+  /// Background writing of the TFs
+  Int_t fNWriters = 0;     /// Number of writer threads, 0 for synchronous writing
+  Int_t fMaxPendingTF = 4; /// Maximum number of TFs waiting to be written
+  Int_t fNIMTThreads = 0;  /// Threads of ROOT implicit MT for the compression, 0 to leave it disabled
+  TFile * fTFFile = 0x0;   ///! In memory file of the current TF, with background writing
+  AliAO2DAsyncWriter * fAsyncWriter = 0x0; ///! Writer threads
+
   FwdTrackPars MUONtoFwdTrack(AliESDMuonTrack&); // Converts MUON Tracks from ESD between RUN2 and RUN3 coordinates
   FwdTrackPars MUONtoFwdTrack(AliAODTrack&); // Converts MUON Tracks from AOD between RUN2 and RUN3 coordinates
 
-  ClassDef(AliAnalysisTaskAO2Dconverter, 16);
+  ClassDef(AliAnalysisTaskAO2Dconverter, 18);
 };
 
 #endif
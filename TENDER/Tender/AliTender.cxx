@@ -17,6 +17,7 @@
 
 #include <TChain.h>
 #include <TFile.h>
+#include <TStopwatch.h>
  
 #include "AliTender.h"
 #include "AliTenderSupply.h"
@@ -41,7 +42,15 @@ AliTender::AliTender():
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fTimeSupplies(kFALSE),
+           fSupplyRun(),
+           fInitTime(),
+           fRunChangeTime(),
+           fEventTime(),
+           fNEvents(),
+           fNRunChanges(),
+           fNTracks()
 {
 // Dummy constructor
 }
@@ -58,7 +67,15 @@ AliTender::AliTender(const char* name):
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fTimeSupplies(kFALSE),
+           fSupplyRun(),
+           fInitTime(),
+           fRunChangeTime(),
+           fEventTime(),
+           fNEvents(),
+           fNRunChanges(),
+           fNTracks()
 {
 // Default constructor
   DefineOutput(1,  AliESDEvent::Class());
@@ -127,9 +144,21 @@ void AliTender::ConnectInputData(Option_t* option)
     // Lock CDB
     fCDBkey = fCDB->SetLock(kTRUE, fCDBkey);
   }
-  TIter next(fSupplies);
-  AliTenderSupply *supply;
-  while ((supply=(AliTenderSupply*)next())) supply->Init();
+  const Int_t nSupplies = fSupplies ? fSupplies->GetEntriesFast() : 0;
+  fSupplyRun.assign(nSupplies, -1);
+  fInitTime.assign(nSupplies, 0.);
+  fRunChangeTime.assign(nSupplies, 0.);
+  fEventTime.assign(nSupplies, 0.);
+  fNEvents.assign(nSupplies, 0);
+  fNRunChanges.assign(nSupplies, 0);
+  fNTracks.assign(nSupplies, 0);
+  TStopwatch timer;
+  for (Int_t i=0; i<nSupplies; i++) {
+    AliTenderSupply *supply = (AliTenderSupply*)fSupplies->UncheckedAt(i);
+    if (fTimeSupplies) timer.Start(kTRUE);
+    supply->Init();
+    if (fTimeSupplies) fInitTime[i] = timer.RealTime();
+  }
 }
 
 //______________________________________________________________________________
@@ -170,9 +199,39 @@ void AliTender::UserExec(Option_t* option)
       fCDBkey = fCDB->SetLock(kTRUE, fCDBkey);
     } 
   }
-  TIter next(fSupplies);
-  AliTenderSupply *supply;
-  while ((supply=(AliTenderSupply*)next())) supply->ProcessEvent();
+  // A supply skipping this event type sees the run change at its first processed event,
+  // so RunChanged() is evaluated per supply
+  const UInt_t eventType = fESD->GetEventType();
+  const Int_t nTracks = fESD->GetNumberOfTracks();
+  const Int_t nSupplies = fSupplies ? fSupplies->GetEntriesFast() : 0;
+  if ((Int_t)fSupplyRun.size() != nSupplies) {
+    fSupplyRun.resize(nSupplies, -1);
+    fInitTime.resize(nSupplies, 0.);
+    fRunChangeTime.resize(nSupplies, 0.);
+    fEventTime.resize(nSupplies, 0.);
+    fNEvents.resize(nSupplies, 0);
+    fNRunChanges.resize(nSupplies, 0);
+    fNTracks.resize(nSupplies, 0);
+  }
+  TStopwatch timer;
+  for (Int_t i=0; i<nSupplies; i++) {
+    AliTenderSupply *supply = (AliTenderSupply*)fSupplies->UncheckedAt(i);
+    if (!supply->AcceptsEventType(eventType)) continue;
+    fRunChanged = (fSupplyRun[i] != fRun);
+    fSupplyRun[i] = fRun;
+    if (fTimeSupplies) timer.Start(kTRUE);
+    supply->ProcessEvent();
+    if (fTimeSupplies) {
+      if (fRunChanged) {
+        fRunChangeTime[i] += timer.RealTime();
+        fNRunChanges[i]++;
+      } else {
+        fEventTime[i] += timer.RealTime();
+      }
+      fNEvents[i]++;
+      fNTracks[i] += nTracks;
+    }
+  }
   fRunChanged = kFALSE;
 
   if (TObject::TestBit(kCheckEventSelection)) fESDhandler->CheckSelectionMask();
@@ -181,6 +240,28 @@ void AliTender::UserExec(Option_t* option)
   if (!opt.Contains("NoPost")) PostData(1, fESD);
 }
 
+//______________________________________________________________________________
+void AliTender::FinishTaskOutput()
+{
+// Print the timing of the supplies, if requested.
+  if (fTimeSupplies) PrintSupplyTiming();
+}
+
+//______________________________________________________________________________
+void AliTender::PrintSupplyTiming() const
+{
+// Time spent by each supply: Init(), first events of the runs (OCDB access) and other events
+  Printf("AliTender: timing of the supplies [s]");
+  Printf("  %-30s %10s %10s %8s %12s %10s %12s %12s", "supply", "init", "run change", "runs", "events", "other", "per event", "tracks/s");
+  for (UInt_t i=0; i<fInitTime.size(); i++) {
+    const AliTenderSupply *supply = (const AliTenderSupply*)fSupplies->UncheckedAt(i);
+    const Long64_t nOther = fNEvents[i] - fNRunChanges[i];
+    const Double_t time = fRunChangeTime[i] + fEventTime[i];
+    Printf("  %-30s %10.3f %10.3f %8d %12lld %10.3f %12.2e %12.3e", supply->GetName(), fInitTime[i], fRunChangeTime[i],
+           fNRunChanges[i], fNEvents[i], fEventTime[i], nOther>0 ? fEventTime[i]/nOther : 0., time>0 ? fNTracks[i]/time : 0.);
+  }
+}
+
 //______________________________________________________________________________
 void AliTender::SetDefaultCDBStorage(const char *dbString)
 {
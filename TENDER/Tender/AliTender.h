@@ -13,6 +13,8 @@
 //      during pass1 reconstruction.
 //==============================================================================
 
+#include <vector>
+
 #ifndef ALIANALYSISTASKSE_H
 #include "AliAnalysisTaskSE.h"
 #endif
@@ -43,6 +45,14 @@ private:
   AliESDEvent              *fESD;            //! Pointer to current ESD event
   TObjArray                *fSupplies;       // Array of tender supplies
   TObjArray                *fCDBSettings;    // Array with CDB configuration
+  Bool_t                    fTimeSupplies;   // Switch on the timing of the supplies
+  std::vector<Int_t>        fSupplyRun;      //! Last run seen by each supply
+  std::vector<Double_t>     fInitTime;       //! Real time spent in Init() per supply
+  std::vector<Double_t>     fRunChangeTime;  //! Real time spent in the first event of the runs per supply
+  std::vector<Double_t>     fEventTime;      //! Real time spent in the other events per supply
+  std::vector<Long64_t>     fNEvents;        //! Number of processed events per supply
+  std::vector<Int_t>        fNRunChanges;    //! Number of run changes seen per supply
+  std::vector<Long64_t>     fNTracks;        //! Number of tracks of the processed events per supply
   
   AliTender(const AliTender &other);
   AliTender& operator=(const AliTender &other);
@@ -68,13 +78,18 @@ public:
    */
   void 			    SetHandleOCDB(Bool_t doHandle) { fHandleCDB = doHandle; }
   void SetESDhandler(AliESDInputHandler*esdH) {fESDhandler = esdH;}
+  // Measure the time spent by each supply in Init(), at run change and per event,
+  // the summary is printed at the end of the task
+  void                      SetTimeSupplies(Bool_t flag=kTRUE) {fTimeSupplies = flag;}
+  void                      PrintSupplyTiming() const;
 
   // Run control
   virtual void              ConnectInputData(Option_t *option = "");
   virtual void              UserCreateOutputObjects();
 //  virtual Bool_t            Notify() {return kTRUE;}
   virtual void              UserExec(Option_t *option);
+  virtual void              FinishTaskOutput();
     
-  ClassDef(AliTender,4)  // Class describing the tender car for ESD analysis
+  ClassDef(AliTender,5)  // Class describing the tender car for ESD analysis
 };
 #endif
@@ -23,7 +23,8 @@ ClassImp(AliTenderSupply)
 //______________________________________________________________________________
 AliTenderSupply::AliTenderSupply()
                 :TNamed(),
-                 fTender(NULL)
+                 fTender(NULL),
+                 fEventTypeMask(0)
 {
 // Dummy constructor
 }
@@ -31,7 +32,8 @@ AliTenderSupply::AliTenderSupply()
 //______________________________________________________________________________
 AliTenderSupply::AliTenderSupply(const char* name, const AliTender *tender)
                 :TNamed(name, "ESD analysis tender car"),
-                 fTender(tender)
+                 fTender(tender),
+                 fEventTypeMask(0)
 {
 // Default constructor
 }
@@ -39,7 +41,8 @@ AliTenderSupply::AliTenderSupply(const char* name, const AliTender *tender)
 //______________________________________________________________________________
 AliTenderSupply::AliTenderSupply(const AliTenderSupply &other)
                 :TNamed(other),
-                 fTender(other.fTender)
+                 fTender(other.fTender),
+                 fEventTypeMask(other.fEventTypeMask)
                  
 {
 // Copy constructor
@@ -58,5 +61,6 @@ AliTenderSupply& AliTenderSupply::operator=(const AliTenderSupply &other)
    if (&other == this) return *this;
    TNamed::operator=(other);
    fTender = other.fTender;
+   fEventTypeMask = other.fEventTypeMask;
    return *this;
 }
@@ -20,6 +20,7 @@ class AliTenderSupply : public TNamed {
 
 protected:
   const AliTender          *fTender;         // Tender car
+  UInt_t                    fEventTypeMask;  // Bit mask of the ESD event types to process (0: all)
   
 public:  
   AliTenderSupply();
@@ -33,7 +34,11 @@ public:
   virtual void              ProcessEvent() = 0;
   
   void                      SetTender(const AliTender *tender) {fTender = tender;}
+  // Process only the events of the given types, e.g. BIT(AliRawEventHeaderBase::kPhysicsEvent).
+  // The supply sees the run change (and fetches its OCDB objects) at its first processed event.
+  void                      SetEventTypeMask(UInt_t mask) {fEventTypeMask = mask;}
+  Bool_t                    AcceptsEventType(UInt_t type) const {return !fEventTypeMask || (type<32 && (fEventTypeMask & (1u<<type)));}
     
-  ClassDef(AliTenderSupply,1)  // Base class for tender user algorithms
+  ClassDef(AliTenderSupply,2)  // Base class for tender user algorithms
 };
 #endif
@@ -653,6 +653,9 @@ void AliEMCALTenderSupply::ProcessEvent()
       else
         AliWarning("InitClusterization OK");
     }
+
+    // gather the calibration maps of this run per cell
+    fEMCALRecoUtils->FillFlatCellCalibration();
     
     if (fDebugLevel>1) 
       fEMCALRecoUtils->Print("");
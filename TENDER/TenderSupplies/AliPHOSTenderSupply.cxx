@@ -70,6 +70,16 @@ AliPHOSTenderSupply::AliPHOSTenderSupply() :
   ,fIsMC(kFALSE)
   ,fMCProduction("")
   ,fDRN(-1)
+  ,fSkipSameCalibration(kFALSE)
+  ,fFlatCalibFilled(kFALSE)
+  ,fBadChannelFlat()
+  ,fTimeShiftHG()
+  ,fTimeShiftLG()
+  ,fDDL()
+  ,fEventBC(-1)
+  ,fCalibrationVersion("")
+  ,fVerifiedRun(-1)
+  ,fVerifiedSameCalib(kFALSE)
 {
 	//
 	// default ctor
@@ -102,6 +112,16 @@ AliPHOSTenderSupply::AliPHOSTenderSupply(const char *name, const AliTender *tend
   ,fIsMC(kFALSE)
   ,fMCProduction("")
   ,fDRN(-1)
+  ,fSkipSameCalibration(kFALSE)
+  ,fFlatCalibFilled(kFALSE)
+  ,fBadChannelFlat()
+  ,fTimeShiftHG()
+  ,fTimeShiftLG()
+  ,fDDL()
+  ,fEventBC(-1)
+  ,fCalibrationVersion("")
+  ,fVerifiedRun(-1)
+  ,fVerifiedSameCalib(kFALSE)
 {
 	//
 	// named ctor
@@ -235,6 +255,7 @@ void AliPHOSTenderSupply::InitTender()
   }
   
   //Init Bad channels map
+  TString badMapName = fUsePrivateBadMap ? "private" : "" ;
   if(!fUsePrivateBadMap){
     AliOADBContainer badmapContainer(Form("phosBadMap"));
     if(fPrivateOADBBadMap.Length()!=0){
@@ -252,6 +273,7 @@ void AliPHOSTenderSupply::InitTender()
     }
     else{
       AliInfo(Form("Setting PHOS bad map with name %s \n",maps->GetName())) ;
+      badMapName = maps->GetName() ;
       for(Int_t mod=0; mod<6;mod++){
         if(fPHOSBadMap[mod]) 
           delete fPHOSBadMap[mod] ;
@@ -352,7 +374,76 @@ void AliPHOSTenderSupply::InitTender()
     }
   }
 
+  //Version of the calibration of this run, compared with the one stored in AODs
+  fCalibrationVersion = Form("%s:%s:pass%d:%s",fPHOSCalibData ? fPHOSCalibData->GetName() : "",
+                             badMapName.Data(),fRecoPass,fNonlinearityVersion.Data()) ;
   
+  FillFlatCalibration() ;
+}
+
+//_____________________________________________________
+void AliPHOSTenderSupply::FillFlatCalibration()
+{
+  //Copy the bad maps and time calibration of this run in flat per cell tables
+  //to avoid histogram and calibration object lookups per cluster
+  
+  fFlatCalibFilled = kFALSE ;
+  if(!fPHOSGeo) return ;
+  
+  const Int_t nX = 64, nZ = 56 ;
+  fBadChannelFlat.assign(6*nX*nZ,0) ;
+  for(Int_t mod=0; mod<6; mod++){
+    if(!fPHOSBadMap[mod]) continue ;
+    for(Int_t ix=1; ix<=nX; ix++)
+      for(Int_t iz=1; iz<=nZ; iz++)
+        fBadChannelFlat[(mod*nX+ix-1)*nZ+iz-1] = (fPHOSBadMap[mod]->GetBinContent(ix,iz)>0) ;
+  }
+  
+  //absId starts from 1 in module 1
+  const Int_t nCells = 5*nX*nZ+1 ;
+  fTimeShiftHG.assign(nCells,0.) ;
+  fTimeShiftLG.assign(nCells,0.) ;
+  fDDL.assign(nCells,0) ;
+  const Int_t nmod=5;
+  Int_t relId[4];
+  for(Int_t absId=1; absId<nCells; absId++){
+    fPHOSGeo->AbsToRelNumbering(absId,relId) ;
+    Int_t   module = relId[0];
+    Int_t   column = relId[3];
+    Int_t   row    = relId[2];
+    if(fPHOSCalibData){
+      fTimeShiftHG[absId] = fPHOSCalibData->GetTimeShiftEmc(module, column, row);
+      fTimeShiftLG[absId] = fPHOSCalibData->GetLGTimeShiftEmc(module, column, row);
+    }
+    fDDL[absId] = (nmod-module) * 4 + (row-1)/16 - 6; //convert offline module numbering to online.
+  }
+  
+  fFlatCalibFilled = (fPHOSCalibData!=0x0) ;
+}
+
+//_____________________________________________________
+Bool_t AliPHOSTenderSupply::IsBadCell(Int_t mod, Int_t ix, Int_t iz) const
+{
+  //Bad channel flag, from the flat table if filled
+  
+  if(fFlatCalibFilled && mod>=0 && mod<6 && ix>=1 && ix<=64 && iz>=1 && iz<=56)
+    return fBadChannelFlat[(mod*64+ix-1)*56+iz-1] ;
+  return fPHOSBadMap[mod]->GetBinContent(ix,iz)>0 ;
+}
+
+//_____________________________________________________
+Bool_t AliPHOSTenderSupply::IsSameCalibration(AliAODEvent * aod)
+{
+  //Check, once per run, if the AOD was produced with the calibration version of this run
+  
+  if(aod->GetRunNumber()!=fVerifiedRun){
+    fVerifiedRun = aod->GetRunNumber() ;
+    TNamed * version = dynamic_cast<TNamed*>(aod->FindListObject("PHOSCalibrationVersion")) ;
+    fVerifiedSameCalib = version && fCalibrationVersion.Length()>0 && fCalibrationVersion.CompareTo(version->GetTitle())==0 ;
+    AliInfo(Form("Run %d: AOD PHOS calibration version <%s>, tender <%s>, %s",fVerifiedRun,
+                 version ? version->GetTitle() : "",fCalibrationVersion.Data(),fVerifiedSameCalib ? "skip reprocessing" : "reprocess")) ;
+  }
+  return fVerifiedSameCalib ;
 }
 
 //_____________________________________________________
@@ -383,6 +474,9 @@ void AliPHOSTenderSupply::ProcessEvent()
     InitTender();
     
   }
+  
+  AliVEvent * event = fTask ? fTask->InputEvent() : esd ;
+  fEventBC = event ? event->GetBunchCrossNumber() : -1 ;
 
   TVector3 vertex ;
   if(esd){
@@ -519,6 +613,8 @@ void AliPHOSTenderSupply::ProcessEvent()
     
   }
   else{//AOD
+    if(fSkipSameCalibration && IsSameCalibration(aod))
+      return ;
     TClonesArray * clusters = aod->GetCaloClusters() ;
     AliAODCaloCells * cells = aod->GetPHOSCells() ;
     ProcessAODEvent(clusters,cells, vertex) ;
@@ -1080,7 +1176,7 @@ Bool_t AliPHOSTenderSupply::IsGoodChannel(Int_t mod, Int_t ix, Int_t iz)
      AliError(Form("No Bad map for PHOS module %d",mod)) ;
      return kFALSE ;
   }
-  if(fPHOSBadMap[mod]->GetBinContent(ix,iz)>0)
+  if(IsBadCell(mod,ix,iz))
     return kFALSE ;
   else
     return kTRUE ;
@@ -1105,6 +1201,7 @@ void AliPHOSTenderSupply::ForceUsingBadMap(const char * filename){
   }
   fbm->Close() ;
   fUsePrivateBadMap=kTRUE ;
+  fFlatCalibFilled=kFALSE ;
 }
 //________________________________________________________________________
 void AliPHOSTenderSupply::ForceUsingCalibration(const char * filename){
@@ -1118,6 +1215,7 @@ void AliPHOSTenderSupply::ForceUsingCalibration(const char * filename){
   fPHOSCalibData = (AliPHOSCalibData*)fc->Get("PHOSCalibration") ;
   fc->Close() ;
   fUsePrivateCalib=kTRUE; 
+  fFlatCalibFilled=kFALSE ;
 }
 //________________________________________________________________________
 void AliPHOSTenderSupply::CorrectPHOSMisalignment(TVector3 &global,Int_t mod){
@@ -1421,25 +1519,32 @@ Double_t AliPHOSTenderSupply::CalibrateTOF(Double_t tof, Int_t absId, Bool_t isH
   //Apply time re-calibration separately for HG and LG channels
   //By default (if not filled) shifts are zero.  
     
-  Int_t relId[4];
-  fPHOSGeo->AbsToRelNumbering(absId,relId) ;
-  Int_t   module = relId[0];
-  Int_t   column = relId[3];
-  Int_t   row    = relId[2];
-  if(isHG)
-    tof-=fPHOSCalibData->GetTimeShiftEmc(module, column, row);
+  Int_t ddl = 0 ;
+  if(fFlatCalibFilled && absId>0 && absId<(Int_t)fTimeShiftHG.size()){
+    tof-= isHG ? fTimeShiftHG[absId] : fTimeShiftLG[absId] ;
+    ddl = fDDL[absId] ;
+  }
   else{
-    tof-=fPHOSCalibData->GetLGTimeShiftEmc(module, column, row);
+    Int_t relId[4];
+    fPHOSGeo->AbsToRelNumbering(absId,relId) ;
+    Int_t   module = relId[0];
+    Int_t   column = relId[3];
+    Int_t   row    = relId[2];
+    if(isHG)
+      tof-=fPHOSCalibData->GetTimeShiftEmc(module, column, row);
+    else{
+      tof-=fPHOSCalibData->GetLGTimeShiftEmc(module, column, row);
+    }
+    //Apply L1phase
+    //First eval DDL
+    const Int_t nmod=5; 
+    ddl = (nmod-module) * 4 + (row-1)/16 - 6; //convert offline module numbering to online.
   }
-  //Apply L1phase
-  //First eval DDL
-  const Int_t nmod=5; 
-  Int_t ddl = (nmod-module) * 4 + (row-1)/16 - 6; //convert offline module numbering to online.
   //L1phase is 0 for Run1
   if(fRunNumber>209122){ //Run2
-    AliVEvent * event = fTask->InputEvent(); 
-    if(event){
-      UShort_t BC = event->GetBunchCrossNumber();
+    //bunch crossing read once per event in ProcessEvent()
+    if(fEventBC>=0){
+      UShort_t BC = fEventBC;
       Int_t timeshift = BC%4 - fL1phase[ddl];
       if(timeshift<0) timeshift += 4; 
       tof -= timeshift*25e-9;
@@ -1463,7 +1568,7 @@ void AliPHOSTenderSupply::DistanceToBadChannel(Int_t mod, TVector3 * locPos, Dou
   Float_t x=0.,z=0.;
   for(Int_t ix=xmin;ix<=xmax;ix++){
     for(Int_t iz=zmin;iz<=zmax;iz++){
-      if(fPHOSBadMap[mod] && fPHOSBadMap[mod]->GetBinContent(ix,iz)>0){ //Bad channel
+      if(fPHOSBadMap[mod] && IsBadCell(mod,ix,iz)){ //Bad channel
         Int_t relidBC[4]={mod,0,ix,iz} ;
         fPHOSGeo->RelPosInModule(relidBC,x,z); 
         Double_t dist = TMath::Sqrt((x-locPos->X())*(x-locPos->X()) + (z-locPos->Z())*(z-locPos->Z()));
@@ -12,6 +12,7 @@
 //                                                                    //
 ////////////////////////////////////////////////////////////////////////
 
+#include <vector>
 #include <AliTenderSupply.h>
 
 class TVector3;
@@ -22,6 +23,7 @@ class AliVCluster ;
 class AliVCaloCells ;
 class AliAnalysisTaskSE ;
 class AliAODCaloCells ;
+class AliAODEvent ;
 
 class AliPHOSTenderSupply: public AliTenderSupply {
   
@@ -59,6 +61,11 @@ public:
   TH2I * GetPHOSBadChannelStatusMap(Int_t iModule) const { return (TH2I*)fPHOSBadMap[iModule] ; }
   void SetPrivateOADBBadMap(char * filename){fPrivateOADBBadMap = filename;}
   
+  //Do not reprocess AOD clusters if the AOD contains a TNamed "PHOSCalibrationVersion"
+  //with title equal to the version of the calibration of this run, see GetCalibrationVersion()
+  void SkipSameCalibration(Bool_t skip=kTRUE){fSkipSameCalibration=skip;}
+  const TString & GetCalibrationVersion() const {return fCalibrationVersion;}
+  
   void   InitTender();
   Double_t TestCPV(Double_t dx, Double_t dz, Double_t pt, Int_t charge) ;
   Int_t   FindTrackMatching(Int_t mod,TVector3 *locpos,Double_t &dx, Double_t &dz, Double_t &pttrack, Int_t &charge);
@@ -79,6 +86,9 @@ protected:
   Double_t EvalTOF(AliVCluster * clu,AliVCaloCells * cells); 
   Double_t CalibrateTOF(Double_t tof, Int_t absId, Bool_t isHG); 
   void DistanceToBadChannel(Int_t mod, TVector3 * locPos, Double_t &minDist) ;
+  void FillFlatCalibration() ;
+  Bool_t IsBadCell(Int_t mod, Int_t ix, Int_t iz) const ;
+  Bool_t IsSameCalibration(AliAODEvent * aod) ;
 
  
 private:
@@ -108,8 +118,20 @@ private:
   Bool_t fIsMC;                              //True if work with MC data
   TString fMCProduction ;                    //Name of MC production
   Int_t fDRN;                                //dummy run number for single particle simulation
+  Bool_t fSkipSameCalibration;               //Do not reprocess AODs produced with the same calibration version
+
+  //Per run flat copies of the bad maps and time calibration
+  Bool_t fFlatCalibFilled;                   //! flat tables below filled for the current maps
+  std::vector<UChar_t> fBadChannelFlat;      //! bad channel flag, index ((mod*64)+ix-1)*56+iz-1
+  std::vector<Float_t> fTimeShiftHG;         //! HG time shift per absId
+  std::vector<Float_t> fTimeShiftLG;         //! LG time shift per absId
+  std::vector<Char_t>  fDDL;                 //! online DDL per absId
+  Int_t   fEventBC;                          //! bunch crossing of the current event, -1 if unknown
+  TString fCalibrationVersion;               //! version of the calibration of the current run
+  Int_t   fVerifiedRun;                      //! run for which the AOD calibration version was checked
+  Bool_t  fVerifiedSameCalib;                //! the AOD of fVerifiedRun has the same calibration version
  
-  ClassDef(AliPHOSTenderSupply, 8); // PHOS tender task
+  ClassDef(AliPHOSTenderSupply, 9); // PHOS tender task
 };
 
 
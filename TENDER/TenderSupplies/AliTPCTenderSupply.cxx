@@ -72,7 +72,12 @@ fGRP(0x0),
 fBeamType("PP"),
 fLHCperiod(),
 fMCperiod(),
-fRecoPass(0)
+fRecoPass(0),
+fDryRun(kFALSE),
+fBatchTrack(),
+fBatchZ(),
+fBatchTgl(),
+fBatchCorr()
 {
   //
   // default ctor
@@ -101,7 +106,12 @@ fGRP(0x0),
 fBeamType("PP"),
 fLHCperiod(),
 fMCperiod(),
-fRecoPass(0)
+fRecoPass(0),
+fDryRun(kFALSE),
+fBatchTrack(),
+fBatchZ(),
+fBatchTgl(),
+fBatchCorr()
 {
   //
   // named ctor
@@ -183,23 +193,42 @@ void AliTPCTenderSupply::ProcessEvent()
   // - recalculate PID probabilities for TPC
   // - correct TPC signal multiplicity dependence
 
+  // The inputs of the tracks with TPC information are gathered first, the
+  // corrections are then computed in a loop without track access and applied
   Int_t ntracks=event->GetNumberOfTracks();
+  fBatchTrack.clear();
+  fBatchZ.clear();
+  fBatchTgl.clear();
   for(Int_t itrack = 0; itrack < ntracks; itrack++){
-    AliESDtrack *track=event->GetTrack(itrack);
-    const AliExternalTrackParam *inner=track->GetInnerParam();
+    const AliExternalTrackParam *inner=event->GetTrack(itrack)->GetInnerParam();
     
     // skip tracks without TPC information
     if (!inner) continue;
+    fBatchTrack.push_back(itrack);
+    fBatchZ.push_back(inner->GetZ());
+    fBatchTgl.push_back(inner->GetTgl());
+  }
+
+  //calculate total gain correction factor given by
+  // o gain calibration factor
+  // o attachment correction
+  // o multiplicity correction in PbPb
+  const Int_t nTPC=fBatchTrack.size();
+  fBatchCorr.resize(nTPC);
+  const Float_t *z=fBatchZ.data();
+  const Float_t *tgl=fBatchTgl.data();
+  Double_t *corr=fBatchCorr.data();
+  for(Int_t i = 0; i < nTPC; i++){
+    Float_t meanDrift= 250. - 0.5*TMath::Abs(2*z[i] + (247-83)*tgl[i]);
+    corr[i]=corrFactor*(1 + corrAttachSlope*180.)/(1 + corrAttachSlope*meanDrift)/corrGainMultiplicityPbPb;
+  }
+  if (fDryRun) return;
 
-    //calculate total gain correction factor given by
-    // o gain calibration factor
-    // o attachment correction
-    // o multiplicity correction in PbPb
-    Float_t meanDrift= 250. - 0.5*TMath::Abs(2*inner->GetZ() + (247-83)*inner->GetTgl());
-    Double_t corrGainTotal=corrFactor*(1 + corrAttachSlope*180.)/(1 + corrAttachSlope*meanDrift)/corrGainMultiplicityPbPb;
+  for(Int_t i = 0; i < nTPC; i++){
+    AliESDtrack *track=event->GetTrack(fBatchTrack[i]);
 
     // apply gain correction
-    track->SetTPCsignal(track->GetTPCsignal()*corrGainTotal ,track->GetTPCsignalSigma(), track->GetTPCsignalN());
+    track->SetTPCsignal(track->GetTPCsignal()*corr[i] ,track->GetTPCsignalSigma(), track->GetTPCsignalN());
 
     // recalculate pid probabilities
     fESDpid->MakeTPCPID(track);
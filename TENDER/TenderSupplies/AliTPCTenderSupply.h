@@ -10,6 +10,8 @@
 //                                                                    //
 ////////////////////////////////////////////////////////////////////////
 
+#include <vector>
+
 #include <TString.h>
 
 #include <AliTenderSupply.h>
@@ -35,6 +37,8 @@ public:
   void SetDebugLevel(Int_t level)         {fDebugLevel=level;}
   void SetMip(Double_t mip)               {fMip=mip;}
   void SetResponseFunctions(TObjArray *arr) {fArrPidResponseMaster=arr;}
+  // compute the corrections without modifying the tracks, for benchmarking
+  void SetDryRun(Bool_t dryRun=kTRUE)     {fDryRun=dryRun;}
   Double_t GetMultiplicityCorrectionMean(Double_t tpcMulti);
   Double_t GetMultiplicityCorrectionSigma(Double_t tpcMulti);
 
@@ -68,6 +72,12 @@ private:
   TString fLHCperiod;                //! LHC period
   TString fMCperiod;                 //! corresponding MC period to use for the splines
   Int_t   fRecoPass;                 //! reconstruction pass
+  Bool_t  fDryRun;                   //  compute but do not apply the corrections
+
+  std::vector<Int_t>   fBatchTrack;  //! index of the tracks with TPC information
+  std::vector<Float_t> fBatchZ;      //! z of the inner param
+  std::vector<Float_t> fBatchTgl;    //! tan(lambda) of the inner param
+  std::vector<Double_t> fBatchCorr;  //! total gain correction
 
   void SetSplines();
   Double_t GetGainCorrection();
@@ -82,7 +92,7 @@ private:
   AliTPCTenderSupply(const AliTPCTenderSupply&c);
   AliTPCTenderSupply& operator= (const AliTPCTenderSupply&c);
   
-  ClassDef(AliTPCTenderSupply, 2);  // TPC tender task
+  ClassDef(AliTPCTenderSupply, 3);  // TPC tender task
 };
 
 
@@ -21,6 +21,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <TSystem.h>
+#include <TGraph.h>
 #include "AliESDEvent.h"
 #include "AliTender.h"
 #include "AliVParticle.h"
@@ -38,7 +39,11 @@ fDebug(0),
   fParams(0),
   fOADBObjPath("$OADB/PWGPP/data/CorrPTInv.root"),
   fOADBObjName("CorrPTInv"),
-  fOADBCont(0)
+  fOADBCont(0),
+  fLazy(kFALSE),
+  fEvent(0),
+  fVtx(0),
+  fVtxTPC(0)
 {
   // default ctor
 }
@@ -51,7 +56,11 @@ AliTrackFixTenderSupply::AliTrackFixTenderSupply(const char *name, const AliTend
   fParams(0),
   fOADBObjPath("$OADB/PWGPP/data/CorrPTInv.root"),
   fOADBObjName("CorrPTInv"),
-  fOADBCont(0)
+  fOADBCont(0),
+  fLazy(kFALSE),
+  fEvent(0),
+  fVtx(0),
+  fVtxTPC(0)
 {
   // named ctor
   //
@@ -71,89 +80,153 @@ void AliTrackFixTenderSupply::ProcessEvent()
   //
   // Fix track kinematics
   //
+  if (!PrepareEvent()) return;
+  int nTracks = fEvent->GetNumberOfTracks();
+  if (fLazy) { // tracks are fixed on request
+    fFixed.assign(nTracks,0);
+    return;
+  }
+  //
+  // collect the tracks to fix
+  fBatchTrack.clear();
+  fBatchMode.clear();
+  fBatchSideA.clear();
+  fBatchPhi.clear();
+  int cormode = 0;
+  double sideAfraction = 0, phi = 0;
+  for (int itr=0;itr<nTracks;itr++) {
+    if (!GetTrackInfo(fEvent->GetTrack(itr),cormode,sideAfraction,phi)) continue;
+    fBatchTrack.push_back(itr);
+    fBatchMode.push_back(cormode);
+    fBatchSideA.push_back(sideAfraction);
+    fBatchPhi.push_back(phi);
+  }
+  //
+  // corrections of all the collected tracks from the tabulated parameters
+  int nFix = fBatchTrack.size();
+  fBatchCorrMain.resize(nFix);
+  fBatchCorrInner.resize(nFix);
+  for (int i=0;i<nFix;i++) {
+    fBatchCorrMain[i]  = GetPtInvCorr(fBatchMode[i],fBatchSideA[i],fBatchPhi[i]);
+    fBatchCorrInner[i] = GetPtInvCorr(AliOADBTrackFix::kCorModeTPCInner,fBatchSideA[i],fBatchPhi[i]);
+  }
+  //
+  for (int i=0;i<nFix;i++) FixTrack(fBatchTrack[i],fBatchMode[i],fBatchSideA[i],fBatchPhi[i],fBatchCorrMain[i],fBatchCorrInner[i]);
+  //
+}
+
+//_____________________________________________________
+Bool_t AliTrackFixTenderSupply::PrepareEvent()
+{
+  // get event, run corrections, field and vertices, kFALSE if nothing is to be fixed
+  fEvent = 0;
+  fFixed.clear();
   AliESDEvent *event=fTender->GetEvent();
-  if (!event) return;
+  if (!event) return kFALSE;
   //
-  if (fTender->RunChanged() && !GetRunCorrections(fTender->GetRun())) return;
+  if (fTender->RunChanged() && !GetRunCorrections(fTender->GetRun())) return kFALSE;
+  if (!fParams) return kFALSE;
   //
-  int nTracks = event->GetNumberOfTracks();
   fBz = event->GetMagneticField();
-  if (TMath::Abs(fBz) < kAlmost0Field) return;
+  if (TMath::Abs(fBz) < kAlmost0Field) return kFALSE;
   //
-  const AliESDVertex *vtx = 0, *vtxTPC = 0;
+  fVtx = event->GetPrimaryVertexTracks(); // vertex to be used for update via RelateToVertex
+  if (!fVtx || fVtx->GetStatus()<1) {
+    fVtx = event->GetPrimaryVertexSPD();
+    if (fVtx && fVtx->GetStatus()<1) fVtx = 0;
+  }
+  fVtxTPC = event->GetPrimaryVertexTPC(); // vertex to be used for update via RelateToVertexTPC
+  if (fVtxTPC && fVtxTPC->GetStatus()<1) fVtxTPC = 0;
   //
-  vtx = event->GetPrimaryVertexTracks(); // vertex to be used for update via RelateToVertex
-  if (!vtx || vtx->GetStatus()<1) {
-    vtx = event->GetPrimaryVertexSPD();
-    if (vtx && vtx->GetStatus()<1) vtx = 0;
+  fEvent = event;
+  return kTRUE;
+}
+
+//_____________________________________________________
+Bool_t AliTrackFixTenderSupply::GetTrackInfo(const AliESDtrack* trc, Int_t& cormode, Double_t& sideAfraction, Double_t& phi) const
+{
+  // correction mode, A side fraction and phi of the track, kFALSE if the track is not to be fixed
+  if (!trc || !trc->IsOn(AliESDtrack::kTPCin)) return kFALSE;
+  const AliExternalTrackParam* parInner = trc->GetInnerParam();
+  if (!parInner) {
+    AliError("Failed to extract inner param");
+    return kFALSE;
   }
-  vtxTPC = event->GetPrimaryVertexTPC(); // vertex to be used for update via RelateToVertexTPC
-  if (vtxTPC && vtxTPC->GetStatus()<1) vtxTPC = 0;
-  //  
-  AliExternalTrackParam* extPar = 0;
-  double xOrig = 0;
+  sideAfraction = GetSideAFraction(trc);
+  cormode = trc->IsOn(AliESDtrack::kITSin) ? AliOADBTrackFix::kCorModeGlob : AliOADBTrackFix::kCorModeTPCInner;
   double xyzTPCInner[3] = {0,0,0};
-  for (int itr=0;itr<nTracks;itr++) {
-    //
-    AliESDtrack* trc = event->GetTrack(itr);
-    if (!trc->IsOn(AliESDtrack::kTPCin)) continue;
-    //
-    double sideAfraction = GetSideAFraction(trc);
-    // correct the main parameterization
-    int cormode = trc->IsOn(AliESDtrack::kITSin) ? AliOADBTrackFix::kCorModeGlob : AliOADBTrackFix::kCorModeTPCInner;
-    xOrig = trc->GetX();
-    double xIniCor = fParams->GetXIniPtInvCorr(cormode);
-    const AliExternalTrackParam* parInner = trc->GetInnerParam();
-    if (!parInner) {
-      AliError("Failed to extract inner param");
-      continue;
-    }
-    parInner->GetXYZ(xyzTPCInner);
-    double phi = TMath::ATan2(xyzTPCInner[1],xyzTPCInner[0]);
-    if (phi<0) phi += 2*TMath::Pi();
-    //
-    if (fDebug>1) {
-      AliInfo(Form("Tr:%4d kITSin:%d Phi=%+5.2f at X=%+7.2f | SideA fraction: %.3f",itr,trc->IsOn(AliESDtrack::kITSin),phi,parInner->GetX(),sideAfraction));
-      AliInfo(Form("Main Param before corr. in mode %s, xIni:%.1f",cormode== AliOADBTrackFix::kCorModeGlob ?  "Glo":"TPC",xIniCor));
-      trc->AliExternalTrackParam::Print();
-    }
-    //
-    if (xIniCor>0) trc->PropagateTo(xIniCor,fBz);
-    CorrectTrackPtInv(trc, cormode, sideAfraction, phi);
-    if (xIniCor>0) {                             // full update is requested
-      if (vtx) trc->RelateToVertex(vtx, fBz, kVeryBig); // redo DCA if vtx is available
-      else     trc->PropagateTo(xOrig, fBz);            // otherwise bring to original point
-    }
-    // 
-    if (fDebug>1) {
-      AliInfo("Main Param after corr.");
-      trc->AliExternalTrackParam::Print();
-    }
-    // correct TPCinner param
-    if ( (extPar=(AliExternalTrackParam*)trc->GetTPCInnerParam()) ) {
-      cormode = AliOADBTrackFix::kCorModeTPCInner;
-      xOrig = extPar->GetX();
-      xIniCor = fParams->GetXIniPtInvCorr(cormode);
-      if (fDebug>1) {
-	AliInfo(Form("TPCinner Param before corr. in mode %s, xIni:%.1f",cormode== AliOADBTrackFix::kCorModeGlob ?  "Glo":"TPC",xIniCor));
-	extPar->AliExternalTrackParam::Print();
-      }
-      //
-      if (xIniCor>0) extPar->PropagateTo(xIniCor,fBz);
-      CorrectTrackPtInv(extPar,cormode,sideAfraction, phi);
-      if (xIniCor>0) {                              // full update is requested
-	if (vtxTPC) trc->RelateToVertexTPC(vtxTPC, fBz, kVeryBig);  // redo DCA if vtx is available
-	else        extPar->PropagateTo(xOrig, fBz);                // otherwise bring to original point
-      }
-      //
-      if (fDebug>1) {
-	AliInfo("TPCinner Param after corr.");
-	extPar->AliExternalTrackParam::Print();
-      }      
-    }
-    //
+  parInner->GetXYZ(xyzTPCInner);
+  phi = TMath::ATan2(xyzTPCInner[1],xyzTPCInner[0]);
+  if (phi<0) phi += 2*TMath::Pi();
+  return kTRUE;
+}
+
+//_____________________________________________________
+void AliTrackFixTenderSupply::FixTrack(Int_t itr, Int_t cormode, Double_t sideAfraction, Double_t phi, Double_t corrMain, Double_t corrInner)
+{
+  // apply the precomputed 1/pt corrections to the main and TPCinner params of the track
+  AliESDtrack* trc = fEvent->GetTrack(itr);
+  // correct the main parameterization
+  double xOrig = trc->GetX();
+  double xIniCor = fParams->GetXIniPtInvCorr(cormode);
+  //
+  if (fDebug>1) {
+    AliInfo(Form("Tr:%4d kITSin:%d Phi=%+5.2f at X=%+7.2f | SideA fraction: %.3f",itr,trc->IsOn(AliESDtrack::kITSin),phi,trc->GetInnerParam()->GetX(),sideAfraction));
+    AliInfo(Form("Main Param before corr. in mode %s, xIni:%.1f",cormode== AliOADBTrackFix::kCorModeGlob ?  "Glo":"TPC",xIniCor));
+    trc->AliExternalTrackParam::Print();
+  }
+  //
+  if (xIniCor>0) trc->PropagateTo(xIniCor,fBz);
+  ((double*)trc->GetParameter())[4] += corrMain;
+  if (xIniCor>0) {                             // full update is requested
+    if (fVtx) trc->RelateToVertex(fVtx, fBz, kVeryBig); // redo DCA if vtx is available
+    else      trc->PropagateTo(xOrig, fBz);             // otherwise bring to original point
+  }
+  // 
+  if (fDebug>1) {
+    AliInfo("Main Param after corr.");
+    trc->AliExternalTrackParam::Print();
+  }
+  // correct TPCinner param
+  AliExternalTrackParam* extPar = (AliExternalTrackParam*)trc->GetTPCInnerParam();
+  if (!extPar) return;
+  cormode = AliOADBTrackFix::kCorModeTPCInner;
+  xOrig = extPar->GetX();
+  xIniCor = fParams->GetXIniPtInvCorr(cormode);
+  if (fDebug>1) {
+    AliInfo(Form("TPCinner Param before corr. in mode %s, xIni:%.1f",cormode== AliOADBTrackFix::kCorModeGlob ?  "Glo":"TPC",xIniCor));
+    extPar->AliExternalTrackParam::Print();
+  }
+  //
+  if (xIniCor>0) extPar->PropagateTo(xIniCor,fBz);
+  ((double*)extPar->GetParameter())[4] += corrInner;
+  if (xIniCor>0) {                              // full update is requested
+    if (fVtxTPC) trc->RelateToVertexTPC(fVtxTPC, fBz, kVeryBig);  // redo DCA if vtx is available
+    else         extPar->PropagateTo(xOrig, fBz);                 // otherwise bring to original point
   }
   //
+  if (fDebug>1) {
+    AliInfo("TPCinner Param after corr.");
+    extPar->AliExternalTrackParam::Print();
+  }
+  //
+}
+
+//_____________________________________________________
+AliESDtrack* AliTrackFixTenderSupply::GetFixedTrack(Int_t itr)
+{
+  // track of the current event with the corrections applied, in the lazy mode they are applied on the first request
+  AliESDEvent *event = fEvent ? fEvent : (fTender ? fTender->GetEvent() : 0);
+  if (!event || itr<0 || itr>=event->GetNumberOfTracks()) return 0;
+  AliESDtrack* trc = event->GetTrack(itr);
+  if (!fLazy || !fEvent || itr>=(int)fFixed.size() || fFixed[itr]) return trc;
+  fFixed[itr] = 1;
+  int cormode = 0;
+  double sideAfraction = 0, phi = 0;
+  if (!GetTrackInfo(trc,cormode,sideAfraction,phi)) return trc;
+  FixTrack(itr,cormode,sideAfraction,phi,GetPtInvCorr(cormode,sideAfraction,phi),
+	   GetPtInvCorr(AliOADBTrackFix::kCorModeTPCInner,sideAfraction,phi));
+  return trc;
 }
 
 //_____________________________________________________
@@ -162,10 +235,46 @@ void AliTrackFixTenderSupply::CorrectTrackPtInv(AliExternalTrackParam* trc, Int_
   // fix track kinematics
   if (!trc) return;
   double *param = (double*)trc->GetParameter();
-  param[4] += fParams->GetPtInvCorr(mode,sideAfraction,phi);
+  param[4] += GetPtInvCorr(mode,sideAfraction,phi);
   //
 }
 
+//_____________________________________________________
+Double_t AliTrackFixTenderSupply::GetPtInvCorr(int mode, double sideAfraction, double phi) const
+{
+  // 1/pt correction from the tabulated parameters, same as AliOADBTrackFix::GetPtInvCorr
+  const std::vector<Double_t> &tabA = fTab[mode][0];
+  int nb = tabA.size();
+  if (!nb) return 0;
+  if (phi<0 || phi>2*TMath::Pi()) {
+    while (phi>2*TMath::Pi()) phi -= 2*TMath::Pi();
+    while (phi<0) phi += 2*TMath::Pi();
+  }
+  int bin = int( phi/(2*TMath::Pi())*nb );
+  if (bin>=nb) bin = nb-1;
+  return sideAfraction*tabA[bin] + (1.-sideAfraction)*fTab[mode][1][bin];
+}
+
+//_____________________________________________________
+void AliTrackFixTenderSupply::TabulateCorrections()
+{
+  // copy the correction graphs of the run to dense arrays
+  for (int imd=0;imd<AliOADBTrackFix::kNCorModes;imd++) {
+    for (int iside=0;iside<2;iside++) fTab[imd][iside].clear();
+    if (!fParams) continue;
+    const TGraph* grA = fParams->GetPtInvCorrGraph(imd,0);
+    const TGraph* grC = fParams->GetPtInvCorrGraph(imd,1);
+    if (!grA || !grC || grA->GetN()<1) continue;
+    int nb = grA->GetN();
+    if (grC->GetN()<nb) {
+      AliError(Form("Correction graphs of mode %d have different number of points: %d %d",imd,nb,grC->GetN()));
+      continue;
+    }
+    fTab[imd][0].assign(grA->GetY(),grA->GetY()+nb);
+    fTab[imd][1].assign(grC->GetY(),grC->GetY()+nb);
+  }
+}
+
 //_____________________________________________________
 Bool_t AliTrackFixTenderSupply::LoadOADBObjects()
 {
@@ -191,9 +300,11 @@ Bool_t AliTrackFixTenderSupply::GetRunCorrections(int run)
 {
   // extract corrections for given run
   fParams = 0;
+  TabulateCorrections();
   if (!fOADBCont) if (!LoadOADBObjects()) return kFALSE;
   fParams = dynamic_cast<AliOADBTrackFix*>(fOADBCont->GetObject(run,"default"));
   if (!fParams) {AliError(Form("No correction parameters for found for run %d",run)); return kFALSE;}
+  TabulateCorrections();
   AliInfo(Form("Loaded correction parameters for run %d",run));
   //
   return kTRUE;
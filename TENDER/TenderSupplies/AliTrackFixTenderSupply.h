@@ -10,18 +10,23 @@
 //                                                                    //
 //  19/06/2012: RS: Add 1/pt shift from AODB to TPC and TPC-ITS       //
 //                  Optionally correct also track coordinate          //
+//  The corrections are tabulated per run and computed for all the    //
+//  tracks of the event in one pass. In the lazy mode the tracks are  //
+//  only fixed when requested via GetFixedTrack                       //
 //                                                                    //
 ////////////////////////////////////////////////////////////////////////
 
 #include <TString.h>
+#include <vector>
 #include "AliTenderSupply.h"
+#include "AliOADBTrackFix.h"
 
 
 class AliESDVertex;
 class AliExternalTrackParam;
 class AliOADBContainer;
 class AliESDtrack;
-class AliOADBTrackFix;
+class AliESDEvent;
 
 class AliTrackFixTenderSupply: public AliTenderSupply {
   
@@ -35,7 +40,12 @@ public:
   //
   Double_t GetSideAFraction(const AliESDtrack* track) const;
   void     CorrectTrackPtInv(AliExternalTrackParam* trc, int mode, double sideAfraction, double phi) const;
+  Double_t GetPtInvCorr(int mode, double sideAfraction, double phi) const;
   Bool_t   GetRunCorrections(int run);
+  //
+  void         SetLazyMode(Bool_t lazy=kTRUE)        { fLazy = lazy; }
+  Bool_t       GetLazyMode()                   const { return fLazy; }
+  AliESDtrack* GetFixedTrack(Int_t itr);
   Bool_t   LoadOADBObjects();
   //
   void     SetOADBObjPath(const char* path)        { fOADBObjPath = path; }
@@ -48,6 +58,11 @@ public:
   //
 private:
   
+  Bool_t   PrepareEvent();
+  void     TabulateCorrections();
+  Bool_t   GetTrackInfo(const AliESDtrack* trc, Int_t& cormode, Double_t& sideAfraction, Double_t& phi) const;
+  void     FixTrack(Int_t itr, Int_t cormode, Double_t sideAfraction, Double_t phi, Double_t corrMain, Double_t corrInner);
+  //
   AliTrackFixTenderSupply(const AliTrackFixTenderSupply&c);
   AliTrackFixTenderSupply& operator= (const AliTrackFixTenderSupply&c);
   //
@@ -57,8 +72,21 @@ private:
   TString           fOADBObjPath;            // path of file with parameters to use, starting from OADB dir
   TString           fOADBObjName;            // name of the corrections object in the OADB container
   AliOADBContainer* fOADBCont;               // OADB container with parameters collection
+  Bool_t            fLazy;                   // fix only the tracks requested via GetFixedTrack
+  //
+  AliESDEvent*         fEvent;               //! event of the current corrections
+  const AliESDVertex*  fVtx;                 //! vertex for the update of the main param
+  const AliESDVertex*  fVtxTPC;              //! vertex for the update of the TPCinner param
+  std::vector<Double_t> fTab[AliOADBTrackFix::kNCorModes][2]; //! tabulated 1/pt corrections vs phi for A,C sides
+  std::vector<char>     fFixed;              //! tracks already fixed in the lazy mode
+  std::vector<Int_t>    fBatchTrack;         //! tracks to fix in the current event
+  std::vector<Int_t>    fBatchMode;          //! correction mode of the main param
+  std::vector<Double_t> fBatchSideA;         //! A side fraction
+  std::vector<Double_t> fBatchPhi;           //! phi at the TPC inner param
+  std::vector<Double_t> fBatchCorrMain;      //! 1/pt correction of the main param
+  std::vector<Double_t> fBatchCorrInner;     //! 1/pt correction of the TPCinner param
   //
-  ClassDef(AliTrackFixTenderSupply, 1);  // track fixing tender task 
+  ClassDef(AliTrackFixTenderSupply, 2);  // track fixing tender task 
 };
 
 